@@ -26,9 +26,11 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_GIF_RECORDING)
     define_if("raylib" SUPPORT_BUSY_WAIT_LOOP)
     define_if("raylib" SUPPORT_EVENTS_WAITING)
+    define_if("raylib" SUPPORT_SIMD_RAYMATH)
     define_if("raylib" SUPPORT_WINMM_HIGHRES_TIMER)
     define_if("raylib" SUPPORT_COMPRESSION_API)
     define_if("raylib" SUPPORT_QUADS_DRAW_MODE)
+    define_if("raylib" SUPPORT_SPATIAL_INDEX)
     define_if("raylib" SUPPORT_IMAGE_EXPORT)
     define_if("raylib" SUPPORT_IMAGE_GENERATION)
     define_if("raylib" SUPPORT_IMAGE_MANIPULATION)
@@ -50,6 +52,8 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_TTF)
     define_if("raylib" SUPPORT_TEXT_MANIPULATION)
     define_if("raylib" SUPPORT_MESH_GENERATION)
+    define_if("raylib" SUPPORT_SIMD_SKINNING)
+    define_if("raylib" SUPPORT_SIMD_COLLISION)
     define_if("raylib" SUPPORT_FILEFORMAT_OBJ)
     define_if("raylib" SUPPORT_FILEFORMAT_MTL)
     define_if("raylib" SUPPORT_FILEFORMAT_IQM)
@@ -88,7 +92,7 @@ if (${CUSTOMIZE_BUILD})
 
     target_compile_definitions("raylib" PUBLIC "DEFAULT_BATCH_DRAWCALLS=256")
     target_compile_definitions("raylib" PUBLIC "MAX_MATRIX_STACK_SIZE=32")
-    target_compile_definitions("raylib" PUBLIC "MAX_SHADER_LOCATIONS=32")
+    target_compile_definitions("raylib" PUBLIC "MAX_SHADER_LOCATIONS=40")
     target_compile_definitions("raylib" PUBLIC "MAX_MATERIAL_MAPS=12")
     target_compile_definitions("raylib" PUBLIC "RL_CULL_DISTANCE_NEAR=0.01")
     target_compile_definitions("raylib" PUBLIC "RL_CULL_DISTANCE_FAR=1000.0")
@@ -100,9 +104,7 @@ if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC "DEFAULT_SHADER_ATTRIB_NAME_TANGENT=\"vertexTangent\"")
     target_compile_definitions("raylib" PUBLIC "DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2=\"vertexTexCoord2\"")
 
-    target_compile_definitions("raylib" PUBLIC "MAX_TEXT_BUFFER_LENGTH=1024")
     target_compile_definitions("raylib" PUBLIC "MAX_TEXT_UNICODE_CHARS=512")
-    target_compile_definitions("raylib" PUBLIC "MAX_TEXTSPLIT_COUNT=128")
 
     target_compile_definitions("raylib" PUBLIC "AUDIO_DEVICE_FORMAT=ma_format_f32")
     target_compile_definitions("raylib" PUBLIC "AUDIO_DEVICE_CHANNELS=2")
@@ -110,6 +112,7 @@ if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC "DEFAULT_AUDIO_BUFFER_SIZE=4096")
 
     target_compile_definitions("raylib" PUBLIC "MAX_TRACELOG_MSG_LENGTH=128")
+    target_compile_definitions("raylib" PUBLIC "MAX_FRAME_MEMORY_SIZE=262144")
     target_compile_definitions("raylib" PUBLIC "MAX_UWP_MESSAGES=512")
 endif ()
 
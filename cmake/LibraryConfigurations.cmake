@@ -47,6 +47,12 @@ elseif (${PLATFORM} MATCHES "Web")
     set(PLATFORM_CPP "PLATFORM_WEB")
     set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
     set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -s USE_GLFW=3 -s ASSERTIONS=1 --profiling")
+    if (WEB_SIMD)
+        set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -msimd128")
+    endif ()
+    if (WEB_THREADS)
+        set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -pthread")
+    endif ()
     set(CMAKE_STATIC_LIBRARY_SUFFIX ".a")
 
 elseif (${PLATFORM} MATCHES "Android")
@@ -91,6 +97,18 @@ elseif ("${PLATFORM}" MATCHES "DRM")
     endif ()
     set(LIBS_PRIVATE ${GLESV2} ${EGL} ${DRM} ${GBM} atomic pthread m dl)
 
+elseif ("${PLATFORM}" MATCHES "Headless")
+    set(PLATFORM_CPP "PLATFORM_HEADLESS")
+    set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
+
+    add_definitions(-D_DEFAULT_SOURCE)
+    add_definitions(-DEGL_NO_X11)
+    add_definitions(-DPLATFORM_HEADLESS)
+
+    find_library(GLESV2 GLESv2)
+    find_library(EGL EGL)
+    set(LIBS_PRIVATE ${GLESV2} ${EGL} atomic pthread m dl)
+
 endif ()
 
 if (NOT ${OPENGL_VERSION})
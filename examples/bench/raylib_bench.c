@@ -0,0 +1,579 @@
+/*******************************************************************************************
+*
+*   raylib_bench - Benchmark harness built from examples scenes
+*
+*   Runs a set of scenes taken from examples (bunnymark, model animation, mesh instancing,
+*   font loading) for a fixed number of frames and reports results as JSON:
+*     - Load time per scene (resources loading and setup)
+*     - Frame time statistics (average, percentiles, max), measured by raylib (GetFrameTimeStats())
+*     - Render statistics per frame (draw calls, vertex, texture binds...) from rlGetRenderStats()
+*
+*   Scenes are updated with a fixed timestep and random values are seeded with SetRandomSeed(),
+*   so every run does the same work, results can be compared between raylib builds
+*
+*   NOTE: Frame rate is not limited (no target FPS, no VSync), PLATFORM_HEADLESS can be used
+*   to run it on machines without display. Frame time statistics consider the last
+*   MAX_FRAME_TIME_SAMPLES frames measured (raylib config.h), log messages go to stderr
+*
+*   USAGE: raylib_bench [--frames <n>] [--warmup <n>] [--seed <n>] [--output <file.json>] [scene ...]
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"               // Required for: rlGetRenderStats(), rlGetVersion()
+
+#define RLIGHTS_IMPLEMENTATION
+#include "../shaders/rlights.h"
+
+#include <stdio.h>              // Required for: fopen(), fprintf(), fclose()
+#include <stdlib.h>             // Required for: atoi(), strtoul()
+#include <string.h>             // Required for: strcmp()
+#include <stdarg.h>             // Required for: va_list [Used in TraceLogStderr()]
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_TIMESTEP          (1.0f/60.0f)    // Fixed timestep used to update scenes (seconds)
+#define BENCH_DEFAULT_FRAMES          600       // Frames measured per scene
+#define BENCH_DEFAULT_WARMUP           30       // Frames run before measuring (shaders compilation, caches)
+#define BENCH_DEFAULT_SEED     0x5eed1234       // Default random seed
+
+#define MAX_BUNNIES                 50000       // Bunnymark: bunnies limit
+#define BUNNIES_PER_FRAME             100       // Bunnymark: bunnies added per frame
+#define MAX_INSTANCES               10000       // Mesh instancing: cubes instances
+#define ANIMATION_FPS                60.0f      // Model animation: animation frames per second
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark scene, load/update/draw/unload functions
+typedef struct BenchScene {
+    const char *name;                   // Scene name (example it comes from)
+    bool (*Load)(void);                 // Load scene resources, returns false on failure
+    void (*Update)(float dt);           // Update scene with fixed timestep
+    void (*Draw)(void);                 // Draw scene (inside BeginDrawing()/EndDrawing())
+    void (*Unload)(void);               // Unload scene resources
+} BenchScene;
+
+// Benchmark scene results
+typedef struct BenchResult {
+    bool loaded;                        // Scene loaded successfully
+    double loadTime;                    // Load time (seconds)
+    double runTime;                     // Measured frames total time (seconds)
+    FrameTimeStats frameTime;           // Frame time statistics
+    int frames;                         // Measured frames
+    double drawCalls;                   // Draw calls per frame (average)
+    int drawCallsMax;                   // Draw calls in a frame (maximum)
+    double batchFlushes;                // Render batch flushes per frame (average)
+    double vertexCount;                 // Vertex drawn per frame (average)
+    double textureBinds;                // Texture bindings per frame (average)
+    double shaderSwitches;              // Shader changes per frame (average)
+    double bytesUploaded;               // Bytes uploaded to GPU per frame (average)
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const int screenWidth = 800;
+static const int screenHeight = 450;
+
+static int glslVersion = 330;           // Shaders version, depends on OpenGL version available
+static float sceneTime = 0.0f;          // Current scene time, advanced by fixed timestep
+
+//----------------------------------------------------------------------------------
+// Scene: textures_bunnymark
+//----------------------------------------------------------------------------------
+typedef struct Bunny {
+    Vector2 position;
+    Vector2 speed;
+    Color color;
+} Bunny;
+
+static Texture2D texBunny = { 0 };
+static Bunny *bunnies = NULL;
+static int bunniesCount = 0;
+
+static bool LoadBunnymark(void)
+{
+    texBunny = LoadTexture("resources/wabbit_alpha.png");
+    bunnies = (Bunny *)RL_CALLOC(MAX_BUNNIES, sizeof(Bunny));
+    bunniesCount = 0;
+
+    return (texBunny.id > 0);
+}
+
+static void UpdateBunnymark(float dt)
+{
+    // Add bunnies at random positions every frame, load increases until MAX_BUNNIES
+    for (int i = 0; (i < BUNNIES_PER_FRAME) && (bunniesCount < MAX_BUNNIES); i++, bunniesCount++)
+    {
+        bunnies[bunniesCount].position = (Vector2){ (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(40, screenHeight) };
+        bunnies[bunniesCount].speed.x = (float)GetRandomValue(-250, 250);
+        bunnies[bunniesCount].speed.y = (float)GetRandomValue(-250, 250);
+        bunnies[bunniesCount].color = (Color){ GetRandomValue(50, 240), GetRandomValue(80, 240), GetRandomValue(100, 240), 255 };
+    }
+
+    for (int i = 0; i < bunniesCount; i++)
+    {
+        bunnies[i].position.x += bunnies[i].speed.x*dt;
+        bunnies[i].position.y += bunnies[i].speed.y*dt;
+
+        if (((bunnies[i].position.x + texBunny.width/2) > screenWidth) ||
+            ((bunnies[i].position.x + texBunny.width/2) < 0)) bunnies[i].speed.x *= -1;
+        if (((bunnies[i].position.y + texBunny.height/2) > screenHeight) ||
+            ((bunnies[i].position.y + texBunny.height/2 - 40) < 0)) bunnies[i].speed.y *= -1;
+    }
+}
+
+static void DrawBunnymark(void)
+{
+    ClearBackground(RAYWHITE);
+
+    for (int i = 0; i < bunniesCount; i++) DrawTexture(texBunny, (int)bunnies[i].position.x, (int)bunnies[i].position.y, bunnies[i].color);
+
+    DrawRectangle(0, 0, screenWidth, 40, BLACK);
+    DrawText(TextFormat("bunnies: %i", bunniesCount), 120, 10, 20, GREEN);
+}
+
+static void UnloadBunnymark(void)
+{
+    RL_FREE(bunnies);
+    bunnies = NULL;
+    UnloadTexture(texBunny);
+}
+
+//----------------------------------------------------------------------------------
+// Scene: models_animation
+//----------------------------------------------------------------------------------
+static Model guyModel = { 0 };
+static Texture2D guyTexture = { 0 };
+static ModelAnimation *guyAnims = NULL;
+static unsigned int guyAnimsCount = 0;
+static int guyAnimFrame = 0;
+
+static bool LoadModelsAnimation(void)
+{
+    guyModel = LoadModel("resources/models/iqm/guy.iqm");
+    guyTexture = LoadTexture("resources/models/iqm/guytex.png");
+    SetMaterialTexture(&guyModel.materials[0], MATERIAL_MAP_DIFFUSE, guyTexture);
+
+    guyAnims = LoadModelAnimations("resources/models/iqm/guyanim.iqm", &guyAnimsCount);
+    guyAnimFrame = 0;
+
+    return ((guyModel.meshCount > 0) && (guyAnimsCount > 0));
+}
+
+static void UpdateModelsAnimation(float dt)
+{
+    guyAnimFrame = (int)(sceneTime*ANIMATION_FPS)%guyAnims[0].frameCount;
+    UpdateModelAnimation(guyModel, guyAnims[0], guyAnimFrame);
+}
+
+static void DrawModelsAnimation(void)
+{
+    // Camera orbits around the model, position depends on scene time only
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 10.0f*cosf(sceneTime*0.5f), 10.0f, 10.0f*sinf(sceneTime*0.5f) };
+    camera.target = (Vector3){ 0.0f, 2.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    ClearBackground(RAYWHITE);
+
+    BeginMode3D(camera);
+
+        DrawModelEx(guyModel, Vector3Zero(), (Vector3){ 1.0f, 0.0f, 0.0f }, -90.0f, Vector3One(), WHITE);
+
+        for (int i = 0; i < guyModel.boneCount; i++) DrawCube(guyAnims[0].framePoses[guyAnimFrame][i].translation, 0.2f, 0.2f, 0.2f, RED);
+
+        DrawGrid(10, 1.0f);
+
+    EndMode3D();
+}
+
+static void UnloadModelsAnimation(void)
+{
+    UnloadTexture(guyTexture);
+    UnloadModelAnimations(guyAnims, guyAnimsCount);
+    UnloadModel(guyModel);
+    guyAnims = NULL;
+}
+
+//----------------------------------------------------------------------------------
+// Scene: shaders_mesh_instancing
+//----------------------------------------------------------------------------------
+static Mesh cube = { 0 };
+static Matrix *transforms = NULL;
+static Shader shaderInstancing = { 0 };
+static Material matInstances = { 0 };
+static Material matDefault = { 0 };
+
+static bool LoadMeshInstancing(void)
+{
+    cube = GenMeshCube(1.0f, 1.0f, 1.0f);
+
+    transforms = (Matrix *)RL_CALLOC(MAX_INSTANCES, sizeof(Matrix));
+
+    for (int i = 0; i < MAX_INSTANCES; i++)
+    {
+        Matrix translation = MatrixTranslate((float)GetRandomValue(-50, 50), (float)GetRandomValue(-50, 50), (float)GetRandomValue(-50, 50));
+        Vector3 axis = Vector3Normalize((Vector3){ (float)GetRandomValue(0, 360), (float)GetRandomValue(0, 360), (float)GetRandomValue(0, 360) });
+        float angle = (float)GetRandomValue(0, 10)*DEG2RAD;
+
+        transforms[i] = MatrixMultiply(MatrixRotate(axis, angle), translation);
+    }
+
+    shaderInstancing = LoadShader(TextFormat("resources/shaders/glsl%i/lighting_instancing.vs", glslVersion),
+                                  TextFormat("resources/shaders/glsl%i/lighting.fs", glslVersion));
+    shaderInstancing.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shaderInstancing, "mvp");
+    shaderInstancing.locs[SHADER_LOC_VECTOR_VIEW] = GetShaderLocation(shaderInstancing, "viewPos");
+    shaderInstancing.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shaderInstancing, "instanceTransform");
+
+    int ambientLoc = GetShaderLocation(shaderInstancing, "ambient");
+    SetShaderValue(shaderInstancing, ambientLoc, (float[4]){ 0.2f, 0.2f, 0.2f, 1.0f }, SHADER_UNIFORM_VEC4);
+
+    CreateLight(LIGHT_DIRECTIONAL, (Vector3){ 50.0f, 50.0f, 0.0f }, Vector3Zero(), WHITE, shaderInstancing);
+
+    matInstances = LoadMaterialDefault();
+    matInstances.shader = shaderInstancing;
+    matInstances.maps[MATERIAL_MAP_DIFFUSE].color = RED;
+
+    matDefault = LoadMaterialDefault();
+    matDefault.maps[MATERIAL_MAP_DIFFUSE].color = BLUE;
+
+    return IsShaderReady(shaderInstancing);
+}
+
+static void UpdateMeshInstancing(float dt)
+{
+    // Instances are rotated every frame, transforms are uploaded to GPU on every draw
+    Matrix rotation = MatrixRotateY(dt*0.5f);
+    for (int i = 0; i < MAX_INSTANCES; i++) transforms[i] = MatrixMultiply(transforms[i], rotation);
+}
+
+static void DrawMeshInstancing(void)
+{
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 125.0f*cosf(sceneTime*0.25f), 125.0f, 125.0f*sinf(sceneTime*0.25f) };
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    float cameraPos[3] = { camera.position.x, camera.position.y, camera.position.z };
+    SetShaderValue(shaderInstancing, shaderInstancing.locs[SHADER_LOC_VECTOR_VIEW], cameraPos, SHADER_UNIFORM_VEC3);
+
+    ClearBackground(RAYWHITE);
+
+    BeginMode3D(camera);
+
+        DrawMesh(cube, matDefault, MatrixTranslate(-10.0f, 0.0f, 0.0f));
+        DrawMeshInstanced(cube, matInstances, transforms, MAX_INSTANCES);
+        DrawMesh(cube, matDefault, MatrixTranslate(10.0f, 0.0f, 0.0f));
+
+    EndMode3D();
+}
+
+static void UnloadMeshInstancing(void)
+{
+    RL_FREE(transforms);
+    transforms = NULL;
+
+    // NOTE: UnloadMaterial() also unloads material shader, default shader is not unloaded
+    UnloadMaterial(matInstances);
+    UnloadMaterial(matDefault);
+    UnloadMesh(cube);
+}
+
+//----------------------------------------------------------------------------------
+// Scene: text_font_loading
+//----------------------------------------------------------------------------------
+static const char *fontMsg = "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHI\nJKLMNOPQRSTUVWXYZ[]^_`abcdefghijklmn\nopqrstuvwxyz{|}~¿ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓ\nÔÕÖ×ØÙÚÛÜÝÞßàáâãäåæçèéêëìíîïðñòóôõö÷\nøùúûüýþÿ";
+static Font fontBm = { 0 };
+static Font fontTtf = { 0 };
+
+static bool LoadTextFontLoading(void)
+{
+    fontBm = LoadFont("resources/pixantiqua.fnt");
+    fontTtf = LoadFontEx("resources/pixantiqua.ttf", 32, 0, 250);
+
+    return (IsFontReady(fontBm) && IsFontReady(fontTtf));
+}
+
+static void UpdateTextFontLoading(float dt)
+{
+    // Nothing to update, text drawing is measured
+}
+
+static void DrawTextFontLoading(void)
+{
+    ClearBackground(RAYWHITE);
+
+    // Both fonts are drawn every frame, text scrolls with scene time
+    float offset = fmodf(sceneTime*20.0f, 40.0f);
+
+    DrawTextEx(fontBm, fontMsg, (Vector2){ 20.0f, 20.0f + offset }, (float)fontBm.baseSize, 2, MAROON);
+    DrawTextEx(fontTtf, fontMsg, (Vector2){ 20.0f, 220.0f + offset }, (float)fontTtf.baseSize, 2, LIME);
+    DrawText(TextFormat("scene time: %.2f", sceneTime), 20, screenHeight - 30, 20, GRAY);
+}
+
+static void UnloadTextFontLoading(void)
+{
+    UnloadFont(fontBm);
+    UnloadFont(fontTtf);
+}
+
+//----------------------------------------------------------------------------------
+// Scenes list
+//----------------------------------------------------------------------------------
+static const BenchScene scenes[] = {
+    { "textures_bunnymark", LoadBunnymark, UpdateBunnymark, DrawBunnymark, UnloadBunnymark },
+    { "models_animation", LoadModelsAnimation, UpdateModelsAnimation, DrawModelsAnimation, UnloadModelsAnimation },
+    { "shaders_mesh_instancing", LoadMeshInstancing, UpdateMeshInstancing, DrawMeshInstancing, UnloadMeshInstancing },
+    { "text_font_loading", LoadTextFontLoading, UpdateTextFontLoading, DrawTextFontLoading, UnloadTextFontLoading },
+};
+
+#define BENCH_SCENES_COUNT  (int)(sizeof(scenes)/sizeof(BenchScene))
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static BenchResult RunScene(const BenchScene *scene, int frames, int warmup, unsigned int seed, bool *aborted);
+static void WriteResults(FILE *file, const BenchResult *results, const bool *selected, int frames, int warmup, unsigned int seed);
+static const char *GetGraphicsName(int version);
+static void TraceLogStderr(int logLevel, const char *text, va_list args);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    int frames = BENCH_DEFAULT_FRAMES;
+    int warmup = BENCH_DEFAULT_WARMUP;
+    unsigned int seed = BENCH_DEFAULT_SEED;
+    const char *outputFileName = NULL;
+
+    bool selected[BENCH_SCENES_COUNT] = { 0 };
+    bool anySelected = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--warmup") == 0) && (i + 1 < argc)) warmup = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc)) seed = (unsigned int)strtoul(argv[++i], NULL, 0);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFileName = argv[++i];
+        else
+        {
+            bool found = false;
+
+            for (int s = 0; s < BENCH_SCENES_COUNT; s++)
+            {
+                if (strcmp(argv[i], scenes[s].name) == 0) { selected[s] = true; found = true; }
+            }
+
+            if (!found)
+            {
+                fprintf(stderr, "USAGE: raylib_bench [--frames <n>] [--warmup <n>] [--seed <n>] [--output <file.json>] [scene ...]\n");
+                fprintf(stderr, "Available scenes:\n");
+                for (int s = 0; s < BENCH_SCENES_COUNT; s++) fprintf(stderr, "    %s\n", scenes[s].name);
+                return 1;
+            }
+
+            anySelected = true;
+        }
+    }
+
+    if (frames < 1) frames = 1;
+    if (warmup < 0) warmup = 0;
+    if (!anySelected) for (int s = 0; s < BENCH_SCENES_COUNT; s++) selected[s] = true;
+
+    // Log messages are sent to stderr, stdout is reserved for results
+    SetTraceLogCallback(TraceLogStderr);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(screenWidth, screenHeight, "raylib_bench");
+
+    glslVersion = (rlGetVersion() == RL_OPENGL_ES_20)? 100 : 330;
+
+    SetTargetFPS(0);        // Frame rate not limited, measure the time frames really take
+    //--------------------------------------------------------------------------------------
+
+    // Run selected scenes
+    //--------------------------------------------------------------------------------------
+    BenchResult results[BENCH_SCENES_COUNT] = { 0 };
+    bool aborted = false;
+
+    for (int s = 0; (s < BENCH_SCENES_COUNT) && !aborted; s++)
+    {
+        if (selected[s]) results[s] = RunScene(&scenes[s], frames, warmup, seed, &aborted);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();
+
+    FILE *file = stdout;
+    if (outputFileName != NULL) file = fopen(outputFileName, "wt");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "raylib_bench: Failed to open output file: %s\n", outputFileName);
+        return 1;
+    }
+
+    WriteResults(file, results, selected, frames, warmup, seed);
+    if (file != stdout) fclose(file);
+    //--------------------------------------------------------------------------------------
+
+    return aborted? 1 : 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Run one scene: load, warmup and measure frames, unload
+static BenchResult RunScene(const BenchScene *scene, int frames, int warmup, unsigned int seed, bool *aborted)
+{
+    BenchResult result = { 0 };
+
+    SetRandomSeed(seed);
+    sceneTime = 0.0f;
+
+    double startTime = GetTime();
+    result.loaded = scene->Load();
+    result.loadTime = GetTime() - startTime;
+
+    if (!result.loaded)
+    {
+        TraceLog(LOG_WARNING, "BENCH: [%s] Scene could not be loaded, check resources path", scene->name);
+        scene->Unload();
+        return result;
+    }
+
+    for (int i = 0; i < (warmup + frames); i++)
+    {
+        if (WindowShouldClose()) { *aborted = true; break; }
+
+        // Frame time statistics only consider measured frames
+        if (i == warmup)
+        {
+            SetFrameTimeStatsWindow(frames);
+            startTime = GetTime();
+        }
+
+        scene->Update(BENCH_TIMESTEP);
+        sceneTime += BENCH_TIMESTEP;
+
+        BeginDrawing();
+            scene->Draw();
+        EndDrawing();
+
+        // NOTE: Render statistics are reset by BeginDrawing(), read them once frame is submitted
+        if (i >= warmup)
+        {
+            rlRenderStats stats = rlGetRenderStats();
+
+            result.frames++;
+            result.drawCalls += stats.drawCalls;
+            result.batchFlushes += stats.batchFlushes;
+            result.vertexCount += stats.vertexCount;
+            result.textureBinds += stats.textureBinds;
+            result.shaderSwitches += stats.shaderSwitches;
+            result.bytesUploaded += stats.bytesUploaded;
+            if (stats.drawCalls > result.drawCallsMax) result.drawCallsMax = stats.drawCalls;
+        }
+    }
+
+    if (result.frames > 0)
+    {
+        result.runTime = GetTime() - startTime;
+        result.frameTime = GetFrameTimeStats();
+        result.drawCalls /= result.frames;
+        result.batchFlushes /= result.frames;
+        result.vertexCount /= result.frames;
+        result.textureBinds /= result.frames;
+        result.shaderSwitches /= result.frames;
+        result.bytesUploaded /= result.frames;
+    }
+
+    scene->Unload();
+
+    return result;
+}
+
+// Write results as JSON, times in milliseconds
+static void WriteResults(FILE *file, const BenchResult *results, const bool *selected, int frames, int warmup, unsigned int seed)
+{
+    fprintf(file, "{\n");
+    fprintf(file, "    \"raylib\": \"%s\",\n", RAYLIB_VERSION);
+    fprintf(file, "    \"graphics\": \"%s\",\n", GetGraphicsName(rlGetVersion()));
+    fprintf(file, "    \"screen\": [%i, %i],\n", screenWidth, screenHeight);
+    fprintf(file, "    \"frames\": %i,\n", frames);
+    fprintf(file, "    \"warmup\": %i,\n", warmup);
+    fprintf(file, "    \"timestep\": %.6f,\n", BENCH_TIMESTEP);
+    fprintf(file, "    \"seed\": %u,\n", seed);
+    fprintf(file, "    \"scenes\": [");
+
+    bool first = true;
+
+    for (int s = 0; s < BENCH_SCENES_COUNT; s++)
+    {
+        if (!selected[s]) continue;
+
+        const BenchResult *r = &results[s];
+
+        fprintf(file, "%s\n        {\n", first? "" : ",");
+        fprintf(file, "            \"name\": \"%s\",\n", scenes[s].name);
+        fprintf(file, "            \"loaded\": %s,\n", r->loaded? "true" : "false");
+        fprintf(file, "            \"load_ms\": %.3f,\n", r->loadTime*1000.0);
+        fprintf(file, "            \"frames\": %i,\n", r->frames);
+        fprintf(file, "            \"run_ms\": %.3f,\n", r->runTime*1000.0);
+        fprintf(file, "            \"frame_ms\": { \"samples\": %i, \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f, \"update\": %.4f, \"draw\": %.4f },\n",
+            r->frameTime.frameCount, r->frameTime.average*1000.0f, r->frameTime.p50*1000.0f, r->frameTime.p95*1000.0f,
+            r->frameTime.p99*1000.0f, r->frameTime.max*1000.0f, r->frameTime.update*1000.0f, r->frameTime.draw*1000.0f);
+        fprintf(file, "            \"render\": { \"draw_calls\": %.2f, \"draw_calls_max\": %i, \"batch_flushes\": %.2f, \"vertex\": %.1f, \"texture_binds\": %.2f, \"shader_switches\": %.2f, \"bytes_uploaded\": %.1f }\n",
+            r->drawCalls, r->drawCallsMax, r->batchFlushes, r->vertexCount, r->textureBinds, r->shaderSwitches, r->bytesUploaded);
+        fprintf(file, "        }");
+
+        first = false;
+    }
+
+    fprintf(file, "\n    ]\n}\n");
+}
+
+// Get graphics API name from rlgl OpenGL version
+static const char *GetGraphicsName(int version)
+{
+    switch (version)
+    {
+        case RL_OPENGL_11: return "OpenGL 1.1";
+        case RL_OPENGL_21: return "OpenGL 2.1";
+        case RL_OPENGL_33: return "OpenGL 3.3";
+        case RL_OPENGL_43: return "OpenGL 4.3";
+        case RL_OPENGL_ES_20: return "OpenGL ES 2.0";
+        default: return "unknown";
+    }
+}
+
+// Trace log callback writing messages to stderr
+static void TraceLogStderr(int logLevel, const char *text, va_list args)
+{
+    switch (logLevel)
+    {
+        case LOG_INFO: fprintf(stderr, "INFO: "); break;
+        case LOG_WARNING: fprintf(stderr, "WARNING: "); break;
+        case LOG_ERROR: fprintf(stderr, "ERROR: "); break;
+        default: break;
+    }
+
+    vfprintf(stderr, text, args);
+    fprintf(stderr, "\n");
+}
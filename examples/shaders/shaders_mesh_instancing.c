@@ -139,6 +139,8 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     RL_FREE(transforms);    // Free transforms
+    UnloadShader(shader);   // Unload shader
+    UnloadMesh(cube);       // Unload cube mesh
 
     CloseWindow();          // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -2,7 +2,7 @@
 *
 *   raylib [textures] example - Bunnymark
 *
-*   Example originally created with raylib 1.6, last time updated with raylib 2.5
+*   Example originally created with raylib 1.6, last time updated with raylib 4.6
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
@@ -13,14 +13,12 @@
 
 #include "raylib.h"
 
+#include "rlgl.h"                   // Required for: rlGetRenderStats()
+
 #include <stdlib.h>                 // Required for: malloc(), free()
 
 #define MAX_BUNNIES        50000    // 50K bunnies limit
 
-// This is the maximum amount of elements (quads) per batch
-// NOTE: This value is defined in [rlgl] module and can be changed there
-#define MAX_BATCH_ELEMENTS  8192
-
 typedef struct Bunny {
     Vector2 position;
     Vector2 speed;
@@ -43,8 +41,10 @@ int main(void)
     Texture2D texBunny = LoadTexture("resources/wabbit_alpha.png");
 
     Bunny *bunnies = (Bunny *)malloc(MAX_BUNNIES*sizeof(Bunny));    // Bunnies array
+    SpriteInstance *sprites = (SpriteInstance *)malloc(MAX_BUNNIES*sizeof(SpriteInstance));    // Bunnies sprites for batch drawing
 
     int bunniesCount = 0;           // Bunnies counter
+    int drawCalls = 0;              // Draw calls issued by last frame
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -72,6 +72,9 @@ int main(void)
             }
         }
 
+        // NOTE: Render statistics are reset by BeginDrawing(), read them before next frame
+        drawCalls = rlGetRenderStats().drawCalls;
+
         // Update bunnies
         for (int i = 0; i < bunniesCount; i++)
         {
@@ -93,18 +96,25 @@ int main(void)
 
             for (int i = 0; i < bunniesCount; i++)
             {
-                // NOTE: When internal batch buffer limit is reached (MAX_BATCH_ELEMENTS),
-                // a draw call is launched and buffer starts being filled again;
-                // before issuing a draw call, updated vertex data from internal CPU buffer is send to GPU...
-                // Process of sending data is costly and it could happen that GPU data has not been completely
-                // processed for drawing while new data is tried to be sent (updating current in-use buffers)
-                // it could generates a stall and consequently a frame drop, limiting the number of drawn bunnies
-                DrawTexture(texBunny, (int)bunnies[i].position.x, (int)bunnies[i].position.y, bunnies[i].color);
+                sprites[i] = (SpriteInstance){
+                    .source = { 0.0f, 0.0f, (float)texBunny.width, (float)texBunny.height },
+                    .dest = { (float)(int)bunnies[i].position.x, (float)(int)bunnies[i].position.y, (float)texBunny.width, (float)texBunny.height },
+                    .tint = bunnies[i].color
+                };
             }
 
+            // NOTE: All bunnies are drawn with one call, texture is set once for all of them.
+            // When internal batch buffer limit is reached (RL_DEFAULT_BATCH_BUFFER_ELEMENTS),
+            // a draw call is launched and buffer starts being filled again;
+            // before issuing a draw call, updated vertex data from internal CPU buffer is send to GPU...
+            // Process of sending data is costly and it could happen that GPU data has not been completely
+            // processed for drawing while new data is tried to be sent (updating current in-use buffers)
+            // it could generates a stall and consequently a frame drop, limiting the number of drawn bunnies
+            DrawTextureBatch(texBunny, sprites, bunniesCount);
+
             DrawRectangle(0, 0, screenWidth, 40, BLACK);
             DrawText(TextFormat("bunnies: %i", bunniesCount), 120, 10, 20, GREEN);
-            DrawText(TextFormat("batched draw calls: %i", 1 + bunniesCount/MAX_BATCH_ELEMENTS), 320, 10, 20, MAROON);
+            DrawText(TextFormat("batched draw calls: %i", drawCalls), 320, 10, 20, MAROON);
 
             DrawFPS(10, 10);
 
@@ -115,6 +125,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     free(bunnies);              // Unload bunnies data array
+    free(sprites);              // Unload bunnies sprites array
 
     UnloadTexture(texBunny);    // Unload bunny texture
 
@@ -15,7 +15,7 @@ return {
     {
       name = "RAYLIB_VERSION_MINOR",
       type = "INT",
-      value = 5,
+      value = 6,
       description = ""
     },
     {
@@ -27,7 +27,7 @@ return {
     {
       name = "RAYLIB_VERSION",
       type = "STRING",
-      value = "4.5",
+      value = "4.6-dev",
       description = ""
     },
     {
@@ -60,28 +60,34 @@ return {
       value = "(180.0f/PI)",
       description = ""
     },
+    {
+      name = "RL_MEMORY_DEFAULT",
+      type = "GUARD",
+      value = "",
+      description = "Default memory allocators in use, required for memory tracking"
+    },
     {
       name = "RL_MALLOC(sz)",
       type = "MACRO",
-      value = "malloc(sz)",
+      value = "MemAllocUninit(sz)",
       description = ""
     },
     {
       name = "RL_CALLOC(n,sz)",
       type = "MACRO",
-      value = "calloc(n,sz)",
+      value = "MemAllocArray(n,sz)",
       description = ""
     },
     {
       name = "RL_REALLOC(ptr,sz)",
       type = "MACRO",
-      value = "realloc(ptr,sz)",
+      value = "MemReallocArray(ptr,1,sz)",
       description = ""
     },
     {
       name = "RL_FREE(ptr)",
       type = "MACRO",
-      value = "free(ptr)",
+      value = "MemFree(ptr)",
       description = ""
     },
     {
@@ -341,15 +347,21 @@ return {
     {
       name = "Vector2",
       description = "Vector2, 2 components",
+      size = 8,
+      alignment = 4,
       fields = {
         {
           type = "float",
           name = "x",
+          offset = 0,
+          size = 4,
           description = "Vector x component"
         },
         {
           type = "float",
           name = "y",
+          offset = 4,
+          size = 4,
           description = "Vector y component"
         }
       }
@@ -357,20 +369,28 @@ return {
     {
       name = "Vector3",
       description = "Vector3, 3 components",
+      size = 12,
+      alignment = 4,
       fields = {
         {
           type = "float",
           name = "x",
+          offset = 0,
+          size = 4,
           description = "Vector x component"
         },
         {
           type = "float",
           name = "y",
+          offset = 4,
+          size = 4,
           description = "Vector y component"
         },
         {
           type = "float",
           name = "z",
+          offset = 8,
+          size = 4,
           description = "Vector z component"
         }
       }
@@ -378,25 +398,35 @@ return {
     {
       name = "Vector4",
       description = "Vector4, 4 components",
+      size = 16,
+      alignment = 4,
       fields = {
         {
           type = "float",
           name = "x",
+          offset = 0,
+          size = 4,
           description = "Vector x component"
         },
         {
           type = "float",
           name = "y",
+          offset = 4,
+          size = 4,
           description = "Vector y component"
         },
         {
           type = "float",
           name = "z",
+          offset = 8,
+          size = 4,
           description = "Vector z component"
         },
         {
           type = "float",
           name = "w",
+          offset = 12,
+          size = 4,
           description = "Vector w component"
         }
       }
@@ -404,85 +434,119 @@ return {
     {
       name = "Matrix",
       description = "Matrix, 4x4 components, column major, OpenGL style, right-handed",
+      size = 64,
+      alignment = 4,
       fields = {
         {
           type = "float",
           name = "m0",
+          offset = 0,
+          size = 4,
           description = "Matrix first row (4 components)"
         },
         {
           type = "float",
           name = "m4",
+          offset = 4,
+          size = 4,
           description = "Matrix first row (4 components)"
         },
         {
           type = "float",
           name = "m8",
+          offset = 8,
+          size = 4,
           description = "Matrix first row (4 components)"
         },
         {
           type = "float",
           name = "m12",
+          offset = 12,
+          size = 4,
           description = "Matrix first row (4 components)"
         },
         {
           type = "float",
           name = "m1",
+          offset = 16,
+          size = 4,
           description = "Matrix second row (4 components)"
         },
         {
           type = "float",
           name = "m5",
+          offset = 20,
+          size = 4,
           description = "Matrix second row (4 components)"
         },
         {
           type = "float",
           name = "m9",
+          offset = 24,
+          size = 4,
           description = "Matrix second row (4 components)"
         },
         {
           type = "float",
           name = "m13",
+          offset = 28,
+          size = 4,
           description = "Matrix second row (4 components)"
         },
         {
           type = "float",
           name = "m2",
+          offset = 32,
+          size = 4,
           description = "Matrix third row (4 components)"
         },
         {
           type = "float",
           name = "m6",
+          offset = 36,
+          size = 4,
           description = "Matrix third row (4 components)"
         },
         {
           type = "float",
           name = "m10",
+          offset = 40,
+          size = 4,
           description = "Matrix third row (4 components)"
         },
         {
           type = "float",
           name = "m14",
+          offset = 44,
+          size = 4,
           description = "Matrix third row (4 components)"
         },
         {
           type = "float",
           name = "m3",
+          offset = 48,
+          size = 4,
           description = "Matrix fourth row (4 components)"
         },
         {
           type = "float",
           name = "m7",
+          offset = 52,
+          size = 4,
           description = "Matrix fourth row (4 components)"
         },
         {
           type = "float",
           name = "m11",
+          offset = 56,
+          size = 4,
           description = "Matrix fourth row (4 components)"
         },
         {
           type = "float",
           name = "m15",
+          offset = 60,
+          size = 4,
           description = "Matrix fourth row (4 components)"
         }
       }
@@ -490,25 +554,35 @@ return {
     {
       name = "Color",
       description = "Color, 4 components, R8G8B8A8 (32bit)",
+      size = 4,
+      alignment = 1,
       fields = {
         {
           type = "unsigned char",
           name = "r",
+          offset = 0,
+          size = 1,
           description = "Color red value"
         },
         {
           type = "unsigned char",
           name = "g",
+          offset = 1,
+          size = 1,
           description = "Color green value"
         },
         {
           type = "unsigned char",
           name = "b",
+          offset = 2,
+          size = 1,
           description = "Color blue value"
         },
         {
           type = "unsigned char",
           name = "a",
+          offset = 3,
+          size = 1,
           description = "Color alpha value"
         }
       }
@@ -516,87 +590,350 @@ return {
     {
       name = "Rectangle",
       description = "Rectangle, 4 components",
+      size = 16,
+      alignment = 4,
       fields = {
         {
           type = "float",
           name = "x",
+          offset = 0,
+          size = 4,
           description = "Rectangle top-left corner position x"
         },
         {
           type = "float",
           name = "y",
+          offset = 4,
+          size = 4,
           description = "Rectangle top-left corner position y"
         },
         {
           type = "float",
           name = "width",
+          offset = 8,
+          size = 4,
           description = "Rectangle width"
         },
         {
           type = "float",
           name = "height",
+          offset = 12,
+          size = 4,
           description = "Rectangle height"
         }
       }
     },
+    {
+      name = "PolygonIndex",
+      description = "PolygonIndex, polygon edges sorted in horizontal rows (fast point in polygon checks)",
+      size = 56,
+      alignment = 8,
+      fields = {
+        {
+          type = "Rectangle",
+          name = "bounds",
+          offset = 0,
+          size = 16,
+          description = "Polygon bounding rectangle"
+        },
+        {
+          type = "int",
+          name = "rowCount",
+          offset = 16,
+          size = 4,
+          description = "Number of rows (bounds split vertically)"
+        },
+        {
+          type = "int",
+          name = "pointCount",
+          offset = 20,
+          size = 4,
+          description = "Number of polygon points"
+        },
+        {
+          type = "Vector2 *",
+          name = "points",
+          offset = 24,
+          size = 8,
+          description = "Polygon points (copied)"
+        },
+        {
+          type = "int *",
+          name = "rowOffsets",
+          offset = 32,
+          size = 8,
+          description = "Rows first edge in rowEdges (rowCount + 1)"
+        },
+        {
+          type = "int *",
+          name = "rowSpanCounts",
+          offset = 40,
+          size = 8,
+          description = "Rows edges spanning the full row height, first in row edges, sorted left to right"
+        },
+        {
+          type = "int *",
+          name = "rowEdges",
+          offset = 48,
+          size = 8,
+          description = "Rows edges (edge i goes from point i to next point)"
+        }
+      }
+    },
+    {
+      name = "Spline",
+      description = "Spline, control points with cached tessellation (DrawSpline())",
+      size = 56,
+      alignment = 8,
+      fields = {
+        {
+          type = "int",
+          name = "type",
+          offset = 0,
+          size = 4,
+          description = "Spline type (SplineType)"
+        },
+        {
+          type = "int",
+          name = "pointCount",
+          offset = 4,
+          size = 4,
+          description = "Number of control points"
+        },
+        {
+          type = "Vector2 *",
+          name = "points",
+          offset = 8,
+          size = 8,
+          description = "Control points"
+        },
+        {
+          type = "int",
+          name = "vertexCount",
+          offset = 16,
+          size = 4,
+          description = "Number of tessellated points"
+        },
+        {
+          type = "Vector2 *",
+          name = "vertices",
+          offset = 24,
+          size = 8,
+          description = "Tessellated points"
+        },
+        {
+          type = "Vector2 *",
+          name = "normals",
+          offset = 32,
+          size = 8,
+          description = "Tessellated points normals (miter scaled)"
+        },
+        {
+          type = "float *",
+          name = "lengths",
+          offset = 40,
+          size = 8,
+          description = "Tessellated points distance from spline start (arc length)"
+        },
+        {
+          type = "float",
+          name = "tolerance",
+          offset = 48,
+          size = 4,
+          description = "Tessellation tolerance in spline units (0: tessellation required)"
+        }
+      }
+    },
     {
       name = "Image",
       description = "Image, pixel data stored in CPU memory (RAM)",
+      size = 24,
+      alignment = 8,
       fields = {
         {
           type = "void *",
           name = "data",
+          offset = 0,
+          size = 8,
           description = "Image raw data"
         },
         {
           type = "int",
           name = "width",
+          offset = 8,
+          size = 4,
           description = "Image base width"
         },
         {
           type = "int",
           name = "height",
+          offset = 12,
+          size = 4,
           description = "Image base height"
         },
         {
           type = "int",
           name = "mipmaps",
+          offset = 16,
+          size = 4,
           description = "Mipmap levels, 1 by default"
         },
         {
           type = "int",
           name = "format",
+          offset = 20,
+          size = 4,
           description = "Data format (PixelFormat type)"
         }
       }
     },
+    {
+      name = "ImageResizeContext",
+      description = "ImageResizeContext, scratch buffers reused by repeated image resizes (ImageResizeEx())",
+      size = 16,
+      alignment = 8,
+      fields = {
+        {
+          type = "bool",
+          name = "srgb",
+          offset = 0,
+          size = 1,
+          description = "Color channels filtered in linear space, alpha weighted (8 bit formats)"
+        },
+        {
+          type = "int",
+          name = "bufferCount",
+          offset = 4,
+          size = 4,
+          description = "Scratch buffers count (one per resized rows slice)"
+        },
+        {
+          type = "void **",
+          name = "buffers",
+          offset = 8,
+          size = 8,
+          description = "Scratch buffers"
+        }
+      }
+    },
+    {
+      name = "AnimImage",
+      description = "AnimImage, animated image (GIF, APNG) decoded frame by frame into image",
+      size = 40,
+      alignment = 8,
+      fields = {
+        {
+          type = "Image",
+          name = "image",
+          offset = 0,
+          size = 24,
+          description = "Current frame image (RGBA)"
+        },
+        {
+          type = "int",
+          name = "frameCount",
+          offset = 24,
+          size = 4,
+          description = "Total number of frames"
+        },
+        {
+          type = "int",
+          name = "currentFrame",
+          offset = 28,
+          size = 4,
+          description = "Current frame index"
+        },
+        {
+          type = "void *",
+          name = "ctxData",
+          offset = 32,
+          size = 8,
+          description = "Animated image decoder context data"
+        }
+      }
+    },
+    {
+      name = "TiledImage",
+      description = "TiledImage, big image split in fixed size tiles, tiles loaded on demand (file or callback) and cached",
+      size = 24,
+      alignment = 8,
+      fields = {
+        {
+          type = "int",
+          name = "width",
+          offset = 0,
+          size = 4,
+          description = "Image width"
+        },
+        {
+          type = "int",
+          name = "height",
+          offset = 4,
+          size = 4,
+          description = "Image height"
+        },
+        {
+          type = "int",
+          name = "format",
+          offset = 8,
+          size = 4,
+          description = "Data format (PixelFormat type), uncompressed formats only"
+        },
+        {
+          type = "int",
+          name = "tileSize",
+          offset = 12,
+          size = 4,
+          description = "Tiles size (square)"
+        },
+        {
+          type = "void *",
+          name = "ctxData",
+          offset = 16,
+          size = 8,
+          description = "Tiled image context data (tiles cache), shared by region views"
+        }
+      }
+    },
     {
       name = "Texture",
       description = "Texture, tex data stored in GPU memory (VRAM)",
+      size = 20,
+      alignment = 4,
       fields = {
         {
           type = "unsigned int",
           name = "id",
+          offset = 0,
+          size = 4,
           description = "OpenGL texture id"
         },
         {
           type = "int",
           name = "width",
+          offset = 4,
+          size = 4,
           description = "Texture base width"
         },
         {
           type = "int",
           name = "height",
+          offset = 8,
+          size = 4,
           description = "Texture base height"
         },
         {
           type = "int",
           name = "mipmaps",
+          offset = 12,
+          size = 4,
           description = "Mipmap levels, 1 by default"
         },
         {
           type = "int",
           name = "format",
+          offset = 16,
+          size = 4,
           description = "Data format (PixelFormat type)"
         }
       }
@@ -604,87 +941,272 @@ return {
     {
       name = "RenderTexture",
       description = "RenderTexture, fbo for texture rendering",
+      size = 44,
+      alignment = 4,
       fields = {
         {
           type = "unsigned int",
           name = "id",
+          offset = 0,
+          size = 4,
           description = "OpenGL framebuffer object id"
         },
         {
           type = "Texture",
           name = "texture",
+          offset = 4,
+          size = 20,
           description = "Color buffer attachment texture"
         },
         {
           type = "Texture",
           name = "depth",
+          offset = 24,
+          size = 20,
           description = "Depth buffer attachment texture"
         }
       }
     },
+    {
+      name = "VideoTexture",
+      description = "VideoTexture, video frames streamed into texture (YUV planes converted on GPU)",
+      size = 40,
+      alignment = 8,
+      fields = {
+        {
+          type = "Texture2D",
+          name = "texture",
+          offset = 0,
+          size = 20,
+          description = "Current frame texture (RGBA)"
+        },
+        {
+          type = "int",
+          name = "frameCount",
+          offset = 20,
+          size = 4,
+          description = "Total number of frames (0: unknown)"
+        },
+        {
+          type = "float",
+          name = "frameRate",
+          offset = 24,
+          size = 4,
+          description = "Frames per second"
+        },
+        {
+          type = "bool",
+          name = "looping",
+          offset = 28,
+          size = 1,
+          description = "Video looping enable"
+        },
+        {
+          type = "void *",
+          name = "ctxData",
+          offset = 32,
+          size = 8,
+          description = "Video decoder context data"
+        }
+      }
+    },
     {
       name = "NPatchInfo",
       description = "NPatchInfo, n-patch layout info",
+      size = 36,
+      alignment = 4,
       fields = {
         {
           type = "Rectangle",
           name = "source",
+          offset = 0,
+          size = 16,
           description = "Texture source rectangle"
         },
         {
           type = "int",
           name = "left",
+          offset = 16,
+          size = 4,
           description = "Left border offset"
         },
         {
           type = "int",
           name = "top",
+          offset = 20,
+          size = 4,
           description = "Top border offset"
         },
         {
           type = "int",
           name = "right",
+          offset = 24,
+          size = 4,
           description = "Right border offset"
         },
         {
           type = "int",
           name = "bottom",
+          offset = 28,
+          size = 4,
           description = "Bottom border offset"
         },
         {
           type = "int",
           name = "layout",
+          offset = 32,
+          size = 4,
           description = "Layout of the n-patch: 3x3, 1x3 or 3x1"
         }
       }
     },
+    {
+      name = "SpriteInstance",
+      description = "SpriteInstance, texture piece drawing parameters (DrawTexturePro() parameters)",
+      size = 48,
+      alignment = 4,
+      fields = {
+        {
+          type = "Rectangle",
+          name = "source",
+          offset = 0,
+          size = 16,
+          description = "Texture source rectangle (negative width/height to flip)"
+        },
+        {
+          type = "Rectangle",
+          name = "dest",
+          offset = 16,
+          size = 16,
+          description = "Destination rectangle"
+        },
+        {
+          type = "Vector2",
+          name = "origin",
+          offset = 32,
+          size = 8,
+          description = "Rotation origin, relative to destination rectangle"
+        },
+        {
+          type = "float",
+          name = "rotation",
+          offset = 40,
+          size = 4,
+          description = "Rotation in degrees"
+        },
+        {
+          type = "Color",
+          name = "tint",
+          offset = 44,
+          size = 4,
+          description = "Tint color"
+        }
+      }
+    },
+    {
+      name = "AtlasRegion",
+      description = "AtlasRegion, image packed into texture atlas page",
+      size = 40,
+      alignment = 4,
+      fields = {
+        {
+          type = "Texture2D",
+          name = "texture",
+          offset = 0,
+          size = 20,
+          description = "Atlas page texture"
+        },
+        {
+          type = "Rectangle",
+          name = "source",
+          offset = 20,
+          size = 16,
+          description = "Image source rectangle in page texture"
+        },
+        {
+          type = "int",
+          name = "id",
+          offset = 36,
+          size = 4,
+          description = "Region id (-1: not packed)"
+        }
+      }
+    },
+    {
+      name = "ImageProcessOp",
+      description = "ImageProcessOp, image color operation for ImageProcess()",
+      size = 16,
+      alignment = 4,
+      fields = {
+        {
+          type = "int",
+          name = "type",
+          offset = 0,
+          size = 4,
+          description = "Operation type (ImageProcessType)"
+        },
+        {
+          type = "float",
+          name = "value",
+          offset = 4,
+          size = 4,
+          description = "Operation value: contrast [-100..100], brightness [-255..255]"
+        },
+        {
+          type = "Color",
+          name = "color",
+          offset = 8,
+          size = 4,
+          description = "Operation color: tint color, replaced color"
+        },
+        {
+          type = "Color",
+          name = "replace",
+          offset = 12,
+          size = 4,
+          description = "Replacement color"
+        }
+      }
+    },
     {
       name = "GlyphInfo",
       description = "GlyphInfo, font characters glyphs info",
+      size = 40,
+      alignment = 8,
       fields = {
         {
           type = "int",
           name = "value",
+          offset = 0,
+          size = 4,
           description = "Character value (Unicode)"
         },
         {
           type = "int",
           name = "offsetX",
+          offset = 4,
+          size = 4,
           description = "Character offset X when drawing"
         },
         {
           type = "int",
           name = "offsetY",
+          offset = 8,
+          size = 4,
           description = "Character offset Y when drawing"
         },
         {
           type = "int",
           name = "advanceX",
+          offset = 12,
+          size = 4,
           description = "Character advance position X"
         },
         {
           type = "Image",
           name = "image",
+          offset = 16,
+          size = 24,
           description = "Character image data"
         }
       }
@@ -692,66 +1214,156 @@ return {
     {
       name = "Font",
       description = "Font, font texture and GlyphInfo array data",
+      size = 56,
+      alignment = 8,
       fields = {
         {
           type = "int",
           name = "baseSize",
+          offset = 0,
+          size = 4,
           description = "Base size (default chars height)"
         },
         {
           type = "int",
           name = "glyphCount",
+          offset = 4,
+          size = 4,
           description = "Number of glyph characters"
         },
         {
           type = "int",
           name = "glyphPadding",
+          offset = 8,
+          size = 4,
           description = "Padding around the glyph characters"
         },
         {
           type = "Texture2D",
           name = "texture",
+          offset = 12,
+          size = 20,
           description = "Texture atlas containing the glyphs"
         },
         {
           type = "Rectangle *",
           name = "recs",
+          offset = 32,
+          size = 8,
           description = "Rectangles in texture for the glyphs"
         },
         {
           type = "GlyphInfo *",
           name = "glyphs",
+          offset = 40,
+          size = 8,
           description = "Glyphs info data"
+        },
+        {
+          type = "rGlyphLookup *",
+          name = "glyphLookup",
+          offset = 48,
+          size = 8,
+          description = "Glyphs index lookup by codepoint (built on font loading, NULL: linear search)"
+        }
+      }
+    },
+    {
+      name = "TextLayout",
+      description = "TextLayout, text glyphs quads positioned once to be drawn multiple times",
+      size = 64,
+      alignment = 8,
+      fields = {
+        {
+          type = "Texture2D",
+          name = "texture",
+          offset = 0,
+          size = 20,
+          description = "Font texture atlas (not owned, font must be kept loaded)"
+        },
+        {
+          type = "int",
+          name = "glyphCount",
+          offset = 20,
+          size = 4,
+          description = "Number of glyphs quads"
+        },
+        {
+          type = "float *",
+          name = "vertices",
+          offset = 24,
+          size = 8,
+          description = "Glyphs quads positions (XY, 4 vertex by quad), relative to layout position"
+        },
+        {
+          type = "float *",
+          name = "texcoords",
+          offset = 32,
+          size = 8,
+          description = "Glyphs quads texture coordinates (UV, 4 vertex by quad)"
+        },
+        {
+          type = "Rectangle",
+          name = "bounds",
+          offset = 40,
+          size = 16,
+          description = "Text bounds, relative to layout position"
+        },
+        {
+          type = "float",
+          name = "pixelRange",
+          offset = 56,
+          size = 4,
+          description = "Distance field screen pixels range (MSDF fonts, 0 for other fonts)"
+        },
+        {
+          type = "unsigned int",
+          name = "instancesId",
+          offset = 60,
+          size = 4,
+          description = "Glyphs instances GPU buffer id (large layouts drawn instanced, 0: render batch drawing)"
         }
       }
     },
     {
       name = "Camera3D",
       description = "Camera, defines position/orientation in 3d space",
+      size = 44,
+      alignment = 4,
       fields = {
         {
           type = "Vector3",
           name = "position",
+          offset = 0,
+          size = 12,
           description = "Camera position"
         },
         {
           type = "Vector3",
           name = "target",
+          offset = 12,
+          size = 12,
           description = "Camera target it looks-at"
         },
         {
           type = "Vector3",
           name = "up",
+          offset = 24,
+          size = 12,
           description = "Camera up vector (rotation over its axis)"
         },
         {
           type = "float",
           name = "fovy",
+          offset = 36,
+          size = 4,
           description = "Camera field-of-view aperture in Y (degrees) in perspective, used as near plane width in orthographic"
         },
         {
           type = "int",
           name = "projection",
+          offset = 40,
+          size = 4,
           description = "Camera projection: CAMERA_PERSPECTIVE or CAMERA_ORTHOGRAPHIC"
         }
       }
@@ -759,122 +1371,618 @@ return {
     {
       name = "Camera2D",
       description = "Camera2D, defines position/orientation in 2d space",
+      size = 24,
+      alignment = 4,
       fields = {
         {
           type = "Vector2",
           name = "offset",
+          offset = 0,
+          size = 8,
           description = "Camera offset (displacement from target)"
         },
         {
           type = "Vector2",
           name = "target",
+          offset = 8,
+          size = 8,
           description = "Camera target (rotation and zoom origin)"
         },
         {
           type = "float",
           name = "rotation",
+          offset = 16,
+          size = 4,
           description = "Camera rotation in degrees"
         },
         {
           type = "float",
           name = "zoom",
+          offset = 20,
+          size = 4,
           description = "Camera zoom (scaling), should be 1.0f by default"
         }
       }
     },
+    {
+      name = "CameraViewProj",
+      description = "CameraViewProj, camera matrices for a viewport size, computed once for many world/screen projections",
+      size = 308,
+      alignment = 4,
+      fields = {
+        {
+          type = "Matrix",
+          name = "view",
+          offset = 0,
+          size = 64,
+          description = "Camera view matrix"
+        },
+        {
+          type = "Matrix",
+          name = "projection",
+          offset = 64,
+          size = 64,
+          description = "Camera projection matrix"
+        },
+        {
+          type = "Matrix",
+          name = "viewProj",
+          offset = 128,
+          size = 64,
+          description = "View-projection matrix (world to clip space)"
+        },
+        {
+          type = "Matrix",
+          name = "invViewProj",
+          offset = 192,
+          size = 64,
+          description = "Inverse view-projection matrix (clip to world space)"
+        },
+        {
+          type = "Camera3D",
+          name = "camera",
+          offset = 256,
+          size = 44,
+          description = "Camera used to compute matrices"
+        },
+        {
+          type = "int",
+          name = "width",
+          offset = 300,
+          size = 4,
+          description = "Viewport width"
+        },
+        {
+          type = "int",
+          name = "height",
+          offset = 304,
+          size = 4,
+          description = "Viewport height"
+        }
+      }
+    },
     {
       name = "Mesh",
       description = "Mesh, vertex data and vao/vbo",
+      size = 224,
+      alignment = 8,
       fields = {
         {
           type = "int",
           name = "vertexCount",
+          offset = 0,
+          size = 4,
           description = "Number of vertices stored in arrays"
         },
         {
           type = "int",
           name = "triangleCount",
+          offset = 4,
+          size = 4,
           description = "Number of triangles stored (indexed or not)"
         },
         {
           type = "float *",
           name = "vertices",
+          offset = 8,
+          size = 8,
           description = "Vertex position (XYZ - 3 components per vertex) (shader-location = 0)"
         },
         {
           type = "float *",
           name = "texcoords",
+          offset = 16,
+          size = 8,
           description = "Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)"
         },
         {
           type = "float *",
           name = "texcoords2",
+          offset = 24,
+          size = 8,
           description = "Vertex texture second coordinates (UV - 2 components per vertex) (shader-location = 5)"
         },
         {
           type = "float *",
           name = "normals",
+          offset = 32,
+          size = 8,
           description = "Vertex normals (XYZ - 3 components per vertex) (shader-location = 2)"
         },
         {
           type = "float *",
           name = "tangents",
+          offset = 40,
+          size = 8,
           description = "Vertex tangents (XYZW - 4 components per vertex) (shader-location = 4)"
         },
         {
           type = "unsigned char *",
           name = "colors",
+          offset = 48,
+          size = 8,
           description = "Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)"
         },
         {
           type = "unsigned short *",
           name = "indices",
+          offset = 56,
+          size = 8,
           description = "Vertex indices (in case vertex data comes indexed)"
         },
         {
           type = "float *",
           name = "animVertices",
+          offset = 64,
+          size = 8,
           description = "Animated vertex positions (after bones transformations)"
         },
         {
           type = "float *",
           name = "animNormals",
+          offset = 72,
+          size = 8,
           description = "Animated normals (after bones transformations)"
         },
         {
           type = "unsigned char *",
           name = "boneIds",
+          offset = 80,
+          size = 8,
           description = "Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)"
         },
         {
           type = "float *",
           name = "boneWeights",
+          offset = 88,
+          size = 8,
           description = "Vertex bone weight, up to 4 bones influence by vertex (skinning)"
         },
+        {
+          type = "Matrix *",
+          name = "boneMatrices",
+          offset = 96,
+          size = 8,
+          description = "Bones animated transformation matrices (GPU skinning, UpdateModelAnimationBones())"
+        },
+        {
+          type = "int",
+          name = "boneCount",
+          offset = 104,
+          size = 4,
+          description = "Number of bones matrices"
+        },
         {
           type = "unsigned int",
           name = "vaoId",
+          offset = 108,
+          size = 4,
           description = "OpenGL Vertex Array Object id"
         },
         {
           type = "unsigned int *",
           name = "vboId",
+          offset = 112,
+          size = 8,
           description = "OpenGL Vertex Buffer Objects id (default vertex data)"
-        }
-      }
-    },
-    {
+        },
+        {
+          type = "unsigned int",
+          name = "packFlags",
+          offset = 120,
+          size = 4,
+          description = "Vertex attributes packed in GPU buffers (MeshPackFlags)"
+        },
+        {
+          type = "Vector4",
+          name = "packOffset",
+          offset = 124,
+          size = 16,
+          description = "Packed positions dequantization: offset (XYZ) and scale (W)"
+        },
+        {
+          type = "int",
+          name = "lodCount",
+          offset = 140,
+          size = 4,
+          description = "Number of LOD levels (including level 0: mesh indices)"
+        },
+        {
+          type = "int *",
+          name = "lodTriangles",
+          offset = 144,
+          size = 8,
+          description = "LOD levels triangles count"
+        },
+        {
+          type = "float *",
+          name = "lodErrors",
+          offset = 152,
+          size = 8,
+          description = "LOD levels simplification error (relative to mesh bounds size)"
+        },
+        {
+          type = "unsigned short *",
+          name = "lodIndices",
+          offset = 160,
+          size = 8,
+          description = "LOD levels indices (levels 1..lodCount-1 stored consecutively, sharing mesh vertices)"
+        },
+        {
+          type = "int",
+          name = "lodLevel",
+          offset = 168,
+          size = 4,
+          description = "LOD level drawn by DrawMesh()"
+        },
+        {
+          type = "int",
+          name = "morphCount",
+          offset = 172,
+          size = 4,
+          description = "Number of morph targets"
+        },
+        {
+          type = "float *",
+          name = "morphVertices",
+          offset = 176,
+          size = 8,
+          description = "Morph targets position deltas (XYZ - 3 components per target, morphCount deltas per vertex)"
+        },
+        {
+          type = "float *",
+          name = "morphNormals",
+          offset = 184,
+          size = 8,
+          description = "Morph targets normal deltas (XYZ - 3 components per target, morphCount deltas per vertex)"
+        },
+        {
+          type = "float *",
+          name = "morphWeights",
+          offset = 192,
+          size = 8,
+          description = "Morph targets weights, SetMeshMorphWeights()"
+        },
+        {
+          type = "unsigned int",
+          name = "morphTextureId",
+          offset = 200,
+          size = 4,
+          description = "OpenGL morph targets deltas texture id (GPU morphing)"
+        },
+        {
+          type = "int",
+          name = "vertexCapacity",
+          offset = 204,
+          size = 4,
+          description = "Vertex buffers capacity in GPU (vertices), ResizeMesh() grows buffers as required"
+        },
+        {
+          type = "int",
+          name = "indexCapacity",
+          offset = 208,
+          size = 4,
+          description = "Index buffer capacity in GPU (indices, including LOD levels indices)"
+        },
+        {
+          type = "int *",
+          name = "dirtyRanges",
+          offset = 216,
+          size = 8,
+          description = "Dynamic mesh buffers ranges pending upload (first, last by buffer), uploaded on draw"
+        }
+      }
+    },
+    {
+      name = "BillboardInstance",
+      description = "BillboardInstance, billboard drawn by DrawBillboardsBatch()",
+      size = 44,
+      alignment = 4,
+      fields = {
+        {
+          type = "Vector3",
+          name = "position",
+          offset = 0,
+          size = 12,
+          description = "Billboard center position"
+        },
+        {
+          type = "Vector2",
+          name = "size",
+          offset = 12,
+          size = 8,
+          description = "Billboard size (width and height, world units)"
+        },
+        {
+          type = "float",
+          name = "rotation",
+          offset = 20,
+          size = 4,
+          description = "Billboard rotation around its center (degrees)"
+        },
+        {
+          type = "Rectangle",
+          name = "source",
+          offset = 24,
+          size = 16,
+          description = "Texture source rectangle (zero width: full texture)"
+        },
+        {
+          type = "Color",
+          name = "tint",
+          offset = 40,
+          size = 4,
+          description = "Billboard tint color"
+        }
+      }
+    },
+    {
+      name = "ParticleEmitter",
+      description = "ParticleEmitter, particles spawn and simulation parameters (UpdateParticleSystem())",
+      size = 88,
+      alignment = 4,
+      fields = {
+        {
+          type = "Vector3",
+          name = "position",
+          offset = 0,
+          size = 12,
+          description = "Emitter position"
+        },
+        {
+          type = "Vector3",
+          name = "spread",
+          offset = 12,
+          size = 12,
+          description = "Spawn position random offset (box half extents)"
+        },
+        {
+          type = "Vector3",
+          name = "velocity",
+          offset = 24,
+          size = 12,
+          description = "Particles initial velocity"
+        },
+        {
+          type = "Vector3",
+          name = "velocityRandom",
+          offset = 36,
+          size = 12,
+          description = "Particles initial velocity random offset (box half extents)"
+        },
+        {
+          type = "Vector3",
+          name = "gravity",
+          offset = 48,
+          size = 12,
+          description = "Particles acceleration"
+        },
+        {
+          type = "float",
+          name = "rate",
+          offset = 60,
+          size = 4,
+          description = "Particles spawned per second"
+        },
+        {
+          type = "float",
+          name = "lifetimeMin",
+          offset = 64,
+          size = 4,
+          description = "Particles minimum lifetime (seconds)"
+        },
+        {
+          type = "float",
+          name = "lifetimeMax",
+          offset = 68,
+          size = 4,
+          description = "Particles maximum lifetime (seconds)"
+        },
+        {
+          type = "float",
+          name = "sizeStart",
+          offset = 72,
+          size = 4,
+          description = "Particles size at spawn (world units)"
+        },
+        {
+          type = "float",
+          name = "sizeEnd",
+          offset = 76,
+          size = 4,
+          description = "Particles size at end of lifetime"
+        },
+        {
+          type = "Color",
+          name = "colorStart",
+          offset = 80,
+          size = 4,
+          description = "Particles color at spawn"
+        },
+        {
+          type = "Color",
+          name = "colorEnd",
+          offset = 84,
+          size = 4,
+          description = "Particles color at end of lifetime"
+        }
+      }
+    },
+    {
+      name = "ParticleSystem",
+      description = "ParticleSystem, particles simulated and drawn on GPU (compute shaders, OpenGL 4.3) or on CPU (fallback)",
+      size = 16,
+      alignment = 8,
+      fields = {
+        {
+          type = "int",
+          name = "maxParticles",
+          offset = 0,
+          size = 4,
+          description = "Maximum particles alive"
+        },
+        {
+          type = "bool",
+          name = "gpu",
+          offset = 4,
+          size = 1,
+          description = "Particles simulated on GPU (particles data not available on CPU)"
+        },
+        {
+          type = "void *",
+          name = "ctxData",
+          offset = 8,
+          size = 8,
+          description = "Particles system internal data (buffers and shaders or CPU particles)"
+        }
+      }
+    },
+    {
+      name = "MeshInstanceBuffer",
+      description = "NOTE: Instances colors and custom attributes are optional, one buffer per attribute (loaded on first update)",
+      size = 60,
+      alignment = 4,
+      fields = {
+        {
+          type = "unsigned int",
+          name = "id",
+          offset = 0,
+          size = 4,
+          description = "OpenGL Vertex Buffer Object id (transforms)"
+        },
+        {
+          type = "int",
+          name = "instanceCount",
+          offset = 4,
+          size = 4,
+          description = "Number of instances transforms stored"
+        },
+        {
+          type = "unsigned int",
+          name = "colorsId",
+          offset = 8,
+          size = 4,
+          description = "Instances colors buffer id (shader-location: SHADER_LOC_INSTANCE_COLOR)"
+        },
+        {
+          type = "unsigned int[4]",
+          name = "attribIds",
+          offset = 12,
+          size = 16,
+          description = "Instances custom attributes buffers ids"
+        },
+        {
+          type = "int[4]",
+          name = "attribLocs",
+          offset = 28,
+          size = 16,
+          description = "Instances custom attributes shader locations"
+        },
+        {
+          type = "int[4]",
+          name = "attribSizes",
+          offset = 44,
+          size = 16,
+          description = "Instances custom attributes components (float, 1..4)"
+        }
+      }
+    },
+    {
+      name = "MeshGenParams",
+      description = "MeshGenParams, procedural mesh shape parameters (GenMeshes())",
+      size = 20,
+      alignment = 4,
+      fields = {
+        {
+          type = "int",
+          name = "type",
+          offset = 0,
+          size = 4,
+          description = "Mesh shape type (MeshGenType)"
+        },
+        {
+          type = "float[2]",
+          name = "params",
+          offset = 4,
+          size = 8,
+          description = "Shape dimensions (radius, size...)"
+        },
+        {
+          type = "int[2]",
+          name = "resolution",
+          offset = 12,
+          size = 8,
+          description = "Shape subdivisions (rings, slices, sides...)"
+        }
+      }
+    },
+    {
+      name = "OcclusionQuery",
+      description = "OcclusionQuery, model visibility tested on GPU over frames (DrawModelOccluded())",
+      size = 8,
+      alignment = 4,
+      fields = {
+        {
+          type = "unsigned int",
+          name = "id",
+          offset = 0,
+          size = 4,
+          description = "OpenGL query object id (0: occlusion queries not supported)"
+        },
+        {
+          type = "bool",
+          name = "pending",
+          offset = 4,
+          size = 1,
+          description = "Query issued, result not read back yet"
+        },
+        {
+          type = "bool",
+          name = "visible",
+          offset = 5,
+          size = 1,
+          description = "Latest query result read back (previous frames)"
+        }
+      }
+    },
+    {
       name = "Shader",
       description = "Shader",
+      size = 16,
+      alignment = 8,
       fields = {
         {
           type = "unsigned int",
           name = "id",
+          offset = 0,
+          size = 4,
           description = "Shader program id"
         },
         {
           type = "int *",
           name = "locs",
+          offset = 8,
+          size = 8,
           description = "Shader locations array (RL_MAX_SHADER_LOCATIONS)"
         }
       }
@@ -882,20 +1990,28 @@ return {
     {
       name = "MaterialMap",
       description = "MaterialMap",
+      size = 28,
+      alignment = 4,
       fields = {
         {
           type = "Texture2D",
           name = "texture",
+          offset = 0,
+          size = 20,
           description = "Material map texture"
         },
         {
           type = "Color",
           name = "color",
+          offset = 20,
+          size = 4,
           description = "Material map color"
         },
         {
           type = "float",
           name = "value",
+          offset = 24,
+          size = 4,
           description = "Material map value"
         }
       }
@@ -903,20 +2019,28 @@ return {
     {
       name = "Material",
       description = "Material, includes shader and maps",
+      size = 40,
+      alignment = 8,
       fields = {
         {
           type = "Shader",
           name = "shader",
+          offset = 0,
+          size = 16,
           description = "Material shader"
         },
         {
           type = "MaterialMap *",
           name = "maps",
+          offset = 16,
+          size = 8,
           description = "Material maps array (MAX_MATERIAL_MAPS)"
         },
         {
           type = "float[4]",
           name = "params",
+          offset = 24,
+          size = 16,
           description = "Material generic parameters (if required)"
         }
       }
@@ -924,20 +2048,28 @@ return {
     {
       name = "Transform",
       description = "Transform, vertex transformation data",
+      size = 40,
+      alignment = 4,
       fields = {
         {
           type = "Vector3",
           name = "translation",
+          offset = 0,
+          size = 12,
           description = "Translation"
         },
         {
           type = "Quaternion",
           name = "rotation",
+          offset = 12,
+          size = 16,
           description = "Rotation"
         },
         {
           type = "Vector3",
           name = "scale",
+          offset = 28,
+          size = 12,
           description = "Scale"
         }
       }
@@ -945,108 +2077,221 @@ return {
     {
       name = "BoneInfo",
       description = "Bone, skeletal animation bone",
+      size = 36,
+      alignment = 4,
       fields = {
         {
           type = "char[32]",
           name = "name",
+          offset = 0,
+          size = 32,
           description = "Bone name"
         },
         {
           type = "int",
           name = "parent",
+          offset = 32,
+          size = 4,
           description = "Bone parent"
         }
       }
     },
+    {
+      name = "ModelPose",
+      description = "NOTE: Pose is kept by model and shared by skinning, bounds update and bones attachments",
+      size = 32,
+      alignment = 8,
+      fields = {
+        {
+          type = "int",
+          name = "boneCount",
+          offset = 0,
+          size = 4,
+          description = "Number of bones"
+        },
+        {
+          type = "Transform *",
+          name = "transforms",
+          offset = 8,
+          size = 8,
+          description = "Bones global transforms (model space)"
+        },
+        {
+          type = "Matrix *",
+          name = "globals",
+          offset = 16,
+          size = 8,
+          description = "Bones global matrices (model space), used by GetModelBoneTransform()"
+        },
+        {
+          type = "Matrix *",
+          name = "boneMatrices",
+          offset = 24,
+          size = 8,
+          description = "Bones skinning matrices (bind pose to animated pose)"
+        }
+      }
+    },
     {
       name = "Model",
       description = "Model, meshes, materials and animation data",
+      size = 144,
+      alignment = 8,
       fields = {
         {
           type = "Matrix",
           name = "transform",
+          offset = 0,
+          size = 64,
           description = "Local transform matrix"
         },
         {
           type = "int",
           name = "meshCount",
+          offset = 64,
+          size = 4,
           description = "Number of meshes"
         },
         {
           type = "int",
           name = "materialCount",
+          offset = 68,
+          size = 4,
           description = "Number of materials"
         },
         {
           type = "Mesh *",
           name = "meshes",
+          offset = 72,
+          size = 8,
           description = "Meshes array"
         },
         {
           type = "Material *",
           name = "materials",
+          offset = 80,
+          size = 8,
           description = "Materials array"
         },
         {
           type = "int *",
           name = "meshMaterial",
+          offset = 88,
+          size = 8,
           description = "Mesh material number"
         },
         {
           type = "int",
           name = "boneCount",
+          offset = 104,
+          size = 4,
           description = "Number of bones"
         },
         {
           type = "BoneInfo *",
           name = "bones",
+          offset = 112,
+          size = 8,
           description = "Bones information (skeleton)"
         },
         {
           type = "Transform *",
           name = "bindPose",
+          offset = 120,
+          size = 8,
           description = "Bones base transformation (pose)"
+        },
+        {
+          type = "ModelPose *",
+          name = "pose",
+          offset = 136,
+          size = 8,
+          description = "Bones current pose (bind pose on load, updated by animation)"
         }
       }
     },
     {
       name = "ModelAnimation",
       description = "ModelAnimation",
+      size = 56,
+      alignment = 8,
       fields = {
         {
           type = "int",
           name = "boneCount",
+          offset = 0,
+          size = 4,
           description = "Number of bones"
         },
         {
           type = "int",
           name = "frameCount",
+          offset = 4,
+          size = 4,
           description = "Number of animation frames"
         },
         {
           type = "BoneInfo *",
           name = "bones",
+          offset = 8,
+          size = 8,
           description = "Bones information (skeleton)"
         },
         {
           type = "Transform **",
           name = "framePoses",
+          offset = 16,
+          size = 8,
           description = "Poses array by frame"
+        },
+        {
+          type = "float *",
+          name = "frameTimes",
+          offset = 24,
+          size = 8,
+          description = "Frames time in seconds (NULL for fixed 60 fps frames), used by UpdateModelAnimationEx()"
+        },
+        {
+          type = "void *",
+          name = "compressedPoses",
+          offset = 32,
+          size = 8,
+          description = "Compressed poses data (CompressModelAnimation()), framePoses is NULL when compressed"
+        },
+        {
+          type = "int",
+          name = "morphCount",
+          offset = 40,
+          size = 4,
+          description = "Number of morph targets weights by frame (model meshes morph targets, meshes order)"
+        },
+        {
+          type = "float *",
+          name = "frameMorphWeights",
+          offset = 48,
+          size = 8,
+          description = "Morph targets weights by frame (frameCount*morphCount), NULL if not animated"
         }
       }
     },
     {
       name = "Ray",
       description = "Ray, ray for raycasting",
+      size = 24,
+      alignment = 4,
       fields = {
         {
           type = "Vector3",
           name = "position",
+          offset = 0,
+          size = 12,
           description = "Ray position (origin)"
         },
         {
           type = "Vector3",
           name = "direction",
+          offset = 12,
+          size = 12,
           description = "Ray direction"
         }
       }
@@ -1054,25 +2299,35 @@ return {
     {
       name = "RayCollision",
       description = "RayCollision, ray hit information",
+      size = 32,
+      alignment = 4,
       fields = {
         {
           type = "bool",
           name = "hit",
+          offset = 0,
+          size = 1,
           description = "Did the ray hit something?"
         },
         {
           type = "float",
           name = "distance",
+          offset = 4,
+          size = 4,
           description = "Distance to the nearest hit"
         },
         {
           type = "Vector3",
           name = "point",
+          offset = 8,
+          size = 12,
           description = "Point of the nearest hit"
         },
         {
           type = "Vector3",
           name = "normal",
+          offset = 20,
+          size = 12,
           description = "Surface normal of hit"
         }
       }
@@ -1080,5671 +2335,9732 @@ return {
     {
       name = "BoundingBox",
       description = "BoundingBox",
+      size = 24,
+      alignment = 4,
       fields = {
         {
           type = "Vector3",
           name = "min",
+          offset = 0,
+          size = 12,
           description = "Minimum vertex box-corner"
         },
         {
           type = "Vector3",
           name = "max",
+          offset = 12,
+          size = 12,
           description = "Maximum vertex box-corner"
         }
       }
     },
     {
-      name = "Wave",
-      description = "Wave, audio wave data",
+      name = "Frustum",
+      description = "Frustum, view volume limited by 6 planes",
+      size = 96,
+      alignment = 4,
       fields = {
         {
-          type = "unsigned int",
-          name = "frameCount",
-          description = "Total number of frames (considering channels)"
-        },
+          type = "Vector4[6]",
+          name = "planes",
+          offset = 0,
+          size = 96,
+          description = "Planes (normal XYZ pointing inside, distance W): left, right, bottom, top, near, far"
+        }
+      }
+    },
+    {
+      name = "BVHNode",
+      description = "BVHNode, bounding volume hierarchy node",
+      size = 32,
+      alignment = 4,
+      fields = {
         {
-          type = "unsigned int",
-          name = "sampleRate",
-          description = "Frequency (samples per second)"
+          type = "Vector3",
+          name = "min",
+          offset = 0,
+          size = 12,
+          description = "Node bounds minimum"
         },
         {
-          type = "unsigned int",
-          name = "sampleSize",
-          description = "Bit depth (bits per sample): 8, 16, 32 (24 not supported)"
+          type = "int",
+          name = "first",
+          offset = 12,
+          size = 4,
+          description = "Leaf first triangle or inner node left child (right child is next node)"
         },
         {
-          type = "unsigned int",
-          name = "channels",
-          description = "Number of channels (1-mono, 2-stereo, ...)"
+          type = "Vector3",
+          name = "max",
+          offset = 16,
+          size = 12,
+          description = "Node bounds maximum"
         },
         {
-          type = "void *",
-          name = "data",
-          description = "Buffer data pointer"
+          type = "int",
+          name = "count",
+          offset = 28,
+          size = 4,
+          description = "Leaf triangles count (0 for inner nodes)"
         }
       }
     },
     {
-      name = "AudioStream",
-      description = "AudioStream, custom audio stream",
+      name = "MeshBVH",
+      description = "MeshBVH, mesh triangles bounding volume hierarchy (ray picking)",
+      size = 24,
+      alignment = 8,
       fields = {
         {
-          type = "rAudioBuffer *",
-          name = "buffer",
-          description = "Pointer to internal data used by the audio system"
-        },
-        {
-          type = "rAudioProcessor *",
-          name = "processor",
-          description = "Pointer to internal data processor, useful for audio effects"
+          type = "int",
+          name = "nodeCount",
+          offset = 0,
+          size = 4,
+          description = "Number of nodes"
         },
         {
-          type = "unsigned int",
-          name = "sampleRate",
-          description = "Frequency (samples per second)"
+          type = "int",
+          name = "triangleCount",
+          offset = 4,
+          size = 4,
+          description = "Number of triangles"
         },
         {
-          type = "unsigned int",
-          name = "sampleSize",
-          description = "Bit depth (bits per sample): 8, 16, 32 (24 not supported)"
+          type = "BVHNode *",
+          name = "nodes",
+          offset = 8,
+          size = 8,
+          description = "Nodes array (root node is first)"
         },
         {
-          type = "unsigned int",
-          name = "channels",
-          description = "Number of channels (1-mono, 2-stereo, ...)"
+          type = "Vector3 *",
+          name = "vertices",
+          offset = 16,
+          size = 8,
+          description = "Triangles vertices ordered by leaf nodes (3 per triangle)"
         }
       }
     },
     {
-      name = "Sound",
-      description = "Sound",
+      name = "MeshInstanceCuller",
+      description = "MeshInstanceCuller, GPU frustum culling of mesh instances (compute shader, requires OpenGL 4.3)",
+      size = 96,
+      alignment = 4,
       fields = {
         {
-          type = "AudioStream",
-          name = "stream",
-          description = "Audio stream"
+          type = "unsigned int",
+          name = "shaderId",
+          offset = 0,
+          size = 4,
+          description = "Culling compute shader program id"
+        },
+        {
+          type = "MeshInstanceBuffer",
+          name = "visible",
+          offset = 4,
+          size = 60,
+          description = "Visible instances transforms (compacted, written by culling pass)"
         },
         {
           type = "unsigned int",
-          name = "frameCount",
-          description = "Total number of frames (considering channels)"
+          name = "argsId",
+          offset = 64,
+          size = 4,
+          description = "Indirect draw arguments buffer id (visible instances count written by culling pass)"
+        },
+        {
+          type = "BoundingBox",
+          name = "bounds",
+          offset = 68,
+          size = 24,
+          description = "Mesh bounding box (local space)"
+        },
+        {
+          type = "int",
+          name = "elementCount",
+          offset = 92,
+          size = 4,
+          description = "Mesh elements drawn by instance (indices or vertex count)"
         }
       }
     },
     {
-      name = "Music",
-      description = "Music, audio stream, anything longer than ~10 seconds should be streamed",
+      name = "ShadowMap",
+      description = "NOTE: Cascades are stored side by side in depth textures, state fields are updated by UpdateShadowMap() and BeginShadowMode()",
+      size = 800,
+      alignment = 4,
       fields = {
         {
-          type = "AudioStream",
-          name = "stream",
-          description = "Audio stream"
+          type = "unsigned int",
+          name = "id",
+          offset = 0,
+          size = 4,
+          description = "OpenGL framebuffer object id (shadows depth)"
         },
         {
           type = "unsigned int",
-          name = "frameCount",
-          description = "Total number of frames (considering channels)"
+          name = "cacheId",
+          offset = 4,
+          size = 4,
+          description = "OpenGL framebuffer object id (static casters depth cache, 0 if not supported)"
         },
         {
-          type = "bool",
-          name = "looping",
-          description = "Music looping enable"
+          type = "Texture2D",
+          name = "depth",
+          offset = 8,
+          size = 20,
+          description = "Shadows depth texture (cascades side by side)"
         },
         {
-          type = "int",
-          name = "ctxType",
-          description = "Type of music context (audio filetype)"
+          type = "Texture2D",
+          name = "cacheDepth",
+          offset = 28,
+          size = 20,
+          description = "Static casters depth texture (cascades side by side)"
         },
-        {
-          type = "void *",
-          name = "ctxData",
-          description = "Audio context data, depends on type"
-        }
-      }
-    },
-    {
-      name = "VrDeviceInfo",
-      description = "VrDeviceInfo, Head-Mounted-Display device parameters",
-      fields = {
         {
           type = "int",
-          name = "hResolution",
-          description = "Horizontal resolution in pixels"
+          name = "type",
+          offset = 48,
+          size = 4,
+          description = "Shadow light type (ShadowLightType)"
         },
         {
           type = "int",
-          name = "vResolution",
-          description = "Vertical resolution in pixels"
-        },
-        {
-          type = "float",
-          name = "hScreenSize",
-          description = "Horizontal size in meters"
+          name = "size",
+          offset = 52,
+          size = 4,
+          description = "Cascade depth size (square, pixels)"
         },
         {
-          type = "float",
-          name = "vScreenSize",
-          description = "Vertical size in meters"
+          type = "int",
+          name = "cascadeCount",
+          offset = 56,
+          size = 4,
+          description = "Number of cascades (spot light: 1)"
         },
         {
           type = "float",
-          name = "vScreenCenter",
-          description = "Screen center in meters"
+          name = "distance",
+          offset = 60,
+          size = 4,
+          description = "Shadows distance from camera (directional light) or light range (spot light)"
         },
         {
           type = "float",
-          name = "eyeToScreenDistance",
-          description = "Distance between eye and display in meters"
+          name = "angle",
+          offset = 64,
+          size = 4,
+          description = "Spot light cone angle (degrees)"
         },
         {
-          type = "float",
-          name = "lensSeparationDistance",
-          description = "Lens separation distance in meters"
+          type = "Vector3",
+          name = "position",
+          offset = 68,
+          size = 12,
+          description = "Light position (spot light)"
         },
         {
-          type = "float",
-          name = "interpupillaryDistance",
-          description = "IPD (distance between pupils) in meters"
+          type = "Vector3",
+          name = "direction",
+          offset = 80,
+          size = 12,
+          description = "Light direction (normalized)"
         },
         {
           type = "float[4]",
-          name = "lensDistortionValues",
-          description = "Lens distortion constant parameters"
+          name = "splits",
+          offset = 92,
+          size = 16,
+          description = "Cascades far distances from camera"
         },
         {
           type = "float[4]",
-          name = "chromaAbCorrection",
-          description = "Chromatic aberration correction parameters"
-        }
-      }
-    },
-    {
-      name = "VrStereoConfig",
-      description = "VrStereoConfig, VR stereo rendering configuration for simulator",
-      fields = {
-        {
-          type = "Matrix[2]",
-          name = "projection",
-          description = "VR projection matrices (per eye)"
-        },
-        {
-          type = "Matrix[2]",
-          name = "viewOffset",
-          description = "VR view offset matrices (per eye)"
+          name = "sizes",
+          offset = 108,
+          size = 16,
+          description = "Cascades light space size (world units, square)"
         },
         {
-          type = "float[2]",
-          name = "leftLensCenter",
-          description = "VR left lens center"
+          type = "Matrix",
+          name = "view",
+          offset = 124,
+          size = 64,
+          description = "Light view matrix (casters drawing)"
         },
         {
-          type = "float[2]",
-          name = "rightLensCenter",
-          description = "VR right lens center"
+          type = "Matrix[4]",
+          name = "projections",
+          offset = 188,
+          size = 256,
+          description = "Cascades light projection matrices (casters drawing)"
         },
         {
-          type = "float[2]",
-          name = "leftScreenCenter",
-          description = "VR left screen center"
+          type = "Matrix[4]",
+          name = "matrices",
+          offset = 444,
+          size = 256,
+          description = "Cascades shadow matrices: world space to shadow depth texture space (UV and depth)"
         },
         {
-          type = "float[2]",
-          name = "rightScreenCenter",
-          description = "VR right screen center"
+          type = "int[3][4]",
+          name = "origins",
+          offset = 700,
+          size = 48,
+          description = "Cascades light space origins: XY in texels, Z in depth steps"
         },
         {
-          type = "float[2]",
-          name = "scale",
-          description = "VR distortion scale"
+          type = "int[3][4]",
+          name = "cacheOrigins",
+          offset = 748,
+          size = 48,
+          description = "Cascades static casters cache origins"
         },
         {
-          type = "float[2]",
-          name = "scaleIn",
-          description = "VR distortion scale in"
+          type = "unsigned int",
+          name = "cacheMask",
+          offset = 796,
+          size = 4,
+          description = "Cascades static casters cache valid (bit per cascade)"
         }
       }
     },
     {
-      name = "FilePathList",
-      description = "File path list",
+      name = "ClusterLight",
+      description = "ClusterLight, point or spot light for clustered lighting",
+      size = 40,
+      alignment = 4,
       fields = {
         {
-          type = "unsigned int",
-          name = "capacity",
-          description = "Filepaths max entries"
+          type = "Vector3",
+          name = "position",
+          offset = 0,
+          size = 12,
+          description = "Light position (world space)"
         },
         {
-          type = "unsigned int",
-          name = "count",
-          description = "Filepaths entries count"
+          type = "Vector3",
+          name = "direction",
+          offset = 12,
+          size = 12,
+          description = "Spot light direction (normalized)"
         },
         {
-          type = "char **",
-          name = "paths",
-          description = "Filepaths entries"
+          type = "Color",
+          name = "color",
+          offset = 24,
+          size = 4,
+          description = "Light color"
+        },
+        {
+          type = "float",
+          name = "intensity",
+          offset = 28,
+          size = 4,
+          description = "Light intensity (color multiplier)"
+        },
+        {
+          type = "float",
+          name = "range",
+          offset = 32,
+          size = 4,
+          description = "Light range, attenuation reaches zero at range distance"
+        },
+        {
+          type = "float",
+          name = "angle",
+          offset = 36,
+          size = 4,
+          description = "Spot light cone angle (degrees), point light if 0"
         }
       }
-    }
-  },
-  aliases = {
-    {
-      type = "Vector4",
-      name = "Quaternion",
-      description = "Quaternion, 4 components (Vector4 alias)"
     },
     {
-      type = "Texture",
-      name = "Texture2D",
-      description = "Texture2D, same as Texture"
-    },
-    {
-      type = "Texture",
-      name = "TextureCubemap",
-      description = "TextureCubemap, same as Texture"
-    },
-    {
-      type = "RenderTexture",
-      name = "RenderTexture2D",
-      description = "RenderTexture2D, same as RenderTexture"
-    },
-    {
-      type = "Camera3D",
-      name = "Camera",
-      description = "Camera type fallback, defaults to Camera3D"
-    }
-  },
-  enums = {
-    {
-      name = "ConfigFlags",
-      description = "System/Window config flags",
-      values = {
+      name = "LightClusters",
+      description = "NOTE: Clusters are screen tiles by exponential depth slices, shader only evaluates lights listed for fragment cluster",
+      size = 120,
+      alignment = 8,
+      fields = {
         {
-          name = "FLAG_VSYNC_HINT",
-          value = 64,
-          description = "Set to try enabling V-Sync on GPU"
+          type = "Texture2D",
+          name = "lights",
+          offset = 0,
+          size = 20,
+          description = "Lights data texture (float RGBA, 3 texels by light)"
         },
         {
-          name = "FLAG_FULLSCREEN_MODE",
-          value = 2,
-          description = "Set to run program in fullscreen"
+          type = "Texture2D",
+          name = "clusters",
+          offset = 20,
+          size = 20,
+          description = "Clusters data texture (float RGBA): clusters lights lists ranges, then lights indices"
         },
         {
-          name = "FLAG_WINDOW_RESIZABLE",
-          value = 4,
-          description = "Set to allow resizable window"
+          type = "float *",
+          name = "lightsData",
+          offset = 40,
+          size = 8,
+          description = "Lights data (CPU copy of lights texture)"
         },
         {
-          name = "FLAG_WINDOW_UNDECORATED",
-          value = 8,
-          description = "Set to disable window decoration (frame and buttons)"
+          type = "float *",
+          name = "clustersData",
+          offset = 48,
+          size = 8,
+          description = "Clusters data (CPU copy of clusters texture)"
         },
         {
-          name = "FLAG_WINDOW_HIDDEN",
-          value = 128,
-          description = "Set to hide window"
+          type = "int *",
+          name = "binned",
+          offset = 56,
+          size = 8,
+          description = "Clusters binned lights (MAX_LIGHTS_PER_CLUSTER by cluster)"
         },
         {
-          name = "FLAG_WINDOW_MINIMIZED",
-          value = 512,
-          description = "Set to minimize window (iconify)"
+          type = "int",
+          name = "maxLights",
+          offset = 64,
+          size = 4,
+          description = "Maximum number of lights"
         },
         {
-          name = "FLAG_WINDOW_MAXIMIZED",
-          value = 1024,
-          description = "Set to maximize window (expanded to monitor)"
+          type = "int",
+          name = "lightCount",
+          offset = 68,
+          size = 4,
+          description = "Number of lights on last update"
         },
         {
-          name = "FLAG_WINDOW_UNFOCUSED",
-          value = 2048,
-          description = "Set to window non focused"
+          type = "int[3]",
+          name = "tiles",
+          offset = 72,
+          size = 12,
+          description = "Clusters grid size: screen tiles (x, y) and depth slices"
         },
         {
-          name = "FLAG_WINDOW_TOPMOST",
-          value = 4096,
-          description = "Set to window always on top"
+          type = "float",
+          name = "near",
+          offset = 84,
+          size = 4,
+          description = "Clusters first depth slice distance from camera"
         },
         {
-          name = "FLAG_WINDOW_ALWAYS_RUN",
-          value = 256,
-          description = "Set to allow windows running while minimized"
+          type = "float",
+          name = "far",
+          offset = 88,
+          size = 4,
+          description = "Clusters last depth slice distance from camera"
         },
         {
-          name = "FLAG_WINDOW_TRANSPARENT",
-          value = 16,
-          description = "Set to allow transparent framebuffer"
+          type = "Vector3",
+          name = "viewPosition",
+          offset = 92,
+          size = 12,
+          description = "Camera position on last update"
         },
         {
-          name = "FLAG_WINDOW_HIGHDPI",
-          value = 8192,
-          description = "Set to support HighDPI"
+          type = "Vector2",
+          name = "screenSize",
+          offset = 104,
+          size = 8,
+          description = "Render size on last update (clusters screen tiles size)"
         },
         {
-          name = "FLAG_WINDOW_MOUSE_PASSTHROUGH",
-          value = 16384,
-          description = "Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED"
+          type = "Color",
+          name = "ambient",
+          offset = 112,
+          size = 4,
+          description = "Ambient light color"
+        }
+      }
+    },
+    {
+      name = "TerrainChunk",
+      description = "TerrainChunk, terrain region mesh at current LOD level",
+      size = 256,
+      alignment = 8,
+      fields = {
+        {
+          type = "Mesh",
+          name = "mesh",
+          offset = 0,
+          size = 224,
+          description = "Chunk mesh for current LOD level (valid if lod >= 0)"
         },
         {
-          name = "FLAG_MSAA_4X_HINT",
-          value = 32,
-          description = "Set to try enabling MSAA 4X"
+          type = "int",
+          name = "lod",
+          offset = 224,
+          size = 4,
+          description = "Current chunk mesh LOD level (-1: not loaded)"
         },
         {
-          name = "FLAG_INTERLACED_HINT",
-          value = 65536,
-          description = "Set to try enabling interlaced video format (for V3D)"
+          type = "int",
+          name = "request",
+          offset = 228,
+          size = 4,
+          description = "Pending chunk mesh generation request (-1: none)"
+        },
+        {
+          type = "BoundingBox",
+          name = "bounds",
+          offset = 232,
+          size = 24,
+          description = "Chunk bounding box (terrain space)"
         }
       }
     },
     {
-      name = "TraceLogLevel",
-      description = "Trace log level",
-      values = {
+      name = "Terrain",
+      description = "Terrain, heightmap split in chunks, chunks LOD meshes generated asynchronously by camera distance",
+      size = 64,
+      alignment = 8,
+      fields = {
         {
-          name = "LOG_ALL",
-          value = 0,
-          description = "Display all logs"
+          type = "int",
+          name = "width",
+          offset = 0,
+          size = 4,
+          description = "Heightmap width (samples)"
         },
         {
-          name = "LOG_TRACE",
-          value = 1,
-          description = "Trace logging, intended for internal use only"
+          type = "int",
+          name = "height",
+          offset = 4,
+          size = 4,
+          description = "Heightmap height (samples)"
         },
         {
-          name = "LOG_DEBUG",
-          value = 2,
-          description = "Debug logging, used for internal debugging, it should be disabled on release builds"
+          type = "unsigned short *",
+          name = "heights",
+          offset = 8,
+          size = 8,
+          description = "Heightmap samples, normalized heights (16 bit)"
         },
         {
-          name = "LOG_INFO",
-          value = 3,
-          description = "Info logging, used for program execution info"
+          type = "Vector3",
+          name = "size",
+          offset = 16,
+          size = 12,
+          description = "Terrain size (world units)"
         },
         {
-          name = "LOG_WARNING",
-          value = 4,
-          description = "Warning logging, used on recoverable failures"
+          type = "int",
+          name = "chunkSize",
+          offset = 28,
+          size = 4,
+          description = "Chunk size (heightmap quads per side, power of two)"
         },
         {
-          name = "LOG_ERROR",
-          value = 5,
-          description = "Error logging, used on unrecoverable failures"
+          type = "int",
+          name = "chunksX",
+          offset = 32,
+          size = 4,
+          description = "Number of chunks along X"
         },
         {
-          name = "LOG_FATAL",
-          value = 6,
-          description = "Fatal logging, used to abort program: exit(EXIT_FAILURE)"
+          type = "int",
+          name = "chunksZ",
+          offset = 36,
+          size = 4,
+          description = "Number of chunks along Z"
         },
         {
-          name = "LOG_NONE",
-          value = 7,
-          description = "Disable logging"
+          type = "int",
+          name = "lodCount",
+          offset = 40,
+          size = 4,
+          description = "Number of LOD levels (every level halves vertices per side)"
+        },
+        {
+          type = "float",
+          name = "lodDistance",
+          offset = 44,
+          size = 4,
+          description = "Camera distance to chunk for first LOD level change (doubled for every level)"
+        },
+        {
+          type = "float",
+          name = "viewDistance",
+          offset = 48,
+          size = 4,
+          description = "Camera distance to chunk for chunk mesh unloading (0: never unloaded)"
+        },
+        {
+          type = "TerrainChunk *",
+          name = "chunks",
+          offset = 56,
+          size = 8,
+          description = "Chunks array (chunksX*chunksZ)"
         }
       }
     },
     {
-      name = "KeyboardKey",
-      description = "Keyboard keys (US keyboard layout)",
-      values = {
+      name = "Wave",
+      description = "Wave, audio wave data",
+      size = 24,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_NULL",
-          value = 0,
-          description = "Key: NULL, used for no key pressed"
+          type = "unsigned int",
+          name = "frameCount",
+          offset = 0,
+          size = 4,
+          description = "Total number of frames (considering channels)"
         },
         {
-          name = "KEY_APOSTROPHE",
-          value = 39,
-          description = "Key: '"
+          type = "unsigned int",
+          name = "sampleRate",
+          offset = 4,
+          size = 4,
+          description = "Frequency (samples per second)"
         },
         {
-          name = "KEY_COMMA",
-          value = 44,
-          description = "Key: ,"
+          type = "unsigned int",
+          name = "sampleSize",
+          offset = 8,
+          size = 4,
+          description = "Bit depth (bits per sample): 8, 16, 32 (24 not supported)"
         },
         {
-          name = "KEY_MINUS",
-          value = 45,
-          description = "Key: -"
+          type = "unsigned int",
+          name = "channels",
+          offset = 12,
+          size = 4,
+          description = "Number of channels (1-mono, 2-stereo, ...)"
         },
         {
-          name = "KEY_PERIOD",
-          value = 46,
-          description = "Key: ."
-        },
+          type = "void *",
+          name = "data",
+          offset = 16,
+          size = 8,
+          description = "Buffer data pointer"
+        }
+      }
+    },
+    {
+      name = "AudioStream",
+      description = "AudioStream, custom audio stream",
+      size = 32,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_SLASH",
-          value = 47,
-          description = "Key: /"
+          type = "rAudioBuffer *",
+          name = "buffer",
+          offset = 0,
+          size = 8,
+          description = "Pointer to internal data used by the audio system"
         },
         {
-          name = "KEY_ZERO",
-          value = 48,
-          description = "Key: 0"
+          type = "rAudioProcessor *",
+          name = "processor",
+          offset = 8,
+          size = 8,
+          description = "Pointer to internal data processor, useful for audio effects"
         },
         {
-          name = "KEY_ONE",
-          value = 49,
-          description = "Key: 1"
+          type = "unsigned int",
+          name = "sampleRate",
+          offset = 16,
+          size = 4,
+          description = "Frequency (samples per second)"
         },
         {
-          name = "KEY_TWO",
-          value = 50,
-          description = "Key: 2"
+          type = "unsigned int",
+          name = "sampleSize",
+          offset = 20,
+          size = 4,
+          description = "Bit depth (bits per sample): 8, 16, 32 (24 not supported)"
         },
         {
-          name = "KEY_THREE",
-          value = 51,
-          description = "Key: 3"
-        },
+          type = "unsigned int",
+          name = "channels",
+          offset = 24,
+          size = 4,
+          description = "Number of channels (1-mono, 2-stereo, ...)"
+        }
+      }
+    },
+    {
+      name = "AudioStreamStats",
+      description = "AudioStreamStats, audio stream buffering stats",
+      size = 24,
+      alignment = 4,
+      fields = {
         {
-          name = "KEY_FOUR",
-          value = 52,
-          description = "Key: 4"
+          type = "unsigned int",
+          name = "subBufferSize",
+          offset = 0,
+          size = 4,
+          description = "Sub-buffer size (frames)"
         },
         {
-          name = "KEY_FIVE",
-          value = 53,
-          description = "Key: 5"
+          type = "unsigned int",
+          name = "subBufferCount",
+          offset = 4,
+          size = 4,
+          description = "Sub-buffers count in use (ring buffer depth)"
         },
         {
-          name = "KEY_SIX",
-          value = 54,
-          description = "Key: 6"
+          type = "unsigned int",
+          name = "subBufferMaxCount",
+          offset = 8,
+          size = 4,
+          description = "Sub-buffers maximum count (adaptive streams grow up to it)"
         },
         {
-          name = "KEY_SEVEN",
-          value = 55,
-          description = "Key: 7"
+          type = "unsigned int",
+          name = "underrunCount",
+          offset = 12,
+          size = 4,
+          description = "Underruns, mixer ran out of stream data"
         },
         {
-          name = "KEY_EIGHT",
-          value = 56,
-          description = "Key: 8"
+          type = "unsigned int",
+          name = "overrunCount",
+          offset = 16,
+          size = 4,
+          description = "Overruns, stream updated with no sub-buffer available"
         },
         {
-          name = "KEY_NINE",
-          value = 57,
-          description = "Key: 9"
-        },
+          type = "float",
+          name = "latency",
+          offset = 20,
+          size = 4,
+          description = "Buffering latency (seconds)"
+        }
+      }
+    },
+    {
+      name = "AudioBus",
+      description = "AudioBus, submix bus, sounds and streams routed to a bus are mixed together and processed once",
+      size = 8,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_SEMICOLON",
-          value = 59,
-          description = "Key: ;"
-        },
+          type = "rAudioBus *",
+          name = "bus",
+          offset = 0,
+          size = 8,
+          description = "Pointer to internal bus data"
+        }
+      }
+    },
+    {
+      name = "AudioCaptureStream",
+      description = "AudioCaptureStream, captured audio from input device (32 bit float samples)",
+      size = 24,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_EQUAL",
-          value = 61,
-          description = "Key: ="
+          type = "rAudioCapture *",
+          name = "capture",
+          offset = 0,
+          size = 8,
+          description = "Pointer to internal capture data"
         },
         {
-          name = "KEY_A",
-          value = 65,
-          description = "Key: A | a"
+          type = "unsigned int",
+          name = "sampleRate",
+          offset = 8,
+          size = 4,
+          description = "Frequency (samples per second)"
         },
         {
-          name = "KEY_B",
-          value = 66,
-          description = "Key: B | b"
+          type = "unsigned int",
+          name = "sampleSize",
+          offset = 12,
+          size = 4,
+          description = "Bit depth (bits per sample): 32 (float)"
         },
         {
-          name = "KEY_C",
-          value = 67,
-          description = "Key: C | c"
-        },
+          type = "unsigned int",
+          name = "channels",
+          offset = 16,
+          size = 4,
+          description = "Number of channels (1-mono, 2-stereo, ...)"
+        }
+      }
+    },
+    {
+      name = "Sound",
+      description = "Sound",
+      size = 40,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_D",
-          value = 68,
-          description = "Key: D | d"
+          type = "AudioStream",
+          name = "stream",
+          offset = 0,
+          size = 32,
+          description = "Audio stream"
         },
         {
-          name = "KEY_E",
-          value = 69,
-          description = "Key: E | e"
-        },
+          type = "unsigned int",
+          name = "frameCount",
+          offset = 32,
+          size = 4,
+          description = "Total number of frames (considering channels)"
+        }
+      }
+    },
+    {
+      name = "Music",
+      description = "Music, audio stream, anything longer than ~10 seconds should be streamed",
+      size = 56,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_F",
-          value = 70,
-          description = "Key: F | f"
+          type = "AudioStream",
+          name = "stream",
+          offset = 0,
+          size = 32,
+          description = "Audio stream"
         },
         {
-          name = "KEY_G",
-          value = 71,
-          description = "Key: G | g"
+          type = "unsigned int",
+          name = "frameCount",
+          offset = 32,
+          size = 4,
+          description = "Total number of frames (considering channels)"
         },
         {
-          name = "KEY_H",
-          value = 72,
-          description = "Key: H | h"
+          type = "bool",
+          name = "looping",
+          offset = 36,
+          size = 1,
+          description = "Music looping enable"
         },
         {
-          name = "KEY_I",
-          value = 73,
-          description = "Key: I | i"
+          type = "int",
+          name = "ctxType",
+          offset = 40,
+          size = 4,
+          description = "Type of music context (audio filetype)"
         },
         {
-          name = "KEY_J",
-          value = 74,
-          description = "Key: J | j"
-        },
+          type = "void *",
+          name = "ctxData",
+          offset = 48,
+          size = 8,
+          description = "Audio context data, depends on type"
+        }
+      }
+    },
+    {
+      name = "VrDeviceInfo",
+      description = "VrDeviceInfo, Head-Mounted-Display device parameters",
+      size = 64,
+      alignment = 4,
+      fields = {
         {
-          name = "KEY_K",
-          value = 75,
-          description = "Key: K | k"
+          type = "int",
+          name = "hResolution",
+          offset = 0,
+          size = 4,
+          description = "Horizontal resolution in pixels"
         },
         {
-          name = "KEY_L",
-          value = 76,
-          description = "Key: L | l"
+          type = "int",
+          name = "vResolution",
+          offset = 4,
+          size = 4,
+          description = "Vertical resolution in pixels"
         },
         {
-          name = "KEY_M",
-          value = 77,
-          description = "Key: M | m"
+          type = "float",
+          name = "hScreenSize",
+          offset = 8,
+          size = 4,
+          description = "Horizontal size in meters"
         },
         {
-          name = "KEY_N",
-          value = 78,
-          description = "Key: N | n"
+          type = "float",
+          name = "vScreenSize",
+          offset = 12,
+          size = 4,
+          description = "Vertical size in meters"
         },
         {
-          name = "KEY_O",
-          value = 79,
-          description = "Key: O | o"
-        },
-        {
-          name = "KEY_P",
-          value = 80,
-          description = "Key: P | p"
-        },
-        {
-          name = "KEY_Q",
-          value = 81,
-          description = "Key: Q | q"
+          type = "float",
+          name = "vScreenCenter",
+          offset = 16,
+          size = 4,
+          description = "Screen center in meters"
         },
         {
-          name = "KEY_R",
-          value = 82,
-          description = "Key: R | r"
+          type = "float",
+          name = "eyeToScreenDistance",
+          offset = 20,
+          size = 4,
+          description = "Distance between eye and display in meters"
         },
         {
-          name = "KEY_S",
-          value = 83,
-          description = "Key: S | s"
+          type = "float",
+          name = "lensSeparationDistance",
+          offset = 24,
+          size = 4,
+          description = "Lens separation distance in meters"
         },
         {
-          name = "KEY_T",
-          value = 84,
-          description = "Key: T | t"
+          type = "float",
+          name = "interpupillaryDistance",
+          offset = 28,
+          size = 4,
+          description = "IPD (distance between pupils) in meters"
         },
         {
-          name = "KEY_U",
-          value = 85,
-          description = "Key: U | u"
+          type = "float[4]",
+          name = "lensDistortionValues",
+          offset = 32,
+          size = 16,
+          description = "Lens distortion constant parameters"
         },
         {
-          name = "KEY_V",
-          value = 86,
-          description = "Key: V | v"
-        },
+          type = "float[4]",
+          name = "chromaAbCorrection",
+          offset = 48,
+          size = 16,
+          description = "Chromatic aberration correction parameters"
+        }
+      }
+    },
+    {
+      name = "VrStereoConfig",
+      description = "VrStereoConfig, VR stereo rendering configuration for simulator",
+      size = 304,
+      alignment = 4,
+      fields = {
         {
-          name = "KEY_W",
-          value = 87,
-          description = "Key: W | w"
+          type = "Matrix[2]",
+          name = "projection",
+          offset = 0,
+          size = 128,
+          description = "VR projection matrices (per eye)"
         },
         {
-          name = "KEY_X",
-          value = 88,
-          description = "Key: X | x"
+          type = "Matrix[2]",
+          name = "viewOffset",
+          offset = 128,
+          size = 128,
+          description = "VR view offset matrices (per eye)"
         },
         {
-          name = "KEY_Y",
-          value = 89,
-          description = "Key: Y | y"
+          type = "float[2]",
+          name = "leftLensCenter",
+          offset = 256,
+          size = 8,
+          description = "VR left lens center"
         },
         {
-          name = "KEY_Z",
-          value = 90,
-          description = "Key: Z | z"
+          type = "float[2]",
+          name = "rightLensCenter",
+          offset = 264,
+          size = 8,
+          description = "VR right lens center"
         },
         {
-          name = "KEY_LEFT_BRACKET",
-          value = 91,
-          description = "Key: ["
+          type = "float[2]",
+          name = "leftScreenCenter",
+          offset = 272,
+          size = 8,
+          description = "VR left screen center"
         },
         {
-          name = "KEY_BACKSLASH",
-          value = 92,
-          description = "Key: '\\'"
+          type = "float[2]",
+          name = "rightScreenCenter",
+          offset = 280,
+          size = 8,
+          description = "VR right screen center"
         },
         {
-          name = "KEY_RIGHT_BRACKET",
-          value = 93,
-          description = "Key: ]"
+          type = "float[2]",
+          name = "scale",
+          offset = 288,
+          size = 8,
+          description = "VR distortion scale"
         },
         {
-          name = "KEY_GRAVE",
-          value = 96,
-          description = "Key: `"
-        },
+          type = "float[2]",
+          name = "scaleIn",
+          offset = 296,
+          size = 8,
+          description = "VR distortion scale in"
+        }
+      }
+    },
+    {
+      name = "FrameTimeStats",
+      description = "Frame time statistics, times in seconds",
+      size = 36,
+      alignment = 4,
+      fields = {
         {
-          name = "KEY_SPACE",
-          value = 32,
-          description = "Key: Space"
+          type = "int",
+          name = "frameCount",
+          offset = 0,
+          size = 4,
+          description = "Number of frames measured"
         },
         {
-          name = "KEY_ESCAPE",
-          value = 256,
-          description = "Key: Esc"
+          type = "float",
+          name = "average",
+          offset = 4,
+          size = 4,
+          description = "Frame time average"
         },
         {
-          name = "KEY_ENTER",
-          value = 257,
-          description = "Key: Enter"
+          type = "float",
+          name = "p50",
+          offset = 8,
+          size = 4,
+          description = "Frame time 50th percentile (median)"
         },
         {
-          name = "KEY_TAB",
-          value = 258,
-          description = "Key: Tab"
+          type = "float",
+          name = "p95",
+          offset = 12,
+          size = 4,
+          description = "Frame time 95th percentile"
         },
         {
-          name = "KEY_BACKSPACE",
-          value = 259,
-          description = "Key: Backspace"
+          type = "float",
+          name = "p99",
+          offset = 16,
+          size = 4,
+          description = "Frame time 99th percentile"
         },
         {
-          name = "KEY_INSERT",
-          value = 260,
-          description = "Key: Ins"
+          type = "float",
+          name = "max",
+          offset = 20,
+          size = 4,
+          description = "Frame time maximum"
         },
         {
-          name = "KEY_DELETE",
-          value = 261,
-          description = "Key: Del"
+          type = "float",
+          name = "update",
+          offset = 24,
+          size = 4,
+          description = "Update time average (from EndDrawing() to BeginDrawing())"
         },
         {
-          name = "KEY_RIGHT",
-          value = 262,
-          description = "Key: Cursor right"
+          type = "float",
+          name = "draw",
+          offset = 28,
+          size = 4,
+          description = "Draw time average (from BeginDrawing() to SwapScreenBuffer() end)"
         },
         {
-          name = "KEY_LEFT",
-          value = 263,
-          description = "Key: Cursor left"
-        },
+          type = "float",
+          name = "wait",
+          offset = 32,
+          size = 4,
+          description = "Wait time average (frame pacing for target FPS)"
+        }
+      }
+    },
+    {
+      name = "FilePathList",
+      description = "File path list",
+      size = 16,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_DOWN",
-          value = 264,
-          description = "Key: Cursor down"
+          type = "unsigned int",
+          name = "capacity",
+          offset = 0,
+          size = 4,
+          description = "Filepaths max entries"
         },
         {
-          name = "KEY_UP",
-          value = 265,
-          description = "Key: Cursor up"
+          type = "unsigned int",
+          name = "count",
+          offset = 4,
+          size = 4,
+          description = "Filepaths entries count"
         },
         {
-          name = "KEY_PAGE_UP",
-          value = 266,
-          description = "Key: Page up"
-        },
+          type = "char **",
+          name = "paths",
+          offset = 8,
+          size = 8,
+          description = "Filepaths entries"
+        }
+      }
+    },
+    {
+      name = "InputEvent",
+      description = "Input event, timestamped input change registered by PollInputEvents()",
+      size = 32,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_PAGE_DOWN",
-          value = 267,
-          description = "Key: Page down"
+          type = "double",
+          name = "time",
+          offset = 0,
+          size = 8,
+          description = "Event time in seconds (GetTime() reference)"
         },
         {
-          name = "KEY_HOME",
-          value = 268,
-          description = "Key: Home"
+          type = "int",
+          name = "type",
+          offset = 8,
+          size = 4,
+          description = "Event type (InputEventType)"
         },
         {
-          name = "KEY_END",
-          value = 269,
-          description = "Key: End"
+          type = "int",
+          name = "code",
+          offset = 12,
+          size = 4,
+          description = "Event code: key, char (unicode), mouse/gamepad button, gamepad axis or touch point id"
         },
         {
-          name = "KEY_CAPS_LOCK",
-          value = 280,
-          description = "Key: Caps lock"
+          type = "int",
+          name = "gamepad",
+          offset = 16,
+          size = 4,
+          description = "Gamepad index (gamepad events only)"
         },
         {
-          name = "KEY_SCROLL_LOCK",
-          value = 281,
-          description = "Key: Scroll down"
-        },
+          type = "Vector2",
+          name = "value",
+          offset = 20,
+          size = 8,
+          description = "Event value: mouse/touch position, mouse wheel move or gamepad axis movement (x)"
+        }
+      }
+    },
+    {
+      name = "MemoryStats",
+      description = "Memory allocations stats (SUPPORT_MEMORY_TRACKING)",
+      size = 16,
+      alignment = 4,
+      fields = {
         {
-          name = "KEY_NUM_LOCK",
-          value = 282,
-          description = "Key: Num lock"
+          type = "unsigned int",
+          name = "current",
+          offset = 0,
+          size = 4,
+          description = "Currently allocated memory (bytes)"
         },
         {
-          name = "KEY_PRINT_SCREEN",
-          value = 283,
-          description = "Key: Print screen"
+          type = "unsigned int",
+          name = "peak",
+          offset = 4,
+          size = 4,
+          description = "Peak allocated memory (bytes)"
         },
         {
-          name = "KEY_PAUSE",
-          value = 284,
-          description = "Key: Pause"
+          type = "unsigned int",
+          name = "count",
+          offset = 8,
+          size = 4,
+          description = "Currently allocated blocks count"
         },
         {
-          name = "KEY_F1",
-          value = 290,
-          description = "Key: F1"
-        },
+          type = "unsigned int",
+          name = "total",
+          offset = 12,
+          size = 4,
+          description = "Total allocations count"
+        }
+      }
+    },
+    {
+      name = "MemArena",
+      description = "Memory arena, linear allocator, all allocations released at once",
+      size = 16,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_F2",
-          value = 291,
-          description = "Key: F2"
+          type = "void *",
+          name = "blocks",
+          offset = 0,
+          size = 8,
+          description = "Arena memory blocks list (current block first)"
         },
         {
-          name = "KEY_F3",
-          value = 292,
-          description = "Key: F3"
-        },
+          type = "unsigned int",
+          name = "blockSize",
+          offset = 8,
+          size = 4,
+          description = "Arena memory blocks size (bytes), bigger allocations get their own block"
+        }
+      }
+    },
+    {
+      name = "MemPool",
+      description = "Memory pool, fixed-size blocks allocator",
+      size = 24,
+      alignment = 8,
+      fields = {
         {
-          name = "KEY_F4",
-          value = 293,
-          description = "Key: F4"
+          type = "unsigned char *",
+          name = "data",
+          offset = 0,
+          size = 8,
+          description = "Pool memory (blockSize*blockCount bytes)"
         },
         {
-          name = "KEY_F5",
-          value = 294,
-          description = "Key: F5"
+          type = "void *",
+          name = "freeList",
+          offset = 8,
+          size = 8,
+          description = "Pool free blocks list"
         },
         {
-          name = "KEY_F6",
-          value = 295,
-          description = "Key: F6"
+          type = "unsigned int",
+          name = "blockSize",
+          offset = 16,
+          size = 4,
+          description = "Pool block size (bytes)"
         },
         {
-          name = "KEY_F7",
-          value = 296,
-          description = "Key: F7"
-        },
+          type = "unsigned int",
+          name = "blockCount",
+          offset = 20,
+          size = 4,
+          description = "Pool blocks count"
+        }
+      }
+    }
+  },
+  aliases = {
+    {
+      type = "Vector4",
+      name = "Quaternion",
+      description = "Quaternion, 4 components (Vector4 alias)"
+    },
+    {
+      type = "Texture",
+      name = "Texture2D",
+      description = "Texture2D, same as Texture"
+    },
+    {
+      type = "Texture",
+      name = "TextureCubemap",
+      description = "TextureCubemap, same as Texture"
+    },
+    {
+      type = "Texture",
+      name = "Texture2DArray",
+      description = "Texture2DArray, same as Texture (layers of same size, sampled with sampler2DArray)"
+    },
+    {
+      type = "Texture",
+      name = "Texture3D",
+      description = "Texture3D, same as Texture (volume slices, sampled with sampler3D)"
+    },
+    {
+      type = "RenderTexture",
+      name = "RenderTexture2D",
+      description = "RenderTexture2D, same as RenderTexture"
+    },
+    {
+      type = "Camera3D",
+      name = "Camera",
+      description = "Camera type fallback, defaults to Camera3D"
+    }
+  },
+  enums = {
+    {
+      name = "ConfigFlags",
+      description = "System/Window config flags",
+      values = {
         {
-          name = "KEY_F8",
-          value = 297,
-          description = "Key: F8"
+          name = "FLAG_VSYNC_HINT",
+          value = 64,
+          description = "Set to try enabling V-Sync on GPU"
         },
         {
-          name = "KEY_F9",
-          value = 298,
-          description = "Key: F9"
+          name = "FLAG_FULLSCREEN_MODE",
+          value = 2,
+          description = "Set to run program in fullscreen"
         },
         {
-          name = "KEY_F10",
-          value = 299,
-          description = "Key: F10"
+          name = "FLAG_WINDOW_RESIZABLE",
+          value = 4,
+          description = "Set to allow resizable window"
         },
         {
-          name = "KEY_F11",
-          value = 300,
-          description = "Key: F11"
+          name = "FLAG_WINDOW_UNDECORATED",
+          value = 8,
+          description = "Set to disable window decoration (frame and buttons)"
         },
         {
-          name = "KEY_F12",
-          value = 301,
-          description = "Key: F12"
+          name = "FLAG_WINDOW_HIDDEN",
+          value = 128,
+          description = "Set to hide window"
         },
         {
-          name = "KEY_LEFT_SHIFT",
-          value = 340,
-          description = "Key: Shift left"
+          name = "FLAG_WINDOW_MINIMIZED",
+          value = 512,
+          description = "Set to minimize window (iconify)"
         },
         {
-          name = "KEY_LEFT_CONTROL",
-          value = 341,
-          description = "Key: Control left"
+          name = "FLAG_WINDOW_MAXIMIZED",
+          value = 1024,
+          description = "Set to maximize window (expanded to monitor)"
         },
         {
-          name = "KEY_LEFT_ALT",
-          value = 342,
-          description = "Key: Alt left"
+          name = "FLAG_WINDOW_UNFOCUSED",
+          value = 2048,
+          description = "Set to window non focused"
         },
         {
-          name = "KEY_LEFT_SUPER",
-          value = 343,
-          description = "Key: Super left"
+          name = "FLAG_WINDOW_TOPMOST",
+          value = 4096,
+          description = "Set to window always on top"
         },
         {
-          name = "KEY_RIGHT_SHIFT",
-          value = 344,
-          description = "Key: Shift right"
+          name = "FLAG_WINDOW_ALWAYS_RUN",
+          value = 256,
+          description = "Set to allow windows running while minimized"
         },
         {
-          name = "KEY_RIGHT_CONTROL",
-          value = 345,
-          description = "Key: Control right"
+          name = "FLAG_WINDOW_TRANSPARENT",
+          value = 16,
+          description = "Set to allow transparent framebuffer"
         },
         {
-          name = "KEY_RIGHT_ALT",
-          value = 346,
-          description = "Key: Alt right"
+          name = "FLAG_WINDOW_HIGHDPI",
+          value = 8192,
+          description = "Set to support HighDPI"
         },
         {
-          name = "KEY_RIGHT_SUPER",
-          value = 347,
-          description = "Key: Super right"
+          name = "FLAG_WINDOW_MOUSE_PASSTHROUGH",
+          value = 16384,
+          description = "Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED"
         },
         {
-          name = "KEY_KB_MENU",
-          value = 348,
-          description = "Key: KB menu"
+          name = "FLAG_MSAA_4X_HINT",
+          value = 32,
+          description = "Set to try enabling MSAA 4X"
         },
         {
-          name = "KEY_KP_0",
-          value = 320,
-          description = "Key: Keypad 0"
+          name = "FLAG_INTERLACED_HINT",
+          value = 65536,
+          description = "Set to try enabling interlaced video format (for V3D)"
         },
         {
-          name = "KEY_KP_1",
-          value = 321,
-          description = "Key: Keypad 1"
-        },
+          name = "FLAG_THREADED_RENDERER",
+          value = 131072,
+          description = "Set to present frames from a render thread, update runs in parallel (PLATFORM_DESKTOP)"
+        }
+      }
+    },
+    {
+      name = "TraceLogLevel",
+      description = "Trace log level",
+      values = {
         {
-          name = "KEY_KP_2",
-          value = 322,
-          description = "Key: Keypad 2"
+          name = "LOG_ALL",
+          value = 0,
+          description = "Display all logs"
         },
         {
-          name = "KEY_KP_3",
-          value = 323,
-          description = "Key: Keypad 3"
+          name = "LOG_TRACE",
+          value = 1,
+          description = "Trace logging, intended for internal use only"
         },
         {
-          name = "KEY_KP_4",
-          value = 324,
-          description = "Key: Keypad 4"
+          name = "LOG_DEBUG",
+          value = 2,
+          description = "Debug logging, used for internal debugging, it should be disabled on release builds"
         },
         {
-          name = "KEY_KP_5",
-          value = 325,
-          description = "Key: Keypad 5"
+          name = "LOG_INFO",
+          value = 3,
+          description = "Info logging, used for program execution info"
         },
         {
-          name = "KEY_KP_6",
-          value = 326,
-          description = "Key: Keypad 6"
+          name = "LOG_WARNING",
+          value = 4,
+          description = "Warning logging, used on recoverable failures"
         },
         {
-          name = "KEY_KP_7",
-          value = 327,
-          description = "Key: Keypad 7"
+          name = "LOG_ERROR",
+          value = 5,
+          description = "Error logging, used on unrecoverable failures"
         },
         {
-          name = "KEY_KP_8",
-          value = 328,
-          description = "Key: Keypad 8"
+          name = "LOG_FATAL",
+          value = 6,
+          description = "Fatal logging, used to abort program: exit(EXIT_FAILURE)"
         },
         {
-          name = "KEY_KP_9",
-          value = 329,
-          description = "Key: Keypad 9"
-        },
+          name = "LOG_NONE",
+          value = 7,
+          description = "Disable logging"
+        }
+      }
+    },
+    {
+      name = "KeyboardKey",
+      description = "Keyboard keys (US keyboard layout)",
+      values = {
         {
-          name = "KEY_KP_DECIMAL",
-          value = 330,
-          description = "Key: Keypad ."
+          name = "KEY_NULL",
+          value = 0,
+          description = "Key: NULL, used for no key pressed"
         },
         {
-          name = "KEY_KP_DIVIDE",
-          value = 331,
-          description = "Key: Keypad /"
+          name = "KEY_APOSTROPHE",
+          value = 39,
+          description = "Key: '"
         },
         {
-          name = "KEY_KP_MULTIPLY",
-          value = 332,
-          description = "Key: Keypad *"
+          name = "KEY_COMMA",
+          value = 44,
+          description = "Key: ,"
         },
         {
-          name = "KEY_KP_SUBTRACT",
-          value = 333,
-          description = "Key: Keypad -"
+          name = "KEY_MINUS",
+          value = 45,
+          description = "Key: -"
         },
         {
-          name = "KEY_KP_ADD",
-          value = 334,
-          description = "Key: Keypad +"
+          name = "KEY_PERIOD",
+          value = 46,
+          description = "Key: ."
         },
         {
-          name = "KEY_KP_ENTER",
-          value = 335,
-          description = "Key: Keypad Enter"
+          name = "KEY_SLASH",
+          value = 47,
+          description = "Key: /"
         },
         {
-          name = "KEY_KP_EQUAL",
-          value = 336,
-          description = "Key: Keypad ="
+          name = "KEY_ZERO",
+          value = 48,
+          description = "Key: 0"
         },
         {
-          name = "KEY_BACK",
-          value = 4,
-          description = "Key: Android back button"
+          name = "KEY_ONE",
+          value = 49,
+          description = "Key: 1"
         },
         {
-          name = "KEY_MENU",
-          value = 82,
-          description = "Key: Android menu button"
+          name = "KEY_TWO",
+          value = 50,
+          description = "Key: 2"
         },
         {
-          name = "KEY_VOLUME_UP",
-          value = 24,
-          description = "Key: Android volume up button"
+          name = "KEY_THREE",
+          value = 51,
+          description = "Key: 3"
         },
         {
-          name = "KEY_VOLUME_DOWN",
-          value = 25,
-          description = "Key: Android volume down button"
-        }
-      }
-    },
-    {
-      name = "MouseButton",
-      description = "Mouse buttons",
-      values = {
+          name = "KEY_FOUR",
+          value = 52,
+          description = "Key: 4"
+        },
         {
-          name = "MOUSE_BUTTON_LEFT",
-          value = 0,
-          description = "Mouse button left"
+          name = "KEY_FIVE",
+          value = 53,
+          description = "Key: 5"
         },
         {
-          name = "MOUSE_BUTTON_RIGHT",
-          value = 1,
-          description = "Mouse button right"
+          name = "KEY_SIX",
+          value = 54,
+          description = "Key: 6"
         },
         {
-          name = "MOUSE_BUTTON_MIDDLE",
-          value = 2,
-          description = "Mouse button middle (pressed wheel)"
+          name = "KEY_SEVEN",
+          value = 55,
+          description = "Key: 7"
         },
         {
-          name = "MOUSE_BUTTON_SIDE",
-          value = 3,
-          description = "Mouse button side (advanced mouse device)"
+          name = "KEY_EIGHT",
+          value = 56,
+          description = "Key: 8"
         },
         {
-          name = "MOUSE_BUTTON_EXTRA",
-          value = 4,
-          description = "Mouse button extra (advanced mouse device)"
+          name = "KEY_NINE",
+          value = 57,
+          description = "Key: 9"
         },
         {
-          name = "MOUSE_BUTTON_FORWARD",
-          value = 5,
-          description = "Mouse button forward (advanced mouse device)"
+          name = "KEY_SEMICOLON",
+          value = 59,
+          description = "Key: ;"
         },
         {
-          name = "MOUSE_BUTTON_BACK",
-          value = 6,
-          description = "Mouse button back (advanced mouse device)"
-        }
-      }
-    },
-    {
-      name = "MouseCursor",
-      description = "Mouse cursor",
-      values = {
+          name = "KEY_EQUAL",
+          value = 61,
+          description = "Key: ="
+        },
         {
-          name = "MOUSE_CURSOR_DEFAULT",
-          value = 0,
-          description = "Default pointer shape"
+          name = "KEY_A",
+          value = 65,
+          description = "Key: A | a"
         },
         {
-          name = "MOUSE_CURSOR_ARROW",
-          value = 1,
-          description = "Arrow shape"
+          name = "KEY_B",
+          value = 66,
+          description = "Key: B | b"
         },
         {
-          name = "MOUSE_CURSOR_IBEAM",
-          value = 2,
-          description = "Text writing cursor shape"
+          name = "KEY_C",
+          value = 67,
+          description = "Key: C | c"
         },
         {
-          name = "MOUSE_CURSOR_CROSSHAIR",
-          value = 3,
-          description = "Cross shape"
+          name = "KEY_D",
+          value = 68,
+          description = "Key: D | d"
         },
         {
-          name = "MOUSE_CURSOR_POINTING_HAND",
-          value = 4,
-          description = "Pointing hand cursor"
+          name = "KEY_E",
+          value = 69,
+          description = "Key: E | e"
         },
         {
-          name = "MOUSE_CURSOR_RESIZE_EW",
-          value = 5,
-          description = "Horizontal resize/move arrow shape"
+          name = "KEY_F",
+          value = 70,
+          description = "Key: F | f"
         },
         {
-          name = "MOUSE_CURSOR_RESIZE_NS",
-          value = 6,
-          description = "Vertical resize/move arrow shape"
+          name = "KEY_G",
+          value = 71,
+          description = "Key: G | g"
         },
         {
-          name = "MOUSE_CURSOR_RESIZE_NWSE",
-          value = 7,
-          description = "Top-left to bottom-right diagonal resize/move arrow shape"
+          name = "KEY_H",
+          value = 72,
+          description = "Key: H | h"
         },
         {
-          name = "MOUSE_CURSOR_RESIZE_NESW",
-          value = 8,
-          description = "The top-right to bottom-left diagonal resize/move arrow shape"
+          name = "KEY_I",
+          value = 73,
+          description = "Key: I | i"
         },
         {
-          name = "MOUSE_CURSOR_RESIZE_ALL",
-          value = 9,
-          description = "The omnidirectional resize/move cursor shape"
+          name = "KEY_J",
+          value = 74,
+          description = "Key: J | j"
         },
         {
-          name = "MOUSE_CURSOR_NOT_ALLOWED",
-          value = 10,
-          description = "The operation-not-allowed shape"
-        }
-      }
-    },
-    {
-      name = "GamepadButton",
-      description = "Gamepad buttons",
-      values = {
+          name = "KEY_K",
+          value = 75,
+          description = "Key: K | k"
+        },
         {
-          name = "GAMEPAD_BUTTON_UNKNOWN",
-          value = 0,
-          description = "Unknown button, just for error checking"
+          name = "KEY_L",
+          value = 76,
+          description = "Key: L | l"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_FACE_UP",
-          value = 1,
-          description = "Gamepad left DPAD up button"
+          name = "KEY_M",
+          value = 77,
+          description = "Key: M | m"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_FACE_RIGHT",
-          value = 2,
-          description = "Gamepad left DPAD right button"
+          name = "KEY_N",
+          value = 78,
+          description = "Key: N | n"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_FACE_DOWN",
-          value = 3,
-          description = "Gamepad left DPAD down button"
+          name = "KEY_O",
+          value = 79,
+          description = "Key: O | o"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_FACE_LEFT",
-          value = 4,
-          description = "Gamepad left DPAD left button"
+          name = "KEY_P",
+          value = 80,
+          description = "Key: P | p"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_FACE_UP",
-          value = 5,
-          description = "Gamepad right button up (i.e. PS3: Triangle, Xbox: Y)"
+          name = "KEY_Q",
+          value = 81,
+          description = "Key: Q | q"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_FACE_RIGHT",
-          value = 6,
-          description = "Gamepad right button right (i.e. PS3: Square, Xbox: X)"
+          name = "KEY_R",
+          value = 82,
+          description = "Key: R | r"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_FACE_DOWN",
-          value = 7,
-          description = "Gamepad right button down (i.e. PS3: Cross, Xbox: A)"
+          name = "KEY_S",
+          value = 83,
+          description = "Key: S | s"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_FACE_LEFT",
-          value = 8,
-          description = "Gamepad right button left (i.e. PS3: Circle, Xbox: B)"
+          name = "KEY_T",
+          value = 84,
+          description = "Key: T | t"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_TRIGGER_1",
-          value = 9,
-          description = "Gamepad top/back trigger left (first), it could be a trailing button"
+          name = "KEY_U",
+          value = 85,
+          description = "Key: U | u"
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_TRIGGER_2",
-          value = 10,
-          description = "Gamepad top/back trigger left (second), it could be a trailing button"
+          name = "KEY_V",
+          value = 86,
+          description = "Key: V | v"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_TRIGGER_1",
-          value = 11,
-          description = "Gamepad top/back trigger right (one), it could be a trailing button"
+          name = "KEY_W",
+          value = 87,
+          description = "Key: W | w"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_TRIGGER_2",
-          value = 12,
-          description = "Gamepad top/back trigger right (second), it could be a trailing button"
+          name = "KEY_X",
+          value = 88,
+          description = "Key: X | x"
         },
         {
-          name = "GAMEPAD_BUTTON_MIDDLE_LEFT",
-          value = 13,
-          description = "Gamepad center buttons, left one (i.e. PS3: Select)"
+          name = "KEY_Y",
+          value = 89,
+          description = "Key: Y | y"
         },
         {
-          name = "GAMEPAD_BUTTON_MIDDLE",
-          value = 14,
-          description = "Gamepad center buttons, middle one (i.e. PS3: PS, Xbox: XBOX)"
+          name = "KEY_Z",
+          value = 90,
+          description = "Key: Z | z"
         },
         {
-          name = "GAMEPAD_BUTTON_MIDDLE_RIGHT",
-          value = 15,
-          description = "Gamepad center buttons, right one (i.e. PS3: Start)"
+          name = "KEY_LEFT_BRACKET",
+          value = 91,
+          description = "Key: ["
         },
         {
-          name = "GAMEPAD_BUTTON_LEFT_THUMB",
-          value = 16,
-          description = "Gamepad joystick pressed button left"
+          name = "KEY_BACKSLASH",
+          value = 92,
+          description = "Key: '\\'"
         },
         {
-          name = "GAMEPAD_BUTTON_RIGHT_THUMB",
-          value = 17,
-          description = "Gamepad joystick pressed button right"
-        }
-      }
-    },
-    {
-      name = "GamepadAxis",
-      description = "Gamepad axis",
-      values = {
-        {
-          name = "GAMEPAD_AXIS_LEFT_X",
-          value = 0,
-          description = "Gamepad left stick X axis"
+          name = "KEY_RIGHT_BRACKET",
+          value = 93,
+          description = "Key: ]"
         },
         {
-          name = "GAMEPAD_AXIS_LEFT_Y",
-          value = 1,
-          description = "Gamepad left stick Y axis"
+          name = "KEY_GRAVE",
+          value = 96,
+          description = "Key: `"
         },
         {
-          name = "GAMEPAD_AXIS_RIGHT_X",
-          value = 2,
-          description = "Gamepad right stick X axis"
+          name = "KEY_SPACE",
+          value = 32,
+          description = "Key: Space"
         },
         {
-          name = "GAMEPAD_AXIS_RIGHT_Y",
-          value = 3,
-          description = "Gamepad right stick Y axis"
+          name = "KEY_ESCAPE",
+          value = 256,
+          description = "Key: Esc"
         },
         {
-          name = "GAMEPAD_AXIS_LEFT_TRIGGER",
-          value = 4,
-          description = "Gamepad back trigger left, pressure level: [1..-1]"
+          name = "KEY_ENTER",
+          value = 257,
+          description = "Key: Enter"
         },
         {
-          name = "GAMEPAD_AXIS_RIGHT_TRIGGER",
-          value = 5,
-          description = "Gamepad back trigger right, pressure level: [1..-1]"
-        }
-      }
-    },
-    {
-      name = "MaterialMapIndex",
-      description = "Material map index",
-      values = {
-        {
-          name = "MATERIAL_MAP_ALBEDO",
-          value = 0,
-          description = "Albedo material (same as: MATERIAL_MAP_DIFFUSE)"
+          name = "KEY_TAB",
+          value = 258,
+          description = "Key: Tab"
         },
         {
-          name = "MATERIAL_MAP_METALNESS",
-          value = 1,
-          description = "Metalness material (same as: MATERIAL_MAP_SPECULAR)"
+          name = "KEY_BACKSPACE",
+          value = 259,
+          description = "Key: Backspace"
         },
         {
-          name = "MATERIAL_MAP_NORMAL",
-          value = 2,
-          description = "Normal material"
+          name = "KEY_INSERT",
+          value = 260,
+          description = "Key: Ins"
         },
         {
-          name = "MATERIAL_MAP_ROUGHNESS",
-          value = 3,
-          description = "Roughness material"
+          name = "KEY_DELETE",
+          value = 261,
+          description = "Key: Del"
         },
         {
-          name = "MATERIAL_MAP_OCCLUSION",
-          value = 4,
-          description = "Ambient occlusion material"
+          name = "KEY_RIGHT",
+          value = 262,
+          description = "Key: Cursor right"
         },
         {
-          name = "MATERIAL_MAP_EMISSION",
-          value = 5,
-          description = "Emission material"
+          name = "KEY_LEFT",
+          value = 263,
+          description = "Key: Cursor left"
         },
         {
-          name = "MATERIAL_MAP_HEIGHT",
-          value = 6,
-          description = "Heightmap material"
+          name = "KEY_DOWN",
+          value = 264,
+          description = "Key: Cursor down"
         },
         {
-          name = "MATERIAL_MAP_CUBEMAP",
-          value = 7,
-          description = "Cubemap material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+          name = "KEY_UP",
+          value = 265,
+          description = "Key: Cursor up"
         },
         {
-          name = "MATERIAL_MAP_IRRADIANCE",
-          value = 8,
-          description = "Irradiance material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+          name = "KEY_PAGE_UP",
+          value = 266,
+          description = "Key: Page up"
         },
         {
-          name = "MATERIAL_MAP_PREFILTER",
-          value = 9,
-          description = "Prefilter material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+          name = "KEY_PAGE_DOWN",
+          value = 267,
+          description = "Key: Page down"
         },
         {
-          name = "MATERIAL_MAP_BRDF",
-          value = 10,
-          description = "Brdf material"
-        }
-      }
-    },
-    {
-      name = "ShaderLocationIndex",
-      description = "Shader location index",
-      values = {
+          name = "KEY_HOME",
+          value = 268,
+          description = "Key: Home"
+        },
         {
-          name = "SHADER_LOC_VERTEX_POSITION",
-          value = 0,
-          description = "Shader location: vertex attribute: position"
+          name = "KEY_END",
+          value = 269,
+          description = "Key: End"
         },
         {
-          name = "SHADER_LOC_VERTEX_TEXCOORD01",
-          value = 1,
-          description = "Shader location: vertex attribute: texcoord01"
+          name = "KEY_CAPS_LOCK",
+          value = 280,
+          description = "Key: Caps lock"
         },
         {
-          name = "SHADER_LOC_VERTEX_TEXCOORD02",
-          value = 2,
-          description = "Shader location: vertex attribute: texcoord02"
+          name = "KEY_SCROLL_LOCK",
+          value = 281,
+          description = "Key: Scroll down"
         },
         {
-          name = "SHADER_LOC_VERTEX_NORMAL",
-          value = 3,
-          description = "Shader location: vertex attribute: normal"
+          name = "KEY_NUM_LOCK",
+          value = 282,
+          description = "Key: Num lock"
         },
         {
-          name = "SHADER_LOC_VERTEX_TANGENT",
-          value = 4,
-          description = "Shader location: vertex attribute: tangent"
+          name = "KEY_PRINT_SCREEN",
+          value = 283,
+          description = "Key: Print screen"
         },
         {
-          name = "SHADER_LOC_VERTEX_COLOR",
-          value = 5,
-          description = "Shader location: vertex attribute: color"
+          name = "KEY_PAUSE",
+          value = 284,
+          description = "Key: Pause"
         },
         {
-          name = "SHADER_LOC_MATRIX_MVP",
-          value = 6,
-          description = "Shader location: matrix uniform: model-view-projection"
+          name = "KEY_F1",
+          value = 290,
+          description = "Key: F1"
         },
         {
-          name = "SHADER_LOC_MATRIX_VIEW",
-          value = 7,
-          description = "Shader location: matrix uniform: view (camera transform)"
+          name = "KEY_F2",
+          value = 291,
+          description = "Key: F2"
         },
         {
-          name = "SHADER_LOC_MATRIX_PROJECTION",
-          value = 8,
-          description = "Shader location: matrix uniform: projection"
+          name = "KEY_F3",
+          value = 292,
+          description = "Key: F3"
         },
         {
-          name = "SHADER_LOC_MATRIX_MODEL",
-          value = 9,
-          description = "Shader location: matrix uniform: model (transform)"
+          name = "KEY_F4",
+          value = 293,
+          description = "Key: F4"
         },
         {
-          name = "SHADER_LOC_MATRIX_NORMAL",
-          value = 10,
-          description = "Shader location: matrix uniform: normal"
+          name = "KEY_F5",
+          value = 294,
+          description = "Key: F5"
         },
         {
-          name = "SHADER_LOC_VECTOR_VIEW",
-          value = 11,
-          description = "Shader location: vector uniform: view"
+          name = "KEY_F6",
+          value = 295,
+          description = "Key: F6"
         },
         {
-          name = "SHADER_LOC_COLOR_DIFFUSE",
-          value = 12,
-          description = "Shader location: vector uniform: diffuse color"
+          name = "KEY_F7",
+          value = 296,
+          description = "Key: F7"
         },
         {
-          name = "SHADER_LOC_COLOR_SPECULAR",
-          value = 13,
-          description = "Shader location: vector uniform: specular color"
+          name = "KEY_F8",
+          value = 297,
+          description = "Key: F8"
         },
         {
-          name = "SHADER_LOC_COLOR_AMBIENT",
-          value = 14,
-          description = "Shader location: vector uniform: ambient color"
+          name = "KEY_F9",
+          value = 298,
+          description = "Key: F9"
         },
         {
-          name = "SHADER_LOC_MAP_ALBEDO",
-          value = 15,
-          description = "Shader location: sampler2d texture: albedo (same as: SHADER_LOC_MAP_DIFFUSE)"
+          name = "KEY_F10",
+          value = 299,
+          description = "Key: F10"
         },
         {
-          name = "SHADER_LOC_MAP_METALNESS",
-          value = 16,
-          description = "Shader location: sampler2d texture: metalness (same as: SHADER_LOC_MAP_SPECULAR)"
+          name = "KEY_F11",
+          value = 300,
+          description = "Key: F11"
         },
         {
-          name = "SHADER_LOC_MAP_NORMAL",
-          value = 17,
-          description = "Shader location: sampler2d texture: normal"
+          name = "KEY_F12",
+          value = 301,
+          description = "Key: F12"
         },
         {
-          name = "SHADER_LOC_MAP_ROUGHNESS",
-          value = 18,
-          description = "Shader location: sampler2d texture: roughness"
+          name = "KEY_LEFT_SHIFT",
+          value = 340,
+          description = "Key: Shift left"
         },
         {
-          name = "SHADER_LOC_MAP_OCCLUSION",
-          value = 19,
-          description = "Shader location: sampler2d texture: occlusion"
+          name = "KEY_LEFT_CONTROL",
+          value = 341,
+          description = "Key: Control left"
         },
         {
-          name = "SHADER_LOC_MAP_EMISSION",
-          value = 20,
-          description = "Shader location: sampler2d texture: emission"
+          name = "KEY_LEFT_ALT",
+          value = 342,
+          description = "Key: Alt left"
         },
         {
-          name = "SHADER_LOC_MAP_HEIGHT",
-          value = 21,
-          description = "Shader location: sampler2d texture: height"
+          name = "KEY_LEFT_SUPER",
+          value = 343,
+          description = "Key: Super left"
         },
         {
-          name = "SHADER_LOC_MAP_CUBEMAP",
-          value = 22,
-          description = "Shader location: samplerCube texture: cubemap"
+          name = "KEY_RIGHT_SHIFT",
+          value = 344,
+          description = "Key: Shift right"
         },
         {
-          name = "SHADER_LOC_MAP_IRRADIANCE",
-          value = 23,
-          description = "Shader location: samplerCube texture: irradiance"
+          name = "KEY_RIGHT_CONTROL",
+          value = 345,
+          description = "Key: Control right"
         },
         {
-          name = "SHADER_LOC_MAP_PREFILTER",
-          value = 24,
-          description = "Shader location: samplerCube texture: prefilter"
+          name = "KEY_RIGHT_ALT",
+          value = 346,
+          description = "Key: Alt right"
         },
         {
-          name = "SHADER_LOC_MAP_BRDF",
-          value = 25,
-          description = "Shader location: sampler2d texture: brdf"
-        }
-      }
-    },
-    {
-      name = "ShaderUniformDataType",
-      description = "Shader uniform data type",
-      values = {
+          name = "KEY_RIGHT_SUPER",
+          value = 347,
+          description = "Key: Super right"
+        },
         {
-          name = "SHADER_UNIFORM_FLOAT",
-          value = 0,
-          description = "Shader uniform type: float"
+          name = "KEY_KB_MENU",
+          value = 348,
+          description = "Key: KB menu"
         },
         {
-          name = "SHADER_UNIFORM_VEC2",
-          value = 1,
-          description = "Shader uniform type: vec2 (2 float)"
+          name = "KEY_KP_0",
+          value = 320,
+          description = "Key: Keypad 0"
         },
         {
-          name = "SHADER_UNIFORM_VEC3",
-          value = 2,
-          description = "Shader uniform type: vec3 (3 float)"
+          name = "KEY_KP_1",
+          value = 321,
+          description = "Key: Keypad 1"
         },
         {
-          name = "SHADER_UNIFORM_VEC4",
-          value = 3,
-          description = "Shader uniform type: vec4 (4 float)"
+          name = "KEY_KP_2",
+          value = 322,
+          description = "Key: Keypad 2"
         },
         {
-          name = "SHADER_UNIFORM_INT",
-          value = 4,
-          description = "Shader uniform type: int"
+          name = "KEY_KP_3",
+          value = 323,
+          description = "Key: Keypad 3"
         },
         {
-          name = "SHADER_UNIFORM_IVEC2",
-          value = 5,
-          description = "Shader uniform type: ivec2 (2 int)"
+          name = "KEY_KP_4",
+          value = 324,
+          description = "Key: Keypad 4"
         },
         {
-          name = "SHADER_UNIFORM_IVEC3",
-          value = 6,
-          description = "Shader uniform type: ivec3 (3 int)"
+          name = "KEY_KP_5",
+          value = 325,
+          description = "Key: Keypad 5"
         },
         {
-          name = "SHADER_UNIFORM_IVEC4",
-          value = 7,
-          description = "Shader uniform type: ivec4 (4 int)"
+          name = "KEY_KP_6",
+          value = 326,
+          description = "Key: Keypad 6"
         },
         {
-          name = "SHADER_UNIFORM_SAMPLER2D",
-          value = 8,
-          description = "Shader uniform type: sampler2d"
+          name = "KEY_KP_7",
+          value = 327,
+          description = "Key: Keypad 7"
+        },
+        {
+          name = "KEY_KP_8",
+          value = 328,
+          description = "Key: Keypad 8"
+        },
+        {
+          name = "KEY_KP_9",
+          value = 329,
+          description = "Key: Keypad 9"
+        },
+        {
+          name = "KEY_KP_DECIMAL",
+          value = 330,
+          description = "Key: Keypad ."
+        },
+        {
+          name = "KEY_KP_DIVIDE",
+          value = 331,
+          description = "Key: Keypad /"
+        },
+        {
+          name = "KEY_KP_MULTIPLY",
+          value = 332,
+          description = "Key: Keypad *"
+        },
+        {
+          name = "KEY_KP_SUBTRACT",
+          value = 333,
+          description = "Key: Keypad -"
+        },
+        {
+          name = "KEY_KP_ADD",
+          value = 334,
+          description = "Key: Keypad +"
+        },
+        {
+          name = "KEY_KP_ENTER",
+          value = 335,
+          description = "Key: Keypad Enter"
+        },
+        {
+          name = "KEY_KP_EQUAL",
+          value = 336,
+          description = "Key: Keypad ="
+        },
+        {
+          name = "KEY_BACK",
+          value = 4,
+          description = "Key: Android back button"
+        },
+        {
+          name = "KEY_MENU",
+          value = 82,
+          description = "Key: Android menu button"
+        },
+        {
+          name = "KEY_VOLUME_UP",
+          value = 24,
+          description = "Key: Android volume up button"
+        },
+        {
+          name = "KEY_VOLUME_DOWN",
+          value = 25,
+          description = "Key: Android volume down button"
         }
       }
     },
     {
-      name = "ShaderAttributeDataType",
-      description = "Shader attribute data types",
+      name = "MouseButton",
+      description = "Mouse buttons",
       values = {
         {
-          name = "SHADER_ATTRIB_FLOAT",
+          name = "MOUSE_BUTTON_LEFT",
           value = 0,
-          description = "Shader attribute type: float"
+          description = "Mouse button left"
         },
         {
-          name = "SHADER_ATTRIB_VEC2",
+          name = "MOUSE_BUTTON_RIGHT",
           value = 1,
-          description = "Shader attribute type: vec2 (2 float)"
+          description = "Mouse button right"
         },
         {
-          name = "SHADER_ATTRIB_VEC3",
+          name = "MOUSE_BUTTON_MIDDLE",
           value = 2,
-          description = "Shader attribute type: vec3 (3 float)"
+          description = "Mouse button middle (pressed wheel)"
         },
         {
-          name = "SHADER_ATTRIB_VEC4",
+          name = "MOUSE_BUTTON_SIDE",
           value = 3,
-          description = "Shader attribute type: vec4 (4 float)"
+          description = "Mouse button side (advanced mouse device)"
+        },
+        {
+          name = "MOUSE_BUTTON_EXTRA",
+          value = 4,
+          description = "Mouse button extra (advanced mouse device)"
+        },
+        {
+          name = "MOUSE_BUTTON_FORWARD",
+          value = 5,
+          description = "Mouse button forward (advanced mouse device)"
+        },
+        {
+          name = "MOUSE_BUTTON_BACK",
+          value = 6,
+          description = "Mouse button back (advanced mouse device)"
         }
       }
     },
     {
-      name = "PixelFormat",
-      description = "Pixel formats",
+      name = "MouseCursor",
+      description = "Mouse cursor",
       values = {
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_GRAYSCALE",
+          name = "MOUSE_CURSOR_DEFAULT",
+          value = 0,
+          description = "Default pointer shape"
+        },
+        {
+          name = "MOUSE_CURSOR_ARROW",
           value = 1,
-          description = "8 bit per pixel (no alpha)"
+          description = "Arrow shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA",
+          name = "MOUSE_CURSOR_IBEAM",
           value = 2,
-          description = "8*2 bpp (2 channels)"
+          description = "Text writing cursor shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R5G6B5",
+          name = "MOUSE_CURSOR_CROSSHAIR",
           value = 3,
-          description = "16 bpp"
+          description = "Cross shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R8G8B8",
+          name = "MOUSE_CURSOR_POINTING_HAND",
           value = 4,
-          description = "24 bpp"
+          description = "Pointing hand cursor"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R5G5B5A1",
+          name = "MOUSE_CURSOR_RESIZE_EW",
           value = 5,
-          description = "16 bpp (1 bit alpha)"
+          description = "Horizontal resize/move arrow shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R4G4B4A4",
+          name = "MOUSE_CURSOR_RESIZE_NS",
           value = 6,
-          description = "16 bpp (4 bit alpha)"
+          description = "Vertical resize/move arrow shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R8G8B8A8",
+          name = "MOUSE_CURSOR_RESIZE_NWSE",
           value = 7,
-          description = "32 bpp"
+          description = "Top-left to bottom-right diagonal resize/move arrow shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R32",
+          name = "MOUSE_CURSOR_RESIZE_NESW",
           value = 8,
-          description = "32 bpp (1 channel - float)"
+          description = "The top-right to bottom-left diagonal resize/move arrow shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R32G32B32",
+          name = "MOUSE_CURSOR_RESIZE_ALL",
           value = 9,
-          description = "32*3 bpp (3 channels - float)"
+          description = "The omnidirectional resize/move cursor shape"
         },
         {
-          name = "PIXELFORMAT_UNCOMPRESSED_R32G32B32A32",
+          name = "MOUSE_CURSOR_NOT_ALLOWED",
           value = 10,
-          description = "32*4 bpp (4 channels - float)"
+          description = "The operation-not-allowed shape"
+        }
+      }
+    },
+    {
+      name = "GamepadButton",
+      description = "Gamepad buttons",
+      values = {
+        {
+          name = "GAMEPAD_BUTTON_UNKNOWN",
+          value = 0,
+          description = "Unknown button, just for error checking"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_DXT1_RGB",
-          value = 11,
-          description = "4 bpp (no alpha)"
+          name = "GAMEPAD_BUTTON_LEFT_FACE_UP",
+          value = 1,
+          description = "Gamepad left DPAD up button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_DXT1_RGBA",
-          value = 12,
-          description = "4 bpp (1 bit alpha)"
+          name = "GAMEPAD_BUTTON_LEFT_FACE_RIGHT",
+          value = 2,
+          description = "Gamepad left DPAD right button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_DXT3_RGBA",
-          value = 13,
-          description = "8 bpp"
+          name = "GAMEPAD_BUTTON_LEFT_FACE_DOWN",
+          value = 3,
+          description = "Gamepad left DPAD down button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_DXT5_RGBA",
-          value = 14,
-          description = "8 bpp"
+          name = "GAMEPAD_BUTTON_LEFT_FACE_LEFT",
+          value = 4,
+          description = "Gamepad left DPAD left button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_ETC1_RGB",
-          value = 15,
-          description = "4 bpp"
+          name = "GAMEPAD_BUTTON_RIGHT_FACE_UP",
+          value = 5,
+          description = "Gamepad right button up (i.e. PS3: Triangle, Xbox: Y)"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_ETC2_RGB",
-          value = 16,
-          description = "4 bpp"
+          name = "GAMEPAD_BUTTON_RIGHT_FACE_RIGHT",
+          value = 6,
+          description = "Gamepad right button right (i.e. PS3: Square, Xbox: X)"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA",
-          value = 17,
-          description = "8 bpp"
+          name = "GAMEPAD_BUTTON_RIGHT_FACE_DOWN",
+          value = 7,
+          description = "Gamepad right button down (i.e. PS3: Cross, Xbox: A)"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_PVRT_RGB",
-          value = 18,
-          description = "4 bpp"
+          name = "GAMEPAD_BUTTON_RIGHT_FACE_LEFT",
+          value = 8,
+          description = "Gamepad right button left (i.e. PS3: Circle, Xbox: B)"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_PVRT_RGBA",
-          value = 19,
-          description = "4 bpp"
+          name = "GAMEPAD_BUTTON_LEFT_TRIGGER_1",
+          value = 9,
+          description = "Gamepad top/back trigger left (first), it could be a trailing button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA",
-          value = 20,
-          description = "8 bpp"
+          name = "GAMEPAD_BUTTON_LEFT_TRIGGER_2",
+          value = 10,
+          description = "Gamepad top/back trigger left (second), it could be a trailing button"
         },
         {
-          name = "PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA",
-          value = 21,
-          description = "2 bpp"
-        }
-      }
-    },
-    {
-      name = "TextureFilter",
-      description = "Texture parameters: filter mode",
-      values = {
+          name = "GAMEPAD_BUTTON_RIGHT_TRIGGER_1",
+          value = 11,
+          description = "Gamepad top/back trigger right (one), it could be a trailing button"
+        },
         {
-          name = "TEXTURE_FILTER_POINT",
-          value = 0,
-          description = "No filter, just pixel approximation"
+          name = "GAMEPAD_BUTTON_RIGHT_TRIGGER_2",
+          value = 12,
+          description = "Gamepad top/back trigger right (second), it could be a trailing button"
         },
         {
-          name = "TEXTURE_FILTER_BILINEAR",
-          value = 1,
-          description = "Linear filtering"
+          name = "GAMEPAD_BUTTON_MIDDLE_LEFT",
+          value = 13,
+          description = "Gamepad center buttons, left one (i.e. PS3: Select)"
         },
         {
-          name = "TEXTURE_FILTER_TRILINEAR",
-          value = 2,
-          description = "Trilinear filtering (linear with mipmaps)"
+          name = "GAMEPAD_BUTTON_MIDDLE",
+          value = 14,
+          description = "Gamepad center buttons, middle one (i.e. PS3: PS, Xbox: XBOX)"
         },
         {
-          name = "TEXTURE_FILTER_ANISOTROPIC_4X",
-          value = 3,
-          description = "Anisotropic filtering 4x"
+          name = "GAMEPAD_BUTTON_MIDDLE_RIGHT",
+          value = 15,
+          description = "Gamepad center buttons, right one (i.e. PS3: Start)"
         },
         {
-          name = "TEXTURE_FILTER_ANISOTROPIC_8X",
-          value = 4,
-          description = "Anisotropic filtering 8x"
+          name = "GAMEPAD_BUTTON_LEFT_THUMB",
+          value = 16,
+          description = "Gamepad joystick pressed button left"
         },
         {
-          name = "TEXTURE_FILTER_ANISOTROPIC_16X",
-          value = 5,
-          description = "Anisotropic filtering 16x"
+          name = "GAMEPAD_BUTTON_RIGHT_THUMB",
+          value = 17,
+          description = "Gamepad joystick pressed button right"
         }
       }
     },
     {
-      name = "TextureWrap",
-      description = "Texture parameters: wrap mode",
+      name = "GamepadAxis",
+      description = "Gamepad axis",
       values = {
         {
-          name = "TEXTURE_WRAP_REPEAT",
+          name = "GAMEPAD_AXIS_LEFT_X",
           value = 0,
-          description = "Repeats texture in tiled mode"
+          description = "Gamepad left stick X axis"
         },
         {
-          name = "TEXTURE_WRAP_CLAMP",
+          name = "GAMEPAD_AXIS_LEFT_Y",
           value = 1,
-          description = "Clamps texture to edge pixel in tiled mode"
+          description = "Gamepad left stick Y axis"
         },
         {
-          name = "TEXTURE_WRAP_MIRROR_REPEAT",
+          name = "GAMEPAD_AXIS_RIGHT_X",
           value = 2,
-          description = "Mirrors and repeats the texture in tiled mode"
+          description = "Gamepad right stick X axis"
         },
         {
-          name = "TEXTURE_WRAP_MIRROR_CLAMP",
+          name = "GAMEPAD_AXIS_RIGHT_Y",
           value = 3,
-          description = "Mirrors and clamps to border the texture in tiled mode"
+          description = "Gamepad right stick Y axis"
+        },
+        {
+          name = "GAMEPAD_AXIS_LEFT_TRIGGER",
+          value = 4,
+          description = "Gamepad back trigger left, pressure level: [1..-1]"
+        },
+        {
+          name = "GAMEPAD_AXIS_RIGHT_TRIGGER",
+          value = 5,
+          description = "Gamepad back trigger right, pressure level: [1..-1]"
         }
       }
     },
     {
-      name = "CubemapLayout",
-      description = "Cubemap layouts",
+      name = "InputEventType",
+      description = "Input event types",
       values = {
         {
-          name = "CUBEMAP_LAYOUT_AUTO_DETECT",
+          name = "INPUT_EVENT_KEY_UP",
           value = 0,
-          description = "Automatically detect layout type"
+          description = "Key released (code: key)"
         },
         {
-          name = "CUBEMAP_LAYOUT_LINE_VERTICAL",
+          name = "INPUT_EVENT_KEY_DOWN",
           value = 1,
-          description = "Layout is defined by a vertical line with faces"
+          description = "Key pressed (code: key)"
         },
         {
-          name = "CUBEMAP_LAYOUT_LINE_HORIZONTAL",
+          name = "INPUT_EVENT_KEY_REPEAT",
           value = 2,
-          description = "Layout is defined by a horizontal line with faces"
+          description = "Key pressed repeat, key held down (code: key)"
         },
         {
-          name = "CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR",
+          name = "INPUT_EVENT_CHAR",
           value = 3,
-          description = "Layout is defined by a 3x4 cross with cubemap faces"
+          description = "Char pressed (code: unicode)"
         },
         {
-          name = "CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE",
+          name = "INPUT_EVENT_MOUSE_BUTTON_UP",
           value = 4,
-          description = "Layout is defined by a 4x3 cross with cubemap faces"
+          description = "Mouse button released (code: button)"
         },
         {
-          name = "CUBEMAP_LAYOUT_PANORAMA",
+          name = "INPUT_EVENT_MOUSE_BUTTON_DOWN",
           value = 5,
-          description = "Layout is defined by a panorama image (equirrectangular map)"
-        }
-      }
-    },
-    {
-      name = "FontType",
-      description = "Font type, defines generation method",
-      values = {
+          description = "Mouse button pressed (code: button)"
+        },
         {
-          name = "FONT_DEFAULT",
-          value = 0,
-          description = "Default font generation, anti-aliased"
+          name = "INPUT_EVENT_MOUSE_MOVE",
+          value = 6,
+          description = "Mouse moved (value: position)"
         },
         {
-          name = "FONT_BITMAP",
-          value = 1,
-          description = "Bitmap font generation, no anti-aliasing"
+          name = "INPUT_EVENT_MOUSE_WHEEL",
+          value = 7,
+          description = "Mouse wheel moved (value: wheel move)"
         },
         {
-          name = "FONT_SDF",
-          value = 2,
-          description = "SDF font generation, requires external shader"
+          name = "INPUT_EVENT_TOUCH_UP",
+          value = 8,
+          description = "Touch point released (code: touch point id, value: position)"
+        },
+        {
+          name = "INPUT_EVENT_TOUCH_DOWN",
+          value = 9,
+          description = "Touch point pressed (code: touch point id, value: position)"
+        },
+        {
+          name = "INPUT_EVENT_TOUCH_MOVE",
+          value = 10,
+          description = "Touch point moved (code: touch point id, value: position)"
+        },
+        {
+          name = "INPUT_EVENT_GAMEPAD_BUTTON_UP",
+          value = 11,
+          description = "Gamepad button released (gamepad, code: button)"
+        },
+        {
+          name = "INPUT_EVENT_GAMEPAD_BUTTON_DOWN",
+          value = 12,
+          description = "Gamepad button pressed (gamepad, code: button)"
+        },
+        {
+          name = "INPUT_EVENT_GAMEPAD_AXIS",
+          value = 13,
+          description = "Gamepad axis moved (gamepad, code: axis, value.x: movement)"
         }
       }
     },
     {
-      name = "BlendMode",
-      description = "Color blending modes (pre-defined)",
+      name = "MaterialMapIndex",
+      description = "Material map index",
       values = {
         {
-          name = "BLEND_ALPHA",
+          name = "MATERIAL_MAP_ALBEDO",
           value = 0,
-          description = "Blend textures considering alpha (default)"
+          description = "Albedo material (same as: MATERIAL_MAP_DIFFUSE)"
         },
         {
-          name = "BLEND_ADDITIVE",
+          name = "MATERIAL_MAP_METALNESS",
           value = 1,
-          description = "Blend textures adding colors"
+          description = "Metalness material (same as: MATERIAL_MAP_SPECULAR)"
         },
         {
-          name = "BLEND_MULTIPLIED",
+          name = "MATERIAL_MAP_NORMAL",
           value = 2,
-          description = "Blend textures multiplying colors"
+          description = "Normal material"
         },
         {
-          name = "BLEND_ADD_COLORS",
+          name = "MATERIAL_MAP_ROUGHNESS",
           value = 3,
-          description = "Blend textures adding colors (alternative)"
+          description = "Roughness material"
         },
         {
-          name = "BLEND_SUBTRACT_COLORS",
+          name = "MATERIAL_MAP_OCCLUSION",
           value = 4,
-          description = "Blend textures subtracting colors (alternative)"
+          description = "Ambient occlusion material"
         },
         {
-          name = "BLEND_ALPHA_PREMULTIPLY",
+          name = "MATERIAL_MAP_EMISSION",
           value = 5,
-          description = "Blend premultiplied textures considering alpha"
+          description = "Emission material"
         },
         {
-          name = "BLEND_CUSTOM",
+          name = "MATERIAL_MAP_HEIGHT",
           value = 6,
-          description = "Blend textures using custom src/dst factors (use rlSetBlendFactors())"
+          description = "Heightmap material"
         },
         {
-          name = "BLEND_CUSTOM_SEPARATE",
+          name = "MATERIAL_MAP_CUBEMAP",
           value = 7,
-          description = "Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())"
+          description = "Cubemap material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+        },
+        {
+          name = "MATERIAL_MAP_IRRADIANCE",
+          value = 8,
+          description = "Irradiance material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+        },
+        {
+          name = "MATERIAL_MAP_PREFILTER",
+          value = 9,
+          description = "Prefilter material (NOTE: Uses GL_TEXTURE_CUBE_MAP)"
+        },
+        {
+          name = "MATERIAL_MAP_BRDF",
+          value = 10,
+          description = "Brdf material"
         }
       }
     },
     {
-      name = "Gesture",
-      description = "Gesture",
+      name = "ShaderLocationIndex",
+      description = "Shader location index",
       values = {
         {
-          name = "GESTURE_NONE",
+          name = "SHADER_LOC_VERTEX_POSITION",
           value = 0,
-          description = "No gesture"
+          description = "Shader location: vertex attribute: position"
         },
         {
-          name = "GESTURE_TAP",
+          name = "SHADER_LOC_VERTEX_TEXCOORD01",
           value = 1,
-          description = "Tap gesture"
+          description = "Shader location: vertex attribute: texcoord01"
         },
         {
-          name = "GESTURE_DOUBLETAP",
+          name = "SHADER_LOC_VERTEX_TEXCOORD02",
           value = 2,
-          description = "Double tap gesture"
+          description = "Shader location: vertex attribute: texcoord02"
         },
         {
-          name = "GESTURE_HOLD",
-          value = 4,
-          description = "Hold gesture"
+          name = "SHADER_LOC_VERTEX_NORMAL",
+          value = 3,
+          description = "Shader location: vertex attribute: normal"
         },
         {
-          name = "GESTURE_DRAG",
-          value = 8,
-          description = "Drag gesture"
+          name = "SHADER_LOC_VERTEX_TANGENT",
+          value = 4,
+          description = "Shader location: vertex attribute: tangent"
         },
         {
-          name = "GESTURE_SWIPE_RIGHT",
-          value = 16,
-          description = "Swipe right gesture"
+          name = "SHADER_LOC_VERTEX_COLOR",
+          value = 5,
+          description = "Shader location: vertex attribute: color"
         },
         {
-          name = "GESTURE_SWIPE_LEFT",
-          value = 32,
-          description = "Swipe left gesture"
+          name = "SHADER_LOC_MATRIX_MVP",
+          value = 6,
+          description = "Shader location: matrix uniform: model-view-projection"
         },
         {
-          name = "GESTURE_SWIPE_UP",
-          value = 64,
-          description = "Swipe up gesture"
+          name = "SHADER_LOC_MATRIX_VIEW",
+          value = 7,
+          description = "Shader location: matrix uniform: view (camera transform)"
         },
         {
-          name = "GESTURE_SWIPE_DOWN",
-          value = 128,
-          description = "Swipe down gesture"
+          name = "SHADER_LOC_MATRIX_PROJECTION",
+          value = 8,
+          description = "Shader location: matrix uniform: projection"
         },
         {
-          name = "GESTURE_PINCH_IN",
-          value = 256,
-          description = "Pinch in gesture"
+          name = "SHADER_LOC_MATRIX_MODEL",
+          value = 9,
+          description = "Shader location: matrix uniform: model (transform)"
         },
         {
-          name = "GESTURE_PINCH_OUT",
-          value = 512,
-          description = "Pinch out gesture"
+          name = "SHADER_LOC_MATRIX_NORMAL",
+          value = 10,
+          description = "Shader location: matrix uniform: normal"
+        },
+        {
+          name = "SHADER_LOC_VECTOR_VIEW",
+          value = 11,
+          description = "Shader location: vector uniform: view"
+        },
+        {
+          name = "SHADER_LOC_COLOR_DIFFUSE",
+          value = 12,
+          description = "Shader location: vector uniform: diffuse color"
+        },
+        {
+          name = "SHADER_LOC_COLOR_SPECULAR",
+          value = 13,
+          description = "Shader location: vector uniform: specular color"
+        },
+        {
+          name = "SHADER_LOC_COLOR_AMBIENT",
+          value = 14,
+          description = "Shader location: vector uniform: ambient color"
+        },
+        {
+          name = "SHADER_LOC_MAP_ALBEDO",
+          value = 15,
+          description = "Shader location: sampler2d texture: albedo (same as: SHADER_LOC_MAP_DIFFUSE)"
+        },
+        {
+          name = "SHADER_LOC_MAP_METALNESS",
+          value = 16,
+          description = "Shader location: sampler2d texture: metalness (same as: SHADER_LOC_MAP_SPECULAR)"
+        },
+        {
+          name = "SHADER_LOC_MAP_NORMAL",
+          value = 17,
+          description = "Shader location: sampler2d texture: normal"
+        },
+        {
+          name = "SHADER_LOC_MAP_ROUGHNESS",
+          value = 18,
+          description = "Shader location: sampler2d texture: roughness"
+        },
+        {
+          name = "SHADER_LOC_MAP_OCCLUSION",
+          value = 19,
+          description = "Shader location: sampler2d texture: occlusion"
+        },
+        {
+          name = "SHADER_LOC_MAP_EMISSION",
+          value = 20,
+          description = "Shader location: sampler2d texture: emission"
+        },
+        {
+          name = "SHADER_LOC_MAP_HEIGHT",
+          value = 21,
+          description = "Shader location: sampler2d texture: height"
+        },
+        {
+          name = "SHADER_LOC_MAP_CUBEMAP",
+          value = 22,
+          description = "Shader location: samplerCube texture: cubemap"
+        },
+        {
+          name = "SHADER_LOC_MAP_IRRADIANCE",
+          value = 23,
+          description = "Shader location: samplerCube texture: irradiance"
+        },
+        {
+          name = "SHADER_LOC_MAP_PREFILTER",
+          value = 24,
+          description = "Shader location: samplerCube texture: prefilter"
+        },
+        {
+          name = "SHADER_LOC_MAP_BRDF",
+          value = 25,
+          description = "Shader location: sampler2d texture: brdf"
+        },
+        {
+          name = "SHADER_LOC_BLOCK_FRAME",
+          value = 26,
+          description = "Shader location: uniform block: frame (view, projection)"
+        },
+        {
+          name = "SHADER_LOC_BLOCK_DRAW",
+          value = 27,
+          description = "Shader location: uniform block: draw (mvp, model, normal, color diffuse)"
+        },
+        {
+          name = "SHADER_LOC_VERTEX_BONEIDS",
+          value = 28,
+          description = "Shader location: vertex attribute: boneIds"
+        },
+        {
+          name = "SHADER_LOC_VERTEX_BONEWEIGHTS",
+          value = 29,
+          description = "Shader location: vertex attribute: boneWeights"
+        },
+        {
+          name = "SHADER_LOC_BONE_MATRICES",
+          value = 30,
+          description = "Shader location: array of matrices uniform: boneMatrices"
+        },
+        {
+          name = "SHADER_LOC_INSTANCE_COLOR",
+          value = 31,
+          description = "Shader location: vertex attribute: instanceColor (per-instance tint)"
+        },
+        {
+          name = "SHADER_LOC_INSTANCE_TRANSFORM",
+          value = 32,
+          description = "Shader location: vertex attribute: instanceTransform (per-instance model matrix)"
+        },
+        {
+          name = "SHADER_LOC_MORPH_WEIGHTS",
+          value = 33,
+          description = "Shader location: array of floats uniform: morphWeights"
+        },
+        {
+          name = "SHADER_LOC_MORPH_TARGETS",
+          value = 34,
+          description = "Shader location: sampler2d texture: morphTargets (morph targets deltas)"
+        },
+        {
+          name = "SHADER_LOC_MATRIX_MVP_STEREO",
+          value = 35,
+          description = "Shader location: array of matrices uniform: mvpStereo (single pass stereo eyes)"
         }
       }
     },
     {
-      name = "CameraMode",
-      description = "Camera system modes",
+      name = "ShaderUniformDataType",
+      description = "Shader uniform data type",
       values = {
         {
-          name = "CAMERA_CUSTOM",
+          name = "SHADER_UNIFORM_FLOAT",
           value = 0,
-          description = "Custom camera"
+          description = "Shader uniform type: float"
         },
         {
-          name = "CAMERA_FREE",
+          name = "SHADER_UNIFORM_VEC2",
           value = 1,
-          description = "Free camera"
+          description = "Shader uniform type: vec2 (2 float)"
         },
         {
-          name = "CAMERA_ORBITAL",
+          name = "SHADER_UNIFORM_VEC3",
           value = 2,
-          description = "Orbital camera"
+          description = "Shader uniform type: vec3 (3 float)"
         },
         {
-          name = "CAMERA_FIRST_PERSON",
+          name = "SHADER_UNIFORM_VEC4",
           value = 3,
-          description = "First person camera"
+          description = "Shader uniform type: vec4 (4 float)"
         },
         {
-          name = "CAMERA_THIRD_PERSON",
+          name = "SHADER_UNIFORM_INT",
           value = 4,
-          description = "Third person camera"
-        }
-      }
-    },
-    {
-      name = "CameraProjection",
-      description = "Camera projection",
-      values = {
+          description = "Shader uniform type: int"
+        },
         {
-          name = "CAMERA_PERSPECTIVE",
-          value = 0,
-          description = "Perspective projection"
+          name = "SHADER_UNIFORM_IVEC2",
+          value = 5,
+          description = "Shader uniform type: ivec2 (2 int)"
         },
         {
-          name = "CAMERA_ORTHOGRAPHIC",
-          value = 1,
-          description = "Orthographic projection"
+          name = "SHADER_UNIFORM_IVEC3",
+          value = 6,
+          description = "Shader uniform type: ivec3 (3 int)"
+        },
+        {
+          name = "SHADER_UNIFORM_IVEC4",
+          value = 7,
+          description = "Shader uniform type: ivec4 (4 int)"
+        },
+        {
+          name = "SHADER_UNIFORM_SAMPLER2D",
+          value = 8,
+          description = "Shader uniform type: sampler2d"
         }
       }
     },
     {
-      name = "NPatchLayout",
-      description = "N-patch layout",
+      name = "ShaderAttributeDataType",
+      description = "Shader attribute data types",
       values = {
         {
-          name = "NPATCH_NINE_PATCH",
+          name = "SHADER_ATTRIB_FLOAT",
           value = 0,
-          description = "Npatch layout: 3x3 tiles"
+          description = "Shader attribute type: float"
         },
         {
-          name = "NPATCH_THREE_PATCH_VERTICAL",
+          name = "SHADER_ATTRIB_VEC2",
           value = 1,
-          description = "Npatch layout: 1x3 tiles"
+          description = "Shader attribute type: vec2 (2 float)"
         },
         {
-          name = "NPATCH_THREE_PATCH_HORIZONTAL",
+          name = "SHADER_ATTRIB_VEC3",
           value = 2,
-          description = "Npatch layout: 3x1 tiles"
+          description = "Shader attribute type: vec3 (3 float)"
+        },
+        {
+          name = "SHADER_ATTRIB_VEC4",
+          value = 3,
+          description = "Shader attribute type: vec4 (4 float)"
         }
       }
-    }
-  },
-  callbacks = {
-    {
-      name = "TraceLogCallback",
-      description = "Logging: Redirect trace log messages",
-      returnType = "void",
-      params = {
-        {type = "int", name = "logLevel"},
-        {type = "const char *", name = "text"},
-        {type = "va_list", name = "args"}
-      }
     },
     {
-      name = "LoadFileDataCallback",
-      description = "FileIO: Load binary data",
-      returnType = "unsigned char *",
+      name = "PixelFormat",
+      description = "Pixel formats",
+      values = {
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_GRAYSCALE",
+          value = 1,
+          description = "8 bit per pixel (no alpha)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA",
+          value = 2,
+          description = "8*2 bpp (2 channels)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R5G6B5",
+          value = 3,
+          description = "16 bpp"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R8G8B8",
+          value = 4,
+          description = "24 bpp"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R5G5B5A1",
+          value = 5,
+          description = "16 bpp (1 bit alpha)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R4G4B4A4",
+          value = 6,
+          description = "16 bpp (4 bit alpha)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R8G8B8A8",
+          value = 7,
+          description = "32 bpp"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R32",
+          value = 8,
+          description = "32 bpp (1 channel - float)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R32G32B32",
+          value = 9,
+          description = "32*3 bpp (3 channels - float)"
+        },
+        {
+          name = "PIXELFORMAT_UNCOMPRESSED_R32G32B32A32",
+          value = 10,
+          description = "32*4 bpp (4 channels - float)"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_DXT1_RGB",
+          value = 11,
+          description = "4 bpp (no alpha)"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_DXT1_RGBA",
+          value = 12,
+          description = "4 bpp (1 bit alpha)"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_DXT3_RGBA",
+          value = 13,
+          description = "8 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_DXT5_RGBA",
+          value = 14,
+          description = "8 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_ETC1_RGB",
+          value = 15,
+          description = "4 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_ETC2_RGB",
+          value = 16,
+          description = "4 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA",
+          value = 17,
+          description = "8 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_PVRT_RGB",
+          value = 18,
+          description = "4 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_PVRT_RGBA",
+          value = 19,
+          description = "4 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA",
+          value = 20,
+          description = "8 bpp"
+        },
+        {
+          name = "PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA",
+          value = 21,
+          description = "2 bpp"
+        }
+      }
+    },
+    {
+      name = "TextureFilter",
+      description = "Texture parameters: filter mode",
+      values = {
+        {
+          name = "TEXTURE_FILTER_POINT",
+          value = 0,
+          description = "No filter, just pixel approximation"
+        },
+        {
+          name = "TEXTURE_FILTER_BILINEAR",
+          value = 1,
+          description = "Linear filtering"
+        },
+        {
+          name = "TEXTURE_FILTER_TRILINEAR",
+          value = 2,
+          description = "Trilinear filtering (linear with mipmaps)"
+        },
+        {
+          name = "TEXTURE_FILTER_ANISOTROPIC_4X",
+          value = 3,
+          description = "Anisotropic filtering 4x"
+        },
+        {
+          name = "TEXTURE_FILTER_ANISOTROPIC_8X",
+          value = 4,
+          description = "Anisotropic filtering 8x"
+        },
+        {
+          name = "TEXTURE_FILTER_ANISOTROPIC_16X",
+          value = 5,
+          description = "Anisotropic filtering 16x"
+        }
+      }
+    },
+    {
+      name = "TextureWrap",
+      description = "Texture parameters: wrap mode",
+      values = {
+        {
+          name = "TEXTURE_WRAP_REPEAT",
+          value = 0,
+          description = "Repeats texture in tiled mode"
+        },
+        {
+          name = "TEXTURE_WRAP_CLAMP",
+          value = 1,
+          description = "Clamps texture to edge pixel in tiled mode"
+        },
+        {
+          name = "TEXTURE_WRAP_MIRROR_REPEAT",
+          value = 2,
+          description = "Mirrors and repeats the texture in tiled mode"
+        },
+        {
+          name = "TEXTURE_WRAP_MIRROR_CLAMP",
+          value = 3,
+          description = "Mirrors and clamps to border the texture in tiled mode"
+        }
+      }
+    },
+    {
+      name = "CubemapLayout",
+      description = "Cubemap layouts",
+      values = {
+        {
+          name = "CUBEMAP_LAYOUT_AUTO_DETECT",
+          value = 0,
+          description = "Automatically detect layout type"
+        },
+        {
+          name = "CUBEMAP_LAYOUT_LINE_VERTICAL",
+          value = 1,
+          description = "Layout is defined by a vertical line with faces"
+        },
+        {
+          name = "CUBEMAP_LAYOUT_LINE_HORIZONTAL",
+          value = 2,
+          description = "Layout is defined by a horizontal line with faces"
+        },
+        {
+          name = "CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR",
+          value = 3,
+          description = "Layout is defined by a 3x4 cross with cubemap faces"
+        },
+        {
+          name = "CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE",
+          value = 4,
+          description = "Layout is defined by a 4x3 cross with cubemap faces"
+        },
+        {
+          name = "CUBEMAP_LAYOUT_PANORAMA",
+          value = 5,
+          description = "Layout is defined by a panorama image (equirrectangular map)"
+        }
+      }
+    },
+    {
+      name = "ImageProcessType",
+      description = "Image color operations (ImageProcess())",
+      values = {
+        {
+          name = "IMAGE_PROCESS_TINT",
+          value = 0,
+          description = "Tint colors (color), same as ImageColorTint()"
+        },
+        {
+          name = "IMAGE_PROCESS_INVERT",
+          value = 1,
+          description = "Invert colors, same as ImageColorInvert()"
+        },
+        {
+          name = "IMAGE_PROCESS_GRAYSCALE",
+          value = 2,
+          description = "Grayscale colors, alpha is kept"
+        },
+        {
+          name = "IMAGE_PROCESS_CONTRAST",
+          value = 3,
+          description = "Modify contrast (value), same as ImageColorContrast()"
+        },
+        {
+          name = "IMAGE_PROCESS_BRIGHTNESS",
+          value = 4,
+          description = "Modify brightness (value), same as ImageColorBrightness()"
+        },
+        {
+          name = "IMAGE_PROCESS_REPLACE",
+          value = 5,
+          description = "Replace color (color) by replacement color (replace), same as ImageColorReplace()"
+        },
+        {
+          name = "IMAGE_PROCESS_ALPHA_PREMULTIPLY",
+          value = 6,
+          description = "Premultiply alpha, same as ImageAlphaPremultiply()"
+        }
+      }
+    },
+    {
+      name = "FontType",
+      description = "Font type, defines generation method",
+      values = {
+        {
+          name = "FONT_DEFAULT",
+          value = 0,
+          description = "Default font generation, anti-aliased"
+        },
+        {
+          name = "FONT_BITMAP",
+          value = 1,
+          description = "Bitmap font generation, no anti-aliasing"
+        },
+        {
+          name = "FONT_SDF",
+          value = 2,
+          description = "SDF font generation, requires external shader"
+        },
+        {
+          name = "FONT_MSDF",
+          value = 3,
+          description = "Multi-channel SDF font generation, RGB glyphs (default shader on LoadFontMsdf())"
+        }
+      }
+    },
+    {
+      name = "TextWrapMode",
+      description = "Text wrap mode, used by DrawTextBoxed()",
+      values = {
+        {
+          name = "TEXT_WRAP_NONE",
+          value = 0,
+          description = "No wrap, lines clipped to rectangle width"
+        },
+        {
+          name = "TEXT_WRAP_CHAR",
+          value = 1,
+          description = "Lines broken on any character"
+        },
+        {
+          name = "TEXT_WRAP_WORD",
+          value = 2,
+          description = "Lines broken between words (long words broken on characters)"
+        }
+      }
+    },
+    {
+      name = "BlendMode",
+      description = "Color blending modes (pre-defined)",
+      values = {
+        {
+          name = "BLEND_ALPHA",
+          value = 0,
+          description = "Blend textures considering alpha (default)"
+        },
+        {
+          name = "BLEND_ADDITIVE",
+          value = 1,
+          description = "Blend textures adding colors"
+        },
+        {
+          name = "BLEND_MULTIPLIED",
+          value = 2,
+          description = "Blend textures multiplying colors"
+        },
+        {
+          name = "BLEND_ADD_COLORS",
+          value = 3,
+          description = "Blend textures adding colors (alternative)"
+        },
+        {
+          name = "BLEND_SUBTRACT_COLORS",
+          value = 4,
+          description = "Blend textures subtracting colors (alternative)"
+        },
+        {
+          name = "BLEND_ALPHA_PREMULTIPLY",
+          value = 5,
+          description = "Blend premultiplied textures considering alpha"
+        },
+        {
+          name = "BLEND_CUSTOM",
+          value = 6,
+          description = "Blend textures using custom src/dst factors (use rlSetBlendFactors())"
+        },
+        {
+          name = "BLEND_CUSTOM_SEPARATE",
+          value = 7,
+          description = "Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())"
+        }
+      }
+    },
+    {
+      name = "Gesture",
+      description = "Gesture",
+      values = {
+        {
+          name = "GESTURE_NONE",
+          value = 0,
+          description = "No gesture"
+        },
+        {
+          name = "GESTURE_TAP",
+          value = 1,
+          description = "Tap gesture"
+        },
+        {
+          name = "GESTURE_DOUBLETAP",
+          value = 2,
+          description = "Double tap gesture"
+        },
+        {
+          name = "GESTURE_HOLD",
+          value = 4,
+          description = "Hold gesture"
+        },
+        {
+          name = "GESTURE_DRAG",
+          value = 8,
+          description = "Drag gesture"
+        },
+        {
+          name = "GESTURE_SWIPE_RIGHT",
+          value = 16,
+          description = "Swipe right gesture"
+        },
+        {
+          name = "GESTURE_SWIPE_LEFT",
+          value = 32,
+          description = "Swipe left gesture"
+        },
+        {
+          name = "GESTURE_SWIPE_UP",
+          value = 64,
+          description = "Swipe up gesture"
+        },
+        {
+          name = "GESTURE_SWIPE_DOWN",
+          value = 128,
+          description = "Swipe down gesture"
+        },
+        {
+          name = "GESTURE_PINCH_IN",
+          value = 256,
+          description = "Pinch in gesture"
+        },
+        {
+          name = "GESTURE_PINCH_OUT",
+          value = 512,
+          description = "Pinch out gesture"
+        }
+      }
+    },
+    {
+      name = "CameraMode",
+      description = "Camera system modes",
+      values = {
+        {
+          name = "CAMERA_CUSTOM",
+          value = 0,
+          description = "Custom camera"
+        },
+        {
+          name = "CAMERA_FREE",
+          value = 1,
+          description = "Free camera"
+        },
+        {
+          name = "CAMERA_ORBITAL",
+          value = 2,
+          description = "Orbital camera"
+        },
+        {
+          name = "CAMERA_FIRST_PERSON",
+          value = 3,
+          description = "First person camera"
+        },
+        {
+          name = "CAMERA_THIRD_PERSON",
+          value = 4,
+          description = "Third person camera"
+        }
+      }
+    },
+    {
+      name = "CameraProjection",
+      description = "Camera projection",
+      values = {
+        {
+          name = "CAMERA_PERSPECTIVE",
+          value = 0,
+          description = "Perspective projection"
+        },
+        {
+          name = "CAMERA_ORTHOGRAPHIC",
+          value = 1,
+          description = "Orthographic projection"
+        }
+      }
+    },
+    {
+      name = "ClipFlags",
+      description = "World to screen projection clip flags (point outside of view volume)",
+      values = {
+        {
+          name = "CLIP_LEFT",
+          value = 1,
+          description = "Point at left of viewport"
+        },
+        {
+          name = "CLIP_RIGHT",
+          value = 2,
+          description = "Point at right of viewport"
+        },
+        {
+          name = "CLIP_BOTTOM",
+          value = 4,
+          description = "Point below viewport"
+        },
+        {
+          name = "CLIP_TOP",
+          value = 8,
+          description = "Point above viewport"
+        },
+        {
+          name = "CLIP_NEAR",
+          value = 16,
+          description = "Point in front of near plane (behind camera)"
+        },
+        {
+          name = "CLIP_FAR",
+          value = 32,
+          description = "Point beyond far plane"
+        }
+      }
+    },
+    {
+      name = "NPatchLayout",
+      description = "N-patch layout",
+      values = {
+        {
+          name = "NPATCH_NINE_PATCH",
+          value = 0,
+          description = "Npatch layout: 3x3 tiles"
+        },
+        {
+          name = "NPATCH_THREE_PATCH_VERTICAL",
+          value = 1,
+          description = "Npatch layout: 1x3 tiles"
+        },
+        {
+          name = "NPATCH_THREE_PATCH_HORIZONTAL",
+          value = 2,
+          description = "Npatch layout: 3x1 tiles"
+        }
+      }
+    },
+    {
+      name = "PathJoin",
+      description = "Path stroke segments join",
+      values = {
+        {
+          name = "PATH_JOIN_MITER",
+          value = 0,
+          description = "Segments joined by extending outlines (bevel over PATH_MITER_LIMIT)"
+        },
+        {
+          name = "PATH_JOIN_BEVEL",
+          value = 1,
+          description = "Segments joined by a straight edge"
+        },
+        {
+          name = "PATH_JOIN_ROUND",
+          value = 2,
+          description = "Segments joined by an arc"
+        }
+      }
+    },
+    {
+      name = "PathCap",
+      description = "Path stroke open contours ends cap",
+      values = {
+        {
+          name = "PATH_CAP_BUTT",
+          value = 0,
+          description = "Contour ends at last point"
+        },
+        {
+          name = "PATH_CAP_SQUARE",
+          value = 1,
+          description = "Contour extended half thickness past last point"
+        },
+        {
+          name = "PATH_CAP_ROUND",
+          value = 2,
+          description = "Contour ended by a half circle"
+        }
+      }
+    },
+    {
+      name = "SplineType",
+      description = "Spline types",
+      values = {
+        {
+          name = "SPLINE_LINEAR",
+          value = 0,
+          description = "Line segments between points"
+        },
+        {
+          name = "SPLINE_CATMULL_ROM",
+          value = 1,
+          description = "Catmull-Rom curve through all points (end points repeated)"
+        },
+        {
+          name = "SPLINE_BASIS",
+          value = 2,
+          description = "Uniform cubic B-spline, 4 points minimum"
+        },
+        {
+          name = "SPLINE_BEZIER_CUBIC",
+          value = 3,
+          description = "Cubic bezier curves: point, control, control, point... (3*n + 1 points)"
+        }
+      }
+    },
+    {
+      name = "MeshOptimizeFlags",
+      description = "Mesh optimization steps",
+      values = {
+        {
+          name = "MESH_OPTIMIZE_INDICES",
+          value = 1,
+          description = "Deduplicate vertices into indices buffer"
+        },
+        {
+          name = "MESH_OPTIMIZE_VERTEX_CACHE",
+          value = 2,
+          description = "Reorder triangles for post-transform vertex cache locality (Tipsify)"
+        },
+        {
+          name = "MESH_OPTIMIZE_OVERDRAW",
+          value = 4,
+          description = "Reorder triangles clusters to reduce overdraw (outer facing first)"
+        },
+        {
+          name = "MESH_OPTIMIZE_VERTEX_FETCH",
+          value = 8,
+          description = "Reorder vertices by first use for vertex fetch locality"
+        },
+        {
+          name = "MESH_OPTIMIZE_ALL",
+          value = 15,
+          description = "All optimization steps"
+        }
+      }
+    },
+    {
+      name = "MeshPackFlags",
+      description = "Mesh vertex attributes packing in GPU buffers",
+      values = {
+        {
+          name = "MESH_PACK_POSITIONS",
+          value = 1,
+          description = "Positions as unorm16, quantized to mesh bounds (dequantized by draw transform)"
+        },
+        {
+          name = "MESH_PACK_TEXCOORDS",
+          value = 2,
+          description = "Texcoords as unorm16 (in [0..1] range) or half-float"
+        },
+        {
+          name = "MESH_PACK_NORMALS",
+          value = 4,
+          description = "Normals and tangents as snorm8"
+        },
+        {
+          name = "MESH_PACK_ALL",
+          value = 7,
+          description = "All vertex attributes packed"
+        }
+      }
+    },
+    {
+      name = "MeshDataFlags",
+      description = "Mesh CPU vertex data attributes",
+      values = {
+        {
+          name = "MESH_DATA_VERTICES",
+          value = 1,
+          description = "Vertex positions (bounds, collision and picking, LoadMeshBVH())"
+        },
+        {
+          name = "MESH_DATA_TEXCOORDS",
+          value = 2,
+          description = "Texture coordinates (texcoords and texcoords2)"
+        },
+        {
+          name = "MESH_DATA_NORMALS",
+          value = 4,
+          description = "Vertex normals"
+        },
+        {
+          name = "MESH_DATA_TANGENTS",
+          value = 8,
+          description = "Vertex tangents"
+        },
+        {
+          name = "MESH_DATA_COLORS",
+          value = 16,
+          description = "Vertex colors"
+        },
+        {
+          name = "MESH_DATA_ALL",
+          value = 31,
+          description = "All vertex attributes"
+        }
+      }
+    },
+    {
+      name = "MeshGenType",
+      description = "Mesh generation shape type",
+      values = {
+        {
+          name = "MESH_GEN_POLY",
+          value = 0,
+          description = "Polygon: params { radius }, resolution { sides }"
+        },
+        {
+          name = "MESH_GEN_PLANE",
+          value = 1,
+          description = "Plane: params { width, length }, resolution { resX, resZ }"
+        },
+        {
+          name = "MESH_GEN_SPHERE",
+          value = 2,
+          description = "Sphere: params { radius }, resolution { rings, slices }"
+        },
+        {
+          name = "MESH_GEN_HEMISPHERE",
+          value = 3,
+          description = "Half-sphere: params { radius }, resolution { rings, slices }"
+        },
+        {
+          name = "MESH_GEN_CYLINDER",
+          value = 4,
+          description = "Cylinder: params { radius, height }, resolution { slices }"
+        },
+        {
+          name = "MESH_GEN_CONE",
+          value = 5,
+          description = "Cone: params { radius, height }, resolution { slices }"
+        },
+        {
+          name = "MESH_GEN_TORUS",
+          value = 6,
+          description = "Torus: params { radius, size }, resolution { radSeg, sides }"
+        },
+        {
+          name = "MESH_GEN_KNOT",
+          value = 7,
+          description = "Trefoil knot: params { radius, size }, resolution { radSeg, sides }"
+        }
+      }
+    },
+    {
+      name = "ShadowLightType",
+      description = "Shadow map light type",
+      values = {
+        {
+          name = "SHADOW_LIGHT_DIRECTIONAL",
+          value = 0,
+          description = "Directional light, cascades cover camera view distance (orthographic)"
+        },
+        {
+          name = "SHADOW_LIGHT_SPOT",
+          value = 1,
+          description = "Spot light, one cascade covers light cone (perspective)"
+        }
+      }
+    },
+    {
+      name = "MemoryModule",
+      description = "Memory module, memory allocations are tagged by module (SUPPORT_MEMORY_TRACKING)",
+      values = {
+        {
+          name = "MEMORY_MODULE_USER",
+          value = 0,
+          description = "Memory module: User allocations (MemAlloc())"
+        },
+        {
+          name = "MEMORY_MODULE_CORE",
+          value = 1,
+          description = "Memory module: rcore and utils"
+        },
+        {
+          name = "MEMORY_MODULE_RLGL",
+          value = 2,
+          description = "Memory module: rlgl CPU buffers"
+        },
+        {
+          name = "MEMORY_MODULE_TEXTURES",
+          value = 3,
+          description = "Memory module: rtextures (images data)"
+        },
+        {
+          name = "MEMORY_MODULE_TEXT",
+          value = 4,
+          description = "Memory module: rtext (fonts data)"
+        },
+        {
+          name = "MEMORY_MODULE_MODELS",
+          value = 5,
+          description = "Memory module: rmodels (meshes, materials, animations data)"
+        },
+        {
+          name = "MEMORY_MODULE_AUDIO",
+          value = 6,
+          description = "Memory module: raudio (waves, sounds and music data)"
+        }
+      }
+    },
+    {
+      name = "CompressionCodec",
+      description = "Compression codec, used by CompressDataEx() and DecompressDataCodec()",
+      values = {
+        {
+          name = "COMPRESSION_DEFLATE",
+          value = 0,
+          description = "DEFLATE (RFC 1951): best compression ratio, slow compression (levels 1..8)"
+        },
+        {
+          name = "COMPRESSION_LZ4",
+          value = 1,
+          description = "LZ4 block format: fast compression, decompression close to memory bandwidth (levels 1..9)"
+        }
+      }
+    },
+    {
+      name = "SoundStorage",
+      description = "Sound storage, sound data format kept in memory",
+      values = {
+        {
+          name = "SOUND_STORAGE_DEVICE",
+          value = 0,
+          description = "Sound data converted to device format on loading (32 bit float, stereo, device sample rate)"
+        },
+        {
+          name = "SOUND_STORAGE_PCM",
+          value = 1,
+          description = "Sound data kept as original wave PCM data (sample size, channels and sample rate)"
+        },
+        {
+          name = "SOUND_STORAGE_QOA",
+          value = 2,
+          description = "Sound data compressed as QOA (SUPPORT_FILEFORMAT_QOA), decoded on mixing"
+        }
+      }
+    },
+    {
+      name = "AudioDistanceModel",
+      description = "Audio distance model, spatial sounds attenuation by distance to listener",
+      values = {
+        {
+          name = "AUDIO_DISTANCE_NONE",
+          value = 0,
+          description = "No distance attenuation"
+        },
+        {
+          name = "AUDIO_DISTANCE_INVERSE",
+          value = 1,
+          description = "Inverse distance: ref/(ref + rolloff*(distance - ref)) (default)"
+        },
+        {
+          name = "AUDIO_DISTANCE_LINEAR",
+          value = 2,
+          description = "Linear distance: 1 - rolloff*(distance - ref)/(max - ref)"
+        },
+        {
+          name = "AUDIO_DISTANCE_EXPONENTIAL",
+          value = 3,
+          description = "Exponential distance: (distance/ref)^-rolloff"
+        }
+      }
+    },
+    {
+      name = "AudioFilterType",
+      description = "Audio bus filter type (biquad)",
+      values = {
+        {
+          name = "AUDIO_FILTER_NONE",
+          value = 0,
+          description = "No filter"
+        },
+        {
+          name = "AUDIO_FILTER_LOWPASS",
+          value = 1,
+          description = "Low-pass filter"
+        },
+        {
+          name = "AUDIO_FILTER_HIGHPASS",
+          value = 2,
+          description = "High-pass filter"
+        },
+        {
+          name = "AUDIO_FILTER_BANDPASS",
+          value = 3,
+          description = "Band-pass filter (constant 0 dB peak gain)"
+        }
+      }
+    }
+  },
+  callbacks = {
+    {
+      name = "TraceLogCallback",
+      description = "Logging: Redirect trace log messages",
+      returnType = "void",
+      params = {
+        {type = "int", name = "logLevel"},
+        {type = "const char *", name = "text"},
+        {type = "va_list", name = "args"}
+      }
+    },
+    {
+      name = "LoadFileDataCallback",
+      description = "FileIO: Load binary data",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "unsigned int *", name = "bytesRead"}
+      }
+    },
+    {
+      name = "SaveFileDataCallback",
+      description = "FileIO: Save binary data",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "void *", name = "data"},
+        {type = "unsigned int", name = "bytesToWrite"}
+      }
+    },
+    {
+      name = "LoadFileTextCallback",
+      description = "FileIO: Load text data",
+      returnType = "char *",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "SaveFileTextCallback",
+      description = "FileIO: Save text data",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "char *", name = "text"}
+      }
+    },
+    {
+      name = "LoadFileDataMappedCallback",
+      description = "FileIO: Load binary data mapped to memory (read-only)",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "unsigned int *", name = "bytesRead"}
+      }
+    },
+    {
+      name = "UnloadFileDataMappedCallback",
+      description = "FileIO: Unload binary data mapped to memory",
+      returnType = "void",
+      params = {
+        {type = "unsigned char *", name = "data"}
+      }
+    },
+    {
+      name = "MemAllocCallback",
+      description = "Memory: Allocate memory",
+      returnType = "void *",
+      params = {
+        {type = "unsigned int", name = "size"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "MemReallocCallback",
+      description = "Memory: Reallocate memory",
+      returnType = "void *",
+      params = {
+        {type = "void *", name = "ptr"},
+        {type = "unsigned int", name = "size"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "MemFreeCallback",
+      description = "Memory: Free memory (never called with NULL)",
+      returnType = "void",
+      params = {
+        {type = "void *", name = "ptr"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "JobCallback",
+      description = "Jobs: Process items range [start, end)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "start"},
+        {type = "int", name = "end"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "MainLoopCallback",
+      description = "Main loop: Update and draw one frame (SetMainLoop())",
+      returnType = "void",
+      params = {
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "DataStreamCallback",
+      description = "Data: Process streamed data chunk, return false to stop",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "TiledImageCallback",
+      description = "Images: Load tiled image tile, returns image of rectangle pixels",
+      returnType = "Image",
+      params = {
+        {type = "Rectangle", name = "rec"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "ImageProbeCallback",
+      description = "Images: Get image size and pixel format from file data, false if not supported",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int *", name = "width"},
+        {type = "int *", name = "height"},
+        {type = "int *", name = "format"}
+      }
+    },
+    {
+      name = "ImageDecodeCallback",
+      description = "Images: Decode image file data into provided pixels memory (probed size and format)",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "void *", name = "pixels"},
+        {type = "int", name = "pixelsSize"}
+      }
+    },
+    {
+      name = "AudioCallback",
+      description = "",
+      returnType = "void",
+      params = {
+        {type = "void *", name = "bufferData"},
+        {type = "unsigned int", name = "frames"}
+      }
+    }
+  },
+  functions = {
+    {
+      name = "InitWindow",
+      description = "Initialize window and OpenGL context",
+      returnType = "void",
+      params = {
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "const char *", name = "title"}
+      }
+    },
+    {
+      name = "WindowShouldClose",
+      description = "Check if KEY_ESCAPE pressed or Close icon pressed",
+      returnType = "bool"
+    },
+    {
+      name = "SetMainLoop",
+      description = "Run main loop, callback called every frame until window should close (browser driven on web, no ASYNCIFY required)",
+      returnType = "void",
+      params = {
+        {type = "MainLoopCallback", name = "callback"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "CloseWindow",
+      description = "Close window and unload OpenGL context",
+      returnType = "void"
+    },
+    {
+      name = "IsWindowReady",
+      description = "Check if window has been initialized successfully",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowFullscreen",
+      description = "Check if window is currently fullscreen",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowHidden",
+      description = "Check if window is currently hidden (only PLATFORM_DESKTOP)",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowMinimized",
+      description = "Check if window is currently minimized (only PLATFORM_DESKTOP)",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowMaximized",
+      description = "Check if window is currently maximized (only PLATFORM_DESKTOP)",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowFocused",
+      description = "Check if window is currently focused (only PLATFORM_DESKTOP)",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowResized",
+      description = "Check if window has been resized last frame",
+      returnType = "bool"
+    },
+    {
+      name = "IsWindowState",
+      description = "Check if one specific window flag is enabled",
+      returnType = "bool",
+      params = {
+        {type = "unsigned int", name = "flag"}
+      }
+    },
+    {
+      name = "SetWindowState",
+      description = "Set window configuration state using flags (only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "flags"}
+      }
+    },
+    {
+      name = "ClearWindowState",
+      description = "Clear window configuration state flags",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "flags"}
+      }
+    },
+    {
+      name = "ToggleFullscreen",
+      description = "Toggle window state: fullscreen/windowed (only PLATFORM_DESKTOP)",
+      returnType = "void"
+    },
+    {
+      name = "MaximizeWindow",
+      description = "Set window state: maximized, if resizable (only PLATFORM_DESKTOP)",
+      returnType = "void"
+    },
+    {
+      name = "MinimizeWindow",
+      description = "Set window state: minimized, if resizable (only PLATFORM_DESKTOP)",
+      returnType = "void"
+    },
+    {
+      name = "RestoreWindow",
+      description = "Set window state: not minimized/maximized (only PLATFORM_DESKTOP)",
+      returnType = "void"
+    },
+    {
+      name = "SetWindowIcon",
+      description = "Set icon for window (single image, RGBA 32bit, only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "Image", name = "image"}
+      }
+    },
+    {
+      name = "SetWindowIcons",
+      description = "Set icon for window (multiple images, RGBA 32bit, only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "images"},
+        {type = "int", name = "count"}
+      }
+    },
+    {
+      name = "SetWindowTitle",
+      description = "Set title for window (only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "title"}
+      }
+    },
+    {
+      name = "SetWindowPosition",
+      description = "Set window position on screen (only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "x"},
+        {type = "int", name = "y"}
+      }
+    },
+    {
+      name = "SetWindowMonitor",
+      description = "Set monitor for the current window (fullscreen mode)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "SetWindowMinSize",
+      description = "Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "SetWindowSize",
+      description = "Set window dimensions",
+      returnType = "void",
+      params = {
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "SetWindowOpacity",
+      description = "Set window opacity [0.0f..1.0f] (only PLATFORM_DESKTOP)",
+      returnType = "void",
+      params = {
+        {type = "float", name = "opacity"}
+      }
+    },
+    {
+      name = "GetWindowHandle",
+      description = "Get native window handle",
+      returnType = "void *"
+    },
+    {
+      name = "GetScreenWidth",
+      description = "Get current screen width",
+      returnType = "int"
+    },
+    {
+      name = "GetScreenHeight",
+      description = "Get current screen height",
+      returnType = "int"
+    },
+    {
+      name = "GetRenderWidth",
+      description = "Get current render width (it considers HiDPI)",
+      returnType = "int"
+    },
+    {
+      name = "GetRenderHeight",
+      description = "Get current render height (it considers HiDPI)",
+      returnType = "int"
+    },
+    {
+      name = "GetMonitorCount",
+      description = "Get number of connected monitors",
+      returnType = "int"
+    },
+    {
+      name = "GetCurrentMonitor",
+      description = "Get current connected monitor",
+      returnType = "int"
+    },
+    {
+      name = "GetMonitorPosition",
+      description = "Get specified monitor position",
+      returnType = "Vector2",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetMonitorWidth",
+      description = "Get specified monitor width (current video mode used by monitor)",
+      returnType = "int",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetMonitorHeight",
+      description = "Get specified monitor height (current video mode used by monitor)",
+      returnType = "int",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetMonitorPhysicalWidth",
+      description = "Get specified monitor physical width in millimetres",
+      returnType = "int",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetMonitorPhysicalHeight",
+      description = "Get specified monitor physical height in millimetres",
+      returnType = "int",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetMonitorRefreshRate",
+      description = "Get specified monitor refresh rate",
+      returnType = "int",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "GetDisplayPlaneCount",
+      description = "Get number of hardware overlay planes available for direct scanout (PLATFORM_DRM)",
+      returnType = "int"
+    },
+    {
+      name = "LoadRenderTextureScanout",
+      description = "Load render texture for direct scanout on a display plane (PLATFORM_DRM)",
+      returnType = "RenderTexture2D",
+      params = {
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "UnloadRenderTextureScanout",
+      description = "Unload scanout render texture, display planes showing it are disabled",
+      returnType = "void",
+      params = {
+        {type = "RenderTexture2D", name = "target"}
+      }
+    },
+    {
+      name = "SetDisplayPlaneTexture",
+      description = "Set scanout render texture displayed on overlay plane (applied on next frame)",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "plane"},
+        {type = "RenderTexture2D", name = "target"},
+        {type = "Rectangle", name = "source"},
+        {type = "Rectangle", name = "dest"}
+      }
+    },
+    {
+      name = "SetDisplayPlaneDmabuf",
+      description = "Set external dmabuf displayed on overlay plane (applied on next frame)",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "plane"},
+        {type = "int", name = "fd"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "stride"},
+        {type = "unsigned int", name = "fourcc"},
+        {type = "Rectangle", name = "dest"}
+      }
+    },
+    {
+      name = "ClearDisplayPlane",
+      description = "Clear overlay plane (applied on next frame)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "plane"}
+      }
+    },
+    {
+      name = "GetWindowPosition",
+      description = "Get window position XY on monitor",
+      returnType = "Vector2"
+    },
+    {
+      name = "GetWindowScaleDPI",
+      description = "Get window scale DPI factor",
+      returnType = "Vector2"
+    },
+    {
+      name = "GetMonitorName",
+      description = "Get the human-readable, UTF-8 encoded name of the primary monitor",
+      returnType = "const char *",
+      params = {
+        {type = "int", name = "monitor"}
+      }
+    },
+    {
+      name = "SetClipboardText",
+      description = "Set clipboard text content",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "text"}
+      }
+    },
+    {
+      name = "GetClipboardText",
+      description = "Get clipboard text content",
+      returnType = "const char *"
+    },
+    {
+      name = "EnableEventWaiting",
+      description = "Enable waiting for events on EndDrawing(), no automatic event polling",
+      returnType = "void"
+    },
+    {
+      name = "DisableEventWaiting",
+      description = "Disable waiting for events on EndDrawing(), automatic events polling",
+      returnType = "void"
+    },
+    {
+      name = "SwapScreenBuffer",
+      description = "Swap back buffer with front buffer (screen drawing)",
+      returnType = "void"
+    },
+    {
+      name = "PollInputEvents",
+      description = "Register all input events",
+      returnType = "void"
+    },
+    {
+      name = "WaitTime",
+      description = "Wait for some time (halt program execution)",
+      returnType = "void",
+      params = {
+        {type = "double", name = "seconds"}
+      }
+    },
+    {
+      name = "ShowCursor",
+      description = "Shows cursor",
+      returnType = "void"
+    },
+    {
+      name = "HideCursor",
+      description = "Hides cursor",
+      returnType = "void"
+    },
+    {
+      name = "IsCursorHidden",
+      description = "Check if cursor is not visible",
+      returnType = "bool"
+    },
+    {
+      name = "EnableCursor",
+      description = "Enables cursor (unlock cursor)",
+      returnType = "void"
+    },
+    {
+      name = "DisableCursor",
+      description = "Disables cursor (lock cursor)",
+      returnType = "void"
+    },
+    {
+      name = "IsCursorOnScreen",
+      description = "Check if cursor is on the screen",
+      returnType = "bool"
+    },
+    {
+      name = "ClearBackground",
+      description = "Set background color (framebuffer clear color)",
+      returnType = "void",
+      params = {
+        {type = "Color", name = "color"}
+      }
+    },
+    {
+      name = "BeginDrawing",
+      description = "Setup canvas (framebuffer) to start drawing",
+      returnType = "void"
+    },
+    {
+      name = "EndDrawing",
+      description = "End canvas drawing and swap buffers (double buffering)",
+      returnType = "void"
+    },
+    {
+      name = "BeginMode2D",
+      description = "Begin 2D mode with custom camera (2D)",
+      returnType = "void",
+      params = {
+        {type = "Camera2D", name = "camera"}
+      }
+    },
+    {
+      name = "EndMode2D",
+      description = "Ends 2D mode with custom camera",
+      returnType = "void"
+    },
+    {
+      name = "BeginMode3D",
+      description = "Begin 3D mode with custom camera (3D)",
+      returnType = "void",
+      params = {
+        {type = "Camera3D", name = "camera"}
+      }
+    },
+    {
+      name = "EndMode3D",
+      description = "Ends 3D mode and returns to default 2D orthographic mode",
+      returnType = "void"
+    },
+    {
+      name = "BeginTextureMode",
+      description = "Begin drawing to render texture",
+      returnType = "void",
+      params = {
+        {type = "RenderTexture2D", name = "target"}
+      }
+    },
+    {
+      name = "EndTextureMode",
+      description = "Ends drawing to render texture",
+      returnType = "void"
+    },
+    {
+      name = "BeginShaderMode",
+      description = "Begin custom shader drawing",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"}
+      }
+    },
+    {
+      name = "EndShaderMode",
+      description = "End custom shader drawing (use default shader)",
+      returnType = "void"
+    },
+    {
+      name = "BeginBlendMode",
+      description = "Begin blending mode (alpha, additive, multiplied, subtract, custom)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "mode"}
+      }
+    },
+    {
+      name = "EndBlendMode",
+      description = "End blending mode (reset to default: alpha blending)",
+      returnType = "void"
+    },
+    {
+      name = "BeginScissorMode",
+      description = "Begin scissor mode (define screen area for following drawing)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "x"},
+        {type = "int", name = "y"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "EndScissorMode",
+      description = "End scissor mode",
+      returnType = "void"
+    },
+    {
+      name = "SetFrameDirtyRect",
+      description = "Set next frame changed region (call before BeginDrawing()), empty region skips frame presentation",
+      returnType = "void",
+      params = {
+        {type = "Rectangle", name = "rec"}
+      }
+    },
+    {
+      name = "BeginDynamicResolutionMode",
+      description = "Begin drawing scene at dynamic resolution, scaled to reach target GPU frame time",
+      returnType = "void"
+    },
+    {
+      name = "EndDynamicResolutionMode",
+      description = "End drawing scene at dynamic resolution, scene upscaled to screen (following drawing at native resolution)",
+      returnType = "void"
+    },
+    {
+      name = "SetDynamicResolution",
+      description = "Set dynamic resolution target GPU frame time (seconds, 0: target FPS), minimum scale and upscale sharpening",
+      returnType = "void",
+      params = {
+        {type = "float", name = "targetTime"},
+        {type = "float", name = "minScale"},
+        {type = "float", name = "sharpness"}
+      }
+    },
+    {
+      name = "GetDynamicResolutionScale",
+      description = "Get current dynamic resolution scale",
+      returnType = "float"
+    },
+    {
+      name = "BeginVrStereoMode",
+      description = "Begin stereo rendering (requires VR simulator)",
+      returnType = "void",
+      params = {
+        {type = "VrStereoConfig", name = "config"}
+      }
+    },
+    {
+      name = "EndVrStereoMode",
+      description = "End stereo rendering (requires VR simulator)",
+      returnType = "void"
+    },
+    {
+      name = "SetVrStereoSinglePass",
+      description = "Set stereo rendering in a single pass, eyes drawn as instances (requires OpenGL 3.3)",
+      returnType = "void",
+      params = {
+        {type = "bool", name = "enabled"}
+      }
+    },
+    {
+      name = "LoadVrStereoConfig",
+      description = "Load VR stereo config for VR simulator device parameters",
+      returnType = "VrStereoConfig",
+      params = {
+        {type = "VrDeviceInfo", name = "device"}
+      }
+    },
+    {
+      name = "UnloadVrStereoConfig",
+      description = "Unload VR stereo config",
+      returnType = "void",
+      params = {
+        {type = "VrStereoConfig", name = "config"}
+      }
+    },
+    {
+      name = "LoadShader",
+      description = "Load shader from files and bind default locations",
+      returnType = "Shader",
+      params = {
+        {type = "const char *", name = "vsFileName"},
+        {type = "const char *", name = "fsFileName"}
+      }
+    },
+    {
+      name = "LoadShaderFromMemory",
+      description = "Load shader from code strings and bind default locations",
+      returnType = "Shader",
+      params = {
+        {type = "const char *", name = "vsCode"},
+        {type = "const char *", name = "fsCode"}
+      }
+    },
+    {
+      name = "LoadShaderAsync",
+      description = "Load shader from files without waiting for compilation (check IsShaderReady() before use)",
+      returnType = "Shader",
+      params = {
+        {type = "const char *", name = "vsFileName"},
+        {type = "const char *", name = "fsFileName"}
+      }
+    },
+    {
+      name = "LoadShaderFromMemoryAsync",
+      description = "Load shader from code strings without waiting for compilation (check IsShaderReady() before use)",
+      returnType = "Shader",
+      params = {
+        {type = "const char *", name = "vsCode"},
+        {type = "const char *", name = "fsCode"}
+      }
+    },
+    {
+      name = "IsShaderReady",
+      description = "Check if a shader is ready",
+      returnType = "bool",
+      params = {
+        {type = "Shader", name = "shader"}
+      }
+    },
+    {
+      name = "GetShaderLocation",
+      description = "Get shader uniform location",
+      returnType = "int",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "const char *", name = "uniformName"}
+      }
+    },
+    {
+      name = "GetShaderLocationAttrib",
+      description = "Get shader attribute location",
+      returnType = "int",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "const char *", name = "attribName"}
+      }
+    },
+    {
+      name = "SetShaderValue",
+      description = "Set shader uniform value",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "const void *", name = "value"},
+        {type = "int", name = "uniformType"}
+      }
+    },
+    {
+      name = "SetShaderValueV",
+      description = "Set shader uniform value vector",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "const void *", name = "value"},
+        {type = "int", name = "uniformType"},
+        {type = "int", name = "count"}
+      }
+    },
+    {
+      name = "SetShaderValueMatrix",
+      description = "Set shader uniform value (matrix 4x4)",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "Matrix", name = "mat"}
+      }
+    },
+    {
+      name = "SetShaderValueTexture",
+      description = "Set shader uniform value for texture (sampler2d)",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "Texture2D", name = "texture"}
+      }
+    },
+    {
+      name = "SetShaderValueTextureArray",
+      description = "Set shader uniform value for texture array (sampler2DArray)",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "Texture2DArray", name = "texture"}
+      }
+    },
+    {
+      name = "SetShaderValueTexture3D",
+      description = "Set shader uniform value for 3d texture (sampler3D)",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"},
+        {type = "int", name = "locIndex"},
+        {type = "Texture3D", name = "texture"}
+      }
+    },
+    {
+      name = "UnloadShader",
+      description = "Unload shader from GPU memory (VRAM)",
+      returnType = "void",
+      params = {
+        {type = "Shader", name = "shader"}
+      }
+    },
+    {
+      name = "SetShaderCacheDirectory",
+      description = "Set shader program binaries cache directory (NULL to disable)",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "dirPath"}
+      }
+    },
+    {
+      name = "GetMouseRay",
+      description = "Get a ray trace from mouse position",
+      returnType = "Ray",
+      params = {
+        {type = "Vector2", name = "mousePosition"},
+        {type = "Camera", name = "camera"}
+      }
+    },
+    {
+      name = "GetCameraMatrix",
+      description = "Get camera transform matrix (view matrix)",
+      returnType = "Matrix",
+      params = {
+        {type = "Camera", name = "camera"}
+      }
+    },
+    {
+      name = "GetCameraMatrix2D",
+      description = "Get camera 2d transform matrix",
+      returnType = "Matrix",
+      params = {
+        {type = "Camera2D", name = "camera"}
+      }
+    },
+    {
+      name = "GetCameraFrustum",
+      description = "Get camera view frustum (same projection as BeginMode3D())",
+      returnType = "Frustum",
+      params = {
+        {type = "Camera", name = "camera"}
+      }
+    },
+    {
+      name = "GetMatrixFrustum",
+      description = "Get frustum planes from view-projection matrix",
+      returnType = "Frustum",
+      params = {
+        {type = "Matrix", name = "matrix"}
+      }
+    },
+    {
+      name = "GetWorldToScreen",
+      description = "Get the screen space position for a 3d world space position",
+      returnType = "Vector2",
+      params = {
+        {type = "Vector3", name = "position"},
+        {type = "Camera", name = "camera"}
+      }
+    },
+    {
+      name = "GetScreenToWorld2D",
+      description = "Get the world space position for a 2d camera screen space position",
+      returnType = "Vector2",
+      params = {
+        {type = "Vector2", name = "position"},
+        {type = "Camera2D", name = "camera"}
+      }
+    },
+    {
+      name = "GetWorldToScreenEx",
+      description = "Get size position for a 3d world space position",
+      returnType = "Vector2",
+      params = {
+        {type = "Vector3", name = "position"},
+        {type = "Camera", name = "camera"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "GetWorldToScreen2D",
+      description = "Get the screen space position for a 2d camera world space position",
+      returnType = "Vector2",
+      params = {
+        {type = "Vector2", name = "position"},
+        {type = "Camera2D", name = "camera"}
+      }
+    },
+    {
+      name = "GetCameraViewProjection",
+      description = "Get camera view-projection matrices for a viewport size (last one cached)",
+      returnType = "CameraViewProj",
+      params = {
+        {type = "Camera", name = "camera"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
+      }
+    },
+    {
+      name = "GetWorldToScreenArray",
+      description = "Get screen space positions for many 3d world space positions, returns points inside view (clip flags optional)",
+      returnType = "int",
+      params = {
+        {type = "const Vector3 *", name = "positions"},
+        {type = "Vector2 *", name = "screenPositions"},
+        {type = "int", name = "count"},
+        {type = "const CameraViewProj *", name = "viewProj"},
+        {type = "unsigned char *", name = "clipFlags"}
+      }
+    },
+    {
+      name = "SetTargetFPS",
+      description = "Set target FPS (maximum)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "fps"}
+      }
+    },
+    {
+      name = "GetFPS",
+      description = "Get current FPS",
+      returnType = "int"
+    },
+    {
+      name = "GetFrameTime",
+      description = "Get time in seconds for last frame drawn (delta time)",
+      returnType = "float"
+    },
+    {
+      name = "SetFixedUpdateRate",
+      description = "Set fixed update rate (steps per second), decoupled from render rate (0: disabled)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "hz"}
+      }
+    },
+    {
+      name = "GetFixedUpdateSteps",
+      description = "Get fixed update steps to run on current frame",
+      returnType = "int"
+    },
+    {
+      name = "GetFixedUpdateAlpha",
+      description = "Get fixed update interpolation factor [0..1) between previous and current step",
+      returnType = "float"
+    },
+    {
+      name = "SetFrameTimeStatsWindow",
+      description = "Set number of last frames measured for frame time statistics",
+      returnType = "void",
+      params = {
+        {type = "int", name = "frames"}
+      }
+    },
+    {
+      name = "GetFrameTimeStats",
+      description = "Get frame time statistics (percentiles) for last frames",
+      returnType = "FrameTimeStats"
+    },
+    {
+      name = "ExportFrameTimeStats",
+      description = "Export last frames times as CSV file (.csv), times in milliseconds",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "BeginProfileScope",
+      description = "Begin named CPU profile scope (current thread)",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "name"}
+      }
+    },
+    {
+      name = "EndProfileScope",
+      description = "End latest CPU profile scope (current thread)",
+      returnType = "void"
+    },
+    {
+      name = "ExportProfileTrace",
+      description = "Export recorded profile scopes as Chrome trace_event JSON file (.json)",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "GetTime",
+      description = "Get elapsed time in seconds since InitWindow()",
+      returnType = "double"
+    },
+    {
+      name = "GetInputEventTime",
+      description = "Get time in seconds of latest input event registered (device timestamp when available)",
+      returnType = "double"
+    },
+    {
+      name = "GetRandomValue",
+      description = "Get a random value between min and max (both included)",
+      returnType = "int",
+      params = {
+        {type = "int", name = "min"},
+        {type = "int", name = "max"}
+      }
+    },
+    {
+      name = "SetRandomSeed",
+      description = "Set the seed for the random number generator",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "seed"}
+      }
+    },
+    {
+      name = "TakeScreenshot",
+      description = "Takes a screenshot of current screen (filename extension defines format)",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "SetGifRecordingFramerate",
+      description = "Set GIF recording framerate (CTRL+F12 recording, frames encoded on background thread)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "fps"}
+      }
+    },
+    {
+      name = "SetConfigFlags",
+      description = "Setup init configuration flags (view FLAGS)",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "flags"}
+      }
+    },
+    {
+      name = "TraceLog",
+      description = "Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "logLevel"},
+        {type = "const char *", name = "text"},
+        {type = "...", name = "args"}
+      }
+    },
+    {
+      name = "SetTraceLogLevel",
+      description = "Set the current threshold (minimum) log level",
+      returnType = "void",
+      params = {
+        {type = "int", name = "logLevel"}
+      }
+    },
+    {
+      name = "SetTraceLogAsync",
+      description = "Set trace log messages written by a background thread (queued messages flushed on disable)",
+      returnType = "void",
+      params = {
+        {type = "bool", name = "enabled"}
+      }
+    },
+    {
+      name = "MemAlloc",
+      description = "Internal memory allocator",
+      returnType = "void *",
+      params = {
+        {type = "unsigned int", name = "size"}
+      }
+    },
+    {
+      name = "MemRealloc",
+      description = "Internal memory reallocator",
+      returnType = "void *",
+      params = {
+        {type = "void *", name = "ptr"},
+        {type = "unsigned int", name = "size"}
+      }
+    },
+    {
+      name = "MemFree",
+      description = "Internal memory free",
+      returnType = "void",
+      params = {
+        {type = "void *", name = "ptr"}
+      }
+    },
+    {
+      name = "MemAllocUninit",
+      description = "Internal memory allocator, memory not initialized (NULL: size too big)",
+      returnType = "void *",
+      params = {
+        {type = "size_t", name = "size"}
+      }
+    },
+    {
+      name = "MemAllocArray",
+      description = "Internal memory allocator for count elements, initialized to zero (NULL: size overflow)",
+      returnType = "void *",
+      params = {
+        {type = "size_t", name = "count"},
+        {type = "size_t", name = "size"}
+      }
+    },
+    {
+      name = "MemReallocArray",
+      description = "Internal memory reallocator for count elements (NULL: size overflow, ptr not freed)",
+      returnType = "void *",
+      params = {
+        {type = "void *", name = "ptr"},
+        {type = "size_t", name = "count"},
+        {type = "size_t", name = "size"}
+      }
+    },
+    {
+      name = "GetMemoryStats",
+      description = "Get memory allocations stats by module (MemoryModule, -1: all modules), requires SUPPORT_MEMORY_TRACKING",
+      returnType = "MemoryStats",
+      params = {
+        {type = "int", name = "module"}
+      }
+    },
+    {
+      name = "SetMemoryBudget",
+      description = "Set memory budget for module (bytes), warning logged when exceeded (0: no budget)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "module"},
+        {type = "unsigned int", name = "budget"}
+      }
+    },
+    {
+      name = "LoadMemArena",
+      description = "Load memory arena, memory blocks are allocated on demand",
+      returnType = "MemArena",
+      params = {
+        {type = "unsigned int", name = "blockSize"}
+      }
+    },
+    {
+      name = "UnloadMemArena",
+      description = "Unload memory arena, all arena allocations are released",
+      returnType = "void",
+      params = {
+        {type = "MemArena", name = "arena"}
+      }
+    },
+    {
+      name = "ResetMemArena",
+      description = "Reset memory arena, all arena allocations are released (current block kept)",
+      returnType = "void",
+      params = {
+        {type = "MemArena *", name = "arena"}
+      }
+    },
+    {
+      name = "MemArenaAlloc",
+      description = "Allocate memory from arena (not initialized, 16-byte aligned)",
+      returnType = "void *",
+      params = {
+        {type = "MemArena *", name = "arena"},
+        {type = "unsigned int", name = "size"}
+      }
+    },
+    {
+      name = "LoadMemPool",
+      description = "Load memory pool of fixed-size blocks",
+      returnType = "MemPool",
+      params = {
+        {type = "unsigned int", name = "blockSize"},
+        {type = "unsigned int", name = "blockCount"}
+      }
+    },
+    {
+      name = "UnloadMemPool",
+      description = "Unload memory pool",
+      returnType = "void",
+      params = {
+        {type = "MemPool", name = "pool"}
+      }
+    },
+    {
+      name = "MemPoolAlloc",
+      description = "Allocate one block from pool (NULL: pool full)",
+      returnType = "void *",
+      params = {
+        {type = "MemPool *", name = "pool"}
+      }
+    },
+    {
+      name = "MemPoolFree",
+      description = "Free one block back to pool",
+      returnType = "void",
+      params = {
+        {type = "MemPool *", name = "pool"},
+        {type = "void *", name = "ptr"}
+      }
+    },
+    {
+      name = "OpenURL",
+      description = "Open URL with default system browser (if available)",
+      returnType = "void",
+      params = {
+        {type = "const char *", name = "url"}
+      }
+    },
+    {
+      name = "InitJobSystem",
+      description = "Initialize jobs system worker threads (0: one per CPU core minus one)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "threadCount"}
+      }
+    },
+    {
+      name = "CloseJobSystem",
+      description = "Close jobs system, worker threads are finished",
+      returnType = "void"
+    },
+    {
+      name = "GetJobThreadCount",
+      description = "Get jobs system threads count, including calling thread (1: serial)",
+      returnType = "int"
+    },
+    {
+      name = "JobParallelFor",
+      description = "Process items [0, count) in parallel, returns when all processed",
+      returnType = "void",
+      params = {
+        {type = "int", name = "count"},
+        {type = "JobCallback", name = "callback"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "IsAsyncLoadReady",
+      description = "Check if an async load request is finished, asset can be retrieved",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "request"}
+      }
+    },
+    {
+      name = "StartAutomationEventRecording",
+      description = "Start automation events recording into file (input changes only)",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "StopAutomationEventRecording",
+      description = "Stop automation events recording, events file is completed",
+      returnType = "void"
+    },
+    {
+      name = "StartAutomationEventPlaying",
+      description = "Start automation events playing from file",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "StopAutomationEventPlaying",
+      description = "Stop automation events playing",
+      returnType = "void"
+    },
+    {
+      name = "SeekAutomationEventPlaying",
+      description = "Seek automation events playing to frame (since playing start)",
+      returnType = "bool",
+      params = {
+        {type = "unsigned int", name = "frame"}
+      }
+    },
+    {
+      name = "SetTraceLogCallback",
+      description = "Set custom trace log",
+      returnType = "void",
+      params = {
+        {type = "TraceLogCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetLoadFileDataCallback",
+      description = "Set custom file binary data loader",
+      returnType = "void",
+      params = {
+        {type = "LoadFileDataCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetSaveFileDataCallback",
+      description = "Set custom file binary data saver",
+      returnType = "void",
+      params = {
+        {type = "SaveFileDataCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetLoadFileTextCallback",
+      description = "Set custom file text data loader",
+      returnType = "void",
+      params = {
+        {type = "LoadFileTextCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetSaveFileTextCallback",
+      description = "Set custom file text data saver",
+      returnType = "void",
+      params = {
+        {type = "SaveFileTextCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetLoadFileDataMappedCallback",
+      description = "Set custom file binary data mapped loader",
+      returnType = "void",
+      params = {
+        {type = "LoadFileDataMappedCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetUnloadFileDataMappedCallback",
+      description = "Set custom file binary data mapped unloader",
+      returnType = "void",
+      params = {
+        {type = "UnloadFileDataMappedCallback", name = "callback"}
+      }
+    },
+    {
+      name = "SetMemoryAllocator",
+      description = "Set custom memory allocator used by all modules, call before InitWindow() (NULL: default)",
+      returnType = "void",
+      params = {
+        {type = "MemAllocCallback", name = "allocFunc"},
+        {type = "MemReallocCallback", name = "reallocFunc"},
+        {type = "MemFreeCallback", name = "freeFunc"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "LoadFileData",
+      description = "Load file data as byte array (read)",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "unsigned int *", name = "bytesRead"}
+      }
+    },
+    {
+      name = "UnloadFileData",
+      description = "Unload file data allocated by LoadFileData()",
+      returnType = "void",
+      params = {
+        {type = "unsigned char *", name = "data"}
+      }
+    },
+    {
+      name = "LoadFileDataMapped",
+      description = "Load file data mapped to memory (read-only), falls back to LoadFileData()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "unsigned int *", name = "bytesRead"}
+      }
+    },
+    {
+      name = "UnloadFileDataMapped",
+      description = "Unload file data loaded by LoadFileDataMapped()",
+      returnType = "void",
+      params = {
+        {type = "unsigned char *", name = "data"}
+      }
+    },
+    {
+      name = "MountPackFile",
+      description = "Mount pack file (.rpak), file paths are resolved through mounted packs first",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "UnmountPackFiles",
+      description = "Unmount all pack files",
+      returnType = "void"
+    },
+    {
+      name = "ExportPackFile",
+      description = "Export files to pack file (.rpak), returns true on success",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "const char **", name = "files"},
+        {type = "int", name = "fileCount"},
+        {type = "bool", name = "compress"}
+      }
+    },
+    {
+      name = "SaveFileData",
+      description = "Save data to file from byte array (write), returns true on success",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "void *", name = "data"},
+        {type = "unsigned int", name = "bytesToWrite"}
+      }
+    },
+    {
+      name = "ExportDataAsCode",
+      description = "Export data to code (.h), returns true on success",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "unsigned int", name = "size"},
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "LoadFileText",
+      description = "Load text data from file (read), returns a '\\0' terminated string",
+      returnType = "char *",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "UnloadFileText",
+      description = "Unload file text data allocated by LoadFileText()",
+      returnType = "void",
+      params = {
+        {type = "char *", name = "text"}
+      }
+    },
+    {
+      name = "SaveFileText",
+      description = "Save text data to file (write), string must be '\\0' terminated, returns true on success",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "char *", name = "text"}
+      }
+    },
+    {
+      name = "FileExists",
+      description = "Check if file exists",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "DirectoryExists",
+      description = "Check if a directory path exists",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "dirPath"}
+      }
+    },
+    {
+      name = "IsFileExtension",
+      description = "Check file extension (including point: .png, .wav)",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "const char *", name = "ext"}
+      }
+    },
+    {
+      name = "GetFileLength",
+      description = "Get file length in bytes (NOTE: GetFileSize() conflicts with windows.h)",
+      returnType = "int",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "GetFileExtension",
+      description = "Get pointer to extension for a filename string (includes dot: '.png')",
+      returnType = "const char *",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "GetFileName",
+      description = "Get pointer to filename for a path string",
+      returnType = "const char *",
+      params = {
+        {type = "const char *", name = "filePath"}
+      }
+    },
+    {
+      name = "GetFileNameWithoutExt",
+      description = "Get filename string without extension (uses static string)",
+      returnType = "const char *",
+      params = {
+        {type = "const char *", name = "filePath"}
+      }
+    },
+    {
+      name = "GetDirectoryPath",
+      description = "Get full path for a given fileName with path (uses static string)",
+      returnType = "const char *",
+      params = {
+        {type = "const char *", name = "filePath"}
+      }
+    },
+    {
+      name = "GetPrevDirectoryPath",
+      description = "Get previous directory path for a given path (uses static string)",
+      returnType = "const char *",
+      params = {
+        {type = "const char *", name = "dirPath"}
+      }
+    },
+    {
+      name = "GetWorkingDirectory",
+      description = "Get current working directory (uses static string)",
+      returnType = "const char *"
+    },
+    {
+      name = "GetApplicationDirectory",
+      description = "Get the directory if the running application (uses static string)",
+      returnType = "const char *"
+    },
+    {
+      name = "ChangeDirectory",
+      description = "Change working directory, return true on success",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "dir"}
+      }
+    },
+    {
+      name = "IsPathFile",
+      description = "Check if a given path is a file or a directory",
+      returnType = "bool",
+      params = {
+        {type = "const char *", name = "path"}
+      }
+    },
+    {
+      name = "LoadDirectoryFiles",
+      description = "Load directory filepaths",
+      returnType = "FilePathList",
+      params = {
+        {type = "const char *", name = "dirPath"}
+      }
+    },
+    {
+      name = "LoadDirectoryFilesEx",
+      description = "Load directory filepaths with extension filtering and recursive directory scan",
+      returnType = "FilePathList",
+      params = {
+        {type = "const char *", name = "basePath"},
+        {type = "const char *", name = "filter"},
+        {type = "bool", name = "scanSubdirs"}
+      }
+    },
+    {
+      name = "UnloadDirectoryFiles",
+      description = "Unload filepaths",
+      returnType = "void",
+      params = {
+        {type = "FilePathList", name = "files"}
+      }
+    },
+    {
+      name = "IsFileDropped",
+      description = "Check if a file has been dropped into window",
+      returnType = "bool"
+    },
+    {
+      name = "LoadDroppedFiles",
+      description = "Load dropped filepaths",
+      returnType = "FilePathList"
+    },
+    {
+      name = "UnloadDroppedFiles",
+      description = "Unload dropped filepaths",
+      returnType = "void",
+      params = {
+        {type = "FilePathList", name = "files"}
+      }
+    },
+    {
+      name = "GetFileModTime",
+      description = "Get file modification time (last write time)",
+      returnType = "long",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "CompressData",
+      description = "Compress data (DEFLATE algorithm), memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "int *", name = "compDataSize"}
+      }
+    },
+    {
+      name = "DecompressData",
+      description = "Decompress data (DEFLATE algorithm), memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "compData"},
+        {type = "int", name = "compDataSize"},
+        {type = "int *", name = "dataSize"}
+      }
+    },
+    {
+      name = "DecompressDataEx",
+      description = "Decompress data (DEFLATE algorithm) with known size, dataSize provides expected size, memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "compData"},
+        {type = "int", name = "compDataSize"},
+        {type = "int *", name = "dataSize"}
+      }
+    },
+    {
+      name = "CompressDataEx",
+      description = "Compress data with codec (CompressionCodec) and level (0: codec default), memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "codec"},
+        {type = "int", name = "level"},
+        {type = "int *", name = "compDataSize"}
+      }
+    },
+    {
+      name = "DecompressDataCodec",
+      description = "Decompress data with codec, dataSize provides expected size (required by LZ4), memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "compData"},
+        {type = "int", name = "compDataSize"},
+        {type = "int", name = "codec"},
+        {type = "int *", name = "dataSize"}
+      }
+    },
+    {
+      name = "CompressDataStream",
+      description = "Compress data in chunks (DEFLATE algorithm), compressed chunks streamed through callback",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "chunkSize"},
+        {type = "DataStreamCallback", name = "callback"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "DecompressDataStream",
+      description = "Decompress data in chunks (DEFLATE algorithm), decompressed chunks streamed through callback",
+      returnType = "bool",
+      params = {
+        {type = "const unsigned char *", name = "compData"},
+        {type = "int", name = "compDataSize"},
+        {type = "DataStreamCallback", name = "callback"},
+        {type = "void *", name = "userData"}
+      }
+    },
+    {
+      name = "EncodeDataBase64",
+      description = "Encode data to Base64 string, memory must be MemFree()",
+      returnType = "char *",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "int *", name = "outputSize"}
+      }
+    },
+    {
+      name = "DecodeDataBase64",
+      description = "Decode Base64 string data, memory must be MemFree()",
+      returnType = "unsigned char *",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int *", name = "outputSize"}
+      }
+    },
+    {
+      name = "EncodeDataBase64Into",
+      description = "Encode data to Base64 string into buffer, returns encoded size (0: buffer too small)",
+      returnType = "int",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "char *", name = "output"},
+        {type = "int", name = "outputSize"}
+      }
+    },
+    {
+      name = "DecodeDataBase64Into",
+      description = "Decode Base64 string data into buffer, returns decoded size (0: buffer too small)",
+      returnType = "int",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "unsigned char *", name = "output"},
+        {type = "int", name = "outputSize"}
+      }
+    },
+    {
+      name = "GetDataBase64EncodedSize",
+      description = "Get Base64 encoded string size for data size (no null terminator)",
+      returnType = "int",
+      params = {
+        {type = "int", name = "dataSize"}
+      }
+    },
+    {
+      name = "GetDataBase64DecodedSize",
+      description = "Get exact decoded data size for Base64 string",
+      returnType = "int",
+      params = {
+        {type = "const unsigned char *", name = "data"},
+        {type = "int", name = "dataSize"}
+      }
+    },
+    {
+      name = "IsKeyPressed",
+      description = "Check if a key has been pressed once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "key"}
+      }
+    },
+    {
+      name = "IsKeyDown",
+      description = "Check if a key is being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "key"}
+      }
+    },
+    {
+      name = "IsKeyReleased",
+      description = "Check if a key has been released once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "key"}
+      }
+    },
+    {
+      name = "IsKeyUp",
+      description = "Check if a key is NOT being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "key"}
+      }
+    },
+    {
+      name = "SetExitKey",
+      description = "Set a custom key to exit program (default is ESC)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "key"}
+      }
+    },
+    {
+      name = "GetKeyPressed",
+      description = "Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty",
+      returnType = "int"
+    },
+    {
+      name = "GetCharPressed",
+      description = "Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty",
+      returnType = "int"
+    },
+    {
+      name = "IsGamepadAvailable",
+      description = "Check if a gamepad is available",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gamepad"}
+      }
+    },
+    {
+      name = "GetGamepadName",
+      description = "Get gamepad internal name id",
+      returnType = "const char *",
+      params = {
+        {type = "int", name = "gamepad"}
+      }
+    },
+    {
+      name = "IsGamepadButtonPressed",
+      description = "Check if a gamepad button has been pressed once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gamepad"},
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsGamepadButtonDown",
+      description = "Check if a gamepad button is being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gamepad"},
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsGamepadButtonReleased",
+      description = "Check if a gamepad button has been released once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gamepad"},
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsGamepadButtonUp",
+      description = "Check if a gamepad button is NOT being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gamepad"},
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "GetGamepadButtonPressed",
+      description = "Get the last gamepad button pressed",
+      returnType = "int"
+    },
+    {
+      name = "GetGamepadAxisCount",
+      description = "Get gamepad axis count for a gamepad",
+      returnType = "int",
+      params = {
+        {type = "int", name = "gamepad"}
+      }
+    },
+    {
+      name = "GetGamepadAxisMovement",
+      description = "Get axis movement value for a gamepad axis",
+      returnType = "float",
+      params = {
+        {type = "int", name = "gamepad"},
+        {type = "int", name = "axis"}
+      }
+    },
+    {
+      name = "SetGamepadMappings",
+      description = "Set internal gamepad mappings (SDL_GameControllerDB)",
+      returnType = "int",
+      params = {
+        {type = "const char *", name = "mappings"}
+      }
+    },
+    {
+      name = "IsMouseButtonPressed",
+      description = "Check if a mouse button has been pressed once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsMouseButtonDown",
+      description = "Check if a mouse button is being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsMouseButtonReleased",
+      description = "Check if a mouse button has been released once",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "IsMouseButtonUp",
+      description = "Check if a mouse button is NOT being pressed",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "button"}
+      }
+    },
+    {
+      name = "GetMouseX",
+      description = "Get mouse position X",
+      returnType = "int"
+    },
+    {
+      name = "GetMouseY",
+      description = "Get mouse position Y",
+      returnType = "int"
+    },
+    {
+      name = "GetMousePosition",
+      description = "Get mouse position XY",
+      returnType = "Vector2"
+    },
+    {
+      name = "GetMouseDelta",
+      description = "Get mouse delta between frames",
+      returnType = "Vector2"
+    },
+    {
+      name = "SetMousePosition",
+      description = "Set mouse position XY",
+      returnType = "void",
+      params = {
+        {type = "int", name = "x"},
+        {type = "int", name = "y"}
+      }
+    },
+    {
+      name = "SetMouseOffset",
+      description = "Set mouse offset",
+      returnType = "void",
+      params = {
+        {type = "int", name = "offsetX"},
+        {type = "int", name = "offsetY"}
+      }
+    },
+    {
+      name = "SetMouseScale",
+      description = "Set mouse scaling",
+      returnType = "void",
+      params = {
+        {type = "float", name = "scaleX"},
+        {type = "float", name = "scaleY"}
+      }
+    },
+    {
+      name = "GetMouseWheelMove",
+      description = "Get mouse wheel movement for X or Y, whichever is larger",
+      returnType = "float"
+    },
+    {
+      name = "GetMouseWheelMoveV",
+      description = "Get mouse wheel movement for both X and Y",
+      returnType = "Vector2"
+    },
+    {
+      name = "SetMouseCursor",
+      description = "Set mouse cursor",
+      returnType = "void",
+      params = {
+        {type = "int", name = "cursor"}
+      }
+    },
+    {
+      name = "GetTouchX",
+      description = "Get touch position X for touch point 0 (relative to screen size)",
+      returnType = "int"
+    },
+    {
+      name = "GetTouchY",
+      description = "Get touch position Y for touch point 0 (relative to screen size)",
+      returnType = "int"
+    },
+    {
+      name = "GetTouchPosition",
+      description = "Get touch position XY for a touch point index (relative to screen size)",
+      returnType = "Vector2",
+      params = {
+        {type = "int", name = "index"}
+      }
+    },
+    {
+      name = "GetTouchPointId",
+      description = "Get touch point identifier for given index",
+      returnType = "int",
+      params = {
+        {type = "int", name = "index"}
+      }
+    },
+    {
+      name = "GetTouchPointCount",
+      description = "Get number of touch points",
+      returnType = "int"
+    },
+    {
+      name = "GetInputEventCount",
+      description = "Get number of input events registered by last PollInputEvents()",
+      returnType = "int"
+    },
+    {
+      name = "GetInputEvent",
+      description = "Get input event registered by last PollInputEvents(), ordered by time",
+      returnType = "InputEvent",
+      params = {
+        {type = "int", name = "index"}
+      }
+    },
+    {
+      name = "GetInputLatency",
+      description = "Get time in seconds from input events to screen buffer swap (latest frame presenting input events)",
+      returnType = "float"
+    },
+    {
+      name = "SetGesturesEnabled",
+      description = "Enable a set of gestures using flags",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "flags"}
+      }
+    },
+    {
+      name = "IsGestureDetected",
+      description = "Check if a gesture have been detected",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "gesture"}
+      }
+    },
+    {
+      name = "GetGestureDetected",
+      description = "Get latest detected gesture",
+      returnType = "int"
+    },
+    {
+      name = "GetGestureHoldDuration",
+      description = "Get gesture hold time in milliseconds",
+      returnType = "float"
+    },
+    {
+      name = "GetGestureDragVector",
+      description = "Get gesture drag vector",
+      returnType = "Vector2"
+    },
+    {
+      name = "GetGestureDragAngle",
+      description = "Get gesture drag angle",
+      returnType = "float"
+    },
+    {
+      name = "GetGesturePinchVector",
+      description = "Get gesture pinch delta",
+      returnType = "Vector2"
+    },
+    {
+      name = "GetGesturePinchAngle",
+      description = "Get gesture pinch angle",
+      returnType = "float"
+    },
+    {
+      name = "UpdateCamera",
+      description = "Update camera position for selected mode",
+      returnType = "void",
+      params = {
+        {type = "Camera *", name = "camera"},
+        {type = "int", name = "mode"}
+      }
+    },
+    {
+      name = "UpdateCameraPro",
+      description = "Update camera movement/rotation",
+      returnType = "void",
+      params = {
+        {type = "Camera *", name = "camera"},
+        {type = "Vector3", name = "movement"},
+        {type = "Vector3", name = "rotation"},
+        {type = "float", name = "zoom"}
+      }
+    },
+    {
+      name = "SetShapesTexture",
+      description = "Set texture and rectangle to be used on shapes drawing",
+      returnType = "void",
+      params = {
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"}
+      }
+    },
+    {
+      name = "AddShapesTexture",
+      description = "Add texture white region used on shapes drawing while texture is current (no draw call break)",
+      returnType = "void",
+      params = {
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"}
+      }
+    },
+    {
+      name = "RemoveShapesTexture",
+      description = "Remove texture white region used on shapes drawing",
+      returnType = "void",
+      params = {
+        {type = "Texture2D", name = "texture"}
+      }
+    },
+    {
+      name = "SetShapesTessellation",
+      description = "Set shapes curves tessellation max error in screen pixels (0: fixed segments)",
+      returnType = "void",
+      params = {
+        {type = "float", name = "maxError"}
+      }
+    },
+    {
+      name = "BeginShapesSdfMode",
+      description = "Begin SDF shapes mode, circles, rings, thick lines and rounded rectangles drawn as antialiased quads",
+      returnType = "void"
+    },
+    {
+      name = "EndShapesSdfMode",
+      description = "End SDF shapes mode, queued shapes are drawn",
+      returnType = "void"
+    },
+    {
+      name = "DrawPixel",
+      description = "Draw a pixel",
+      returnType = "void",
+      params = {
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "Color", name = "color"}
+      }
+    },
+    {
+      name = "DrawPixelV",
+      description = "Draw a pixel (Vector version)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "unsigned int *", name = "bytesRead"}
+        {type = "Vector2", name = "position"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SaveFileDataCallback",
-      description = "FileIO: Save binary data",
-      returnType = "bool",
+      name = "DrawLine",
+      description = "Draw a line",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "void *", name = "data"},
-        {type = "unsigned int", name = "bytesToWrite"}
+        {type = "int", name = "startPosX"},
+        {type = "int", name = "startPosY"},
+        {type = "int", name = "endPosX"},
+        {type = "int", name = "endPosY"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "LoadFileTextCallback",
-      description = "FileIO: Load text data",
-      returnType = "char *",
+      name = "DrawLineV",
+      description = "Draw a line (Vector version)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "Vector2", name = "startPos"},
+        {type = "Vector2", name = "endPos"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SaveFileTextCallback",
-      description = "FileIO: Save text data",
-      returnType = "bool",
+      name = "DrawLineEx",
+      description = "Draw a line defining thickness",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "char *", name = "text"}
+        {type = "Vector2", name = "startPos"},
+        {type = "Vector2", name = "endPos"},
+        {type = "float", name = "thick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "AudioCallback",
-      description = "",
+      name = "DrawLineBezier",
+      description = "Draw a line using cubic-bezier curves in-out",
       returnType = "void",
       params = {
-        {type = "void *", name = "bufferData"},
-        {type = "unsigned int", name = "frames"}
+        {type = "Vector2", name = "startPos"},
+        {type = "Vector2", name = "endPos"},
+        {type = "float", name = "thick"},
+        {type = "Color", name = "color"}
       }
-    }
-  },
-  functions = {
+    },
     {
-      name = "InitWindow",
-      description = "Initialize window and OpenGL context",
+      name = "DrawLineBezierQuad",
+      description = "Draw line using quadratic bezier curves with a control point",
       returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "const char *", name = "title"}
+        {type = "Vector2", name = "startPos"},
+        {type = "Vector2", name = "endPos"},
+        {type = "Vector2", name = "controlPos"},
+        {type = "float", name = "thick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "WindowShouldClose",
-      description = "Check if KEY_ESCAPE pressed or Close icon pressed",
-      returnType = "bool"
+      name = "DrawLineBezierCubic",
+      description = "Draw line using cubic bezier curves with 2 control points",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "startPos"},
+        {type = "Vector2", name = "endPos"},
+        {type = "Vector2", name = "startControlPos"},
+        {type = "Vector2", name = "endControlPos"},
+        {type = "float", name = "thick"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "CloseWindow",
-      description = "Close window and unload OpenGL context",
-      returnType = "void"
+      name = "DrawLineStrip",
+      description = "Draw lines sequence",
+      returnType = "void",
+      params = {
+        {type = "Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowReady",
-      description = "Check if window has been initialized successfully",
-      returnType = "bool"
+      name = "DrawCircle",
+      description = "Draw a color-filled circle",
+      returnType = "void",
+      params = {
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "float", name = "radius"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowFullscreen",
-      description = "Check if window is currently fullscreen",
-      returnType = "bool"
+      name = "DrawCircleSector",
+      description = "Draw a piece of a circle",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "float", name = "startAngle"},
+        {type = "float", name = "endAngle"},
+        {type = "int", name = "segments"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowHidden",
-      description = "Check if window is currently hidden (only PLATFORM_DESKTOP)",
-      returnType = "bool"
+      name = "DrawCircleSectorLines",
+      description = "Draw circle sector outline",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "float", name = "startAngle"},
+        {type = "float", name = "endAngle"},
+        {type = "int", name = "segments"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowMinimized",
-      description = "Check if window is currently minimized (only PLATFORM_DESKTOP)",
-      returnType = "bool"
+      name = "DrawCircleGradient",
+      description = "Draw a gradient-filled circle",
+      returnType = "void",
+      params = {
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "float", name = "radius"},
+        {type = "Color", name = "color1"},
+        {type = "Color", name = "color2"}
+      }
     },
     {
-      name = "IsWindowMaximized",
-      description = "Check if window is currently maximized (only PLATFORM_DESKTOP)",
-      returnType = "bool"
+      name = "DrawCircleV",
+      description = "Draw a color-filled circle (Vector version)",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowFocused",
-      description = "Check if window is currently focused (only PLATFORM_DESKTOP)",
-      returnType = "bool"
+      name = "DrawCircleLines",
+      description = "Draw circle outline",
+      returnType = "void",
+      params = {
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "float", name = "radius"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowResized",
-      description = "Check if window has been resized last frame",
-      returnType = "bool"
+      name = "DrawEllipse",
+      description = "Draw ellipse",
+      returnType = "void",
+      params = {
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "float", name = "radiusH"},
+        {type = "float", name = "radiusV"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsWindowState",
-      description = "Check if one specific window flag is enabled",
-      returnType = "bool",
+      name = "DrawEllipsePro",
+      description = "Draw ellipse with pro parameters",
+      returnType = "void",
       params = {
-        {type = "unsigned int", name = "flag"}
+        {type = "Vector2", name = "center"},
+        {type = "Vector2", name = "radius"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "angle"},
+        {type = "Color", name = "col"}
       }
     },
     {
-      name = "SetWindowState",
-      description = "Set window configuration state using flags (only PLATFORM_DESKTOP)",
+      name = "DrawEllipseLines",
+      description = "Draw ellipse outline",
       returnType = "void",
       params = {
-        {type = "unsigned int", name = "flags"}
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "float", name = "radiusH"},
+        {type = "float", name = "radiusV"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "ClearWindowState",
-      description = "Clear window configuration state flags",
+      name = "DrawEllipseLinesEx",
+      description = "Draw ellipse outline with extended parameters",
       returnType = "void",
       params = {
-        {type = "unsigned int", name = "flags"}
+        {type = "Vector2", name = "center"},
+        {type = "Vector2", name = "radius"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "ToggleFullscreen",
-      description = "Toggle window state: fullscreen/windowed (only PLATFORM_DESKTOP)",
-      returnType = "void"
+      name = "DrawEllipseLinesPro",
+      description = "Draw ellipse outline with pro parameters        ",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "Vector2", name = "radius"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "MaximizeWindow",
-      description = "Set window state: maximized, if resizable (only PLATFORM_DESKTOP)",
-      returnType = "void"
+      name = "DrawRing",
+      description = "Draw ring",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "innerRadius"},
+        {type = "float", name = "outerRadius"},
+        {type = "float", name = "startAngle"},
+        {type = "float", name = "endAngle"},
+        {type = "int", name = "segments"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "MinimizeWindow",
-      description = "Set window state: minimized, if resizable (only PLATFORM_DESKTOP)",
-      returnType = "void"
+      name = "DrawRingLines",
+      description = "Draw ring outline",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "innerRadius"},
+        {type = "float", name = "outerRadius"},
+        {type = "float", name = "startAngle"},
+        {type = "float", name = "endAngle"},
+        {type = "int", name = "segments"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "RestoreWindow",
-      description = "Set window state: not minimized/maximized (only PLATFORM_DESKTOP)",
-      returnType = "void"
+      name = "DrawRectangle",
+      description = "Draw a color-filled rectangle",
+      returnType = "void",
+      params = {
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "SetWindowIcon",
-      description = "Set icon for window (single image, RGBA 32bit, only PLATFORM_DESKTOP)",
+      name = "DrawRectangleV",
+      description = "Draw a color-filled rectangle (Vector version)",
       returnType = "void",
       params = {
-        {type = "Image", name = "image"}
+        {type = "Vector2", name = "position"},
+        {type = "Vector2", name = "size"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetWindowIcons",
-      description = "Set icon for window (multiple images, RGBA 32bit, only PLATFORM_DESKTOP)",
+      name = "DrawRectangleRec",
+      description = "Draw a color-filled rectangle",
       returnType = "void",
       params = {
-        {type = "Image *", name = "images"},
-        {type = "int", name = "count"}
+        {type = "Rectangle", name = "rec"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetWindowTitle",
-      description = "Set title for window (only PLATFORM_DESKTOP)",
+      name = "DrawRectanglePro",
+      description = "Draw a color-filled rectangle with pro parameters",
       returnType = "void",
       params = {
-        {type = "const char *", name = "title"}
+        {type = "Rectangle", name = "rec"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetWindowPosition",
-      description = "Set window position on screen (only PLATFORM_DESKTOP)",
+      name = "DrawRectangleGradientV",
+      description = "Draw a vertical-gradient-filled rectangle",
       returnType = "void",
       params = {
-        {type = "int", name = "x"},
-        {type = "int", name = "y"}
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "color1"},
+        {type = "Color", name = "color2"}
       }
     },
     {
-      name = "SetWindowMonitor",
-      description = "Set monitor for the current window (fullscreen mode)",
+      name = "DrawRectangleGradientH",
+      description = "Draw a horizontal-gradient-filled rectangle",
       returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "color1"},
+        {type = "Color", name = "color2"}
       }
     },
     {
-      name = "SetWindowMinSize",
-      description = "Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)",
+      name = "DrawRectangleGradientEx",
+      description = "Draw a gradient-filled rectangle with custom vertex colors",
       returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"}
+        {type = "Rectangle", name = "rec"},
+        {type = "Color", name = "col1"},
+        {type = "Color", name = "col2"},
+        {type = "Color", name = "col3"},
+        {type = "Color", name = "col4"}
       }
     },
     {
-      name = "SetWindowSize",
-      description = "Set window dimensions",
+      name = "DrawRectangleLines",
+      description = "Draw rectangle outline",
       returnType = "void",
       params = {
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
         {type = "int", name = "width"},
-        {type = "int", name = "height"}
+        {type = "int", name = "height"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetWindowOpacity",
-      description = "Set window opacity [0.0f..1.0f] (only PLATFORM_DESKTOP)",
+      name = "DrawRectangleLinesEx",
+      description = "Draw rectangle outline with extended parameters",
       returnType = "void",
       params = {
-        {type = "float", name = "opacity"}
+        {type = "Rectangle", name = "rec"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetWindowHandle",
-      description = "Get native window handle",
-      returnType = "void *"
-    },
-    {
-      name = "GetScreenWidth",
-      description = "Get current screen width",
-      returnType = "int"
-    },
-    {
-      name = "GetScreenHeight",
-      description = "Get current screen height",
-      returnType = "int"
-    },
-    {
-      name = "GetRenderWidth",
-      description = "Get current render width (it considers HiDPI)",
-      returnType = "int"
-    },
-    {
-      name = "GetRenderHeight",
-      description = "Get current render height (it considers HiDPI)",
-      returnType = "int"
+      name = "DrawRectangleLinesPro",
+      description = "Draw rectangle outline with pro parameters ",
+      returnType = "void",
+      params = {
+        {type = "Rectangle", name = "rec"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "GetMonitorCount",
-      description = "Get number of connected monitors",
-      returnType = "int"
+      name = "DrawRectangleRounded",
+      description = "Draw rectangle with rounded edges",
+      returnType = "void",
+      params = {
+        {type = "Rectangle", name = "rec"},
+        {type = "float", name = "roundness"},
+        {type = "int", name = "segments"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "GetCurrentMonitor",
-      description = "Get current connected monitor",
-      returnType = "int"
+      name = "DrawRectangleRoundedLines",
+      description = "Draw rectangle with rounded edges outline",
+      returnType = "void",
+      params = {
+        {type = "Rectangle", name = "rec"},
+        {type = "float", name = "roundness"},
+        {type = "int", name = "segments"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "GetMonitorPosition",
-      description = "Get specified monitor position",
-      returnType = "Vector2",
+      name = "DrawTriangle",
+      description = "Draw a color-filled triangle (vertex in counter-clockwise order!)",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2", name = "v1"},
+        {type = "Vector2", name = "v2"},
+        {type = "Vector2", name = "v3"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMonitorWidth",
-      description = "Get specified monitor width (current video mode used by monitor)",
-      returnType = "int",
+      name = "DrawTriangleLines",
+      description = "Draw triangle outline (vertex in counter-clockwise order!)",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2", name = "v1"},
+        {type = "Vector2", name = "v2"},
+        {type = "Vector2", name = "v3"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMonitorHeight",
-      description = "Get specified monitor height (current video mode used by monitor)",
-      returnType = "int",
+      name = "DrawTriangleLinesEx",
+      description = "Draw a triangle using lines with extended parameters",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2", name = "v1"},
+        {type = "Vector2", name = "v2"},
+        {type = "Vector2", name = "v3"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMonitorPhysicalWidth",
-      description = "Get specified monitor physical width in millimetres",
-      returnType = "int",
+      name = "DrawTriangleFan",
+      description = "Draw a triangle fan defined by points (first vertex is the center)",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMonitorPhysicalHeight",
-      description = "Get specified monitor physical height in millimetres",
-      returnType = "int",
+      name = "DrawTriangleStrip",
+      description = "Draw a triangle strip defined by points",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMonitorRefreshRate",
-      description = "Get specified monitor refresh rate",
-      returnType = "int",
+      name = "DrawPoly",
+      description = "Draw a regular polygon (Vector version)",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "float", name = "radius"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetWindowPosition",
-      description = "Get window position XY on monitor",
-      returnType = "Vector2"
+      name = "DrawPolyEx",
+      description = "Draw a bi-directional polygon of n sides (Vector version)",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "Vector2", name = "radius"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "col"}
+      }
     },
     {
-      name = "GetWindowScaleDPI",
-      description = "Get window scale DPI factor",
-      returnType = "Vector2"
+      name = "DrawPolyPro",
+      description = "Draw a bi-directional polygon of n sides (Vector version) with pro parameters",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "Vector2", name = "radius"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "col"}
+      }
     },
     {
-      name = "GetMonitorName",
-      description = "Get the human-readable, UTF-8 encoded name of the primary monitor",
-      returnType = "const char *",
+      name = "DrawPolyLines",
+      description = "Draw a polygon outline of n sides",
+      returnType = "void",
       params = {
-        {type = "int", name = "monitor"}
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "float", name = "radius"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetClipboardText",
-      description = "Set clipboard text content",
+      name = "DrawPolyLinesEx",
+      description = "Draw a polygon outline of n sides with extended parameters",
       returnType = "void",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "float", name = "radius"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetClipboardText",
-      description = "Get clipboard text content",
-      returnType = "const char *"
+      name = "DrawPolyLinesPro",
+      description = "Draw a bi-directional polygon outline of n sides with pro parameters",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "sides"},
+        {type = "Vector2", name = "radius"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "lineThick"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "EnableEventWaiting",
-      description = "Enable waiting for events on EndDrawing(), no automatic event polling",
+      name = "PathBegin",
+      description = "Begin a new path, previous path points are cleared",
       returnType = "void"
     },
     {
-      name = "DisableEventWaiting",
-      description = "Disable waiting for events on EndDrawing(), automatic events polling",
-      returnType = "void"
+      name = "PathMoveTo",
+      description = "Move path pen to point, a new contour is started",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "point"}
+      }
     },
     {
-      name = "SwapScreenBuffer",
-      description = "Swap back buffer with front buffer (screen drawing)",
-      returnType = "void"
+      name = "PathLineTo",
+      description = "Add a line from path pen to point",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "point"}
+      }
     },
     {
-      name = "PollInputEvents",
-      description = "Register all input events",
-      returnType = "void"
+      name = "PathQuadTo",
+      description = "Add a quadratic bezier curve from path pen to point (adaptive flattening)",
+      returnType = "void",
+      params = {
+        {type = "Vector2", name = "control"},
+        {type = "Vector2", name = "point"}
+      }
     },
     {
-      name = "WaitTime",
-      description = "Wait for some time (halt program execution)",
+      name = "PathCubicTo",
+      description = "Add a cubic bezier curve from path pen to point (adaptive flattening)",
       returnType = "void",
       params = {
-        {type = "double", name = "seconds"}
+        {type = "Vector2", name = "control1"},
+        {type = "Vector2", name = "control2"},
+        {type = "Vector2", name = "point"}
       }
     },
     {
-      name = "ShowCursor",
-      description = "Shows cursor",
+      name = "PathClose",
+      description = "Close current path contour",
       returnType = "void"
     },
     {
-      name = "HideCursor",
-      description = "Hides cursor",
-      returnType = "void"
+      name = "PathStroke",
+      description = "Draw path contours outline (PathJoin, PathCap)",
+      returnType = "void",
+      params = {
+        {type = "float", name = "thick"},
+        {type = "int", name = "join"},
+        {type = "int", name = "cap"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "IsCursorHidden",
-      description = "Check if cursor is not visible",
-      returnType = "bool"
+      name = "PathFill",
+      description = "Draw path contours filled (concave contours triangulated)",
+      returnType = "void",
+      params = {
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "EnableCursor",
-      description = "Enables cursor (unlock cursor)",
-      returnType = "void"
+      name = "LoadSpline",
+      description = "Load spline from control points (SplineType), tessellated on first use",
+      returnType = "Spline",
+      params = {
+        {type = "int", name = "type"},
+        {type = "const Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"}
+      }
     },
     {
-      name = "DisableCursor",
-      description = "Disables cursor (lock cursor)",
-      returnType = "void"
+      name = "UnloadSpline",
+      description = "Unload spline data",
+      returnType = "void",
+      params = {
+        {type = "Spline", name = "spline"}
+      }
     },
     {
-      name = "IsCursorOnScreen",
-      description = "Check if cursor is on the screen",
-      returnType = "bool"
+      name = "UpdateSpline",
+      description = "Update spline control points, tessellated again on next use",
+      returnType = "void",
+      params = {
+        {type = "Spline *", name = "spline"},
+        {type = "const Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"}
+      }
     },
     {
-      name = "ClearBackground",
-      description = "Set background color (framebuffer clear color)",
+      name = "DrawSpline",
+      description = "Draw spline, tessellation cached until points or zoom level change",
       returnType = "void",
       params = {
+        {type = "Spline *", name = "spline"},
+        {type = "float", name = "thick"},
         {type = "Color", name = "color"}
       }
     },
     {
-      name = "BeginDrawing",
-      description = "Setup canvas (framebuffer) to start drawing",
-      returnType = "void"
+      name = "GetSplineLength",
+      description = "Get spline length (tessellated)",
+      returnType = "float",
+      params = {
+        {type = "Spline *", name = "spline"}
+      }
     },
     {
-      name = "EndDrawing",
-      description = "End canvas drawing and swap buffers (double buffering)",
-      returnType = "void"
+      name = "GetSplinePoint",
+      description = "Get spline point at distance from start (arc length parameterization)",
+      returnType = "Vector2",
+      params = {
+        {type = "Spline *", name = "spline"},
+        {type = "float", name = "distance"}
+      }
     },
     {
-      name = "BeginMode2D",
-      description = "Begin 2D mode with custom camera (2D)",
-      returnType = "void",
+      name = "CheckCollisionRecs",
+      description = "Check collision between two rectangles",
+      returnType = "bool",
       params = {
-        {type = "Camera2D", name = "camera"}
+        {type = "Rectangle", name = "rec1"},
+        {type = "Rectangle", name = "rec2"}
       }
     },
     {
-      name = "EndMode2D",
-      description = "Ends 2D mode with custom camera",
-      returnType = "void"
+      name = "CheckCollisionCircles",
+      description = "Check collision between two circles",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "center1"},
+        {type = "float", name = "radius1"},
+        {type = "Vector2", name = "center2"},
+        {type = "float", name = "radius2"}
+      }
     },
     {
-      name = "BeginMode3D",
-      description = "Begin 3D mode with custom camera (3D)",
-      returnType = "void",
+      name = "CheckCollisionCircleRec",
+      description = "Check collision between circle and rectangle",
+      returnType = "bool",
       params = {
-        {type = "Camera3D", name = "camera"}
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "EndMode3D",
-      description = "Ends 3D mode and returns to default 2D orthographic mode",
-      returnType = "void"
+      name = "CheckCollisionPointRec",
+      description = "Check if point is inside rectangle",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "point"},
+        {type = "Rectangle", name = "rec"}
+      }
     },
     {
-      name = "BeginTextureMode",
-      description = "Begin drawing to render texture",
-      returnType = "void",
+      name = "CheckCollisionPointCircle",
+      description = "Check if point is inside circle",
+      returnType = "bool",
       params = {
-        {type = "RenderTexture2D", name = "target"}
+        {type = "Vector2", name = "point"},
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"}
       }
     },
     {
-      name = "EndTextureMode",
-      description = "Ends drawing to render texture",
-      returnType = "void"
+      name = "CheckCollisionPointEllipse",
+      description = "Check if point is inside ellipse",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "point"},
+        {type = "Vector2", name = "center"},
+        {type = "Vector2", name = "radius"}
+      }
     },
     {
-      name = "BeginShaderMode",
-      description = "Begin custom shader drawing",
-      returnType = "void",
+      name = "CheckCollisionPointTriangle",
+      description = "Check if point is inside a triangle",
+      returnType = "bool",
       params = {
-        {type = "Shader", name = "shader"}
+        {type = "Vector2", name = "point"},
+        {type = "Vector2", name = "p1"},
+        {type = "Vector2", name = "p2"},
+        {type = "Vector2", name = "p3"}
       }
     },
     {
-      name = "EndShaderMode",
-      description = "End custom shader drawing (use default shader)",
-      returnType = "void"
+      name = "CheckCollisionPointPoly",
+      description = "Check if point is within a polygon described by array of vertices",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "point"},
+        {type = "Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"}
+      }
     },
     {
-      name = "BeginBlendMode",
-      description = "Begin blending mode (alpha, additive, multiplied, subtract, custom)",
+      name = "LoadPolygonIndex",
+      description = "Load polygon index for fast point in polygon checks (simple polygon)",
+      returnType = "PolygonIndex",
+      params = {
+        {type = "const Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"}
+      }
+    },
+    {
+      name = "UnloadPolygonIndex",
+      description = "Unload polygon index data",
       returnType = "void",
       params = {
-        {type = "int", name = "mode"}
+        {type = "PolygonIndex", name = "index"}
       }
     },
     {
-      name = "EndBlendMode",
-      description = "End blending mode (reset to default: alpha blending)",
-      returnType = "void"
+      name = "CheckCollisionPointPolyIndex",
+      description = "Check if point is within an indexed polygon",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "point"},
+        {type = "PolygonIndex", name = "index"}
+      }
     },
     {
-      name = "BeginScissorMode",
-      description = "Begin scissor mode (define screen area for following drawing)",
-      returnType = "void",
+      name = "CheckCollisionPointsPoly",
+      description = "Check points within an indexed polygon, results per point, returns points inside count",
+      returnType = "int",
       params = {
-        {type = "int", name = "x"},
-        {type = "int", name = "y"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"}
+        {type = "const Vector2 *", name = "points"},
+        {type = "int", name = "pointCount"},
+        {type = "PolygonIndex", name = "index"},
+        {type = "bool *", name = "results"}
       }
     },
     {
-      name = "EndScissorMode",
-      description = "End scissor mode",
-      returnType = "void"
+      name = "CheckCollisionLines",
+      description = "Check the collision between two lines defined by two points each, returns collision point by reference",
+      returnType = "bool",
+      params = {
+        {type = "Vector2", name = "startPos1"},
+        {type = "Vector2", name = "endPos1"},
+        {type = "Vector2", name = "startPos2"},
+        {type = "Vector2", name = "endPos2"},
+        {type = "Vector2 *", name = "collisionPoint"}
+      }
     },
     {
-      name = "BeginVrStereoMode",
-      description = "Begin stereo rendering (requires VR simulator)",
-      returnType = "void",
+      name = "CheckCollisionPointLine",
+      description = "Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]",
+      returnType = "bool",
       params = {
-        {type = "VrStereoConfig", name = "config"}
+        {type = "Vector2", name = "point"},
+        {type = "Vector2", name = "p1"},
+        {type = "Vector2", name = "p2"},
+        {type = "int", name = "threshold"}
       }
     },
     {
-      name = "EndVrStereoMode",
-      description = "End stereo rendering (requires VR simulator)",
-      returnType = "void"
+      name = "GetCollisionRec",
+      description = "Get collision rectangle for two rectangles collision",
+      returnType = "Rectangle",
+      params = {
+        {type = "Rectangle", name = "rec1"},
+        {type = "Rectangle", name = "rec2"}
+      }
     },
     {
-      name = "LoadVrStereoConfig",
-      description = "Load VR stereo config for VR simulator device parameters",
-      returnType = "VrStereoConfig",
+      name = "CheckCollisionRecsBatch",
+      description = "Check collision between rectangle and rectangles array (SoA), returns colliding count",
+      returnType = "int",
       params = {
-        {type = "VrDeviceInfo", name = "device"}
+        {type = "Rectangle", name = "rec"},
+        {type = "const float *", name = "xs"},
+        {type = "const float *", name = "ys"},
+        {type = "const float *", name = "widths"},
+        {type = "const float *", name = "heights"},
+        {type = "int", name = "count"},
+        {type = "bool *", name = "results"}
       }
     },
     {
-      name = "UnloadVrStereoConfig",
-      description = "Unload VR stereo config",
-      returnType = "void",
+      name = "CheckCollisionCirclesBatch",
+      description = "Check collision between circle and circles array (SoA), returns colliding count",
+      returnType = "int",
       params = {
-        {type = "VrStereoConfig", name = "config"}
+        {type = "Vector2", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "const float *", name = "xs"},
+        {type = "const float *", name = "ys"},
+        {type = "const float *", name = "radii"},
+        {type = "int", name = "count"},
+        {type = "bool *", name = "results"}
       }
     },
     {
-      name = "LoadShader",
-      description = "Load shader from files and bind default locations",
-      returnType = "Shader",
+      name = "CheckCollisionCircleRecBatch",
+      description = "Check collision between rectangle and circles array (SoA), returns colliding count",
+      returnType = "int",
       params = {
-        {type = "const char *", name = "vsFileName"},
-        {type = "const char *", name = "fsFileName"}
+        {type = "Rectangle", name = "rec"},
+        {type = "const float *", name = "xs"},
+        {type = "const float *", name = "ys"},
+        {type = "const float *", name = "radii"},
+        {type = "int", name = "count"},
+        {type = "bool *", name = "results"}
       }
     },
     {
-      name = "LoadShaderFromMemory",
-      description = "Load shader from code strings and bind default locations",
-      returnType = "Shader",
+      name = "CheckCollisionPointRecBatch",
+      description = "Check points array (SoA) inside rectangle, returns points inside count",
+      returnType = "int",
       params = {
-        {type = "const char *", name = "vsCode"},
-        {type = "const char *", name = "fsCode"}
+        {type = "Rectangle", name = "rec"},
+        {type = "const float *", name = "xs"},
+        {type = "const float *", name = "ys"},
+        {type = "int", name = "count"},
+        {type = "bool *", name = "results"}
       }
     },
     {
-      name = "IsShaderReady",
-      description = "Check if a shader is ready",
-      returnType = "bool",
+      name = "LoadImage",
+      description = "Load image from file into CPU memory (RAM)",
+      returnType = "Image",
       params = {
-        {type = "Shader", name = "shader"}
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "LoadImageRaw",
+      description = "Load image from RAW file data",
+      returnType = "Image",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "format"},
+        {type = "int", name = "headerSize"}
       }
     },
     {
-      name = "GetShaderLocation",
-      description = "Get shader uniform location",
-      returnType = "int",
+      name = "LoadImageAnim",
+      description = "Load image sequence from file (frames appended to image.data)",
+      returnType = "Image",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "const char *", name = "uniformName"}
+        {type = "const char *", name = "fileName"},
+        {type = "int *", name = "frames"}
       }
     },
     {
-      name = "GetShaderLocationAttrib",
-      description = "Get shader attribute location",
-      returnType = "int",
+      name = "LoadImageFromMemory",
+      description = "Load image from memory buffer, fileType refers to extension: i.e. '.png'",
+      returnType = "Image",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "const char *", name = "attribName"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"}
       }
     },
     {
-      name = "SetShaderValue",
-      description = "Set shader uniform value",
-      returnType = "void",
+      name = "LoadImageFromMemoryInto",
+      description = "Load image from memory buffer into provided pixels memory (size from GetImageInfoFromMemory())",
+      returnType = "bool",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "int", name = "locIndex"},
-        {type = "const void *", name = "value"},
-        {type = "int", name = "uniformType"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "void *", name = "pixels"},
+        {type = "int", name = "pixelsSize"}
       }
     },
     {
-      name = "SetShaderValueV",
-      description = "Set shader uniform value vector",
-      returnType = "void",
+      name = "GetImageInfoFromMemory",
+      description = "Get image size and pixel format from memory buffer, without decoding",
+      returnType = "bool",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "int", name = "locIndex"},
-        {type = "const void *", name = "value"},
-        {type = "int", name = "uniformType"},
-        {type = "int", name = "count"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int *", name = "width"},
+        {type = "int *", name = "height"},
+        {type = "int *", name = "format"}
       }
     },
     {
-      name = "SetShaderValueMatrix",
-      description = "Set shader uniform value (matrix 4x4)",
-      returnType = "void",
+      name = "RegisterImageDecoder",
+      description = "Register image decoder for file type (i.e. '.jpg'), checked before built-in decoders",
+      returnType = "bool",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "int", name = "locIndex"},
-        {type = "Matrix", name = "mat"}
+        {type = "const char *", name = "fileType"},
+        {type = "ImageProbeCallback", name = "probe"},
+        {type = "ImageDecodeCallback", name = "decode"}
       }
     },
     {
-      name = "SetShaderValueTexture",
-      description = "Set shader uniform value for texture (sampler2d)",
-      returnType = "void",
+      name = "LoadImageFromTexture",
+      description = "Load image from GPU texture data",
+      returnType = "Image",
       params = {
-        {type = "Shader", name = "shader"},
-        {type = "int", name = "locIndex"},
         {type = "Texture2D", name = "texture"}
       }
     },
     {
-      name = "UnloadShader",
-      description = "Unload shader from GPU memory (VRAM)",
-      returnType = "void",
+      name = "LoadImageFromScreen",
+      description = "Load image from screen buffer and (screenshot)",
+      returnType = "Image"
+    },
+    {
+      name = "IsImageReady",
+      description = "Check if an image is ready",
+      returnType = "bool",
       params = {
-        {type = "Shader", name = "shader"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "GetMouseRay",
-      description = "Get a ray trace from mouse position",
-      returnType = "Ray",
+      name = "UnloadImage",
+      description = "Unload image from CPU memory (RAM)",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "mousePosition"},
-        {type = "Camera", name = "camera"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "GetCameraMatrix",
-      description = "Get camera transform matrix (view matrix)",
-      returnType = "Matrix",
+      name = "LoadAnimImage",
+      description = "Load animated image from file (GIF, APNG), frames decoded on demand",
+      returnType = "AnimImage",
       params = {
-        {type = "Camera", name = "camera"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GetCameraMatrix2D",
-      description = "Get camera 2d transform matrix",
-      returnType = "Matrix",
+      name = "IsAnimImageReady",
+      description = "Check if an animated image is ready",
+      returnType = "bool",
       params = {
-        {type = "Camera2D", name = "camera"}
+        {type = "AnimImage", name = "anim"}
       }
     },
     {
-      name = "GetWorldToScreen",
-      description = "Get the screen space position for a 3d world space position",
-      returnType = "Vector2",
+      name = "UnloadAnimImage",
+      description = "Unload animated image frames decoder and current frame image",
+      returnType = "void",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "Camera", name = "camera"}
+        {type = "AnimImage", name = "anim"}
       }
     },
     {
-      name = "GetScreenToWorld2D",
-      description = "Get the world space position for a 2d camera screen space position",
-      returnType = "Vector2",
+      name = "AnimImageNextFrame",
+      description = "Decode next animated image frame into anim.image (loops to first frame)",
+      returnType = "bool",
       params = {
-        {type = "Vector2", name = "position"},
-        {type = "Camera2D", name = "camera"}
+        {type = "AnimImage *", name = "anim"}
       }
     },
     {
-      name = "GetWorldToScreenEx",
-      description = "Get size position for a 3d world space position",
-      returnType = "Vector2",
+      name = "AnimImageSeek",
+      description = "Decode animated image frame into anim.image",
+      returnType = "bool",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "Camera", name = "camera"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"}
+        {type = "AnimImage *", name = "anim"},
+        {type = "int", name = "frame"}
       }
     },
     {
-      name = "GetWorldToScreen2D",
-      description = "Get the screen space position for a 2d camera world space position",
-      returnType = "Vector2",
+      name = "GetAnimImageFrameDelay",
+      description = "Get animated image frame delay (milliseconds)",
+      returnType = "int",
       params = {
-        {type = "Vector2", name = "position"},
-        {type = "Camera2D", name = "camera"}
+        {type = "AnimImage", name = "anim"},
+        {type = "int", name = "frame"}
       }
     },
     {
-      name = "SetTargetFPS",
-      description = "Set target FPS (maximum)",
+      name = "SetAnimImagePrefetch",
+      description = "Set animated image next frame decoding on async loader thread",
       returnType = "void",
       params = {
-        {type = "int", name = "fps"}
+        {type = "AnimImage", name = "anim"},
+        {type = "bool", name = "enabled"}
       }
     },
     {
-      name = "GetFPS",
-      description = "Get current FPS",
-      returnType = "int"
-    },
-    {
-      name = "GetFrameTime",
-      description = "Get time in seconds for last frame drawn (delta time)",
-      returnType = "float"
-    },
-    {
-      name = "GetTime",
-      description = "Get elapsed time in seconds since InitWindow()",
-      returnType = "double"
+      name = "LoadTiledImageRaw",
+      description = "Load tiled image from RAW file data, tiles read from file on demand",
+      returnType = "TiledImage",
+      params = {
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "format"},
+        {type = "int", name = "headerSize"},
+        {type = "int", name = "tileSize"}
+      }
     },
     {
-      name = "GetRandomValue",
-      description = "Get a random value between min and max (both included)",
-      returnType = "int",
+      name = "LoadTiledImageCallback",
+      description = "Load tiled image with tiles loaded by callback on demand (generators)",
+      returnType = "TiledImage",
       params = {
-        {type = "int", name = "min"},
-        {type = "int", name = "max"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "format"},
+        {type = "int", name = "tileSize"},
+        {type = "TiledImageCallback", name = "callback"},
+        {type = "void *", name = "userData"}
       }
     },
     {
-      name = "SetRandomSeed",
-      description = "Set the seed for the random number generator",
-      returnType = "void",
+      name = "LoadTiledImageView",
+      description = "Load tiled image region view, no pixels copied (tiles cache shared)",
+      returnType = "TiledImage",
       params = {
-        {type = "unsigned int", name = "seed"}
+        {type = "TiledImage", name = "image"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "TakeScreenshot",
-      description = "Takes a screenshot of current screen (filename extension defines format)",
-      returnType = "void",
+      name = "IsTiledImageReady",
+      description = "Check if a tiled image is ready",
+      returnType = "bool",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "TiledImage", name = "image"}
       }
     },
     {
-      name = "SetConfigFlags",
-      description = "Setup init configuration flags (view FLAGS)",
+      name = "UnloadTiledImage",
+      description = "Unload tiled image (tiles cache unloaded with last view)",
       returnType = "void",
       params = {
-        {type = "unsigned int", name = "flags"}
+        {type = "TiledImage", name = "image"}
       }
     },
     {
-      name = "TraceLog",
-      description = "Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)",
+      name = "SetTiledImageBudget",
+      description = "Set tiled image tiles cache memory budget (bytes), least recently used tiles unloaded",
       returnType = "void",
       params = {
-        {type = "int", name = "logLevel"},
-        {type = "const char *", name = "text"},
-        {type = "...", name = "args"}
+        {type = "TiledImage", name = "image"},
+        {type = "unsigned int", name = "bytes"}
       }
     },
     {
-      name = "SetTraceLogLevel",
-      description = "Set the current threshold (minimum) log level",
-      returnType = "void",
+      name = "GetTiledImageColor",
+      description = "Get tiled image pixel color at (x, y)",
+      returnType = "Color",
       params = {
-        {type = "int", name = "logLevel"}
+        {type = "TiledImage", name = "image"},
+        {type = "int", name = "x"},
+        {type = "int", name = "y"}
       }
     },
     {
-      name = "MemAlloc",
-      description = "Internal memory allocator",
-      returnType = "void *",
+      name = "ImageFromTiledImage",
+      description = "Create an image from tiled image piece, copied tile by tile",
+      returnType = "Image",
       params = {
-        {type = "unsigned int", name = "size"}
+        {type = "TiledImage", name = "image"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "MemRealloc",
-      description = "Internal memory reallocator",
-      returnType = "void *",
+      name = "ImageFromTiledImageScaled",
+      description = "Create an image from tiled image piece scaled to new size (box filter), streamed by rows (RGBA)",
+      returnType = "Image",
       params = {
-        {type = "void *", name = "ptr"},
-        {type = "unsigned int", name = "size"}
+        {type = "TiledImage", name = "image"},
+        {type = "Rectangle", name = "rec"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"}
       }
     },
     {
-      name = "MemFree",
-      description = "Internal memory free",
+      name = "ImageDrawTiledImage",
+      description = "Draw a source tiled image piece within a destination image, streamed tile by tile",
       returnType = "void",
       params = {
-        {type = "void *", name = "ptr"}
+        {type = "Image *", name = "dst"},
+        {type = "TiledImage", name = "src"},
+        {type = "Rectangle", name = "srcRec"},
+        {type = "Rectangle", name = "dstRec"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "OpenURL",
-      description = "Open URL with default system browser (if available)",
-      returnType = "void",
+      name = "ExportImage",
+      description = "Export image data to file, returns true on success",
+      returnType = "bool",
       params = {
-        {type = "const char *", name = "url"}
+        {type = "Image", name = "image"},
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "SetTraceLogCallback",
-      description = "Set custom trace log",
-      returnType = "void",
+      name = "ExportImageAsCode",
+      description = "Export image as code file defining an array of bytes, returns true on success",
+      returnType = "bool",
       params = {
-        {type = "TraceLogCallback", name = "callback"}
+        {type = "Image", name = "image"},
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "SetLoadFileDataCallback",
-      description = "Set custom file binary data loader",
-      returnType = "void",
+      name = "GenImageColor",
+      description = "Generate image: plain color",
+      returnType = "Image",
       params = {
-        {type = "LoadFileDataCallback", name = "callback"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetSaveFileDataCallback",
-      description = "Set custom file binary data saver",
-      returnType = "void",
+      name = "GenImageGradientV",
+      description = "Generate image: vertical gradient",
+      returnType = "Image",
       params = {
-        {type = "SaveFileDataCallback", name = "callback"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "top"},
+        {type = "Color", name = "bottom"}
       }
     },
     {
-      name = "SetLoadFileTextCallback",
-      description = "Set custom file text data loader",
-      returnType = "void",
+      name = "GenImageGradientH",
+      description = "Generate image: horizontal gradient",
+      returnType = "Image",
       params = {
-        {type = "LoadFileTextCallback", name = "callback"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "left"},
+        {type = "Color", name = "right"}
       }
     },
     {
-      name = "SetSaveFileTextCallback",
-      description = "Set custom file text data saver",
-      returnType = "void",
+      name = "GenImageGradientRadial",
+      description = "Generate image: radial gradient",
+      returnType = "Image",
       params = {
-        {type = "SaveFileTextCallback", name = "callback"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "float", name = "density"},
+        {type = "Color", name = "inner"},
+        {type = "Color", name = "outer"}
       }
     },
     {
-      name = "LoadFileData",
-      description = "Load file data as byte array (read)",
-      returnType = "unsigned char *",
+      name = "GenImageChecked",
+      description = "Generate image: checked",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "unsigned int *", name = "bytesRead"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "checksX"},
+        {type = "int", name = "checksY"},
+        {type = "Color", name = "col1"},
+        {type = "Color", name = "col2"}
       }
     },
     {
-      name = "UnloadFileData",
-      description = "Unload file data allocated by LoadFileData()",
-      returnType = "void",
+      name = "GenImageWhiteNoise",
+      description = "Generate image: white noise",
+      returnType = "Image",
       params = {
-        {type = "unsigned char *", name = "data"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "float", name = "factor"}
       }
     },
     {
-      name = "SaveFileData",
-      description = "Save data to file from byte array (write), returns true on success",
-      returnType = "bool",
+      name = "GenImagePerlinNoise",
+      description = "Generate image: perlin noise",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "void *", name = "data"},
-        {type = "unsigned int", name = "bytesToWrite"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "offsetX"},
+        {type = "int", name = "offsetY"},
+        {type = "float", name = "scale"}
       }
     },
     {
-      name = "ExportDataAsCode",
-      description = "Export data to code (.h), returns true on success",
-      returnType = "bool",
+      name = "GenImageCellular",
+      description = "Generate image: cellular algorithm, bigger tileSize means bigger cells",
+      returnType = "Image",
       params = {
-        {type = "const unsigned char *", name = "data"},
-        {type = "unsigned int", name = "size"},
-        {type = "const char *", name = "fileName"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "tileSize"}
       }
     },
     {
-      name = "LoadFileText",
-      description = "Load text data from file (read), returns a '\\0' terminated string",
-      returnType = "char *",
+      name = "GenImageText",
+      description = "Generate image: grayscale image from text data",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "UnloadFileText",
-      description = "Unload file text data allocated by LoadFileText()",
-      returnType = "void",
+      name = "GenImageGradientRadialRec",
+      description = "Generate image: radial gradient, rectangle of width*height gradient",
+      returnType = "Image",
       params = {
-        {type = "char *", name = "text"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "float", name = "density"},
+        {type = "Color", name = "inner"},
+        {type = "Color", name = "outer"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "SaveFileText",
-      description = "Save text data to file (write), string must be '\\0' terminated, returns true on success",
-      returnType = "bool",
+      name = "GenImagePerlinNoiseRec",
+      description = "Generate image: perlin noise, rectangle of width*height noise (can exceed it)",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "char *", name = "text"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "offsetX"},
+        {type = "int", name = "offsetY"},
+        {type = "float", name = "scale"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "FileExists",
-      description = "Check if file exists",
-      returnType = "bool",
+      name = "GenImageCellularRec",
+      description = "Generate image: infinite cellular pattern rectangle, cells seeds hashed from tiles position",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "int", name = "tileSize"},
+        {type = "unsigned int", name = "seed"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "DirectoryExists",
-      description = "Check if a directory path exists",
-      returnType = "bool",
+      name = "GenImageWhiteNoiseRec",
+      description = "Generate image: infinite white noise rectangle, pixels hashed from position",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "dirPath"}
+        {type = "float", name = "factor"},
+        {type = "unsigned int", name = "seed"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "IsFileExtension",
-      description = "Check file extension (including point: .png, .wav)",
-      returnType = "bool",
+      name = "ImageCopy",
+      description = "Create an image duplicate (useful for transformations)",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "const char *", name = "ext"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "GetFileLength",
-      description = "Get file length in bytes (NOTE: GetFileSize() conflicts with windows.h)",
-      returnType = "int",
+      name = "ImageFromImage",
+      description = "Create an image from another image piece",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "Image", name = "image"},
+        {type = "Rectangle", name = "rec"}
       }
     },
     {
-      name = "GetFileExtension",
-      description = "Get pointer to extension for a filename string (includes dot: '.png')",
-      returnType = "const char *",
+      name = "ImageText",
+      description = "Create an image from text (default font)",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "const char *", name = "text"},
+        {type = "int", name = "fontSize"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetFileName",
-      description = "Get pointer to filename for a path string",
-      returnType = "const char *",
+      name = "ImageTextEx",
+      description = "Create an image from text (custom sprite font)",
+      returnType = "Image",
       params = {
-        {type = "const char *", name = "filePath"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GetFileNameWithoutExt",
-      description = "Get filename string without extension (uses static string)",
-      returnType = "const char *",
+      name = "ImageFormat",
+      description = "Convert image data to desired format",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "filePath"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "newFormat"}
       }
     },
     {
-      name = "GetDirectoryPath",
-      description = "Get full path for a given fileName with path (uses static string)",
-      returnType = "const char *",
+      name = "ImageCompress",
+      description = "Compress image data to GPU compressed format (DXT, ETC1, ETC2), quality [0..100]",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "filePath"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "compressedFormat"},
+        {type = "int", name = "quality"}
       }
     },
     {
-      name = "GetPrevDirectoryPath",
-      description = "Get previous directory path for a given path (uses static string)",
-      returnType = "const char *",
+      name = "ImageToPOT",
+      description = "Convert image to POT (power-of-two)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "dirPath"}
+        {type = "Image *", name = "image"},
+        {type = "Color", name = "fill"}
       }
     },
     {
-      name = "GetWorkingDirectory",
-      description = "Get current working directory (uses static string)",
-      returnType = "const char *"
-    },
-    {
-      name = "GetApplicationDirectory",
-      description = "Get the directory if the running application (uses static string)",
-      returnType = "const char *"
-    },
-    {
-      name = "ChangeDirectory",
-      description = "Change working directory, return true on success",
-      returnType = "bool",
+      name = "ImageCrop",
+      description = "Crop an image to a defined rectangle",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "dir"}
+        {type = "Image *", name = "image"},
+        {type = "Rectangle", name = "crop"}
       }
     },
     {
-      name = "IsPathFile",
-      description = "Check if a given path is a file or a directory",
-      returnType = "bool",
+      name = "ImageAlphaCrop",
+      description = "Crop image depending on alpha value",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "path"}
+        {type = "Image *", name = "image"},
+        {type = "float", name = "threshold"}
       }
     },
     {
-      name = "LoadDirectoryFiles",
-      description = "Load directory filepaths",
-      returnType = "FilePathList",
+      name = "ImageAlphaClear",
+      description = "Clear alpha channel to desired color",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "dirPath"}
+        {type = "Image *", name = "image"},
+        {type = "Color", name = "color"},
+        {type = "float", name = "threshold"}
       }
     },
     {
-      name = "LoadDirectoryFilesEx",
-      description = "Load directory filepaths with extension filtering and recursive directory scan",
-      returnType = "FilePathList",
+      name = "ImageAlphaMask",
+      description = "Apply alpha mask to image",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "basePath"},
-        {type = "const char *", name = "filter"},
-        {type = "bool", name = "scanSubdirs"}
+        {type = "Image *", name = "image"},
+        {type = "Image", name = "alphaMask"}
       }
     },
     {
-      name = "UnloadDirectoryFiles",
-      description = "Unload filepaths",
+      name = "ImageAlphaPremultiply",
+      description = "Premultiply alpha channel",
       returnType = "void",
       params = {
-        {type = "FilePathList", name = "files"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "IsFileDropped",
-      description = "Check if a file has been dropped into window",
-      returnType = "bool"
-    },
-    {
-      name = "LoadDroppedFiles",
-      description = "Load dropped filepaths",
-      returnType = "FilePathList"
-    },
-    {
-      name = "UnloadDroppedFiles",
-      description = "Unload dropped filepaths",
+      name = "ImageBlurGaussian",
+      description = "Apply Gaussian blur using a box blur approximation",
       returnType = "void",
       params = {
-        {type = "FilePathList", name = "files"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "blurSize"}
       }
     },
     {
-      name = "GetFileModTime",
-      description = "Get file modification time (last write time)",
-      returnType = "long",
+      name = "ImageResize",
+      description = "Resize image (Bicubic scaling algorithm)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"}
       }
     },
     {
-      name = "CompressData",
-      description = "Compress data (DEFLATE algorithm), memory must be MemFree()",
-      returnType = "unsigned char *",
+      name = "ImageResizeNN",
+      description = "Resize image (Nearest-Neighbor scaling algorithm)",
+      returnType = "void",
       params = {
-        {type = "const unsigned char *", name = "data"},
-        {type = "int", name = "dataSize"},
-        {type = "int *", name = "compDataSize"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"}
       }
     },
     {
-      name = "DecompressData",
-      description = "Decompress data (DEFLATE algorithm), memory must be MemFree()",
-      returnType = "unsigned char *",
+      name = "ImageResizeEx",
+      description = "Resize image (Bicubic scaling algorithm) with resize context (scratch buffers reuse, sRGB filtering)",
+      returnType = "void",
       params = {
-        {type = "const unsigned char *", name = "compData"},
-        {type = "int", name = "compDataSize"},
-        {type = "int *", name = "dataSize"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"},
+        {type = "ImageResizeContext *", name = "context"}
       }
     },
     {
-      name = "EncodeDataBase64",
-      description = "Encode data to Base64 string, memory must be MemFree()",
-      returnType = "char *",
+      name = "LoadImageResizeContext",
+      description = "Load image resize context, scratch buffers are kept between resizes",
+      returnType = "ImageResizeContext",
       params = {
-        {type = "const unsigned char *", name = "data"},
-        {type = "int", name = "dataSize"},
-        {type = "int *", name = "outputSize"}
+        {type = "bool", name = "srgb"}
       }
     },
     {
-      name = "DecodeDataBase64",
-      description = "Decode Base64 string data, memory must be MemFree()",
-      returnType = "unsigned char *",
+      name = "UnloadImageResizeContext",
+      description = "Unload image resize context scratch buffers",
+      returnType = "void",
       params = {
-        {type = "const unsigned char *", name = "data"},
-        {type = "int *", name = "outputSize"}
+        {type = "ImageResizeContext", name = "context"}
       }
     },
     {
-      name = "IsKeyPressed",
-      description = "Check if a key has been pressed once",
-      returnType = "bool",
+      name = "ImageResizeCanvas",
+      description = "Resize canvas and fill with color",
+      returnType = "void",
       params = {
-        {type = "int", name = "key"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"},
+        {type = "int", name = "offsetX"},
+        {type = "int", name = "offsetY"},
+        {type = "Color", name = "fill"}
       }
     },
     {
-      name = "IsKeyDown",
-      description = "Check if a key is being pressed",
-      returnType = "bool",
+      name = "ImageMipmaps",
+      description = "Compute all mipmap levels for a provided image",
+      returnType = "void",
       params = {
-        {type = "int", name = "key"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "IsKeyReleased",
-      description = "Check if a key has been released once",
-      returnType = "bool",
+      name = "ImageMipmapsEx",
+      description = "Compute all mipmap levels for a provided image, gamma-correct and alpha weighted filtering options",
+      returnType = "void",
       params = {
-        {type = "int", name = "key"}
+        {type = "Image *", name = "image"},
+        {type = "bool", name = "srgb"},
+        {type = "bool", name = "premultipliedAlpha"}
       }
     },
     {
-      name = "IsKeyUp",
-      description = "Check if a key is NOT being pressed",
-      returnType = "bool",
+      name = "ImageDither",
+      description = "Dither image data to 16bpp or lower (Floyd-Steinberg dithering)",
+      returnType = "void",
       params = {
-        {type = "int", name = "key"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "rBpp"},
+        {type = "int", name = "gBpp"},
+        {type = "int", name = "bBpp"},
+        {type = "int", name = "aBpp"}
       }
     },
     {
-      name = "SetExitKey",
-      description = "Set a custom key to exit program (default is ESC)",
+      name = "ImageQuantize",
+      description = "Quantize image colors to palette size (median cut, up to 256 colors), Floyd-Steinberg dithering optional",
       returnType = "void",
       params = {
-        {type = "int", name = "key"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "paletteSize"},
+        {type = "bool", name = "dither"}
       }
     },
     {
-      name = "GetKeyPressed",
-      description = "Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty",
-      returnType = "int"
-    },
-    {
-      name = "GetCharPressed",
-      description = "Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty",
-      returnType = "int"
+      name = "ImageFlipVertical",
+      description = "Flip image vertically",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "image"}
+      }
     },
     {
-      name = "IsGamepadAvailable",
-      description = "Check if a gamepad is available",
-      returnType = "bool",
+      name = "ImageFlipHorizontal",
+      description = "Flip image horizontally",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "GetGamepadName",
-      description = "Get gamepad internal name id",
-      returnType = "const char *",
+      name = "ImageRotateCW",
+      description = "Rotate image clockwise 90deg",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "IsGamepadButtonPressed",
-      description = "Check if a gamepad button has been pressed once",
-      returnType = "bool",
+      name = "ImageRotateCCW",
+      description = "Rotate image counter-clockwise 90deg",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"},
-        {type = "int", name = "button"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "IsGamepadButtonDown",
-      description = "Check if a gamepad button is being pressed",
-      returnType = "bool",
+      name = "ImageColorTint",
+      description = "Modify image color: tint",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"},
-        {type = "int", name = "button"}
+        {type = "Image *", name = "image"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "IsGamepadButtonReleased",
-      description = "Check if a gamepad button has been released once",
-      returnType = "bool",
+      name = "ImageColorInvert",
+      description = "Modify image color: invert",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"},
-        {type = "int", name = "button"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "IsGamepadButtonUp",
-      description = "Check if a gamepad button is NOT being pressed",
-      returnType = "bool",
+      name = "ImageColorGrayscale",
+      description = "Modify image color: grayscale",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"},
-        {type = "int", name = "button"}
+        {type = "Image *", name = "image"}
       }
     },
     {
-      name = "GetGamepadButtonPressed",
-      description = "Get the last gamepad button pressed",
-      returnType = "int"
+      name = "ImageColorContrast",
+      description = "Modify image color: contrast (-100 to 100)",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "image"},
+        {type = "float", name = "contrast"}
+      }
     },
     {
-      name = "GetGamepadAxisCount",
-      description = "Get gamepad axis count for a gamepad",
-      returnType = "int",
+      name = "ImageColorBrightness",
+      description = "Modify image color: brightness (-255 to 255)",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"}
+        {type = "Image *", name = "image"},
+        {type = "int", name = "brightness"}
       }
     },
     {
-      name = "GetGamepadAxisMovement",
-      description = "Get axis movement value for a gamepad axis",
-      returnType = "float",
+      name = "ImageColorReplace",
+      description = "Modify image color: replace color",
+      returnType = "void",
       params = {
-        {type = "int", name = "gamepad"},
-        {type = "int", name = "axis"}
+        {type = "Image *", name = "image"},
+        {type = "Color", name = "color"},
+        {type = "Color", name = "replace"}
       }
     },
     {
-      name = "SetGamepadMappings",
-      description = "Set internal gamepad mappings (SDL_GameControllerDB)",
-      returnType = "int",
+      name = "ImageProcess",
+      description = "Apply color operations sequence to image in one pass (in place for RGBA8)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "mappings"}
+        {type = "Image *", name = "image"},
+        {type = "const ImageProcessOp *", name = "ops"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "IsMouseButtonPressed",
-      description = "Check if a mouse button has been pressed once",
-      returnType = "bool",
+      name = "LoadImageColors",
+      description = "Load color data from image as a Color array (RGBA - 32bit)",
+      returnType = "Color *",
       params = {
-        {type = "int", name = "button"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "IsMouseButtonDown",
-      description = "Check if a mouse button is being pressed",
-      returnType = "bool",
+      name = "LoadImagePalette",
+      description = "Load colors palette from image as a Color array (RGBA - 32bit)",
+      returnType = "Color *",
       params = {
-        {type = "int", name = "button"}
+        {type = "Image", name = "image"},
+        {type = "int", name = "maxPaletteSize"},
+        {type = "int *", name = "colorCount"}
       }
     },
     {
-      name = "IsMouseButtonReleased",
-      description = "Check if a mouse button has been released once",
-      returnType = "bool",
+      name = "UnloadImageColors",
+      description = "Unload color data loaded with LoadImageColors()",
+      returnType = "void",
       params = {
-        {type = "int", name = "button"}
+        {type = "Color *", name = "colors"}
       }
     },
     {
-      name = "IsMouseButtonUp",
-      description = "Check if a mouse button is NOT being pressed",
-      returnType = "bool",
+      name = "UnloadImagePalette",
+      description = "Unload colors palette loaded with LoadImagePalette()",
+      returnType = "void",
       params = {
-        {type = "int", name = "button"}
+        {type = "Color *", name = "colors"}
       }
     },
     {
-      name = "GetMouseX",
-      description = "Get mouse position X",
-      returnType = "int"
+      name = "GetImageAlphaBorder",
+      description = "Get image alpha border rectangle",
+      returnType = "Rectangle",
+      params = {
+        {type = "Image", name = "image"},
+        {type = "float", name = "threshold"}
+      }
     },
     {
-      name = "GetMouseY",
-      description = "Get mouse position Y",
-      returnType = "int"
+      name = "GetImageColor",
+      description = "Get image pixel color at (x, y) position",
+      returnType = "Color",
+      params = {
+        {type = "Image", name = "image"},
+        {type = "int", name = "x"},
+        {type = "int", name = "y"}
+      }
     },
     {
-      name = "GetMousePosition",
-      description = "Get mouse position XY",
-      returnType = "Vector2"
+      name = "ImageClearBackground",
+      description = "Clear image background with given color",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "dst"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "GetMouseDelta",
-      description = "Get mouse delta between frames",
-      returnType = "Vector2"
+      name = "ImageDrawPixel",
+      description = "Draw pixel within an image",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "dst"},
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "SetMousePosition",
-      description = "Set mouse position XY",
+      name = "ImageDrawPixelV",
+      description = "Draw pixel within an image (Vector version)",
       returnType = "void",
       params = {
-        {type = "int", name = "x"},
-        {type = "int", name = "y"}
+        {type = "Image *", name = "dst"},
+        {type = "Vector2", name = "position"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetMouseOffset",
-      description = "Set mouse offset",
+      name = "ImageDrawLine",
+      description = "Draw line within an image",
       returnType = "void",
       params = {
-        {type = "int", name = "offsetX"},
-        {type = "int", name = "offsetY"}
+        {type = "Image *", name = "dst"},
+        {type = "int", name = "startPosX"},
+        {type = "int", name = "startPosY"},
+        {type = "int", name = "endPosX"},
+        {type = "int", name = "endPosY"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetMouseScale",
-      description = "Set mouse scaling",
+      name = "ImageDrawLineV",
+      description = "Draw line within an image (Vector version)",
       returnType = "void",
       params = {
-        {type = "float", name = "scaleX"},
-        {type = "float", name = "scaleY"}
+        {type = "Image *", name = "dst"},
+        {type = "Vector2", name = "start"},
+        {type = "Vector2", name = "end"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetMouseWheelMove",
-      description = "Get mouse wheel movement for X or Y, whichever is larger",
-      returnType = "float"
-    },
-    {
-      name = "GetMouseWheelMoveV",
-      description = "Get mouse wheel movement for both X and Y",
-      returnType = "Vector2"
-    },
-    {
-      name = "SetMouseCursor",
-      description = "Set mouse cursor",
+      name = "ImageDrawCircle",
+      description = "Draw a filled circle within an image",
       returnType = "void",
       params = {
-        {type = "int", name = "cursor"}
+        {type = "Image *", name = "dst"},
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "int", name = "radius"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetTouchX",
-      description = "Get touch position X for touch point 0 (relative to screen size)",
-      returnType = "int"
-    },
-    {
-      name = "GetTouchY",
-      description = "Get touch position Y for touch point 0 (relative to screen size)",
-      returnType = "int"
-    },
-    {
-      name = "GetTouchPosition",
-      description = "Get touch position XY for a touch point index (relative to screen size)",
-      returnType = "Vector2",
+      name = "ImageDrawCircleV",
+      description = "Draw a filled circle within an image (Vector version)",
+      returnType = "void",
       params = {
-        {type = "int", name = "index"}
+        {type = "Image *", name = "dst"},
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "radius"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetTouchPointId",
-      description = "Get touch point identifier for given index",
-      returnType = "int",
+      name = "ImageDrawCircleLines",
+      description = "Draw circle outline within an image",
+      returnType = "void",
       params = {
-        {type = "int", name = "index"}
+        {type = "Image *", name = "dst"},
+        {type = "int", name = "centerX"},
+        {type = "int", name = "centerY"},
+        {type = "int", name = "radius"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetTouchPointCount",
-      description = "Get number of touch points",
-      returnType = "int"
-    },
-    {
-      name = "SetGesturesEnabled",
-      description = "Enable a set of gestures using flags",
+      name = "ImageDrawCircleLinesV",
+      description = "Draw circle outline within an image (Vector version)",
       returnType = "void",
       params = {
-        {type = "unsigned int", name = "flags"}
+        {type = "Image *", name = "dst"},
+        {type = "Vector2", name = "center"},
+        {type = "int", name = "radius"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "IsGestureDetected",
-      description = "Check if a gesture have been detected",
-      returnType = "bool",
+      name = "ImageDrawRectangle",
+      description = "Draw rectangle within an image",
+      returnType = "void",
       params = {
-        {type = "int", name = "gesture"}
+        {type = "Image *", name = "dst"},
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetGestureDetected",
-      description = "Get latest detected gesture",
-      returnType = "int"
-    },
-    {
-      name = "GetGestureHoldDuration",
-      description = "Get gesture hold time in milliseconds",
-      returnType = "float"
-    },
-    {
-      name = "GetGestureDragVector",
-      description = "Get gesture drag vector",
-      returnType = "Vector2"
-    },
-    {
-      name = "GetGestureDragAngle",
-      description = "Get gesture drag angle",
-      returnType = "float"
-    },
-    {
-      name = "GetGesturePinchVector",
-      description = "Get gesture pinch delta",
-      returnType = "Vector2"
-    },
-    {
-      name = "GetGesturePinchAngle",
-      description = "Get gesture pinch angle",
-      returnType = "float"
+      name = "ImageDrawRectangleV",
+      description = "Draw rectangle within an image (Vector version)",
+      returnType = "void",
+      params = {
+        {type = "Image *", name = "dst"},
+        {type = "Vector2", name = "position"},
+        {type = "Vector2", name = "size"},
+        {type = "Color", name = "color"}
+      }
     },
     {
-      name = "UpdateCamera",
-      description = "Update camera position for selected mode",
+      name = "ImageDrawRectangleRec",
+      description = "Draw rectangle within an image",
       returnType = "void",
       params = {
-        {type = "Camera *", name = "camera"},
-        {type = "int", name = "mode"}
+        {type = "Image *", name = "dst"},
+        {type = "Rectangle", name = "rec"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "UpdateCameraPro",
-      description = "Update camera movement/rotation",
+      name = "ImageDrawRectangleLines",
+      description = "Draw rectangle lines within an image",
       returnType = "void",
       params = {
-        {type = "Camera *", name = "camera"},
-        {type = "Vector3", name = "movement"},
-        {type = "Vector3", name = "rotation"},
-        {type = "float", name = "zoom"}
+        {type = "Image *", name = "dst"},
+        {type = "Rectangle", name = "rec"},
+        {type = "int", name = "thick"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetShapesTexture",
-      description = "Set texture and rectangle to be used on shapes drawing",
+      name = "ImageDraw",
+      description = "Draw a source image within a destination image (tint applied to source)",
       returnType = "void",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "source"}
+        {type = "Image *", name = "dst"},
+        {type = "Image", name = "src"},
+        {type = "Rectangle", name = "srcRec"},
+        {type = "Rectangle", name = "dstRec"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "DrawPixel",
-      description = "Draw a pixel",
+      name = "ImageDrawText",
+      description = "Draw text (using default font) within an image (destination)",
       returnType = "void",
       params = {
+        {type = "Image *", name = "dst"},
+        {type = "const char *", name = "text"},
         {type = "int", name = "posX"},
         {type = "int", name = "posY"},
+        {type = "int", name = "fontSize"},
         {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawPixelV",
-      description = "Draw a pixel (Vector version)",
+      name = "ImageDrawTextEx",
+      description = "Draw text (custom sprite font) within an image (destination)",
       returnType = "void",
       params = {
+        {type = "Image *", name = "dst"},
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
         {type = "Vector2", name = "position"},
-        {type = "Color", name = "color"}
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "DrawLine",
-      description = "Draw a line",
-      returnType = "void",
+      name = "LoadTexture",
+      description = "Load texture from file into GPU memory (VRAM)",
+      returnType = "Texture2D",
       params = {
-        {type = "int", name = "startPosX"},
-        {type = "int", name = "startPosY"},
-        {type = "int", name = "endPosX"},
-        {type = "int", name = "endPosY"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "DrawLineV",
-      description = "Draw a line (Vector version)",
-      returnType = "void",
+      name = "LoadTextureAsync",
+      description = "Load texture from file asynchronously, returns request id (-1: failed)",
+      returnType = "int",
       params = {
-        {type = "Vector2", name = "startPos"},
-        {type = "Vector2", name = "endPos"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "DrawLineEx",
-      description = "Draw a line defining thickness",
-      returnType = "void",
+      name = "GetTextureAsync",
+      description = "Get async loaded texture, request is released (empty if not ready)",
+      returnType = "Texture2D",
       params = {
-        {type = "Vector2", name = "startPos"},
-        {type = "Vector2", name = "endPos"},
-        {type = "float", name = "thick"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "request"}
       }
     },
     {
-      name = "DrawLineBezier",
-      description = "Draw a line using cubic-bezier curves in-out",
-      returnType = "void",
+      name = "LoadTextureStreamed",
+      description = "Load texture from file with mipmaps streaming (only low resolution mipmaps resident)",
+      returnType = "Texture2D",
       params = {
-        {type = "Vector2", name = "startPos"},
-        {type = "Vector2", name = "endPos"},
-        {type = "float", name = "thick"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "DrawLineBezierQuad",
-      description = "Draw line using quadratic bezier curves with a control point",
+      name = "RequestTextureStreaming",
+      description = "Request streamed texture mipmaps for a drawn size (in pixels)",
       returnType = "void",
       params = {
-        {type = "Vector2", name = "startPos"},
-        {type = "Vector2", name = "endPos"},
-        {type = "Vector2", name = "controlPos"},
-        {type = "float", name = "thick"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "texture"},
+        {type = "float", name = "screenSize"}
       }
     },
     {
-      name = "DrawLineBezierCubic",
-      description = "Draw line using cubic bezier curves with 2 control points",
+      name = "SetTextureStreamingBudget",
+      description = "Set streamed textures GPU memory budget (bytes)",
       returnType = "void",
       params = {
-        {type = "Vector2", name = "startPos"},
-        {type = "Vector2", name = "endPos"},
-        {type = "Vector2", name = "startControlPos"},
-        {type = "Vector2", name = "endControlPos"},
-        {type = "float", name = "thick"},
-        {type = "Color", name = "color"}
+        {type = "unsigned int", name = "bytes"}
       }
     },
     {
-      name = "DrawLineStrip",
-      description = "Draw lines sequence",
-      returnType = "void",
+      name = "GetTextureStreamingMemory",
+      description = "Get streamed textures resident GPU memory (bytes)",
+      returnType = "unsigned int"
+    },
+    {
+      name = "LoadVideoTexture",
+      description = "Load video texture from file (.y4m), frames decoded ahead on async loader thread",
+      returnType = "VideoTexture",
       params = {
-        {type = "Vector2 *", name = "points"},
-        {type = "int", name = "pointCount"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "DrawCircle",
-      description = "Draw a color-filled circle",
-      returnType = "void",
+      name = "IsVideoTextureReady",
+      description = "Check if a video texture is ready",
+      returnType = "bool",
       params = {
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "float", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "VideoTexture", name = "video"}
       }
     },
     {
-      name = "DrawCircleSector",
-      description = "Draw a piece of a circle",
+      name = "UnloadVideoTexture",
+      description = "Unload video texture decoder and textures",
       returnType = "void",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "radius"},
-        {type = "float", name = "startAngle"},
-        {type = "float", name = "endAngle"},
-        {type = "int", name = "segments"},
-        {type = "Color", name = "color"}
+        {type = "VideoTexture", name = "video"}
       }
     },
     {
-      name = "DrawCircleSectorLines",
-      description = "Draw circle sector outline",
-      returnType = "void",
+      name = "UpdateVideoTexture",
+      description = "Update video texture frame for playback time (seconds, i.e. music time played), returns true if frame changed",
+      returnType = "bool",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "radius"},
-        {type = "float", name = "startAngle"},
-        {type = "float", name = "endAngle"},
-        {type = "int", name = "segments"},
-        {type = "Color", name = "color"}
+        {type = "VideoTexture *", name = "video"},
+        {type = "float", name = "time"}
       }
     },
     {
-      name = "DrawCircleGradient",
-      description = "Draw a gradient-filled circle",
-      returnType = "void",
+      name = "LoadTextureFromImage",
+      description = "Load texture from image data",
+      returnType = "Texture2D",
       params = {
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "float", name = "radius"},
-        {type = "Color", name = "color1"},
-        {type = "Color", name = "color2"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "DrawCircleV",
-      description = "Draw a color-filled circle (Vector version)",
-      returnType = "void",
+      name = "LoadTextureCompressed",
+      description = "Load texture from file compressed to best GPU supported format (DXT, ETC2), quality [0..100]",
+      returnType = "Texture2D",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "quality"}
       }
     },
     {
-      name = "DrawCircleLines",
-      description = "Draw circle outline",
-      returnType = "void",
+      name = "LoadTextureCubemap",
+      description = "Load cubemap from image, multiple image cubemap layouts supported",
+      returnType = "TextureCubemap",
       params = {
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "float", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "Image", name = "image"},
+        {type = "int", name = "layout"}
       }
     },
     {
-      name = "DrawEllipse",
-      description = "Draw ellipse",
-      returnType = "void",
+      name = "LoadTextureArray",
+      description = "Load texture array from images (same size), mipmaps generated if first image has mipmaps",
+      returnType = "Texture2DArray",
       params = {
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "float", name = "radiusH"},
-        {type = "float", name = "radiusV"},
-        {type = "Color", name = "color"}
+        {type = "const Image *", name = "layers"},
+        {type = "int", name = "layerCount"}
       }
     },
     {
-      name = "DrawEllipseLines",
-      description = "Draw ellipse outline",
-      returnType = "void",
+      name = "LoadTexture3D",
+      description = "Load 3d texture from images slices (same size)",
+      returnType = "Texture3D",
       params = {
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "float", name = "radiusH"},
-        {type = "float", name = "radiusV"},
-        {type = "Color", name = "color"}
+        {type = "const Image *", name = "slices"},
+        {type = "int", name = "sliceCount"}
       }
     },
     {
-      name = "DrawRing",
-      description = "Draw ring",
-      returnType = "void",
+      name = "LoadRenderTexture",
+      description = "Load texture for rendering (framebuffer)",
+      returnType = "RenderTexture2D",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "innerRadius"},
-        {type = "float", name = "outerRadius"},
-        {type = "float", name = "startAngle"},
-        {type = "float", name = "endAngle"},
-        {type = "int", name = "segments"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"}
       }
     },
     {
-      name = "DrawRingLines",
-      description = "Draw ring outline",
-      returnType = "void",
+      name = "LoadRenderTextureEx",
+      description = "Load texture for rendering (framebuffer) with color format (float formats supported), depth optional",
+      returnType = "RenderTexture2D",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "innerRadius"},
-        {type = "float", name = "outerRadius"},
-        {type = "float", name = "startAngle"},
-        {type = "float", name = "endAngle"},
-        {type = "int", name = "segments"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "format"},
+        {type = "bool", name = "depth"}
       }
     },
     {
-      name = "DrawRectangle",
-      description = "Draw a color-filled rectangle",
-      returnType = "void",
+      name = "LoadRenderTextureMultisample",
+      description = "Load multisample texture for rendering (framebuffer), resolved to texture on EndTextureMode()",
+      returnType = "RenderTexture2D",
       params = {
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
         {type = "int", name = "width"},
         {type = "int", name = "height"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "samples"}
       }
     },
     {
-      name = "DrawRectangleV",
-      description = "Draw a color-filled rectangle (Vector version)",
-      returnType = "void",
+      name = "IsTextureReady",
+      description = "Check if a texture is ready",
+      returnType = "bool",
       params = {
-        {type = "Vector2", name = "position"},
-        {type = "Vector2", name = "size"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "texture"}
       }
     },
     {
-      name = "DrawRectangleRec",
-      description = "Draw a color-filled rectangle",
+      name = "UnloadTexture",
+      description = "Unload texture from GPU memory (VRAM)",
       returnType = "void",
       params = {
-        {type = "Rectangle", name = "rec"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "texture"}
       }
     },
     {
-      name = "DrawRectanglePro",
-      description = "Draw a color-filled rectangle with pro parameters",
-      returnType = "void",
+      name = "IsRenderTextureReady",
+      description = "Check if a render texture is ready",
+      returnType = "bool",
       params = {
-        {type = "Rectangle", name = "rec"},
-        {type = "Vector2", name = "origin"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "color"}
+        {type = "RenderTexture2D", name = "target"}
       }
     },
     {
-      name = "DrawRectangleGradientV",
-      description = "Draw a vertical-gradient-filled rectangle",
+      name = "UnloadRenderTexture",
+      description = "Unload render texture from GPU memory (VRAM)",
       returnType = "void",
       params = {
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "color1"},
-        {type = "Color", name = "color2"}
+        {type = "RenderTexture2D", name = "target"}
       }
     },
     {
-      name = "DrawRectangleGradientH",
-      description = "Draw a horizontal-gradient-filled rectangle",
-      returnType = "void",
+      name = "AcquireRenderTexture",
+      description = "Acquire render texture from pool (released matching targets reused), depth contents transient",
+      returnType = "RenderTexture2D",
       params = {
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
         {type = "int", name = "width"},
         {type = "int", name = "height"},
-        {type = "Color", name = "color1"},
-        {type = "Color", name = "color2"}
+        {type = "int", name = "format"},
+        {type = "bool", name = "depth"}
       }
     },
     {
-      name = "DrawRectangleGradientEx",
-      description = "Draw a gradient-filled rectangle with custom vertex colors",
+      name = "ReleaseRenderTexture",
+      description = "Release render texture to pool, kept for reuse a number of frames",
       returnType = "void",
       params = {
-        {type = "Rectangle", name = "rec"},
-        {type = "Color", name = "col1"},
-        {type = "Color", name = "col2"},
-        {type = "Color", name = "col3"},
-        {type = "Color", name = "col4"}
+        {type = "RenderTexture2D", name = "target"}
       }
     },
     {
-      name = "DrawRectangleLines",
-      description = "Draw rectangle outline",
+      name = "UpdateTexture",
+      description = "Update GPU texture with new data",
       returnType = "void",
       params = {
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "texture"},
+        {type = "const void *", name = "pixels"}
       }
     },
     {
-      name = "DrawRectangleLinesEx",
-      description = "Draw rectangle outline with extended parameters",
+      name = "UpdateTextureRec",
+      description = "Update GPU texture rectangle with new data",
       returnType = "void",
       params = {
+        {type = "Texture2D", name = "texture"},
         {type = "Rectangle", name = "rec"},
-        {type = "float", name = "lineThick"},
-        {type = "Color", name = "color"}
+        {type = "const void *", name = "pixels"}
       }
     },
     {
-      name = "DrawRectangleRounded",
-      description = "Draw rectangle with rounded edges",
+      name = "UpdateTextureArrayLayer",
+      description = "Update GPU texture array layer with new data",
       returnType = "void",
       params = {
-        {type = "Rectangle", name = "rec"},
-        {type = "float", name = "roundness"},
-        {type = "int", name = "segments"},
-        {type = "Color", name = "color"}
+        {type = "Texture2DArray", name = "texture"},
+        {type = "int", name = "layer"},
+        {type = "const void *", name = "pixels"}
       }
     },
     {
-      name = "DrawRectangleRoundedLines",
-      description = "Draw rectangle with rounded edges outline",
+      name = "UpdateTexture3DSlice",
+      description = "Update GPU 3d texture slice with new data",
       returnType = "void",
       params = {
-        {type = "Rectangle", name = "rec"},
-        {type = "float", name = "roundness"},
-        {type = "int", name = "segments"},
-        {type = "float", name = "lineThick"},
-        {type = "Color", name = "color"}
+        {type = "Texture3D", name = "texture"},
+        {type = "int", name = "slice"},
+        {type = "const void *", name = "pixels"}
       }
     },
     {
-      name = "DrawTriangle",
-      description = "Draw a color-filled triangle (vertex in counter-clockwise order!)",
+      name = "UpdateTextureRecAsync",
+      description = "Update GPU texture rectangle with new data through pixel buffer (no render thread stall)",
       returnType = "void",
       params = {
-        {type = "Vector2", name = "v1"},
-        {type = "Vector2", name = "v2"},
-        {type = "Vector2", name = "v3"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "rec"},
+        {type = "const void *", name = "pixels"}
       }
     },
     {
-      name = "DrawTriangleLines",
-      description = "Draw triangle outline (vertex in counter-clockwise order!)",
-      returnType = "void",
+      name = "CopyTextureRegion",
+      description = "Copy texture rectangle into another texture on GPU (no CPU readback)",
+      returnType = "bool",
       params = {
-        {type = "Vector2", name = "v1"},
-        {type = "Vector2", name = "v2"},
-        {type = "Vector2", name = "v3"},
-        {type = "Color", name = "color"}
+        {type = "Texture2D", name = "src"},
+        {type = "Rectangle", name = "srcRec"},
+        {type = "Texture2D", name = "dst"},
+        {type = "Vector2", name = "dstPos"}
       }
     },
     {
-      name = "DrawTriangleFan",
-      description = "Draw a triangle fan defined by points (first vertex is the center)",
-      returnType = "void",
+      name = "LoadAtlasBuilder",
+      description = "Load atlas builder, images packed into texture pages on demand",
+      returnType = "AtlasBuilder *",
       params = {
-        {type = "Vector2 *", name = "points"},
-        {type = "int", name = "pointCount"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "pageWidth"},
+        {type = "int", name = "pageHeight"},
+        {type = "int", name = "padding"}
       }
     },
     {
-      name = "DrawTriangleStrip",
-      description = "Draw a triangle strip defined by points",
+      name = "UnloadAtlasBuilder",
+      description = "Unload atlas builder and pages textures",
       returnType = "void",
       params = {
-        {type = "Vector2 *", name = "points"},
-        {type = "int", name = "pointCount"},
-        {type = "Color", name = "color"}
+        {type = "AtlasBuilder *", name = "atlas"}
       }
     },
     {
-      name = "DrawPoly",
-      description = "Draw a regular polygon (Vector version)",
-      returnType = "void",
+      name = "AddAtlasImage",
+      description = "Pack image into atlas page, image uploaded with padding edges extruded",
+      returnType = "AtlasRegion",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "int", name = "sides"},
-        {type = "float", name = "radius"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "color"}
+        {type = "AtlasBuilder *", name = "atlas"},
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "DrawPolyLines",
-      description = "Draw a polygon outline of n sides",
+      name = "RemoveAtlasImage",
+      description = "Remove image from atlas, region space reused by next images",
       returnType = "void",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "int", name = "sides"},
-        {type = "float", name = "radius"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "color"}
+        {type = "AtlasBuilder *", name = "atlas"},
+        {type = "int", name = "id"}
       }
     },
     {
-      name = "DrawPolyLinesEx",
-      description = "Draw a polygon outline of n sides with extended parameters",
-      returnType = "void",
+      name = "GetAtlasRegion",
+      description = "Get atlas image region (texture and source rectangle)",
+      returnType = "AtlasRegion",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "int", name = "sides"},
-        {type = "float", name = "radius"},
-        {type = "float", name = "rotation"},
-        {type = "float", name = "lineThick"},
-        {type = "Color", name = "color"}
+        {type = "const AtlasBuilder *", name = "atlas"},
+        {type = "int", name = "id"}
+      }
+    },
+    {
+      name = "GetAtlasPageCount",
+      description = "Get atlas pages count",
+      returnType = "int",
+      params = {
+        {type = "const AtlasBuilder *", name = "atlas"}
       }
     },
     {
-      name = "CheckCollisionRecs",
-      description = "Check collision between two rectangles",
-      returnType = "bool",
+      name = "GetAtlasPage",
+      description = "Get atlas page texture",
+      returnType = "Texture2D",
       params = {
-        {type = "Rectangle", name = "rec1"},
-        {type = "Rectangle", name = "rec2"}
+        {type = "const AtlasBuilder *", name = "atlas"},
+        {type = "int", name = "page"}
       }
     },
     {
-      name = "CheckCollisionCircles",
-      description = "Check collision between two circles",
-      returnType = "bool",
+      name = "GenTextureMipmaps",
+      description = "Generate GPU mipmaps for a texture",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "center1"},
-        {type = "float", name = "radius1"},
-        {type = "Vector2", name = "center2"},
-        {type = "float", name = "radius2"}
+        {type = "Texture2D *", name = "texture"}
       }
     },
     {
-      name = "CheckCollisionCircleRec",
-      description = "Check collision between circle and rectangle",
-      returnType = "bool",
+      name = "SetTextureFilter",
+      description = "Set texture scaling filter mode",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "radius"},
-        {type = "Rectangle", name = "rec"}
+        {type = "Texture2D", name = "texture"},
+        {type = "int", name = "filter"}
       }
     },
     {
-      name = "CheckCollisionPointRec",
-      description = "Check if point is inside rectangle",
-      returnType = "bool",
+      name = "SetTextureWrap",
+      description = "Set texture wrapping mode",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "point"},
-        {type = "Rectangle", name = "rec"}
+        {type = "Texture2D", name = "texture"},
+        {type = "int", name = "wrap"}
       }
     },
     {
-      name = "CheckCollisionPointCircle",
-      description = "Check if point is inside circle",
-      returnType = "bool",
+      name = "LoadRenderTextureFromImage",
+      description = "Load render texture from image data (same rows order as image)",
+      returnType = "RenderTexture2D",
       params = {
-        {type = "Vector2", name = "point"},
-        {type = "Vector2", name = "center"},
-        {type = "float", name = "radius"}
+        {type = "Image", name = "image"}
       }
     },
     {
-      name = "CheckCollisionPointTriangle",
-      description = "Check if point is inside a triangle",
-      returnType = "bool",
+      name = "TextureColorTint",
+      description = "Modify render texture color: tint",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "point"},
-        {type = "Vector2", name = "p1"},
-        {type = "Vector2", name = "p2"},
-        {type = "Vector2", name = "p3"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "CheckCollisionPointPoly",
-      description = "Check if point is within a polygon described by array of vertices",
-      returnType = "bool",
+      name = "TextureColorInvert",
+      description = "Modify render texture color: invert",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "point"},
-        {type = "Vector2 *", name = "points"},
-        {type = "int", name = "pointCount"}
+        {type = "RenderTexture2D *", name = "target"}
       }
     },
     {
-      name = "CheckCollisionLines",
-      description = "Check the collision between two lines defined by two points each, returns collision point by reference",
-      returnType = "bool",
+      name = "TextureColorGrayscale",
+      description = "Modify render texture color: grayscale (alpha removed)",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "startPos1"},
-        {type = "Vector2", name = "endPos1"},
-        {type = "Vector2", name = "startPos2"},
-        {type = "Vector2", name = "endPos2"},
-        {type = "Vector2 *", name = "collisionPoint"}
+        {type = "RenderTexture2D *", name = "target"}
       }
     },
     {
-      name = "CheckCollisionPointLine",
-      description = "Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]",
-      returnType = "bool",
+      name = "TextureColorContrast",
+      description = "Modify render texture color: contrast (-100 to 100)",
+      returnType = "void",
       params = {
-        {type = "Vector2", name = "point"},
-        {type = "Vector2", name = "p1"},
-        {type = "Vector2", name = "p2"},
-        {type = "int", name = "threshold"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "float", name = "contrast"}
       }
     },
     {
-      name = "GetCollisionRec",
-      description = "Get collision rectangle for two rectangles collision",
-      returnType = "Rectangle",
+      name = "TextureColorBrightness",
+      description = "Modify render texture color: brightness (-255 to 255)",
+      returnType = "void",
       params = {
-        {type = "Rectangle", name = "rec1"},
-        {type = "Rectangle", name = "rec2"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "int", name = "brightness"}
       }
     },
     {
-      name = "LoadImage",
-      description = "Load image from file into CPU memory (RAM)",
-      returnType = "Image",
+      name = "TextureColorReplace",
+      description = "Modify render texture color: replace color",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "Color", name = "color"},
+        {type = "Color", name = "replace"}
       }
     },
     {
-      name = "LoadImageRaw",
-      description = "Load image from RAW file data",
-      returnType = "Image",
+      name = "TextureAlphaPremultiply",
+      description = "Premultiply render texture alpha channel",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "int", name = "format"},
-        {type = "int", name = "headerSize"}
+        {type = "RenderTexture2D *", name = "target"}
       }
     },
     {
-      name = "LoadImageAnim",
-      description = "Load image sequence from file (frames appended to image.data)",
-      returnType = "Image",
+      name = "TextureDither",
+      description = "Dither render texture colors to bits per channel (ordered dithering)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "int *", name = "frames"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "int", name = "rBpp"},
+        {type = "int", name = "gBpp"},
+        {type = "int", name = "bBpp"},
+        {type = "int", name = "aBpp"}
       }
     },
     {
-      name = "LoadImageFromMemory",
-      description = "Load image from memory buffer, fileType refers to extension: i.e. '.png'",
-      returnType = "Image",
+      name = "TextureResize",
+      description = "Resize render texture (bilinear, successive halving passes to downscale)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileType"},
-        {type = "const unsigned char *", name = "fileData"},
-        {type = "int", name = "dataSize"}
+        {type = "RenderTexture2D *", name = "target"},
+        {type = "int", name = "newWidth"},
+        {type = "int", name = "newHeight"}
       }
     },
     {
-      name = "LoadImageFromTexture",
-      description = "Load image from GPU texture data",
-      returnType = "Image",
+      name = "GenTextureCubemap",
+      description = "Generate cubemap from equirectangular panorama texture",
+      returnType = "TextureCubemap",
       params = {
-        {type = "Texture2D", name = "texture"}
+        {type = "Texture2D", name = "panorama"},
+        {type = "int", name = "size"},
+        {type = "int", name = "format"}
       }
     },
     {
-      name = "LoadImageFromScreen",
-      description = "Load image from screen buffer and (screenshot)",
-      returnType = "Image"
-    },
-    {
-      name = "IsImageReady",
-      description = "Check if an image is ready",
-      returnType = "bool",
+      name = "GenTextureIrradiance",
+      description = "Generate irradiance cubemap from environment cubemap (diffuse lighting)",
+      returnType = "TextureCubemap",
       params = {
-        {type = "Image", name = "image"}
+        {type = "TextureCubemap", name = "cubemap"},
+        {type = "int", name = "size"}
       }
     },
     {
-      name = "UnloadImage",
-      description = "Unload image from CPU memory (RAM)",
-      returnType = "void",
+      name = "GenTexturePrefiltered",
+      description = "Generate prefiltered cubemap from environment cubemap (specular lighting, roughness by mipmap level)",
+      returnType = "TextureCubemap",
       params = {
-        {type = "Image", name = "image"}
+        {type = "TextureCubemap", name = "cubemap"},
+        {type = "int", name = "size"}
       }
     },
     {
-      name = "ExportImage",
-      description = "Export image data to file, returns true on success",
-      returnType = "bool",
+      name = "GenTextureBRDF",
+      description = "Generate BRDF integration lookup texture (split-sum approximation)",
+      returnType = "Texture2D",
       params = {
-        {type = "Image", name = "image"},
-        {type = "const char *", name = "fileName"}
+        {type = "int", name = "size"}
       }
     },
     {
-      name = "ExportImageAsCode",
-      description = "Export image as code file defining an array of bytes, returns true on success",
+      name = "ExportTextureCubemap",
+      description = "Export cubemap faces and mipmaps to file (.ktx), returns true on success",
       returnType = "bool",
       params = {
-        {type = "Image", name = "image"},
+        {type = "TextureCubemap", name = "cubemap"},
         {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GenImageColor",
-      description = "Generate image: plain color",
-      returnType = "Image",
+      name = "LoadTextureCubemapFromFile",
+      description = "Load cubemap with mipmaps from file (.ktx)",
+      returnType = "TextureCubemap",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GenImageGradientV",
-      description = "Generate image: vertical gradient",
-      returnType = "Image",
+      name = "DrawTexture",
+      description = "Draw a Texture2D",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "top"},
-        {type = "Color", name = "bottom"}
+        {type = "Texture2D", name = "texture"},
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageGradientH",
-      description = "Generate image: horizontal gradient",
-      returnType = "Image",
+      name = "DrawTextureV",
+      description = "Draw a Texture2D with position defined as Vector2",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "left"},
-        {type = "Color", name = "right"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Vector2", name = "position"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageGradientRadial",
-      description = "Generate image: radial gradient",
-      returnType = "Image",
+      name = "DrawTextureEx",
+      description = "Draw a Texture2D with extended parameters",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "float", name = "density"},
-        {type = "Color", name = "inner"},
-        {type = "Color", name = "outer"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Vector2", name = "position"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageChecked",
-      description = "Generate image: checked",
-      returnType = "Image",
+      name = "DrawTextureRec",
+      description = "Draw a part of a texture defined by a rectangle",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "int", name = "checksX"},
-        {type = "int", name = "checksY"},
-        {type = "Color", name = "col1"},
-        {type = "Color", name = "col2"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"},
+        {type = "Vector2", name = "position"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageWhiteNoise",
-      description = "Generate image: white noise",
-      returnType = "Image",
+      name = "DrawTexturePro",
+      description = "Draw a part of a texture defined by a rectangle with 'pro' parameters",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "float", name = "factor"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"},
+        {type = "Rectangle", name = "dest"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImagePerlinNoise",
-      description = "Generate image: perlin noise",
-      returnType = "Image",
+      name = "DrawTexturePoly",
+      description = "Draw textured polygon, defined by vertex and texture coordinates",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "int", name = "offsetX"},
-        {type = "int", name = "offsetY"},
-        {type = "float", name = "scale"}
+        {type = "Texture2D", name = "texture"},
+        {type = "Vector2", name = "texcenter"},
+        {type = "Vector2", name = "center"},
+        {type = "Vector2 *", name = "points"},
+        {type = "Vector2 *", name = "texcoords"},
+        {type = "int", name = "pointCount"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageCellular",
-      description = "Generate image: cellular algorithm, bigger tileSize means bigger cells",
-      returnType = "Image",
+      name = "DrawTextureNPatch",
+      description = "Draws a texture (or part of it) that stretches or shrinks nicely",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "int", name = "tileSize"}
+        {type = "Texture2D", name = "texture"},
+        {type = "NPatchInfo", name = "nPatchInfo"},
+        {type = "Rectangle", name = "dest"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GenImageText",
-      description = "Generate image: grayscale image from text data",
-      returnType = "Image",
+      name = "DrawTextureBatch",
+      description = "Draw multiple parts of a texture with 'pro' parameters, one batch submission",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "const char *", name = "text"}
+        {type = "Texture2D", name = "texture"},
+        {type = "const SpriteInstance *", name = "sprites"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "ImageCopy",
-      description = "Create an image duplicate (useful for transformations)",
-      returnType = "Image",
+      name = "Fade",
+      description = "Get color with alpha applied, alpha goes from 0.0f to 1.0f",
+      returnType = "Color",
       params = {
-        {type = "Image", name = "image"}
+        {type = "Color", name = "color"},
+        {type = "float", name = "alpha"}
       }
     },
     {
-      name = "ImageFromImage",
-      description = "Create an image from another image piece",
-      returnType = "Image",
+      name = "ColorToInt",
+      description = "Get hexadecimal value for a Color",
+      returnType = "int",
       params = {
-        {type = "Image", name = "image"},
-        {type = "Rectangle", name = "rec"}
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "ImageText",
-      description = "Create an image from text (default font)",
-      returnType = "Image",
+      name = "ColorNormalize",
+      description = "Get Color normalized as float [0..1]",
+      returnType = "Vector4",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int", name = "fontSize"},
         {type = "Color", name = "color"}
       }
     },
     {
-      name = "ImageTextEx",
-      description = "Create an image from text (custom sprite font)",
-      returnType = "Image",
+      name = "ColorFromNormalized",
+      description = "Get Color from normalized values [0..1]",
+      returnType = "Color",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const char *", name = "text"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"},
-        {type = "Color", name = "tint"}
+        {type = "Vector4", name = "normalized"}
       }
     },
     {
-      name = "ImageFormat",
-      description = "Convert image data to desired format",
-      returnType = "void",
+      name = "ColorToHSV",
+      description = "Get HSV values for a Color, hue [0..360], saturation/value [0..1]",
+      returnType = "Vector3",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "newFormat"}
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "ImageToPOT",
-      description = "Convert image to POT (power-of-two)",
-      returnType = "void",
+      name = "ColorFromHSV",
+      description = "Get a Color from HSV values, hue [0..360], saturation/value [0..1]",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "Color", name = "fill"}
+        {type = "float", name = "hue"},
+        {type = "float", name = "saturation"},
+        {type = "float", name = "value"}
       }
     },
     {
-      name = "ImageCrop",
-      description = "Crop an image to a defined rectangle",
-      returnType = "void",
+      name = "ColorTint",
+      description = "Get color multiplied with another color",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "Rectangle", name = "crop"}
+        {type = "Color", name = "color"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageAlphaCrop",
-      description = "Crop image depending on alpha value",
-      returnType = "void",
+      name = "ColorBrightness",
+      description = "Get color with brightness correction, brightness factor goes from -1.0f to 1.0f",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "float", name = "threshold"}
+        {type = "Color", name = "color"},
+        {type = "float", name = "factor"}
       }
     },
     {
-      name = "ImageAlphaClear",
-      description = "Clear alpha channel to desired color",
-      returnType = "void",
+      name = "ColorContrast",
+      description = "Get color with contrast correction, contrast values between -1.0f and 1.0f",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
         {type = "Color", name = "color"},
-        {type = "float", name = "threshold"}
+        {type = "float", name = "contrast"}
       }
     },
     {
-      name = "ImageAlphaMask",
-      description = "Apply alpha mask to image",
-      returnType = "void",
+      name = "ColorAlpha",
+      description = "Get color with alpha applied, alpha goes from 0.0f to 1.0f",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "Image", name = "alphaMask"}
+        {type = "Color", name = "color"},
+        {type = "float", name = "alpha"}
       }
     },
     {
-      name = "ImageAlphaPremultiply",
-      description = "Premultiply alpha channel",
-      returnType = "void",
+      name = "ColorAlphaBlend",
+      description = "Get src alpha-blended into dst color with tint",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "Color", name = "dst"},
+        {type = "Color", name = "src"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageBlurGaussian",
-      description = "Apply Gaussian blur using a box blur approximation",
-      returnType = "void",
+      name = "GetColor",
+      description = "Get Color structure from hexadecimal value",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "blurSize"}
+        {type = "unsigned int", name = "hexValue"}
       }
     },
     {
-      name = "ImageResize",
-      description = "Resize image (Bicubic scaling algorithm)",
-      returnType = "void",
+      name = "GetPixelColor",
+      description = "Get Color from a source pixel pointer of certain format",
+      returnType = "Color",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "newWidth"},
-        {type = "int", name = "newHeight"}
+        {type = "void *", name = "srcPtr"},
+        {type = "int", name = "format"}
       }
     },
     {
-      name = "ImageResizeNN",
-      description = "Resize image (Nearest-Neighbor scaling algorithm)",
+      name = "SetPixelColor",
+      description = "Set color formatted into destination pixel pointer",
       returnType = "void",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "newWidth"},
-        {type = "int", name = "newHeight"}
+        {type = "void *", name = "dstPtr"},
+        {type = "Color", name = "color"},
+        {type = "int", name = "format"}
       }
     },
     {
-      name = "ImageResizeCanvas",
-      description = "Resize canvas and fill with color",
-      returnType = "void",
+      name = "GetPixelDataSize",
+      description = "Get pixel data size in bytes for certain format",
+      returnType = "int",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "newWidth"},
-        {type = "int", name = "newHeight"},
-        {type = "int", name = "offsetX"},
-        {type = "int", name = "offsetY"},
-        {type = "Color", name = "fill"}
+        {type = "int", name = "width"},
+        {type = "int", name = "height"},
+        {type = "int", name = "format"}
       }
     },
     {
-      name = "ImageMipmaps",
-      description = "Compute all mipmap levels for a provided image",
-      returnType = "void",
+      name = "GetFontDefault",
+      description = "Get the default Font",
+      returnType = "Font"
+    },
+    {
+      name = "LoadFont",
+      description = "Load font from file into GPU memory (VRAM)",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "ImageDither",
-      description = "Dither image data to 16bpp or lower (Floyd-Steinberg dithering)",
-      returnType = "void",
+      name = "LoadFontAsync",
+      description = "Load font from file asynchronously, returns request id (-1: failed)",
+      returnType = "int",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "rBpp"},
-        {type = "int", name = "gBpp"},
-        {type = "int", name = "bBpp"},
-        {type = "int", name = "aBpp"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "ImageFlipVertical",
-      description = "Flip image vertically",
-      returnType = "void",
+      name = "GetFontAsync",
+      description = "Get async loaded font, request is released (empty if not ready)",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "int", name = "request"}
       }
     },
     {
-      name = "ImageFlipHorizontal",
-      description = "Flip image horizontally",
-      returnType = "void",
+      name = "LoadFontEx",
+      description = "Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "fontSize"},
+        {type = "int *", name = "fontChars"},
+        {type = "int", name = "glyphCount"}
       }
     },
     {
-      name = "ImageRotateCW",
-      description = "Rotate image clockwise 90deg",
-      returnType = "void",
+      name = "LoadFontFromImage",
+      description = "Load font from Image (XNA style)",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "Image", name = "image"},
+        {type = "Color", name = "key"},
+        {type = "int", name = "firstChar"}
       }
     },
     {
-      name = "ImageRotateCCW",
-      description = "Rotate image counter-clockwise 90deg",
-      returnType = "void",
+      name = "LoadFontFromMemory",
+      description = "Load font from memory buffer, fileType refers to extension: i.e. '.ttf'",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "fontSize"},
+        {type = "int *", name = "fontChars"},
+        {type = "int", name = "glyphCount"}
       }
     },
     {
-      name = "ImageColorTint",
-      description = "Modify image color: tint",
-      returnType = "void",
+      name = "LoadFontDynamic",
+      description = "Load font with glyphs rasterized on first use into atlas (atlasSize: 0 for default), least recently used glyphs evicted",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "fontSize"},
+        {type = "int", name = "atlasSize"}
       }
     },
     {
-      name = "ImageColorInvert",
-      description = "Modify image color: invert",
-      returnType = "void",
+      name = "LoadFontDynamicFromMemory",
+      description = "Load dynamic font from memory buffer (data copied), fileType refers to extension: i.e. '.ttf'",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "fontSize"},
+        {type = "int", name = "atlasSize"}
       }
     },
     {
-      name = "ImageColorGrayscale",
-      description = "Modify image color: grayscale",
-      returnType = "void",
+      name = "LoadFontMsdf",
+      description = "Load font as multi-channel SDF (MSDF), drawn with default MSDF shader at any size (NULL codepoints: default charset)",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"}
+        {type = "const char *", name = "fileName"},
+        {type = "int", name = "fontSize"},
+        {type = "int *", name = "codepoints"},
+        {type = "int", name = "codepointCount"}
       }
     },
     {
-      name = "ImageColorContrast",
-      description = "Modify image color: contrast (-100 to 100)",
-      returnType = "void",
+      name = "LoadFontMsdfFromMemory",
+      description = "Load MSDF font from memory buffer, fileType refers to extension: i.e. '.ttf'",
+      returnType = "Font",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "float", name = "contrast"}
+        {type = "const char *", name = "fileType"},
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "fontSize"},
+        {type = "int *", name = "codepoints"},
+        {type = "int", name = "codepointCount"}
       }
     },
     {
-      name = "ImageColorBrightness",
-      description = "Modify image color: brightness (-255 to 255)",
-      returnType = "void",
+      name = "IsFontReady",
+      description = "Check if a font is ready",
+      returnType = "bool",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "int", name = "brightness"}
+        {type = "Font", name = "font"}
       }
     },
     {
-      name = "ImageColorReplace",
-      description = "Modify image color: replace color",
-      returnType = "void",
+      name = "LoadFontData",
+      description = "Load font data for further use",
+      returnType = "GlyphInfo *",
       params = {
-        {type = "Image *", name = "image"},
-        {type = "Color", name = "color"},
-        {type = "Color", name = "replace"}
+        {type = "const unsigned char *", name = "fileData"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "fontSize"},
+        {type = "int *", name = "fontChars"},
+        {type = "int", name = "glyphCount"},
+        {type = "int", name = "type"}
       }
     },
     {
-      name = "LoadImageColors",
-      description = "Load color data from image as a Color array (RGBA - 32bit)",
-      returnType = "Color *",
+      name = "GenImageFontAtlas",
+      description = "Generate image font atlas using chars info",
+      returnType = "Image",
       params = {
-        {type = "Image", name = "image"}
+        {type = "const GlyphInfo *", name = "chars"},
+        {type = "Rectangle **", name = "recs"},
+        {type = "int", name = "glyphCount"},
+        {type = "int", name = "fontSize"},
+        {type = "int", name = "padding"},
+        {type = "int", name = "packMethod"}
       }
     },
     {
-      name = "LoadImagePalette",
-      description = "Load colors palette from image as a Color array (RGBA - 32bit)",
-      returnType = "Color *",
+      name = "UnloadFontData",
+      description = "Unload font chars info data (RAM)",
+      returnType = "void",
       params = {
-        {type = "Image", name = "image"},
-        {type = "int", name = "maxPaletteSize"},
-        {type = "int *", name = "colorCount"}
+        {type = "GlyphInfo *", name = "chars"},
+        {type = "int", name = "glyphCount"}
       }
     },
     {
-      name = "UnloadImageColors",
-      description = "Unload color data loaded with LoadImageColors()",
+      name = "UnloadFont",
+      description = "Unload font from GPU memory (VRAM)",
       returnType = "void",
       params = {
-        {type = "Color *", name = "colors"}
+        {type = "Font", name = "font"}
       }
     },
     {
-      name = "UnloadImagePalette",
-      description = "Unload colors palette loaded with LoadImagePalette()",
-      returnType = "void",
+      name = "ExportFontAsCode",
+      description = "Export font as code file, returns true on success",
+      returnType = "bool",
       params = {
-        {type = "Color *", name = "colors"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GetImageAlphaBorder",
-      description = "Get image alpha border rectangle",
-      returnType = "Rectangle",
+      name = "ExportFontBinary",
+      description = "Export font as binary file (.rfnb): atlas, glyphs metrics and kerning, returns true on success",
+      returnType = "bool",
       params = {
-        {type = "Image", name = "image"},
-        {type = "float", name = "threshold"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "fileName"},
+        {type = "bool", name = "compressAtlas"}
       }
     },
     {
-      name = "GetImageColor",
-      description = "Get image pixel color at (x, y) position",
-      returnType = "Color",
+      name = "LoadFontBinary",
+      description = "Load font from binary file (.rfnb), no rasterization (memory mapped, atlas uploaded directly)",
+      returnType = "Font",
       params = {
-        {type = "Image", name = "image"},
-        {type = "int", name = "x"},
-        {type = "int", name = "y"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "ImageClearBackground",
-      description = "Clear image background with given color",
+      name = "DrawFPS",
+      description = "Draw current FPS",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "posX"},
+        {type = "int", name = "posY"}
       }
     },
     {
-      name = "ImageDrawPixel",
-      description = "Draw pixel within an image",
+      name = "DrawText",
+      description = "Draw text (using default font)",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
+        {type = "const char *", name = "text"},
         {type = "int", name = "posX"},
         {type = "int", name = "posY"},
+        {type = "int", name = "fontSize"},
         {type = "Color", name = "color"}
       }
     },
     {
-      name = "ImageDrawPixelV",
-      description = "Draw pixel within an image (Vector version)",
+      name = "DrawTextEx",
+      description = "Draw text using font and additional parameters",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
         {type = "Vector2", name = "position"},
-        {type = "Color", name = "color"}
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawLine",
-      description = "Draw line within an image",
+      name = "DrawTextPro",
+      description = "Draw text using Font and pro parameters (rotation)",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "int", name = "startPosX"},
-        {type = "int", name = "startPosY"},
-        {type = "int", name = "endPosX"},
-        {type = "int", name = "endPosY"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "Vector2", name = "position"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawLineV",
-      description = "Draw line within an image (Vector version)",
+      name = "DrawTextCodepoint",
+      description = "Draw one character (codepoint)",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Vector2", name = "start"},
-        {type = "Vector2", name = "end"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "int", name = "codepoint"},
+        {type = "Vector2", name = "position"},
+        {type = "float", name = "fontSize"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawCircle",
-      description = "Draw a filled circle within an image",
+      name = "DrawTextCodepoints",
+      description = "Draw multiple character (codepoint)",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "int", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const int *", name = "codepoints"},
+        {type = "int", name = "count"},
+        {type = "Vector2", name = "position"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawCircleV",
-      description = "Draw a filled circle within an image (Vector version)",
+      name = "DrawTextBoxed",
+      description = "Draw text inside rectangle (TextWrapMode), lines out of rectangle or scissor area skipped",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Vector2", name = "center"},
-        {type = "int", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "Rectangle", name = "rec"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "int", name = "wrapMode"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawCircleLines",
-      description = "Draw circle outline within an image",
-      returnType = "void",
+      name = "LoadTextLayout",
+      description = "Load text layout, glyphs positioned once (wrapWidth: words wrap width, 0 to disable)",
+      returnType = "TextLayout",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "int", name = "centerX"},
-        {type = "int", name = "centerY"},
-        {type = "int", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"},
+        {type = "float", name = "wrapWidth"}
       }
     },
     {
-      name = "ImageDrawCircleLinesV",
-      description = "Draw circle outline within an image (Vector version)",
+      name = "UnloadTextLayout",
+      description = "Unload text layout data",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Vector2", name = "center"},
-        {type = "int", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "TextLayout", name = "layout"}
       }
     },
     {
-      name = "ImageDrawRectangle",
-      description = "Draw rectangle within an image",
+      name = "DrawTextLayout",
+      description = "Draw text layout, all glyphs quads in one batch pass",
       returnType = "void",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "Color", name = "color"}
+        {type = "TextLayout", name = "layout"},
+        {type = "Vector2", name = "position"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "ImageDrawRectangleV",
-      description = "Draw rectangle within an image (Vector version)",
-      returnType = "void",
+      name = "MeasureText",
+      description = "Measure string width for default font",
+      returnType = "int",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Vector2", name = "position"},
-        {type = "Vector2", name = "size"},
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "text"},
+        {type = "int", name = "fontSize"}
       }
     },
     {
-      name = "ImageDrawRectangleRec",
-      description = "Draw rectangle within an image",
-      returnType = "void",
+      name = "MeasureTextEx",
+      description = "Measure string size for Font",
+      returnType = "Vector2",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Rectangle", name = "rec"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"}
       }
     },
     {
-      name = "ImageDrawRectangleLines",
-      description = "Draw rectangle lines within an image",
-      returnType = "void",
+      name = "MeasureTextBytes",
+      description = "Measure string size for Font, text bytes count provided (no null terminator required)",
+      returnType = "Vector2",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Rectangle", name = "rec"},
-        {type = "int", name = "thick"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "const char *", name = "text"},
+        {type = "int", name = "byteCount"},
+        {type = "float", name = "fontSize"},
+        {type = "float", name = "spacing"}
       }
     },
     {
-      name = "ImageDraw",
-      description = "Draw a source image within a destination image (tint applied to source)",
-      returnType = "void",
+      name = "GetGlyphIndex",
+      description = "Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found",
+      returnType = "int",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "Image", name = "src"},
-        {type = "Rectangle", name = "srcRec"},
-        {type = "Rectangle", name = "dstRec"},
-        {type = "Color", name = "tint"}
+        {type = "Font", name = "font"},
+        {type = "int", name = "codepoint"}
+      }
+    },
+    {
+      name = "GetGlyphInfo",
+      description = "Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found",
+      returnType = "GlyphInfo",
+      params = {
+        {type = "Font", name = "font"},
+        {type = "int", name = "codepoint"}
       }
     },
     {
-      name = "ImageDrawText",
-      description = "Draw text (using default font) within an image (destination)",
-      returnType = "void",
+      name = "GetGlyphAtlasRec",
+      description = "Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found",
+      returnType = "Rectangle",
       params = {
-        {type = "Image *", name = "dst"},
-        {type = "const char *", name = "text"},
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "int", name = "fontSize"},
-        {type = "Color", name = "color"}
+        {type = "Font", name = "font"},
+        {type = "int", name = "codepoint"}
       }
     },
     {
-      name = "ImageDrawTextEx",
-      description = "Draw text (custom sprite font) within an image (destination)",
-      returnType = "void",
+      name = "GetGlyphKerning",
+      description = "Get glyphs pair kerning, advance adjustment in pixels at font base size (0 if no kerning)",
+      returnType = "float",
       params = {
-        {type = "Image *", name = "dst"},
         {type = "Font", name = "font"},
-        {type = "const char *", name = "text"},
-        {type = "Vector2", name = "position"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"},
-        {type = "Color", name = "tint"}
+        {type = "int", name = "codepoint"},
+        {type = "int", name = "nextCodepoint"}
       }
     },
     {
-      name = "LoadTexture",
-      description = "Load texture from file into GPU memory (VRAM)",
-      returnType = "Texture2D",
+      name = "LoadUTF8",
+      description = "Load UTF-8 text encoded from codepoints array",
+      returnType = "char *",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "const int *", name = "codepoints"},
+        {type = "int", name = "length"}
       }
     },
     {
-      name = "LoadTextureFromImage",
-      description = "Load texture from image data",
-      returnType = "Texture2D",
+      name = "UnloadUTF8",
+      description = "Unload UTF-8 text encoded from codepoints array",
+      returnType = "void",
       params = {
-        {type = "Image", name = "image"}
+        {type = "char *", name = "text"}
       }
     },
     {
-      name = "LoadTextureCubemap",
-      description = "Load cubemap from image, multiple image cubemap layouts supported",
-      returnType = "TextureCubemap",
+      name = "LoadCodepoints",
+      description = "Load all codepoints from a UTF-8 text string, codepoints count returned by parameter",
+      returnType = "int *",
       params = {
-        {type = "Image", name = "image"},
-        {type = "int", name = "layout"}
+        {type = "const char *", name = "text"},
+        {type = "int *", name = "count"}
       }
     },
     {
-      name = "LoadRenderTexture",
-      description = "Load texture for rendering (framebuffer)",
-      returnType = "RenderTexture2D",
+      name = "UnloadCodepoints",
+      description = "Unload codepoints data from memory",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"}
+        {type = "int *", name = "codepoints"}
       }
     },
     {
-      name = "IsTextureReady",
-      description = "Check if a texture is ready",
-      returnType = "bool",
+      name = "GetCodepointCount",
+      description = "Get total number of codepoints in a UTF-8 encoded string",
+      returnType = "int",
       params = {
-        {type = "Texture2D", name = "texture"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "UnloadTexture",
-      description = "Unload texture from GPU memory (VRAM)",
-      returnType = "void",
+      name = "DecodeUTF8Into",
+      description = "Decode UTF-8 text bytes into provided codepoints buffer (no allocation), returns codepoints decoded",
+      returnType = "int",
       params = {
-        {type = "Texture2D", name = "texture"}
+        {type = "const char *", name = "text"},
+        {type = "int", name = "byteCount"},
+        {type = "int *", name = "codepoints"},
+        {type = "int", name = "capacity"}
       }
     },
     {
-      name = "IsRenderTextureReady",
-      description = "Check if a render texture is ready",
-      returnType = "bool",
+      name = "GetCodepoint",
+      description = "Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
+      returnType = "int",
       params = {
-        {type = "RenderTexture2D", name = "target"}
+        {type = "const char *", name = "text"},
+        {type = "int *", name = "codepointSize"}
       }
     },
     {
-      name = "UnloadRenderTexture",
-      description = "Unload render texture from GPU memory (VRAM)",
-      returnType = "void",
+      name = "GetCodepointNext",
+      description = "Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
+      returnType = "int",
       params = {
-        {type = "RenderTexture2D", name = "target"}
+        {type = "const char *", name = "text"},
+        {type = "int *", name = "codepointSize"}
       }
     },
     {
-      name = "UpdateTexture",
-      description = "Update GPU texture with new data",
-      returnType = "void",
+      name = "GetCodepointPrevious",
+      description = "Get previous codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
+      returnType = "int",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "const void *", name = "pixels"}
+        {type = "const char *", name = "text"},
+        {type = "int *", name = "codepointSize"}
       }
     },
     {
-      name = "UpdateTextureRec",
-      description = "Update GPU texture rectangle with new data",
-      returnType = "void",
+      name = "CodepointToUTF8",
+      description = "Encode one codepoint into UTF-8 byte array (array length returned as parameter)",
+      returnType = "const char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "rec"},
-        {type = "const void *", name = "pixels"}
+        {type = "int", name = "codepoint"},
+        {type = "int *", name = "utf8Size"}
       }
     },
     {
-      name = "GenTextureMipmaps",
-      description = "Generate GPU mipmaps for a texture",
-      returnType = "void",
+      name = "TextCopy",
+      description = "Copy one string to another, returns bytes copied",
+      returnType = "int",
       params = {
-        {type = "Texture2D *", name = "texture"}
+        {type = "char *", name = "dst"},
+        {type = "const char *", name = "src"}
       }
     },
     {
-      name = "SetTextureFilter",
-      description = "Set texture scaling filter mode",
-      returnType = "void",
+      name = "TextIsEqual",
+      description = "Check if two text string are equal",
+      returnType = "bool",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "int", name = "filter"}
+        {type = "const char *", name = "text1"},
+        {type = "const char *", name = "text2"}
       }
     },
     {
-      name = "SetTextureWrap",
-      description = "Set texture wrapping mode",
-      returnType = "void",
+      name = "TextLength",
+      description = "Get text length, checks for '\\0' ending",
+      returnType = "unsigned int",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "int", name = "wrap"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "DrawTexture",
-      description = "Draw a Texture2D",
-      returnType = "void",
+      name = "TextFormat",
+      description = "Text formatting with variables (sprintf() style)",
+      returnType = "const char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "Color", name = "tint"}
+        {type = "const char *", name = "text"},
+        {type = "...", name = "args"}
       }
     },
     {
-      name = "DrawTextureV",
-      description = "Draw a Texture2D with position defined as Vector2",
-      returnType = "void",
+      name = "TextSubtext",
+      description = "Get a piece of a text string",
+      returnType = "const char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Vector2", name = "position"},
-        {type = "Color", name = "tint"}
+        {type = "const char *", name = "text"},
+        {type = "int", name = "position"},
+        {type = "int", name = "length"}
       }
     },
     {
-      name = "DrawTextureEx",
-      description = "Draw a Texture2D with extended parameters",
-      returnType = "void",
+      name = "TextReplace",
+      description = "Replace text string (WARNING: memory must be freed!)",
+      returnType = "char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Vector2", name = "position"},
-        {type = "float", name = "rotation"},
-        {type = "float", name = "scale"},
-        {type = "Color", name = "tint"}
+        {type = "char *", name = "text"},
+        {type = "const char *", name = "replace"},
+        {type = "const char *", name = "by"}
       }
     },
     {
-      name = "DrawTextureRec",
-      description = "Draw a part of a texture defined by a rectangle",
-      returnType = "void",
+      name = "TextInsert",
+      description = "Insert text in a position (WARNING: memory must be freed!)",
+      returnType = "char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "source"},
-        {type = "Vector2", name = "position"},
-        {type = "Color", name = "tint"}
+        {type = "const char *", name = "text"},
+        {type = "const char *", name = "insert"},
+        {type = "int", name = "position"}
       }
     },
     {
-      name = "DrawTexturePro",
-      description = "Draw a part of a texture defined by a rectangle with 'pro' parameters",
-      returnType = "void",
+      name = "TextJoin",
+      description = "Join text strings with delimiter",
+      returnType = "const char *",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "source"},
-        {type = "Rectangle", name = "dest"},
-        {type = "Vector2", name = "origin"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "tint"}
+        {type = "const char **", name = "textList"},
+        {type = "int", name = "count"},
+        {type = "const char *", name = "delimiter"}
       }
     },
     {
-      name = "DrawTextureNPatch",
-      description = "Draws a texture (or part of it) that stretches or shrinks nicely",
-      returnType = "void",
+      name = "TextSplit",
+      description = "Split text into multiple strings",
+      returnType = "const char **",
       params = {
-        {type = "Texture2D", name = "texture"},
-        {type = "NPatchInfo", name = "nPatchInfo"},
-        {type = "Rectangle", name = "dest"},
-        {type = "Vector2", name = "origin"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "tint"}
+        {type = "const char *", name = "text"},
+        {type = "char", name = "delimiter"},
+        {type = "int *", name = "count"}
       }
     },
     {
-      name = "Fade",
-      description = "Get color with alpha applied, alpha goes from 0.0f to 1.0f",
-      returnType = "Color",
+      name = "TextSplitEx",
+      description = "Split text into multiple strings, allocated from memory arena (no substrings limit)",
+      returnType = "const char **",
       params = {
-        {type = "Color", name = "color"},
-        {type = "float", name = "alpha"}
+        {type = "MemArena *", name = "arena"},
+        {type = "const char *", name = "text"},
+        {type = "char", name = "delimiter"},
+        {type = "int *", name = "count"}
       }
     },
     {
-      name = "ColorToInt",
-      description = "Get hexadecimal value for a Color",
-      returnType = "int",
+      name = "TextAppend",
+      description = "Append text at specific position and move cursor!",
+      returnType = "void",
       params = {
-        {type = "Color", name = "color"}
+        {type = "char *", name = "text"},
+        {type = "const char *", name = "append"},
+        {type = "int *", name = "position"}
       }
     },
     {
-      name = "ColorNormalize",
-      description = "Get Color normalized as float [0..1]",
-      returnType = "Vector4",
+      name = "TextFindIndex",
+      description = "Find first text occurrence within a string",
+      returnType = "int",
       params = {
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "text"},
+        {type = "const char *", name = "find"}
       }
     },
     {
-      name = "ColorFromNormalized",
-      description = "Get Color from normalized values [0..1]",
-      returnType = "Color",
+      name = "TextToUpper",
+      description = "Get upper case version of provided string",
+      returnType = "const char *",
       params = {
-        {type = "Vector4", name = "normalized"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorToHSV",
-      description = "Get HSV values for a Color, hue [0..360], saturation/value [0..1]",
-      returnType = "Vector3",
+      name = "TextToLower",
+      description = "Get lower case version of provided string",
+      returnType = "const char *",
       params = {
-        {type = "Color", name = "color"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorFromHSV",
-      description = "Get a Color from HSV values, hue [0..360], saturation/value [0..1]",
-      returnType = "Color",
+      name = "TextToPascal",
+      description = "Get Pascal case notation version of provided string",
+      returnType = "const char *",
       params = {
-        {type = "float", name = "hue"},
-        {type = "float", name = "saturation"},
-        {type = "float", name = "value"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorTint",
-      description = "Get color multiplied with another color",
-      returnType = "Color",
+      name = "TextToInteger",
+      description = "Get integer value from text (negative values not supported)",
+      returnType = "int",
       params = {
-        {type = "Color", name = "color"},
-        {type = "Color", name = "tint"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorBrightness",
-      description = "Get color with brightness correction, brightness factor goes from -1.0f to 1.0f",
-      returnType = "Color",
+      name = "TextHash",
+      description = "Get text hash (FNV-1a, 32 bit)",
+      returnType = "unsigned int",
       params = {
-        {type = "Color", name = "color"},
-        {type = "float", name = "factor"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorContrast",
-      description = "Get color with contrast correction, contrast values between -1.0f and 1.0f",
-      returnType = "Color",
+      name = "TextIntern",
+      description = "Intern text string, returns stable id (same text, same id; 0: NULL text)",
+      returnType = "unsigned int",
       params = {
-        {type = "Color", name = "color"},
-        {type = "float", name = "contrast"}
+        {type = "const char *", name = "text"}
       }
     },
     {
-      name = "ColorAlpha",
-      description = "Get color with alpha applied, alpha goes from 0.0f to 1.0f",
-      returnType = "Color",
+      name = "TextGetInterned",
+      description = "Get interned text string by id (stable pointer, valid until CloseWindow())",
+      returnType = "const char *",
       params = {
-        {type = "Color", name = "color"},
-        {type = "float", name = "alpha"}
+        {type = "unsigned int", name = "id"}
       }
     },
     {
-      name = "ColorAlphaBlend",
-      description = "Get src alpha-blended into dst color with tint",
-      returnType = "Color",
+      name = "TextGetInternedHash",
+      description = "Get interned text string precomputed hash by id",
+      returnType = "unsigned int",
       params = {
-        {type = "Color", name = "dst"},
-        {type = "Color", name = "src"},
-        {type = "Color", name = "tint"}
+        {type = "unsigned int", name = "id"}
       }
     },
     {
-      name = "GetColor",
-      description = "Get Color structure from hexadecimal value",
-      returnType = "Color",
+      name = "DrawLine3D",
+      description = "Draw a line in 3D world space",
+      returnType = "void",
       params = {
-        {type = "unsigned int", name = "hexValue"}
+        {type = "Vector3", name = "startPos"},
+        {type = "Vector3", name = "endPos"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetPixelColor",
-      description = "Get Color from a source pixel pointer of certain format",
-      returnType = "Color",
+      name = "DrawPoint3D",
+      description = "Draw a point in 3D space, actually a small line",
+      returnType = "void",
       params = {
-        {type = "void *", name = "srcPtr"},
-        {type = "int", name = "format"}
+        {type = "Vector3", name = "position"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "SetPixelColor",
-      description = "Set color formatted into destination pixel pointer",
+      name = "DrawCircle3D",
+      description = "Draw a circle in 3D world space",
       returnType = "void",
       params = {
-        {type = "void *", name = "dstPtr"},
-        {type = "Color", name = "color"},
-        {type = "int", name = "format"}
+        {type = "Vector3", name = "center"},
+        {type = "float", name = "radius"},
+        {type = "Vector3", name = "rotationAxis"},
+        {type = "float", name = "rotationAngle"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetPixelDataSize",
-      description = "Get pixel data size in bytes for certain format",
-      returnType = "int",
+      name = "DrawTriangle3D",
+      description = "Draw a color-filled triangle (vertex in counter-clockwise order!)",
+      returnType = "void",
       params = {
-        {type = "int", name = "width"},
-        {type = "int", name = "height"},
-        {type = "int", name = "format"}
+        {type = "Vector3", name = "v1"},
+        {type = "Vector3", name = "v2"},
+        {type = "Vector3", name = "v3"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GetFontDefault",
-      description = "Get the default Font",
-      returnType = "Font"
-    },
-    {
-      name = "LoadFont",
-      description = "Load font from file into GPU memory (VRAM)",
-      returnType = "Font",
+      name = "DrawTriangleStrip3D",
+      description = "Draw a triangle strip defined by points",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "Vector3 *", name = "points"},
+        {type = "int", name = "pointCount"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "LoadFontEx",
-      description = "Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set",
-      returnType = "Font",
+      name = "DrawCube",
+      description = "Draw cube",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"},
-        {type = "int", name = "fontSize"},
-        {type = "int *", name = "fontChars"},
-        {type = "int", name = "glyphCount"}
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "width"},
+        {type = "float", name = "height"},
+        {type = "float", name = "length"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "LoadFontFromImage",
-      description = "Load font from Image (XNA style)",
-      returnType = "Font",
+      name = "DrawCubeV",
+      description = "Draw cube (Vector version)",
+      returnType = "void",
       params = {
-        {type = "Image", name = "image"},
-        {type = "Color", name = "key"},
-        {type = "int", name = "firstChar"}
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "size"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "LoadFontFromMemory",
-      description = "Load font from memory buffer, fileType refers to extension: i.e. '.ttf'",
-      returnType = "Font",
+      name = "DrawCubeWires",
+      description = "Draw cube wires",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileType"},
-        {type = "const unsigned char *", name = "fileData"},
-        {type = "int", name = "dataSize"},
-        {type = "int", name = "fontSize"},
-        {type = "int *", name = "fontChars"},
-        {type = "int", name = "glyphCount"}
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "width"},
+        {type = "float", name = "height"},
+        {type = "float", name = "length"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "IsFontReady",
-      description = "Check if a font is ready",
-      returnType = "bool",
+      name = "DrawCubeWiresV",
+      description = "Draw cube wires (Vector version)",
+      returnType = "void",
       params = {
-        {type = "Font", name = "font"}
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "size"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "LoadFontData",
-      description = "Load font data for further use",
-      returnType = "GlyphInfo *",
+      name = "DrawSphere",
+      description = "Draw sphere",
+      returnType = "void",
       params = {
-        {type = "const unsigned char *", name = "fileData"},
-        {type = "int", name = "dataSize"},
-        {type = "int", name = "fontSize"},
-        {type = "int *", name = "fontChars"},
-        {type = "int", name = "glyphCount"},
-        {type = "int", name = "type"}
+        {type = "Vector3", name = "centerPos"},
+        {type = "float", name = "radius"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "GenImageFontAtlas",
-      description = "Generate image font atlas using chars info",
-      returnType = "Image",
+      name = "DrawSphereEx",
+      description = "Draw sphere with extended parameters",
+      returnType = "void",
       params = {
-        {type = "const GlyphInfo *", name = "chars"},
-        {type = "Rectangle **", name = "recs"},
-        {type = "int", name = "glyphCount"},
-        {type = "int", name = "fontSize"},
-        {type = "int", name = "padding"},
-        {type = "int", name = "packMethod"}
+        {type = "Vector3", name = "centerPos"},
+        {type = "float", name = "radius"},
+        {type = "int", name = "rings"},
+        {type = "int", name = "slices"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "UnloadFontData",
-      description = "Unload font chars info data (RAM)",
+      name = "DrawSphereWires",
+      description = "Draw sphere wires",
       returnType = "void",
       params = {
-        {type = "GlyphInfo *", name = "chars"},
-        {type = "int", name = "glyphCount"}
+        {type = "Vector3", name = "centerPos"},
+        {type = "float", name = "radius"},
+        {type = "int", name = "rings"},
+        {type = "int", name = "slices"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "UnloadFont",
-      description = "Unload font from GPU memory (VRAM)",
+      name = "DrawCylinder",
+      description = "Draw a cylinder/cone",
       returnType = "void",
       params = {
-        {type = "Font", name = "font"}
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "radiusTop"},
+        {type = "float", name = "radiusBottom"},
+        {type = "float", name = "height"},
+        {type = "int", name = "slices"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "ExportFontAsCode",
-      description = "Export font as code file, returns true on success",
-      returnType = "bool",
+      name = "DrawCylinderEx",
+      description = "Draw a cylinder with base at startPos and top at endPos",
+      returnType = "void",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const char *", name = "fileName"}
+        {type = "Vector3", name = "startPos"},
+        {type = "Vector3", name = "endPos"},
+        {type = "float", name = "startRadius"},
+        {type = "float", name = "endRadius"},
+        {type = "int", name = "sides"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawFPS",
-      description = "Draw current FPS",
+      name = "DrawCylinderWires",
+      description = "Draw a cylinder/cone wires",
       returnType = "void",
       params = {
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"}
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "radiusTop"},
+        {type = "float", name = "radiusBottom"},
+        {type = "float", name = "height"},
+        {type = "int", name = "slices"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawText",
-      description = "Draw text (using default font)",
+      name = "DrawCylinderWiresEx",
+      description = "Draw a cylinder wires with base at startPos and top at endPos",
       returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int", name = "posX"},
-        {type = "int", name = "posY"},
-        {type = "int", name = "fontSize"},
+        {type = "Vector3", name = "startPos"},
+        {type = "Vector3", name = "endPos"},
+        {type = "float", name = "startRadius"},
+        {type = "float", name = "endRadius"},
+        {type = "int", name = "sides"},
         {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawTextEx",
-      description = "Draw text using font and additional parameters",
+      name = "DrawCapsule",
+      description = "Draw a capsule with the center of its sphere caps at startPos and endPos",
       returnType = "void",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const char *", name = "text"},
-        {type = "Vector2", name = "position"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"},
-        {type = "Color", name = "tint"}
+        {type = "Vector3", name = "startPos"},
+        {type = "Vector3", name = "endPos"},
+        {type = "float", name = "radius"},
+        {type = "int", name = "slices"},
+        {type = "int", name = "rings"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawTextPro",
-      description = "Draw text using Font and pro parameters (rotation)",
+      name = "DrawCapsuleWires",
+      description = "Draw capsule wireframe with the center of its sphere caps at startPos and endPos",
       returnType = "void",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const char *", name = "text"},
-        {type = "Vector2", name = "position"},
-        {type = "Vector2", name = "origin"},
-        {type = "float", name = "rotation"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"},
-        {type = "Color", name = "tint"}
+        {type = "Vector3", name = "startPos"},
+        {type = "Vector3", name = "endPos"},
+        {type = "float", name = "radius"},
+        {type = "int", name = "slices"},
+        {type = "int", name = "rings"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawTextCodepoint",
-      description = "Draw one character (codepoint)",
+      name = "DrawPlane",
+      description = "Draw a plane XZ",
       returnType = "void",
       params = {
-        {type = "Font", name = "font"},
-        {type = "int", name = "codepoint"},
-        {type = "Vector2", name = "position"},
-        {type = "float", name = "fontSize"},
-        {type = "Color", name = "tint"}
+        {type = "Vector3", name = "centerPos"},
+        {type = "Vector2", name = "size"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "DrawTextCodepoints",
-      description = "Draw multiple character (codepoint)",
+      name = "DrawRay",
+      description = "Draw a ray line",
       returnType = "void",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const int *", name = "codepoints"},
-        {type = "int", name = "count"},
-        {type = "Vector2", name = "position"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"},
-        {type = "Color", name = "tint"}
+        {type = "Ray", name = "ray"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "MeasureText",
-      description = "Measure string width for default font",
-      returnType = "int",
+      name = "DrawGrid",
+      description = "Draw a grid (centered at (0, 0, 0))",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int", name = "fontSize"}
+        {type = "int", name = "slices"},
+        {type = "float", name = "spacing"}
       }
     },
     {
-      name = "MeasureTextEx",
-      description = "Measure string size for Font",
-      returnType = "Vector2",
+      name = "LoadModel",
+      description = "Load model from files (meshes and materials)",
+      returnType = "Model",
       params = {
-        {type = "Font", name = "font"},
-        {type = "const char *", name = "text"},
-        {type = "float", name = "fontSize"},
-        {type = "float", name = "spacing"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GetGlyphIndex",
-      description = "Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found",
+      name = "LoadModelAsync",
+      description = "Load model from files asynchronously, returns request id (-1: failed)",
       returnType = "int",
       params = {
-        {type = "Font", name = "font"},
-        {type = "int", name = "codepoint"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "GetGlyphInfo",
-      description = "Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found",
-      returnType = "GlyphInfo",
+      name = "GetModelAsync",
+      description = "Get async loaded model, request is released (empty if not ready)",
+      returnType = "Model",
       params = {
-        {type = "Font", name = "font"},
-        {type = "int", name = "codepoint"}
+        {type = "int", name = "request"}
       }
     },
     {
-      name = "GetGlyphAtlasRec",
-      description = "Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found",
-      returnType = "Rectangle",
+      name = "LoadModelFromMesh",
+      description = "Load model from generated mesh (default material)",
+      returnType = "Model",
       params = {
-        {type = "Font", name = "font"},
-        {type = "int", name = "codepoint"}
+        {type = "Mesh", name = "mesh"}
       }
     },
     {
-      name = "LoadUTF8",
-      description = "Load UTF-8 text encoded from codepoints array",
-      returnType = "char *",
+      name = "LoadModelBinary",
+      description = "Load model from binary file (.rlm), vertex data uploaded from mapped file",
+      returnType = "Model",
       params = {
-        {type = "const int *", name = "codepoints"},
-        {type = "int", name = "length"}
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "UnloadUTF8",
-      description = "Unload UTF-8 text encoded from codepoints array",
-      returnType = "void",
+      name = "ExportModelBinary",
+      description = "Export model (and animations) to binary file (.rlm), returns true on success",
+      returnType = "bool",
       params = {
-        {type = "char *", name = "text"}
+        {type = "Model", name = "model"},
+        {type = "const ModelAnimation *", name = "animations"},
+        {type = "int", name = "animCount"},
+        {type = "const char *", name = "fileName"}
       }
     },
     {
-      name = "LoadCodepoints",
-      description = "Load all codepoints from a UTF-8 text string, codepoints count returned by parameter",
-      returnType = "int *",
+      name = "IsModelReady",
+      description = "Check if a model is ready",
+      returnType = "bool",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int *", name = "count"}
+        {type = "Model", name = "model"}
       }
     },
     {
-      name = "UnloadCodepoints",
-      description = "Unload codepoints data from memory",
+      name = "UnloadModel",
+      description = "Unload model (including meshes) from memory (RAM and/or VRAM)",
       returnType = "void",
       params = {
-        {type = "int *", name = "codepoints"}
+        {type = "Model", name = "model"}
       }
     },
     {
-      name = "GetCodepointCount",
-      description = "Get total number of codepoints in a UTF-8 encoded string",
-      returnType = "int",
+      name = "GetModelBoundingBox",
+      description = "Compute model bounding box limits (considers all meshes)",
+      returnType = "BoundingBox",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "Model", name = "model"}
       }
     },
     {
-      name = "GetCodepoint",
-      description = "Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
-      returnType = "int",
+      name = "LoadOcclusionQuery",
+      description = "Load occlusion query for a drawn model (visible until tested)",
+      returnType = "OcclusionQuery"
+    },
+    {
+      name = "UnloadOcclusionQuery",
+      description = "Unload occlusion query from GPU memory",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int *", name = "codepointSize"}
+        {type = "OcclusionQuery", name = "query"}
       }
     },
     {
-      name = "GetCodepointNext",
-      description = "Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
-      returnType = "int",
+      name = "DrawModel",
+      description = "Draw a model (with texture if set)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int *", name = "codepointSize"}
+        {type = "Model", name = "model"},
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "GetCodepointPrevious",
-      description = "Get previous codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure",
-      returnType = "int",
+      name = "DrawModelEx",
+      description = "Draw a model with extended parameters",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int *", name = "codepointSize"}
+        {type = "Model", name = "model"},
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "rotationAxis"},
+        {type = "float", name = "rotationAngle"},
+        {type = "Vector3", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "CodepointToUTF8",
-      description = "Encode one codepoint into UTF-8 byte array (array length returned as parameter)",
-      returnType = "const char *",
+      name = "DrawModelWires",
+      description = "Draw a model wires (with texture if set)",
+      returnType = "void",
       params = {
-        {type = "int", name = "codepoint"},
-        {type = "int *", name = "utf8Size"}
+        {type = "Model", name = "model"},
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextCopy",
-      description = "Copy one string to another, returns bytes copied",
-      returnType = "int",
+      name = "DrawModelWiresEx",
+      description = "Draw a model wires (with texture if set) with extended parameters",
+      returnType = "void",
       params = {
-        {type = "char *", name = "dst"},
-        {type = "const char *", name = "src"}
+        {type = "Model", name = "model"},
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "rotationAxis"},
+        {type = "float", name = "rotationAngle"},
+        {type = "Vector3", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextIsEqual",
-      description = "Check if two text string are equal",
-      returnType = "bool",
+      name = "DrawModelLOD",
+      description = "Draw a model with meshes LOD levels selected by projected size (current camera)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text1"},
-        {type = "const char *", name = "text2"}
+        {type = "Model", name = "model"},
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextLength",
-      description = "Get text length, checks for '\\0' ending",
-      returnType = "unsigned int",
+      name = "DrawModelOccluded",
+      description = "Draw a model if its bounding box was not occluded (previous frames occlusion query)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "Model", name = "model"},
+        {type = "OcclusionQuery *", name = "query"},
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "scale"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextFormat",
-      description = "Text formatting with variables (sprintf() style)",
-      returnType = "const char *",
+      name = "DrawModelInstanced",
+      description = "Draw multiple model instances with different transforms and tints (colors can be NULL)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "...", name = "args"}
+        {type = "Model", name = "model"},
+        {type = "const Matrix *", name = "transforms"},
+        {type = "const Color *", name = "colors"},
+        {type = "int", name = "instances"}
       }
     },
     {
-      name = "TextSubtext",
-      description = "Get a piece of a text string",
-      returnType = "const char *",
+      name = "DrawModelInstancedBuffer",
+      description = "Draw multiple model instances with transforms, colors and attributes stored in GPU buffer",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "int", name = "position"},
-        {type = "int", name = "length"}
+        {type = "Model", name = "model"},
+        {type = "MeshInstanceBuffer", name = "buffer"},
+        {type = "int", name = "instances"}
       }
     },
     {
-      name = "TextReplace",
-      description = "Replace text string (WARNING: memory must be freed!)",
-      returnType = "char *",
-      params = {
-        {type = "char *", name = "text"},
-        {type = "const char *", name = "replace"},
-        {type = "const char *", name = "by"}
+      name = "SetModelFrustumCulling",
+      description = "Set model meshes frustum culling on drawing (disabled by default)",
+      returnType = "void",
+      params = {
+        {type = "bool", name = "enabled"}
       }
     },
     {
-      name = "TextInsert",
-      description = "Insert text in a position (WARNING: memory must be freed!)",
-      returnType = "char *",
+      name = "DrawBoundingBox",
+      description = "Draw bounding box (wires)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "const char *", name = "insert"},
-        {type = "int", name = "position"}
+        {type = "BoundingBox", name = "box"},
+        {type = "Color", name = "color"}
       }
     },
     {
-      name = "TextJoin",
-      description = "Join text strings with delimiter",
-      returnType = "const char *",
+      name = "DrawBillboard",
+      description = "Draw a billboard texture",
+      returnType = "void",
       params = {
-        {type = "const char **", name = "textList"},
-        {type = "int", name = "count"},
-        {type = "const char *", name = "delimiter"}
+        {type = "Camera", name = "camera"},
+        {type = "Texture2D", name = "texture"},
+        {type = "Vector3", name = "position"},
+        {type = "float", name = "size"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextSplit",
-      description = "Split text into multiple strings",
-      returnType = "const char **",
+      name = "DrawBillboardRec",
+      description = "Draw a billboard texture defined by source",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "char", name = "delimiter"},
-        {type = "int *", name = "count"}
+        {type = "Camera", name = "camera"},
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"},
+        {type = "Vector3", name = "position"},
+        {type = "Vector2", name = "size"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextAppend",
-      description = "Append text at specific position and move cursor!",
+      name = "DrawBillboardPro",
+      description = "Draw a billboard texture defined by source and rotation",
       returnType = "void",
       params = {
-        {type = "char *", name = "text"},
-        {type = "const char *", name = "append"},
-        {type = "int *", name = "position"}
+        {type = "Camera", name = "camera"},
+        {type = "Texture2D", name = "texture"},
+        {type = "Rectangle", name = "source"},
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "up"},
+        {type = "Vector2", name = "size"},
+        {type = "Vector2", name = "origin"},
+        {type = "float", name = "rotation"},
+        {type = "Color", name = "tint"}
       }
     },
     {
-      name = "TextFindIndex",
-      description = "Find first text occurrence within a string",
-      returnType = "int",
+      name = "DrawBillboardsBatch",
+      description = "Draw billboards batch facing camera (quads expanded on GPU if supported)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"},
-        {type = "const char *", name = "find"}
+        {type = "Camera", name = "camera"},
+        {type = "Texture2D", name = "texture"},
+        {type = "const BillboardInstance *", name = "items"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "TextToUpper",
-      description = "Get upper case version of provided string",
-      returnType = "const char *",
+      name = "SetBillboardsBatchSorting",
+      description = "Set billboards batch back-to-front sorting (disabled by default)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "bool", name = "enabled"}
       }
     },
     {
-      name = "TextToLower",
-      description = "Get lower case version of provided string",
-      returnType = "const char *",
+      name = "LoadParticleSystem",
+      description = "Load particle system, simulated on GPU if compute shaders supported (OpenGL 4.3)",
+      returnType = "ParticleSystem",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "int", name = "maxParticles"}
       }
     },
     {
-      name = "TextToPascal",
-      description = "Get Pascal case notation version of provided string",
-      returnType = "const char *",
+      name = "IsParticleSystemReady",
+      description = "Check if a particle system is ready",
+      returnType = "bool",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "ParticleSystem", name = "system"}
       }
     },
     {
-      name = "TextToInteger",
-      description = "Get integer value from text (negative values not supported)",
-      returnType = "int",
+      name = "UnloadParticleSystem",
+      description = "Unload particle system (GPU buffers and shaders or CPU particles)",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "text"}
+        {type = "ParticleSystem", name = "system"}
       }
     },
     {
-      name = "DrawLine3D",
-      description = "Draw a line in 3D world space",
+      name = "UpdateParticleSystem",
+      description = "Update particle system: spawn emitter particles, move particles and remove expired ones",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "startPos"},
-        {type = "Vector3", name = "endPos"},
-        {type = "Color", name = "color"}
+        {type = "ParticleSystem", name = "system"},
+        {type = "ParticleEmitter", name = "emitter"},
+        {type = "float", name = "deltaTime"}
       }
     },
     {
-      name = "DrawPoint3D",
-      description = "Draw a point in 3D space, actually a small line",
+      name = "DrawParticleSystem",
+      description = "Draw particle system particles as billboards facing camera",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "Color", name = "color"}
+        {type = "ParticleSystem", name = "system"},
+        {type = "Camera", name = "camera"},
+        {type = "Texture2D", name = "texture"}
       }
     },
     {
-      name = "DrawCircle3D",
-      description = "Draw a circle in 3D world space",
-      returnType = "void",
+      name = "GetParticleCount",
+      description = "Get particle system particles alive (GPU simulated: read back from GPU, stalls pipeline)",
+      returnType = "int",
       params = {
-        {type = "Vector3", name = "center"},
-        {type = "float", name = "radius"},
-        {type = "Vector3", name = "rotationAxis"},
-        {type = "float", name = "rotationAngle"},
-        {type = "Color", name = "color"}
+        {type = "ParticleSystem", name = "system"}
       }
     },
     {
-      name = "DrawTriangle3D",
-      description = "Draw a color-filled triangle (vertex in counter-clockwise order!)",
-      returnType = "void",
+      name = "LoadShadowMap",
+      description = "Load directional light shadow map, cascades cover distance from camera",
+      returnType = "ShadowMap",
       params = {
-        {type = "Vector3", name = "v1"},
-        {type = "Vector3", name = "v2"},
-        {type = "Vector3", name = "v3"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "size"},
+        {type = "int", name = "cascades"},
+        {type = "float", name = "distance"}
       }
     },
     {
-      name = "DrawTriangleStrip3D",
-      description = "Draw a triangle strip defined by points",
-      returnType = "void",
+      name = "LoadShadowMapSpot",
+      description = "Load spot light shadow map (cone angle in degrees)",
+      returnType = "ShadowMap",
       params = {
-        {type = "Vector3 *", name = "points"},
-        {type = "int", name = "pointCount"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "size"},
+        {type = "float", name = "angle"},
+        {type = "float", name = "range"}
       }
     },
     {
-      name = "DrawCube",
-      description = "Draw cube",
-      returnType = "void",
+      name = "IsShadowMapReady",
+      description = "Check if a shadow map is ready",
+      returnType = "bool",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "width"},
-        {type = "float", name = "height"},
-        {type = "float", name = "length"},
-        {type = "Color", name = "color"}
+        {type = "ShadowMap", name = "shadow"}
       }
     },
     {
-      name = "DrawCubeV",
-      description = "Draw cube (Vector version)",
+      name = "UnloadShadowMap",
+      description = "Unload shadow map from GPU memory (VRAM)",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "Vector3", name = "size"},
-        {type = "Color", name = "color"}
+        {type = "ShadowMap", name = "shadow"}
       }
     },
     {
-      name = "DrawCubeWires",
-      description = "Draw cube wires",
+      name = "UpdateShadowMap",
+      description = "Update shadow map cascades for camera and light (position used by spot lights)",
       returnType = "void",
       params = {
+        {type = "ShadowMap *", name = "shadow"},
+        {type = "Camera", name = "camera"},
         {type = "Vector3", name = "position"},
-        {type = "float", name = "width"},
-        {type = "float", name = "height"},
-        {type = "float", name = "length"},
-        {type = "Color", name = "color"}
+        {type = "Vector3", name = "direction"}
       }
     },
     {
-      name = "DrawCubeWiresV",
-      description = "Draw cube wires (Vector version)",
+      name = "InvalidateShadowMap",
+      description = "Invalidate shadow map static casters cache (static casters changed)",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "Vector3", name = "size"},
-        {type = "Color", name = "color"}
+        {type = "ShadowMap *", name = "shadow"}
       }
     },
     {
-      name = "DrawSphere",
-      description = "Draw sphere",
-      returnType = "void",
+      name = "BeginShadowMode",
+      description = "Begin drawing shadow casters into cascade, static casters pass returns false if cache is valid",
+      returnType = "bool",
       params = {
-        {type = "Vector3", name = "centerPos"},
-        {type = "float", name = "radius"},
-        {type = "Color", name = "color"}
+        {type = "ShadowMap *", name = "shadow"},
+        {type = "int", name = "cascade"},
+        {type = "bool", name = "staticCasters"}
       }
     },
     {
-      name = "DrawSphereEx",
-      description = "Draw sphere with extended parameters",
+      name = "EndShadowMode",
+      description = "End drawing shadow casters",
+      returnType = "void"
+    },
+    {
+      name = "SetShaderShadowMap",
+      description = "Set shader shadow map uniforms and bind shadow depth texture",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "centerPos"},
-        {type = "float", name = "radius"},
-        {type = "int", name = "rings"},
-        {type = "int", name = "slices"},
-        {type = "Color", name = "color"}
+        {type = "Shader", name = "shader"},
+        {type = "ShadowMap", name = "shadow"}
       }
     },
     {
-      name = "DrawSphereWires",
-      description = "Draw sphere wires",
-      returnType = "void",
+      name = "LoadLightClusters",
+      description = "Load light clusters for clustered forward lighting (requires OpenGL 3.3)",
+      returnType = "LightClusters",
       params = {
-        {type = "Vector3", name = "centerPos"},
-        {type = "float", name = "radius"},
-        {type = "int", name = "rings"},
-        {type = "int", name = "slices"},
-        {type = "Color", name = "color"}
+        {type = "int", name = "maxLights"}
       }
     },
     {
-      name = "DrawCylinder",
-      description = "Draw a cylinder/cone",
-      returnType = "void",
+      name = "IsLightClustersReady",
+      description = "Check if light clusters are ready",
+      returnType = "bool",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "radiusTop"},
-        {type = "float", name = "radiusBottom"},
-        {type = "float", name = "height"},
-        {type = "int", name = "slices"},
-        {type = "Color", name = "color"}
+        {type = "LightClusters", name = "clusters"}
       }
     },
     {
-      name = "DrawCylinderEx",
-      description = "Draw a cylinder with base at startPos and top at endPos",
+      name = "UnloadLightClusters",
+      description = "Unload light clusters from CPU and GPU memory",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "startPos"},
-        {type = "Vector3", name = "endPos"},
-        {type = "float", name = "startRadius"},
-        {type = "float", name = "endRadius"},
-        {type = "int", name = "sides"},
-        {type = "Color", name = "color"}
+        {type = "LightClusters", name = "clusters"}
       }
     },
     {
-      name = "DrawCylinderWires",
-      description = "Draw a cylinder/cone wires",
+      name = "UpdateLightClusters",
+      description = "Update lights and bin them into camera view clusters (current render size)",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "radiusTop"},
-        {type = "float", name = "radiusBottom"},
-        {type = "float", name = "height"},
-        {type = "int", name = "slices"},
-        {type = "Color", name = "color"}
+        {type = "LightClusters *", name = "clusters"},
+        {type = "Camera", name = "camera"},
+        {type = "const ClusterLight *", name = "lights"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "DrawCylinderWiresEx",
-      description = "Draw a cylinder wires with base at startPos and top at endPos",
+      name = "LoadShaderLightClusters",
+      description = "Load standard material shader with clustered lighting (diffuse, specular, ambient)",
+      returnType = "Shader"
+    },
+    {
+      name = "SetShaderLightClusters",
+      description = "Set shader light clusters uniforms and bind clusters textures",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "startPos"},
-        {type = "Vector3", name = "endPos"},
-        {type = "float", name = "startRadius"},
-        {type = "float", name = "endRadius"},
-        {type = "int", name = "sides"},
-        {type = "Color", name = "color"}
+        {type = "Shader", name = "shader"},
+        {type = "LightClusters", name = "clusters"}
       }
     },
     {
-      name = "DrawCapsule",
-      description = "Draw a capsule with the center of its sphere caps at startPos and endPos",
+      name = "UploadMesh",
+      description = "Upload mesh vertex data in GPU and provide VAO/VBO ids",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "startPos"},
-        {type = "Vector3", name = "endPos"},
-        {type = "float", name = "radius"},
-        {type = "int", name = "slices"},
-        {type = "int", name = "rings"},
-        {type = "Color", name = "color"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "bool", name = "dynamic"}
       }
     },
     {
-      name = "DrawCapsuleWires",
-      description = "Draw capsule wireframe with the center of its sphere caps at startPos and endPos",
+      name = "UploadMeshPacked",
+      description = "Upload mesh vertex data in GPU with packed attributes (MeshPackFlags), uploaded meshes are uploaded again",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "startPos"},
-        {type = "Vector3", name = "endPos"},
-        {type = "float", name = "radius"},
-        {type = "int", name = "slices"},
-        {type = "int", name = "rings"},
-        {type = "Color", name = "color"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "bool", name = "dynamic"},
+        {type = "unsigned int", name = "flags"}
       }
     },
     {
-      name = "DrawPlane",
-      description = "Draw a plane XZ",
+      name = "GetMeshPackedTransform",
+      description = "Get mesh packed positions dequantization transform (identity if positions not packed)",
+      returnType = "Matrix",
+      params = {
+        {type = "Mesh", name = "mesh"}
+      }
+    },
+    {
+      name = "ReleaseMeshData",
+      description = "Release mesh CPU vertex data not required after upload, attributes in keepFlags are kept (MeshDataFlags)",
       returnType = "void",
       params = {
-        {type = "Vector3", name = "centerPos"},
-        {type = "Vector2", name = "size"},
-        {type = "Color", name = "color"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "unsigned int", name = "keepFlags"}
       }
     },
     {
-      name = "DrawRay",
-      description = "Draw a ray line",
+      name = "UpdateMeshBuffer",
+      description = "Update mesh vertex data in GPU for a specific buffer index",
       returnType = "void",
       params = {
-        {type = "Ray", name = "ray"},
-        {type = "Color", name = "color"}
+        {type = "Mesh", name = "mesh"},
+        {type = "int", name = "index"},
+        {type = "const void *", name = "data"},
+        {type = "int", name = "dataSize"},
+        {type = "int", name = "offset"}
       }
     },
     {
-      name = "DrawGrid",
-      description = "Draw a grid (centered at (0, 0, 0))",
+      name = "UpdateMeshVertices",
+      description = "Update mesh vertex positions range (data NULL: CPU data already updated), dynamic meshes upload on draw",
       returnType = "void",
       params = {
-        {type = "int", name = "slices"},
-        {type = "float", name = "spacing"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "first"},
+        {type = "int", name = "count"},
+        {type = "const Vector3 *", name = "vertices"}
       }
     },
     {
-      name = "LoadModel",
-      description = "Load model from files (meshes and materials)",
-      returnType = "Model",
+      name = "UpdateMeshNormals",
+      description = "Update mesh vertex normals range",
+      returnType = "void",
       params = {
-        {type = "const char *", name = "fileName"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "first"},
+        {type = "int", name = "count"},
+        {type = "const Vector3 *", name = "normals"}
       }
     },
     {
-      name = "LoadModelFromMesh",
-      description = "Load model from generated mesh (default material)",
-      returnType = "Model",
+      name = "UpdateMeshTexcoords",
+      description = "Update mesh vertex texture coordinates range",
+      returnType = "void",
       params = {
-        {type = "Mesh", name = "mesh"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "first"},
+        {type = "int", name = "count"},
+        {type = "const Vector2 *", name = "texcoords"}
       }
     },
     {
-      name = "IsModelReady",
-      description = "Check if a model is ready",
-      returnType = "bool",
+      name = "UpdateMeshColors",
+      description = "Update mesh vertex colors range",
+      returnType = "void",
       params = {
-        {type = "Model", name = "model"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "first"},
+        {type = "int", name = "count"},
+        {type = "const Color *", name = "colors"}
       }
     },
     {
-      name = "UnloadModel",
-      description = "Unload model (including meshes) from memory (RAM and/or VRAM)",
+      name = "UpdateMeshIndices",
+      description = "Update mesh indices range (indexed meshes)",
       returnType = "void",
       params = {
-        {type = "Model", name = "model"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "first"},
+        {type = "int", name = "count"},
+        {type = "const unsigned short *", name = "indices"}
       }
     },
     {
-      name = "GetModelBoundingBox",
-      description = "Compute model bounding box limits (considers all meshes)",
-      returnType = "BoundingBox",
+      name = "ResizeMesh",
+      description = "Resize mesh vertex data and triangles, GPU buffers grow as required (no upload again)",
+      returnType = "void",
       params = {
-        {type = "Model", name = "model"}
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "vertexCount"},
+        {type = "int", name = "triangleCount"}
       }
     },
     {
-      name = "DrawModel",
-      description = "Draw a model (with texture if set)",
+      name = "UnloadMesh",
+      description = "Unload mesh data from CPU and GPU",
       returnType = "void",
       params = {
-        {type = "Model", name = "model"},
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "scale"},
-        {type = "Color", name = "tint"}
+        {type = "Mesh", name = "mesh"}
       }
     },
     {
-      name = "DrawModelEx",
-      description = "Draw a model with extended parameters",
+      name = "DrawMesh",
+      description = "Draw a 3d mesh with material and transform",
       returnType = "void",
       params = {
-        {type = "Model", name = "model"},
-        {type = "Vector3", name = "position"},
-        {type = "Vector3", name = "rotationAxis"},
-        {type = "float", name = "rotationAngle"},
-        {type = "Vector3", name = "scale"},
-        {type = "Color", name = "tint"}
+        {type = "Mesh", name = "mesh"},
+        {type = "Material", name = "material"},
+        {type = "Matrix", name = "transform"}
       }
     },
     {
-      name = "DrawModelWires",
-      description = "Draw a model wires (with texture if set)",
+      name = "BeginMeshQueue",
+      description = "Begin mesh draws queue, DrawMesh() calls are queued until EndMeshQueue()",
+      returnType = "void"
+    },
+    {
+      name = "EndMeshQueue",
+      description = "End mesh draws queue, queued draws are sorted by state and submitted (instanced when possible)",
+      returnType = "void"
+    },
+    {
+      name = "DrawMeshInstanced",
+      description = "Draw multiple mesh instances with material and different transforms",
       returnType = "void",
       params = {
-        {type = "Model", name = "model"},
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "scale"},
-        {type = "Color", name = "tint"}
+        {type = "Mesh", name = "mesh"},
+        {type = "Material", name = "material"},
+        {type = "const Matrix *", name = "transforms"},
+        {type = "int", name = "instances"}
       }
     },
     {
-      name = "DrawModelWiresEx",
-      description = "Draw a model wires (with texture if set) with extended parameters",
-      returnType = "void",
+      name = "LoadMeshInstanceBuffer",
+      description = "Load mesh instances transforms buffer into GPU (transforms can be NULL)",
+      returnType = "MeshInstanceBuffer",
       params = {
-        {type = "Model", name = "model"},
-        {type = "Vector3", name = "position"},
-        {type = "Vector3", name = "rotationAxis"},
-        {type = "float", name = "rotationAngle"},
-        {type = "Vector3", name = "scale"},
-        {type = "Color", name = "tint"}
+        {type = "const Matrix *", name = "transforms"},
+        {type = "int", name = "instances"},
+        {type = "bool", name = "dynamic"}
       }
     },
     {
-      name = "DrawBoundingBox",
-      description = "Draw bounding box (wires)",
+      name = "UpdateMeshInstanceBuffer",
+      description = "Update mesh instances transforms buffer (partial update, offset and count in instances)",
       returnType = "void",
       params = {
-        {type = "BoundingBox", name = "box"},
-        {type = "Color", name = "color"}
+        {type = "MeshInstanceBuffer", name = "buffer"},
+        {type = "const Matrix *", name = "transforms"},
+        {type = "int", name = "offset"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "DrawBillboard",
-      description = "Draw a billboard texture",
+      name = "UpdateMeshInstanceColors",
+      description = "Update mesh instances colors (colors buffer loaded on first update)",
       returnType = "void",
       params = {
-        {type = "Camera", name = "camera"},
-        {type = "Texture2D", name = "texture"},
-        {type = "Vector3", name = "position"},
-        {type = "float", name = "size"},
-        {type = "Color", name = "tint"}
+        {type = "MeshInstanceBuffer *", name = "buffer"},
+        {type = "const Color *", name = "colors"},
+        {type = "int", name = "offset"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "DrawBillboardRec",
-      description = "Draw a billboard texture defined by source",
+      name = "UpdateMeshInstanceAttribute",
+      description = "Update mesh instances custom attribute (buffer loaded on first update, max 4 attributes)",
       returnType = "void",
       params = {
-        {type = "Camera", name = "camera"},
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "source"},
-        {type = "Vector3", name = "position"},
-        {type = "Vector2", name = "size"},
-        {type = "Color", name = "tint"}
+        {type = "MeshInstanceBuffer *", name = "buffer"},
+        {type = "int", name = "attribLoc"},
+        {type = "const float *", name = "values"},
+        {type = "int", name = "components"},
+        {type = "int", name = "offset"},
+        {type = "int", name = "count"}
       }
     },
     {
-      name = "DrawBillboardPro",
-      description = "Draw a billboard texture defined by source and rotation",
+      name = "UnloadMeshInstanceBuffer",
+      description = "Unload mesh instances buffers from GPU (transforms, colors and attributes)",
       returnType = "void",
       params = {
-        {type = "Camera", name = "camera"},
-        {type = "Texture2D", name = "texture"},
-        {type = "Rectangle", name = "source"},
-        {type = "Vector3", name = "position"},
-        {type = "Vector3", name = "up"},
-        {type = "Vector2", name = "size"},
-        {type = "Vector2", name = "origin"},
-        {type = "float", name = "rotation"},
-        {type = "Color", name = "tint"}
+        {type = "MeshInstanceBuffer", name = "buffer"}
       }
     },
     {
-      name = "UploadMesh",
-      description = "Upload mesh vertex data in GPU and provide VAO/VBO ids",
+      name = "DrawMeshInstancedBuffer",
+      description = "Draw multiple mesh instances with material and transforms stored in GPU buffer",
       returnType = "void",
       params = {
-        {type = "Mesh *", name = "mesh"},
-        {type = "bool", name = "dynamic"}
+        {type = "Mesh", name = "mesh"},
+        {type = "Material", name = "material"},
+        {type = "MeshInstanceBuffer", name = "buffer"},
+        {type = "int", name = "instances"}
       }
     },
     {
-      name = "UpdateMeshBuffer",
-      description = "Update mesh vertex data in GPU for a specific buffer index",
-      returnType = "void",
+      name = "LoadMeshInstanceCuller",
+      description = "Load mesh instances GPU frustum culler (OpenGL 4.3)",
+      returnType = "MeshInstanceCuller",
       params = {
         {type = "Mesh", name = "mesh"},
-        {type = "int", name = "index"},
-        {type = "const void *", name = "data"},
-        {type = "int", name = "dataSize"},
-        {type = "int", name = "offset"}
+        {type = "int", name = "maxInstances"}
       }
     },
     {
-      name = "UnloadMesh",
-      description = "Unload mesh data from CPU and GPU",
+      name = "UnloadMeshInstanceCuller",
+      description = "Unload mesh instances GPU frustum culler",
       returnType = "void",
       params = {
-        {type = "Mesh", name = "mesh"}
+        {type = "MeshInstanceCuller", name = "culler"}
       }
     },
     {
-      name = "DrawMesh",
-      description = "Draw a 3d mesh with material and transform",
+      name = "CullMeshInstances",
+      description = "Cull mesh instances against current camera frustum, visible instances are compacted on GPU",
       returnType = "void",
       params = {
-        {type = "Mesh", name = "mesh"},
-        {type = "Material", name = "material"},
-        {type = "Matrix", name = "transform"}
+        {type = "MeshInstanceCuller", name = "culler"},
+        {type = "MeshInstanceBuffer", name = "buffer"},
+        {type = "int", name = "instances"}
       }
     },
     {
-      name = "DrawMeshInstanced",
-      description = "Draw multiple mesh instances with material and different transforms",
+      name = "DrawMeshInstancedCulled",
+      description = "Draw mesh instances visible after last CullMeshInstances() (indirect draw)",
       returnType = "void",
       params = {
         {type = "Mesh", name = "mesh"},
         {type = "Material", name = "material"},
-        {type = "const Matrix *", name = "transforms"},
-        {type = "int", name = "instances"}
+        {type = "MeshInstanceCuller", name = "culler"}
       }
     },
     {
@@ -6772,6 +12088,35 @@ return {
         {type = "Mesh *", name = "mesh"}
       }
     },
+    {
+      name = "OptimizeMesh",
+      description = "Optimize mesh indices and vertices order for GPU rendering (MeshOptimizeFlags)",
+      returnType = "void",
+      params = {
+        {type = "Mesh *", name = "mesh"},
+        {type = "unsigned int", name = "flags"}
+      }
+    },
+    {
+      name = "GenMeshLODs",
+      description = "Generate mesh LOD levels (simplified indices sharing mesh vertices), error relative to mesh size",
+      returnType = "void",
+      params = {
+        {type = "Mesh *", name = "mesh"},
+        {type = "int", name = "levels"},
+        {type = "float", name = "targetError"}
+      }
+    },
+    {
+      name = "SetMeshMorphWeights",
+      description = "Set mesh morph targets weights (morphed on GPU if supported, on CPU otherwise)",
+      returnType = "void",
+      params = {
+        {type = "Mesh *", name = "mesh"},
+        {type = "const float *", name = "weights"},
+        {type = "int", name = "count"}
+      }
+    },
     {
       name = "GenMeshPoly",
       description = "Generate polygonal mesh",
@@ -6882,6 +12227,64 @@ return {
         {type = "Vector3", name = "cubeSize"}
       }
     },
+    {
+      name = "GenMeshes",
+      description = "Generate meshes shapes in parallel (jobs system), uploaded to GPU",
+      returnType = "void",
+      params = {
+        {type = "Mesh *", name = "meshes"},
+        {type = "const MeshGenParams *", name = "params"},
+        {type = "int", name = "count"}
+      }
+    },
+    {
+      name = "LoadTerrain",
+      description = "Load terrain from heightmap image, split in chunks of size (power of two) with LOD levels",
+      returnType = "Terrain",
+      params = {
+        {type = "Image", name = "heightmap"},
+        {type = "Vector3", name = "size"},
+        {type = "int", name = "chunkSize"},
+        {type = "int", name = "lodCount"}
+      }
+    },
+    {
+      name = "UnloadTerrain",
+      description = "Unload terrain chunks meshes and heightmap data (waits for pending chunks)",
+      returnType = "void",
+      params = {
+        {type = "Terrain", name = "terrain"}
+      }
+    },
+    {
+      name = "UpdateTerrain",
+      description = "Update terrain chunks LOD levels by view distance (terrain space), meshes generated on loader thread",
+      returnType = "void",
+      params = {
+        {type = "Terrain *", name = "terrain"},
+        {type = "Vector3", name = "viewPosition"}
+      }
+    },
+    {
+      name = "DrawTerrain",
+      description = "Draw terrain loaded chunks visible in view frustum",
+      returnType = "void",
+      params = {
+        {type = "Terrain", name = "terrain"},
+        {type = "Material", name = "material"},
+        {type = "Matrix", name = "transform"}
+      }
+    },
+    {
+      name = "GetTerrainHeight",
+      description = "Get terrain height at position (terrain space, bilinear)",
+      returnType = "float",
+      params = {
+        {type = "Terrain", name = "terrain"},
+        {type = "float", name = "x"},
+        {type = "float", name = "z"}
+      }
+    },
     {
       name = "LoadMaterials",
       description = "Load materials from model file",
@@ -6951,6 +12354,46 @@ return {
         {type = "int", name = "frame"}
       }
     },
+    {
+      name = "UpdateModelAnimationBones",
+      description = "Update model animation bones matrices (GPU skinning)",
+      returnType = "void",
+      params = {
+        {type = "Model", name = "model"},
+        {type = "ModelAnimation", name = "anim"},
+        {type = "int", name = "frame"}
+      }
+    },
+    {
+      name = "UpdateModelAnimationEx",
+      description = "Update model animations blended pose at time (interpolated frames)",
+      returnType = "void",
+      params = {
+        {type = "Model", name = "model"},
+        {type = "const ModelAnimation *", name = "anims"},
+        {type = "const float *", name = "weights"},
+        {type = "int", name = "count"},
+        {type = "float", name = "time"}
+      }
+    },
+    {
+      name = "CompressModelAnimation",
+      description = "Compress animation poses (quantized, constant tracks removed), framePoses are unloaded",
+      returnType = "void",
+      params = {
+        {type = "ModelAnimation *", name = "anim"}
+      }
+    },
+    {
+      name = "GetModelAnimationPose",
+      description = "Get animation frame pose (boneCount transforms), decompressed if required",
+      returnType = "void",
+      params = {
+        {type = "ModelAnimation", name = "anim"},
+        {type = "int", name = "frame"},
+        {type = "Transform *", name = "pose"}
+      }
+    },
     {
       name = "UnloadModelAnimation",
       description = "Unload animation data",
@@ -6977,6 +12420,15 @@ return {
         {type = "ModelAnimation", name = "anim"}
       }
     },
+    {
+      name = "GetModelBoneTransform",
+      description = "Get model bone transform for current pose (model transform applied), bones attachments",
+      returnType = "Matrix",
+      params = {
+        {type = "Model", name = "model"},
+        {type = "int", name = "boneId"}
+      }
+    },
     {
       name = "CheckCollisionSpheres",
       description = "Check collision between two spheres",
@@ -6989,20 +12441,50 @@ return {
       }
     },
     {
-      name = "CheckCollisionBoxes",
-      description = "Check collision between two bounding boxes",
+      name = "CheckCollisionBoxes",
+      description = "Check collision between two bounding boxes",
+      returnType = "bool",
+      params = {
+        {type = "BoundingBox", name = "box1"},
+        {type = "BoundingBox", name = "box2"}
+      }
+    },
+    {
+      name = "CheckCollisionBoxSphere",
+      description = "Check collision between box and sphere",
+      returnType = "bool",
+      params = {
+        {type = "BoundingBox", name = "box"},
+        {type = "Vector3", name = "center"},
+        {type = "float", name = "radius"}
+      }
+    },
+    {
+      name = "CheckCollisionBoxesBatch",
+      description = "Check collision between box and boxes array, returns colliding boxes count",
+      returnType = "int",
+      params = {
+        {type = "BoundingBox", name = "box"},
+        {type = "const BoundingBox *", name = "boxes"},
+        {type = "int", name = "count"},
+        {type = "bool *", name = "results"}
+      }
+    },
+    {
+      name = "CheckFrustumBox",
+      description = "Check if box is inside or intersects frustum",
       returnType = "bool",
       params = {
-        {type = "BoundingBox", name = "box1"},
-        {type = "BoundingBox", name = "box2"}
+        {type = "Frustum", name = "frustum"},
+        {type = "BoundingBox", name = "box"}
       }
     },
     {
-      name = "CheckCollisionBoxSphere",
-      description = "Check collision between box and sphere",
+      name = "CheckFrustumSphere",
+      description = "Check if sphere is inside or intersects frustum",
       returnType = "bool",
       params = {
-        {type = "BoundingBox", name = "box"},
+        {type = "Frustum", name = "frustum"},
         {type = "Vector3", name = "center"},
         {type = "float", name = "radius"}
       }
@@ -7026,6 +12508,17 @@ return {
         {type = "BoundingBox", name = "box"}
       }
     },
+    {
+      name = "GetRayCollisionBoxes",
+      description = "Get collision info between ray and boxes array (nearest hit box)",
+      returnType = "RayCollision",
+      params = {
+        {type = "Ray", name = "ray"},
+        {type = "const BoundingBox *", name = "boxes"},
+        {type = "int", name = "count"},
+        {type = "int *", name = "hitIndex"}
+      }
+    },
     {
       name = "GetRayCollisionMesh",
       description = "Get collision info between ray and mesh",
@@ -7036,6 +12529,32 @@ return {
         {type = "Matrix", name = "transform"}
       }
     },
+    {
+      name = "LoadMeshBVH",
+      description = "Load mesh bounding volume hierarchy (SAH), ray picking acceleration",
+      returnType = "MeshBVH",
+      params = {
+        {type = "Mesh", name = "mesh"}
+      }
+    },
+    {
+      name = "UnloadMeshBVH",
+      description = "Unload mesh bounding volume hierarchy",
+      returnType = "void",
+      params = {
+        {type = "MeshBVH", name = "bvh"}
+      }
+    },
+    {
+      name = "GetRayCollisionMeshBVH",
+      description = "Get collision info between ray and mesh bounding volume hierarchy",
+      returnType = "RayCollision",
+      params = {
+        {type = "Ray", name = "ray"},
+        {type = "MeshBVH", name = "bvh"},
+        {type = "Matrix", name = "transform"}
+      }
+    },
     {
       name = "GetRayCollisionTriangle",
       description = "Get collision info between ray and triangle",
@@ -7047,6 +12566,17 @@ return {
         {type = "Vector3", name = "p3"}
       }
     },
+    {
+      name = "GetRayCollisionTriangles",
+      description = "Get collision info between ray and triangles array (3 vertices per triangle, nearest hit)",
+      returnType = "RayCollision",
+      params = {
+        {type = "Ray", name = "ray"},
+        {type = "const Vector3 *", name = "vertices"},
+        {type = "int", name = "triangleCount"},
+        {type = "int *", name = "hitIndex"}
+      }
+    },
     {
       name = "GetRayCollisionQuad",
       description = "Get collision info between ray and quad",
@@ -7064,6 +12594,24 @@ return {
       description = "Initialize audio device and context",
       returnType = "void"
     },
+    {
+      name = "InitAudioDeviceOffline",
+      description = "Initialize offline audio device, audio mixed on RenderAudioFrames() (no playback)",
+      returnType = "void",
+      params = {
+        {type = "unsigned int", name = "sampleRate"},
+        {type = "unsigned int", name = "channels"}
+      }
+    },
+    {
+      name = "RenderAudioFrames",
+      description = "Render audio frames with offline device (interleaved float samples)",
+      returnType = "void",
+      params = {
+        {type = "float *", name = "frames"},
+        {type = "int", name = "frameCount"}
+      }
+    },
     {
       name = "CloseAudioDevice",
       description = "Close the audio device and context",
@@ -7082,6 +12630,11 @@ return {
         {type = "float", name = "volume"}
       }
     },
+    {
+      name = "GetAudioTime",
+      description = "Get audio device time in seconds (device frames mixed), used to schedule sounds",
+      returnType = "double"
+    },
     {
       name = "LoadWave",
       description = "Load wave data from file",
@@ -7116,6 +12669,40 @@ return {
         {type = "const char *", name = "fileName"}
       }
     },
+    {
+      name = "LoadSoundAsync",
+      description = "Load sound from file asynchronously, returns request id (-1: failed)",
+      returnType = "int",
+      params = {
+        {type = "const char *", name = "fileName"}
+      }
+    },
+    {
+      name = "GetSoundAsync",
+      description = "Get async loaded sound, request is released (empty if not ready)",
+      returnType = "Sound",
+      params = {
+        {type = "int", name = "request"}
+      }
+    },
+    {
+      name = "LoadSoundsAsync",
+      description = "Load sounds from files asynchronously, decoded in parallel on jobs system, returns request id (-1: failed)",
+      returnType = "int",
+      params = {
+        {type = "const char **", name = "fileNames"},
+        {type = "int", name = "count"}
+      }
+    },
+    {
+      name = "GetSoundsAsync",
+      description = "Get async loaded sounds, request is released, returns sounds count (0: not ready)",
+      returnType = "int",
+      params = {
+        {type = "int", name = "request"},
+        {type = "Sound *", name = "sounds"}
+      }
+    },
     {
       name = "LoadSoundFromWave",
       description = "Load sound from wave data",
@@ -7124,6 +12711,14 @@ return {
         {type = "Wave", name = "wave"}
       }
     },
+    {
+      name = "SetSoundStorageDefault",
+      description = "Set storage for new sounds (SoundStorage), compact storages are decoded on mixing",
+      returnType = "void",
+      params = {
+        {type = "int", name = "storage"}
+      }
+    },
     {
       name = "IsSoundReady",
       description = "Checks if a sound is ready",
@@ -7184,6 +12779,15 @@ return {
         {type = "Sound", name = "sound"}
       }
     },
+    {
+      name = "PlaySoundAt",
+      description = "Play a sound at audio device time (sample accurate), check GetAudioTime()",
+      returnType = "void",
+      params = {
+        {type = "Sound", name = "sound"},
+        {type = "double", name = "audioTime"}
+      }
+    },
     {
       name = "StopSound",
       description = "Stop playing a sound",
@@ -7243,6 +12847,111 @@ return {
         {type = "float", name = "pan"}
       }
     },
+    {
+      name = "PlaySoundInstance",
+      description = "Play a sound instance on a pooled voice sharing sound data, returns instance id (-1: no voice available)",
+      returnType = "int",
+      params = {
+        {type = "Sound", name = "sound"},
+        {type = "int", name = "priority"}
+      }
+    },
+    {
+      name = "StopSoundInstance",
+      description = "Stop a sound instance",
+      returnType = "void",
+      params = {
+        {type = "int", name = "instance"}
+      }
+    },
+    {
+      name = "IsSoundInstancePlaying",
+      description = "Check if a sound instance is currently playing",
+      returnType = "bool",
+      params = {
+        {type = "int", name = "instance"}
+      }
+    },
+    {
+      name = "SetSoundInstanceVolume",
+      description = "Set volume for a sound instance (1.0 is max level)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "instance"},
+        {type = "float", name = "volume"}
+      }
+    },
+    {
+      name = "SetSoundInstancePitch",
+      description = "Set pitch for a sound instance (1.0 is base level)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "instance"},
+        {type = "float", name = "pitch"}
+      }
+    },
+    {
+      name = "SetSoundInstancePan",
+      description = "Set pan for a sound instance (0.5 is center)",
+      returnType = "void",
+      params = {
+        {type = "int", name = "instance"},
+        {type = "float", name = "pan"}
+      }
+    },
+    {
+      name = "UpdateAudioListener",
+      description = "Update audio listener, spatial sounds are updated on audio thread (once per frame)",
+      returnType = "void",
+      params = {
+        {type = "Vector3", name = "position"},
+        {type = "Vector3", name = "forward"},
+        {type = "Vector3", name = "up"},
+        {type = "Vector3", name = "velocity"}
+      }
+    },
+    {
+      name = "SetAudioDistanceModel",
+      description = "Set spatial sounds distance model (AudioDistanceModel), applied on next listener update",
+      returnType = "void",
+      params = {
+        {type = "int", name = "model"},
+        {type = "float", name = "refDistance"},
+        {type = "float", name = "maxDistance"},
+        {type = "float", name = "rolloff"}
+      }
+    },
+    {
+      name = "SetAudioDopplerFactor",
+      description = "Set spatial sounds doppler factor (0.0f: disabled) and speed of sound, applied on next listener update",
+      returnType = "void",
+      params = {
+        {type = "float", name = "factor"},
+        {type = "float", name = "speedOfSound"}
+      }
+    },
+    {
+      name = "SetSoundPositions",
+      description = "Set sounds positions and velocities (optional), sounds become spatial (single batched update)",
+      returnType = "void",
+      params = {
+        {type = "const Sound *", name = "sounds"},
+        {type = "const Vector3 *", name = "positions"},
+        {type = "const Vector3 *", name = "velocities"},
+        {type = "int", name = "count"}
+      }
+    },
+    {
+      name = "SetSoundInstancePositions",
+      description = "Set sound instances positions and velocities (optional), instances become spatial",
+      returnType = "void",
+      params = {
+        {type = "const int *", name = "instances"},
+        {type = "const Vector3 *", name = "positions"},
+        {type = "const Vector3 *", name = "velocities"},
+        {type = "int", name = "count"}
+      }
+    },
     {
       name = "WaveCopy",
       description = "Copy a wave to a new wave",
@@ -7541,6 +13250,23 @@ return {
         {type = "int", name = "size"}
       }
     },
+    {
+      name = "SetAudioStreamBufferCountDefault",
+      description = "Default sub-buffers count for new audio streams, grows up to maxCount on repeated underruns",
+      returnType = "void",
+      params = {
+        {type = "int", name = "count"},
+        {type = "int", name = "maxCount"}
+      }
+    },
+    {
+      name = "GetAudioStreamStats",
+      description = "Get audio stream buffering stats (sub-buffers, underruns, overruns)",
+      returnType = "AudioStreamStats",
+      params = {
+        {type = "AudioStream", name = "stream"}
+      }
+    },
     {
       name = "SetAudioStreamCallback",
       description = "Audio thread callback to request new data",
@@ -7583,6 +13309,155 @@ return {
       params = {
         {type = "AudioCallback", name = "processor"}
       }
+    },
+    {
+      name = "LoadAudioBus",
+      description = "Load audio bus, routed sounds and streams are mixed together and processed once",
+      returnType = "AudioBus"
+    },
+    {
+      name = "IsAudioBusReady",
+      description = "Checks if an audio bus is ready",
+      returnType = "bool",
+      params = {
+        {type = "AudioBus", name = "bus"}
+      }
+    },
+    {
+      name = "UnloadAudioBus",
+      description = "Unload audio bus, routed sounds and streams are mixed into output",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"}
+      }
+    },
+    {
+      name = "SetAudioBusVolume",
+      description = "Set volume for an audio bus (1.0 is max level)",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"},
+        {type = "float", name = "volume"}
+      }
+    },
+    {
+      name = "SetAudioBusFilter",
+      description = "Set audio bus filter (AudioFilterType), resonance is Q factor (0.707f: no resonance)",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"},
+        {type = "int", name = "type"},
+        {type = "float", name = "frequency"},
+        {type = "float", name = "resonance"}
+      }
+    },
+    {
+      name = "SetAudioBusReverb",
+      description = "Set audio bus reverb, mix is wet level (0.0f: reverb disabled)",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"},
+        {type = "float", name = "roomSize"},
+        {type = "float", name = "damping"},
+        {type = "float", name = "mix"}
+      }
+    },
+    {
+      name = "AttachAudioBusProcessor",
+      description = "Attach audio processor to bus, runs once over the bus mix (stereo float frames)",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"},
+        {type = "AudioCallback", name = "processor"}
+      }
+    },
+    {
+      name = "DetachAudioBusProcessor",
+      description = "Detach audio processor from bus",
+      returnType = "void",
+      params = {
+        {type = "AudioBus", name = "bus"},
+        {type = "AudioCallback", name = "processor"}
+      }
+    },
+    {
+      name = "SetAudioStreamBus",
+      description = "Route audio stream to bus (empty bus: output)",
+      returnType = "void",
+      params = {
+        {type = "AudioStream", name = "stream"},
+        {type = "AudioBus", name = "bus"}
+      }
+    },
+    {
+      name = "SetSoundBus",
+      description = "Route sound to bus (empty bus: output), instances use sound bus",
+      returnType = "void",
+      params = {
+        {type = "Sound", name = "sound"},
+        {type = "AudioBus", name = "bus"}
+      }
+    },
+    {
+      name = "LoadAudioCaptureStream",
+      description = "Load audio capture stream from default input device, capture starts right away (0: device default)",
+      returnType = "AudioCaptureStream",
+      params = {
+        {type = "unsigned int", name = "sampleRate"},
+        {type = "unsigned int", name = "channels"}
+      }
+    },
+    {
+      name = "IsAudioCaptureStreamReady",
+      description = "Checks if an audio capture stream is ready",
+      returnType = "bool",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"}
+      }
+    },
+    {
+      name = "UnloadAudioCaptureStream",
+      description = "Unload audio capture stream, capture device is stopped",
+      returnType = "void",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"}
+      }
+    },
+    {
+      name = "GetAudioCaptureStreamAvailable",
+      description = "Get audio capture stream frames available to read",
+      returnType = "int",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"}
+      }
+    },
+    {
+      name = "ReadAudioCaptureStream",
+      description = "Read captured frames (interleaved float samples), returns frames read (non-blocking)",
+      returnType = "int",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"},
+        {type = "float *", name = "frames"},
+        {type = "int", name = "frameCount"}
+      }
+    },
+    {
+      name = "AttachAudioCaptureProcessor",
+      description = "Attach audio processor to capture stream, runs on captured frames",
+      returnType = "void",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"},
+        {type = "AudioCallback", name = "processor"}
+      }
+    },
+    {
+      name = "DetachAudioCaptureProcessor",
+      description = "Detach audio processor from capture stream",
+      returnType = "void",
+      params = {
+        {type = "AudioCaptureStream", name = "stream"},
+        {type = "AudioCallback", name = "processor"}
+      }
     }
   }
 }
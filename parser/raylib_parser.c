@@ -48,6 +48,9 @@
 
      - This parser could work with other C header files if mentioned constraints are followed.
      - This parser does not require <string.h> library, all data is parsed directly from char buffers.
+     - Structs memory layout (size, alignment, fields offset and size) is not known by the parser, it is computed
+       by the compiler: LAYOUT format exports a C program that prints the layout of all parsed structs, its output
+       can be provided back (--layout) to include layout info in JSON, XML and LUA formats.
 
     LICENSE: zlib/libpng
 
@@ -66,15 +69,15 @@
 #include <ctype.h>              // Required for: isdigit()
 
 #define MAX_DEFINES_TO_PARSE    2048    // Maximum number of defines to parse
-#define MAX_STRUCTS_TO_PARSE      64    // Maximum number of structures to parse
-#define MAX_ALIASES_TO_PARSE      64    // Maximum number of aliases to parse
-#define MAX_ENUMS_TO_PARSE        64    // Maximum number of enums to parse
-#define MAX_CALLBACKS_TO_PARSE    64    // Maximum number of callbacks to parse
-#define MAX_FUNCS_TO_PARSE      1024    // Maximum number of functions to parse
+#define MAX_STRUCTS_TO_PARSE     256    // Maximum number of structures to parse
+#define MAX_ALIASES_TO_PARSE     128    // Maximum number of aliases to parse
+#define MAX_ENUMS_TO_PARSE       256    // Maximum number of enums to parse
+#define MAX_CALLBACKS_TO_PARSE   128    // Maximum number of callbacks to parse
+#define MAX_FUNCS_TO_PARSE      4096    // Maximum number of functions to parse
 
 #define MAX_LINE_LENGTH          512    // Maximum length of one line (including comments)
 
-#define MAX_STRUCT_FIELDS         64    // Maximum number of struct fields
+#define MAX_STRUCT_FIELDS        128    // Maximum number of struct fields
 #define MAX_ENUM_VALUES          512    // Maximum number of enum values
 #define MAX_FUNCTION_PARAMETERS   12    // Maximum number of function parameters
 
@@ -117,6 +120,11 @@ typedef struct StructInfo {
     char fieldType[MAX_STRUCT_FIELDS][64];     // Field type
     char fieldName[MAX_STRUCT_FIELDS][64];     // Field name
     char fieldDesc[MAX_STRUCT_FIELDS][128];    // Field description
+    bool hasLayout;             // Struct memory layout loaded (--layout)
+    int size;                   // Struct size in bytes
+    int alignment;              // Struct alignment in bytes
+    int fieldOffset[MAX_STRUCT_FIELDS];        // Field offset in bytes
+    int fieldSize[MAX_STRUCT_FIELDS];          // Field size in bytes
 } StructInfo;
 
 // Alias info data
@@ -148,7 +156,7 @@ typedef struct FunctionInfo {
 } FunctionInfo;
 
 // Output format for parsed data
-typedef enum { DEFAULT = 0, JSON, XML, LUA, CODE } OutputFormat;
+typedef enum { DEFAULT = 0, JSON, XML, LUA, CODE, LAYOUT } OutputFormat;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -171,6 +179,7 @@ static char apiDefine[32] = { 0 };         // Functions define (i.e. RLAPI for r
 static char truncAfter[32] = { 0 };        // Truncate marker (i.e. "RLGL IMPLEMENTATION" for rlgl.h)
 static char inFileName[512] = { 0 };       // Input file name (required in case of provided through CLI)
 static char outFileName[512] = { 0 };      // Output file name (required for file save/export)
+static char layoutFileName[512] = { 0 };   // Structs layout file name, generated by LAYOUT format program (optional)
 static int outputFormat = DEFAULT;
 
 //----------------------------------------------------------------------------------
@@ -191,6 +200,7 @@ static void MemoryCopy(void *dest, const void *src, unsigned int count);
 static char *EscapeBackslashes(char *text);                 // Replace '\' by "\\" when exporting to JSON and XML
 static const char *StrDefineType(DefineType type);          // Get string of define type
 
+static void LoadStructsLayout(const char *fileName);         // Load structs memory layout, printed by LAYOUT format program
 static void ExportParsedData(const char *fileName, int format); // Export parsed data in desired format
 
 //----------------------------------------------------------------------------------
@@ -260,6 +270,8 @@ int main(int argc, char* argv[])
         // Read define line
         if (IsTextEqual(lines[i]+j, "#define ", 8))
         {
+            if (defineCount >= MAX_DEFINES_TO_PARSE) { printf("WARNING: Defines limit reached (MAX_DEFINES_TO_PARSE: %i), remaining defines not parsed\n", MAX_DEFINES_TO_PARSE); break; }
+
             // Keep the line position in the array of lines,
             // so, we can scan that position and following lines
             defineLines[defineCount] = i;
@@ -287,6 +299,7 @@ int main(int argc, char* argv[])
                 }
             }
             if (!validStruct) continue;
+            if (structCount >= MAX_STRUCTS_TO_PARSE) { printf("WARNING: Structs limit reached (MAX_STRUCTS_TO_PARSE: %i), remaining structs not parsed\n", MAX_STRUCTS_TO_PARSE); break; }
             structLines[structCount] = i;
             while (lines[i][0] != '}') i++;
             while (lines[i][0] != '\0') i++;
@@ -311,6 +324,7 @@ int main(int argc, char* argv[])
                 if ((v == ';') || (v == '(') || (v == '\0')) break;
             }
             if (!validAlias) continue;
+            if (aliasCount >= MAX_ALIASES_TO_PARSE) { printf("WARNING: Aliases limit reached (MAX_ALIASES_TO_PARSE: %i), remaining aliases not parsed\n", MAX_ALIASES_TO_PARSE); break; }
             aliasLines[aliasCount] = i;
             aliasCount++;
         }
@@ -322,6 +336,8 @@ int main(int argc, char* argv[])
         // Read enum line
         if (IsTextEqual(lines[i], "typedef enum {", 14) && (lines[i][TextLength(lines[i])-1] != ';')) // ignore inline enums
         {
+            if (enumCount >= MAX_ENUMS_TO_PARSE) { printf("WARNING: Enums limit reached (MAX_ENUMS_TO_PARSE: %i), remaining enums not parsed\n", MAX_ENUMS_TO_PARSE); break; }
+
             // Keep the line position in the array of lines,
             // so, we can scan that position and following lines
             enumLines[enumCount] = i;
@@ -349,6 +365,7 @@ int main(int argc, char* argv[])
 
             if (hasBeginning && hasMiddle && hasEnd)
             {
+                if (callbackCount >= MAX_CALLBACKS_TO_PARSE) { printf("WARNING: Callbacks limit reached (MAX_CALLBACKS_TO_PARSE: %i), remaining callbacks not parsed\n", MAX_CALLBACKS_TO_PARSE); break; }
                 callbackLines[callbackCount] = i;
                 callbackCount++;
             }
@@ -361,6 +378,7 @@ int main(int argc, char* argv[])
         // Read function line (starting with `define`, i.e. for raylib.h "RLAPI")
         if (IsTextEqual(lines[i], apiDefine, TextLength(apiDefine)))
         {
+            if (funcCount >= MAX_FUNCS_TO_PARSE) { printf("WARNING: Functions limit reached (MAX_FUNCS_TO_PARSE: %i), remaining functions not parsed\n", MAX_FUNCS_TO_PARSE); break; }
             funcLines[funcCount] = i;
             funcCount++;
         }
@@ -1049,6 +1067,9 @@ int main(int argc, char* argv[])
     else if (outputFormat == XML) printf("\nOutput format:    XML\n\n");
     else if (outputFormat == LUA) printf("\nOutput format:    LUA\n\n");
     else if (outputFormat == CODE) printf("\nOutput format:    CODE\n\n");
+    else if (outputFormat == LAYOUT) printf("\nOutput format:    LAYOUT\n\n");
+
+    if (layoutFileName[0] != '\0') LoadStructsLayout(layoutFileName);
 
     ExportParsedData(outFileName, outputFormat);
 
@@ -1088,11 +1109,14 @@ static void ShowCommandLineInfo(void)
     printf("                                      Supported extensions: .txt, .json, .xml, .lua, .h\n");
     printf("                                      NOTE: If not specified, defaults to: raylib_api.txt\n\n");
     printf("    -f, --format <type>             : Define output format for parser data.\n");
-    printf("                                      Supported types: DEFAULT, JSON, XML, LUA, CODE\n\n");
+    printf("                                      Supported types: DEFAULT, JSON, XML, LUA, CODE, LAYOUT\n\n");
+    printf("                                      NOTE: LAYOUT exports a C program printing structs memory layout\n\n");
     printf("    -d, --define <DEF>              : Define functions specifiers (i.e. RLAPI for raylib.h, RMDEF for raymath.h, etc.)\n");
     printf("                                      NOTE: If no specifier defined, defaults to: RLAPI\n\n");
     printf("    -t, --truncate <after>          : Define string to truncate input after (i.e. \"RLGL IMPLEMENTATION\" for rlgl.h)\n");
     printf("                                      NOTE: If not specified, the full input file is parsed.\n\n");
+    printf("    -l, --layout <filename.txt>     : Define structs memory layout file to include in JSON, XML and LUA formats.\n");
+    printf("                                      NOTE: Layout file is the output of the program exported with LAYOUT format.\n\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > raylib_parser --input raylib.h --output api.json\n");
@@ -1101,6 +1125,10 @@ static void ShowCommandLineInfo(void)
     printf("        Process <raylib.h> to generate <raylib_data.info> as XML text data\n\n");
     printf("    > raylib_parser --input raymath.h --output raymath_data.info --format XML\n");
     printf("        Process <raymath.h> to generate <raymath_data.info> as XML text data\n\n");
+    printf("    > raylib_parser --output raylib_layout.c --format LAYOUT\n");
+    printf("      cc raylib_layout.c -o raylib_layout && ./raylib_layout > raylib_layout.txt\n");
+    printf("      raylib_parser --output raylib_api.json --format JSON --layout raylib_layout.txt\n");
+    printf("        Process <raylib.h> to generate <api.json> including structs memory layout\n\n");
 }
 
 // Process command line arguments
@@ -1142,6 +1170,7 @@ static void ProcessCommandLine(int argc, char *argv[])
                 else if (IsTextEqual(argv[i + 1], "XML\0", 4)) outputFormat = XML;
                 else if (IsTextEqual(argv[i + 1], "LUA\0", 4)) outputFormat = LUA;
                 else if (IsTextEqual(argv[i + 1], "CODE\0", 4)) outputFormat = CODE;
+                else if (IsTextEqual(argv[i + 1], "LAYOUT\0", 7)) outputFormat = LAYOUT;
             }
             else printf("WARNING: No format parameters provided\n");
         }
@@ -1155,6 +1184,16 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else printf("WARNING: No define key provided\n");
         }
+        else if (IsTextEqual(argv[i], "-l", 2) || IsTextEqual(argv[i], "--layout", 8))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                MemoryCopy(layoutFileName, argv[i + 1], TextLength(argv[i + 1])); // Read structs layout filename
+                layoutFileName[TextLength(argv[i + 1])] = '\0';
+                i++;
+            }
+            else printf("WARNING: No layout file provided\n");
+        }
         else if (IsTextEqual(argv[i], "-t", 2) || IsTextEqual(argv[i], "--truncate", 10))
         {
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
@@ -1463,6 +1502,70 @@ static char *TextReplace(char *text, const char *replace, const char *by)
 */
 
 // Export parsed data in desired format
+// Load structs memory layout, printed by LAYOUT format program
+// NOTE: Layout is only assigned to structs with all fields found, layout must match parsed header
+static void LoadStructsLayout(const char *fileName)
+{
+    int length = 0;
+    char *buffer = LoadFileText(fileName, &length);
+
+    if (buffer == NULL)
+    {
+        printf("WARNING: Could not read layout file: %s\n", fileName);
+        return;
+    }
+
+    int linesCount = 0;
+    char **lines = GetTextLines(buffer, length, &linesCount);
+    int layoutCount = 0;
+
+    for (int i = 0; i < structCount; i++)
+    {
+        int fieldsFound = 0;
+        bool structFound = false;
+        unsigned int nameLength = TextLength(structs[i].name);
+
+        for (int l = 0; l < linesCount; l++)
+        {
+            char name[128] = { 0 };
+            int value1 = 0, value2 = 0;
+            if (sscanf(lines[l], "%127s %i %i", name, &value1, &value2) != 3) continue;
+            if (!IsTextEqual(name, structs[i].name, nameLength)) continue;
+
+            if (name[nameLength] == '\0')
+            {
+                structs[i].size = value1;
+                structs[i].alignment = value2;
+                structFound = true;
+            }
+            else if (name[nameLength] == '.')
+            {
+                for (int f = 0; f < structs[i].fieldCount; f++)
+                {
+                    unsigned int fieldLength = TextLength(structs[i].fieldName[f]);
+
+                    if (IsTextEqual(&name[nameLength + 1], structs[i].fieldName[f], fieldLength + 1))
+                    {
+                        structs[i].fieldOffset[f] = value1;
+                        structs[i].fieldSize[f] = value2;
+                        fieldsFound++;
+                    }
+                }
+            }
+        }
+
+        structs[i].hasLayout = structFound && (fieldsFound == structs[i].fieldCount);
+        if (structs[i].hasLayout) layoutCount++;
+        else if (structFound || (fieldsFound > 0)) printf("WARNING: Layout for struct %s does not match parsed fields\n", structs[i].name);
+    }
+
+    for (int i = 0; i < linesCount; i++) free(lines[i]);
+    free(lines);
+    free(buffer);
+
+    printf("Structs layout loaded: %i/%i\n", layoutCount, structCount);
+}
+
 static void ExportParsedData(const char *fileName, int format)
 {
     FILE *outFile = fopen(fileName, "wt");
@@ -1583,12 +1686,22 @@ static void ExportParsedData(const char *fileName, int format)
                 fprintf(outFile, "    {\n");
                 fprintf(outFile, "      \"name\": \"%s\",\n", structs[i].name);
                 fprintf(outFile, "      \"description\": \"%s\",\n", EscapeBackslashes(structs[i].desc));
+                if (structs[i].hasLayout)
+                {
+                    fprintf(outFile, "      \"size\": %i,\n", structs[i].size);
+                    fprintf(outFile, "      \"alignment\": %i,\n", structs[i].alignment);
+                }
                 fprintf(outFile, "      \"fields\": [\n");
                 for (int f = 0; f < structs[i].fieldCount; f++)
                 {
                     fprintf(outFile, "        {\n");
                     fprintf(outFile, "          \"type\": \"%s\",\n", structs[i].fieldType[f]);
                     fprintf(outFile, "          \"name\": \"%s\",\n", structs[i].fieldName[f]);
+                    if (structs[i].hasLayout)
+                    {
+                        fprintf(outFile, "          \"offset\": %i,\n", structs[i].fieldOffset[f]);
+                        fprintf(outFile, "          \"size\": %i,\n", structs[i].fieldSize[f]);
+                    }
                     fprintf(outFile, "          \"description\": \"%s\"\n", EscapeBackslashes(structs[i].fieldDesc[f]));
                     fprintf(outFile, "        }");
                     if (f < structs[i].fieldCount - 1) fprintf(outFile, ",\n");
@@ -1714,9 +1827,9 @@ static void ExportParsedData(const char *fileName, int format)
                     <Define name="" type="" value="" desc="" />
                 </Defines>
                 <Structs count="">
-                    <Struct name="" fieldCount="" desc="">
-                        <Field type="" name="" desc="" />
-                        <Field type="" name="" desc="" />
+                    <Struct name="" fieldCount="" size="" alignment="" desc="">
+                        <Field type="" name="" offset="" size="" desc="" />
+                        <Field type="" name="" offset="" size="" desc="" />
                     </Struct>
                 <Structs>
                 <Aliases count="">
@@ -1767,10 +1880,14 @@ static void ExportParsedData(const char *fileName, int format)
             fprintf(outFile, "    <Structs count=\"%i\">\n", structCount);
             for (int i = 0; i < structCount; i++)
             {
-                fprintf(outFile, "        <Struct name=\"%s\" fieldCount=\"%i\" desc=\"%s\">\n", structs[i].name, structs[i].fieldCount, structs[i].desc);
+                fprintf(outFile, "        <Struct name=\"%s\" fieldCount=\"%i\" ", structs[i].name, structs[i].fieldCount);
+                if (structs[i].hasLayout) fprintf(outFile, "size=\"%i\" alignment=\"%i\" ", structs[i].size, structs[i].alignment);
+                fprintf(outFile, "desc=\"%s\">\n", structs[i].desc);
                 for (int f = 0; f < structs[i].fieldCount; f++)
                 {
-                    fprintf(outFile, "            <Field type=\"%s\" name=\"%s\" desc=\"%s\" />\n", structs[i].fieldType[f], structs[i].fieldName[f], structs[i].fieldDesc[f]);
+                    fprintf(outFile, "            <Field type=\"%s\" name=\"%s\" ", structs[i].fieldType[f], structs[i].fieldName[f]);
+                    if (structs[i].hasLayout) fprintf(outFile, "offset=\"%i\" size=\"%i\" ", structs[i].fieldOffset[f], structs[i].fieldSize[f]);
+                    fprintf(outFile, "desc=\"%s\" />\n", structs[i].fieldDesc[f]);
                 }
                 fprintf(outFile, "        </Struct>\n");
             }
@@ -1864,12 +1981,22 @@ static void ExportParsedData(const char *fileName, int format)
                 fprintf(outFile, "    {\n");
                 fprintf(outFile, "      name = \"%s\",\n", structs[i].name);
                 fprintf(outFile, "      description = \"%s\",\n", EscapeBackslashes(structs[i].desc));
+                if (structs[i].hasLayout)
+                {
+                    fprintf(outFile, "      size = %i,\n", structs[i].size);
+                    fprintf(outFile, "      alignment = %i,\n", structs[i].alignment);
+                }
                 fprintf(outFile, "      fields = {\n");
                 for (int f = 0; f < structs[i].fieldCount; f++)
                 {
                     fprintf(outFile, "        {\n");
                     fprintf(outFile, "          type = \"%s\",\n", structs[i].fieldType[f]);
                     fprintf(outFile, "          name = \"%s\",\n", structs[i].fieldName[f]);
+                    if (structs[i].hasLayout)
+                    {
+                        fprintf(outFile, "          offset = %i,\n", structs[i].fieldOffset[f]);
+                        fprintf(outFile, "          size = %i,\n", structs[i].fieldSize[f]);
+                    }
                     fprintf(outFile, "          description = \"%s\"\n", EscapeBackslashes(structs[i].fieldDesc[f]));
                     fprintf(outFile, "        }");
                     if (f < structs[i].fieldCount - 1) fprintf(outFile, ",\n");
@@ -1979,6 +2106,40 @@ static void ExportParsedData(const char *fileName, int format)
             fprintf(outFile, "  }\n");
             fprintf(outFile, "}\n");
         } break;
+        case LAYOUT:
+        {
+            // C program printing structs memory layout, as computed by the compiler used to build it
+            // NOTE: Compilation fails if a parsed field does not exist or does not fit into its struct
+            // Output lines: <struct> <size> <alignment>, <struct>.<field> <offset> <size>
+            fprintf(outFile, "// Structs memory layout, generated by raylib_parser from %s\n", inFileName);
+            fprintf(outFile, "// Output is provided to raylib_parser --layout option\n\n");
+            fprintf(outFile, "#include <stdio.h>\n");
+            fprintf(outFile, "#include <stddef.h>\n\n");
+            fprintf(outFile, "#include \"%s\"\n\n", inFileName);
+
+            // Alignment computed as offset of struct following a char (C99 compatible)
+            for (int i = 0; i < structCount; i++)
+            {
+                fprintf(outFile, "typedef struct { char c; %s s; } LayoutAlign_%s;\n", structs[i].name, structs[i].name);
+                for (int f = 0; f < structs[i].fieldCount; f++)
+                {
+                    fprintf(outFile, "typedef char LayoutCheck_%s_%s[((offsetof(%s, %s) + sizeof(((%s *)0)->%s)) <= sizeof(%s))? 1 : -1];\n",
+                        structs[i].name, structs[i].fieldName[f], structs[i].name, structs[i].fieldName[f], structs[i].name, structs[i].fieldName[f], structs[i].name);
+                }
+            }
+
+            fprintf(outFile, "\nint main(void)\n{\n");
+            for (int i = 0; i < structCount; i++)
+            {
+                fprintf(outFile, "    printf(\"%s %%i %%i\\n\", (int)sizeof(%s), (int)offsetof(LayoutAlign_%s, s));\n", structs[i].name, structs[i].name, structs[i].name);
+                for (int f = 0; f < structs[i].fieldCount; f++)
+                {
+                    fprintf(outFile, "    printf(\"%s.%s %%i %%i\\n\", (int)offsetof(%s, %s), (int)sizeof(((%s *)0)->%s));\n",
+                        structs[i].name, structs[i].fieldName[f], structs[i].name, structs[i].fieldName[f], structs[i].name, structs[i].fieldName[f]);
+                }
+            }
+            fprintf(outFile, "\n    return 0;\n}\n");
+        } break;
         case CODE:
         default: break;
     }
@@ -58,12 +58,22 @@
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 // Wait for events passively (sleeping while no events) instead of polling them actively every frame
 //#define SUPPORT_EVENTS_WAITING          1
+// Use SSE/NEON/WASM SIMD instructions for raymath hot functions (MatrixMultiply(), MatrixInvert()...), scalar fallback if not available
+#define SUPPORT_SIMD_RAYMATH            1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
+// Support shader program binaries cache on disk, enabled with SetShaderCacheDirectory()
+// NOTE: Requires GL_ARB_get_program_binary (OpenGL 4.1) or GL_OES_get_program_binary, shaders are compiled otherwise
+#define SUPPORT_SHADER_CACHE            1
+// Support frame time statistics (percentiles over a frames window) and per-frame times CSV export
+#define SUPPORT_FRAME_TIME_STATS        1
+// Profiler module is included (rprof.h), named CPU scopes recorded per thread and exported as Chrome trace JSON
+// NOTE: Some raylib functions are recorded as scopes: rlDrawRenderBatch(), SwapScreenBuffer(), PollInputEvents()...
+//#define SUPPORT_PROFILER                1
 // Support automatic generated events, loading and recording of those events when required
 //#define SUPPORT_EVENTS_AUTOMATION       1
 // Support custom frame control, only for advance users
@@ -84,8 +94,25 @@
 #define MAX_TOUCH_POINTS                8       // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
+#define MAX_KEY_CHANGED_QUEUE          32       // Maximum number of keys state changes registered per frame (full keys sync if exceeded)
+#define MAX_INPUT_EVENTS_QUEUE        256       // Maximum number of timestamped input events registered per frame (GetInputEvent())
+#define MAX_INPUT_EVENTS_RING         512       // Maximum raw input events queued per input device thread, power of 2 [PLATFORM_RPI, PLATFORM_DRM]
+#define MAX_DISPLAY_PLANES              4       // Maximum number of hardware overlay planes used for direct scanout [PLATFORM_DRM]
+#define MAX_SCANOUT_RENDER_TEXTURES     8       // Maximum number of render textures loaded for direct scanout [PLATFORM_DRM]
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define COMPRESSION_STREAM_CHUNK_SIZE 65536     // Default chunk size for data compression streams (bytes)
+#define MAX_SHADERS_PENDING           256       // Maximum number of shaders loading asynchronously, pending of completion
+#define MAX_FRAME_TIME_SAMPLES       1024       // Maximum number of frames measured for frame time statistics
+#define HEADLESS_FRAMES_COUNT           0       // Headless platform frames rendered before WindowShouldClose() returns true (0 = no limit)
+#define AUTOMATION_EVENTS_SYNC_INTERVAL 600     // Automation events frames between sync records (input state snapshot, seek point)
+#define AUTOMATION_EVENTS_BUFFER_SIZE 4096      // Automation events stream buffer size (bytes)
+#define GIF_RECORD_FRAMERATE           10       // Default GIF recording framerate (frames per second), SetGifRecordingFramerate()
+#define MAX_GIF_FRAMES_PENDING          4       // Maximum number of GIF frames pixel buffers being encoded asynchronously
+#define DYNAMIC_RESOLUTION_FRAMES       3       // Frames GPU time queries are kept in flight for dynamic resolution scaling
+#define DYNAMIC_RESOLUTION_HEADROOM  0.9f       // Dynamic resolution GPU time aimed, relative to target frame time
+#define FIXED_UPDATE_MAX_TIME        0.25       // Maximum frame time accumulated for fixed update steps (seconds)
+#define FIXED_UPDATE_MINIMIZED_FPS     10       // Frames rate while window is minimized and fixed update rate is set (not rendered)
 
 
 //------------------------------------------------------------------------------------
@@ -105,7 +132,7 @@
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
-#define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_SHADER_LOCATIONS               40      // Maximum number of shader locations supported
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
@@ -136,6 +163,10 @@
 // Use QUADS instead of TRIANGLES for drawing when possible
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE         1
+// Spatial indices module is included (rspatial.h), 2D rectangles grid and 3D boxes dynamic tree for broadphase queries
+#define SUPPORT_SPATIAL_INDEX           1
+// Use SSE2/NEON/WASM SIMD instructions for batched 2d collision tests (CheckCollisionRecsBatch()...), scalar fallback if not available
+#define SUPPORT_SIMD_SHAPES_COLLISION   1
 
 
 //------------------------------------------------------------------------------------
@@ -153,7 +184,7 @@
 #define SUPPORT_FILEFORMAT_HDR          1
 //#define SUPPORT_FILEFORMAT_PIC          1
 //#define SUPPORT_FILEFORMAT_PNM          1
-//#define SUPPORT_FILEFORMAT_KTX          1
+#define SUPPORT_FILEFORMAT_KTX          1       // KTX 1.1 and KTX2 (no supercompression) containers
 //#define SUPPORT_FILEFORMAT_ASTC         1
 //#define SUPPORT_FILEFORMAT_PKM          1
 //#define SUPPORT_FILEFORMAT_PVR          1
@@ -165,6 +196,13 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support textures mipmaps streaming (LoadTextureStreamed()), only low resolution mipmaps are resident until requested by drawn size
+// NOTE: Requires OpenGL 3.3 texture base mipmap level, textures are fully loaded otherwise
+#define SUPPORT_TEXTURE_STREAMING       1
+// Support video textures playback (LoadVideoTexture()), YUV4MPEG2 (.y4m) frames read ahead on async loader thread
+// NOTE: YUV planes are uploaded as single channel textures and converted to RGB on GPU, requires OpenGL 2.1 or higher
+#define SUPPORT_VIDEO_TEXTURE           1
+#define VIDEO_TEXTURE_QUEUE_FRAMES      4       // Video texture frames decoded ahead
 
 
 //------------------------------------------------------------------------------------
@@ -180,12 +218,17 @@
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
 #define SUPPORT_TEXT_MANIPULATION       1
+// Support fonts kerning (TTF/OTF kern table and GPOS pair adjustments), applied on text drawing and measuring
+// NOTE: Text glyphs positions (shaped runs) are cached by DrawTextEx() for fonts with kerning pairs
+#define SUPPORT_FONT_KERNING            1
 
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
-                                                // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
-#define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+// NOTE: Text functions results (TextFormat(), TextSubtext(), TextToUpper(), TextJoin(), TextSplit()...)
+// are allocated from frame memory and valid until EndDrawing(), size defined by MAX_FRAME_MEMORY_SIZE
+// WARNING: Frame memory is not thread-safe, text functions returning results must be called from main thread
+#define MAX_TEXT_BUFFER_LENGTH      MAX_FRAME_MEMORY_SIZE   // Maximum length of TextFormat() results (bytes), longer results are truncated
+#define MAX_TEXTSPLIT_COUNT         MAX_FRAME_MEMORY_SIZE   // Maximum number of substrings to split: TextSplit()
 
 
 //------------------------------------------------------------------------------------
@@ -201,11 +244,28 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Use SSE2/NEON instructions for CPU mesh skinning (UpdateModelAnimation()), scalar fallback if not available
+#define SUPPORT_SIMD_SKINNING           1
+// Use SSE2/NEON instructions for batched collision tests (GetRayCollisionTriangles(), GetRayCollisionBoxes()...)
+#define SUPPORT_SIMD_COLLISION          1
+// Store glTF animations channels keyframes instead of fixed rate frames, reduces animations memory
+// WARNING: Frames are not evenly spaced in time, UpdateModelAnimationEx() should be used to sample them by time
+//#define SUPPORT_GLTF_ANIMATION_KEYFRAMES  1
+// Optimize loaded models meshes before uploading to GPU (OptimizeMesh()), vertices are deduplicated and reordered
+//#define SUPPORT_MESH_OPTIMIZATION       1
+// Draw 3d shapes as instances of cached unit meshes resident on GPU, consecutive same shapes are drawn instanced
+#define SUPPORT_SHAPES_MESH_CACHE       1
+// Share models materials textures loaded from same image through a reference counted cache, UnloadModel() releases references
+#define SUPPORT_MODEL_TEXTURE_CACHE     1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
-#define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
+#define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
+#define MAX_MESH_BONE_MATRICES         64       // Maximum bones matrices for GPU skinning, models with more bones use CPU skinning
+#define MAX_MESH_MORPH_TARGETS         64       // Maximum morph targets for GPU morphing, meshes with more targets are morphed on CPU
+#define MAX_TERRAIN_CHUNK_REQUESTS      8       // Maximum terrain chunks meshes generated concurrently (async load requests)
+#define MAX_LIGHTS_PER_CLUSTER         64       // Maximum lights affecting a light cluster (clustered lighting), exceeding lights are ignored
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -218,6 +278,12 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Use SSE2/NEON/WASM SIMD instructions for audio buffers mixing (MixAudioFrames()), scalar fallback if not available
+#define SUPPORT_SIMD_AUDIO_MIXING       1
+// Use a linear resampler for mono/stereo buffers resampling and pitch, instead of miniaudio data converter (cheaper for many pitched voices)
+#define SUPPORT_FAST_AUDIO_RESAMPLING   1
+// Decode music streams on a dedicated thread, UpdateMusicStream() is not required every frame (not available on web)
+#define SUPPORT_MUSIC_STREAM_THREAD     1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -225,7 +291,12 @@
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels (voices for sound instances)
+#define MAX_AUDIO_COMMANDS               256    // Maximum audio commands queued for the audio thread (power of two)
+#define MAX_AUDIO_STREAM_SUB_BUFFERS       8    // Maximum sub-buffers of an audio stream (ring buffer depth)
+#define AUDIO_STREAM_ADAPTIVE_UNDERRUNS    3    // Audio stream underruns required to grow its sub-buffers count (adaptive streams)
+#define AUDIO_BUS_BLOCK_SIZE             512    // Audio buses mixing block size (frames), buffers are mixed by blocks when buses are used
+#define AUDIO_CAPTURE_BUFFER_SIZE       4096    // Audio capture stream ring buffer size (frames), captured frames are dropped if not read in time
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -236,9 +307,25 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Jobs system (thread pool) used by some modules to process data in parallel, enabled with InitJobSystem()
+// NOTE: Not available on PLATFORM_WEB without pthreads support, jobs are processed serially
+#define SUPPORT_JOB_SYSTEM              1
+// Memory allocations tracking by module: GetMemoryStats(), SetMemoryBudget(), unfreed blocks logged on CloseWindow()
+// NOTE: Every allocation stores a tracking header, enable it for development builds
+//#define SUPPORT_MEMORY_TRACKING        1
+// Pack files (.rpak) support, mounted packs are checked first by LoadFileData(), LoadFileText() and FileExists()
+#define SUPPORT_PACK_FILES              1
+// NOTE: Async loads (LoadTextureAsync(), LoadFontAsync()...) are decoded on a loader thread when jobs system is
+// available, GPU data is uploaded by BeginDrawing() on main thread, most ASYNC_LOAD_FRAME_BUDGET ms per frame
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_TRACELOG_ASYNC_MESSAGES   256       // Maximum trace-log messages queued in async mode (power of 2), exceeding ones are dropped
+#define MAX_JOB_THREADS                32       // Maximum number of jobs system worker threads
+#define MAX_ASYNC_LOAD_REQUESTS        64       // Maximum number of pending async load requests
+#define MAX_PACK_FILES                  8       // Maximum number of mounted pack files
+#define ASYNC_LOAD_FRAME_BUDGET       2.0       // Async loads finalization time budget per frame (milliseconds)
+#define MAX_FRAME_MEMORY_SIZE      262144       // Frame memory size (bytes), text functions results: TextFormat(), TextJoin()...
 
 #endif // CONFIG_H
@@ -13,6 +13,7 @@
 *   TODO:
 *     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx_to_memory()
 *     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
+*     - Support KTX2 supercompression schemes (BasisLZ, Zstandard, ZLIB), requires transcoder/decoders
 *
 *   CONFIGURATION:
 *
@@ -63,10 +64,13 @@ extern "C" {            // Prevents name mangling of functions
 RLAPI void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
+RLAPI void *rl_load_ktx_cubemap_from_memory(const unsigned char *file_data, unsigned int file_size, int *size, int *format, int *mips);
+RLAPI void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
 RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+RLAPI int rl_save_ktx_cubemap(const char *file_name, void *data, int size, int format, int mipmaps);  // Save cubemap data as KTX file (faces by mipmap level)
 
 #if defined(__cplusplus)
 }
@@ -97,6 +101,12 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 //----------------------------------------------------------------------------------
 // Get pixel data size in bytes for certain pixel format
 static int get_pixel_data_size(int width, int height, int format);
+#if defined(RL_GPUTEX_SUPPORT_KTX)
+// Get pixel format for KTX OpenGL internal format and type
+static int get_ktx_pixel_format(unsigned int gl_internal_format, unsigned int gl_type);
+// Save image data as KTX file, faces data by mipmap level
+static int save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps, int faces);
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -439,8 +449,211 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
             else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            else *format = get_ktx_pixel_format(header->gl_internal_format, header->gl_type);
+        }
+    }
+
+    return image_data;
+}
+
+// Load KTX cubemap data, all faces data for every mipmap level
+// NOTE: Data is returned as: level 0 faces (+X, -X, +Y, -Y, +Z, -Z), level 1 faces...
+void *rl_load_ktx_cubemap_from_memory(const unsigned char *file_data, unsigned int file_size, int *size, int *format, int *mips)
+{
+    void *cubemap_data = NULL;
+
+    // KTX 1.1 Header
+    typedef struct {
+        char id[12];
+        unsigned int endianness;
+        unsigned int gl_type;
+        unsigned int gl_type_size;
+        unsigned int gl_format;
+        unsigned int gl_internal_format;
+        unsigned int gl_base_internal_format;
+        unsigned int width;
+        unsigned int height;
+        unsigned int depth;
+        unsigned int elements;
+        unsigned int faces;
+        unsigned int mipmap_levels;
+        unsigned int key_value_data_size;
+    } ktx_header;
+
+    if ((file_data == NULL) || (file_size < sizeof(ktx_header))) return NULL;
+
+    ktx_header *header = (ktx_header *)file_data;
+
+    if ((header->id[1] != 'K') || (header->id[2] != 'T') || (header->id[3] != 'X') ||
+        (header->id[4] != ' ') || (header->id[5] != '1') || (header->id[6] != '1'))
+    {
+        LOG("WARNING: IMAGE: KTX file data not valid");
+    }
+    else if ((header->faces != 6) || (header->elements > 1) || (header->width != header->height))
+    {
+        LOG("WARNING: IMAGE: KTX file data is not a cubemap");
+    }
+    else
+    {
+        int levels = (header->mipmap_levels > 0)? header->mipmap_levels : 1;
+        int pixel_format = get_ktx_pixel_format(header->gl_internal_format, header->gl_type);
+
+        if (pixel_format == 0) LOG("WARNING: IMAGE: KTX cubemap pixel format not supported");
+        else
+        {
+            // Cubemap data size, faces stored without padding
+            int data_size = 0;
+            for (int i = 0, s = header->width; i < levels; i++, s = (s > 1)? s/2 : 1) data_size += 6*get_pixel_data_size(s, s, pixel_format);
+
+            cubemap_data = RL_MALLOC(data_size);
+
+            const unsigned char *file_data_ptr = file_data + sizeof(ktx_header) + header->key_value_data_size;
+            unsigned char *cubemap_data_ptr = (unsigned char *)cubemap_data;
+
+            for (int i = 0, s = header->width; i < levels; i++, s = (s > 1)? s/2 : 1)
+            {
+                // NOTE: Every mipmap level starts with one face data size, faces data is padded to 4 bytes
+                int face_size = get_pixel_data_size(s, s, pixel_format);
+                int face_stride = (face_size + 3) & ~3;
+
+                if ((file_data_ptr + 4 + 6*face_stride) > (file_data + file_size))
+                {
+                    LOG("WARNING: IMAGE: KTX cubemap file data truncated");
+                    RL_FREE(cubemap_data);
+                    return NULL;
+                }
+
+                file_data_ptr += 4;
+
+                for (int f = 0; f < 6; f++)
+                {
+                    memcpy(cubemap_data_ptr, file_data_ptr, face_size);
+                    cubemap_data_ptr += face_size;
+                    file_data_ptr += face_stride;
+                }
+            }
+
+            *size = header->width;
+            *format = pixel_format;
+            *mips = levels;
+        }
+    }
+
+    return cubemap_data;
+}
+
+// Load KTX2 image data (uncompressed, DXT, ETC2, ASTC formats)
+// NOTE: Only 2D textures without supercompression are supported, Basis Universal (ETC1S/UASTC) data requires a transcoder
+void *rl_load_ktx2_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
+{
+    void *image_data = NULL;        // Image data pointer
+
+    // KTX2 file Header (80 bytes)
+    // v2.0 - https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+    typedef struct {
+        char id[12];                            // Identifier: "«KTX 20»\r\n\x1A\n"
+        unsigned int vk_format;                 // Vulkan format (VK_FORMAT_UNDEFINED for Basis Universal data)
+        unsigned int type_size;                 // Data type size (1 for block compressed formats)
+        unsigned int width;                     // Texture image width in pixels
+        unsigned int height;                    // Texture image height in pixels
+        unsigned int depth;                     // For 2D textures is 0
+        unsigned int layers;                    // Array layers, for no-array = 0
+        unsigned int faces;                     // Cubemap faces, for no-cubemap = 1
+        unsigned int levels;                    // Mipmap levels, 0 requires mipmaps generation
+        unsigned int supercompression;          // Supercompression scheme: 0-None, 1-BasisLZ, 2-Zstandard, 3-ZLIB
+        unsigned int dfd_offset;                // Data format descriptor offset
+        unsigned int dfd_size;                  // Data format descriptor size
+        unsigned int kvd_offset;                // Key/value data offset
+        unsigned int kvd_size;                  // Key/value data size
+        unsigned long long sgd_offset;          // Supercompression global data offset
+        unsigned long long sgd_size;            // Supercompression global data size
+    } ktx2_header;
+
+    // NOTE: Levels index follows header: byte offset, byte length and uncompressed byte length per level (base level first)
+
+    if ((file_data != NULL) && (file_size >= sizeof(ktx2_header)))
+    {
+        ktx2_header *header = (ktx2_header *)file_data;
+        int levels = (header->levels > 0)? header->levels : 1;
 
-            // TODO: Support uncompressed data formats? Right now it returns format = 0!
+        if ((header->id[1] != 'K') || (header->id[2] != 'T') || (header->id[3] != 'X') ||
+            (header->id[4] != ' ') || (header->id[5] != '2') || (header->id[6] != '0'))
+        {
+            LOG("WARNING: IMAGE: KTX2 file data not valid");
+        }
+        else if ((header->vk_format == 0) || (header->supercompression == 1))
+        {
+            LOG("WARNING: IMAGE: KTX2 Basis Universal data (ETC1S/UASTC) requires a transcoder, not supported");
+        }
+        else if (header->supercompression != 0)
+        {
+            LOG("WARNING: IMAGE: KTX2 supercompression scheme not supported (%i)", header->supercompression);
+        }
+        else if ((header->depth > 1) || (header->layers > 1) || (header->faces != 1))
+        {
+            LOG("WARNING: IMAGE: KTX2 only 2D textures supported");
+        }
+        else if (file_size < sizeof(ktx2_header) + levels*3*sizeof(unsigned long long))
+        {
+            LOG("WARNING: IMAGE: KTX2 file data not valid");
+        }
+        else
+        {
+            switch (header->vk_format)
+            {
+                case 9: *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;            // VK_FORMAT_R8_UNORM
+                case 16: *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;          // VK_FORMAT_R8G8_UNORM
+                case 4: *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;               // VK_FORMAT_R5G6B5_UNORM_PACK16
+                case 6: *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;             // VK_FORMAT_R5G5B5A1_UNORM_PACK16
+                case 2: *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;             // VK_FORMAT_R4G4B4A4_UNORM_PACK16
+                case 23: case 29: *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;     // VK_FORMAT_R8G8B8_UNORM, VK_FORMAT_R8G8B8_SRGB
+                case 37: case 43: *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;   // VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_R8G8B8A8_SRGB
+                case 100: *format = PIXELFORMAT_UNCOMPRESSED_R32; break;                // VK_FORMAT_R32_SFLOAT
+                case 106: *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;          // VK_FORMAT_R32G32B32_SFLOAT
+                case 109: *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;       // VK_FORMAT_R32G32B32A32_SFLOAT
+                case 131: case 132: *format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;   // VK_FORMAT_BC1_RGB_UNORM_BLOCK, VK_FORMAT_BC1_RGB_SRGB_BLOCK
+                case 133: case 134: *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;  // VK_FORMAT_BC1_RGBA_UNORM_BLOCK, VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+                case 135: case 136: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;  // VK_FORMAT_BC2_UNORM_BLOCK, VK_FORMAT_BC2_SRGB_BLOCK
+                case 137: case 138: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;  // VK_FORMAT_BC3_UNORM_BLOCK, VK_FORMAT_BC3_SRGB_BLOCK
+                case 147: case 148: *format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;   // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+                case 151: case 152: *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK, VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+                case 157: case 158: *format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break; // VK_FORMAT_ASTC_4x4_UNORM_BLOCK, VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+                case 171: case 172: *format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break; // VK_FORMAT_ASTC_8x8_UNORM_BLOCK, VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+                default: *format = 0; break;
+            }
+
+            if (*format == 0) LOG("WARNING: IMAGE: KTX2 data format not supported (%i)", header->vk_format);
+            else
+            {
+                const unsigned long long *level_index = (const unsigned long long *)(file_data + sizeof(ktx2_header));
+                unsigned long long data_size = 0;
+                bool valid = true;
+
+                for (int i = 0; i < levels; i++)
+                {
+                    if ((level_index[i*3] + level_index[i*3 + 1]) > file_size) valid = false;
+                    data_size += level_index[i*3 + 1];
+                }
+
+                if (!valid) LOG("WARNING: IMAGE: KTX2 file data not valid");
+                else
+                {
+                    // Levels are copied base level first, as expected by mipmaps data
+                    image_data = RL_MALLOC((size_t)data_size);
+
+                    unsigned char *image_data_ptr = (unsigned char *)image_data;
+
+                    for (int i = 0; i < levels; i++)
+                    {
+                        memcpy(image_data_ptr, file_data + level_index[i*3], (size_t)level_index[i*3 + 1]);
+                        image_data_ptr += level_index[i*3 + 1];
+                    }
+
+                    *width = header->width;
+                    *height = header->height;
+                    *mips = levels;
+                }
+            }
         }
     }
 
@@ -448,9 +661,22 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 }
 
 // Save image data as KTX file
+int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+{
+    return save_ktx(file_name, data, width, height, format, mipmaps, 1);
+}
+
+// Save cubemap data as KTX file
+// NOTE: Data is expected as: level 0 faces (+X, -X, +Y, -Y, +Z, -Z), level 1 faces...
+int rl_save_ktx_cubemap(const char *file_name, void *data, int size, int format, int mipmaps)
+{
+    return save_ktx(file_name, data, size, size, format, mipmaps, 6);
+}
+
+// Save image data as KTX file, faces data by mipmap level
 // NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
 // TODO: Review KTX saving, many things changed!
-int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+static int save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps, int faces)
 {
     // KTX file Header (64 bytes)
     // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
@@ -475,11 +701,13 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     } ktx_header;
 
     // Calculate file data_size required
+    // NOTE: Cubemap faces data is padded to 4 bytes (cube padding)
     int data_size = sizeof(ktx_header);
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
+        int face_size = get_pixel_data_size(w, h, format);
+        data_size += 4 + ((faces > 1)? faces*((face_size + 3) & ~3) : face_size);
         w /= 2; h /= 2;
     }
 
@@ -506,7 +734,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.height = height;
     header.depth = 0;
     header.elements = 0;
-    header.faces = 1;
+    header.faces = faces;
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     header.key_value_data_size = 0;         // No extra data after the header
 
@@ -531,12 +759,18 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
             unsigned int data_size = get_pixel_data_size(temp_width, temp_height, format);
 
             memcpy(file_data_ptr, &data_size, sizeof(unsigned int));
-            memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
+            file_data_ptr += 4;
+
+            for (int f = 0; f < faces; f++)
+            {
+                memcpy(file_data_ptr, (unsigned char *)data + data_offset, data_size);
+
+                data_offset += data_size;
+                file_data_ptr += (faces > 1)? ((data_size + 3) & ~3) : data_size;
+            }
 
             temp_width /= 2;
             temp_height /= 2;
-            data_offset += data_size;
-            file_data_ptr += (4 + data_size);
         }
     }
 
@@ -771,6 +1005,24 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
 // Get pixel data size in bytes for certain pixel format
+#if defined(RL_GPUTEX_SUPPORT_KTX)
+// Get pixel format for KTX OpenGL internal format and type
+// NOTE: Formats are matched against the ones used by current OpenGL version (rlGetGlTextureFormats()),
+// uncompressed formats are matched by type too, OpenGL ES 2.0 uses same unsized internal format for several formats
+static int get_ktx_pixel_format(unsigned int gl_internal_format, unsigned int gl_type)
+{
+    for (int format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; format <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; format++)
+    {
+        unsigned int internal_format = 0, gl_format = 0, type = 0;
+        rlGetGlTextureFormats(format, &internal_format, &gl_format, &type);
+
+        if ((internal_format != 0) && (internal_format == gl_internal_format) && ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (type == gl_type))) return format;
+    }
+
+    return 0;
+}
+#endif
+
 static int get_pixel_data_size(int width, int height, int format)
 {
     int data_size = 0;       // Size in bytes
@@ -0,0 +1,225 @@
+/**********************************************************************************************
+*
+*   rly4m - YUV4MPEG2 (.y4m) video frames reader, single header
+*
+*   Small streaming reader for YUV4MPEG2 video files, the uncompressed planar format produced
+*   and consumed by most video tools (i.e. ffmpeg -pix_fmt yuv420p out.y4m). Frames are read
+*   from file one by one into caller memory as Y, U and V planes, ready to be uploaded to GPU
+*   as separate single channel textures and converted to RGB in a shader.
+*
+*   CONFIGURATION:
+*       #define RLY4M_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   USAGE:
+*       struct rly4m y4m = { 0 };
+*       if (rly4m_open(&y4m, "video.y4m"))
+*       {
+*           unsigned char *planes = malloc(y4m.frameSize);
+*           while (rly4m_read(&y4m, planes)) { ... }    // Y plane, then U and V planes (chromaWidth*chromaHeight)
+*           rly4m_close(&y4m);
+*       }
+*
+*   NOTES:
+*       - Only 4:2:0 chroma subsampling is supported (C420jpeg, C420paldv, C420mpeg2, C420), stream default
+*       - Color range is read from ffmpeg XCOLORRANGE parameter, limited (TV) range if not provided
+*       - Frames count and seeking assume frames headers without parameters ("FRAME\n"), frames
+*         with parameters are read sequentially
+*
+*   LICENSE: zlib/libpng
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLY4M_H
+#define RLY4M_H
+
+#include <stdio.h>          // Required for: FILE
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define RLY4M_HEADER_MAX    1024                    // Stream header maximum length
+#define RLY4M_FRAME_TAG     "FRAME\n"               // Frame header without parameters
+
+// Video stream reader state
+struct rly4m {
+    FILE *file;                                     // Stream file, kept open
+    int width;                                      // Frame width (Y plane)
+    int height;                                     // Frame height (Y plane)
+    int chromaWidth;                                // U and V planes width
+    int chromaHeight;                               // U and V planes height
+    int rateNum;                                    // Frame rate numerator
+    int rateDen;                                    // Frame rate denominator
+    int fullRange;                                  // Full range (PC) color values, limited (TV) range otherwise
+    int frameSize;                                  // Frame planes size (bytes)
+    long long dataOffset;                           // First frame header offset
+    int frameCount;                                 // Frames count (0: unknown)
+    int frame;                                      // Next frame to read
+};
+
+extern int rly4m_open(struct rly4m *y4m, const char *fileName);     // Open stream and read header, returns 1 on success
+extern int rly4m_read(struct rly4m *y4m, unsigned char *planes);    // Read next frame planes (frameSize bytes), returns 0 at stream end or on error
+extern int rly4m_seek(struct rly4m *y4m, int frame);                // Seek to frame, next rly4m_read() reads it, returns 1 on success
+extern void rly4m_close(struct rly4m *y4m);                         // Close stream file
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLY4M_H
+
+/***********************************************************************************
+*
+*   RLY4M IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLY4M_IMPLEMENTATION)
+
+#include <string.h>         // Required for: memset(), strncmp(), strchr()
+#include <stdlib.h>         // Required for: atoi()
+
+#if defined(_WIN32)
+    #define RLY4M_SEEK(file, offset, origin) _fseeki64(file, offset, origin)
+    #define RLY4M_TELL(file) _ftelli64(file)
+#else
+    #define RLY4M_SEEK(file, offset, origin) fseeko(file, (off_t)(offset), origin)
+    #define RLY4M_TELL(file) (long long)ftello(file)
+#endif
+
+// Read header line (up to '\n'), returns line length (-1: error or too long)
+static int rly4m_read_line(FILE *file, char *line, int capacity)
+{
+    int length = 0;
+
+    for (int c = fgetc(file); c != '\n'; c = fgetc(file))
+    {
+        if ((c == EOF) || (length >= capacity - 1)) return -1;
+        line[length++] = (char)c;
+    }
+
+    line[length] = '\0';
+
+    return length;
+}
+
+int rly4m_open(struct rly4m *y4m, const char *fileName)
+{
+    char header[RLY4M_HEADER_MAX] = { 0 };
+
+    memset(y4m, 0, sizeof(struct rly4m));
+
+    y4m->file = fopen(fileName, "rb");
+    if (y4m->file == NULL) return 0;
+
+    int length = rly4m_read_line(y4m->file, header, RLY4M_HEADER_MAX);
+    int valid = ((length > 10) && (strncmp(header, "YUV4MPEG2 ", 10) == 0));
+
+    y4m->rateNum = 25;
+    y4m->rateDen = 1;
+
+    // Parse header parameters, separated by spaces, first character is the parameter tag
+    for (char *param = header + 9; valid && (param != NULL); param = strchr(param + 1, ' '))
+    {
+        char *value = param + 2;
+
+        switch (param[1])
+        {
+            case 'W': y4m->width = atoi(value); break;
+            case 'H': y4m->height = atoi(value); break;
+            case 'F':
+            {
+                y4m->rateNum = atoi(value);
+                char *den = strchr(value, ':');
+                y4m->rateDen = (den != NULL)? atoi(den + 1) : 1;
+            } break;
+            case 'C': valid = (strncmp(value, "420", 3) == 0); break;
+            case 'X': if (strncmp(value, "COLORRANGE=FULL", 15) == 0) y4m->fullRange = 1; break;
+            default: break;     // Interlacing (I), pixel aspect (A) and unknown parameters are ignored
+        }
+    }
+
+    if (!valid || (y4m->width <= 0) || (y4m->height <= 0) || (y4m->rateNum <= 0) || (y4m->rateDen <= 0))
+    {
+        rly4m_close(y4m);
+        return 0;
+    }
+
+    y4m->chromaWidth = (y4m->width + 1)/2;
+    y4m->chromaHeight = (y4m->height + 1)/2;
+    y4m->frameSize = y4m->width*y4m->height + 2*y4m->chromaWidth*y4m->chromaHeight;
+    y4m->dataOffset = RLY4M_TELL(y4m->file);
+
+    // Frames count from file size, exact if frames headers have no parameters
+    if (RLY4M_SEEK(y4m->file, 0, SEEK_END) == 0)
+    {
+        long long dataSize = RLY4M_TELL(y4m->file) - y4m->dataOffset;
+        long long frameStride = y4m->frameSize + (long long)strlen(RLY4M_FRAME_TAG);
+
+        if ((dataSize%frameStride) == 0) y4m->frameCount = (int)(dataSize/frameStride);
+    }
+
+    if (RLY4M_SEEK(y4m->file, y4m->dataOffset, SEEK_SET) != 0)
+    {
+        rly4m_close(y4m);
+        return 0;
+    }
+
+    return 1;
+}
+
+int rly4m_read(struct rly4m *y4m, unsigned char *planes)
+{
+    char header[RLY4M_HEADER_MAX] = { 0 };
+
+    if (y4m->file == NULL) return 0;
+    if ((y4m->frameCount > 0) && (y4m->frame >= y4m->frameCount)) return 0;
+
+    int length = rly4m_read_line(y4m->file, header, RLY4M_HEADER_MAX);
+    if ((length < 5) || (strncmp(header, "FRAME", 5) != 0)) return 0;
+
+    if (fread(planes, 1, y4m->frameSize, y4m->file) != (size_t)y4m->frameSize) return 0;
+
+    y4m->frame++;
+
+    return 1;
+}
+
+int rly4m_seek(struct rly4m *y4m, int frame)
+{
+    if ((y4m->file == NULL) || (frame < 0) || ((y4m->frameCount > 0) && (frame >= y4m->frameCount))) return 0;
+
+    long long frameStride = y4m->frameSize + (long long)strlen(RLY4M_FRAME_TAG);
+
+    if (RLY4M_SEEK(y4m->file, y4m->dataOffset + frame*frameStride, SEEK_SET) != 0) return 0;
+
+    y4m->frame = frame;
+
+    return 1;
+}
+
+void rly4m_close(struct rly4m *y4m)
+{
+    if (y4m->file != NULL) fclose(y4m->file);
+    y4m->file = NULL;
+}
+
+#endif // RLY4M_IMPLEMENTATION
@@ -0,0 +1,344 @@
+/**********************************************************************************************
+*
+*   rlz4 - LZ4 block format compressor and decompressor, single header
+*
+*   Small implementation of the LZ4 block format (no frame format), compatible with the reference
+*   LZ4_compress_default()/LZ4_decompress_safe() block functions. It is designed for speed:
+*   compression at hundreds of MB/s and decompression running close to memory bandwidth,
+*   suitable for per-frame data (replays, network snapshots, assets caches).
+*
+*   CONFIGURATION:
+*       #define RLZ4_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   USAGE:
+*       struct rlz4 *state = malloc(sizeof(struct rlz4));   // Compressor state (~256KB), no initialization required
+*       unsigned char *comp = malloc(rlz4_bound(size));
+*       int compSize = rlz4_compress(state, comp, data, size, 1);
+*       int dataSize = rlz4_decompress(data, size, comp, compSize);   // Decompressed size must be known
+*
+*   NOTES:
+*       - Level 1 uses a single hash probe per position (fast), higher levels (up to 9) search hash chains
+*         with depth 2^level, improving compression ratio at a lower compression speed
+*       - Decompression speed does not depend on compression level
+*       - Decompressor checks all input and output bounds, it is safe for untrusted input
+*
+*   LICENSE: zlib/libpng
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLZ4_H
+#define RLZ4_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define RLZ4_HASH_BITS      15                      // Hash table size (log2), reduced for small inputs
+#define RLZ4_WINDOW_SIZE    65536                   // Matches window size (LZ4 offsets are 16 bit)
+#define RLZ4_LEVEL_MAX      9                       // Maximum compression level
+
+// Compressor state, hash table heads and chains
+struct rlz4 {
+    int head[1 << RLZ4_HASH_BITS];                  // Latest position + 1 for each hash (0: empty)
+    unsigned short chain[RLZ4_WINDOW_SIZE];         // Distance to previous position with same hash (0: end)
+};
+
+extern int rlz4_bound(int size);                                                            // Get compressed data worst case size
+extern int rlz4_compress(struct rlz4 *state, void *out, const void *in, int size, int level);   // Compress data, returns compressed size
+extern int rlz4_decompress(void *out, int capacity, const void *in, int size);              // Decompress data, returns decompressed size (-1: invalid data)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLZ4_H
+
+/***********************************************************************************
+*
+*   RLZ4 IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLZ4_IMPLEMENTATION)
+
+#include <string.h>         // Required for: memcpy(), memset()
+
+#define RLZ4_MIN_MATCH      4                       // Minimum match length
+#define RLZ4_LAST_LITERALS  5                       // Last bytes of block are always literals
+#define RLZ4_MATCH_LIMIT    12                      // Last match must start at least 12 bytes before block end
+#define RLZ4_SKIP_TRIGGER   6                       // Search step increased every 2^6 failed probes (level 1)
+
+// Read 32bit value (unaligned)
+static unsigned int rlz4_read32(const unsigned char *p)
+{
+    unsigned int value;
+    memcpy(&value, p, 4);
+    return value;
+}
+
+// Hash of 4 bytes sequence (Knuth multiplicative hash)
+static unsigned int rlz4_hash(unsigned int value, int bits)
+{
+    return (value*2654435761u) >> (32 - bits);
+}
+
+// Write length extension bytes (255 per byte), returns updated output pointer
+static unsigned char *rlz4_write_length(unsigned char *op, int length)
+{
+    while (length >= 255) { *op++ = 255; length -= 255; }
+    *op++ = (unsigned char)length;
+    return op;
+}
+
+// Write sequence: token, literals and match (offset 0: last literals only)
+static unsigned char *rlz4_write_sequence(unsigned char *op, const unsigned char *literals, int literalLength, int offset, int matchLength)
+{
+    unsigned char *token = op++;
+    *token = (unsigned char)(((literalLength >= 15)? 15 : literalLength) << 4);
+    if (literalLength >= 15) op = rlz4_write_length(op, literalLength - 15);
+
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (offset > 0)
+    {
+        *op++ = (unsigned char)(offset & 0xff);
+        *op++ = (unsigned char)(offset >> 8);
+
+        matchLength -= RLZ4_MIN_MATCH;
+        *token |= (unsigned char)((matchLength >= 15)? 15 : matchLength);
+        if (matchLength >= 15) op = rlz4_write_length(op, matchLength - 15);
+    }
+
+    return op;
+}
+
+// Get compressed data worst case size (incompressible data)
+int rlz4_bound(int size)
+{
+    return size + size/255 + 16;
+}
+
+// Compress data into LZ4 block format, returns compressed size
+// NOTE: Output buffer must be at least rlz4_bound(size) bytes
+int rlz4_compress(struct rlz4 *state, void *out, const void *in, int size, int level)
+{
+    const unsigned char *src = (const unsigned char *)in;
+    unsigned char *op = (unsigned char *)out;
+
+    if (size <= 0) { *op++ = 0; return 1; }     // Empty block: single token, no literals
+
+    int anchor = 0;
+
+    if (size > RLZ4_MATCH_LIMIT)
+    {
+        // Hash table size adapted to input size, only used part is cleared
+        int bits = 10;
+        while ((bits < RLZ4_HASH_BITS) && ((1 << bits) < size)) bits++;
+        memset(state->head, 0, (1 << bits)*sizeof(int));
+
+        if (level < 1) level = 1;
+        if (level > RLZ4_LEVEL_MAX) level = RLZ4_LEVEL_MAX;
+        int maxDepth = (level == 1)? 1 : (1 << level);
+
+        int searchLimit = size - RLZ4_MATCH_LIMIT;  // Last position where a match can start
+        int matchLimit = size - RLZ4_LAST_LITERALS; // Matches can not extend into last literals
+        int inserted = 0;                           // Next position to insert in hash chains (level > 1)
+        int ip = 0;
+        int step = 1 << RLZ4_SKIP_TRIGGER;
+
+        while (ip <= searchLimit)
+        {
+            unsigned int sequence = rlz4_read32(src + ip);
+            int matchPos = -1;
+            int matchLength = 0;
+
+            if (level == 1)
+            {
+                // Single probe, position replaces previous one
+                unsigned int h = rlz4_hash(sequence, bits);
+                int candidate = state->head[h] - 1;
+                state->head[h] = ip + 1;
+
+                if ((candidate >= 0) && ((ip - candidate) < RLZ4_WINDOW_SIZE) && (rlz4_read32(src + candidate) == sequence))
+                {
+                    matchPos = candidate;
+                    matchLength = RLZ4_MIN_MATCH;
+                    while (((ip + matchLength) < matchLimit) && (src[candidate + matchLength] == src[ip + matchLength])) matchLength++;
+                }
+            }
+            else
+            {
+                // Insert skipped positions in hash chains, search longest match
+                for (; inserted <= ip; inserted++)
+                {
+                    unsigned int h = rlz4_hash(rlz4_read32(src + inserted), bits);
+                    int distance = inserted + 1 - state->head[h];
+                    state->chain[inserted & (RLZ4_WINDOW_SIZE - 1)] = (unsigned short)(((state->head[h] == 0) || (distance >= RLZ4_WINDOW_SIZE))? 0 : distance);
+                    state->head[h] = inserted + 1;
+                }
+
+                int candidate = ip - state->chain[ip & (RLZ4_WINDOW_SIZE - 1)];
+
+                for (int depth = 0; (depth < maxDepth) && (candidate < ip); depth++)
+                {
+                    if ((src[candidate + matchLength] == src[ip + matchLength]) && (rlz4_read32(src + candidate) == sequence))
+                    {
+                        int length = RLZ4_MIN_MATCH;
+                        while (((ip + length) < matchLimit) && (src[candidate + length] == src[ip + length])) length++;
+
+                        if (length > matchLength)
+                        {
+                            matchPos = candidate;
+                            matchLength = length;
+                            if ((ip + length) >= matchLimit) break;
+                        }
+                    }
+
+                    int distance = state->chain[candidate & (RLZ4_WINDOW_SIZE - 1)];
+                    if ((distance == 0) || ((ip - (candidate - distance)) >= RLZ4_WINDOW_SIZE)) break;
+                    candidate -= distance;
+                }
+            }
+
+            if (matchPos < 0)
+            {
+                // No match, search step increases on incompressible data (level 1)
+                ip += (level == 1)? (step++ >> RLZ4_SKIP_TRIGGER) : 1;
+                continue;
+            }
+
+            // Extend match backwards over pending literals
+            int start = ip;
+            while ((start > anchor) && (matchPos > 0) && (src[start - 1] == src[matchPos - 1])) { start--; matchPos--; matchLength++; }
+
+            op = rlz4_write_sequence(op, src + anchor, start - anchor, start - matchPos, matchLength);
+
+            ip = start + matchLength;
+            anchor = ip;
+            step = 1 << RLZ4_SKIP_TRIGGER;
+
+            // Insert position inside match, improves next matches (level 1)
+            if ((level == 1) && (ip - 2 <= searchLimit)) state->head[rlz4_hash(rlz4_read32(src + ip - 2), bits)] = ip - 2 + 1;
+        }
+    }
+
+    // Last literals
+    op = rlz4_write_sequence(op, src + anchor, size - anchor, 0, 0);
+
+    return (int)(op - (unsigned char *)out);
+}
+
+// Decompress LZ4 block data, returns decompressed size (-1: invalid data or output capacity exceeded)
+// NOTE: Fast paths copy 8/16 bytes chunks while far enough from buffers end, exact copies otherwise
+int rlz4_decompress(void *out, int capacity, const void *in, int size)
+{
+    const unsigned char *ip = (const unsigned char *)in;
+    const unsigned char *inEnd = ip + size;
+    unsigned char *dst = (unsigned char *)out;
+    unsigned char *op = dst;
+    unsigned char *outEnd = dst + capacity;
+
+    if (size <= 0) return -1;
+
+    while (ip < inEnd)
+    {
+        unsigned int token = *ip++;
+
+        // Literals
+        size_t literalLength = token >> 4;
+
+        if ((literalLength <= 14) && ((inEnd - ip) >= 16) && ((outEnd - op) >= 16))
+        {
+            memcpy(op, ip, 16);     // Short literals fast path, extra bytes overwritten later
+        }
+        else
+        {
+            if (literalLength == 15)
+            {
+                unsigned int value = 255;
+                while ((value == 255) && (ip < inEnd)) { value = *ip++; literalLength += value; }
+                if (value == 255) return -1;
+            }
+
+            if ((literalLength > (size_t)(inEnd - ip)) || (literalLength > (size_t)(outEnd - op))) return -1;
+            memcpy(op, ip, literalLength);
+        }
+
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == inEnd) break;     // Last sequence, literals only
+
+        // Match
+        if ((inEnd - ip) < 2) return -1;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        if ((offset == 0) || (offset > (size_t)(op - dst))) return -1;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            unsigned int value = 255;
+            while ((value == 255) && (ip < inEnd)) { value = *ip++; matchLength += value; }
+            if (value == 255) return -1;
+        }
+        matchLength += RLZ4_MIN_MATCH;
+
+        if (matchLength > (size_t)(outEnd - op)) return -1;
+
+        const unsigned char *match = op - offset;
+
+        if ((offset >= 16) && ((size_t)(outEnd - op) >= (matchLength + 32)))
+        {
+            // Non-overlapping 16 bytes chunks, last chunk could write past match end
+            // NOTE: Most matches are short, first two chunks copied without loop
+            unsigned char *copyEnd = op + matchLength;
+            memcpy(op, match, 16);
+            memcpy(op + 16, match + 16, 16);
+            if (matchLength > 32)
+            {
+                op += 32;
+                match += 32;
+                do { memcpy(op, match, 16); op += 16; match += 16; } while (op < copyEnd);
+            }
+            op = copyEnd;
+        }
+        else if ((offset >= 8) && ((size_t)(outEnd - op) >= (matchLength + 8)))
+        {
+            // Non-overlapping 8 bytes chunks, last chunk could write past match end
+            unsigned char *copyEnd = op + matchLength;
+            do { memcpy(op, match, 8); op += 8; match += 8; } while (op < copyEnd);
+            op = copyEnd;
+        }
+        else
+        {
+            // Overlapping match (repeated pattern) or close to output end, bytes copied in order
+            for (size_t i = 0; i < matchLength; i++) op[i] = match[i];
+            op += matchLength;
+        }
+    }
+
+    return (int)(op - dst);
+}
+
+#endif // RLZ4_IMPLEMENTATION
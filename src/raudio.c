@@ -19,6 +19,18 @@
 *       Define to use the module as standalone library (independently of raylib).
 *       Required types and functions are defined in the same module.
 *
+*   #define SUPPORT_SIMD_AUDIO_MIXING
+*       Use SSE2/NEON/WASM SIMD instructions for audio buffers mixing (MixAudioFrames()),
+*       scalar fallback if not available
+*
+*   #define SUPPORT_FAST_AUDIO_RESAMPLING
+*       Mono/stereo buffers resampling (sample rate conversion and pitch) uses a linear resampler
+*       instead of miniaudio data converter, much cheaper for many pitched voices
+*
+*   #define SUPPORT_MUSIC_STREAM_THREAD
+*       Music streams are decoded on a dedicated thread, UpdateMusicStream() is not required every frame,
+*       main thread hitches do not starve music streams. Not available on web (no threads)
+*
 *   #define SUPPORT_FILEFORMAT_WAV
 *   #define SUPPORT_FILEFORMAT_OGG
 *   #define SUPPORT_FILEFORMAT_MP3
@@ -79,7 +91,13 @@
     #if !defined(EXTERNAL_CONFIG_FLAGS)
         #include "config.h"     // Defines module configuration flags
     #endif
-    #include "utils.h"          // Required for: fopen() Android mapping
+    #define MEMORY_MODULE MEMORY_MODULE_AUDIO   // Memory tracking module (SUPPORT_MEMORY_TRACKING)
+    #include "utils.h"          // Required for: fopen() Android mapping, PROFILE_BEGIN()
+#endif
+
+#if !defined(PROFILE_BEGIN)
+    #define PROFILE_BEGIN(name) (void)0
+    #define PROFILE_END() (void)0
 #endif
 
 #if defined(SUPPORT_MODULE_RAUDIO)
@@ -162,6 +180,7 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #define MA_MALLOC RL_MALLOC
+#define MA_REALLOC RL_REALLOC
 #define MA_FREE RL_FREE
 
 #define MA_NO_JACK
@@ -181,6 +200,20 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// SIMD audio mixing (MixAudioFrames()), scalar fallback if not available
+#if defined(SUPPORT_SIMD_AUDIO_MIXING)
+    #if defined(__wasm_simd128__)
+        #define RAUDIO_SIMD_WASM
+        #include <wasm_simd128.h>           // Required for: WebAssembly SIMD intrinsics
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAUDIO_SIMD_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RAUDIO_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -211,8 +244,24 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_OGG)
-    // TODO: Remap stb_vorbis malloc()/free() calls to RL_MALLOC/RL_FREE
+    // NOTE: stb_vorbis calls malloc()/realloc()/free() directly, remapped to RL_MALLOC/RL_REALLOC/RL_FREE
+    // WARNING: Standard headers used by stb_vorbis must be included before remapping
+    #include <assert.h>
+    #include <math.h>
+    #include <limits.h>
+    #if defined(_MSC_VER) || defined(__MINGW32__)
+        #include <malloc.h>
+    #endif
+
+    #define malloc(sz)          RL_MALLOC(sz)
+    #define realloc(ptr,sz)     RL_REALLOC(ptr,sz)
+    #define free(ptr)           RL_FREE(ptr)
+
     #include "external/stb_vorbis.c"    // OGG loading functions
+
+    #undef malloc
+    #undef realloc
+    #undef free
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_MP3)
@@ -282,7 +331,89 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
-    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
+    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels, voices for sound instances (PlaySoundInstance())
+#endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS               256    // Maximum audio commands queued for the audio thread
+#endif
+
+#ifndef AUDIO_SPATIAL_REAR_ATTENUATION
+    #define AUDIO_SPATIAL_REAR_ATTENUATION  0.3f    // Spatial sounds attenuation when placed right behind listener (head shadowing)
+#endif
+#ifndef AUDIO_BUS_BLOCK_SIZE
+    #define AUDIO_BUS_BLOCK_SIZE             512    // Audio buses mixing block size (frames), buffers are mixed by blocks when buses are used
+#endif
+#ifndef AUDIO_CAPTURE_BUFFER_SIZE
+    #define AUDIO_CAPTURE_BUFFER_SIZE       4096    // Audio capture stream ring buffer size (frames), captured frames are dropped if not read in time
+#endif
+#ifndef MAX_AUDIO_STREAM_SUB_BUFFERS
+    #define MAX_AUDIO_STREAM_SUB_BUFFERS       8    // Maximum sub-buffers of an audio stream (ring buffer depth)
+#endif
+#ifndef AUDIO_STREAM_ADAPTIVE_UNDERRUNS
+    #define AUDIO_STREAM_ADAPTIVE_UNDERRUNS    3    // Audio stream underruns required to grow its sub-buffers count (adaptive streams)
+#endif
+#ifndef MAX_MUSIC_STREAMS
+    #define MAX_MUSIC_STREAMS                 16    // Maximum music streams decoded by music streaming thread
+#endif
+#ifndef MUSIC_STREAM_THREAD_INTERVAL
+    #define MUSIC_STREAM_THREAD_INTERVAL       5    // Music streaming thread buffers refill check interval (milliseconds)
+#endif
+
+// NOTE: On web, music streaming thread requires multi-threading build (Web Workers)
+#if defined(SUPPORT_MUSIC_STREAM_THREAD) && (!defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define RAUDIO_MUSIC_THREAD
+#endif
+
+// Wave format converter is thread-local, every thread converting waves reuses its own
+#if defined(_MSC_VER)
+    #define RAUDIO_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define RAUDIO_THREAD_LOCAL _Thread_local
+#else
+    #define RAUDIO_THREAD_LOCAL __thread
+#endif
+
+#if ((MAX_AUDIO_COMMANDS & (MAX_AUDIO_COMMANDS - 1)) != 0)
+    #error "MAX_AUDIO_COMMANDS must be a power of two"
+#endif
+
+// SIMD 4 floats operations used by audio mixing
+#if defined(RAUDIO_SIMD_WASM)
+    #define RAUDIO_SIMD
+    #define SIMD4_LOAD(ptr)         wasm_v128_load(ptr)
+    #define SIMD4_STORE(ptr, a)     wasm_v128_store(ptr, a)
+    #define SIMD4_SET1(x)           wasm_f32x4_splat(x)
+    #define SIMD4_SETR(x, y, z, w)  wasm_f32x4_make(x, y, z, w)
+    #define SIMD4_ADD(a, b)         wasm_f32x4_add(a, b)
+    #define SIMD4_MUL(a, b)         wasm_f32x4_mul(a, b)
+    #define SIMD4_MIN(a, b)         wasm_f32x4_min(a, b)
+    #define SIMD4_MAX(a, b)         wasm_f32x4_max(a, b)
+    #define SIMD4_LOAD_S16(ptr)     wasm_f32x4_convert_i32x4(wasm_i32x4_load16x4(ptr))
+    #define SIMD4_STORE_S16(ptr, a) wasm_v128_store64_lane(ptr, wasm_i16x8_narrow_i32x4(wasm_i32x4_trunc_sat_f32x4(a), wasm_i32x4_trunc_sat_f32x4(a)), 0)
+#elif defined(RAUDIO_SIMD_SSE2)
+    #define RAUDIO_SIMD
+    #define SIMD4_LOAD(ptr)         _mm_loadu_ps(ptr)
+    #define SIMD4_STORE(ptr, a)     _mm_storeu_ps(ptr, a)
+    #define SIMD4_SET1(x)           _mm_set1_ps(x)
+    #define SIMD4_SETR(x, y, z, w)  _mm_setr_ps(x, y, z, w)
+    #define SIMD4_ADD(a, b)         _mm_add_ps(a, b)
+    #define SIMD4_MUL(a, b)         _mm_mul_ps(a, b)
+    #define SIMD4_MIN(a, b)         _mm_min_ps(a, b)
+    #define SIMD4_MAX(a, b)         _mm_max_ps(a, b)
+    #define SIMD4_LOAD_S16(ptr)     _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)(ptr))), 16))
+    #define SIMD4_STORE_S16(ptr, a) _mm_storel_epi64((__m128i *)(ptr), _mm_packs_epi32(_mm_cvttps_epi32(a), _mm_setzero_si128()))
+#elif defined(RAUDIO_SIMD_NEON)
+    #define RAUDIO_SIMD
+    #define SIMD4_LOAD(ptr)         vld1q_f32(ptr)
+    #define SIMD4_STORE(ptr, a)     vst1q_f32(ptr, a)
+    #define SIMD4_SET1(x)           vdupq_n_f32(x)
+    #define SIMD4_SETR(x, y, z, w)  vld1q_f32((const float[4]){ x, y, z, w })
+    #define SIMD4_ADD(a, b)         vaddq_f32(a, b)
+    #define SIMD4_MUL(a, b)         vmulq_f32(a, b)
+    #define SIMD4_MIN(a, b)         vminq_f32(a, b)
+    #define SIMD4_MAX(a, b)         vmaxq_f32(a, b)
+    #define SIMD4_LOAD_S16(ptr)     vcvtq_f32_s32(vmovl_s16(vld1_s16(ptr)))
+    #define SIMD4_STORE_S16(ptr, a) vst1_s16(ptr, vqmovn_s32(vcvtq_s32_f32(a)))
 #endif
 
 //----------------------------------------------------------------------------------
@@ -324,28 +455,133 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+#define AUDIO_REVERB_COMBS                 4    // Reverb comb filters per channel (processed as one SIMD vector)
+#define AUDIO_REVERB_ALLPASSES             2    // Reverb allpass filters per channel
+
+// Audio command type
+// NOTE: Commands are sent from main thread and processed by the audio thread before mixing,
+// audio thread owns the buffers list, processors lists and the buffers playback state
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,             // Play buffer from the start (at scheduled device frame, if any)
+    AUDIO_COMMAND_PLAY_CONTINUE,        // Play buffer from current frame cursor position
+    AUDIO_COMMAND_PLAY_INSTANCE,        // Play source buffer data from the start on a pooled voice buffer
+    AUDIO_COMMAND_STOP,                 // Stop buffer
+    AUDIO_COMMAND_VOLUME,               // Set buffer volume
+    AUDIO_COMMAND_PITCH,                // Set buffer pitch
+    AUDIO_COMMAND_PAN,                  // Set buffer pan
+    AUDIO_COMMAND_TRACK,                // Add buffer to mixing list
+    AUDIO_COMMAND_UNTRACK,              // Remove buffer from mixing list
+    AUDIO_COMMAND_UNLOAD,               // Remove buffer from mixing list and release it to be freed
+    AUDIO_COMMAND_ATTACH_PROCESSOR,     // Add processor to buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR,     // Remove processors from buffer (or mixed output if no buffer) and release them to be freed
+    AUDIO_COMMAND_LISTENER,             // Set listener and spatial settings, update spatial buffers, release command data to be freed
+    AUDIO_COMMAND_SPATIAL,              // Set buffers positions and velocities (batch), release command data to be freed
+    AUDIO_COMMAND_BUS_TRACK,            // Add bus to buses list
+    AUDIO_COMMAND_BUS_UNLOAD,           // Remove bus from buses list, route its buffers to output and release it to be freed
+    AUDIO_COMMAND_BUS_ROUTE,            // Route buffer to bus (or output if no bus)
+    AUDIO_COMMAND_BUS_VOLUME,           // Set bus volume
+    AUDIO_COMMAND_BUS_FILTER,           // Set bus filter type and coefficients, release command data to be freed
+    AUDIO_COMMAND_BUS_REVERB            // Set bus reverb parameters, release command data to be freed
+} AudioCommandType;
+
+// Audio decoder struct, compressed sounds data (QOA) is decoded on mixing by slices
+// NOTE: Only last decoded slice is kept, LMS state allows decoding next slices sequentially
+typedef struct rAudioDecoder {
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    qoa_lms_t lms[QOA_MAX_CHANNELS];                // QOA LMS state, after decoding last slice
+    short frames[QOA_SLICE_LEN*QOA_MAX_CHANNELS];   // Last decoded slice frames (interleaved)
+#endif
+    unsigned int slicePos;          // Last decoded slice position (frames)
+    unsigned int sliceFrames;       // Last decoded slice frames, 0 if no slice decoded
+} rAudioDecoder;
+
+// Audio bus filter, biquad filter (RBJ cookbook)
+typedef struct AudioBusFilter {
+    int type;                       // Filter type (AudioFilterType), AUDIO_FILTER_NONE: disabled
+    float b0, b1, b2, a1, a2;       // Biquad coefficients (normalized)
+    float z1[2], z2[2];             // Biquad state per channel (transposed direct form II)
+} AudioBusFilter;
+
+// Audio bus reverb, Schroeder-Moorer reverb (Freeverb tuning): parallel comb filters followed by allpass filters
+typedef struct AudioBusReverb {
+    float *delays;                  // Delay lines memory (combs and allpasses, both channels)
+    float *combs[2][AUDIO_REVERB_COMBS];            // Comb filters delay lines
+    int combLength[2][AUDIO_REVERB_COMBS];          // Comb filters delay lines length
+    int combIndex[2][AUDIO_REVERB_COMBS];           // Comb filters delay lines position
+    float combStore[2][AUDIO_REVERB_COMBS];         // Comb filters damping low-pass state
+    float *allpasses[2][AUDIO_REVERB_ALLPASSES];    // Allpass filters delay lines
+    int allpassLength[2][AUDIO_REVERB_ALLPASSES];   // Allpass filters delay lines length
+    int allpassIndex[2][AUDIO_REVERB_ALLPASSES];    // Allpass filters delay lines position
+    float feedback;                 // Comb filters feedback (room size)
+    float damping;                  // Comb filters damping
+    float mix;                      // Reverb wet mix, 0.0f: reverb disabled
+} AudioBusReverb;
+
+// Audio bus struct, submix of its buffers processed once per mixing block
+struct rAudioBus {
+    float frames[AUDIO_BUS_BLOCK_SIZE*AUDIO_DEVICE_CHANNELS];  // Bus mixing block
+    float volume;                   // Bus volume
+    rAudioProcessor *processor;     // Bus processors
+    AudioBusFilter filter;          // Bus built-in filter
+    AudioBusReverb reverb;          // Bus built-in reverb
+
+    rAudioBus *next;                // Next bus on the list
+    rAudioBus *prev;                // Previous bus on the list
+};
+
+// Audio capture struct, captured frames are written to a lock-free ring buffer by capture thread
+struct rAudioCapture {
+    ma_device device;               // miniaudio capture device
+    ma_pcm_rb ring;                 // Captured frames ring buffer (single producer: capture thread, single consumer: reader)
+    rAudioProcessor *processor;     // Capture processors, run on captured frames (capture thread)
+    ma_spinlock processorLock;      // Capture processors lock, only contended on attach/detach
+    ma_uint32 droppedFrames;        // Captured frames dropped because ring buffer was full
+};
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
 
     AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
     rAudioProcessor *processor;     // Audio processor
+    rAudioBus *bus;                 // Audio bus the buffer is mixed into, NULL: mixed into output
+    ma_uint64 startFrame;           // Scheduled playback start device frame, 0: not scheduled (audio thread)
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
+    float levels[2];                // Audio buffer mixing levels (left, right) applied on last mix, ramped on volume/pan changes
+
+    bool spatial;                   // Audio buffer positioned in 3d space, spatial gain/pan/pitch are applied
+    Vector3 position;               // Spatial position
+    Vector3 velocity;               // Spatial velocity (doppler)
+    float spatialGain;              // Spatial gain: distance and rear attenuation, multiplies volume
+    float spatialPan;               // Spatial pan (0.0f to 1.0f), replaces pan
+    float spatialPitch;             // Spatial pitch: doppler shift, multiplies pitch
+
+    ma_uint32 resamplerStep;        // Resampler step, input frames per output frame (16.16 fixed point), includes pitch
+    ma_uint32 resamplerFrac;        // Resampler position, input frames to move before next output frame (16.16 fixed point)
+    float resamplerFrames[4];       // Resampler previous and next input frames (left, right), interpolated
 
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    bool isSubBufferProcessed[MAX_AUDIO_STREAM_SUB_BUFFERS];    // SubBuffer processed (virtual ring buffer)
+    unsigned int subBufferSize;     // SubBuffer size in frames (fixed, sizeInFrames changes with subBufferCount)
+    unsigned int subBufferCount;    // SubBuffers in use (2 by default, double buffer)
+    unsigned int subBufferMaxCount; // SubBuffers allocated, count grows on repeated underruns if greater than subBufferCount
+    unsigned int underrunCount;     // Stream underruns, mixer ran out of data
+    unsigned int overrunCount;      // Stream overruns, data updated with no sub-buffer available
+    unsigned int adaptiveUnderruns; // Stream underruns since sub-buffers count was last changed
+    bool underrun;                  // Stream is running out of data, underrun already counted
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    rAudioDecoder *decoder;         // Data decoder, only for compressed data (QOA sounds)
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -361,24 +597,143 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+#if defined(RAUDIO_SIMD_WASM)
+typedef v128_t simd4f;              // SIMD 4 floats
+#elif defined(RAUDIO_SIMD_SSE2)
+typedef __m128 simd4f;              // SIMD 4 floats
+#elif defined(RAUDIO_SIMD_NEON)
+typedef float32x4_t simd4f;         // SIMD 4 floats
+#endif
+
+// Audio command struct
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Command audio buffer
+    AudioBuffer *source;            // Command source audio buffer (sound instance), voice buffer itself on voice unloading
+    rAudioProcessor *processor;     // Command processor (attached or released)
+    AudioCallback process;          // Command processor callback (detached)
+    rAudioBus *bus;                 // Command bus: bus commands, bus processors and buffer routing (NULL: output)
+    void *data;                     // Command data: listener, spatial batch or bus effect parameters, released once applied
+    float value;                    // Command value: volume, pitch or pan
+    ma_uint64 frame;                // Command device frame: scheduled playback start (0: right away)
+} AudioCommand;
+
+// Audio listener and spatial settings
+typedef struct AudioListener {
+    Vector3 position;               // Listener position
+    Vector3 forward;                // Listener forward direction
+    Vector3 up;                     // Listener up direction
+    Vector3 velocity;               // Listener velocity (doppler)
+    int distanceModel;              // Distance model (AudioDistanceModel)
+    float refDistance;              // Distance model reference distance, no attenuation below it
+    float maxDistance;              // Distance model maximum distance, no more attenuation beyond it
+    float rolloff;                  // Distance model rolloff factor
+    float dopplerFactor;            // Doppler factor (0.0f: doppler disabled)
+    float speedOfSound;             // Speed of sound (units per second)
+} AudioListener;
+
+// Audio spatial source, buffer position and velocity
+typedef struct AudioSpatialSource {
+    AudioBuffer *buffer;            // Spatial audio buffer (sound or sound instance voice)
+    Vector3 position;               // Spatial position
+    Vector3 velocity;               // Spatial velocity
+} AudioSpatialSource;
+
+// Audio spatial batch, sources updated with a single command
+typedef struct AudioSpatialBatch {
+    int count;                      // Sources count
+    AudioSpatialSource sources[];   // Sources positions and velocities
+} AudioSpatialBatch;
+
+// Audio voice struct, plays sound instances sharing sound data
+typedef struct AudioVoice {
+    AudioBuffer *buffer;            // Voice audio buffer, data is not owned
+    AudioBuffer *source;            // Sound audio buffer played by the voice
+    int id;                         // Sound instance id, voice index is (id%MAX_AUDIO_BUFFER_POOL_CHANNELS)
+    int priority;                   // Sound instance priority, lower priority voices are stolen first
+} AudioVoice;
+
+// Audio commands queue, lock-free single producer/single consumer ring buffer
+typedef struct AudioCommandQueue {
+    AudioCommand commands[MAX_AUDIO_COMMANDS];  // Commands ring buffer
+    ma_uint32 head;                 // Write position, only modified by producer thread
+    ma_uint32 tail;                 // Read position, only modified by consumer thread
+} AudioCommandQueue;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool offline;               // Offline device: not started, mixed on RenderAudioFrames() calls
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
+        ma_uint64 frameClock;       // Device frames mixed since device initialization (written by audio thread)
     } System;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
+        int defaultCount;           // Default sub-buffers count for audio streams
+        int defaultMaxCount;        // Default sub-buffers maximum count for audio streams (adaptive)
+        int defaultStorage;         // Default storage for new sounds (SoundStorage)
     } Buffer;
+    struct {
+        AudioCommandQueue pending;  // Commands sent by main thread, processed by audio thread
+        AudioCommandQueue released; // Buffers and processors released by audio thread, freed by main thread
+        ma_spinlock sendLock;       // Commands senders lock (main thread and music streaming thread), never taken by audio thread
+    } Command;
+#if defined(RAUDIO_MUSIC_THREAD)
+    struct {
+        Music streams[MAX_MUSIC_STREAMS];   // Music streams decoded by streaming thread (stream.buffer == NULL: free slot)
+        ma_mutex lock;              // Music decoders lock, shared by main thread and streaming thread
+        ma_thread thread;           // Music streaming thread
+        bool threadActive;          // Music streaming thread running
+        ma_uint32 quit;             // Music streaming thread quit request
+    } MusicStream;
+#endif
+    struct {
+        AudioVoice voices[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // Voices pool for sound instances
+        int counter;                // Sound instances counter, used to generate instances ids
+    } Voice;
+    struct {
+        rAudioBus *first;           // Pointer to first bus in the list (audio thread)
+        rAudioBus *last;            // Pointer to last bus in the list (audio thread)
+    } Bus;
+    struct {
+        AudioListener settings;     // Listener and spatial settings (main thread), sent on listener update
+        AudioListener listener;     // Listener and spatial settings (audio thread)
+    } Spatial;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
+#if !defined(RAUDIO_STANDALONE)
+// Sound async load request data
+typedef struct SoundAsyncLoad {
+    char *fileName;                 // Sound file name
+    Wave wave;                      // Decoded wave (loader thread)
+    Sound sound;                    // Loaded sound (main thread)
+} SoundAsyncLoad;
+
+// Sounds batch async load item
+typedef struct SoundBatchItem {
+    char *fileName;                 // Sound file name
+    float *data;                    // Decoded data in device format (device storage)
+    unsigned int frameCount;        // Decoded data frame count (device storage)
+    Wave wave;                      // Decoded wave (compact storage)
+    Sound sound;                    // Loaded sound (main thread)
+} SoundBatchItem;
+
+// Sounds batch async load request data
+typedef struct SoundBatchAsyncLoad {
+    SoundBatchItem *items;          // Sounds to load
+    int count;                      // Sounds count
+    int storage;                    // Sounds storage (SoundStorage), defined on request
+    unsigned int sampleRate;        // Device sample rate, defined on request
+} SoundBatchAsyncLoad;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -389,15 +744,67 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Spatial.settings = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, AUDIO_DISTANCE_INVERSE, 1.0f, 1000.0f, 1.0f, 1.0f, 343.3f },
+    .Spatial.listener = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, AUDIO_DISTANCE_INVERSE, 1.0f, 1000.0f, 1.0f, 1.0f, 343.3f },
     .mixedProcessor = NULL
 };
 
+// Wave format converter, reused by WaveFormat() while converting waves with same formats
+static RAUDIO_THREAD_LOCAL struct {
+    bool ready;                     // Converter initialized
+    ma_data_converter_config config; // Converter formats
+    ma_data_converter converter;    // miniaudio data converter
+} waveConverter = { 0 };
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
+static void OnReceiveAudioDataFromDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount); // Capture device callback, frames written to capture ring buffer
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);    // Mix audio buffer frames into output (device format)
+static void MixAudioBus(rAudioBus *bus, float *framesOut, ma_uint32 frameCount);                 // Process bus mixing block and mix it into output
+static void ProcessAudioBusFilter(AudioBusFilter *filter, float *frames, ma_uint32 frameCount);  // Process bus biquad filter (stereo)
+static void ProcessAudioBusReverb(AudioBusReverb *reverb, float *frames, ma_uint32 frameCount);  // Process bus reverb (stereo)
+static void GetAudioBufferLevels(AudioBuffer *buffer, float *levels);  // Get audio buffer mixing levels for current volume and pan
+static void ResetAudioBufferResampler(AudioBuffer *buffer, float pitch);   // Reset audio buffer resampler state and step for pitch (audio thread)
+static void UpdateAudioBufferPitch(AudioBuffer *buffer);            // Update audio buffer resampling for pitch and spatial pitch (audio thread)
+static void UpdateAudioBufferSpatial(AudioBuffer *buffer);          // Update audio buffer spatial gain, pan and pitch from listener (audio thread)
+
+static bool PushAudioCommand(AudioCommandQueue *queue, AudioCommand command);   // Push command to queue (producer thread)
+static bool PopAudioCommand(AudioCommandQueue *queue, AudioCommand *command);   // Pop command from queue (consumer thread)
+static void SendAudioCommand(AudioCommand command);                 // Send command to audio thread (main thread)
+static void ProcessAudioCommands(void);                             // Process all pending commands (audio thread)
+static void ProcessAudioCommand(AudioCommand command);              // Process one command (audio thread)
+static void FreeReleasedAudioData(void);                            // Free buffers and processors released by audio thread (main thread)
+static void ResetAudioBuffer(AudioBuffer *buffer);                  // Stop buffer and reset its playback state (audio thread)
+static void ConvertWaveSamples(const void *samplesIn, int sampleSizeIn, void *samplesOut, int sampleSizeOut, unsigned int sampleCount); // Convert wave samples size, in place if samples are not bigger
+static void ConvertSamplesS16ToF32(const short *samplesIn, float *samplesOut, unsigned int sampleCount, float scale);  // Convert s16 samples to float
+static void ConvertSamplesF32ToS16(const float *samplesIn, short *samplesOut, unsigned int sampleCount);              // Convert float samples to s16 (clipped), in place supported
+static AudioVoice *GetSoundInstanceVoice(int instance);             // Get voice playing a sound instance, NULL if instance is not valid anymore
+static Sound LoadSoundFromWaveCompact(Wave wave, int storage);      // Load sound keeping wave data compact (original PCM or QOA), converted on mixing
+static float *DecodeSoundData(const char *fileType, const unsigned char *fileData, int dataSize, ma_uint32 sampleRate, unsigned int *frameCount); // Decode file data directly to device format (thread-safe)
+static Sound LoadSoundFromDeviceData(float *data, unsigned int frameCount); // Load sound from device format data, data ownership is moved to sound
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static void DecodeAudioBufferFrames(AudioBuffer *buffer, short *framesOut, ma_uint32 position, ma_uint32 frameCount); // Decode compressed buffer frames (audio thread)
+#endif
+
+static void UpdateMusicStreamBuffers(Music music);                  // Refill processed music stream buffers with decoded data
+static void ResetMusicStream(Music music);                          // Stop music stream and rewind its decoder
+static void LockMusicStreams(void);                                 // Lock music decoders (if music streaming thread is running)
+static void UnlockMusicStreams(void);                               // Unlock music decoders (if music streaming thread is running)
+#if defined(RAUDIO_MUSIC_THREAD)
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data); // Music streaming thread, refills playing music streams buffers
+#endif
+
+#if !defined(RAUDIO_STANDALONE)
+static void DecodeSoundAsync(void *data);                           // Decode sound async load wave (loader thread)
+static void FinalizeSoundAsync(void *data);                         // Finalize sound async load, wave converted to sound (main thread)
+static void DecodeSoundBatchAsync(void *data);                      // Decode sounds batch async load, files decoded in parallel (loader thread)
+static void DecodeSoundBatchRange(int start, int end, void *userData); // Decode sounds batch range of files (jobs system threads)
+static void FinalizeSoundBatchAsync(void *data);                    // Finalize sounds batch async load, decoded data moved to sounds (main thread)
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -475,16 +882,6 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
-
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio / %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
@@ -493,6 +890,97 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+#if defined(RAUDIO_MUSIC_THREAD)
+    // NOTE: Streaming thread sends commands to the audio thread, it must be created once device is ready
+    if (ma_mutex_init(&AUDIO.MusicStream.lock) == MA_SUCCESS)
+    {
+        AUDIO.MusicStream.quit = 0;
+        AUDIO.MusicStream.threadActive = (ma_thread_create(&AUDIO.MusicStream.thread, ma_thread_priority_default, 0, MusicStreamThread, NULL, NULL) == MA_SUCCESS);
+
+        if (!AUDIO.MusicStream.threadActive)
+        {
+            ma_mutex_uninit(&AUDIO.MusicStream.lock);
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to create music streaming thread, UpdateMusicStream() required");
+        }
+    }
+#endif
+}
+
+// Initialize offline audio device, audio is mixed on RenderAudioFrames() calls (no playback)
+// NOTE: Mixing runs the same path than device playback as fast as possible, music streaming thread is not used,
+// UpdateMusicStream() is required between RenderAudioFrames() calls
+void InitAudioDeviceOffline(unsigned int sampleRate, unsigned int channels)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device already initialized");
+        return;
+    }
+
+    if (channels != AUDIO_DEVICE_CHANNELS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Offline device channels not supported, using %i channels", AUDIO_DEVICE_CHANNELS);
+        channels = AUDIO_DEVICE_CHANNELS;
+    }
+
+    // Init audio context, null backend device is never started
+    ma_backend backends[1] = { ma_backend_null };
+    ma_context_config ctxConfig = ma_context_config_init();
+    ma_log_callback_init(OnLog, NULL);
+
+    ma_result result = ma_context_init(backends, 1, &ctxConfig, &AUDIO.System.context);
+    if (result != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize offline context");
+        return;
+    }
+
+    ma_device_config config = ma_device_config_init(ma_device_type_playback);
+    config.playback.format = AUDIO_DEVICE_FORMAT;
+    config.playback.channels = channels;
+    config.sampleRate = sampleRate;
+    config.dataCallback = OnSendAudioDataToDevice;
+    config.pUserData = NULL;
+
+    result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
+    if (result != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize offline device");
+        ma_context_uninit(&AUDIO.System.context);
+        return;
+    }
+
+    TRACELOG(LOG_INFO, "AUDIO: Offline device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Format:        %s", ma_get_format_name(AUDIO.System.device.playback.format));
+    TRACELOG(LOG_INFO, "    > Channels:      %d", AUDIO.System.device.playback.channels);
+    TRACELOG(LOG_INFO, "    > Sample rate:   %d", AUDIO.System.device.sampleRate);
+
+    AUDIO.System.frameClock = 0;
+    AUDIO.System.offline = true;
+    AUDIO.System.isReady = true;
+}
+
+// Render audio frames with offline device, frames are interleaved floats (device channels)
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isReady || !AUDIO.System.offline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Offline device not initialized, frames can not be rendered");
+        return;
+    }
+
+    if ((frames == NULL) || (frameCount <= 0)) return;
+
+    OnSendAudioDataToDevice(&AUDIO.System.device, frames, NULL, (ma_uint32)frameCount);
+
+    // NOTE: Master volume is applied by the device on playback, it must be applied here
+    float masterVolume = 1.0f;
+    ma_device_get_master_volume(&AUDIO.System.device, &masterVolume);
+    if (masterVolume != 1.0f) ma_apply_volume_factor_pcm_frames_f32(frames, (ma_uint64)frameCount, AUDIO.System.device.playback.channels, masterVolume);
+
+    // Mixing runs on calling thread, released buffers can be freed right away
+    FreeReleasedAudioData();
 }
 
 // Close the audio device for all contexts
@@ -500,11 +988,39 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+#if defined(RAUDIO_MUSIC_THREAD)
+        if (AUDIO.MusicStream.threadActive)
+        {
+            c89atomic_store_32(&AUDIO.MusicStream.quit, 1);
+            ma_thread_wait(&AUDIO.MusicStream.thread);
+            ma_mutex_uninit(&AUDIO.MusicStream.lock);
+
+            AUDIO.MusicStream.threadActive = false;
+            memset(AUDIO.MusicStream.streams, 0, sizeof(AUDIO.MusicStream.streams));
+        }
+#endif
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+        AUDIO.System.offline = false;
+        AUDIO.System.frameClock = 0;
+
+        // Audio thread is not running anymore, remaining commands are processed here
+        ProcessAudioCommands();
+        FreeReleasedAudioData();
+
+        // Unload voices pool, voices data is owned by sounds
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+        {
+            if (AUDIO.Voice.voices[i].buffer != NULL)
+            {
+                AUDIO.Voice.voices[i].buffer->data = NULL;
+                UnloadAudioBuffer(AUDIO.Voice.voices[i].buffer);
+            }
+        }
+        memset(AUDIO.Voice.voices, 0, sizeof(AUDIO.Voice.voices));
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -526,6 +1042,17 @@ void SetMasterVolume(float volume)
     ma_device_set_master_volume(&AUDIO.System.device, volume);
 }
 
+// Get audio device time (in seconds), device frames mixed since initialization
+// NOTE: Time advances by device periods, it is the clock used to schedule sounds with PlaySoundAt()
+double GetAudioTime(void)
+{
+    double time = 0.0;
+
+    if (AUDIO.System.device.sampleRate > 0) time = (double)c89atomic_load_64(&AUDIO.System.frameClock)/AUDIO.System.device.sampleRate;
+
+    return time;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -560,6 +1087,11 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
+    audioBuffer->spatialGain = 1.0f;
+    audioBuffer->spatialPan = 0.5f;
+    audioBuffer->spatialPitch = 1.0f;
+    GetAudioBufferLevels(audioBuffer, audioBuffer->levels);
+    ResetAudioBufferResampler(audioBuffer, audioBuffer->pitch);
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
@@ -574,8 +1106,10 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->subBufferSize = (sizeInFrames > 1)? sizeInFrames/2 : sizeInFrames;
+    audioBuffer->subBufferCount = 2;
+    audioBuffer->subBufferMaxCount = 2;
+    for (int i = 0; i < MAX_AUDIO_STREAM_SUB_BUFFERS; i++) audioBuffer->isSubBufferProcessed[i] = true;
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -584,15 +1118,10 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is freed once the audio thread has stopped using it
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        UntrackAudioBuffer(buffer);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
-    }
+    if (buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = buffer });
 }
 
 // Check if an audio buffer is playing
@@ -612,9 +1141,11 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+        // NOTE: State is updated right away for IsAudioBufferPlaying(), frame cursor is reset by audio thread
         buffer->playing = true;
         buffer->paused = false;
-        buffer->frameCursorPos = 0;
+
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
     }
 }
 
@@ -625,12 +1156,13 @@ void StopAudioBuffer(AudioBuffer *buffer)
     {
         if (IsAudioBufferPlaying(buffer))
         {
+            // NOTE: Streaming state is reset right away so buffers can be refilled, frame cursor is reset by audio thread
             buffer->playing = false;
             buffer->paused = false;
-            buffer->frameCursorPos = 0;
             buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            for (int i = 0; i < MAX_AUDIO_STREAM_SUB_BUFFERS; i++) buffer->isSubBufferProcessed[i] = true;
+
+            SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
         }
     }
 }
@@ -650,23 +1182,14 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-    }
+    // NOTE: Data converter rate is updated by audio thread, it can not be changed while mixing
+    if ((buffer != NULL) && (pitch > 0.0f)) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
 }
 
 // Set pan for an audio buffer
@@ -675,41 +1198,19 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL) buffer->pan = pan;
+    if (buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
 }
 
 // Track audio buffer to linked list next position
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
 }
 
 // Untrack audio buffer from linked list
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
 }
 
 //----------------------------------------------------------------------------------
@@ -857,22 +1358,138 @@ bool IsWaveReady(Wave wave)
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 Sound LoadSound(const char *fileName)
 {
-    Wave wave = LoadWave(fileName);
+    Sound sound = { 0 };
+
+    if (AUDIO.Buffer.defaultStorage == SOUND_STORAGE_DEVICE)
+    {
+        // Device storage: file decoded by chunks directly into device format, no intermediate wave
+        unsigned int fileSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+        if (fileData != NULL)
+        {
+            unsigned int frameCount = 0;
+            float *data = DecodeSoundData(GetFileExtension(fileName), fileData, fileSize, AUDIO.System.device.sampleRate, &frameCount);
+
+            sound = LoadSoundFromDeviceData(data, frameCount);
+        }
+
+        RL_FREE(fileData);
+    }
+    else
+    {
+        Wave wave = LoadWave(fileName);
+
+        sound = LoadSoundFromWave(wave);
+
+        UnloadWave(wave);       // Sound is loaded, we can unload wave
+    }
+
+    return sound;
+}
+
+#if !defined(RAUDIO_STANDALONE)
+// Load sound from file asynchronously, returns request id (-1: failed)
+// NOTE: Wave is decoded on loader thread and converted on BeginDrawing(), check IsAsyncLoadReady()
+int LoadSoundAsync(const char *fileName)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)RL_CALLOC(1, sizeof(SoundAsyncLoad));
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
+
+    int request = LoadAsync(DecodeSoundAsync, FinalizeSoundAsync, load);
+
+    if (request < 0)
+    {
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return request;
+}
+
+// Get async loaded sound, request is released (empty if not ready)
+Sound GetSoundAsync(int request)
+{
+    Sound sound = { 0 };
+    SoundAsyncLoad *load = (SoundAsyncLoad *)GetAsyncLoadData(request, FinalizeSoundAsync);
 
-    Sound sound = LoadSoundFromWave(wave);
+    if (load != NULL)
+    {
+        sound = load->sound;
 
-    UnloadWave(wave);       // Sound is loaded, we can unload wave
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
 
     return sound;
 }
 
+// Load sounds from files asynchronously, returns request id (-1: failed)
+// NOTE: Files are decoded in parallel on jobs system (check InitJobSystem()) directly into device format,
+// sounds are created on BeginDrawing(), check IsAsyncLoadReady()
+int LoadSoundsAsync(const char **fileNames, int count)
+{
+    if ((fileNames == NULL) || (count <= 0)) return -1;
+
+    SoundBatchAsyncLoad *load = (SoundBatchAsyncLoad *)RL_CALLOC(1, sizeof(SoundBatchAsyncLoad));
+    load->items = (SoundBatchItem *)RL_CALLOC(count, sizeof(SoundBatchItem));
+    load->count = count;
+    load->storage = AUDIO.Buffer.defaultStorage;
+    load->sampleRate = AUDIO.System.device.sampleRate;
+
+    for (int i = 0; i < count; i++)
+    {
+        load->items[i].fileName = (char *)RL_MALLOC(strlen(fileNames[i]) + 1);
+        strcpy(load->items[i].fileName, fileNames[i]);
+    }
+
+    int request = LoadAsync(DecodeSoundBatchAsync, FinalizeSoundBatchAsync, load);
+
+    if (request < 0)
+    {
+        for (int i = 0; i < count; i++) RL_FREE(load->items[i].fileName);
+        RL_FREE(load->items);
+        RL_FREE(load);
+    }
+
+    return request;
+}
+
+// Get async loaded sounds, request is released, returns loaded sounds count (0: not ready)
+// NOTE: sounds array must hold the requested count, sounds failing to load are empty (check IsSoundReady())
+int GetSoundsAsync(int request, Sound *sounds)
+{
+    int count = 0;
+    SoundBatchAsyncLoad *load = (SoundBatchAsyncLoad *)GetAsyncLoadData(request, FinalizeSoundBatchAsync);
+
+    if (load != NULL)
+    {
+        for (int i = 0; i < load->count; i++)
+        {
+            sounds[i] = load->items[i].sound;
+            RL_FREE(load->items[i].fileName);
+        }
+
+        count = load->count;
+
+        RL_FREE(load->items);
+        RL_FREE(load);
+    }
+
+    return count;
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
+// NOTE: Sound data is converted to device format unless a compact storage is defined, check SetSoundStorageDefault()
 Sound LoadSoundFromWave(Wave wave)
 {
     Sound sound = { 0 };
 
-    if (wave.data != NULL)
+    if ((wave.data != NULL) && (AUDIO.Buffer.defaultStorage != SOUND_STORAGE_DEVICE)) sound = LoadSoundFromWaveCompact(wave, AUDIO.Buffer.defaultStorage);
+    else if (wave.data != NULL)
     {
         // When using miniaudio we need to do our own mixing.
         // To simplify this we need convert the format of each sound to be consistent with
@@ -909,6 +1526,21 @@ Sound LoadSoundFromWave(Wave wave)
     return sound;
 }
 
+// Set storage for new sounds (SoundStorage), compact storages are converted/decoded on mixing
+// NOTE: Compact storage saves memory (i.e. 22050 Hz s16 mono takes 1/8 of device format), QOA takes 1/5 of s16 data
+void SetSoundStorageDefault(int storage)
+{
+#if !defined(SUPPORT_FILEFORMAT_QOA)
+    if (storage == SOUND_STORAGE_QOA)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: QOA storage not supported, using PCM storage");
+        storage = SOUND_STORAGE_PCM;
+    }
+#endif
+
+    AUDIO.Buffer.defaultStorage = storage;
+}
+
 // Checks if a sound is ready
 bool IsSoundReady(Sound sound)
 {
@@ -927,8 +1559,20 @@ void UnloadWave(Wave wave)
 }
 
 // Unload sound
+// NOTE: Sound instances playing sound data are stopped
 void UnloadSound(Sound sound)
 {
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.voices[i];
+
+        if ((voice->source != NULL) && (voice->source == sound.stream.buffer))
+        {
+            StopAudioBuffer(voice->buffer);
+            voice->source = NULL;
+        }
+    }
+
     UnloadAudioBuffer(sound.stream.buffer);
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
@@ -938,6 +1582,12 @@ void UpdateSound(Sound sound, const void *data, int sampleCount)
 {
     if (sound.stream.buffer != NULL)
     {
+        if (sound.stream.buffer->decoder != NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Compressed sound data can not be updated");
+            return;
+        }
+
         StopAudioBuffer(sound.stream.buffer);
 
         // TODO: May want to lock/unlock this since this data buffer is read at mixing time
@@ -1074,6 +1724,22 @@ void PlaySound(Sound sound)
     PlayAudioBuffer(sound.stream.buffer);
 }
 
+// Play a sound at audio device time (in seconds), check GetAudioTime()
+// NOTE: Sound starts at the exact device frame, sound starts right away if time has already passed
+void PlaySoundAt(Sound sound, double audioTime)
+{
+    if ((sound.stream.buffer != NULL) && (AUDIO.System.device.sampleRate > 0))
+    {
+        ma_uint64 frame = (audioTime > 0.0)? (ma_uint64)(audioTime*AUDIO.System.device.sampleRate + 0.5) : 0;
+
+        // NOTE: State is updated right away for IsSoundPlaying(), a scheduled sound is considered playing
+        sound.stream.buffer->playing = true;
+        sound.stream.buffer->paused = false;
+
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = sound.stream.buffer, .frame = frame });
+    }
+}
+
 // Pause a sound
 void PauseSound(Sound sound)
 {
@@ -1116,43 +1782,293 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
-// Convert wave data to desired format
-void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
+// Play a sound instance on a pooled voice, sharing sound data, returns instance id (-1: no voice available)
+// NOTE: If all voices are busy, the oldest instance with lowest priority (not higher than requested one) is stolen
+int PlaySoundInstance(Sound sound, int priority)
 {
-    ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
-    ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    if (sound.stream.buffer == NULL) return -1;
 
-    ma_uint32 frameCountIn = wave->frameCount;
-    ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, formatOut, channels, sampleRate, NULL, frameCountIn, formatIn, wave->channels, wave->sampleRate);
+    int index = -1;
 
-    if (frameCount == 0)
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
     {
-        TRACELOG(LOG_WARNING, "WAVE: Failed to get frame count for format conversion");
-        return;
+        AudioVoice *voice = &AUDIO.Voice.voices[i];
+
+        // Free voice found, no need to steal one
+        if ((voice->buffer == NULL) || (voice->source == NULL) || !voice->buffer->playing) { index = i; break; }
+
+        // Steal lowest priority voice, oldest one on same priority
+        if (voice->priority <= priority)
+        {
+            AudioVoice *stolen = (index >= 0)? &AUDIO.Voice.voices[index] : NULL;
+
+            if ((stolen == NULL) || (voice->priority < stolen->priority) ||
+                ((voice->priority == stolen->priority) && (voice->id < stolen->id))) index = i;
+        }
     }
 
-    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+    if (index < 0) return -1;
 
-    frameCount = (ma_uint32)ma_convert_frames(data, frameCount, formatOut, channels, sampleRate, wave->data, frameCountIn, formatIn, wave->channels, wave->sampleRate);
-    if (frameCount == 0)
+    AudioVoice *voice = &AUDIO.Voice.voices[index];
+    AudioBuffer *source = sound.stream.buffer;
+
+    // Voice buffer data format must match sound data format (compact sounds storage), voice is recreated otherwise
+    if ((voice->buffer != NULL) && ((voice->buffer->converter.formatIn != source->converter.formatIn) ||
+        (voice->buffer->converter.channelsIn != source->converter.channelsIn) ||
+        (voice->buffer->converter.sampleRateIn != source->converter.sampleRateIn) ||
+        ((voice->buffer->decoder != NULL) != (source->decoder != NULL))))
     {
-        TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
-        return;
+        // NOTE: Voice data is owned by sound, it is detached on audio thread (voice could be still playing)
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = voice->buffer, .source = voice->buffer });
+        voice->buffer = NULL;
     }
 
-    wave->frameCount = frameCount;
-    wave->sampleSize = sampleSize;
-    wave->sampleRate = sampleRate;
-    wave->channels = channels;
+    if (voice->buffer == NULL)
+    {
+        voice->buffer = LoadAudioBuffer(source->converter.formatIn, source->converter.channelsIn, source->converter.sampleRateIn, 0, AUDIO_BUFFER_USAGE_STATIC);
+        if (voice->buffer == NULL) return -1;
 
-    RL_FREE(wave->data);
-    wave->data = data;
+        // Compressed sound data is decoded by every voice playing it
+        if (source->decoder != NULL) voice->buffer->decoder = (rAudioDecoder *)RL_CALLOC(1, sizeof(rAudioDecoder));
+    }
+
+    // Instances ids are increasing, so they also keep instances playing order
+    if (AUDIO.Voice.counter >= (2147483647/MAX_AUDIO_BUFFER_POOL_CHANNELS - 1)) AUDIO.Voice.counter = 0;
+    AUDIO.Voice.counter++;
+
+    voice->source = sound.stream.buffer;
+    voice->id = AUDIO.Voice.counter*MAX_AUDIO_BUFFER_POOL_CHANNELS + index;
+    voice->priority = priority;
+    voice->buffer->playing = true;
+    voice->buffer->paused = false;
+
+    // NOTE: Voice takes sound data, volume, pitch and pan on audio thread
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY_INSTANCE, .buffer = voice->buffer, .source = sound.stream.buffer });
+
+    return voice->id;
 }
 
-// Copy a wave to a new wave
-Wave WaveCopy(Wave wave)
+// Stop a sound instance
+void StopSoundInstance(int instance)
 {
-    Wave newWave = { 0 };
+    AudioVoice *voice = GetSoundInstanceVoice(instance);
+
+    if (voice != NULL)
+    {
+        StopAudioBuffer(voice->buffer);
+        voice->source = NULL;
+    }
+}
+
+// Check if a sound instance is currently playing
+bool IsSoundInstancePlaying(int instance)
+{
+    AudioVoice *voice = GetSoundInstanceVoice(instance);
+
+    return ((voice != NULL) && IsAudioBufferPlaying(voice->buffer));
+}
+
+// Set volume for a sound instance (1.0 is max level)
+void SetSoundInstanceVolume(int instance, float volume)
+{
+    AudioVoice *voice = GetSoundInstanceVoice(instance);
+
+    if (voice != NULL) SetAudioBufferVolume(voice->buffer, volume);
+}
+
+// Set pitch for a sound instance (1.0 is base level)
+void SetSoundInstancePitch(int instance, float pitch)
+{
+    AudioVoice *voice = GetSoundInstanceVoice(instance);
+
+    if (voice != NULL) SetAudioBufferPitch(voice->buffer, pitch);
+}
+
+// Set pan for a sound instance (0.5 is center)
+void SetSoundInstancePan(int instance, float pan)
+{
+    AudioVoice *voice = GetSoundInstanceVoice(instance);
+
+    if (voice != NULL) SetAudioBufferPan(voice->buffer, pan);
+}
+
+// Update audio listener, spatial sounds gain, pan and pitch are updated on audio thread
+// NOTE: Listener should be updated once per frame, spatial settings changes are also applied
+void UpdateAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity)
+{
+    AudioListener *listener = (AudioListener *)RL_MALLOC(sizeof(AudioListener));
+    if (listener == NULL) return;
+
+    AUDIO.Spatial.settings.position = position;
+    AUDIO.Spatial.settings.forward = forward;
+    AUDIO.Spatial.settings.up = up;
+    AUDIO.Spatial.settings.velocity = velocity;
+    *listener = AUDIO.Spatial.settings;
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_LISTENER, .data = listener });
+}
+
+// Set spatial sounds distance model (AudioDistanceModel), applied on next listener update
+void SetAudioDistanceModel(int model, float refDistance, float maxDistance, float rolloff)
+{
+    AUDIO.Spatial.settings.distanceModel = model;
+    AUDIO.Spatial.settings.refDistance = refDistance;
+    AUDIO.Spatial.settings.maxDistance = maxDistance;
+    AUDIO.Spatial.settings.rolloff = rolloff;
+}
+
+// Set spatial sounds doppler factor (0.0f: disabled) and speed of sound, applied on next listener update
+void SetAudioDopplerFactor(float factor, float speedOfSound)
+{
+    AUDIO.Spatial.settings.dopplerFactor = factor;
+    AUDIO.Spatial.settings.speedOfSound = speedOfSound;
+}
+
+// Set sounds 3d positions and velocities (optional, NULL), sounds become spatial
+// NOTE: All sounds are sent to audio thread in a single command
+void SetSoundPositions(const Sound *sounds, const Vector3 *positions, const Vector3 *velocities, int count)
+{
+    if ((sounds == NULL) || (positions == NULL) || (count <= 0)) return;
+
+    AudioSpatialBatch *batch = (AudioSpatialBatch *)RL_MALLOC(sizeof(AudioSpatialBatch) + count*sizeof(AudioSpatialSource));
+    if (batch == NULL) return;
+
+    batch->count = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (sounds[i].stream.buffer == NULL) continue;
+
+        AudioSpatialSource *source = &batch->sources[batch->count++];
+        source->buffer = sounds[i].stream.buffer;
+        source->position = positions[i];
+        source->velocity = (velocities != NULL)? velocities[i] : (Vector3){ 0.0f, 0.0f, 0.0f };
+    }
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SPATIAL, .data = batch });
+}
+
+// Set sound instances 3d positions and velocities (optional, NULL), instances become spatial
+// NOTE: Instances not playing anymore are ignored
+void SetSoundInstancePositions(const int *instances, const Vector3 *positions, const Vector3 *velocities, int count)
+{
+    if ((instances == NULL) || (positions == NULL) || (count <= 0)) return;
+
+    AudioSpatialBatch *batch = (AudioSpatialBatch *)RL_MALLOC(sizeof(AudioSpatialBatch) + count*sizeof(AudioSpatialSource));
+    if (batch == NULL) return;
+
+    batch->count = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        AudioVoice *voice = GetSoundInstanceVoice(instances[i]);
+        if (voice == NULL) continue;
+
+        AudioSpatialSource *source = &batch->sources[batch->count++];
+        source->buffer = voice->buffer;
+        source->position = positions[i];
+        source->velocity = (velocities != NULL)? velocities[i] : (Vector3){ 0.0f, 0.0f, 0.0f };
+    }
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SPATIAL, .data = batch });
+}
+
+// Convert wave data to desired format
+void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0)) return;
+
+    // Same sample rate and channels, only samples size conversion required (in place if samples are not bigger)
+    if (((unsigned int)sampleRate == wave->sampleRate) && ((unsigned int)channels == wave->channels))
+    {
+        if ((unsigned int)sampleSize == wave->sampleSize) return;
+
+        unsigned int sampleCount = wave->frameCount*wave->channels;
+        void *data = ((unsigned int)sampleSize < wave->sampleSize)? wave->data : RL_MALLOC(sampleCount*(sampleSize/8));
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "WAVE: Failed to allocate memory for format conversion");
+            return;
+        }
+
+        ConvertWaveSamples(wave->data, wave->sampleSize, data, sampleSize, sampleCount);
+
+        if (data == wave->data)
+        {
+            // NOTE: Shrinking could fail, data is kept bigger than required in that case
+            void *shrunk = RL_REALLOC(wave->data, sampleCount*(sampleSize/8));
+            if (shrunk != NULL) wave->data = shrunk;
+        }
+        else
+        {
+            RL_FREE(wave->data);
+            wave->data = data;
+        }
+
+        wave->sampleSize = sampleSize;
+        return;
+    }
+
+    ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    // Thread converter is reused if formats match, it just requires a reset
+    ma_data_converter_config config = ma_data_converter_config_init(formatIn, formatOut, wave->channels, channels, wave->sampleRate, sampleRate);
+    config.resampling.linear.lpfOrder = ma_min(MA_DEFAULT_RESAMPLER_LPF_ORDER, MA_MAX_FILTER_ORDER);   // Same filtering as ma_convert_frames()
+
+    if (waveConverter.ready && (waveConverter.config.formatIn == config.formatIn) && (waveConverter.config.formatOut == config.formatOut) &&
+        (waveConverter.config.channelsIn == config.channelsIn) && (waveConverter.config.channelsOut == config.channelsOut) &&
+        (waveConverter.config.sampleRateIn == config.sampleRateIn) && (waveConverter.config.sampleRateOut == config.sampleRateOut))
+    {
+        ma_data_converter_reset(&waveConverter.converter);
+    }
+    else
+    {
+        if (waveConverter.ready) ma_data_converter_uninit(&waveConverter.converter, NULL);
+
+        waveConverter.config = config;
+        waveConverter.ready = (ma_data_converter_init(&config, NULL, &waveConverter.converter) == MA_SUCCESS);
+
+        if (!waveConverter.ready)
+        {
+            TRACELOG(LOG_WARNING, "WAVE: Failed to create format converter");
+            return;
+        }
+    }
+
+    ma_uint64 frameCountIn = wave->frameCount;
+    ma_uint64 frameCount = 0;
+    ma_data_converter_get_expected_output_frame_count(&waveConverter.converter, frameCountIn, &frameCount);
+
+    if (frameCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "WAVE: Failed to get frame count for format conversion");
+        return;
+    }
+
+    void *data = RL_MALLOC((size_t)frameCount*channels*(sampleSize/8));
+
+    if ((data == NULL) || (ma_data_converter_process_pcm_frames(&waveConverter.converter, wave->data, &frameCountIn, data, &frameCount) != MA_SUCCESS) || (frameCount == 0))
+    {
+        TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
+        RL_FREE(data);
+        return;
+    }
+
+    wave->frameCount = (unsigned int)frameCount;
+    wave->sampleSize = sampleSize;
+    wave->sampleRate = sampleRate;
+    wave->channels = channels;
+
+    RL_FREE(wave->data);
+    wave->data = data;
+}
+
+// Copy a wave to a new wave
+Wave WaveCopy(Wave wave)
+{
+    Wave newWave = { 0 };
 
     newWave.data = RL_MALLOC(wave.frameCount*wave.channels*wave.sampleSize/8);
 
@@ -1176,14 +2092,19 @@ void WaveCrop(Wave *wave, int initSample, int finalSample)
 {
     if ((initSample >= 0) && (initSample < finalSample) && ((unsigned int)finalSample < (wave->frameCount*wave->channels)))
     {
-        int sampleCount = finalSample - initSample;
+        // NOTE: Samples range is aligned to frames, cropped data is moved in place
+        unsigned int initFrame = initSample/wave->channels;
+        unsigned int frameCount = (finalSample - initSample)/wave->channels;
+        unsigned int frameSize = wave->channels*wave->sampleSize/8;
+
+        if (frameCount == 0) frameCount = 1;
 
-        void *data = RL_MALLOC(sampleCount*wave->sampleSize/8);
+        memmove(wave->data, (unsigned char *)wave->data + initFrame*frameSize, frameCount*frameSize);
 
-        memcpy(data, (unsigned char *)wave->data + (initSample*wave->channels*wave->sampleSize/8), sampleCount*wave->sampleSize/8);
+        void *data = RL_REALLOC(wave->data, frameCount*frameSize);
+        if (data != NULL) wave->data = data;
 
-        RL_FREE(wave->data);
-        wave->data = data;
+        wave->frameCount = frameCount;
     }
     else TRACELOG(LOG_WARNING, "WAVE: Crop range out of bounds");
 }
@@ -1193,16 +2114,18 @@ void WaveCrop(Wave *wave, int initSample, int finalSample)
 // NOTE 2: Sample data allocated should be freed with UnloadWaveSamples()
 float *LoadWaveSamples(Wave wave)
 {
-    float *samples = (float *)RL_MALLOC(wave.frameCount*wave.channels*sizeof(float));
-
     // NOTE: sampleCount is the total number of interlaced samples (including channels)
+    unsigned int sampleCount = wave.frameCount*wave.channels;
+    float *samples = (float *)RL_MALLOC(sampleCount*sizeof(float));
+
+    if (samples == NULL) return NULL;
 
-    for (unsigned int i = 0; i < wave.frameCount*wave.channels; i++)
+    if (wave.sampleSize == 8)
     {
-        if (wave.sampleSize == 8) samples[i] = (float)(((unsigned char *)wave.data)[i] - 127)/256.0f;
-        else if (wave.sampleSize == 16) samples[i] = (float)(((short *)wave.data)[i])/32767.0f;
-        else if (wave.sampleSize == 32) samples[i] = ((float *)wave.data)[i];
+        for (unsigned int i = 0; i < sampleCount; i++) samples[i] = (float)(((unsigned char *)wave.data)[i] - 127)/256.0f;
     }
+    else if (wave.sampleSize == 16) ConvertSamplesS16ToF32((short *)wave.data, samples, sampleCount, 1.0f/32767.0f);
+    else if (wave.sampleSize == 32) memcpy(samples, wave.data, sampleCount*sizeof(float));
 
     return samples;
 }
@@ -1630,6 +2553,16 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(RAUDIO_MUSIC_THREAD)
+    // Music stream must be removed from streaming thread before releasing its data
+    LockMusicStreams();
+    for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+    {
+        if ((music.stream.buffer != NULL) && (AUDIO.MusicStream.streams[i].stream.buffer == music.stream.buffer)) AUDIO.MusicStream.streams[i].stream.buffer = NULL;
+    }
+    UnlockMusicStreams();
+#endif
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1665,12 +2598,31 @@ void PlayMusicStream(Music music)
     if (music.stream.buffer != NULL)
     {
         // For music streams, we need to make sure we maintain the frame cursor position
-        // This is a hack for this section of code in UpdateMusicStream()
         // NOTE: In case window is minimized, music stream is stopped, just make sure to
         // play again on window restore: if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = music.stream.buffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        music.stream.buffer->frameCursorPos = frameCursorPos;
+        music.stream.buffer->playing = true;
+        music.stream.buffer->paused = false;
+
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY_CONTINUE, .buffer = music.stream.buffer });
+
+#if defined(RAUDIO_MUSIC_THREAD)
+        // Add music stream to streaming thread, music looping state is updated if already added
+        if (AUDIO.MusicStream.threadActive)
+        {
+            int index = -1;
+
+            LockMusicStreams();
+            for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+            {
+                if (AUDIO.MusicStream.streams[i].stream.buffer == music.stream.buffer) { index = i; break; }
+                if ((index < 0) && (AUDIO.MusicStream.streams[i].stream.buffer == NULL)) index = i;
+            }
+
+            if (index >= 0) AUDIO.MusicStream.streams[index] = music;
+            else TRACELOG(LOG_WARNING, "STREAM: Music streaming thread is full (MAX_MUSIC_STREAMS: %i), UpdateMusicStream() required", MAX_MUSIC_STREAMS);
+            UnlockMusicStreams();
+        }
+#endif
     }
 }
 
@@ -1689,33 +2641,9 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
-
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    LockMusicStreams();
+    ResetMusicStream(music);
+    UnlockMusicStreams();
 }
 
 // Seek music to a certain position (in seconds)
@@ -1726,6 +2654,8 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    LockMusicStreams();
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1747,214 +2677,90 @@ void SeekMusicStream(Music music, float position)
     }
 
     music.stream.buffer->framesProcessed = positionInFrames;
+
+    UnlockMusicStreams();
 }
 
 // Update (re-fill) music buffers if data already processed
+// NOTE: Not required if music stream is decoded by music streaming thread, music looping state is updated
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
-    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
+    PROFILE_BEGIN("UpdateMusicStream");
 
-    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
-    int frameSize = music.stream.channels*music.stream.sampleSize/8;
-    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
+    bool streamed = false;
 
-    if (AUDIO.System.pcmBufferSize < pcmSize)
+    LockMusicStreams();
+#if defined(RAUDIO_MUSIC_THREAD)
+    for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
     {
-        RL_FREE(AUDIO.System.pcmBuffer);
-        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
-        AUDIO.System.pcmBufferSize = pcmSize;
+        if (AUDIO.MusicStream.streams[i].stream.buffer == music.stream.buffer)
+        {
+            AUDIO.MusicStream.streams[i].looping = music.looping;
+            streamed = true;
+            break;
+        }
     }
+#endif
+    if (!streamed) UpdateMusicStreamBuffers(music);
+    UnlockMusicStreams();
 
-    // Check both sub-buffers to check if they require refilling
-    for (int i = 0; i < 2; i++)
-    {
-        if ((music.stream.buffer != NULL) && !music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+    // NOTE: In case window is minimized, music stream is stopped,
+    // just make sure to play again on window restore
+    if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
-        unsigned int framesToStream = 0;                 // Total frames to be streamed
+    PROFILE_END();
+}
 
-        if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
-        else framesToStream = framesLeft;
+// Check if any music is playing
+bool IsMusicStreamPlaying(Music music)
+{
+    return IsAudioStreamPlaying(music.stream);
+}
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
+// Set volume for music
+void SetMusicVolume(Music music, float volume)
+{
+    SetAudioStreamVolume(music.stream, volume);
+}
 
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
-
-        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
-
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
-
-        if (framesLeft <= subBufferSizeInFrames)
-        {
-            if (!music.looping)
-            {
-                // Streaming is ending, we filled latest frames from input
-                StopMusicStream(music);
-                return;
-            }
-        }
-    }
-
-    // NOTE: In case window is minimized, music stream is stopped,
-    // just make sure to play again on window restore
-    if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
-}
-
-// Check if any music is playing
-bool IsMusicStreamPlaying(Music music)
-{
-    return IsAudioStreamPlaying(music.stream);
-}
-
-// Set volume for music
-void SetMusicVolume(Music music, float volume)
-{
-    SetAudioStreamVolume(music.stream, volume);
-}
-
-// Set pitch for music
-void SetMusicPitch(Music music, float pitch)
-{
-    SetAudioBufferPitch(music.stream.buffer, pitch);
-}
-
-// Set pan for a music
-void SetMusicPan(Music music, float pan)
-{
-    SetAudioBufferPan(music.stream.buffer, pan);
-}
-
-// Get music time length (in seconds)
-float GetMusicTimeLength(Music music)
-{
-    float totalSeconds = 0.0f;
-
-    totalSeconds = (float)music.frameCount/music.stream.sampleRate;
-
-    return totalSeconds;
-}
-
-// Get current music time played (in seconds)
-float GetMusicTimePlayed(Music music)
-{
-    float secondsPlayed = 0.0f;
-    if (music.stream.buffer != NULL)
-    {
-#if defined(SUPPORT_FILEFORMAT_XM)
-        if (music.ctxType == MUSIC_MODULE_XM)
+// Set pitch for music
+void SetMusicPitch(Music music, float pitch)
+{
+    SetAudioBufferPitch(music.stream.buffer, pitch);
+}
+
+// Set pan for a music
+void SetMusicPan(Music music, float pan)
+{
+    SetAudioBufferPan(music.stream.buffer, pan);
+}
+
+// Get music time length (in seconds)
+float GetMusicTimeLength(Music music)
+{
+    float totalSeconds = 0.0f;
+
+    totalSeconds = (float)music.frameCount/music.stream.sampleRate;
+
+    return totalSeconds;
+}
+
+// Get current music time played (in seconds)
+float GetMusicTimePlayed(Music music)
+{
+    float secondsPlayed = 0.0f;
+    if (music.stream.buffer != NULL)
+    {
+#if defined(SUPPORT_FILEFORMAT_XM)
+        if (music.ctxType == MUSIC_MODULE_XM)
         {
             uint64_t framesPlayed = 0;
 
+            LockMusicStreams();
             jar_xm_get_position(music.ctxData, NULL, NULL, NULL, &framesPlayed);
+            UnlockMusicStreams();
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
@@ -1962,11 +2768,12 @@ float GetMusicTimePlayed(Music music)
         {
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
             int framesProcessed = (int)music.stream.buffer->framesProcessed;
-            int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
+            int subBufferCount = (int)music.stream.buffer->subBufferCount;
+            int subBufferSize = (int)music.stream.buffer->subBufferSize;
+            int framesInBuffers = 0;
+            for (int i = 0; i < subBufferCount; i++) framesInBuffers += music.stream.buffer->isSubBufferProcessed[i]? 0 : subBufferSize;
             int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
-            int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
+            int framesPlayed = (framesProcessed - framesInBuffers + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
@@ -1994,11 +2801,19 @@ AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, un
 
     if (subBufferSize < periodSize) subBufferSize = periodSize;
 
-    // Create a double audio buffer of defined size
-    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+    // Sub-buffers are allocated for the maximum count, only required ones are used (adaptive streams)
+    unsigned int subBufferCount = (AUDIO.Buffer.defaultCount == 0)? 2 : AUDIO.Buffer.defaultCount;
+    unsigned int subBufferMaxCount = (AUDIO.Buffer.defaultMaxCount == 0)? subBufferCount : (unsigned int)AUDIO.Buffer.defaultMaxCount;
+
+    // Create a ring audio buffer of defined size, double buffer by default
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*subBufferMaxCount, AUDIO_BUFFER_USAGE_STREAM);
 
     if (stream.buffer != NULL)
     {
+        stream.buffer->subBufferSize = subBufferSize;
+        stream.buffer->subBufferCount = subBufferCount;
+        stream.buffer->subBufferMaxCount = subBufferMaxCount;
+        stream.buffer->sizeInFrames = subBufferSize*subBufferCount;
         stream.buffer->looping = true;    // Always loop for streaming buffers
         TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
     }
@@ -2031,24 +2846,33 @@ void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        ma_uint32 subBufferCount = stream.buffer->subBufferCount;
+        ma_uint32 subBufferSizeInFrames = stream.buffer->subBufferSize;
+        ma_uint32 currentSubBufferIndex = (stream.buffer->frameCursorPos/subBufferSizeInFrames)%subBufferCount;
+
+        // Sub-buffers waiting to be mixed follow the current one, the first processed
+        // sub-buffer found after them (ring order) is the next one to update
+        int subBufferToUpdate = -1;
+        bool allSubBuffersProcessed = true;
+
+        for (ma_uint32 i = 0; i < subBufferCount; i++)
         {
-            ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 index = (currentSubBufferIndex + i)%subBufferCount;
+
+            if (!stream.buffer->isSubBufferProcessed[index]) allSubBuffersProcessed = false;
+            else if (subBufferToUpdate < 0) subBufferToUpdate = (int)index;
+        }
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+        if (subBufferToUpdate >= 0)
+        {
+            if (allSubBuffersProcessed)
             {
-                // Both buffers are available for updating.
+                // All buffers are available for updating.
                 // Update the first one and make sure the cursor is moved back to the front.
                 subBufferToUpdate = 0;
                 stream.buffer->frameCursorPos = 0;
             }
-            else
-            {
-                // Just update whichever sub-buffer is processed.
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
-            }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
             unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
 
             // Total frames processed in buffer is always the complete size, filled with 0 if required
@@ -2072,7 +2896,11 @@ void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+        else
+        {
+            stream.buffer->overrunCount++;
+            TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+        }
     }
 }
 
@@ -2081,7 +2909,14 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    return (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1]);
+    bool processed = false;
+
+    for (unsigned int i = 0; i < stream.buffer->subBufferCount; i++)
+    {
+        if (stream.buffer->isSubBufferProcessed[i]) { processed = true; break; }
+    }
+
+    return processed;
 }
 
 // Play audio stream
@@ -2138,6 +2973,38 @@ void SetAudioStreamBufferSizeDefault(int size)
     AUDIO.Buffer.defaultSize = size;
 }
 
+// Default sub-buffers count for new audio streams (2 by default, double buffer)
+// NOTE: If maxCount is greater than count, sub-buffers count grows on repeated underruns (adaptive streams)
+void SetAudioStreamBufferCountDefault(int count, int maxCount)
+{
+    if (count < 2) count = 2;
+    else if (count > MAX_AUDIO_STREAM_SUB_BUFFERS) count = MAX_AUDIO_STREAM_SUB_BUFFERS;
+
+    if (maxCount < count) maxCount = count;
+    else if (maxCount > MAX_AUDIO_STREAM_SUB_BUFFERS) maxCount = MAX_AUDIO_STREAM_SUB_BUFFERS;
+
+    AUDIO.Buffer.defaultCount = count;
+    AUDIO.Buffer.defaultMaxCount = maxCount;
+}
+
+// Get audio stream buffering stats
+AudioStreamStats GetAudioStreamStats(AudioStream stream)
+{
+    AudioStreamStats stats = { 0 };
+
+    if (stream.buffer != NULL)
+    {
+        stats.subBufferCount = stream.buffer->subBufferCount;
+        stats.subBufferMaxCount = stream.buffer->subBufferMaxCount;
+        stats.subBufferSize = stream.buffer->subBufferSize;
+        stats.underrunCount = stream.buffer->underrunCount;
+        stats.overrunCount = stream.buffer->overrunCount;
+        if (stream.sampleRate > 0) stats.latency = (float)stream.buffer->sizeInFrames/stream.sampleRate;
+    }
+
+    return stats;
+}
+
 // Audio thread callback to request new data
 void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
@@ -2146,55 +3013,20 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important.
 // The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element.
+// a given stream, the audio thread iterates through the list to find the end. That way we don't need a pointer to the last element.
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor });
 }
 
 // Remove processor from audio stream
+// NOTE: Processor could still be called by audio thread for the buffer being mixed
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .process = process });
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2202,91 +3034,430 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor });
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .process = process });
+}
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AudioBus management functions
+//----------------------------------------------------------------------------------
 
-    while (processor)
+// Load audio bus, sounds and streams routed to the bus are mixed together and processed once
+AudioBus LoadAudioBus(void)
+{
+    AudioBus bus = { 0 };
+
+    bus.bus = (rAudioBus *)RL_CALLOC(1, sizeof(rAudioBus));
+
+    if (bus.bus == NULL)
     {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus");
+        return bus;
+    }
 
-        if (processor->process == process)
+    bus.bus->volume = 1.0f;
+
+    // Reverb delay lines, Freeverb tuning (44100 Hz) scaled to device sample rate, right channel lines are spread
+    static const int combTuning[AUDIO_REVERB_COMBS] = { 1116, 1188, 1277, 1356 };
+    static const int allpassTuning[AUDIO_REVERB_ALLPASSES] = { 556, 441 };
+    const int stereoSpread = 23;
+
+    AudioBusReverb *reverb = &bus.bus->reverb;
+    float scale = (AUDIO.System.device.sampleRate > 0)? (float)AUDIO.System.device.sampleRate/44100.0f : 1.0f;
+    int delaysLength = 0;
+
+    for (int c = 0; c < 2; c++)
+    {
+        for (int k = 0; k < AUDIO_REVERB_COMBS; k++)
         {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+            reverb->combLength[c][k] = (int)((combTuning[k] + c*stereoSpread)*scale);
+            delaysLength += reverb->combLength[c][k];
+        }
 
-            RL_FREE(processor);
+        for (int k = 0; k < AUDIO_REVERB_ALLPASSES; k++)
+        {
+            reverb->allpassLength[c][k] = (int)((allpassTuning[k] + c*stereoSpread)*scale);
+            delaysLength += reverb->allpassLength[c][k];
         }
+    }
 
-        processor = next;
+    reverb->delays = (float *)RL_CALLOC(delaysLength, sizeof(float));
+
+    if (reverb->delays != NULL)
+    {
+        float *delay = reverb->delays;
+
+        for (int c = 0; c < 2; c++)
+        {
+            for (int k = 0; k < AUDIO_REVERB_COMBS; k++) { reverb->combs[c][k] = delay; delay += reverb->combLength[c][k]; }
+            for (int k = 0; k < AUDIO_REVERB_ALLPASSES; k++) { reverb->allpasses[c][k] = delay; delay += reverb->allpassLength[c][k]; }
+        }
     }
+    else TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus reverb");
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_TRACK, .bus = bus.bus });
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    return bus;
 }
 
+// Checks if an audio bus is ready
+bool IsAudioBusReady(AudioBus bus)
+{
+    return (bus.bus != NULL);
+}
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+// Unload audio bus, sounds and streams routed to the bus are mixed into output
+void UnloadAudioBus(AudioBus bus)
+{
+    if (bus.bus != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_UNLOAD, .bus = bus.bus });
+}
 
-// Log callback function
-static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
+// Set volume for an audio bus (1.0 is max level)
+void SetAudioBusVolume(AudioBus bus, float volume)
 {
-    TRACELOG(LOG_WARNING, "miniaudio: %s", pMessage);   // All log messages from miniaudio are errors
+    if (bus.bus != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_VOLUME, .bus = bus.bus, .value = volume });
 }
 
-// Reads audio data from an AudioBuffer object in internal format.
-static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+// Set audio bus filter (AudioFilterType), resonance is filter Q factor (0.707f: no resonance)
+void SetAudioBusFilter(AudioBus bus, int type, float frequency, float resonance)
 {
-    // Using audio buffer callback
-    if (audioBuffer->callback)
-    {
-        audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+    if (bus.bus == NULL) return;
 
-        return frameCount;
+    AudioBusFilter *filter = (AudioBusFilter *)RL_CALLOC(1, sizeof(AudioBusFilter));
+    if (filter == NULL) return;
+
+    float sampleRate = (AUDIO.System.device.sampleRate > 0)? (float)AUDIO.System.device.sampleRate : 44100.0f;
+    if (frequency > 0.49f*sampleRate) frequency = 0.49f*sampleRate;
+    if (resonance <= 0.0f) resonance = 0.707f;
+
+    // Biquad coefficients, RBJ audio EQ cookbook
+    float w0 = 2.0f*PI*frequency/sampleRate;
+    float cosw0 = cosf(w0);
+    float alpha = sinf(w0)/(2.0f*resonance);
+    float a0 = 1.0f + alpha;
+
+    switch (type)
+    {
+        case AUDIO_FILTER_LOWPASS:
+        {
+            filter->b0 = (1.0f - cosw0)*0.5f/a0;
+            filter->b1 = (1.0f - cosw0)/a0;
+            filter->b2 = filter->b0;
+        } break;
+        case AUDIO_FILTER_HIGHPASS:
+        {
+            filter->b0 = (1.0f + cosw0)*0.5f/a0;
+            filter->b1 = -(1.0f + cosw0)/a0;
+            filter->b2 = filter->b0;
+        } break;
+        case AUDIO_FILTER_BANDPASS:
+        {
+            filter->b0 = alpha/a0;
+            filter->b1 = 0.0f;
+            filter->b2 = -alpha/a0;
+        } break;
+        default: type = AUDIO_FILTER_NONE; break;
     }
 
-    ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
-    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+    filter->type = type;
+    filter->a1 = -2.0f*cosw0/a0;
+    filter->a2 = (1.0f - alpha)/a0;
 
-    if (currentSubBufferIndex > 1) return 0;
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_FILTER, .bus = bus.bus, .data = filter });
+}
 
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+// Set audio bus reverb, room size and damping in [0..1] range, mix is reverb wet level (0.0f: reverb disabled)
+void SetAudioBusReverb(AudioBus bus, float roomSize, float damping, float mix)
+{
+    if (bus.bus == NULL) return;
 
-    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    AudioBusReverb *reverb = (AudioBusReverb *)RL_CALLOC(1, sizeof(AudioBusReverb));
+    if (reverb == NULL) return;
 
-    // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
+    // NOTE: Feedback and damping ranges follow Freeverb tuning
+    reverb->feedback = roomSize*0.28f + 0.7f;
+    reverb->damping = damping*0.4f;
+    reverb->mix = (mix < 0.0f)? 0.0f : ((mix > 1.0f)? 1.0f : mix);
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_REVERB, .bus = bus.bus, .data = reverb });
+}
+
+// Attach audio processor to bus, processor runs once over the bus mix
+void AttachAudioBusProcessor(AudioBus bus, AudioCallback process)
+{
+    if (bus.bus == NULL) return;
+
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .bus = bus.bus, .processor = processor });
+}
+
+// Detach audio processor from bus
+void DetachAudioBusProcessor(AudioBus bus, AudioCallback process)
+{
+    if (bus.bus != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .bus = bus.bus, .process = process });
+}
+
+// Route audio stream to bus, empty bus routes it to output
+void SetAudioStreamBus(AudioStream stream, AudioBus bus)
+{
+    if (stream.buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_ROUTE, .buffer = stream.buffer, .bus = bus.bus });
+}
+
+// Route sound to bus, empty bus routes it to output
+// NOTE: Sound instances are routed to the sound bus when played
+void SetSoundBus(Sound sound, AudioBus bus)
+{
+    SetAudioStreamBus(sound.stream, bus);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AudioCaptureStream management functions
+//----------------------------------------------------------------------------------
+
+// Load audio capture stream from default capture device (32 bit float samples), capture starts right away
+// NOTE: Device uses low latency profile, captured frames are read with ReadAudioCaptureStream() without blocking
+AudioCaptureStream LoadAudioCaptureStream(unsigned int sampleRate, unsigned int channels)
+{
+    AudioCaptureStream stream = { 0 };
+
+    if (!AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device must be initialized to load capture stream");
+        return stream;
+    }
+
+    rAudioCapture *capture = (rAudioCapture *)RL_CALLOC(1, sizeof(rAudioCapture));
+
+    if (capture == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for capture stream");
+        return stream;
+    }
+
+    ma_device_config config = ma_device_config_init(ma_device_type_capture);
+    config.capture.pDeviceID = NULL;    // NULL for the default capture device
+    config.capture.format = ma_format_f32;
+    config.capture.channels = channels;
+    config.sampleRate = sampleRate;
+    config.performanceProfile = ma_performance_profile_low_latency;
+    config.dataCallback = OnReceiveAudioDataFromDevice;
+    config.pUserData = capture;
+
+    if (ma_device_init(&AUDIO.System.context, &config, &capture->device) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize capture device");
+        RL_FREE(capture);
+        return stream;
+    }
+
+    // NOTE: Device could choose its own native channels and sample rate if not defined (0)
+    ma_uint32 captureChannels = capture->device.capture.channels;
+
+    if (ma_pcm_rb_init(ma_format_f32, captureChannels, AUDIO_CAPTURE_BUFFER_SIZE, NULL, NULL, &capture->ring) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create capture stream ring buffer");
+        ma_device_uninit(&capture->device);
+        RL_FREE(capture);
+        return stream;
+    }
+
+    if (ma_device_start(&capture->device) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to start capture device");
+        ma_device_uninit(&capture->device);
+        ma_pcm_rb_uninit(&capture->ring);
+        RL_FREE(capture);
+        return stream;
+    }
+
+    stream.capture = capture;
+    stream.sampleRate = capture->device.sampleRate;
+    stream.sampleSize = 32;
+    stream.channels = captureChannels;
+
+    TRACELOG(LOG_INFO, "AUDIO: Capture stream initialized successfully (%i Hz, %i bit, %i channels)", stream.sampleRate, stream.sampleSize, stream.channels);
+
+    return stream;
+}
+
+// Checks if an audio capture stream is ready
+bool IsAudioCaptureStreamReady(AudioCaptureStream stream)
+{
+    return ((stream.capture != NULL) &&     // Validate capture data
+            (stream.sampleRate > 0) &&      // Validate sample rate is supported
+            (stream.channels > 0));         // Validate number of channels supported
+}
+
+// Unload audio capture stream, capture device is stopped
+void UnloadAudioCaptureStream(AudioCaptureStream stream)
+{
+    if (stream.capture == NULL) return;
+
+    // NOTE: Device uninit waits for capture thread, processors and ring buffer are not used anymore
+    ma_device_uninit(&stream.capture->device);
+    ma_pcm_rb_uninit(&stream.capture->ring);
+
+    rAudioProcessor *processor = stream.capture->processor;
+
+    while (processor)
+    {
+        rAudioProcessor *next = processor->next;
+        RL_FREE(processor);
+        processor = next;
+    }
+
+    if (stream.capture->droppedFrames > 0) TRACELOG(LOG_DEBUG, "AUDIO: Capture stream dropped %u frames, not read in time", stream.capture->droppedFrames);
+
+    RL_FREE(stream.capture);
+
+    TRACELOG(LOG_INFO, "AUDIO: Capture stream unloaded successfully");
+}
+
+// Get audio capture stream frames available to read
+int GetAudioCaptureStreamAvailable(AudioCaptureStream stream)
+{
+    int frames = 0;
+
+    if (stream.capture != NULL) frames = (int)ma_pcm_rb_available_read(&stream.capture->ring);
+
+    return frames;
+}
+
+// Read captured frames (interleaved float samples), returns frames read, never blocks
+int ReadAudioCaptureStream(AudioCaptureStream stream, float *frames, int frameCount)
+{
+    int framesRead = 0;
+
+    if ((stream.capture == NULL) || (frames == NULL)) return 0;
+
+    // NOTE: Ring buffer could wrap, it is read in two contiguous sections at most
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = (ma_uint32)(frameCount - framesRead);
+        void *ringFrames = NULL;
+
+        if ((ma_pcm_rb_acquire_read(&stream.capture->ring, &framesToRead, &ringFrames) != MA_SUCCESS) || (framesToRead == 0)) break;
+
+        memcpy(frames + framesRead*stream.channels, ringFrames, framesToRead*stream.channels*sizeof(float));
+        ma_pcm_rb_commit_read(&stream.capture->ring, framesToRead);
+
+        framesRead += framesToRead;
+    }
+
+    return framesRead;
+}
+
+// Attach audio processor to capture stream, processor runs on captured frames (capture thread)
+void AttachAudioCaptureProcessor(AudioCaptureStream stream, AudioCallback process)
+{
+    if (stream.capture == NULL) return;
+
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+
+    ma_spinlock_lock(&stream.capture->processorLock);
+
+    rAudioProcessor *last = stream.capture->processor;
+
+    while (last && last->next) last = last->next;
+
+    if (last != NULL)
+    {
+        processor->prev = last;
+        last->next = processor;
+    }
+    else stream.capture->processor = processor;
+
+    ma_spinlock_unlock(&stream.capture->processorLock);
+}
+
+// Detach audio processor from capture stream
+void DetachAudioCaptureProcessor(AudioCaptureStream stream, AudioCallback process)
+{
+    if (stream.capture == NULL) return;
+
+    rAudioProcessor *released = NULL;
+
+    ma_spinlock_lock(&stream.capture->processorLock);
+
+    rAudioProcessor *processor = stream.capture->processor;
+
+    while (processor)
+    {
+        rAudioProcessor *next = processor->next;
+        rAudioProcessor *prev = processor->prev;
+
+        if (processor->process == process)
+        {
+            if (stream.capture->processor == processor) stream.capture->processor = next;
+            if (prev) prev->next = next;
+            if (next) next->prev = prev;
+
+            processor->next = released;
+            released = processor;
+        }
+
+        processor = next;
+    }
+
+    ma_spinlock_unlock(&stream.capture->processorLock);
+
+    // Detached processors are freed once capture thread does not use them
+    while (released)
+    {
+        rAudioProcessor *next = released->next;
+        RL_FREE(released);
+        released = next;
+    }
+}
+
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Log callback function
+static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
+{
+    TRACELOG(LOG_WARNING, "miniaudio: %s", pMessage);   // All log messages from miniaudio are errors
+}
+
+// Reads audio data from an AudioBuffer object in internal format.
+static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    // Using audio buffer callback
+    if (audioBuffer->callback)
+    {
+        audioBuffer->callback(framesOut, frameCount);
+        audioBuffer->framesProcessed += frameCount;
+
+        return frameCount;
+    }
+
+    ma_uint32 subBufferCount = audioBuffer->subBufferCount;
+    ma_uint32 subBufferSizeInFrames = audioBuffer->subBufferSize;
+    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+
+    if (currentSubBufferIndex >= subBufferCount) return 0;
+
+    // Another thread can update the processed state of buffers, so
+    // we just take a copy here to try and avoid potential synchronization problems
+    bool isSubBufferProcessed[MAX_AUDIO_STREAM_SUB_BUFFERS] = { 0 };
+    for (ma_uint32 i = 0; i < subBufferCount; i++) isSubBufferProcessed[i] = audioBuffer->isSubBufferProcessed[i];
+
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
     ma_uint32 framesRead = 0;
     while (1)
     {
@@ -2300,250 +3471,1802 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         }
         else
         {
-            if (isSubBufferProcessed[currentSubBufferIndex]) break;
+            if (isSubBufferProcessed[currentSubBufferIndex]) break;
+        }
+
+        ma_uint32 totalFramesRemaining = (frameCount - framesRead);
+        if (totalFramesRemaining == 0) break;
+
+        ma_uint32 framesRemainingInOutputBuffer;
+        if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
+        {
+            framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+        }
+        else
+        {
+            ma_uint32 firstFrameIndexOfThisSubBuffer = subBufferSizeInFrames*currentSubBufferIndex;
+            framesRemainingInOutputBuffer = subBufferSizeInFrames - (audioBuffer->frameCursorPos - firstFrameIndexOfThisSubBuffer);
+        }
+
+        ma_uint32 framesToRead = totalFramesRemaining;
+        if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (audioBuffer->decoder != NULL) DecodeAudioBufferFrames(audioBuffer, (short *)((unsigned char *)framesOut + (framesRead*frameSizeInBytes)), audioBuffer->frameCursorPos, framesToRead);
+        else
+#endif
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
+        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        framesRead += framesToRead;
+
+        // If we've read to the end of the buffer, mark it as processed
+        if (framesToRead == framesRemainingInOutputBuffer)
+        {
+            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            isSubBufferProcessed[currentSubBufferIndex] = true;
+
+            currentSubBufferIndex = (currentSubBufferIndex + 1)%subBufferCount;
+
+            // We need to break from this loop if we're not looping
+            if (!audioBuffer->looping)
+            {
+                ResetAudioBuffer(audioBuffer);
+                break;
+            }
+        }
+    }
+
+    // Zero-fill excess
+    ma_uint32 totalFramesRemaining = (frameCount - framesRead);
+    if (totalFramesRemaining > 0)
+    {
+        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
+
+        // For static buffers we can fill the remaining frames with silence for safety, but we don't want
+        // to report those frames as "read". The reason for this is that the caller uses the return value
+        // to know whether a non-looping sound has finished playback.
+        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC)
+        {
+            // Stream ran out of data, underrun is counted once until new data is mixed
+            // NOTE: Streams never updated are not considered
+            if (framesRead > 0) audioBuffer->underrun = false;
+            if (!audioBuffer->underrun && audioBuffer->playing && (audioBuffer->framesProcessed > 0))
+            {
+                audioBuffer->underrun = true;
+                audioBuffer->underrunCount++;
+                audioBuffer->adaptiveUnderruns++;
+
+                // Adaptive streams grow sub-buffers count on repeated underruns, all sub-buffers are processed
+                // at this point, so the ring buffer can be resized and restarted from the first sub-buffer
+                if ((audioBuffer->adaptiveUnderruns >= AUDIO_STREAM_ADAPTIVE_UNDERRUNS) && (audioBuffer->subBufferCount < audioBuffer->subBufferMaxCount))
+                {
+                    audioBuffer->subBufferCount++;
+                    audioBuffer->sizeInFrames = subBufferSizeInFrames*audioBuffer->subBufferCount;
+                    audioBuffer->frameCursorPos = 0;
+                    audioBuffer->adaptiveUnderruns = 0;
+                }
+            }
+
+            framesRead += totalFramesRemaining;
+        }
+    }
+    else audioBuffer->underrun = false;
+
+    return framesRead;
+}
+
+#if defined(SUPPORT_FAST_AUDIO_RESAMPLING)
+// Reads audio data from a mono/stereo AudioBuffer object resampled to device sample rate (and pitch) with a linear resampler
+// NOTE: Input frames required for requested output frames are computed exactly (fixed point), no data is read in advance
+static ma_uint32 ReadAudioBufferFramesResampled(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    ma_uint8 inputBuffer[4096];     // NOTE: Not initialized, required input frames are always filled
+    float inputFrames[1024];        // Input frames converted to mixing format (stereo)
+    ma_uint32 inputFrameCap = sizeof(inputFrames)/sizeof(float)/2;
+    ma_uint32 inputFrameCount = 0;
+    ma_uint32 inputFrameIndex = 0;
+    bool inputEnded = false;
+
+    ma_format formatIn = audioBuffer->converter.formatIn;
+    ma_uint32 channelsIn = audioBuffer->converter.channelsIn;
+    ma_uint32 step = audioBuffer->resamplerStep;
+    float *frames = audioBuffer->resamplerFrames;
+    ma_uint32 framesProcessed = 0;
+
+    while (framesProcessed < frameCount)
+    {
+        // Move to input frames required by next output frame
+        while (audioBuffer->resamplerFrac >= 0x10000)
+        {
+            if (inputFrameIndex == inputFrameCount)
+            {
+                if (inputEnded) return framesProcessed;
+
+                ma_uint64 framesRequired = ((ma_uint64)audioBuffer->resamplerFrac + (ma_uint64)step*(frameCount - framesProcessed - 1)) >> 16;
+                ma_uint32 framesToRead = (framesRequired > inputFrameCap)? inputFrameCap : (ma_uint32)framesRequired;
+
+                inputFrameCount = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, framesToRead);
+                inputFrameIndex = 0;
+
+                if (inputFrameCount < framesToRead) inputEnded = true;
+                if (inputFrameCount == 0) return framesProcessed;
+
+                // Convert input frames to mixing format, mono frames are copied to both channels
+                ma_pcm_convert(inputFrames, ma_format_f32, inputBuffer, formatIn, inputFrameCount*channelsIn, ma_dither_mode_none);
+
+                if (channelsIn == 1)
+                {
+                    for (int i = (int)inputFrameCount - 1; i >= 0; i--)
+                    {
+                        float sample = inputFrames[i];
+                        inputFrames[i*2] = sample;
+                        inputFrames[i*2 + 1] = sample;
+                    }
+                }
+            }
+
+            frames[0] = frames[2];
+            frames[1] = frames[3];
+            frames[2] = inputFrames[inputFrameIndex*2];
+            frames[3] = inputFrames[inputFrameIndex*2 + 1];
+            inputFrameIndex++;
+
+            audioBuffer->resamplerFrac -= 0x10000;
+        }
+
+        float t = (float)audioBuffer->resamplerFrac/65536.0f;
+        framesOut[framesProcessed*2] = frames[0] + (frames[2] - frames[0])*t;
+        framesOut[framesProcessed*2 + 1] = frames[1] + (frames[3] - frames[1])*t;
+        framesProcessed++;
+
+        audioBuffer->resamplerFrac += step;
+    }
+
+    return framesProcessed;
+}
+#endif
+
+// Reads audio data from an AudioBuffer object in device format. Returned data will be in a format appropriate for mixing.
+static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    // Buffer data already in mixing format and no resampling required, data converter is not required
+    if ((audioBuffer->converter.formatIn == ma_format_f32) && (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut) &&
+        (audioBuffer->resamplerStep == 0x10000)) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
+#if defined(SUPPORT_FAST_AUDIO_RESAMPLING)
+    // Mono/stereo buffers are resampled with linear resampler, also converting sample format and channels
+    if ((audioBuffer->converter.channelsIn <= 2) && (audioBuffer->converter.channelsOut == 2)) return ReadAudioBufferFramesResampled(audioBuffer, framesOut, frameCount);
+#endif
+
+    // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
+    // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
+    // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
+    // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
+    ma_uint8 inputBuffer[4096];     // NOTE: Not initialized, required input frames are always filled
+    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    ma_uint32 totalOutputFramesProcessed = 0;
+    while (totalOutputFramesProcessed < frameCount)
+    {
+        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
+        ma_uint64 inputFramesToProcessThisIteration = 0;
+
+        (void)ma_data_converter_get_required_input_frame_count(&audioBuffer->converter, outputFramesToProcessThisIteration, &inputFramesToProcessThisIteration);
+        if (inputFramesToProcessThisIteration > inputBufferFrameCap)
+        {
+            inputFramesToProcessThisIteration = inputBufferFrameCap;
+        }
+
+        float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
+
+        /* At this point we can convert the data to our mixing format. */
+        ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);    /* Safe cast. */
+        ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
+        ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
+
+        totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; /* Safe cast. */
+
+        if (inputFramesProcessedThisIteration < inputFramesToProcessThisIteration)
+        {
+            break;  /* Ran out of input data. */
+        }
+
+        /* This should never be hit, but will add it here for safety. Ensures we get out of the loop when no input nor output frames are processed. */
+        if (inputFramesProcessedThisIteration == 0 && outputFramesProcessedThisIteration == 0)
+        {
+            break;
+        }
+    }
+
+    return totalOutputFramesProcessed;
+}
+
+// Sending audio data to device callback function
+// This function will be called when miniaudio needs more data
+// NOTE: All the mixing takes place here
+static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
+{
+    (void)pDevice;
+
+    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
+    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+
+    // Apply commands sent by main thread, no lock is required because
+    // buffers list and processors lists are only modified on this thread
+    ProcessAudioCommands();
+
+    // Buffers are mixed by blocks when buses are used, buses mix their buffers and are processed once per block
+    const ma_uint32 channels = pDevice->playback.channels;
+    const ma_uint32 blockSize = ((AUDIO.Bus.first != NULL) && (channels <= AUDIO_DEVICE_CHANNELS))? AUDIO_BUS_BLOCK_SIZE : frameCount;
+
+    for (ma_uint32 blockStart = 0; blockStart < frameCount; blockStart += blockSize)
+    {
+        ma_uint32 blockFrames = ((frameCount - blockStart) < blockSize)? (frameCount - blockStart) : blockSize;
+        float *blockOut = (float *)pFramesOut + blockStart*channels;
+        const ma_uint64 blockClock = AUDIO.System.frameClock + blockStart;
+
+        if (blockSize != frameCount)
+        {
+            for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next) memset(bus->frames, 0, blockFrames*channels*sizeof(float));
+        }
+
+        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        {
+            // Ignore stopped or paused sounds
+            if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+            // Scheduled buffers start at their exact frame offset inside the block
+            ma_uint32 startOffset = 0;
+
+            if (audioBuffer->startFrame > blockClock)
+            {
+                if (audioBuffer->startFrame >= (blockClock + blockFrames)) continue;
+
+                startOffset = (ma_uint32)(audioBuffer->startFrame - blockClock);
+            }
+
+            audioBuffer->startFrame = 0;
+
+            float *mixOut = ((audioBuffer->bus != NULL) && (blockSize != frameCount))? audioBuffer->bus->frames : blockOut;
+            MixAudioBuffer(audioBuffer, mixOut + startOffset*channels, blockFrames - startOffset);
+        }
+
+        if (blockSize != frameCount)
+        {
+            for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next) MixAudioBus(bus, blockOut, blockFrames);
+        }
+    }
+
+    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    while (processor)
+    {
+        processor->process(pFramesOut, frameCount);
+        processor = processor->next;
+    }
+
+    // NOTE: Only audio thread writes the clock, it is read atomically by GetAudioTime()
+    c89atomic_store_64(&AUDIO.System.frameClock, AUDIO.System.frameClock + frameCount);
+}
+
+// Receiving audio data from capture device callback function
+// NOTE: Captured frames are written to ring buffer and processed in place, frames are dropped if ring buffer is full
+static void OnReceiveAudioDataFromDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
+{
+    (void)pFramesOut;
+
+    rAudioCapture *capture = (rAudioCapture *)pDevice->pUserData;
+    const ma_uint32 channels = pDevice->capture.channels;
+    ma_uint32 framesWritten = 0;
+
+    if ((capture == NULL) || (pFramesInput == NULL)) return;
+
+    // NOTE: Ring buffer could wrap, it is written in two contiguous sections at most
+    while (framesWritten < frameCount)
+    {
+        ma_uint32 framesToWrite = frameCount - framesWritten;
+        void *ringFrames = NULL;
+
+        if ((ma_pcm_rb_acquire_write(&capture->ring, &framesToWrite, &ringFrames) != MA_SUCCESS) || (framesToWrite == 0)) break;
+
+        memcpy(ringFrames, (const float *)pFramesInput + framesWritten*channels, framesToWrite*channels*sizeof(float));
+
+        ma_spinlock_lock(&capture->processorLock);
+        for (rAudioProcessor *processor = capture->processor; processor != NULL; processor = processor->next) processor->process(ringFrames, framesToWrite);
+        ma_spinlock_unlock(&capture->processorLock);
+
+        ma_pcm_rb_commit_write(&capture->ring, framesToWrite);
+
+        framesWritten += framesToWrite;
+    }
+
+    if (framesWritten < frameCount) capture->droppedFrames += (frameCount - framesWritten);
+}
+
+// Main mixing function, pretty simple in this project, just an accumulation
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    if (frameCount == 0) return;
+
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    // Levels are linearly ramped from the levels applied on last mix to the current ones,
+    // it avoids zipper noise when volume or pan are changed while playing
+    float levels[2] = { 0 };
+    GetAudioBufferLevels(buffer, levels);
+
+    const float left = buffer->levels[0];
+    const float right = buffer->levels[1];
+    const float leftStep = (levels[0] - left)/frameCount;
+    const float rightStep = (levels[1] - right)/frameCount;
+
+    buffer->levels[0] = levels[0];
+    buffer->levels[1] = levels[1];
+
+    ma_uint32 frame = 0;
+
+    if (channels == 2)  // We consider panning
+    {
+#if defined(RAUDIO_SIMD)
+        // Two stereo frames mixed per iteration
+        simd4f level = SIMD4_SETR(left, right, left + leftStep, right + rightStep);
+        const simd4f step = SIMD4_SETR(2.0f*leftStep, 2.0f*rightStep, 2.0f*leftStep, 2.0f*rightStep);
+
+        for (; (frame + 2) <= frameCount; frame += 2)
+        {
+            simd4f out = SIMD4_LOAD(framesOut + frame*2);
+            out = SIMD4_ADD(out, SIMD4_MUL(SIMD4_LOAD(framesIn + frame*2), level));
+            SIMD4_STORE(framesOut + frame*2, out);
+
+            level = SIMD4_ADD(level, step);
+        }
+#endif
+        for (; frame < frameCount; frame++)
+        {
+            framesOut[frame*2] += (framesIn[frame*2]*(left + leftStep*frame));
+            framesOut[frame*2 + 1] += (framesIn[frame*2 + 1]*(right + rightStep*frame));
+        }
+    }
+    else if ((channels == 1) || (leftStep == 0.0f))  // Same level for every sample of a frame, samples can be mixed linearly
+    {
+        const ma_uint32 sampleCount = frameCount*channels;
+        const float sampleStep = (channels == 1)? leftStep : 0.0f;
+        ma_uint32 sample = 0;
+
+#if defined(RAUDIO_SIMD)
+        simd4f level = SIMD4_SETR(left, left + sampleStep, left + 2.0f*sampleStep, left + 3.0f*sampleStep);
+        const simd4f step = SIMD4_SET1(4.0f*sampleStep);
+
+        for (; (sample + 4) <= sampleCount; sample += 4)
+        {
+            simd4f out = SIMD4_LOAD(framesOut + sample);
+            out = SIMD4_ADD(out, SIMD4_MUL(SIMD4_LOAD(framesIn + sample), level));
+            SIMD4_STORE(framesOut + sample, out);
+
+            level = SIMD4_ADD(level, step);
+        }
+#endif
+        for (; sample < sampleCount; sample++) framesOut[sample] += (framesIn[sample]*(left + sampleStep*sample));
+    }
+    else  // Multiple channels with level ramp, level changes per frame
+    {
+        float *frameOut = framesOut;
+        const float *frameIn = framesIn;
+
+        for (; frame < frameCount; frame++)
+        {
+            const float level = left + leftStep*frame;
+
+            // Output accumulates input multiplied by volume to provided output (usually 0)
+            for (ma_uint32 c = 0; c < channels; c++) frameOut[c] += (frameIn[c]*level);
+
+            frameOut += channels;
+            frameIn += channels;
+        }
+    }
+}
+
+// Mix audio buffer frames into output (device format)
+// NOTE: Output could be the device output or a bus mixing block
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    // Static buffers already in mixing format (sounds) are mixed directly from buffer data,
+    // no conversion is required as long as pitch is not changed and no processor is attached
+    if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (audioBuffer->callback == NULL) && (audioBuffer->processor == NULL) &&
+        (audioBuffer->converter.formatIn == ma_format_f32) && (audioBuffer->converter.channelsIn == AUDIO.System.device.playback.channels) &&
+        (audioBuffer->converter.sampleRateIn == AUDIO.System.device.sampleRate) && (audioBuffer->pitch == 1.0f) && (audioBuffer->spatialPitch == 1.0f))
+    {
+        ma_uint32 framesMixed = 0;
+
+        while ((framesMixed < frameCount) && audioBuffer->playing && (audioBuffer->sizeInFrames > 0))
+        {
+            ma_uint32 framesAvailable = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+            ma_uint32 framesToMix = frameCount - framesMixed;
+            if (framesToMix > framesAvailable) framesToMix = framesAvailable;
+
+            MixAudioFrames(framesOut + framesMixed*AUDIO.System.device.playback.channels,
+                (const float *)audioBuffer->data + audioBuffer->frameCursorPos*AUDIO.System.device.playback.channels, framesToMix, audioBuffer);
+
+            audioBuffer->frameCursorPos += framesToMix;
+            framesMixed += framesToMix;
+
+            if (audioBuffer->frameCursorPos >= audioBuffer->sizeInFrames)
+            {
+                audioBuffer->frameCursorPos = 0;
+                if (!audioBuffer->looping) ResetAudioBuffer(audioBuffer);
+            }
+        }
+
+        return;
+    }
+
+    ma_uint32 framesRead = 0;
+
+    while (1)
+    {
+        if (framesRead >= frameCount) break;
+
+        // Just read as much data as we can from the stream
+        ma_uint32 framesToRead = (frameCount - framesRead);
+
+        while (framesToRead > 0)
+        {
+            float tempBuffer[1024];     // Frames for stereo, NOTE: Not initialized, frames read are always filled
+
+            ma_uint32 framesToReadRightNow = framesToRead;
+            if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+            {
+                framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+            }
+
+            ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+            if (framesJustRead > 0)
+            {
+                float *framesMixedOut = framesOut + (framesRead*AUDIO.System.device.playback.channels);
+                float *framesIn = tempBuffer;
+
+                // Apply processors chain if defined
+                rAudioProcessor *processor = audioBuffer->processor;
+                while (processor)
+                {
+                    processor->process(framesIn, framesJustRead);
+                    processor = processor->next;
+                }
+
+                MixAudioFrames(framesMixedOut, framesIn, framesJustRead, audioBuffer);
+
+                framesToRead -= framesJustRead;
+                framesRead += framesJustRead;
+            }
+
+            if (!audioBuffer->playing)
+            {
+                framesRead = frameCount;
+                break;
+            }
+
+            // If we weren't able to read all the frames we requested, break
+            if (framesJustRead < framesToReadRightNow)
+            {
+                if (!audioBuffer->looping)
+                {
+                    ResetAudioBuffer(audioBuffer);
+                    break;
+                }
+                else
+                {
+                    // Should never get here, but just for safety,
+                    // move the cursor position back to the start and continue the loop
+                    audioBuffer->frameCursorPos = 0;
+                    continue;
+                }
+            }
+        }
+
+        // If for some reason we weren't able to read every frame we'll need to break from the loop
+        // Not doing this could theoretically put us into an infinite loop
+        if (framesToRead > 0) break;
+    }
+}
+
+// Process bus mixing block and mix it into output
+// NOTE: Bus effects and processors are run once over the sum of the bus buffers
+static void MixAudioBus(rAudioBus *bus, float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if (channels == 2)
+    {
+        if (bus->filter.type != AUDIO_FILTER_NONE) ProcessAudioBusFilter(&bus->filter, bus->frames, frameCount);
+        if (bus->reverb.mix > 0.0f) ProcessAudioBusReverb(&bus->reverb, bus->frames, frameCount);
+    }
+
+    rAudioProcessor *processor = bus->processor;
+    while (processor)
+    {
+        processor->process(bus->frames, frameCount);
+        processor = processor->next;
+    }
+
+    const ma_uint32 sampleCount = frameCount*channels;
+    const float volume = bus->volume;
+    ma_uint32 sample = 0;
+
+#if defined(RAUDIO_SIMD)
+    const simd4f level = SIMD4_SET1(volume);
+
+    for (; (sample + 4) <= sampleCount; sample += 4)
+    {
+        SIMD4_STORE(framesOut + sample, SIMD4_ADD(SIMD4_LOAD(framesOut + sample), SIMD4_MUL(SIMD4_LOAD(bus->frames + sample), level)));
+    }
+#endif
+    for (; sample < sampleCount; sample++) framesOut[sample] += bus->frames[sample]*volume;
+}
+
+// Process bus biquad filter (stereo)
+// NOTE: Biquad recursion is serial per channel, both channels are processed on the same pass
+static void ProcessAudioBusFilter(AudioBusFilter *filter, float *frames, ma_uint32 frameCount)
+{
+    const float b0 = filter->b0, b1 = filter->b1, b2 = filter->b2, a1 = filter->a1, a2 = filter->a2;
+    float z1l = filter->z1[0], z2l = filter->z2[0];
+    float z1r = filter->z1[1], z2r = filter->z2[1];
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    {
+        float left = frames[frame*2];
+        float right = frames[frame*2 + 1];
+
+        float outLeft = b0*left + z1l;
+        float outRight = b0*right + z1r;
+
+        z1l = b1*left - a1*outLeft + z2l;
+        z1r = b1*right - a1*outRight + z2r;
+        z2l = b2*left - a2*outLeft;
+        z2r = b2*right - a2*outRight;
+
+        frames[frame*2] = outLeft;
+        frames[frame*2 + 1] = outRight;
+    }
+
+    filter->z1[0] = z1l;
+    filter->z2[0] = z2l;
+    filter->z1[1] = z1r;
+    filter->z2[1] = z2r;
+}
+
+// Process bus reverb (stereo)
+// NOTE: Comb filters of every channel are processed together as a SIMD vector (AUDIO_REVERB_COMBS = 4)
+static void ProcessAudioBusReverb(AudioBusReverb *reverb, float *frames, ma_uint32 frameCount)
+{
+    const float feedback = reverb->feedback;
+    const float damp1 = reverb->damping;
+    const float damp2 = 1.0f - reverb->damping;
+    const float wet = reverb->mix*3.0f;
+    const float dry = 1.0f - reverb->mix;
+
+#if defined(RAUDIO_SIMD)
+    const simd4f feedback4 = SIMD4_SET1(feedback);
+    const simd4f damp14 = SIMD4_SET1(damp1);
+    const simd4f damp24 = SIMD4_SET1(damp2);
+#endif
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    {
+        const float input = (frames[frame*2] + frames[frame*2 + 1])*0.015f;
+
+        for (int c = 0; c < 2; c++)
+        {
+            float delayed[AUDIO_REVERB_COMBS] = { 0 };
+            float written[AUDIO_REVERB_COMBS] = { 0 };
+            float out = 0.0f;
+
+            for (int k = 0; k < AUDIO_REVERB_COMBS; k++) delayed[k] = reverb->combs[c][k][reverb->combIndex[c][k]];
+
+#if defined(RAUDIO_SIMD)
+            simd4f store = SIMD4_ADD(SIMD4_MUL(SIMD4_LOAD(delayed), damp24), SIMD4_MUL(SIMD4_LOAD(reverb->combStore[c]), damp14));
+            SIMD4_STORE(reverb->combStore[c], store);
+            SIMD4_STORE(written, SIMD4_ADD(SIMD4_SET1(input), SIMD4_MUL(store, feedback4)));
+#else
+            for (int k = 0; k < AUDIO_REVERB_COMBS; k++)
+            {
+                reverb->combStore[c][k] = delayed[k]*damp2 + reverb->combStore[c][k]*damp1;
+                written[k] = input + reverb->combStore[c][k]*feedback;
+            }
+#endif
+            for (int k = 0; k < AUDIO_REVERB_COMBS; k++)
+            {
+                reverb->combs[c][k][reverb->combIndex[c][k]] = written[k];
+                if (++reverb->combIndex[c][k] >= reverb->combLength[c][k]) reverb->combIndex[c][k] = 0;
+                out += delayed[k];
+            }
+
+            for (int k = 0; k < AUDIO_REVERB_ALLPASSES; k++)
+            {
+                float *allpass = reverb->allpasses[c][k];
+                float buffered = allpass[reverb->allpassIndex[c][k]];
+
+                allpass[reverb->allpassIndex[c][k]] = out + buffered*0.5f;
+                if (++reverb->allpassIndex[c][k] >= reverb->allpassLength[c][k]) reverb->allpassIndex[c][k] = 0;
+                out = buffered - out;
+            }
+
+            frames[frame*2 + c] = frames[frame*2 + c]*dry + out*wet;
+        }
+    }
+}
+
+// Get audio buffer mixing levels for current volume and pan
+// NOTE: Pan is only considered for stereo output, both levels are the same otherwise
+static void GetAudioBufferLevels(AudioBuffer *buffer, float *levels)
+{
+    // Spatial buffers are attenuated and panned from listener point of view
+    const float volume = buffer->spatial? buffer->volume*buffer->spatialGain : buffer->volume;
+
+    if (AUDIO.System.device.playback.channels == 2)
+    {
+        const float left = buffer->spatial? buffer->spatialPan : buffer->pan;
+        const float right = 1.0f - left;
+
+        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
+        levels[0] = volume*0.5f*left*(3.0f - left*left);
+        levels[1] = volume*0.5f*right*(3.0f - right*right);
+    }
+    else
+    {
+        levels[0] = volume;
+        levels[1] = volume;
+    }
+}
+
+// Reset audio buffer resampler state and step for pitch
+// NOTE: Resampler starts two input frames ahead, first output frame is first input frame (no interpolation from silence)
+static void ResetAudioBufferResampler(AudioBuffer *buffer, float pitch)
+{
+    if (buffer->converter.sampleRateOut > 0) buffer->resamplerStep = (ma_uint32)((float)buffer->converter.sampleRateIn*pitch/buffer->converter.sampleRateOut*65536.0f + 0.5f);
+    buffer->resamplerFrac = 0x20000;
+    memset(buffer->resamplerFrames, 0, sizeof(buffer->resamplerFrames));
+}
+
+// Update audio buffer resampling for pitch and spatial pitch
+// NOTE: Pitching is just an adjustment of the sample rate, it changes the duration of the sound:
+//  - higher pitches will make the sound faster
+//  - lower pitches make it slower
+static void UpdateAudioBufferPitch(AudioBuffer *buffer)
+{
+    float pitch = buffer->pitch*buffer->spatialPitch;
+
+    ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
+    ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+    // NOTE: Resampler step is updated for next mixed block, resampler position is kept
+    buffer->resamplerStep = (ma_uint32)((float)buffer->converter.sampleRateIn*pitch/buffer->converter.sampleRateOut*65536.0f + 0.5f);
+}
+
+// Update audio buffer spatial gain, pan and pitch from listener
+// NOTE: Distance models and doppler shift follow OpenAL definitions (clamped distance models),
+// panning uses interaural level difference with rear attenuation (HRTF-lite, no interaural delay)
+static void UpdateAudioBufferSpatial(AudioBuffer *buffer)
+{
+    const AudioListener *listener = &AUDIO.Spatial.listener;
+
+    Vector3 toSource = { buffer->position.x - listener->position.x, buffer->position.y - listener->position.y, buffer->position.z - listener->position.z };
+    float distance = sqrtf(toSource.x*toSource.x + toSource.y*toSource.y + toSource.z*toSource.z);
+
+    // Distance attenuation
+    float gain = 1.0f;
+    float refDistance = (listener->refDistance > 0.0f)? listener->refDistance : 1.0f;
+    float maxDistance = (listener->maxDistance > refDistance)? listener->maxDistance : refDistance;
+    float clampedDistance = (distance < refDistance)? refDistance : ((distance > maxDistance)? maxDistance : distance);
+
+    switch (listener->distanceModel)
+    {
+        case AUDIO_DISTANCE_INVERSE: gain = refDistance/(refDistance + listener->rolloff*(clampedDistance - refDistance)); break;
+        case AUDIO_DISTANCE_LINEAR: gain = (maxDistance > refDistance)? 1.0f - listener->rolloff*(clampedDistance - refDistance)/(maxDistance - refDistance) : 1.0f; break;
+        case AUDIO_DISTANCE_EXPONENTIAL: gain = powf(clampedDistance/refDistance, -listener->rolloff); break;
+        default: break;
+    }
+
+    if (gain < 0.0f) gain = 0.0f;
+    else if (gain > 1.0f) gain = 1.0f;
+
+    float pan = 0.5f;
+    float pitch = 1.0f;
+
+    if (distance > 0.0001f)
+    {
+        // Listener right direction: forward x up
+        Vector3 forward = listener->forward;
+        Vector3 up = listener->up;
+        Vector3 right = { forward.y*up.z - forward.z*up.y, forward.z*up.x - forward.x*up.z, forward.x*up.y - forward.y*up.x };
+        float rightLength = sqrtf(right.x*right.x + right.y*right.y + right.z*right.z);
+        float forwardLength = sqrtf(forward.x*forward.x + forward.y*forward.y + forward.z*forward.z);
+
+        if ((rightLength > 0.0f) && (forwardLength > 0.0f))
+        {
+            float side = (toSource.x*right.x + toSource.y*right.y + toSource.z*right.z)/(rightLength*distance);
+            float front = (toSource.x*forward.x + toSource.y*forward.y + toSource.z*forward.z)/(forwardLength*distance);
+
+            // NOTE: Pan 1.0f is left channel only
+            pan = 0.5f - 0.5f*side;
+            if (front < 0.0f) gain *= 1.0f + AUDIO_SPATIAL_REAR_ATTENUATION*front;
+        }
+
+        // Doppler shift, velocities projected on source to listener direction
+        if ((listener->dopplerFactor > 0.0f) && (listener->speedOfSound > 0.0f))
+        {
+            float speedOfSound = listener->speedOfSound;
+            float maxSpeed = speedOfSound/listener->dopplerFactor;
+            float listenerSpeed = -(toSource.x*listener->velocity.x + toSource.y*listener->velocity.y + toSource.z*listener->velocity.z)/distance;
+            float sourceSpeed = -(toSource.x*buffer->velocity.x + toSource.y*buffer->velocity.y + toSource.z*buffer->velocity.z)/distance;
+
+            if (listenerSpeed > maxSpeed) listenerSpeed = maxSpeed;
+            if (sourceSpeed > maxSpeed*0.99f) sourceSpeed = maxSpeed*0.99f;
+
+            pitch = (speedOfSound - listener->dopplerFactor*listenerSpeed)/(speedOfSound - listener->dopplerFactor*sourceSpeed);
+        }
+    }
+
+    buffer->spatialGain = gain;
+    buffer->spatialPan = pan;
+
+    if (pitch != buffer->spatialPitch)
+    {
+        buffer->spatialPitch = pitch;
+        UpdateAudioBufferPitch(buffer);
+    }
+}
+
+// Push command to queue, returns false if queue is full
+// NOTE: Only one thread can push commands to a given queue
+static bool PushAudioCommand(AudioCommandQueue *queue, AudioCommand command)
+{
+    ma_uint32 head = c89atomic_load_explicit_32(&queue->head, c89atomic_memory_order_relaxed);
+    ma_uint32 tail = c89atomic_load_explicit_32(&queue->tail, c89atomic_memory_order_acquire);
+
+    if ((head - tail) >= MAX_AUDIO_COMMANDS) return false;
+
+    queue->commands[head & (MAX_AUDIO_COMMANDS - 1)] = command;
+    c89atomic_store_explicit_32(&queue->head, head + 1, c89atomic_memory_order_release);
+
+    return true;
+}
+
+// Pop command from queue, returns false if queue is empty
+// NOTE: Only one thread can pop commands from a given queue
+static bool PopAudioCommand(AudioCommandQueue *queue, AudioCommand *command)
+{
+    ma_uint32 tail = c89atomic_load_explicit_32(&queue->tail, c89atomic_memory_order_relaxed);
+    ma_uint32 head = c89atomic_load_explicit_32(&queue->head, c89atomic_memory_order_acquire);
+
+    if (head == tail) return false;
+
+    *command = queue->commands[tail & (MAX_AUDIO_COMMANDS - 1)];
+    c89atomic_store_explicit_32(&queue->tail, tail + 1, c89atomic_memory_order_release);
+
+    return true;
+}
+
+// Send command to audio thread
+// NOTE: If audio thread is not running, command is processed right away
+static void SendAudioCommand(AudioCommand command)
+{
+    // NOTE: Commands could be sent by main thread and music streaming thread, queues
+    // only support one producer, senders are serialized (audio thread is never locked)
+    ma_spinlock_lock(&AUDIO.Command.sendLock);
+
+    // Released data must be freed before sending a new command, every command releases
+    // one element at most, so released queue can never get full
+    FreeReleasedAudioData();
+
+#if !defined(MA_EMSCRIPTEN)
+    if (AUDIO.System.isReady && !AUDIO.System.offline)
+    {
+        // Queue is only full when lots of commands are sent in a short time, wait for audio thread to process them
+        while (!PushAudioCommand(&AUDIO.Command.pending, command)) ma_sleep(1);
+    }
+    else
+#endif
+    {
+        // NOTE: On web and offline device, audio is mixed on main thread
+        ProcessAudioCommand(command);
+        FreeReleasedAudioData();
+    }
+
+    ma_spinlock_unlock(&AUDIO.Command.sendLock);
+}
+
+// Process all commands sent by main thread
+static void ProcessAudioCommands(void)
+{
+    AudioCommand command = { 0 };
+
+    while (PopAudioCommand(&AUDIO.Command.pending, &command)) ProcessAudioCommand(command);
+}
+
+// Process one command sent by main thread
+static void ProcessAudioCommand(AudioCommand command)
+{
+    AudioBuffer *buffer = command.buffer;
+
+    switch (command.type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            buffer->playing = true;
+            buffer->frameCursorPos = 0;
+            buffer->startFrame = command.frame;
+            ResetAudioBufferResampler(buffer, buffer->pitch*buffer->spatialPitch);
+            GetAudioBufferLevels(buffer, buffer->levels);   // No levels ramp when playback starts
+        } break;
+        case AUDIO_COMMAND_PLAY_CONTINUE:
+        {
+            buffer->playing = true;
+            GetAudioBufferLevels(buffer, buffer->levels);
+        } break;
+        case AUDIO_COMMAND_PLAY_INSTANCE:
+        {
+            AudioBuffer *source = command.source;
+
+            buffer->data = source->data;
+            buffer->sizeInFrames = source->sizeInFrames;
+            buffer->subBufferSize = source->subBufferSize;
+            buffer->looping = false;
+            buffer->volume = source->volume;
+            buffer->pan = source->pan;
+            buffer->pitch = source->pitch;
+            buffer->bus = source->bus;
+
+            // Sound instances start at sound position (if spatial)
+            buffer->spatial = source->spatial;
+            buffer->position = source->position;
+            buffer->velocity = source->velocity;
+            buffer->spatialGain = source->spatialGain;
+            buffer->spatialPan = source->spatialPan;
+            buffer->spatialPitch = source->spatialPitch;
+            UpdateAudioBufferPitch(buffer);
+
+            buffer->playing = true;
+            buffer->frameCursorPos = 0;
+            buffer->framesProcessed = 0;
+            if (buffer->decoder != NULL) buffer->decoder->sliceFrames = 0;
+            ResetAudioBufferResampler(buffer, buffer->pitch*buffer->spatialPitch);
+            GetAudioBufferLevels(buffer, buffer->levels);
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            buffer->playing = false;
+            buffer->paused = false;
+            buffer->frameCursorPos = 0;
+        } break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command.value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            buffer->pitch = command.value;
+            UpdateAudioBufferPitch(buffer);
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command.value; break;
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
+
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        case AUDIO_COMMAND_UNLOAD:
+        {
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
+
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
+
+            buffer->prev = NULL;
+            buffer->next = NULL;
+
+            // Voice buffer data is owned by the sound played, it must not be released
+            if (command.source == buffer) buffer->data = NULL;
+
+            // Unloaded buffer is not used anymore by audio thread, main thread can free it
+            if (command.type == AUDIO_COMMAND_UNLOAD) PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : ((command.bus != NULL)? &command.bus->processor : &AUDIO.mixedProcessor);
+            rAudioProcessor *last = *first;
+
+            while (last && last->next)
+            {
+                last = last->next;
+            }
+            if (last)
+            {
+                command.processor->prev = last;
+                last->next = command.processor;
+            }
+            else *first = command.processor;
+        } break;
+        case AUDIO_COMMAND_BUS_TRACK:
+        {
+            rAudioBus *bus = command.bus;
+
+            if (AUDIO.Bus.first == NULL) AUDIO.Bus.first = bus;
+            else
+            {
+                AUDIO.Bus.last->next = bus;
+                bus->prev = AUDIO.Bus.last;
+            }
+
+            AUDIO.Bus.last = bus;
+        } break;
+        case AUDIO_COMMAND_BUS_UNLOAD:
+        {
+            rAudioBus *bus = command.bus;
+
+            if (bus->prev == NULL) AUDIO.Bus.first = bus->next;
+            else bus->prev->next = bus->next;
+
+            if (bus->next == NULL) AUDIO.Bus.last = bus->prev;
+            else bus->next->prev = bus->prev;
+
+            // Buffers routed to the bus are mixed into output
+            for (AudioBuffer *routed = AUDIO.Buffer.first; routed != NULL; routed = routed->next)
+            {
+                if (routed->bus == bus) routed->bus = NULL;
+            }
+
+            PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_BUS_ROUTE: buffer->bus = command.bus; break;
+        case AUDIO_COMMAND_BUS_VOLUME: command.bus->volume = command.value; break;
+        case AUDIO_COMMAND_BUS_FILTER:
+        {
+            AudioBusFilter *filter = (AudioBusFilter *)command.data;
+            rAudioBus *bus = command.bus;
+
+            // Filter state is kept, only coefficients are updated
+            if (bus->filter.type == AUDIO_FILTER_NONE) memset(&bus->filter, 0, sizeof(AudioBusFilter));
+            bus->filter.type = filter->type;
+            bus->filter.b0 = filter->b0;
+            bus->filter.b1 = filter->b1;
+            bus->filter.b2 = filter->b2;
+            bus->filter.a1 = filter->a1;
+            bus->filter.a2 = filter->a2;
+
+            PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_BUS_REVERB:
+        {
+            AudioBusReverb *reverb = (AudioBusReverb *)command.data;
+            rAudioBus *bus = command.bus;
+
+            bus->reverb.feedback = reverb->feedback;
+            bus->reverb.damping = reverb->damping;
+            bus->reverb.mix = (bus->reverb.delays != NULL)? reverb->mix : 0.0f;
+
+            PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_LISTENER:
+        {
+            AUDIO.Spatial.listener = *(AudioListener *)command.data;
+
+            for (AudioBuffer *spatialBuffer = AUDIO.Buffer.first; spatialBuffer != NULL; spatialBuffer = spatialBuffer->next)
+            {
+                if (spatialBuffer->spatial) UpdateAudioBufferSpatial(spatialBuffer);
+            }
+
+            PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_SPATIAL:
+        {
+            AudioSpatialBatch *batch = (AudioSpatialBatch *)command.data;
+
+            for (int i = 0; i < batch->count; i++)
+            {
+                AudioBuffer *spatialBuffer = batch->sources[i].buffer;
+
+                spatialBuffer->spatial = true;
+                spatialBuffer->position = batch->sources[i].position;
+                spatialBuffer->velocity = batch->sources[i].velocity;
+                UpdateAudioBufferSpatial(spatialBuffer);
+            }
+
+            PushAudioCommand(&AUDIO.Command.released, command);
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : ((command.bus != NULL)? &command.bus->processor : &AUDIO.mixedProcessor);
+            rAudioProcessor *processor = *first;
+            rAudioProcessor *detached = NULL;   // Detached processors are chained to be released together
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command.process)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
+
+                    processor->prev = NULL;
+                    processor->next = detached;
+                    detached = processor;
+                }
+
+                processor = next;
+            }
+
+            if (detached != NULL)
+            {
+                command.processor = detached;
+                PushAudioCommand(&AUDIO.Command.released, command);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Free buffers and processors released by audio thread
+static void FreeReleasedAudioData(void)
+{
+    AudioCommand command = { 0 };
+
+    while (PopAudioCommand(&AUDIO.Command.released, &command))
+    {
+        if (command.type == AUDIO_COMMAND_UNLOAD)
+        {
+            ma_data_converter_uninit(&command.buffer->converter, NULL);
+            RL_FREE(command.buffer->decoder);
+            RL_FREE(command.buffer->data);
+            RL_FREE(command.buffer);
+        }
+        else if ((command.type == AUDIO_COMMAND_LISTENER) || (command.type == AUDIO_COMMAND_SPATIAL) ||
+                 (command.type == AUDIO_COMMAND_BUS_FILTER) || (command.type == AUDIO_COMMAND_BUS_REVERB)) RL_FREE(command.data);
+        else if (command.type == AUDIO_COMMAND_BUS_UNLOAD)
+        {
+            rAudioProcessor *processor = command.bus->processor;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                RL_FREE(processor);
+                processor = next;
+            }
+
+            RL_FREE(command.bus->reverb.delays);
+            RL_FREE(command.bus);
+        }
+        else if (command.type == AUDIO_COMMAND_DETACH_PROCESSOR)
+        {
+            rAudioProcessor *processor = command.processor;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                RL_FREE(processor);
+                processor = next;
+            }
+        }
+    }
+}
+
+// Stop music stream and rewind its decoder
+// NOTE: Music decoders lock must be taken by caller
+static void ResetMusicStream(Music music)
+{
+    StopAudioStream(music.stream);
+
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Refill processed music stream buffers with decoded data
+// NOTE: Music decoders lock must be taken by caller
+static void UpdateMusicStreamBuffers(Music music)
+{
+    unsigned int subBufferSizeInFrames = music.stream.buffer->subBufferSize;
+
+    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
+
+    if (AUDIO.System.pcmBufferSize < pcmSize)
+    {
+        RL_FREE(AUDIO.System.pcmBuffer);
+        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
+        AUDIO.System.pcmBufferSize = pcmSize;
+    }
+
+    // Check all sub-buffers to check if they require refilling
+    for (int i = 0; i < (int)music.stream.buffer->subBufferCount; i++)
+    {
+        if ((music.stream.buffer != NULL) && !music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+
+        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesToStream = 0;                 // Total frames to be streamed
+
+        if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
+        else framesToStream = framesLeft;
+
+        int frameCountStillNeeded = framesToStream;
+        int frameCountReadTotal = 0;
+
+        switch (music.ctxType)
+        {
+        #if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV:
+            {
+                if (music.stream.sampleSize == 16)
+                {
+                    while (true)
+                    {
+                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                        frameCountReadTotal += frameCountRead;
+                        frameCountStillNeeded -= frameCountRead;
+                        if (frameCountStillNeeded == 0) break;
+                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                    }
+                }
+                else if (music.stream.sampleSize == 32)
+                {
+                    while (true)
+                    {
+                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                        frameCountReadTotal += frameCountRead;
+                        frameCountStillNeeded -= frameCountRead;
+                        if (frameCountStillNeeded == 0) break;
+                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                    }
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG:
+            {
+                while (true)
+                {
+                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3:
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA:
+            {
+                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
+                frameCountReadTotal += frameCountRead;
+                /*
+                while (true)
+                {
+                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+                }
+                */
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC:
+            {
+                while (true)
+                {
+                    int frameCountRead = drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_XM)
+            case MUSIC_MODULE_XM:
+            {
+                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
+                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MOD)
+            case MUSIC_MODULE_MOD:
+            {
+                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
+                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+            } break;
+        #endif
+            default: break;
+        }
+
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+
+        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+
+        if (framesLeft <= subBufferSizeInFrames)
+        {
+            if (!music.looping)
+            {
+                // Streaming is ending, we filled latest frames from input
+                ResetMusicStream(music);
+                return;
+            }
+        }
+    }
+}
+
+// Lock music decoders (if music streaming thread is running)
+static void LockMusicStreams(void)
+{
+#if defined(RAUDIO_MUSIC_THREAD)
+    if (AUDIO.MusicStream.threadActive) ma_mutex_lock(&AUDIO.MusicStream.lock);
+#endif
+}
+
+// Unlock music decoders (if music streaming thread is running)
+static void UnlockMusicStreams(void)
+{
+#if defined(RAUDIO_MUSIC_THREAD)
+    if (AUDIO.MusicStream.threadActive) ma_mutex_unlock(&AUDIO.MusicStream.lock);
+#endif
+}
+
+#if defined(RAUDIO_MUSIC_THREAD)
+// Music streaming thread, refills playing music streams buffers
+// NOTE: Buffers are refilled as soon as they are processed by the audio thread
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data)
+{
+    (void)data;
+
+    while (c89atomic_load_32(&AUDIO.MusicStream.quit) == 0)
+    {
+        ma_mutex_lock(&AUDIO.MusicStream.lock);
+        for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+        {
+            if (AUDIO.MusicStream.streams[i].stream.buffer != NULL) UpdateMusicStreamBuffers(AUDIO.MusicStream.streams[i]);
+        }
+        ma_mutex_unlock(&AUDIO.MusicStream.lock);
+
+        ma_sleep(MUSIC_STREAM_THREAD_INTERVAL);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Get voice playing a sound instance, NULL if instance is not valid anymore
+// NOTE: Voice could be stolen by a newer instance
+static AudioVoice *GetSoundInstanceVoice(int instance)
+{
+    AudioVoice *voice = NULL;
+
+    if (instance >= 0)
+    {
+        voice = &AUDIO.Voice.voices[instance%MAX_AUDIO_BUFFER_POOL_CHANNELS];
+
+        if ((voice->buffer == NULL) || (voice->source == NULL) || (voice->id != instance)) voice = NULL;
+    }
+
+    return voice;
+}
+
+// Decode file data directly to device format (thread-safe)
+// NOTE: Data is decoded by chunks as float and converted on the fly, avoiding an intermediate wave copy
+static float *DecodeSoundData(const char *fileType, const unsigned char *fileData, int dataSize, ma_uint32 sampleRate, unsigned int *frameCount)
+{
+    #define SOUND_DECODE_CHUNK_FRAMES   4096
+
+    float *data = NULL;
+    int ctxType = MUSIC_AUDIO_NONE;
+    void *ctxData = NULL;
+    unsigned int channels = 0;
+    unsigned int sampleRateIn = 0;
+    ma_uint64 frameCountIn = 0;
+
+    *frameCount = 0;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (strcmp(fileType, ".wav") == 0)
+    {
+        drwav *wav = (drwav *)RL_CALLOC(1, sizeof(drwav));
+
+        if (drwav_init_memory(wav, fileData, dataSize, NULL))
+        {
+            ctxType = MUSIC_AUDIO_WAV;
+            ctxData = wav;
+            channels = wav->channels;
+            sampleRateIn = wav->sampleRate;
+            frameCountIn = wav->totalPCMFrameCount;
+        }
+        else RL_FREE(wav);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (strcmp(fileType, ".ogg") == 0)
+    {
+        stb_vorbis *ogg = stb_vorbis_open_memory(fileData, dataSize, NULL, NULL);
+
+        if (ogg != NULL)
+        {
+            stb_vorbis_info info = stb_vorbis_get_info(ogg);
+
+            ctxType = MUSIC_AUDIO_OGG;
+            ctxData = ogg;
+            channels = info.channels;
+            sampleRateIn = info.sample_rate;
+            frameCountIn = stb_vorbis_stream_length_in_samples(ogg);    // NOTE: It returns frames!
         }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (strcmp(fileType, ".mp3") == 0)
+    {
+        drmp3 *mp3 = (drmp3 *)RL_CALLOC(1, sizeof(drmp3));
 
-        ma_uint32 totalFramesRemaining = (frameCount - framesRead);
-        if (totalFramesRemaining == 0) break;
+        if (drmp3_init_memory(mp3, fileData, dataSize, NULL))
+        {
+            ctxType = MUSIC_AUDIO_MP3;
+            ctxData = mp3;
+            channels = mp3->channels;
+            sampleRateIn = mp3->sampleRate;
+            frameCountIn = drmp3_get_pcm_frame_count(mp3);      // NOTE: Scans the frames and rewinds
+        }
+        else RL_FREE(mp3);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (strcmp(fileType, ".flac") == 0)
+    {
+        drflac *flac = drflac_open_memory(fileData, dataSize, NULL);
 
-        ma_uint32 framesRemainingInOutputBuffer;
-        if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
+        if (flac != NULL)
         {
-            framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+            ctxType = MUSIC_AUDIO_FLAC;
+            ctxData = flac;
+            channels = flac->channels;
+            sampleRateIn = flac->sampleRate;
+            frameCountIn = flac->totalPCMFrameCount;
         }
-        else
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    else if (strcmp(fileType, ".qoa") == 0)
+    {
+        // NOTE: QOA is decoded in one go (decoder works on whole data), only conversion is done in one pass
+        qoa_desc qoa = { 0 };
+        short *samples = qoa_decode(fileData, dataSize, &qoa);
+
+        if (samples != NULL)
         {
-            ma_uint32 firstFrameIndexOfThisSubBuffer = subBufferSizeInFrames*currentSubBufferIndex;
-            framesRemainingInOutputBuffer = subBufferSizeInFrames - (audioBuffer->frameCursorPos - firstFrameIndexOfThisSubBuffer);
+            ma_uint64 frameCountOut = ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, sampleRate, NULL, qoa.samples, ma_format_s16, qoa.channels, qoa.samplerate);
+            data = (float *)RL_MALLOC((size_t)frameCountOut*AUDIO_DEVICE_CHANNELS*sizeof(float));
+
+            if (data != NULL) *frameCount = (unsigned int)ma_convert_frames(data, frameCountOut, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, sampleRate, samples, qoa.samples, ma_format_s16, qoa.channels, qoa.samplerate);
+
+            QOA_FREE(samples);
         }
+        else TRACELOG(LOG_WARNING, "SOUND: Failed to decode QOA data");
 
-        ma_uint32 framesToRead = totalFramesRemaining;
-        if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
+        return data;
+    }
+#endif
+    else
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Data format not supported");
+        return NULL;
+    }
 
-        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
-        framesRead += framesToRead;
+    if (ctxData == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to decode [%s] data", fileType);
+        return NULL;
+    }
 
-        // If we've read to the end of the buffer, mark it as processed
-        if (framesToRead == framesRemainingInOutputBuffer)
+    ma_data_converter converter = { 0 };
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(ma_format_f32, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRateIn, sampleRate);
+    converterConfig.resampling.linear.lpfOrder = ma_min(MA_DEFAULT_RESAMPLER_LPF_ORDER, MA_MAX_FILTER_ORDER);   // Same filtering as ma_convert_frames()
+    ma_uint64 frameCountOut = 0;
+    float *chunk = (float *)RL_MALLOC(SOUND_DECODE_CHUNK_FRAMES*channels*sizeof(float));
+
+    if ((chunk != NULL) && (frameCountIn > 0) && (ma_data_converter_init(&converterConfig, NULL, &converter) == MA_SUCCESS))
+    {
+        ma_data_converter_get_expected_output_frame_count(&converter, frameCountIn, &frameCountOut);
+        data = (float *)RL_MALLOC((size_t)frameCountOut*AUDIO_DEVICE_CHANNELS*sizeof(float));
+
+        ma_uint64 framesDecoded = 0;
+        ma_uint64 framesConverted = 0;
+
+        while ((data != NULL) && (framesDecoded < frameCountIn) && (framesConverted < frameCountOut))
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
-            isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_uint64 framesToDecode = frameCountIn - framesDecoded;
+            if (framesToDecode > SOUND_DECODE_CHUNK_FRAMES) framesToDecode = SOUND_DECODE_CHUNK_FRAMES;
 
-            currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
+            ma_uint64 framesRead = 0;
 
-            // We need to break from this loop if we're not looping
-            if (!audioBuffer->looping)
+            switch (ctxType)
             {
-                StopAudioBuffer(audioBuffer);
-                break;
+#if defined(SUPPORT_FILEFORMAT_WAV)
+                case MUSIC_AUDIO_WAV: framesRead = drwav_read_pcm_frames_f32((drwav *)ctxData, framesToDecode, chunk); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+                case MUSIC_AUDIO_OGG: framesRead = stb_vorbis_get_samples_float_interleaved((stb_vorbis *)ctxData, channels, chunk, (int)framesToDecode*channels); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+                case MUSIC_AUDIO_MP3: framesRead = drmp3_read_pcm_frames_f32((drmp3 *)ctxData, framesToDecode, chunk); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+                case MUSIC_AUDIO_FLAC: framesRead = drflac_read_pcm_frames_f32((drflac *)ctxData, framesToDecode, chunk); break;
+#endif
+                default: break;
             }
+
+            if (framesRead == 0) break;
+
+            ma_uint64 framesIn = framesRead;
+            ma_uint64 framesOut = frameCountOut - framesConverted;
+            ma_data_converter_process_pcm_frames(&converter, chunk, &framesIn, data + framesConverted*AUDIO_DEVICE_CHANNELS, &framesOut);
+
+            framesDecoded += framesRead;
+            framesConverted += framesOut;
         }
+
+        *frameCount = (unsigned int)framesConverted;
+
+        ma_data_converter_uninit(&converter, NULL);
     }
 
-    // Zero-fill excess
-    ma_uint32 totalFramesRemaining = (frameCount - framesRead);
-    if (totalFramesRemaining > 0)
-    {
-        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
+    if (*frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
-        // For static buffers we can fill the remaining frames with silence for safety, but we don't want
-        // to report those frames as "read". The reason for this is that the caller uses the return value
-        // to know whether a non-looping sound has finished playback.
-        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) framesRead += totalFramesRemaining;
+    RL_FREE(chunk);
+
+    switch (ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_uninit((drwav *)ctxData); RL_FREE(ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_close((stb_vorbis *)ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_uninit((drmp3 *)ctxData); RL_FREE(ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_close((drflac *)ctxData); break;
+#endif
+        default: break;
     }
 
-    return framesRead;
+    return data;
 }
 
-// Reads audio data from an AudioBuffer object in device format. Returned data will be in a format appropriate for mixing.
-static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+// Load sound from device format data, data ownership is moved to sound
+static Sound LoadSoundFromDeviceData(float *data, unsigned int frameCount)
 {
-    // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
-    // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
-    // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
-    // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
-    ma_uint8 inputBuffer[4096] = { 0 };
-    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    Sound sound = { 0 };
 
-    ma_uint32 totalOutputFramesProcessed = 0;
-    while (totalOutputFramesProcessed < frameCount)
+    if ((data == NULL) || (frameCount == 0))
     {
-        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
-        ma_uint64 inputFramesToProcessThisIteration = 0;
+        RL_FREE(data);
+        return sound;
+    }
 
-        (void)ma_data_converter_get_required_input_frame_count(&audioBuffer->converter, outputFramesToProcessThisIteration, &inputFramesToProcessThisIteration);
-        if (inputFramesToProcessThisIteration > inputBufferFrameCap)
+    AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+    if (audioBuffer == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+        RL_FREE(data);
+        return sound;
+    }
+
+    // NOTE: Buffer is not playing yet, data can be set after buffer is tracked by audio thread
+    audioBuffer->data = (unsigned char *)data;
+    audioBuffer->sizeInFrames = frameCount;
+    audioBuffer->subBufferSize = (frameCount > 1)? frameCount/2 : frameCount;
+
+    sound.frameCount = frameCount;
+    sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+    sound.stream.sampleSize = 32;
+    sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+    sound.stream.buffer = audioBuffer;
+
+    return sound;
+}
+
+// Load sound keeping wave data compact (original PCM or QOA), data is converted to device format on mixing
+static Sound LoadSoundFromWaveCompact(Wave wave, int storage)
+{
+    Sound sound = { 0 };
+
+    ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    AudioBuffer *audioBuffer = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if ((storage == SOUND_STORAGE_QOA) && (wave.channels <= QOA_MAX_CHANNELS))
+    {
+        // QOA encodes 16 bit samples, other sample sizes are converted
+        Wave waveIn = wave;
+        if (wave.sampleSize != 16)
         {
-            inputFramesToProcessThisIteration = inputBufferFrameCap;
+            waveIn = WaveCopy(wave);
+            WaveFormat(&waveIn, wave.sampleRate, 16, wave.channels);
         }
 
-        float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
+        qoa_desc qoa = { 0 };
+        qoa.channels = waveIn.channels;
+        qoa.samplerate = waveIn.sampleRate;
+        qoa.samples = waveIn.frameCount;
 
-        /* At this point we can convert the data to our mixing format. */
-        ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);    /* Safe cast. */
-        ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
-        ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
+        unsigned int dataSize = 0;
+        unsigned char *data = (unsigned char *)qoa_encode((const short *)waveIn.data, &qoa, &dataSize);
 
-        totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; /* Safe cast. */
+        if (waveIn.data != wave.data) UnloadWave(waveIn);
 
-        if (inputFramesProcessedThisIteration < inputFramesToProcessThisIteration)
+        if (data != NULL)
         {
-            break;  /* Ran out of input data. */
+            // NOTE: Buffer data is QOA encoded data (header included), sizeInFrames refers to decoded frames
+            audioBuffer = LoadAudioBuffer(ma_format_s16, wave.channels, wave.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+            if (audioBuffer != NULL)
+            {
+                audioBuffer->data = data;
+                audioBuffer->decoder = (rAudioDecoder *)RL_CALLOC(1, sizeof(rAudioDecoder));
+                audioBuffer->sizeInFrames = wave.frameCount;
+                audioBuffer->subBufferSize = (wave.frameCount > 1)? wave.frameCount/2 : wave.frameCount;
+
+                sound.stream.sampleSize = 16;
+                TRACELOG(LOG_INFO, "SOUND: Sound data compressed as QOA (%i bytes, %.1f%%)", dataSize, 100.0f*dataSize/(wave.frameCount*wave.channels*wave.sampleSize/8));
+            }
+            else RL_FREE(data);
         }
+        else TRACELOG(LOG_WARNING, "SOUND: Failed to compress sound data, using PCM storage");
+    }
+#endif
 
-        /* This should never be hit, but will add it here for safety. Ensures we get out of the loop when no input nor output frames are processed. */
-        if (inputFramesProcessedThisIteration == 0 && outputFramesProcessedThisIteration == 0)
+    // Original PCM data is kept as is, converter takes care of sample size, channels and sample rate
+    if (audioBuffer == NULL)
+    {
+        audioBuffer = LoadAudioBuffer(formatIn, wave.channels, wave.sampleRate, wave.frameCount, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
         {
-            break;
+            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+            return sound;
         }
+
+        memcpy(audioBuffer->data, wave.data, wave.frameCount*wave.channels*wave.sampleSize/8);
+        sound.stream.sampleSize = wave.sampleSize;
     }
 
-    return totalOutputFramesProcessed;
+    sound.frameCount = wave.frameCount;
+    sound.stream.sampleRate = wave.sampleRate;
+    sound.stream.channels = wave.channels;
+    sound.stream.buffer = audioBuffer;
+
+    return sound;
 }
 
-// Sending audio data to device callback function
-// This function will be called when miniaudio needs more data
-// NOTE: All the mixing takes place here
-static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Decode compressed buffer frames (QOA) into 16 bit interleaved frames
+// NOTE: QOA frames have the same size (except last one) and LMS state is stored on every frame header,
+// so decoding can be started on any frame, slices are decoded sequentially from there
+static void DecodeAudioBufferFrames(AudioBuffer *buffer, short *framesOut, ma_uint32 position, ma_uint32 frameCount)
 {
-    (void)pDevice;
+    rAudioDecoder *decoder = buffer->decoder;
+    unsigned int channels = buffer->converter.channelsIn;
+    unsigned int frameSize = QOA_FRAME_SIZE(channels, QOA_SLICES_PER_FRAME);
 
-    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
-    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
-
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    for (ma_uint32 i = 0; i < frameCount;)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
-
-            ma_uint32 framesRead = 0;
+        ma_uint32 framePos = position + i;
 
-            while (1)
+        // Decode the slice containing required frame position, if not already decoded
+        if ((decoder->sliceFrames == 0) || (framePos < decoder->slicePos) || (framePos >= (decoder->slicePos + decoder->sliceFrames)))
+        {
+            unsigned int slicePos = framePos - framePos%QOA_SLICE_LEN;
+            unsigned int frameIndex = slicePos/QOA_FRAME_LEN;
+            unsigned int sliceIndex = (slicePos%QOA_FRAME_LEN)/QOA_SLICE_LEN;
+            const unsigned char *bytes = buffer->data + 8 + frameIndex*frameSize;     // Skip file header
+            unsigned int firstSlice = sliceIndex;
+
+            // LMS state is loaded from frame header if required slice is not next one,
+            // previous slices in that frame are decoded to update LMS state
+            if ((sliceIndex == 0) || (decoder->sliceFrames != QOA_SLICE_LEN) || (slicePos != (decoder->slicePos + QOA_SLICE_LEN)))
             {
-                if (framesRead >= frameCount) break;
-
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                unsigned int p = 8;     // Skip frame header
 
-                while (framesToRead > 0)
+                for (unsigned int c = 0; c < channels; c++)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    qoa_uint64_t history = qoa_read_u64(bytes, &p);
+                    qoa_uint64_t weights = qoa_read_u64(bytes, &p);
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    for (int k = 0; k < QOA_LMS_LEN; k++)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        decoder->lms[c].history[k] = ((signed short)(history >> 48));
+                        history <<= 16;
+                        decoder->lms[c].weights[k] = ((signed short)(weights >> 48));
+                        weights <<= 16;
                     }
+                }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
+                firstSlice = 0;
+            }
 
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+            unsigned int sliceFrames = 0;
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+            for (unsigned int s = firstSlice; s <= sliceIndex; s++)
+            {
+                unsigned int p = 8 + QOA_LMS_LEN*4*channels + s*channels*8;
+                unsigned int sliceStart = frameIndex*QOA_FRAME_LEN + s*QOA_SLICE_LEN;
+                sliceFrames = buffer->sizeInFrames - sliceStart;
+                if (sliceFrames > QOA_SLICE_LEN) sliceFrames = QOA_SLICE_LEN;
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                for (unsigned int c = 0; c < channels; c++)
+                {
+                    qoa_uint64_t slice = qoa_read_u64(bytes, &p);
+                    int scalefactor = (slice >> 60) & 0xf;
 
-                    if (!audioBuffer->playing)
+                    for (unsigned int k = 0; k < sliceFrames; k++)
                     {
-                        framesRead = frameCount;
-                        break;
-                    }
+                        int predicted = qoa_lms_predict(&decoder->lms[c]);
+                        int quantized = (slice >> 57) & 0x7;
+                        int dequantized = qoa_dequant_tab[scalefactor][quantized];
+                        int reconstructed = qoa_clamp(predicted + dequantized, -32768, 32767);
 
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBuffer(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        decoder->frames[k*channels + c] = (short)reconstructed;
+                        slice <<= 3;
+
+                        qoa_lms_update(&decoder->lms[c], reconstructed, dequantized);
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            decoder->slicePos = slicePos;
+            decoder->sliceFrames = sliceFrames;
         }
-    }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
-    {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+        ma_uint32 framesToCopy = decoder->slicePos + decoder->sliceFrames - framePos;
+        if (framesToCopy > (frameCount - i)) framesToCopy = frameCount - i;
+
+        memcpy(framesOut + i*channels, decoder->frames + (framePos - decoder->slicePos)*channels, framesToCopy*channels*sizeof(short));
+        i += framesToCopy;
     }
+}
+#endif
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+// Stop audio buffer and reset its playback state
+// NOTE: Called by audio thread when a non-looping buffer reaches its end
+static void ResetAudioBuffer(AudioBuffer *buffer)
+{
+    buffer->playing = false;
+    buffer->paused = false;
+    buffer->frameCursorPos = 0;
+    buffer->framesProcessed = 0;
+    buffer->underrun = false;
+    buffer->startFrame = 0;
+    for (int i = 0; i < MAX_AUDIO_STREAM_SUB_BUFFERS; i++) buffer->isSubBufferProcessed[i] = true;
 }
 
-// Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+// Convert wave samples size (8: u8, 16: s16, 32: float), in place if samples are not bigger
+// NOTE: Samples are converted forward, output never overtakes input for smaller samples, conversions match miniaudio ones
+static void ConvertWaveSamples(const void *samplesIn, int sampleSizeIn, void *samplesOut, int sampleSizeOut, unsigned int sampleCount)
 {
-    const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const unsigned char *u8In = (const unsigned char *)samplesIn;
+    const short *s16In = (const short *)samplesIn;
+    const float *f32In = (const float *)samplesIn;
 
-    if (channels == 2)  // We consider panning
+    if (sampleSizeIn == sampleSizeOut)
     {
-        const float left = buffer->pan;
-        const float right = 1.0f - left;
-
-        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
-
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
-
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
-
-            frameOut += 2;
-            frameIn += 2;
-        }
+        if (samplesIn != samplesOut) memmove(samplesOut, samplesIn, sampleCount*(sampleSizeIn/8));
+    }
+    else if ((sampleSizeIn == 16) && (sampleSizeOut == 32)) ConvertSamplesS16ToF32(s16In, (float *)samplesOut, sampleCount, 1.0f/32768.0f);
+    else if ((sampleSizeIn == 32) && (sampleSizeOut == 16)) ConvertSamplesF32ToS16(f32In, (short *)samplesOut, sampleCount);
+    else if (sampleSizeIn == 8)
+    {
+        if (sampleSizeOut == 16) for (unsigned int i = 0; i < sampleCount; i++) ((short *)samplesOut)[i] = (short)((u8In[i] - 128) << 8);
+        else for (unsigned int i = 0; i < sampleCount; i++) ((float *)samplesOut)[i] = (float)u8In[i]/127.5f - 1.0f;
     }
-    else  // We do not consider panning
+    else if (sampleSizeOut == 8)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        if (sampleSizeIn == 16) for (unsigned int i = 0; i < sampleCount; i++) ((unsigned char *)samplesOut)[i] = (unsigned char)((s16In[i] >> 8) + 128);
+        else
         {
-            for (ma_uint32 c = 0; c < channels; c++)
+            for (unsigned int i = 0; i < sampleCount; i++)
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
-
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                float sample = (f32In[i] < -1.0f)? -1.0f : ((f32In[i] > 1.0f)? 1.0f : f32In[i]);
+                ((unsigned char *)samplesOut)[i] = (unsigned char)((sample + 1.0f)*127.5f);
             }
         }
     }
 }
 
+// Convert s16 samples to float, samples are scaled by scale factor
+static void ConvertSamplesS16ToF32(const short *samplesIn, float *samplesOut, unsigned int sampleCount, float scale)
+{
+    unsigned int i = 0;
+
+#if defined(RAUDIO_SIMD)
+    const simd4f scale4 = SIMD4_SET1(scale);
+
+    for (; (i + 4) <= sampleCount; i += 4) SIMD4_STORE(samplesOut + i, SIMD4_MUL(SIMD4_LOAD_S16(samplesIn + i), scale4));
+#endif
+    for (; i < sampleCount; i++) samplesOut[i] = (float)samplesIn[i]*scale;
+}
+
+// Convert float samples to s16, samples are clipped to [-1..1] range
+// NOTE: In place conversion supported, every 4 samples are loaded before being stored
+static void ConvertSamplesF32ToS16(const float *samplesIn, short *samplesOut, unsigned int sampleCount)
+{
+    unsigned int i = 0;
+
+#if defined(RAUDIO_SIMD)
+    const simd4f minSample = SIMD4_SET1(-1.0f);
+    const simd4f maxSample = SIMD4_SET1(1.0f);
+    const simd4f scale = SIMD4_SET1(32767.0f);
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        simd4f samples = SIMD4_MUL(SIMD4_MIN(SIMD4_MAX(SIMD4_LOAD(samplesIn + i), minSample), maxSample), scale);
+        SIMD4_STORE_S16(samplesOut + i, samples);
+    }
+#endif
+    for (; i < sampleCount; i++)
+    {
+        float sample = (samplesIn[i] < -1.0f)? -1.0f : ((samplesIn[i] > 1.0f)? 1.0f : samplesIn[i]);
+        samplesOut[i] = (short)(sample*32767.0f);
+    }
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -2654,6 +5377,73 @@ static bool SaveFileText(const char *fileName, char *text)
 }
 #endif
 
+#if !defined(RAUDIO_STANDALONE)
+// Decode sound async load wave (loader thread)
+static void DecodeSoundAsync(void *data)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)data;
+
+    load->wave = LoadWave(load->fileName);
+}
+
+// Finalize sound async load, wave converted to sound (main thread)
+static void FinalizeSoundAsync(void *data)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)data;
+
+    load->sound = LoadSoundFromWave(load->wave);
+    UnloadWave(load->wave);
+}
+
+// Decode sounds batch async load, files decoded in parallel (loader thread)
+static void DecodeSoundBatchAsync(void *data)
+{
+    SoundBatchAsyncLoad *load = (SoundBatchAsyncLoad *)data;
+
+    JobParallelFor(load->count, DecodeSoundBatchRange, load);
+}
+
+// Decode sounds batch range of files (jobs system threads)
+static void DecodeSoundBatchRange(int start, int end, void *userData)
+{
+    SoundBatchAsyncLoad *load = (SoundBatchAsyncLoad *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        SoundBatchItem *item = &load->items[i];
+
+        if (load->storage == SOUND_STORAGE_DEVICE)
+        {
+            unsigned int fileSize = 0;
+            unsigned char *fileData = LoadFileData(item->fileName, &fileSize);
+
+            if (fileData != NULL) item->data = DecodeSoundData(GetFileExtension(item->fileName), fileData, fileSize, load->sampleRate, &item->frameCount);
+
+            RL_FREE(fileData);
+        }
+        else item->wave = LoadWave(item->fileName);
+    }
+}
+
+// Finalize sounds batch async load, decoded data moved to sounds (main thread)
+static void FinalizeSoundBatchAsync(void *data)
+{
+    SoundBatchAsyncLoad *load = (SoundBatchAsyncLoad *)data;
+
+    for (int i = 0; i < load->count; i++)
+    {
+        SoundBatchItem *item = &load->items[i];
+
+        if (load->storage == SOUND_STORAGE_DEVICE) item->sound = LoadSoundFromDeviceData(item->data, item->frameCount);
+        else
+        {
+            item->sound = LoadSoundFromWaveCompact(item->wave, load->storage);
+            UnloadWave(item->wave);
+        }
+    }
+}
+#endif
+
 #undef AudioBuffer
 
 #endif      // SUPPORT_MODULE_RAUDIO
@@ -35,6 +35,7 @@
 *       [rcore] msf_gif (Miles Fogle) for GIF recording
 *       [rcore] sinfl (Micha Mettke) for DEFLATE decompression algorithm
 *       [rcore] sdefl (Micha Mettke) for DEFLATE compression algorithm
+*       [rcore] rlz4 for LZ4 block format compression/decompression (fast codec)
 *       [rtextures] stb_image (Sean Barret) for images loading (BMP, TGA, PNG, JPEG, HDR...)
 *       [rtextures] stb_image_write (Sean Barret) for image writing (BMP, TGA, PNG, JPG)
 *       [rtextures] stb_image_resize (Sean Barret) for image resizing algorithms
@@ -80,6 +81,7 @@
 #define RAYLIB_H
 
 #include <stdarg.h>     // Required for: va_list - Only used by TraceLogCallback
+#include <stddef.h>     // Required for: size_t - Only used by RL_MALLOC/RL_CALLOC/RL_REALLOC allocators
 
 #define RAYLIB_VERSION_MAJOR 4
 #define RAYLIB_VERSION_MINOR 6
@@ -117,18 +119,22 @@
 #endif
 
 // Allow custom memory allocators
-// NOTE: Require recompiling raylib sources
+// NOTE: By default memory is managed by MemAlloc()/MemRealloc()/MemFree(), redirected at runtime with
+// SetMemoryAllocator(), custom allocators defined here require recompiling raylib sources
+#if !defined(RL_MALLOC) && !defined(RL_CALLOC) && !defined(RL_REALLOC) && !defined(RL_FREE)
+    #define RL_MEMORY_DEFAULT           // Default memory allocators in use, required for memory tracking
+#endif
 #ifndef RL_MALLOC
-    #define RL_MALLOC(sz)       malloc(sz)
+    #define RL_MALLOC(sz)       MemAllocUninit(sz)
 #endif
 #ifndef RL_CALLOC
-    #define RL_CALLOC(n,sz)     calloc(n,sz)
+    #define RL_CALLOC(n,sz)     MemAllocArray(n,sz)
 #endif
 #ifndef RL_REALLOC
-    #define RL_REALLOC(ptr,sz)  realloc(ptr,sz)
+    #define RL_REALLOC(ptr,sz)  MemReallocArray(ptr,1,sz)
 #endif
 #ifndef RL_FREE
-    #define RL_FREE(ptr)        free(ptr)
+    #define RL_FREE(ptr)        MemFree(ptr)
 #endif
 
 // NOTE: MSVC C++ compiler does not support compound literals (C99 feature)
@@ -240,6 +246,29 @@ typedef struct Rectangle {
     float height;           // Rectangle height
 } Rectangle;
 
+// PolygonIndex, polygon edges sorted in horizontal rows (fast point in polygon checks)
+typedef struct PolygonIndex {
+    Rectangle bounds;       // Polygon bounding rectangle
+    int rowCount;           // Number of rows (bounds split vertically)
+    int pointCount;         // Number of polygon points
+    Vector2 *points;        // Polygon points (copied)
+    int *rowOffsets;        // Rows first edge in rowEdges (rowCount + 1)
+    int *rowSpanCounts;     // Rows edges spanning the full row height, first in row edges, sorted left to right
+    int *rowEdges;          // Rows edges (edge i goes from point i to next point)
+} PolygonIndex;
+
+// Spline, control points with cached tessellation (DrawSpline())
+typedef struct Spline {
+    int type;               // Spline type (SplineType)
+    int pointCount;         // Number of control points
+    Vector2 *points;        // Control points
+    int vertexCount;        // Number of tessellated points
+    Vector2 *vertices;      // Tessellated points
+    Vector2 *normals;       // Tessellated points normals (miter scaled)
+    float *lengths;         // Tessellated points distance from spline start (arc length)
+    float tolerance;        // Tessellation tolerance in spline units (0: tessellation required)
+} Spline;
+
 // Image, pixel data stored in CPU memory (RAM)
 typedef struct Image {
     void *data;             // Image raw data
@@ -249,6 +278,30 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageResizeContext, scratch buffers reused by repeated image resizes (ImageResizeEx())
+typedef struct ImageResizeContext {
+    bool srgb;              // Color channels filtered in linear space, alpha weighted (8 bit formats)
+    int bufferCount;        // Scratch buffers count (one per resized rows slice)
+    void **buffers;         // Scratch buffers
+} ImageResizeContext;
+
+// AnimImage, animated image (GIF, APNG) decoded frame by frame into image
+typedef struct AnimImage {
+    Image image;            // Current frame image (RGBA)
+    int frameCount;         // Total number of frames
+    int currentFrame;       // Current frame index
+    void *ctxData;          // Animated image decoder context data
+} AnimImage;
+
+// TiledImage, big image split in fixed size tiles, tiles loaded on demand (file or callback) and cached
+typedef struct TiledImage {
+    int width;              // Image width
+    int height;             // Image height
+    int format;             // Data format (PixelFormat type), uncompressed formats only
+    int tileSize;           // Tiles size (square)
+    void *ctxData;          // Tiled image context data (tiles cache), shared by region views
+} TiledImage;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -264,6 +317,12 @@ typedef Texture Texture2D;
 // TextureCubemap, same as Texture
 typedef Texture TextureCubemap;
 
+// Texture2DArray, same as Texture (layers of same size, sampled with sampler2DArray)
+typedef Texture Texture2DArray;
+
+// Texture3D, same as Texture (volume slices, sampled with sampler3D)
+typedef Texture Texture3D;
+
 // RenderTexture, fbo for texture rendering
 typedef struct RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -274,6 +333,15 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// VideoTexture, video frames streamed into texture (YUV planes converted on GPU)
+typedef struct VideoTexture {
+    Texture2D texture;      // Current frame texture (RGBA)
+    int frameCount;         // Total number of frames (0: unknown)
+    float frameRate;        // Frames per second
+    bool looping;           // Video looping enable
+    void *ctxData;          // Video decoder context data
+} VideoTexture;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -284,6 +352,34 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteInstance, texture piece drawing parameters (DrawTexturePro() parameters)
+typedef struct SpriteInstance {
+    Rectangle source;       // Texture source rectangle (negative width/height to flip)
+    Rectangle dest;         // Destination rectangle
+    Vector2 origin;         // Rotation origin, relative to destination rectangle
+    float rotation;         // Rotation in degrees
+    Color tint;             // Tint color
+} SpriteInstance;
+
+// AtlasRegion, image packed into texture atlas page
+typedef struct AtlasRegion {
+    Texture2D texture;      // Atlas page texture
+    Rectangle source;       // Image source rectangle in page texture
+    int id;                 // Region id (-1: not packed)
+} AtlasRegion;
+
+// ImageProcessOp, image color operation for ImageProcess()
+typedef struct ImageProcessOp {
+    int type;               // Operation type (ImageProcessType)
+    float value;            // Operation value: contrast [-100..100], brightness [-255..255]
+    Color color;            // Operation color: tint color, replaced color
+    Color replace;          // Replacement color
+} ImageProcessOp;
+
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct AtlasBuilder AtlasBuilder;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -293,6 +389,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rGlyphLookup rGlyphLookup;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -301,8 +401,20 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *glyphLookup; // Glyphs index lookup by codepoint (built on font loading, NULL: linear search)
 } Font;
 
+// TextLayout, text glyphs quads positioned once to be drawn multiple times
+typedef struct TextLayout {
+    Texture2D texture;      // Font texture atlas (not owned, font must be kept loaded)
+    int glyphCount;         // Number of glyphs quads
+    float *vertices;        // Glyphs quads positions (XY, 4 vertex by quad), relative to layout position
+    float *texcoords;       // Glyphs quads texture coordinates (UV, 4 vertex by quad)
+    Rectangle bounds;       // Text bounds, relative to layout position
+    float pixelRange;       // Distance field screen pixels range (MSDF fonts, 0 for other fonts)
+    unsigned int instancesId;   // Glyphs instances GPU buffer id (large layouts drawn instanced, 0: render batch drawing)
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -322,6 +434,17 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// CameraViewProj, camera matrices for a viewport size, computed once for many world/screen projections
+typedef struct CameraViewProj {
+    Matrix view;            // Camera view matrix
+    Matrix projection;      // Camera projection matrix
+    Matrix viewProj;        // View-projection matrix (world to clip space)
+    Matrix invViewProj;     // Inverse view-projection matrix (clip to world space)
+    Camera3D camera;        // Camera used to compute matrices
+    int width;              // Viewport width
+    int height;             // Viewport height
+} CameraViewProj;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -341,12 +464,94 @@ typedef struct Mesh {
     float *animNormals;     // Animated normals (after bones transformations)
     unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    Matrix *boneMatrices;   // Bones animated transformation matrices (GPU skinning, UpdateModelAnimationBones())
+    int boneCount;          // Number of bones matrices
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
+
+    // Vertex data packing (UploadMeshPacked())
+    unsigned int packFlags; // Vertex attributes packed in GPU buffers (MeshPackFlags)
+    Vector4 packOffset;     // Packed positions dequantization: offset (XYZ) and scale (W)
+
+    // Level of detail data (GenMeshLODs())
+    int lodCount;           // Number of LOD levels (including level 0: mesh indices)
+    int *lodTriangles;      // LOD levels triangles count
+    float *lodErrors;       // LOD levels simplification error (relative to mesh bounds size)
+    unsigned short *lodIndices; // LOD levels indices (levels 1..lodCount-1 stored consecutively, sharing mesh vertices)
+    int lodLevel;           // LOD level drawn by DrawMesh()
+
+    // Morph targets data (blend shapes)
+    int morphCount;         // Number of morph targets
+    float *morphVertices;   // Morph targets position deltas (XYZ - 3 components per target, morphCount deltas per vertex)
+    float *morphNormals;    // Morph targets normal deltas (XYZ - 3 components per target, morphCount deltas per vertex)
+    float *morphWeights;    // Morph targets weights, SetMeshMorphWeights()
+    unsigned int morphTextureId; // OpenGL morph targets deltas texture id (GPU morphing)
+
+    // Dynamic mesh data (UploadMesh() dynamic, UpdateMeshVertices()...)
+    int vertexCapacity;     // Vertex buffers capacity in GPU (vertices), ResizeMesh() grows buffers as required
+    int indexCapacity;      // Index buffer capacity in GPU (indices, including LOD levels indices)
+    int *dirtyRanges;       // Dynamic mesh buffers ranges pending upload (first, last by buffer), uploaded on draw
 } Mesh;
 
+// BillboardInstance, billboard drawn by DrawBillboardsBatch()
+typedef struct BillboardInstance {
+    Vector3 position;       // Billboard center position
+    Vector2 size;           // Billboard size (width and height, world units)
+    float rotation;         // Billboard rotation around its center (degrees)
+    Rectangle source;       // Texture source rectangle (zero width: full texture)
+    Color tint;             // Billboard tint color
+} BillboardInstance;
+
+// ParticleEmitter, particles spawn and simulation parameters (UpdateParticleSystem())
+typedef struct ParticleEmitter {
+    Vector3 position;       // Emitter position
+    Vector3 spread;         // Spawn position random offset (box half extents)
+    Vector3 velocity;       // Particles initial velocity
+    Vector3 velocityRandom; // Particles initial velocity random offset (box half extents)
+    Vector3 gravity;        // Particles acceleration
+    float rate;             // Particles spawned per second
+    float lifetimeMin;      // Particles minimum lifetime (seconds)
+    float lifetimeMax;      // Particles maximum lifetime (seconds)
+    float sizeStart;        // Particles size at spawn (world units)
+    float sizeEnd;          // Particles size at end of lifetime
+    Color colorStart;       // Particles color at spawn
+    Color colorEnd;         // Particles color at end of lifetime
+} ParticleEmitter;
+
+// ParticleSystem, particles simulated and drawn on GPU (compute shaders, OpenGL 4.3) or on CPU (fallback)
+typedef struct ParticleSystem {
+    int maxParticles;       // Maximum particles alive
+    bool gpu;               // Particles simulated on GPU (particles data not available on CPU)
+    void *ctxData;          // Particles system internal data (buffers and shaders or CPU particles)
+} ParticleSystem;
+
+// MeshInstanceBuffer, instances transforms stored in GPU memory, reused between draws
+// NOTE: Instances colors and custom attributes are optional, one buffer per attribute (loaded on first update)
+typedef struct MeshInstanceBuffer {
+    unsigned int id;            // OpenGL Vertex Buffer Object id (transforms)
+    int instanceCount;          // Number of instances transforms stored
+    unsigned int colorsId;      // Instances colors buffer id (shader-location: SHADER_LOC_INSTANCE_COLOR)
+    unsigned int attribIds[4];  // Instances custom attributes buffers ids
+    int attribLocs[4];          // Instances custom attributes shader locations
+    int attribSizes[4];         // Instances custom attributes components (float, 1..4)
+} MeshInstanceBuffer;
+
+// MeshGenParams, procedural mesh shape parameters (GenMeshes())
+typedef struct MeshGenParams {
+    int type;               // Mesh shape type (MeshGenType)
+    float params[2];        // Shape dimensions (radius, size...)
+    int resolution[2];      // Shape subdivisions (rings, slices, sides...)
+} MeshGenParams;
+
+// OcclusionQuery, model visibility tested on GPU over frames (DrawModelOccluded())
+typedef struct OcclusionQuery {
+    unsigned int id;            // OpenGL query object id (0: occlusion queries not supported)
+    bool pending;               // Query issued, result not read back yet
+    bool visible;               // Latest query result read back (previous frames)
+} OcclusionQuery;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -380,6 +585,15 @@ typedef struct BoneInfo {
     int parent;             // Bone parent
 } BoneInfo;
 
+// ModelPose, model bones pose evaluated by animation update
+// NOTE: Pose is kept by model and shared by skinning, bounds update and bones attachments
+typedef struct ModelPose {
+    int boneCount;          // Number of bones
+    Transform *transforms;  // Bones global transforms (model space)
+    Matrix *globals;        // Bones global matrices (model space), used by GetModelBoneTransform()
+    Matrix *boneMatrices;   // Bones skinning matrices (bind pose to animated pose)
+} ModelPose;
+
 // Model, meshes, materials and animation data
 typedef struct Model {
     Matrix transform;       // Local transform matrix
@@ -389,11 +603,14 @@ typedef struct Model {
     Mesh *meshes;           // Meshes array
     Material *materials;    // Materials array
     int *meshMaterial;      // Mesh material number
+    struct BoundingBox *meshBounds; // Meshes bounding boxes (computed on load, updated by animation)
 
     // Animation data
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+    struct BoundingBox *boneBounds; // Meshes vertices bounding boxes by bone (bind pose, meshCount*boneCount)
+    ModelPose *pose;        // Bones current pose (bind pose on load, updated by animation)
 } Model;
 
 // ModelAnimation
@@ -402,6 +619,10 @@ typedef struct ModelAnimation {
     int frameCount;         // Number of animation frames
     BoneInfo *bones;        // Bones information (skeleton)
     Transform **framePoses; // Poses array by frame
+    float *frameTimes;      // Frames time in seconds (NULL for fixed 60 fps frames), used by UpdateModelAnimationEx()
+    void *compressedPoses;  // Compressed poses data (CompressModelAnimation()), framePoses is NULL when compressed
+    int morphCount;         // Number of morph targets weights by frame (model meshes morph targets, meshes order)
+    float *frameMorphWeights; // Morph targets weights by frame (frameCount*morphCount), NULL if not animated
 } ModelAnimation;
 
 // Ray, ray for raycasting
@@ -424,6 +645,111 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// Frustum, view volume limited by 6 planes
+typedef struct Frustum {
+    Vector4 planes[6];      // Planes (normal XYZ pointing inside, distance W): left, right, bottom, top, near, far
+} Frustum;
+
+// BVHNode, bounding volume hierarchy node
+typedef struct BVHNode {
+    Vector3 min;            // Node bounds minimum
+    int first;              // Leaf first triangle or inner node left child (right child is next node)
+    Vector3 max;            // Node bounds maximum
+    int count;              // Leaf triangles count (0 for inner nodes)
+} BVHNode;
+
+// MeshBVH, mesh triangles bounding volume hierarchy (ray picking)
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes
+    int triangleCount;      // Number of triangles
+    BVHNode *nodes;         // Nodes array (root node is first)
+    Vector3 *vertices;      // Triangles vertices ordered by leaf nodes (3 per triangle)
+} MeshBVH;
+
+// MeshInstanceCuller, GPU frustum culling of mesh instances (compute shader, requires OpenGL 4.3)
+typedef struct MeshInstanceCuller {
+    unsigned int shaderId;      // Culling compute shader program id
+    MeshInstanceBuffer visible; // Visible instances transforms (compacted, written by culling pass)
+    unsigned int argsId;        // Indirect draw arguments buffer id (visible instances count written by culling pass)
+    BoundingBox bounds;         // Mesh bounding box (local space)
+    int elementCount;           // Mesh elements drawn by instance (indices or vertex count)
+} MeshInstanceCuller;
+
+// ShadowMap, directional light (cascades) or spot light shadows depth, static casters depth is cached
+// NOTE: Cascades are stored side by side in depth textures, state fields are updated by UpdateShadowMap() and BeginShadowMode()
+typedef struct ShadowMap {
+    unsigned int id;            // OpenGL framebuffer object id (shadows depth)
+    unsigned int cacheId;       // OpenGL framebuffer object id (static casters depth cache, 0 if not supported)
+    Texture2D depth;            // Shadows depth texture (cascades side by side)
+    Texture2D cacheDepth;       // Static casters depth texture (cascades side by side)
+    int type;                   // Shadow light type (ShadowLightType)
+    int size;                   // Cascade depth size (square, pixels)
+    int cascadeCount;           // Number of cascades (spot light: 1)
+    float distance;             // Shadows distance from camera (directional light) or light range (spot light)
+    float angle;                // Spot light cone angle (degrees)
+    Vector3 position;           // Light position (spot light)
+    Vector3 direction;          // Light direction (normalized)
+    float splits[4];            // Cascades far distances from camera
+    float sizes[4];             // Cascades light space size (world units, square)
+    Matrix view;                // Light view matrix (casters drawing)
+    Matrix projections[4];      // Cascades light projection matrices (casters drawing)
+    Matrix matrices[4];         // Cascades shadow matrices: world space to shadow depth texture space (UV and depth)
+    int origins[4][3];          // Cascades light space origins: XY in texels, Z in depth steps
+    int cacheOrigins[4][3];     // Cascades static casters cache origins
+    unsigned int cacheMask;     // Cascades static casters cache valid (bit per cascade)
+} ShadowMap;
+
+// ClusterLight, point or spot light for clustered lighting
+typedef struct ClusterLight {
+    Vector3 position;           // Light position (world space)
+    Vector3 direction;          // Spot light direction (normalized)
+    Color color;                // Light color
+    float intensity;            // Light intensity (color multiplier)
+    float range;                // Light range, attenuation reaches zero at range distance
+    float angle;                // Spot light cone angle (degrees), point light if 0
+} ClusterLight;
+
+// LightClusters, lights binned into camera view clusters for forward lighting
+// NOTE: Clusters are screen tiles by exponential depth slices, shader only evaluates lights listed for fragment cluster
+typedef struct LightClusters {
+    Texture2D lights;           // Lights data texture (float RGBA, 3 texels by light)
+    Texture2D clusters;         // Clusters data texture (float RGBA): clusters lights lists ranges, then lights indices
+    float *lightsData;          // Lights data (CPU copy of lights texture)
+    float *clustersData;        // Clusters data (CPU copy of clusters texture)
+    int *binned;                // Clusters binned lights (MAX_LIGHTS_PER_CLUSTER by cluster)
+    int maxLights;              // Maximum number of lights
+    int lightCount;             // Number of lights on last update
+    int tiles[3];               // Clusters grid size: screen tiles (x, y) and depth slices
+    float near;                 // Clusters first depth slice distance from camera
+    float far;                  // Clusters last depth slice distance from camera
+    Vector3 viewPosition;       // Camera position on last update
+    Vector2 screenSize;         // Render size on last update (clusters screen tiles size)
+    Color ambient;              // Ambient light color
+} LightClusters;
+
+// TerrainChunk, terrain region mesh at current LOD level
+typedef struct TerrainChunk {
+    Mesh mesh;              // Chunk mesh for current LOD level (valid if lod >= 0)
+    int lod;                // Current chunk mesh LOD level (-1: not loaded)
+    int request;            // Pending chunk mesh generation request (-1: none)
+    BoundingBox bounds;     // Chunk bounding box (terrain space)
+} TerrainChunk;
+
+// Terrain, heightmap split in chunks, chunks LOD meshes generated asynchronously by camera distance
+typedef struct Terrain {
+    int width;              // Heightmap width (samples)
+    int height;             // Heightmap height (samples)
+    unsigned short *heights; // Heightmap samples, normalized heights (16 bit)
+    Vector3 size;           // Terrain size (world units)
+    int chunkSize;          // Chunk size (heightmap quads per side, power of two)
+    int chunksX;            // Number of chunks along X
+    int chunksZ;            // Number of chunks along Z
+    int lodCount;           // Number of LOD levels (every level halves vertices per side)
+    float lodDistance;      // Camera distance to chunk for first LOD level change (doubled for every level)
+    float viewDistance;     // Camera distance to chunk for chunk mesh unloading (0: never unloaded)
+    TerrainChunk *chunks;   // Chunks array (chunksX*chunksZ)
+} Terrain;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -437,6 +763,8 @@ typedef struct Wave {
 // NOTE: Actual structs are defined internally in raudio module
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
+typedef struct rAudioBus rAudioBus;
+typedef struct rAudioCapture rAudioCapture;
 
 // AudioStream, custom audio stream
 typedef struct AudioStream {
@@ -448,6 +776,30 @@ typedef struct AudioStream {
     unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
 } AudioStream;
 
+// AudioStreamStats, audio stream buffering stats
+typedef struct AudioStreamStats {
+    unsigned int subBufferSize;     // Sub-buffer size (frames)
+    unsigned int subBufferCount;    // Sub-buffers count in use (ring buffer depth)
+    unsigned int subBufferMaxCount; // Sub-buffers maximum count (adaptive streams grow up to it)
+    unsigned int underrunCount;     // Underruns, mixer ran out of stream data
+    unsigned int overrunCount;      // Overruns, stream updated with no sub-buffer available
+    float latency;                  // Buffering latency (seconds)
+} AudioStreamStats;
+
+// AudioBus, submix bus, sounds and streams routed to a bus are mixed together and processed once
+typedef struct AudioBus {
+    rAudioBus *bus;             // Pointer to internal bus data
+} AudioBus;
+
+// AudioCaptureStream, captured audio from input device (32 bit float samples)
+typedef struct AudioCaptureStream {
+    rAudioCapture *capture;     // Pointer to internal capture data
+
+    unsigned int sampleRate;    // Frequency (samples per second)
+    unsigned int sampleSize;    // Bit depth (bits per sample): 32 (float)
+    unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
+} AudioCaptureStream;
+
 // Sound
 typedef struct Sound {
     AudioStream stream;         // Audio stream
@@ -490,6 +842,19 @@ typedef struct VrStereoConfig {
     float scaleIn[2];               // VR distortion scale in
 } VrStereoConfig;
 
+// Frame time statistics, times in seconds
+typedef struct FrameTimeStats {
+    int frameCount;                 // Number of frames measured
+    float average;                  // Frame time average
+    float p50;                      // Frame time 50th percentile (median)
+    float p95;                      // Frame time 95th percentile
+    float p99;                      // Frame time 99th percentile
+    float max;                      // Frame time maximum
+    float update;                   // Update time average (from EndDrawing() to BeginDrawing())
+    float draw;                     // Draw time average (from BeginDrawing() to SwapScreenBuffer() end)
+    float wait;                     // Wait time average (frame pacing for target FPS)
+} FrameTimeStats;
+
 // File path list
 typedef struct FilePathList {
     unsigned int capacity;          // Filepaths max entries
@@ -497,6 +862,37 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// Input event, timestamped input change registered by PollInputEvents()
+typedef struct InputEvent {
+    double time;                    // Event time in seconds (GetTime() reference)
+    int type;                       // Event type (InputEventType)
+    int code;                       // Event code: key, char (unicode), mouse/gamepad button, gamepad axis or touch point id
+    int gamepad;                    // Gamepad index (gamepad events only)
+    Vector2 value;                  // Event value: mouse/touch position, mouse wheel move or gamepad axis movement (x)
+} InputEvent;
+
+// Memory allocations stats (SUPPORT_MEMORY_TRACKING)
+typedef struct MemoryStats {
+    unsigned int current;           // Currently allocated memory (bytes)
+    unsigned int peak;              // Peak allocated memory (bytes)
+    unsigned int count;             // Currently allocated blocks count
+    unsigned int total;             // Total allocations count
+} MemoryStats;
+
+// Memory arena, linear allocator, all allocations released at once
+typedef struct MemArena {
+    void *blocks;                   // Arena memory blocks list (current block first)
+    unsigned int blockSize;         // Arena memory blocks size (bytes), bigger allocations get their own block
+} MemArena;
+
+// Memory pool, fixed-size blocks allocator
+typedef struct MemPool {
+    unsigned char *data;            // Pool memory (blockSize*blockCount bytes)
+    void *freeList;                 // Pool free blocks list
+    unsigned int blockSize;         // Pool block size (bytes)
+    unsigned int blockCount;        // Pool blocks count
+} MemPool;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -518,7 +914,8 @@ typedef enum {
     FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
     FLAG_WINDOW_MOUSE_PASSTHROUGH = 0x00004000, // Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED
     FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
+    FLAG_INTERLACED_HINT    = 0x00010000,   // Set to try enabling interlaced video format (for V3D)
+    FLAG_THREADED_RENDERER  = 0x00020000    // Set to present frames from a render thread, update runs in parallel (PLATFORM_DESKTOP)
 } ConfigFlags;
 
 // Trace log level
@@ -717,6 +1114,24 @@ typedef enum {
     GAMEPAD_AXIS_RIGHT_TRIGGER = 5      // Gamepad back trigger right, pressure level: [1..-1]
 } GamepadAxis;
 
+// Input event types
+typedef enum {
+    INPUT_EVENT_KEY_UP = 0,         // Key released (code: key)
+    INPUT_EVENT_KEY_DOWN,           // Key pressed (code: key)
+    INPUT_EVENT_KEY_REPEAT,         // Key pressed repeat, key held down (code: key)
+    INPUT_EVENT_CHAR,               // Char pressed (code: unicode)
+    INPUT_EVENT_MOUSE_BUTTON_UP,    // Mouse button released (code: button)
+    INPUT_EVENT_MOUSE_BUTTON_DOWN,  // Mouse button pressed (code: button)
+    INPUT_EVENT_MOUSE_MOVE,         // Mouse moved (value: position)
+    INPUT_EVENT_MOUSE_WHEEL,        // Mouse wheel moved (value: wheel move)
+    INPUT_EVENT_TOUCH_UP,           // Touch point released (code: touch point id, value: position)
+    INPUT_EVENT_TOUCH_DOWN,         // Touch point pressed (code: touch point id, value: position)
+    INPUT_EVENT_TOUCH_MOVE,         // Touch point moved (code: touch point id, value: position)
+    INPUT_EVENT_GAMEPAD_BUTTON_UP,  // Gamepad button released (gamepad, code: button)
+    INPUT_EVENT_GAMEPAD_BUTTON_DOWN,// Gamepad button pressed (gamepad, code: button)
+    INPUT_EVENT_GAMEPAD_AXIS        // Gamepad axis moved (gamepad, code: axis, value.x: movement)
+} InputEventType;
+
 // Material map index
 typedef enum {
     MATERIAL_MAP_ALBEDO = 0,        // Albedo material (same as: MATERIAL_MAP_DIFFUSE)
@@ -762,7 +1177,17 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_BLOCK_FRAME,         // Shader location: uniform block: frame (view, projection)
+    SHADER_LOC_BLOCK_DRAW,          // Shader location: uniform block: draw (mvp, model, normal, color diffuse)
+    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
+    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
+    SHADER_LOC_BONE_MATRICES,       // Shader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_INSTANCE_COLOR,      // Shader location: vertex attribute: instanceColor (per-instance tint)
+    SHADER_LOC_INSTANCE_TRANSFORM,  // Shader location: vertex attribute: instanceTransform (per-instance model matrix)
+    SHADER_LOC_MORPH_WEIGHTS,       // Shader location: array of floats uniform: morphWeights
+    SHADER_LOC_MORPH_TARGETS,       // Shader location: sampler2d texture: morphTargets (morph targets deltas)
+    SHADER_LOC_MATRIX_MVP_STEREO    // Shader location: array of matrices uniform: mvpStereo (single pass stereo eyes)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -845,13 +1270,32 @@ typedef enum {
     CUBEMAP_LAYOUT_PANORAMA                 // Layout is defined by a panorama image (equirrectangular map)
 } CubemapLayout;
 
+// Image color operations (ImageProcess())
+typedef enum {
+    IMAGE_PROCESS_TINT = 0,                 // Tint colors (color), same as ImageColorTint()
+    IMAGE_PROCESS_INVERT,                   // Invert colors, same as ImageColorInvert()
+    IMAGE_PROCESS_GRAYSCALE,                // Grayscale colors, alpha is kept
+    IMAGE_PROCESS_CONTRAST,                 // Modify contrast (value), same as ImageColorContrast()
+    IMAGE_PROCESS_BRIGHTNESS,               // Modify brightness (value), same as ImageColorBrightness()
+    IMAGE_PROCESS_REPLACE,                  // Replace color (color) by replacement color (replace), same as ImageColorReplace()
+    IMAGE_PROCESS_ALPHA_PREMULTIPLY         // Premultiply alpha, same as ImageAlphaPremultiply()
+} ImageProcessType;
+
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, requires external shader
+    FONT_MSDF                       // Multi-channel SDF font generation, RGB glyphs (default shader on LoadFontMsdf())
 } FontType;
 
+// Text wrap mode, used by DrawTextBoxed()
+typedef enum {
+    TEXT_WRAP_NONE = 0,             // No wrap, lines clipped to rectangle width
+    TEXT_WRAP_CHAR,                 // Lines broken on any character
+    TEXT_WRAP_WORD                  // Lines broken between words (long words broken on characters)
+} TextWrapMode;
+
 // Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
@@ -895,6 +1339,16 @@ typedef enum {
     CAMERA_ORTHOGRAPHIC             // Orthographic projection
 } CameraProjection;
 
+// World to screen projection clip flags (point outside of view volume)
+typedef enum {
+    CLIP_LEFT   = 1,                // Point at left of viewport
+    CLIP_RIGHT  = 2,                // Point at right of viewport
+    CLIP_BOTTOM = 4,                // Point below viewport
+    CLIP_TOP    = 8,                // Point above viewport
+    CLIP_NEAR   = 16,               // Point in front of near plane (behind camera)
+    CLIP_FAR    = 32                // Point beyond far plane
+} ClipFlags;
+
 // N-patch layout
 typedef enum {
     NPATCH_NINE_PATCH = 0,          // Npatch layout: 3x3 tiles
@@ -902,6 +1356,119 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Path stroke segments join
+typedef enum {
+    PATH_JOIN_MITER = 0,            // Segments joined by extending outlines (bevel over PATH_MITER_LIMIT)
+    PATH_JOIN_BEVEL,                // Segments joined by a straight edge
+    PATH_JOIN_ROUND                 // Segments joined by an arc
+} PathJoin;
+
+// Path stroke open contours ends cap
+typedef enum {
+    PATH_CAP_BUTT = 0,              // Contour ends at last point
+    PATH_CAP_SQUARE,                // Contour extended half thickness past last point
+    PATH_CAP_ROUND                  // Contour ended by a half circle
+} PathCap;
+
+// Spline types
+typedef enum {
+    SPLINE_LINEAR = 0,              // Line segments between points
+    SPLINE_CATMULL_ROM,             // Catmull-Rom curve through all points (end points repeated)
+    SPLINE_BASIS,                   // Uniform cubic B-spline, 4 points minimum
+    SPLINE_BEZIER_CUBIC             // Cubic bezier curves: point, control, control, point... (3*n + 1 points)
+} SplineType;
+
+// Mesh optimization steps
+// NOTE: Provided as bit-wise flags to OptimizeMesh()
+typedef enum {
+    MESH_OPTIMIZE_INDICES       = 1,    // Deduplicate vertices into indices buffer
+    MESH_OPTIMIZE_VERTEX_CACHE  = 2,    // Reorder triangles for post-transform vertex cache locality (Tipsify)
+    MESH_OPTIMIZE_OVERDRAW      = 4,    // Reorder triangles clusters to reduce overdraw (outer facing first)
+    MESH_OPTIMIZE_VERTEX_FETCH  = 8,    // Reorder vertices by first use for vertex fetch locality
+    MESH_OPTIMIZE_ALL           = 15    // All optimization steps
+} MeshOptimizeFlags;
+
+// Mesh vertex attributes packing in GPU buffers
+// NOTE: Provided as bit-wise flags to UploadMeshPacked(), mesh CPU data is kept as float
+typedef enum {
+    MESH_PACK_POSITIONS         = 1,    // Positions as unorm16, quantized to mesh bounds (dequantized by draw transform)
+    MESH_PACK_TEXCOORDS         = 2,    // Texcoords as unorm16 (in [0..1] range) or half-float
+    MESH_PACK_NORMALS           = 4,    // Normals and tangents as snorm8
+    MESH_PACK_ALL               = 7     // All vertex attributes packed
+} MeshPackFlags;
+
+// Mesh CPU vertex data attributes
+// NOTE: Provided as bit-wise flags to ReleaseMeshData(), attributes kept on CPU after upload
+typedef enum {
+    MESH_DATA_VERTICES          = 1,    // Vertex positions (bounds, collision and picking, LoadMeshBVH())
+    MESH_DATA_TEXCOORDS         = 2,    // Texture coordinates (texcoords and texcoords2)
+    MESH_DATA_NORMALS           = 4,    // Vertex normals
+    MESH_DATA_TANGENTS          = 8,    // Vertex tangents
+    MESH_DATA_COLORS            = 16,   // Vertex colors
+    MESH_DATA_ALL               = 31    // All vertex attributes
+} MeshDataFlags;
+
+// Mesh generation shape type
+// NOTE: Used by GenMeshes(), parameters match GenMesh*() functions parameters order
+typedef enum {
+    MESH_GEN_POLY = 0,      // Polygon: params { radius }, resolution { sides }
+    MESH_GEN_PLANE,         // Plane: params { width, length }, resolution { resX, resZ }
+    MESH_GEN_SPHERE,        // Sphere: params { radius }, resolution { rings, slices }
+    MESH_GEN_HEMISPHERE,    // Half-sphere: params { radius }, resolution { rings, slices }
+    MESH_GEN_CYLINDER,      // Cylinder: params { radius, height }, resolution { slices }
+    MESH_GEN_CONE,          // Cone: params { radius, height }, resolution { slices }
+    MESH_GEN_TORUS,         // Torus: params { radius, size }, resolution { radSeg, sides }
+    MESH_GEN_KNOT           // Trefoil knot: params { radius, size }, resolution { radSeg, sides }
+} MeshGenType;
+
+// Shadow map light type
+typedef enum {
+    SHADOW_LIGHT_DIRECTIONAL = 0,   // Directional light, cascades cover camera view distance (orthographic)
+    SHADOW_LIGHT_SPOT               // Spot light, one cascade covers light cone (perspective)
+} ShadowLightType;
+
+// Memory module, memory allocations are tagged by module (SUPPORT_MEMORY_TRACKING)
+typedef enum {
+    MEMORY_MODULE_USER = 0,         // Memory module: User allocations (MemAlloc())
+    MEMORY_MODULE_CORE,             // Memory module: rcore and utils
+    MEMORY_MODULE_RLGL,             // Memory module: rlgl CPU buffers
+    MEMORY_MODULE_TEXTURES,         // Memory module: rtextures (images data)
+    MEMORY_MODULE_TEXT,             // Memory module: rtext (fonts data)
+    MEMORY_MODULE_MODELS,           // Memory module: rmodels (meshes, materials, animations data)
+    MEMORY_MODULE_AUDIO             // Memory module: raudio (waves, sounds and music data)
+} MemoryModule;
+
+// Compression codec, used by CompressDataEx() and DecompressDataCodec()
+typedef enum {
+    COMPRESSION_DEFLATE = 0,        // DEFLATE (RFC 1951): best compression ratio, slow compression (levels 1..8)
+    COMPRESSION_LZ4                 // LZ4 block format: fast compression, decompression close to memory bandwidth (levels 1..9)
+} CompressionCodec;
+
+// Sound storage, sound data format kept in memory
+// NOTE: Compact storages are converted/decoded to device format on mixing
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,       // Sound data converted to device format on loading (32 bit float, stereo, device sample rate)
+    SOUND_STORAGE_PCM,              // Sound data kept as original wave PCM data (sample size, channels and sample rate)
+    SOUND_STORAGE_QOA               // Sound data compressed as QOA (SUPPORT_FILEFORMAT_QOA), decoded on mixing
+} SoundStorage;
+
+// Audio distance model, spatial sounds attenuation by distance to listener
+// NOTE: Distance is clamped to [refDistance, maxDistance] range
+typedef enum {
+    AUDIO_DISTANCE_NONE = 0,        // No distance attenuation
+    AUDIO_DISTANCE_INVERSE,         // Inverse distance: ref/(ref + rolloff*(distance - ref)) (default)
+    AUDIO_DISTANCE_LINEAR,          // Linear distance: 1 - rolloff*(distance - ref)/(max - ref)
+    AUDIO_DISTANCE_EXPONENTIAL      // Exponential distance: (distance/ref)^-rolloff
+} AudioDistanceModel;
+
+// Audio bus filter type (biquad)
+typedef enum {
+    AUDIO_FILTER_NONE = 0,          // No filter
+    AUDIO_FILTER_LOWPASS,           // Low-pass filter
+    AUDIO_FILTER_HIGHPASS,          // High-pass filter
+    AUDIO_FILTER_BANDPASS           // Band-pass filter (constant 0 dB peak gain)
+} AudioFilterType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -909,6 +1476,18 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, unsigned in
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, unsigned int bytesToWrite);  // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef unsigned char *(*LoadFileDataMappedCallback)(const char *fileName, unsigned int *bytesRead);    // FileIO: Load binary data mapped to memory (read-only)
+typedef void (*UnloadFileDataMappedCallback)(unsigned char *data);      // FileIO: Unload binary data mapped to memory
+typedef void *(*MemAllocCallback)(unsigned int size, void *userData);   // Memory: Allocate memory
+typedef void *(*MemReallocCallback)(void *ptr, unsigned int size, void *userData); // Memory: Reallocate memory
+typedef void (*MemFreeCallback)(void *ptr, void *userData);             // Memory: Free memory (never called with NULL)
+
+typedef void (*JobCallback)(int start, int end, void *userData);        // Jobs: Process items range [start, end)
+typedef void (*MainLoopCallback)(void *userData);                       // Main loop: Update and draw one frame (SetMainLoop())
+typedef bool (*DataStreamCallback)(const unsigned char *data, int dataSize, void *userData);  // Data: Process streamed data chunk, return false to stop
+typedef Image (*TiledImageCallback)(Rectangle rec, void *userData);     // Images: Load tiled image tile, returns image of rectangle pixels
+typedef bool (*ImageProbeCallback)(const unsigned char *fileData, int dataSize, int *width, int *height, int *format);  // Images: Get image size and pixel format from file data, false if not supported
+typedef bool (*ImageDecodeCallback)(const unsigned char *fileData, int dataSize, void *pixels, int pixelsSize);         // Images: Decode image file data into provided pixels memory (probed size and format)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -926,6 +1505,7 @@ extern "C" {            // Prevents name mangling of functions
 // Window-related functions
 RLAPI void InitWindow(int width, int height, const char *title);  // Initialize window and OpenGL context
 RLAPI bool WindowShouldClose(void);                               // Check if KEY_ESCAPE pressed or Close icon pressed
+RLAPI void SetMainLoop(MainLoopCallback callback, void *userData); // Run main loop, callback called every frame until window should close (browser driven on web, no ASYNCIFY required)
 RLAPI void CloseWindow(void);                                     // Close window and unload OpenGL context
 RLAPI bool IsWindowReady(void);                                   // Check if window has been initialized successfully
 RLAPI bool IsWindowFullscreen(void);                              // Check if window is currently fullscreen
@@ -962,6 +1542,12 @@ RLAPI int GetMonitorHeight(int monitor);                          // Get specifi
 RLAPI int GetMonitorPhysicalWidth(int monitor);                   // Get specified monitor physical width in millimetres
 RLAPI int GetMonitorPhysicalHeight(int monitor);                  // Get specified monitor physical height in millimetres
 RLAPI int GetMonitorRefreshRate(int monitor);                     // Get specified monitor refresh rate
+RLAPI int GetDisplayPlaneCount(void);                             // Get number of hardware overlay planes available for direct scanout (PLATFORM_DRM)
+RLAPI RenderTexture2D LoadRenderTextureScanout(int width, int height); // Load render texture for direct scanout on a display plane (PLATFORM_DRM)
+RLAPI void UnloadRenderTextureScanout(RenderTexture2D target);    // Unload scanout render texture, display planes showing it are disabled
+RLAPI bool SetDisplayPlaneTexture(int plane, RenderTexture2D target, Rectangle source, Rectangle dest); // Set scanout render texture displayed on overlay plane (applied on next frame)
+RLAPI bool SetDisplayPlaneDmabuf(int plane, int fd, int width, int height, int stride, unsigned int fourcc, Rectangle dest); // Set external dmabuf displayed on overlay plane (applied on next frame)
+RLAPI void ClearDisplayPlane(int plane);                          // Clear overlay plane (applied on next frame)
 RLAPI Vector2 GetWindowPosition(void);                            // Get window position XY on monitor
 RLAPI Vector2 GetWindowScaleDPI(void);                            // Get window scale DPI factor
 RLAPI const char *GetMonitorName(int monitor);                    // Get the human-readable, UTF-8 encoded name of the primary monitor
@@ -1002,8 +1588,14 @@ RLAPI void BeginBlendMode(int mode);                              // Begin blend
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void SetFrameDirtyRect(Rectangle rec);                      // Set next frame changed region (call before BeginDrawing()), empty region skips frame presentation
+RLAPI void BeginDynamicResolutionMode(void);                      // Begin drawing scene at dynamic resolution, scaled to reach target GPU frame time
+RLAPI void EndDynamicResolutionMode(void);                        // End drawing scene at dynamic resolution, scene upscaled to screen (following drawing at native resolution)
+RLAPI void SetDynamicResolution(float targetTime, float minScale, float sharpness); // Set dynamic resolution target GPU frame time (seconds, 0: target FPS), minimum scale and upscale sharpening
+RLAPI float GetDynamicResolutionScale(void);                      // Get current dynamic resolution scale
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
+RLAPI void SetVrStereoSinglePass(bool enabled);                   // Set stereo rendering in a single pass, eyes drawn as instances (requires OpenGL 3.3)
 
 // VR stereo config functions for VR simulator
 RLAPI VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device);     // Load VR stereo config for VR simulator device parameters
@@ -1013,6 +1605,8 @@ RLAPI void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR s
 // NOTE: Shader functionality is not available on OpenGL 1.1
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
 RLAPI Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
+RLAPI Shader LoadShaderAsync(const char *vsFileName, const char *fsFileName);   // Load shader from files without waiting for compilation (check IsShaderReady() before use)
+RLAPI Shader LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode); // Load shader from code strings without waiting for compilation (check IsShaderReady() before use)
 RLAPI bool IsShaderReady(Shader shader);                                   // Check if a shader is ready
 RLAPI int GetShaderLocation(Shader shader, const char *uniformName);       // Get shader uniform location
 RLAPI int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
@@ -1020,37 +1614,94 @@ RLAPI void SetShaderValue(Shader shader, int locIndex, const void *value, int un
 RLAPI void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniformType, int count);   // Set shader uniform value vector
 RLAPI void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
+RLAPI void SetShaderValueTextureArray(Shader shader, int locIndex, Texture2DArray texture); // Set shader uniform value for texture array (sampler2DArray)
+RLAPI void SetShaderValueTexture3D(Shader shader, int locIndex, Texture3D texture); // Set shader uniform value for 3d texture (sampler3D)
 RLAPI void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
+RLAPI void SetShaderCacheDirectory(const char *dirPath);                  // Set shader program binaries cache directory (NULL to disable)
 
 // Screen-space-related functions
 RLAPI Ray GetMouseRay(Vector2 mousePosition, Camera camera);      // Get a ray trace from mouse position
 RLAPI Matrix GetCameraMatrix(Camera camera);                      // Get camera transform matrix (view matrix)
 RLAPI Matrix GetCameraMatrix2D(Camera2D camera);                  // Get camera 2d transform matrix
+RLAPI Frustum GetCameraFrustum(Camera camera);                    // Get camera view frustum (same projection as BeginMode3D())
+RLAPI Frustum GetMatrixFrustum(Matrix matrix);                    // Get frustum planes from view-projection matrix
 RLAPI Vector2 GetWorldToScreen(Vector3 position, Camera camera);  // Get the screen space position for a 3d world space position
 RLAPI Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera); // Get the world space position for a 2d camera screen space position
 RLAPI Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height); // Get size position for a 3d world space position
 RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Get the screen space position for a 2d camera world space position
+RLAPI CameraViewProj GetCameraViewProjection(Camera camera, int width, int height); // Get camera view-projection matrices for a viewport size (last one cached)
+RLAPI int GetWorldToScreenArray(const Vector3 *positions, Vector2 *screenPositions, int count, const CameraViewProj *viewProj, unsigned char *clipFlags); // Get screen space positions for many 3d world space positions, returns points inside view (clip flags optional)
 
 // Timing-related functions
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
+RLAPI void SetFixedUpdateRate(int hz);                            // Set fixed update rate (steps per second), decoupled from render rate (0: disabled)
+RLAPI int GetFixedUpdateSteps(void);                              // Get fixed update steps to run on current frame
+RLAPI float GetFixedUpdateAlpha(void);                            // Get fixed update interpolation factor [0..1) between previous and current step
+RLAPI void SetFrameTimeStatsWindow(int frames);                   // Set number of last frames measured for frame time statistics
+RLAPI FrameTimeStats GetFrameTimeStats(void);                     // Get frame time statistics (percentiles) for last frames
+RLAPI bool ExportFrameTimeStats(const char *fileName);            // Export last frames times as CSV file (.csv), times in milliseconds
+
+// Profiler functions (Module: rprof)
+// NOTE: Scope names are not copied, they must be string literals or remain valid until exported
+RLAPI void BeginProfileScope(const char *name);                   // Begin named CPU profile scope (current thread)
+RLAPI void EndProfileScope(void);                                 // End latest CPU profile scope (current thread)
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded profile scopes as Chrome trace_event JSON file (.json)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
+RLAPI double GetInputEventTime(void);                             // Get time in seconds of latest input event registered (device timestamp when available)
 
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void SetGifRecordingFramerate(int fps);                     // Set GIF recording framerate (CTRL+F12 recording, frames encoded on background thread)
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
 RLAPI void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
+RLAPI void SetTraceLogAsync(bool enabled);                        // Set trace log messages written by a background thread (queued messages flushed on disable)
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void *MemAllocUninit(size_t size);                          // Internal memory allocator, memory not initialized (NULL: size too big)
+RLAPI void *MemAllocArray(size_t count, size_t size);             // Internal memory allocator for count elements, initialized to zero (NULL: size overflow)
+RLAPI void *MemReallocArray(void *ptr, size_t count, size_t size); // Internal memory reallocator for count elements (NULL: size overflow, ptr not freed)
+RLAPI MemoryStats GetMemoryStats(int module);                     // Get memory allocations stats by module (MemoryModule, -1: all modules), requires SUPPORT_MEMORY_TRACKING
+RLAPI void SetMemoryBudget(int module, unsigned int budget);      // Set memory budget for module (bytes), warning logged when exceeded (0: no budget)
+
+// Memory arena and pool functions
+// NOTE: Arena and pool memory is allocated with MemAlloc(), they are not thread-safe
+RLAPI MemArena LoadMemArena(unsigned int blockSize);             // Load memory arena, memory blocks are allocated on demand
+RLAPI void UnloadMemArena(MemArena arena);                       // Unload memory arena, all arena allocations are released
+RLAPI void ResetMemArena(MemArena *arena);                       // Reset memory arena, all arena allocations are released (current block kept)
+RLAPI void *MemArenaAlloc(MemArena *arena, unsigned int size);   // Allocate memory from arena (not initialized, 16-byte aligned)
+RLAPI MemPool LoadMemPool(unsigned int blockSize, unsigned int blockCount); // Load memory pool of fixed-size blocks
+RLAPI void UnloadMemPool(MemPool pool);                          // Unload memory pool
+RLAPI void *MemPoolAlloc(MemPool *pool);                         // Allocate one block from pool (NULL: pool full)
+RLAPI void MemPoolFree(MemPool *pool, void *ptr);                // Free one block back to pool
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
+// Jobs system functions
+// NOTE: Jobs callbacks run on worker threads, they must not call OpenGL (rlgl) functions
+RLAPI void InitJobSystem(int threadCount);                        // Initialize jobs system worker threads (0: one per CPU core minus one)
+RLAPI void CloseJobSystem(void);                                  // Close jobs system, worker threads are finished
+RLAPI int GetJobThreadCount(void);                                // Get jobs system threads count, including calling thread (1: serial)
+RLAPI void JobParallelFor(int count, JobCallback callback, void *userData); // Process items [0, count) in parallel, returns when all processed
+
+// Async loading functions
+// NOTE: Assets are decoded on a loader thread and uploaded to GPU on BeginDrawing(), use Load*Async()/Get*Async()
+RLAPI bool IsAsyncLoadReady(int request);                         // Check if an async load request is finished, asset can be retrieved
+
+// Automation events functions
+// NOTE: Events files are binary and streamed to/from disk, requires SUPPORT_EVENTS_AUTOMATION
+RLAPI bool StartAutomationEventRecording(const char *fileName);   // Start automation events recording into file (input changes only)
+RLAPI void StopAutomationEventRecording(void);                    // Stop automation events recording, events file is completed
+RLAPI bool StartAutomationEventPlaying(const char *fileName);     // Start automation events playing from file
+RLAPI void StopAutomationEventPlaying(void);                      // Stop automation events playing
+RLAPI bool SeekAutomationEventPlaying(unsigned int frame);        // Seek automation events playing to frame (since playing start)
+
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advance users
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
@@ -1058,10 +1709,18 @@ RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void SetLoadFileDataMappedCallback(LoadFileDataMappedCallback callback);      // Set custom file binary data mapped loader
+RLAPI void SetUnloadFileDataMappedCallback(UnloadFileDataMappedCallback callback);  // Set custom file binary data mapped unloader
+RLAPI void SetMemoryAllocator(MemAllocCallback allocFunc, MemReallocCallback reallocFunc, MemFreeCallback freeFunc, void *userData); // Set custom memory allocator used by all modules, call before InitWindow() (NULL: default)
 
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead);       // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI unsigned char *LoadFileDataMapped(const char *fileName, unsigned int *bytesRead); // Load file data mapped to memory (read-only), falls back to LoadFileData()
+RLAPI void UnloadFileDataMapped(unsigned char *data);             // Unload file data loaded by LoadFileDataMapped()
+RLAPI bool MountPackFile(const char *fileName);                   // Mount pack file (.rpak), file paths are resolved through mounted packs first
+RLAPI void UnmountPackFiles(void);                                // Unmount all pack files
+RLAPI bool ExportPackFile(const char *fileName, const char **files, int fileCount, bool compress); // Export files to pack file (.rpak), returns true on success
 RLAPI bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite);   // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, unsigned int size, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1091,8 +1750,17 @@ RLAPI long GetFileModTime(const char *fileName);                  // Get file mo
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI unsigned char *DecompressDataEx(const unsigned char *compData, int compDataSize, int *dataSize); // Decompress data (DEFLATE algorithm) with known size, dataSize provides expected size, memory must be MemFree()
+RLAPI unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int codec, int level, int *compDataSize); // Compress data with codec (CompressionCodec) and level (0: codec default), memory must be MemFree()
+RLAPI unsigned char *DecompressDataCodec(const unsigned char *compData, int compDataSize, int codec, int *dataSize); // Decompress data with codec, dataSize provides expected size (required by LZ4), memory must be MemFree()
+RLAPI bool CompressDataStream(const unsigned char *data, int dataSize, int chunkSize, DataStreamCallback callback, void *userData); // Compress data in chunks (DEFLATE algorithm), compressed chunks streamed through callback
+RLAPI bool DecompressDataStream(const unsigned char *compData, int compDataSize, DataStreamCallback callback, void *userData);       // Decompress data in chunks (DEFLATE algorithm), decompressed chunks streamed through callback
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
+RLAPI int EncodeDataBase64Into(const unsigned char *data, int dataSize, char *output, int outputSize); // Encode data to Base64 string into buffer, returns encoded size (0: buffer too small)
+RLAPI int DecodeDataBase64Into(const unsigned char *data, int dataSize, unsigned char *output, int outputSize); // Decode Base64 string data into buffer, returns decoded size (0: buffer too small)
+RLAPI int GetDataBase64EncodedSize(int dataSize);                                                    // Get Base64 encoded string size for data size (no null terminator)
+RLAPI int GetDataBase64DecodedSize(const unsigned char *data, int dataSize);                         // Get exact decoded data size for Base64 string
 
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
@@ -1142,6 +1810,11 @@ RLAPI Vector2 GetTouchPosition(int index);                    // Get touch posit
 RLAPI int GetTouchPointId(int index);                         // Get touch point identifier for given index
 RLAPI int GetTouchPointCount(void);                           // Get number of touch points
 
+// Input-related functions: events
+RLAPI int GetInputEventCount(void);                           // Get number of input events registered by last PollInputEvents()
+RLAPI InputEvent GetInputEvent(int index);                    // Get input event registered by last PollInputEvents(), ordered by time
+RLAPI float GetInputLatency(void);                            // Get time in seconds from input events to screen buffer swap (latest frame presenting input events)
+
 //------------------------------------------------------------------------------------
 // Gestures and Touch Handling Functions (Module: rgestures)
 //------------------------------------------------------------------------------------
@@ -1167,6 +1840,11 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI void AddShapesTexture(Texture2D texture, Rectangle source);       // Add texture white region used on shapes drawing while texture is current (no draw call break)
+RLAPI void RemoveShapesTexture(Texture2D texture);                       // Remove texture white region used on shapes drawing
+RLAPI void SetShapesTessellation(float maxError);                        // Set shapes curves tessellation max error in screen pixels (0: fixed segments)
+RLAPI void BeginShapesSdfMode(void);                                     // Begin SDF shapes mode, circles, rings, thick lines and rounded rectangles drawn as antialiased quads
+RLAPI void EndShapesSdfMode(void);                                       // End SDF shapes mode, queued shapes are drawn
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1215,6 +1893,24 @@ RLAPI void DrawPolyLines(Vector2 center, int sides, float radius, float rotation
 RLAPI void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color); // Draw a polygon outline of n sides with extended parameters
 RLAPI void DrawPolyLinesPro(Vector2 center, int sides, Vector2 radius, Vector2 origin, float rotation, float lineThick, Color color);  // Draw a bi-directional polygon outline of n sides with pro parameters
 
+// Paths drawing functions
+RLAPI void PathBegin(void);                                                         // Begin a new path, previous path points are cleared
+RLAPI void PathMoveTo(Vector2 point);                                               // Move path pen to point, a new contour is started
+RLAPI void PathLineTo(Vector2 point);                                               // Add a line from path pen to point
+RLAPI void PathQuadTo(Vector2 control, Vector2 point);                              // Add a quadratic bezier curve from path pen to point (adaptive flattening)
+RLAPI void PathCubicTo(Vector2 control1, Vector2 control2, Vector2 point);          // Add a cubic bezier curve from path pen to point (adaptive flattening)
+RLAPI void PathClose(void);                                                         // Close current path contour
+RLAPI void PathStroke(float thick, int join, int cap, Color color);                 // Draw path contours outline (PathJoin, PathCap)
+RLAPI void PathFill(Color color);                                                   // Draw path contours filled (concave contours triangulated)
+
+// Splines drawing functions
+RLAPI Spline LoadSpline(int type, const Vector2 *points, int pointCount);           // Load spline from control points (SplineType), tessellated on first use
+RLAPI void UnloadSpline(Spline spline);                                             // Unload spline data
+RLAPI void UpdateSpline(Spline *spline, const Vector2 *points, int pointCount);     // Update spline control points, tessellated again on next use
+RLAPI void DrawSpline(Spline *spline, float thick, Color color);                    // Draw spline, tessellation cached until points or zoom level change
+RLAPI float GetSplineLength(Spline *spline);                                        // Get spline length (tessellated)
+RLAPI Vector2 GetSplinePoint(Spline *spline, float distance);                       // Get spline point at distance from start (arc length parameterization)
+
 // Basic shapes collision detection functions
 RLAPI bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2);                                           // Check collision between two rectangles
 RLAPI bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2);        // Check collision between two circles
@@ -1224,9 +1920,17 @@ RLAPI bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius
 RLAPI bool CheckCollisionPointEllipse(Vector2 point, Vector2 center, Vector2 radius);                    // Check if point is inside ellipse
 RLAPI bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3);               // Check if point is inside a triangle
 RLAPI bool CheckCollisionPointPoly(Vector2 point, Vector2 *points, int pointCount);                      // Check if point is within a polygon described by array of vertices
+RLAPI PolygonIndex LoadPolygonIndex(const Vector2 *points, int pointCount);                              // Load polygon index for fast point in polygon checks (simple polygon)
+RLAPI void UnloadPolygonIndex(PolygonIndex index);                                                       // Unload polygon index data
+RLAPI bool CheckCollisionPointPolyIndex(Vector2 point, PolygonIndex index);                              // Check if point is within an indexed polygon
+RLAPI int CheckCollisionPointsPoly(const Vector2 *points, int pointCount, PolygonIndex index, bool *results); // Check points within an indexed polygon, results per point, returns points inside count
 RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
 RLAPI bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
+RLAPI int CheckCollisionRecsBatch(Rectangle rec, const float *xs, const float *ys, const float *widths, const float *heights, int count, bool *results); // Check collision between rectangle and rectangles array (SoA), returns colliding count
+RLAPI int CheckCollisionCirclesBatch(Vector2 center, float radius, const float *xs, const float *ys, const float *radii, int count, bool *results); // Check collision between circle and circles array (SoA), returns colliding count
+RLAPI int CheckCollisionCircleRecBatch(Rectangle rec, const float *xs, const float *ys, const float *radii, int count, bool *results); // Check collision between rectangle and circles array (SoA), returns colliding count
+RLAPI int CheckCollisionPointRecBatch(Rectangle rec, const float *xs, const float *ys, int count, bool *results); // Check points array (SoA) inside rectangle, returns points inside count
 
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
@@ -1238,10 +1942,30 @@ RLAPI Image LoadImage(const char *fileName);
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+RLAPI bool LoadImageFromMemoryInto(const char *fileType, const unsigned char *fileData, int dataSize, void *pixels, int pixelsSize); // Load image from memory buffer into provided pixels memory (size from GetImageInfoFromMemory())
+RLAPI bool GetImageInfoFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *width, int *height, int *format); // Get image size and pixel format from memory buffer, without decoding
+RLAPI bool RegisterImageDecoder(const char *fileType, ImageProbeCallback probe, ImageDecodeCallback decode); // Register image decoder for file type (i.e. '.jpg'), checked before built-in decoders
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI AnimImage LoadAnimImage(const char *fileName);                                                     // Load animated image from file (GIF, APNG), frames decoded on demand
+RLAPI bool IsAnimImageReady(AnimImage anim);                                                             // Check if an animated image is ready
+RLAPI void UnloadAnimImage(AnimImage anim);                                                              // Unload animated image frames decoder and current frame image
+RLAPI bool AnimImageNextFrame(AnimImage *anim);                                                          // Decode next animated image frame into anim.image (loops to first frame)
+RLAPI bool AnimImageSeek(AnimImage *anim, int frame);                                                    // Decode animated image frame into anim.image
+RLAPI int GetAnimImageFrameDelay(AnimImage anim, int frame);                                             // Get animated image frame delay (milliseconds)
+RLAPI void SetAnimImagePrefetch(AnimImage anim, bool enabled);                                           // Set animated image next frame decoding on async loader thread
+RLAPI TiledImage LoadTiledImageRaw(const char *fileName, int width, int height, int format, int headerSize, int tileSize); // Load tiled image from RAW file data, tiles read from file on demand
+RLAPI TiledImage LoadTiledImageCallback(int width, int height, int format, int tileSize, TiledImageCallback callback, void *userData); // Load tiled image with tiles loaded by callback on demand (generators)
+RLAPI TiledImage LoadTiledImageView(TiledImage image, Rectangle rec);                                    // Load tiled image region view, no pixels copied (tiles cache shared)
+RLAPI bool IsTiledImageReady(TiledImage image);                                                          // Check if a tiled image is ready
+RLAPI void UnloadTiledImage(TiledImage image);                                                           // Unload tiled image (tiles cache unloaded with last view)
+RLAPI void SetTiledImageBudget(TiledImage image, unsigned int bytes);                                    // Set tiled image tiles cache memory budget (bytes), least recently used tiles unloaded
+RLAPI Color GetTiledImageColor(TiledImage image, int x, int y);                                          // Get tiled image pixel color at (x, y)
+RLAPI Image ImageFromTiledImage(TiledImage image, Rectangle rec);                                        // Create an image from tiled image piece, copied tile by tile
+RLAPI Image ImageFromTiledImageScaled(TiledImage image, Rectangle rec, int newWidth, int newHeight);     // Create an image from tiled image piece scaled to new size (box filter), streamed by rows (RGBA)
+RLAPI void ImageDrawTiledImage(Image *dst, TiledImage src, Rectangle srcRec, Rectangle dstRec, Color tint); // Draw a source tiled image piece within a destination image, streamed tile by tile
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
@@ -1255,6 +1979,10 @@ RLAPI Image GenImageWhiteNoise(int width, int height, float factor);
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
+RLAPI Image GenImageGradientRadialRec(int width, int height, float density, Color inner, Color outer, Rectangle rec); // Generate image: radial gradient, rectangle of width*height gradient
+RLAPI Image GenImagePerlinNoiseRec(int width, int height, int offsetX, int offsetY, float scale, Rectangle rec); // Generate image: perlin noise, rectangle of width*height noise (can exceed it)
+RLAPI Image GenImageCellularRec(int tileSize, unsigned int seed, Rectangle rec);                         // Generate image: infinite cellular pattern rectangle, cells seeds hashed from tiles position
+RLAPI Image GenImageWhiteNoiseRec(float factor, unsigned int seed, Rectangle rec);                       // Generate image: infinite white noise rectangle, pixels hashed from position
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1262,6 +1990,7 @@ RLAPI Image ImageFromImage(Image image, Rectangle rec);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int compressedFormat, int quality);                               // Compress image data to GPU compressed format (DXT, ETC1, ETC2), quality [0..100]
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1271,9 +2000,14 @@ RLAPI void ImageAlphaPremultiply(Image *image);
 RLAPI void ImageBlurGaussian(Image *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
 RLAPI void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
+RLAPI void ImageResizeEx(Image *image, int newWidth, int newHeight, ImageResizeContext *context);        // Resize image (Bicubic scaling algorithm) with resize context (scratch buffers reuse, sRGB filtering)
+RLAPI ImageResizeContext LoadImageResizeContext(bool srgb);                                              // Load image resize context, scratch buffers are kept between resizes
+RLAPI void UnloadImageResizeContext(ImageResizeContext context);                                         // Unload image resize context scratch buffers
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, bool srgb, bool premultipliedAlpha);                             // Compute all mipmap levels for a provided image, gamma-correct and alpha weighted filtering options
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageQuantize(Image *image, int paletteSize, bool dither);                                    // Quantize image colors to palette size (median cut, up to 256 colors), Floyd-Steinberg dithering optional
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
@@ -1284,6 +2018,7 @@ RLAPI void ImageColorGrayscale(Image *image);
 RLAPI void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RLAPI void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
+RLAPI void ImageProcess(Image *image, const ImageProcessOp *ops, int count);                            // Apply color operations sequence to image in one pass (in place for RGBA8)
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
@@ -1313,21 +2048,73 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI int LoadTextureAsync(const char *fileName);                                                        // Load texture from file asynchronously, returns request id (-1: failed)
+RLAPI Texture2D GetTextureAsync(int request);                                                            // Get async loaded texture, request is released (empty if not ready)
+RLAPI Texture2D LoadTextureStreamed(const char *fileName);                                               // Load texture from file with mipmaps streaming (only low resolution mipmaps resident)
+RLAPI void RequestTextureStreaming(Texture2D texture, float screenSize);                                 // Request streamed texture mipmaps for a drawn size (in pixels)
+RLAPI void SetTextureStreamingBudget(unsigned int bytes);                                                // Set streamed textures GPU memory budget (bytes)
+RLAPI unsigned int GetTextureStreamingMemory(void);                                                      // Get streamed textures resident GPU memory (bytes)
+RLAPI VideoTexture LoadVideoTexture(const char *fileName);                                               // Load video texture from file (.y4m), frames decoded ahead on async loader thread
+RLAPI bool IsVideoTextureReady(VideoTexture video);                                                      // Check if a video texture is ready
+RLAPI void UnloadVideoTexture(VideoTexture video);                                                       // Unload video texture decoder and textures
+RLAPI bool UpdateVideoTexture(VideoTexture *video, float time);                                          // Update video texture frame for playback time (seconds, i.e. music time played), returns true if frame changed
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI Texture2D LoadTextureCompressed(const char *fileName, int quality);                                // Load texture from file compressed to best GPU supported format (DXT, ETC2), quality [0..100]
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
+RLAPI Texture2DArray LoadTextureArray(const Image *layers, int layerCount);                              // Load texture array from images (same size), mipmaps generated if first image has mipmaps
+RLAPI Texture3D LoadTexture3D(const Image *slices, int sliceCount);                                      // Load 3d texture from images slices (same size)
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
+RLAPI RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool depth);               // Load texture for rendering (framebuffer) with color format (float formats supported), depth optional
+RLAPI RenderTexture2D LoadRenderTextureMultisample(int width, int height, int samples);                 // Load multisample texture for rendering (framebuffer), resolved to texture on EndTextureMode()
 RLAPI bool IsTextureReady(Texture2D texture);                                                            // Check if a texture is ready
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                       // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
+RLAPI RenderTexture2D AcquireRenderTexture(int width, int height, int format, bool depth);              // Acquire render texture from pool (released matching targets reused), depth contents transient
+RLAPI void ReleaseRenderTexture(RenderTexture2D target);                                                 // Release render texture to pool, kept for reuse a number of frames
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI void UpdateTextureArrayLayer(Texture2DArray texture, int layer, const void *pixels);               // Update GPU texture array layer with new data
+RLAPI void UpdateTexture3DSlice(Texture3D texture, int slice, const void *pixels);                       // Update GPU 3d texture slice with new data
+RLAPI void UpdateTextureRecAsync(Texture2D texture, Rectangle rec, const void *pixels);                  // Update GPU texture rectangle with new data through pixel buffer (no render thread stall)
+RLAPI bool CopyTextureRegion(Texture2D src, Rectangle srcRec, Texture2D dst, Vector2 dstPos);            // Copy texture rectangle into another texture on GPU (no CPU readback)
+
+// Texture atlas functions
+RLAPI AtlasBuilder *LoadAtlasBuilder(int pageWidth, int pageHeight, int padding);                        // Load atlas builder, images packed into texture pages on demand
+RLAPI void UnloadAtlasBuilder(AtlasBuilder *atlas);                                                      // Unload atlas builder and pages textures
+RLAPI AtlasRegion AddAtlasImage(AtlasBuilder *atlas, Image image);                                       // Pack image into atlas page, image uploaded with padding edges extruded
+RLAPI void RemoveAtlasImage(AtlasBuilder *atlas, int id);                                                // Remove image from atlas, region space reused by next images
+RLAPI AtlasRegion GetAtlasRegion(const AtlasBuilder *atlas, int id);                                     // Get atlas image region (texture and source rectangle)
+RLAPI int GetAtlasPageCount(const AtlasBuilder *atlas);                                                  // Get atlas pages count
+RLAPI Texture2D GetAtlasPage(const AtlasBuilder *atlas, int page);                                       // Get atlas page texture
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
 RLAPI void SetTextureWrap(Texture2D texture, int wrap);                                                  // Set texture wrapping mode
 
+// Texture filters functions (GPU image processing)
+// NOTE: Filters are applied to render texture color attachment with fragment shader passes, use LoadImageFromTexture() to read back
+RLAPI RenderTexture2D LoadRenderTextureFromImage(Image image);                                           // Load render texture from image data (same rows order as image)
+RLAPI void TextureColorTint(RenderTexture2D *target, Color color);                                       // Modify render texture color: tint
+RLAPI void TextureColorInvert(RenderTexture2D *target);                                                  // Modify render texture color: invert
+RLAPI void TextureColorGrayscale(RenderTexture2D *target);                                               // Modify render texture color: grayscale (alpha removed)
+RLAPI void TextureColorContrast(RenderTexture2D *target, float contrast);                                // Modify render texture color: contrast (-100 to 100)
+RLAPI void TextureColorBrightness(RenderTexture2D *target, int brightness);                              // Modify render texture color: brightness (-255 to 255)
+RLAPI void TextureColorReplace(RenderTexture2D *target, Color color, Color replace);                     // Modify render texture color: replace color
+RLAPI void TextureAlphaPremultiply(RenderTexture2D *target);                                             // Premultiply render texture alpha channel
+RLAPI void TextureDither(RenderTexture2D *target, int rBpp, int gBpp, int bBpp, int aBpp);               // Dither render texture colors to bits per channel (ordered dithering)
+RLAPI void TextureResize(RenderTexture2D *target, int newWidth, int newHeight);                          // Resize render texture (bilinear, successive halving passes to downscale)
+
+// Texture image based lighting functions (GPU precomputation)
+// NOTE: Cubemaps are generated with fragment shader passes, use ExportTextureCubemap() to cache results on disk
+RLAPI TextureCubemap GenTextureCubemap(Texture2D panorama, int size, int format);                       // Generate cubemap from equirectangular panorama texture
+RLAPI TextureCubemap GenTextureIrradiance(TextureCubemap cubemap, int size);                            // Generate irradiance cubemap from environment cubemap (diffuse lighting)
+RLAPI TextureCubemap GenTexturePrefiltered(TextureCubemap cubemap, int size);                           // Generate prefiltered cubemap from environment cubemap (specular lighting, roughness by mipmap level)
+RLAPI Texture2D GenTextureBRDF(int size);                                                                // Generate BRDF integration lookup texture (split-sum approximation)
+RLAPI bool ExportTextureCubemap(TextureCubemap cubemap, const char *fileName);                           // Export cubemap faces and mipmaps to file (.ktx), returns true on success
+RLAPI TextureCubemap LoadTextureCubemapFromFile(const char *fileName);                                  // Load cubemap with mipmaps from file (.ktx)
+
 // Texture drawing functions
 RLAPI void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
 RLAPI void DrawTextureV(Texture2D texture, Vector2 position, Color tint);                                // Draw a Texture2D with position defined as Vector2
@@ -1336,6 +2123,7 @@ RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTexturePoly(Texture2D texture, Vector2 texcenter, Vector2 center, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint); // Draw textured polygon, defined by vertex and texture coordinates
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void DrawTextureBatch(Texture2D texture, const SpriteInstance *sprites, int count);             // Draw multiple parts of a texture with 'pro' parameters, one batch submission
 
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1361,15 +2149,23 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 // Font loading/unloading functions
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
+RLAPI int LoadFontAsync(const char *fileName);                                              // Load font from file asynchronously, returns request id (-1: failed)
+RLAPI Font GetFontAsync(int request);                                                       // Get async loaded font, request is released (empty if not ready)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);              // Load font with glyphs rasterized on first use into atlas (atlasSize: 0 for default), least recently used glyphs evicted
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load dynamic font from memory buffer (data copied), fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontMsdf(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font as multi-channel SDF (MSDF), drawn with default MSDF shader at any size (NULL codepoints: default charset)
+RLAPI Font LoadFontMsdfFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load MSDF font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *chars, int glyphCount);                                // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
+RLAPI bool ExportFontBinary(Font font, const char *fileName, bool compressAtlas);           // Export font as binary file (.rfnb): atlas, glyphs metrics and kerning, returns true on success
+RLAPI Font LoadFontBinary(const char *fileName);                                            // Load font from binary file (.rfnb), no rasterization (memory mapped, atlas uploaded directly)
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
@@ -1378,13 +2174,21 @@ RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontS
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
+RLAPI void DrawTextBoxed(Font font, const char *text, Rectangle rec, float fontSize, float spacing, int wrapMode, Color tint); // Draw text inside rectangle (TextWrapMode), lines out of rectangle or scissor area skipped
+
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text layout, glyphs positioned once (wrapWidth: words wrap width, 0 to disable)
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout, all glyphs quads in one batch pass
 
 // Text font info functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
+RLAPI Vector2 MeasureTextBytes(Font font, const char *text, int byteCount, float fontSize, float spacing); // Measure string size for Font, text bytes count provided (no null terminator required)
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                  // Get glyphs pair kerning, advance adjustment in pixels at font base size (0 if no kerning)
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
@@ -1392,6 +2196,7 @@ RLAPI void UnloadUTF8(char *text);                                      // Unloa
 RLAPI int *LoadCodepoints(const char *text, int *count);                // Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
 RLAPI void UnloadCodepoints(int *codepoints);                           // Unload codepoints data from memory
 RLAPI int GetCodepointCount(const char *text);                          // Get total number of codepoints in a UTF-8 encoded string
+RLAPI int DecodeUTF8Into(const char *text, int byteCount, int *codepoints, int capacity);   // Decode UTF-8 text bytes into provided codepoints buffer (no allocation), returns codepoints decoded
 RLAPI int GetCodepoint(const char *text, int *codepointSize);           // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
 RLAPI int GetCodepointNext(const char *text, int *codepointSize);       // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
 RLAPI int GetCodepointPrevious(const char *text, int *codepointSize);   // Get previous codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
@@ -1408,12 +2213,17 @@ RLAPI char *TextReplace(char *text, const char *replace, const char *by);
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
 RLAPI const char *TextJoin(const char **textList, int count, const char *delimiter);        // Join text strings with delimiter
 RLAPI const char **TextSplit(const char *text, char delimiter, int *count);                 // Split text into multiple strings
+RLAPI const char **TextSplitEx(MemArena *arena, const char *text, char delimiter, int *count); // Split text into multiple strings, allocated from memory arena (no substrings limit)
 RLAPI void TextAppend(char *text, const char *append, int *position);                       // Append text at specific position and move cursor!
 RLAPI int TextFindIndex(const char *text, const char *find);                                // Find first text occurrence within a string
 RLAPI const char *TextToUpper(const char *text);                      // Get upper case version of provided string
 RLAPI const char *TextToLower(const char *text);                      // Get lower case version of provided string
 RLAPI const char *TextToPascal(const char *text);                     // Get Pascal case notation version of provided string
 RLAPI int TextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
+RLAPI unsigned int TextHash(const char *text);                        // Get text hash (FNV-1a, 32 bit)
+RLAPI unsigned int TextIntern(const char *text);                      // Intern text string, returns stable id (same text, same id; 0: NULL text)
+RLAPI const char *TextGetInterned(unsigned int id);                   // Get interned text string by id (stable pointer, valid until CloseWindow())
+RLAPI unsigned int TextGetInternedHash(unsigned int id);              // Get interned text string precomputed hash by id
 
 //------------------------------------------------------------------------------------
 // Basic 3d Shapes Drawing Functions (Module: models)
@@ -1448,30 +2258,94 @@ RLAPI void DrawGrid(int slices, float spacing);
 
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
+RLAPI int LoadModelAsync(const char *fileName);                                             // Load model from files asynchronously, returns request id (-1: failed)
+RLAPI Model GetModelAsync(int request);                                                     // Get async loaded model, request is released (empty if not ready)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
+RLAPI Model LoadModelBinary(const char *fileName);                                          // Load model from binary file (.rlm), vertex data uploaded from mapped file
+RLAPI bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName); // Export model (and animations) to binary file (.rlm), returns true on success
 RLAPI bool IsModelReady(Model model);                                                       // Check if a model is ready
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI OcclusionQuery LoadOcclusionQuery(void);                                              // Load occlusion query for a drawn model (visible until tested)
+RLAPI void UnloadOcclusionQuery(OcclusionQuery query);                                      // Unload occlusion query from GPU memory
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);          // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
+RLAPI void DrawModelLOD(Model model, Vector3 position, float scale, Color tint);            // Draw a model with meshes LOD levels selected by projected size (current camera)
+RLAPI void DrawModelOccluded(Model model, OcclusionQuery *query, Vector3 position, float scale, Color tint); // Draw a model if its bounding box was not occluded (previous frames occlusion query)
+RLAPI void DrawModelInstanced(Model model, const Matrix *transforms, const Color *colors, int instances); // Draw multiple model instances with different transforms and tints (colors can be NULL)
+RLAPI void DrawModelInstancedBuffer(Model model, MeshInstanceBuffer buffer, int instances);  // Draw multiple model instances with transforms, colors and attributes stored in GPU buffer
+RLAPI void SetModelFrustumCulling(bool enabled);                                            // Set model meshes frustum culling on drawing (disabled by default)
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                   // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint);   // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint); // Draw a billboard texture defined by source
 RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint); // Draw a billboard texture defined by source and rotation
+RLAPI void DrawBillboardsBatch(Camera camera, Texture2D texture, const BillboardInstance *items, int count); // Draw billboards batch facing camera (quads expanded on GPU if supported)
+RLAPI void SetBillboardsBatchSorting(bool enabled);                                         // Set billboards batch back-to-front sorting (disabled by default)
+
+// Particle systems functions
+RLAPI ParticleSystem LoadParticleSystem(int maxParticles);                                  // Load particle system, simulated on GPU if compute shaders supported (OpenGL 4.3)
+RLAPI bool IsParticleSystemReady(ParticleSystem system);                                    // Check if a particle system is ready
+RLAPI void UnloadParticleSystem(ParticleSystem system);                                     // Unload particle system (GPU buffers and shaders or CPU particles)
+RLAPI void UpdateParticleSystem(ParticleSystem system, ParticleEmitter emitter, float deltaTime); // Update particle system: spawn emitter particles, move particles and remove expired ones
+RLAPI void DrawParticleSystem(ParticleSystem system, Camera camera, Texture2D texture);     // Draw particle system particles as billboards facing camera
+RLAPI int GetParticleCount(ParticleSystem system);                                          // Get particle system particles alive (GPU simulated: read back from GPU, stalls pipeline)
+
+// Shadow mapping functions
+RLAPI ShadowMap LoadShadowMap(int size, int cascades, float distance);                      // Load directional light shadow map, cascades cover distance from camera
+RLAPI ShadowMap LoadShadowMapSpot(int size, float angle, float range);                      // Load spot light shadow map (cone angle in degrees)
+RLAPI bool IsShadowMapReady(ShadowMap shadow);                                              // Check if a shadow map is ready
+RLAPI void UnloadShadowMap(ShadowMap shadow);                                               // Unload shadow map from GPU memory (VRAM)
+RLAPI void UpdateShadowMap(ShadowMap *shadow, Camera camera, Vector3 position, Vector3 direction); // Update shadow map cascades for camera and light (position used by spot lights)
+RLAPI void InvalidateShadowMap(ShadowMap *shadow);                                          // Invalidate shadow map static casters cache (static casters changed)
+RLAPI bool BeginShadowMode(ShadowMap *shadow, int cascade, bool staticCasters);             // Begin drawing shadow casters into cascade, static casters pass returns false if cache is valid
+RLAPI void EndShadowMode(void);                                                             // End drawing shadow casters
+RLAPI void SetShaderShadowMap(Shader shader, ShadowMap shadow);                             // Set shader shadow map uniforms and bind shadow depth texture
+
+// Clustered lighting functions
+RLAPI LightClusters LoadLightClusters(int maxLights);                                      // Load light clusters for clustered forward lighting (requires OpenGL 3.3)
+RLAPI bool IsLightClustersReady(LightClusters clusters);                                    // Check if light clusters are ready
+RLAPI void UnloadLightClusters(LightClusters clusters);                                     // Unload light clusters from CPU and GPU memory
+RLAPI void UpdateLightClusters(LightClusters *clusters, Camera camera, const ClusterLight *lights, int count); // Update lights and bin them into camera view clusters (current render size)
+RLAPI Shader LoadShaderLightClusters(void);                                                 // Load standard material shader with clustered lighting (diffuse, specular, ambient)
+RLAPI void SetShaderLightClusters(Shader shader, LightClusters clusters);                   // Set shader light clusters uniforms and bind clusters textures
 
 // Mesh management functions
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
+RLAPI void UploadMeshPacked(Mesh *mesh, bool dynamic, unsigned int flags);                  // Upload mesh vertex data in GPU with packed attributes (MeshPackFlags), uploaded meshes are uploaded again
+RLAPI Matrix GetMeshPackedTransform(Mesh mesh);                                             // Get mesh packed positions dequantization transform (identity if positions not packed)
+RLAPI void ReleaseMeshData(Mesh *mesh, unsigned int keepFlags);                             // Release mesh CPU vertex data not required after upload, attributes in keepFlags are kept (MeshDataFlags)
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
+RLAPI void UpdateMeshVertices(Mesh *mesh, int first, int count, const Vector3 *vertices);   // Update mesh vertex positions range (data NULL: CPU data already updated), dynamic meshes upload on draw
+RLAPI void UpdateMeshNormals(Mesh *mesh, int first, int count, const Vector3 *normals);     // Update mesh vertex normals range
+RLAPI void UpdateMeshTexcoords(Mesh *mesh, int first, int count, const Vector2 *texcoords); // Update mesh vertex texture coordinates range
+RLAPI void UpdateMeshColors(Mesh *mesh, int first, int count, const Color *colors);         // Update mesh vertex colors range
+RLAPI void UpdateMeshIndices(Mesh *mesh, int first, int count, const unsigned short *indices); // Update mesh indices range (indexed meshes)
+RLAPI void ResizeMesh(Mesh *mesh, int vertexCount, int triangleCount);                      // Resize mesh vertex data and triangles, GPU buffers grow as required (no upload again)
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
+RLAPI void BeginMeshQueue(void);                                                            // Begin mesh draws queue, DrawMesh() calls are queued until EndMeshQueue()
+RLAPI void EndMeshQueue(void);                                                              // End mesh draws queue, queued draws are sorted by state and submitted (instanced when possible)
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI MeshInstanceBuffer LoadMeshInstanceBuffer(const Matrix *transforms, int instances, bool dynamic); // Load mesh instances transforms buffer into GPU (transforms can be NULL)
+RLAPI void UpdateMeshInstanceBuffer(MeshInstanceBuffer buffer, const Matrix *transforms, int offset, int count); // Update mesh instances transforms buffer (partial update, offset and count in instances)
+RLAPI void UpdateMeshInstanceColors(MeshInstanceBuffer *buffer, const Color *colors, int offset, int count); // Update mesh instances colors (colors buffer loaded on first update)
+RLAPI void UpdateMeshInstanceAttribute(MeshInstanceBuffer *buffer, int attribLoc, const float *values, int components, int offset, int count); // Update mesh instances custom attribute (buffer loaded on first update, max 4 attributes)
+RLAPI void UnloadMeshInstanceBuffer(MeshInstanceBuffer buffer);                             // Unload mesh instances buffers from GPU (transforms, colors and attributes)
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, MeshInstanceBuffer buffer, int instances); // Draw multiple mesh instances with material and transforms stored in GPU buffer
+RLAPI MeshInstanceCuller LoadMeshInstanceCuller(Mesh mesh, int maxInstances);                 // Load mesh instances GPU frustum culler (OpenGL 4.3)
+RLAPI void UnloadMeshInstanceCuller(MeshInstanceCuller culler);                             // Unload mesh instances GPU frustum culler
+RLAPI void CullMeshInstances(MeshInstanceCuller culler, MeshInstanceBuffer buffer, int instances); // Cull mesh instances against current camera frustum, visible instances are compacted on GPU
+RLAPI void DrawMeshInstancedCulled(Mesh mesh, Material material, MeshInstanceCuller culler); // Draw mesh instances visible after last CullMeshInstances() (indirect draw)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void OptimizeMesh(Mesh *mesh, unsigned int flags);                                    // Optimize mesh indices and vertices order for GPU rendering (MeshOptimizeFlags)
+RLAPI void GenMeshLODs(Mesh *mesh, int levels, float targetError);                          // Generate mesh LOD levels (simplified indices sharing mesh vertices), error relative to mesh size
+RLAPI void SetMeshMorphWeights(Mesh *mesh, const float *weights, int count);                // Set mesh morph targets weights (morphed on GPU if supported, on CPU otherwise)
 
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
@@ -1485,6 +2359,14 @@ RLAPI Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);
 RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                    // Generate trefoil knot mesh
 RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
+RLAPI void GenMeshes(Mesh *meshes, const MeshGenParams *params, int count);                 // Generate meshes shapes in parallel (jobs system), uploaded to GPU
+
+// Terrain management functions
+RLAPI Terrain LoadTerrain(Image heightmap, Vector3 size, int chunkSize, int lodCount);      // Load terrain from heightmap image, split in chunks of size (power of two) with LOD levels
+RLAPI void UnloadTerrain(Terrain terrain);                                                  // Unload terrain chunks meshes and heightmap data (waits for pending chunks)
+RLAPI void UpdateTerrain(Terrain *terrain, Vector3 viewPosition);                           // Update terrain chunks LOD levels by view distance (terrain space), meshes generated on loader thread
+RLAPI void DrawTerrain(Terrain terrain, Material material, Matrix transform);               // Draw terrain loaded chunks visible in view frustum
+RLAPI float GetTerrainHeight(Terrain terrain, float x, float z);                           // Get terrain height at position (terrain space, bilinear)
 
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
@@ -1497,18 +2379,31 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount);   // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation bones matrices (GPU skinning)
+RLAPI void UpdateModelAnimationEx(Model model, const ModelAnimation *anims, const float *weights, int count, float time); // Update model animations blended pose at time (interpolated frames)
+RLAPI void CompressModelAnimation(ModelAnimation *anim);                                    // Compress animation poses (quantized, constant tracks removed), framePoses are unloaded
+RLAPI void GetModelAnimationPose(ModelAnimation anim, int frame, Transform *pose);          // Get animation frame pose (boneCount transforms), decompressed if required
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, unsigned int count);           // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI Matrix GetModelBoneTransform(Model model, int boneId);                                // Get model bone transform for current pose (model transform applied), bones attachments
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
 RLAPI bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);                                 // Check collision between two bounding boxes
 RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);                  // Check collision between box and sphere
+RLAPI int CheckCollisionBoxesBatch(BoundingBox box, const BoundingBox *boxes, int count, bool *results); // Check collision between box and boxes array, returns colliding boxes count
+RLAPI bool CheckFrustumBox(Frustum frustum, BoundingBox box);                                       // Check if box is inside or intersects frustum
+RLAPI bool CheckFrustumSphere(Frustum frustum, Vector3 center, float radius);                       // Check if sphere is inside or intersects frustum
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
+RLAPI RayCollision GetRayCollisionBoxes(Ray ray, const BoundingBox *boxes, int count, int *hitIndex);    // Get collision info between ray and boxes array (nearest hit box)
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI MeshBVH LoadMeshBVH(Mesh mesh);                                                               // Load mesh bounding volume hierarchy (SAH), ray picking acceleration
+RLAPI void UnloadMeshBVH(MeshBVH bvh);                                                              // Unload mesh bounding volume hierarchy
+RLAPI RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform);                  // Get collision info between ray and mesh bounding volume hierarchy
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
+RLAPI RayCollision GetRayCollisionTriangles(Ray ray, const Vector3 *vertices, int triangleCount, int *hitIndex); // Get collision info between ray and triangles array (3 vertices per triangle, nearest hit)
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
 //------------------------------------------------------------------------------------
@@ -1518,16 +2413,24 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(unsigned int sampleRate, unsigned int channels); // Initialize offline audio device, audio mixed on RenderAudioFrames() (no playback)
+RLAPI void RenderAudioFrames(float *frames, int frameCount);          // Render audio frames with offline device (interleaved float samples)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI double GetAudioTime(void);                                      // Get audio device time in seconds (device frames mixed), used to schedule sounds
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI bool IsWaveReady(Wave wave);                                    // Checks if wave data is ready
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
+RLAPI int LoadSoundAsync(const char *fileName);                       // Load sound from file asynchronously, returns request id (-1: failed)
+RLAPI Sound GetSoundAsync(int request);                               // Get async loaded sound, request is released (empty if not ready)
+RLAPI int LoadSoundsAsync(const char **fileNames, int count);        // Load sounds from files asynchronously, decoded in parallel on jobs system, returns request id (-1: failed)
+RLAPI int GetSoundsAsync(int request, Sound *sounds);                 // Get async loaded sounds, request is released, returns sounds count (0: not ready)
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI void SetSoundStorageDefault(int storage);                       // Set storage for new sounds (SoundStorage), compact storages are decoded on mixing
 RLAPI bool IsSoundReady(Sound sound);                                 // Checks if a sound is ready
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
@@ -1537,6 +2440,7 @@ RLAPI bool ExportWaveAsCode(Wave wave, const char *fileName);         // Export
 
 // Wave/Sound management functions
 RLAPI void PlaySound(Sound sound);                                    // Play a sound
+RLAPI void PlaySoundAt(Sound sound, double audioTime);               // Play a sound at audio device time (sample accurate), check GetAudioTime()
 RLAPI void StopSound(Sound sound);                                    // Stop playing a sound
 RLAPI void PauseSound(Sound sound);                                   // Pause a sound
 RLAPI void ResumeSound(Sound sound);                                  // Resume a paused sound
@@ -1544,6 +2448,19 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI int PlaySoundInstance(Sound sound, int priority);               // Play a sound instance on a pooled voice sharing sound data, returns instance id (-1: no voice available)
+RLAPI void StopSoundInstance(int instance);                           // Stop a sound instance
+RLAPI bool IsSoundInstancePlaying(int instance);                      // Check if a sound instance is currently playing
+RLAPI void SetSoundInstanceVolume(int instance, float volume);        // Set volume for a sound instance (1.0 is max level)
+RLAPI void SetSoundInstancePitch(int instance, float pitch);          // Set pitch for a sound instance (1.0 is base level)
+RLAPI void SetSoundInstancePan(int instance, float pan);              // Set pan for a sound instance (0.5 is center)
+
+// Spatial audio functions
+RLAPI void UpdateAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Update audio listener, spatial sounds are updated on audio thread (once per frame)
+RLAPI void SetAudioDistanceModel(int model, float refDistance, float maxDistance, float rolloff); // Set spatial sounds distance model (AudioDistanceModel), applied on next listener update
+RLAPI void SetAudioDopplerFactor(float factor, float speedOfSound);  // Set spatial sounds doppler factor (0.0f: disabled) and speed of sound, applied on next listener update
+RLAPI void SetSoundPositions(const Sound *sounds, const Vector3 *positions, const Vector3 *velocities, int count); // Set sounds positions and velocities (optional), sounds become spatial (single batched update)
+RLAPI void SetSoundInstancePositions(const int *instances, const Vector3 *positions, const Vector3 *velocities, int count); // Set sound instances positions and velocities (optional), instances become spatial
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1583,6 +2500,8 @@ RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set vol
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
 RLAPI void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (0.5 is centered)
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
+RLAPI void SetAudioStreamBufferCountDefault(int count, int maxCount); // Default sub-buffers count for new audio streams, grows up to maxCount on repeated underruns
+RLAPI AudioStreamStats GetAudioStreamStats(AudioStream stream);      // Get audio stream buffering stats (sub-buffers, underruns, overruns)
 RLAPI void SetAudioStreamCallback(AudioStream stream, AudioCallback callback);  // Audio thread callback to request new data
 
 RLAPI void AttachAudioStreamProcessor(AudioStream stream, AudioCallback processor); // Attach audio stream processor to stream
@@ -1591,6 +2510,27 @@ RLAPI void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processo
 RLAPI void AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline
 RLAPI void DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
 
+// AudioBus management functions
+RLAPI AudioBus LoadAudioBus(void);                                    // Load audio bus, routed sounds and streams are mixed together and processed once
+RLAPI bool IsAudioBusReady(AudioBus bus);                             // Checks if an audio bus is ready
+RLAPI void UnloadAudioBus(AudioBus bus);                              // Unload audio bus, routed sounds and streams are mixed into output
+RLAPI void SetAudioBusVolume(AudioBus bus, float volume);             // Set volume for an audio bus (1.0 is max level)
+RLAPI void SetAudioBusFilter(AudioBus bus, int type, float frequency, float resonance); // Set audio bus filter (AudioFilterType), resonance is Q factor (0.707f: no resonance)
+RLAPI void SetAudioBusReverb(AudioBus bus, float roomSize, float damping, float mix);  // Set audio bus reverb, mix is wet level (0.0f: reverb disabled)
+RLAPI void AttachAudioBusProcessor(AudioBus bus, AudioCallback processor); // Attach audio processor to bus, runs once over the bus mix (stereo float frames)
+RLAPI void DetachAudioBusProcessor(AudioBus bus, AudioCallback processor); // Detach audio processor from bus
+RLAPI void SetAudioStreamBus(AudioStream stream, AudioBus bus);       // Route audio stream to bus (empty bus: output)
+RLAPI void SetSoundBus(Sound sound, AudioBus bus);                    // Route sound to bus (empty bus: output), instances use sound bus
+
+// AudioCaptureStream management functions
+RLAPI AudioCaptureStream LoadAudioCaptureStream(unsigned int sampleRate, unsigned int channels); // Load audio capture stream from default input device, capture starts right away (0: device default)
+RLAPI bool IsAudioCaptureStreamReady(AudioCaptureStream stream);      // Checks if an audio capture stream is ready
+RLAPI void UnloadAudioCaptureStream(AudioCaptureStream stream);       // Unload audio capture stream, capture device is stopped
+RLAPI int GetAudioCaptureStreamAvailable(AudioCaptureStream stream);  // Get audio capture stream frames available to read
+RLAPI int ReadAudioCaptureStream(AudioCaptureStream stream, float *frames, int frameCount); // Read captured frames (interleaved float samples), returns frames read (non-blocking)
+RLAPI void AttachAudioCaptureProcessor(AudioCaptureStream stream, AudioCallback processor); // Attach audio processor to capture stream, runs on captured frames
+RLAPI void DetachAudioCaptureProcessor(AudioCaptureStream stream, AudioCallback processor); // Detach audio processor from capture stream
+
 #if defined(__cplusplus)
 }
 #endif
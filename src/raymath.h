@@ -13,11 +13,18 @@
 *       Define static inline functions code, so #include header suffices for use.
 *       This may use up lots of memory.
 *
+*   #define RAYMATH_SIMD
+*       Use SSE/NEON/WASM SIMD instructions for the hot matrix/quaternion functions
+*       (MatrixMultiply(), MatrixInvert(), MatrixTranspose(), Vector3Transform()...),
+*       scalar code is used if no supported instruction set is available.
+*       NOTE: Results match scalar code, unless FMA instructions are enabled at compile time
+*
 *   CONVENTIONS:
 *
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
-*     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Functions input parameters are always received by value (2 unavoidable exceptions),
+*       except *Array() functions, working on caller provided arrays for batched processing
 *     - Functions use always a "result" variable for return
 *     - Functions are always defined inline
 *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
@@ -70,6 +77,26 @@
     #endif
 #endif
 
+// SIMD instruction set selection, RAYMATH_SIMD is undefined if no supported instruction set available
+#if defined(RAYMATH_SIMD)
+    #if defined(__wasm_simd128__)
+        #define RAYMATH_SIMD_WASM
+        #include <wasm_simd128.h>           // Required for: WebAssembly SIMD intrinsics
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RAYMATH_SIMD_SSE
+        #if defined(__FMA__)
+            #include <immintrin.h>          // Required for: SSE and FMA intrinsics
+        #else
+            #include <xmmintrin.h>          // Required for: SSE intrinsics
+        #endif
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(_MSC_VER)
+        #define RAYMATH_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #else
+        #undef RAYMATH_SIMD
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -99,6 +126,68 @@
     #define Vector3ToFloat(vec) (Vector3ToFloatV(vec).v)
 #endif
 
+// SIMD 4-wide float helpers, used by RAYMATH_SIMD functions implementation
+// NOTE: Matrix memory layout is { m0, m4, m8, m12 }, { m1, m5, m9, m13 }... so every
+// 4-floats load gets one matrix row: { m[n], m[n + 4], m[n + 8], m[n + 12] }
+#if defined(RAYMATH_SIMD_SSE)
+    #define RM_FLOAT4                   __m128
+    #define RM_LOAD4(ptr)               _mm_loadu_ps(ptr)
+    #define RM_STORE4(ptr, v)           _mm_storeu_ps(ptr, v)
+    #define RM_SET1(x)                  _mm_set1_ps(x)
+    #define RM_SETR(x, y, z, w)         _mm_setr_ps(x, y, z, w)
+    #define RM_ADD(a, b)                _mm_add_ps(a, b)
+    #define RM_SUB(a, b)                _mm_sub_ps(a, b)
+    #define RM_MUL(a, b)                _mm_mul_ps(a, b)
+    #if defined(__FMA__)
+        #define RM_MADD(a, b, c)        _mm_fmadd_ps(a, b, c)
+    #else
+        #define RM_MADD(a, b, c)        _mm_add_ps(_mm_mul_ps(a, b), c)
+    #endif
+    #define RM_TRANSPOSE4(r0, r1, r2, r3) _MM_TRANSPOSE4_PS(r0, r1, r2, r3)
+#elif defined(RAYMATH_SIMD_NEON)
+    #define RM_FLOAT4                   float32x4_t
+    #define RM_LOAD4(ptr)               vld1q_f32(ptr)
+    #define RM_STORE4(ptr, v)           vst1q_f32(ptr, v)
+    #define RM_SET1(x)                  vdupq_n_f32(x)
+    #define RM_SETR(x, y, z, w)         ((float32x4_t){ x, y, z, w })
+    #define RM_ADD(a, b)                vaddq_f32(a, b)
+    #define RM_SUB(a, b)                vsubq_f32(a, b)
+    #define RM_MUL(a, b)                vmulq_f32(a, b)
+    #if defined(__aarch64__) && defined(__ARM_FEATURE_FMA)
+        #define RM_MADD(a, b, c)        vfmaq_f32(c, a, b)
+    #else
+        #define RM_MADD(a, b, c)        vaddq_f32(vmulq_f32(a, b), c)
+    #endif
+    #define RM_TRANSPOSE4(r0, r1, r2, r3) do { \
+        float32x4x2_t rmT01 = vtrnq_f32(r0, r1); \
+        float32x4x2_t rmT23 = vtrnq_f32(r2, r3); \
+        r0 = vcombine_f32(vget_low_f32(rmT01.val[0]), vget_low_f32(rmT23.val[0])); \
+        r1 = vcombine_f32(vget_low_f32(rmT01.val[1]), vget_low_f32(rmT23.val[1])); \
+        r2 = vcombine_f32(vget_high_f32(rmT01.val[0]), vget_high_f32(rmT23.val[0])); \
+        r3 = vcombine_f32(vget_high_f32(rmT01.val[1]), vget_high_f32(rmT23.val[1])); \
+    } while (0)
+#elif defined(RAYMATH_SIMD_WASM)
+    #define RM_FLOAT4                   v128_t
+    #define RM_LOAD4(ptr)               wasm_v128_load(ptr)
+    #define RM_STORE4(ptr, v)           wasm_v128_store(ptr, v)
+    #define RM_SET1(x)                  wasm_f32x4_splat(x)
+    #define RM_SETR(x, y, z, w)         wasm_f32x4_make(x, y, z, w)
+    #define RM_ADD(a, b)                wasm_f32x4_add(a, b)
+    #define RM_SUB(a, b)                wasm_f32x4_sub(a, b)
+    #define RM_MUL(a, b)                wasm_f32x4_mul(a, b)
+    #define RM_MADD(a, b, c)            wasm_f32x4_add(wasm_f32x4_mul(a, b), c)
+    #define RM_TRANSPOSE4(r0, r1, r2, r3) do { \
+        v128_t rmT0 = wasm_i32x4_shuffle(r0, r1, 0, 4, 1, 5); \
+        v128_t rmT1 = wasm_i32x4_shuffle(r2, r3, 0, 4, 1, 5); \
+        v128_t rmT2 = wasm_i32x4_shuffle(r0, r1, 2, 6, 3, 7); \
+        v128_t rmT3 = wasm_i32x4_shuffle(r2, r3, 2, 6, 3, 7); \
+        r0 = wasm_i32x4_shuffle(rmT0, rmT1, 0, 1, 4, 5); \
+        r1 = wasm_i32x4_shuffle(rmT0, rmT1, 2, 3, 6, 7); \
+        r2 = wasm_i32x4_shuffle(rmT2, rmT3, 0, 1, 4, 5); \
+        r3 = wasm_i32x4_shuffle(rmT2, rmT3, 2, 3, 6, 7); \
+    } while (0)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -400,6 +489,46 @@ RMAPI Vector2 Vector2Transform(Vector2 v, Matrix mat)
     return result;
 }
 
+// Transforms an array of Vector2 by a given Matrix
+// NOTE: out and in can point to the same array
+RMAPI void Vector2TransformArray(Vector2 *out, const Vector2 *in, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD)
+    // Matrix elements broadcast once, 4 points transformed at a time in SoA layout
+    RM_FLOAT4 m0 = RM_SET1(mat.m0), m1 = RM_SET1(mat.m1);
+    RM_FLOAT4 m4 = RM_SET1(mat.m4), m5 = RM_SET1(mat.m5);
+    RM_FLOAT4 m12 = RM_SET1(mat.m12), m13 = RM_SET1(mat.m13);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        RM_FLOAT4 x = RM_SETR(in[i].x, in[i + 1].x, in[i + 2].x, in[i + 3].x);
+        RM_FLOAT4 y = RM_SETR(in[i].y, in[i + 1].y, in[i + 2].y, in[i + 3].y);
+
+        float rx[4] = { 0 };
+        float ry[4] = { 0 };
+        RM_STORE4(rx, RM_ADD(RM_MADD(m4, y, RM_MUL(m0, x)), m12));
+        RM_STORE4(ry, RM_ADD(RM_MADD(m5, y, RM_MUL(m1, x)), m13));
+
+        for (int k = 0; k < 4; k++)
+        {
+            out[i + k].x = rx[k];
+            out[i + k].y = ry[k];
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = in[i].x;
+        float y = in[i].y;
+
+        out[i].x = mat.m0*x + mat.m4*y + mat.m12;
+        out[i].y = mat.m1*x + mat.m5*y + mat.m13;
+    }
+}
+
 // Calculate linear interpolation between two vectors
 RMAPI Vector2 Vector2Lerp(Vector2 v1, Vector2 v2, float amount)
 {
@@ -775,13 +904,73 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     float y = v.y;
     float z = v.z;
 
+#if defined(RAYMATH_SIMD)
+    const float *m = (const float *)&mat;
+    RM_FLOAT4 c0 = RM_LOAD4(m), c1 = RM_LOAD4(m + 4), c2 = RM_LOAD4(m + 8), c3 = RM_LOAD4(m + 12);
+    RM_TRANSPOSE4(c0, c1, c2, c3);      // Get matrix columns { m0, m1, m2, m3 }, { m4, m5, m6, m7 }...
+
+    float transformed[4] = { 0 };
+    RM_STORE4(transformed, RM_ADD(RM_MADD(RM_SET1(z), c2, RM_MADD(RM_SET1(y), c1, RM_MUL(RM_SET1(x), c0))), c3));
+
+    result.x = transformed[0];
+    result.y = transformed[1];
+    result.z = transformed[2];
+#else
     result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
     result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
     result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+#endif
 
     return result;
 }
 
+// Transforms an array of Vector3 by a given Matrix
+// NOTE: out and in can point to the same array
+RMAPI void Vector3TransformArray(Vector3 *out, const Vector3 *in, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD)
+    // Matrix elements broadcast once, 4 points transformed at a time in SoA layout
+    RM_FLOAT4 m0 = RM_SET1(mat.m0), m1 = RM_SET1(mat.m1), m2 = RM_SET1(mat.m2);
+    RM_FLOAT4 m4 = RM_SET1(mat.m4), m5 = RM_SET1(mat.m5), m6 = RM_SET1(mat.m6);
+    RM_FLOAT4 m8 = RM_SET1(mat.m8), m9 = RM_SET1(mat.m9), m10 = RM_SET1(mat.m10);
+    RM_FLOAT4 m12 = RM_SET1(mat.m12), m13 = RM_SET1(mat.m13), m14 = RM_SET1(mat.m14);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        RM_FLOAT4 x = RM_SETR(in[i].x, in[i + 1].x, in[i + 2].x, in[i + 3].x);
+        RM_FLOAT4 y = RM_SETR(in[i].y, in[i + 1].y, in[i + 2].y, in[i + 3].y);
+        RM_FLOAT4 z = RM_SETR(in[i].z, in[i + 1].z, in[i + 2].z, in[i + 3].z);
+
+        float rx[4] = { 0 };
+        float ry[4] = { 0 };
+        float rz[4] = { 0 };
+        RM_STORE4(rx, RM_ADD(RM_MADD(m8, z, RM_MADD(m4, y, RM_MUL(m0, x))), m12));
+        RM_STORE4(ry, RM_ADD(RM_MADD(m9, z, RM_MADD(m5, y, RM_MUL(m1, x))), m13));
+        RM_STORE4(rz, RM_ADD(RM_MADD(m10, z, RM_MADD(m6, y, RM_MUL(m2, x))), m14));
+
+        for (int k = 0; k < 4; k++)
+        {
+            out[i + k].x = rx[k];
+            out[i + k].y = ry[k];
+            out[i + k].z = rz[k];
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = in[i].x;
+        float y = in[i].y;
+        float z = in[i].z;
+
+        out[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        out[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        out[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
 // Transform a vector by quaternion rotation
 RMAPI Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -1144,6 +1333,17 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    const float *m = (const float *)&mat;
+    float *r = (float *)&result;
+    RM_FLOAT4 c0 = RM_LOAD4(m), c1 = RM_LOAD4(m + 4), c2 = RM_LOAD4(m + 8), c3 = RM_LOAD4(m + 12);
+    RM_TRANSPOSE4(c0, c1, c2, c3);
+
+    RM_STORE4(r, c0);
+    RM_STORE4(r + 4, c1);
+    RM_STORE4(r + 8, c2);
+    RM_STORE4(r + 12, c3);
+#else
     result.m0 = mat.m0;
     result.m1 = mat.m4;
     result.m2 = mat.m8;
@@ -1160,6 +1360,7 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
     result.m13 = mat.m7;
     result.m14 = mat.m11;
     result.m15 = mat.m15;
+#endif
 
     return result;
 }
@@ -1175,6 +1376,37 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     float a20 = mat.m8, a21 = mat.m9, a22 = mat.m10, a23 = mat.m11;
     float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
 
+#if defined(RAYMATH_SIMD)
+    // Same arithmetic than scalar code, 2x2 determinants and cofactors computed 4 at a time
+    float b[12] = { 0 };
+    RM_STORE4(b, RM_SUB(RM_MUL(RM_SETR(a00, a00, a00, a01), RM_SETR(a11, a12, a13, a12)),
+                        RM_MUL(RM_SETR(a01, a02, a03, a02), RM_SETR(a10, a10, a10, a11))));
+    RM_STORE4(b + 4, RM_SUB(RM_MUL(RM_SETR(a01, a02, a20, a20), RM_SETR(a13, a13, a31, a32)),
+                            RM_MUL(RM_SETR(a03, a03, a21, a22), RM_SETR(a11, a12, a30, a30))));
+    RM_STORE4(b + 8, RM_SUB(RM_MUL(RM_SETR(a20, a21, a21, a22), RM_SETR(a33, a32, a33, a33)),
+                            RM_MUL(RM_SETR(a23, a22, a23, a23), RM_SETR(a30, a31, a31, a32))));
+
+    float invDet = 1.0f/(b[0]*b[11] - b[1]*b[10] + b[2]*b[9] + b[3]*b[8] - b[4]*b[7] + b[5]*b[6]);
+
+    // NOTE: Every stored row is { m[n], m[n + 4], m[n + 8], m[n + 12] },
+    // cofactors signs alternate, negation is applied with invDet
+    RM_FLOAT4 q = RM_SETR(b[11], b[11], b[10], b[9]);
+    RM_FLOAT4 t = RM_SETR(b[10], b[8], b[8], b[7]);
+    RM_FLOAT4 u = RM_SETR(b[9], b[7], b[6], b[6]);
+    RM_FLOAT4 signPos = RM_SETR(invDet, -invDet, invDet, -invDet);
+    RM_FLOAT4 signNeg = RM_SETR(-invDet, invDet, -invDet, invDet);
+    float *r = (float *)&result;
+
+    RM_STORE4(r, RM_MUL(RM_ADD(RM_SUB(RM_MUL(RM_SETR(a11, a10, a10, a10), q), RM_MUL(RM_SETR(a12, a12, a11, a11), t)), RM_MUL(RM_SETR(a13, a13, a13, a12), u)), signPos));
+    RM_STORE4(r + 4, RM_MUL(RM_ADD(RM_SUB(RM_MUL(RM_SETR(a01, a00, a00, a00), q), RM_MUL(RM_SETR(a02, a02, a01, a01), t)), RM_MUL(RM_SETR(a03, a03, a03, a02), u)), signNeg));
+
+    q = RM_SETR(b[5], b[5], b[4], b[3]);
+    t = RM_SETR(b[4], b[2], b[2], b[1]);
+    u = RM_SETR(b[3], b[1], b[0], b[0]);
+
+    RM_STORE4(r + 8, RM_MUL(RM_ADD(RM_SUB(RM_MUL(RM_SETR(a31, a30, a30, a30), q), RM_MUL(RM_SETR(a32, a32, a31, a31), t)), RM_MUL(RM_SETR(a33, a33, a33, a32), u)), signPos));
+    RM_STORE4(r + 12, RM_MUL(RM_ADD(RM_SUB(RM_MUL(RM_SETR(a21, a20, a20, a20), q), RM_MUL(RM_SETR(a22, a22, a21, a21), t)), RM_MUL(RM_SETR(a23, a23, a23, a22), u)), signNeg));
+#else
     float b00 = a00*a11 - a01*a10;
     float b01 = a00*a12 - a02*a10;
     float b02 = a00*a13 - a03*a10;
@@ -1207,6 +1439,7 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1227,6 +1460,13 @@ RMAPI Matrix MatrixAdd(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    const float *a = (const float *)&left;
+    const float *b = (const float *)&right;
+    float *r = (float *)&result;
+
+    for (int i = 0; i < 16; i += 4) RM_STORE4(r + i, RM_ADD(RM_LOAD4(a + i), RM_LOAD4(b + i)));
+#else
     result.m0 = left.m0 + right.m0;
     result.m1 = left.m1 + right.m1;
     result.m2 = left.m2 + right.m2;
@@ -1243,6 +1483,7 @@ RMAPI Matrix MatrixAdd(Matrix left, Matrix right)
     result.m13 = left.m13 + right.m13;
     result.m14 = left.m14 + right.m14;
     result.m15 = left.m15 + right.m15;
+#endif
 
     return result;
 }
@@ -1252,6 +1493,13 @@ RMAPI Matrix MatrixSubtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    const float *a = (const float *)&left;
+    const float *b = (const float *)&right;
+    float *r = (float *)&result;
+
+    for (int i = 0; i < 16; i += 4) RM_STORE4(r + i, RM_SUB(RM_LOAD4(a + i), RM_LOAD4(b + i)));
+#else
     result.m0 = left.m0 - right.m0;
     result.m1 = left.m1 - right.m1;
     result.m2 = left.m2 - right.m2;
@@ -1268,6 +1516,7 @@ RMAPI Matrix MatrixSubtract(Matrix left, Matrix right)
     result.m13 = left.m13 - right.m13;
     result.m14 = left.m14 - right.m14;
     result.m15 = left.m15 - right.m15;
+#endif
 
     return result;
 }
@@ -1278,6 +1527,17 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    // NOTE: Every result row is a linear combination of left rows, 16 multiply-adds
+    const float *a = (const float *)&left;
+    float *r = (float *)&result;
+    RM_FLOAT4 c0 = RM_LOAD4(a), c1 = RM_LOAD4(a + 4), c2 = RM_LOAD4(a + 8), c3 = RM_LOAD4(a + 12);
+
+    RM_STORE4(r, RM_MADD(c3, RM_SET1(right.m12), RM_MADD(c2, RM_SET1(right.m8), RM_MADD(c1, RM_SET1(right.m4), RM_MUL(c0, RM_SET1(right.m0))))));
+    RM_STORE4(r + 4, RM_MADD(c3, RM_SET1(right.m13), RM_MADD(c2, RM_SET1(right.m9), RM_MADD(c1, RM_SET1(right.m5), RM_MUL(c0, RM_SET1(right.m1))))));
+    RM_STORE4(r + 8, RM_MADD(c3, RM_SET1(right.m14), RM_MADD(c2, RM_SET1(right.m10), RM_MADD(c1, RM_SET1(right.m6), RM_MUL(c0, RM_SET1(right.m2))))));
+    RM_STORE4(r + 12, RM_MADD(c3, RM_SET1(right.m15), RM_MADD(c2, RM_SET1(right.m11), RM_MADD(c1, RM_SET1(right.m7), RM_MUL(c0, RM_SET1(right.m3))))));
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1294,10 +1554,61 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
 
+// Get an array of matrix multiplications by the same right matrix: out[i] = MatrixMultiply(left[i], right)
+// NOTE: out and left can point to the same array
+RMAPI void MatrixMultiplyArray(Matrix *out, const Matrix *left, int count, Matrix right)
+{
+#if defined(RAYMATH_SIMD)
+    // Right matrix elements broadcast once, 16 multiply-adds per matrix
+    RM_FLOAT4 r0 = RM_SET1(right.m0), r1 = RM_SET1(right.m1), r2 = RM_SET1(right.m2), r3 = RM_SET1(right.m3);
+    RM_FLOAT4 r4 = RM_SET1(right.m4), r5 = RM_SET1(right.m5), r6 = RM_SET1(right.m6), r7 = RM_SET1(right.m7);
+    RM_FLOAT4 r8 = RM_SET1(right.m8), r9 = RM_SET1(right.m9), r10 = RM_SET1(right.m10), r11 = RM_SET1(right.m11);
+    RM_FLOAT4 r12 = RM_SET1(right.m12), r13 = RM_SET1(right.m13), r14 = RM_SET1(right.m14), r15 = RM_SET1(right.m15);
+
+    for (int i = 0; i < count; i++)
+    {
+        const float *a = (const float *)&left[i];
+        float *r = (float *)&out[i];
+        RM_FLOAT4 c0 = RM_LOAD4(a), c1 = RM_LOAD4(a + 4), c2 = RM_LOAD4(a + 8), c3 = RM_LOAD4(a + 12);
+
+        RM_STORE4(r, RM_MADD(c3, r12, RM_MADD(c2, r8, RM_MADD(c1, r4, RM_MUL(c0, r0)))));
+        RM_STORE4(r + 4, RM_MADD(c3, r13, RM_MADD(c2, r9, RM_MADD(c1, r5, RM_MUL(c0, r1)))));
+        RM_STORE4(r + 8, RM_MADD(c3, r14, RM_MADD(c2, r10, RM_MADD(c1, r6, RM_MUL(c0, r2)))));
+        RM_STORE4(r + 12, RM_MADD(c3, r15, RM_MADD(c2, r11, RM_MADD(c1, r7, RM_MUL(c0, r3)))));
+    }
+#else
+    for (int i = 0; i < count; i++)
+    {
+        Matrix l = left[i];
+        Matrix result = { 0 };
+
+        result.m0 = l.m0*right.m0 + l.m1*right.m4 + l.m2*right.m8 + l.m3*right.m12;
+        result.m1 = l.m0*right.m1 + l.m1*right.m5 + l.m2*right.m9 + l.m3*right.m13;
+        result.m2 = l.m0*right.m2 + l.m1*right.m6 + l.m2*right.m10 + l.m3*right.m14;
+        result.m3 = l.m0*right.m3 + l.m1*right.m7 + l.m2*right.m11 + l.m3*right.m15;
+        result.m4 = l.m4*right.m0 + l.m5*right.m4 + l.m6*right.m8 + l.m7*right.m12;
+        result.m5 = l.m4*right.m1 + l.m5*right.m5 + l.m6*right.m9 + l.m7*right.m13;
+        result.m6 = l.m4*right.m2 + l.m5*right.m6 + l.m6*right.m10 + l.m7*right.m14;
+        result.m7 = l.m4*right.m3 + l.m5*right.m7 + l.m6*right.m11 + l.m7*right.m15;
+        result.m8 = l.m8*right.m0 + l.m9*right.m4 + l.m10*right.m8 + l.m11*right.m12;
+        result.m9 = l.m8*right.m1 + l.m9*right.m5 + l.m10*right.m9 + l.m11*right.m13;
+        result.m10 = l.m8*right.m2 + l.m9*right.m6 + l.m10*right.m10 + l.m11*right.m14;
+        result.m11 = l.m8*right.m3 + l.m9*right.m7 + l.m10*right.m11 + l.m11*right.m15;
+        result.m12 = l.m12*right.m0 + l.m13*right.m4 + l.m14*right.m8 + l.m15*right.m12;
+        result.m13 = l.m12*right.m1 + l.m13*right.m5 + l.m14*right.m9 + l.m15*right.m13;
+        result.m14 = l.m12*right.m2 + l.m13*right.m6 + l.m14*right.m10 + l.m15*right.m14;
+        result.m15 = l.m12*right.m3 + l.m13*right.m7 + l.m14*right.m11 + l.m15*right.m15;
+
+        out[i] = result;
+    }
+#endif
+}
+
 // Get translation matrix
 RMAPI Matrix MatrixTranslate(float x, float y, float z)
 {
@@ -1758,10 +2069,18 @@ RMAPI Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2)
     float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
     float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
 
+#if defined(RAYMATH_SIMD)
+    RM_FLOAT4 v = RM_MUL(RM_SETR(qax, qay, qaz, qaw), RM_SET1(qbw));
+    v = RM_ADD(v, RM_MUL(RM_SETR(qaw, qaw, qaw, -qax), RM_SETR(qbx, qby, qbz, qbx)));
+    v = RM_ADD(v, RM_MUL(RM_SETR(qay, qaz, qax, -qay), RM_SETR(qbz, qbx, qby, qby)));
+    v = RM_SUB(v, RM_MUL(RM_SETR(qaz, qax, qay, qaz), RM_SETR(qby, qbz, qbx, qbz)));
+    RM_STORE4(&result.x, v);
+#else
     result.x = qax*qbw + qaw*qbx + qay*qbz - qaz*qby;
     result.y = qay*qbw + qaw*qby + qaz*qbx - qax*qbz;
     result.z = qaz*qbw + qaw*qbz + qax*qby - qay*qbx;
     result.w = qaw*qbw - qax*qbx - qay*qby - qaz*qbz;
+#endif
 
     return result;
 }
@@ -1867,6 +2186,80 @@ RMAPI Quaternion QuaternionSlerp(Quaternion q1, Quaternion q2, float amount)
     return result;
 }
 
+// Calculate slerp-optimized interpolation between two arrays of quaternions: out[i] = QuaternionSlerp(q1[i], q2[i], amount)
+// NOTE: Every case is reduced to a weighted sum of q1 and q2, normalized for the nlerp case
+RMAPI void QuaternionSlerpArray(Quaternion *out, const Quaternion *q1, const Quaternion *q2, int count, float amount)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion qa = q1[i];
+        Quaternion qb = q2[i];
+
+        float cosHalfTheta = qa.x*qb.x + qa.y*qb.y + qa.z*qb.z + qa.w*qb.w;
+        float ratioA = 1.0f;
+        float ratioB = 0.0f;
+        float signB = 1.0f;     // Opposite hemisphere quaternions: q2 is negated through its weight
+        int normalize = 0;
+
+        if (cosHalfTheta < 0)
+        {
+            signB = -1.0f;
+            cosHalfTheta = -cosHalfTheta;
+        }
+
+        if (fabsf(cosHalfTheta) >= 1.0f) { }
+        else if (cosHalfTheta > 0.95f)
+        {
+            ratioA = 1.0f - amount;
+            ratioB = amount;
+            normalize = 1;
+        }
+        else
+        {
+            float halfTheta = acosf(cosHalfTheta);
+            float sinHalfTheta = sqrtf(1.0f - cosHalfTheta*cosHalfTheta);
+
+            if (fabsf(sinHalfTheta) < 0.001f)
+            {
+                ratioA = 0.5f;
+                ratioB = 0.5f;
+            }
+            else
+            {
+                ratioA = sinf((1 - amount)*halfTheta)/sinHalfTheta;
+                ratioB = sinf(amount*halfTheta)/sinHalfTheta;
+            }
+        }
+
+        ratioB *= signB;
+
+        Quaternion result = { 0 };
+
+#if defined(RAYMATH_SIMD)
+        RM_STORE4(&result.x, RM_MADD(RM_LOAD4(&qb.x), RM_SET1(ratioB), RM_MUL(RM_LOAD4(&qa.x), RM_SET1(ratioA))));
+#else
+        result.x = qa.x*ratioA + qb.x*ratioB;
+        result.y = qa.y*ratioA + qb.y*ratioB;
+        result.z = qa.z*ratioA + qb.z*ratioB;
+        result.w = qa.w*ratioA + qb.w*ratioB;
+#endif
+
+        if (normalize)
+        {
+            float length = sqrtf(result.x*result.x + result.y*result.y + result.z*result.z + result.w*result.w);
+            if (length == 0.0f) length = 1.0f;
+            float ilength = 1.0f/length;
+
+            result.x *= ilength;
+            result.y *= ilength;
+            result.z *= ilength;
+            result.w *= ilength;
+        }
+
+        out[i] = result;
+    }
+}
+
 // Calculate quaternion based on the rotation from one vector to another
 RMAPI Quaternion QuaternionFromVector3ToVector3(Vector3 from, Vector3 to)
 {
@@ -11,6 +11,7 @@
 *       - PLATFORM_RPI:     Raspberry Pi 0,1,2,3 (Raspbian, native mode)
 *       - PLATFORM_DRM:     Linux native mode, including Raspberry Pi 4 with V3D fkms driver
 *       - PLATFORM_WEB:     HTML5 with WebAssembly
+*       - PLATFORM_HEADLESS: Linux offscreen rendering (EGL surfaceless/pbuffer), no display required
 *
 *   CONFIGURATION:
 *
@@ -36,6 +37,11 @@
 *       Windowing and input system configured for HTML5 (run on browser), code converted from C to asm.js
 *       using emscripten compiler. OpenGL ES 2.0 required for direct translation to WebGL equivalent code.
 *
+*   #define PLATFORM_HEADLESS
+*       No window or input system, graphic device is managed by EGL without a display connection
+*       (EGL_MESA_platform_surfaceless if available) and rendering is done into an offscreen framebuffer,
+*       frame loop is not throttled (no vsync, target FPS ignored), intended for benchmarks and CI runs
+*
 *   #define SUPPORT_DEFAULT_FONT (default)
 *       Default font is loaded on window initialization to be available for the user to render simple text.
 *       NOTE: If enabled, uses external module functions to load default raylib font (module: text)
@@ -62,6 +68,7 @@
 *
 *   #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 *       Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
+*       NOTE: Busy-wait time is limited to the measured system sleep overshoot, calibrated on InitTimer() and every wait
 *
 *   #define SUPPORT_EVENTS_WAITING
 *       Wait for events passively (sleeping while no events) instead of polling them actively every frame
@@ -71,12 +78,19 @@
 *
 *   #define SUPPORT_GIF_RECORDING
 *       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*       NOTE: Frames are encoded on async loader thread, recording framerate set with SetGifRecordingFramerate()
 *
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
 *       provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
 *       for linkage
 *
+*   #define SUPPORT_PROFILER
+*       Profiler module is included (rprof.h), named CPU scopes are recorded per thread and exported as Chrome trace JSON
+*
+*   #define SUPPORT_FRAME_TIME_STATS
+*       Support frame time statistics (percentiles over a frames window) and per-frame times CSV export
+*
 *   #define SUPPORT_EVENTS_AUTOMATION
 *       Support automatic generated events, loading and recording of those events when required
 *
@@ -115,11 +129,27 @@
     #include "config.h"             // Defines module configuration flags
 #endif
 
+#define MEMORY_MODULE MEMORY_MODULE_CORE    // Memory tracking module (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"                  // Required for: TRACELOG() macros
 
+#if defined(SUPPORT_PROFILER)
+    #define PROFILER_IMPLEMENTATION
+    #include "rprof.h"              // Profiler functionality
+
+    #define RL_PROFILE_BEGIN(name) PROFILE_BEGIN(name)
+    #define RL_PROFILE_END() PROFILE_END()
+#endif
+
+#undef MEMORY_MODULE
+#define MEMORY_MODULE MEMORY_MODULE_RLGL    // Memory tracking module: rlgl CPU buffers
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
+#undef MEMORY_MODULE
+#define MEMORY_MODULE MEMORY_MODULE_CORE
 
+#if defined(SUPPORT_SIMD_RAYMATH)
+    #define RAYMATH_SIMD            // Use SIMD instructions for raymath hot functions
+#endif
 #define RAYMATH_IMPLEMENTATION      // Define external out-of-line implementation
 #include "raymath.h"                // Vector3, Quaternion and Matrix functionality
 
@@ -149,6 +179,23 @@
 
     #define SDEFL_IMPLEMENTATION
     #include "external/sdefl.h"     // Deflate (RFC 1951) compressor
+
+    #define RLZ4_IMPLEMENTATION
+    #include "external/rlz4.h"      // LZ4 block format compressor/decompressor
+#endif
+
+// SIMD Base64 encoding/decoding kernels (EncodeDataBase64(), DecodeDataBase64()), scalar fallback if not available
+// NOTE: SSSE3/AVX2 kernels require compiler target support (i.e. -mssse3, -mavx2, -march=native)
+#if defined(__AVX2__)
+    #define RCORE_SIMD_AVX2
+    #define RCORE_SIMD_SSSE3
+    #include <immintrin.h>          // Required for: AVX2 and SSSE3 intrinsics
+#elif defined(__SSSE3__) || defined(__AVX__)
+    #define RCORE_SIMD_SSSE3
+    #include <tmmintrin.h>          // Required for: SSSE3 intrinsics
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define RCORE_SIMD_NEON
+    #include <arm_neon.h>           // Required for: NEON intrinsics (AArch64 table lookups)
 #endif
 
 #if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
@@ -180,7 +227,9 @@
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <errno.h>                  // Required for: EINTR [Used in WaitTime()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
+#include <ctype.h>                  // Required for: tolower() [Used in LoadDirectoryFilesEx()]
 
 #define _CRT_INTERNAL_NONSTDC_NAMES  1
 #include <sys/stat.h>               // Required for: stat(), S_ISREG [Used in GetFileModTime(), IsFilePath()]
@@ -188,6 +237,9 @@
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+    #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #if defined(PLATFORM_DESKTOP) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
@@ -245,6 +297,9 @@
         void *glfwGetCocoaWindow(GLFWwindow* handle);
         #include "GLFW/glfw3native.h"       // Required for: glfwGetCocoaWindow()
     #endif
+    #if !defined(_WIN32)
+        #include <pthread.h>                // POSIX threads management (threaded renderer)
+    #endif
 
     // TODO: HACK: Added flag if not provided by GLFW when using external library
     // Latest GLFW release (GLFW 3.3.8) does not implement this flag, it was added for 3.4.0-dev
@@ -271,6 +326,7 @@
     #include <dirent.h>                 // POSIX directory browsing
 
     #include <sys/ioctl.h>              // Required for: ioctl() - UNIX System call for device-specific input/output operations
+    #include <poll.h>                   // POSIX poll() - Input devices events waiting
     #include <linux/kd.h>               // Linux: KDSKBMODE, K_MEDIUMRAM constants definition
     #include <linux/input.h>            // Linux: Keycodes constants definition (KEY_A, ...)
     #include <linux/joystick.h>         // Linux: Joystick support library
@@ -282,6 +338,7 @@
     #include <gbm.h>                    // Generic Buffer Management (native platform for EGL on DRM)
     #include <xf86drm.h>                // Direct Rendering Manager user-level library interface
     #include <xf86drmMode.h>            // Direct Rendering Manager mode setting (KMS) interface
+    #include <drm_fourcc.h>             // Direct Rendering Manager pixel formats (fourcc codes)
 #endif
 
     #include "EGL/egl.h"                // Native platform windowing system interface
@@ -289,6 +346,23 @@
     //#include "GLES2/gl2.h"            // OpenGL ES 2.0 library (not required in this module, only in rlgl)
 #endif
 
+#if defined(PLATFORM_HEADLESS)
+    #include <unistd.h>                 // POSIX standard function definitions - usleep()
+
+    // NOTE: Desktop OpenGL builds get khrplatform.h from glad (already included by rlgl),
+    // its embedded copy does not define KHRONOS_APIENTRY, required by EGL headers
+    #ifndef KHRONOS_APIENTRY
+        #define KHRONOS_APIENTRY
+    #endif
+
+    #include "EGL/egl.h"                // Native platform windowing system interface
+    #include "EGL/eglext.h"             // EGL extensions: EGL_MESA_platform_surfaceless, EGL_KHR_create_context
+
+    #ifndef EGL_PLATFORM_SURFACELESS_MESA
+        #define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+    #endif
+#endif
+
 #if defined(PLATFORM_WEB)
     #define GLFW_INCLUDE_ES2            // GLFW3: Enable OpenGL ES 2.0 (translated to WebGL)
     #include "GLFW/glfw3.h"             // GLFW3: Windows, OpenGL context and Input management
@@ -301,16 +375,34 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    #ifndef EGL_BUFFER_AGE_EXT
+        #define EGL_BUFFER_AGE_EXT     0x313D   // EGL_EXT_buffer_age: back buffer age surface query
+    #endif
+#endif
+
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
     #define USE_LAST_TOUCH_DEVICE       // When multiple touchscreens are connected, only use the one with the highest event<N> number
 
     #define DEFAULT_GAMEPAD_DEV    "/dev/input/js"  // Gamepad input (base dev for all gamepads: js0, js1, ...)
     #define DEFAULT_EVDEV_PATH       "/dev/input/"  // Path to the linux input events
+
+    #define JS_EVENT_BUTTON         0x01    // Gamepad button pressed/released
+    #define JS_EVENT_AXIS           0x02    // Gamepad joystick axis moved
+    #define JS_EVENT_INIT           0x80    // Gamepad initial state of device
+
+    #if !defined(input_event_sec)
+        #define input_event_sec time.tv_sec     // Linux: input_event timestamp seconds (kernel headers < 4.16)
+        #define input_event_usec time.tv_usec   // Linux: input_event timestamp microseconds (kernel headers < 4.16)
+    #endif
 #endif
 
 #ifndef MAX_FILEPATH_CAPACITY
     #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
 #endif
+#ifndef MAX_FILE_FILTER_EXTENSIONS
+    #define MAX_FILE_FILTER_EXTENSIONS    32        // Maximum number of extensions in directory scan filter
+#endif
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH         4096        // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
@@ -339,10 +431,69 @@
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef MAX_KEY_CHANGED_QUEUE
+    #define MAX_KEY_CHANGED_QUEUE         32        // Maximum number of keys state changes registered per frame (full keys sync if exceeded)
+#endif
+#ifndef MAX_INPUT_EVENTS_QUEUE
+    #define MAX_INPUT_EVENTS_QUEUE       256        // Maximum number of timestamped input events registered per frame (GetInputEvent())
+#endif
+#ifndef MAX_INPUT_EVENTS_RING
+    #define MAX_INPUT_EVENTS_RING        512        // Maximum raw input events queued per input device thread (power of 2)
+#endif
+#ifndef MAX_DISPLAY_PLANES
+    #define MAX_DISPLAY_PLANES             4        // Maximum number of hardware overlay planes used for direct scanout
+#endif
+#ifndef MAX_SCANOUT_RENDER_TEXTURES
+    #define MAX_SCANOUT_RENDER_TEXTURES    8        // Maximum number of render textures loaded for direct scanout
+#endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
+#ifndef COMPRESSION_STREAM_CHUNK_SIZE
+    #define COMPRESSION_STREAM_CHUNK_SIZE 65536     // Default chunk size for data compression streams (bytes)
+#endif
+#define SHADER_CACHE_HEADER_SIZE          12        // Shader program binaries cache file header size: "rSPB", format, size
+
+#ifndef MAX_SHADERS_PENDING
+    #define MAX_SHADERS_PENDING          256        // Maximum number of shaders loading asynchronously, pending of completion
+#endif
+#ifndef MAX_FRAME_TIME_SAMPLES
+    #define MAX_FRAME_TIME_SAMPLES      1024        // Maximum number of frames measured for frame time statistics
+#endif
+#ifndef ASYNC_LOAD_FRAME_BUDGET
+    #define ASYNC_LOAD_FRAME_BUDGET      2.0        // Async loads finalization time budget per frame (milliseconds)
+#endif
+#ifndef MAX_SCREENSHOTS_PENDING
+    #define MAX_SCREENSHOTS_PENDING        8        // Maximum number of screenshots being read back and exported asynchronously
+#endif
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // Default GIF recording framerate (frames per second)
+#endif
+#ifndef MAX_GIF_FRAMES_PENDING
+    #define MAX_GIF_FRAMES_PENDING         4        // Maximum number of GIF frames pixel buffers being encoded asynchronously
+#endif
+#ifndef DYNAMIC_RESOLUTION_FRAMES
+    #define DYNAMIC_RESOLUTION_FRAMES      3        // Frames GPU time queries are kept in flight for dynamic resolution scaling
+#endif
+#ifndef DYNAMIC_RESOLUTION_HEADROOM
+    #define DYNAMIC_RESOLUTION_HEADROOM 0.9f        // Dynamic resolution GPU time aimed, relative to target frame time
+#endif
+#ifndef FIXED_UPDATE_MAX_TIME
+    #define FIXED_UPDATE_MAX_TIME       0.25        // Maximum frame time accumulated for fixed update steps (seconds), longer frames slow down simulation
+#endif
+#ifndef FIXED_UPDATE_MINIMIZED_FPS
+    #define FIXED_UPDATE_MINIMIZED_FPS    10        // Frames rate while window is minimized and fixed update rate is set, frames are not rendered
+#endif
+#ifndef HEADLESS_FRAMES_COUNT
+    #define HEADLESS_FRAMES_COUNT          0        // Headless platform frames to run before WindowShouldClose() (0: no limit)
+#endif
+#ifndef AUTOMATION_EVENTS_SYNC_INTERVAL
+    #define AUTOMATION_EVENTS_SYNC_INTERVAL  600    // Automation events frames between sync records (input state snapshot, seek point)
+#endif
+#ifndef AUTOMATION_EVENTS_BUFFER_SIZE
+    #define AUTOMATION_EVENTS_BUFFER_SIZE   4096    // Automation events stream buffer size (bytes)
+#endif
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -354,6 +505,24 @@
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+// Raw input event, registered by input devices threads
+typedef struct {
+    double time;                    // Event time in seconds (GetTime() reference), device timestamp when available
+    int value;                      // Event value
+    unsigned short type;            // Event type (EV_KEY, EV_REL, EV_ABS... or JS_EVENT_BUTTON, JS_EVENT_AXIS for gamepads)
+    unsigned short code;            // Event code (button/axis number for gamepads)
+} InputRawEvent;
+
+// Raw input events ring, lock-free single producer (device thread) and single consumer (main thread)
+// NOTE: head and tail are free-running counters, only accessed through atomic load/store
+typedef struct {
+    InputRawEvent events[MAX_INPUT_EVENTS_RING]; // Events buffer
+    unsigned int head;              // Events written count (producer)
+    unsigned int tail;              // Events read count (consumer)
+    unsigned int dropped;           // Events dropped count, ring was full (producer)
+    unsigned int droppedReported;   // Events dropped count already reported (consumer)
+} InputEventRing;
+
 typedef struct {
     pthread_t threadId;             // Event reading thread id
     int fd;                         // File descriptor to the device it is assigned to
@@ -365,12 +534,52 @@ typedef struct {
     bool isMultitouch;              // True if device supports multiple absolute movevents and has BTN_TOUCH
     bool isKeyboard;                // True if device has letter keycodes
     bool isGamepad;                 // True if device has gamepad buttons
+    bool positionChanged;           // True if position changed since latest events report (EV_SYN), processed by main thread
+    InputEventRing ring;            // Events registered by reading thread, pending to be processed
 } InputEventWorker;
 #endif
 
+#if defined(PLATFORM_DRM)
+// Overlay plane properties set on atomic commits (same order as in SetDisplayPlane*() requests)
+typedef enum {
+    PLANE_PROP_FB_ID = 0, PLANE_PROP_CRTC_ID,
+    PLANE_PROP_SRC_X, PLANE_PROP_SRC_Y, PLANE_PROP_SRC_W, PLANE_PROP_SRC_H,
+    PLANE_PROP_CRTC_X, PLANE_PROP_CRTC_Y, PLANE_PROP_CRTC_W, PLANE_PROP_CRTC_H,
+    PLANE_PROP_COUNT
+} DisplayPlaneProperty;
+
+// Hardware overlay plane, content scanned out directly by display controller (no GL composition)
+// NOTE: Requested state is applied on next SwapScreenBuffer(), together with primary plane page flip
+typedef struct {
+    uint32_t id;                    // DRM plane id
+    uint32_t props[PLANE_PROP_COUNT]; // DRM plane properties ids [atomic]
+    uint32_t fb;                    // Requested framebuffer (0: plane disabled)
+    bool fbImported;                // Requested framebuffer created from external dmabuf, owned by plane
+    uint32_t currentFb;             // Framebuffer currently scanned out
+    bool currentFbImported;         // Current framebuffer created from external dmabuf, owned by plane
+    Rectangle source;               // Requested framebuffer region
+    Rectangle dest;                 // Requested screen region
+    bool dirty;                     // Requested state pending to be applied
+} DisplayPlaneDRM;
+
+// Render texture loaded for direct scanout, color texture storage is a GBM buffer object
+typedef struct {
+    unsigned int textureId;         // Color texture id (render texture lookup)
+    struct gbm_bo *bo;              // GBM buffer object, storage shared by texture and framebuffer
+    EGLImageKHR image;              // EGL image importing buffer object dmabuf
+    uint32_t fb;                    // DRM framebuffer scanning out buffer object
+} ScanoutBufferDRM;
+#endif
+
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
+// Shader loading asynchronously, pending of compilation/linkage completion
+typedef struct {
+    Shader shader;                  // Shader program id and default locations (set on completion)
+    unsigned long long cacheKey;    // Shader program binaries cache key (0: not cached)
+} ShaderPending;
+
 // Core global state context data
 typedef struct CoreData {
     struct {
@@ -380,7 +589,12 @@ typedef struct CoreData {
 #if defined(PLATFORM_RPI)
         EGL_DISPMANX_WINDOW_T handle;       // Native window handle (graphic device)
 #endif
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_HEADLESS)
+#if defined(PLATFORM_HEADLESS)
+        unsigned int fbo;                   // Offscreen framebuffer object (surfaceless context, no default framebuffer)
+        unsigned int fboTexture;            // Offscreen framebuffer color attachment texture
+        unsigned int frameCount;            // Frames to run before WindowShouldClose() returns true (0: no limit)
+#endif
 #if defined(PLATFORM_DRM)
         int fd;                             // File descriptor for /dev/dri/...
         drmModeConnector *connector;        // Direct Rendering Manager (DRM) mode connector
@@ -388,13 +602,24 @@ typedef struct CoreData {
         int modeIndex;                      // Index of the used mode of connector->modes
         struct gbm_device *gbmDevice;       // GBM device
         struct gbm_surface *gbmSurface;     // GBM surface
-        struct gbm_bo *prevBO;              // Previous GBM buffer object (during frame swapping)
-        uint32_t prevFB;                    // Previous GBM framebufer (during frame swapping)
+        struct gbm_bo *prevBO;              // GBM buffer object currently scanned out
+        struct gbm_bo *pendingBO;           // GBM buffer object queued for page flip (presented on next vblank)
+        bool crtcModeSet;                   // CRTC mode has been set, next frames are presented with page flips
+        bool atomic;                        // Atomic modesetting supported, primary and overlay planes updated in the same commit
+        uint32_t primaryPlane;              // Primary plane id [atomic]
+        uint32_t primaryPlaneFbProp;        // Primary plane FB_ID property id [atomic]
+        DisplayPlaneDRM planes[MAX_DISPLAY_PLANES]; // Overlay planes usable with CRTC
+        int planeCount;                     // Overlay planes count
+        ScanoutBufferDRM scanoutBuffers[MAX_SCANOUT_RENDER_TEXTURES]; // Render textures loaded for direct scanout
+        PFNEGLCREATEIMAGEKHRPROC createImage;   // Create EGL image (EGL_KHR_image_base), used to import dmabufs (EGL_EXT_image_dma_buf_import)
+        PFNEGLDESTROYIMAGEKHRPROC destroyImage; // Destroy EGL image
 #endif  // PLATFORM_DRM
         EGLDisplay device;                  // Native display device (physical screen connection)
         EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
         EGLContext context;                 // Graphic context, mode in which drawing can be done
         EGLConfig config;                   // Graphic config
+        EGLBoolean (*swapBuffersWithDamage)(EGLDisplay, EGLSurface, EGLint *, EGLint);  // Swap buffers presenting damage region (EGL_KHR/EXT_swap_buffers_with_damage)
+        bool bufferAge;                     // Back buffer age query supported (EGL_EXT_buffer_age)
 #endif
         const char *title;                  // Window text title const pointer
         unsigned int flags;                 // Configuration flags (bit based), keeps window state
@@ -408,9 +633,12 @@ typedef struct CoreData {
         Size display;                       // Display width and height (monitor, device-screen, LCD, ...)
         Size screen;                        // Screen width and height (used render area)
         Size currentFbo;                    // Current render width and height (depends on active fbo)
+        unsigned int currentFboId;          // Current render texture fbo id (0: default framebuffer)
         Size render;                        // Framebuffer width and height (render area, including black bars if required)
         Point renderOffset;                 // Offset from render area (must be divided by 2)
         Matrix screenScale;                 // Matrix to scale screen (framebuffer rendering)
+        Rectangle scissor;                  // Scissor mode area (screen coordinates, upper-left origin)
+        bool scissorEnabled;                // Check if scissor mode is enabled
 
         char **dropFilepaths;         // Store dropped files paths pointers (provided by GLFW)
         unsigned int dropFileCount;         // Count dropped files strings
@@ -436,6 +664,9 @@ typedef struct CoreData {
             char currentKeyState[MAX_KEYBOARD_KEYS];        // Registers current frame key state
             char previousKeyState[MAX_KEYBOARD_KEYS];       // Registers previous frame key state
 
+            int keyChangedQueue[MAX_KEY_CHANGED_QUEUE];     // Keys with state changed since previous frame (previousKeyState[] pending update)
+            int keyChangedQueueCount;       // Keys changed count, if greater than MAX_KEY_CHANGED_QUEUE all keys are updated
+
             int keyPressedQueue[MAX_KEY_PRESSED_QUEUE];     // Input keys queue
             int keyPressedQueueCount;       // Input keys queue count
 
@@ -466,10 +697,6 @@ typedef struct CoreData {
             char previousButtonState[MAX_MOUSE_BUTTONS];    // Registers previous mouse button state
             Vector2 currentWheelMove;       // Registers current mouse wheel variation
             Vector2 previousWheelMove;      // Registers previous mouse wheel variation
-#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-            // NOTE: currentButtonState[] can't be written directly due to multithreading, app could miss the update
-            char currentButtonStateEvdev[MAX_MOUSE_BUTTONS]; // Holds the new mouse state for the next polling event to grab
-#endif
         } Mouse;
         struct {
             int pointCount;                             // Number of touch points active
@@ -489,8 +716,21 @@ typedef struct CoreData {
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
             pthread_t threadId;             // Gamepad reading thread id
             int streamId[MAX_GAMEPADS];     // Gamepad device file descriptor
+            InputEventRing ring[MAX_GAMEPADS];  // Gamepad events registered by reading thread, pending to be processed
 #endif
         } Gamepad;
+        struct {
+            InputEvent pending[MAX_INPUT_EVENTS_QUEUE];     // Input events registered, pending for PollInputEvents() end
+            int pendingCount;               // Input events pending count
+            InputEvent queue[MAX_INPUT_EVENTS_QUEUE];       // Input events registered by last PollInputEvents(), ordered by time
+            int queueCount;                 // Input events registered count
+            int dropped;                    // Input events dropped count (pending queue full)
+            double swapTime;                // Oldest input event time presented by next screen buffer swap
+            bool swapPending;               // Input events pending to be presented by next screen buffer swap
+            float swapLatency;              // Input latency measured by latest screen buffer swap presenting input events
+            float latency;                  // Input latency registered on BeginDrawing() (threaded renderer swap completed)
+        } Events;
+        double eventTime;                   // Latest input event time registered (GetTime() reference)
     } Input;
     struct {
         double current;                     // Current time measure
@@ -499,13 +739,113 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+        double deadline;                    // Next frame deadline time, if 0 restarted on next frame
+        double sleepError;                  // Measured system sleep overshoot (calibrated sleep granularity)
+        double fixedStep;                   // Fixed update step time, if 0 not applied (SetFixedUpdateRate())
+        double fixedAccumulator;            // Frame time accumulated not yet consumed by fixed update steps
+        int fixedSteps;                     // Fixed update steps to run on current frame
+        bool mainLoop;                      // Frames driven by SetMainLoop() (web: browser requestAnimationFrame, frames not waited)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_HEADLESS)
         unsigned long long base;            // Base time measure for hi-res timer
+#endif
+#if defined(_WIN32)
+        void *timer;                        // High-resolution waitable timer handle (if available)
 #endif
         unsigned int frameCounter;          // Frame counter
     } Time;
+    struct {
+        Rectangle next;                     // Next frame changed region, set by SetFrameDirtyRect() (screen coordinates)
+        bool nextSet;                       // Next frame changed region set, otherwise full frame is presented
+        Rectangle current;                  // Current frame changed region (framebuffer pixels, bottom-left origin)
+        Rectangle previous;                 // Previous frame presented changed region (framebuffer pixels, bottom-left origin)
+        Rectangle clip;                     // Current frame drawing clip region (framebuffer pixels, bottom-left origin)
+        bool partial;                       // Current frame presented partially (changed region only)
+        bool clipped;                       // Current frame drawing clipped, back buffer content is known (buffer age)
+        bool clipSuspended;                 // Drawing clip suspended, drawing to render texture
+        bool skipped;                       // Current frame not changed, screen buffer swap skipped
+    } Damage;
+    struct {
+        unsigned int fbo;                   // Scene framebuffer id, full render size (0: not loaded)
+        unsigned int texture;               // Scene framebuffer color texture id
+        int width;                          // Scene framebuffer width
+        int height;                         // Scene framebuffer height
+        int current[2];                     // Current frame scene drawing size (scaled render size)
+        float scale;                        // Current resolution scale (0.0f: not initialized)
+        float minScale;                     // Minimum resolution scale
+        float sharpness;                    // Upscale sharpening amount (0.0f: bilinear only)
+        double targetTime;                  // Target GPU frame time in seconds (0: target FPS time)
+        double gpuTime;                     // Latest GPU frame time measured (milliseconds)
+        unsigned int queries[DYNAMIC_RESOLUTION_FRAMES];    // GPU frame time queries, ring
+        int query;                          // Current frame query index
+        bool queryActive;                   // Current frame query active (BeginDrawing() to EndDrawing())
+        bool queryIssued[DYNAMIC_RESOLUTION_FRAMES];        // Query issued, result can be read back
+        bool active;                        // Drawing scene at scaled resolution
+        bool loaded;                        // GPU frame time queries and upscale shader loaded
+        bool failed;                        // Scene framebuffer could not be loaded
+        Shader shader;                      // Upscale shader (default shader if not loaded)
+        int locs[2];                        // Upscale shader locations: region, sharpness
+    } Resolution;
+#if defined(PLATFORM_DESKTOP)
+    struct {
+        bool active;                        // Threaded renderer running (FLAG_THREADED_RENDERER)
+        bool quit;                          // Render thread exit requested
+        bool contextOwned;                  // Main thread owns OpenGL context (no frame being presented)
+#if defined(_WIN32)
+        void *thread;                       // Render thread handle
+        void *frameReady;                   // Frame submitted event (auto-reset)
+        void *frameDone;                    // Frame presented event (auto-reset)
+#else
+        pthread_t threadId;                 // Render thread id
+        pthread_mutex_t mutex;              // Frame submission mutex
+        pthread_cond_t cond;                // Frame submission condition (submitted/presented)
+        bool framePending;                  // Frame submitted, waiting to be presented
+#endif
+    } Renderer;
+#endif
 } CoreData;
 
+// Directory scan file extensions filter, parsed once per scan
+typedef struct FileFilter {
+    int count;                                          // Number of extensions (0: no filter)
+    char exts[MAX_FILE_FILTER_EXTENSIONS][16];          // Extensions, lowercase, including the dot: ".png"
+} FileFilter;
+
+// Directory scan paths, stored in a single strings arena
+// NOTE: Paths are stored as arena offsets while scanning, arena could be reallocated
+typedef struct FilePathScan {
+    char *data;                     // Paths strings arena ('\0' terminated strings)
+    unsigned int size;              // Arena used size
+    unsigned int capacity;          // Arena capacity
+    unsigned int *offsets;          // Paths offsets in arena
+    unsigned int count;             // Paths count
+    unsigned int offsetsCapacity;   // Paths offsets capacity
+} FilePathScan;
+
+// Directory scan job data, subdirectories scanned in parallel (jobs system)
+typedef struct FileScanJob {
+    const FilePathScan *dirs;       // Subdirectories to scan
+    FilePathScan *scans;            // Scanned paths, one per subdirectory
+    const FileFilter *filter;       // Extensions filter
+} FileScanJob;
+
+// Screenshot pending, screen pixels read back by GPU and exported by async loader thread
+typedef struct ScreenshotPending {
+    char path[2048];                // Screenshot file path
+    Image image;                    // Screenshot image (exported on loader thread)
+    bool readback;                  // Screen pixels readback queued, not collected yet
+    int request;                    // Export async load request (-1: exported synchronously)
+    bool exported;                  // Export finalized (main thread)
+    bool success;                   // Image exported successfully
+} ScreenshotPending;
+
+// GIF frame pending, screen pixels copied into a recycled buffer and encoded by async loader thread
+typedef struct GifFramePending {
+    unsigned char *pixels;          // Frame pixels (recording size, buffer reused by next frames)
+    int pitch;                      // Frame pixels row pitch in bytes (negative: bottom-up rows)
+    int delay;                      // Frame delay (centiseconds)
+    int request;                    // Encode async load request
+} GifFramePending;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -513,18 +853,53 @@ RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exported s
 
 static CoreData CORE = { 0 };               // Global CORE state context
 
-#if defined(SUPPORT_SCREEN_CAPTURE)
+// NOTE: Screenshots are taken by keys (desktop, web, rpi/drm platforms) and automation events
+#if (defined(SUPPORT_SCREEN_CAPTURE) && !defined(PLATFORM_HEADLESS) && !defined(PLATFORM_ANDROID)) || defined(SUPPORT_EVENTS_AUTOMATION)
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+static ScreenshotPending *screenshotsPending[MAX_SCREENSHOTS_PENDING] = { 0 };  // Screenshots pending, in order
+static int screenshotsPendingCount = 0;     // Screenshots pending count
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
 static int gifFrameCounter = 0;             // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+static MsfGifState gifState = { 0 };        // MSGIF context state, only accessed by loader thread while frames pending
+static int gifFramerate = GIF_RECORD_FRAMERATE; // GIF recording framerate (frames per second)
+static double gifFrameTime = 0.0;           // GIF latest frame recorded time
+static GifFramePending gifFrames[MAX_GIF_FRAMES_PENDING] = { 0 };  // GIF frames buffers, ring in encoding order
+static int gifFramesFirst = 0;              // GIF frames ring oldest pending frame
+static int gifFramesPendingCount = 0;       // GIF frames being encoded count
+#endif
+
+#if defined(SUPPORT_SHADER_CACHE)
+static char shaderCacheDirectory[MAX_FILEPATH_LENGTH] = { 0 };     // Shader program binaries cache directory (empty: disabled)
+#endif
+static ShaderPending shadersPending[MAX_SHADERS_PENDING] = { 0 };  // Shaders loading asynchronously
+static int shadersPendingCount = 0;         // Shaders loading asynchronously counter
+
+static CameraViewProj cameraViewProj = { 0 };   // Last camera view-projection computed, reused while camera and viewport do not change
+
+#if defined(SUPPORT_FRAME_TIME_STATS)
+// Frame time sample, times in seconds
+typedef struct FrameTimeSample {
+    unsigned int frame;                     // Frame number
+    float update;                           // Update time
+    float draw;                             // Draw time (including SwapScreenBuffer())
+    float wait;                             // Wait time
+} FrameTimeSample;
+
+static FrameTimeSample frameTimeSamples[MAX_FRAME_TIME_SAMPLES] = { 0 };   // Frame time samples (ring buffer)
+static int frameTimeSamplesCount = 0;       // Frame time samples recorded (up to window)
+static int frameTimeSamplesIndex = 0;       // Frame time samples next index
+static int frameTimeSamplesWindow = MAX_FRAME_TIME_SAMPLES;     // Frame time samples window
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-#define MAX_CODE_AUTOMATION_EVENTS      16384
+#define AUTOMATION_EVENTS_HEADER_SIZE      16       // Automation events file header size: "rAEV", version, sync interval
+#define AUTOMATION_EVENT_SYNC            0xff       // Automation events stream sync record marker (seek point)
 
 typedef enum AutomationEventType {
     EVENT_NONE = 0,
@@ -553,7 +928,10 @@ typedef enum AutomationEventType {
     WINDOW_RESIZE,                  // param[0]: width, param[1]: height
     // Custom events
     ACTION_TAKE_SCREENSHOT,
-    ACTION_SETTARGETFPS
+    ACTION_SETTARGETFPS,
+    // Input events (queues)
+    INPUT_CHAR_PRESSED,             // param[0]: codepoint
+    AUTOMATION_EVENT_TYPE_COUNT
 } AutomationEventType;
 
 // Event type
@@ -592,18 +970,60 @@ static const char *autoEventTypeName[] = {
     "WINDOW_MINIMIZE",
     "WINDOW_RESIZE",
     "ACTION_TAKE_SCREENSHOT",
-    "ACTION_SETTARGETFPS"
+    "ACTION_SETTARGETFPS",
+    "INPUT_CHAR_PRESSED"
+};
+
+// Parameters stored per event type
+static const unsigned char autoEventParamCount[AUTOMATION_EVENT_TYPE_COUNT] = {
+    0, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 2, 2, 3, 1, 1, 3, 1, 0, 0, 0, 2, 0, 1, 1
 };
 
 // Automation Event (24 bytes)
+// NOTE: Float values (mouse wheel, gamepad axis) are stored as float bits for exact replay
 typedef struct AutomationEvent {
     unsigned int frame;                 // Event frame
     unsigned int type;                  // Event type (AutomationEventType)
     int params[4];                      // Event parameters (if required)
 } AutomationEvent;
 
-static AutomationEvent *events = NULL;  // Events array
-static unsigned int eventCount = 0;     // Events count
+// Automation events seek point, one per stream sync record
+typedef struct AutomationSeekPoint {
+    unsigned int frame;                 // Sync record frame
+    unsigned int offset;                // Sync record file offset
+} AutomationSeekPoint;
+
+// Automation events stream, binary events file recorded/played through a buffer
+// NOTE: Events are stored as [type][frame delta][params delta] varints, delta-encoded against
+// previous event (frame) and previous event of same type (params), bases reset on every sync record
+typedef struct AutomationEventStream {
+    FILE *file;                         // Events file (recording or playing)
+    unsigned char buffer[AUTOMATION_EVENTS_BUFFER_SIZE];    // Stream buffer
+    unsigned int bufferSize;            // Stream buffer size (bytes pending to write or available to read)
+    unsigned int bufferPosition;        // Stream buffer read position
+    unsigned int offset;                // Stream buffer file offset
+    unsigned int end;                   // Events data end file offset (playing)
+
+    unsigned int frameStart;            // Core frames counter at recording/playing start
+    unsigned int frame;                 // Previous event frame (delta-encoding base)
+    int params[AUTOMATION_EVENT_TYPE_COUNT][3];             // Previous event params per type (delta-encoding base)
+    unsigned int eventCount;            // Events recorded/played
+
+    AutomationSeekPoint *seekPoints;    // Sync records seek points (frame index)
+    unsigned int seekPointCount;        // Seek points count
+    unsigned int seekPointCapacity;     // Seek points capacity (recording)
+
+    AutomationEvent next;               // Next event to play (only sync frame read for sync records)
+    bool nextReady;                     // Next event available
+
+    // Recorded state for polled inputs, compared every frame (recording)
+    bool gamepadReady[MAX_GAMEPADS];
+    float gamepadAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];
+    Vector2 touchPosition[MAX_TOUCH_POINTS];
+    int gesture;
+} AutomationEventStream;
+
+static AutomationEventStream eventStream = { 0 };   // Events stream
 static bool eventsPlaying = false;      // Play events
 static bool eventsRecording = false;    // Record events
 
@@ -618,20 +1038,79 @@ static bool eventsRecording = false;    // Record events
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void UnloadShapesDefault(void);      // [Module: shapes] Unloads SDF shapes shader and path buffers on CloseWindow()
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+extern void UnloadTextInternTable(void);    // [Module: text] Unloads text strings intern table on CloseWindow()
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_STREAMING)
+extern void UpdateTextureStreaming(void);   // [Module: textures] Updates streamed textures mipmaps residency
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UnloadTextureFilterDefault(void);   // [Module: textures] Unloads textures filters shader and framebuffer
+extern void UpdateRenderTexturePool(void);      // [Module: textures] Unloads pooled render textures released some frames ago
+extern void UnloadRenderTexturePool(void);      // [Module: textures] Unloads all pooled render textures
+extern void ResolveRenderTexture(unsigned int id);     // [Module: textures] Resolves multisample render texture, invalidates transient attachments
+#endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadShaderSkinning(void);     // [Module: models] Unloads GPU skinning default shader
+extern void UnloadMeshDrawDefault(void);    // [Module: models] Unloads internal instances buffer and mesh queue
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
+#if defined(PLATFORM_DESKTOP)
+static void InitRenderThread(void);                     // Initialize render thread, frames are presented from it (FLAG_THREADED_RENDERER)
+static void CloseRenderThread(void);                    // Close render thread, OpenGL context is returned to main thread
+static void SubmitRenderFrame(void);                    // Submit current frame to render thread, OpenGL context is released
+#if defined(_WIN32)
+static unsigned long __stdcall RenderThread(void *arg); // Render thread, presents submitted frames
+#else
+static void *RenderThread(void *arg);                   // Render thread, presents submitted frames
+#endif
+#endif
+static void AcquireRenderContext(void);                 // Wait for render thread to present frame and make OpenGL context current (main thread)
+static void SleepUntil(double time);                    // Halt program execution until time, using system sleep functions
+static void WaitUntil(double time);                     // Wait until time (GetTime() reference), calibrating sleep overshoot
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 
-static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID) || defined(SUPPORT_EVENTS_AUTOMATION)
+static void SetKeyState(int key, char state);           // Set key current state, key change registered for previous state update
+#endif
+static void UpdatePreviousKeyStates(void);              // Register previous keys states, only for keys changed since last frame
+#if !defined(PLATFORM_HEADLESS)
+static void RegisterInputEvent(double time, int type, int code, int gamepad, Vector2 value);   // Register timestamped input event (pending)
+#endif
+static void SwapInputEvents(void);                      // Make pending input events available (GetInputEvent()), ordered by time
+static Rectangle GetScissorRec(int x, int y, int width, int height);    // Get scissor rectangle in current framebuffer pixels (bottom-left origin)
+static void BeginFrameDamage(void);                     // Setup current frame changed region presentation and drawing clip
+static bool LoadDynamicResolution(void);                // Load dynamic resolution scene framebuffer (render size), queries and upscale shader
+static void UnloadDynamicResolution(void);              // Unload dynamic resolution scene framebuffer, queries and upscale shader
+static void UpdateDynamicResolution(void);              // Read back GPU frame time and update resolution scale for next frame
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+static void RegisterGamepadButtonEvents(int gamepad);  // Register gamepad buttons changes events (gamepads state polled)
+#endif
+
+static void LoadFileFilter(const char *filter, FileFilter *fileFilter);                            // Parse extensions filter ("png;.jpg") once for directory scanning
+static bool IsFileFilterMatch(const FileFilter *fileFilter, const char *fileName);                  // Check if file name extension matches filter (not case-sensitive)
+static void AddScanPath(FilePathScan *scan, const char *path);                                       // Add path to directory scan arena
+static void ScanDirectoryFiles(const char *basePath, FilePathScan *scan, const FileFilter *filter, FilePathScan *dirs);  // Scan files and directories in a base path, subdirectories added to dirs (if provided)
+static void ScanDirectoryFilesRecursively(const char *basePath, FilePathScan *scan, const FileFilter *filter);  // Scan all files recursively from a base path
+static void ScanDirectoriesJob(int start, int end, void *userData);                                 // Scan subdirectories range recursively, jobs system callback
+static FilePathList LoadScanPaths(FilePathScan *scan);                                               // Load directory scan paths as FilePathList, scan arena ownership transferred
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
+#if defined(PLATFORM_DESKTOP)
+static void *GlfwAllocateCallback(size_t size, void *user);                                 // GLFW3 allocator, uses RL_MALLOC()
+static void *GlfwReallocateCallback(void *block, size_t size, void *user);                  // GLFW3 allocator, uses RL_REALLOC()
+static void GlfwDeallocateCallback(void *block, void *user);                                // GLFW3 allocator, uses RL_FREE()
+#endif
 // Window callbacks events
 static void WindowSizeCallback(GLFWwindow *window, int width, int height);                 // GLFW3 WindowSize Callback, runs when window is resized
 #if !defined(PLATFORM_WEB)
@@ -647,6 +1126,9 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
 static void MouseCursorPosCallback(GLFWwindow *window, double x, double y);                // GLFW3 Cursor Position Callback, runs on mouse move
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset);       // GLFW3 Srolling Callback, runs on mouse wheel
 static void CursorEnterCallback(GLFWwindow *window, int enter);                            // GLFW3 Cursor Enter Callback, cursor enters client area
+#if defined(PLATFORM_DESKTOP)
+static void JoystickCallback(int jid, int event);                                          // GLFW3 Joystick Callback, runs on gamepad connected/disconnected
+#endif
 #endif
 
 #if defined(PLATFORM_ANDROID)
@@ -675,6 +1157,12 @@ static void InitEvdevInput(void);                       // Initialize evdev inpu
 static void ConfigureEvdevDevice(char *device);         // Identifies a input device and configures it for use if appropriate
 static void PollKeyboardEvents(void);                   // Process evdev keyboard events.
 static void *EventThread(void *arg);                    // Input device events reading thread
+static double GetEvdevEventTime(const struct input_event *event);   // Get evdev event timestamp (GetTime() reference)
+static bool PushInputEvent(InputEventRing *ring, const InputRawEvent *event);   // Register raw input event (device thread)
+static bool PopInputEvent(InputEventRing *ring, InputRawEvent *event);  // Get next raw input event (main thread)
+static void ProcessEvdevEvent(InputEventWorker *worker, const InputRawEvent *event); // Process mouse/touch event (main thread)
+static void ProcessGamepadEvent(int gamepad, const InputRawEvent *event);   // Process gamepad event (main thread)
+static void PollInputDevicesEvents(void);               // Process raw input events registered by devices threads
 
 static void InitGamepad(void);                          // Initialize raw gamepad input
 static void *GamepadThread(void *arg);                  // Mouse reading thread
@@ -683,20 +1171,77 @@ static void *GamepadThread(void *arg);                  // Mouse reading thread
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode);                               // Search matching DRM mode in connector's mode list
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
 static int FindNearestConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);    // Search the nearest matching DRM connector mode in connector's list
+static void DestroyFramebufferDRM(struct gbm_bo *bo, void *data);      // Release DRM framebuffer attached to GBM buffer object
+static uint32_t GetFramebufferDRM(struct gbm_bo *bo);                   // Get DRM framebuffer for GBM buffer object (created once, cached in buffer)
+static void PageFlipHandlerDRM(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data); // Page flip completion event handler
+static void WaitPageFlipDRM(void);                                      // Wait for queued page flip completion, release previous buffer object
+static uint32_t GetPropertyIdDRM(uint32_t objectId, uint32_t objectType, const char *name, uint64_t *value); // Get DRM object property id by name (0 if not found)
+static void InitDisplayPlanesDRM(drmModeRes *res);                      // Find primary and overlay planes usable with CRTC
+static bool SetDisplayPlaneFramebufferDRM(int plane, uint32_t fb, bool imported, Rectangle source, Rectangle dest); // Request overlay plane framebuffer, applied on next frame present
+static void UpdateDisplayPlanesDRM(drmModeAtomicReq *request);          // Apply overlay planes requested state, added to atomic request or set with legacy ioctl (NULL)
+static void FinishDisplayPlanesDRM(bool applied);                       // Register overlay planes state applied (or discarded), release framebuffers no longer scanned out
 #endif
 
 #endif  // PLATFORM_RPI || PLATFORM_DRM
 
+#if defined(SUPPORT_GIF_RECORDING)
+static void CollectGifFrames(bool wait);                    // Add queued screen readbacks to GIF recording (in order)
+static GifFramePending *GetGifFrame(void);                  // Get a free GIF frame buffer, waits for oldest frame encoding if required
+static void EncodeGifFrame(GifFramePending *frame);         // Queue GIF frame encoding on async loader thread
+static void EncodeGifFrameAsync(void *data);                // Encode GIF frame into recording (loader thread)
+static void ReleaseGifFrames(bool wait);                    // Release encoded GIF frames buffers, all pending frames waited if requested
+static void CloseGifFrames(void);                           // Finish GIF frames encoding, frames buffers unloaded
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+static void CollectScreenshots(bool wait);                  // Collect screenshots readbacks to be exported, exported screenshots released
+static void ExportScreenshot(ScreenshotPending *screenshot);    // Queue screenshot image export on async loader thread
+static void ExportScreenshotAsync(void *data);              // Export screenshot image file (loader thread)
+static void FinalizeScreenshotAsync(void *data);            // Finalize screenshot export (main thread)
+#endif
+
+static void SetShaderDefaultLocations(unsigned int id, int *locs);  // Set shader default locations (attributes, uniforms and uniform blocks)
+static void FinishShaderPending(int index);                 // Finish shader loading asynchronously, set its locations and remove it from pending list
+static Vector3 UnprojectPoint(Vector3 source, Matrix invViewProj);   // Unproject normalized device coordinates point with inverse view-projection matrix
+#if defined(SUPPORT_FRAME_TIME_STATS)
+static void RecordFrameTimeSample(void);                    // Record last frame times into frame time samples
+static int CompareFloat(const void *a, const void *b);      // Compare float values, required by qsort()
+#endif
+
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode);  // Load shader program from binaries cache, compile and cache it on miss
+static unsigned int LoadShaderCacheBinary(unsigned long long key);      // Load shader program from binaries cache file (0 if not available)
+static void SaveShaderCacheBinary(unsigned int id, unsigned long long key); // Save shader program binary into binaries cache file
+static bool GetShaderCacheFileName(unsigned long long key, char *fileName);  // Get binaries cache file name, false if path does not fit MAX_FILEPATH_LENGTH
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-static void LoadAutomationEvents(const char *fileName);     // Load automation events from file
-static void ExportAutomationEvents(const char *fileName);   // Export recorded automation events into a file
-static void RecordAutomationEvent(unsigned int frame);      // Record frame events (to internal events array)
-static void PlayAutomationEvent(unsigned int frame);        // Play frame events (from internal events array)
+static void WriteAutomationBytes(const unsigned char *bytes, unsigned int size);    // Write bytes to events stream (buffered)
+static void WriteAutomationVarint(unsigned int value);                  // Write variable-length unsigned value to events stream
+static bool ReadAutomationVarint(unsigned int *value);                  // Read variable-length unsigned value from events stream
+static void RecordAutomationEvent(unsigned int type, int param0, int param1, int param2);  // Record event into events stream (current frame)
+static void RecordAutomationSync(unsigned int frame);                   // Record sync record: input state snapshot and seek point
+static void RecordAutomationFrame(unsigned int frame);                  // Record polled inputs changes at frame end (mouse, touch, gamepad, gestures)
+static bool ReadAutomationEvent(AutomationEvent *event);                // Read next event from events stream
+static bool ReadAutomationState(void);                                  // Read sync record input state snapshot and apply it
+static void ApplyAutomationEvent(const AutomationEvent *event, bool seeking);  // Apply event to input state, transient events skipped on seeking
+static void PlayAutomationEvents(unsigned int frame, bool seeking);     // Play events stream up to frame
 #endif
 
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
+
+// NOTE: Waitable timers are used for high-resolution sleeps (CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, Windows 10 1803+)
+__declspec(dllimport) void *__stdcall CreateWaitableTimerExW(void *attributes, const unsigned short *name, unsigned long flags, unsigned long access);
+__declspec(dllimport) int __stdcall SetWaitableTimer(void *timer, const long long *dueTime, long period, void *routine, void *arg, int resume);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long msTimeout);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+
+// NOTE: Required for threaded renderer (FLAG_THREADED_RENDERER)
+__declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) void *__stdcall CreateEventW(void *attributes, int manualReset, int initialState, const unsigned short *name);
+__declspec(dllimport) int __stdcall SetEvent(void *event);
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -838,7 +1383,7 @@ void InitWindow(int width, int height, const char *title)
         }
     }
 #endif
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_HEADLESS)
     // Initialize graphics device (display device and OpenGL context)
     // NOTE: returns true if window and graphic device has been initialized successfully
     CORE.Window.ready = InitGraphicsDevice(width, height);
@@ -925,29 +1470,71 @@ void InitWindow(int width, int height, const char *title)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    events = (AutomationEvent *)RL_CALLOC(MAX_CODE_AUTOMATION_EVENTS, sizeof(AutomationEvent));
     CORE.Time.frameCounter = 0;
 #endif
 
-#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM
+#if defined(PLATFORM_DESKTOP)
+    if ((CORE.Window.flags & FLAG_THREADED_RENDERER) > 0) InitRenderThread();
+#endif
+
+#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM || PLATFORM_HEADLESS
 }
 
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if defined(PLATFORM_DESKTOP)
+    CloseRenderThread();
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    CollectScreenshots(true);   // Export pending screenshots before closing async loader
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
+        CloseGifFrames();       // Finish frames encoding before closing async loader
         MsfGifResult result = msf_gif_end(&gifState);
         msf_gif_free(result);
         gifRecording = false;
     }
 #endif
 
+    CloseAsyncLoads();          // Close async loader thread, decoding requests are finished
+
+#if defined(SUPPORT_MODULE_RSHAPES)
+    UnloadShapesDefault();      // WARNING: Module required: rshapes
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXT)
+    UnloadTextInternTable();    // WARNING: Module required: rtext
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadTextureFilterDefault();   // WARNING: Module required: rtextures
+    UnloadRenderTexturePool();      // WARNING: Module required: rtextures
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadShaderSkinning();     // WARNING: Module required: rmodels
+    UnloadMeshDrawDefault();    // WARNING: Module required: rmodels
+#endif
+
+    UnloadDynamicResolution();  // Unload dynamic resolution scene framebuffer (if loaded)
+
+#if defined(PLATFORM_HEADLESS)
+    rlSetFramebufferDefault(0);
+    if (CORE.Window.fbo > 0) rlUnloadFramebuffer(CORE.Window.fbo);  // Unload offscreen framebuffer and depth attachment
+    if (CORE.Window.fboTexture > 0) rlUnloadTexture(CORE.Window.fboTexture);
+    CORE.Window.fbo = 0;
+    CORE.Window.fboTexture = 0;
+#endif
+
     rlglClose();                // De-init rlgl
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -958,8 +1545,12 @@ void CloseWindow(void)
 #if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
     timeEndPeriod(1);           // Restore time period
 #endif
+#if defined(_WIN32)
+    if (CORE.Time.timer != NULL) CloseHandle(CORE.Time.timer);
+    CORE.Time.timer = NULL;
+#endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_HEADLESS)
     // Close surface, context and display
     if (CORE.Window.device != EGL_NO_DISPLAY)
     {
@@ -983,10 +1574,28 @@ void CloseWindow(void)
 #endif
 
 #if defined(PLATFORM_DRM)
-    if (CORE.Window.prevFB)
+    WaitPageFlipDRM();
+
+    // Disable overlay planes and release direct scanout buffers
+    for (int i = 0; i < CORE.Window.planeCount; i++)
     {
-        drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        CORE.Window.prevFB = 0;
+        drmModeSetPlane(CORE.Window.fd, CORE.Window.planes[i].id, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        if (CORE.Window.planes[i].fbImported && (CORE.Window.planes[i].fb != CORE.Window.planes[i].currentFb)) drmModeRmFB(CORE.Window.fd, CORE.Window.planes[i].fb);
+        if (CORE.Window.planes[i].currentFbImported) drmModeRmFB(CORE.Window.fd, CORE.Window.planes[i].currentFb);
+    }
+    CORE.Window.planeCount = 0;
+
+    for (int i = 0; i < MAX_SCANOUT_RENDER_TEXTURES; i++)
+    {
+        ScanoutBufferDRM *buffer = &CORE.Window.scanoutBuffers[i];
+
+        if (buffer->bo != NULL)
+        {
+            drmModeRmFB(CORE.Window.fd, buffer->fb);
+            CORE.Window.destroyImage(CORE.Window.device, buffer->image);
+            gbm_bo_destroy(buffer->bo);
+            *buffer = (ScanoutBufferDRM){ 0 };
+        }
     }
 
     if (CORE.Window.prevBO)
@@ -1073,7 +1682,12 @@ void CloseWindow(void)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    RL_FREE(events);
+    StopAutomationEventRecording();
+    StopAutomationEventPlaying();
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    TraceMemoryBlocks();    // Log unfreed memory blocks (application or raylib leaks)
 #endif
 
     CORE.Window.ready = false;
@@ -1089,7 +1703,8 @@ bool WindowShouldClose(void)
     // By default, this function is never called on a web-ready raylib example because we encapsulate
     // frame code in a UpdateDrawFrame() function, to allow browser manage execution asynchronously
     // but now emscripten allows sync code to be executed in an interpreted way, using emterpreter!
-    emscripten_sleep(16);
+    // NOTE: Frames driven by browser (SetMainLoop()) must not sleep, ASYNCIFY could be not available
+    if (!CORE.Time.mainLoop) emscripten_sleep(16);
     return false;
 #endif
 
@@ -1113,6 +1728,32 @@ bool WindowShouldClose(void)
     if (CORE.Window.ready) return CORE.Window.shouldClose;
     else return true;
 #endif
+
+#if defined(PLATFORM_HEADLESS)
+    // Frame loop finishes after requested frames count (if provided)
+    if ((CORE.Window.frameCount > 0) && (CORE.Time.frameCounter >= CORE.Window.frameCount)) CORE.Window.shouldClose = true;
+
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+#endif
+}
+
+// Run main loop, callback called every frame until window should close
+// NOTE: On PLATFORM_WEB frames are driven by browser (emscripten_set_main_loop_arg(), requestAnimationFrame timing)
+// so blocking loops and ASYNCIFY are not required, function does not return (browser keeps calling callback)
+void SetMainLoop(MainLoopCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+    CORE.Time.mainLoop = true;
+
+#if defined(PLATFORM_WEB)
+    emscripten_set_main_loop_arg(callback, userData, 0, 1);
+#else
+    while (!WindowShouldClose()) callback(userData);
+#endif
+
+    CORE.Time.mainLoop = false;
 }
 
 // Check if window has been initialized successfully
@@ -1185,6 +1826,8 @@ bool IsWindowState(unsigned int flag)
 // Toggle fullscreen mode (only PLATFORM_DESKTOP)
 void ToggleFullscreen(void)
 {
+    AcquireRenderContext();     // Threaded renderer: V-Sync could be set, OpenGL context required
+
 #if defined(PLATFORM_DESKTOP)
     if (!CORE.Window.fullscreen)
     {
@@ -1338,6 +1981,8 @@ void RestoreWindow(void)
 // Set window configuration state using flags
 void SetWindowState(unsigned int flags)
 {
+    AcquireRenderContext();     // Threaded renderer: V-Sync could be set, OpenGL context required
+
 #if defined(PLATFORM_DESKTOP)
     // Check previous state and requested state to apply required changes
     // NOTE: In most cases the functions already change the flags internally
@@ -1448,6 +2093,8 @@ void SetWindowState(unsigned int flags)
 // Clear window configuration state flags
 void ClearWindowState(unsigned int flags)
 {
+    AcquireRenderContext();     // Threaded renderer: V-Sync could be set, OpenGL context required
+
 #if defined(PLATFORM_DESKTOP)
     // Check previous state and requested state to apply required changes
     // NOTE: In most cases the functions already change the flags internally
@@ -1926,71 +2573,279 @@ int GetMonitorRefreshRate(int monitor)
     return 0;
 }
 
-// Get window position XY on monitor
-Vector2 GetWindowPosition(void)
+// Get number of hardware overlay planes available for direct scanout
+int GetDisplayPlaneCount(void)
 {
-    int x = 0;
-    int y = 0;
-#if defined(PLATFORM_DESKTOP)
-    glfwGetWindowPos(CORE.Window.handle, &x, &y);
+#if defined(PLATFORM_DRM)
+    return CORE.Window.planeCount;
+#else
+    return 0;
 #endif
-    return (Vector2){ (float)x, (float)y };
 }
 
-// Get window scale DPI factor for current monitor
-Vector2 GetWindowScaleDPI(void)
+// Load render texture for direct scanout on a display plane (color buffer shared with display controller)
+// NOTE: Color format is PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, stored bottom-up as any other render texture
+RenderTexture2D LoadRenderTextureScanout(int width, int height)
 {
-    Vector2 scale = { 1.0f, 1.0f };
+    RenderTexture2D target = { 0 };
 
-#if defined(PLATFORM_DESKTOP)
-    float xdpi = 1.0;
-    float ydpi = 1.0;
-    Vector2 windowPos = GetWindowPosition();
+#if defined(PLATFORM_DRM)
+    ScanoutBufferDRM *buffer = NULL;
+    for (int i = 0; (i < MAX_SCANOUT_RENDER_TEXTURES) && (buffer == NULL); i++) if (CORE.Window.scanoutBuffers[i].bo == NULL) buffer = &CORE.Window.scanoutBuffers[i];
 
-    int monitorCount = 0;
-    GLFWmonitor **monitors = glfwGetMonitors(&monitorCount);
+    if (buffer == NULL)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Scanout render textures limit reached (MAX_SCANOUT_RENDER_TEXTURES: %i)", MAX_SCANOUT_RENDER_TEXTURES);
+        return target;
+    }
 
-    // Check window monitor
-    for (int i = 0; i < monitorCount; i++)
+    if (CORE.Window.createImage == NULL)
     {
-        glfwGetMonitorContentScale(monitors[i], &xdpi, &ydpi);
+        TRACELOG(LOG_WARNING, "DISPLAY: Scanout render textures not supported (EGL_EXT_image_dma_buf_import)");
+        return target;
+    }
 
-        int xpos, ypos, width, height;
-        glfwGetMonitorWorkarea(monitors[i], &xpos, &ypos, &width, &height);
+    buffer->bo = gbm_bo_create(CORE.Window.gbmDevice, width, height, GBM_FORMAT_ARGB8888, GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (buffer->bo == NULL)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create scanout buffer object [%i x %i]", width, height);
+        return target;
+    }
 
-        if ((windowPos.x >= xpos) && (windowPos.x < xpos + width) &&
-            (windowPos.y >= ypos) && (windowPos.y < ypos + height))
-        {
-            scale.x = xdpi;
-            scale.y = ydpi;
-            break;
-        }
+    // Import buffer object into EGL, image keeps its own reference to dmabuf
+    int fd = gbm_bo_get_fd(buffer->bo);
+    uint32_t stride = gbm_bo_get_stride(buffer->bo);
+
+    EGLint imageAttribs[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_LINUX_DRM_FOURCC_EXT, DRM_FORMAT_ARGB8888,
+        EGL_DMA_BUF_PLANE0_FD_EXT, fd,
+        EGL_DMA_BUF_PLANE0_OFFSET_EXT, 0,
+        EGL_DMA_BUF_PLANE0_PITCH_EXT, (EGLint)stride,
+        EGL_NONE
+    };
+
+    buffer->image = (fd >= 0)? CORE.Window.createImage(CORE.Window.device, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT, NULL, imageAttribs) : EGL_NO_IMAGE_KHR;
+    if (fd >= 0) close(fd);
+
+    // NOTE: Framebuffer depth 32 keeps alpha channel, blended by display controller over primary plane
+    int result = -1;
+    if (buffer->image != EGL_NO_IMAGE_KHR) result = drmModeAddFB(CORE.Window.fd, width, height, 32, 32, stride, gbm_bo_get_handle(buffer->bo).u32, &buffer->fb);
+    if (result == 0) buffer->textureId = rlLoadTextureEGLImage(buffer->image);
+
+    if (buffer->textureId == 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to import scanout buffer object [%i x %i]", width, height);
+        if (result == 0) drmModeRmFB(CORE.Window.fd, buffer->fb);
+        if (buffer->image != EGL_NO_IMAGE_KHR) CORE.Window.destroyImage(CORE.Window.device, buffer->image);
+        gbm_bo_destroy(buffer->bo);
+        *buffer = (ScanoutBufferDRM){ 0 };
+        return target;
+    }
+
+    target.id = rlLoadFramebuffer(width, height);
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        target.texture.id = buffer->textureId;
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
+
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "DISPLAY: [ID %i] Scanout render texture loaded successfully", target.id);
+
+        rlDisableFramebuffer();
     }
+    else TRACELOG(LOG_WARNING, "DISPLAY: Scanout render texture framebuffer could not be created");
+#else
+    TRACELOG(LOG_WARNING, "DISPLAY: Scanout render textures only supported on PLATFORM_DRM");
 #endif
 
-    return scale;
+    return target;
 }
 
-// Get the human-readable, UTF-8 encoded name of the selected monitor
-const char *GetMonitorName(int monitor)
+// Unload scanout render texture, display planes showing it are disabled
+void UnloadRenderTextureScanout(RenderTexture2D target)
 {
-#if defined(PLATFORM_DESKTOP)
-    int monitorCount;
-    GLFWmonitor **monitors = glfwGetMonitors(&monitorCount);
-
-    if ((monitor >= 0) && (monitor < monitorCount))
+#if defined(PLATFORM_DRM)
+    for (int i = 0; i < MAX_SCANOUT_RENDER_TEXTURES; i++)
     {
-        return glfwGetMonitorName(monitors[monitor]);
+        ScanoutBufferDRM *buffer = &CORE.Window.scanoutBuffers[i];
+
+        if ((buffer->bo != NULL) && (buffer->textureId == target.texture.id))
+        {
+            // NOTE: Removing a framebuffer scanned out disables the plane, state is updated accordingly
+            for (int p = 0; p < CORE.Window.planeCount; p++)
+            {
+                DisplayPlaneDRM *overlay = &CORE.Window.planes[p];
+
+                if (overlay->fb == buffer->fb) { overlay->fb = 0; overlay->fbImported = false; }
+                if (overlay->currentFb == buffer->fb) { overlay->currentFb = 0; overlay->currentFbImported = false; }
+            }
+
+            if (target.id > 0) rlUnloadFramebuffer(target.id);     // Depth renderbuffer unloaded too
+            rlUnloadTexture(buffer->textureId);
+
+            drmModeRmFB(CORE.Window.fd, buffer->fb);
+            CORE.Window.destroyImage(CORE.Window.device, buffer->image);
+            gbm_bo_destroy(buffer->bo);
+            *buffer = (ScanoutBufferDRM){ 0 };
+
+            TRACELOG(LOG_INFO, "DISPLAY: [ID %i] Unloaded scanout render texture", target.id);
+            return;
+        }
     }
-    else TRACELOG(LOG_WARNING, "GLFW: Failed to find selected monitor");
+
+    TRACELOG(LOG_WARNING, "DISPLAY: [ID %i] Render texture not loaded for scanout", target.id);
 #endif
-    return "";
 }
 
-// Set clipboard text content
-void SetClipboardText(const char *text)
+// Set scanout render texture to be displayed on overlay plane, source region scaled to screen dest region
+// NOTE: Plane change is applied on next frame present, after render texture drawing is submitted
+bool SetDisplayPlaneTexture(int plane, RenderTexture2D target, Rectangle source, Rectangle dest)
 {
-#if defined(PLATFORM_DESKTOP)
+#if defined(PLATFORM_DRM)
+    for (int i = 0; i < MAX_SCANOUT_RENDER_TEXTURES; i++)
+    {
+        ScanoutBufferDRM *buffer = &CORE.Window.scanoutBuffers[i];
+
+        if ((buffer->bo != NULL) && (buffer->textureId == target.texture.id)) return SetDisplayPlaneFramebufferDRM(plane, buffer->fb, false, source, dest);
+    }
+
+    TRACELOG(LOG_WARNING, "DISPLAY: [ID %i] Render texture not loaded for scanout", target.id);
+#endif
+    return false;
+}
+
+// Set external dmabuf (i.e. video decoder frame) to be displayed on overlay plane, scaled to screen dest region
+// NOTE: Supported formats depend on plane, NV12/NV21 chroma plane expected right after luma plane
+bool SetDisplayPlaneDmabuf(int plane, int fd, int width, int height, int stride, unsigned int fourcc, Rectangle dest)
+{
+#if defined(PLATFORM_DRM)
+    uint32_t handle = 0;
+    if (drmPrimeFDToHandle(CORE.Window.fd, fd, &handle) != 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to import dmabuf [fd %i]", fd);
+        return false;
+    }
+
+    uint32_t handles[4] = { handle, 0 };
+    uint32_t pitches[4] = { (uint32_t)stride, 0 };
+    uint32_t offsets[4] = { 0 };
+
+    if ((fourcc == DRM_FORMAT_NV12) || (fourcc == DRM_FORMAT_NV21))
+    {
+        handles[1] = handle;
+        pitches[1] = (uint32_t)stride;
+        offsets[1] = (uint32_t)(stride*height);
+    }
+
+    uint32_t fb = 0;
+    int result = drmModeAddFB2(CORE.Window.fd, width, height, fourcc, handles, pitches, offsets, &fb, 0);
+
+    // NOTE: Framebuffer keeps its own reference to buffer object, imported handle not required anymore
+    struct drm_gem_close gemClose = { 0 };
+    gemClose.handle = handle;
+    drmIoctl(CORE.Window.fd, DRM_IOCTL_GEM_CLOSE, &gemClose);
+
+    if (result != 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: drmModeAddFB2() failed with result: %d", result);
+        return false;
+    }
+
+    return SetDisplayPlaneFramebufferDRM(plane, fb, true, (Rectangle){ 0, 0, (float)width, (float)height }, dest);
+#else
+    return false;
+#endif
+}
+
+// Clear overlay plane, disabled on next frame present
+void ClearDisplayPlane(int plane)
+{
+#if defined(PLATFORM_DRM)
+    SetDisplayPlaneFramebufferDRM(plane, 0, false, (Rectangle){ 0 }, (Rectangle){ 0 });
+#endif
+}
+
+// Get window position XY on monitor
+Vector2 GetWindowPosition(void)
+{
+    int x = 0;
+    int y = 0;
+#if defined(PLATFORM_DESKTOP)
+    glfwGetWindowPos(CORE.Window.handle, &x, &y);
+#endif
+    return (Vector2){ (float)x, (float)y };
+}
+
+// Get window scale DPI factor for current monitor
+Vector2 GetWindowScaleDPI(void)
+{
+    Vector2 scale = { 1.0f, 1.0f };
+
+#if defined(PLATFORM_DESKTOP)
+    float xdpi = 1.0;
+    float ydpi = 1.0;
+    Vector2 windowPos = GetWindowPosition();
+
+    int monitorCount = 0;
+    GLFWmonitor **monitors = glfwGetMonitors(&monitorCount);
+
+    // Check window monitor
+    for (int i = 0; i < monitorCount; i++)
+    {
+        glfwGetMonitorContentScale(monitors[i], &xdpi, &ydpi);
+
+        int xpos, ypos, width, height;
+        glfwGetMonitorWorkarea(monitors[i], &xpos, &ypos, &width, &height);
+
+        if ((windowPos.x >= xpos) && (windowPos.x < xpos + width) &&
+            (windowPos.y >= ypos) && (windowPos.y < ypos + height))
+        {
+            scale.x = xdpi;
+            scale.y = ydpi;
+            break;
+        }
+    }
+#endif
+
+    return scale;
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *GetMonitorName(int monitor)
+{
+#if defined(PLATFORM_DESKTOP)
+    int monitorCount;
+    GLFWmonitor **monitors = glfwGetMonitors(&monitorCount);
+
+    if ((monitor >= 0) && (monitor < monitorCount))
+    {
+        return glfwGetMonitorName(monitors[monitor]);
+    }
+    else TRACELOG(LOG_WARNING, "GLFW: Failed to find selected monitor");
+#endif
+    return "";
+}
+
+// Set clipboard text content
+void SetClipboardText(const char *text)
+{
+#if defined(PLATFORM_DESKTOP)
     glfwSetClipboardString(CORE.Window.handle, text);
 #endif
 #if defined(PLATFORM_WEB)
@@ -2119,6 +2974,28 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    AcquireRenderContext();             // Threaded renderer: wait for previous frame presentation
+    CORE.Input.Events.latency = CORE.Input.Events.swapLatency;     // Register latest frame input latency (swap completed)
+    BeginFrameDamage();                 // Setup frame changed region (SetFrameDirtyRect()), drawing could be clipped
+
+    ProcessAsyncLoads(ASYNC_LOAD_FRAME_BUDGET/1000.0);  // Finalize decoded async loads (GPU upload), up to frame budget
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_STREAMING)
+    UpdateTextureStreaming();           // Evict and request streamed textures mipmaps (requested on previous frame)
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UpdateRenderTexturePool();          // Unload pooled render textures not acquired for some frames
+#endif
+
+    rlResetRenderStats();               // Reset render statistics for current frame
+    rlBeginGpuScope("Frame");           // Begin GPU timer scope for current frame (RLGL_ENABLE_GPU_TIMERS)
+
+    // Measure GPU frame time for dynamic resolution scaling, once BeginDynamicResolutionMode() has been used
+    if (CORE.Resolution.queries[CORE.Resolution.query] > 0)
+    {
+        rlBeginTimerQuery(CORE.Resolution.queries[CORE.Resolution.query]);
+        CORE.Resolution.queryActive = true;
+    }
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
@@ -2129,25 +3006,56 @@ void BeginDrawing(void)
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    if (CORE.Resolution.active) EndDynamicResolutionMode();     // Upscale scene drawn at scaled resolution
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    if (screenshotsPendingCount > 0) CollectScreenshots(false);     // Export screenshots readbacks already transferred by GPU
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
     {
-        #define GIF_RECORD_FRAMERATE    10
         gifFrameCounter++;
 
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
+        // Add previous frames readbacks already transferred by GPU, release encoded frames buffers
+        CollectGifFrames(false);
+        ReleaseGifFrames(false);
+
+        // NOTE: We record one gif frame every 1/gifFramerate seconds
+        double time = GetTime();
+
+        if ((time - gifFrameTime) >= 1.0/gifFramerate)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
+            // NOTE: Frame time is not accumulated, avoids recording frames in a burst after a long frame
+            gifFrameTime = time;
+
+            // Queue image data readback for the current frame (from backbuffer)
+            // NOTE: Pixels are retrieved some frames later, once GPU has transferred them
             Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
+            int width = (int)((float)CORE.Window.render.width*scale.x);
+            int height = (int)((float)CORE.Window.render.height*scale.y);
+
+            if (!rlRequestScreenPixels(width, height))
+            {
+                // No free pixel buffer, add pending frames first to keep frames order
+                CollectGifFrames(true);
+
+                if (!rlRequestScreenPixels(width, height) && (width == gifState.width) && (height == gifState.height))
+                {
+                    // Pixel buffers not supported, read image data synchronously, still encoded on loader thread
+                    unsigned char *screenData = rlReadScreenPixels(width, height);
+                    GifFramePending *frame = GetGifFrame();
+
+                    memcpy(frame->pixels, screenData, width*height*4);
+                    frame->pitch = width*4;
+                    EncodeGifFrame(frame);
 
-            RL_FREE(screenData);    // Free image data
+                    RL_FREE(screenData);    // Free image data
+                }
+            }
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -2190,8 +3098,30 @@ void EndDrawing(void)
     }
 #endif
 
+    rlEndGpuScope();                // End GPU timer scope for current frame (RLGL_ENABLE_GPU_TIMERS)
+    rlUpdateGpuScopes();            // Read back available GPU timers results
+    UpdateDynamicResolution();      // Read back available GPU frame time, update resolution scale
+
+    // Register oldest input event processed by current frame, input latency measured on screen buffer swap
+    // NOTE: Events are ordered by time and polled after swap, so they are the ones used to update this frame
+    if ((CORE.Input.Events.queueCount > 0) && !CORE.Damage.skipped)
+    {
+        CORE.Input.Events.swapTime = CORE.Input.Events.queue[0].time;
+        CORE.Input.Events.swapPending = true;
+    }
+
+    if (CORE.Damage.clipped) rlDisableScissorTest();    // Disable frame changed region drawing clip
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
-    SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    // NOTE: Frame not changed (SetFrameDirtyRect() empty region), screen keeps previous frame
+    if (!CORE.Damage.skipped)
+    {
+#if defined(PLATFORM_DESKTOP)
+        if (CORE.Renderer.active) SubmitRenderFrame();  // Frame presented by render thread, update runs in parallel
+        else
+#endif
+        SwapScreenBuffer();             // Copy back buffer to front buffer (screen)
+    }
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -2200,32 +3130,64 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    // Frames are throttled while minimized if fixed update rate is set, simulation keeps running (FLAG_WINDOW_ALWAYS_RUN)
+    double target = CORE.Time.target;
+    if ((CORE.Time.fixedStep > 0.0) && IsWindowMinimized() && (target < 1.0/FIXED_UPDATE_MINIMIZED_FPS)) target = 1.0/FIXED_UPDATE_MINIMIZED_FPS;
+#if defined(PLATFORM_WEB)
+    if (CORE.Time.mainLoop) target = 0.0;   // Frames paced by browser (requestAnimationFrame), no waiting
+#endif
+
+    // Wait for next frame deadline
+    // NOTE: Deadlines are advanced by target time from previous deadline (not from current time),
+    // so wait overshoots are compensated on next frame and do not accumulate as drift
+    if (target > 0.0)
     {
-        WaitTime(CORE.Time.target - CORE.Time.frame);
+        if (CORE.Time.deadline <= 0.0) CORE.Time.deadline = CORE.Time.current - CORE.Time.frame;
+        CORE.Time.deadline += target;
+
+        // Frame took longer than one extra frame time, restart deadlines to avoid catching up with short frames
+        if ((CORE.Time.current - CORE.Time.deadline) > target) CORE.Time.deadline = CORE.Time.current;
+
+        if (CORE.Time.current < CORE.Time.deadline)
+        {
+            WaitUntil(CORE.Time.deadline);
 
-        CORE.Time.current = GetTime();
-        double waitTime = CORE.Time.current - CORE.Time.previous;
-        CORE.Time.previous = CORE.Time.current;
+            CORE.Time.current = GetTime();
+            double waitTime = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
 
-        CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+            CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        }
+    }
+
+    // Fixed update steps for next frame, frame time is consumed by whole steps and remainder is kept
+    if (CORE.Time.fixedStep > 0.0)
+    {
+        CORE.Time.fixedAccumulator += (CORE.Time.frame < FIXED_UPDATE_MAX_TIME)? CORE.Time.frame : FIXED_UPDATE_MAX_TIME;
+        CORE.Time.fixedSteps = (int)(CORE.Time.fixedAccumulator/CORE.Time.fixedStep);
+        CORE.Time.fixedAccumulator -= CORE.Time.fixedSteps*CORE.Time.fixedStep;
     }
 
+#if defined(SUPPORT_FRAME_TIME_STATS)
+    RecordFrameTimeSample();
+#endif
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     // Events recording and playing logic
-    if (eventsRecording) RecordAutomationEvent(CORE.Time.frameCounter);
-    else if (eventsPlaying)
-    {
-        // TODO: When should we play? After/before/replace PollInputEvents()?
-        if (CORE.Time.frameCounter >= eventCount) eventsPlaying = false;
-        PlayAutomationEvent(CORE.Time.frameCounter);
-    }
+    // NOTE: Events are played after PollInputEvents(), same point where input changes are recorded
+    if (eventsRecording) RecordAutomationFrame(CORE.Time.frameCounter - eventStream.frameStart);
+    else if (eventsPlaying) PlayAutomationEvents(CORE.Time.frameCounter - eventStream.frameStart, false);
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    MarkProfileFrame(CORE.Time.frameCounter);
 #endif
 
+    ResetFrameMemory();     // Frame text results expire (TextFormat(), TextJoin()...), next frame starts using frame memory again
+
     CORE.Time.frameCounter++;
 }
 
@@ -2256,6 +3218,7 @@ void EndMode2D(void)
 void BeginMode3D(Camera camera)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlBeginGpuScope("Mode3D");      // Begin GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPushMatrix();                 // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -2295,6 +3258,7 @@ void BeginMode3D(Camera camera)
 void EndMode3D(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuScope();                // End GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
@@ -2312,7 +3276,16 @@ void BeginTextureMode(RenderTexture2D target)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+    // Suspend frame changed region clip, only screen drawing is clipped
+    if (CORE.Damage.clipped && !CORE.Damage.clipSuspended)
+    {
+        rlDisableScissorTest();
+        CORE.Damage.clipSuspended = true;
+    }
+    rlBeginGpuScope("TextureMode"); // Begin GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
+
     rlEnableFramebuffer(target.id); // Enable render target
+    CORE.Window.currentFboId = target.id;
 
     // Set viewport and RLGL internal framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -2341,8 +3314,21 @@ void BeginTextureMode(RenderTexture2D target)
 void EndTextureMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuScope();                // End GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    ResolveRenderTexture(CORE.Window.currentFboId);    // Resolve multisample render texture, transient attachments are not stored
+#endif
     rlDisableFramebuffer();         // Disable render target (fbo)
+    CORE.Window.currentFboId = 0;
+
+    // Restore frame changed region clip for screen drawing
+    if (CORE.Damage.clipSuspended)
+    {
+        rlEnableScissorTest();
+        rlScissor((int)CORE.Damage.clip.x, (int)CORE.Damage.clip.y, (int)CORE.Damage.clip.width, (int)CORE.Damage.clip.height);
+        CORE.Damage.clipSuspended = false;
+    }
 
     // Set viewport to default framebuffer size
     SetupViewport(CORE.Window.render.width, CORE.Window.render.height);
@@ -2356,11 +3342,13 @@ void EndTextureMode(void)
 void BeginShaderMode(Shader shader)
 {
     rlSetShader(shader.id, shader.locs);
+    rlBeginGpuScope("ShaderMode");  // Begin GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
 }
 
 // End custom shader mode (returns to default shader)
 void EndShaderMode(void)
 {
+    rlEndGpuScope();                // End GPU timer scope (RLGL_ENABLE_GPU_TIMERS)
     rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
@@ -2379,33 +3367,195 @@ void EndBlendMode(void)
 
 // Begin scissor mode (define screen area for following drawing)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
+// NOTE: On screen drawing, scissor is intersected with frame changed region clip (SetFrameDirtyRect())
 void BeginScissorMode(int x, int y, int width, int height)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlEnableScissorTest();
 
-#if defined(__APPLE__)
-    Vector2 scale = GetWindowScaleDPI();
-    rlScissor((int)(x*scale.x), (int)(GetScreenHeight()*scale.y - (((y + height)*scale.y))), (int)(width*scale.x), (int)(height*scale.y));
-#else
-    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
-    {
-        Vector2 scale = GetWindowScaleDPI();
-        rlScissor((int)(x*scale.x), (int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (int)(width*scale.x), (int)(height*scale.y));
-    }
-    else
+    Rectangle rec = GetScissorRec(x, y, width, height);
+
+    if (CORE.Damage.clipped && !CORE.Damage.clipSuspended)
     {
-        rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
+        float right = fminf(rec.x + rec.width, CORE.Damage.clip.x + CORE.Damage.clip.width);
+        float top = fminf(rec.y + rec.height, CORE.Damage.clip.y + CORE.Damage.clip.height);
+
+        rec.x = fmaxf(rec.x, CORE.Damage.clip.x);
+        rec.y = fmaxf(rec.y, CORE.Damage.clip.y);
+        rec.width = fmaxf(right - rec.x, 0.0f);
+        rec.height = fmaxf(top - rec.y, 0.0f);
     }
-#endif
+
+    rlScissor((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height);
+
+    CORE.Window.scissor = (Rectangle){ (float)x, (float)y, (float)width, (float)height };
+    CORE.Window.scissorEnabled = true;
 }
 
 // End scissor mode
+// NOTE: On screen drawing, frame changed region clip is restored
 void EndScissorMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
-    rlDisableScissorTest();
+
+    if (CORE.Damage.clipped && !CORE.Damage.clipSuspended) rlScissor((int)CORE.Damage.clip.x, (int)CORE.Damage.clip.y, (int)CORE.Damage.clip.width, (int)CORE.Damage.clip.height);
+    else rlDisableScissorTest();
+
+    CORE.Window.scissorEnabled = false;
+}
+
+// Get scissor mode area (screen coordinates), returns false if scissor mode is not enabled
+// NOTE: Not exposed in raylib.h, required by text module to cull text lines out of screen area
+bool GetScissorArea(Rectangle *area)
+{
+    if (CORE.Window.scissorEnabled) *area = CORE.Window.scissor;
+
+    return CORE.Window.scissorEnabled;
+}
+
+// Set next frame changed screen region (damage), successive calls add up regions
+// NOTE: It must be called before BeginDrawing(), frame should still be fully drawn:
+//  - Screen drawing is clipped to changed region only if back buffer content is known (buffer age)
+//  - Frame is presented partially, if supported (EGL_KHR_swap_buffers_with_damage)
+//  - An empty region (width/height 0) means nothing changed, screen buffer swap is skipped
+void SetFrameDirtyRect(Rectangle rec)
+{
+    bool empty = ((rec.width <= 0) || (rec.height <= 0));
+
+    if (!CORE.Damage.nextSet || ((CORE.Damage.next.width <= 0) || (CORE.Damage.next.height <= 0)))
+    {
+        CORE.Damage.next = empty? (Rectangle){ 0 } : rec;
+    }
+    else if (!empty)
+    {
+        float right = fmaxf(CORE.Damage.next.x + CORE.Damage.next.width, rec.x + rec.width);
+        float bottom = fmaxf(CORE.Damage.next.y + CORE.Damage.next.height, rec.y + rec.height);
+
+        CORE.Damage.next.x = fminf(CORE.Damage.next.x, rec.x);
+        CORE.Damage.next.y = fminf(CORE.Damage.next.y, rec.y);
+        CORE.Damage.next.width = right - CORE.Damage.next.x;
+        CORE.Damage.next.height = bottom - CORE.Damage.next.y;
+    }
+
+    CORE.Damage.nextSet = true;
+}
+
+// Begin drawing scene at dynamic resolution
+// NOTE: Scene is drawn into an internal framebuffer at a scaled render size, upscaled to screen
+// by EndDynamicResolutionMode(), following drawing (UI) happens at native resolution.
+// Scale is updated every frame from GPU frame time (timer queries), aiming to target frame time,
+// drawing coordinates are kept in screen space. Render textures can not be drawn inside this mode
+void BeginDynamicResolutionMode(void)
+{
+    if (CORE.Resolution.active || !LoadDynamicResolution()) return;
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    // Suspend frame changed region clip, only screen drawing is clipped
+    if (CORE.Damage.clipped && !CORE.Damage.clipSuspended)
+    {
+        rlDisableScissorTest();
+        CORE.Damage.clipSuspended = true;
+    }
+
+    int width = (int)((float)CORE.Resolution.width*CORE.Resolution.scale + 0.5f);
+    int height = (int)((float)CORE.Resolution.height*CORE.Resolution.scale + 0.5f);
+    CORE.Resolution.current[0] = (width < 1)? 1 : width;
+    CORE.Resolution.current[1] = (height < 1)? 1 : height;
+
+    rlEnableFramebuffer(CORE.Resolution.fbo);
+    CORE.Window.currentFboId = CORE.Resolution.fbo;
+
+    // NOTE: Projection is not changed, only viewport is scaled,
+    // scene is drawn in the bottom-left region of the framebuffer
+    rlViewport(0, 0, CORE.Resolution.current[0], CORE.Resolution.current[1]);
+    rlSetFramebufferWidth(CORE.Resolution.current[0]);
+    rlSetFramebufferHeight(CORE.Resolution.current[1]);
+
+    CORE.Window.currentFbo.width = CORE.Resolution.current[0];
+    CORE.Window.currentFbo.height = CORE.Resolution.current[1];
+
+    CORE.Resolution.active = true;
+}
+
+// End drawing scene at dynamic resolution, scene is upscaled to screen
+// NOTE: Upscale is bilinear, sharpened if requested, EndDrawing() ends the mode if still active
+void EndDynamicResolutionMode(void)
+{
+    if (!CORE.Resolution.active) return;
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlDisableFramebuffer();         // Disable scene framebuffer (fbo)
+    CORE.Window.currentFboId = 0;
+    CORE.Resolution.active = false;
+
+    // Restore frame changed region clip for screen drawing
+    if (CORE.Damage.clipSuspended)
+    {
+        rlEnableScissorTest();
+        rlScissor((int)CORE.Damage.clip.x, (int)CORE.Damage.clip.y, (int)CORE.Damage.clip.width, (int)CORE.Damage.clip.height);
+        CORE.Damage.clipSuspended = false;
+    }
+
+    // Set viewport to default framebuffer size
+    SetupViewport(CORE.Window.render.width, CORE.Window.render.height);
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    // Scene region texture coordinates and texel size, samples are clamped to region
+    float u = (float)CORE.Resolution.current[0]/(float)CORE.Resolution.width;
+    float v = (float)CORE.Resolution.current[1]/(float)CORE.Resolution.height;
+    float region[4] = { u, v, 1.0f/(float)CORE.Resolution.width, 1.0f/(float)CORE.Resolution.height };
+
+    if (CORE.Resolution.shader.id > 0)
+    {
+        rlSetShader(CORE.Resolution.shader.id, CORE.Resolution.shader.locs);
+        SetShaderValue(CORE.Resolution.shader, CORE.Resolution.locs[0], region, SHADER_UNIFORM_VEC4);
+        SetShaderValue(CORE.Resolution.shader, CORE.Resolution.locs[1], &CORE.Resolution.sharpness, SHADER_UNIFORM_FLOAT);
+    }
+
+    // Draw scene region over the full render area, framebuffer rows are bottom-up
+    rlDisableColorBlend();
+    rlSetTexture(CORE.Resolution.texture);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlTexCoord2f(0.0f, v);
+        rlVertex2f(0.0f, 0.0f);
+        rlTexCoord2f(0.0f, 0.0f);
+        rlVertex2f(0.0f, (float)CORE.Window.render.height);
+        rlTexCoord2f(u, 0.0f);
+        rlVertex2f((float)CORE.Window.render.width, (float)CORE.Window.render.height);
+        rlTexCoord2f(u, v);
+        rlVertex2f((float)CORE.Window.render.width, 0.0f);
+    rlEnd();
+    rlSetTexture(0);
+    rlDrawRenderBatchActive();
+    rlEnableColorBlend();
+
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+
+    // Restore screen scaling for following screen drawing
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));
+}
+
+// Set dynamic resolution scaling parameters
+// NOTE: targetTime is the GPU frame time aimed in seconds (0: target FPS time, 1/60 if not set),
+// minScale limits the render size scale (0.1f..1.0f), sharpness is the upscale sharpening (0.0f: bilinear)
+void SetDynamicResolution(float targetTime, float minScale, float sharpness)
+{
+    CORE.Resolution.targetTime = (targetTime > 0.0f)? targetTime : 0.0;
+    CORE.Resolution.minScale = (minScale < 0.1f)? 0.1f : ((minScale > 1.0f)? 1.0f : minScale);
+    CORE.Resolution.sharpness = (sharpness < 0.0f)? 0.0f : ((sharpness > 1.0f)? 1.0f : sharpness);
+
+    if ((CORE.Resolution.scale > 0.0f) && (CORE.Resolution.scale < CORE.Resolution.minScale)) CORE.Resolution.scale = CORE.Resolution.minScale;
+}
+
+// Get current dynamic resolution scale (render size scale used for scene drawing)
+float GetDynamicResolutionScale(void)
+{
+    return (CORE.Resolution.scale > 0.0f)? CORE.Resolution.scale : 1.0f;
 }
 
 // Begin VR drawing configuration
@@ -2424,6 +3574,15 @@ void EndVrStereoMode(void)
     rlDisableStereoRender();
 }
 
+// Set stereo rendering in a single pass, eyes drawn as instances
+// NOTE: Only shaders declaring mvpStereo uniform are drawn in a single pass (default shader supported),
+// other shaders keep being drawn once per eye
+void SetVrStereoSinglePass(bool enabled)
+{
+    if (enabled) rlEnableStereoSinglePass();
+    else rlDisableStereoSinglePass();
+}
+
 // Load VR stereo config for VR simulator device parameters
 VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device)
 {
@@ -2529,60 +3688,113 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     Shader shader = { 0 };
 
+#if defined(SUPPORT_SHADER_CACHE)
+    shader.id = LoadShaderCodeCached(vsCode, fsCode);
+#else
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+#endif
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
     {
-        // Default shader attribute locations have been binded before linking:
-        //          vertex position location    = 0
-        //          vertex texcoord location    = 1
-        //          vertex normal location      = 2
-        //          vertex color location       = 3
-        //          vertex tangent location     = 4
-        //          vertex texcoord2 location   = 5
+        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        SetShaderDefaultLocations(shader.id, shader.locs);
+    }
 
-        // NOTE: If any location is not found, loc point becomes -1
+    return shader;
+}
 
-        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+// Load shader from files without waiting for compilation/linkage (check with IsShaderReady() before use)
+Shader LoadShaderAsync(const char *vsFileName, const char *fsFileName)
+{
+    Shader shader = { 0 };
 
-        // All locations reset to -1 (no location)
-        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+    char *vShaderStr = NULL;
+    char *fShaderStr = NULL;
 
-        // Get handles to GLSL input attribute locations
-        shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-        shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-        shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-        shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    if (vsFileName != NULL) vShaderStr = LoadFileText(vsFileName);
+    if (fsFileName != NULL) fShaderStr = LoadFileText(fsFileName);
 
-        // Get handles to GLSL uniform locations (vertex shader)
-        shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
-        shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
-        shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
-        shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    shader = LoadShaderFromMemoryAsync(vShaderStr, fShaderStr);
 
-        // Get handles to GLSL uniform locations (fragment shader)
-        shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
-        shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
-        shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
-    }
+    UnloadFileText(vShaderStr);
+    UnloadFileText(fShaderStr);
 
     return shader;
 }
 
-// Check if a shader is ready
-bool IsShaderReady(Shader shader)
+// Load shader from code strings without waiting for compilation/linkage (check with IsShaderReady() before use)
+// NOTE: Driver compiles shaders in parallel (if KHR_parallel_shader_compile supported) while loading continues,
+// default locations are set once IsShaderReady() reports the shader as completed
+Shader LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode)
 {
-    return ((shader.id > 0) &&          // Validate shader id (loaded successfully)
-            (shader.locs != NULL));     // Validate memory has been allocated for default shader locations
+    Shader shader = { 0 };
 
-    // The following locations are tried to be set automatically (locs[i] >= 0),
-    // any of them can be checked for validation but the only mandatory one is, afaik, SHADER_LOC_VERTEX_POSITION
-    // NOTE: Users can also setup manually their own attributes/uniforms and do not used the default raylib ones
+    // Default shader requested, nothing to compile
+    if ((vsCode == NULL) && (fsCode == NULL)) return LoadShaderFromMemory(vsCode, fsCode);
+
+    if (shadersPendingCount >= MAX_SHADERS_PENDING)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Maximum shaders pending reached (%i), loading shader synchronously", MAX_SHADERS_PENDING);
+        return LoadShaderFromMemory(vsCode, fsCode);
+    }
+
+    unsigned long long cacheKey = 0;
+
+#if defined(SUPPORT_SHADER_CACHE)
+    if (shaderCacheDirectory[0] != '\0')
+    {
+        cacheKey = rlGetShaderBinaryKey(vsCode, fsCode);
+        shader.id = LoadShaderCacheBinary(cacheKey);
+
+        if (shader.id > 0)
+        {
+            shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+            SetShaderDefaultLocations(shader.id, shader.locs);
+
+            return shader;
+        }
+    }
+#endif
+
+    shader.id = rlLoadShaderCodeAsync(vsCode, fsCode);
+
+    if (shader.id > 0)
+    {
+        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+        // All locations reset to -1 (no location), they are set on completion
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+        shadersPending[shadersPendingCount].shader = shader;
+        shadersPending[shadersPendingCount].cacheKey = cacheKey;
+        shadersPendingCount++;
+    }
+
+    return shader;
+}
+
+// Check if a shader is ready
+// NOTE: Shaders loading asynchronously are ready once driver has completed compilation/linkage (non-blocking)
+bool IsShaderReady(Shader shader)
+{
+    for (int i = 0; i < shadersPendingCount; i++)
+    {
+        if (shadersPending[i].shader.id == shader.id)
+        {
+            if (!rlIsShaderProgramCompleted(shader.id)) return false;
+
+            FinishShaderPending(i);
+            break;
+        }
+    }
+
+    return ((shader.id > 0) &&          // Validate shader id (loaded successfully)
+            (shader.locs != NULL));     // Validate memory has been allocated for default shader locations
+
+    // The following locations are tried to be set automatically (locs[i] >= 0),
+    // any of them can be checked for validation but the only mandatory one is, afaik, SHADER_LOC_VERTEX_POSITION
+    // NOTE: Users can also setup manually their own attributes/uniforms and do not used the default raylib ones
 
     // Vertex shader attribute locations (default)
     // shader.locs[SHADER_LOC_VERTEX_POSITION]      // Set by default internal shader
@@ -2609,6 +3821,17 @@ bool IsShaderReady(Shader shader)
 // Unload shader from GPU memory (VRAM)
 void UnloadShader(Shader shader)
 {
+    // Remove shader from pending list, in case it was loading asynchronously
+    for (int i = 0; i < shadersPendingCount; i++)
+    {
+        if (shadersPending[i].shader.id == shader.id)
+        {
+            shadersPending[i] = shadersPending[shadersPendingCount - 1];
+            shadersPendingCount--;
+            break;
+        }
+    }
+
     if (shader.id != rlGetShaderIdDefault())
     {
         rlUnloadShaderProgram(shader.id);
@@ -2618,6 +3841,24 @@ void UnloadShader(Shader shader)
     }
 }
 
+// Set shader program binaries cache directory (NULL to disable)
+// NOTE: Shaders loaded later are retrieved from the cache, missing or rejected binaries are compiled and cached
+void SetShaderCacheDirectory(const char *dirPath)
+{
+#if defined(SUPPORT_SHADER_CACHE)
+    if ((dirPath == NULL) || (dirPath[0] == '\0')) shaderCacheDirectory[0] = '\0';
+    else
+    {
+        strncpy(shaderCacheDirectory, dirPath, MAX_FILEPATH_LENGTH - 1);
+        shaderCacheDirectory[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+        if (!DirectoryExists(shaderCacheDirectory)) TRACELOG(LOG_WARNING, "SHADER: Cache directory does not exist: %s", shaderCacheDirectory);
+    }
+#else
+    TRACELOG(LOG_WARNING, "SHADER: Shader cache not supported, SUPPORT_SHADER_CACHE not defined");
+#endif
+}
+
 // Get shader uniform location
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
@@ -2669,6 +3910,26 @@ void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture)
     }
 }
 
+// Set shader uniform value for texture array
+void SetShaderValueTextureArray(Shader shader, int locIndex, Texture2DArray texture)
+{
+    if (locIndex > -1)
+    {
+        rlEnableShader(shader.id);
+        rlSetUniformSamplerType(locIndex, texture.id, RL_TEXTURE_2D_ARRAY);
+    }
+}
+
+// Set shader uniform value for 3d texture
+void SetShaderValueTexture3D(Shader shader, int locIndex, Texture3D texture)
+{
+    if (locIndex > -1)
+    {
+        rlEnableShader(shader.id);
+        rlSetUniformSamplerType(locIndex, texture.id, RL_TEXTURE_3D);
+    }
+}
+
 // Get a ray trace from mouse position
 Ray GetMouseRay(Vector2 mouse, Camera camera)
 {
@@ -2683,34 +3944,17 @@ Ray GetMouseRay(Vector2 mouse, Camera camera)
     // Store values in a vector
     Vector3 deviceCoords = { x, y, z };
 
-    // Calculate view matrix from camera look at
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
-
-    Matrix matProj = MatrixIdentity();
-
-    if (camera.projection == CAMERA_PERSPECTIVE)
-    {
-        // Calculate projection matrix from perspective
-        matProj = MatrixPerspective(camera.fovy*DEG2RAD, ((double)GetScreenWidth()/(double)GetScreenHeight()), RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
-    }
-    else if (camera.projection == CAMERA_ORTHOGRAPHIC)
-    {
-        float aspect = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
-        double top = camera.fovy/2.0;
-        double right = top*aspect;
-
-        // Calculate projection matrix from orthographic
-        matProj = MatrixOrtho(-right, right, -top, top, 0.01, 1000.0);
-    }
+    // Get view-projection matrices and inverse (reused while camera does not change)
+    CameraViewProj viewProj = GetCameraViewProjection(camera, GetScreenWidth(), GetScreenHeight());
 
     // Unproject far/near points
-    Vector3 nearPoint = Vector3Unproject((Vector3){ deviceCoords.x, deviceCoords.y, 0.0f }, matProj, matView);
-    Vector3 farPoint = Vector3Unproject((Vector3){ deviceCoords.x, deviceCoords.y, 1.0f }, matProj, matView);
+    Vector3 nearPoint = UnprojectPoint((Vector3){ deviceCoords.x, deviceCoords.y, 0.0f }, viewProj.invViewProj);
+    Vector3 farPoint = UnprojectPoint((Vector3){ deviceCoords.x, deviceCoords.y, 1.0f }, viewProj.invViewProj);
 
     // Unproject the mouse cursor in the near plane.
     // We need this as the source position because orthographic projects, compared to perspective doesn't have a
     // convergence point, meaning that the "eye" of the camera is more like a plane than a point.
-    Vector3 cameraPlanePointerPos = Vector3Unproject((Vector3){ deviceCoords.x, deviceCoords.y, -1.0f }, matProj, matView);
+    Vector3 cameraPlanePointerPos = UnprojectPoint((Vector3){ deviceCoords.x, deviceCoords.y, -1.0f }, viewProj.invViewProj);
 
     // Calculate normalized direction vector
     Vector3 direction = Vector3Normalize(Vector3Subtract(farPoint, nearPoint));
@@ -2758,6 +4002,67 @@ Matrix GetCameraMatrix2D(Camera2D camera)
     return matTransform;
 }
 
+// Get camera view frustum (same projection as BeginMode3D())
+// NOTE: Aspect ratio is taken from current framebuffer (screen or render texture)
+Frustum GetCameraFrustum(Camera camera)
+{
+    Matrix matProj = MatrixIdentity();
+    double aspect = (double)CORE.Window.currentFbo.width/(double)CORE.Window.currentFbo.height;
+
+    if (camera.projection == CAMERA_PERSPECTIVE)
+    {
+        matProj = MatrixPerspective(camera.fovy*DEG2RAD, aspect, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    else if (camera.projection == CAMERA_ORTHOGRAPHIC)
+    {
+        double top = camera.fovy/2.0;
+        double right = top*aspect;
+
+        matProj = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    return GetMatrixFrustum(MatrixMultiply(matView, matProj));
+}
+
+// Get frustum planes from view-projection matrix
+// NOTE: Planes are extracted from clip-space matrix rows (Gribb-Hartmann) and normalized,
+// a model-view-projection matrix provides frustum in model space
+Frustum GetMatrixFrustum(Matrix matrix)
+{
+    Frustum frustum = { 0 };
+
+    // Clip-space coordinates: x' = m0*x + m4*y + m8*z + m12 (rows of transformation)
+    float rowX[4] = { matrix.m0, matrix.m4, matrix.m8, matrix.m12 };
+    float rowY[4] = { matrix.m1, matrix.m5, matrix.m9, matrix.m13 };
+    float rowZ[4] = { matrix.m2, matrix.m6, matrix.m10, matrix.m14 };
+    float rowW[4] = { matrix.m3, matrix.m7, matrix.m11, matrix.m15 };
+
+    // Planes: left, right, bottom, top, near, far (-w <= x, y, z <= w)
+    const float *rows[3] = { rowX, rowY, rowZ };
+
+    for (int i = 0; i < 6; i++)
+    {
+        const float *row = rows[i/2];
+        float sign = (i%2 == 0)? 1.0f : -1.0f;
+        Vector4 plane = { rowW[0] + sign*row[0], rowW[1] + sign*row[1], rowW[2] + sign*row[2], rowW[3] + sign*row[3] };
+        float length = sqrtf(plane.x*plane.x + plane.y*plane.y + plane.z*plane.z);
+
+        if (length > 0.0f)
+        {
+            plane.x /= length;
+            plane.y /= length;
+            plane.z /= length;
+            plane.w /= length;
+        }
+
+        frustum.planes[i] = plane;
+    }
+
+    return frustum;
+}
+
 // Get the screen space position from a 3d world space position
 Vector2 GetWorldToScreen(Vector3 position, Camera camera)
 {
@@ -2769,45 +4074,122 @@ Vector2 GetWorldToScreen(Vector3 position, Camera camera)
 // Get size position for a 3d world space position (useful for texture drawing)
 Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height)
 {
-    // Calculate projection matrix (from perspective instead of frustum
-    Matrix matProj = MatrixIdentity();
+    // Get view-projection matrix (reused while camera and viewport do not change)
+    CameraViewProj viewProj = GetCameraViewProjection(camera, width, height);
+
+    Vector2 screenPosition = { 0 };
+    GetWorldToScreenArray(&position, &screenPosition, 1, &viewProj, NULL);
+
+    return screenPosition;
+}
+
+// Get camera view-projection matrices for a viewport size (same projection as BeginMode3D())
+// NOTE: Last computed matrices are cached, calls with same camera and viewport do not recompute them
+CameraViewProj GetCameraViewProjection(Camera camera, int width, int height)
+{
+    if ((cameraViewProj.width == width) && (cameraViewProj.height == height) &&
+        (memcmp(&cameraViewProj.camera, &camera, sizeof(Camera)) == 0)) return cameraViewProj;
+
+    CameraViewProj viewProj = { 0 };
+    viewProj.camera = camera;
+    viewProj.width = width;
+    viewProj.height = height;
+    viewProj.projection = MatrixIdentity();
+
+    double aspect = (double)width/(double)height;
 
     if (camera.projection == CAMERA_PERSPECTIVE)
     {
         // Calculate projection matrix from perspective
-        matProj = MatrixPerspective(camera.fovy*DEG2RAD, ((double)width/(double)height), RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+        viewProj.projection = MatrixPerspective(camera.fovy*DEG2RAD, aspect, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
     }
     else if (camera.projection == CAMERA_ORTHOGRAPHIC)
     {
-        float aspect = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
         double top = camera.fovy/2.0;
         double right = top*aspect;
 
         // Calculate projection matrix from orthographic
-        matProj = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+        viewProj.projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
     }
 
-    // Calculate view matrix from camera look at (and transpose it)
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    // Calculate view matrix from camera look at
+    viewProj.view = MatrixLookAt(camera.position, camera.target, camera.up);
+    viewProj.viewProj = MatrixMultiply(viewProj.view, viewProj.projection);
+    viewProj.invViewProj = MatrixInvert(viewProj.viewProj);
+
+    cameraViewProj = viewProj;
 
-    // TODO: Why not use Vector3Transform(Vector3 v, Matrix mat)?
+    return viewProj;
+}
 
-    // Convert world position vector to quaternion
-    Quaternion worldPos = { position.x, position.y, position.z, 1.0f };
+// Get screen space positions for many 3d world space positions, returns number of points inside view volume
+// NOTE: Clip flags (ClipFlags) are optionally returned per point, screen position is computed even if clipped
+int GetWorldToScreenArray(const Vector3 *positions, Vector2 *screenPositions, int count, const CameraViewProj *viewProj, unsigned char *clipFlags)
+{
+    int visibleCount = 0;
+    Matrix mat = viewProj->viewProj;
+    float halfWidth = (float)viewProj->width/2.0f;
+    float halfHeight = (float)viewProj->height/2.0f;
 
-    // Transform world position to view
-    worldPos = QuaternionTransform(worldPos, matView);
+    for (int i = 0; i < count; i += 4)
+    {
+        int batchCount = ((count - i) < 4)? (count - i) : 4;
 
-    // Transform result to projection (clip space position)
-    worldPos = QuaternionTransform(worldPos, matProj);
+        // Transform world positions to clip space
+        float cx[4] = { 0 };
+        float cy[4] = { 0 };
+        float cz[4] = { 0 };
+        float cw[4] = { 0 };
 
-    // Calculate normalized device coordinates (inverted y)
-    Vector3 ndcPos = { worldPos.x/worldPos.w, -worldPos.y/worldPos.w, worldPos.z/worldPos.w };
+#if defined(RAYMATH_SIMD)
+        if (batchCount == 4)
+        {
+            const Vector3 *p = &positions[i];
+            RM_FLOAT4 x = RM_SETR(p[0].x, p[1].x, p[2].x, p[3].x);
+            RM_FLOAT4 y = RM_SETR(p[0].y, p[1].y, p[2].y, p[3].y);
+            RM_FLOAT4 z = RM_SETR(p[0].z, p[1].z, p[2].z, p[3].z);
+
+            RM_STORE4(cx, RM_ADD(RM_MADD(RM_SET1(mat.m8), z, RM_MADD(RM_SET1(mat.m4), y, RM_MUL(RM_SET1(mat.m0), x))), RM_SET1(mat.m12)));
+            RM_STORE4(cy, RM_ADD(RM_MADD(RM_SET1(mat.m9), z, RM_MADD(RM_SET1(mat.m5), y, RM_MUL(RM_SET1(mat.m1), x))), RM_SET1(mat.m13)));
+            RM_STORE4(cz, RM_ADD(RM_MADD(RM_SET1(mat.m10), z, RM_MADD(RM_SET1(mat.m6), y, RM_MUL(RM_SET1(mat.m2), x))), RM_SET1(mat.m14)));
+            RM_STORE4(cw, RM_ADD(RM_MADD(RM_SET1(mat.m11), z, RM_MADD(RM_SET1(mat.m7), y, RM_MUL(RM_SET1(mat.m3), x))), RM_SET1(mat.m15)));
+        }
+        else
+#endif
+        {
+            for (int k = 0; k < batchCount; k++)
+            {
+                Vector3 p = positions[i + k];
 
-    // Calculate 2d screen position vector
-    Vector2 screenPosition = { (ndcPos.x + 1.0f)/2.0f*(float)width, (ndcPos.y + 1.0f)/2.0f*(float)height };
+                cx[k] = mat.m0*p.x + mat.m4*p.y + mat.m8*p.z + mat.m12;
+                cy[k] = mat.m1*p.x + mat.m5*p.y + mat.m9*p.z + mat.m13;
+                cz[k] = mat.m2*p.x + mat.m6*p.y + mat.m10*p.z + mat.m14;
+                cw[k] = mat.m3*p.x + mat.m7*p.y + mat.m11*p.z + mat.m15;
+            }
+        }
 
-    return screenPosition;
+        for (int k = 0; k < batchCount; k++)
+        {
+            // Clip against view volume (-w <= x, y, z <= w)
+            unsigned char flags = 0;
+            if (cx[k] < -cw[k]) flags |= CLIP_LEFT;
+            if (cx[k] > cw[k]) flags |= CLIP_RIGHT;
+            if (cy[k] < -cw[k]) flags |= CLIP_BOTTOM;
+            if (cy[k] > cw[k]) flags |= CLIP_TOP;
+            if (cz[k] < -cw[k]) flags |= CLIP_NEAR;
+            if (cz[k] > cw[k]) flags |= CLIP_FAR;
+
+            if (flags == 0) visibleCount++;
+            if (clipFlags != NULL) clipFlags[i + k] = flags;
+
+            // Calculate screen position from normalized device coordinates (inverted y)
+            float invW = 1.0f/cw[k];
+            screenPositions[i + k].x = (cx[k]*invW + 1.0f)*halfWidth;
+            screenPositions[i + k].y = (1.0f - cy[k]*invW)*halfHeight;
+        }
+    }
+
+    return visibleCount;
 }
 
 // Get the screen space position for a 2d camera world space position
@@ -2834,9 +4216,42 @@ void SetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+#if defined(PLATFORM_HEADLESS)
+    CORE.Time.target = 0.0;         // Frame loop is not throttled, frames run as fast as possible
+#endif
+
+    CORE.Time.deadline = 0.0;       // Restart frame deadlines on next frame
+
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
+// Set fixed update rate (steps per second), 0 disables fixed update steps
+// NOTE: Frame time is accumulated and consumed by fixed steps, GetFixedUpdateSteps() steps must be run every frame,
+// render rate is still set by SetTargetFPS() and frames are not rendered while window is minimized
+void SetFixedUpdateRate(int hz)
+{
+    CORE.Time.fixedStep = (hz > 0)? 1.0/(double)hz : 0.0;
+    CORE.Time.fixedAccumulator = 0.0;
+    CORE.Time.fixedSteps = 0;
+}
+
+// Get fixed update steps to run on current frame (0 if fixed update rate not set)
+int GetFixedUpdateSteps(void)
+{
+    return CORE.Time.fixedSteps;
+}
+
+// Get fixed update interpolation factor [0..1), time since last fixed step relative to step time
+// NOTE: Useful to draw states interpolated between previous and current fixed step
+float GetFixedUpdateAlpha(void)
+{
+    float alpha = 1.0f;
+
+    if (CORE.Time.fixedStep > 0.0) alpha = (float)(CORE.Time.fixedAccumulator/CORE.Time.fixedStep);
+
+    return alpha;
+}
+
 // Get current FPS
 // NOTE: We calculate an average framerate
 int GetFPS(void)
@@ -2876,6 +4291,99 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Set number of last frames measured for frame time statistics
+// NOTE: Window is limited to MAX_FRAME_TIME_SAMPLES, recorded samples are reset
+void SetFrameTimeStatsWindow(int frames)
+{
+#if defined(SUPPORT_FRAME_TIME_STATS)
+    if (frames < 1) frames = 1;
+    if (frames > MAX_FRAME_TIME_SAMPLES)
+    {
+        TRACELOG(LOG_WARNING, "TIMER: Frame time stats window limited to %i frames", MAX_FRAME_TIME_SAMPLES);
+        frames = MAX_FRAME_TIME_SAMPLES;
+    }
+
+    frameTimeSamplesWindow = frames;
+    frameTimeSamplesCount = 0;
+    frameTimeSamplesIndex = 0;
+#endif
+}
+
+// Get frame time statistics (percentiles) for last frames
+// NOTE: Frames are measured by EndDrawing(), not available with SUPPORT_CUSTOM_FRAME_CONTROL
+FrameTimeStats GetFrameTimeStats(void)
+{
+    FrameTimeStats stats = { 0 };
+
+#if defined(SUPPORT_FRAME_TIME_STATS)
+    if (frameTimeSamplesCount == 0) return stats;
+
+    float *times = (float *)RL_MALLOC(frameTimeSamplesCount*sizeof(float));
+
+    for (int i = 0; i < frameTimeSamplesCount; i++)
+    {
+        FrameTimeSample sample = frameTimeSamples[i];
+        times[i] = sample.update + sample.draw + sample.wait;
+
+        stats.average += times[i];
+        stats.update += sample.update;
+        stats.draw += sample.draw;
+        stats.wait += sample.wait;
+    }
+
+    qsort(times, frameTimeSamplesCount, sizeof(float), CompareFloat);
+
+    // NOTE: Nearest-rank percentiles
+    stats.frameCount = frameTimeSamplesCount;
+    stats.average /= frameTimeSamplesCount;
+    stats.update /= frameTimeSamplesCount;
+    stats.draw /= frameTimeSamplesCount;
+    stats.wait /= frameTimeSamplesCount;
+    stats.p50 = times[(int)ceilf(0.50f*frameTimeSamplesCount) - 1];
+    stats.p95 = times[(int)ceilf(0.95f*frameTimeSamplesCount) - 1];
+    stats.p99 = times[(int)ceilf(0.99f*frameTimeSamplesCount) - 1];
+    stats.max = times[frameTimeSamplesCount - 1];
+
+    RL_FREE(times);
+#endif
+
+    return stats;
+}
+
+// Export last frames times as CSV file (.csv), times in milliseconds
+bool ExportFrameTimeStats(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FRAME_TIME_STATS)
+    // NOTE: Text data buffer size is estimated considering a maximum of 64 chars per frame line
+    char *txtData = (char *)RL_CALLOC(frameTimeSamplesCount*64 + 64, sizeof(char));
+
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "frame,update,draw,wait,total\n");
+
+    // Export samples in frames order, oldest sample is at next index once window is full
+    int first = (frameTimeSamplesCount < frameTimeSamplesWindow)? 0 : frameTimeSamplesIndex;
+
+    for (int i = 0; i < frameTimeSamplesCount; i++)
+    {
+        FrameTimeSample sample = frameTimeSamples[(first + i)%frameTimeSamplesWindow];
+
+        byteCount += sprintf(txtData + byteCount, "%u,%.3f,%.3f,%.3f,%.3f\n", sample.frame,
+            sample.update*1000.0f, sample.draw*1000.0f, sample.wait*1000.0f, (sample.update + sample.draw + sample.wait)*1000.0f);
+    }
+
+    success = SaveFileText(fileName, txtData);
+
+    RL_FREE(txtData);
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "TIMER: [%s] Frame times exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "TIMER: [%s] Failed to export frame times", fileName);
+
+    return success;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -2886,7 +4394,7 @@ double GetTime(void)
     time = glfwGetTime();   // Elapsed time since glfwInit()
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_HEADLESS)
     struct timespec ts = { 0 };
     clock_gettime(CLOCK_MONOTONIC, &ts);
     unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
@@ -2896,6 +4404,14 @@ double GetTime(void)
     return time;
 }
 
+// Get time of the latest input event registered, in seconds since InitTimer()
+// NOTE: On PLATFORM_RPI/PLATFORM_DRM/PLATFORM_ANDROID the device event timestamp is used,
+// on other platforms time is measured when the event is received (callback)
+double GetInputEventTime(void)
+{
+    return CORE.Input.eventTime;
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process.
@@ -2910,34 +4426,62 @@ void SetConfigFlags(unsigned int flags)
 // NOTE TRACELOG() function is located in [utils.h]
 
 // Takes a screenshot of current screen (saved a .png)
+// NOTE: Screen pixels are read back through a pixel buffer (if supported) and exported on async loader thread,
+// file is saved some frames later, pending screenshots are completed on CloseWindow()
 void TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
+    AcquireRenderContext();     // Threaded renderer: screen pixels read, OpenGL context required
+
     // Security check to (partially) avoid malicious code on PLATFORM_WEB
     if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character");  return; }
 
-    Vector2 scale = GetWindowScaleDPI();
-    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    if (screenshotsPendingCount == MAX_SCREENSHOTS_PENDING) CollectScreenshots(true);
 
-    char path[2048] = { 0 };
-    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
 
-    ExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
+    ScreenshotPending *screenshot = (ScreenshotPending *)RL_CALLOC(1, sizeof(ScreenshotPending));
+    strcpy(screenshot->path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
+    screenshot->request = -1;
 
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+#if defined(SUPPORT_GIF_RECORDING)
+    // NOTE: Readback pixel buffers are shared with GIF recording, screenshot read synchronously while recording
+    if (!gifRecording)
 #endif
+    {
+        screenshot->readback = rlRequestScreenPixels(width, height);
+    }
+
+    screenshotsPending[screenshotsPendingCount] = screenshot;
+    screenshotsPendingCount++;
 
-    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    if (!screenshot->readback)
+    {
+        // Pixel buffers not supported or no free buffer, read image data synchronously
+        screenshot->image = (Image){ rlReadScreenPixels(width, height), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        ExportScreenshot(screenshot);
+    }
 #else
     TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
 #endif
 }
 
+// Set GIF recording framerate (frames per second), recording started with CTRL+F12
+// NOTE: GIF frames delay is defined in centiseconds, framerate limited to 50 fps (most viewers slow down faster GIFs)
+void SetGifRecordingFramerate(int fps)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (fps < 1) fps = 1;
+    else if (fps > 50) fps = 50;
+
+    gifFramerate = fps;
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: GIF recording not supported (SUPPORT_GIF_RECORDING)");
+#endif
+}
+
 // Get a random value between min and max (both included)
 // WARNING: Ranges higher than RAND_MAX will return invalid results
 // More specifically, if (max - min) > INT_MAX there will be an overflow,
@@ -2970,6 +4514,8 @@ bool FileExists(const char *fileName)
 {
     bool result = false;
 
+    if (GetPackFileInfo(fileName, NULL)) return true;     // File found in mounted pack files
+
 #if defined(_WIN32)
     if (_access(fileName, 0) != -1) result = true;
 #else
@@ -3039,6 +4585,9 @@ int GetFileLength(const char *fileName)
 {
     int size = 0;
 
+    unsigned int packSize = 0;
+    if (GetPackFileInfo(fileName, &packSize)) return (int)packSize;    // File found in mounted pack files
+
     FILE *file = fopen(fileName, "rb");
 
     if (file != NULL)
@@ -3264,66 +4813,65 @@ const char *GetApplicationDirectory(void)
 
 // Load directory filepaths
 // NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
 // No recursive scanning is done!
 FilePathList LoadDirectoryFiles(const char *dirPath)
 {
-    FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
-
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
+    FilePathScan scan = { 0 };
 
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
+    // NOTE: Directory paths are also registered
+    if (DirectoryExists(dirPath)) ScanDirectoryFiles(dirPath, &scan, NULL, NULL);
     else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
 
-    return files;
+    return LoadScanPaths(&scan);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Filter is parsed once, paths are stored in a single strings arena (no capacity limit),
+// on recursive scanning base path subdirectories are scanned in parallel by jobs system (if initialized)
 FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    FilePathList files = { 0 };
-
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+    FilePathScan scan = { 0 };
+    FileFilter fileFilter = { 0 };
+    LoadFileFilter(filter, &fileFilter);
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    if (scanSubdirs)
+    {
+        FilePathScan dirs = { 0 };
+        ScanDirectoryFiles(basePath, &scan, &fileFilter, &dirs);
 
-    return files;
+        if (dirs.count > 0)
+        {
+            FilePathScan *scans = (FilePathScan *)RL_CALLOC(dirs.count, sizeof(FilePathScan));
+            FileScanJob job = { &dirs, scans, &fileFilter };
+            JobParallelFor((int)dirs.count, ScanDirectoriesJob, &job);
+
+            // Merge subdirectories paths, in subdirectories scan order
+            for (unsigned int i = 0; i < dirs.count; i++)
+            {
+                for (unsigned int j = 0; j < scans[i].count; j++) AddScanPath(&scan, scans[i].data + scans[i].offsets[j]);
+
+                RL_FREE(scans[i].data);
+                RL_FREE(scans[i].offsets);
+            }
+
+            RL_FREE(scans);
+        }
+
+        RL_FREE(dirs.data);
+        RL_FREE(dirs.offsets);
+    }
+    else ScanDirectoryFiles(basePath, &scan, &fileFilter, NULL);
+
+    return LoadScanPaths(&scan);
 }
 
 // Unload directory filepaths
+// NOTE: All paths strings are stored in a single arena, starting at paths[0]
 // WARNING: files.count is not reseted to 0 after unloading
 void UnloadDirectoryFiles(FilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
+    if ((files.paths != NULL) && (files.capacity > 0)) RL_FREE(files.paths[0]);
 
     RL_FREE(files.paths);
 }
@@ -3404,11 +4952,7 @@ unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDa
     unsigned char *compData = NULL;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl sdefl = { 0 };
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
-    *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbwi
+    compData = CompressDataEx(data, dataSize, COMPRESSION_DEFLATE, COMPRESSION_QUALITY_DEFLATE, compDataSize);   // Compression level 8, same as stbwi
 
     TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
@@ -3416,18 +4960,110 @@ unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDa
     return compData;
 }
 
-// Decompress data (DEFLATE algorithm)
-unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
+// Compress data with codec (CompressionCodec) and level (0: codec default)
+// NOTE: DEFLATE output is a raw DEFLATE stream (DecompressData()), LZ4 output is a raw LZ4 block,
+// decompressed size is not stored, it must be provided to DecompressDataCodec()
+unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int codec, int level, int *compDataSize)
 {
-    unsigned char *data = NULL;
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    if ((data == NULL) && (dataSize > 0)) return NULL;
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
-    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
+    if (codec == COMPRESSION_DEFLATE)
+    {
+        // Compress data and generate a valid DEFLATE stream
+        // NOTE: Compressor state is big (~770KB), not on stack
+        struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+        compData = (unsigned char *)RL_CALLOC(sdefl_bound(dataSize), 1);
+        *compDataSize = sdeflate(sdefl, compData, data, dataSize, (level <= 0)? COMPRESSION_QUALITY_DEFLATE : level);
+        RL_FREE(sdefl);
+    }
+    else if (codec == COMPRESSION_LZ4)
+    {
+        // NOTE: Compressor state (~256KB) does not require initialization
+        struct rlz4 *rlz4 = (struct rlz4 *)RL_MALLOC(sizeof(struct rlz4));
+        compData = (unsigned char *)RL_MALLOC(rlz4_bound(dataSize));
+        *compDataSize = rlz4_compress(rlz4, compData, data, dataSize, (level <= 0)? 1 : level);
+        RL_FREE(rlz4);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression codec not supported: %i", codec);
+        return NULL;
+    }
+
+    // Shrink worst-case bounds buffer to compressed size
+    unsigned char *temp = (unsigned char *)RL_REALLOC(compData, (*compDataSize > 0)? *compDataSize : 1);
+    if (temp != NULL) compData = temp;
+
+    TRACELOGD("SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
+#endif
+
+    return compData;
+}
+
+// Decompress data with codec (CompressionCodec)
+// NOTE: dataSize provides expected decompressed size (max buffer size), returns actual decompressed size,
+// LZ4 requires it, DEFLATE uses MAX_DECOMPRESSION_SIZE if not provided (0), memory must be MemFree()
+unsigned char *DecompressDataCodec(const unsigned char *compData, int compDataSize, int codec, int *dataSize)
+{
+    unsigned char *data = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (codec == COMPRESSION_DEFLATE)
+    {
+        if (*dataSize > 0) data = DecompressDataEx(compData, compDataSize, dataSize);
+        else data = DecompressData(compData, compDataSize, dataSize);
+    }
+    else if (codec == COMPRESSION_LZ4)
+    {
+        int capacity = *dataSize;
+        *dataSize = 0;
+
+        if (capacity <= 0)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: LZ4 decompression requires expected data size");
+            return NULL;
+        }
+
+        data = (unsigned char *)RL_MALLOC(capacity);
+        int length = rlz4_decompress(data, capacity, compData, compDataSize);
+
+        if (length < 0)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data");
+            RL_FREE(data);
+            return NULL;
+        }
+
+        *dataSize = length;
+
+        TRACELOGD("SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+    }
+    else
+    {
+        *dataSize = 0;
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression codec not supported: %i", codec);
+    }
+#endif
+
+    return data;
+}
+
+// Decompress data (DEFLATE algorithm)
+unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    // Decompress data from a valid DEFLATE stream
+    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
+    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+
+    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
+    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
     unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
 
     if (temp != NULL) data = temp;
@@ -3441,98 +5077,463 @@ unsigned char *DecompressData(const unsigned char *compData, int compDataSize, i
     return data;
 }
 
+// Decompress data (DEFLATE algorithm) with known output size
+// NOTE: dataSize provides expected decompressed size (max buffer size), returns actual decompressed size,
+// only required memory is allocated, memory must be MemFree()
+unsigned char *DecompressDataEx(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    int capacity = *dataSize;
+    *dataSize = 0;
+
+    if (capacity <= 0) return NULL;
+
+    data = (unsigned char *)RL_MALLOC(capacity);
+    int length = sinflate(data, capacity, compData, compDataSize);
+
+    if (length < 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data");
+        RL_FREE(data);
+        return NULL;
+    }
+
+    *dataSize = length;
+
+    TRACELOGD("SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+#endif
+
+    return data;
+}
+
+// Compress data in chunks (DEFLATE algorithm), compressed chunks are streamed through callback
+// NOTE: Every chunk is an independent DEFLATE stream with a header: [compSize: 4 bytes][dataSize: 4 bytes],
+// memory required is bounded by chunkSize (0: COMPRESSION_STREAM_CHUNK_SIZE), use DecompressDataStream()
+bool CompressDataStream(const unsigned char *data, int dataSize, int chunkSize, DataStreamCallback callback, void *userData)
+{
+    bool success = false;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((data == NULL) || (dataSize <= 0) || (callback == NULL)) return false;
+    if (chunkSize <= 0) chunkSize = COMPRESSION_STREAM_CHUNK_SIZE;
+
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));   // NOTE: Compressor state is big (~770KB), not on stack
+    unsigned char *chunk = (unsigned char *)RL_MALLOC(8 + sdefl_bound(chunkSize));
+
+    success = true;
+
+    for (int offset = 0; (offset < dataSize) && success; offset += chunkSize)
+    {
+        int size = (dataSize - offset < chunkSize)? dataSize - offset : chunkSize;
+        int compSize = sdeflate(sdefl, chunk + 8, data + offset, size, COMPRESSION_QUALITY_DEFLATE);
+
+        memcpy(chunk, &compSize, 4);
+        memcpy(chunk + 4, &size, 4);
+
+        success = callback(chunk, 8 + compSize, userData);
+    }
+
+    RL_FREE(chunk);
+    RL_FREE(sdefl);
+
+    if (!success) TRACELOG(LOG_WARNING, "SYSTEM: Compress data stream stopped by callback");
+#endif
+
+    return success;
+}
+
+// Decompress data in chunks (DEFLATE algorithm), decompressed chunks are streamed through callback
+// NOTE: Data must be generated by CompressDataStream(), memory required is bounded by chunks size
+bool DecompressDataStream(const unsigned char *compData, int compDataSize, DataStreamCallback callback, void *userData)
+{
+    bool success = false;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((compData == NULL) || (compDataSize <= 0) || (callback == NULL)) return false;
+
+    unsigned char *chunk = NULL;
+    unsigned char *tail = NULL;
+    int chunkCapacity = 0;
+    int offset = 0;
+
+    success = true;
+
+    while ((offset < compDataSize) && success)
+    {
+        int compSize = 0;
+        int size = 0;
+
+        if ((compDataSize - offset) >= 8)
+        {
+            memcpy(&compSize, compData + offset, 4);
+            memcpy(&size, compData + offset + 4, 4);
+        }
+
+        if ((compSize <= 0) || (size <= 0) || (compSize > (compDataSize - offset - 8)))
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Decompress data stream: Chunk header not valid");
+            success = false;
+            break;
+        }
+
+        if (size > chunkCapacity)
+        {
+            RL_FREE(chunk);
+            chunk = (unsigned char *)RL_MALLOC(size);
+            chunkCapacity = size;
+        }
+
+        // WARNING: sinfl reads input in 8 bytes words and could read up to 15 bytes past chunk end,
+        // chunks close to compressed data end are copied to a padded buffer
+        const unsigned char *input = compData + offset + 8;
+
+        if ((offset + 8 + compSize + 16) > compDataSize)
+        {
+            tail = (unsigned char *)RL_CALLOC(compSize + 16, 1);
+            memcpy(tail, input, compSize);
+            input = tail;
+        }
+
+        int length = sinflate(chunk, size, input, compSize);
+
+        RL_FREE(tail);
+        tail = NULL;
+
+        if (length != size)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Decompress data stream: Failed to decompress chunk");
+            success = false;
+            break;
+        }
+
+        success = callback(chunk, size, userData);
+        offset += 8 + compSize;
+    }
+
+    RL_FREE(chunk);
+#endif
+
+    return success;
+}
+
+// Get Base64 encoded string size for input data size (padding included, no null terminator)
+int GetDataBase64EncodedSize(int dataSize)
+{
+    return 4*((dataSize + 2)/3);
+}
+
+// Get exact decoded data size for Base64 string, computed from string size and padding characters
+// NOTE: Strings without padding are supported, last incomplete group (2 or 3 characters) is decoded
+int GetDataBase64DecodedSize(const unsigned char *data, int dataSize)
+{
+    if ((data == NULL) || (dataSize <= 0)) return 0;
+
+    int size = 3*(dataSize/4);
+    int remainder = dataSize%4;
+
+    if (remainder == 0)
+    {
+        if (data[dataSize - 1] == '=') size--;
+        if ((dataSize > 1) && (data[dataSize - 2] == '=')) size--;
+    }
+    else if (remainder > 1) size += remainder - 1;   // Unpadded string, 2 characters: 1 byte, 3 characters: 2 bytes
+
+    return size;
+}
+
 // Encode data to Base64 string
+// NOTE: Returned string is not null terminated, outputSize provides its size
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
-    static const unsigned char base64encodeTable[] = {
+    *outputSize = GetDataBase64EncodedSize(dataSize);
+
+    char *encodedData = (char *)RL_MALLOC(*outputSize);
+
+    if (encodedData == NULL) return NULL;
+
+    EncodeDataBase64Into(data, dataSize, encodedData, *outputSize);
+
+    return encodedData;
+}
+
+// Decode Base64 string data
+// NOTE: Input string must be null terminated
+unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
+{
+    int dataSize = (int)strlen((const char *)data);
+    int outSize = GetDataBase64DecodedSize(data, dataSize);
+
+    // Allocate memory to store decoded Base64 data
+    unsigned char *decodedData = (unsigned char *)RL_MALLOC((outSize > 0)? outSize : 1);
+
+    if (decodedData != NULL) outSize = DecodeDataBase64Into(data, dataSize, decodedData, outSize);
+
+    *outputSize = outSize;
+    return decodedData;
+}
+
+// Encode data to Base64 string into provided buffer, returns encoded size (0: buffer too small)
+// NOTE: Required buffer size is GetDataBase64EncodedSize(dataSize), string is not null terminated
+int EncodeDataBase64Into(const unsigned char *data, int dataSize, char *output, int outputSize)
+{
+    static const char base64encodeTable[64] = {
         'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
         'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
         'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
     };
 
-    static const int modTable[] = { 0, 2, 1 };
+    int encodedSize = GetDataBase64EncodedSize(dataSize);
+
+    if ((output == NULL) || (outputSize < encodedSize))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Base64 encoding buffer too small (required: %i bytes)", encodedSize);
+        return 0;
+    }
 
-    *outputSize = 4*((dataSize + 2)/3);
+    int i = 0;
+    int j = 0;
 
-    char *encodedData = (char *)RL_MALLOC(*outputSize);
+#if defined(RCORE_SIMD_AVX2)
+    // Encode 24 bytes into 32 characters per iteration, 12 bytes per 128bit lane
+    // NOTE: 28 bytes loaded (two 16 bytes loads), last 4 bytes ignored
+    while ((i + 28) <= dataSize)
+    {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(data + i))), _mm_loadu_si128((const __m128i *)(data + i + 12)), 1);
 
-    if (encodedData == NULL) return NULL;
+        // Split 3 bytes groups into 4 bytes, containing 6 bits indices
+        in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        __m256i indexAC = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i indexBD = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(indexAC, indexBD);
+
+        // Map indices to characters, adding range offset: [0..25] 'A', [26..51] 'a', [52..61] '0', 62 '+', 63 '/'
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        __m256i offsets = _mm256_shuffle_epi8(_mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                                               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), range);
+
+        _mm256_storeu_si256((__m256i *)(output + j), _mm256_add_epi8(indices, offsets));
 
-    for (int i = 0, j = 0; i < dataSize;)
+        i += 24;
+        j += 32;
+    }
+#endif
+#if defined(RCORE_SIMD_SSSE3)
+    // Encode 12 bytes into 16 characters per iteration
+    // NOTE: 16 bytes loaded, last 4 bytes ignored
+    while ((i + 16) <= dataSize)
     {
-        unsigned int octetA = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetB = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetC = (i < dataSize)? (unsigned char)data[i++] : 0;
+        __m128i in = _mm_loadu_si128((const __m128i *)(data + i));
 
-        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
+        // Split 3 bytes groups into 4 bytes, containing 6 bits indices
+        in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        __m128i indexAC = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        __m128i indexBD = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(indexAC, indexBD);
+
+        // Map indices to characters, adding range offset: [0..25] 'A', [26..51] 'a', [52..61] '0', 62 '+', 63 '/'
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+        __m128i offsets = _mm_shuffle_epi8(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), range);
 
-        encodedData[j++] = base64encodeTable[(triple >> 3*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 2*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 1*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 0*6) & 0x3F];
+        _mm_storeu_si128((__m128i *)(output + j), _mm_add_epi8(indices, offsets));
+
+        i += 12;
+        j += 16;
     }
+#elif defined(RCORE_SIMD_NEON)
+    // Encode 48 bytes into 64 characters per iteration, bytes deinterleaved by 3 and characters interleaved by 4
+    uint8x16x4_t table = { { vld1q_u8((const uint8_t *)base64encodeTable), vld1q_u8((const uint8_t *)base64encodeTable + 16),
+                             vld1q_u8((const uint8_t *)base64encodeTable + 32), vld1q_u8((const uint8_t *)base64encodeTable + 48) } };
+    uint8x16_t mask = vdupq_n_u8(0x3f);
+
+    while ((i + 48) <= dataSize)
+    {
+        uint8x16x3_t in = vld3q_u8(data + i);
+        uint8x16x4_t out;
 
-    for (int i = 0; i < modTable[dataSize%3]; i++) encodedData[*outputSize - 1 - i] = '=';  // Padding character
+        out.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        out.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+        out.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], mask));
 
-    return encodedData;
+        vst4q_u8((uint8_t *)(output + j), out);
+
+        i += 48;
+        j += 64;
+    }
+#endif
+
+    // Encode remaining bytes, last group padded
+    for (; i < dataSize; i += 3, j += 4)
+    {
+        unsigned int octetA = data[i];
+        unsigned int octetB = ((i + 1) < dataSize)? data[i + 1] : 0;
+        unsigned int octetC = ((i + 2) < dataSize)? data[i + 2] : 0;
+
+        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
+
+        output[j] = base64encodeTable[(triple >> 3*6) & 0x3F];
+        output[j + 1] = base64encodeTable[(triple >> 2*6) & 0x3F];
+        output[j + 2] = ((i + 1) < dataSize)? base64encodeTable[(triple >> 1*6) & 0x3F] : '=';   // Padding character
+        output[j + 3] = ((i + 2) < dataSize)? base64encodeTable[(triple >> 0*6) & 0x3F] : '=';   // Padding character
+    }
+
+    return encodedSize;
 }
 
-// Decode Base64 string data
-unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
+// Decode Base64 string data into provided buffer, returns decoded size (0: buffer too small)
+// NOTE: Required buffer size is GetDataBase64DecodedSize(data, dataSize), invalid characters are decoded as 0
+int DecodeDataBase64Into(const unsigned char *data, int dataSize, unsigned char *output, int outputSize)
 {
-    static const unsigned char base64decodeTable[] = {
+    static const unsigned char base64decodeTable[256] = {
         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
         11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
         37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
     };
 
-    // Get output size of Base64 input data
-    int outSize = 0;
-    for (int i = 0; data[4*i] != 0; i++)
+    int decodedSize = GetDataBase64DecodedSize(data, dataSize);
+
+    if ((output == NULL) || (outputSize < decodedSize))
     {
-        if (data[4*i + 3] == '=')
-        {
-            if (data[4*i + 2] == '=') outSize += 1;
-            else outSize += 2;
-        }
-        else outSize += 3;
+        TRACELOG(LOG_WARNING, "SYSTEM: Base64 decoding buffer too small (required: %i bytes)", decodedSize);
+        return 0;
     }
 
-    // Allocate memory to store decoded Base64 data
-    unsigned char *decodedData = (unsigned char *)RL_MALLOC(outSize);
+    int i = 0;
+    int j = 0;
+
+    // NOTE: SIMD kernels only decode complete groups (last group could be padded), blocks with invalid characters
+    // are decoded by scalar code, so results are the same with and without SIMD
+#if defined(RCORE_SIMD_SSSE3)
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+#endif
+#if defined(RCORE_SIMD_AVX2)
+    // Decode 32 characters into 24 bytes per iteration, 16 characters per 128bit lane
+    // NOTE: Lanes 12 bytes results stored with 16 bytes stores, 28 bytes written
+    while (((i + 32) < dataSize) && ((j + 28) <= outputSize))
+    {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(data + i));
+
+        // Validate characters, classified by low and high nibbles
+        __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi8(0x0f));
+        __m256i loClass = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(lutLo), _mm256_and_si256(in, _mm256_set1_epi8(0x0f)));
+        __m256i hiClass = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(lutHi), hiNibbles);
+        if (!_mm256_testz_si256(loClass, hiClass)) break;
+
+        // Map characters to 6 bits values, adding range offset ('/' handled apart, same high nibble than '+')
+        __m256i roll = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(lutRoll), _mm256_add_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('/')), hiNibbles));
+        __m256i values = _mm256_add_epi8(in, roll);
+
+        // Pack 4 values of 6 bits into 3 bytes
+        __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i *)(output + j), _mm256_castsi256_si128(merged));
+        _mm_storeu_si128((__m128i *)(output + j + 12), _mm256_extracti128_si256(merged, 1));
 
-    for (int i = 0; i < outSize/3; i++)
+        i += 32;
+        j += 24;
+    }
+#endif
+#if defined(RCORE_SIMD_SSSE3)
+    // Decode 16 characters into 12 bytes per iteration
+    // NOTE: 12 bytes result stored with a 16 bytes store
+    while (((i + 16) < dataSize) && ((j + 16) <= outputSize))
+    {
+        __m128i in = _mm_loadu_si128((const __m128i *)(data + i));
+
+        // Validate characters, classified by low and high nibbles
+        __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+        __m128i loClass = _mm_shuffle_epi8(lutLo, _mm_and_si128(in, _mm_set1_epi8(0x0f)));
+        __m128i hiClass = _mm_shuffle_epi8(lutHi, hiNibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(loClass, hiClass), _mm_setzero_si128())) != 0) break;
+
+        // Map characters to 6 bits values, adding range offset ('/' handled apart, same high nibble than '+')
+        __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), hiNibbles));
+        __m128i values = _mm_add_epi8(in, roll);
+
+        // Pack 4 values of 6 bits into 3 bytes
+        __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i *)(output + j), merged);
+
+        i += 16;
+        j += 12;
+    }
+#elif defined(RCORE_SIMD_NEON)
+    // Decode 64 characters into 48 bytes per iteration, characters deinterleaved by 4 and bytes interleaved by 3
+    // NOTE: Characters mapped through 128 entries table (0xff: invalid), non-ASCII characters detected by high bit
+    static const unsigned char base64decodeTableNeon[128] = {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 62, 255, 255, 255, 63,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 255, 255, 255, 255, 255, 255, 255, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+        14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 255, 255, 255, 255, 255, 255, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 255, 255, 255, 255, 255
+    };
+    uint8x16x4_t tableLo = { { vld1q_u8(base64decodeTableNeon), vld1q_u8(base64decodeTableNeon + 16), vld1q_u8(base64decodeTableNeon + 32), vld1q_u8(base64decodeTableNeon + 48) } };
+    uint8x16x4_t tableHi = { { vld1q_u8(base64decodeTableNeon + 64), vld1q_u8(base64decodeTableNeon + 80), vld1q_u8(base64decodeTableNeon + 96), vld1q_u8(base64decodeTableNeon + 112) } };
+
+    while (((i + 64) < dataSize) && ((j + 48) <= outputSize))
     {
-        unsigned char a = base64decodeTable[(int)data[4*i]];
-        unsigned char b = base64decodeTable[(int)data[4*i + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*i + 2]];
-        unsigned char d = base64decodeTable[(int)data[4*i + 3]];
+        uint8x16x4_t in = vld4q_u8(data + i);
+        uint8x16_t invalid = vdupq_n_u8(0);
+
+        for (int k = 0; k < 4; k++)
+        {
+            uint8x16_t value = vqtbx4q_u8(vqtbl4q_u8(tableLo, in.val[k]), tableHi, vsubq_u8(in.val[k], vdupq_n_u8(64)));
+            invalid = vorrq_u8(invalid, vorrq_u8(value, in.val[k]));
+            in.val[k] = value;
+        }
+
+        if (vmaxvq_u8(invalid) >= 0x80) break;
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
 
-        decodedData[3*i] = (a << 2) | (b >> 4);
-        decodedData[3*i + 1] = (b << 4) | (c >> 2);
-        decodedData[3*i + 2] = (c << 6) | d;
+        vst3q_u8(output + j, out);
+
+        i += 64;
+        j += 48;
     }
+#endif
 
-    if (outSize%3 == 1)
+    // Decode remaining complete groups
+    for (; (j + 3) <= decodedSize; i += 4, j += 3)
     {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        decodedData[outSize - 1] = (a << 2) | (b >> 4);
+        unsigned char a = base64decodeTable[data[i]];
+        unsigned char b = base64decodeTable[data[i + 1]];
+        unsigned char c = base64decodeTable[data[i + 2]];
+        unsigned char d = base64decodeTable[data[i + 3]];
+
+        output[j] = (a << 2) | (b >> 4);
+        output[j + 1] = (b << 4) | (c >> 2);
+        output[j + 2] = (c << 6) | d;
     }
-    else if (outSize%3 == 2)
+
+    // Decode last group, padded or incomplete
+    if ((decodedSize - j) >= 1)
     {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*n + 2]];
-        decodedData[outSize - 2] = (a << 2) | (b >> 4);
-        decodedData[outSize - 1] = (b << 4) | (c >> 2);
+        unsigned char a = base64decodeTable[data[i]];
+        unsigned char b = base64decodeTable[data[i + 1]];
+        output[j] = (a << 2) | (b >> 4);
+
+        if ((decodedSize - j) == 2)
+        {
+            unsigned char c = base64decodeTable[data[i + 2]];
+            output[j + 1] = (b << 4) | (c >> 2);
+        }
     }
 
-    *outputSize = outSize;
-    return decodedData;
+    return decodedSize;
 }
 
 // Open URL with default system browser (if available)
@@ -3590,49 +5591,261 @@ void OpenURL(const char *url)
     }
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
-//----------------------------------------------------------------------------------
-// Check if a key has been pressed once
-bool IsKeyPressed(int key)
+// Start automation events recording into file (binary, streamed to disk)
+// NOTE: Recording stores input changes only, a sync record (input state snapshot) is
+// stored every AUTOMATION_EVENTS_SYNC_INTERVAL frames to allow seeking on playing
+bool StartAutomationEventRecording(const char *fileName)
 {
-    bool pressed = false;
+    bool success = false;
 
-    if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    StopAutomationEventRecording();
+    StopAutomationEventPlaying();
 
-    return pressed;
-}
+    FILE *file = fopen(fileName, "wb");
 
-// Check if a key is being pressed (key held down)
-bool IsKeyDown(int key)
-{
-    if (CORE.Input.Keyboard.currentKeyState[key] == 1) return true;
-    else return false;
-}
+    if (file != NULL)
+    {
+        memset(&eventStream, 0, sizeof(AutomationEventStream));
+        eventStream.file = file;
 
-// Check if a key has been released once
-bool IsKeyReleased(int key)
-{
-    bool released = false;
+        // Write file header: "rAEV", version, sync interval
+        unsigned char header[AUTOMATION_EVENTS_HEADER_SIZE] = { 'r', 'A', 'E', 'V', 1, 0, 0, 0,
+            (unsigned char)(AUTOMATION_EVENTS_SYNC_INTERVAL & 0xff), (unsigned char)((AUTOMATION_EVENTS_SYNC_INTERVAL >> 8) & 0xff),
+            (unsigned char)((AUTOMATION_EVENTS_SYNC_INTERVAL >> 16) & 0xff), (unsigned char)((AUTOMATION_EVENTS_SYNC_INTERVAL >> 24) & 0xff), 0, 0, 0, 0 };
+        WriteAutomationBytes(header, AUTOMATION_EVENTS_HEADER_SIZE);
 
-    if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
+        eventStream.frameStart = CORE.Time.frameCounter;
+        RecordAutomationSync(0);
 
-    return released;
-}
+        eventsRecording = true;
+        success = true;
 
-// Check if a key is NOT being pressed (key not held down)
-bool IsKeyUp(int key)
-{
-    if (CORE.Input.Keyboard.currentKeyState[key] == 0) return true;
-    else return false;
+        TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events recording started", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events file for recording", fileName);
+#else
+    TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events automation not supported (SUPPORT_EVENTS_AUTOMATION)", fileName);
+#endif
+
+    return success;
 }
 
-// Get the last key pressed
-int GetKeyPressed(void)
+// Stop automation events recording, sync records index is stored at file end
+void StopAutomationEventRecording(void)
 {
-    int value = 0;
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsRecording) return;
 
-    if (CORE.Input.Keyboard.keyPressedQueueCount > 0)
+    unsigned int frames = CORE.Time.frameCounter - eventStream.frameStart;
+
+    // Write seek points index: [frame][offset] per sync record, count, "rAEI"
+    unsigned char entry[8] = { 0 };
+
+    for (unsigned int i = 0; i <= eventStream.seekPointCount; i++)
+    {
+        unsigned int values[2] = { eventStream.seekPointCount, 0x49454172 };    // Index end: count, "rAEI"
+
+        if (i < eventStream.seekPointCount)
+        {
+            values[0] = eventStream.seekPoints[i].frame;
+            values[1] = eventStream.seekPoints[i].offset;
+        }
+
+        for (int k = 0; k < 8; k++) entry[k] = (unsigned char)((values[k/4] >> (8*(k%4))) & 0xff);
+        WriteAutomationBytes(entry, 8);
+    }
+
+    fwrite(eventStream.buffer, 1, eventStream.bufferSize, eventStream.file);
+    eventStream.offset += eventStream.bufferSize;
+    eventStream.bufferSize = 0;
+
+    fclose(eventStream.file);
+    eventStream.file = NULL;
+
+    TRACELOG(LOG_INFO, "AUTOMATION: Events recording finished: %i events, %i frames, %i bytes", eventStream.eventCount, frames, eventStream.offset);
+
+    RL_FREE(eventStream.seekPoints);
+    eventStream.seekPoints = NULL;
+    eventStream.seekPointCount = 0;
+    eventStream.seekPointCapacity = 0;
+
+    eventsRecording = false;
+#endif
+}
+
+// Start automation events playing from file, events are streamed from disk
+bool StartAutomationEventPlaying(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    StopAutomationEventRecording();
+    StopAutomationEventPlaying();
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        unsigned char header[AUTOMATION_EVENTS_HEADER_SIZE] = { 0 };
+        fread(header, 1, AUTOMATION_EVENTS_HEADER_SIZE, file);
+
+        if ((header[0] == 'r') && (header[1] == 'A') && (header[2] == 'E') && (header[3] == 'V') && (header[4] == 1))
+        {
+            memset(&eventStream, 0, sizeof(AutomationEventStream));
+            eventStream.file = file;
+
+            fseek(file, 0, SEEK_END);
+            unsigned int size = (unsigned int)ftell(file);
+            eventStream.end = size;
+
+            // Load seek points index from file end (not available if recording was not finished)
+            unsigned char trailer[8] = { 0 };
+            fseek(file, (long)size - 8, SEEK_SET);
+
+            if ((size >= (AUTOMATION_EVENTS_HEADER_SIZE + 8)) && (fread(trailer, 1, 8, file) == 8) &&
+                (trailer[4] == 'r') && (trailer[5] == 'A') && (trailer[6] == 'E') && (trailer[7] == 'I'))
+            {
+                unsigned int count = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((unsigned int)trailer[3] << 24);
+
+                if (count <= ((size - AUTOMATION_EVENTS_HEADER_SIZE - 8)/8))
+                {
+                    eventStream.end = size - 8 - count*8;
+                    eventStream.seekPoints = (AutomationSeekPoint *)RL_CALLOC(count, sizeof(AutomationSeekPoint));
+                    fseek(file, (long)eventStream.end, SEEK_SET);
+
+                    for (unsigned int i = 0; (eventStream.seekPoints != NULL) && (i < count); i++)
+                    {
+                        unsigned char entry[8] = { 0 };
+                        if (fread(entry, 1, 8, file) != 8) break;
+
+                        eventStream.seekPoints[i].frame = entry[0] | (entry[1] << 8) | (entry[2] << 16) | ((unsigned int)entry[3] << 24);
+                        eventStream.seekPoints[i].offset = entry[4] | (entry[5] << 8) | (entry[6] << 16) | ((unsigned int)entry[7] << 24);
+                        eventStream.seekPointCount++;
+                    }
+                }
+            }
+            else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events seek index not found, seeking requires playing from start", fileName);
+
+            fseek(file, AUTOMATION_EVENTS_HEADER_SIZE, SEEK_SET);
+            eventStream.offset = AUTOMATION_EVENTS_HEADER_SIZE;
+
+            eventStream.frameStart = CORE.Time.frameCounter;
+            eventStream.nextReady = ReadAutomationEvent(&eventStream.next);
+
+            eventsPlaying = true;
+            success = true;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events playing started (seek points: %i)", fileName, eventStream.seekPointCount);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file not valid", fileName);
+            fclose(file);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events file for playing", fileName);
+#else
+    TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events automation not supported (SUPPORT_EVENTS_AUTOMATION)", fileName);
+#endif
+
+    return success;
+}
+
+// Stop automation events playing
+void StopAutomationEventPlaying(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsPlaying) return;
+
+    fclose(eventStream.file);
+    eventStream.file = NULL;
+
+    RL_FREE(eventStream.seekPoints);
+    eventStream.seekPoints = NULL;
+    eventStream.seekPointCount = 0;
+
+    eventsPlaying = false;
+#endif
+}
+
+// Seek automation events playing to frame, next frame played is the requested one
+// NOTE: Input state is restored from nearest previous sync record, following events are
+// applied up to requested frame skipping transient events (queues, wheel, window actions)
+bool SeekAutomationEventPlaying(unsigned int frame)
+{
+    bool success = false;
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsPlaying) return false;
+
+    AutomationSeekPoint seekPoint = { 0, AUTOMATION_EVENTS_HEADER_SIZE };
+
+    for (unsigned int i = 0; i < eventStream.seekPointCount; i++)
+    {
+        if ((eventStream.seekPoints[i].frame <= frame) && (eventStream.seekPoints[i].frame >= seekPoint.frame)) seekPoint = eventStream.seekPoints[i];
+    }
+
+    fseek(eventStream.file, (long)seekPoint.offset, SEEK_SET);
+    eventStream.offset = seekPoint.offset;
+    eventStream.bufferSize = 0;
+    eventStream.bufferPosition = 0;
+    eventStream.frame = 0;
+    memset(eventStream.params, 0, sizeof(eventStream.params));
+
+    eventStream.nextReady = ReadAutomationEvent(&eventStream.next);
+    if (frame > 0) PlayAutomationEvents(frame - 1, true);
+
+    eventStream.frameStart = CORE.Time.frameCounter - frame;
+    success = eventStream.nextReady;
+#endif
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
+//----------------------------------------------------------------------------------
+// Check if a key has been pressed once
+bool IsKeyPressed(int key)
+{
+    bool pressed = false;
+
+    if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
+
+    return pressed;
+}
+
+// Check if a key is being pressed (key held down)
+bool IsKeyDown(int key)
+{
+    if (CORE.Input.Keyboard.currentKeyState[key] == 1) return true;
+    else return false;
+}
+
+// Check if a key has been released once
+bool IsKeyReleased(int key)
+{
+    bool released = false;
+
+    if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
+
+    return released;
+}
+
+// Check if a key is NOT being pressed (key not held down)
+bool IsKeyUp(int key)
+{
+    if (CORE.Input.Keyboard.currentKeyState[key] == 0) return true;
+    else return false;
+}
+
+// Get the last key pressed
+int GetKeyPressed(void)
+{
+    int value = 0;
+
+    if (CORE.Input.Keyboard.keyPressedQueueCount > 0)
     {
         // Get character from the queue head
         value = CORE.Input.Keyboard.keyPressedQueue[0];
@@ -4005,6 +6218,31 @@ int GetTouchPointCount(void)
     return CORE.Input.Touch.pointCount;
 }
 
+// Get number of input events registered by last PollInputEvents()
+int GetInputEventCount(void)
+{
+    return CORE.Input.Events.queueCount;
+}
+
+// Get input event registered by last PollInputEvents()
+// NOTE: Events are ordered by time, event index 0 is the oldest one
+InputEvent GetInputEvent(int index)
+{
+    InputEvent event = { 0 };
+
+    if ((index >= 0) && (index < CORE.Input.Events.queueCount)) event = CORE.Input.Events.queue[index];
+
+    return event;
+}
+
+// Get time in seconds from input events to screen buffer swap
+// NOTE: Measured from the oldest input event processed by the frame to its SwapScreenBuffer() completion,
+// registered for latest frame presenting input events (display scanout is not included)
+float GetInputLatency(void)
+{
+    return CORE.Input.Events.latency;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -4024,17 +6262,19 @@ static bool InitGraphicsDevice(int width, int height)
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwSetErrorCallback(ErrorCallback);
-/*
-    // TODO: Setup GLFW custom allocators to match raylib ones
+
+#if defined(PLATFORM_DESKTOP)
+    // Setup GLFW allocators to match raylib ones, redirected by SetMemoryAllocator()
+    // NOTE: Emscripten GLFW implementation (PLATFORM_WEB) does not support custom allocators
     const GLFWallocator allocator = {
-        .allocate = MemAlloc,
-        .deallocate = MemFree,
-        .reallocate = MemRealloc,
+        .allocate = GlfwAllocateCallback,
+        .reallocate = GlfwReallocateCallback,
+        .deallocate = GlfwDeallocateCallback,
         .user = NULL
     };
 
     glfwInitAllocator(&allocator);
-*/
+#endif
 #if defined(__APPLE__)
     glfwInitHint(GLFW_COCOA_CHDIR_RESOURCES, GLFW_FALSE);
 #endif
@@ -4158,7 +6398,14 @@ static bool InitGraphicsDevice(int width, int height)
     // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
     // The initialization will still happen and possible delays still occur, but before the window is shown, which is a nicer experience.
     // REF: https://github.com/raysan5/raylib/issues/1554
-    if (MAX_GAMEPADS > 0) glfwSetJoystickCallback(NULL);
+    // NOTE: Gamepads connection state is tracked by callback, GLFW only reports changes,
+    // so already connected gamepads are checked once here
+    if (MAX_GAMEPADS > 0)
+    {
+        glfwSetJoystickCallback(JoystickCallback);
+
+        for (int i = 0; i < MAX_GAMEPADS; i++) CORE.Input.Gamepad.ready[i] = glfwJoystickPresent(i);
+    }
 #endif
 
 #if defined(PLATFORM_DESKTOP)
@@ -4357,7 +6604,11 @@ static bool InitGraphicsDevice(int width, int height)
     CORE.Window.gbmDevice = NULL;
     CORE.Window.gbmSurface = NULL;
     CORE.Window.prevBO = NULL;
-    CORE.Window.prevFB = 0;
+    CORE.Window.pendingBO = NULL;
+    CORE.Window.crtcModeSet = false;
+    CORE.Window.atomic = false;
+    CORE.Window.primaryPlane = 0;
+    CORE.Window.planeCount = 0;
 
 #if defined(DEFAULT_GRAPHIC_DEVICE_DRM)
     CORE.Window.fd = open(DEFAULT_GRAPHIC_DEVICE_DRM, O_RDWR);
@@ -4488,6 +6739,8 @@ static bool InitGraphicsDevice(int width, int height)
     CORE.Window.render.width = CORE.Window.screen.width;
     CORE.Window.render.height = CORE.Window.screen.height;
 
+    InitDisplayPlanesDRM(res);
+
     drmModeFreeEncoder(enc);
     enc = NULL;
 
@@ -4588,7 +6841,7 @@ static bool InitGraphicsDevice(int width, int height)
     if (!eglChooseConfig(CORE.Window.device, framebufferAttribs, configs, numConfigs, &matchingNumConfigs))
     {
         TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose EGL config: 0x%x", eglGetError());
-        free(configs);
+        RL_FREE(configs);
         return false;
     }
 
@@ -4738,6 +6991,25 @@ static bool InitGraphicsDevice(int width, int height)
     }
     else
     {
+        // Check frame changed region presentation support (SetFrameDirtyRect())
+        const char *eglExtensions = eglQueryString(CORE.Window.device, EGL_EXTENSIONS);
+
+        if (eglExtensions != NULL)
+        {
+            if (strstr(eglExtensions, "EGL_KHR_swap_buffers_with_damage") != NULL) CORE.Window.swapBuffersWithDamage = (EGLBoolean (*)(EGLDisplay, EGLSurface, EGLint *, EGLint))eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+            else if (strstr(eglExtensions, "EGL_EXT_swap_buffers_with_damage") != NULL) CORE.Window.swapBuffersWithDamage = (EGLBoolean (*)(EGLDisplay, EGLSurface, EGLint *, EGLint))eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+
+            CORE.Window.bufferAge = (strstr(eglExtensions, "EGL_EXT_buffer_age") != NULL);
+#if defined(PLATFORM_DRM)
+            // Check dmabuf import support, required for render textures direct scanout (LoadRenderTextureScanout())
+            if ((strstr(eglExtensions, "EGL_KHR_image_base") != NULL) && (strstr(eglExtensions, "EGL_EXT_image_dma_buf_import") != NULL))
+            {
+                CORE.Window.createImage = (PFNEGLCREATEIMAGEKHRPROC)eglGetProcAddress("eglCreateImageKHR");
+                CORE.Window.destroyImage = (PFNEGLDESTROYIMAGEKHRPROC)eglGetProcAddress("eglDestroyImageKHR");
+            }
+#endif
+        }
+
         CORE.Window.render.width = CORE.Window.screen.width;
         CORE.Window.render.height = CORE.Window.screen.height;
         CORE.Window.currentFbo.width = CORE.Window.render.width;
@@ -4751,6 +7023,138 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
 
+#if defined(PLATFORM_HEADLESS)
+    // No display available, screen size is used as display size
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    // Requested frames count from environment, useful for benchmark runs (i.e. RAYLIB_HEADLESS_FRAMES=600)
+    CORE.Window.frameCount = HEADLESS_FRAMES_COUNT;
+    const char *frameCount = getenv("RAYLIB_HEADLESS_FRAMES");
+    if (frameCount != NULL) CORE.Window.frameCount = (unsigned int)atoi(frameCount);
+
+    // Get an EGL device connection, surfaceless platform does not require any display server or device
+    CORE.Window.device = EGL_NO_DISPLAY;
+    const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    if ((clientExtensions != NULL) && (strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL))
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (eglGetPlatformDisplayEXT != NULL) CORE.Window.device = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+
+    if (CORE.Window.device == EGL_NO_DISPLAY) CORE.Window.device = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (CORE.Window.device == EGL_NO_DISPLAY)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return false;
+    }
+
+    if (eglInitialize(CORE.Window.device, NULL, NULL) == EGL_FALSE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return false;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const EGLint renderableType = EGL_OPENGL_ES2_BIT;
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE
+    };
+#else
+    const EGLint renderableType = EGL_OPENGL_BIT;
+    const EGLint contextAttribs[] =
+    {
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_43)
+        EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+        EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+    #endif
+        EGL_NONE
+    };
+#endif
+
+    const EGLint framebufferAttribs[] =
+    {
+        EGL_RENDERABLE_TYPE, renderableType,    // Type of context support
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,      // Offscreen surfaces
+        EGL_RED_SIZE, 8,            // RED color bit depth
+        EGL_GREEN_SIZE, 8,          // GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // ALPHA bit depth
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size (Required to use Depth testing!)
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if ((eglChooseConfig(CORE.Window.device, framebufferAttribs, &CORE.Window.config, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose EGL config: 0x%x", eglGetError());
+        return false;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    eglBindAPI(EGL_OPENGL_ES_API);
+#else
+    eglBindAPI(EGL_OPENGL_API);
+#endif
+
+    CORE.Window.context = eglCreateContext(CORE.Window.device, CORE.Window.config, EGL_NO_CONTEXT, contextAttribs);
+    if (CORE.Window.context == EGL_NO_CONTEXT)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL context: 0x%x", eglGetError());
+        return false;
+    }
+
+    // At this point we need to manage render size vs screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    // Surfaceless context renders into an offscreen framebuffer (created after rlglInit()),
+    // a pbuffer surface of render size is used if surfaceless context is not supported
+    CORE.Window.surface = EGL_NO_SURFACE;
+    const char *displayExtensions = eglQueryString(CORE.Window.device, EGL_EXTENSIONS);
+
+    if ((displayExtensions == NULL) || (strstr(displayExtensions, "EGL_KHR_surfaceless_context") == NULL))
+    {
+        const EGLint surfaceAttribs[] =
+        {
+            EGL_WIDTH, CORE.Window.render.width,
+            EGL_HEIGHT, CORE.Window.render.height,
+            EGL_NONE
+        };
+
+        CORE.Window.surface = eglCreatePbufferSurface(CORE.Window.device, CORE.Window.config, surfaceAttribs);
+        if (CORE.Window.surface == EGL_NO_SURFACE)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL pbuffer surface: 0x%04x", eglGetError());
+            return false;
+        }
+    }
+
+    if (eglMakeCurrent(CORE.Window.device, CORE.Window.surface, CORE.Window.surface, CORE.Window.context) == EGL_FALSE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to attach EGL rendering context");
+        return false;
+    }
+
+    // Disable vsync, frames are not presented
+    if (CORE.Window.surface != EGL_NO_SURFACE) eglSwapInterval(CORE.Window.device, 0);
+
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Headless device initialized successfully (%s)", (CORE.Window.surface == EGL_NO_SURFACE)? "surfaceless" : "pbuffer");
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    if (CORE.Window.frameCount > 0) TRACELOG(LOG_INFO, "    > Frames count: %i", CORE.Window.frameCount);
+#endif  // PLATFORM_HEADLESS
+
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -4767,6 +7171,29 @@ static bool InitGraphicsDevice(int width, int height)
     // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
+#if defined(PLATFORM_HEADLESS)
+    if (CORE.Window.surface == EGL_NO_SURFACE)
+    {
+        // Surfaceless context has no default framebuffer, an offscreen framebuffer is set as default
+        CORE.Window.fbo = rlLoadFramebuffer(CORE.Window.render.width, CORE.Window.render.height);
+
+        CORE.Window.fboTexture = rlLoadTexture(NULL, CORE.Window.render.width, CORE.Window.render.height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        unsigned int depthId = rlLoadTextureDepth(CORE.Window.render.width, CORE.Window.render.height, true);
+
+        rlFramebufferAttach(CORE.Window.fbo, CORE.Window.fboTexture, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(CORE.Window.fbo, depthId, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        if (!rlFramebufferComplete(CORE.Window.fbo))
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Failed to setup headless offscreen framebuffer");
+            return false;
+        }
+
+        rlSetFramebufferDefault(CORE.Window.fbo);
+        rlDisableFramebuffer();         // Bind default framebuffer (offscreen framebuffer)
+    }
+#endif
+
 #if defined(PLATFORM_ANDROID)
     CORE.Window.ready = true;
 #endif
@@ -4893,7 +7320,7 @@ static void InitTimer(void)
     timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_HEADLESS)
     struct timespec now = { 0 };
 
     if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
@@ -4903,62 +7330,304 @@ static void InitTimer(void)
     else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
 #endif
 
+#if defined(_WIN32)
+    // Try to create a high-resolution waitable timer, fallback to Sleep() if not available
+    // NOTE: 0x00000002: CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, 0x001F0003: TIMER_ALL_ACCESS
+    if (CORE.Time.timer == NULL) CORE.Time.timer = CreateWaitableTimerExW(NULL, NULL, 0x00000002, 0x001F0003);
+#endif
+
+#if !defined(SUPPORT_BUSY_WAIT_LOOP)
+    // Calibrate system sleep granularity, measuring the overshoot of some short sleeps
+    CORE.Time.sleepError = 0.0;
+    for (int i = 0; i < 8; i++) WaitUntil(GetTime() + 0.001);
+
+    TRACELOG(LOG_INFO, "TIMER: Sleep granularity: %.03f milliseconds", CORE.Time.sleepError*1000.0);
+#endif
+
     CORE.Time.previous = GetTime();     // Get time as double
+    CORE.Time.deadline = 0.0;
 }
 
 // Wait for some time (stop program execution)
 // NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
-// take longer than expected... for that reason we use the busy wait loop
+// take longer than expected... for that reason sleep overshoot is measured and
+// the remaining time is spent in a busy wait loop (SUPPORT_PARTIALBUSY_WAIT_LOOP)
 // Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
 // Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
 void WaitTime(double seconds)
 {
-#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-    double destinationTime = GetTime() + seconds;
-#endif
+    if (seconds > 0.0) WaitUntil(GetTime() + seconds);
+}
 
+// Wait until time (GetTime() reference)
+// NOTE: Sleep is targeted to wake up before time by the measured sleep overshoot,
+// overshoot estimate grows immediately and decays slowly, so a single late wake up is not repeated
+static void WaitUntil(double time)
+{
 #if defined(SUPPORT_BUSY_WAIT_LOOP)
-    while (GetTime() < destinationTime) { }
+    while (GetTime() < time) { }
 #else
     #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
+        double wakeTime = time - CORE.Time.sleepError;
     #else
-        double sleepSeconds = seconds;
+        double wakeTime = time;
     #endif
 
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned long)(sleepSeconds*1000.0));
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-        struct timespec req = { 0 };
-        time_t sec = sleepSeconds;
-        long nsec = (sleepSeconds - sec)*1000000000L;
-        req.tv_sec = sec;
-        req.tv_nsec = nsec;
+    if (wakeTime > GetTime())
+    {
+        SleepUntil(wakeTime);
+
+        double overshoot = GetTime() - wakeTime;
+        if (overshoot < 0.0) overshoot = 0.0;
+        if (overshoot > 0.02) overshoot = 0.02;     // Limit busy wait time in case of process preemption
+
+        if (overshoot > CORE.Time.sleepError) CORE.Time.sleepError = overshoot;
+        else CORE.Time.sleepError += (overshoot - CORE.Time.sleepError)*0.05;
+    }
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        while (GetTime() < time) { }
+    #endif
+#endif
+}
+
+// Halt program execution until time (GetTime() reference), using system sleep functions
+static void SleepUntil(double time)
+{
+    double seconds = time - GetTime();
+    if (seconds <= 0.0) return;
+
+    #if defined(_WIN32)
+        if (CORE.Time.timer != NULL)
+        {
+            long long dueTime = -(long long)(seconds*10000000.0);   // Relative time, in 100 nanosecond intervals
+
+            if (SetWaitableTimer(CORE.Time.timer, &dueTime, 0, NULL, NULL, 0))
+            {
+                WaitForSingleObject(CORE.Time.timer, 0xFFFFFFFF);   // INFINITE
+                return;
+            }
+        }
+
+        Sleep((unsigned long)(seconds*1000.0));
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__)
+        // NOTE: Absolute deadline sleep on monotonic clock, interruptions resume to same deadline
+        struct timespec req = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &req);
+
+        unsigned long long int nanoSeconds = (unsigned long long int)req.tv_sec*1000000000LLU + (unsigned long long int)req.tv_nsec + (unsigned long long int)(seconds*1e9);
+        req.tv_sec = (time_t)(nanoSeconds/1000000000LLU);
+        req.tv_nsec = (long)(nanoSeconds%1000000000LLU);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &req, NULL) == EINTR) continue;
+    #elif defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+        struct timespec req = { 0 };
+        time_t sec = seconds;
+        long nsec = (seconds - sec)*1000000000L;
+        req.tv_sec = sec;
+        req.tv_nsec = nsec;
 
         // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
         while (nanosleep(&req, &req) == -1) continue;
     #endif
     #if defined(__APPLE__)
-        usleep(sleepSeconds*1000000.0);
+        usleep(seconds*1000000.0);
     #endif
+}
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        while (GetTime() < destinationTime) { }
-    #endif
+#if defined(PLATFORM_DESKTOP)
+// Initialize render thread, frames are presented from it (FLAG_THREADED_RENDERER)
+// NOTE: Main thread submits frames on EndDrawing() and releases OpenGL context, render thread swaps buffers
+// while main thread runs next frame update, context is acquired back on BeginDrawing() once frame is presented.
+// WARNING: Between EndDrawing() and BeginDrawing() main thread does not own OpenGL context,
+// GPU resources (textures, shaders, meshes...) must be loaded/unloaded between BeginDrawing()/EndDrawing()
+static void InitRenderThread(void)
+{
+    bool success = false;
+
+    CORE.Renderer.quit = false;
+    CORE.Renderer.contextOwned = true;
+
+#if defined(_WIN32)
+    CORE.Renderer.frameReady = CreateEventW(NULL, 0, 0, NULL);
+    CORE.Renderer.frameDone = CreateEventW(NULL, 0, 0, NULL);
+
+    if ((CORE.Renderer.frameReady != NULL) && (CORE.Renderer.frameDone != NULL))
+    {
+        CORE.Renderer.thread = CreateThread(NULL, 0, RenderThread, NULL, 0, NULL);
+        success = (CORE.Renderer.thread != NULL);
+    }
+
+    if (!success)
+    {
+        if (CORE.Renderer.frameReady != NULL) CloseHandle(CORE.Renderer.frameReady);
+        if (CORE.Renderer.frameDone != NULL) CloseHandle(CORE.Renderer.frameDone);
+        CORE.Renderer.frameReady = NULL;
+        CORE.Renderer.frameDone = NULL;
+    }
+#else
+    CORE.Renderer.framePending = false;
+    pthread_mutex_init(&CORE.Renderer.mutex, NULL);
+    pthread_cond_init(&CORE.Renderer.cond, NULL);
+
+    success = (pthread_create(&CORE.Renderer.threadId, NULL, &RenderThread, NULL) == 0);
+
+    if (!success)
+    {
+        pthread_cond_destroy(&CORE.Renderer.cond);
+        pthread_mutex_destroy(&CORE.Renderer.mutex);
+    }
+#endif
+
+    CORE.Renderer.active = success;
+
+    if (success) TRACELOG(LOG_INFO, "DISPLAY: Threaded renderer initialized successfully");
+    else
+    {
+        CORE.Window.flags &= ~FLAG_THREADED_RENDERER;
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create render thread, frames presented from main thread");
+    }
+}
+
+// Close render thread, OpenGL context is returned to main thread
+static void CloseRenderThread(void)
+{
+    if (!CORE.Renderer.active) return;
+
+    AcquireRenderContext();
+
+#if defined(_WIN32)
+    CORE.Renderer.quit = true;
+    SetEvent(CORE.Renderer.frameReady);
+    WaitForSingleObject(CORE.Renderer.thread, 0xFFFFFFFF);     // INFINITE
+
+    CloseHandle(CORE.Renderer.thread);
+    CloseHandle(CORE.Renderer.frameReady);
+    CloseHandle(CORE.Renderer.frameDone);
+    CORE.Renderer.thread = NULL;
+    CORE.Renderer.frameReady = NULL;
+    CORE.Renderer.frameDone = NULL;
+#else
+    pthread_mutex_lock(&CORE.Renderer.mutex);
+    CORE.Renderer.quit = true;
+    pthread_cond_broadcast(&CORE.Renderer.cond);
+    pthread_mutex_unlock(&CORE.Renderer.mutex);
+
+    pthread_join(CORE.Renderer.threadId, NULL);
+
+    pthread_cond_destroy(&CORE.Renderer.cond);
+    pthread_mutex_destroy(&CORE.Renderer.mutex);
+#endif
+
+    CORE.Renderer.active = false;
+}
+
+// Submit current frame to render thread, OpenGL context is released
+// NOTE: Render batch data is already submitted, just the buffers swap is done by render thread
+static void SubmitRenderFrame(void)
+{
+    glfwMakeContextCurrent(NULL);       // NOTE: Releasing context flushes pending OpenGL commands
+    CORE.Renderer.contextOwned = false;
+
+#if defined(_WIN32)
+    SetEvent(CORE.Renderer.frameReady);
+#else
+    pthread_mutex_lock(&CORE.Renderer.mutex);
+    CORE.Renderer.framePending = true;
+    pthread_cond_broadcast(&CORE.Renderer.cond);
+    pthread_mutex_unlock(&CORE.Renderer.mutex);
+#endif
+}
+
+// Render thread, presents submitted frames
+#if defined(_WIN32)
+static unsigned long __stdcall RenderThread(void *arg)
+#else
+static void *RenderThread(void *arg)
+#endif
+{
+    while (true)
+    {
+        // Wait for next frame submission
+#if defined(_WIN32)
+        WaitForSingleObject(CORE.Renderer.frameReady, 0xFFFFFFFF);     // INFINITE
+        if (CORE.Renderer.quit) break;
+#else
+        pthread_mutex_lock(&CORE.Renderer.mutex);
+        while (!CORE.Renderer.framePending && !CORE.Renderer.quit) pthread_cond_wait(&CORE.Renderer.cond, &CORE.Renderer.mutex);
+        bool quit = CORE.Renderer.quit;
+        pthread_mutex_unlock(&CORE.Renderer.mutex);
+        if (quit) break;
+#endif
+
+        glfwMakeContextCurrent(CORE.Window.handle);
+        SwapScreenBuffer();                 // Copy back buffer to front buffer (screen)
+        glfwMakeContextCurrent(NULL);
+
+        // Notify frame presentation, context can be acquired by main thread
+#if defined(_WIN32)
+        SetEvent(CORE.Renderer.frameDone);
+#else
+        pthread_mutex_lock(&CORE.Renderer.mutex);
+        CORE.Renderer.framePending = false;
+        pthread_cond_broadcast(&CORE.Renderer.cond);
+        pthread_mutex_unlock(&CORE.Renderer.mutex);
+#endif
+    }
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+#endif  // PLATFORM_DESKTOP
+
+// Wait for render thread to present frame and make OpenGL context current (main thread)
+// NOTE: Nothing to do if threaded renderer is not active or main thread already owns the context
+static void AcquireRenderContext(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (!CORE.Renderer.active || CORE.Renderer.contextOwned) return;
+
+#if defined(_WIN32)
+    WaitForSingleObject(CORE.Renderer.frameDone, 0xFFFFFFFF);      // INFINITE
+#else
+    pthread_mutex_lock(&CORE.Renderer.mutex);
+    while (CORE.Renderer.framePending) pthread_cond_wait(&CORE.Renderer.cond, &CORE.Renderer.mutex);
+    pthread_mutex_unlock(&CORE.Renderer.mutex);
+#endif
+
+    glfwMakeContextCurrent(CORE.Window.handle);
+    CORE.Renderer.contextOwned = true;
 #endif
 }
 
 // Swap back buffer with front buffer (screen drawing)
+// NOTE: Input latency is measured on swap completion, if frame presents input events
 void SwapScreenBuffer(void)
 {
+    PROFILE_BEGIN("SwapScreenBuffer");
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwSwapBuffers(CORE.Window.handle);
 #endif
 
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+#if defined(PLATFORM_DRM)
+    // Previous frame page flip must be completed before presenting a new one,
+    // frame has been processed meanwhile, waiting here just syncs to vblank
+    WaitPageFlipDRM();
+#endif
+
+    if (CORE.Damage.partial && (CORE.Window.swapBuffersWithDamage != NULL))
+    {
+        // Present only frame changed region (bottom-left origin)
+        EGLint rect[4] = { (EGLint)CORE.Damage.current.x, (EGLint)CORE.Damage.current.y, (EGLint)CORE.Damage.current.width, (EGLint)CORE.Damage.current.height };
+        CORE.Window.swapBuffersWithDamage(CORE.Window.device, CORE.Window.surface, rect, 1);
+    }
+    else eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
 
 #if defined(PLATFORM_DRM)
 
@@ -4967,148 +7636,626 @@ void SwapScreenBuffer(void)
     struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
     if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
 
-    uint32_t fb = 0;
-    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
-
-    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+    // NOTE: GBM surface reuses a small set of buffer objects, framebuffers are only created once per buffer
+    uint32_t fb = GetFramebufferDRM(bo);
 
-    if (CORE.Window.prevFB)
+    if (!CORE.Window.crtcModeSet)
     {
-        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+        // First frame requires a full modeset, next frames just flip the scanned out framebuffer
+        int result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+        else CORE.Window.crtcModeSet = true;
+
+        if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+        CORE.Window.prevBO = bo;
+
+        UpdateDisplayPlanesDRM(NULL);
+        FinishDisplayPlanesDRM(true);
     }
+    else if (CORE.Window.atomic)
+    {
+        // Primary plane framebuffer and overlay planes changes presented together on next vblank,
+        // completion event is waited before presenting next frame
+        drmModeAtomicReq *request = drmModeAtomicAlloc();
+        drmModeAtomicAddProperty(request, CORE.Window.primaryPlane, CORE.Window.primaryPlaneFbProp, fb);
+        UpdateDisplayPlanesDRM(request);
 
-    CORE.Window.prevFB = fb;
+        int result = drmModeAtomicCommit(CORE.Window.fd, request, DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT, NULL);
+        drmModeAtomicFree(request);
 
-    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+        if (result != 0)
+        {
+            // Overlay planes configuration could be rejected by driver (format, scaling...), present frame without it
+            TRACELOG(LOG_WARNING, "DISPLAY: drmModeAtomicCommit() failed with result: %d, overlay planes changes discarded", result);
+            FinishDisplayPlanesDRM(false);
+
+            request = drmModeAtomicAlloc();
+            drmModeAtomicAddProperty(request, CORE.Window.primaryPlane, CORE.Window.primaryPlaneFbProp, fb);
+            result = drmModeAtomicCommit(CORE.Window.fd, request, DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT, NULL);
+            drmModeAtomicFree(request);
+        }
+        else FinishDisplayPlanesDRM(true);
+
+        if (result != 0)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: drmModeAtomicCommit() failed with result: %d", result);
+            gbm_surface_release_buffer(CORE.Window.gbmSurface, bo);
+        }
+        else CORE.Window.pendingBO = bo;
+    }
+    else
+    {
+        // Queue page flip on next vblank, completion event is waited before presenting next frame
+        int result = drmModePageFlip(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, DRM_MODE_PAGE_FLIP_EVENT, NULL);
+
+        if (result != 0)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: drmModePageFlip() failed with result: %d", result);
+            gbm_surface_release_buffer(CORE.Window.gbmSurface, bo);
+        }
+        else CORE.Window.pendingBO = bo;
 
-    CORE.Window.prevBO = bo;
+        // NOTE: Legacy planes update could wait for vblank, only done when planes state changes
+        UpdateDisplayPlanesDRM(NULL);
+        FinishDisplayPlanesDRM(true);
+    }
 
 #endif  // PLATFORM_DRM
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
+
+#if defined(PLATFORM_HEADLESS)
+    // NOTE: Offscreen framebuffer is not presented, pbuffer swap does not wait for vsync
+    if (CORE.Window.surface != EGL_NO_SURFACE) eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+#endif
+
+    CORE.Damage.previous = CORE.Damage.current;     // Register presented changed region (buffer age 2 redraw)
+
+    // Measure input latency: oldest input event presented by this frame to swap completion
+    // NOTE: With threaded renderer it is measured by render thread, registered on next BeginDrawing()
+    if (CORE.Input.Events.swapPending)
+    {
+        CORE.Input.Events.swapLatency = (float)(GetTime() - CORE.Input.Events.swapTime);
+        CORE.Input.Events.swapPending = false;
+    }
+
+    PROFILE_END();
 }
 
-// Register all input events
-void PollInputEvents(void)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID) || defined(SUPPORT_EVENTS_AUTOMATION)
+// Set key current state, key change registered for previous state update
+// NOTE: previousKeyState[] matches currentKeyState[] for all keys not registered in the changed queue
+static void SetKeyState(int key, char state)
 {
-#if defined(SUPPORT_GESTURES_SYSTEM)
-    // NOTE: Gestures update must be called every frame to reset gestures correctly
-    // because ProcessGestureEvent() is just called on an event, not every frame
-    UpdateGestures();
-#endif
+    if (CORE.Input.Keyboard.currentKeyState[key] == state) return;
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    CORE.Input.Keyboard.currentKeyState[key] = state;
 
-#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
-    // Reset last gamepad button/axis registered state
-    CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
-    CORE.Input.Gamepad.axisCount = 0;
+    if (CORE.Input.Keyboard.keyChangedQueueCount < MAX_KEY_CHANGED_QUEUE) CORE.Input.Keyboard.keyChangedQueue[CORE.Input.Keyboard.keyChangedQueueCount] = key;
+    CORE.Input.Keyboard.keyChangedQueueCount++;
+}
 #endif
 
+// Register previous keys states, only for keys changed since last frame
+// NOTE: Per frame cost depends on keys events, not on MAX_KEYBOARD_KEYS, unless changed queue overflows
+static void UpdatePreviousKeyStates(void)
+{
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    // NOTE: Keyboard events are read by worker threads writing currentKeyState[] directly, changes can not be registered
+    memcpy(CORE.Input.Keyboard.previousKeyState, CORE.Input.Keyboard.currentKeyState, MAX_KEYBOARD_KEYS);
+#else
+    if (CORE.Input.Keyboard.keyChangedQueueCount > MAX_KEY_CHANGED_QUEUE) memcpy(CORE.Input.Keyboard.previousKeyState, CORE.Input.Keyboard.currentKeyState, MAX_KEYBOARD_KEYS);
+    else
+    {
+        for (int i = 0; i < CORE.Input.Keyboard.keyChangedQueueCount; i++)
+        {
+            int key = CORE.Input.Keyboard.keyChangedQueue[i];
+            CORE.Input.Keyboard.previousKeyState[key] = CORE.Input.Keyboard.currentKeyState[key];
+        }
+    }
+#endif
 
-    PollKeyboardEvents();
+    CORE.Input.Keyboard.keyChangedQueueCount = 0;
+}
 
-    // Register previous mouse states
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+#if !defined(PLATFORM_HEADLESS)
+// Register timestamped input event, available on GetInputEvent() after PollInputEvents()
+// NOTE: Events registered out of PollInputEvents() (PLATFORM_WEB callbacks) are kept pending for next one
+static void RegisterInputEvent(double time, int type, int code, int gamepad, Vector2 value)
+{
+    CORE.Input.eventTime = time;
+
+    if (CORE.Input.Events.pendingCount < MAX_INPUT_EVENTS_QUEUE)
     {
-        CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
-        CORE.Input.Mouse.currentButtonState[i] = CORE.Input.Mouse.currentButtonStateEvdev[i];
+        InputEvent *event = &CORE.Input.Events.pending[CORE.Input.Events.pendingCount];
+        event->time = time;
+        event->type = type;
+        event->code = code;
+        event->gamepad = gamepad;
+        event->value = value;
+
+        CORE.Input.Events.pendingCount++;
     }
+    else CORE.Input.Events.dropped++;
+}
+#endif
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+// Make pending input events available (GetInputEvent()), ordered by time
+// NOTE: Events are registered mostly in order, insertion sort only moves events from different devices
+static void SwapInputEvents(void)
+{
+    if (CORE.Input.Events.dropped > 0)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Input events queue full, %i events dropped", CORE.Input.Events.dropped);
+        CORE.Input.Events.dropped = 0;
+    }
+
+    InputEvent *queue = CORE.Input.Events.queue;
+    int count = CORE.Input.Events.pendingCount;
+
+    for (int i = 0; i < count; i++)
     {
-        if (CORE.Input.Gamepad.ready[i])
+        InputEvent event = CORE.Input.Events.pending[i];
+        int k = i;
+
+        while ((k > 0) && (queue[k - 1].time > event.time))
         {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+            queue[k] = queue[k - 1];
+            k--;
         }
+
+        queue[k] = event;
     }
-#endif
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+    CORE.Input.Events.queueCount = count;
+    CORE.Input.Events.pendingCount = 0;
+}
 
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+// Get scissor rectangle in current framebuffer pixels (bottom-left origin)
+// NOTE: Input rectangle is defined in screen coordinates (top-left origin), HighDPI scaling is considered
+static Rectangle GetScissorRec(int x, int y, int width, int height)
+{
+    Rectangle rec = { 0 };
 
-    // Register previous mouse states
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    if (CORE.Resolution.active)
+    {
+        // Scene drawn at dynamic resolution, screen coordinates scaled to current scene size
+        float scaleX = (float)CORE.Resolution.current[0]/(float)CORE.Window.screen.width;
+        float scaleY = (float)CORE.Resolution.current[1]/(float)CORE.Window.screen.height;
+        rec = (Rectangle){ (float)(int)(x*scaleX), (float)(int)(CORE.Resolution.current[1] - (y + height)*scaleY), (float)(int)(width*scaleX), (float)(int)(height*scaleY) };
 
-    // Register previous mouse wheel state
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+        return rec;
+    }
 
-    // Register previous mouse position
-    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+#if defined(__APPLE__)
+    Vector2 scale = GetWindowScaleDPI();
+    rec = (Rectangle){ (float)(int)(x*scale.x), (float)(int)(GetScreenHeight()*scale.y - (((y + height)*scale.y))), (float)(int)(width*scale.x), (float)(int)(height*scale.y) };
+#else
+    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
+    {
+        Vector2 scale = GetWindowScaleDPI();
+        rec = (Rectangle){ (float)(int)(x*scale.x), (float)(int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (float)(int)(width*scale.x), (float)(int)(height*scale.y) };
+    }
+    else
+    {
+        rec = (Rectangle){ (float)x, (float)(CORE.Window.currentFbo.height - (y + height)), (float)width, (float)height };
+    }
 #endif
 
-    // Register previous touch states
-    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+    return rec;
+}
 
-    // Reset touch positions
-    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
-    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
-    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+// Setup current frame changed region presentation and drawing clip
+// NOTE: Back buffer age (frames since its content was presented) defines the region to be redrawn:
+// age 1 requires current frame changes, age 2 also previous frame changes, age 0 (unknown) full frame
+static void BeginFrameDamage(void)
+{
+    Rectangle screenRec = GetScissorRec(0, 0, CORE.Window.screen.width, CORE.Window.screen.height);
 
-#if defined(PLATFORM_DESKTOP)
-    // Check if gamepads are ready
-    // NOTE: We do it here in case of disconnection
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    CORE.Damage.current = screenRec;
+    CORE.Damage.partial = false;
+    CORE.Damage.clipped = false;
+    CORE.Damage.clipSuspended = false;
+    CORE.Damage.skipped = false;
+
+    // NOTE: Minimized window frames are not visible, drawing is fully clipped and screen buffer swap skipped,
+    // only while fixed update rate is set (simulation keeps running, frames throttled)
+    if ((CORE.Time.fixedStep > 0.0) && IsWindowMinimized())
     {
-        if (glfwJoystickPresent(i)) CORE.Input.Gamepad.ready[i] = true;
-        else CORE.Input.Gamepad.ready[i] = false;
+        CORE.Damage.current = (Rectangle){ 0 };
+        CORE.Damage.clip = (Rectangle){ 0 };
+        CORE.Damage.clipped = true;
+        CORE.Damage.skipped = true;
+        CORE.Damage.nextSet = false;
+
+        rlEnableScissorTest();
+        rlScissor(0, 0, 0, 0);
+        return;
     }
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    // NOTE: After window resize full frame is presented, previous frames content is not valid
+    if (CORE.Damage.nextSet && !IsWindowResized())
     {
-        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
+        Rectangle next = CORE.Damage.next;
+
+        if ((next.width <= 0) || (next.height <= 0))
         {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+            // Nothing changed, drawing is fully clipped and screen buffer swap skipped
+            CORE.Damage.current = (Rectangle){ 0 };
+            CORE.Damage.clip = (Rectangle){ 0 };
+            CORE.Damage.clipped = true;
+            CORE.Damage.skipped = true;
+        }
+        else
+        {
+            // Get changed region in framebuffer pixels, limited to screen, expanded to whole pixels
+            int x = (int)floorf(next.x);
+            int y = (int)floorf(next.y);
+            Rectangle rec = GetScissorRec(x, y, (int)ceilf(next.x + next.width) - x, (int)ceilf(next.y + next.height) - y);
+
+            float right = fminf(rec.x + rec.width, screenRec.x + screenRec.width);
+            float top = fminf(rec.y + rec.height, screenRec.y + screenRec.height);
+            rec.x = fmaxf(rec.x, screenRec.x);
+            rec.y = fmaxf(rec.y, screenRec.y);
+            rec.width = fmaxf(right - rec.x, 0.0f);
+            rec.height = fmaxf(top - rec.y, 0.0f);
+
+            CORE.Damage.current = rec;
+            CORE.Damage.partial = true;
+
+            int bufferAge = 0;
+#if defined(PLATFORM_HEADLESS)
+            bufferAge = 1;      // Offscreen framebuffer content is always preserved
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+            if (CORE.Window.bufferAge) eglQuerySurface(CORE.Window.device, CORE.Window.surface, EGL_BUFFER_AGE_EXT, &bufferAge);
+#endif
+            if (bufferAge == 1) CORE.Damage.clip = rec;
+            else if (bufferAge == 2)
+            {
+                // Back buffer also misses previous frame changes
+                Rectangle prev = CORE.Damage.previous;
+                right = fmaxf(rec.x + rec.width, prev.x + prev.width);
+                top = fmaxf(rec.y + rec.height, prev.y + prev.height);
+
+                CORE.Damage.clip.x = fminf(rec.x, prev.x);
+                CORE.Damage.clip.y = fminf(rec.y, prev.y);
+                CORE.Damage.clip.width = right - CORE.Damage.clip.x;
+                CORE.Damage.clip.height = top - CORE.Damage.clip.y;
+            }
 
-            // Get current gamepad state
-            // NOTE: There is no callback available, so we get it manually
-            // Get remapped buttons
-            GLFWgamepadstate state = { 0 };
-            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+            CORE.Damage.clipped = ((bufferAge == 1) || (bufferAge == 2));
+        }
+    }
 
-            const unsigned char *buttons = state.buttons;
+    CORE.Damage.nextSet = false;
 
-            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
-            {
-                GamepadButton button = -1;
+    if (CORE.Damage.clipped)
+    {
+        rlEnableScissorTest();
+        rlScissor((int)CORE.Damage.clip.x, (int)CORE.Damage.clip.y, (int)CORE.Damage.clip.width, (int)CORE.Damage.clip.height);
+    }
+}
 
-                switch (k)
-                {
-                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+// Load dynamic resolution scene framebuffer, GPU frame time queries and upscale shader
+// NOTE: Framebuffer is allocated at full render size once (reloaded on window resize),
+// scaled resolution only changes the viewport, no reallocation happens when scale changes
+static bool LoadDynamicResolution(void)
+{
+    if (CORE.Resolution.failed) return false;
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
-                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+    if ((CORE.Resolution.fbo > 0) && ((CORE.Resolution.width != (int)CORE.Window.render.width) || (CORE.Resolution.height != (int)CORE.Window.render.height)))
+    {
+        rlUnloadFramebuffer(CORE.Resolution.fbo);   // Depth renderbuffer is unloaded with framebuffer
+        rlUnloadTexture(CORE.Resolution.texture);
+        CORE.Resolution.fbo = 0;
+        CORE.Resolution.texture = 0;
+    }
 
-                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
-                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
-                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+    if (CORE.Resolution.fbo > 0) return true;
 
-                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+    int width = CORE.Window.render.width;
+    int height = CORE.Window.render.height;
+    unsigned int fbo = rlLoadFramebuffer(width, height);
+    unsigned int texture = 0;
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
+    if (fbo > 0)
+    {
+        texture = rlLoadTexture(NULL, width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        unsigned int depth = rlLoadTextureDepth(width, height, true);
+
+        rlFramebufferAttach(fbo, texture, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(fbo, depth, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        if (!rlFramebufferComplete(fbo))
+        {
+            rlUnloadFramebuffer(fbo);
+            rlUnloadTexture(texture);
+            fbo = 0;
+        }
+    }
+
+    if (fbo == 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Dynamic resolution framebuffer can not be created, scene drawn at native resolution");
+        CORE.Resolution.failed = true;
+        return false;
+    }
+
+    rlTextureParameters(texture, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+    rlTextureParameters(texture, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+
+    CORE.Resolution.fbo = fbo;
+    CORE.Resolution.texture = texture;
+    CORE.Resolution.width = width;
+    CORE.Resolution.height = height;
+
+    if (CORE.Resolution.minScale <= 0.0f) CORE.Resolution.minScale = 0.5f;
+    if (CORE.Resolution.scale <= 0.0f) CORE.Resolution.scale = 1.0f;
+
+    if (!CORE.Resolution.loaded)
+    {
+        // GPU frame time queries, scale is kept fixed if not supported
+        if (rlIsTimerQuerySupported())
+        {
+            for (int i = 0; i < DYNAMIC_RESOLUTION_FRAMES; i++) CORE.Resolution.queries[i] = rlLoadTimerQuery();
+        }
+        else TRACELOG(LOG_WARNING, "DISPLAY: GPU timer queries not supported, dynamic resolution scale kept fixed");
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        // Upscale shader, scene region samples are clamped to avoid bleeding
+        // texels out of current region, sharpened by a 4-neighbours unsharp mask
+        const char *upscaleFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+        "#version 120                       \n"
+        "#define TEXTURE texture2D          \n"
+        "#define FRAG_COLOR gl_FragColor    \n"
+        "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+        "#version 330                       \n"
+        "#define TEXTURE texture            \n"
+        "#define FRAG_COLOR finalColor      \n"
+        "in vec2 fragTexCoord;              \n"
+        "out vec4 finalColor;               \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100                       \n"
+        "#ifdef GL_FRAGMENT_PRECISION_HIGH  \n"
+        "precision highp float;             \n"
+        "#else                              \n"
+        "precision mediump float;           \n"
+        "#endif                             \n"
+        "#define TEXTURE texture2D          \n"
+        "#define FRAG_COLOR gl_FragColor    \n"
+        "varying vec2 fragTexCoord;         \n"
+#endif
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 region;               \n"     // xy: Scene region texture coordinates, zw: texel size
+        "uniform float sharpness;           \n"
+        "vec4 SampleRegion(vec2 uv)         \n"
+        "{                                  \n"
+        "    return TEXTURE(texture0, clamp(uv, region.zw*0.5, region.xy - region.zw*0.5)); \n"
+        "}                                  \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 color = SampleRegion(fragTexCoord); \n"
+        "    if (sharpness > 0.0)           \n"
+        "    {                              \n"
+        "        vec3 blur = (SampleRegion(fragTexCoord + vec2(region.z, 0.0)).rgb + SampleRegion(fragTexCoord - vec2(region.z, 0.0)).rgb + \n"
+        "            SampleRegion(fragTexCoord + vec2(0.0, region.w)).rgb + SampleRegion(fragTexCoord - vec2(0.0, region.w)).rgb)*0.25; \n"
+        "        color.rgb = clamp(color.rgb + (color.rgb - blur)*sharpness*2.0, 0.0, 1.0); \n"
+        "    }                              \n"
+        "    FRAG_COLOR = color;            \n"
+        "}                                  \n";
+
+        // NOTE: Failed shader compilation returns default shader, upscale is bilinear only
+        Shader shader = LoadShaderFromMemory(NULL, upscaleFShaderCode);
+
+        if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()))
+        {
+            CORE.Resolution.shader = shader;
+            CORE.Resolution.locs[0] = rlGetLocationUniform(shader.id, "region");
+            CORE.Resolution.locs[1] = rlGetLocationUniform(shader.id, "sharpness");
+        }
+        else TRACELOG(LOG_WARNING, "SHADER: Dynamic resolution upscale shader could not be loaded, bilinear upscale used");
+#endif
+        CORE.Resolution.loaded = true;
+    }
+
+    TRACELOG(LOG_INFO, "DISPLAY: [ID %i] Dynamic resolution framebuffer loaded successfully (%i x %i)", fbo, width, height);
+
+    return true;
+}
+
+// Unload dynamic resolution scene framebuffer, queries and upscale shader
+static void UnloadDynamicResolution(void)
+{
+    if (CORE.Resolution.fbo > 0)
+    {
+        rlUnloadFramebuffer(CORE.Resolution.fbo);   // Depth renderbuffer is unloaded with framebuffer
+        rlUnloadTexture(CORE.Resolution.texture);
+    }
+
+    for (int i = 0; i < DYNAMIC_RESOLUTION_FRAMES; i++) rlUnloadTimerQuery(CORE.Resolution.queries[i]);
+
+    if (CORE.Resolution.shader.id > 0) UnloadShader(CORE.Resolution.shader);
+
+    memset(&CORE.Resolution, 0, sizeof(CORE.Resolution));
+}
+
+// Read back GPU frame time and update resolution scale for next frame
+// NOTE: Oldest query in flight is read without waiting, its frame is dropped if not available yet.
+// GPU time is considered proportional to pixels drawn (scale squared), scale goes down fast
+// on slow frames and up slowly, small changes are ignored to avoid oscillation
+static void UpdateDynamicResolution(void)
+{
+    if (!CORE.Resolution.queryActive) return;
+
+    rlEndTimerQuery();
+    CORE.Resolution.queryIssued[CORE.Resolution.query] = true;
+    CORE.Resolution.queryActive = false;
+
+    CORE.Resolution.query = (CORE.Resolution.query + 1)%DYNAMIC_RESOLUTION_FRAMES;
+    if (!CORE.Resolution.queryIssued[CORE.Resolution.query]) return;
+
+    double time = rlGetTimerQueryResult(CORE.Resolution.queries[CORE.Resolution.query]);
+    if (time <= 0.0) return;
+
+    CORE.Resolution.gpuTime = time;
+
+    double target = (CORE.Resolution.targetTime > 0.0)? CORE.Resolution.targetTime : ((CORE.Time.target > 0.0)? CORE.Time.target : 1.0/60.0);
+    target *= 1000.0*DYNAMIC_RESOLUTION_HEADROOM;
+
+    float scale = CORE.Resolution.scale;
+    float ideal = scale*sqrtf((float)(target/time));
+
+    if (fabsf(ideal - scale) > 0.02f*scale) scale += (ideal - scale)*((ideal < scale)? 0.5f : 0.1f);
+
+    if (scale < CORE.Resolution.minScale) scale = CORE.Resolution.minScale;
+    else if (scale > 1.0f) scale = 1.0f;
+
+    CORE.Resolution.scale = scale;
+}
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+// Register gamepad buttons changes events
+// NOTE: Gamepads state is polled on PollInputEvents(), events time is the polling time
+static void RegisterGamepadButtonEvents(int gamepad)
+{
+    double time = GetTime();
+
+    for (int i = 0; i < MAX_GAMEPAD_BUTTONS; i++)
+    {
+        if (CORE.Input.Gamepad.currentButtonState[gamepad][i] != CORE.Input.Gamepad.previousButtonState[gamepad][i])
+        {
+            RegisterInputEvent(time, CORE.Input.Gamepad.currentButtonState[gamepad][i]? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, i, gamepad, (Vector2){ 0 });
+        }
+    }
+}
+#endif
+
+// Register all input events
+void PollInputEvents(void)
+{
+    PROFILE_BEGIN("PollInputEvents");
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
+    CORE.Input.Gamepad.axisCount = 0;
+#endif
+
+#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    // Register previous keys states
+    UpdatePreviousKeyStates();
+
+    PollKeyboardEvents();
+
+    // Register previous mouse states
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+    memcpy(CORE.Input.Mouse.previousButtonState, CORE.Input.Mouse.currentButtonState, MAX_MOUSE_BUTTONS);
+
+    // Register gamepads buttons events
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        // Register previous gamepad states
+        if (CORE.Input.Gamepad.ready[i]) memcpy(CORE.Input.Gamepad.previousButtonState[i], CORE.Input.Gamepad.currentButtonState[i], MAX_GAMEPAD_BUTTONS);
+    }
+
+    // Process mouse/touch/gamepad events registered by input devices threads
+    PollInputDevicesEvents();
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+
+    // Register previous keys states
+    UpdatePreviousKeyStates();
+
+    // Register previous mouse states
+    memcpy(CORE.Input.Mouse.previousButtonState, CORE.Input.Mouse.currentButtonState, MAX_MOUSE_BUTTONS);
+
+    // Register previous mouse wheel state
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+
+    // Register previous mouse position
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+#endif
+
+#if defined(PLATFORM_HEADLESS)
+    // No input devices available, input states are only changed by automation events playing
+
+    // Register previous keys and mouse states
+    UpdatePreviousKeyStates();
+    memcpy(CORE.Input.Mouse.previousButtonState, CORE.Input.Mouse.currentButtonState, MAX_MOUSE_BUTTONS);
+
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    memcpy(CORE.Input.Gamepad.previousButtonState, CORE.Input.Gamepad.currentButtonState, sizeof(CORE.Input.Gamepad.currentButtonState));
+#endif
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Reset touch positions
+    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
+    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
+    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+
+#if defined(PLATFORM_DESKTOP)
+    // Register gamepads buttons events
+    // NOTE: Only connected gamepads are polled, connection changes are registered by JoystickCallback()
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
+        {
+            // Register previous gamepad states
+            memcpy(CORE.Input.Gamepad.previousButtonState[i], CORE.Input.Gamepad.currentButtonState[i], MAX_GAMEPAD_BUTTONS);
+
+            // Get current gamepad state
+            // NOTE: There is no callback available, so we get it manually
+            // Get remapped buttons
+            GLFWgamepadstate state = { 0 };
+            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+
+            const unsigned char *buttons = state.buttons;
+
+            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
+            {
+                GamepadButton button = -1;
+
+                switch (k)
+                {
+                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
+                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+
+                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
+                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
+                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
                     case GLFW_GAMEPAD_BUTTON_RIGHT_THUMB: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
                     default: break;
                 }
@@ -5137,6 +8284,8 @@ void PollInputEvents(void)
             CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
 
             CORE.Input.Gamepad.axisCount = GLFW_GAMEPAD_AXIS_LAST + 1;
+
+            RegisterGamepadButtonEvents(i);
         }
     }
 
@@ -5160,7 +8309,7 @@ void PollInputEvents(void)
     for (int i = 0; (i < numGamepads) && (i < MAX_GAMEPADS); i++)
     {
         // Register previous gamepad button states
-        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+        memcpy(CORE.Input.Gamepad.previousButtonState[i], CORE.Input.Gamepad.currentButtonState[i], MAX_GAMEPAD_BUTTONS);
 
         EmscriptenGamepadEvent gamepadState;
 
@@ -5215,14 +8364,15 @@ void PollInputEvents(void)
             }
 
             CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
+
+            RegisterGamepadButtonEvents(i);
         }
     }
 #endif
 
 #if defined(PLATFORM_ANDROID)
     // Register previous keys states
-    // NOTE: Android supports up to 260 keys
-    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    UpdatePreviousKeyStates();
 
     // Android ALooper_pollAll() variables
     int pollResult = 0;
@@ -5250,93 +8400,151 @@ void PollInputEvents(void)
 
     if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
 
-    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
-    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
+    // NOTE: Mouse input events reading is done asynchronously in another pthread - EventThread()
+    // NOTE: Gamepad (Joystick) input events reading is done asynchonously in another pthread - GamepadThread()
+    // Events are registered in lock-free rings and processed on PollInputDevicesEvents()
 #endif
+
+    // Input events registered by this polling are available until next one (GetInputEvent())
+    SwapInputEvents();
+
+    PROFILE_END();
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// Parse extensions filter ("png;.jpg") once for directory scanning
+// NOTE: Extensions are stored lowercase and including the dot, same behaviour than IsFileExtension()
+static void LoadFileFilter(const char *filter, FileFilter *fileFilter)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    fileFilter->count = 0;
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    if (filter == NULL) return;
 
-    if (dir != NULL)
+    const char *ext = filter;
+
+    while (*ext != '\0')
     {
-        while ((dp = readdir(dir)) != NULL)
+        const char *end = strchr(ext, ';');
+        if (end == NULL) end = ext + strlen(ext);
+
+        int length = (int)(end - ext);
+
+        if ((length > 0) && (length < 15))
         {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
+            if (fileFilter->count < MAX_FILE_FILTER_EXTENSIONS)
             {
-                sprintf(path, "%s/%s", basePath, dp->d_name);
+                char *dst = fileFilter->exts[fileFilter->count];
+                int k = 0;
 
-                if (filter != NULL)
-                {
-                    if (IsFileExtension(path, filter))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
-                }
-                else
-                {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
-                }
+                if (ext[0] != '.') dst[k++] = '.';
+                for (int c = 0; c < length; c++) dst[k++] = (char)tolower((unsigned char)ext[c]);
+                dst[k] = '\0';
+
+                fileFilter->count++;
             }
+            else TRACELOG(LOG_WARNING, "FILEIO: Directory scan filter extensions limit reached (MAX_FILE_FILTER_EXTENSIONS: %i)", MAX_FILE_FILTER_EXTENSIONS);
         }
 
-        closedir(dir);
+        ext = (*end == ';')? end + 1 : end;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    // NOTE: A filter with no valid extensions matches nothing, same as IsFileExtension()
+    if (fileFilter->count == 0) { fileFilter->count = 1; fileFilter->exts[0][0] = '\0'; }
+}
+
+// Check if file name extension matches filter (not case-sensitive)
+static bool IsFileFilterMatch(const FileFilter *fileFilter, const char *fileName)
+{
+    if (fileFilter == NULL || fileFilter->count == 0) return true;
+
+    const char *dot = strrchr(fileName, '.');
+    if ((dot == NULL) || (dot == fileName)) return false;
+
+    char ext[16] = { 0 };
+    for (int i = 0; (i < 15) && (dot[i] != '\0'); i++) ext[i] = (char)tolower((unsigned char)dot[i]);
+
+    for (int i = 0; i < fileFilter->count; i++)
+    {
+        if (strcmp(ext, fileFilter->exts[i]) == 0) return true;
+    }
+
+    return false;
+}
+
+// Add path to directory scan arena
+static void AddScanPath(FilePathScan *scan, const char *path)
+{
+    unsigned int length = (unsigned int)strlen(path) + 1;
+
+    if ((scan->size + length) > scan->capacity)
+    {
+        unsigned int capacity = (scan->capacity > 0)? scan->capacity*2 : 4096;
+        while ((scan->size + length) > capacity) capacity *= 2;
+
+        char *data = (char *)RL_REALLOC(scan->data, capacity);
+        if (data == NULL) { TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate directory scan memory"); return; }
+
+        scan->data = data;
+        scan->capacity = capacity;
+    }
+
+    if (scan->count >= scan->offsetsCapacity)
+    {
+        unsigned int offsetsCapacity = (scan->offsetsCapacity > 0)? scan->offsetsCapacity*2 : 64;
+
+        unsigned int *offsets = (unsigned int *)RL_REALLOC(scan->offsets, offsetsCapacity*sizeof(unsigned int));
+        if (offsets == NULL) { TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate directory scan memory"); return; }
+
+        scan->offsets = offsets;
+        scan->offsetsCapacity = offsetsCapacity;
+    }
+
+    memcpy(scan->data + scan->size, path, length);
+    scan->offsets[scan->count] = scan->size;
+    scan->size += length;
+    scan->count++;
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+// Scan files and directories in a base path, subdirectories added to dirs (if provided)
+// NOTE: If dirs provided only files are added to scan (recursive scanning), entry type is read from
+// dirent d_type when available, avoiding one stat() per entry
+static void ScanDirectoryFiles(const char *basePath, FilePathScan *scan, const FileFilter *filter, FilePathScan *dirs)
 {
     char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
 
     struct dirent *dp = NULL;
     DIR *dir = opendir(basePath);
 
     if (dir != NULL)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+        while ((dp = readdir(dir)) != NULL)
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+            if ((strcmp(dp->d_name, ".") != 0) &&
+                (strcmp(dp->d_name, "..") != 0))
             {
-                // Construct new path from our base path
-                sprintf(path, "%s/%s", basePath, dp->d_name);
+                snprintf(path, MAX_FILEPATH_LENGTH, "%s/%s", basePath, dp->d_name);
 
-                if (IsPathFile(path))
+                if (dirs != NULL)
                 {
-                    if (filter != NULL)
+                    bool isFile = false;
+                    bool isDirectory = false;
+#if defined(DT_DIR)
+                    if (dp->d_type == DT_REG) isFile = true;
+                    else if (dp->d_type == DT_DIR) isDirectory = true;
+                    else if ((dp->d_type == DT_UNKNOWN) || (dp->d_type == DT_LNK))
+#endif
                     {
-                        if (IsFileExtension(path, filter))
+                        struct stat pathStat = { 0 };
+                        if (stat(path, &pathStat) == 0)
                         {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
+                            isFile = S_ISREG(pathStat.st_mode);
+                            isDirectory = S_ISDIR(pathStat.st_mode);
                         }
                     }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
+                    if (isFile && IsFileFilterMatch(filter, dp->d_name)) AddScanPath(scan, path);
+                    else if (isDirectory) AddScanPath(dirs, path);
                 }
-                else ScanDirectoryFilesRecursively(path, files, filter);
+                else if (IsFileFilterMatch(filter, dp->d_name)) AddScanPath(scan, path);
             }
         }
 
@@ -5345,6 +8553,49 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *fi
     else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
 }
 
+// Scan all files recursively from a base path
+static void ScanDirectoryFilesRecursively(const char *basePath, FilePathScan *scan, const FileFilter *filter)
+{
+    FilePathScan dirs = { 0 };
+
+    ScanDirectoryFiles(basePath, scan, filter, &dirs);
+
+    for (unsigned int i = 0; i < dirs.count; i++) ScanDirectoryFilesRecursively(dirs.data + dirs.offsets[i], scan, filter);
+
+    RL_FREE(dirs.data);
+    RL_FREE(dirs.offsets);
+}
+
+// Scan subdirectories range recursively, jobs system callback
+static void ScanDirectoriesJob(int start, int end, void *userData)
+{
+    FileScanJob *job = (FileScanJob *)userData;
+
+    for (int i = start; i < end; i++) ScanDirectoryFilesRecursively(job->dirs->data + job->dirs->offsets[i], &job->scans[i], job->filter);
+}
+
+// Load directory scan paths as FilePathList, scan arena ownership transferred
+// NOTE: Arena first path is paths[0], required by UnloadDirectoryFiles()
+static FilePathList LoadScanPaths(FilePathScan *scan)
+{
+    FilePathList files = { 0 };
+
+    if (scan->count > 0)
+    {
+        files.capacity = scan->count;
+        files.count = scan->count;
+        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
+
+        for (unsigned int i = 0; i < files.count; i++) files.paths[i] = scan->data + scan->offsets[i];
+    }
+    else RL_FREE(scan->data);
+
+    RL_FREE(scan->offsets);
+    *scan = (FilePathScan){ 0 };
+
+    return files;
+}
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 // GLFW3 Error Callback, runs on GLFW3 error
 static void ErrorCallback(int error, const char *description)
@@ -5352,6 +8603,13 @@ static void ErrorCallback(int error, const char *description)
     TRACELOG(LOG_WARNING, "GLFW: Error: %i Description: %s", error, description);
 }
 
+#if defined(PLATFORM_DESKTOP)
+// GLFW3 allocator callbacks, GLFW memory is managed with raylib memory allocator
+static void *GlfwAllocateCallback(size_t size, void *user) { (void)user; return RL_MALLOC(size); }
+static void *GlfwReallocateCallback(void *block, size_t size, void *user) { (void)user; return RL_REALLOC(block, size); }
+static void GlfwDeallocateCallback(void *block, void *user) { (void)user; RL_FREE(block); }
+#endif
+
 // GLFW3 WindowSize Callback, runs when window is resizedLastFrame
 // NOTE: Window resizing not allowed by default
 static void WindowSizeCallback(GLFWwindow *window, int width, int height)
@@ -5417,15 +8675,17 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 
     // WARNING: GLFW could return GLFW_REPEAT, we need to consider it as 1
     // to work properly with our implementation (IsKeyDown/IsKeyUp checks)
-    if (action == GLFW_RELEASE) CORE.Input.Keyboard.currentKeyState[key] = 0;
-    else CORE.Input.Keyboard.currentKeyState[key] = 1;
+    char state = (action == GLFW_RELEASE)? 0 : 1;
 
 #if !defined(PLATFORM_WEB)
     // WARNING: Check if CAPS/NUM key modifiers are enabled and force down state for those keys
     if (((key == KEY_CAPS_LOCK) && ((mods & GLFW_MOD_CAPS_LOCK) > 0)) ||
-        ((key == KEY_NUM_LOCK) && ((mods & GLFW_MOD_NUM_LOCK) > 0))) CORE.Input.Keyboard.currentKeyState[key] = 1;
+        ((key == KEY_NUM_LOCK) && ((mods & GLFW_MOD_NUM_LOCK) > 0))) state = 1;
 #endif
 
+    SetKeyState(key, state);
+    RegisterInputEvent(GetTime(), (action == GLFW_RELEASE)? INPUT_EVENT_KEY_UP : ((action == GLFW_REPEAT)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN), key, 0, (Vector2){ 0 });
+
     // Check if there is space available in the key queue
     if ((CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE) && (action == GLFW_PRESS))
     {
@@ -5434,6 +8694,12 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
         CORE.Input.Keyboard.keyPressedQueueCount++;
     }
 
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    // Record key state and key queue events (GLFW_REPEAT does not change key state)
+    if (action != GLFW_REPEAT) RecordAutomationEvent(CORE.Input.Keyboard.currentKeyState[key]? INPUT_KEY_DOWN : INPUT_KEY_UP, key, 0, 0);
+    if (action == GLFW_PRESS) RecordAutomationEvent(INPUT_KEY_PRESSED, key, 0, 0);
+#endif
+
     // Check the exit key to set close window
     if ((key == CORE.Input.Keyboard.exitKey) && (action == GLFW_PRESS)) glfwSetWindowShouldClose(CORE.Window.handle, GLFW_TRUE);
 
@@ -5447,6 +8713,7 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
             {
                 gifRecording = false;
 
+                CloseGifFrames();
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
@@ -5462,8 +8729,13 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
             }
             else
             {
+            #if defined(SUPPORT_MODULE_RTEXTURES)
+                CollectScreenshots(true);   // Screenshots readbacks collected, pixel buffers used by recording
+            #endif
+
                 gifRecording = true;
                 gifFrameCounter = 0;
+                gifFrameTime = GetTime();
 
                 Vector2 scale = GetWindowScaleDPI();
                 msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
@@ -5484,17 +8756,13 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     if ((key == GLFW_KEY_F11) && (action == GLFW_PRESS))
     {
-        eventsRecording = !eventsRecording;
-
-        // On finish recording, we export events into a file
-        if (!eventsRecording) ExportAutomationEvents("eventsrec.rep");
+        // On finish recording, events file is completed with seek points index
+        if (eventsRecording) StopAutomationEventRecording();
+        else StartAutomationEventRecording("eventsrec.rep");
     }
     else if ((key == GLFW_KEY_F9) && (action == GLFW_PRESS))
     {
-        LoadAutomationEvents("eventsrec.rep");
-        eventsPlaying = true;
-
-        TRACELOG(LOG_WARNING, "eventsPlaying enabled!");
+        StartAutomationEventPlaying("eventsrec.rep");
     }
 #endif
 }
@@ -5509,6 +8777,8 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
     // Ref: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // Ref: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
+    RegisterInputEvent(GetTime(), INPUT_EVENT_CHAR, (int)key, 0, (Vector2){ 0 });
+
     // Check if there is space available in the queue
     if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
     {
@@ -5516,7 +8786,11 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
         CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = key;
         CORE.Input.Keyboard.charPressedQueueCount++;
     }
-}
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    RecordAutomationEvent(INPUT_CHAR_PRESSED, (int)key, 0, 0);
+#endif
+}
 
 // GLFW3 Mouse Button Callback, runs on mouse button pressed
 static void MouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
@@ -5524,6 +8798,7 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
     CORE.Input.Mouse.currentButtonState[button] = action;
+    RegisterInputEvent(GetTime(), (action == GLFW_RELEASE)? INPUT_EVENT_MOUSE_BUTTON_UP : INPUT_EVENT_MOUSE_BUTTON_DOWN, button, 0, GetMousePosition());
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
     // Process mouse events as touches to be able to use mouse-gestures
@@ -5559,6 +8834,7 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.x = (float)x;
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+    RegisterInputEvent(GetTime(), INPUT_EVENT_MOUSE_MOVE, 0, 0, GetMousePosition());
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
     // Process mouse events as touches to be able to use mouse-gestures
@@ -5588,6 +8864,7 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (Vector2){ (float)xoffset, (float)yoffset };
+    RegisterInputEvent(GetTime(), INPUT_EVENT_MOUSE_WHEEL, 0, 0, CORE.Input.Mouse.currentWheelMove);
 }
 
 // GLFW3 CursorEnter Callback, when cursor enters the window
@@ -5597,6 +8874,26 @@ static void CursorEnterCallback(GLFWwindow *window, int enter)
     else CORE.Input.Mouse.cursorOnScreen = false;
 }
 
+#if defined(PLATFORM_DESKTOP)
+// GLFW3 Joystick Callback, runs on gamepad connected/disconnected
+// NOTE: Called from glfwPollEvents(), new state is polled on next PollInputEvents()
+static void JoystickCallback(int jid, int event)
+{
+    if ((jid < 0) || (jid >= MAX_GAMEPADS)) return;
+
+    CORE.Input.Gamepad.ready[jid] = (event == GLFW_CONNECTED);
+
+    if (event == GLFW_DISCONNECTED)
+    {
+        // Release disconnected gamepad state, avoid buttons kept pressed
+        memset(CORE.Input.Gamepad.currentButtonState[jid], 0, MAX_GAMEPAD_BUTTONS);
+        memset(CORE.Input.Gamepad.axisState[jid], 0, MAX_GAMEPAD_AXIS*sizeof(float));
+    }
+
+    TRACELOG(LOG_INFO, "INPUT: Gamepad %i %s", jid, (event == GLFW_CONNECTED)? "connected" : "disconnected");
+}
+#endif
+
 // GLFW3 Window Drop Callback, runs when drop files into window
 static void WindowDropCallback(GLFWwindow *window, int count, const char **paths)
 {
@@ -5778,6 +9075,12 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     int type = AInputEvent_getType(event);
     int source = AInputEvent_getSource(event);
 
+    // Register input event time, Android events timestamps are CLOCK_MONOTONIC (same clock than GetTime())
+    double time = GetTime();
+    if (type == AINPUT_EVENT_TYPE_MOTION) time = (double)(AMotionEvent_getEventTime(event) - (long long int)CORE.Time.base)*1e-9;
+    else if (type == AINPUT_EVENT_TYPE_KEY) time = (double)(AKeyEvent_getEventTime(event) - (long long int)CORE.Time.base)*1e-9;
+    CORE.Input.eventTime = time;
+
     if (type == AINPUT_EVENT_TYPE_MOTION)
     {
         if (((source & AINPUT_SOURCE_JOYSTICK) == AINPUT_SOURCE_JOYSTICK) ||
@@ -5857,8 +9160,13 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
             if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
             {
                 CORE.Input.Gamepad.currentButtonState[0][button] = 1;
+                if (AKeyEvent_getRepeatCount(event) == 0) RegisterInputEvent(time, INPUT_EVENT_GAMEPAD_BUTTON_DOWN, button, 0, (Vector2){ 0 });
+            }
+            else
+            {
+                CORE.Input.Gamepad.currentButtonState[0][button] = 0;  // Key up
+                RegisterInputEvent(time, INPUT_EVENT_GAMEPAD_BUTTON_UP, button, 0, (Vector2){ 0 });
             }
-            else CORE.Input.Gamepad.currentButtonState[0][button] = 0;  // Key up
 
             return 1; // Handled gamepad button
         }
@@ -5867,12 +9175,22 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
         // NOTE: Android key action is 0 for down and 1 for up
         if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
         {
-            CORE.Input.Keyboard.currentKeyState[keycode] = 1;   // Key down
+            SetKeyState(keycode, 1);    // Key down
+            RegisterInputEvent(time, (AKeyEvent_getRepeatCount(event) > 0)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN, keycode, 0, (Vector2){ 0 });
 
             CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keycode;
             CORE.Input.Keyboard.keyPressedQueueCount++;
         }
-        else CORE.Input.Keyboard.currentKeyState[keycode] = 0;  // Key up
+        else
+        {
+            SetKeyState(keycode, 0);    // Key up
+            RegisterInputEvent(time, INPUT_EVENT_KEY_UP, keycode, 0, (Vector2){ 0 });
+        }
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+        RecordAutomationEvent(CORE.Input.Keyboard.currentKeyState[keycode]? INPUT_KEY_DOWN : INPUT_KEY_UP, keycode, 0, 0);
+        if (CORE.Input.Keyboard.currentKeyState[keycode]) RecordAutomationEvent(INPUT_KEY_PRESSED, keycode, 0, 0);
+#endif
 
         if (keycode == AKEYCODE_POWER)
         {
@@ -5941,6 +9259,20 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
 
     int32_t pointerIndex = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
 
+    // Register touch events: pointer changed for down/up actions, all pointers for move action
+    if ((flags == AMOTION_EVENT_ACTION_MOVE) || (flags == AMOTION_EVENT_ACTION_CANCEL))
+    {
+        for (int i = 0; (i < CORE.Input.Touch.pointCount) && (i < MAX_TOUCH_POINTS); i++)
+        {
+            RegisterInputEvent(time, (flags == AMOTION_EVENT_ACTION_MOVE)? INPUT_EVENT_TOUCH_MOVE : INPUT_EVENT_TOUCH_UP, CORE.Input.Touch.pointId[i], 0, CORE.Input.Touch.position[i]);
+        }
+    }
+    else if ((pointerIndex < CORE.Input.Touch.pointCount) && (pointerIndex < MAX_TOUCH_POINTS))
+    {
+        if ((flags == AMOTION_EVENT_ACTION_DOWN) || (flags == AMOTION_EVENT_ACTION_POINTER_DOWN)) RegisterInputEvent(time, INPUT_EVENT_TOUCH_DOWN, CORE.Input.Touch.pointId[pointerIndex], 0, CORE.Input.Touch.position[pointerIndex]);
+        else if ((flags == AMOTION_EVENT_ACTION_UP) || (flags == AMOTION_EVENT_ACTION_POINTER_UP)) RegisterInputEvent(time, INPUT_EVENT_TOUCH_UP, CORE.Input.Touch.pointId[pointerIndex], 0, CORE.Input.Touch.position[pointerIndex]);
+    }
+
     if (flags == AMOTION_EVENT_ACTION_POINTER_UP || flags == AMOTION_EVENT_ACTION_UP)
     {
         // One of the touchpoints is released, remove it from touch point arrays
@@ -6044,6 +9376,8 @@ static EM_BOOL EmscriptenGamepadCallback(int eventType, const EmscriptenGamepadE
 // Register touch input events
 static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent *touchEvent, void *userData)
 {
+    double time = GetTime();
+
     // Register touch points count
     CORE.Input.Touch.pointCount = touchEvent->numTouches;
 
@@ -6068,6 +9402,16 @@ static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent
 
         if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) CORE.Input.Touch.currentTouchState[i] = 1;
         else if (eventType == EMSCRIPTEN_EVENT_TOUCHEND) CORE.Input.Touch.currentTouchState[i] = 0;
+
+        // Register touch event only for changed touch points
+        if (touchEvent->touches[i].isChanged)
+        {
+            int type = INPUT_EVENT_TOUCH_MOVE;
+            if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) type = INPUT_EVENT_TOUCH_DOWN;
+            else if ((eventType == EMSCRIPTEN_EVENT_TOUCHEND) || (eventType == EMSCRIPTEN_EVENT_TOUCHCANCEL)) type = INPUT_EVENT_TOUCH_UP;
+
+            RegisterInputEvent(time, type, CORE.Input.Touch.pointId[i], 0, CORE.Input.Touch.position[i]);
+        }
     }
 
 #if defined(SUPPORT_GESTURES_SYSTEM)        // PLATFORM_WEB
@@ -6361,6 +9705,13 @@ static void ConfigureEvdevDevice(char *device)
     }
     worker->fd = fd;
 
+#if defined(EVIOCSCLOCKID)
+    // Request events timestamps on CLOCK_MONOTONIC, same clock than GetTime()
+    // NOTE: On failure, CLOCK_REALTIME timestamps are detected by GetEvdevEventTime()
+    int clockId = CLOCK_MONOTONIC;
+    ioctl(fd, EVIOCSCLOCKID, &clockId);
+#endif
+
     // Grab number on the end of the devices name "event<N>"
     int devNum = 0;
     char *ptrDevName = strrchr(device, 't');
@@ -6559,534 +9910,1419 @@ static void PollKeyboardEvents(void)
                     // Event interface: 'value' is the value the event carries. Either a relative change for EV_REL,
                     // absolute new value for EV_ABS (joysticks ...), or 0 for EV_KEY for release, 1 for keypress and 2 for autorepeat
                     CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1)? 1 : 0;
-                    if (event.value >= 1)
+                    RegisterInputEvent(GetEvdevEventTime(&event), (event.value == 0)? INPUT_EVENT_KEY_UP : ((event.value == 2)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN), keycode, 0, (Vector2){ 0 });
+
+                    // Check if there is space available in the key queue
+                    if ((event.value >= 1) && (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE))
                     {
                         CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keycode;     // Register last key pressed
                         CORE.Input.Keyboard.keyPressedQueueCount++;
                     }
 
-                #if defined(SUPPORT_SCREEN_CAPTURE)
-                    // Check screen capture key (raylib key: KEY_F12)
-                    if (CORE.Input.Keyboard.currentKeyState[301] == 1)
-                    {
-                        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-                        screenshotCounter++;
-                    }
-                #endif
+                #if defined(SUPPORT_EVENTS_AUTOMATION)
+                    // Record key state and key queue events (autorepeat does not change key state)
+                    if (event.value != 2) RecordAutomationEvent((event.value == 1)? INPUT_KEY_DOWN : INPUT_KEY_UP, keycode, 0, 0);
+                    if (event.value >= 1) RecordAutomationEvent(INPUT_KEY_PRESSED, keycode, 0, 0);
+                #endif
+
+                #if defined(SUPPORT_SCREEN_CAPTURE)
+                    // Check screen capture key (raylib key: KEY_F12)
+                    if (CORE.Input.Keyboard.currentKeyState[301] == 1)
+                    {
+                        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                        screenshotCounter++;
+                    }
+                #endif
+
+                    if (CORE.Input.Keyboard.currentKeyState[CORE.Input.Keyboard.exitKey] == 1) CORE.Window.shouldClose = true;
+
+                    TRACELOGD("RPI: KEY_%s ScanCode: %4i KeyCode: %4i", event.value == 0 ? "UP":"DOWN", event.code, keycode);
+                }
+            }
+        }
+    }
+}
+
+// Input device events reading thread
+// NOTE: Events are only registered here, they are processed on main thread by ProcessEvdevEvent()
+static void *EventThread(void *arg)
+{
+    InputEventWorker *worker = (InputEventWorker *)arg;
+    struct input_event events[64] = { 0 };
+    struct pollfd device = { .fd = worker->fd, .events = POLLIN };
+
+    while (!CORE.Window.shouldClose)
+    {
+        // Wait for device events, timeout allows checking for window close
+        if (poll(&device, 1, 100) <= 0) continue;
+        if (device.revents & (POLLERR | POLLHUP | POLLNVAL)) break;     // Device disconnected
+
+        // Read all available events at once, bursts are registered without waiting
+        int bytesRead = read(worker->fd, events, sizeof(events));
+
+        for (int i = 0; i < (bytesRead/(int)sizeof(struct input_event)); i++)
+        {
+            InputRawEvent event = { 0 };
+            event.time = GetEvdevEventTime(&events[i]);
+            event.type = events[i].type;
+            event.code = events[i].code;
+            event.value = events[i].value;
+
+            PushInputEvent(&worker->ring, &event);
+        }
+    }
+
+    close(worker->fd);
+
+    return NULL;
+}
+
+// Get evdev event timestamp, converted to GetTime() reference
+// NOTE: Timestamp is registered by kernel when event happened, device clock is requested
+// to be CLOCK_MONOTONIC (EVIOCSCLOCKID), if it is not (CLOCK_REALTIME, far in future), GetTime() is used
+static double GetEvdevEventTime(const struct input_event *event)
+{
+    unsigned long long int nanoSeconds = (unsigned long long int)event->input_event_sec*1000000000LLU + (unsigned long long int)event->input_event_usec*1000LLU;
+    double time = (double)((long long int)(nanoSeconds - CORE.Time.base))*1e-9;
+    double currentTime = GetTime();
+
+    if (time > currentTime) time = currentTime;
+
+    return time;
+}
+
+// Register raw input event in ring, called only by device thread (single producer)
+// NOTE: If ring is full event is dropped, main thread reports it
+static bool PushInputEvent(InputEventRing *ring, const InputRawEvent *event)
+{
+    unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if ((head - tail) >= MAX_INPUT_EVENTS_RING)
+    {
+        __atomic_store_n(&ring->dropped, __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    ring->events[head & (MAX_INPUT_EVENTS_RING - 1)] = *event;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);     // Publish event to consumer
+
+    return true;
+}
+
+// Get next raw input event from ring, called only by main thread (single consumer)
+static bool PopInputEvent(InputEventRing *ring, InputRawEvent *event)
+{
+    unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (tail == head) return false;
+
+    *event = ring->events[tail & (MAX_INPUT_EVENTS_RING - 1)];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);     // Release slot to producer
+
+    return true;
+}
+
+// Process raw input events registered by input devices threads
+// NOTE: Called by PollInputEvents(), events are processed in registration order per device
+static void PollInputDevicesEvents(void)
+{
+    InputRawEvent event = { 0 };
+
+    for (int i = 0; i < sizeof(CORE.Input.eventWorker)/sizeof(InputEventWorker); ++i)
+    {
+        InputEventWorker *worker = &CORE.Input.eventWorker[i];
+        if (worker->threadId == 0) continue;
+
+        while (PopInputEvent(&worker->ring, &event)) ProcessEvdevEvent(worker, &event);
+
+        unsigned int dropped = __atomic_load_n(&worker->ring.dropped, __ATOMIC_RELAXED);
+        if (dropped != worker->ring.droppedReported)
+        {
+            TRACELOG(LOG_WARNING, "RPI: Input device event%i queue full, %u events dropped", worker->eventNum, dropped - worker->ring.droppedReported);
+            worker->ring.droppedReported = dropped;
+        }
+    }
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (!CORE.Input.Gamepad.ready[i]) continue;
+
+        while (PopInputEvent(&CORE.Input.Gamepad.ring[i], &event)) ProcessGamepadEvent(i, &event);
+
+        unsigned int dropped = __atomic_load_n(&CORE.Input.Gamepad.ring[i].dropped, __ATOMIC_RELAXED);
+        if (dropped != CORE.Input.Gamepad.ring[i].droppedReported)
+        {
+            TRACELOG(LOG_WARNING, "RPI: Gamepad %i events queue full, %u events dropped", i, dropped - CORE.Input.Gamepad.ring[i].droppedReported);
+            CORE.Input.Gamepad.ring[i].droppedReported = dropped;
+        }
+    }
+}
+
+// Process mouse/touch raw input event, update input state
+static void ProcessEvdevEvent(InputEventWorker *worker, const InputRawEvent *event)
+{
+    int touchAction = -1;           // 0-TOUCH_ACTION_UP, 1-TOUCH_ACTION_DOWN, 2-TOUCH_ACTION_MOVE
+    bool gestureUpdate = false;     // Flag to note gestures require to update
+
+    CORE.Input.eventTime = event->time;
+
+    // Relative movement parsing
+    if (event->type == EV_REL)
+    {
+        if (event->code == REL_X)
+        {
+            CORE.Input.Mouse.currentPosition.x += event->value;
+            CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
+
+            touchAction = 2;    // TOUCH_ACTION_MOVE
+            gestureUpdate = true;
+        }
+
+        if (event->code == REL_Y)
+        {
+            CORE.Input.Mouse.currentPosition.y += event->value;
+            CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
+
+            touchAction = 2;    // TOUCH_ACTION_MOVE
+            gestureUpdate = true;
+        }
+
+        if (event->code == REL_WHEEL)
+        {
+            CORE.Input.Mouse.currentWheelMove.y += event->value;
+            RegisterInputEvent(event->time, INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ 0.0f, (float)event->value });
+        }
+    }
+
+    // Absolute movement parsing
+    if (event->type == EV_ABS)
+    {
+        // Basic movement
+        if (event->code == ABS_X)
+        {
+            CORE.Input.Mouse.currentPosition.x = (event->value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;    // Scale acording to absRange
+            CORE.Input.Touch.position[0].x = (event->value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;        // Scale acording to absRange
+
+            touchAction = 2;    // TOUCH_ACTION_MOVE
+            gestureUpdate = true;
+        }
+
+        if (event->code == ABS_Y)
+        {
+            CORE.Input.Mouse.currentPosition.y = (event->value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;  // Scale acording to absRange
+            CORE.Input.Touch.position[0].y = (event->value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;      // Scale acording to absRange
+
+            touchAction = 2;    // TOUCH_ACTION_MOVE
+            gestureUpdate = true;
+        }
+
+        // Multitouch movement
+        if (event->code == ABS_MT_SLOT) worker->touchSlot = event->value;   // Remember the slot number for the folowing events
+
+        if (event->code == ABS_MT_POSITION_X)
+        {
+            if (worker->touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[worker->touchSlot].x = (event->value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;    // Scale acording to absRange
+        }
+
+        if (event->code == ABS_MT_POSITION_Y)
+        {
+            if (worker->touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[worker->touchSlot].y = (event->value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;  // Scale acording to absRange
+        }
+
+        if (event->code == ABS_MT_TRACKING_ID)
+        {
+            if ((event->value < 0) && (worker->touchSlot < MAX_TOUCH_POINTS))
+            {
+                // Touch has ended for this point
+                CORE.Input.Touch.position[worker->touchSlot].x = -1;
+                CORE.Input.Touch.position[worker->touchSlot].y = -1;
+            }
+        }
+
+        // Touchscreen tap
+        if (event->code == ABS_PRESSURE)
+        {
+            int previousMouseLeftButtonState = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT];
+
+            if (!event->value && previousMouseLeftButtonState)
+            {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 0;
+                RegisterInputEvent(event->time, INPUT_EVENT_MOUSE_BUTTON_UP, MOUSE_BUTTON_LEFT, 0, GetMousePosition());
+
+                touchAction = 0;    // TOUCH_ACTION_UP
+                gestureUpdate = true;
+            }
+
+            if (event->value && !previousMouseLeftButtonState)
+            {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 1;
+                RegisterInputEvent(event->time, INPUT_EVENT_MOUSE_BUTTON_DOWN, MOUSE_BUTTON_LEFT, 0, GetMousePosition());
+
+                touchAction = 1;    // TOUCH_ACTION_DOWN
+                gestureUpdate = true;
+            }
+        }
+
+    }
+
+    // Button parsing
+    if (event->type == EV_KEY)
+    {
+        int button = -1;
+
+        // Mouse button parsing
+        if ((event->code == BTN_TOUCH) || (event->code == BTN_LEFT))
+        {
+            button = MOUSE_BUTTON_LEFT;
+
+            if (event->value > 0) touchAction = 1;   // TOUCH_ACTION_DOWN
+            else touchAction = 0;       // TOUCH_ACTION_UP
+            gestureUpdate = true;
+        }
+        else if (event->code == BTN_RIGHT) button = MOUSE_BUTTON_RIGHT;
+        else if (event->code == BTN_MIDDLE) button = MOUSE_BUTTON_MIDDLE;
+        else if (event->code == BTN_SIDE) button = MOUSE_BUTTON_SIDE;
+        else if (event->code == BTN_EXTRA) button = MOUSE_BUTTON_EXTRA;
+        else if (event->code == BTN_FORWARD) button = MOUSE_BUTTON_FORWARD;
+        else if (event->code == BTN_BACK) button = MOUSE_BUTTON_BACK;
+
+        if (button != -1)
+        {
+            CORE.Input.Mouse.currentButtonState[button] = event->value;
+            RegisterInputEvent(event->time, (event->value > 0)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, button, 0, GetMousePosition());
+        }
+    }
+
+    // Screen confinement
+    if (!CORE.Input.Mouse.cursorHidden)
+    {
+        if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
+        if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
+
+        if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
+        if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
+    }
+
+    // Register mouse move event once per events report (EV_SYN), all axis are updated at that point
+    if (gestureUpdate && (touchAction == 2)) worker->positionChanged = true;
+
+    if ((event->type == EV_SYN) && (event->code == SYN_REPORT) && worker->positionChanged)
+    {
+        RegisterInputEvent(event->time, INPUT_EVENT_MOUSE_MOVE, 0, 0, GetMousePosition());
+        worker->positionChanged = false;
+    }
+
+#if defined(SUPPORT_GESTURES_SYSTEM)        // PLATFORM_RPI, PLATFORM_DRM
+    if (gestureUpdate)
+    {
+        GestureEvent gestureEvent = { 0 };
+
+        gestureEvent.pointCount = 0;
+        gestureEvent.touchAction = touchAction;
+
+        if (CORE.Input.Touch.position[0].x >= 0) gestureEvent.pointCount++;
+        if (CORE.Input.Touch.position[1].x >= 0) gestureEvent.pointCount++;
+        if (CORE.Input.Touch.position[2].x >= 0) gestureEvent.pointCount++;
+        if (CORE.Input.Touch.position[3].x >= 0) gestureEvent.pointCount++;
+
+        gestureEvent.pointId[0] = 0;
+        gestureEvent.pointId[1] = 1;
+        gestureEvent.pointId[2] = 2;
+        gestureEvent.pointId[3] = 3;
+
+        gestureEvent.position[0] = CORE.Input.Touch.position[0];
+        gestureEvent.position[1] = CORE.Input.Touch.position[1];
+        gestureEvent.position[2] = CORE.Input.Touch.position[2];
+        gestureEvent.position[3] = CORE.Input.Touch.position[3];
+
+        ProcessGestureEvent(gestureEvent);
+    }
+#endif
+}
+
+// Initialize gamepad system
+static void InitGamepad(void)
+{
+    char gamepadDev[128] = { 0 };
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        sprintf(gamepadDev, "%s%i", DEFAULT_GAMEPAD_DEV, i);
+
+        if ((CORE.Input.Gamepad.streamId[i] = open(gamepadDev, O_RDONLY | O_NONBLOCK)) < 0)
+        {
+            // NOTE: Only show message for first gamepad
+            if (i == 0) TRACELOG(LOG_WARNING, "RPI: Failed to open Gamepad device, no gamepad available");
+        }
+        else
+        {
+            CORE.Input.Gamepad.ready[i] = true;
+
+            // NOTE: Only create one thread
+            if (i == 0)
+            {
+                int error = pthread_create(&CORE.Input.Gamepad.threadId, NULL, &GamepadThread, NULL);
+
+                if (error != 0) TRACELOG(LOG_WARNING, "RPI: Failed to create gamepad input event thread");
+                else  TRACELOG(LOG_INFO, "RPI: Gamepad device initialized successfully");
+            }
+        }
+    }
+}
+
+// Process Gamepad (/dev/input/js0)
+// NOTE: Events are only registered here, they are processed on main thread by ProcessGamepadEvent()
+static void *GamepadThread(void *arg)
+{
+    struct js_event {
+        unsigned int time;      // event timestamp in milliseconds
+        short value;            // event value
+        unsigned char type;     // event type
+        unsigned char number;   // event axis/button number
+    };
+
+    // Read gamepad events
+    struct js_event gamepadEvents[32] = { 0 };
+    struct pollfd devices[MAX_GAMEPADS] = { 0 };
+    bool disconnected[MAX_GAMEPADS] = { 0 };
+
+    while (!CORE.Window.shouldClose)
+    {
+        // NOTE: Gamepads could be initialized after thread creation, negative file descriptors are ignored by poll()
+        for (int i = 0; i < MAX_GAMEPADS; i++)
+        {
+            devices[i].fd = (CORE.Input.Gamepad.ready[i] && !disconnected[i])? CORE.Input.Gamepad.streamId[i] : -1;
+            devices[i].events = POLLIN;
+        }
+
+        // Wait for any gamepad events, timeout allows checking for window close
+        if (poll(devices, MAX_GAMEPADS, 100) <= 0) continue;
+
+        for (int i = 0; i < MAX_GAMEPADS; i++)
+        {
+            if (devices[i].revents & (POLLERR | POLLHUP | POLLNVAL)) disconnected[i] = true;    // Gamepad disconnected
+            else if (devices[i].revents & POLLIN)
+            {
+                // NOTE: js_event time is not referenced to a known clock, reading time is used
+                int bytesRead = read(CORE.Input.Gamepad.streamId[i], gamepadEvents, sizeof(gamepadEvents));
+                double time = GetTime();
+
+                for (int k = 0; k < (bytesRead/(int)sizeof(struct js_event)); k++)
+                {
+                    InputRawEvent event = { 0 };
+                    event.time = time;
+                    event.type = gamepadEvents[k].type & ~JS_EVENT_INIT;     // Ignore synthetic events
+                    event.code = gamepadEvents[k].number;
+                    event.value = gamepadEvents[k].value;
+
+                    PushInputEvent(&CORE.Input.Gamepad.ring[i], &event);
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Process gamepad raw input event, update input state
+static void ProcessGamepadEvent(int gamepad, const InputRawEvent *event)
+{
+    // Process gamepad events by type
+    if (event->type == JS_EVENT_BUTTON)
+    {
+        //TRACELOG(LOG_WARNING, "RPI: Gamepad button: %i, value: %i", event->code, event->value);
+
+        if (event->code < MAX_GAMEPAD_BUTTONS)
+        {
+            // 1 - button pressed, 0 - button released
+            CORE.Input.Gamepad.currentButtonState[gamepad][event->code] = event->value;
+            RegisterInputEvent(event->time, event->value? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, event->code, gamepad, (Vector2){ 0 });
+
+            if (event->value == 1) CORE.Input.Gamepad.lastButtonPressed = event->code;
+            else CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
+        }
+    }
+    else if (event->type == JS_EVENT_AXIS)
+    {
+        //TRACELOG(LOG_WARNING, "RPI: Gamepad axis: %i, value: %i", event->code, event->value);
+
+        if (event->code < MAX_GAMEPAD_AXIS)
+        {
+            // NOTE: Scaling of event->value to get values between -1..1
+            CORE.Input.Gamepad.axisState[gamepad][event->code] = (float)event->value/32768;
+            RegisterInputEvent(event->time, INPUT_EVENT_GAMEPAD_AXIS, event->code, gamepad, (Vector2){ CORE.Input.Gamepad.axisState[gamepad][event->code], 0.0f });
+        }
+    }
+}
+#endif  // PLATFORM_RPI || PLATFORM_DRM
+
+#if defined(PLATFORM_DRM)
+// Search matching DRM mode in connector's mode list
+static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode)
+{
+    if (NULL == connector) return -1;
+    if (NULL == mode) return -1;
+
+    // safe bitwise comparison of two modes
+    #define BINCMP(a, b) memcmp((a), (b), (sizeof(a) < sizeof(b)) ? sizeof(a) : sizeof(b))
+
+    for (size_t i = 0; i < connector->count_modes; i++)
+    {
+        TRACELOG(LOG_TRACE, "DISPLAY: DRM mode: %d %ux%u@%u %s", i, connector->modes[i].hdisplay, connector->modes[i].vdisplay,
+            connector->modes[i].vrefresh, (connector->modes[i].flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+
+        if (0 == BINCMP(&CORE.Window.crtc->mode, &CORE.Window.connector->modes[i])) return i;
+    }
+
+    return -1;
+
+    #undef BINCMP
+}
+
+// Search exactly matching DRM connector mode in connector's list
+static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced)
+{
+    TRACELOG(LOG_TRACE, "DISPLAY: Searching exact connector mode for %ux%u@%u, selecting an interlaced mode is allowed: %s", width, height, fps, allowInterlaced ? "yes" : "no");
+
+    if (NULL == connector) return -1;
+
+    for (int i = 0; i < CORE.Window.connector->count_modes; i++)
+    {
+        const drmModeModeInfo *const mode = &CORE.Window.connector->modes[i];
+
+        TRACELOG(LOG_TRACE, "DISPLAY: DRM Mode %d %ux%u@%u %s", i, mode->hdisplay, mode->vdisplay, mode->vrefresh, (mode->flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+
+        if ((mode->flags & DRM_MODE_FLAG_INTERLACE) && (!allowInterlaced)) continue;
+
+        if ((mode->hdisplay == width) && (mode->vdisplay == height) && (mode->vrefresh == fps)) return i;
+    }
+
+    TRACELOG(LOG_TRACE, "DISPLAY: No DRM exact matching mode found");
+    return -1;
+}
+
+// Search the nearest matching DRM connector mode in connector's list
+static int FindNearestConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced)
+{
+    TRACELOG(LOG_TRACE, "DISPLAY: Searching nearest connector mode for %ux%u@%u, selecting an interlaced mode is allowed: %s", width, height, fps, allowInterlaced ? "yes" : "no");
+
+    if (NULL == connector) return -1;
+
+    int nearestIndex = -1;
+    for (int i = 0; i < CORE.Window.connector->count_modes; i++)
+    {
+        const drmModeModeInfo *const mode = &CORE.Window.connector->modes[i];
+
+        TRACELOG(LOG_TRACE, "DISPLAY: DRM mode: %d %ux%u@%u %s", i, mode->hdisplay, mode->vdisplay, mode->vrefresh,
+            (mode->flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+
+        if ((mode->hdisplay < width) || (mode->vdisplay < height))
+        {
+            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode is too small");
+            continue;
+        }
+
+        if ((mode->flags & DRM_MODE_FLAG_INTERLACE) && (!allowInterlaced))
+        {
+            TRACELOG(LOG_TRACE, "DISPLAY: DRM shouldn't choose an interlaced mode");
+            continue;
+        }
+
+        if (nearestIndex < 0)
+        {
+            nearestIndex = i;
+            continue;
+        }
+
+        const int widthDiff = abs(mode->hdisplay - width);
+        const int heightDiff = abs(mode->vdisplay - height);
+        const int fpsDiff = abs(mode->vrefresh - fps);
+
+        const int nearestWidthDiff = abs(CORE.Window.connector->modes[nearestIndex].hdisplay - width);
+        const int nearestHeightDiff = abs(CORE.Window.connector->modes[nearestIndex].vdisplay - height);
+        const int nearestFpsDiff = abs(CORE.Window.connector->modes[nearestIndex].vrefresh - fps);
+
+        if ((widthDiff < nearestWidthDiff) || (heightDiff < nearestHeightDiff) || (fpsDiff < nearestFpsDiff)) {
+            nearestIndex = i;
+        }
+    }
+
+    return nearestIndex;
+}
+
+// Release DRM framebuffer attached to GBM buffer object, called on buffer object destruction
+static void DestroyFramebufferDRM(struct gbm_bo *bo, void *data)
+{
+    uint32_t fb = (uint32_t)(uintptr_t)data;
+
+    if (fb != 0) drmModeRmFB(gbm_device_get_fd(gbm_bo_get_device(bo)), fb);
+}
+
+// Get DRM framebuffer for GBM buffer object (created once, cached in buffer)
+static uint32_t GetFramebufferDRM(struct gbm_bo *bo)
+{
+    if (bo == NULL) return 0;
+
+    uint32_t fb = (uint32_t)(uintptr_t)gbm_bo_get_user_data(bo);
+
+    if (fb == 0)
+    {
+        int result = drmModeAddFB(CORE.Window.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo), 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
+
+        if (result != 0)
+        {
+            TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+            return 0;
+        }
+
+        gbm_bo_set_user_data(bo, (void *)(uintptr_t)fb, DestroyFramebufferDRM);
+    }
+
+    return fb;
+}
+
+// Page flip completion event handler, previously scanned out buffer object can be released
+static void PageFlipHandlerDRM(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+{
+    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+    CORE.Window.prevBO = CORE.Window.pendingBO;
+    CORE.Window.pendingBO = NULL;
+}
+
+// Wait for queued page flip completion, release previous buffer object
+static void WaitPageFlipDRM(void)
+{
+    drmEventContext eventContext = { 0 };
+    eventContext.version = 2;
+    eventContext.page_flip_handler = PageFlipHandlerDRM;
+
+    while (CORE.Window.pendingBO != NULL)
+    {
+        struct pollfd pfd = { .fd = CORE.Window.fd, .events = POLLIN };
+        int result = poll(&pfd, 1, 1000);
 
-                    if (CORE.Input.Keyboard.currentKeyState[CORE.Input.Keyboard.exitKey] == 1) CORE.Window.shouldClose = true;
+        if ((result < 0) && (errno == EINTR)) continue;
+        else if (result <= 0)
+        {
+            // Flip event never arrived (i.e. VT switched), do not hang waiting for it
+            TRACELOG(LOG_WARNING, "DISPLAY: Page flip completion wait timed out");
+            PageFlipHandlerDRM(CORE.Window.fd, 0, 0, 0, NULL);
+        }
+        else drmHandleEvent(CORE.Window.fd, &eventContext);
+    }
+}
 
-                    TRACELOGD("RPI: KEY_%s ScanCode: %4i KeyCode: %4i", event.value == 0 ? "UP":"DOWN", event.code, keycode);
-                }
+// Get DRM object property id by name (0 if not found), current value is optionally returned
+static uint32_t GetPropertyIdDRM(uint32_t objectId, uint32_t objectType, const char *name, uint64_t *value)
+{
+    uint32_t id = 0;
+    drmModeObjectProperties *props = drmModeObjectGetProperties(CORE.Window.fd, objectId, objectType);
+
+    for (unsigned int i = 0; (props != NULL) && (i < props->count_props) && (id == 0); i++)
+    {
+        drmModePropertyRes *prop = drmModeGetProperty(CORE.Window.fd, props->props[i]);
+
+        if (prop != NULL)
+        {
+            if (strcmp(prop->name, name) == 0)
+            {
+                id = prop->prop_id;
+                if (value != NULL) *value = props->prop_values[i];
             }
+
+            drmModeFreeProperty(prop);
         }
     }
+
+    if (props != NULL) drmModeFreeObjectProperties(props);
+
+    return id;
 }
 
-// Input device events reading thread
-static void *EventThread(void *arg)
+// Find primary and overlay planes usable with CRTC
+// NOTE: Atomic modesetting is used if supported, overlay planes are updated together with primary plane page flip
+static void InitDisplayPlanesDRM(drmModeRes *res)
 {
-    struct input_event event = { 0 };
-    InputEventWorker *worker = (InputEventWorker *)arg;
+    static const char *planePropNames[PLANE_PROP_COUNT] = { "FB_ID", "CRTC_ID", "SRC_X", "SRC_Y", "SRC_W", "SRC_H", "CRTC_X", "CRTC_Y", "CRTC_W", "CRTC_H" };
 
-    int touchAction = -1;           // 0-TOUCH_ACTION_UP, 1-TOUCH_ACTION_DOWN, 2-TOUCH_ACTION_MOVE
-    bool gestureUpdate = false;     // Flag to note gestures require to update
+    int crtcIndex = -1;
+    for (int i = 0; i < res->count_crtcs; i++) if (res->crtcs[i] == CORE.Window.crtc->crtc_id) crtcIndex = i;
+    if (crtcIndex < 0) return;
 
-    while (!CORE.Window.shouldClose)
+    // NOTE: Atomic capability also exposes primary and cursor planes (universal planes), plane type is checked
+    CORE.Window.atomic = (drmSetClientCap(CORE.Window.fd, DRM_CLIENT_CAP_ATOMIC, 1) == 0);
+
+    drmModePlaneRes *planeRes = drmModeGetPlaneResources(CORE.Window.fd);
+    if (planeRes == NULL) return;
+
+    for (unsigned int i = 0; i < planeRes->count_planes; i++)
     {
-        // Try to read data from the device and only continue if successful
-        while (read(worker->fd, &event, sizeof(event)) == (int)sizeof(event))
+        drmModePlane *plane = drmModeGetPlane(CORE.Window.fd, planeRes->planes[i]);
+        if (plane == NULL) continue;
+
+        if (plane->possible_crtcs & (1 << crtcIndex))
         {
-            // Relative movement parsing
-            if (event.type == EV_REL)
-            {
-                if (event.code == REL_X)
-                {
-                    CORE.Input.Mouse.currentPosition.x += event.value;
-                    CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
+            uint64_t type = DRM_PLANE_TYPE_OVERLAY;
+            if (CORE.Window.atomic) GetPropertyIdDRM(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type);
 
-                    touchAction = 2;    // TOUCH_ACTION_MOVE
-                    gestureUpdate = true;
-                }
+            if ((type == DRM_PLANE_TYPE_PRIMARY) && (CORE.Window.primaryPlane == 0 || plane->crtc_id == CORE.Window.crtc->crtc_id))
+            {
+                CORE.Window.primaryPlane = plane->plane_id;
+                CORE.Window.primaryPlaneFbProp = GetPropertyIdDRM(plane->plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+            }
+            else if ((type == DRM_PLANE_TYPE_OVERLAY) && (CORE.Window.planeCount < MAX_DISPLAY_PLANES))
+            {
+                DisplayPlaneDRM *overlay = &CORE.Window.planes[CORE.Window.planeCount];
+                *overlay = (DisplayPlaneDRM){ 0 };
+                overlay->id = plane->plane_id;
 
-                if (event.code == REL_Y)
+                if (CORE.Window.atomic)
                 {
-                    CORE.Input.Mouse.currentPosition.y += event.value;
-                    CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
-
-                    touchAction = 2;    // TOUCH_ACTION_MOVE
-                    gestureUpdate = true;
+                    for (int p = 0; p < PLANE_PROP_COUNT; p++) overlay->props[p] = GetPropertyIdDRM(plane->plane_id, DRM_MODE_OBJECT_PLANE, planePropNames[p], NULL);
                 }
 
-                if (event.code == REL_WHEEL) CORE.Input.Mouse.currentWheelMove.y += event.value;
+                CORE.Window.planeCount++;
             }
+        }
 
-            // Absolute movement parsing
-            if (event.type == EV_ABS)
-            {
-                // Basic movement
-                if (event.code == ABS_X)
-                {
-                    CORE.Input.Mouse.currentPosition.x = (event.value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;    // Scale acording to absRange
-                    CORE.Input.Touch.position[0].x = (event.value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;        // Scale acording to absRange
+        drmModeFreePlane(plane);
+    }
 
-                    touchAction = 2;    // TOUCH_ACTION_MOVE
-                    gestureUpdate = true;
-                }
+    drmModeFreePlaneResources(planeRes);
 
-                if (event.code == ABS_Y)
-                {
-                    CORE.Input.Mouse.currentPosition.y = (event.value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;  // Scale acording to absRange
-                    CORE.Input.Touch.position[0].y = (event.value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;      // Scale acording to absRange
+    if (CORE.Window.atomic && ((CORE.Window.primaryPlane == 0) || (CORE.Window.primaryPlaneFbProp == 0)))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: DRM primary plane not found, atomic modesetting disabled");
+        CORE.Window.atomic = false;
+    }
 
-                    touchAction = 2;    // TOUCH_ACTION_MOVE
-                    gestureUpdate = true;
-                }
+    TRACELOG(LOG_INFO, "DISPLAY: DRM overlay planes available: %i (%s)", CORE.Window.planeCount, CORE.Window.atomic? "atomic" : "legacy");
+}
 
-                // Multitouch movement
-                if (event.code == ABS_MT_SLOT) worker->touchSlot = event.value;   // Remember the slot number for the folowing events
+// Request overlay plane framebuffer, applied on next frame present
+static bool SetDisplayPlaneFramebufferDRM(int plane, uint32_t fb, bool imported, Rectangle source, Rectangle dest)
+{
+    if ((plane < 0) || (plane >= CORE.Window.planeCount))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Display plane [%i] not available (%i overlay planes)", plane, CORE.Window.planeCount);
+        if (imported) drmModeRmFB(CORE.Window.fd, fb);
+        return false;
+    }
 
-                if (event.code == ABS_MT_POSITION_X)
-                {
-                    if (worker->touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[worker->touchSlot].x = (event.value - worker->absRange.x)*CORE.Window.screen.width/worker->absRange.width;    // Scale acording to absRange
-                }
+    DisplayPlaneDRM *overlay = &CORE.Window.planes[plane];
 
-                if (event.code == ABS_MT_POSITION_Y)
-                {
-                    if (worker->touchSlot < MAX_TOUCH_POINTS) CORE.Input.Touch.position[worker->touchSlot].y = (event.value - worker->absRange.y)*CORE.Window.screen.height/worker->absRange.height;  // Scale acording to absRange
-                }
+    // Previous request never presented, its imported framebuffer is not required anymore
+    if (overlay->fbImported && (overlay->fb != overlay->currentFb) && (overlay->fb != fb)) drmModeRmFB(CORE.Window.fd, overlay->fb);
 
-                if (event.code == ABS_MT_TRACKING_ID)
-                {
-                    if ((event.value < 0) && (worker->touchSlot < MAX_TOUCH_POINTS))
-                    {
-                        // Touch has ended for this point
-                        CORE.Input.Touch.position[worker->touchSlot].x = -1;
-                        CORE.Input.Touch.position[worker->touchSlot].y = -1;
-                    }
-                }
+    overlay->fb = fb;
+    overlay->fbImported = imported;
+    overlay->source = source;
+    overlay->dest = dest;
+    overlay->dirty = true;
 
-                // Touchscreen tap
-                if (event.code == ABS_PRESSURE)
-                {
-                    int previousMouseLeftButtonState = CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_LEFT];
+    return true;
+}
 
-                    if (!event.value && previousMouseLeftButtonState)
-                    {
-                        CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 0;
+// Apply overlay planes requested state, added to atomic request or set with legacy ioctl (NULL)
+static void UpdateDisplayPlanesDRM(drmModeAtomicReq *request)
+{
+    for (int i = 0; i < CORE.Window.planeCount; i++)
+    {
+        DisplayPlaneDRM *overlay = &CORE.Window.planes[i];
+        if (!overlay->dirty) continue;
 
-                        touchAction = 0;    // TOUCH_ACTION_UP
-                        gestureUpdate = true;
-                    }
+        uint32_t crtcId = (overlay->fb != 0)? CORE.Window.crtc->crtc_id : 0;
 
-                    if (event.value && !previousMouseLeftButtonState)
-                    {
-                        CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 1;
+        // NOTE: Source region is defined in 16.16 fixed point, screen region in pixels (could be negative)
+        uint64_t values[PLANE_PROP_COUNT] = {
+            overlay->fb, crtcId,
+            (uint64_t)overlay->source.x << 16, (uint64_t)overlay->source.y << 16,
+            (uint64_t)overlay->source.width << 16, (uint64_t)overlay->source.height << 16,
+            (uint64_t)(int64_t)overlay->dest.x, (uint64_t)(int64_t)overlay->dest.y,
+            (uint64_t)overlay->dest.width, (uint64_t)overlay->dest.height
+        };
 
-                        touchAction = 1;    // TOUCH_ACTION_DOWN
-                        gestureUpdate = true;
-                    }
-                }
+        if (overlay->fb == 0)
+        {
+            // Disabled plane only requires framebuffer and CRTC cleared
+            for (int p = PLANE_PROP_SRC_X; p < PLANE_PROP_COUNT; p++) values[p] = 0;
+        }
 
-            }
+        if (request != NULL)
+        {
+            for (int p = 0; p < PLANE_PROP_COUNT; p++) drmModeAtomicAddProperty(request, overlay->id, overlay->props[p], values[p]);
+        }
+        else
+        {
+            int result = drmModeSetPlane(CORE.Window.fd, overlay->id, crtcId, overlay->fb, 0,
+                (int32_t)values[PLANE_PROP_CRTC_X], (int32_t)values[PLANE_PROP_CRTC_Y], (uint32_t)values[PLANE_PROP_CRTC_W], (uint32_t)values[PLANE_PROP_CRTC_H],
+                (uint32_t)values[PLANE_PROP_SRC_X], (uint32_t)values[PLANE_PROP_SRC_Y], (uint32_t)values[PLANE_PROP_SRC_W], (uint32_t)values[PLANE_PROP_SRC_H]);
 
-            // Button parsing
-            if (event.type == EV_KEY)
+            if (result != 0)
             {
-                // Mouse button parsing
-                if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
-                {
-                    CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = event.value;
-
-                    if (event.value > 0) touchAction = 1;   // TOUCH_ACTION_DOWN
-                    else touchAction = 0;       // TOUCH_ACTION_UP
-                    gestureUpdate = true;
-                }
+                // Requested state discarded, plane keeps scanning out current framebuffer
+                TRACELOG(LOG_WARNING, "DISPLAY: drmModeSetPlane() failed with result: %d", result);
+                if (overlay->fbImported && (overlay->fb != overlay->currentFb)) drmModeRmFB(CORE.Window.fd, overlay->fb);
 
-                if (event.code == BTN_RIGHT) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_RIGHT] = event.value;
-                if (event.code == BTN_MIDDLE) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_MIDDLE] = event.value;
-                if (event.code == BTN_SIDE) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_SIDE] = event.value;
-                if (event.code == BTN_EXTRA) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
-                if (event.code == BTN_FORWARD) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
-                if (event.code == BTN_BACK) CORE.Input.Mouse.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
+                overlay->fb = overlay->currentFb;
+                overlay->fbImported = overlay->currentFbImported;
+                overlay->dirty = false;
             }
+        }
+    }
+}
 
-            // Screen confinement
-            if (!CORE.Input.Mouse.cursorHidden)
-            {
-                if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
-                if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
+// Register overlay planes state applied (or discarded), release framebuffers no longer scanned out
+// NOTE: Framebuffers removed after the commit are kept by kernel until they are not scanned out anymore
+static void FinishDisplayPlanesDRM(bool applied)
+{
+    for (int i = 0; i < CORE.Window.planeCount; i++)
+    {
+        DisplayPlaneDRM *overlay = &CORE.Window.planes[i];
+        if (!overlay->dirty) continue;
 
-                if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
-                if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
-            }
+        if (applied)
+        {
+            if (overlay->currentFbImported && (overlay->currentFb != overlay->fb)) drmModeRmFB(CORE.Window.fd, overlay->currentFb);
 
-#if defined(SUPPORT_GESTURES_SYSTEM)        // PLATFORM_RPI, PLATFORM_DRM
-            if (gestureUpdate)
-            {
-                GestureEvent gestureEvent = { 0 };
+            overlay->currentFb = overlay->fb;
+            overlay->currentFbImported = overlay->fbImported;
+        }
+        else
+        {
+            // Requested state discarded, plane keeps scanning out current framebuffer
+            if (overlay->fbImported && (overlay->fb != overlay->currentFb)) drmModeRmFB(CORE.Window.fd, overlay->fb);
 
-                gestureEvent.pointCount = 0;
-                gestureEvent.touchAction = touchAction;
+            overlay->fb = overlay->currentFb;
+            overlay->fbImported = overlay->currentFbImported;
+        }
+
+        overlay->dirty = false;
+    }
+}
+#endif
 
-                if (CORE.Input.Touch.position[0].x >= 0) gestureEvent.pointCount++;
-                if (CORE.Input.Touch.position[1].x >= 0) gestureEvent.pointCount++;
-                if (CORE.Input.Touch.position[2].x >= 0) gestureEvent.pointCount++;
-                if (CORE.Input.Touch.position[3].x >= 0) gestureEvent.pointCount++;
+#if defined(SUPPORT_GIF_RECORDING)
+// Add queued screen readbacks to GIF recording (in order)
+// NOTE: Readback rows are bottom-up, flip is done by msf_gif using a negative pitch
+static void CollectGifFrames(bool wait)
+{
+    AcquireRenderContext();     // Threaded renderer: pixel buffers mapped, OpenGL context required
 
-                gestureEvent.pointId[0] = 0;
-                gestureEvent.pointId[1] = 1;
-                gestureEvent.pointId[2] = 2;
-                gestureEvent.pointId[3] = 3;
+    int width = 0;
+    int height = 0;
+    unsigned char *pixels = NULL;
 
-                gestureEvent.position[0] = CORE.Input.Touch.position[0];
-                gestureEvent.position[1] = CORE.Input.Touch.position[1];
-                gestureEvent.position[2] = CORE.Input.Touch.position[2];
-                gestureEvent.position[3] = CORE.Input.Touch.position[3];
+    while ((pixels = rlCollectScreenPixels(&width, &height, wait)) != NULL)
+    {
+        // NOTE: Frames with a size different than recording one (window resized) are discarded
+        // Pixels are copied to release mapped pixel buffer, encoding is done on loader thread
+        if ((width == gifState.width) && (height == gifState.height))
+        {
+            GifFramePending *frame = GetGifFrame();
 
-                ProcessGestureEvent(gestureEvent);
-            }
-#endif
+            memcpy(frame->pixels, pixels, width*height*4);
+            frame->pitch = -width*4;
+            EncodeGifFrame(frame);
+        }
+
+        rlReleaseScreenPixels();
+    }
+}
+
+// Get a free GIF frame buffer, waits for oldest frame encoding if required
+// NOTE: Frames buffers are allocated once with recording size and reused
+static GifFramePending *GetGifFrame(void)
+{
+    if (gifFramesPendingCount == MAX_GIF_FRAMES_PENDING)
+    {
+        // Encoding slower than recording, wait for oldest frame
+        GifFramePending *oldest = &gifFrames[gifFramesFirst];
+
+        while (!IsAsyncLoadReady(oldest->request))
+        {
+            ProcessAsyncLoads(0.0);
+            if (!IsAsyncLoadReady(oldest->request)) WaitTime(0.001);
         }
 
-        WaitTime(0.005);    // Sleep for 5ms to avoid hogging CPU time
+        ReleaseGifFrames(false);
     }
 
-    close(worker->fd);
+    GifFramePending *frame = &gifFrames[(gifFramesFirst + gifFramesPendingCount)%MAX_GIF_FRAMES_PENDING];
 
-    return NULL;
+    if (frame->pixels == NULL) frame->pixels = (unsigned char *)RL_MALLOC(gifState.width*gifState.height*4);
+    frame->delay = (100 + gifFramerate/2)/gifFramerate;
+
+    return frame;
 }
 
-// Initialize gamepad system
-static void InitGamepad(void)
+// Queue GIF frame encoding on async loader thread
+// NOTE: Frames are encoded in queue order, if async loads queue is full frame is encoded synchronously
+static void EncodeGifFrame(GifFramePending *frame)
 {
-    char gamepadDev[128] = { 0 };
+    frame->request = LoadAsync(EncodeGifFrameAsync, NULL, frame);
 
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    if (frame->request < 0)
     {
-        sprintf(gamepadDev, "%s%i", DEFAULT_GAMEPAD_DEV, i);
+        ReleaseGifFrames(true);     // Pending frames encoded first, recording state only accessed by one thread
+        EncodeGifFrameAsync(frame);
+    }
+    else gifFramesPendingCount++;
+}
 
-        if ((CORE.Input.Gamepad.streamId[i] = open(gamepadDev, O_RDONLY | O_NONBLOCK)) < 0)
-        {
-            // NOTE: Only show message for first gamepad
-            if (i == 0) TRACELOG(LOG_WARNING, "RPI: Failed to open Gamepad device, no gamepad available");
-        }
-        else
-        {
-            CORE.Input.Gamepad.ready[i] = true;
+// Encode GIF frame into recording (loader thread)
+// NOTE: Color quantization and LZW compression of one frame, most expensive GIF recording step
+static void EncodeGifFrameAsync(void *data)
+{
+    GifFramePending *frame = (GifFramePending *)data;
 
-            // NOTE: Only create one thread
-            if (i == 0)
-            {
-                int error = pthread_create(&CORE.Input.Gamepad.threadId, NULL, &GamepadThread, NULL);
+    msf_gif_frame(&gifState, frame->pixels, frame->delay, 16, frame->pitch);
+}
 
-                if (error != 0) TRACELOG(LOG_WARNING, "RPI: Failed to create gamepad input event thread");
-                else  TRACELOG(LOG_INFO, "RPI: Gamepad device initialized successfully");
+// Release encoded GIF frames buffers, all pending frames waited if requested
+// NOTE: Buffers are released in encoding order, they are kept allocated for next frames
+static void ReleaseGifFrames(bool wait)
+{
+    while (gifFramesPendingCount > 0)
+    {
+        GifFramePending *frame = &gifFrames[gifFramesFirst];
+
+        if (wait)
+        {
+            while (!IsAsyncLoadReady(frame->request))
+            {
+                ProcessAsyncLoads(0.0);
+                if (!IsAsyncLoadReady(frame->request)) WaitTime(0.001);
             }
         }
+        else if (!IsAsyncLoadReady(frame->request)) break;
+
+        GetAsyncLoadData(frame->request, NULL);
+        frame->request = -1;
+
+        gifFramesFirst = (gifFramesFirst + 1)%MAX_GIF_FRAMES_PENDING;
+        gifFramesPendingCount--;
     }
 }
 
-// Process Gamepad (/dev/input/js0)
-static void *GamepadThread(void *arg)
+// Finish GIF frames encoding, frames buffers unloaded
+// NOTE: Required before msf_gif_end(), recording state is accessed by loader thread while frames pending
+static void CloseGifFrames(void)
 {
-    #define JS_EVENT_BUTTON         0x01    // Button pressed/released
-    #define JS_EVENT_AXIS           0x02    // Joystick axis moved
-    #define JS_EVENT_INIT           0x80    // Initial state of device
+    CollectGifFrames(true);
+    ReleaseGifFrames(true);
 
-    struct js_event {
-        unsigned int time;      // event timestamp in milliseconds
-        short value;            // event value
-        unsigned char type;     // event type
-        unsigned char number;   // event axis/button number
-    };
+    for (int i = 0; i < MAX_GIF_FRAMES_PENDING; i++)
+    {
+        RL_FREE(gifFrames[i].pixels);
+        gifFrames[i].pixels = NULL;
+    }
 
-    // Read gamepad event
-    struct js_event gamepadEvent = { 0 };
+    gifFramesFirst = 0;
+}
+#endif
 
-    while (!CORE.Window.shouldClose)
+#if defined(SUPPORT_MODULE_RTEXTURES)
+// Collect screenshots readbacks to be exported, exported screenshots released
+// NOTE: Readbacks are collected in order, if wait is requested all pending screenshots are exported
+static void CollectScreenshots(bool wait)
+{
+    AcquireRenderContext();     // Threaded renderer: pixel buffers mapped, OpenGL context required
+
+    for (int i = 0; i < screenshotsPendingCount; i++)
     {
-        for (int i = 0; i < MAX_GAMEPADS; i++)
-        {
-            if (read(CORE.Input.Gamepad.streamId[i], &gamepadEvent, sizeof(struct js_event)) == (int)sizeof(struct js_event))
-            {
-                gamepadEvent.type &= ~JS_EVENT_INIT;     // Ignore synthetic events
+        ScreenshotPending *screenshot = screenshotsPending[i];
+        if (!screenshot->readback) continue;
 
-                // Process gamepad events by type
-                if (gamepadEvent.type == JS_EVENT_BUTTON)
-                {
-                    //TRACELOG(LOG_WARNING, "RPI: Gamepad button: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
+        int width = 0;
+        int height = 0;
+        unsigned char *pixels = rlCollectScreenPixels(&width, &height, wait);
+        if (pixels == NULL) break;      // Readbacks still being transferred by GPU
 
-                    if (gamepadEvent.number < MAX_GAMEPAD_BUTTONS)
-                    {
-                        // 1 - button pressed, 0 - button released
-                        CORE.Input.Gamepad.currentButtonState[i][gamepadEvent.number] = (int)gamepadEvent.value;
+        // Flip image vertically and set alpha component to 255 (no transparent image retrieval), same as rlReadScreenPixels()
+        unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4);
 
-                        if ((int)gamepadEvent.value == 1) CORE.Input.Gamepad.lastButtonPressed = gamepadEvent.number;
-                        else CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
-                    }
-                }
-                else if (gamepadEvent.type == JS_EVENT_AXIS)
-                {
-                    //TRACELOG(LOG_WARNING, "RPI: Gamepad axis: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
+        for (int y = 0; y < height; y++) memcpy(imgData + y*width*4, pixels + (height - 1 - y)*width*4, width*4);
+        for (int p = 3; p < width*height*4; p += 4) imgData[p] = 255;
 
-                    if (gamepadEvent.number < MAX_GAMEPAD_AXIS)
-                    {
-                        // NOTE: Scaling of gamepadEvent.value to get values between -1..1
-                        CORE.Input.Gamepad.axisState[i][gamepadEvent.number] = (float)gamepadEvent.value/32768;
-                    }
-                }
+        rlReleaseScreenPixels();
+
+        screenshot->image = (Image){ imgData, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        screenshot->readback = false;
+        ExportScreenshot(screenshot);
+    }
+
+    int count = 0;
+
+    for (int i = 0; i < screenshotsPendingCount; i++)
+    {
+        ScreenshotPending *screenshot = screenshotsPending[i];
+
+        if (wait && !screenshot->readback)
+        {
+            while (!screenshot->exported)
+            {
+                ProcessAsyncLoads(0.0);
+                if (!screenshot->exported) WaitTime(0.001);
             }
-            else WaitTime(0.001);    // Sleep for 1 ms to avoid hogging CPU time
         }
+
+        if (screenshot->exported)
+        {
+            if (screenshot->request >= 0) GetAsyncLoadData(screenshot->request, FinalizeScreenshotAsync);
+            RL_FREE(screenshot);
+        }
+        else screenshotsPending[count++] = screenshot;
     }
 
-    return NULL;
+    screenshotsPendingCount = count;
 }
-#endif  // PLATFORM_RPI || PLATFORM_DRM
 
-#if defined(PLATFORM_DRM)
-// Search matching DRM mode in connector's mode list
-static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode)
+// Queue screenshot image export on async loader thread
+// NOTE: If async loads queue is full, image is exported synchronously
+static void ExportScreenshot(ScreenshotPending *screenshot)
 {
-    if (NULL == connector) return -1;
-    if (NULL == mode) return -1;
+    screenshot->request = LoadAsync(ExportScreenshotAsync, FinalizeScreenshotAsync, screenshot);
 
-    // safe bitwise comparison of two modes
-    #define BINCMP(a, b) memcmp((a), (b), (sizeof(a) < sizeof(b)) ? sizeof(a) : sizeof(b))
+    if (screenshot->request < 0)
+    {
+        ExportScreenshotAsync(screenshot);
+        FinalizeScreenshotAsync(screenshot);
+    }
+}
 
-    for (size_t i = 0; i < connector->count_modes; i++)
+// Export screenshot image file (loader thread)
+static void ExportScreenshotAsync(void *data)
+{
+    ScreenshotPending *screenshot = (ScreenshotPending *)data;
+
+    screenshot->success = ExportImage(screenshot->image, screenshot->path);    // WARNING: Module required: rtextures
+
+    RL_FREE(screenshot->image.data);
+    screenshot->image.data = NULL;
+}
+
+// Finalize screenshot export (main thread)
+static void FinalizeScreenshotAsync(void *data)
+{
+    ScreenshotPending *screenshot = (ScreenshotPending *)data;
+
+    if (screenshot->success)
     {
-        TRACELOG(LOG_TRACE, "DISPLAY: DRM mode: %d %ux%u@%u %s", i, connector->modes[i].hdisplay, connector->modes[i].vdisplay,
-            connector->modes[i].vrefresh, (connector->modes[i].flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+    #if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(screenshot->path), GetFileName(screenshot->path)));
+    #endif
 
-        if (0 == BINCMP(&CORE.Window.crtc->mode, &CORE.Window.connector->modes[i])) return i;
+        TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", screenshot->path);
     }
 
-    return -1;
+    screenshot->exported = true;
+}
+#endif
 
-    #undef BINCMP
+// Set shader default locations (attributes, uniforms and uniform blocks)
+// NOTE: If any location is not found, loc point becomes -1
+static void SetShaderDefaultLocations(unsigned int id, int *locs)
+{
+    // Default shader attribute locations have been binded before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
+    //          vertex boneIds location     = 6
+    //          vertex boneWeights location = 7
+
+    // All locations reset to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) locs[i] = -1;
+
+    // Get handles to GLSL input attribute locations
+    // NOTE: Skinning, instancing, morphing and stereo locations are optional, not found only logged as debug
+    locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttribEx(id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS, true);
+    locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttribEx(id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS, true);
+    locs[SHADER_LOC_INSTANCE_COLOR] = rlGetLocationAttribEx(id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR, true);
+    locs[SHADER_LOC_INSTANCE_TRANSFORM] = rlGetLocationAttribEx(id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM, true);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniformEx(id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES, true);
+    locs[SHADER_LOC_MORPH_WEIGHTS] = rlGetLocationUniformEx(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS, true);
+    locs[SHADER_LOC_MORPH_TARGETS] = rlGetLocationUniformEx(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS, true);
+    locs[SHADER_LOC_MATRIX_MVP_STEREO] = rlGetLocationUniformEx(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO, true);
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
+    locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
+    locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+
+    // Get handles to GLSL uniform blocks (if uniform buffer objects supported)
+    locs[SHADER_LOC_BLOCK_FRAME] = rlGetLocationUniformBlock(id, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME);
+    locs[SHADER_LOC_BLOCK_DRAW] = rlGetLocationUniformBlock(id, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_DRAW);
 }
 
-// Search exactly matching DRM connector mode in connector's list
-static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced)
+// Unproject normalized device coordinates point with inverse view-projection matrix
+// NOTE: Same as Vector3Unproject() with matrix inverse already computed
+static Vector3 UnprojectPoint(Vector3 source, Matrix invViewProj)
 {
-    TRACELOG(LOG_TRACE, "DISPLAY: Searching exact connector mode for %ux%u@%u, selecting an interlaced mode is allowed: %s", width, height, fps, allowInterlaced ? "yes" : "no");
+    Quaternion point = QuaternionTransform((Quaternion){ source.x, source.y, source.z, 1.0f }, invViewProj);
+
+    Vector3 result = { point.x/point.w, point.y/point.w, point.z/point.w };
+
+    return result;
+}
+
+// Finish shader loading asynchronously, set its locations and remove it from pending list
+// NOTE: Failed shaders use default shader code, they are not cached
+static void FinishShaderPending(int index)
+{
+    ShaderPending pending = shadersPending[index];
+
+    bool result = rlFinishShaderProgram(pending.shader.id);
+    SetShaderDefaultLocations(pending.shader.id, pending.shader.locs);
+
+#if defined(SUPPORT_SHADER_CACHE)
+    if (result && (pending.cacheKey != 0)) SaveShaderCacheBinary(pending.shader.id, pending.cacheKey);
+#endif
+
+    shadersPending[index] = shadersPending[shadersPendingCount - 1];
+    shadersPendingCount--;
+}
+
+#if defined(SUPPORT_FRAME_TIME_STATS)
+// Record last frame times into frame time samples
+static void RecordFrameTimeSample(void)
+{
+    FrameTimeSample sample = { 0 };
+    sample.frame = CORE.Time.frameCounter;
+    sample.update = (float)CORE.Time.update;
+    sample.draw = (float)CORE.Time.draw;
+    sample.wait = (float)(CORE.Time.frame - CORE.Time.update - CORE.Time.draw);
+
+    frameTimeSamples[frameTimeSamplesIndex] = sample;
+    frameTimeSamplesIndex = (frameTimeSamplesIndex + 1)%frameTimeSamplesWindow;
+    if (frameTimeSamplesCount < frameTimeSamplesWindow) frameTimeSamplesCount++;
+}
+
+// Compare float values, required by qsort()
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+#endif
+
+#if defined(SUPPORT_SHADER_CACHE)
+// Load shader program from binaries cache, compile and cache it on miss
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode)
+{
+    // Cache disabled or default shader requested, nothing to cache
+    if ((shaderCacheDirectory[0] == '\0') || ((vsCode == NULL) && (fsCode == NULL))) return rlLoadShaderCode(vsCode, fsCode);
+
+    unsigned long long key = rlGetShaderBinaryKey(vsCode, fsCode);
+    unsigned int id = LoadShaderCacheBinary(key);
+
+    if (id == 0)
+    {
+        id = rlLoadShaderCode(vsCode, fsCode);
+
+        // NOTE: Shaders failing to compile fallback to default shader, it is not cached
+        if ((id > 0) && (id != rlGetShaderIdDefault())) SaveShaderCacheBinary(id, key);
+    }
+
+    return id;
+}
 
-    if (NULL == connector) return -1;
+// Load shader program from binaries cache file, 0 if not available or rejected by driver
+// NOTE: Cache file contains a small header: "rSPB" identifier, binary format (4 bytes) and binary size (4 bytes)
+static unsigned int LoadShaderCacheBinary(unsigned long long key)
+{
+    unsigned int id = 0;
+    char fileName[MAX_FILEPATH_LENGTH] = { 0 };
 
-    for (int i = 0; i < CORE.Window.connector->count_modes; i++)
+    if (GetShaderCacheFileName(key, fileName) && FileExists(fileName))
     {
-        const drmModeModeInfo *const mode = &CORE.Window.connector->modes[i];
+        unsigned int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
 
-        TRACELOG(LOG_TRACE, "DISPLAY: DRM Mode %d %ux%u@%u %s", i, mode->hdisplay, mode->vdisplay, mode->vrefresh, (mode->flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+        if ((fileData != NULL) && (dataSize > SHADER_CACHE_HEADER_SIZE) && (memcmp(fileData, "rSPB", 4) == 0))
+        {
+            unsigned int format = 0;
+            unsigned int size = 0;
+            memcpy(&format, fileData + 4, 4);
+            memcpy(&size, fileData + 8, 4);
 
-        if ((mode->flags & DRM_MODE_FLAG_INTERLACE) && (!allowInterlaced)) continue;
+            if (size == (dataSize - SHADER_CACHE_HEADER_SIZE)) id = rlLoadShaderProgramBinary(fileData + SHADER_CACHE_HEADER_SIZE, (int)size, format);
+        }
 
-        if ((mode->hdisplay == width) && (mode->vdisplay == height) && (mode->vrefresh == fps)) return i;
+        UnloadFileData(fileData);
+
+        if (id == 0) TRACELOG(LOG_WARNING, "SHADER: Cached program binary not valid, compiling shader: %s", fileName);
     }
 
-    TRACELOG(LOG_TRACE, "DISPLAY: No DRM exact matching mode found");
-    return -1;
+    return id;
 }
 
-// Search the nearest matching DRM connector mode in connector's list
-static int FindNearestConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced)
+// Get binaries cache file name for shader program key
+// NOTE: Cache is skipped if file path does not fit MAX_FILEPATH_LENGTH
+static bool GetShaderCacheFileName(unsigned long long key, char *fileName)
 {
-    TRACELOG(LOG_TRACE, "DISPLAY: Searching nearest connector mode for %ux%u@%u, selecting an interlaced mode is allowed: %s", width, height, fps, allowInterlaced ? "yes" : "no");
-
-    if (NULL == connector) return -1;
+    int length = snprintf(fileName, MAX_FILEPATH_LENGTH, "%s/shader_%016llx.bin", shaderCacheDirectory, key);
 
-    int nearestIndex = -1;
-    for (int i = 0; i < CORE.Window.connector->count_modes; i++)
+    if ((length < 0) || (length >= MAX_FILEPATH_LENGTH))
     {
-        const drmModeModeInfo *const mode = &CORE.Window.connector->modes[i];
+        TRACELOG(LOG_WARNING, "SHADER: Binaries cache file path too long, cache skipped: %s", shaderCacheDirectory);
+        return false;
+    }
 
-        TRACELOG(LOG_TRACE, "DISPLAY: DRM mode: %d %ux%u@%u %s", i, mode->hdisplay, mode->vdisplay, mode->vrefresh,
-            (mode->flags & DRM_MODE_FLAG_INTERLACE) ? "interlaced" : "progressive");
+    return true;
+}
 
-        if ((mode->hdisplay < width) || (mode->vdisplay < height))
-        {
-            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode is too small");
-            continue;
-        }
+// Save shader program binary into binaries cache file
+static void SaveShaderCacheBinary(unsigned int id, unsigned long long key)
+{
+    int size = 0;
+    unsigned int format = 0;
+    unsigned char *binary = rlGetShaderProgramBinary(id, &size, &format);
 
-        if ((mode->flags & DRM_MODE_FLAG_INTERLACE) && (!allowInterlaced))
-        {
-            TRACELOG(LOG_TRACE, "DISPLAY: DRM shouldn't choose an interlaced mode");
-            continue;
-        }
+    if (binary == NULL) return;
 
-        if (nearestIndex < 0)
-        {
-            nearestIndex = i;
-            continue;
-        }
+    char fileName[MAX_FILEPATH_LENGTH] = { 0 };
 
-        const int widthDiff = abs(mode->hdisplay - width);
-        const int heightDiff = abs(mode->vdisplay - height);
-        const int fpsDiff = abs(mode->vrefresh - fps);
+    if (GetShaderCacheFileName(key, fileName))
+    {
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(size + SHADER_CACHE_HEADER_SIZE);
+        memcpy(fileData, "rSPB", 4);
+        memcpy(fileData + 4, &format, 4);
+        memcpy(fileData + 8, &size, 4);
+        memcpy(fileData + SHADER_CACHE_HEADER_SIZE, binary, size);
 
-        const int nearestWidthDiff = abs(CORE.Window.connector->modes[nearestIndex].hdisplay - width);
-        const int nearestHeightDiff = abs(CORE.Window.connector->modes[nearestIndex].vdisplay - height);
-        const int nearestFpsDiff = abs(CORE.Window.connector->modes[nearestIndex].vrefresh - fps);
+        SaveFileData(fileName, fileData, size + SHADER_CACHE_HEADER_SIZE);
 
-        if ((widthDiff < nearestWidthDiff) || (heightDiff < nearestHeightDiff) || (fpsDiff < nearestFpsDiff)) {
-            nearestIndex = i;
-        }
+        RL_FREE(fileData);
     }
 
-    return nearestIndex;
+    RL_FREE(binary);
 }
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-// NOTE: Loading happens over AutomationEvent *events
-// TODO: This system should probably be redesigned
-static void LoadAutomationEvents(const char *fileName)
+// Write bytes to events stream (buffered)
+static void WriteAutomationBytes(const unsigned char *bytes, unsigned int size)
 {
-    // Load events file (binary)
-    /*
-    FILE *repFile = fopen(fileName, "rb");
-    unsigned char fileId[4] = { 0 };
-    
-    fread(fileId, 1, 4, repFile);
-
-    if ((fileId[0] == 'r') && (fileId[1] == 'E') && (fileId[2] == 'P') && (fileId[1] == ' '))
+    for (unsigned int i = 0; i < size; i++)
     {
-        fread(&eventCount, sizeof(int), 1, repFile);
-        TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-        fread(events, sizeof(AutomationEvent), eventCount, repFile);
-    }
+        if (eventStream.bufferSize == AUTOMATION_EVENTS_BUFFER_SIZE)
+        {
+            fwrite(eventStream.buffer, 1, eventStream.bufferSize, eventStream.file);
+            eventStream.offset += eventStream.bufferSize;
+            eventStream.bufferSize = 0;
+        }
 
-    fclose(repFile);
-    */
+        eventStream.buffer[eventStream.bufferSize] = bytes[i];
+        eventStream.bufferSize++;
+    }
+}
 
-    // Load events file (text)
-    FILE *repFile = fopen(fileName, "rt");
+// Write variable-length unsigned value to events stream (7 bits per byte, LEB128)
+static void WriteAutomationVarint(unsigned int value)
+{
+    unsigned char bytes[5] = { 0 };
+    unsigned int size = 0;
 
-    if (repFile != NULL)
+    do
     {
-        unsigned int count = 0;
-        char buffer[256] = { 0 };
+        bytes[size] = (unsigned char)(value & 0x7f);
+        value >>= 7;
+        if (value > 0) bytes[size] |= 0x80;
+        size++;
+    } while (value > 0);
+
+    WriteAutomationBytes(bytes, size);
+}
 
-        fgets(buffer, 256, repFile);
+// Read variable-length unsigned value from events stream
+static bool ReadAutomationVarint(unsigned int *value)
+{
+    *value = 0;
 
-        while (!feof(repFile))
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        if (eventStream.bufferPosition == eventStream.bufferSize)
         {
-            if (buffer[0] == 'c') sscanf(buffer, "c %i", &eventCount);
-            else if (buffer[0] == 'e')
-            {
-                sscanf(buffer, "e %d %d %d %d %d", &events[count].frame, &events[count].type,
-                       &events[count].params[0], &events[count].params[1], &events[count].params[2]);
+            // Refill stream buffer, events data ends before seek points index
+            unsigned int offset = eventStream.offset + eventStream.bufferSize;
+            unsigned int size = ((eventStream.end - offset) < AUTOMATION_EVENTS_BUFFER_SIZE)? (eventStream.end - offset) : AUTOMATION_EVENTS_BUFFER_SIZE;
 
-                count++;
-            }
+            eventStream.offset = offset;
+            eventStream.bufferSize = (size > 0)? (unsigned int)fread(eventStream.buffer, 1, size, eventStream.file) : 0;
+            eventStream.bufferPosition = 0;
 
-            fgets(buffer, 256, repFile);
+            if (eventStream.bufferSize == 0) return false;
         }
 
-        if (count != eventCount) TRACELOG(LOG_WARNING, "Events count provided is different than count");
+        unsigned char byte = eventStream.buffer[eventStream.bufferPosition];
+        eventStream.bufferPosition++;
 
-        fclose(repFile);
+        *value |= (unsigned int)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) return true;
     }
 
-    TRACELOG(LOG_WARNING, "Events loaded: %i", eventCount);
+    return false;
 }
 
-// Export recorded events into a file
-static void ExportAutomationEvents(const char *fileName)
+// Record event into events stream (current frame)
+// NOTE: Called from input callbacks on main thread, only input changes are recorded
+static void RecordAutomationEvent(unsigned int type, int param0, int param1, int param2)
 {
-    unsigned char fileId[4] = "rEP ";
+    if (!eventsRecording) return;
 
-    // Save as binary
-    /*
-    FILE *repFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, repFile);
-    fwrite(&eventCount, sizeof(int), 1, repFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, repFile);
-    fclose(repFile);
-    */
+    unsigned int frame = CORE.Time.frameCounter - eventStream.frameStart;
+    int params[3] = { param0, param1, param2 };
 
-    // Export events as text
-    FILE *repFile = fopen(fileName, "wt");
+    WriteAutomationVarint(type);
+    WriteAutomationVarint(frame - eventStream.frame);
 
-    if (repFile != NULL)
+    for (int i = 0; i < autoEventParamCount[type]; i++)
     {
-        fprintf(repFile, "# Automation events list\n");
-        fprintf(repFile, "#    c <events_count>\n");
-        fprintf(repFile, "#    e <frame> <event_type> <param0> <param1> <param2> // <event_type_name>\n");
+        // Params delta is zigzag-encoded, small negative deltas also use few bytes
+        int delta = (int)((unsigned int)params[i] - (unsigned int)eventStream.params[type][i]);
+        WriteAutomationVarint(((unsigned int)delta << 1) ^ (unsigned int)(delta >> 31));
+        eventStream.params[type][i] = params[i];
+    }
 
-        fprintf(repFile, "c %i\n", eventCount);
-        for (int i = 0; i < eventCount; i++)
-        {
-            fprintf(repFile, "e %i %i %i %i %i // %s\n", events[i].frame, events[i].type,
-                    events[i].params[0], events[i].params[1], events[i].params[2], autoEventTypeName[events[i].type]);
-        }
+    eventStream.frame = frame;
+    eventStream.eventCount++;
 
-        fclose(repFile);
-    }
+    TRACELOG(LOG_DEBUG, "AUTOMATION: [%i] %s: %i, %i, %i", frame, autoEventTypeName[type], param0, param1, param2);
 }
 
-// EndDrawing() -> After PollInputEvents()
-// Check event in current frame and save into the events[i] array
-static void RecordAutomationEvent(unsigned int frame)
+// Record sync record: input state snapshot and seek point
+// NOTE: Snapshot stores input state at the start of frame, playing can start from any sync record
+static void RecordAutomationSync(unsigned int frame)
 {
-    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+    if (eventStream.seekPointCount >= eventStream.seekPointCapacity)
     {
-        // INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_UP;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
+        unsigned int capacity = (eventStream.seekPointCapacity > 0)? eventStream.seekPointCapacity*2 : 64;
+        AutomationSeekPoint *seekPoints = (AutomationSeekPoint *)RL_REALLOC(eventStream.seekPoints, capacity*sizeof(AutomationSeekPoint));
 
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+        if (seekPoints != NULL)
+        {
+            eventStream.seekPoints = seekPoints;
+            eventStream.seekPointCapacity = capacity;
         }
+    }
+
+    if (eventStream.seekPointCount < eventStream.seekPointCapacity)
+    {
+        eventStream.seekPoints[eventStream.seekPointCount].frame = frame;
+        eventStream.seekPoints[eventStream.seekPointCount].offset = eventStream.offset + eventStream.bufferSize;
+        eventStream.seekPointCount++;
+    }
+
+    WriteAutomationVarint(AUTOMATION_EVENT_SYNC);
+    WriteAutomationVarint(frame);
+
+    // Reset delta-encoding bases, sync record is decoded independently
+    eventStream.frame = frame;
+    memset(eventStream.params, 0, sizeof(eventStream.params));
+
+    // Keyboard keys down, ascending keys delta
+    unsigned int keyCount = 0;
+    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++) if (CORE.Input.Keyboard.currentKeyState[key]) keyCount++;
 
-        // INPUT_KEY_DOWN
+    WriteAutomationVarint(keyCount);
+    for (int key = 0, previousKey = 0; key < MAX_KEYBOARD_KEYS; key++)
+    {
         if (CORE.Input.Keyboard.currentKeyState[key])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_DOWN;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
+            WriteAutomationVarint(key - previousKey);
+            previousKey = key;
+        }
+    }
+
+    // Mouse buttons mask and position
+    unsigned int buttons = 0;
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++) if (CORE.Input.Mouse.currentButtonState[button]) buttons |= (1u << button);
 
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+    WriteAutomationVarint(buttons);
+    WriteAutomationVarint((unsigned int)(int)CORE.Input.Mouse.currentPosition.x);
+    WriteAutomationVarint((unsigned int)(int)CORE.Input.Mouse.currentPosition.y);
+
+    // Touch points mask and positions
+    unsigned int touches = 0;
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++) if (CORE.Input.Touch.currentTouchState[id]) touches |= (1u << id);
+
+    WriteAutomationVarint(touches);
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+    {
+        if (CORE.Input.Touch.currentTouchState[id])
+        {
+            WriteAutomationVarint((unsigned int)(int)CORE.Input.Touch.position[id].x);
+            WriteAutomationVarint((unsigned int)(int)CORE.Input.Touch.position[id].y);
         }
+
+        eventStream.touchPosition[id] = CORE.Input.Touch.position[id];
     }
 
-    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    // Gamepads ready mask, buttons mask and axis (float bits)
+    unsigned int gamepads = 0;
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++) if (CORE.Input.Gamepad.ready[gamepad]) gamepads |= (1u << gamepad);
+
+    WriteAutomationVarint(gamepads);
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
     {
-        // INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
+        eventStream.gamepadReady[gamepad] = CORE.Input.Gamepad.ready[gamepad];
+
+        if (CORE.Input.Gamepad.ready[gamepad])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_UP;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
+            buttons = 0;
+            for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++) if (CORE.Input.Gamepad.currentButtonState[gamepad][button]) buttons |= (1u << button);
 
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            WriteAutomationVarint(buttons);
+            for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+            {
+                unsigned int value = 0;
+                memcpy(&value, &CORE.Input.Gamepad.axisState[gamepad][axis], sizeof(float));
+                WriteAutomationVarint(value);
+            }
         }
 
-        // INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_DOWN;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++) eventStream.gamepadAxis[gamepad][axis] = CORE.Input.Gamepad.axisState[gamepad][axis];
+    }
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    eventStream.gesture = GESTURES.current;
+#endif
+    WriteAutomationVarint((unsigned int)eventStream.gesture);
+}
 
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+// Record polled inputs changes at frame end (mouse, touch, gamepad, gestures)
+// NOTE: Keyboard keys and char queues are recorded on input callbacks, avoiding keys scanning
+static void RecordAutomationFrame(unsigned int frame)
+{
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        if (CORE.Input.Mouse.currentButtonState[button] != CORE.Input.Mouse.previousButtonState[button])
+        {
+            RecordAutomationEvent(CORE.Input.Mouse.currentButtonState[button]? INPUT_MOUSE_BUTTON_DOWN : INPUT_MOUSE_BUTTON_UP, button, 0, 0);
         }
     }
 
@@ -7094,244 +11330,336 @@ static void RecordAutomationEvent(unsigned int frame)
     if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
         ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_POSITION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        events[eventCount].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        RecordAutomationEvent(INPUT_MOUSE_POSITION, (int)CORE.Input.Mouse.currentPosition.x, (int)CORE.Input.Mouse.currentPosition.y, 0);
     }
 
-    // INPUT_MOUSE_WHEEL_MOTION
-    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
-        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    // INPUT_MOUSE_WHEEL_MOTION (wheel move is reset every frame)
+    if ((CORE.Input.Mouse.currentWheelMove.x != 0.0f) || (CORE.Input.Mouse.currentWheelMove.y != 0.0f))
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_WHEEL_MOTION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;;
-        events[eventCount].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_WHEEL_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        int wheel[2] = { 0 };
+        memcpy(wheel, &CORE.Input.Mouse.currentWheelMove, 2*sizeof(float));
+        RecordAutomationEvent(INPUT_MOUSE_WHEEL_MOTION, wheel[0], wheel[1], 0);
     }
 
     for (int id = 0; id < MAX_TOUCH_POINTS; id++)
     {
-        // INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_UP;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
-
-        // INPUT_TOUCH_DOWN
-        if (CORE.Input.Touch.currentTouchState[id])
+        if (CORE.Input.Touch.currentTouchState[id] != CORE.Input.Touch.previousTouchState[id])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_DOWN;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            RecordAutomationEvent(CORE.Input.Touch.currentTouchState[id]? INPUT_TOUCH_DOWN : INPUT_TOUCH_UP, id, 0, 0);
         }
 
-        // INPUT_TOUCH_POSITION
-        // TODO: It requires the id!
-        /*
-        if (((int)CORE.Input.Touch.currentPosition[id].x != (int)CORE.Input.Touch.previousPosition[id].x) ||
-            ((int)CORE.Input.Touch.currentPosition[id].y != (int)CORE.Input.Touch.previousPosition[id].y))
+        if (CORE.Input.Touch.currentTouchState[id] &&
+            (((int)CORE.Input.Touch.position[id].x != (int)eventStream.touchPosition[id].x) ||
+             ((int)CORE.Input.Touch.position[id].y != (int)eventStream.touchPosition[id].y)))
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_POSITION;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = (int)CORE.Input.Touch.currentPosition[id].x;
-            events[eventCount].params[2] = (int)CORE.Input.Touch.currentPosition[id].y;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            RecordAutomationEvent(INPUT_TOUCH_POSITION, id, (int)CORE.Input.Touch.position[id].x, (int)CORE.Input.Touch.position[id].y);
+            eventStream.touchPosition[id] = CORE.Input.Touch.position[id];
         }
-        */
     }
 
     for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
     {
-        // INPUT_GAMEPAD_CONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == true)) // Check if changed to ready
+        if (CORE.Input.Gamepad.ready[gamepad] != eventStream.gamepadReady[gamepad])
         {
-            // TODO: Save gamepad connect event
+            RecordAutomationEvent(CORE.Input.Gamepad.ready[gamepad]? INPUT_GAMEPAD_CONNECT : INPUT_GAMEPAD_DISCONNECT, gamepad, 0, 0);
+            eventStream.gamepadReady[gamepad] = CORE.Input.Gamepad.ready[gamepad];
         }
-        */
 
-        // INPUT_GAMEPAD_DISCONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == false)) // Check if changed to not-ready
-        {
-            // TODO: Save gamepad disconnect event
-        }
-        */
+        if (!CORE.Input.Gamepad.ready[gamepad]) continue;
 
         for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
         {
-            // INPUT_GAMEPAD_BUTTON_UP
-            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button])
+            if (CORE.Input.Gamepad.currentButtonState[gamepad][button] != CORE.Input.Gamepad.previousButtonState[gamepad][button])
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_UP;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                RecordAutomationEvent(CORE.Input.Gamepad.currentButtonState[gamepad][button]? INPUT_GAMEPAD_BUTTON_DOWN : INPUT_GAMEPAD_BUTTON_UP, gamepad, button, 0);
             }
+        }
 
-            // INPUT_GAMEPAD_BUTTON_DOWN
-            if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+        {
+            if (CORE.Input.Gamepad.axisState[gamepad][axis] != eventStream.gamepadAxis[gamepad][axis])
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_DOWN;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                int value = 0;
+                memcpy(&value, &CORE.Input.Gamepad.axisState[gamepad][axis], sizeof(float));
+                RecordAutomationEvent(INPUT_GAMEPAD_AXIS_MOTION, gamepad, axis, value);
+                eventStream.gamepadAxis[gamepad][axis] = CORE.Input.Gamepad.axisState[gamepad][axis];
             }
         }
+    }
 
-        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // INPUT_GESTURE (only saved if changed)
+    if (GESTURES.current != eventStream.gesture)
+    {
+        RecordAutomationEvent(INPUT_GESTURE, GESTURES.current, 0, 0);
+        eventStream.gesture = GESTURES.current;
+    }
+#endif
+
+    // Sync record for next frame, seek point with input state at next frame start
+    if (((frame + 1)%AUTOMATION_EVENTS_SYNC_INTERVAL) == 0) RecordAutomationSync(frame + 1);
+}
+
+// Read next event from events stream
+// NOTE: Only sync frame is read for sync records, input state is read when played
+static bool ReadAutomationEvent(AutomationEvent *event)
+{
+    unsigned int type = 0;
+    unsigned int value = 0;
+
+    if (!ReadAutomationVarint(&type) || !ReadAutomationVarint(&value)) return false;
+
+    if (type == AUTOMATION_EVENT_SYNC)
+    {
+        event->type = type;
+        event->frame = value;
+
+        eventStream.frame = value;
+        memset(eventStream.params, 0, sizeof(eventStream.params));
+
+        return true;
+    }
+
+    if (type >= AUTOMATION_EVENT_TYPE_COUNT)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: Events stream not valid, event type unknown (%i)", type);
+        return false;
+    }
+
+    event->type = type;
+    event->frame = eventStream.frame + value;
+    eventStream.frame = event->frame;
+
+    for (int i = 0; i < autoEventParamCount[type]; i++)
+    {
+        if (!ReadAutomationVarint(&value)) return false;
+
+        int delta = (int)(value >> 1) ^ -(int)(value & 1);
+        eventStream.params[type][i] = (int)((unsigned int)eventStream.params[type][i] + (unsigned int)delta);
+        event->params[i] = eventStream.params[type][i];
+    }
+
+    return true;
+}
+
+// Read sync record input state snapshot and apply it
+static bool ReadAutomationState(void)
+{
+    unsigned int value = 0;
+    unsigned int count = 0;
+    unsigned int key = 0;
+
+    // Keyboard keys down
+    if (!ReadAutomationVarint(&count)) return false;
+
+    char keyState[MAX_KEYBOARD_KEYS] = { 0 };
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (!ReadAutomationVarint(&value)) return false;
+
+        key += value;
+        if (key < MAX_KEYBOARD_KEYS) keyState[key] = 1;
+    }
+
+    for (int k = 0; k < MAX_KEYBOARD_KEYS; k++) SetKeyState(k, keyState[k]);
+
+    // Mouse buttons mask and position
+    if (!ReadAutomationVarint(&value)) return false;
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++) CORE.Input.Mouse.currentButtonState[button] = (char)((value >> button) & 1);
+
+    if (!ReadAutomationVarint(&value)) return false;
+    CORE.Input.Mouse.currentPosition.x = (float)(int)value;
+    if (!ReadAutomationVarint(&value)) return false;
+    CORE.Input.Mouse.currentPosition.y = (float)(int)value;
+
+    // Touch points mask and positions
+    unsigned int touches = 0;
+    if (!ReadAutomationVarint(&touches)) return false;
+
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+    {
+        CORE.Input.Touch.currentTouchState[id] = (char)((touches >> id) & 1);
+
+        if (CORE.Input.Touch.currentTouchState[id])
+        {
+            if (!ReadAutomationVarint(&value)) return false;
+            CORE.Input.Touch.position[id].x = (float)(int)value;
+            if (!ReadAutomationVarint(&value)) return false;
+            CORE.Input.Touch.position[id].y = (float)(int)value;
+        }
+    }
+
+    // Gamepads ready mask, buttons mask and axis (float bits)
+    unsigned int gamepads = 0;
+    if (!ReadAutomationVarint(&gamepads)) return false;
+
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
+        CORE.Input.Gamepad.ready[gamepad] = ((gamepads >> gamepad) & 1);
+
+        if (CORE.Input.Gamepad.ready[gamepad])
         {
-            // INPUT_GAMEPAD_AXIS_MOTION
-            if (CORE.Input.Gamepad.axisState[gamepad][axis] > 0.1f)
+            if (!ReadAutomationVarint(&value)) return false;
+            for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++) CORE.Input.Gamepad.currentButtonState[gamepad][button] = (char)((value >> button) & 1);
+
+            for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_AXIS_MOTION;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = axis;
-                events[eventCount].params[2] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_AXIS_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                if (!ReadAutomationVarint(&value)) return false;
+                memcpy(&CORE.Input.Gamepad.axisState[gamepad][axis], &value, sizeof(float));
             }
         }
     }
 
-    // INPUT_GESTURE
-    if (GESTURES.current != GESTURE_NONE)
+    if (!ReadAutomationVarint(&value)) return false;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    GESTURES.current = (int)value;
+#endif
+
+    return true;
+}
+
+// Apply event to input state, transient events skipped on seeking
+// NOTE: Event parameters are validated, events file could be corrupted
+static void ApplyAutomationEvent(const AutomationEvent *event, bool seeking)
+{
+    const int *params = event->params;
+
+    switch (event->type)
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_GESTURE;
-        events[eventCount].params[0] = GESTURES.current;
-        events[eventCount].params[1] = 0;
-        events[eventCount].params[2] = 0;
+        // Input events
+        case INPUT_KEY_UP:              // param[0]: key
+        case INPUT_KEY_DOWN:            // param[0]: key
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_KEYBOARD_KEYS)) SetKeyState(params[0], (event->type == INPUT_KEY_DOWN));
+        } break;
+        case INPUT_KEY_PRESSED:         // param[0]: key
+        {
+            if (!seeking && (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE))
+            {
+                CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = params[0];
+                CORE.Input.Keyboard.keyPressedQueueCount++;
+            }
+        } break;
+        case INPUT_CHAR_PRESSED:        // param[0]: codepoint
+        {
+            if (!seeking && (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE))
+            {
+                CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = params[0];
+                CORE.Input.Keyboard.charPressedQueueCount++;
+            }
+        } break;
+        case INPUT_MOUSE_BUTTON_UP:     // param[0]: button
+        case INPUT_MOUSE_BUTTON_DOWN:   // param[0]: button
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_MOUSE_BUTTONS)) CORE.Input.Mouse.currentButtonState[params[0]] = (event->type == INPUT_MOUSE_BUTTON_DOWN);
+        } break;
+        case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
+        {
+            CORE.Input.Mouse.currentPosition.x = (float)params[0];
+            CORE.Input.Mouse.currentPosition.y = (float)params[1];
+        } break;
+        case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta (float bits)
+        {
+            if (!seeking) memcpy(&CORE.Input.Mouse.currentWheelMove, params, 2*sizeof(float));
+        } break;
+        case INPUT_TOUCH_UP:            // param[0]: id
+        case INPUT_TOUCH_DOWN:          // param[0]: id
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_TOUCH_POINTS)) CORE.Input.Touch.currentTouchState[params[0]] = (event->type == INPUT_TOUCH_DOWN);
+        } break;
+        case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_TOUCH_POINTS))
+            {
+                CORE.Input.Touch.position[params[0]].x = (float)params[1];
+                CORE.Input.Touch.position[params[0]].y = (float)params[2];
+            }
+        } break;
+        case INPUT_GAMEPAD_CONNECT:     // param[0]: gamepad
+        case INPUT_GAMEPAD_DISCONNECT:  // param[0]: gamepad
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS)) CORE.Input.Gamepad.ready[params[0]] = (event->type == INPUT_GAMEPAD_CONNECT);
+        } break;
+        case INPUT_GAMEPAD_BUTTON_UP:   // param[0]: gamepad, param[1]: button
+        case INPUT_GAMEPAD_BUTTON_DOWN: // param[0]: gamepad, param[1]: button
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_BUTTONS))
+            {
+                CORE.Input.Gamepad.currentButtonState[params[0]][params[1]] = (event->type == INPUT_GAMEPAD_BUTTON_DOWN);
+            }
+        } break;
+        case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: value (float bits)
+        {
+            if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_AXIS))
+            {
+                memcpy(&CORE.Input.Gamepad.axisState[params[0]][params[1]], &params[2], sizeof(float));
+            }
+        } break;
+    #if defined(SUPPORT_GESTURES_SYSTEM)
+        case INPUT_GESTURE: GESTURES.current = params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
+    #endif
+
+        // Window events
+        case WINDOW_CLOSE: if (!seeking) CORE.Window.shouldClose = true; break;
+        case WINDOW_MAXIMIZE: if (!seeking) MaximizeWindow(); break;
+        case WINDOW_MINIMIZE: if (!seeking) MinimizeWindow(); break;
+        case WINDOW_RESIZE: if (!seeking) SetWindowSize(params[0], params[1]); break;
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_GESTURE: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        // Custom events
+        case ACTION_TAKE_SCREENSHOT:
+        {
+            if (!seeking)
+            {
+                TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                screenshotCounter++;
+            }
+        } break;
+        case ACTION_SETTARGETFPS: SetTargetFPS(params[0]); break;
+        default: break;
     }
 }
 
-// Play automation event
-static void PlayAutomationEvent(unsigned int frame)
+// Play events stream up to frame (included)
+// NOTE: Sync records apply the input state snapshot, stream ends playing when no more events available
+static void PlayAutomationEvents(unsigned int frame, bool seeking)
 {
-    for (unsigned int i = 0; i < eventCount; i++)
+    while (eventStream.nextReady && (eventStream.next.frame <= frame))
     {
-        if (events[i].frame == frame)
+        if (eventStream.next.type == AUTOMATION_EVENT_SYNC)
         {
-            switch (events[i].type)
+            if (!ReadAutomationState())
             {
-                // Input events
-                case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = false; break;             // param[0]: key
-                case INPUT_KEY_DOWN: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = true; break;            // param[0]: key
-                case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = false; break;    // param[0]: key
-                case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = true; break;   // param[0]: key
-                case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
-                {
-                    CORE.Input.Mouse.currentPosition.x = (float)events[i].params[0];
-                    CORE.Input.Mouse.currentPosition.y = (float)events[i].params[1];
-                } break;
-                case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
-                {
-                    CORE.Input.Mouse.currentWheelMove.x = (float)events[i].params[0]; break;
-                    CORE.Input.Mouse.currentWheelMove.y = (float)events[i].params[1]; break;
-                } break;
-                case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[events[i].params[0]] = false; break;            // param[0]: id
-                case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[events[i].params[0]] = true; break;           // param[0]: id
-                case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
-                {
-                    CORE.Input.Touch.position[events[i].params[0]].x = (float)events[i].params[1];
-                    CORE.Input.Touch.position[events[i].params[0]].y = (float)events[i].params[2];
-                } break;
-                case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = true; break;                // param[0]: gamepad
-                case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = false; break;            // param[0]: gamepad
-                case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = false; break;    // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = true; break;   // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
-                {
-                    CORE.Input.Gamepad.axisState[events[i].params[0]][events[i].params[1]] = ((float)events[i].params[2]/32768.0f);
-                } break;
-                case INPUT_GESTURE: GESTURES.current = events[i].params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
-
-                // Window events
-                case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
-                case WINDOW_MAXIMIZE: MaximizeWindow(); break;
-                case WINDOW_MINIMIZE: MinimizeWindow(); break;
-                case WINDOW_RESIZE: SetWindowSize(events[i].params[0], events[i].params[1]); break;
-
-                // Custom events
-                case ACTION_TAKE_SCREENSHOT:
-                {
-                    TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-                    screenshotCounter++;
-                } break;
-                case ACTION_SETTARGETFPS: SetTargetFPS(events[i].params[0]); break;
-                default: break;
+                eventStream.nextReady = false;
+                break;
             }
         }
+        else
+        {
+            ApplyAutomationEvent(&eventStream.next, seeking);
+            eventStream.eventCount++;
+        }
+
+        eventStream.nextReady = ReadAutomationEvent(&eventStream.next);
+    }
+
+    if (!eventStream.nextReady && !seeking)
+    {
+        TRACELOG(LOG_INFO, "AUTOMATION: Events playing finished: %i events, %i frames", eventStream.eventCount, frame + 1);
+        StopAutomationEventPlaying();
     }
 }
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
 const char *TextFormat(const char *text, ...)
 {
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS      4        // Maximum number of static buffers for text formatting
-#endif
-#ifndef MAX_TEXT_BUFFER_LENGTH
-    #define MAX_TEXT_BUFFER_LENGTH   1024        // Maximum size of static text buffer
-#endif
-
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
-
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
-
     va_list args;
     va_start(args, text);
-    vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    const char *result = FormatFrameMemory(text, args);
     va_end(args);
 
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
-
-    return currentBuffer;
+    return (result != NULL)? result : "";
 }
 #endif // !SUPPORT_MODULE_RTEXT
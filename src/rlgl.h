@@ -45,16 +45,59 @@
 *   #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *       Enable debug context (only available on OpenGL 4.3)
 *
+*   #define RLGL_ENABLE_PERSISTENT_MAPPING
+*       Allocate render batch vertex buffers as persistently mapped rings (GL_ARB_buffer_storage),
+*       vertex data is written directly into GPU-visible memory and ring segments are fenced,
+*       only available on OpenGL 3.3+ if extension is supported, fallbacks to glBufferSubData() otherwise
+*
+*   #define RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER
+*       Store render batch vertex data interleaved { position, texcoord, color } (24 bytes per vertex)
+*       in a single array and VBO, only one buffer update is required per batch draw
+*
+*   #define RLGL_ENABLE_GPU_TIMERS
+*       Enable GPU timestamp queries for rlBeginGpuScope()/rlEndGpuScope() scopes, raylib opens scopes
+*       automatically for frame, texture, shader and 3d modes, results are read back without blocking
+*       RL_GPU_TIMER_FRAMES frames later, only available on OpenGL 3.3+ (GL_ARB_timer_query)
+*
+*   #define RLGL_ENABLE_MULTI_TEXTURE_BATCH
+*       Store a texture slot per vertex on render batch, default shader samples from an array of
+*       RL_DEFAULT_BATCH_TEXTURE_SLOTS textures, so draws using different textures can share a draw call,
+*       custom shaders keep getting a new draw call on every texture change
+*
+*   #define RLGL_DISABLE_SIMD_TRANSFORM
+*       Disable SSE2/NEON vertex transform used by rlVertex*() and rlVertexQuads() when matrix
+*       stack transform is required (rlPushMatrix()), scalar code is used instead
+*
+*   #define RLGL_DISABLE_STATE_CACHE
+*       Disable OpenGL state cache and shader uniform locations cache, all state calls are issued to
+*       OpenGL even if state does not change (program, textures, VAO, blend, depth, cull and scissor),
+*       otherwise rlResetStateCache() must be called after changing that state with raw OpenGL calls
+*
+*   #define RLGL_ENABLE_THREAD_BATCHES
+*       Keep rlgl state per thread (thread-local), so worker threads can record vertex data on their own
+*       rlThreadBatch (rlBeginThreadBatch()/rlEndThreadBatch()) using rlgl vertex level functions,
+*       without calling OpenGL, recorded batches are drawn in order by context thread (rlDrawThreadBatch())
+*
 *   rlgl capabilities could be customized just defining some internal
 *   values before library inclusion (default values listed):
 *
 *   #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
-*   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*   #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS_UINT  8192    // Default internal render batch elements limits (OpenGL ES 2.0 with 32-bit indices)
+*   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering, buffers are fenced before reuse on OpenGL 3.3)
 *   #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *   #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*   #define RL_DEFAULT_BATCH_STREAM_SEGMENTS      3    // Number of ring segments per vertex buffer when using persistent mapping
+*   #define RL_DEFAULT_BATCH_TEXTURE_SLOTS        8    // Number of textures a draw call can sample when using multi-texture batch (max: 16)
+*   #define RL_MAX_GPU_SCOPES                    64    // Maximum number of GPU timer scopes per frame
+*   #define RL_GPU_TIMER_FRAMES                   3    // Number of frames GPU timer queries are kept in flight before read back
+*   #define RL_MAX_RECORDS                       64    // Maximum number of records (static vertex data and draws) loaded at once
+*   #define RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE 131072    // Size of internal draw uniform block buffer (bytes), ranges are reused on wrap
+*   #define RL_MAX_UNIFORM_LOCATIONS_CACHE      256    // Maximum number of shader uniform locations cached (shader id and name)
+*   #define RL_TEXTURE_UPLOAD_BUFFERS             4    // Number of pixel buffers (PBO ring) used by rlUpdateTextureAsync()
+*   #define RL_SCREEN_READBACK_BUFFERS            2    // Number of pixel buffers (PBO ring) used by rlRequestScreenPixels()
 *
 *   #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
-*   #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*   #define RL_MAX_SHADER_LOCATIONS              40    // Maximum number of shader locations supported
 *   #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *   #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -76,6 +119,12 @@
 *   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 *
+*   When uniform buffer objects are supported (OpenGL 3.1), the following std140 uniform blocks
+*   are bound automatically if declared by the shader:
+*
+*   #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME "raylibFrame"       // frame block: mat4 matView, mat4 matProjection (binding point: 0)
+*   #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_DRAW  "raylibDraw"        // draw block: mat4 mvp, mat4 matModel, mat4 matNormal, vec4 colDiffuse (binding point: 1)
+*
 *   DEPENDENCIES:
 *
 *      - OpenGL libraries (depending on platform and OpenGL version selected)
@@ -199,6 +248,8 @@
         // NOTE: On HTML5 (emscripten) this is allocated on heap,
         // by default it's only 16MB!...just take care...
         #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS  2048
+        // Elements limit used instead if 32-bit indices are supported (GL_OES_element_index_uint)
+        #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS_UINT  8192
     #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
@@ -210,6 +261,33 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_STREAM_SEGMENTS
+    #define RL_DEFAULT_BATCH_STREAM_SEGMENTS         3      // Number of ring segments per vertex buffer when using persistent mapping
+#endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+    #define RL_DEFAULT_BATCH_TEXTURE_SLOTS           8      // Number of textures a draw call can sample when using multi-texture batch (max: 16)
+#endif
+#ifndef RL_MAX_GPU_SCOPES
+    #define RL_MAX_GPU_SCOPES                       64      // Maximum number of GPU timer scopes per frame
+#endif
+#ifndef RL_GPU_TIMER_FRAMES
+    #define RL_GPU_TIMER_FRAMES                      3      // Number of frames GPU timer queries are kept in flight before read back
+#endif
+#ifndef RL_MAX_RECORDS
+    #define RL_MAX_RECORDS                          64      // Maximum number of records (static vertex data and draws) loaded at once
+#endif
+#ifndef RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE
+    #define RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE   131072      // Size of internal draw uniform block buffer (bytes), ranges are reused on wrap
+#endif
+#ifndef RL_MAX_UNIFORM_LOCATIONS_CACHE
+    #define RL_MAX_UNIFORM_LOCATIONS_CACHE         256      // Maximum number of shader uniform locations cached (shader id and name)
+#endif
+#ifndef RL_TEXTURE_UPLOAD_BUFFERS
+    #define RL_TEXTURE_UPLOAD_BUFFERS                4      // Number of pixel buffers (PBO ring) used by rlUpdateTextureAsync()
+#endif
+#ifndef RL_SCREEN_READBACK_BUFFERS
+    #define RL_SCREEN_READBACK_BUFFERS               2      // Number of pixel buffers (PBO ring) used by rlRequestScreenPixels()
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -218,7 +296,7 @@
 
 // Shader limits
 #ifndef RL_MAX_SHADER_LOCATIONS
-    #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
+    #define RL_MAX_SHADER_LOCATIONS                 40      // Maximum number of shader locations supported
 #endif
 
 // Projection matrix culling
@@ -249,6 +327,12 @@
 #define RL_TEXTURE_WRAP_MIRROR_REPEAT           0x8370      // GL_MIRRORED_REPEAT
 #define RL_TEXTURE_WRAP_MIRROR_CLAMP            0x8742      // GL_MIRROR_CLAMP_EXT
 
+// Texture types (equivalent to OpenGL defines)
+#define RL_TEXTURE_2D                           0x0DE1      // GL_TEXTURE_2D
+#define RL_TEXTURE_CUBE_MAP                     0x8513      // GL_TEXTURE_CUBE_MAP
+#define RL_TEXTURE_2D_ARRAY                     0x8C1A      // GL_TEXTURE_2D_ARRAY
+#define RL_TEXTURE_3D                           0x806F      // GL_TEXTURE_3D
+
 // Matrix modes (equivalent to OpenGL)
 #define RL_MODELVIEW                            0x1700      // GL_MODELVIEW
 #define RL_PROJECTION                           0x1701      // GL_PROJECTION
@@ -260,8 +344,12 @@
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_SHORT                                0x1402      // GL_SHORT
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
+#define RL_HALF_FLOAT                           0x140B      // GL_HALF_FLOAT (GL_HALF_FLOAT_OES on OpenGL ES 2.0)
 
 // GL buffer usage hint
 #define RL_STREAM_DRAW                          0x88E0      // GL_STREAM_DRAW
@@ -274,6 +362,12 @@
 #define RL_DYNAMIC_READ                         0x88E9      // GL_DYNAMIC_READ
 #define RL_DYNAMIC_COPY                         0x88EA      // GL_DYNAMIC_COPY
 
+// GL framebuffer targets and buffers masks
+#define RL_READ_FRAMEBUFFER                     0x8CA8      // GL_READ_FRAMEBUFFER
+#define RL_DRAW_FRAMEBUFFER                     0x8CA9      // GL_DRAW_FRAMEBUFFER
+#define RL_COLOR_BUFFER_BIT                     0x00004000  // GL_COLOR_BUFFER_BIT
+#define RL_DEPTH_BUFFER_BIT                     0x00000100  // GL_DEPTH_BUFFER_BIT
+
 // GL Shader type
 #define RL_FRAGMENT_SHADER                      0x8B30      // GL_FRAGMENT_SHADER
 #define RL_VERTEX_SHADER                        0x8B31      // GL_VERTEX_SHADER
@@ -340,14 +434,23 @@ typedef struct rlVertexBuffer {
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    float *texslots;            // Vertex texture slot (1 component per vertex) (shader-location = 6)
 #endif
+    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+                                // NOTE: On OpenGL ES 2.0 without GL_OES_element_index_uint, uploaded as 16-bit indices
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+                                // NOTE: Using RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER, texcoords and colors point
+                                // into vertices array and all vertex data is stored in vboId[0]
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    unsigned int texslotsVboId; // OpenGL Vertex Buffer Object id for texture slots
+#endif
+
+    bool persistentMapped;      // Vertex data arrays point to persistently mapped GPU memory (RLGL_ENABLE_PERSISTENT_MAPPING)
+    int currentSegment;         // Current ring segment being filled (persistent mapping only)
+    void *segmentFence[RL_DEFAULT_BATCH_STREAM_SEGMENTS]; // Fence sync objects protecting ring segments in use by GPU (GLsync)
+    void *fence;                // Fence sync object protecting buffer in use by GPU (GLsync)
 } rlVertexBuffer;
 
 // Draw call type
@@ -361,6 +464,11 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, first sort key in sorted batch mode (see rlEnableSortedBatch())
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    unsigned int textureSlots[RL_DEFAULT_BATCH_TEXTURE_SLOTS]; // Textures sampled by the draw, textureSlots[0] is textureId
+    int textureSlotCount;       // Number of texture slots in use
+#endif
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -377,6 +485,9 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Render batch callback, called before default render batch vertex data is drawn
+typedef void (*rlRenderBatchCallback)(void);
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -476,7 +587,17 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,          // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,       // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,        // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF              // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_BLOCK_FRAME,          // Shader location: uniform block: frame (view, projection)
+    RL_SHADER_LOC_BLOCK_DRAW,           // Shader location: uniform block: draw (mvp, model, normal, color diffuse)
+    RL_SHADER_LOC_VERTEX_BONEIDS,       // Shader location: vertex attribute: boneIds
+    RL_SHADER_LOC_VERTEX_BONEWEIGHTS,   // Shader location: vertex attribute: boneWeights
+    RL_SHADER_LOC_BONE_MATRICES,        // Shader location: array of matrices uniform: boneMatrices
+    RL_SHADER_LOC_INSTANCE_COLOR,       // Shader location: vertex attribute: instanceColor (per-instance tint)
+    RL_SHADER_LOC_INSTANCE_TRANSFORM,   // Shader location: vertex attribute: instanceTransform (per-instance model matrix)
+    RL_SHADER_LOC_MORPH_WEIGHTS,        // Shader location: array of floats uniform: morphWeights
+    RL_SHADER_LOC_MORPH_TARGETS,        // Shader location: sampler2d texture: morphTargets (morph targets deltas)
+    RL_SHADER_LOC_MATRIX_MVP_STEREO     // Shader location: array of matrices uniform: mvpStereo (single pass stereo eyes)
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE       RL_SHADER_LOC_MAP_ALBEDO
@@ -536,6 +657,59 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// GPU memory allocation type, tracked on GPU memory usage registry
+typedef enum {
+    RL_GPU_MEMORY_TEXTURE = 0,      // Textures and cubemaps (including mipmaps), also depth textures
+    RL_GPU_MEMORY_RENDERBUFFER,     // Renderbuffers (depth attachments)
+    RL_GPU_MEMORY_VERTEX_BUFFER,    // Vertex buffers (VBO) and element buffers (EBO)
+    RL_GPU_MEMORY_SHADER_BUFFER,    // Shader storage buffers (SSBO) and uniform buffers (UBO)
+    RL_GPU_MEMORY_FRAMEBUFFER       // Framebuffers (no memory, attachments are accounted on their own type)
+} rlGpuMemoryType;
+
+// Render batch flush reason
+typedef enum {
+    RL_FLUSH_REQUESTED = 0,         // Flush requested explicitly: rlDrawRenderBatchActive(), mode/target changes, end of frame
+    RL_FLUSH_BATCH_LIMIT,           // Vertex buffer limit reached (rlCheckRenderBatchLimit())
+    RL_FLUSH_TEXTURE_CHANGE,        // Draw calls limit reached on texture change (rlSetTexture())
+    RL_FLUSH_MODE_CHANGE,           // Draw calls limit reached on primitive mode change (rlBegin())
+    RL_FLUSH_LAYER_CHANGE,          // Draw calls limit reached on draw layer change (rlSetDrawLayer())
+    RL_FLUSH_SHADER_CHANGE,         // Shader change (rlSetShader())
+    RL_FLUSH_BLEND_CHANGE           // Blend mode change (rlSetBlendMode())
+} rlFlushReason;
+
+// Render statistics, accumulated since last rlResetRenderStats()
+typedef struct rlRenderStats {
+    int batchFlushes;               // Render batch flushes with vertex data (rlDrawRenderBatch())
+    int flushReasons[8];            // Render batch flushes by reason (rlFlushReason)
+    int drawCalls;                  // Draw calls issued, render batch and vertex arrays
+    int vertexCount;                // Vertex drawn, render batch and vertex arrays
+    int textureBinds;               // Texture bindings
+    int shaderSwitches;             // Shader program changes (rlSetShader(), rlEnableShader())
+    unsigned int bytesUploaded;     // Bytes uploaded to GPU: render batch, vertex buffers and textures updates
+    int bufferWaits;                // Render batch buffers reuses that had to wait for GPU to finish with them
+    int bufferOrphans;              // Render batch buffers updates that orphaned storage still in use by GPU (no wait)
+    int stateCallsSkipped;          // Redundant OpenGL state calls skipped by state cache
+} rlRenderStats;
+
+// Draw indirect command, indexed draw parameters (layout required by glMultiDrawElementsIndirect())
+typedef struct rlDrawIndirectCommand {
+    unsigned int count;             // Indices count
+    unsigned int instanceCount;     // Instances count
+    unsigned int firstIndex;        // First index in bound indices buffer
+    int baseVertex;                 // Value added to every index
+    unsigned int baseInstance;      // First instance for instanced vertex attributes
+} rlDrawIndirectCommand;
+
+// Thread batch, opaque type, vertex data recorded from a worker thread (RLGL_ENABLE_THREAD_BATCHES)
+typedef struct rlThreadBatch rlThreadBatch;
+
+// GPU timer scope
+typedef struct rlGpuScope {
+    char name[32];                  // Scope name
+    int depth;                      // Scope nesting depth (0 for top level scopes)
+    double time;                    // Scope GPU time in milliseconds
+} rlGpuScope;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -569,6 +743,8 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertexQuads(const float *vertices, const float *texcoords, int quadCount); // Define multiple quads (position, texcoord or NULL) - 4 vertex by quad, current color
+RLAPI void rlVertexQuads2D(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount); // Define multiple 2d quads (position XY, texcoord, color by quad or NULL) - current depth
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -606,7 +782,11 @@ RLAPI void rlDisableShader(void);                       // Disable shader progra
 // Framebuffer state
 RLAPI void rlEnableFramebuffer(unsigned int id);        // Enable render texture (fbo)
 RLAPI void rlDisableFramebuffer(void);                  // Disable render texture (fbo), return to default framebuffer
+RLAPI void rlSetFramebufferDefault(unsigned int id);    // Set default framebuffer (offscreen fbo instead of window framebuffer)
 RLAPI void rlActiveDrawBuffers(int count);              // Activate multiple draw color buffers
+RLAPI void rlBindFramebuffer(unsigned int target, unsigned int framebuffer); // Bind framebuffer (fbo) to target (RL_READ_FRAMEBUFFER, RL_DRAW_FRAMEBUFFER)
+RLAPI void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX, int dstY, int dstWidth, int dstHeight, int bufferMask); // Blit read framebuffer region to draw framebuffer (nearest filtering)
+RLAPI void rlInvalidateFramebuffer(int bufferMask);    // Invalidate bound framebuffer (fbo) buffers contents (RL_COLOR_BUFFER_BIT, RL_DEPTH_BUFFER_BIT), not stored by tile-based GPUs
 
 // General render state
 RLAPI void rlEnableColorBlend(void);                     // Enable color blending
@@ -615,6 +795,7 @@ RLAPI void rlEnableDepthTest(void);                     // Enable depth test
 RLAPI void rlDisableDepthTest(void);                    // Disable depth test
 RLAPI void rlEnableDepthMask(void);                     // Enable depth write
 RLAPI void rlDisableDepthMask(void);                    // Disable depth write
+RLAPI void rlColorMask(bool r, bool g, bool b, bool a);  // Set color channels write mask
 RLAPI void rlEnableBackfaceCulling(void);               // Enable backface culling
 RLAPI void rlDisableBackfaceCulling(void);              // Disable backface culling
 RLAPI void rlSetCullFace(int mode);                     // Set face culling mode
@@ -630,10 +811,16 @@ RLAPI void rlDisableSmoothLines(void);                  // Disable line aliasing
 RLAPI void rlEnableStereoRender(void);                  // Enable stereo rendering
 RLAPI void rlDisableStereoRender(void);                 // Disable stereo rendering
 RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo render is enabled
+RLAPI void rlEnableStereoSinglePass(void);              // Enable single pass stereo rendering (eyes drawn as instances, requires OpenGL 3.3)
+RLAPI void rlDisableStereoSinglePass(void);             // Disable single pass stereo rendering
+RLAPI bool rlIsStereoSinglePassEnabled(void);           // Check if single pass stereo rendering is enabled (and stereo render enabled)
+RLAPI void rlBeginStereoSinglePass(int locIndex, Matrix modelview); // Begin single pass stereo draw: set eyes mvp matrices uniform array and enable eyes clipping
+RLAPI void rlEndStereoSinglePass(void);                 // End single pass stereo draw
 
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
+RLAPI void rlResetStateCache(void);                     // Reset OpenGL state cache (required after changing state with raw OpenGL calls)
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
@@ -652,7 +839,9 @@ RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuff
 RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuffer height
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
+RLAPI unsigned int rlGetTextureIdCurrent(void);         // Get current texture id (used on batch drawing)
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id (used on rendering)
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
 
 // Render batch management
@@ -664,8 +853,58 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // D
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI bool rlIsRenderBatchDefault(void);                                    // Check if default render batch and shader are active (context thread, not recording or sorted)
+RLAPI bool rlIsRenderBatchEmpty(void);                                      // Check if active render batch has no vertex data pending
+RLAPI void rlSetRenderBatchCallback(rlRenderBatchCallback callback);        // Set callback called before default render batch is drawn (deferred draws, NULL to disable)
+RLAPI rlRenderBatchCallback rlGetRenderBatchCallback(void);                // Get callback called before default render batch is drawn (callbacks chaining)
+RLAPI rlRenderStats rlGetRenderStats(void);                                 // Get render statistics accumulated since last reset (raylib resets them on BeginDrawing())
+RLAPI void rlResetRenderStats(void);                                        // Reset render statistics
+RLAPI unsigned long long rlGetGpuMemoryUsage(void);                         // Get GPU memory used by loaded textures, renderbuffers and buffers (bytes)
+RLAPI unsigned long long rlGetGpuMemoryUsageType(int type, int *count);     // Get GPU memory used by one allocation type (rlGpuMemoryType) and objects count
+RLAPI void rlTraceGpuMemoryUsage(bool allocations);                         // Log GPU memory usage per allocation type, optionally every allocation
+
+// GPU timers management (RLGL_ENABLE_GPU_TIMERS)
+RLAPI void rlBeginGpuScope(const char *name);                               // Begin GPU timer scope, render batch is flushed
+RLAPI void rlEndGpuScope(void);                                             // End current GPU timer scope, render batch is flushed
+RLAPI void rlUpdateGpuScopes(void);                                         // End GPU timers frame and read back available results (raylib calls it on EndDrawing())
+RLAPI const rlGpuScope *rlGetGpuScopes(int *count);                         // Get GPU timer scopes of latest frame with results available
+
+// Timer queries management
+RLAPI bool rlIsTimerQuerySupported(void);                                   // Check if timer queries are supported
+RLAPI unsigned int rlLoadTimerQuery(void);                                  // Load timer query object (0 if not supported)
+RLAPI void rlUnloadTimerQuery(unsigned int id);                             // Unload timer query object
+RLAPI void rlBeginTimerQuery(unsigned int id);                              // Begin timer query, GPU time elapsed is measured, render batch is flushed
+RLAPI void rlEndTimerQuery(void);                                           // End current timer query, render batch is flushed
+RLAPI double rlGetTimerQueryResult(unsigned int id);                        // Get timer query result in milliseconds without waiting (-1.0: not available)
+
+// Occlusion queries management
+RLAPI bool rlIsOcclusionQuerySupported(void);                               // Check if occlusion queries are supported
+RLAPI bool rlIsConditionalRenderSupported(void);                            // Check if conditional rendering (by occlusion query) is supported
+RLAPI unsigned int rlLoadOcclusionQuery(void);                              // Load occlusion query object (0 if not supported)
+RLAPI void rlUnloadOcclusionQuery(unsigned int id);                         // Unload occlusion query object
+RLAPI void rlBeginOcclusionQuery(unsigned int id);                          // Begin occlusion query, samples passing depth test are counted, render batch is flushed
+RLAPI void rlEndOcclusionQuery(void);                                       // End current occlusion query, render batch is flushed
+RLAPI int rlGetOcclusionQueryResult(unsigned int id);                       // Get occlusion query result without waiting (-1: not available, 0: occluded, 1: visible)
+RLAPI void rlBeginConditionalRender(unsigned int id);                       // Begin drawing conditioned by occlusion query result on GPU (not waiting for it), render batch is flushed
+RLAPI void rlEndConditionalRender(void);                                    // End drawing conditioned by occlusion query, render batch is flushed
+
+// Records management (static vertex data and draws, uploaded once and replayed)
+RLAPI void rlBeginRecord(void);                                             // Begin recording vertex data and draws, render batch is flushed
+RLAPI unsigned int rlEndRecord(void);                                       // End recording and upload record to GPU, returns record handle (0 on failure)
+RLAPI void rlReplay(unsigned int handle, Matrix transform);                 // Draw record, transform is applied before current modelview
+RLAPI void rlUnloadRecord(unsigned int handle);                             // Unload record from GPU memory (VRAM)
+
+// Thread batches management (RLGL_ENABLE_THREAD_BATCHES)
+RLAPI rlThreadBatch *rlLoadThreadBatch(void);                               // Load thread batch, current rlgl state is copied to it (context thread)
+RLAPI void rlUnloadThreadBatch(rlThreadBatch *batch);                       // Unload thread batch (context thread)
+RLAPI void rlBeginThreadBatch(rlThreadBatch *batch);                        // Begin recording vertex data on thread batch (worker thread)
+RLAPI void rlEndThreadBatch(void);                                          // End recording vertex data on thread batch (worker thread)
+RLAPI void rlDrawThreadBatch(rlThreadBatch *batch);                         // Draw thread batch recorded data and reset it for next recording (context thread)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlEnableSortedBatch(void);                   // Enable sorted batch mode, draws are reordered by (layer, texture, mode) on batch drawing
+RLAPI void rlDisableSortedBatch(void);                  // Disable sorted batch mode, draws keep submission order (default)
+RLAPI void rlSetDrawLayer(int layer);                   // Set current draw layer, lower layers are drawn first in sorted batch mode
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -675,27 +914,56 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset);     // Update GPU buffer with new data
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset);   // Update vertex buffer elements with new data
+RLAPI void rlResizeVertexBuffer(unsigned int id, int size, bool dynamic);           // Reallocate vertex buffer storage (previous storage orphaned, data must be uploaded again)
+RLAPI void rlResizeVertexBufferElements(unsigned int id, int size, bool dynamic);   // Reallocate vertex buffer elements storage (previous storage orphaned)
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer);
 RLAPI void rlSetVertexAttributeDivisor(unsigned int index, int divisor);
 RLAPI void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count); // Set vertex attribute default value
+RLAPI bool rlIsVertexHalfFloatSupported(void);            // Check if half-float vertex attributes are supported (RL_HALF_FLOAT)
+RLAPI bool rlIsInstancingSupported(void);                 // Check if instanced drawing is supported
 RLAPI void rlDrawVertexArray(int offset, int count);
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer);
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances);
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances);
+RLAPI void rlDrawVertexArrayLinesInstanced(int offset, int count, int instances);  // Draw vertex array lines instanced (vertex pairs)
+RLAPI void rlDrawMultiIndirect(const rlDrawIndirectCommand *commands, int drawCount); // Draw multiple indexed draws from bound vertex array (one glMultiDrawElementsIndirect() if supported)
+RLAPI void rlDrawVertexArrayIndirect(unsigned int argsBufferId, int offset);  // Draw vertex array with arguments stored in GPU buffer (count, instanceCount, first, baseInstance)
+RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int argsBufferId, int offset); // Draw vertex array elements with arguments stored in GPU buffer (rlDrawIndirectCommand)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
+RLAPI unsigned int rlLoadTextureLevels(const void *data, int width, int height, int format, int mipmapCount, int baseLevel); // Load texture in GPU with mipmaps from base level (data starts at base level)
+RLAPI void *rlLoadTextureStaging(int size, unsigned int *stagingId);      // Load texture staging pixel buffer, returns mapped memory (writable from any thread, NULL if not supported)
+RLAPI unsigned int rlLoadTextureFromStaging(unsigned int stagingId, int width, int height, int format, int mipmapCount); // Load texture from staging pixel buffer, staging buffer is released
+RLAPI unsigned int rlLoadTextureEGLImage(void *image);                     // Load texture with storage provided by an EGL image (dmabuf, GBM buffer object...), 0 if not supported
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer);               // Load depth texture/renderbuffer (to be attached to fbo)
-RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);                        // Load texture cubemap
+RLAPI unsigned int rlLoadRenderbufferMultisample(int width, int height, int format, int samples);  // Load multisample color renderbuffer (to be attached to fbo), 0 if not supported
+RLAPI unsigned int rlLoadRenderbufferDepthMultisample(int width, int height, int samples);         // Load multisample depth renderbuffer (to be attached to fbo), 0 if not supported
+RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount);       // Load texture cubemap data (faces by mipmap level)
+RLAPI unsigned int rlLoadTextureCubemapFaces(const void **faces, int size, int format, int rowLength);   // Load texture cubemap from faces data in a bigger image, faces rows separated by row length (pixels)
+RLAPI unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, bool mipmaps); // Load texture array (layers data one after the other), mipmaps generated on GPU (optional)
+RLAPI unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format); // Load 3d texture (slices data one after the other)
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture with new data
+RLAPI void rlUpdateTextureLayer(unsigned int id, int type, int layer, int width, int height, int format, const void *data); // Update texture array layer or 3d texture slice (type: RL_TEXTURE_2D_ARRAY, RL_TEXTURE_3D)
+RLAPI bool rlCopyTextureRegion(unsigned int srcId, int srcFormat, int srcX, int srcY, unsigned int dstId, int dstFormat, int dstX, int dstY, int width, int height); // Copy texture region to another texture on GPU (no CPU readback)
+RLAPI unsigned int rlUpdateTextureAsync(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update GPU texture with new data through pixel buffer (returns upload ticket, 0 if uploaded synchronously)
+RLAPI bool rlIsTextureUploadComplete(unsigned int ticket);                // Check if asynchronous texture upload has been completed by GPU (non-blocking)
+RLAPI void rlUpdateTextureLevel(unsigned int id, int level, int width, int height, int format, const void *data); // Update texture mipmap level data (level size), level memory released if data is NULL
+RLAPI void rlSetTextureBaseLevel(unsigned int id, int baseLevel);         // Set texture base mipmap level (highest resolution level sampled)
+RLAPI bool rlIsTextureBaseLevelSupported(void);                           // Check if texture base mipmap level can be set (mipmaps streaming)
+RLAPI bool rlIsTextureFormatSupported(int format);                        // Check if texture pixel format is supported by GPU (compressed and float formats extensions)
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
+RLAPI void *rlReadTextureCubemapPixels(unsigned int id, int size, int format, int mipmapCount);   // Read texture cubemap pixel data (faces by mipmap level)
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI bool rlRequestScreenPixels(int width, int height);                  // Queue screen pixel data readback into pixel buffer (non-blocking, false if not supported or no free buffer)
+RLAPI unsigned char *rlCollectScreenPixels(int *width, int *height, bool wait); // Get oldest queued screen pixel data readback (bottom-up rows, NULL if not ready), must be released
+RLAPI void rlReleaseScreenPixels(void);                                   // Release screen pixel data retrieved with rlCollectScreenPixels()
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -705,19 +973,31 @@ RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Del
 
 // Shaders management
 RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
+RLAPI unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode); // Load shader from code strings, compilation/linkage status not checked (see rlIsShaderProgramCompleted())
+RLAPI bool rlIsShaderProgramCompleted(unsigned int id);                   // Check if shader program compilation/linkage is completed (non-blocking with KHR_parallel_shader_compile)
+RLAPI bool rlFinishShaderProgram(unsigned int id);                        // Finish shader program loaded with rlLoadShaderCodeAsync(), failed programs get default shader (returns false)
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
+RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int size, unsigned int format); // Load shader program from driver binary (returns 0 if rejected)
+RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *size, unsigned int *format); // Get shader program driver binary (must be freed, NULL if not supported)
+RLAPI unsigned long long rlGetShaderBinaryKey(const char *vsCode, const char *fsCode); // Get shader program binary key, hash of shader code and driver identification
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
+RLAPI int rlGetLocationUniformEx(unsigned int shaderId, const char *uniformName, bool optional); // Get shader location uniform, optional uniforms not found only logged as debug
+RLAPI int rlGetLocationAttribEx(unsigned int shaderId, const char *attribName, bool optional);   // Get shader location attribute, optional attributes not found only logged as debug
+RLAPI int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName); // Get shader location uniform block (block index)
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count);    // Set shader value matrices array
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
+RLAPI void rlSetUniformSamplerType(int locIndex, unsigned int textureId, int type); // Set shader value sampler for texture type (RL_TEXTURE_2D, RL_TEXTURE_CUBE_MAP, RL_TEXTURE_2D_ARRAY, RL_TEXTURE_3D)
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
 RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ);  // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+RLAPI void rlComputeShaderBarrier(void);                                       // Wait for compute shader buffer writes to be visible (storage, vertex attributes, indirect commands)
 
 // Shader buffer storage object management (ssbo)
 RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
@@ -728,6 +1008,14 @@ RLAPI void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, u
 RLAPI void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count); // Copy SSBO data between buffers
 RLAPI unsigned int rlGetShaderBufferSize(unsigned int id);                      // Get SSBO buffer size
 
+// Uniform buffer object management (ubo)
+RLAPI unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint); // Load uniform buffer object (UBO)
+RLAPI void rlUnloadUniformBuffer(unsigned int uboId);                           // Unload uniform buffer object (UBO)
+RLAPI void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset); // Update UBO buffer data
+RLAPI void rlBindUniformBuffer(unsigned int id, unsigned int index, unsigned int offset, unsigned int size); // Bind UBO buffer range to binding point (size 0: full buffer)
+RLAPI void rlSetUniformBlockFrame(Matrix view, Matrix projection);              // Set default frame uniform block data (only uploaded on change)
+RLAPI void rlSetUniformBlockDraw(Matrix mvp, Matrix model, Matrix normal, const float *color); // Set default draw uniform block data (new buffer range bound)
+
 // Buffer management
 RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly);  // Bind image texture
 
@@ -816,6 +1104,79 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
+// Persistent mapped render batch buffers require buffer storage and sync objects,
+// not available on OpenGL 2.1 and OpenGL ES 2.0
+#if defined(RLGL_ENABLE_PERSISTENT_MAPPING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define RLGL_PERSISTENT_MAPPING_AVAILABLE
+#endif
+
+// Single pass stereo requires instanced drawing and clip distances (gl_InstanceID, gl_ClipDistance),
+// not available on OpenGL 2.1 and OpenGL ES 2.0
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define RLGL_STEREO_SINGLE_PASS_AVAILABLE
+#endif
+
+// GPU timestamp queries require OpenGL 3.3 (or GL_ARB_timer_query), not available on OpenGL ES 2.0
+#if defined(RLGL_ENABLE_GPU_TIMERS) && defined(GRAPHICS_API_OPENGL_33)
+    #define RLGL_GPU_TIMERS_AVAILABLE
+#endif
+
+// CPU profile scopes, not recorded by default, raylib records them into its profiler (SUPPORT_PROFILER)
+#ifndef RL_PROFILE_BEGIN
+    #define RL_PROFILE_BEGIN(name) (void)0
+#endif
+#ifndef RL_PROFILE_END
+    #define RL_PROFILE_END() (void)0
+#endif
+
+// OpenGL state cache, skips redundant state calls (program, textures, VAO, capabilities)
+#if !defined(RLGL_DISABLE_STATE_CACHE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define RLGL_STATE_CACHE_AVAILABLE
+#endif
+
+// OpenGL capabilities tracked by state cache
+#define RL_STATE_BLEND                  0
+#define RL_STATE_DEPTH_TEST             1
+#define RL_STATE_CULL_FACE              2
+#define RL_STATE_SCISSOR_TEST           3
+
+// Thread batches require rlgl state to be thread-local, rlgl global data is accessed through a pointer
+#if defined(RLGL_ENABLE_THREAD_BATCHES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define RLGL_THREAD_BATCHES_AVAILABLE
+    #if defined(__cplusplus) && (__cplusplus >= 201103L)
+        #define RL_THREAD_LOCAL thread_local
+    #elif defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define RL_THREAD_LOCAL _Thread_local
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#endif
+
+// SIMD vertex transform (matrix stack transform on rlVertex*()), scalar fallback if not available
+#if !defined(RLGL_DISABLE_SIMD_TRANSFORM)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RLGL_SIMD_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RLGL_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
+
+// Render batch vertex data layout, strides between consecutive vertex elements in arrays units
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+    #define RL_BATCH_POSITION_STRIDE     6      // Floats between vertex positions: { position (3), texcoord (2), color (1) }
+    #define RL_BATCH_TEXCOORD_STRIDE     6      // Floats between vertex texcoords
+    #define RL_BATCH_COLOR_STRIDE       24      // Bytes between vertex colors
+#else
+    #define RL_BATCH_POSITION_STRIDE     3      // Floats between vertex positions
+    #define RL_BATCH_TEXCOORD_STRIDE     2      // Floats between vertex texcoords
+    #define RL_BATCH_COLOR_STRIDE        4      // Bytes between vertex colors
+#endif
+#define RL_BATCH_VERTEX_SIZE            24      // Interleaved vertex size in bytes: 3*float + 2*float + 4*unsigned char
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -833,6 +1194,28 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
 
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH            0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS       0x87FE
+#endif
+#ifndef GL_ANY_SAMPLES_PASSED
+    #define GL_ANY_SAMPLES_PASSED               0x8C2F
+#endif
+#ifndef GL_SAMPLES_PASSED
+    #define GL_SAMPLES_PASSED                   0x8914
+#endif
+#ifndef GL_QUERY_RESULT
+    #define GL_QUERY_RESULT                     0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+    #define GL_QUERY_RESULT_AVAILABLE           0x8867
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR            0x91B1
+#endif
+
 #ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
     #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
 #endif
@@ -911,6 +1294,26 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
 
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6 (multi-texture batch)
+#endif
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT   6
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6 (GPU skinning)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7 (GPU skinning)
+#endif
+// NOTE: Bone ids location is shared with batch texture slot, no shader is expected to declare both attributes
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS       6
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS   7
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR "instanceColor"   // Per-instance tint color (instanced drawing)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM "instanceTransform" // Per-instance model matrix (instanced drawing)
+#endif
+
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #endif
@@ -929,6 +1332,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bones matrices array (GPU skinning)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS "morphWeights"    // morph targets weights array (GPU morphing)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO "mvpStereo"      // eyes model-view-projection matrices array (single pass stereo)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -938,14 +1350,61 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
+#ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS
+    #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS "morphTargets"  // morph targets deltas texture (GPU morphing)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME "raylibFrame"       // frame uniform block (view and projection matrices)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_DRAW
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_DRAW  "raylibDraw"        // draw uniform block (mvp, model and normal matrices, color diffuse)
+#endif
+
+// Default uniform blocks binding points and std140 sizes
+#define RL_UNIFORM_BLOCK_BINDING_FRAME                 0
+#define RL_UNIFORM_BLOCK_BINDING_DRAW                  1
+#define RL_UNIFORM_BLOCK_FRAME_SIZE                  128      // mat4 matView, mat4 matProjection
+#define RL_UNIFORM_BLOCK_DRAW_SIZE                   208      // mat4 mvp, mat4 matModel, mat4 matNormal, vec4 colDiffuse
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Record data, static vertex data and draws uploaded once to be replayed
+typedef struct rlRecordData {
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id: position, texcoord, color, indices, texture slots
+    rlDrawCall *draws;          // Recorded draws (NULL if record slot is free)
+    int drawCount;              // Recorded draws count
+    int vertexCount;            // Recorded vertex count (including alignment vertex)
+    int quadCount;              // Quads covered by indices buffer
+} rlRecordData;
+
+// GPU memory allocation registry entry, open addressing hash table keyed by object type and id
+typedef struct rlGpuAllocation {
+    unsigned int id;            // OpenGL object id (0: free entry)
+    int type;                   // Allocation type (rlGpuMemoryType)
+    unsigned int size;          // Allocation size in bytes
+} rlGpuAllocation;
+
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+#define RL_STATE_CACHE_UNKNOWN          0xFFFFFFFF  // State value not known, next state call is always issued
+#define RL_STATE_CACHE_TEXTURE_UNITS            16  // Texture units tracked by state cache, upper units are not cached
+#define RL_UNIFORM_LOCATION_NAME_SIZE           48  // Maximum uniform name length cached (including null terminator)
+
+// Uniform location cache entry, open addressing hash table keyed by shader id and name
+typedef struct rlUniformLocation {
+    unsigned int shaderId;      // Shader program id (0: free or removed entry)
+    unsigned int hash;          // Uniform name hash (FNV-1a, never 0 for used entries)
+    int location;               // Uniform location (-1 if not found)
+    char name[RL_UNIFORM_LOCATION_NAME_SIZE];   // Uniform name
+} rlUniformLocation;
+#endif
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
+    rlRenderStats stats;                    // Render statistics (reset by rlResetRenderStats())
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
@@ -959,19 +1418,46 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
+        bool sortedBatch;                   // Sorted batch mode, draws reordered by state on batch drawing
+        int drawLayer;                      // Current draw layer (sorted batch mode)
+        int textureSlot;                    // Current draw texture slot (added on glVertex*(), multi-texture batch)
+        unsigned int textureId;             // Current texture set by rlSetTexture() (0: none), carried into draws opened by rlBegin() (multi-texture batch)
+        int flushReason;                    // Reason for next render batch flush (rlFlushReason), reset after flush
+        rlRenderBatchCallback batchCallback;    // Render batch callback, called before default batch is drawn (context thread)
         Matrix stack[RL_MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
+        unsigned int activeTextureType[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];  // Active textures types (OpenGL texture target)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        unsigned int indirectBufferId;      // Draw indirect commands buffer id (rlDrawMultiIndirect())
+        int indirectBufferSize;             // Draw indirect commands buffer size in bytes
+        unsigned int uploadBufferId[RL_TEXTURE_UPLOAD_BUFFERS];     // Texture upload pixel buffers ring (PBO)
+        int uploadBufferSize[RL_TEXTURE_UPLOAD_BUFFERS];            // Texture upload pixel buffers size in bytes
+        void *uploadFence[RL_TEXTURE_UPLOAD_BUFFERS];               // Texture upload pixel buffers fence (GLsync), signaled when transfer is done
+        unsigned int uploadTicket[RL_TEXTURE_UPLOAD_BUFFERS];       // Texture upload ticket using each pixel buffer
+        unsigned int uploadNextTicket;      // Next texture upload ticket (0 is reserved for synchronous uploads)
+        int uploadCurrent;                  // Next texture upload pixel buffer to use
+        unsigned int copyFramebufferId[2];  // Texture copy framebuffers (read, draw), loaded on first copy without direct copy support
+        unsigned int readbackBufferId[RL_SCREEN_READBACK_BUFFERS];  // Screen readback pixel buffers ring (PBO)
+        int readbackBufferSize[RL_SCREEN_READBACK_BUFFERS];         // Screen readback pixel buffers size in bytes
+        int readbackWidth[RL_SCREEN_READBACK_BUFFERS];              // Screen readback width
+        int readbackHeight[RL_SCREEN_READBACK_BUFFERS];             // Screen readback height
+        void *readbackFence[RL_SCREEN_READBACK_BUFFERS];            // Screen readback fence (GLsync), signaled when pixels are available
+        int readbackFirst;                  // Oldest queued screen readback pixel buffer
+        int readbackCount;                  // Number of queued screen readbacks
+        bool readbackMapped;                // Oldest queued screen readback pixel buffer is mapped
 
         bool stereoRender;                  // Stereo rendering flag
+        bool stereoSinglePass;              // Stereo rendering in a single pass, eyes drawn as instances
+        unsigned int stereoShaderId;        // Default shader program id for single pass stereo (eye selected by instance)
+        int *stereoShaderLocs;              // Default shader locations for single pass stereo
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
         Matrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
 
@@ -990,11 +1476,15 @@ typedef struct rlglData {
 
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
+        unsigned int framebufferDefault;    // Default framebuffer id (0: window framebuffer)
+        unsigned int occlusionQuery;        // Current occlusion query id (0: no query active)
+        unsigned int timerQuery;            // Current timer query id (0: no query active)
+        bool conditionalRender;             // Conditional rendering active
 
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
-        bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
+        bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_instanced_arrays)
         bool texNPOT;                       // NPOT textures full support (GL_ARB_texture_non_power_of_two, GL_OES_texture_npot)
         bool texDepth;                      // Depth textures supported (GL_ARB_depth_texture, GL_OES_depth_texture)
         bool texDepthWebGL;                 // Depth textures supported WebGL specific (GL_WEBGL_depth_texture)
@@ -1008,11 +1498,89 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable/persistent buffer storage support (GL_ARB_buffer_storage)
+        bool timerQuery;                    // Timer queries support (GL_ARB_timer_query)
+        bool sync;                          // Sync objects support (GL_ARB_sync)
+        bool ubo;                           // Uniform buffer objects support (GL_ARB_uniform_buffer_object)
+        bool multiDrawIndirect;             // Multi draw indirect support (GL_ARB_multi_draw_indirect)
+        bool baseVertex;                    // Draw elements base vertex support (GL_ARB_draw_elements_base_vertex)
+        bool baseInstance;                  // Draw base instance support (GL_ARB_base_instance)
+        bool programBinary;                 // Shader program binaries support (GL_ARB_get_program_binary, GL_OES_get_program_binary)
+        bool parallelCompile;               // Shader parallel compilation support (GL_KHR_parallel_shader_compile)
+        bool vertexHalfFloat;               // Half-float vertex attributes support (GL_ARB_half_float_vertex, GL_OES_vertex_half_float)
+        bool occlusionQuery;                // Occlusion queries support (OpenGL 1.5, GL_EXT_occlusion_query_boolean)
+        bool occlusionQueryAny;             // Occlusion queries any samples passed support (GL_ARB_occlusion_query2, GL_EXT_occlusion_query_boolean)
+        bool conditionalRender;             // Conditional rendering support (OpenGL 3.0, GL_NV_conditional_render)
+        bool texBaseLevel;                  // Texture base and max mipmap levels support (OpenGL 1.2)
+        bool invalidateFramebuffer;         // Framebuffer contents invalidation support (OpenGL 4.3, GL_EXT_discard_framebuffer)
+        bool copyImage;                     // Direct texture data copy support (OpenGL 4.3, GL_ARB_copy_image)
+        bool eglImage;                      // EGL images as texture storage support (GL_OES_EGL_image)
+        bool elementIndexUint;              // 32-bit element indices support (OpenGL 1.1, GL_OES_element_index_uint)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        bool active;                        // Recording flag, vertex data is accumulated on record batch
+        rlRenderBatch batch;                // Record batch (CPU only), its vertex data is appended to arrays below on flush
+        rlRenderBatch *previousBatch;       // Render batch active before recording
+        float *vertices;                    // Recorded vertex positions (XYZ - 3 components per vertex)
+        float *texcoords;                   // Recorded vertex texture coordinates (UV - 2 components per vertex)
+        unsigned char *colors;              // Recorded vertex colors (RGBA - 4 components per vertex)
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        float *texslots;                    // Recorded vertex texture slots (1 component per vertex)
+#endif
+        int vertexCount;                    // Recorded vertex count
+        int vertexCapacity;                 // Recorded vertex arrays capacity
+        rlDrawCall *draws;                  // Recorded draws
+        int drawCount;                      // Recorded draws count
+        int drawCapacity;                   // Recorded draws array capacity
+        rlRecordData records[RL_MAX_RECORDS];   // Records loaded, handle is index + 1
+    } Record;           // Records data
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    struct {
+        unsigned int queries[RL_GPU_TIMER_FRAMES][2*RL_MAX_GPU_SCOPES];   // Timestamp queries per frame, begin and end per scope
+        rlGpuScope scopes[RL_GPU_TIMER_FRAMES][RL_MAX_GPU_SCOPES];        // Scopes recorded per frame, waiting for results
+        int scopeCount[RL_GPU_TIMER_FRAMES];    // Scopes recorded per frame
+        int stack[RL_MAX_GPU_SCOPES];           // Open scopes indices (-1 if scope was not recorded)
+        int stackCounter;                       // Open scopes counter
+        int frame;                              // Current frame queries set
+        rlGpuScope results[RL_MAX_GPU_SCOPES];  // Latest frame scopes with results available
+        int resultCount;                        // Latest frame scopes count
+    } GpuTimers;        // GPU timers data
+#endif
+    struct {
+        unsigned int frameId;               // Frame uniform block buffer id
+        float frameData[32];                // Frame uniform block data uploaded (matView, matProjection)
+        bool frameValid;                    // Frame uniform block data has been uploaded
+        unsigned int drawId;                // Draw uniform block buffer id
+        int drawStride;                     // Draw uniform block range size, aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+        int drawOffset;                     // Draw uniform block next range offset
+    } UniformBlocks;    // Default uniform blocks data
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    struct {
+        unsigned int program;               // Shader program in use
+        unsigned int vaoId;                 // Vertex array object bound
+        unsigned int activeSlot;            // Active texture unit
+        unsigned int texture2d[RL_STATE_CACHE_TEXTURE_UNITS];       // Texture 2D bound per texture unit
+        unsigned int textureCubemap[RL_STATE_CACHE_TEXTURE_UNITS];  // Texture cubemap bound per texture unit
+        unsigned int caps[4];               // Capabilities enabled: blend, depth test, cull face, scissor test
+        unsigned int depthMask;             // Depth write enabled
+        unsigned int cullFace;              // Cull face mode (GL_BACK, GL_FRONT)
+        int scissor[4];                     // Scissor rectangle (x, y, width, height)
+        bool scissorValid;                  // Scissor rectangle known
+        rlUniformLocation locations[RL_MAX_UNIFORM_LOCATIONS_CACHE];    // Uniform locations cache
+        int locationsUsed;                  // Uniform locations cache entries used (including removed)
+    } StateCache;       // OpenGL state cache
+#endif
+    struct {
+        rlGpuAllocation *allocations;       // Allocations registry (open addressing hash table)
+        int capacity;                       // Allocations registry capacity (power of two)
+        int count;                          // Allocations registered
+        unsigned long long usage[5];        // Memory used per allocation type (rlGpuMemoryType)
+        int objects[5];                     // Objects registered per allocation type (rlGpuMemoryType)
+    } GpuMemory;        // GPU memory usage registry
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1023,7 +1591,19 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+static rlglData rlglContextData = { 0 };                            // Context thread rlgl data
+static RL_THREAD_LOCAL rlglData *rlglThreadData = &rlglContextData; // Current thread rlgl data, worker threads point it to a thread batch data
+#define RLGL (*rlglThreadData)
+#else
 static rlglData RLGL = { 0 };
+#endif
+
+// Thread batch, recorded vertex data and GPU buffers to draw it
+struct rlThreadBatch {
+    rlglData *data;             // Thread batch rlgl data: state copy, record batch and recorded vertex data
+    rlRecordData record;        // GPU buffers updated with recorded vertex data on drawing
+};
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -1036,6 +1616,23 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: Shader program binaries functionality is exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
+
+// NOTE: Occlusion queries functionality is exposed through extension (EXT)
+static PFNGLGENQUERIESEXTPROC glGenQueries = NULL;
+static PFNGLDELETEQUERIESEXTPROC glDeleteQueries = NULL;
+static PFNGLBEGINQUERYEXTPROC glBeginQuery = NULL;
+static PFNGLENDQUERYEXTPROC glEndQuery = NULL;
+static PFNGLGETQUERYOBJECTUIVEXTPROC glGetQueryObjectuiv = NULL;
+
+// NOTE: Framebuffer contents invalidation functionality is exposed through extension (EXT)
+static PFNGLDISCARDFRAMEBUFFEREXTPROC glDiscardFramebuffer = NULL;
+
+// NOTE: EGL images as texture storage functionality is exposed through extension (OES)
+static PFNGLEGLIMAGETARGETTEXTURE2DOESPROC glEGLImageTargetTexture2D = NULL;
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1044,16 +1641,66 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLinkShaderProgram(unsigned int program);      // Bind default attribute locations and link shader program
+static bool rlCheckShaderCompile(unsigned int shader, int type);    // Check shader compilation status, log errors
+static bool rlCheckShaderProgramLink(unsigned int program);         // Check shader program linkage status, log errors
+static void rlSortRenderBatch(rlRenderBatch *batch);    // Sort batch draws by state and merge them (sorted batch mode)
+static void rlRecordRenderBatch(rlRenderBatch *batch);  // Append batch vertex data and draws to current record
+static void rlLoadRecordBatch(rlRenderBatch *batch);    // Load record batch, CPU only render batch
+static void rlUnloadRecordingData(rlglData *data);      // Unload record batch and recorded vertex data arrays
+static bool rlUpdateRecordBuffers(rlRecordData *record, const rlglData *data, int usage); // Load/update record GPU buffers with recorded vertex data
+static void rlUnloadRecordBuffers(rlRecordData *record);    // Unload record GPU buffers
+static void rlDrawRecordData(const rlRecordData *record, const rlDrawCall *draws, int drawCount, Matrix transform); // Draw record GPU buffers
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+static void rlResetThreadBatch(rlThreadBatch *batch);   // Reset thread batch recorded data and copy current rlgl state
+#endif
+static void rlSubmitDrawCalls(const rlDrawCall *draws, int drawCount, int baseVertex, int instances); // Draw a list of draws from currently bound vertex data
+static void rlUploadBatchBuffer(unsigned int vboId, const void *data, int size, int capacity, bool orphan); // Upload render batch vertex data range, orphaning buffer storage if required
+static void rlBufferQuadIndices(const unsigned int *indices, int count);   // Upload quads indices to bound element buffer, 16-bit if 32-bit indices not supported
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlWaitFence(void **fence);      // Wait for GPU to signal a fence sync object and delete it
+static void rlBindShaderUniformBlocks(unsigned int program);    // Bind shader program default uniform blocks to their binding points
+#endif
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+static void rlWaitVertexBufferSegment(rlVertexBuffer *buffer, int segment);    // Wait for GPU to release a ring segment and point vertex arrays to it
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static unsigned int rlGetTextureDataSize(int width, int height, int format, int mipmapCount); // Get texture data size in bytes, including mipmaps
+
+// GPU memory usage registry functions, registry is only available on OpenGL 3.3+ and OpenGL ES 2.0
+static void rlTrackGpuMemory(int type, unsigned int id, unsigned int size); // Register GPU allocation (or update its size)
+static void rlUntrackGpuMemory(int type, unsigned int id);                  // Remove GPU allocation from registry
+#if defined(GRAPHICS_API_OPENGL_33)
+static unsigned int rlGetTrackedGpuMemory(int type, unsigned int id);       // Get GPU allocation registered size (0 if not registered)
+#endif
+#if !defined(GRAPHICS_API_OPENGL_11)
+static void rlLoadTextureLevel(int level, int width, int height, int format, const void *data);    // Load bound texture mipmap level data (format supported)
+#endif
+
+// OpenGL state cache functions, state calls are issued directly if cache is not available
+static void rlStateBindTexture(unsigned int target, unsigned int id);   // Bind texture to active texture unit
+static void rlStateForgetTexture(unsigned int id);                      // Remove deleted texture from state cache
+static void rlStateEnable(int state, unsigned int cap, bool enabled);   // Enable/disable OpenGL capability
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlStateActiveTexture(unsigned int slot);                    // Select active texture unit
+static void rlStateUseProgram(unsigned int id);                         // Use shader program
+static void rlStateBindVertexArray(unsigned int vaoId);                 // Bind vertex array object
+static void rlStateForgetVertexArray(unsigned int vaoId);               // Remove deleted vertex array object from state cache
+static void rlStateForgetProgram(unsigned int id);                      // Remove deleted shader program from state cache (and its uniform locations)
+#endif
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
 static Matrix rlMatrixMultiply(Matrix left, Matrix right);  // Multiply two matrices
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlTransformPoint(const Matrix *mat, float *x, float *y, float *z);  // Transform one point by matrix
+static void rlTransformPoints4(const Matrix *mat, float *x, float *y, float *z); // Transform four points by matrix (arrays of 4 components)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Matrix operations
@@ -1322,6 +1969,23 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertexQuads(const float *vertices, const float *texcoords, int quadCount)
+{
+    for (int i = 0; i < quadCount*4; i++)
+    {
+        if (texcoords != NULL) glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        glVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]);
+    }
+}
+void rlVertexQuads2D(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount)
+{
+    for (int i = 0; i < quadCount*4; i++)
+    {
+        if ((colors != NULL) && (i%4 == 0)) glColor4ub(colors[i], colors[i + 1], colors[i + 2], colors[i + 3]);
+        glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        glVertex2f(vertices[2*i], vertices[2*i + 1]);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1349,11 +2013,24 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            RLGL.State.flushReason = RL_FLUSH_MODE_CHANGE;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // NOTE: Texture set before rlBegin() could be placed in previous draw texture slots (different mode),
+        // it is carried into the new draw so it is not lost
+        if (RLGL.State.textureId > 0) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
+        RLGL.State.textureSlot = 0;
+#endif
     }
 }
 
@@ -1375,12 +2052,7 @@ void rlVertex3f(float x, float y, float z)
     float tz = z;
 
     // Transform provided vector if required
-    if (RLGL.State.transformRequired)
-    {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
-    }
+    if (RLGL.State.transformRequired) rlTransformPoint(&RLGL.State.transform, &tx, &ty, &tz);
 
     // WARNING: We can't break primitives when launching a new batch.
     // RL_LINES comes in pairs, RL_TRIANGLES come in groups of 3 vertices and RL_QUADS come in groups of 4 vertices.
@@ -1408,22 +2080,33 @@ void rlVertex3f(float x, float y, float z)
     }
 
     // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+    // NOTE: Vertex data layout depends on RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER, strides take care of it
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    float *vertex = buffer->vertices + RL_BATCH_POSITION_STRIDE*RLGL.State.vertexCounter;
+    float *texcoord = buffer->texcoords + RL_BATCH_TEXCOORD_STRIDE*RLGL.State.vertexCounter;
+    unsigned char *color = buffer->colors + RL_BATCH_COLOR_STRIDE*RLGL.State.vertexCounter;
+
+    vertex[0] = tx;
+    vertex[1] = ty;
+    vertex[2] = tz;
 
     // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+    texcoord[0] = RLGL.State.texcoordx;
+    texcoord[1] = RLGL.State.texcoordy;
 
     // TODO: Add current normal
     // By default rlVertexBuffer type does not store normals
 
     // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    color[0] = RLGL.State.colorr;
+    color[1] = RLGL.State.colorg;
+    color[2] = RLGL.State.colorb;
+    color[3] = RLGL.State.colora;
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    // Add current texture slot
+    buffer->texslots[RLGL.State.vertexCounter] = (float)RLGL.State.textureSlot;
+#endif
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1435,6 +2118,124 @@ void rlVertex2f(float x, float y)
     rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
 }
 
+// Define multiple quads, 4 vertex by quad (position XYZ, texcoord UV), current color is used
+// NOTE: Current draw mode must be RL_QUADS (rlBegin()), texcoords can be NULL to use current texcoord,
+// the four quad corners are transformed at once when matrix stack transform is required
+void rlVertexQuads(const float *vertices, const float *texcoords, int quadCount)
+{
+    for (int q = 0; q < quadCount; q++)
+    {
+        // Quads are never split between batches, launch a draw call if there is no space for a full quad
+        if (RLGL.State.vertexCounter > (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)) rlCheckRenderBatchLimit(4 + 1);
+
+        float px[4] = { vertices[12*q], vertices[12*q + 3], vertices[12*q + 6], vertices[12*q + 9] };
+        float py[4] = { vertices[12*q + 1], vertices[12*q + 4], vertices[12*q + 7], vertices[12*q + 10] };
+        float pz[4] = { vertices[12*q + 2], vertices[12*q + 5], vertices[12*q + 8], vertices[12*q + 11] };
+
+        if (RLGL.State.transformRequired) rlTransformPoints4(&RLGL.State.transform, px, py, pz);
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        for (int i = 0; i < 4; i++)
+        {
+            float *vertex = buffer->vertices + RL_BATCH_POSITION_STRIDE*RLGL.State.vertexCounter;
+            float *texcoord = buffer->texcoords + RL_BATCH_TEXCOORD_STRIDE*RLGL.State.vertexCounter;
+            unsigned char *color = buffer->colors + RL_BATCH_COLOR_STRIDE*RLGL.State.vertexCounter;
+
+            vertex[0] = px[i];
+            vertex[1] = py[i];
+            vertex[2] = pz[i];
+
+            if (texcoords != NULL)
+            {
+                texcoord[0] = texcoords[8*q + 2*i];
+                texcoord[1] = texcoords[8*q + 2*i + 1];
+            }
+            else
+            {
+                texcoord[0] = RLGL.State.texcoordx;
+                texcoord[1] = RLGL.State.texcoordy;
+            }
+
+            color[0] = RLGL.State.colorr;
+            color[1] = RLGL.State.colorg;
+            color[2] = RLGL.State.colorb;
+            color[3] = RLGL.State.colora;
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            buffer->texslots[RLGL.State.vertexCounter] = (float)RLGL.State.textureSlot;
+#endif
+            RLGL.State.vertexCounter++;
+        }
+
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += 4;
+    }
+}
+
+// Define multiple 2d quads, 4 vertex by quad (position XY, texcoord UV), one color by quad (RGBA)
+// NOTE: Current draw mode must be RL_QUADS (rlBegin()), colors can be NULL to use current color,
+// all quads use current depth, batch space is checked once for every run of quads fitting in current buffer
+void rlVertexQuads2D(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount)
+{
+    float depth = RLGL.currentBatch->currentDepth;
+    unsigned char currentColor[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+
+    for (int q = 0; q < quadCount; )
+    {
+        // Quads are never split between batches, launch a draw call if there is no space for a full quad
+        if (RLGL.State.vertexCounter > (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)) rlCheckRenderBatchLimit(4 + 1);
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int run = (buffer->elementCount*4 - 4 - RLGL.State.vertexCounter)/4 + 1;
+        if (run > (quadCount - q)) run = quadCount - q;
+
+        float *vertex = buffer->vertices + RL_BATCH_POSITION_STRIDE*RLGL.State.vertexCounter;
+        float *texcoord = buffer->texcoords + RL_BATCH_TEXCOORD_STRIDE*RLGL.State.vertexCounter;
+        unsigned char *color = buffer->colors + RL_BATCH_COLOR_STRIDE*RLGL.State.vertexCounter;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        float *texslot = buffer->texslots + RLGL.State.vertexCounter;
+        float textureSlot = (float)RLGL.State.textureSlot;
+#endif
+        bool transformRequired = RLGL.State.transformRequired;
+
+        for (int end = q + run; q < end; q++)
+        {
+            float px[4] = { vertices[8*q], vertices[8*q + 2], vertices[8*q + 4], vertices[8*q + 6] };
+            float py[4] = { vertices[8*q + 1], vertices[8*q + 3], vertices[8*q + 5], vertices[8*q + 7] };
+            float pz[4] = { depth, depth, depth, depth };
+
+            if (transformRequired) rlTransformPoints4(&RLGL.State.transform, px, py, pz);
+
+            const unsigned char *quadColor = (colors != NULL)? (colors + 4*q) : currentColor;
+
+            for (int i = 0; i < 4; i++)
+            {
+                vertex[0] = px[i];
+                vertex[1] = py[i];
+                vertex[2] = pz[i];
+
+                texcoord[0] = texcoords[8*q + 2*i];
+                texcoord[1] = texcoords[8*q + 2*i + 1];
+
+                color[0] = quadColor[0];
+                color[1] = quadColor[1];
+                color[2] = quadColor[2];
+                color[3] = quadColor[3];
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+                *texslot++ = textureSlot;
+#endif
+                vertex += RL_BATCH_POSITION_STRIDE;
+                texcoord += RL_BATCH_TEXCOORD_STRIDE;
+                color += RL_BATCH_COLOR_STRIDE;
+            }
+        }
+
+        RLGL.State.vertexCounter += 4*run;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += 4*run;
+    }
+}
+
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
@@ -1493,10 +2294,14 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlDisableTexture();
 #else
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        RLGL.State.textureId = 0;
+    #endif
         // NOTE: If quads batch limit is reached, we force a draw call and next batch starts
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
+            RLGL.State.flushReason = RL_FLUSH_BATCH_LIMIT;
             rlDrawRenderBatch(RLGL.currentBatch);
         }
 #endif
@@ -1506,6 +2311,38 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // Look for texture in current draw texture slots, adding it if a slot is available
+        // NOTE: Only default shader samples from texture slots, custom shaders require a new draw per texture,
+        // if next rlBegin() mode differs from current draw mode, texture is carried into the new draw
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        RLGL.State.textureId = id;
+
+        if ((draw->vertexCount > 0) && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId))
+        {
+            int slot = -1;
+
+            for (int i = 0; i < draw->textureSlotCount; i++)
+            {
+                if (draw->textureSlots[i] == id) { slot = i; break; }
+            }
+
+            if ((slot == -1) && (draw->textureSlotCount < RL_DEFAULT_BATCH_TEXTURE_SLOTS))
+            {
+                slot = draw->textureSlotCount;
+                draw->textureSlots[slot] = id;
+                draw->textureSlotCount++;
+            }
+
+            if (slot >= 0)
+            {
+                RLGL.State.textureSlot = slot;
+                return;
+            }
+        }
+
+        RLGL.State.textureSlot = 0;
+    #endif
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
@@ -1527,20 +2364,94 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                RLGL.State.flushReason = RL_FLUSH_TEXTURE_CHANGE;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
+    #endif
         }
 #endif
     }
 }
 
+// Enable sorted batch mode
+// NOTE: Within a batch, draws are considered order-independent inside the same layer,
+// they are reordered by (layer, texture, mode) and merged when possible on rlDrawRenderBatch()
+void rlEnableSortedBatch(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.sortedBatch = true;
+#endif
+}
+
+// Disable sorted batch mode
+void rlDisableSortedBatch(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.sortedBatch = false;
+#endif
+}
+
+// Set current draw layer
+// NOTE: Only used in sorted batch mode, draws on lower layers are drawn first,
+// a new draw call is registered if current one already contains vertex
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawLayer == layer) return;
+
+    RLGL.State.drawLayer = layer;
+
+    if (RLGL.State.sortedBatch && (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer != layer))
+    {
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
+        {
+            // Make sure current draw vertexCount is aligned a multiple of 4 (see rlSetTexture())
+            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
+            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
+            else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+
+            // Store current draw state, new draw keeps it
+            rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
+            {
+                RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
+
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                RLGL.State.flushReason = RL_FLUSH_LAYER_CHANGE;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
+
+            currentDraw.vertexCount = 0;
+            currentDraw.vertexAlignment = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1] = currentDraw;
+        }
+
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+    }
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlStateActiveTexture(slot);
 #endif
 }
 
@@ -1550,7 +2461,10 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.stats.textureBinds++;
+#endif
 }
 
 // Disable texture
@@ -1559,14 +2473,15 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    RLGL.stats.textureBinds++;
 #endif
 }
 
@@ -1574,14 +2489,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1623,14 +2538,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1666,7 +2581,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1674,7 +2589,8 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    if (RLGL.State.currentShaderId != id) RLGL.stats.shaderSwitches++;
+    rlStateUseProgram(id);
 #endif
 }
 
@@ -1682,7 +2598,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlStateUseProgram(0);
 #endif
 }
 
@@ -1698,7 +2614,16 @@ void rlEnableFramebuffer(unsigned int id)
 void rlDisableFramebuffer(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);
+#endif
+}
+
+// Set default framebuffer, bound when no render texture is enabled
+// NOTE: Used on contexts without window framebuffer (surfaceless), 0 restores window framebuffer
+void rlSetFramebufferDefault(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.framebufferDefault = id;
 #endif
 }
 
@@ -1735,53 +2660,139 @@ void rlActiveDrawBuffers(int count)
 #endif
 }
 
+// Bind framebuffer (fbo) to target, read and draw targets are the same on OpenGL ES 2.0
+void rlBindFramebuffer(unsigned int target, unsigned int framebuffer)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    target = GL_FRAMEBUFFER;
+#endif
+    glBindFramebuffer(target, (framebuffer > 0)? framebuffer : RLGL.State.framebufferDefault);
+#endif
+}
+
+// Blit read framebuffer region to draw framebuffer (nearest filtering)
+// NOTE: Not supported on OpenGL 2.1 and OpenGL ES 2.0, depth buffers blit requires matching formats
+void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX, int dstY, int dstWidth, int dstHeight, int bufferMask)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBlitFramebuffer(srcX, srcY, srcX + srcWidth, srcY + srcHeight, dstX, dstY, dstX + dstWidth, dstY + dstHeight, bufferMask, GL_NEAREST);
+#endif
+}
+
+// Invalidate bound framebuffer buffers contents
+// NOTE: Must be called on a framebuffer object (not default framebuffer) before unbinding it, invalidated
+// buffers are not written back to memory by tile-based GPUs, contents are undefined until next clear
+void rlInvalidateFramebuffer(int bufferMask)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (!RLGL.ExtSupported.invalidateFramebuffer) return;
+
+    GLenum attachments[2] = { 0 };
+    int count = 0;
+
+    if (bufferMask & RL_COLOR_BUFFER_BIT) attachments[count++] = GL_COLOR_ATTACHMENT0;
+    if (bufferMask & RL_DEPTH_BUFFER_BIT) attachments[count++] = GL_DEPTH_ATTACHMENT;
+
+    if (count == 0) return;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
+#else
+    glDiscardFramebuffer(GL_FRAMEBUFFER, count, attachments);
+#endif
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // General render state configuration
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlStateEnable(RL_STATE_BLEND, GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlStateEnable(RL_STATE_BLEND, GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlStateEnable(RL_STATE_DEPTH_TEST, GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlStateEnable(RL_STATE_DEPTH_TEST, GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.depthMask == GL_TRUE) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.depthMask = GL_TRUE;
+#endif
+    glDepthMask(GL_TRUE);
+}
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.depthMask == GL_FALSE) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.depthMask = GL_FALSE;
+#endif
+    glDepthMask(GL_FALSE);
+}
+
+// Set color channels write mask
+void rlColorMask(bool r, bool g, bool b, bool a)
+{
+    glColorMask(r, g, b, a);
+}
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlStateEnable(RL_STATE_CULL_FACE, GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlStateEnable(RL_STATE_CULL_FACE, GL_CULL_FACE, false); }
 
 // Set face culling mode
 void rlSetCullFace(int mode)
 {
+    unsigned int glMode = 0;
+
     switch (mode)
     {
-        case RL_CULL_FACE_BACK: glCullFace(GL_BACK); break;
-        case RL_CULL_FACE_FRONT: glCullFace(GL_FRONT); break;
-        default: break;
+        case RL_CULL_FACE_BACK: glMode = GL_BACK; break;
+        case RL_CULL_FACE_FRONT: glMode = GL_FRONT; break;
+        default: return;
     }
+
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.cullFace == glMode) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.cullFace = glMode;
+#endif
+    glCullFace(glMode);
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { rlStateEnable(RL_STATE_SCISSOR_TEST, GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { rlStateEnable(RL_STATE_SCISSOR_TEST, GL_SCISSOR_TEST, false); }
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.scissorValid &&
+        (RLGL.StateCache.scissor[0] == x) && (RLGL.StateCache.scissor[1] == y) &&
+        (RLGL.StateCache.scissor[2] == width) && (RLGL.StateCache.scissor[3] == height)) { RLGL.stats.stateCallsSkipped++; return; }
+
+    RLGL.StateCache.scissor[0] = x;
+    RLGL.StateCache.scissor[1] = y;
+    RLGL.StateCache.scissor[2] = width;
+    RLGL.StateCache.scissor[3] = height;
+    RLGL.StateCache.scissorValid = true;
+#endif
+    glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1854,6 +2865,63 @@ bool rlIsStereoRenderEnabled(void)
 #endif
 }
 
+// Enable single pass stereo rendering
+// NOTE: Eyes are drawn as two instances into side-by-side halves of the framebuffer, shaders must
+// declare mvpStereo[2] uniform, select eye matrix by gl_InstanceID and clip eye half with gl_ClipDistance[0],
+// shaders without mvpStereo uniform are still drawn once per eye
+void rlEnableStereoSinglePass(void)
+{
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.stereoSinglePass = true;
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Single pass stereo rendering not supported, requires OpenGL 3.3");
+#endif
+}
+
+// Disable single pass stereo rendering
+void rlDisableStereoSinglePass(void)
+{
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.stereoSinglePass = false;
+#endif
+}
+
+// Check if single pass stereo rendering is enabled (and stereo render enabled)
+bool rlIsStereoSinglePassEnabled(void)
+{
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    return (RLGL.State.stereoRender && RLGL.State.stereoSinglePass);
+#else
+    return false;
+#endif
+}
+
+// Begin single pass stereo draw: set eyes model-view-projection matrices uniform array and enable eyes clipping
+// NOTE: Shader program must be enabled, draws between begin/end must be instanced (2 instances, one by eye)
+void rlBeginStereoSinglePass(int locIndex, Matrix modelview)
+{
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    Matrix matMVP[2] = { 0 };
+    for (int eye = 0; eye < 2; eye++) matMVP[eye] = rlMatrixMultiply(rlMatrixMultiply(modelview, RLGL.State.viewOffsetStereo[eye]), RLGL.State.projectionStereo[eye]);
+
+    rlSetUniformMatrices(locIndex, matMVP, 2);
+
+    // Full framebuffer viewport, every eye is clipped to its half by the shader
+    rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+    glEnable(GL_CLIP_DISTANCE0);
+#endif
+}
+
+// End single pass stereo draw
+void rlEndStereoSinglePass(void)
+{
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    glDisable(GL_CLIP_DISTANCE0);
+#endif
+}
+
 // Clear color buffer with color
 void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
 {
@@ -1897,12 +2965,40 @@ void rlCheckErrors()
 #endif
 }
 
+// Reset OpenGL state cache
+// NOTE: Required after changing program, textures, VAO, blend mode, depth, cull or scissor state with raw OpenGL calls,
+// next state call from rlgl is always issued, uniform locations cache is kept
+void rlResetStateCache(void)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    RLGL.StateCache.program = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.vaoId = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.activeSlot = RL_STATE_CACHE_UNKNOWN;
+
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        RLGL.StateCache.texture2d[i] = RL_STATE_CACHE_UNKNOWN;
+        RLGL.StateCache.textureCubemap[i] = RL_STATE_CACHE_UNKNOWN;
+    }
+
+    for (int i = 0; i < 4; i++) RLGL.StateCache.caps[i] = RL_STATE_CACHE_UNKNOWN;
+
+    RLGL.StateCache.depthMask = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.cullFace = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.scissorValid = false;
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.currentBlendMode = -1;   // Force blend mode to be set again
+#endif
+}
+
 // Set blend mode
 void rlSetBlendMode(int mode)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
+        RLGL.State.flushReason = RL_FLUSH_BLEND_CHANGE;
         rlDrawRenderBatch(RLGL.currentBatch);
 
         switch (mode)
@@ -2058,6 +3154,10 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init OpenGL state cache, all state is unknown until first set
+    rlResetStateCache();
+    RLGL.State.currentBlendMode = RL_BLEND_ALPHA;   // Set below with default OpenGL states
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2072,7 +3172,12 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    // NOTE: Batch elements limit is raised if 32-bit indices are supported on OpenGL ES 2.0
+    int bufferElements = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+#if defined(RL_DEFAULT_BATCH_BUFFER_ELEMENTS_UINT)
+    if (RLGL.ExtSupported.elementIndexUint) bufferElements = RL_DEFAULT_BATCH_BUFFER_ELEMENTS_UINT;
+#endif
+    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, bufferElements);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -2089,17 +3194,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlDisableDepthTest();                                   // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlEnableColorBlend();                                   // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
-    glCullFace(GL_BACK);                                    // Cull the back face (default)
+    rlSetCullFace(RL_CULL_FACE_BACK);                       // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlEnableBackfaceCulling();                              // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2121,6 +3226,30 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
 #endif
 
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    // Init GPU timers queries
+    if (RLGL.ExtSupported.timerQuery) glGenQueries(RL_GPU_TIMER_FRAMES*2*RL_MAX_GPU_SCOPES, &RLGL.GpuTimers.queries[0][0]);
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Timer queries not supported, GPU timers disabled");
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Init default uniform blocks buffers
+    // NOTE: Frame block stays bound to its binding point, draw block ranges are bound on every draw
+    if (RLGL.ExtSupported.ubo)
+    {
+        int alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment <= 0) alignment = 256;
+
+        RLGL.UniformBlocks.drawStride = ((RL_UNIFORM_BLOCK_DRAW_SIZE + alignment - 1)/alignment)*alignment;
+        RLGL.UniformBlocks.drawOffset = 0;
+        RLGL.UniformBlocks.frameValid = false;
+        RLGL.UniformBlocks.frameId = rlLoadUniformBuffer(RL_UNIFORM_BLOCK_FRAME_SIZE, NULL, RL_DYNAMIC_DRAW);
+        RLGL.UniformBlocks.drawId = rlLoadUniformBuffer(RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE, NULL, RL_STREAM_DRAW);
+        rlBindUniformBuffer(RLGL.UniformBlocks.frameId, RL_UNIFORM_BLOCK_BINDING_FRAME, 0, 0);
+    }
+#endif
+
     // Init state: Color/Depth buffers clear
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
     glClearDepth(1.0f);                                     // Set clear depth value (default)
@@ -2133,10 +3262,90 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload records and recording data
+    for (int i = 0; i < RL_MAX_RECORDS; i++) rlUnloadRecord(i + 1);
+
+    rlUnloadRecordingData(&RLGL);
+
     rlUnloadShaderDefault();          // Unload default shader
 
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    if (RLGL.ExtSupported.timerQuery) glDeleteQueries(RL_GPU_TIMER_FRAMES*2*RL_MAX_GPU_SCOPES, &RLGL.GpuTimers.queries[0][0]);
+#endif
+
+    // Unload default uniform blocks buffers
+    rlUnloadUniformBuffer(RLGL.UniformBlocks.frameId);
+    rlUnloadUniformBuffer(RLGL.UniformBlocks.drawId);
+    RLGL.UniformBlocks.frameId = 0;
+    RLGL.UniformBlocks.drawId = 0;
+
+    // Unload draw indirect commands buffer
+    if (RLGL.State.indirectBufferId > 0) glDeleteBuffers(1, &RLGL.State.indirectBufferId);
+    RLGL.State.indirectBufferId = 0;
+    RLGL.State.indirectBufferSize = 0;
+
+    // Unload texture upload pixel buffers
+    for (int i = 0; i < RL_TEXTURE_UPLOAD_BUFFERS; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (RLGL.State.uploadFence[i] != NULL) glDeleteSync((GLsync)RLGL.State.uploadFence[i]);
+#endif
+        if (RLGL.State.uploadBufferId[i] > 0) glDeleteBuffers(1, &RLGL.State.uploadBufferId[i]);
+        RLGL.State.uploadFence[i] = NULL;
+        RLGL.State.uploadBufferId[i] = 0;
+        RLGL.State.uploadBufferSize[i] = 0;
+    }
+
+    // Unload screen readback pixel buffers
+    if (RLGL.State.readbackMapped) rlReleaseScreenPixels();
+
+    for (int i = 0; i < RL_SCREEN_READBACK_BUFFERS; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (RLGL.State.readbackFence[i] != NULL) glDeleteSync((GLsync)RLGL.State.readbackFence[i]);
+#endif
+        if (RLGL.State.readbackBufferId[i] > 0) glDeleteBuffers(1, &RLGL.State.readbackBufferId[i]);
+        RLGL.State.readbackFence[i] = NULL;
+        RLGL.State.readbackBufferId[i] = 0;
+        RLGL.State.readbackBufferSize[i] = 0;
+    }
+
+    RLGL.State.readbackFirst = 0;
+    RLGL.State.readbackCount = 0;
+
+    // Unload texture copy framebuffers
+#if defined(RLGL_RENDER_TEXTURES_HINT)
+    for (int i = 0; i < 2; i++) if (RLGL.State.copyFramebufferId[i] > 0) glDeleteFramebuffers(1, &RLGL.State.copyFramebufferId[i]);
+    RLGL.State.copyFramebufferId[0] = 0;
+    RLGL.State.copyFramebufferId[1] = 0;
+#endif
+
+    rlStateForgetTexture(RLGL.State.defaultTextureId);
+    rlUntrackGpuMemory(RL_GPU_MEMORY_TEXTURE, RLGL.State.defaultTextureId);
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+    // Report GPU allocations not unloaded, registry is released
+    // NOTE: Internal resources are unloaded at this point (modules on CloseWindow(), rlgl above),
+    // so reported allocations are user resources (textures, meshes, render textures...) not unloaded
+    if (RLGL.GpuMemory.count > 0)
+    {
+        static const char *typeNames[5] = { "Texture", "Renderbuffer", "Vertex buffer", "Shader buffer", "Framebuffer" };
+
+        TRACELOG(RL_LOG_WARNING, "RLGL: GPU allocations not unloaded: %i (%.2f MB)", RLGL.GpuMemory.count, (float)rlGetGpuMemoryUsage()/(1024.0f*1024.0f));
+
+        for (int i = 0; i < RLGL.GpuMemory.capacity; i++)
+        {
+            rlGpuAllocation *allocation = &RLGL.GpuMemory.allocations[i];
+            if (allocation->id > 0) TRACELOG(RL_LOG_WARNING, "    > %s [ID %i] %u bytes", typeNames[allocation->type], allocation->id, allocation->size);
+        }
+    }
+
+    RL_FREE(RLGL.GpuMemory.allocations);
+    RLGL.GpuMemory.allocations = NULL;
+    RLGL.GpuMemory.capacity = 0;
+    RLGL.GpuMemory.count = 0;
+    for (int i = 0; i < 5; i++) { RLGL.GpuMemory.usage[i] = 0; RLGL.GpuMemory.objects[i] = 0; }
 #endif
 }
 
@@ -2161,6 +3370,9 @@ void rlLoadExtensions(void *loader)
     for (int i = 0; i < numExt; i++) TRACELOG(RL_LOG_INFO, "    %s", glGetStringi(GL_EXTENSIONS, i));
 #endif
 
+    // 32-bit element indices supported by default (OpenGL 1.1 core)
+    RLGL.ExtSupported.elementIndexUint = true;
+
 #if defined(GRAPHICS_API_OPENGL_21)
     // Register supported extensions flags
     // Optional OpenGL 2.1 extensions
@@ -2193,6 +3405,39 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    #if !defined(GRAPHICS_API_OPENGL_21)
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;       // Requires sync objects (OpenGL 3.2)
+    #endif
+    RLGL.ExtSupported.timerQuery = GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query;
+    RLGL.ExtSupported.sync = GLAD_GL_VERSION_3_2;
+    RLGL.ExtSupported.ubo = GLAD_GL_VERSION_3_1 || GLAD_GL_ARB_uniform_buffer_object;
+    RLGL.ExtSupported.multiDrawIndirect = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect;
+    RLGL.ExtSupported.baseVertex = GLAD_GL_VERSION_3_2;
+    RLGL.ExtSupported.baseInstance = GLAD_GL_VERSION_4_2;
+    RLGL.ExtSupported.programBinary = GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary;
+    RLGL.ExtSupported.vertexHalfFloat = GLAD_GL_VERSION_3_0 || GLAD_GL_ARB_half_float_vertex;
+    RLGL.ExtSupported.occlusionQuery = GLAD_GL_VERSION_1_5 || GLAD_GL_ARB_occlusion_query;
+    RLGL.ExtSupported.occlusionQueryAny = GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_occlusion_query2;
+    RLGL.ExtSupported.conditionalRender = GLAD_GL_VERSION_3_0;
+    RLGL.ExtSupported.texBaseLevel = GLAD_GL_VERSION_1_2;
+    RLGL.ExtSupported.invalidateFramebuffer = GLAD_GL_VERSION_4_3;
+    RLGL.ExtSupported.copyImage = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_copy_image;
+
+    // Check parallel shaders compilation support
+    // NOTE: Extension not provided by glad, it is checked on extensions list (OpenGL 3.0 required)
+    if (GLAD_GL_VERSION_3_0)
+    {
+        GLint numExt = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+
+        for (int i = 0; i < numExt; i++)
+        {
+            const char *extension = (const char *)glGetStringi(GL_EXTENSIONS, i);
+
+            if ((extension != NULL) && ((strcmp(extension, "GL_KHR_parallel_shader_compile") == 0) ||
+                (strcmp(extension, "GL_ARB_parallel_shader_compile") == 0))) RLGL.ExtSupported.parallelCompile = true;
+        }
+    }
 
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2259,8 +3504,9 @@ void rlLoadExtensions(void *loader)
         }
         else
         {
-            if ((strcmp(extList[i], (const char *)"GL_EXT_draw_instanced") == 0) &&     // Standard EXT
-                (strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0))
+            // NOTE: GL_EXT_instanced_arrays provides instanced draws and attribute divisor,
+            // GL_EXT_draw_instanced alone (no divisor) is not enough for per-instance attributes
+            if (strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0)       // Standard EXT
             {
                 glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)((rlglLoadProc)loader)("glDrawArraysInstancedEXT");
                 glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)((rlglLoadProc)loader)("glDrawElementsInstancedEXT");
@@ -2274,6 +3520,9 @@ void rlLoadExtensions(void *loader)
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
 
+        // Check 32-bit element indices support, render batch index type and elements limit depend on it
+        if (strcmp(extList[i], (const char *)"GL_OES_element_index_uint") == 0) RLGL.ExtSupported.elementIndexUint = true;
+
         // Check texture float support
         if (strcmp(extList[i], (const char *)"GL_OES_texture_float") == 0) RLGL.ExtSupported.texFloat32 = true;
 
@@ -2308,6 +3557,51 @@ void rlLoadExtensions(void *loader)
 
         // Check clamp mirror wrap mode support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
+
+        // Check shader program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+        }
+
+        // Check parallel shaders compilation support
+        if (strcmp(extList[i], (const char *)"GL_KHR_parallel_shader_compile") == 0) RLGL.ExtSupported.parallelCompile = true;
+
+        // Check framebuffer contents invalidation support
+        if (strcmp(extList[i], (const char *)"GL_EXT_discard_framebuffer") == 0)
+        {
+            glDiscardFramebuffer = (PFNGLDISCARDFRAMEBUFFEREXTPROC)((rlglLoadProc)loader)("glDiscardFramebufferEXT");
+            if (glDiscardFramebuffer != NULL) RLGL.ExtSupported.invalidateFramebuffer = true;
+        }
+
+        // Check EGL images as texture storage support
+        if (strcmp(extList[i], (const char *)"GL_OES_EGL_image") == 0)
+        {
+            glEGLImageTargetTexture2D = (PFNGLEGLIMAGETARGETTEXTURE2DOESPROC)((rlglLoadProc)loader)("glEGLImageTargetTexture2DOES");
+            if (glEGLImageTargetTexture2D != NULL) RLGL.ExtSupported.eglImage = true;
+        }
+
+        // Check half-float vertex attributes support
+        if (strcmp(extList[i], (const char *)"GL_OES_vertex_half_float") == 0) RLGL.ExtSupported.vertexHalfFloat = true;
+
+        // Check occlusion queries support, boolean queries (any samples passed)
+        if (strcmp(extList[i], (const char *)"GL_EXT_occlusion_query_boolean") == 0)
+        {
+            glGenQueries = (PFNGLGENQUERIESEXTPROC)((rlglLoadProc)loader)("glGenQueriesEXT");
+            glDeleteQueries = (PFNGLDELETEQUERIESEXTPROC)((rlglLoadProc)loader)("glDeleteQueriesEXT");
+            glBeginQuery = (PFNGLBEGINQUERYEXTPROC)((rlglLoadProc)loader)("glBeginQueryEXT");
+            glEndQuery = (PFNGLENDQUERYEXTPROC)((rlglLoadProc)loader)("glEndQueryEXT");
+            glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectuivEXT");
+
+            if ((glGenQueries != NULL) && (glDeleteQueries != NULL) && (glBeginQuery != NULL) && (glEndQuery != NULL) && (glGetQueryObjectuiv != NULL))
+            {
+                RLGL.ExtSupported.occlusionQuery = true;
+                RLGL.ExtSupported.occlusionQueryAny = true;
+            }
+        }
     }
 
     // Free extensions pointers
@@ -2315,6 +3609,16 @@ void rlLoadExtensions(void *loader)
     RL_FREE(extensionsDup);    // Duplicated string must be deallocated
 #endif  // GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Some drivers expose program binaries functionality without any supported binary format
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats == 0) RLGL.ExtSupported.programBinary = false;
+    }
+#endif
+
     // Check OpenGL information and capabilities
     //------------------------------------------------------------------------------
     // Show current OpenGL and GLSL version
@@ -2369,6 +3673,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.vao) TRACELOG(RL_LOG_INFO, "GL: VAO extension detected, VAO functions loaded successfully");
     else TRACELOG(RL_LOG_WARNING, "GL: VAO extension not found, VAO not supported");
     if (RLGL.ExtSupported.texNPOT) TRACELOG(RL_LOG_INFO, "GL: NPOT textures extension detected, full NPOT textures supported");
+    if (RLGL.ExtSupported.elementIndexUint) TRACELOG(RL_LOG_INFO, "GL: 32-bit element indices supported");
     else TRACELOG(RL_LOG_WARNING, "GL: NPOT textures extension not found, limited NPOT support (no-mipmaps, no-repeat)");
     if (RLGL.ExtSupported.texCompDXT) TRACELOG(RL_LOG_INFO, "GL: DXT compressed textures supported");
     if (RLGL.ExtSupported.texCompETC1) TRACELOG(RL_LOG_INFO, "GL: ETC1 compressed textures supported");
@@ -2377,6 +3682,15 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
+    if (RLGL.ExtSupported.timerQuery) TRACELOG(RL_LOG_INFO, "GL: Timer queries supported");
+    if (RLGL.ExtSupported.occlusionQuery) TRACELOG(RL_LOG_INFO, "GL: Occlusion queries supported");
+    if (RLGL.ExtSupported.invalidateFramebuffer) TRACELOG(RL_LOG_INFO, "GL: Framebuffer invalidation supported");
+    if (RLGL.ExtSupported.copyImage) TRACELOG(RL_LOG_INFO, "GL: Direct texture copy supported");
+    if (RLGL.ExtSupported.conditionalRender) TRACELOG(RL_LOG_INFO, "GL: Conditional rendering supported");
+    if (RLGL.ExtSupported.sync) TRACELOG(RL_LOG_INFO, "GL: Sync objects supported");
+    if (RLGL.ExtSupported.ubo) TRACELOG(RL_LOG_INFO, "GL: Uniform buffer objects supported");
+    if (RLGL.ExtSupported.multiDrawIndirect) TRACELOG(RL_LOG_INFO, "GL: Multi draw indirect supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2450,6 +3764,20 @@ unsigned int rlGetTextureIdDefault(void)
     return id;
 }
 
+// Get current texture id (used on batch drawing)
+// NOTE: Texture of the current batch draw call, vertex data using it does not require a new draw call
+unsigned int rlGetTextureIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    id = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[RLGL.State.textureSlot];
+    #endif
+#endif
+    return id;
+}
+
 // Get default shader id
 unsigned int rlGetShaderIdDefault(void)
 {
@@ -2460,6 +3788,16 @@ unsigned int rlGetShaderIdDefault(void)
     return id;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Get default shader locs
 int *rlGetShaderLocsDefault(void)
 {
@@ -2480,25 +3818,41 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
+
+    // Check if vertex data can be written directly into persistently mapped GPU memory
+    bool persistentMapping = false;
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+    persistentMapping = RLGL.ExtSupported.bufferStorage;
+#endif
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].persistentMapped = persistentMapping;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
-#if defined(GRAPHICS_API_OPENGL_33)
-        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
+        // NOTE: In case of persistent mapping, vertex data arrays are mapped from GPU memory once buffers are created
+        if (!persistentMapping)
+        {
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+            // Single array for all vertex data, texcoords and colors point to first vertex attributes
+            batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*4, RL_BATCH_VERTEX_SIZE);  // 24 bytes by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = batch.vertexBuffer[i].vertices + 3;
+            batch.vertexBuffer[i].colors = (unsigned char *)(batch.vertexBuffer[i].vertices + 5);
+#else
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
 #endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            batch.vertexBuffer[i].texslots = (float *)RL_CALLOC(bufferElements*4, sizeof(float));        // 1 float by vertex, 4 vertex by quad
 #endif
-
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
+        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 
         int k = 0;
 
@@ -2529,13 +3883,34 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+        // Quads - Interleaved vertex buffer binding and attributes enable
+        // Vertex data: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping) glBufferStorage(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*RL_BATCH_VERTEX_SIZE, NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        else
+#endif
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*RL_BATCH_VERTEX_SIZE, batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, RL_BATCH_VERTEX_SIZE, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, RL_BATCH_VERTEX_SIZE, (void *)(3*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, RL_BATCH_VERTEX_SIZE, (void *)(5*sizeof(float)));
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping) glBufferStorage(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*3*4*sizeof(float), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        else
+#endif
         glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -2543,6 +3918,10 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping) glBufferStorage(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*2*4*sizeof(float), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        else
+#endif
         glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
@@ -2550,25 +3929,120 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping) glBufferStorage(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*4*sizeof(unsigned char), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        else
+#endif
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // Vertex texture slot buffer (shader-location = 6)
+        glGenBuffers(1, &batch.vertexBuffer[i].texslotsVboId);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].texslotsVboId);
+    #if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping) glBufferStorage(GL_ARRAY_BUFFER, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*sizeof(float), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        else
+    #endif
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(float), batch.vertexBuffer[i].texslots, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+#endif
+
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (persistentMapping)
+        {
+            // Map the full rings once, mapping is kept for the entire buffers lifetime
+            // NOTE: Vertex arrays always point to the ring segment currently being filled (segment 0 at this point)
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].texslotsVboId);
+            batch.vertexBuffer[i].texslots = (float *)glMapBufferRange(GL_ARRAY_BUFFER, 0, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*sizeof(float), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    #endif
+    #if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            batch.vertexBuffer[i].vertices = (float *)glMapBufferRange(GL_ARRAY_BUFFER, 0, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*RL_BATCH_VERTEX_SIZE, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+            bool mapFailed = (batch.vertexBuffer[i].vertices == NULL);
+        #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            mapFailed = mapFailed || (batch.vertexBuffer[i].texslots == NULL);
+        #endif
+
+            if (mapFailed)
+            {
+                // Fallback to CPU array, buffer storage is created dynamic so it can still be updated with glBufferSubData()
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular buffers updates");
+
+                if (batch.vertexBuffer[i].vertices != NULL)
+                {
+                    glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+
+                batch.vertexBuffer[i].persistentMapped = false;
+                batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*4, RL_BATCH_VERTEX_SIZE);
+            }
+
+            batch.vertexBuffer[i].texcoords = batch.vertexBuffer[i].vertices + 3;
+            batch.vertexBuffer[i].colors = (unsigned char *)(batch.vertexBuffer[i].vertices + 5);
+    #else
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            batch.vertexBuffer[i].vertices = (float *)glMapBufferRange(GL_ARRAY_BUFFER, 0, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*3*4*sizeof(float), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            batch.vertexBuffer[i].texcoords = (float *)glMapBufferRange(GL_ARRAY_BUFFER, 0, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*2*4*sizeof(float), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            batch.vertexBuffer[i].colors = (unsigned char *)glMapBufferRange(GL_ARRAY_BUFFER, 0, RL_DEFAULT_BATCH_STREAM_SEGMENTS*bufferElements*4*4*sizeof(unsigned char), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+            bool mapFailed = (batch.vertexBuffer[i].vertices == NULL) || (batch.vertexBuffer[i].texcoords == NULL) || (batch.vertexBuffer[i].colors == NULL);
+        #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            mapFailed = mapFailed || (batch.vertexBuffer[i].texslots == NULL);
+        #endif
+
+            if (mapFailed)
+            {
+                // Fallback to CPU arrays, buffers storage is created dynamic so they can still be updated with glBufferSubData()
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular buffers updates");
+
+                for (int j = 0; j < 3; j++)
+                {
+                    glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[j]);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+
+                batch.vertexBuffer[i].persistentMapped = false;
+                batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));
+                batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));
+                batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));
+            }
+    #endif
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            if (!batch.vertexBuffer[i].persistentMapped)
+            {
+                if (batch.vertexBuffer[i].texslots != NULL)
+                {
+                    glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].texslotsVboId);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+
+                batch.vertexBuffer[i].texslots = (float *)RL_CALLOC(bufferElements*4, sizeof(float));
+            }
+    #endif
+
+            batch.vertexBuffer[i].currentSegment = 0;
+        }
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-#if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
+        rlBufferQuadIndices(batch.vertexBuffer[i].indices, bufferElements*6);
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2583,6 +4057,11 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = 0;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        batch.draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch.draws[i].textureSlotCount = 1;
+#endif
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2610,27 +4089,77 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(0);
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
-            glBindVertexArray(0);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+#endif
+            rlStateBindVertexArray(0);
+        }
+
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+        if (batch.vertexBuffer[i].persistentMapped)
+        {
+            // Delete ring segments fences and unmap buffers, vertex arrays memory is owned by GPU
+            for (int j = 0; j < RL_DEFAULT_BATCH_STREAM_SEGMENTS; j++)
+            {
+                if (batch.vertexBuffer[i].segmentFence[j] != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].segmentFence[j]);
+            }
+
+            for (int j = 0; j < 3; j++)
+            {
+                if (batch.vertexBuffer[i].vboId[j] == 0) continue;  // Interleaved layout only uses vboId[0]
+
+                glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[j]);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+            }
+
+    #if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].texslotsVboId);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            batch.vertexBuffer[i].texslots = NULL;
+    #endif
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+            batch.vertexBuffer[i].vertices = NULL;
+            batch.vertexBuffer[i].texcoords = NULL;
+            batch.vertexBuffer[i].colors = NULL;
         }
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
 
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        glDeleteBuffers(1, &batch.vertexBuffer[i].texslotsVboId);
+#endif
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao)
+        {
+            rlStateForgetVertexArray(batch.vertexBuffer[i].vaoId);
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        }
 
         // Free vertex arrays memory from CPU (RAM)
+        // NOTE: Interleaved texcoords and colors point into vertices array
         RL_FREE(batch.vertexBuffer[i].vertices);
+#if !defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+#endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        RL_FREE(batch.vertexBuffer[i].texslots);
+#endif
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2644,30 +4173,82 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
+    RL_PROFILE_BEGIN("rlDrawRenderBatch");
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Deferred draws are drawn before default batch vertex data, they were submitted before it
+    // NOTE: Callback is cleared while called, draws could flush the batch again
+    if ((RLGL.State.batchCallback != NULL) && (batch == &RLGL.defaultBatch) && rlIsRenderBatchDefault())
+    {
+        rlRenderBatchCallback callback = RLGL.State.batchCallback;
+        RLGL.State.batchCallback = NULL;
+        callback();
+        RLGL.State.batchCallback = callback;
+    }
+
+    // Reorder draws and vertex data by state to reduce draw calls (sorted batch mode)
+    if (RLGL.State.sortedBatch && (RLGL.State.vertexCounter > 0)) rlSortRenderBatch(batch);
+
+    // Record batch is not drawn, its vertex data and draws are appended to current record
+    bool recording = (batch == &RLGL.Record.batch);
+    if (recording && (RLGL.State.vertexCounter > 0)) rlRecordRenderBatch(batch);
+
+    // Register flush statistics, only flushes with vertex data are considered
+    if ((RLGL.State.vertexCounter > 0) && !recording)
+    {
+        RLGL.stats.batchFlushes++;
+        RLGL.stats.flushReasons[RLGL.State.flushReason]++;
+    }
+    RLGL.State.flushReason = RL_FLUSH_REQUESTED;
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-    if (RLGL.State.vertexCounter > 0)
+    // NOTE: Persistent mapped buffers are written directly by rlVertex*(), no update required
+    if ((RLGL.State.vertexCounter > 0) && !batch->vertexBuffer[batch->currentBuffer].persistentMapped && !recording)
     {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        int capacity = buffer->elementCount*4;     // Buffer vertex capacity
+        bool orphan = false;
+
+        // NOTE: Only the vertex range emitted since last flush is uploaded, in case GPU is still drawing from
+        // buffer storage (previous flush of a single buffer batch) storage is orphaned, so update does not sync
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (buffer->fence != NULL)
+        {
+            GLenum status = glClientWaitSync((GLsync)buffer->fence, 0, 0);   // Non-blocking fence check
+            if (status == GL_TIMEOUT_EXPIRED) orphan = true;
+
+            glDeleteSync((GLsync)buffer->fence);
+            buffer->fence = NULL;
+        }
+        else if (!RLGL.ExtSupported.sync) orphan = (batch->bufferCount == 1);
+#else
+        orphan = (batch->bufferCount == 1);   // No fences available, single buffer was just used by previous flush
+#endif
+        if (orphan) RLGL.stats.bufferOrphans++;
+
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(buffer->vaoId);
 
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+        // Interleaved vertex data buffer, just one update required
+        rlUploadBatchBuffer(buffer->vboId[0], buffer->vertices, RLGL.State.vertexCounter*RL_BATCH_VERTEX_SIZE, capacity*RL_BATCH_VERTEX_SIZE, orphan);
+#else
         // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        rlUploadBatchBuffer(buffer->vboId[0], buffer->vertices, RLGL.State.vertexCounter*3*sizeof(float), capacity*3*sizeof(float), orphan);
 
         // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+        rlUploadBatchBuffer(buffer->vboId[1], buffer->texcoords, RLGL.State.vertexCounter*2*sizeof(float), capacity*2*sizeof(float), orphan);
 
         // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        rlUploadBatchBuffer(buffer->vboId[2], buffer->colors, RLGL.State.vertexCounter*4*sizeof(unsigned char), capacity*4*sizeof(unsigned char), orphan);
+#endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // Texture slots buffer
+        rlUploadBatchBuffer(buffer->texslotsVboId, buffer->texslots, RLGL.State.vertexCounter*sizeof(float), capacity*sizeof(float), orphan);
+#endif
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2685,7 +4266,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2695,14 +4276,36 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     Matrix matModelView = RLGL.State.modelview;
 
     int eyeCount = 1;
-    if (RLGL.State.stereoRender) eyeCount = 2;
-
-    for (int eye = 0; eye < eyeCount; eye++)
+    if (RLGL.State.stereoRender && !recording) eyeCount = 2;
+
+    // Single pass stereo draws both eyes at once as instances, default shader is replaced by its stereo version
+    // NOTE: Current shader is restored once batch is drawn
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    int *shaderLocs = RLGL.State.currentShaderLocs;
+    int instances = 1;
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    if ((eyeCount == 2) && RLGL.State.stereoSinglePass)
     {
-        if (eyeCount == 2)
+        if ((RLGL.State.currentShaderId == RLGL.State.defaultShaderId) && (RLGL.State.stereoShaderId > 0))
         {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            RLGL.State.currentShaderId = RLGL.State.stereoShaderId;
+            RLGL.State.currentShaderLocs = RLGL.State.stereoShaderLocs;
+        }
+
+        if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP_STEREO] != -1)
+        {
+            eyeCount = 1;
+            instances = 2;
+        }
+    }
+#endif
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        if (eyeCount == 2)
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
 
             // Set current eye view offset to modelview matrix
             rlSetMatrixModelview(rlMatrixMultiply(matModelView, RLGL.State.viewOffsetStereo[eye]));
@@ -2711,24 +4314,38 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         }
 
         // Draw buffers
-        if (RLGL.State.vertexCounter > 0)
+        if ((RLGL.State.vertexCounter > 0) && !recording)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlStateUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
-            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            float matMVPfloat[16] = {
-                matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
-                matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
-                matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
-                matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
-            };
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+            if (instances > 1) rlBeginStereoSinglePass(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP_STEREO], RLGL.State.modelview);
+            else
+            {
+                Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+                float matMVPfloat[16] = {
+                    matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+                    matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+                    matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+                    matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+                };
+                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+            }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+                // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, RL_BATCH_VERTEX_SIZE, 0);
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, RL_BATCH_VERTEX_SIZE, (void *)(3*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, RL_BATCH_VERTEX_SIZE, (void *)(5*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -2743,6 +4360,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+                // Bind vertex attrib: texture slot (shader-location = 6)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].texslotsVboId);
+                glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+                glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
@@ -2757,36 +4381,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlStateActiveTexture(1 + i);
+                    rlStateBindTexture(RLGL.State.activeTextureType[i], RLGL.State.activeTextureId[i]);
+                    RLGL.stats.textureBinds++;
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
-
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
-            {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+            rlStateActiveTexture(0);
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
-                {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
-#endif
-                }
+            // Persistent mapped buffers store vertex data at current ring segment offset
+            int segmentBaseVertex = 0;
+            if (batch->vertexBuffer[batch->currentBuffer].persistentMapped) segmentBaseVertex = batch->vertexBuffer[batch->currentBuffer].currentSegment*batch->vertexBuffer[batch->currentBuffer].elementCount*4;
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
-            }
+            rlSubmitDrawCalls(batch->draws, batch->drawCounter, segmentBaseVertex, instances);
+            if (instances > 1) rlEndStereoSinglePass();
 
             if (!RLGL.ExtSupported.vao)
             {
@@ -2794,20 +4404,47 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlStateBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        // NOTE: Record batch could be flushed from worker threads, no OpenGL calls allowed
+        if (!recording)
+        {
+            if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+            rlStateUseProgram(0);    // Unbind shader program
+        }
     }
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    // Restore current shader (replaced for single pass stereo)
+    RLGL.State.currentShaderId = shaderId;
+    RLGL.State.currentShaderLocs = shaderLocs;
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+    // Fence the ring segment just submitted and move to next one, waiting for GPU to release it if required
+    if ((RLGL.State.vertexCounter > 0) && batch->vertexBuffer[batch->currentBuffer].persistentMapped)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+        buffer->segmentFence[buffer->currentSegment] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        rlWaitVertexBufferSegment(buffer, (buffer->currentSegment + 1)%RL_DEFAULT_BATCH_STREAM_SEGMENTS);
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence the buffer just submitted, it is checked before its next update to orphan storage still in use
+    if ((RLGL.State.vertexCounter > 0) && RLGL.ExtSupported.sync &&
+        !batch->vertexBuffer[batch->currentBuffer].persistentMapped && !recording)
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
 
@@ -2824,8 +4461,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        batch->draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch->draws[i].textureSlotCount = 1;
+#endif
     }
 
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    RLGL.State.textureSlot = 0;
+#endif
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -2837,6 +4483,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
 #endif
+
+    RL_PROFILE_END();
 }
 
 // Set the active render batch for rlgl
@@ -2858,6 +4506,58 @@ void rlDrawRenderBatchActive(void)
 #endif
 }
 
+// Check if default render batch and shader are active
+// NOTE: Vertex data emitted could be replaced by direct draws deferred until batch drawing (rlSetRenderBatchCallback()),
+// not possible on worker threads (thread batches), while recording or in sorted batch mode (draws reordered)
+bool rlIsRenderBatchDefault(void)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = ((RLGL.currentBatch == &RLGL.defaultBatch) && !RLGL.Record.active && !RLGL.State.sortedBatch &&
+              (RLGL.State.currentShaderId == RLGL.State.defaultShaderId));
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    if (rlglThreadData != &rlglContextData) result = false;
+#endif
+#endif
+
+    return result;
+}
+
+// Check if active render batch has no vertex data pending
+bool rlIsRenderBatchEmpty(void)
+{
+    bool result = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = (RLGL.State.vertexCounter == 0);
+#endif
+
+    return result;
+}
+
+// Set callback called before default render batch is drawn
+// NOTE: Direct draws deferred by callback owner are drawn in submission order with batch vertex data
+void rlSetRenderBatchCallback(rlRenderBatchCallback callback)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.batchCallback = callback;
+#endif
+}
+
+// Get callback called before default render batch is drawn
+// NOTE: Callback owners replacing it can call previous one from their callback (chaining)
+rlRenderBatchCallback rlGetRenderBatchCallback(void)
+{
+    rlRenderBatchCallback callback = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    callback = RLGL.State.batchCallback;
+#endif
+
+    return callback;
+}
+
 // Check internal buffer overflow for a given number of vertex
 // and force a rlRenderBatch draw call if required
 bool rlCheckRenderBatchLimit(int vCount)
@@ -2873,1306 +4573,3330 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[RLGL.State.textureSlot];
+#endif
 
+        RLGL.State.flushReason = RL_FLUSH_BATCH_LIMIT;
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = currentTexture;
+#endif
     }
 #endif
 
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Begin GPU timer scope
+// NOTE: Render batch is flushed so the scope only measures work submitted inside it
+void rlBeginGpuScope(const char *name)
 {
-    unsigned int id = 0;
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    if (!RLGL.ExtSupported.timerQuery || (RLGL.GpuTimers.stackCounter >= RL_MAX_GPU_SCOPES)) return;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    int frame = RLGL.GpuTimers.frame;
+    int index = -1;     // Scopes over RL_MAX_GPU_SCOPES per frame are not recorded
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    if (RLGL.GpuTimers.scopeCount[frame] < RL_MAX_GPU_SCOPES)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
-    }
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        index = RLGL.GpuTimers.scopeCount[frame];
+        rlGpuScope *scope = &RLGL.GpuTimers.scopes[frame][index];
+
+        strncpy(scope->name, (name != NULL)? name : "", sizeof(scope->name) - 1);
+        scope->name[sizeof(scope->name) - 1] = '\0';
+        scope->depth = RLGL.GpuTimers.stackCounter;
+        scope->time = 0.0;
+
+        glQueryCounter(RLGL.GpuTimers.queries[frame][2*index], GL_TIMESTAMP);
+        RLGL.GpuTimers.scopeCount[frame]++;
     }
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    RLGL.GpuTimers.stack[RLGL.GpuTimers.stackCounter] = index;
+    RLGL.GpuTimers.stackCounter++;
+#endif
+}
+
+// End current GPU timer scope
+void rlEndGpuScope(void)
+{
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    if (!RLGL.ExtSupported.timerQuery || (RLGL.GpuTimers.stackCounter == 0)) return;
+
+    RLGL.GpuTimers.stackCounter--;
+    int index = RLGL.GpuTimers.stack[RLGL.GpuTimers.stackCounter];
+
+    if (index >= 0)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
+        rlDrawRenderBatch(RLGL.currentBatch);
+        glQueryCounter(RLGL.GpuTimers.queries[RLGL.GpuTimers.frame][2*index + 1], GL_TIMESTAMP);
     }
+#endif
+}
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+// End GPU timers frame and read back available results
+// NOTE: Queries of the oldest frame in flight are checked without blocking,
+// if GPU has not finished them yet, that frame results are dropped
+void rlUpdateGpuScopes(void)
+{
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    if (!RLGL.ExtSupported.timerQuery) return;
+
+    // Close scopes left open, their queries must be issued before reusing them
+    while (RLGL.GpuTimers.stackCounter > 0) rlEndGpuScope();
+
+    RLGL.GpuTimers.frame = (RLGL.GpuTimers.frame + 1)%RL_GPU_TIMER_FRAMES;
+
+    int frame = RLGL.GpuTimers.frame;
+    int count = RLGL.GpuTimers.scopeCount[frame];
+    bool available = (count > 0);
+
+    for (int i = 0; (i < count) && available; i++)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
+        GLint result = 0;
+        glGetQueryObjectiv(RLGL.GpuTimers.queries[frame][2*i + 1], GL_QUERY_RESULT_AVAILABLE, &result);
+        available = (result != 0);
     }
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    if (available)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
+        for (int i = 0; i < count; i++)
+        {
+            GLuint64 timeBegin = 0;
+            GLuint64 timeEnd = 0;
+            glGetQueryObjectui64v(RLGL.GpuTimers.queries[frame][2*i], GL_QUERY_RESULT, &timeBegin);
+            glGetQueryObjectui64v(RLGL.GpuTimers.queries[frame][2*i + 1], GL_QUERY_RESULT, &timeEnd);
+
+            RLGL.GpuTimers.results[i] = RLGL.GpuTimers.scopes[frame][i];
+            RLGL.GpuTimers.results[i].time = (double)(timeEnd - timeBegin)/1000000.0;   // Nanoseconds to milliseconds
+        }
+
+        RLGL.GpuTimers.resultCount = count;
     }
+
+    RLGL.GpuTimers.scopeCount[frame] = 0;
 #endif
-#endif  // GRAPHICS_API_OPENGL_11
+}
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+// Get GPU timer scopes of latest frame with results available
+// NOTE: Returned array is owned by rlgl, it is overwritten by rlUpdateGpuScopes()
+const rlGpuScope *rlGetGpuScopes(int *count)
+{
+    const rlGpuScope *scopes = NULL;
+    int scopeCount = 0;
 
-    glGenTextures(1, &id);              // Generate texture id
+#if defined(RLGL_GPU_TIMERS_AVAILABLE)
+    scopes = RLGL.GpuTimers.results;
+    scopeCount = RLGL.GpuTimers.resultCount;
+#endif
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (count != NULL) *count = scopeCount;
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+    return scopes;
+}
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+// Check if timer queries are supported
+bool rlIsTimerQuerySupported(void)
+{
+    bool result = false;
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+#if defined(GRAPHICS_API_OPENGL_33)
+    result = RLGL.ExtSupported.timerQuery;
+#endif
 
-        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+    return result;
+}
 
-        if (glInternalFormat != -1)
-        {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+// Load timer query object
+unsigned int rlLoadTimerQuery(void)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.timerQuery) glGenQueries(1, &id);
+    else TRACELOG(RL_LOG_WARNING, "GL: Timer queries not supported");
 #endif
 
+    return id;
+}
+
+// Unload timer query object
+void rlUnloadTimerQuery(unsigned int id)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+    if (RLGL.ExtSupported.timerQuery && (id > 0)) glDeleteQueries(1, &id);
 #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
+}
+
+// Begin timer query
+// NOTE: Render batch is flushed so the query only measures work submitted inside it,
+// only one timer query can be active at a time (GPU timer scopes use timestamps, not affected)
+void rlBeginTimerQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.timerQuery || (id == 0) || (RLGL.State.timerQuery > 0)) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    glBeginQuery(GL_TIME_ELAPSED, id);
+    RLGL.State.timerQuery = id;
 #endif
-        }
+}
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
+// End current timer query
+void rlEndTimerQuery(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.timerQuery == 0) return;
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
-    else
-    {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
-    }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    glEndQuery(GL_TIME_ELAPSED);
+    RLGL.State.timerQuery = 0;
 #endif
+}
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+// Get timer query result without waiting
+// NOTE: Returns -1.0 if GPU has not finished the query yet, queries should be read some frames later
+double rlGetTimerQueryResult(unsigned int id)
+{
+    double result = -1.0;
 
 #if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
+    if (!RLGL.ExtSupported.timerQuery || (id == 0)) return result;
+
+    GLint available = 0;
+    glGetQueryObjectiv(id, GL_QUERY_RESULT_AVAILABLE, &available);
+
+    if (available)
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        GLuint64 time = 0;
+        glGetQueryObjectui64v(id, GL_QUERY_RESULT, &time);
+        result = (double)time/1000000.0;    // Nanoseconds to milliseconds
     }
 #endif
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+    return result;
+}
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+// Check if occlusion queries are supported
+bool rlIsOcclusionQuerySupported(void)
+{
+    bool result = false;
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = RLGL.ExtSupported.occlusionQuery;
+#endif
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+    return result;
+}
 
-    return id;
+// Check if conditional rendering (by occlusion query) is supported
+bool rlIsConditionalRenderSupported(void)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    result = RLGL.ExtSupported.occlusionQuery && RLGL.ExtSupported.conditionalRender;
+#endif
+
+    return result;
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// Load occlusion query object
+unsigned int rlLoadOcclusionQuery(void)
 {
     unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+    if (RLGL.ExtSupported.occlusionQuery) glGenQueries(1, &id);
+    else TRACELOG(RL_LOG_WARNING, "GL: Occlusion queries not supported");
+#endif
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    return id;
+}
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // WARNING: WebGL platform requires unsized internal format definition (GL_DEPTH_COMPONENT)
-    // while other platforms using OpenGL ES 2.0 require/support sized internal formats depending on the GPU capabilities
-    if (!RLGL.ExtSupported.texDepthWebGL || useRenderBuffer)
-    {
-        if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-        else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-        else glInternalFormat = GL_DEPTH_COMPONENT16;
-    }
+// Unload occlusion query object
+void rlUnloadOcclusionQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.occlusionQuery && (id > 0)) glDeleteQueries(1, &id);
 #endif
+}
 
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
-    {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+// Begin occlusion query
+// NOTE: Render batch is flushed so the query only counts work submitted inside it,
+// boolean queries (any samples passed) are used if supported, they can stop counting early
+void rlBeginOcclusionQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.occlusionQuery || (id == 0) || (RLGL.State.occlusionQuery > 0)) return;
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+    glBeginQuery(RLGL.ExtSupported.occlusionQueryAny? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED, id);
+    RLGL.State.occlusionQuery = id;
+#endif
+}
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    }
-    else
-    {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+// End current occlusion query
+void rlEndOcclusionQuery(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.occlusionQuery == 0) return;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
-    }
+    glEndQuery(RLGL.ExtSupported.occlusionQueryAny? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED);
+    RLGL.State.occlusionQuery = 0;
 #endif
-
-    return id;
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
+// Get occlusion query result without waiting
+// NOTE: Returns -1 if GPU has not finished the query yet, 0 if no samples passed, 1 otherwise
+int rlGetOcclusionQueryResult(unsigned int id)
 {
-    unsigned int id = 0;
+    int result = -1;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
+    if (!RLGL.ExtSupported.occlusionQuery || (id == 0)) return result;
 
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
-
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int available = 0;
+    glGetQueryObjectuiv(id, GL_QUERY_RESULT_AVAILABLE, &available);
 
-    if (glInternalFormat != -1)
+    if (available)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
-        {
-            if (data == NULL)
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-                {
-                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
-                    {
-                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
-                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-                        else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    }
-                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
-                }
-                else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
-            }
-
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-#endif
-        }
+        unsigned int samples = 0;
+        glGetQueryObjectuiv(id, GL_QUERY_RESULT, &samples);
+        result = (samples > 0)? 1 : 0;
     }
-
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-#endif
+    return result;
+}
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+// Begin drawing conditioned by occlusion query result
+// NOTE: GPU does not wait for query result, draws are done if result is not available yet
+void rlBeginConditionalRender(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.conditionalRender || (id == 0) || RLGL.State.conditionalRender) return;
 
-    return id;
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    glBeginConditionalRender(id, GL_QUERY_NO_WAIT);
+    RLGL.State.conditionalRender = true;
+#endif
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+// End drawing conditioned by occlusion query
+void rlEndConditionalRender(void)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.State.conditionalRender) return;
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
-    {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
-    }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+    glEndConditionalRender();
+    RLGL.State.conditionalRender = false;
+#endif
 }
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+// Begin recording vertex data and draws into a record
+// NOTE: Render batch is flushed, vertex data is accumulated on a CPU-only batch until rlEndRecord(),
+// transformations applied while recording are baked into recorded vertex data
+void rlBeginRecord(void)
 {
-    *glInternalFormat = 0;
-    *glFormat = 0;
-    *glType = 0;
-
-    switch (format)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Record.active)
     {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-    #endif
-    #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-    #endif
-        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+        TRACELOG(RL_LOG_WARNING, "RLGL: Record already in progress");
+        return;
     }
-}
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
-{
-    glDeleteTextures(1, &id);
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    // Record batch is loaded on first use, it has no GPU buffers
+    if (RLGL.Record.batch.vertexBuffer == NULL) rlLoadRecordBatch(&RLGL.Record.batch);
+
+    RLGL.Record.previousBatch = RLGL.currentBatch;
+    RLGL.currentBatch = &RLGL.Record.batch;
+    RLGL.Record.vertexCount = 0;
+    RLGL.Record.drawCount = 0;
+    RLGL.Record.active = true;
+#endif
 }
 
-// Generate mipmap data for selected texture
-// NOTE: Only supports GPU mipmap generation
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+// End recording and upload record vertex data to GPU
+// NOTE: Returned handle must be unloaded with rlUnloadRecord()
+unsigned int rlEndRecord(void)
 {
+    unsigned int handle = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (!RLGL.Record.active)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: No record in progress");
+        return 0;
+    }
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    rlDrawRenderBatch(RLGL.currentBatch);   // Append pending vertex data to record
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+    RLGL.currentBatch = RLGL.Record.previousBatch;
+    RLGL.Record.active = false;
 
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    int index = -1;
+    for (int i = 0; i < RL_MAX_RECORDS; i++)
     {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+        if (RLGL.Record.records[i].draws == NULL) { index = i; break; }
+    }
 
-        #define MIN(a,b) (((a)<(b))? (a):(b))
-        #define MAX(a,b) (((a)>(b))? (a):(b))
+    if (RLGL.Record.drawCount == 0) TRACELOG(RL_LOG_WARNING, "RLGL: Record is empty, nothing to load");
+    else if (index < 0) TRACELOG(RL_LOG_WARNING, "RLGL: Maximum number of records reached (%i)", RL_MAX_RECORDS);
+    else if (rlUpdateRecordBuffers(&RLGL.Record.records[index], &RLGL, GL_STATIC_DRAW))
+    {
+        rlRecordData *record = &RLGL.Record.records[index];
 
-        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+        record->draws = (rlDrawCall *)RL_MALLOC(RLGL.Record.drawCount*sizeof(rlDrawCall));
+        memcpy(record->draws, RLGL.Record.draws, RLGL.Record.drawCount*sizeof(rlDrawCall));
+        record->drawCount = RLGL.Record.drawCount;
+
+        handle = index + 1;
+        TRACELOG(RL_LOG_INFO, "RLGL: [ID %i] Record loaded successfully (%i vertex, %i draws)", handle, record->vertexCount, record->drawCount);
     }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-#else
-    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+    RLGL.Record.vertexCount = 0;
+    RLGL.Record.drawCount = 0;
 #endif
-}
 
+    return handle;
+}
 
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Draw record using current shader, transform is applied before current modelview
+// NOTE: Pending render batch data is drawn first to keep drawing order
+void rlReplay(unsigned int handle, Matrix transform)
 {
-    void *pixels = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((handle == 0) || (handle > RL_MAX_RECORDS) || (RLGL.Record.records[handle - 1].draws == NULL)) return;
 
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (RLGL.Record.active)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: [ID %i] Record can not be replayed while recording", handle);
+        return;
+    }
 
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    rlRecordData *record = &RLGL.Record.records[handle - 1];
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    rlDrawRenderBatch(RLGL.currentBatch);
+    rlDrawRecordData(record, record->draws, record->drawCount, transform);
+#endif
+}
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlGetPixelDataSize(width, height, format);
+// Unload record from GPU memory (VRAM)
+void rlUnloadRecord(unsigned int handle)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((handle == 0) || (handle > RL_MAX_RECORDS) || (RLGL.Record.records[handle - 1].draws == NULL)) return;
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
-    {
-        pixels = RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
-    }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+    rlRecordData *record = &RLGL.Record.records[handle - 1];
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlUnloadRecordBuffers(record);
+    RL_FREE(record->draws);
+    *record = (rlRecordData){ 0 };
+
+    TRACELOG(RL_LOG_INFO, "RLGL: [ID %i] Record unloaded successfully", handle);
 #endif
+}
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    unsigned int fboId = rlLoadFramebuffer(width, height);
+// Load thread batch, vertex data can be recorded on it from any thread
+// NOTE: rlgl state (matrices, shader, default texture, batch modes) is copied to thread batch,
+// it must be called from rlgl context thread, same as rlDrawThreadBatch() and rlUnloadThreadBatch()
+rlThreadBatch *rlLoadThreadBatch(void)
+{
+    rlThreadBatch *batch = NULL;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    batch = (rlThreadBatch *)RL_CALLOC(1, sizeof(rlThreadBatch));
+    batch->data = (rlglData *)RL_CALLOC(1, sizeof(rlglData));
 
-    // Attach our texture to FBO
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+    rlLoadRecordBatch(&batch->data->Record.batch);
+    rlResetThreadBatch(batch);
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Thread batches not enabled (RLGL_ENABLE_THREAD_BATCHES)");
+#endif
 
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    return batch;
+}
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+// Unload thread batch
+void rlUnloadThreadBatch(rlThreadBatch *batch)
+{
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    if (batch == NULL) return;
 
-    // Clean up temporal fbo
-    rlUnloadFramebuffer(fboId);
+    rlUnloadRecordBuffers(&batch->record);
+    rlUnloadRecordingData(batch->data);
+
+    RL_FREE(batch->data);
+    RL_FREE(batch);
 #endif
+}
 
-    return pixels;
+// Begin recording vertex data on thread batch
+// NOTE: Current thread rlgl functions work on thread batch state until rlEndThreadBatch(),
+// only vertex level functions (rlBegin(), rlVertex*(), rlSetTexture()...) and matrix operations are allowed
+void rlBeginThreadBatch(rlThreadBatch *batch)
+{
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    if (batch != NULL) rlglThreadData = batch->data;
+#endif
 }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
+// End recording vertex data on thread batch
+void rlEndThreadBatch(void)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    if (rlglThreadData == &rlglContextData) return;
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    rlDrawRenderBatch(RLGL.currentBatch);   // Append pending vertex data to recorded data
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    rlglThreadData = &rlglContextData;
+#endif
+}
 
-    for (int y = height - 1; y >= 0; y--)
+// Draw thread batch recorded data and reset it for next recording
+// NOTE: Pending render batch data is drawn first, thread batches are drawn in calling order
+void rlDrawThreadBatch(rlThreadBatch *batch)
+{
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+    if (batch == NULL) return;
+
+    if (batch->data->Record.drawCount > 0)
     {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+        rlDrawRenderBatch(RLGL.currentBatch);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+        if (rlUpdateRecordBuffers(&batch->record, batch->data, GL_STREAM_DRAW))
+        {
+            rlDrawRecordData(&batch->record, batch->data->Record.draws, batch->data->Record.drawCount, rlMatrixIdentity());
         }
     }
 
-    RL_FREE(screenData);
+    rlResetThreadBatch(batch);
+#endif
+}
+// Get render statistics accumulated since last reset
+// NOTE: raylib resets statistics on BeginDrawing(), so they can be read after EndDrawing()
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.stats;
+#endif
+    return stats;
+}
 
-    return imgData;     // NOTE: image data should be freed
+// Reset render statistics
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.stats = (rlRenderStats){ 0 };
+#endif
 }
 
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(int width, int height)
+// Get GPU memory used by loaded textures, renderbuffers and buffers (bytes)
+// NOTE: Sizes are computed from formats and dimensions, driver padding and internal rlgl buffers are not included
+unsigned long long rlGetGpuMemoryUsage(void)
 {
-    unsigned int fboId = 0;
+    unsigned long long usage = 0;
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < 5; i++) usage += RLGL.GpuMemory.usage[i];
 #endif
 
-    return fboId;
+    return usage;
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+// Get GPU memory used by one allocation type (rlGpuMemoryType) and objects count
+unsigned long long rlGetGpuMemoryUsageType(int type, int *count)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    unsigned long long usage = 0;
+    if (count != NULL) *count = 0;
 
-    switch (attachType)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((type >= 0) && (type < 5))
     {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+        usage = RLGL.GpuMemory.usage[type];
+        if (count != NULL) *count = RLGL.GpuMemory.objects[type];
+    }
+#endif
 
-        } break;
-        case RL_ATTACHMENT_DEPTH:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+    return usage;
+}
 
-        } break;
-        case RL_ATTACHMENT_STENCIL:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+// Log GPU memory usage per allocation type, optionally every registered allocation
+// NOTE: Allocations listing is useful to find resources not unloaded (i.e. leaked render textures)
+void rlTraceGpuMemoryUsage(bool allocations)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    static const char *typeNames[5] = { "Textures", "Renderbuffers", "Vertex buffers", "Shader buffers", "Framebuffers" };
 
-        } break;
-        default: break;
-    }
+    TRACELOG(RL_LOG_INFO, "RLGL: GPU memory usage: %.2f MB (%i objects)", (float)rlGetGpuMemoryUsage()/(1024.0f*1024.0f), RLGL.GpuMemory.count);
+    for (int i = 0; i < 5; i++) TRACELOG(RL_LOG_INFO, "    > %-15s %10.2f MB (%i)", typeNames[i], (float)RLGL.GpuMemory.usage[i]/(1024.0f*1024.0f), RLGL.GpuMemory.objects[i]);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (allocations)
+    {
+        for (int i = 0; i < RLGL.GpuMemory.capacity; i++)
+        {
+            rlGpuAllocation *allocation = &RLGL.GpuMemory.allocations[i];
+            if (allocation->id > 0) TRACELOG(RL_LOG_INFO, "    [%s] [ID %i] %u bytes", typeNames[allocation->type], allocation->id, allocation->size);
+        }
+    }
 #endif
 }
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
 {
-    bool result = false;
+    unsigned int id = 0;
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
 
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
     {
-        switch (status)
-        {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
-        }
+        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
 
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
 #endif
+#endif  // GRAPHICS_API_OPENGL_11
 
-    return result;
-}
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
-{
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenTextures(1, &id);              // Generate texture id
 
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
 
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer.
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
+        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
 
-    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#if defined(GRAPHICS_API_OPENGL_11)
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        if (glInternalFormat != -1) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+#else
+        rlLoadTextureLevel(i, mipWidth, mipHeight, format, (unsigned char *)data + mipOffset);
 #endif
-}
 
-// Vertex data management
-//-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-#endif
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
 
-    return id;
-}
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
 #endif
 
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+    if (id > 0)
+    {
+        rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, rlGetTextureDataSize(width, height, format, mipmapCount));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+
     return id;
 }
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
+// Load texture staging pixel buffer, returns mapped memory (writable from any thread, NULL if not supported)
+// NOTE: Mapped memory can be written by a loader thread while rendering continues, staging buffer must be
+// released loading a texture from it (rlLoadTextureFromStaging()), requires OpenGL 3.3
+void *rlLoadTextureStaging(int size, unsigned int *stagingId)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-#endif
-}
+    void *mapped = NULL;
+    *stagingId = 0;
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (size > 0)
+    {
+        glGenBuffers(1, stagingId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, *stagingId);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+        mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (mapped == NULL)
+        {
+            glDeleteBuffers(1, stagingId);
+            *stagingId = 0;
+        }
+    }
 #endif
+
+    return mapped;
 }
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
+// Load texture from staging pixel buffer, staging buffer is released
+// NOTE: Texture data is transferred from pixel buffer by GPU, no data copy by render thread
+unsigned int rlLoadTextureFromStaging(unsigned int stagingId, int width, int height, int format, int mipmapCount)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingId);
+
+    // NOTE: Mipmaps data offsets are relative to bound pixel buffer
+    if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE) id = rlLoadTexture(NULL, width, height, format, mipmapCount);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Staging pixel buffer data lost, texture could not be loaded");
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &stagingId);     // Buffer storage is released by driver after transfer
 #endif
+
+    return id;
 }
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
+// Load texture with storage provided by an EGL image (dmabuf, GBM buffer object...)
+// NOTE: Texture shares memory with image, rendering to it (attached to a framebuffer) writes directly into image buffer
+unsigned int rlLoadTextureEGLImage(void *image)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-#endif
-}
+    unsigned int id = 0;
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
-#endif
-}
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.eglImage && (image != NULL))
+    {
+        glGenTextures(1, &id);
+        rlStateBindTexture(GL_TEXTURE_2D, id);
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+        glEGLImageTargetTexture2D(GL_TEXTURE_2D, (GLeglImageOES)image);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+        rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+        if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded from EGL image", id);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: EGL image textures not supported (GL_OES_EGL_image)");
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: EGL image textures only supported on OpenGL ES 2.0");
 #endif
+
+    return id;
 }
 
-// Enable vertex array object (VAO)
-bool rlEnableVertexArray(unsigned int vaoId)
+// Load texture in GPU with mipmaps from base level (data starts at base level)
+// NOTE: Levels under base level are not loaded (higher resolution levels), they can be loaded later with
+// rlUpdateTextureLevel() and sampled moving down the base level (rlSetTextureBaseLevel()), mipmaps streaming
+unsigned int rlLoadTextureLevels(const void *data, int width, int height, int format, int mipmapCount, int baseLevel)
 {
-    bool result = false;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    if (baseLevel <= 0) return rlLoadTexture(data, width, height, format, mipmapCount);
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.texBaseLevel || (baseLevel >= mipmapCount) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        glBindVertexArray(vaoId);
-        result = true;
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture mipmaps from base level");
+        return id;
     }
-#endif
-    return result;
-}
 
-// Disable vertex array object (VAO)
-void rlDisableVertexArray(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+
+    unsigned int size = 0;
+
+    for (int i = baseLevel; i < mipmapCount; i++)
+    {
+        int mipWidth = ((width >> i) > 0)? (width >> i) : 1;
+        int mipHeight = ((height >> i) > 0)? (height >> i) : 1;
+
+        rlLoadTextureLevel(i, mipWidth, mipHeight, format, (unsigned char *)data + size);
+        size += rlGetPixelDataSize(mipWidth, mipHeight, format);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, baseLevel);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, size);
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps, base level: %i)", id, width, height, rlGetPixelFormatName(format), mipmapCount, baseLevel);
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: Texture base mipmap level not supported");
 #endif
+
+    return id;
 }
 
-// Enable vertex attribute index
-void rlEnableVertexAttribute(unsigned int index)
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 {
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glEnableVertexAttribArray(index);
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // WARNING: WebGL platform requires unsized internal format definition (GL_DEPTH_COMPONENT)
+    // while other platforms using OpenGL ES 2.0 require/support sized internal formats depending on the GPU capabilities
+    if (!RLGL.ExtSupported.texDepthWebGL || useRenderBuffer)
+    {
+        if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+        else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+        else glInternalFormat = GL_DEPTH_COMPONENT16;
+    }
 #endif
-}
 
-// Disable vertex attribute index
-void rlDisableVertexAttribute(unsigned int index)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDisableVertexAttribArray(index);
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    {
+        glGenTextures(1, &id);
+        rlStateBindTexture(GL_TEXTURE_2D, id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+        rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    }
+    else
+    {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        rlTrackGpuMemory(RL_GPU_MEMORY_RENDERBUFFER, id, width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    }
 #endif
-}
 
-// Draw vertex array
-void rlDrawVertexArray(int offset, int count)
-{
-    glDrawArrays(GL_TRIANGLES, offset, count);
+    return id;
 }
 
-// Draw vertex array elements
-void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
+// Load multisample color renderbuffer (to be attached to fbo)
+// NOTE: Samples are clamped to GPU maximum (GL_MAX_SAMPLES), not supported on OpenGL 2.1 and OpenGL ES 2.0
+unsigned int rlLoadRenderbufferMultisample(int width, int height, int format, int samples)
 {
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
-}
+    unsigned int id = 0;
 
-// Draw vertex array instanced
-void rlDrawVertexArrayInstanced(int offset, int count, int instances)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21) && defined(RLGL_RENDER_TEXTURES_HINT)
+    int maxSamples = 0;
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+    if (samples > maxSamples) samples = maxSamples;
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((samples > 1) && (glInternalFormat != 0))
+    {
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, glInternalFormat, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        rlTrackGpuMemory(RL_GPU_MEMORY_RENDERBUFFER, id, rlGetPixelDataSize(width, height, format)*samples);
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Multisample color renderbuffer loaded successfully (%i samples)", id, samples);
+    }
 #endif
+
+    return id;
 }
 
-// Draw vertex array elements instanced
-void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+// Load multisample depth renderbuffer (to be attached to fbo)
+// NOTE: Samples are clamped to GPU maximum (GL_MAX_SAMPLES), not supported on OpenGL 2.1 and OpenGL ES 2.0
+unsigned int rlLoadRenderbufferDepthMultisample(int width, int height, int samples)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21) && defined(RLGL_RENDER_TEXTURES_HINT)
+    int maxSamples = 0;
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+    if (samples > maxSamples) samples = maxSamples;
+
+    if (samples > 1)
+    {
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, GL_DEPTH_COMPONENT24, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        rlTrackGpuMemory(RL_GPU_MEMORY_RENDERBUFFER, id, width*height*4*samples);
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Multisample depth renderbuffer loaded successfully (%i samples)", id, samples);
+    }
 #endif
+
+    return id;
 }
 
-#if defined(GRAPHICS_API_OPENGL_11)
-// Enable vertex state pointer
-void rlEnableStatePointer(int vertexAttribType, void *buffer)
+// Load texture array
+// NOTE: Layers data is expected one after the other (same size and format), uncompressed formats only,
+// not supported on OpenGL 2.1 and OpenGL ES 2.0 (OpenGL 3.0 required)
+unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, bool mipmaps)
 {
-    if (buffer != NULL) glEnableClientState(vertexAttribType);
-    switch (vertexAttribType)
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat == 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
-        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
-        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
-        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
-        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
-        default: break;
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Texture array format not supported (%i)", format);
+        return id;
     }
-}
 
-// Disable vertex state pointer
-void rlDisableStatePointer(int vertexAttribType)
-{
-    glDisableClientState(vertexAttribType);
-}
-#endif
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-// Load vertex array object (VAO)
-unsigned int rlLoadVertexArray(void)
-{
-    unsigned int vaoId = 0;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    glGenTextures(1, &id);
+    rlStateBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, glInternalFormat, width, height, layers, 0, glFormat, glType, data);
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    unsigned int size = rlGetPixelDataSize(width, height, format)*layers;
+
+    if (mipmaps)
     {
-        glGenVertexArrays(1, &vaoId);
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        size += size/3;     // Mipmaps chain requires one third of base level memory
     }
-#endif
-    return vaoId;
-}
+    else glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
-// Set vertex attribute
-void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
-#endif
-}
+    rlStateBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 
-// Set vertex attribute divisor
-void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribDivisor(index, divisor);
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, size);
+    RLGL.stats.bytesUploaded += (data != NULL)? rlGetPixelDataSize(width, height, format)*layers : 0;
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture array loaded successfully (%ix%i | %i layers | %s)", id, width, height, layers, rlGetPixelFormatName(format));
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: Texture arrays not supported by OpenGL version");
 #endif
+
+    return id;
 }
 
-// Unload vertex array object (VAO)
-void rlUnloadVertexArray(unsigned int vaoId)
+// Load 3d texture
+// NOTE: Slices data is expected one after the other (same size and format), uncompressed formats only,
+// not supported on OpenGL 2.1 and OpenGL ES 2.0
+unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat == 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &vaoId);
-        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: 3d texture format not supported (%i)", format);
+        return id;
     }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);
+    rlStateBindTexture(GL_TEXTURE_3D, id);
+    glTexImage3D(GL_TEXTURE_3D, 0, glInternalFormat, width, height, depth, 0, glFormat, glType, data);
+
+    // NOTE: Volumes are usually sampled as lookup tables (color grading, noise), filtered and clamped
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+    rlStateBindTexture(GL_TEXTURE_3D, 0);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, rlGetPixelDataSize(width, height, format)*depth);
+    RLGL.stats.bytesUploaded += (data != NULL)? rlGetPixelDataSize(width, height, format)*depth : 0;
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] 3d texture loaded successfully (%ix%ix%i | %s)", id, width, height, depth, rlGetPixelFormatName(format));
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: 3d textures not supported by OpenGL version");
 #endif
+
+    return id;
 }
 
-// Unload vertex buffer (VBO)
-void rlUnloadVertexBuffer(unsigned int vboId)
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount)
 {
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteBuffers(1, &vboId);
-    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
-#endif
-}
+    unsigned int dataSize = 0;
+    unsigned char *dataPtr = (unsigned char *)data;
 
-// Shaders management
-//-----------------------------------------------------------------------------------------------
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
-{
-    unsigned int id = 0;
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = 0;
-    unsigned int fragmentShaderId = 0;
+    if (mipmapCount < 1) mipmapCount = 1;
 
-    // Compile vertex shader (if provided)
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+    glGenTextures(1, &id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
-    // Compile fragment shader (if provided)
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
-    // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
-    else
+    if (glInternalFormat != -1)
     {
-        // One of or both shader are new, we need to compile a new shader program
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
-
-        // We can detach and delete vertex/fragment shaders (if not default ones)
-        // NOTE: We detach shader before deletion to make sure memory is freed
-        if (vertexShaderId != RLGL.State.defaultVShaderId)
-        {
-            // WARNING: Shader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        // Load cubemap faces, all faces data for every mipmap level
+        // NOTE: Data is expected as: level 0 faces (+X, -X, +Y, -Y, +Z, -Z), level 1 faces...
+        for (int level = 0, mipSize = size; level < mipmapCount; level++, mipSize = (mipSize > 1)? mipSize/2 : 1)
         {
-            // WARNING: Shader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
+            unsigned int mipDataSize = rlGetPixelDataSize(mipSize, mipSize, format);
+
+            for (unsigned int i = 0; i < 6; i++)
+            {
+                if (data == NULL)
+                {
+                    if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                    {
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+                        // NOTE: Sized float formats are supported as render targets on OpenGL 3.3
+                        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, glInternalFormat, mipSize, mipSize, 0, glFormat, glType, NULL);
+#else
+                        if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
+                        {
+                            // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
+                            if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, GL_RGB, mipSize, mipSize, 0, GL_RGB, GL_FLOAT, NULL);
+                            else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                        }
+                        else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                        else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, glInternalFormat, mipSize, mipSize, 0, glFormat, glType, NULL);
+#endif
+                    }
+                    else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+                }
+                else
+                {
+                    if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, glInternalFormat, mipSize, mipSize, 0, glFormat, glType, dataPtr);
+                    else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, glInternalFormat, mipSize, mipSize, 0, mipDataSize, dataPtr);
+
+                    dataPtr += mipDataSize;
+                }
+            }
+
+            dataSize += 6*mipDataSize;
         }
 
-        // In case shader program loading failed, we assign default shader
-        if (id == 0)
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
         {
-            // In case shader loading fails, we return the default shader
-            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
-            id = RLGL.State.defaultShaderId;
+            GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+            glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
         }
-        /*
-        else
+        else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
         {
-            // Get available shader uniforms
-            // NOTE: This information is useful for debug...
-            int uniformCount = -1;
-            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+#if defined(GRAPHICS_API_OPENGL_21)
+            GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+            GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+            glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+        }
+#endif
+    }
 
-            for (int i = 0; i < uniformCount; i++)
-            {
-                int namelen = -1;
-                int num = -1;
-                char name[256] = { 0 };     // Assume no variable names longer than 256
-                GLenum type = GL_ZERO;
+    // Set cubemap texture sampling parameters
+    // NOTE: Mipmapped cubemaps are sampled with trilinear filtering (i.e. prefiltered environment maps)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, (mipmapCount > 1)? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+#endif
 
-                // Get the name of the uniforms
-                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 
-                name[namelen] = 0;
-                TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
-            }
-        }
-        */
-    }
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, dataSize);
 #endif
 
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+
     return id;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Load texture cubemap from faces data in a bigger image
+// NOTE: Faces pointers point to every face first pixel (+X, -X, +Y, -Y, +Z, -Z), uncompressed formats only,
+// faces are uploaded in place with unpack row length, on OpenGL ES 2.0 face rows are copied to a face size buffer
+unsigned int rlLoadTextureCubemapFaces(const void **faces, int size, int format, int rowLength)
 {
-    unsigned int shader = 0;
+    unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap faces loading does not support compressed format");
+        return id;
+    }
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    if (success == GL_FALSE)
+    if (glInternalFormat == -1) return id;
+
+    int pixelSize = rlGetPixelDataSize(1, 1, format);
+
+    glGenTextures(1, &id);
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+    for (unsigned int i = 0; i < 6; i++) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, faces[i]);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#else
+    // NOTE: GL_UNPACK_ROW_LENGTH not supported on OpenGL ES 2.0, only face rows are copied
+    unsigned char *face = (rowLength != size)? (unsigned char *)RL_MALLOC(size*size*pixelSize) : NULL;
+
+    for (unsigned int i = 0; i < 6; i++)
     {
-        switch (type)
+        const unsigned char *data = (const unsigned char *)faces[i];
+
+        if (face != NULL)
         {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
-        #endif
-            default: break;
+            for (int y = 0; y < size; y++) memcpy(face + y*size*pixelSize, data + y*rowLength*pixelSize, size*pixelSize);
+            data = face;
         }
 
-        int maxLength = 0;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, data);
+    }
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetShaderInfoLog(shader, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
-            RL_FREE(log);
-        }
+    RL_FREE(face);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
     }
-    else
+    else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
     {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
-        #endif
-            default: break;
-        }
+#if defined(GRAPHICS_API_OPENGL_21)
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+        glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
     }
 #endif
 
-    return shader;
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+
+    rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, 6*size*size*pixelSize);
+#endif
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+
+    return id;
 }
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    unsigned int program = 0;
+    rlStateBindTexture(GL_TEXTURE_2D, id);
 
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    program = glCreateProgram();
+        RLGL.stats.bytesUploaded += rlGetPixelDataSize(width, height, format);
+#endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+}
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+// Update texture array layer or 3d texture slice
+// NOTE: Only base level is updated, texture array mipmaps must be generated again if required
+void rlUpdateTextureLayer(unsigned int id, int type, int layer, int width, int height, int format, const void *data)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    // NOTE: Default attribute shader locations must be Bound before linking
-    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    if ((id == 0) || (glInternalFormat == 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) ||
+        ((type != RL_TEXTURE_2D_ARRAY) && (type != RL_TEXTURE_3D)))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update texture layer", id);
+        return;
+    }
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    rlStateBindTexture(type, id);
+    glTexSubImage3D(type, 0, 0, 0, layer, width, height, 1, glFormat, glType, data);
+    rlStateBindTexture(type, 0);
 
-    glLinkProgram(program);
+    RLGL.stats.bytesUploaded += rlGetPixelDataSize(width, height, format);
+#endif
+}
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+// Copy texture region to another texture on GPU (base level, no CPU readback)
+// NOTE: Direct copy is used if supported and formats match, fallback renders through framebuffers:
+// glBlitFramebuffer() on OpenGL 3.3, glCopyTexSubImage2D() on OpenGL 2.1 and OpenGL ES 2.0,
+// compressed formats only supported by direct copy, current framebuffer binding is kept
+bool rlCopyTextureRegion(unsigned int srcId, int srcFormat, int srcX, int srcY, unsigned int dstId, int dstFormat, int dstX, int dstY, int width, int height)
+{
+    bool result = false;
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if ((srcId == 0) || (dstId == 0) || (width <= 0) || (height <= 0)) return result;
 
-    if (success == GL_FALSE)
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (RLGL.ExtSupported.copyImage && (srcFormat == dstFormat))
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        glCopyImageSubData(srcId, GL_TEXTURE_2D, 0, srcX, srcY, 0, dstId, GL_TEXTURE_2D, 0, dstX, dstY, 0, width, height, 1);
+        return true;
+    }
+#endif
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if ((srcFormat >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (dstFormat >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Compressed textures copy not supported");
+        return result;
+    }
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+    if (RLGL.State.copyFramebufferId[0] == 0) glGenFramebuffers(2, RLGL.State.copyFramebufferId);
 
-        glDeleteProgram(program);
+    // NOTE: Scissor test affects framebuffer blits, it is disabled during copy
+    GLboolean scissorTest = glIsEnabled(GL_SCISSOR_TEST);
+    if (scissorTest) glDisable(GL_SCISSOR_TEST);
 
-        program = 0;
-    }
-    else
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    GLint prevReadFbo = 0, prevDrawFbo = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prevReadFbo);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prevDrawFbo);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, RLGL.State.copyFramebufferId[0]);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, srcId, 0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, RLGL.State.copyFramebufferId[1]);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dstId, 0);
+
+    if ((glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE) &&
+        (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE))
     {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        glBlitFramebuffer(srcX, srcY, srcX + width, srcY + height, dstX, dstY, dstX + width, dstY + height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        result = true;
+    }
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    // Detach textures, copy framebuffers do not keep textures referenced
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, prevReadFbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, prevDrawFbo);
+#else
+    GLint prevFbo = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prevFbo);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.copyFramebufferId[0]);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, srcId, 0);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+    {
+        rlStateBindTexture(GL_TEXTURE_2D, dstId);
+        glCopyTexSubImage2D(GL_TEXTURE_2D, 0, dstX, dstY, srcX, srcY, width, height);
+        rlStateBindTexture(GL_TEXTURE_2D, 0);
+        result = true;
     }
+
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, prevFbo);
 #endif
-    return program;
-}
 
-// Unload shader program
-void rlUnloadShaderProgram(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteProgram(id);
+    if (scissorTest) glEnable(GL_SCISSOR_TEST);
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+    if (!result) TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to copy texture region to [ID %i]", srcId, dstId);
 #endif
-}
-
-// Get shader location uniform
-int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
-{
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
-#endif
-    return location;
+    return result;
 }
 
-// Get shader location attribute
-int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+// Update texture mipmap level data (level size), level memory released if data is NULL
+// NOTE: Level is re-specified, levels not sampled (under base level) can be loaded or released at any time
+void rlUpdateTextureLevel(unsigned int id, int level, int width, int height, int format, const void *data)
 {
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetAttribLocation(shaderId, attribName);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((id == 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
-#endif
-    return location;
-}
+    unsigned int levelSize = rlGetPixelDataSize(width, height, format);
+    unsigned int size = rlGetTrackedGpuMemory(RL_GPU_MEMORY_TEXTURE, id);
 
-// Set shader value uniform
-void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (uniformType)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+
+    if (data != NULL)
     {
-        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+        rlLoadTextureLevel(level, width, height, format, data);
+        size += levelSize;
     }
-#endif
-}
-
-// Set shader value attribute
-void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (attribType)
+    else
     {
-        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        // Zero size level, drivers release level memory
+        if (glInternalFormat != -1) glTexImage2D(GL_TEXTURE_2D, level, glInternalFormat, 0, 0, 0, glFormat, glType, NULL);
+        size = (size > levelSize)? size - levelSize : 0;
     }
+
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, size);
 #endif
 }
 
-// Set shader value uniform matrix
-void rlSetUniformMatrix(int locIndex, Matrix mat)
+// Set texture base mipmap level (highest resolution level sampled)
+void rlSetTextureBaseLevel(unsigned int id, int baseLevel)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.texBaseLevel) return;
+
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, baseLevel);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
 #endif
 }
 
-// Set shader value uniform sampler
-void rlSetUniformSampler(int locIndex, unsigned int textureId)
+// Check if texture base mipmap level can be set (mipmaps streaming)
+bool rlIsTextureBaseLevelSupported(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Check if texture is already active
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+    bool result = false;
 
-    // Register a new active texture for the internal batch system
-    // NOTE: Default texture is always activated as GL_TEXTURE0
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
-    {
-        if (RLGL.State.activeTextureId[i] == 0)
-        {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
-            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
-            break;
-        }
-    }
+#if defined(GRAPHICS_API_OPENGL_33)
+    result = RLGL.ExtSupported.texBaseLevel;
 #endif
+
+    return result;
 }
 
-// Set shader currently active (id and locations)
-void rlSetShader(unsigned int id, int *locs)
+// Check if texture pixel format is supported by GPU (compressed and float formats extensions)
+bool rlIsTextureFormatSupported(int format)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.currentShaderId != id)
+    bool result = false;
+
+    switch (format)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-        RLGL.State.currentShaderId = id;
-        RLGL.State.currentShaderLocs = locs;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: result = true; break;
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: result = RLGL.ExtSupported.texFloat32; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: result = RLGL.ExtSupported.texCompDXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: result = RLGL.ExtSupported.texCompETC1; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: result = RLGL.ExtSupported.texCompETC2; break;
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: result = RLGL.ExtSupported.texCompPVRT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: result = RLGL.ExtSupported.texCompASTC; break;
+    #endif
+        default: break;
     }
-#endif
+
+    return result;
 }
 
-// Load compute shader program
-unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+// Update GPU texture with new data through pixel buffer
+// NOTE: Data is copied into next pixel buffer of the ring (PBO) and transfer is issued from it, so data can be freed
+// right away and the render thread does not wait for the copy into texture memory, only when ring buffer is still
+// in use by a previous transfer, returned ticket can be checked with rlIsTextureUploadComplete()
+// WARNING: Requires OpenGL 3.2, otherwise (and for compressed formats) texture is updated synchronously (ticket 0)
+unsigned int rlUpdateTextureAsync(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    unsigned int program = 0;
-
-#if defined(GRAPHICS_API_OPENGL_43)
-    GLint success = 0;
-    program = glCreateProgram();
-    glAttachShader(program, shaderId);
-    glLinkProgram(program);
+    unsigned int ticket = 0;
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+#if defined(GRAPHICS_API_OPENGL_33)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    int size = rlGetPixelDataSize(width, height, format);
 
-    if (success == GL_FALSE)
+    if (RLGL.ExtSupported.sync && (glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (data != NULL) && (size > 0))
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+        int index = RLGL.State.uploadCurrent;
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        // Wait for previous transfer from this pixel buffer (usually done already, ring is long enough)
+        if (RLGL.State.uploadFence[index] != NULL) rlWaitFence(&RLGL.State.uploadFence[index]);
 
-        if (maxLength > 0)
+        if (RLGL.State.uploadBufferId[index] == 0) glGenBuffers(1, &RLGL.State.uploadBufferId[index]);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, RLGL.State.uploadBufferId[index]);
+
+        if (size > RLGL.State.uploadBufferSize[index])
         {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+            RLGL.State.uploadBufferSize[index] = size;
         }
 
-        glDeleteProgram(program);
-
-        program = 0;
-    }
-    else
-    {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        // NOTE: Buffer is not in use by GPU anymore (fenced), no driver synchronization required
+        void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
-    }
-#endif
+        if (mapped != NULL)
+        {
+            memcpy(mapped, data, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
 
-    return program;
-}
+            rlStateBindTexture(GL_TEXTURE_2D, id);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, 0);   // Transfer from bound pixel buffer
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
-// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
-void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDispatchCompute(groupX, groupY, groupZ);
-#endif
-}
+            RLGL.State.uploadFence[index] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 
-// Load shader storage buffer object (SSBO)
-unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
-{
-    unsigned int ssbo = 0;
+            RLGL.State.uploadNextTicket++;
+            if (RLGL.State.uploadNextTicket == 0) RLGL.State.uploadNextTicket = 1;
+            ticket = RLGL.State.uploadNextTicket;
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glGenBuffers(1, &ssbo);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
-    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
-#endif
+            RLGL.State.uploadTicket[index] = ticket;
+            RLGL.State.uploadCurrent = (index + 1)%RL_TEXTURE_UPLOAD_BUFFERS;
+            RLGL.stats.bytesUploaded += size;
 
-    return ssbo;
-}
+            return ticket;
+        }
 
-// Unload shader storage buffer object (SSBO)
-void rlUnloadShaderBuffer(unsigned int ssboId)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDeleteBuffers(1, &ssboId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to map pixel buffer, updated synchronously", id);
+    }
 #endif
-}
 
-// Update SSBO buffer data
-void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
-#endif
+    rlUpdateTexture(id, offsetX, offsetY, width, height, format, data);
+
+    return ticket;
 }
 
-// Get SSBO buffer size
-unsigned int rlGetShaderBufferSize(unsigned int id)
+// Check if asynchronous texture upload has been completed by GPU (non-blocking)
+// NOTE: Ticket 0 (synchronous upload) and tickets whose pixel buffer has been reused are always completed
+bool rlIsTextureUploadComplete(unsigned int ticket)
 {
-    long long size = 0;
+    bool result = true;
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
-#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (ticket == 0) return result;
 
-    return (size > 0)? (unsigned int)size : 0;
-}
+    for (int i = 0; i < RL_TEXTURE_UPLOAD_BUFFERS; i++)
+    {
+        if ((RLGL.State.uploadTicket[i] == ticket) && (RLGL.State.uploadFence[i] != NULL))
+        {
+            GLenum status = glClientWaitSync((GLsync)RLGL.State.uploadFence[i], GL_SYNC_FLUSH_COMMANDS_BIT, 0);
 
-// Read SSBO buffer data (GPU->CPU)
-void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
-#endif
-}
+            if ((status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED) || (status == GL_WAIT_FAILED))
+            {
+                glDeleteSync((GLsync)RLGL.State.uploadFence[i]);
+                RLGL.State.uploadFence[i] = NULL;
+            }
+            else result = false;
 
-// Bind SSBO buffer
-void rlBindShaderBuffer(unsigned int id, unsigned int index)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+            break;
+        }
+    }
 #endif
-}
 
-// Copy SSBO buffer data
-void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
-    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
-#endif
+    return result;
 }
 
-// Bind image texture
-void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    unsigned int glInternalFormat = 0, glFormat = 0, glType = 0;
-
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
-#endif
-}
+    *glInternalFormat = 0;
+    *glFormat = 0;
+    *glType = 0;
 
-// Matrix state management
-//-----------------------------------------------------------------------------------------
-// Get internal modelview matrix
-Matrix rlGetMatrixModelview(void)
-{
-    Matrix matrix = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_11)
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+    #endif
+        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    rlStateForgetTexture(id);
+    rlUntrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id);
+    glDeleteTextures(1, &id);
+}
+
+// Generate mipmap data for selected texture
+// NOTE: Only supports GPU mipmap generation
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+
+        #define MIN(a,b) (((a)<(b))? (a):(b))
+        #define MAX(a,b) (((a)>(b))? (a):(b))
+
+        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        rlTrackGpuMemory(RL_GPU_MEMORY_TEXTURE, id, rlGetTextureDataSize(width, height, format, *mipmaps));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+#endif
+}
+
+
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    rlStateBindTexture(GL_TEXTURE_2D, id);
+
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlGetPixelDataSize(width, height, format);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        pixels = RL_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    unsigned int fboId = rlLoadFramebuffer(width, height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);
+
+    // Clean up temporal fbo
+    rlUnloadFramebuffer(fboId);
+#endif
+
+    return pixels;
+}
+
+// Read texture cubemap pixel data, all faces data for every mipmap level
+// NOTE: Data is returned as: level 0 faces (+X, -X, +Y, -Y, +Z, -Z), level 1 faces...
+void *rlReadTextureCubemapPixels(unsigned int id, int size, int format, int mipmapCount)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        unsigned int dataSize = 0;
+        for (int level = 0, mipSize = size; level < mipmapCount; level++, mipSize = (mipSize > 1)? mipSize/2 : 1) dataSize += 6*rlGetPixelDataSize(mipSize, mipSize, format);
+
+        pixels = RL_MALLOC(dataSize);
+        unsigned char *pixelsPtr = (unsigned char *)pixels;
+
+        rlStateBindTexture(GL_TEXTURE_CUBE_MAP, id);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        for (int level = 0, mipSize = size; level < mipmapCount; level++, mipSize = (mipSize > 1)? mipSize/2 : 1)
+        {
+            for (int i = 0; i < 6; i++)
+            {
+                glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, glFormat, glType, pixelsPtr);
+                pixelsPtr += rlGetPixelDataSize(mipSize, mipSize, format);
+            }
+        }
+
+        rlStateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+#else
+    // NOTE: glGetTexImage() is not available on OpenGL ES 2.0, cubemap faces can not be read back
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Cubemap data retrieval not supported by graphics API", id);
+#endif
+
+    return pixels;
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+
+    // Flip image vertically!
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+
+    for (int y = height - 1; y >= 0; y--)
+    {
+        unsigned char *line = imgData + ((height - 1) - y)*width*4;
+        memcpy(line, screenData + y*width*4, width*4);  // Flip line
+
+        // Set alpha component value to 255 (no trasparent image retrieval)
+        // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+        for (int x = 3; x < (width*4); x += 4) line[x] = 255;
+    }
+
+    RL_FREE(screenData);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Queue screen pixel data readback into pixel buffer (non-blocking)
+// NOTE: Transfer is done by GPU asynchronously, pixels are retrieved later (usually two frames after) with
+// rlCollectScreenPixels(), returns false if no pixel buffer is free or pixel buffers are not supported (OpenGL 3.2 required)
+bool rlRequestScreenPixels(int width, int height)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.sync && (RLGL.State.readbackCount < RL_SCREEN_READBACK_BUFFERS) && (width > 0) && (height > 0))
+    {
+        int index = (RLGL.State.readbackFirst + RLGL.State.readbackCount)%RL_SCREEN_READBACK_BUFFERS;
+        int size = width*height*4;
+
+        if (RLGL.State.readbackBufferId[index] == 0) glGenBuffers(1, &RLGL.State.readbackBufferId[index]);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.State.readbackBufferId[index]);
+
+        if (size > RLGL.State.readbackBufferSize[index])
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+            RLGL.State.readbackBufferSize[index] = size;
+        }
+
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);   // Transfer into bound pixel buffer
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        RLGL.State.readbackFence[index] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        RLGL.State.readbackWidth[index] = width;
+        RLGL.State.readbackHeight[index] = height;
+        RLGL.State.readbackCount++;
+
+        result = true;
+    }
+#endif
+
+    return result;
+}
+
+// Get oldest queued screen pixel data readback, NULL if there is no readback queued or it is not ready
+// NOTE 1: Returned data is the mapped pixel buffer, rows are bottom-up (flip must be done by consumer) and
+// alpha channel is retrieved as is, data is valid until rlReleaseScreenPixels() is called
+// NOTE 2: If wait is requested, function blocks until GPU transfer is completed
+unsigned char *rlCollectScreenPixels(int *width, int *height, bool wait)
+{
+    unsigned char *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((RLGL.State.readbackCount == 0) || RLGL.State.readbackMapped) return pixels;
+
+    int index = RLGL.State.readbackFirst;
+
+    if (RLGL.State.readbackFence[index] != NULL)
+    {
+        if (wait) rlWaitFence(&RLGL.State.readbackFence[index]);
+        else
+        {
+            GLenum status = glClientWaitSync((GLsync)RLGL.State.readbackFence[index], GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+            if (status == GL_TIMEOUT_EXPIRED) return pixels;
+
+            glDeleteSync((GLsync)RLGL.State.readbackFence[index]);
+            RLGL.State.readbackFence[index] = NULL;
+        }
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.State.readbackBufferId[index]);
+    pixels = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, RLGL.State.readbackWidth[index]*RLGL.State.readbackHeight[index]*4, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (pixels != NULL)
+    {
+        if (width != NULL) *width = RLGL.State.readbackWidth[index];
+        if (height != NULL) *height = RLGL.State.readbackHeight[index];
+        RLGL.State.readbackMapped = true;
+    }
+    else
+    {
+        // Drop failed readback, so next ones can be retrieved
+        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map screen readback pixel buffer");
+        RLGL.State.readbackFirst = (index + 1)%RL_SCREEN_READBACK_BUFFERS;
+        RLGL.State.readbackCount--;
+    }
+#endif
+
+    return pixels;
+}
+
+// Release screen pixel data retrieved with rlCollectScreenPixels()
+void rlReleaseScreenPixels(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.State.readbackMapped) return;
+
+    int index = RLGL.State.readbackFirst;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.State.readbackBufferId[index]);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    RLGL.State.readbackFirst = (index + 1)%RL_SCREEN_READBACK_BUFFERS;
+    RLGL.State.readbackCount--;
+    RLGL.State.readbackMapped = false;
+#endif
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(int width, int height)
+{
+    unsigned int fboId = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);   // Unbind any framebuffer
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_FRAMEBUFFER, fboId, 0);
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        default: break;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);
+#endif
+}
+
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
+{
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
+void rlUnloadFramebuffer(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    // Query color attachment, only renderbuffers are deleted (multisample framebuffers)
+    int colorType = 0, colorId = 0;
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &colorType);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &colorId);
+
+    unsigned int colorIdU = (unsigned int)colorId;
+    if (colorType == GL_RENDERBUFFER)
+    {
+        rlUntrackGpuMemory(RL_GPU_MEMORY_RENDERBUFFER, colorIdU);
+        glDeleteRenderbuffers(1, &colorIdU);
+    }
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER)
+    {
+        rlUntrackGpuMemory(RL_GPU_MEMORY_RENDERBUFFER, depthIdU);
+        glDeleteRenderbuffers(1, &depthIdU);
+    }
+    else if (depthType == GL_TEXTURE)
+    {
+        rlStateForgetTexture(depthIdU);
+        rlUntrackGpuMemory(RL_GPU_MEMORY_TEXTURE, depthIdU);
+        glDeleteTextures(1, &depthIdU);
+    }
+
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer.
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefault);
+    rlUntrackGpuMemory(RL_GPU_MEMORY_FRAMEBUFFER, id);
+    glDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#endif
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_VERTEX_BUFFER, id, size);
+#endif
+
+    return id;
+}
+
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_VERTEX_BUFFER, id, size);
+#endif
+
+    return id;
+}
+
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.stats.bytesUploaded += dataSize;
+#endif
+}
+
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.stats.bytesUploaded += dataSize;
+#endif
+}
+
+// Reallocate vertex buffer storage, buffer id is kept (vertex array state not changed)
+// NOTE: Previous storage is orphaned, driver keeps it alive while in use by GPU, so reallocation does not wait
+// for previous draws, it is used to grow buffers and to fully update buffers every frame without sync
+void rlResizeVertexBuffer(unsigned int id, int size, bool dynamic)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_VERTEX_BUFFER, id, size);
+#endif
+}
+
+// Reallocate vertex buffer elements storage, buffer id is kept (previous storage orphaned)
+void rlResizeVertexBufferElements(unsigned int id, int size, bool dynamic)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, NULL, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_VERTEX_BUFFER, id, size);
+#endif
+}
+
+// Enable vertex array object (VAO)
+bool rlEnableVertexArray(unsigned int vaoId)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlStateBindVertexArray(vaoId);
+        result = true;
+    }
+#endif
+    return result;
+}
+
+// Disable vertex array object (VAO)
+void rlDisableVertexArray(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+#endif
+}
+
+// Enable vertex attribute index
+void rlEnableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glEnableVertexAttribArray(index);
+#endif
+}
+
+// Disable vertex attribute index
+void rlDisableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDisableVertexAttribArray(index);
+#endif
+}
+
+// Draw vertex array
+void rlDrawVertexArray(int offset, int count)
+{
+    glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.stats.drawCalls++;
+    RLGL.stats.vertexCount += count;
+#endif
+}
+
+// Draw vertex array elements
+void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
+{
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.stats.drawCalls++;
+    RLGL.stats.vertexCount += count;
+#endif
+}
+
+// Draw vertex array instanced
+void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.instancing) return;
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.stats.drawCalls++;
+    RLGL.stats.vertexCount += count*instances;
+#endif
+}
+
+// Draw vertex array elements instanced
+void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.instancing) return;
+
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+    RLGL.stats.drawCalls++;
+    RLGL.stats.vertexCount += count*instances;
+#endif
+}
+
+// Draw vertex array lines instanced
+void rlDrawVertexArrayLinesInstanced(int offset, int count, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.instancing) return;
+
+    glDrawArraysInstanced(GL_LINES, offset, count, instances);
+    RLGL.stats.drawCalls++;
+    RLGL.stats.vertexCount += count*instances;
+#endif
+}
+
+// Draw vertex array with arguments stored in GPU buffer
+// NOTE: Arguments layout: { count, instanceCount, first, baseInstance }, usually written by a compute shader
+void rlDrawVertexArrayIndirect(unsigned int argsBufferId, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, argsBufferId);
+    glDrawArraysIndirect(GL_TRIANGLES, (const void *)(size_t)offset);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.stats.drawCalls++;
+#endif
+}
+
+// Draw vertex array elements with arguments stored in GPU buffer (unsigned short indices)
+// NOTE: Arguments layout: rlDrawIndirectCommand, usually written by a compute shader
+void rlDrawVertexArrayElementsIndirect(unsigned int argsBufferId, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, argsBufferId);
+    glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)(size_t)offset);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.stats.drawCalls++;
+#endif
+}
+
+// Draw multiple indexed draws from bound vertex array and indices buffer (unsigned short indices)
+// NOTE: Useful for static mesh sets, several meshes stored in the same vertex/indices buffers sharing a material,
+// commands are uploaded to an internal buffer and drawn with one glMultiDrawElementsIndirect() call (OpenGL 4.3),
+// otherwise every command is drawn on its own, base vertex requires OpenGL 3.2 and base instance OpenGL 4.2
+void rlDrawMultiIndirect(const rlDrawIndirectCommand *commands, int drawCount)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((commands == NULL) || (drawCount <= 0)) return;
+
+    int vertexCount = 0;
+    for (int i = 0; i < drawCount; i++) vertexCount += commands[i].count*commands[i].instanceCount;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.multiDrawIndirect)
+    {
+        int size = drawCount*(int)sizeof(rlDrawIndirectCommand);
+
+        if (RLGL.State.indirectBufferId == 0) glGenBuffers(1, &RLGL.State.indirectBufferId);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, RLGL.State.indirectBufferId);
+
+        // Buffer storage is orphaned on every upload (grows if required), so previous draws are not stalled
+        if (size > RLGL.State.indirectBufferSize) RLGL.State.indirectBufferSize = size;
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, RLGL.State.indirectBufferSize, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, size, commands);
+
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, 0, drawCount, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+        RLGL.stats.drawCalls++;
+        RLGL.stats.bytesUploaded += size;
+        RLGL.stats.vertexCount += vertexCount;
+        return;
+    }
+#endif
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        const rlDrawIndirectCommand *command = &commands[i];
+        const void *indices = (const void *)(command->firstIndex*sizeof(unsigned short));
+
+        if ((command->count == 0) || (command->instanceCount == 0)) continue;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        if ((command->baseInstance > 0) && RLGL.ExtSupported.baseInstance)
+        {
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, command->count, GL_UNSIGNED_SHORT, indices, command->instanceCount, command->baseVertex, command->baseInstance);
+        }
+        else if ((command->baseInstance == 0) && (command->baseVertex != 0) && RLGL.ExtSupported.baseVertex)
+        {
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command->count, GL_UNSIGNED_SHORT, indices, command->instanceCount, command->baseVertex);
+        }
+        else
+#endif
+        if ((command->baseInstance == 0) && (command->baseVertex == 0))
+        {
+            if (command->instanceCount == 1) glDrawElements(GL_TRIANGLES, command->count, GL_UNSIGNED_SHORT, indices);
+            else if (RLGL.ExtSupported.instancing) glDrawElementsInstanced(GL_TRIANGLES, command->count, GL_UNSIGNED_SHORT, indices, command->instanceCount);
+            else
+            {
+                TRACELOG(RL_LOG_WARNING, "RLGL: Draw indirect command %i skipped, instancing not supported", i);
+                continue;
+            }
+        }
+        else
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Draw indirect command %i skipped, base vertex/instance not supported", i);
+            continue;
+        }
+
+        RLGL.stats.drawCalls++;
+    }
+
+    RLGL.stats.vertexCount += vertexCount;
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_11)
+// Enable vertex state pointer
+void rlEnableStatePointer(int vertexAttribType, void *buffer)
+{
+    if (buffer != NULL) glEnableClientState(vertexAttribType);
+    switch (vertexAttribType)
+    {
+        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
+        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
+        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
+        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
+        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
+        default: break;
+    }
+}
+
+// Disable vertex state pointer
+void rlDisableStatePointer(int vertexAttribType)
+{
+    glDisableClientState(vertexAttribType);
+}
+#endif
+
+// Load vertex array object (VAO)
+unsigned int rlLoadVertexArray(void)
+{
+    unsigned int vaoId = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &vaoId);
+    }
+#endif
+    return vaoId;
+}
+
+// Set vertex attribute
+void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 half-float type is provided by extension with a different enum value
+    if (type == RL_HALF_FLOAT) type = GL_HALF_FLOAT_OES;
+    #endif
+    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+#endif
+}
+
+// Check if instanced drawing is supported
+bool rlIsInstancingSupported(void)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = RLGL.ExtSupported.instancing;
+#endif
+
+    return result;
+}
+
+// Check if half-float vertex attributes are supported (RL_HALF_FLOAT)
+bool rlIsVertexHalfFloatSupported(void)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = RLGL.ExtSupported.vertexHalfFloat;
+#endif
+
+    return result;
+}
+
+// Set vertex attribute divisor
+void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: On OpenGL ES 2.0 divisor is only available with instancing extensions
+    if (RLGL.ExtSupported.instancing) glVertexAttribDivisor(index, divisor);
+#endif
+}
+
+// Unload vertex array object (VAO)
+void rlUnloadVertexArray(unsigned int vaoId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlStateBindVertexArray(0);
+        glDeleteVertexArrays(1, &vaoId);
+        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+    }
+#endif
+}
+
+// Unload vertex buffer (VBO)
+void rlUnloadVertexBuffer(unsigned int vboId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlUntrackGpuMemory(RL_GPU_MEMORY_VERTEX_BUFFER, vboId);
+    glDeleteBuffers(1, &vboId);
+    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+#endif
+}
+
+// Shaders management
+//-----------------------------------------------------------------------------------------------
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int vertexShaderId = 0;
+    unsigned int fragmentShaderId = 0;
+
+    // Compile vertex shader (if provided)
+    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    // In case no vertex shader was provided or compilation failed, we use default vertex shader
+    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+
+    // Compile fragment shader (if provided)
+    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+    // In case no fragment shader was provided or compilation failed, we use default fragment shader
+    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+
+    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
+    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
+    else
+    {
+        // One of or both shader are new, we need to compile a new shader program
+        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        // We can detach and delete vertex/fragment shaders (if not default ones)
+        // NOTE: We detach shader before deletion to make sure memory is freed
+        if (vertexShaderId != RLGL.State.defaultVShaderId)
+        {
+            // WARNING: Shader program linkage could fail and returned id is 0
+            if (id > 0) glDetachShader(id, vertexShaderId);
+            glDeleteShader(vertexShaderId);
+        }
+        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        {
+            // WARNING: Shader program linkage could fail and returned id is 0
+            if (id > 0) glDetachShader(id, fragmentShaderId);
+            glDeleteShader(fragmentShaderId);
+        }
+
+        // In case shader program loading failed, we assign default shader
+        if (id == 0)
+        {
+            // In case shader loading fails, we return the default shader
+            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+            id = RLGL.State.defaultShaderId;
+        }
+        /*
+        else
+        {
+            // Get available shader uniforms
+            // NOTE: This information is useful for debug...
+            int uniformCount = -1;
+            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+            for (int i = 0; i < uniformCount; i++)
+            {
+                int namelen = -1;
+                int num = -1;
+                char name[256] = { 0 };     // Assume no variable names longer than 256
+                GLenum type = GL_ZERO;
+
+                // Get the name of the uniforms
+                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+
+                name[namelen] = 0;
+                TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+            }
+        }
+        */
+    }
+#endif
+
+    return id;
+}
+
+// Load shader from code strings, compilation and linkage status are not checked
+// NOTE: Compilation/linkage can be done by driver in parallel (KHR_parallel_shader_compile), program must be
+// finished with rlFinishShaderProgram() before use, rlIsShaderProgramCompleted() can be polled not to block
+unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // In case vertex and fragment shader are the default ones, we can just assign the default shader program id
+    if ((vsCode == NULL) && (fsCode == NULL)) return RLGL.State.defaultShaderId;
+
+    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+
+    if (vsCode != NULL)
+    {
+        vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShaderId, 1, &vsCode, NULL);
+        glCompileShader(vertexShaderId);
+    }
+
+    if (fsCode != NULL)
+    {
+        fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShaderId, 1, &fsCode, NULL);
+        glCompileShader(fragmentShaderId);
+    }
+
+    id = glCreateProgram();
+
+    glAttachShader(id, vertexShaderId);
+    glAttachShader(id, fragmentShaderId);
+
+    rlLinkShaderProgram(id);
+
+    // NOTE: Shaders are flagged for deletion, they are released when detached from program
+    if (vertexShaderId != RLGL.State.defaultVShaderId) glDeleteShader(vertexShaderId);
+    if (fragmentShaderId != RLGL.State.defaultFShaderId) glDeleteShader(fragmentShaderId);
+#endif
+
+    return id;
+}
+
+// Check if shader program compilation/linkage is completed
+// NOTE: Without KHR_parallel_shader_compile it always returns true, rlFinishShaderProgram() blocks in that case
+bool rlIsShaderProgramCompleted(unsigned int id)
+{
+    bool result = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.parallelCompile && (id > 0))
+    {
+        GLint completed = GL_TRUE;
+        glGetProgramiv(id, GL_COMPLETION_STATUS_KHR, &completed);
+
+        result = (completed == GL_TRUE);
+    }
+#endif
+
+    return result;
+}
+
+// Finish shader program loaded with rlLoadShaderCodeAsync(), checking compilation/linkage status
+// NOTE: Failed programs are linked again with default shaders, so program id remains valid (returns false)
+bool rlFinishShaderProgram(unsigned int id)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (id == RLGL.State.defaultShaderId)) return true;
+
+    GLuint shaders[2] = { 0 };
+    GLsizei shaderCount = 0;
+    glGetAttachedShaders(id, 2, &shaderCount, shaders);
+
+    for (int i = 0; i < shaderCount; i++)
+    {
+        if ((shaders[i] != RLGL.State.defaultVShaderId) && (shaders[i] != RLGL.State.defaultFShaderId))
+        {
+            GLint type = 0;
+            glGetShaderiv(shaders[i], GL_SHADER_TYPE, &type);
+            rlCheckShaderCompile(shaders[i], type);
+        }
+    }
+
+    result = rlCheckShaderProgramLink(id);
+
+    // Detach shaders, flagged for deletion ones are released
+    for (int i = 0; i < shaderCount; i++) glDetachShader(id, shaders[i]);
+
+    if (result) TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", id);
+    else
+    {
+        // In case shader program loading failed, we link default shaders into it
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load custom shader code, using default shader", id);
+
+        glAttachShader(id, RLGL.State.defaultVShaderId);
+        glAttachShader(id, RLGL.State.defaultFShaderId);
+
+        rlLinkShaderProgram(id);
+
+        glDetachShader(id, RLGL.State.defaultVShaderId);
+        glDetachShader(id, RLGL.State.defaultFShaderId);
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Bind default uniform blocks (if declared) to their binding points
+    rlBindShaderUniformBlocks(id);
+#endif
+#endif
+
+    return result;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    unsigned int shader = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderCode, NULL);
+
+    glCompileShader(shader);
+    rlCheckShaderCompile(shader, type);
+#endif
+
+    return shader;
+}
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    rlLinkShaderProgram(program);
+
+    if (!rlCheckShaderProgramLink(program))
+    {
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Bind default uniform blocks (if declared) to their binding points
+        rlBindShaderUniformBlocks(program);
+#endif
+    }
+#endif
+    return program;
+}
+
+// Load shader program from driver binary (retrieved with rlGetShaderProgramBinary())
+// NOTE: Driver can reject the binary (driver updated, different GPU), returned id is 0 in that case
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int size, unsigned int format)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.programBinary && (data != NULL) && (size > 0))
+    {
+        GLint success = 0;
+        program = glCreateProgram();
+
+        glProgramBinary(program, format, data, size);
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        if (success == GL_FALSE)
+        {
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Program binary rejected by driver", program);
+            glDeleteProgram(program);
+
+            program = 0;
+        }
+        else
+        {
+            TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", program);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            // Bind default uniform blocks (if declared) to their binding points
+            rlBindShaderUniformBlocks(program);
+#endif
+        }
+    }
+#endif
+
+    return program;
+}
+
+// Get shader program driver binary, NULL if not supported
+// NOTE: Returned data must be freed, binary is only valid with same GPU and driver (see rlGetShaderBinaryKey())
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *size, unsigned int *format)
+{
+    unsigned char *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.programBinary && (id > 0))
+    {
+        GLint length = 0;
+        glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+
+        if (length > 0)
+        {
+            GLsizei written = 0;
+            GLenum binaryFormat = 0;
+
+            data = (unsigned char *)RL_MALLOC(length);
+            glGetProgramBinary(id, length, &written, &binaryFormat, data);
+
+            if (written > 0)
+            {
+                if (size != NULL) *size = written;
+                if (format != NULL) *format = binaryFormat;
+            }
+            else
+            {
+                RL_FREE(data);
+                data = NULL;
+            }
+        }
+    }
+#endif
+
+    return data;
+}
+
+// Get shader program binary key, hash of shader code and driver identification
+// NOTE: Driver vendor, renderer and version are included, binaries from other drivers get a different key
+unsigned long long rlGetShaderBinaryKey(const char *vsCode, const char *fsCode)
+{
+    unsigned long long hash = 14695981039346656037ULL;     // FNV-1a 64 bit offset basis
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    const char *strings[5] = {
+        (const char *)glGetString(GL_VENDOR),
+        (const char *)glGetString(GL_RENDERER),
+        (const char *)glGetString(GL_VERSION),
+        vsCode,
+        fsCode
+    };
+
+    for (int i = 0; i < 5; i++)
+    {
+        if (strings[i] != NULL)
+        {
+            for (const unsigned char *c = (const unsigned char *)strings[i]; *c != '\0'; c++)
+            {
+                hash ^= *c;
+                hash *= 1099511628211ULL;       // FNV-1a 64 bit prime
+            }
+        }
+
+        // NOTE: Strings separator, so code moved from one shader to the other changes the key
+        hash ^= 0xff;
+        hash *= 1099511628211ULL;
+    }
+#endif
+
+    return hash;
+}
+
+// Unload shader program
+void rlUnloadShaderProgram(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateForgetProgram(id);
+    glDeleteProgram(id);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+#endif
+}
+
+// Get shader location uniform
+int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+{
+    return rlGetLocationUniformEx(shaderId, uniformName, false);
+}
+
+// Get shader location uniform, optional uniforms not found only logged as debug
+// NOTE: Locations are cached by shader id and name (if state cache available), only first query reaches OpenGL
+int rlGetLocationUniformEx(unsigned int shaderId, const char *uniformName, bool optional)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    rlUniformLocation *entry = NULL;
+    size_t nameLength = strlen(uniformName);
+
+    if ((shaderId > 0) && (nameLength < RL_UNIFORM_LOCATION_NAME_SIZE))
+    {
+        // FNV-1a name hash, 0 is reserved for free entries
+        unsigned int hash = 2166136261u;
+        for (size_t i = 0; i < nameLength; i++) hash = (hash ^ (unsigned char)uniformName[i])*16777619u;
+        hash ^= shaderId*2654435761u;
+        if (hash == 0) hash = 1;
+
+        int index = (int)(hash%RL_MAX_UNIFORM_LOCATIONS_CACHE);
+        int freeIndex = -1;
+
+        for (int i = 0; i < RL_MAX_UNIFORM_LOCATIONS_CACHE; i++)
+        {
+            rlUniformLocation *current = &RLGL.StateCache.locations[(index + i)%RL_MAX_UNIFORM_LOCATIONS_CACHE];
+
+            if (current->shaderId == 0)
+            {
+                if ((freeIndex == -1) && (current->hash == 0)) freeIndex = (index + i)%RL_MAX_UNIFORM_LOCATIONS_CACHE;
+                if (current->hash == 0) break;      // Free entry, end of probing sequence (removed entries keep probing)
+                continue;
+            }
+
+            if ((current->shaderId == shaderId) && (current->hash == hash) && (strcmp(current->name, uniformName) == 0)) return current->location;
+        }
+
+        // Cache is cleared when it gets too full, locations are queried again on demand
+        if (RLGL.StateCache.locationsUsed >= RL_MAX_UNIFORM_LOCATIONS_CACHE*3/4)
+        {
+            memset(RLGL.StateCache.locations, 0, sizeof(RLGL.StateCache.locations));
+            RLGL.StateCache.locationsUsed = 0;
+            freeIndex = index;
+        }
+
+        if (freeIndex != -1)
+        {
+            entry = &RLGL.StateCache.locations[freeIndex];
+            entry->shaderId = shaderId;
+            entry->hash = hash;
+            memcpy(entry->name, uniformName, nameLength + 1);
+            RLGL.StateCache.locationsUsed++;
+        }
+    }
+#endif
+    location = glGetUniformLocation(shaderId, uniformName);
+
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (entry != NULL) entry->location = location;
+#endif
+
+    if (location == -1) TRACELOG(optional? RL_LOG_DEBUG : RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
+#endif
+    return location;
+}
+
+// Get shader location attribute
+int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+{
+    return rlGetLocationAttribEx(shaderId, attribName, false);
+}
+
+// Get shader location attribute, optional attributes not found only logged as debug
+int rlGetLocationAttribEx(unsigned int shaderId, const char *attribName, bool optional)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    location = glGetAttribLocation(shaderId, attribName);
+
+    if (location == -1) TRACELOG(optional? RL_LOG_DEBUG : RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
+#endif
+    return location;
+}
+
+// Get shader location uniform block (block index)
+// NOTE: Default blocks are bound to their binding points on shader program linking
+int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.ubo)
+    {
+        unsigned int blockIndex = glGetUniformBlockIndex(shaderId, blockName);
+        if (blockIndex != GL_INVALID_INDEX) location = (int)blockIndex;
+    }
+
+    if (location == -1) TRACELOG(RL_LOG_DEBUG, "SHADER: [ID %i] Failed to find shader uniform block: %s", shaderId, blockName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform block (%s) set at location: %i", shaderId, blockName, location);
+#endif
+    return location;
+}
+
+// Set shader value uniform
+void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value attribute
+void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    switch (attribType)
+    {
+        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value uniform matrix
+void rlSetUniformMatrix(int locIndex, Matrix mat)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float matfloat[16] = {
+        mat.m0, mat.m1, mat.m2, mat.m3,
+        mat.m4, mat.m5, mat.m6, mat.m7,
+        mat.m8, mat.m9, mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15
+    };
+    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#endif
+}
+
+// Set shader value uniform matrices array
+// NOTE: Matrix struct is row-major in memory, matrices are converted to column-major float arrays
+void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((matrices == NULL) || (count <= 0)) return;
+
+    // NOTE: Stack buffer used for common skeletons size, avoids allocations per draw
+    float buffer[64*16];
+    float *matfloat = (count <= 64)? buffer : (float *)RL_MALLOC(count*16*sizeof(float));
+
+    for (int i = 0; i < count; i++)
+    {
+        const Matrix *mat = &matrices[i];
+        float *m = matfloat + i*16;
+
+        m[0] = mat->m0; m[1] = mat->m1; m[2] = mat->m2; m[3] = mat->m3;
+        m[4] = mat->m4; m[5] = mat->m5; m[6] = mat->m6; m[7] = mat->m7;
+        m[8] = mat->m8; m[9] = mat->m9; m[10] = mat->m10; m[11] = mat->m11;
+        m[12] = mat->m12; m[13] = mat->m13; m[14] = mat->m14; m[15] = mat->m15;
+    }
+
+    glUniformMatrix4fv(locIndex, count, false, matfloat);
+
+    if (matfloat != buffer) RL_FREE(matfloat);
+#endif
+}
+
+// Set shader value uniform sampler
+void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+    rlSetUniformSamplerType(locIndex, textureId, RL_TEXTURE_2D);
+}
+
+// Set shader value uniform sampler for texture type
+// NOTE: Texture is bound to its texture unit with required type (target) on batch drawing
+void rlSetUniformSamplerType(int locIndex, unsigned int textureId, int type)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check if texture is already active
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+
+    // Register a new active texture for the internal batch system
+    // NOTE: Default texture is always activated as GL_TEXTURE0
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == 0)
+        {
+            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            RLGL.State.activeTextureType[i] = (unsigned int)type;
+            break;
+        }
+    }
+#endif
+}
+
+// Set shader currently active (id and locations)
+void rlSetShader(unsigned int id, int *locs)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentShaderId != id)
+    {
+        RLGL.State.flushReason = RL_FLUSH_SHADER_CHANGE;
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentShaderId = id;
+        RLGL.stats.shaderSwitches++;
+        RLGL.State.currentShaderLocs = locs;
+    }
+#endif
+}
+
+// Load compute shader program
+unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+    }
+#endif
+
+    return program;
+}
+
+// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
+void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glDispatchCompute(groupX, groupY, groupZ);
+#endif
+}
+
+// Wait for compute shader buffer writes to be visible
+// NOTE: Required before using buffers written by a compute shader as storage, vertex attributes or indirect commands
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+#endif
+}
+
+// Load shader storage buffer object (SSBO)
+unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int ssbo = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glGenBuffers(1, &ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    rlTrackGpuMemory(RL_GPU_MEMORY_SHADER_BUFFER, ssbo, size);
+#endif
+
+    return ssbo;
+}
+
+// Unload shader storage buffer object (SSBO)
+void rlUnloadShaderBuffer(unsigned int ssboId)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    rlUntrackGpuMemory(RL_GPU_MEMORY_SHADER_BUFFER, ssboId);
+    glDeleteBuffers(1, &ssboId);
+#endif
+}
+
+// Update SSBO buffer data
+void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Get SSBO buffer size
+unsigned int rlGetShaderBufferSize(unsigned int id)
+{
+    long long size = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+#endif
+
+    return (size > 0)? (unsigned int)size : 0;
+}
+
+// Read SSBO buffer data (GPU->CPU)
+void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+#endif
+}
+
+// Bind SSBO buffer
+void rlBindShaderBuffer(unsigned int id, unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#endif
+}
+
+// Copy SSBO buffer data
+void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
+#endif
+}
+
+// Load uniform buffer object (UBO)
+unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int ubo = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.ubo)
+    {
+        glGenBuffers(1, &ubo);
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+        glBufferData(GL_UNIFORM_BUFFER, size, data, usageHint? usageHint : RL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        rlTrackGpuMemory(RL_GPU_MEMORY_SHADER_BUFFER, ubo, size);
+    }
+    else TRACELOG(RL_LOG_WARNING, "UBO: Uniform buffer objects not supported");
+#endif
+
+    return ubo;
+}
+
+// Unload uniform buffer object (UBO)
+void rlUnloadUniformBuffer(unsigned int uboId)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (uboId > 0)
+    {
+        rlUntrackGpuMemory(RL_GPU_MEMORY_SHADER_BUFFER, uboId);
+        glDeleteBuffers(1, &uboId);
+    }
+#endif
+}
+
+// Update UBO buffer data
+void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (id > 0)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, id);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, dataSize, data);
+    }
+#endif
+}
+
+// Bind UBO buffer range to binding point
+// NOTE: offset must be a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+// binding points RL_UNIFORM_BLOCK_BINDING_FRAME and RL_UNIFORM_BLOCK_BINDING_DRAW are used by default blocks
+void rlBindUniformBuffer(unsigned int id, unsigned int index, unsigned int offset, unsigned int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.ubo)
+    {
+        if (size == 0) glBindBufferBase(GL_UNIFORM_BUFFER, index, id);
+        else glBindBufferRange(GL_UNIFORM_BUFFER, index, id, offset, size);
+    }
+#endif
+}
+
+// Set default frame uniform block data
+// NOTE: Data is only uploaded when changed, usually once per frame (or per camera)
+void rlSetUniformBlockFrame(Matrix view, Matrix projection)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.UniformBlocks.frameId == 0) return;
+
+    float data[32] = {
+        view.m0, view.m1, view.m2, view.m3,
+        view.m4, view.m5, view.m6, view.m7,
+        view.m8, view.m9, view.m10, view.m11,
+        view.m12, view.m13, view.m14, view.m15,
+        projection.m0, projection.m1, projection.m2, projection.m3,
+        projection.m4, projection.m5, projection.m6, projection.m7,
+        projection.m8, projection.m9, projection.m10, projection.m11,
+        projection.m12, projection.m13, projection.m14, projection.m15
+    };
+
+    if (!RLGL.UniformBlocks.frameValid || (memcmp(data, RLGL.UniformBlocks.frameData, sizeof(data)) != 0))
+    {
+        rlUpdateUniformBuffer(RLGL.UniformBlocks.frameId, data, sizeof(data), 0);
+        memcpy(RLGL.UniformBlocks.frameData, data, sizeof(data));
+        RLGL.UniformBlocks.frameValid = true;
+    }
+#endif
+}
+
+// Set default draw uniform block data
+// NOTE: Every call writes a new range of the internal buffer and binds it,
+// buffer is orphaned when full so ranges in use by previous draws are not overwritten
+void rlSetUniformBlockDraw(Matrix mvp, Matrix model, Matrix normal, const float *color)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.UniformBlocks.drawId == 0) return;
+
+    float data[52] = {
+        mvp.m0, mvp.m1, mvp.m2, mvp.m3,
+        mvp.m4, mvp.m5, mvp.m6, mvp.m7,
+        mvp.m8, mvp.m9, mvp.m10, mvp.m11,
+        mvp.m12, mvp.m13, mvp.m14, mvp.m15,
+        model.m0, model.m1, model.m2, model.m3,
+        model.m4, model.m5, model.m6, model.m7,
+        model.m8, model.m9, model.m10, model.m11,
+        model.m12, model.m13, model.m14, model.m15,
+        normal.m0, normal.m1, normal.m2, normal.m3,
+        normal.m4, normal.m5, normal.m6, normal.m7,
+        normal.m8, normal.m9, normal.m10, normal.m11,
+        normal.m12, normal.m13, normal.m14, normal.m15,
+        1.0f, 1.0f, 1.0f, 1.0f
+    };
+
+    if (color != NULL) memcpy(&data[48], color, 4*sizeof(float));
+
+    glBindBuffer(GL_UNIFORM_BUFFER, RLGL.UniformBlocks.drawId);
+
+    if ((RLGL.UniformBlocks.drawOffset + RLGL.UniformBlocks.drawStride) > RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE)
+    {
+        // Orphan buffer storage, driver keeps previous storage alive while in use
+        glBufferData(GL_UNIFORM_BUFFER, RL_UNIFORM_BLOCK_DRAW_BUFFER_SIZE, NULL, RL_STREAM_DRAW);
+        RLGL.UniformBlocks.drawOffset = 0;
+    }
+
+    glBufferSubData(GL_UNIFORM_BUFFER, RLGL.UniformBlocks.drawOffset, sizeof(data), data);
+    glBindBufferRange(GL_UNIFORM_BUFFER, RL_UNIFORM_BLOCK_BINDING_DRAW, RLGL.UniformBlocks.drawId, RLGL.UniformBlocks.drawOffset, RL_UNIFORM_BLOCK_DRAW_SIZE);
+
+    RLGL.UniformBlocks.drawOffset += RLGL.UniformBlocks.drawStride;
+#endif
+}
+
+// Bind image texture
+void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    unsigned int glInternalFormat = 0, glFormat = 0, glType = 0;
+
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+#endif
+}
+
+// Matrix state management
+//-----------------------------------------------------------------------------------------
+// Get internal modelview matrix
+Matrix rlGetMatrixModelview(void)
+{
+    Matrix matrix = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_11)
     float mat[16];
     glGetFloatv(GL_MODELVIEW_MATRIX, mat);
     matrix.m0 = mat[0];
@@ -4192,379 +7916,1288 @@ Matrix rlGetMatrixModelview(void)
     matrix.m14 = mat[14];
     matrix.m15 = mat[15];
 #else
-    matrix = RLGL.State.modelview;
+    matrix = RLGL.State.modelview;
+#endif
+    return matrix;
+}
+
+// Get internal projection matrix
+Matrix rlGetMatrixProjection(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    Matrix m;
+    m.m0 = mat[0];
+    m.m1 = mat[1];
+    m.m2 = mat[2];
+    m.m3 = mat[3];
+    m.m4 = mat[4];
+    m.m5 = mat[5];
+    m.m6 = mat[6];
+    m.m7 = mat[7];
+    m.m8 = mat[8];
+    m.m9 = mat[9];
+    m.m10 = mat[10];
+    m.m11 = mat[11];
+    m.m12 = mat[12];
+    m.m13 = mat[13];
+    m.m14 = mat[14];
+    m.m15 = mat[15];
+    return m;
+#else
+    return RLGL.State.projection;
+#endif
+}
+
+// Get internal accumulated transform matrix
+Matrix rlGetMatrixTransform(void)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // TODO: Consider possible transform matrices in the RLGL.State.stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = rlMatrixIdentity();
+    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
+    mat = RLGL.State.transform;
+#endif
+    return mat;
+}
+
+// Get internal projection matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.projectionStereo[eye];
+#endif
+    return mat;
+}
+
+// Get internal view offset matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.viewOffsetStereo[eye];
+#endif
+    return mat;
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void rlSetMatrixModelview(Matrix view)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.modelview = view;
+#endif
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void rlSetMatrixProjection(Matrix projection)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.projection = projection;
+#endif
+}
+
+// Set eyes projection matrices for stereo rendering
+void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.projectionStereo[0] = right;
+    RLGL.State.projectionStereo[1] = left;
+#endif
+}
+
+// Set eyes view offsets matrices for stereo rendering
+void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewOffsetStereo[0] = right;
+    RLGL.State.viewOffsetStereo[1] = left;
+#endif
+}
+
+// Load and draw a quad in NDC
+void rlLoadDrawQuad(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int quadVAO = 0;
+    unsigned int quadVBO = 0;
+
+    float vertices[] = {
+         // Positions         Texcoords
+        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &quadVAO);
+    rlStateBindVertexArray(quadVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &quadVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, texcoords)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+
+    // Draw quad
+    rlStateBindVertexArray(quadVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    rlStateBindVertexArray(0);
+
+    // Delete buffers (VBO and VAO)
+    glDeleteBuffers(1, &quadVBO);
+    glDeleteVertexArrays(1, &quadVAO);
+#endif
+}
+
+// Load and draw a cube in NDC
+void rlLoadDrawCube(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int cubeVAO = 0;
+    unsigned int cubeVBO = 0;
+
+    float vertices[] = {
+         // Positions          Normals               Texcoords
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &cubeVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, normals, texcoords)
+    rlStateBindVertexArray(cubeVAO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlStateBindVertexArray(0);
+
+    // Draw cube
+    rlStateBindVertexArray(cubeVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    rlStateBindVertexArray(0);
+
+    // Delete VBO and VAO
+    glDeleteBuffers(1, &cubeVBO);
+    glDeleteVertexArrays(1, &cubeVAO);
+#endif
+}
+
+// Get name string for pixel format
+const char *rlGetPixelFormatName(unsigned int format)
+{
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        default: return "UNKNOWN"; break;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Bind texture to active texture unit
+static void rlStateBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    // NOTE: Only 2d textures and cubemaps bindings are cached, other texture types are always bound
+    if ((RLGL.StateCache.activeSlot < RL_STATE_CACHE_TEXTURE_UNITS) && ((target == GL_TEXTURE_2D) || (target == GL_TEXTURE_CUBE_MAP)))
+    {
+        unsigned int *bound = (target == GL_TEXTURE_CUBE_MAP)? &RLGL.StateCache.textureCubemap[RLGL.StateCache.activeSlot] : &RLGL.StateCache.texture2d[RLGL.StateCache.activeSlot];
+
+        if (*bound == id) { RLGL.stats.stateCallsSkipped++; return; }
+        *bound = id;
+    }
+#endif
+    glBindTexture(target, id);
+}
+
+// Remove deleted texture from state cache
+// NOTE: Deleted textures are unbound from all units by OpenGL and their ids can be reused
+static void rlStateForgetTexture(unsigned int id)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.StateCache.texture2d[i] == id) RLGL.StateCache.texture2d[i] = 0;
+        if (RLGL.StateCache.textureCubemap[i] == id) RLGL.StateCache.textureCubemap[i] = 0;
+    }
+#endif
+}
+
+// Enable/disable OpenGL capability
+static void rlStateEnable(int state, unsigned int cap, bool enabled)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.caps[state] == (unsigned int)enabled) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.caps[state] = (unsigned int)enabled;
+#endif
+    if (enabled) glEnable(cap);
+    else glDisable(cap);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Select active texture unit
+static void rlStateActiveTexture(unsigned int slot)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.activeSlot == slot) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.activeSlot = slot;
+#endif
+    glActiveTexture(GL_TEXTURE0 + slot);
+}
+
+// Use shader program
+static void rlStateUseProgram(unsigned int id)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.program == id) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.program = id;
+#endif
+    glUseProgram(id);
+}
+
+// Bind vertex array object
+static void rlStateBindVertexArray(unsigned int vaoId)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.vaoId == vaoId) { RLGL.stats.stateCallsSkipped++; return; }
+    RLGL.StateCache.vaoId = vaoId;
+#endif
+    glBindVertexArray(vaoId);
+}
+
+// Remove deleted vertex array object from state cache
+// NOTE: Deleting the bound VAO reverts binding to 0
+static void rlStateForgetVertexArray(unsigned int vaoId)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.vaoId == vaoId) RLGL.StateCache.vaoId = 0;
+#endif
+}
+
+// Remove deleted shader program from state cache (and its uniform locations)
+// NOTE: Program in use is only flagged for deletion, it stays in use until another program is used
+static void rlStateForgetProgram(unsigned int id)
+{
+#if defined(RLGL_STATE_CACHE_AVAILABLE)
+    if (RLGL.StateCache.program == id) RLGL.StateCache.program = RL_STATE_CACHE_UNKNOWN;
+
+    // Mark entries as removed (hash kept), so probing sequences of other entries are not broken
+    for (int i = 0; i < RL_MAX_UNIFORM_LOCATIONS_CACHE; i++)
+    {
+        if (RLGL.StateCache.locations[i].shaderId == id) RLGL.StateCache.locations[i].shaderId = 0;
+    }
+#endif
+}
+
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlLoadShaderDefault(void)
+{
+    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    // Multi-texture batch default shader, vertex texture slot selects the texture0[] sampler to use
+    // NOTE: Samplers arrays can only be indexed with constant expressions on GLSL 120/330, so slot is selected by branching
+    #define RL_STRINGIFY(x) #x
+    #define RL_TOSTRING(x) RL_STRINGIFY(x)
+    #define RL_TEXTURE_SLOT_SAMPLE(n) \
+    "#if TEXTURE_SLOTS > " #n "           \n" \
+    "    else if (slot == " #n ") texelColor = TEXTURE(texture0[" #n "], fragTexCoord); \n" \
+    "#endif                             \n"
+
+    int maxTextureUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+    if (maxTextureUnits < RL_DEFAULT_BATCH_TEXTURE_SLOTS) TRACELOG(RL_LOG_WARNING, "RLGL: Multi-texture batch requires %i texture units, only %i available", RL_DEFAULT_BATCH_TEXTURE_SLOTS, maxTextureUnits);
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "#define TEXTURE texture            \n"
+    "#define FINAL_COLOR finalColor     \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
+    "out vec4 finalColor;               \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#endif
+    "#define TEXTURE_SLOTS " RL_TOSTRING(RL_DEFAULT_BATCH_TEXTURE_SLOTS) " \n"
+    "uniform sampler2D texture0[TEXTURE_SLOTS]; \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    int slot = int(fragTexSlot + 0.5); \n"
+    "    vec4 texelColor = vec4(1.0);   \n"
+    "    if (slot == 0) texelColor = TEXTURE(texture0[0], fragTexCoord); \n"
+    RL_TEXTURE_SLOT_SAMPLE(1) RL_TEXTURE_SLOT_SAMPLE(2) RL_TEXTURE_SLOT_SAMPLE(3)
+    RL_TEXTURE_SLOT_SAMPLE(4) RL_TEXTURE_SLOT_SAMPLE(5) RL_TEXTURE_SLOT_SAMPLE(6) RL_TEXTURE_SLOT_SAMPLE(7)
+    RL_TEXTURE_SLOT_SAMPLE(8) RL_TEXTURE_SLOT_SAMPLE(9) RL_TEXTURE_SLOT_SAMPLE(10) RL_TEXTURE_SLOT_SAMPLE(11)
+    RL_TEXTURE_SLOT_SAMPLE(12) RL_TEXTURE_SLOT_SAMPLE(13) RL_TEXTURE_SLOT_SAMPLE(14) RL_TEXTURE_SLOT_SAMPLE(15)
+    "    FINAL_COLOR = texelColor*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#else
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+#endif  // RLGL_ENABLE_MULTI_TEXTURE_BATCH
+
+    // NOTE: Compiled vertex/fragment shaders are not deleted,
+    // they are kept for re-use as default shaders in case some shader loading fails
+    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // Set texture slots samplers to texture units, texture0[i] samples from unit i
+        int textureUnits[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_TEXTURE_SLOTS; i++) textureUnits[i] = i;
+
+        rlStateUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RL_DEFAULT_BATCH_TEXTURE_SLOTS, textureUnits);
+        rlStateUseProgram(0);
+#endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    // Single pass stereo default vertex shader, eye selected by instance and drawn on its framebuffer half
+    // NOTE: Eye geometry outside its half is clipped by gl_ClipDistance[0], default fragment shader is reused
+    const char *stereoVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    "in float vertexTexSlot;            \n"
+    "out float fragTexSlot;             \n"
+#endif
+    "uniform mat4 mvpStereo[2];         \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    "    fragTexSlot = vertexTexSlot;   \n"
+#endif
+    "    vec4 position = mvpStereo[gl_InstanceID]*vec4(vertexPosition, 1.0); \n"
+    "    float side = float(2*gl_InstanceID - 1); \n"
+    "    gl_ClipDistance[0] = position.w + side*position.x; \n"
+    "    gl_Position = vec4(0.5*(position.x + side*position.w), position.yzw); \n"
+    "}                                  \n";
+
+    unsigned int stereoVShaderId = rlCompileShader(stereoVShaderCode, GL_VERTEX_SHADER);
+    if ((stereoVShaderId > 0) && (RLGL.State.defaultFShaderId > 0))
+    {
+        RLGL.State.stereoShaderId = rlLoadShaderProgram(stereoVShaderId, RLGL.State.defaultFShaderId);
+        glDeleteShader(stereoVShaderId);    // Flagged for deletion, deleted with program
+    }
+
+    if (RLGL.State.stereoShaderId > 0)
+    {
+        RLGL.State.stereoShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.stereoShaderLocs[i] = -1;
+
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.stereoShaderId, "vertexPosition");
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.stereoShaderId, "vertexTexCoord");
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.stereoShaderId, "vertexColor");
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_MATRIX_MVP_STEREO] = glGetUniformLocation(RLGL.State.stereoShaderId, "mvpStereo");
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.stereoShaderId, "colDiffuse");
+        RLGL.State.stereoShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.stereoShaderId, "texture0");
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        int textureUnits[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_TEXTURE_SLOTS; i++) textureUnits[i] = i;
+
+        rlStateUseProgram(RLGL.State.stereoShaderId);
+        glUniform1iv(RLGL.State.stereoShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RL_DEFAULT_BATCH_TEXTURE_SLOTS, textureUnits);
+        rlStateUseProgram(0);
+#endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load default stereo shader, single pass stereo not available");
 #endif
-    return matrix;
 }
 
-// Get internal projection matrix
-Matrix rlGetMatrixProjection(void)
+// Submit a list of draws from currently bound vertex data, one OpenGL draw call by draw
+// NOTE: Quads are drawn using currently bound indices buffer, all draws vertex data is offset by baseVertex,
+// draws are instanced only for single pass stereo (instances = 2)
+static void rlSubmitDrawCalls(const rlDrawCall *draws, int drawCount, int baseVertex, int instances)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    Matrix m;
-    m.m0 = mat[0];
-    m.m1 = mat[1];
-    m.m2 = mat[2];
-    m.m3 = mat[3];
-    m.m4 = mat[4];
-    m.m5 = mat[5];
-    m.m6 = mat[6];
-    m.m7 = mat[7];
-    m.m8 = mat[8];
-    m.m9 = mat[9];
-    m.m10 = mat[10];
-    m.m11 = mat[11];
-    m.m12 = mat[12];
-    m.m13 = mat[13];
-    m.m14 = mat[14];
-    m.m15 = mat[15];
-    return m;
-#else
-    return RLGL.State.projection;
+    for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+    {
+        // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+        rlStateBindTexture(GL_TEXTURE_2D, draws[i].textureId);
+        RLGL.stats.textureBinds++;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // Bind additional draw texture slots, sampled by default shader as texture0[slot]
+        if (draws[i].textureSlotCount > 1)
+        {
+            for (int s = 1; s < draws[i].textureSlotCount; s++)
+            {
+                rlStateActiveTexture(s);
+                rlStateBindTexture(GL_TEXTURE_2D, draws[i].textureSlots[s]);
+                RLGL.stats.textureBinds++;
+            }
+
+            rlStateActiveTexture(0);
+        }
+#endif
+
+        if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES))
+        {
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+            if (instances > 1) glDrawArraysInstanced(draws[i].mode, baseVertex + vertexOffset, draws[i].vertexCount, instances);
+            else
+#endif
+            glDrawArrays(draws[i].mode, baseVertex + vertexOffset, draws[i].vertexCount);
+        }
+        else
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            // We need to define the number of indices to be processed: elementCount*6
+            // NOTE: The final parameter tells the GPU the offset in bytes from the
+            // start of the index buffer to the location of the first index to process
+            GLvoid *indicesOffset = (GLvoid *)(vertexOffset/4*6*sizeof(GLuint));
+    #if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+            if (instances > 1) glDrawElementsInstancedBaseVertex(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, indicesOffset, instances, baseVertex);
+            else
+    #endif
+    #if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+            if (baseVertex > 0) glDrawElementsBaseVertex(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, indicesOffset, baseVertex);
+            else
+    #endif
+            glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, indicesOffset);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            if (RLGL.ExtSupported.elementIndexUint) glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+            else glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
 #endif
+        }
+
+        RLGL.stats.drawCalls++;
+        RLGL.stats.vertexCount += draws[i].vertexCount*instances;
+
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
 }
 
-// Get internal accumulated transform matrix
-Matrix rlGetMatrixTransform(void)
+// Upload quads indices to currently bound element buffer
+// NOTE: Indices are converted to 16-bit if 32-bit indices are not supported (OpenGL ES 2.0)
+static void rlBufferQuadIndices(const unsigned int *indices, int count)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // TODO: Consider possible transform matrices in the RLGL.State.stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = rlMatrixIdentity();
-    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
-    mat = RLGL.State.transform;
-#endif
-    return mat;
+    if (RLGL.ExtSupported.elementIndexUint) glBufferData(GL_ELEMENT_ARRAY_BUFFER, count*sizeof(unsigned int), indices, GL_STATIC_DRAW);
+    else
+    {
+        // NOTE: Without GL_OES_element_index_uint, indexed vertices are limited to 65536 (16384 quads)
+        unsigned short *shortIndices = (unsigned short *)RL_MALLOC(count*sizeof(unsigned short));
+        for (int i = 0; i < count; i++) shortIndices[i] = (unsigned short)indices[i];
+
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count*sizeof(unsigned short), shortIndices, GL_STATIC_DRAW);
+        RL_FREE(shortIndices);
+    }
 }
 
-// Get internal projection matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
+// Upload render batch vertex data range into buffer, orphaning buffer storage if required
+// NOTE: Orphaned storage is released by driver once GPU finishes with it, new storage is returned right away
+static void rlUploadBatchBuffer(unsigned int vboId, const void *data, int size, int capacity, bool orphan)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.projectionStereo[eye];
-#endif
-    return mat;
+    glBindBuffer(GL_ARRAY_BUFFER, vboId);
+    if (orphan) glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+
+    RLGL.stats.bytesUploaded += size;
 }
 
-// Get internal view offset matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
+// Append render batch vertex data and draws to current record
+// NOTE: Draws alignment is recomputed from vertex offsets and record vertex count
+// is kept a multiple of 4 between appends, so quads keep aligned with indices
+static void rlRecordRenderBatch(rlRenderBatch *batch)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.viewOffsetStereo[eye];
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int vertexCount = RLGL.State.vertexCounter;
+    int base = RLGL.Record.vertexCount;
+    int padding = (4 - (base + vertexCount)%4)%4;
+
+    // Grow record vertex arrays if required
+    if ((base + vertexCount + padding) > RLGL.Record.vertexCapacity)
+    {
+        int capacity = (RLGL.Record.vertexCapacity > 0)? RLGL.Record.vertexCapacity : buffer->elementCount*4;
+        while (capacity < (base + vertexCount + padding)) capacity *= 2;
+
+        RLGL.Record.vertices = (float *)RL_REALLOC(RLGL.Record.vertices, capacity*3*sizeof(float));
+        RLGL.Record.texcoords = (float *)RL_REALLOC(RLGL.Record.texcoords, capacity*2*sizeof(float));
+        RLGL.Record.colors = (unsigned char *)RL_REALLOC(RLGL.Record.colors, capacity*4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        RLGL.Record.texslots = (float *)RL_REALLOC(RLGL.Record.texslots, capacity*sizeof(float));
 #endif
-    return mat;
+        RLGL.Record.vertexCapacity = capacity;
+    }
+
+    // Copy vertex data, batch layout could be interleaved
+    for (int i = 0; i < vertexCount; i++)
+    {
+        memcpy(RLGL.Record.vertices + 3*(base + i), buffer->vertices + i*RL_BATCH_POSITION_STRIDE, 3*sizeof(float));
+        memcpy(RLGL.Record.texcoords + 2*(base + i), buffer->texcoords + i*RL_BATCH_TEXCOORD_STRIDE, 2*sizeof(float));
+        memcpy(RLGL.Record.colors + 4*(base + i), buffer->colors + i*RL_BATCH_COLOR_STRIDE, 4*sizeof(unsigned char));
+    }
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    memcpy(RLGL.Record.texslots + base, buffer->texslots, vertexCount*sizeof(float));
+#endif
+
+    // Alignment vertex are never drawn
+    memset(RLGL.Record.vertices + 3*(base + vertexCount), 0, padding*3*sizeof(float));
+    memset(RLGL.Record.texcoords + 2*(base + vertexCount), 0, padding*2*sizeof(float));
+    memset(RLGL.Record.colors + 4*(base + vertexCount), 0, padding*4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    memset(RLGL.Record.texslots + base + vertexCount, 0, padding*sizeof(float));
+#endif
+
+    // Copy draws with vertex data, previous draw alignment covers the gap up to next draw
+    int vertexOffset = 0;       // Draw vertex offset on batch
+    int vertexEnd = 0;          // Last recorded draw vertex end on batch
+
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
+        {
+            if (RLGL.Record.drawCount >= RLGL.Record.drawCapacity)
+            {
+                RLGL.Record.drawCapacity = (RLGL.Record.drawCapacity > 0)? RLGL.Record.drawCapacity*2 : RL_DEFAULT_BATCH_DRAWCALLS;
+                RLGL.Record.draws = (rlDrawCall *)RL_REALLOC(RLGL.Record.draws, RLGL.Record.drawCapacity*sizeof(rlDrawCall));
+            }
+
+            if (RLGL.Record.drawCount > 0) RLGL.Record.draws[RLGL.Record.drawCount - 1].vertexAlignment += (vertexOffset - vertexEnd);
+
+            RLGL.Record.draws[RLGL.Record.drawCount] = batch->draws[i];
+            RLGL.Record.draws[RLGL.Record.drawCount].vertexAlignment = 0;
+            RLGL.Record.drawCount++;
+
+            vertexEnd = vertexOffset + batch->draws[i].vertexCount;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    if (RLGL.Record.drawCount > 0) RLGL.Record.draws[RLGL.Record.drawCount - 1].vertexAlignment += (vertexCount + padding - vertexEnd);
+
+    RLGL.Record.vertexCount = base + vertexCount + padding;
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void rlSetMatrixModelview(Matrix view)
+// Load record batch, CPU only render batch (no GPU buffers)
+static void rlLoadRecordBatch(rlRenderBatch *batch)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.modelview = view;
+    int bufferElements = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+
+    batch->vertexBuffer = (rlVertexBuffer *)RL_CALLOC(1, sizeof(rlVertexBuffer));
+    batch->vertexBuffer[0].elementCount = bufferElements;
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+    batch->vertexBuffer[0].vertices = (float *)RL_CALLOC(bufferElements*4, RL_BATCH_VERTEX_SIZE);
+    batch->vertexBuffer[0].texcoords = batch->vertexBuffer[0].vertices + 3;
+    batch->vertexBuffer[0].colors = (unsigned char *)(batch->vertexBuffer[0].vertices + 5);
+#else
+    batch->vertexBuffer[0].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));
+    batch->vertexBuffer[0].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));
+    batch->vertexBuffer[0].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));
 #endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    batch->vertexBuffer[0].texslots = (float *)RL_CALLOC(bufferElements*4, sizeof(float));
+#endif
+
+    batch->draws = (rlDrawCall *)RL_CALLOC(RL_DEFAULT_BATCH_DRAWCALLS, sizeof(rlDrawCall));
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        batch->draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch->draws[i].textureSlotCount = 1;
+#endif
+    }
+
+    batch->bufferCount = 1;
+    batch->drawCounter = 1;
+    batch->currentDepth = -1.0f;
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void rlSetMatrixProjection(Matrix projection)
+// Unload record batch and recorded vertex data arrays
+static void rlUnloadRecordingData(rlglData *data)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projection = projection;
+    if (data->Record.batch.vertexBuffer != NULL)
+    {
+        RL_FREE(data->Record.batch.vertexBuffer[0].vertices);
+#if !defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+        RL_FREE(data->Record.batch.vertexBuffer[0].texcoords);
+        RL_FREE(data->Record.batch.vertexBuffer[0].colors);
+#endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        RL_FREE(data->Record.batch.vertexBuffer[0].texslots);
+#endif
+        RL_FREE(data->Record.batch.vertexBuffer);
+        RL_FREE(data->Record.batch.draws);
+    }
+
+    RL_FREE(data->Record.vertices);
+    RL_FREE(data->Record.texcoords);
+    RL_FREE(data->Record.colors);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    RL_FREE(data->Record.texslots);
 #endif
+    RL_FREE(data->Record.draws);
 }
 
-// Set eyes projection matrices for stereo rendering
-void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projectionStereo[0] = right;
-    RLGL.State.projectionStereo[1] = left;
-#endif
+// Load or update record GPU buffers with recorded vertex data
+// NOTE: Buffers are created on first call, indices buffer is only updated if more quads are required
+static bool rlUpdateRecordBuffers(rlRecordData *record, const rlglData *data, int usage)
+{
+    int vertexCount = data->Record.vertexCount;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (vertexCount > 65536)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Record vertex count (%i) exceeds 16 bit indices limit", vertexCount);
+        return false;
+    }
+#endif
+
+    bool load = (record->vboId[0] == 0);
+
+    if (load)
+    {
+        if (RLGL.ExtSupported.vao) glGenVertexArrays(1, &record->vaoId);
+        glGenBuffers(4, record->vboId);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        glGenBuffers(1, &record->vboId[4]);
+#endif
+    }
+
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(record->vaoId);
+
+    // Vertex position buffer (shader-location = 0)
+    glBindBuffer(GL_ARRAY_BUFFER, record->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount*3*sizeof(float), data->Record.vertices, usage);
+    if (load)
+    {
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+    }
+
+    // Vertex texcoord buffer (shader-location = 1)
+    glBindBuffer(GL_ARRAY_BUFFER, record->vboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount*2*sizeof(float), data->Record.texcoords, usage);
+    if (load)
+    {
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+    }
+
+    // Vertex color buffer (shader-location = 3)
+    glBindBuffer(GL_ARRAY_BUFFER, record->vboId[2]);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount*4*sizeof(unsigned char), data->Record.colors, usage);
+    if (load)
+    {
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+    }
+
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    // Vertex texture slot buffer (shader-location = 6)
+    glBindBuffer(GL_ARRAY_BUFFER, record->vboId[4]);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(float), data->Record.texslots, usage);
+    if (load)
+    {
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+    }
+#endif
+
+    // Quads indices buffer, recorded vertex count is always a multiple of 4
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, record->vboId[3]);
+
+    if ((vertexCount/4) > record->quadCount)
+    {
+        int quadCount = vertexCount/4;
+        unsigned int *indices = (unsigned int *)RL_MALLOC(quadCount*6*sizeof(unsigned int));
+        for (int j = 0, k = 0; j < (quadCount*6); j += 6, k++)
+        {
+            indices[j] = 4*k;
+            indices[j + 1] = 4*k + 1;
+            indices[j + 2] = 4*k + 2;
+            indices[j + 3] = 4*k;
+            indices[j + 4] = 4*k + 2;
+            indices[j + 5] = 4*k + 3;
+        }
+
+        rlBufferQuadIndices(indices, quadCount*6);
+        RL_FREE(indices);
+
+        record->quadCount = quadCount;
+    }
+
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    record->vertexCount = vertexCount;
+    RLGL.stats.bytesUploaded += vertexCount*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+
+    return true;
 }
 
-// Set eyes view offsets matrices for stereo rendering
-void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+// Unload record GPU buffers
+static void rlUnloadRecordBuffers(rlRecordData *record)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.viewOffsetStereo[0] = right;
-    RLGL.State.viewOffsetStereo[1] = left;
-#endif
+    if (RLGL.ExtSupported.vao && (record->vaoId > 0))
+    {
+        rlStateForgetVertexArray(record->vaoId);
+        glDeleteVertexArrays(1, &record->vaoId);
+    }
+    glDeleteBuffers(5, record->vboId);      // NOTE: Unused buffers ids (0) are silently ignored
+
+    record->vaoId = 0;
+    for (int i = 0; i < 5; i++) record->vboId[i] = 0;
+    record->quadCount = 0;
 }
 
-// Load and draw a quad in NDC
-void rlLoadDrawQuad(void)
+// Draw record GPU buffers using current shader, transform is applied before current modelview
+static void rlDrawRecordData(const rlRecordData *record, const rlDrawCall *draws, int drawCount, Matrix transform)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int quadVAO = 0;
-    unsigned int quadVBO = 0;
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    int *shaderLocs = RLGL.State.currentShaderLocs;
 
-    float vertices[] = {
-         // Positions         Texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
-    };
+    int eyeCount = 1;
+    if (RLGL.State.stereoRender) eyeCount = 2;
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    // Single pass stereo uses stereo version of default shader
+    if ((eyeCount == 2) && RLGL.State.stereoSinglePass && (shaderId == RLGL.State.defaultShaderId) && (RLGL.State.stereoShaderId > 0))
+    {
+        shaderId = RLGL.State.stereoShaderId;
+        shaderLocs = RLGL.State.stereoShaderLocs;
+    }
+#endif
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+    rlStateUseProgram(shaderId);
 
-    // Bind vertex attributes (position, texcoords)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(record->vaoId);
+    else
+    {
+        // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        glBindBuffer(GL_ARRAY_BUFFER, record->vboId[0]);
+        glVertexAttribPointer(shaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(shaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
 
-    // Draw quad
-    glBindVertexArray(quadVAO);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, record->vboId[1]);
+        glVertexAttribPointer(shaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(shaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
 
-    // Delete buffers (VBO and VAO)
-    glDeleteBuffers(1, &quadVBO);
-    glDeleteVertexArrays(1, &quadVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, record->vboId[2]);
+        glVertexAttribPointer(shaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(shaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        glBindBuffer(GL_ARRAY_BUFFER, record->vboId[4]);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
 #endif
-}
 
-// Load and draw a cube in NDC
-void rlLoadDrawCube(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int cubeVAO = 0;
-    unsigned int cubeVBO = 0;
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, record->vboId[3]);
+    }
 
-    float vertices[] = {
-         // Positions          Normals               Texcoords
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
-    };
+    // Setup some default shader values
+    glUniform4f(shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+    rlStateActiveTexture(0);
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+#if defined(RLGL_STEREO_SINGLE_PASS_AVAILABLE)
+    // Single pass stereo, both eyes drawn at once as instances (shader must declare mvpStereo uniform)
+    if ((eyeCount == 2) && RLGL.State.stereoSinglePass && (shaderLocs[RL_SHADER_LOC_MATRIX_MVP_STEREO] != -1))
+    {
+        rlBeginStereoSinglePass(shaderLocs[RL_SHADER_LOC_MATRIX_MVP_STEREO], rlMatrixMultiply(transform, RLGL.State.modelview));
+        rlSubmitDrawCalls(draws, drawCount, 0, 2);
+        rlEndStereoSinglePass();
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        eyeCount = 0;
+    }
+#endif
 
-    // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        Matrix matModelView = RLGL.State.modelview;
+        Matrix matProjection = RLGL.State.projection;
 
-    // Draw cube
-    glBindVertexArray(cubeVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+        if (eyeCount == 2)
+        {
+            // Setup current eye viewport (half screen width), view offset and projection
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            matModelView = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.viewOffsetStereo[eye]);
+            matProjection = RLGL.State.projectionStereo[eye];
+        }
 
-    // Delete VBO and VAO
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteVertexArrays(1, &cubeVAO);
-#endif
-}
+        // Create model-modelview-projection matrix and upload to shader
+        Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(transform, matModelView), matProjection);
+        float matMVPfloat[16] = {
+            matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+            matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+            matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+            matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+        };
+        glUniformMatrix4fv(shaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+
+        rlSubmitDrawCalls(draws, drawCount, 0, 1);
+    }
 
-// Get name string for pixel format
-const char *rlGetPixelFormatName(unsigned int format)
-{
-    switch (format)
+    // Restore viewport to default measures
+    if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+    else
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
-        default: return "UNKNOWN"; break;
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
+
+    rlStateBindTexture(GL_TEXTURE_2D, 0);
+    rlStateUseProgram(0);
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlLoadShaderDefault(void)
+#if defined(RLGL_THREAD_BATCHES_AVAILABLE)
+// Reset thread batch recorded data and copy current rlgl state to it
+// NOTE: Called from rlgl context thread, thread batch keeps recording after it
+static void rlResetThreadBatch(rlThreadBatch *batch)
 {
-    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+    rlglData *data = batch->data;
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+    data->State = RLGL.State;
+    data->ExtSupported = RLGL.ExtSupported;
+    data->State.vertexCounter = 0;
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+    // Current matrix must point to thread batch state matrices
+    if (RLGL.State.currentMatrix == &RLGL.State.projection) data->State.currentMatrix = &data->State.projection;
+    else if (RLGL.State.currentMatrix == &RLGL.State.transform) data->State.currentMatrix = &data->State.transform;
+    else data->State.currentMatrix = &data->State.modelview;
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-    "}                                  \n";
+    data->currentBatch = &data->Record.batch;
+    data->Record.vertexCount = 0;
+    data->Record.drawCount = 0;
+    data->Record.active = true;
+}
 #endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
+
+// Sort render batch draws by (layer, texture, mode) and merge the compatible consecutive ones
+// NOTE: Vertex data is reordered to keep every draw contiguous, vertex alignment is recomputed
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // NOTE: Persistent mapped vertex data lives in GPU memory, reading it back for sorting is not worth it
+    if ((batch->drawCounter < 2) || buffer->persistentMapped) return;
+
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int srcOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawCount = 0;
+    bool sorted = true;
+
+    // Get draws source vertex offsets and sort them (stable insertion sort, submission order kept for equal keys)
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        srcOffset[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+        if (batch->draws[i].vertexCount == 0) continue;     // Empty draws are discarded
+
+        int j = drawCount;
+        rlDrawCall *draw = &batch->draws[i];
+
+        while (j > 0)
+        {
+            rlDrawCall *prev = &batch->draws[order[j - 1]];
+
+            if ((prev->layer < draw->layer) || ((prev->layer == draw->layer) && ((prev->textureId < draw->textureId) ||
+                ((prev->textureId == draw->textureId) && (prev->mode <= draw->mode))))) break;
+
+            order[j] = order[j - 1];
+            j--;
+            sorted = false;
+        }
+
+        order[j] = i;
+        drawCount++;
+    }
+
+    if (sorted) return;
+
+    // Compute vertex count required after reordering, every draw is padded to a multiple of 4 vertex
+    int vertexCount = 0;
+    for (int i = 0; i < drawCount; i++) vertexCount += (batch->draws[order[i]].vertexCount + 3)/4*4;
+
+    // Vertex data arrays to reorder, depending on vertex layout
+    unsigned char *arrays[4] = { 0 };
+    int arraysVertexSize[4] = { 0 };
+    int arrayCount = 0;
+
+#if defined(RLGL_ENABLE_INTERLEAVED_VERTEX_BUFFER)
+    arrays[arrayCount] = (unsigned char *)buffer->vertices; arraysVertexSize[arrayCount] = RL_BATCH_VERTEX_SIZE; arrayCount++;
+#else
+    arrays[arrayCount] = (unsigned char *)buffer->vertices; arraysVertexSize[arrayCount] = 3*sizeof(float); arrayCount++;
+    arrays[arrayCount] = (unsigned char *)buffer->texcoords; arraysVertexSize[arrayCount] = 2*sizeof(float); arrayCount++;
+    arrays[arrayCount] = buffer->colors; arraysVertexSize[arrayCount] = 4*sizeof(unsigned char); arrayCount++;
+#endif
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    arrays[arrayCount] = (unsigned char *)buffer->texslots; arraysVertexSize[arrayCount] = sizeof(float); arrayCount++;
 #endif
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    unsigned char *scratch = (unsigned char *)RL_MALLOC(vertexCount*RL_BATCH_VERTEX_SIZE);
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    if (scratch == NULL) return;    // Keep submission order if memory can not be allocated
 
-    if (RLGL.State.defaultShaderId > 0)
+    // Reorder vertex data arrays
+    for (int a = 0; a < arrayCount; a++)
     {
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+        for (int i = 0, dstOffset = 0; i < drawCount; i++)
+        {
+            rlDrawCall *draw = &batch->draws[order[i]];
 
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+            memcpy(scratch + dstOffset*arraysVertexSize[a], arrays[a] + srcOffset[order[i]]*arraysVertexSize[a], draw->vertexCount*arraysVertexSize[a]);
+            dstOffset += (draw->vertexCount + 3)/4*4;
+        }
 
-        // Set default shader locations: uniform locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+        memcpy(arrays[a], scratch, vertexCount*arraysVertexSize[a]);
     }
-    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+
+    RL_FREE(scratch);
+
+    // Reorder draws, merging consecutive ones sharing state
+    // NOTE: Only draws without alignment vertex can be merged with next one, padding vertex are not valid data
+    rlDrawCall draws[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int mergedCount = 0;
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        rlDrawCall draw = batch->draws[order[i]];
+        rlDrawCall *prev = (mergedCount > 0)? &draws[mergedCount - 1] : NULL;
+
+        bool mergeable = (prev != NULL) && (prev->vertexAlignment == 0) && (prev->layer == draw.layer) &&
+            (prev->textureId == draw.textureId) && (prev->mode == draw.mode);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+        // NOTE: Vertex texture slots are only valid for draws sharing the same texture slots
+        mergeable = mergeable && (prev->textureSlotCount == draw.textureSlotCount) &&
+            (memcmp(prev->textureSlots, draw.textureSlots, draw.textureSlotCount*sizeof(unsigned int)) == 0);
+#endif
+
+        if (mergeable)
+        {
+            prev->vertexCount += draw.vertexCount;
+            prev->vertexAlignment = (draw.vertexCount + 3)/4*4 - draw.vertexCount;
+        }
+        else
+        {
+            draw.vertexAlignment = (draw.vertexCount + 3)/4*4 - draw.vertexCount;
+            draws[mergedCount] = draw;
+            mergedCount++;
+        }
+    }
+
+    for (int i = 0; i < mergedCount; i++) batch->draws[i] = draws[i];
+
+    batch->drawCounter = mergedCount;
+    RLGL.State.vertexCounter = vertexCount;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Wait for GPU to signal a fence sync object, fence is deleted and set to NULL
+// NOTE: Signaled fences return immediately, any actual wait is registered on render statistics
+static void rlWaitFence(void **fence)
+{
+    // NOTE: First wait flushes pending commands, later waits just poll until the fence is signaled
+    GLenum result = glClientWaitSync((GLsync)*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+    if (result == GL_TIMEOUT_EXPIRED) RLGL.stats.bufferWaits++;
+
+    while ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED) && (result != GL_WAIT_FAILED))
+    {
+        result = glClientWaitSync((GLsync)*fence, 0, 1000000);   // 1 ms timeout (nanoseconds)
+    }
+
+    glDeleteSync((GLsync)*fence);
+    *fence = NULL;
+}
+
+// Bind shader program default uniform blocks (if declared) to their binding points
+static void rlBindShaderUniformBlocks(unsigned int program)
+{
+    if (RLGL.ExtSupported.ubo)
+    {
+        unsigned int blockIndex = glGetUniformBlockIndex(program, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME);
+        if (blockIndex != GL_INVALID_INDEX) glUniformBlockBinding(program, blockIndex, RL_UNIFORM_BLOCK_BINDING_FRAME);
+
+        blockIndex = glGetUniformBlockIndex(program, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_DRAW);
+        if (blockIndex != GL_INVALID_INDEX) glUniformBlockBinding(program, blockIndex, RL_UNIFORM_BLOCK_BINDING_DRAW);
+    }
+}
+#endif
+
+#if defined(RLGL_PERSISTENT_MAPPING_AVAILABLE)
+// Wait for GPU to release a vertex buffer ring segment and point vertex arrays to it
+// NOTE: Vertex arrays always point to current segment, mapped ring base is computed from it
+static void rlWaitVertexBufferSegment(rlVertexBuffer *buffer, int segment)
+{
+    if (buffer->segmentFence[segment] != NULL) rlWaitFence(&buffer->segmentFence[segment]);
+
+    int offset = segment - buffer->currentSegment;
+
+    buffer->vertices += offset*buffer->elementCount*4*RL_BATCH_POSITION_STRIDE;
+    buffer->texcoords += offset*buffer->elementCount*4*RL_BATCH_TEXCOORD_STRIDE;
+    buffer->colors += offset*buffer->elementCount*4*RL_BATCH_COLOR_STRIDE;
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    buffer->texslots += offset*buffer->elementCount*4;
+#endif
+    buffer->currentSegment = segment;
 }
+#endif
 
 // Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs (and single pass stereo version)
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlStateUseProgram(0);
+
+    if (RLGL.State.stereoShaderId > 0)
+    {
+        rlStateForgetProgram(RLGL.State.stereoShaderId);
+        glDeleteProgram(RLGL.State.stereoShaderId);
+        RL_FREE(RLGL.State.stereoShaderLocs);
+
+        RLGL.State.stereoShaderId = 0;
+        RLGL.State.stereoShaderLocs = NULL;
+    }
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
 
+    rlStateForgetProgram(RLGL.State.defaultShaderId);
     glDeleteProgram(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
@@ -4572,6 +9205,108 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Bind default attribute locations and link shader program
+static void rlLinkShaderProgram(unsigned int program)
+{
+    // NOTE: Default attribute shader locations must be Bound before linking
+    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+#if defined(RLGL_ENABLE_MULTI_TEXTURE_BATCH)
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+#endif
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Request program binary to be retrievable after linking (shader binaries cache)
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+}
+
+// Check shader compilation status, log compilation errors
+static bool rlCheckShaderCompile(unsigned int shader, int type)
+{
+    GLint success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+        #endif
+            default: break;
+        }
+
+        int maxLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetShaderInfoLog(shader, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+            RL_FREE(log);
+        }
+    }
+    else
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
+        #endif
+            default: break;
+        }
+    }
+
+    return (success == GL_TRUE);
+}
+
+// Check shader program linkage status, log linkage errors
+static bool rlCheckShaderProgramLink(unsigned int program)
+{
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+    }
+
+    return (success == GL_TRUE);
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -4696,6 +9431,178 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+// Get texture data size in bytes, including mipmaps
+static unsigned int rlGetTextureDataSize(int width, int height, int format, int mipmapCount)
+{
+    unsigned int dataSize = 0;
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        dataSize += rlGetPixelDataSize(width, height, format);
+
+        width /= 2;
+        height /= 2;
+
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return dataSize;
+}
+
+// Register GPU allocation on GPU memory usage registry (or update its size if already registered)
+// NOTE: Registry is an open addressing hash table (linear probing) keyed by allocation type and object id
+static void rlTrackGpuMemory(int type, unsigned int id, unsigned int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id == 0) return;
+
+    // Grow registry when 3/4 full, allocations are registered again
+    if ((RLGL.GpuMemory.count + 1)*4 > RLGL.GpuMemory.capacity*3)
+    {
+        rlGpuAllocation *previous = RLGL.GpuMemory.allocations;
+        int previousCapacity = RLGL.GpuMemory.capacity;
+
+        RLGL.GpuMemory.capacity = (previousCapacity > 0)? previousCapacity*2 : 256;
+        RLGL.GpuMemory.allocations = (rlGpuAllocation *)RL_CALLOC(RLGL.GpuMemory.capacity, sizeof(rlGpuAllocation));
+        RLGL.GpuMemory.count = 0;
+        for (int i = 0; i < 5; i++) { RLGL.GpuMemory.usage[i] = 0; RLGL.GpuMemory.objects[i] = 0; }
+
+        for (int i = 0; i < previousCapacity; i++)
+        {
+            if (previous[i].id > 0) rlTrackGpuMemory(previous[i].type, previous[i].id, previous[i].size);
+        }
+
+        RL_FREE(previous);
+    }
+
+    unsigned int mask = RLGL.GpuMemory.capacity - 1;
+    unsigned int index = ((id*2654435761u) ^ (unsigned int)type) & mask;
+
+    while (RLGL.GpuMemory.allocations[index].id > 0)
+    {
+        rlGpuAllocation *allocation = &RLGL.GpuMemory.allocations[index];
+
+        if ((allocation->id == id) && (allocation->type == type))
+        {
+            // Allocation already registered, update its size (i.e. mipmaps generated)
+            RLGL.GpuMemory.usage[type] += size;
+            RLGL.GpuMemory.usage[type] -= allocation->size;
+            allocation->size = size;
+            return;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    RLGL.GpuMemory.allocations[index] = (rlGpuAllocation){ id, type, size };
+    RLGL.GpuMemory.usage[type] += size;
+    RLGL.GpuMemory.objects[type]++;
+    RLGL.GpuMemory.count++;
+#endif
+}
+
+// Remove GPU allocation from GPU memory usage registry
+// NOTE: Following entries of the probing sequence are moved back, so no removed entries markers are required
+static void rlUntrackGpuMemory(int type, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (RLGL.GpuMemory.capacity == 0)) return;
+
+    unsigned int mask = RLGL.GpuMemory.capacity - 1;
+    unsigned int index = ((id*2654435761u) ^ (unsigned int)type) & mask;
+
+    while (RLGL.GpuMemory.allocations[index].id > 0)
+    {
+        rlGpuAllocation *allocation = &RLGL.GpuMemory.allocations[index];
+
+        if ((allocation->id == id) && (allocation->type == type))
+        {
+            RLGL.GpuMemory.usage[type] -= allocation->size;
+            RLGL.GpuMemory.objects[type]--;
+            RLGL.GpuMemory.count--;
+
+            // Move back following entries that can not be found anymore over the free entry
+            unsigned int empty = index;
+            unsigned int next = (index + 1) & mask;
+
+            while (RLGL.GpuMemory.allocations[next].id > 0)
+            {
+                rlGpuAllocation *entry = &RLGL.GpuMemory.allocations[next];
+                unsigned int home = ((entry->id*2654435761u) ^ (unsigned int)entry->type) & mask;
+
+                // Entry can be moved if its home slot is not cyclically in (empty, next]
+                if (((next - home) & mask) >= ((next - empty) & mask))
+                {
+                    RLGL.GpuMemory.allocations[empty] = *entry;
+                    empty = next;
+                }
+
+                next = (next + 1) & mask;
+            }
+
+            RLGL.GpuMemory.allocations[empty].id = 0;
+            return;
+        }
+
+        index = (index + 1) & mask;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Get GPU allocation registered size (0 if not registered)
+// NOTE: Only required by rlUpdateTextureLevel() (OpenGL 3.3+)
+static unsigned int rlGetTrackedGpuMemory(int type, unsigned int id)
+{
+    if ((id == 0) || (RLGL.GpuMemory.capacity == 0)) return 0;
+
+    unsigned int mask = RLGL.GpuMemory.capacity - 1;
+    unsigned int index = ((id*2654435761u) ^ (unsigned int)type) & mask;
+
+    while (RLGL.GpuMemory.allocations[index].id > 0)
+    {
+        if ((RLGL.GpuMemory.allocations[index].id == id) && (RLGL.GpuMemory.allocations[index].type == type)) return RLGL.GpuMemory.allocations[index].size;
+
+        index = (index + 1) & mask;
+    }
+
+    return 0;
+}
+#endif
+
+#if !defined(GRAPHICS_API_OPENGL_11)
+// Load bound texture mipmap level data (format supported)
+static void rlLoadTextureLevel(int level, int width, int height, int format, const void *data)
+{
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat == -1) return;
+
+    if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, level, glInternalFormat, width, height, 0, glFormat, glType, data);
+    else glCompressedTexImage2D(GL_TEXTURE_2D, level, glInternalFormat, width, height, 0, rlGetPixelDataSize(width, height, format), data);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+    else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+#if defined(GRAPHICS_API_OPENGL_21)
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+#endif
+}
+#endif
+
 // Auxiliar math functions
 
 // Get identity matrix
@@ -4737,4 +9644,67 @@ static Matrix rlMatrixMultiply(Matrix left, Matrix right)
     return result;
 }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Transform one point by matrix
+// NOTE: SIMD versions keep scalar operations order, results are the same
+static void rlTransformPoint(const Matrix *mat, float *x, float *y, float *z)
+{
+#if defined(RLGL_SIMD_SSE2)
+    __m128 result = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_setr_ps(mat->m0, mat->m1, mat->m2, 0.0f), _mm_set1_ps(*x)),
+        _mm_mul_ps(_mm_setr_ps(mat->m4, mat->m5, mat->m6, 0.0f), _mm_set1_ps(*y))),
+        _mm_mul_ps(_mm_setr_ps(mat->m8, mat->m9, mat->m10, 0.0f), _mm_set1_ps(*z))),
+        _mm_setr_ps(mat->m12, mat->m13, mat->m14, 0.0f));
+
+    float out[4];
+    _mm_storeu_ps(out, result);
+#elif defined(RLGL_SIMD_NEON)
+    float32x4_t col0 = { mat->m0, mat->m1, mat->m2, 0.0f };
+    float32x4_t col1 = { mat->m4, mat->m5, mat->m6, 0.0f };
+    float32x4_t col2 = { mat->m8, mat->m9, mat->m10, 0.0f };
+    float32x4_t col3 = { mat->m12, mat->m13, mat->m14, 0.0f };
+
+    // NOTE: Not using fused multiply-add (vfmaq_f32), it would change results
+    float32x4_t result = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(col0, *x), vmulq_n_f32(col1, *y)), vmulq_n_f32(col2, *z)), col3);
+
+    float out[4];
+    vst1q_f32(out, result);
+#else
+    float out[3] = {
+        mat->m0*(*x) + mat->m4*(*y) + mat->m8*(*z) + mat->m12,
+        mat->m1*(*x) + mat->m5*(*y) + mat->m9*(*z) + mat->m13,
+        mat->m2*(*x) + mat->m6*(*y) + mat->m10*(*z) + mat->m14
+    };
+#endif
+
+    *x = out[0];
+    *y = out[1];
+    *z = out[2];
+}
+
+// Transform four points by matrix, points provided as arrays of 4 components
+static void rlTransformPoints4(const Matrix *mat, float *x, float *y, float *z)
+{
+#if defined(RLGL_SIMD_SSE2)
+    __m128 vx = _mm_loadu_ps(x);
+    __m128 vy = _mm_loadu_ps(y);
+    __m128 vz = _mm_loadu_ps(z);
+
+    _mm_storeu_ps(x, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat->m0), vx), _mm_mul_ps(_mm_set1_ps(mat->m4), vy)), _mm_mul_ps(_mm_set1_ps(mat->m8), vz)), _mm_set1_ps(mat->m12)));
+    _mm_storeu_ps(y, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat->m1), vx), _mm_mul_ps(_mm_set1_ps(mat->m5), vy)), _mm_mul_ps(_mm_set1_ps(mat->m9), vz)), _mm_set1_ps(mat->m13)));
+    _mm_storeu_ps(z, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(mat->m2), vx), _mm_mul_ps(_mm_set1_ps(mat->m6), vy)), _mm_mul_ps(_mm_set1_ps(mat->m10), vz)), _mm_set1_ps(mat->m14)));
+#elif defined(RLGL_SIMD_NEON)
+    float32x4_t vx = vld1q_f32(x);
+    float32x4_t vy = vld1q_f32(y);
+    float32x4_t vz = vld1q_f32(z);
+
+    vst1q_f32(x, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(vx, mat->m0), vmulq_n_f32(vy, mat->m4)), vmulq_n_f32(vz, mat->m8)), vdupq_n_f32(mat->m12)));
+    vst1q_f32(y, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(vx, mat->m1), vmulq_n_f32(vy, mat->m5)), vmulq_n_f32(vz, mat->m9)), vdupq_n_f32(mat->m13)));
+    vst1q_f32(z, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(vx, mat->m2), vmulq_n_f32(vy, mat->m6)), vmulq_n_f32(vz, mat->m10)), vdupq_n_f32(mat->m14)));
+#else
+    for (int i = 0; i < 4; i++) rlTransformPoint(mat, &x[i], &y[i], &z[i]);
+#endif
+}
+#endif
+
 #endif  // RLGL_IMPLEMENTATION
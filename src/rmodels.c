@@ -19,6 +19,30 @@
 *       Support procedural mesh generation functions, uses external par_shapes.h library
 *       NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*   #define SUPPORT_SIMD_SKINNING
+*       Use SSE2/NEON instructions for CPU mesh skinning (UpdateModelAnimation()) and IQM animations frames channels
+*       dequantization (LoadModelAnimations()), scalar fallback if not available
+*
+*   #define SUPPORT_SIMD_COLLISION
+*       Use SSE2/NEON instructions for batched collision tests (GetRayCollisionTriangles(), GetRayCollisionBoxes(),
+*       CheckCollisionBoxesBatch()), scalar fallback if not available
+*
+*   #define SUPPORT_GLTF_ANIMATION_KEYFRAMES
+*       Store glTF animations channels keyframes instead of fixed rate (60 fps) frames, reduces animations memory,
+*       frames are not evenly spaced in time, UpdateModelAnimationEx() should be used to sample them by time
+*
+*   #define SUPPORT_MESH_OPTIMIZATION
+*       Optimize loaded models meshes before uploading to GPU (OptimizeMesh()): vertices deduplication,
+*       triangles reordering for vertex cache and overdraw, vertices reordering for fetch locality
+*
+*   #define SUPPORT_SHAPES_MESH_CACHE
+*       Draw 3d shapes (DrawCube(), DrawSphereEx(), DrawCylinder(), DrawCapsule()...) as instances of cached unit meshes
+*       resident on GPU instead of tessellating them into render batch, consecutive same shapes are drawn instanced
+*
+*   #define SUPPORT_MODEL_TEXTURE_CACHE
+*       Share models materials textures loaded from same image (OBJ/MTL, glTF, M3D loaders) through a reference counted
+*       cache keyed by image path, images already cached are not decoded again, UnloadModel() releases references
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -50,14 +74,36 @@
 
 #if defined(SUPPORT_MODULE_RMODELS)
 
+#define MEMORY_MODULE MEMORY_MODULE_MODELS  // Memory tracking module (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: TRACELOG(), LoadFileData(), LoadFileText(), SaveFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#if defined(SUPPORT_SIMD_RAYMATH)
+    #define RAYMATH_SIMD            // Use SIMD instructions for raymath hot functions
+#endif
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
 
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
+#include <stdarg.h>         // Required for: va_list, va_start(), va_end() [Used in SetTextureCacheKey()]
+
+// SIMD CPU mesh skinning (UpdateModelAnimation()) and batched collision tests, scalar fallback if not available
+#if defined(SUPPORT_SIMD_SKINNING) || defined(SUPPORT_SIMD_COLLISION)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RMODELS_SIMD_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RMODELS_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
+
+// 3d shapes drawn as cached unit meshes instances, requires programmable pipeline
+#if defined(SUPPORT_SHAPES_MESH_CACHE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define RMODELS_SHAPES_CACHE
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -83,6 +129,7 @@
     #define VOX_REALLOC RL_REALLOC
     #define VOX_FREE RL_FREE
 
+    #define VOX_LOADER_NO_MESH          // Mesh generated by LoadVOX(), greedy meshing
     #define VOX_LOADER_IMPLEMENTATION
     #include "external/vox_loader.h"    // VOX file format loading (MagikaVoxel)
 #endif
@@ -132,43 +179,604 @@
     #define MAX_MATERIAL_MAPS       12    // Maximum number of maps supported
 #endif
 #ifndef MAX_MESH_VERTEX_BUFFERS
-    #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
+    #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
+#endif
+#ifndef MAX_MESH_BONE_MATRICES
+    #define MAX_MESH_BONE_MATRICES  64    // Maximum bones matrices for GPU skinning, models with more bones use CPU skinning
+#endif
+#ifndef MESH_DYNAMIC_BUFFERS
+    #define MESH_DYNAMIC_BUFFERS     7    // Dynamic mesh buffers with dirty ranges: vertex attributes (0..5) and indices (6)
+#endif
+#ifndef MAX_MESH_MORPH_TARGETS
+    #define MAX_MESH_MORPH_TARGETS  64    // Maximum morph targets for GPU morphing, meshes with more targets are morphed on CPU
+#endif
+
+#define MODEL_ANIMATION_FRAME_TIME  (1.0f/60.0f)    // Animation frame time for animations without frames time
+
+// Compressed animation bone tracks flags, varying tracks are stored by frame
+#define ANIMATION_TRACK_TRANSLATION     1   // Bone translation varies by frame (3 x 16bit, quantized in track range)
+#define ANIMATION_TRACK_ROTATION        2   // Bone rotation varies by frame (3 x 16bit, smallest three components)
+#define ANIMATION_TRACK_SCALE           4   // Bone scale varies by frame (3 x 16bit, quantized in track range)
+#define ANIMATION_TRACK_TOLERANCE       0.00001f    // Bone track values range considered constant (first frame value kept)
+#define ANIMATION_QUATERNION_RANGE      1.41421356f // Smallest three quaternion components range scale (sqrt(2))
+#define GLTF_MEM_ARENA_BLOCK_SIZE   65536   // glTF parse data memory arena block size (bytes)
+
+#define MESH_BVH_BINS               16      // Mesh BVH build surface area heuristic bins per axis
+#define MESH_BVH_MAX_DEPTH          64      // Mesh BVH maximum depth, deeper nodes are leaves
+#define MESH_BVH_TRAVERSAL_COST     1.0f    // Mesh BVH node traversal cost, relative to ray-triangle test cost
+
+#ifndef MAX_TERRAIN_CHUNK_REQUESTS
+    #define MAX_TERRAIN_CHUNK_REQUESTS  8       // Maximum terrain chunks meshes generated concurrently (async load requests)
+#endif
+#ifndef MAX_LIGHTS_PER_CLUSTER
+    #define MAX_LIGHTS_PER_CLUSTER      64      // Maximum lights affecting a light cluster (clustered lighting), exceeding lights are ignored
+#endif
+#define TERRAIN_MAX_CHUNK_SIZE      128     // Terrain chunk maximum size (quads per side), vertices fit 16bit indices
+#define TERRAIN_MAX_LOD_LEVELS      8       // Terrain maximum LOD levels
+
+#ifndef MESH_OPTIMIZE_CACHE_SIZE
+    #define MESH_OPTIMIZE_CACHE_SIZE    16      // Post-transform vertex cache size (FIFO) for triangles reordering
+#endif
+#define MESH_OPTIMIZE_OVERDRAW_THRESHOLD 1.05f  // Overdraw clusters vertex cache miss ratio limit, relative to mesh ratio
+#define MESH_OPTIMIZE_ATTRIBUTES    12      // Mesh vertex attributes arrays remapped by optimization
+
+#define MESH_LOD_MAX_LEVELS         8       // Mesh maximum LOD levels (including level 0)
+#define MESH_LOD_BORDER_WEIGHT      10.0f   // Mesh simplification borders quadrics weight, relative to faces quadrics
+#define MESH_LOD_MIN_REDUCTION      0.9f    // Mesh LOD level maximum triangles ratio to previous level, levels generation stops otherwise
+#ifndef MESH_LOD_PIXEL_ERROR
+    #define MESH_LOD_PIXEL_ERROR    1.0f    // Mesh LOD level maximum projected simplification error (pixels), DrawModelLOD()
 #endif
 
+#define MESH_MORPH_TEXTURE_TILE     128     // Mesh morph targets texture tile width (texels), one tile by target, two texels by vertex
+#define MESH_MORPH_TEXTURE_SLOT     (MAX_MATERIAL_MAPS + 1)     // Mesh morph targets texture slot (after shadow map slot)
+
+#define SHADOW_MAX_CASCADES         4       // Shadow map maximum cascades (directional light)
+#define SHADOW_CASCADE_MARGIN       16      // Shadow map cascade margin (texels), cascade origin lags inside margin
+#define SHADOW_CASCADE_SPLIT_LAMBDA 0.75f   // Shadow map cascades splits logarithmic distribution weight (uniform otherwise)
+#define SHADOW_MAP_TEXTURE_SLOT     MAX_MATERIAL_MAPS   // Shadow map depth texture slot, SetShaderShadowMap()
+
+#define LIGHT_CLUSTERS_TILES_X      16      // Light clusters screen tiles horizontally
+#define LIGHT_CLUSTERS_TILES_Y      9       // Light clusters screen tiles vertically
+#define LIGHT_CLUSTERS_SLICES       24      // Light clusters depth slices (exponential distribution)
+#define LIGHT_CLUSTERS_TEXTURE_WIDTH 1024   // Light clusters data texture width (texels)
+#define LIGHT_CLUSTERS_TEXTURE_SLOT (MAX_MATERIAL_MAPS + 2)     // Lights data texture slot, clusters data texture uses next slot
+
+#define SHAPE_MESH_CUBE             0       // Shape unit mesh: cube (DrawCube())
+#define SHAPE_MESH_CUBE_WIRES       1       // Shape unit mesh: cube wires (DrawCubeWires())
+#define SHAPE_MESH_SPHERE           2       // Shape unit mesh: sphere rings and slices (DrawSphereEx())
+#define SHAPE_MESH_SPHERE_WIRES     3       // Shape unit mesh: sphere wires rings and slices (DrawSphereWires())
+#define SHAPE_MESH_CYLINDER         4       // Shape unit mesh: cylinder sides, radii relative to largest radius (DrawCylinder())
+#define SHAPE_MESH_CYLINDER_WIRES   5       // Shape unit mesh: cylinder wires sides and radii (DrawCylinderWires())
+#define SHAPE_MESH_CYLINDER_EX      6       // Shape unit mesh: cylinder between two points sides and radii (DrawCylinderEx())
+#define SHAPE_MESH_CYLINDER_EX_WIRES 7      // Shape unit mesh: cylinder wires between two points (DrawCylinderWiresEx())
+#define SHAPE_MESH_CAPSULE_CAP      8       // Shape unit mesh: capsule end sphere cap rings and slices (DrawCapsule())
+#define SHAPE_MESH_CAPSULE_CAP_FLIPPED 9    // Shape unit mesh: capsule start sphere cap, reflected transform (winding reversed)
+#define SHAPE_MESH_CAPSULE_BODY     10      // Shape unit mesh: capsule body slices
+#define SHAPES_CACHE_MAX_MESHES     64      // Shapes unit meshes cached, shapes with other parameters are tessellated every draw
+#define SHAPES_MAX_PENDING_INSTANCES 16384  // Shapes instances pending drawing, drawn when limit is reached
+
+#define BILLBOARD_INSTANCE_FLOATS   12      // Billboards batch instance data: position and rotation, source, size and tint (as float)
+#define PARTICLES_GROUP_SIZE        64      // Particles compute shaders local group size (particles per work group)
+
+#define MESH_PACKED_TEXCOORDS_UNORM     0x0100  // Mesh texcoords packed as unorm16 (packFlags internal bit)
+#define MESH_PACKED_TEXCOORDS_HALF      0x0200  // Mesh texcoords packed as half-float (packFlags internal bit)
+#define MESH_PACKED_TEXCOORDS2_UNORM    0x0400  // Mesh texcoords2 packed as unorm16 (packFlags internal bit)
+#define MESH_PACKED_TEXCOORDS2_HALF     0x0800  // Mesh texcoords2 packed as half-float (packFlags internal bit)
+
+#define MODEL_BINARY_VERSION        1       // Model binary file format version (.rlm)
+#define MODEL_BINARY_ALIGNMENT      16      // Model binary file data blocks alignment (bytes)
+#define MODEL_BINARY_MESH_STREAMS   9       // Model binary mesh data blocks: 8 vertex attributes and indices
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh skinning job data, vertices of all model meshes processed in parallel (UpdateModelAnimation())
+typedef struct MeshSkinningJob {
+    Model *model;                   // Model to skin (meshes animated vertices and normals updated)
+    const Matrix *boneMatrices;     // Bones matrices for animation frame (ComputeBoneMatrices())
+    const int *meshOffsets;         // Meshes first vertex in job items, meshes not skinned have no items (meshCount + 1)
+} MeshSkinningJob;
+
+// Procedural mesh generation writer, vertex data written directly into mesh arrays (indexed)
+typedef struct MeshGenWriter {
+    Mesh *mesh;                     // Mesh to write (arrays are NULL on counting pass)
+    int vertexCount;                // Vertices written (or counted)
+    int indexCount;                 // Indices written (or counted), degenerate triangles are not written
+    unsigned int *wideIndices;      // Indices if vertices exceed 16bit indices (triangles expanded when finished)
+} MeshGenWriter;
+
+// Procedural meshes generation job data, meshes vertex data generated in parallel (GenMeshes())
+typedef struct MeshGenJob {
+    Mesh *meshes;                   // Meshes to generate (vertex data, not uploaded)
+    const MeshGenParams *params;    // Meshes shapes parameters
+} MeshGenJob;
+
+// Mesh tangents generation job data, triangles corners and vertices processed in parallel (GenMeshTangents())
+typedef struct MeshTangentsJob {
+    const Mesh *mesh;               // Mesh to compute tangents (tangents updated)
+    Vector3 *cornerTangents;        // Triangles corners tangents, weighted by corner angle (triangleCount*3)
+    Vector3 *cornerBitangents;      // Triangles corners bitangents, weighted by corner angle (triangleCount*3)
+    int *corners;                   // Triangles corners grouped by welded vertex (triangleCount*3)
+    int *cornerOffsets;             // Welded vertices first corner in corners (vertexCount + 1)
+    int *welds;                     // Vertices welded vertex, first vertex with same position, normal and texcoords (vertexCount)
+} MeshTangentsJob;
+
+// Compressed animation bone tracks, constant tracks keep the value of first frame
+typedef struct AnimationBoneTrack {
+    unsigned int flags;             // Bone varying tracks (ANIMATION_TRACK_*)
+    unsigned int offset;            // Bone varying tracks offset in frame data (16bit values)
+    Transform pose;                 // Bone pose for constant tracks
+    Vector3 translationMin;         // Translation track range minimum
+    Vector3 translationStep;        // Translation track quantization step (range/65535)
+    Vector3 scaleMin;               // Scale track range minimum
+    Vector3 scaleStep;              // Scale track quantization step (range/65535)
+} AnimationBoneTrack;
+
+// Compressed animation data header
+// NOTE: Single allocation: header, bones tracks (boneCount) and frames data (frameCount*frameStride)
+typedef struct AnimationCompressed {
+    int boneCount;                  // Number of bones tracks
+    int frameStride;                // Frame data size (16bit values), all varying tracks of all bones
+} AnimationCompressed;
+
+// Mesh triangles cluster for overdraw optimization, clusters are sorted by key
+typedef struct MeshTriangleCluster {
+    float sortKey;                  // Cluster facing outwards from mesh center (centroid offset along normal)
+    int start;                      // Cluster first triangle
+    int end;                        // Cluster last triangle (exclusive)
+    Vector3 centroid;               // Cluster centroid (area weighted)
+    Vector3 normal;                 // Cluster average normal (area weighted)
+} MeshTriangleCluster;
+
+// Mesh simplification quadric, error at point p: p'Ap + 2b'p + c (A symmetric)
+typedef struct MeshQuadric {
+    float a00, a11, a22;            // Quadric matrix A diagonal
+    float a10, a20, a21;            // Quadric matrix A lower triangle
+    float b0, b1, b2;               // Quadric vector b
+    float c;                        // Quadric constant
+    float w;                        // Quadric accumulated weight (planes area)
+} MeshQuadric;
+
+// Mesh simplification edge, position groups pair (a < b) of a triangle
+typedef struct MeshEdge {
+    int a;                          // Edge first position group
+    int b;                          // Edge second position group
+    int triangle;                   // Edge triangle
+} MeshEdge;
+
+// Mesh simplification edge collapse, source position group collapsed into target position group
+typedef struct MeshCollapse {
+    float error;                    // Collapse error (squared distance, relative to mesh size)
+    int source;                     // Collapse source position group
+    int target;                     // Collapse target position group
+} MeshCollapse;
+
+// Mesh simplification data, vertices sharing position (i.e. attributes seams) are collapsed together
+// NOTE: Position groups are identified by group first vertex, quadrics are stored by group
+typedef struct MeshSimplifyData {
+    int vertexCount;                // Mesh vertex count
+    Vector3 *points;                // Vertices positions, relative to mesh bounds (centered, unit size)
+    int *group;                     // Vertices position group
+    int *groupNext;                 // Vertices next vertex in position group (circular list)
+    MeshQuadric *quadrics;          // Position groups quadrics
+    int *remap;                     // Vertices collapse target, simplification pass
+    bool *locked;                   // Position groups locked, simplification pass
+    int *adjacencyStart;            // Vertices first adjacent triangle (vertexCount + 1)
+    int *adjacency;                 // Vertices adjacent triangles
+    MeshCollapse *collapses;        // Edge collapses candidates
+} MeshSimplifyData;
+
+// Model binary file header (.rlm)
+// NOTE: File layout: [header][meshes][materials][materials maps][textures][animations][data blocks], little-endian,
+// data blocks (vertex streams, indices, pixels, bones, poses) offsets from file start, aligned to MODEL_BINARY_ALIGNMENT
+typedef struct ModelBinaryHeader {
+    char id[4];                     // File identifier: "rMDL"
+    unsigned int version;           // File version: MODEL_BINARY_VERSION
+    unsigned int fileSize;          // File size in bytes
+    int meshCount;                  // Number of meshes
+    int materialCount;              // Number of materials
+    int mapCount;                   // Number of maps by material
+    int textureCount;               // Number of textures (pixel data stored)
+    int boneCount;                  // Number of bones
+    int animationCount;             // Number of animations
+    unsigned int bones;             // Bones information data block (BoneInfo)
+    unsigned int bindPose;          // Bones base transformation data block (Transform)
+    Matrix transform;               // Model local transform matrix
+} ModelBinaryHeader;
+
+// Model binary file mesh
+typedef struct ModelBinaryMesh {
+    int vertexCount;                // Number of vertices
+    int triangleCount;              // Number of triangles
+    int material;                   // Mesh material index
+    unsigned int streams[MODEL_BINARY_MESH_STREAMS];  // Data blocks (0 if not available): vertices, texcoords, texcoords2, normals, tangents, colors, boneIds, boneWeights, indices
+} ModelBinaryMesh;
+
+// Model binary file material map
+typedef struct ModelBinaryMap {
+    int texture;                    // Texture index (-1: material default texture)
+    Color color;                    // Map color
+    float value;                    // Map value
+} ModelBinaryMap;
+
+// Model binary file texture
+typedef struct ModelBinaryTexture {
+    int width;                      // Texture width
+    int height;                     // Texture height
+    int mipmaps;                    // Mipmap levels (generated on loading)
+    int format;                     // Pixel data format (PixelFormat type)
+    unsigned int data;              // Pixel data block (base level)
+} ModelBinaryTexture;
+
+// Model binary file animation
+typedef struct ModelBinaryAnimation {
+    int boneCount;                  // Number of bones
+    int frameCount;                 // Number of frames
+    unsigned int bones;             // Bones information data block (BoneInfo)
+    unsigned int poses;             // Frames poses data block (Transform, frameCount*boneCount)
+    unsigned int frameTimes;        // Frames times data block (0 if fixed rate frames)
+} ModelBinaryAnimation;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// glTF model data loaded on CPU, materials textures pending upload
+typedef struct GLTFModelData {
+    Model model;                    // Model data, materials textures not loaded
+    Image *images;                  // Decoded images, indexed as glTF images
+    int imageCount;                 // Number of glTF images
+    int *mapImages;                 // Materials maps image index (-1: no image), MAX_MATERIAL_MAPS per material
+    char *imageKeys;                // Images textures cache keys, MAX_FILEPATH_LENGTH per image
+} GLTFModelData;
+
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_M3D)
+// Animation frames decoding job data (IQM, M3D), frames decoded in parallel
+// NOTE: IQM poses channels follow Transform fields order: translation (3), rotation (4), scale (3)
+typedef struct AnimationFramesJob {
+    ModelAnimation *anim;           // Animation decoded, frames poses allocated
+    const unsigned short *frameData;    // IQM animation frames channels data, from animation first frame
+    int channelCount;               // IQM frames channels count
+    const float *channelOffsets;    // IQM poses channels offsets (10 per pose)
+    const float *channelScales;     // IQM poses channels scales (10 per pose), zero for channels not animated
+    const int *channelIndices;      // IQM poses channels index in frame channels data (10 per pose)
+} AnimationFramesJob;
+#endif
+
+// Model texture cache entry, materials textures shared by models loaders
+typedef struct ModelTextureCacheEntry {
+    char key[MAX_FILEPATH_LENGTH];  // Texture image key: file path, embedded images keyed by model file name and image
+    unsigned int hash;              // Texture image key hash (FNV-1a)
+    Texture2D texture;              // Texture loaded
+    int refCount;                   // Materials maps referencing texture
+} ModelTextureCacheEntry;
+
+// glTF parallel loading job data
+// NOTE: cgltf data is read-only for jobs, every item writes its own image or mesh
+typedef struct GLTFLoadJob {
+    const cgltf_data *data;         // glTF parsed data
+    const char *fileName;           // glTF file name
+    const char *texPath;            // Images directory path
+    int *imageIndices;              // Images to decode, glTF images indices
+    Image *images;                  // Decoded images, indexed as glTF images
+    cgltf_primitive **primitives;   // Triangles primitives, indexed as model meshes
+    cgltf_node **nodes;             // Primitives mesh node (NULL if not referenced)
+    Mesh *meshes;                   // Model meshes
+    int *meshMaterial;              // Model meshes material index
+} GLTFLoadJob;
+#endif
+
+// Model async load request data
+typedef struct ModelAsyncLoad {
+    char *fileName;                 // Model file name
+    Model model;                    // Loaded model (main thread)
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    GLTFModelData gltf;             // glTF model data, decoded on loader thread
+#endif
+    bool decoded;                   // Model data decoded on loader thread
+} ModelAsyncLoad;
+
+// Terrain chunk mesh async generation request data
+// NOTE: Terrain heights are shared read-only with loader thread, terrain waits pending requests on unloading
+typedef struct TerrainChunkAsyncLoad {
+    const unsigned short *heights;  // Terrain heightmap samples
+    int width;                      // Terrain heightmap width
+    int height;                     // Terrain heightmap height
+    Vector3 size;                   // Terrain size
+    int x;                          // Chunk first sample X
+    int z;                          // Chunk first sample Z
+    int quadsX;                     // Chunk quads along X
+    int quadsZ;                     // Chunk quads along Z
+    int lod;                        // Chunk mesh LOD level
+    int lodCount;                   // Terrain LOD levels, skirts cover cracks between any levels
+    Mesh mesh;                      // Generated chunk mesh
+} TerrainChunkAsyncLoad;
+
+// Mesh draw queued by DrawMesh() between BeginMeshQueue() and EndMeshQueue()
+typedef struct MeshQueueEntry {
+    Mesh mesh;                      // Mesh to draw
+    Material material;              // Mesh material (maps are read on EndMeshQueue())
+    Color color;                    // Material diffuse color when queued (DrawModel() tint)
+    Matrix transform;               // Mesh transform (includes packed positions and rlgl internal transforms)
+} MeshQueueEntry;
+
+#if defined(RMODELS_SHAPES_CACHE)
+// Shape unit mesh cached on GPU, 3d shapes are drawn as its instances
+typedef struct ShapeMesh {
+    int type;                       // Shape type (SHAPE_MESH_*)
+    int rings;                      // Shape rings (sphere and capsule caps)
+    int slices;                     // Shape slices or sides
+    float radiusTop;                // Cylinder top radius, relative to largest radius
+    float radiusBottom;             // Cylinder bottom radius, relative to largest radius
+    bool lines;                     // Mesh vertices are lines vertex pairs (wires shapes)
+    int vertexCount;                // Mesh vertex count, not indexed
+    unsigned int vaoId;             // Vertex array object id (0 if not supported)
+    unsigned int vboId;             // Vertex positions buffer id
+} ShapeMesh;
+
+// Shape mesh instances draw pending, consecutive shapes with same mesh are added to same draw
+typedef struct ShapeMeshDraw {
+    int mesh;                       // Shape mesh index in shapes cache
+    int first;                      // First instance in instances buffer (set on drawing)
+    int count;                      // Instances count
+    bool opaque;                    // All instances colors are opaque, multiple meshes shapes (capsules) can be merged
+} ShapeMeshDraw;
+
+// Shape mesh instance pending drawing
+typedef struct ShapeMeshInstance {
+    float16 transform;              // Instance transform (includes rlgl internal transform)
+    Color color;                    // Instance color
+    int draw;                       // Instance draw index
+} ShapeMeshInstance;
+#endif
+
+// Billboards batch sort key, view depth of billboard (DrawBillboardsBatch())
+typedef struct BillboardSortKey {
+    float depth;                    // Billboard view depth (along camera forward)
+    int index;                      // Billboard index in batch items
+} BillboardSortKey;
+
+// Billboards batch sorting job data, keys computed and sorted by chunks in parallel
+typedef struct BillboardsSortJob {
+    const BillboardInstance *items; // Billboards batch items
+    BillboardSortKey *keys;         // Billboards sort keys (count)
+    int count;                      // Billboards count
+    int chunkSize;                  // Billboards sorted by job item (chunk)
+    Vector3 position;               // Camera position
+    Vector3 forward;                // Camera forward direction
+} BillboardsSortJob;
+
+// Particle state, simulated on GPU (std430 layout, two vec4) or on CPU
+typedef struct ParticleState {
+    Vector3 position;               // Particle position
+    float age;                      // Particle age (seconds)
+    Vector3 velocity;               // Particle velocity
+    float lifetime;                 // Particle lifetime (seconds)
+} ParticleState;
+
+// Particle system internal data (ParticleSystem.ctxData)
+// NOTE: GPU particles are compacted from one particles buffer to the other on every update,
+// alive particles count is the instanceCount of the target buffer indirect draw arguments
+typedef struct ParticleSystemData {
+    ParticleEmitter emitter;        // Last update emitter, particles sizes and colors used on drawing
+    float spawnTime;                // Particles spawn accumulator (fractional particles pending)
+    unsigned int seed;              // Particles random state, advanced on every update
+    int current;                    // GPU particles buffer holding alive particles (0 or 1)
+    unsigned int particlesIds[2];   // GPU particles buffers (SSBO)
+    unsigned int argsIds[2];        // GPU particles indirect draw arguments buffers: { 6, alive particles, 0, 0 }
+    unsigned int updateShaderId;    // GPU particles update compute shader program
+    unsigned int spawnShaderId;     // GPU particles spawn compute shader program
+    unsigned int drawShaderId;      // GPU particles drawing shader program, quads expanded from particles buffer
+    unsigned int vaoId;             // GPU particles drawing vertex array (no attributes)
+    ParticleState *particles;       // CPU particles (maxParticles)
+    BillboardInstance *items;       // CPU particles billboards (maxParticles), drawn with DrawBillboardsBatch()
+    int count;                      // CPU particles alive
+} ParticleSystemData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static Shader skinningShader = { 0 };       // Default shader with GPU skinning, loaded on first UpdateModelAnimationBones()
+static bool skinningShaderFailed = false;   // GPU skinning shader failed to load, CPU skinning used
+static Shader morphShader = { 0 };          // Default shader with GPU morphing, loaded on first morphed mesh draw
+static Shader morphSkinningShader = { 0 };  // Default shader with GPU morphing and skinning
+static bool morphShaderFailed = false;      // GPU morphing shaders failed to load, default shader used
+static bool modelFrustumCulling = false;    // Skip model meshes outside current frustum on DrawModelEx()
+static MeshInstanceBuffer instanceBuffer = { 0 };   // Internal instances buffer, reused by DrawMeshInstanced()/DrawModelInstanced()
+static float16 *instanceTransforms = NULL;  // Internal instances transforms upload memory (instanceBuffer.instanceCount)
+static MeshQueueEntry *meshQueue = NULL;    // Mesh draws queue, kept between frames (meshQueueCapacity)
+static int *meshQueueOrder = NULL;          // Mesh draws queue submission order (sorted)
+static int meshQueueCount = 0;              // Mesh draws queued
+static int meshQueueCapacity = 0;           // Mesh draws queue capacity
+static bool meshQueueActive = false;        // Mesh draws are queued by DrawMesh() (BeginMeshQueue())
+static unsigned char *tangentsScratch = NULL;   // Tangents generation scratch memory, kept between GenMeshTangents() calls
+static size_t tangentsScratchSize = 0;      // Tangents generation scratch memory size
+static Shader shadowShader = { 0 };         // Shadow casters depth shader, loaded on first LoadShadowMap()
+static Shader shadowShaderInstancing = { 0 };   // Shadow casters depth shader with instancing (instanced and queued draws)
+static MaterialMap shadowMaterialMaps[MAX_MATERIAL_MAPS] = { 0 };   // Shadow casters material maps (no textures)
+static bool shadowModeActive = false;       // Meshes are drawn as shadow casters (BeginShadowMode())
+static bool shadowModeStereo = false;       // Stereo render enabled before BeginShadowMode()
+static int shadowModeFramebufferWidth = 0;  // Framebuffer width before BeginShadowMode()
+static int shadowModeFramebufferHeight = 0; // Framebuffer height before BeginShadowMode()
+static Matrix shadowModeView = { 0 };       // Modelview matrix before BeginShadowMode()
+static Matrix shadowModeProjection = { 0 }; // Projection matrix before BeginShadowMode()
+#if defined(RMODELS_SHAPES_CACHE)
+static Shader shapesShader = { 0 };         // Shapes instancing shader, loaded on first shape draw
+static bool shapesShaderFailed = false;     // Shapes instancing shader failed to load (or instancing not supported), shapes tessellated
+static ShapeMesh shapeMeshes[SHAPES_CACHE_MAX_MESHES] = { 0 };    // Shapes unit meshes cache
+static int shapeMeshCount = 0;              // Shapes unit meshes cached
+static ShapeMeshDraw *shapeDraws = NULL;    // Shapes draws pending, drawn before default render batch (shapeDrawCapacity)
+static int shapeDrawCount = 0;              // Shapes draws pending
+static int shapeDrawCapacity = 0;           // Shapes draws capacity
+static ShapeMeshInstance *shapeInstances = NULL;    // Shapes instances pending, in submission order (shapeInstanceCapacity)
+static Color *shapeColors = NULL;           // Shapes instances colors upload memory (shapeInstanceCapacity)
+static int shapeInstanceCount = 0;          // Shapes instances pending
+static int shapeInstanceCapacity = 0;       // Shapes instances capacity
+static bool shapeDrawing = false;           // Shapes draws being drawn (render batch callback)
+#endif
+static Shader billboardsShader = { 0 };     // Billboards batch instancing shader, loaded on first DrawBillboardsBatch()
+static bool billboardsShaderFailed = false; // Billboards batch shader failed to load (or instancing not supported), render batch used
+static int billboardsLocs[5] = { 0 };       // Billboards batch shader locations: instances attributes (3) and camera vectors (2)
+static unsigned int billboardsVaoId = 0;    // Billboards batch quad vertex array
+static unsigned int billboardsVboId = 0;    // Billboards batch quad corners buffer
+static unsigned int billboardsInstancesId = 0;  // Billboards batch instances buffer (orphaned on every draw)
+static float *billboardsInstances = NULL;   // Billboards batch instances upload memory (billboardsCapacity)
+static BillboardSortKey *billboardsKeys = NULL; // Billboards batch sort keys, two arrays for merging (billboardsCapacity*2)
+static int billboardsCapacity = 0;          // Billboards batch memory capacity (billboards)
+static bool billboardsSorting = false;      // Billboards batch sorted back-to-front (SetBillboardsBatchSorting())
+static ModelTextureCacheEntry *textureCache = NULL;     // Models materials textures cache (textureCacheCapacity)
+static int textureCacheCount = 0;           // Models materials textures cached
+static int textureCacheCapacity = 0;        // Models materials textures cache capacity
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_M3D)
+static Transform **LoadAnimationFramePoses(int frameCount, int boneCount);  // Load animation frames poses, one allocation
+#endif
+static void UnloadAnimationFramePoses(Transform **framePoses, int frameCount, int boneCount);    // Unload animation frames poses
+static void SetTextureCacheKey(char *key, const char *text, ...);  // Set texture cache key from formatted text (empty: not fitting MAX_FILEPATH_LENGTH)
+static int FindTextureCached(const char *key);  // Find models materials texture cached by image key (-1: not cached)
+static bool GetTextureCached(const char *key, Texture2D *texture);  // Get models materials texture cached by image key, reference added
+static Texture2D AddTextureCached(const char *key, Image image);    // Load texture from image and add it to cache, one reference
+static Texture2D LoadTextureCached(const char *fileName);   // Load models materials texture from file through cache
+static bool UnloadTextureCached(Texture2D texture);     // Release models materials texture cached reference, unloaded without references
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
 #endif
 #if defined(SUPPORT_FILEFORMAT_IQM)
 static Model LoadIQM(const char *fileName);     // Load IQM mesh data
 static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount);   // Load IQM animation data
+static void DecodeAnimationFramesIQM(int start, int end, void *userData);   // Decode IQM animation frames range, jobs system callback
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
 static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
+static GLTFModelData LoadGLTFData(const char *fileName, bool skipCached);   // Load GLTF model data on CPU, materials images decoded (thread-safe if not skipCached)
+static Model LoadGLTFTextures(GLTFModelData gltf);  // Load GLTF model materials textures from decoded images (main thread)
+static void LoadImagesGLTF(int start, int end, void *userData);  // Load GLTF images range, jobs system callback
+static void LoadMeshesGLTF(int start, int end, void *userData);  // Load GLTF meshes range, jobs system callback
+static void LoadMeshGLTF(Mesh *mesh, const cgltf_primitive *primitive, const cgltf_node *node, const char *fileName);  // Load GLTF triangles primitive into mesh
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, unsigned int *animCount);  // Load GLTF animation data
+static void GetMorphWeightsAtTimeGLTF(const cgltf_animation_sampler *sampler, float time, int count, float *weights);  // Get morph targets weights for weights sampler at time
+static void *AllocArenaGLTF(void *user, cgltf_size size);  // Allocate cgltf parse data from memory arena
+static void FreeArenaGLTF(void *user, void *ptr);   // Free cgltf parse data, released at once with memory arena
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+static int CompareKeyframesGLTF(const void *a, const void *b);  // Compare keyframes time, qsort() callback
+#endif
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
 static Model LoadVOX(const char *filename);     // Load VOX mesh data
+static int GenVoxelQuads(VoxArray3D *voxarray, float **vertices, unsigned char **colors, float **normals);   // Generate voxels greedy meshed quads, returns quads count
 #endif
 #if defined(SUPPORT_FILEFORMAT_M3D)
 static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount);   // Load M3D animation data
+static void BuildAnimationFramesM3D(int start, int end, void *userData);    // Build M3D animation frames range poses from parent bones, jobs system callback
 #endif
+static ModelAnimation *LoadModelAnimationsBinary(const char *fileName, unsigned int *animCount);    // Load model binary file animations (.rlm)
+static const ModelBinaryHeader *GetModelBinaryHeader(const unsigned char *data, unsigned int size);  // Get model binary file header, validated (NULL if not valid)
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void DrawMeshInstancedVbo(Mesh mesh, Material material, MeshInstanceBuffer buffer, int first, int instances, unsigned int argsBufferId); // Draw mesh instances from instances buffer (indirect if args buffer provided)
+static void EnableMeshShader(Shader shader, Matrix matView, Matrix matProjection);  // Enable mesh shader program and upload view and projection matrices
+static void EnableMeshMaterial(Material material);          // Upload material colors to shader and bind material texture maps
+static void DisableMeshMaterial(Material material);         // Unbind material texture maps
+static void EnableMeshVertexArray(Mesh mesh, Shader shader);    // Bind mesh vertex data for shader attributes (VAO or VBOs)
+static void DrawMeshVertexArray(Mesh mesh, Material material, Matrix transform, Matrix matView, Matrix matProjection);   // Send mesh model transformation to shader and draw mesh
+static void DrawMeshInstancedArray(Mesh mesh, Material material, MeshInstanceBuffer buffer, int first, int instances, unsigned int argsBufferId, Matrix matView, Matrix matProjection); // Attach instances buffer to mesh vertex data and draw mesh instances
+static void QueueMesh(Mesh mesh, Material material, Matrix transform);  // Add mesh draw to mesh queue (BeginMeshQueue())
+static int CompareMeshQueueEntries(const void *a, const void *b);       // Compare mesh queue entries order: shader, material, mesh
+static bool LoadInstanceBufferDefault(int instances);   // Load internal instances buffer (grown to required instances)
+static void UploadInstanceTransforms(const Matrix *transforms, int instances, Matrix local); // Upload instances transforms to internal instances buffer, combined with local transform
+static void SetMeshMorphUniforms(Mesh mesh, Shader shader);     // Upload mesh morph weights and bind morph targets texture (if locations available)
+#endif
+static int GetAnimationFrame(ModelAnimation anim, float time, float *t);   // Get animation frame at time (looped by duration) and interpolation factor to next frame
+static void SampleAnimationPose(Model model, ModelAnimation anim, float time, Transform *pose, Transform *frames);  // Sample animation pose at time, interpolated between frames
+static const Transform *GetAnimationFramePose(ModelAnimation anim, int frame, Transform *pose);  // Get animation frame pose, decompressed into pose if required
+static void EncodeQuaternion(Quaternion q, unsigned short *data);   // Encode quaternion smallest three components (15bit) and largest component index
+static Quaternion DecodeQuaternion(const unsigned short *data);     // Decode quaternion from smallest three components
+static void ComputeBoneMatrices(Model model, const Transform *pose, int poseCount, Matrix *boneMatrices); // Compute bones matrices for pose
+static const Matrix *UpdateModelPose(Model model, const Transform *pose, int poseCount, Matrix *buffer);  // Update model pose for animation pose, returns bones skinning matrices
+static void SkinModelMeshes(Model model, const Matrix *boneMatrices);   // Skin model meshes on CPU with bones matrices, vertex data uploaded to GPU
+static void SetModelBoneMatrices(Model model, const Matrix *boneMatrices);  // Set model meshes bones matrices (GPU skinning)
+static void SkinMeshVertices(int start, int end, void *userData);    // Skin model meshes vertices range for animation frame, jobs system callback
+static void SkinVertices(Mesh *mesh, const Matrix *boneMatrices, int start, int end);   // Skin mesh vertices range with bones matrices
+static void ComputeTriangleTangents(int start, int end, void *userData);    // Compute triangles range corners tangents, jobs system callback
+#if defined(SUPPORT_MESH_GENERATION)
+static Mesh GenMeshShape(MeshGenParams params);     // Generate mesh shape, uploaded to GPU
+static bool GenMeshShapeData(Mesh *mesh, MeshGenParams params);    // Generate mesh shape vertex data (not uploaded), thread-safe
+static void GenMeshShapesJob(int start, int end, void *userData);  // Generate meshes range shapes vertex data, jobs system callback
+static void GenMeshShapeVertices(MeshGenWriter *writer, MeshGenParams params);  // Write mesh shape vertices and triangles (counted if mesh arrays are NULL)
+static Vector3 GetMeshGenSurface(MeshGenParams params, float u, float v, Vector3 *normal);  // Get mesh shape parametric surface point and normal at (u, v)
+static void AddMeshGenGrid(MeshGenWriter *writer, MeshGenParams params, int slices, int stacks);   // Add mesh shape parametric surface grid
+static void AddMeshGenDisk(MeshGenWriter *writer, Vector3 center, float radius, int slices, bool up, Vector2 texcoord);  // Add horizontal disk (triangles fan)
+static void AddMeshGenVertex(MeshGenWriter *writer, Vector3 position, Vector3 normal, Vector2 texcoord);   // Add mesh generation vertex
+static void AddMeshGenTriangle(MeshGenWriter *writer, int a, int b, int c);     // Add mesh generation triangle (degenerate triangles skipped)
+#endif
+static void ComputeVertexTangents(int start, int end, void *userData);      // Compute vertices range tangents from welded vertex corners, jobs system callback
+static bool LoadShaderSkinning(void);           // Load GPU skinning default shader (if not loaded)
+static bool LoadShaderMorph(void);              // Load GPU morphing default shaders (if not loaded)
+static void SetModelMorphWeights(Model model, const float *weights, int count, bool skinning);  // Set model meshes morph weights (meshes order), CPU skinned meshes are morphed by skinning
+static void MorphVertices(Mesh *mesh, int start, int end);  // Morph mesh vertices range into animated vertex data (CPU morphing)
+static void LoadModelMeshBounds(Model *model);  // Compute model meshes bounding boxes (culling) and load bones pose
+static void UpdateModelMeshBounds(Model model, const Matrix *boneMatrices); // Update skinned meshes bounding boxes from bones bounds
+extern void UnloadShaderSkinning(void);         // Unload GPU skinning and morphing default shaders, called on CloseWindow()
+extern void UnloadMeshDrawDefault(void);        // Unload internal instances buffer, mesh queue, shadow shaders and textures cache, called on CloseWindow()
+static void LoadShadowMapBuffers(ShadowMap *shadow);    // Load shadow map framebuffers and depth textures
+static bool LoadShaderShadow(void);             // Load shadow casters depth shaders (if not loaded)
+static bool GetLightClustersTiles(float min, float max, int tiles, int *first, int *last);   // Get clusters tiles range covered by normalized screen range [-1..1]
+#if defined(RMODELS_SHAPES_CACHE)
+static bool LoadShaderShapes(void);             // Load shapes instancing shader (if not loaded), shapes draws callback registered
+static int LoadShapeMesh(int type, int rings, int slices, float radiusTop, float radiusBottom);  // Load shape unit mesh into shapes cache, returns mesh index (-1 if shape must be tessellated)
+static int GenShapeMeshVertices(int type, int rings, int slices, float radiusTop, float radiusBottom, Vector3 *vertices);  // Generate shape unit mesh vertices, returns vertex count (vertices can be NULL)
+static Matrix GetShapeMeshBasis(Vector3 x, Vector3 y, Vector3 z, Vector3 origin);   // Get shape mesh transform from basis axes and origin
+static void QueueShapeMeshes(const int *meshes, const Matrix *transforms, int count, Color color);  // Add shape meshes instances to pending shapes draws
+static void DrawShapeMeshes(void);              // Draw pending shapes draws, render batch callback
+#endif
+static const BillboardSortKey *SortBillboards(const BillboardInstance *items, int count, Vector3 position, Vector3 forward);   // Sort billboards back-to-front by view depth
+static void ComputeBillboardsSortKeys(int start, int end, void *userData);  // Compute billboards range sort keys, jobs system callback
+static void SortBillboardsChunks(int start, int end, void *userData);       // Sort billboards sort keys chunks range, jobs system callback
+static int CompareBillboardSortKeys(const void *a, const void *b);          // Compare billboards sort keys (farthest first), qsort() callback
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool LoadShaderBillboards(void);         // Load billboards batch instancing shader and quad vertex data (if not loaded)
+static void DrawBillboardsInstanced(Texture2D texture, Vector3 right, Vector3 up, int count);  // Draw billboards batch instances, quads expanded on GPU
+#endif
+#if defined(GRAPHICS_API_OPENGL_43)
+static bool LoadParticleSystemGpu(ParticleSystemData *data, int maxParticles);  // Load particle system GPU buffers and shaders (compute shaders required)
+static void UnloadParticleSystemGpu(ParticleSystemData *data);  // Unload particle system GPU buffers and shaders (loaded ones)
+#endif
+static float GetParticleRandom(unsigned int *state);    // Get particles random value in [0..1) range (xorshift)
+static void SetupModelLoaded(Model *model, const char *fileName);   // Setup model loaded from file: default mesh/material, GPU upload and bounds
+static void DecodeModelAsync(void *data);       // Decode model async load data (loader thread), glTF only
+static void FinalizeModelAsync(void *data);     // Finalize model async load (main thread)
+static void GenTerrainChunkAsync(void *data);   // Generate terrain chunk mesh data (loader thread)
+static void FinalizeTerrainChunkAsync(void *data);  // Upload terrain chunk mesh (main thread)
+static float GetTerrainEdgeError(const TerrainChunkAsyncLoad *load, bool alongX, int line, int step);    // Get terrain chunk edge max height error at LOD step
+static void GetMeshAttributes(Mesh *mesh, void **attributes[MESH_OPTIMIZE_ATTRIBUTES], int *sizes);  // Get mesh vertex attributes arrays and vertex sizes
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *source, int count);   // Remap mesh vertex attributes, new vertices copied from source vertices
+static bool IndexMeshVertices(Mesh *mesh);      // Deduplicate mesh vertices into indices buffer, fails if unique vertices exceed 16bit indices
+static float GetMeshCacheMissRatio(const unsigned short *indices, int indexCount, int vertexCount); // Get mesh average cache miss ratio (FIFO vertex cache)
+static void OptimizeMeshVertexCache(unsigned short *indices, int indexCount, int vertexCount);  // Reorder triangles for vertex cache locality (Tipsify)
+static void OptimizeMeshOverdraw(const float *vertices, unsigned short *indices, int indexCount, int vertexCount); // Reorder triangles clusters to reduce overdraw
+static void OptimizeMeshVertexFetch(Mesh *mesh);    // Reorder mesh vertices by first use in indices
+static int CompareMeshTriangleClusters(const void *a, const void *b);  // Compare triangle clusters sort key (descending), qsort() callback
+static void AddMeshQuadricPlane(MeshQuadric *quadric, Vector3 normal, float distance, float weight);  // Add weighted plane to mesh quadric
+static float GetMeshQuadricValue(const MeshQuadric *quadric, Vector3 point);  // Get mesh quadric value at point (weighted squared distance)
+static int SimplifyMeshIndices(MeshSimplifyData *data, unsigned short *indices, int triangleCount, int targetTriangles, float maxError, float *error);  // Simplify mesh indices by edge collapses, returns triangles count
+static int CompareMeshEdges(const void *a, const void *b);      // Compare mesh simplification edges (position groups), qsort() callback
+static int CompareMeshCollapses(const void *a, const void *b);  // Compare mesh edge collapses error (ascending), qsort() callback
+static int GetMeshLODIndices(Mesh mesh, int *count);    // Get mesh indices range for current LOD level, returns offset in mesh indices buffer
+static void *LoadMeshPackedBuffer(Mesh *mesh, int buffer, unsigned int flags, int *dataSize);  // Load mesh vertex buffer packed data (NULL if not packed), packing registered in mesh
+static void SetMeshVertexAttribute(Mesh mesh, int buffer, int location);  // Set mesh vertex buffer attribute format (considering packing)
+static const void *GetMeshBufferData(Mesh mesh, int buffer, int *stride);   // Get mesh buffer data uploaded to GPU and data stride
+static void UpdateMeshData(Mesh *mesh, int buffer, int first, int count, const void *data);  // Update mesh buffer data range, uploaded or registered as dirty (dynamic meshes)
+static void UploadMeshDirtyRanges(Mesh mesh);   // Upload dynamic mesh dirty ranges to GPU buffers, called before mesh is drawn
+static unsigned short FloatToHalf(float x);     // Convert float to half-float bits (round to nearest)
+static float GetRayDistanceBVHNode(Vector3 origin, Vector3 invDirection, const BVHNode *node, float maxDistance);  // Get ray entry distance to BVH node bounds (FLT_MAX if missed)
+static void GrowBoundsBVH(BoundingBox *box, Vector3 min, Vector3 max);  // Grow bounds to contain box, BVH build helper
+#if defined(SUPPORT_SIMD_COLLISION) && (defined(RMODELS_SIMD_SSE2) || defined(RMODELS_SIMD_NEON))
+static int CheckRayTriangles4(Ray ray, float vertices[9][4], float maxDistance, float *distances);  // Check ray against 4 triangles (SoA vertices), returns hit triangles mask
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -257,6 +865,16 @@ void DrawTriangleStrip3D(Vector3 *points, int pointCount, Color color)
 // NOTE: Cube position is the center position
 void DrawCube(Vector3 position, float width, float height, float length, Color color)
 {
+#if defined(RMODELS_SHAPES_CACHE)
+    int mesh = LoadShapeMesh(SHAPE_MESH_CUBE, 0, 0, 0.0f, 0.0f);
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(width, height, length), MatrixTranslate(position.x, position.y, position.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     float x = 0.0f;
     float y = 0.0f;
     float z = 0.0f;
@@ -336,6 +954,16 @@ void DrawCubeV(Vector3 position, Vector3 size, Color color)
 // Draw cube wires
 void DrawCubeWires(Vector3 position, float width, float height, float length, Color color)
 {
+#if defined(RMODELS_SHAPES_CACHE)
+    int mesh = LoadShapeMesh(SHAPE_MESH_CUBE_WIRES, 0, 0, 0.0f, 0.0f);
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(width, height, length), MatrixTranslate(position.x, position.y, position.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     float x = 0.0f;
     float y = 0.0f;
     float z = 0.0f;
@@ -420,6 +1048,16 @@ void DrawSphere(Vector3 centerPos, float radius, Color color)
 // Draw sphere with extended parameters
 void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color color)
 {
+#if defined(RMODELS_SHAPES_CACHE)
+    int mesh = ((rings >= 0) && (slices > 0))? LoadShapeMesh(SHAPE_MESH_SPHERE, rings, slices, 0.0f, 0.0f) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(radius, radius, radius), MatrixTranslate(centerPos.x, centerPos.y, centerPos.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     rlPushMatrix();
         // NOTE: Transformation is applied in inverse order (scale -> translate)
         rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
@@ -460,6 +1098,16 @@ void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color
 // Draw sphere wires
 void DrawSphereWires(Vector3 centerPos, float radius, int rings, int slices, Color color)
 {
+#if defined(RMODELS_SHAPES_CACHE)
+    int mesh = ((rings >= 0) && (slices > 0))? LoadShapeMesh(SHAPE_MESH_SPHERE_WIRES, rings, slices, 0.0f, 0.0f) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(radius, radius, radius), MatrixTranslate(centerPos.x, centerPos.y, centerPos.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     rlPushMatrix();
         // NOTE: Transformation is applied in inverse order (scale -> translate)
         rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
@@ -504,6 +1152,18 @@ void DrawCylinder(Vector3 position, float radiusTop, float radiusBottom, float h
 {
     if (sides < 3) sides = 3;
 
+#if defined(RMODELS_SHAPES_CACHE)
+    // Unit mesh radii are relative to largest radius, meshes are cached by radii ratio
+    float scale = (radiusTop > radiusBottom)? radiusTop : radiusBottom;
+    int mesh = ((scale > 0.0f) && (sides <= 360))? LoadShapeMesh(SHAPE_MESH_CYLINDER, 0, sides, radiusTop/scale, radiusBottom/scale) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(scale, height, scale), MatrixTranslate(position.x, position.y, position.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
 
@@ -567,6 +1227,18 @@ void DrawCylinderEx(Vector3 startPos, Vector3 endPos, float startRadius, float e
     Vector3 b1 = Vector3Normalize(Vector3Perpendicular(direction));
     Vector3 b2 = Vector3Normalize(Vector3CrossProduct(b1, direction));
 
+#if defined(RMODELS_SHAPES_CACHE)
+    // Unit mesh goes from origin to (0, 1, 0), transformed into the basis
+    float scale = (startRadius > endRadius)? startRadius : endRadius;
+    int mesh = (scale > 0.0f)? LoadShapeMesh(SHAPE_MESH_CYLINDER_EX, 0, sides, endRadius/scale, startRadius/scale) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = GetShapeMeshBasis(Vector3Scale(b1, scale), direction, Vector3Scale(b2, scale), startPos);
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     float baseAngle = (2.0f*PI)/sides;
 
     rlBegin(RL_TRIANGLES);
@@ -616,6 +1288,17 @@ void DrawCylinderWires(Vector3 position, float radiusTop, float radiusBottom, fl
 {
     if (sides < 3) sides = 3;
 
+#if defined(RMODELS_SHAPES_CACHE)
+    float scale = (radiusTop > radiusBottom)? radiusTop : radiusBottom;
+    int mesh = ((scale > 0.0f) && (sides <= 360))? LoadShapeMesh(SHAPE_MESH_CYLINDER_WIRES, 0, sides, radiusTop/scale, radiusBottom/scale) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = MatrixMultiply(MatrixScale(scale, height, scale), MatrixTranslate(position.x, position.y, position.z));
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
 
@@ -654,6 +1337,17 @@ void DrawCylinderWiresEx(Vector3 startPos, Vector3 endPos, float startRadius, fl
     Vector3 b1 = Vector3Normalize(Vector3Perpendicular(direction));
     Vector3 b2 = Vector3Normalize(Vector3CrossProduct(b1, direction));
 
+#if defined(RMODELS_SHAPES_CACHE)
+    float scale = (startRadius > endRadius)? startRadius : endRadius;
+    int mesh = (scale > 0.0f)? LoadShapeMesh(SHAPE_MESH_CYLINDER_EX_WIRES, 0, sides, endRadius/scale, startRadius/scale) : -1;
+    if (mesh >= 0)
+    {
+        Matrix transform = GetShapeMeshBasis(Vector3Scale(b1, scale), direction, Vector3Scale(b2, scale), startPos);
+        QueueShapeMeshes(&mesh, &transform, 1, color);
+        return;
+    }
+#endif
+
     float baseAngle = (2.0f*PI)/sides;
 
     rlBegin(RL_LINES);
@@ -703,6 +1397,31 @@ void DrawCapsule(Vector3 startPos, Vector3 endPos, float radius, int slices, int
     Vector3 b2 = Vector3Normalize(Vector3CrossProduct(b1, direction));
     Vector3 capCenter = endPos;
 
+#if defined(RMODELS_SHAPES_CACHE)
+    // Capsule drawn as caps and body meshes instances, start cap transform is reflected along direction
+    int meshes[3] = { -1, -1, -1 };
+    if (rings > 0)
+    {
+        meshes[0] = LoadShapeMesh(SHAPE_MESH_CAPSULE_CAP, rings, slices, 0.0f, 0.0f);
+        meshes[1] = LoadShapeMesh(SHAPE_MESH_CAPSULE_CAP_FLIPPED, rings, slices, 0.0f, 0.0f);
+        meshes[2] = LoadShapeMesh(SHAPE_MESH_CAPSULE_BODY, 0, slices, 0.0f, 0.0f);
+    }
+
+    if ((meshes[0] >= 0) && (meshes[1] >= 0) && (meshes[2] >= 0))
+    {
+        Vector3 x = Vector3Scale(b1, radius);
+        Vector3 z = Vector3Scale(b2, radius);
+        Matrix transforms[3] = {
+            GetShapeMeshBasis(x, Vector3Scale(b0, radius), z, endPos),
+            GetShapeMeshBasis(x, Vector3Scale(b0, -radius), z, startPos),
+            GetShapeMeshBasis(x, direction, z, startPos)
+        };
+
+        QueueShapeMeshes(meshes, transforms, sphereCase? 2 : 3, color);
+        return;
+    }
+#endif
+
     float baseSliceAngle = (2.0f*PI)/slices;
     float baseRingAngle  = PI * 0.5f / rings;
 
@@ -1035,6 +1754,9 @@ Model LoadModel(const char *fileName)
 {
     Model model = { 0 };
 
+    // Model binary files provide GPU ready data, uploaded from mapped file
+    if (IsFileExtension(fileName, ".rlm")) return LoadModelBinary(fileName);
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
     if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
 #endif
@@ -1051,16 +1773,25 @@ Model LoadModel(const char *fileName)
     if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
 #endif
 
+    SetupModelLoaded(&model, fileName);
+
+    return model;
+}
+
+// Setup model loaded from file: default mesh/material if missing, meshes uploaded to GPU and bounds computed
+// NOTE: Loaders can request meshes packed vertex attributes (quantized source data) with mesh.packFlags
+static void SetupModelLoaded(Model *model, const char *fileName)
+{
     // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    model->transform = MatrixIdentity();
 
-    if (model.meshCount == 0)
+    if (model->meshCount == 0)
     {
-        model.meshCount = 1;
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model->meshCount = 1;
+        model->meshes = (Mesh *)RL_CALLOC(model->meshCount, sizeof(Mesh));
 #if defined(SUPPORT_MESH_GENERATION)
         TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data, default to cube mesh", fileName);
-        model.meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
+        model->meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
 #else
         TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data", fileName);
 #endif
@@ -1068,18 +1799,67 @@ Model LoadModel(const char *fileName)
     else
     {
         // Upload vertex data to GPU (static mesh)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        for (int i = 0; i < model->meshCount; i++)
+        {
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+            OptimizeMesh(&model->meshes[i], MESH_OPTIMIZE_ALL);
+#endif
+            UploadMeshPacked(&model->meshes[i], false, model->meshes[i].packFlags);
+        }
     }
 
-    if (model.materialCount == 0)
+    if (model->materialCount == 0)
     {
         TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load material data, default to white material", fileName);
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+        model->materialCount = 1;
+        model->materials = (Material *)RL_CALLOC(model->materialCount, sizeof(Material));
+        model->materials[0] = LoadMaterialDefault();
+
+        if (model->meshMaterial == NULL) model->meshMaterial = (int *)RL_CALLOC(model->meshCount, sizeof(int));
+    }
+
+    LoadModelMeshBounds(model);
+}
+
+// Load model from files asynchronously, returns request id (-1: failed)
+// NOTE: glTF models data is decoded on loader thread (images and meshes), GPU upload on BeginDrawing(),
+// other model loaders upload meshes and material textures while parsing, so model is loaded on
+// BeginDrawing() (main thread), one model per frame budget, check IsAsyncLoadReady()
+int LoadModelAsync(const char *fileName)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)RL_CALLOC(1, sizeof(ModelAsyncLoad));
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
+
+    AsyncLoadCallback decode = NULL;
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) decode = DecodeModelAsync;
+#endif
+
+    int request = LoadAsync(decode, FinalizeModelAsync, load);
+
+    if (request < 0)
+    {
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return request;
+}
+
+// Get async loaded model, request is released (empty if not ready)
+Model GetModelAsync(int request)
+{
+    Model model = { 0 };
+    ModelAsyncLoad *load = (ModelAsyncLoad *)GetAsyncLoadData(request, FinalizeModelAsync);
+
+    if (load != NULL)
+    {
+        model = load->model;
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+        RL_FREE(load->fileName);
+        RL_FREE(load);
     }
 
     return model;
@@ -1106,2875 +1886,6779 @@ Model LoadModelFromMesh(Mesh mesh)
     model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
     model.meshMaterial[0] = 0;  // First material index
 
+    LoadModelMeshBounds(&model);
+
     return model;
 }
 
-// Check if a model is ready
-bool IsModelReady(Model model)
+// Load model from binary file (.rlm), vertex data uploaded from mapped file
+// NOTE: File data blocks are used in place: meshes vertex streams and textures pixels are uploaded
+// to GPU from mapped file and copied to CPU memory, materials use default shader
+Model LoadModelBinary(const char *fileName)
 {
-    return ((model.meshes != NULL) &&           // Validate model contains some mesh
-            (model.materials != NULL) &&        // Validate model contains some material (at least default one)
-            (model.meshMaterial != NULL) &&     // Validate mesh-material linkage
-            (model.meshCount > 0) &&            // Validate mesh count
-            (model.materialCount > 0));         // Validate material count
+    Model model = { 0 };
+    unsigned int size = 0;
+    unsigned char *data = LoadFileDataMapped(fileName, &size);
+    const ModelBinaryHeader *header = GetModelBinaryHeader(data, size);
 
-    // NOTE: This is a very general model validation, many elements could be validated from a model...
-}
+    if (header == NULL)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model binary file not valid or version not supported", fileName);
+        UnloadFileDataMapped(data);
+        return model;
+    }
 
-// Unload model (meshes/materials) from memory (RAM and/or VRAM)
-// NOTE: This function takes care of all model elements, for a detailed control
-// over them, use UnloadMesh() and UnloadMaterial()
-void UnloadModel(Model model)
-{
-    // Unload meshes
-    for (int i = 0; i < model.meshCount; i++) UnloadMesh(model.meshes[i]);
+    const ModelBinaryMesh *meshes = (const ModelBinaryMesh *)(data + sizeof(ModelBinaryHeader));
+    const float *params = (const float *)(meshes + header->meshCount);
+    const ModelBinaryMap *maps = (const ModelBinaryMap *)(params + header->materialCount*4);
+    const ModelBinaryTexture *textures = (const ModelBinaryTexture *)(maps + header->materialCount*header->mapCount);
 
-    // Unload materials maps
-    // NOTE: As the user could be sharing shaders and textures between models,
-    // we don't unload the material but just free its maps,
-    // the user is responsible for freeing models shaders and textures
-    for (int i = 0; i < model.materialCount; i++) RL_FREE(model.materials[i].maps);
+    model.transform = header->transform;
 
-    // Unload arrays
-    RL_FREE(model.meshes);
-    RL_FREE(model.materials);
-    RL_FREE(model.meshMaterial);
+    // Load textures from pixel data
+    Texture2D *loadedTextures = (Texture2D *)RL_CALLOC(header->textureCount + 1, sizeof(Texture2D));
 
-    // Unload animation data
-    RL_FREE(model.bones);
-    RL_FREE(model.bindPose);
+    for (int i = 0; i < header->textureCount; i++)
+    {
+        Texture2D *texture = &loadedTextures[i];
 
-    TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
-}
+        texture->id = rlLoadTexture(data + textures[i].data, textures[i].width, textures[i].height, textures[i].format, 1);
+        texture->width = textures[i].width;
+        texture->height = textures[i].height;
+        texture->format = textures[i].format;
+        texture->mipmaps = 1;
 
-// Compute model bounding box limits (considers all meshes)
-BoundingBox GetModelBoundingBox(Model model)
-{
-    BoundingBox bounds = { 0 };
+        if ((textures[i].mipmaps > 1) && (texture->id > 0)) GenTextureMipmaps(texture);
+    }
 
-    if (model.meshCount > 0)
+    // Load materials, maps textures referenced by index
+    model.materialCount = (header->materialCount > 0)? header->materialCount : 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+    for (int i = 0; i < model.materialCount; i++)
     {
-        Vector3 temp = { 0 };
-        bounds = GetMeshBoundingBox(model.meshes[0]);
+        model.materials[i] = LoadMaterialDefault();
+        if (i >= header->materialCount) continue;
 
-        for (int i = 1; i < model.meshCount; i++)
-        {
-            BoundingBox tempBounds = GetMeshBoundingBox(model.meshes[i]);
+        for (int p = 0; p < 4; p++) model.materials[i].params[p] = params[i*4 + p];
 
-            temp.x = (bounds.min.x < tempBounds.min.x)? bounds.min.x : tempBounds.min.x;
-            temp.y = (bounds.min.y < tempBounds.min.y)? bounds.min.y : tempBounds.min.y;
-            temp.z = (bounds.min.z < tempBounds.min.z)? bounds.min.z : tempBounds.min.z;
-            bounds.min = temp;
+        for (int m = 0; (m < header->mapCount) && (m < MAX_MATERIAL_MAPS); m++)
+        {
+            const ModelBinaryMap *map = &maps[i*header->mapCount + m];
 
-            temp.x = (bounds.max.x > tempBounds.max.x)? bounds.max.x : tempBounds.max.x;
-            temp.y = (bounds.max.y > tempBounds.max.y)? bounds.max.y : tempBounds.max.y;
-            temp.z = (bounds.max.z > tempBounds.max.z)? bounds.max.z : tempBounds.max.z;
-            bounds.max = temp;
+            if (map->texture >= 0) model.materials[i].maps[m].texture = loadedTextures[map->texture];
+            model.materials[i].maps[m].color = map->color;
+            model.materials[i].maps[m].value = map->value;
         }
     }
 
-    return bounds;
-}
+    RL_FREE(loadedTextures);
 
-// Upload vertex data into a VAO (if supported) and VBO
-void UploadMesh(Mesh *mesh, bool dynamic)
-{
-    if (mesh->vaoId > 0)
+    // Load meshes, vertex streams are uploaded from file data
+    model.meshCount = header->meshCount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    for (int i = 0; i < model.meshCount; i++)
     {
-        // Check if mesh has already been loaded in GPU
-        TRACELOG(LOG_WARNING, "VAO: [ID %i] Trying to re-load an already loaded mesh", mesh->vaoId);
-        return;
-    }
+        Mesh *mesh = &model.meshes[i];
+        void **streams[MODEL_BINARY_MESH_STREAMS] = { (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2,
+            (void **)&mesh->normals, (void **)&mesh->tangents, (void **)&mesh->colors, (void **)&mesh->boneIds, (void **)&mesh->boneWeights, (void **)&mesh->indices };
+        int sizes[MODEL_BINARY_MESH_STREAMS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float), 0 };
 
-    mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+        mesh->vertexCount = meshes[i].vertexCount;
+        mesh->triangleCount = meshes[i].triangleCount;
+        model.meshMaterial[i] = ((meshes[i].material >= 0) && (meshes[i].material < model.materialCount))? meshes[i].material : 0;
 
-    mesh->vaoId = 0;        // Vertex Array Object
-    mesh->vboId[0] = 0;     // Vertex buffer: positions
-    mesh->vboId[1] = 0;     // Vertex buffer: texcoords
-    mesh->vboId[2] = 0;     // Vertex buffer: normals
-    mesh->vboId[3] = 0;     // Vertex buffer: colors
-    mesh->vboId[4] = 0;     // Vertex buffer: tangents
-    mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
-    mesh->vboId[6] = 0;     // Vertex buffer: indices
+        for (int s = 0; s < MODEL_BINARY_MESH_STREAMS; s++) *streams[s] = (meshes[i].streams[s] > 0)? data + meshes[i].streams[s] : NULL;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mesh->vaoId = rlLoadVertexArray();
-    rlEnableVertexArray(mesh->vaoId);
+        UploadMesh(mesh, false);
 
-    // NOTE: Vertex attributes must be uploaded considering default locations points and available vertex data
+        // Copy file data to mesh CPU buffers
+        for (int s = 0; s < MODEL_BINARY_MESH_STREAMS; s++)
+        {
+            if (*streams[s] == NULL) continue;
 
-    // Enable vertex attributes: position (shader-location = 0)
-    void *vertices = mesh->animVertices != NULL ? mesh->animVertices : mesh->vertices;
-    mesh->vboId[0] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
-    rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(0);
+            int streamSize = (s == (MODEL_BINARY_MESH_STREAMS - 1))? (int)(mesh->triangleCount*3*sizeof(unsigned short)) : (int)(mesh->vertexCount*sizes[s]);
+            void *buffer = RL_MALLOC(streamSize);
 
-    // Enable vertex attributes: texcoords (shader-location = 1)
-    mesh->vboId[1] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
-    rlSetVertexAttribute(1, 2, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(1);
+            memcpy(buffer, *streams[s], streamSize);
+            *streams[s] = buffer;
+        }
 
-    // WARNING: When setting default vertex attribute values, the values for each generic vertex attribute
-    // is part of current state, and it is maintained even if a different program object is used
+        // Skinned meshes animated vertex data
+        if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+        {
+            mesh->animVertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
 
-    if (mesh->normals != NULL)
-    {
-        // Enable vertex attributes: normals (shader-location = 2)
-        void *normals = mesh->animNormals != NULL ? mesh->animNormals : mesh->normals;
-        mesh->vboId[2] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
-        rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(2);
+            if (mesh->normals != NULL)
+            {
+                mesh->animNormals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+                memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+            }
+        }
     }
-    else
+
+    // Load bones and bind pose
+    if (header->boneCount > 0)
     {
-        // Default vertex attribute: normal
-        // WARNING: Default value provided to shader if location available
-        float value[3] = { 1.0f, 1.0f, 1.0f };
-        rlSetVertexAttributeDefault(2, value, SHADER_ATTRIB_VEC3, 3);
-        rlDisableVertexAttribute(2);
+        model.boneCount = header->boneCount;
+        model.bones = (BoneInfo *)RL_MALLOC(model.boneCount*sizeof(BoneInfo));
+        model.bindPose = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+
+        memcpy(model.bones, data + header->bones, model.boneCount*sizeof(BoneInfo));
+        memcpy(model.bindPose, data + header->bindPose, model.boneCount*sizeof(Transform));
     }
 
-    if (mesh->colors != NULL)
+    LoadModelMeshBounds(&model);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Model binary file loaded successfully: %i meshes / %i materials", fileName, model.meshCount, model.materialCount);
+
+    UnloadFileDataMapped(data);
+
+    return model;
+}
+
+// Export model (and animations) to binary file (.rlm), returns true on success
+// NOTE: Textures pixel data is read back from GPU and stored (base level), animations are optional,
+// compressed animations are stored decompressed
+bool ExportModelBinary(Model model, const ModelAnimation *animations, int animCount, const char *fileName)
+{
+    if ((model.meshCount <= 0) || (model.meshes == NULL)) return false;
+    if (animations == NULL) animCount = 0;
+
+    // Get textures referenced by materials (default texture is not stored)
+    int mapCount = MAX_MATERIAL_MAPS;
+    int textureCount = 0;
+    unsigned int *textureIds = (unsigned int *)RL_CALLOC(model.materialCount*mapCount + 1, sizeof(unsigned int));
+    int *mapTextures = (int *)RL_MALLOC((model.materialCount*mapCount + 1)*sizeof(int));
+
+    for (int i = 0; i < model.materialCount*mapCount; i++)
     {
-        // Enable vertex attribute: color (shader-location = 3)
-        mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
-        rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-        rlEnableVertexAttribute(3);
-    }
-    else
-    {
-        // Default vertex attribute: color
-        // WARNING: Default value provided to shader if location available
-        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
-        rlSetVertexAttributeDefault(3, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(3);
+        unsigned int id = (model.materials[i/mapCount].maps != NULL)? model.materials[i/mapCount].maps[i%mapCount].texture.id : 0;
+        mapTextures[i] = -1;
+
+        if ((id == 0) || (id == rlGetTextureIdDefault())) continue;
+
+        for (int t = 0; t < textureCount; t++) if (textureIds[t] == id) mapTextures[i] = t;
+
+        if (mapTextures[i] < 0)
+        {
+            mapTextures[i] = textureCount;
+            textureIds[textureCount++] = id;
+        }
     }
 
-    if (mesh->tangents != NULL)
-    {
-        // Enable vertex attribute: tangent (shader-location = 4)
-        mesh->vboId[4] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(4);
-    }
-    else
-    {
-        // Default vertex attribute: tangent
-        // WARNING: Default value provided to shader if location available
-        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(4, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(4);
-    }
+    // Read textures pixel data from GPU
+    Image *images = (Image *)RL_CALLOC(textureCount + 1, sizeof(Image));
+    Texture2D *sources = (Texture2D *)RL_CALLOC(textureCount + 1, sizeof(Texture2D));
 
-    if (mesh->texcoords2 != NULL)
-    {
-        // Enable vertex attribute: texcoord2 (shader-location = 5)
-        mesh->vboId[5] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(5, 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(5);
-    }
-    else
+    for (int i = 0; i < model.materialCount*mapCount; i++)
     {
-        // Default vertex attribute: texcoord2
-        // WARNING: Default value provided to shader if location available
-        float value[2] = { 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(5, value, SHADER_ATTRIB_VEC2, 2);
-        rlDisableVertexAttribute(5);
-    }
+        if ((mapTextures[i] >= 0) && (images[mapTextures[i]].data == NULL))
+        {
+            sources[mapTextures[i]] = model.materials[i/mapCount].maps[i%mapCount].texture;
+            images[mapTextures[i]] = LoadImageFromTexture(sources[mapTextures[i]]);
 
-    if (mesh->indices != NULL)
-    {
-        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
+            if (images[mapTextures[i]].data == NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to read texture data, default texture used", fileName);
+        }
     }
 
-    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
-    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
-
-    rlDisableVertexArray();
-#endif
-}
-
-// Update mesh vertex data in GPU for a specific buffer index
-void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
-{
-    rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
-}
-
-// Draw a 3d mesh with material and transform
-void DrawMesh(Mesh mesh, Material material, Matrix transform)
-{
-#if defined(GRAPHICS_API_OPENGL_11)
-    #define GL_VERTEX_ARRAY         0x8074
-    #define GL_NORMAL_ARRAY         0x8075
-    #define GL_COLOR_ARRAY          0x8076
-    #define GL_TEXTURE_COORD_ARRAY  0x8078
-
-    rlEnableTexture(material.maps[MATERIAL_MAP_DIFFUSE].texture.id);
-
-    rlEnableStatePointer(GL_VERTEX_ARRAY, mesh.vertices);
-    rlEnableStatePointer(GL_TEXTURE_COORD_ARRAY, mesh.texcoords);
-    rlEnableStatePointer(GL_NORMAL_ARRAY, mesh.normals);
-    rlEnableStatePointer(GL_COLOR_ARRAY, mesh.colors);
+    // Compute file layout: tables followed by aligned data blocks
+    #define MODEL_BINARY_BLOCK(blockSize) (dataSize = ((dataSize + MODEL_BINARY_ALIGNMENT - 1)/MODEL_BINARY_ALIGNMENT)*MODEL_BINARY_ALIGNMENT, dataSize += (blockSize), (unsigned int)(dataSize - (blockSize)))
 
-    rlPushMatrix();
-        rlMultMatrixf(MatrixToFloat(transform));
-        rlColor4ub(material.maps[MATERIAL_MAP_DIFFUSE].color.r,
-                   material.maps[MATERIAL_MAP_DIFFUSE].color.g,
-                   material.maps[MATERIAL_MAP_DIFFUSE].color.b,
-                   material.maps[MATERIAL_MAP_DIFFUSE].color.a);
+    unsigned long long dataSize = sizeof(ModelBinaryHeader) + model.meshCount*sizeof(ModelBinaryMesh) + model.materialCount*4*sizeof(float) +
+        model.materialCount*mapCount*sizeof(ModelBinaryMap) + textureCount*sizeof(ModelBinaryTexture) + animCount*sizeof(ModelBinaryAnimation);
 
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
-        else rlDrawVertexArray(0, mesh.vertexCount);
-    rlPopMatrix();
+    ModelBinaryHeader header = { { 'r', 'M', 'D', 'L' }, MODEL_BINARY_VERSION, 0, model.meshCount, model.materialCount, mapCount, textureCount, model.boneCount, animCount, 0, 0, model.transform };
+    ModelBinaryMesh *meshes = (ModelBinaryMesh *)RL_CALLOC(model.meshCount, sizeof(ModelBinaryMesh));
+    ModelBinaryTexture *textures = (ModelBinaryTexture *)RL_CALLOC(textureCount + 1, sizeof(ModelBinaryTexture));
+    ModelBinaryAnimation *anims = (ModelBinaryAnimation *)RL_CALLOC(animCount + 1, sizeof(ModelBinaryAnimation));
 
-    rlDisableStatePointer(GL_VERTEX_ARRAY);
-    rlDisableStatePointer(GL_TEXTURE_COORD_ARRAY);
-    rlDisableStatePointer(GL_NORMAL_ARRAY);
-    rlDisableStatePointer(GL_COLOR_ARRAY);
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh *mesh = &model.meshes[i];
+        const void *streams[MODEL_BINARY_MESH_STREAMS] = { mesh->vertices, mesh->texcoords, mesh->texcoords2, mesh->normals, mesh->tangents, mesh->colors, mesh->boneIds, mesh->boneWeights, mesh->indices };
+        int sizes[MODEL_BINARY_MESH_STREAMS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float), 0 };
 
-    rlDisableTexture();
-#endif
+        meshes[i].vertexCount = mesh->vertexCount;
+        meshes[i].triangleCount = mesh->triangleCount;
+        meshes[i].material = (model.meshMaterial != NULL)? model.meshMaterial[i] : 0;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Bind shader program
-    rlEnableShader(material.shader.id);
+        for (int s = 0; s < MODEL_BINARY_MESH_STREAMS; s++)
+        {
+            int streamSize = (s == (MODEL_BINARY_MESH_STREAMS - 1))? (int)(mesh->triangleCount*3*sizeof(unsigned short)) : (int)(mesh->vertexCount*sizes[s]);
+            if (streams[s] != NULL) meshes[i].streams[s] = MODEL_BINARY_BLOCK(streamSize);
+        }
+    }
 
-    // Send required data to shader (matrices, values)
-    //-----------------------------------------------------
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    for (int i = 0; i < textureCount; i++)
     {
-        float values[4] = {
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+        textures[i].width = images[i].width;
+        textures[i].height = images[i].height;
+        textures[i].mipmaps = sources[i].mipmaps;
+        textures[i].format = images[i].format;
+        if (images[i].data != NULL) textures[i].data = MODEL_BINARY_BLOCK(GetPixelDataSize(images[i].width, images[i].height, images[i].format));
     }
 
-    // Upload to shader material.colSpecular (if location available)
-    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    if ((model.boneCount > 0) && (model.bones != NULL) && (model.bindPose != NULL))
     {
-        float values[4] = {
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+        header.bones = MODEL_BINARY_BLOCK(model.boneCount*sizeof(BoneInfo));
+        header.bindPose = MODEL_BINARY_BLOCK(model.boneCount*sizeof(Transform));
     }
+    else header.boneCount = 0;
 
-    // Get a copy of current matrices to work with,
-    // just in case stereo render is required, and we need to modify them
-    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it and there is no model-drawing function
-    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matModel = MatrixIdentity();
-    Matrix matView = rlGetMatrixModelview();
-    Matrix matModelView = MatrixIdentity();
-    Matrix matProjection = rlGetMatrixProjection();
+    for (int i = 0; i < animCount; i++)
+    {
+        anims[i].boneCount = animations[i].boneCount;
+        anims[i].frameCount = animations[i].frameCount;
+        anims[i].bones = MODEL_BINARY_BLOCK(animations[i].boneCount*sizeof(BoneInfo));
+        anims[i].poses = MODEL_BINARY_BLOCK(animations[i].frameCount*animations[i].boneCount*sizeof(Transform));
+        if (animations[i].frameTimes != NULL) anims[i].frameTimes = MODEL_BINARY_BLOCK(animations[i].frameCount*sizeof(float));
+    }
 
-    // Upload view and projection matrices (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
-    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    #undef MODEL_BINARY_BLOCK
 
-    // Model transformation matrix is sent to shader uniform location: SHADER_LOC_MATRIX_MODEL
-    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
+    bool success = (dataSize <= 0xffffffff);
 
-    // Accumulate several model transformations:
-    //    transform: model transformation provided (includes DrawModel() params combined with model.transform)
-    //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
-    matModel = MatrixMultiply(transform, rlGetMatrixTransform());
+    if (success)
+    {
+        // Fill file data
+        unsigned char *fileData = (unsigned char *)RL_CALLOC((size_t)dataSize, 1);
+        unsigned char *table = fileData + sizeof(ModelBinaryHeader);
 
-    // Get model-view matrix
-    matModelView = MatrixMultiply(matModel, matView);
+        header.fileSize = (unsigned int)dataSize;
+        memcpy(fileData, &header, sizeof(ModelBinaryHeader));
+        memcpy(table, meshes, model.meshCount*sizeof(ModelBinaryMesh));
+        table += model.meshCount*sizeof(ModelBinaryMesh);
 
-    // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
-    //-----------------------------------------------------
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            memcpy(table, model.materials[i].params, 4*sizeof(float));
+            table += 4*sizeof(float);
+        }
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
+        for (int i = 0; i < model.materialCount*mapCount; i++)
         {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+            ModelBinaryMap map = { ((mapTextures[i] >= 0) && (images[mapTextures[i]].data != NULL))? mapTextures[i] : -1, WHITE, 0.0f };
 
-            // Enable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
-            else rlEnableTexture(material.maps[i].texture.id);
+            if (model.materials[i/mapCount].maps != NULL)
+            {
+                map.color = model.materials[i/mapCount].maps[i%mapCount].color;
+                map.value = model.materials[i/mapCount].maps[i%mapCount].value;
+            }
 
-            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+            memcpy(table, &map, sizeof(ModelBinaryMap));
+            table += sizeof(ModelBinaryMap);
         }
-    }
-
-    // Try binding vertex array objects (VAO) or use VBOs if not possible
-    // WARNING: UploadMesh() enables all vertex attributes available in mesh and sets default attribute values
-    // for shader expected vertex attributes that are not provided by the mesh (i.e. colors)
-    // This could be a dangerous approach because different meshes with different shaders can enable/disable some attributes
-    if (!rlEnableVertexArray(mesh.vaoId))
-    {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+        memcpy(table, textures, textureCount*sizeof(ModelBinaryTexture));
+        table += textureCount*sizeof(ModelBinaryTexture);
+        memcpy(table, anims, animCount*sizeof(ModelBinaryAnimation));
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+        for (int i = 0; i < model.meshCount; i++)
         {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
-        }
+            Mesh *mesh = &model.meshes[i];
+            const void *streams[MODEL_BINARY_MESH_STREAMS] = { mesh->vertices, mesh->texcoords, mesh->texcoords2, mesh->normals, mesh->tangents, mesh->colors, mesh->boneIds, mesh->boneWeights, mesh->indices };
+            int sizes[MODEL_BINARY_MESH_STREAMS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float), 0 };
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[3]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
+            for (int s = 0; s < MODEL_BINARY_MESH_STREAMS; s++)
             {
-                // Set default value for defined vertex attribute in shader but not provided by mesh
-                // WARNING: It could result in GPU undefined behaviour
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                int streamSize = (s == (MODEL_BINARY_MESH_STREAMS - 1))? (int)(mesh->triangleCount*3*sizeof(unsigned short)) : (int)(mesh->vertexCount*sizes[s]);
+                if (streams[s] != NULL) memcpy(fileData + meshes[i].streams[s], streams[s], streamSize);
             }
         }
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+        for (int i = 0; i < textureCount; i++)
         {
-            rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            if (images[i].data != NULL) memcpy(fileData + textures[i].data, images[i].data, GetPixelDataSize(images[i].width, images[i].height, images[i].format));
         }
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+        if (header.boneCount > 0)
         {
-            rlEnableVertexBuffer(mesh.vboId[5]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            memcpy(fileData + header.bones, model.bones, model.boneCount*sizeof(BoneInfo));
+            memcpy(fileData + header.bindPose, model.bindPose, model.boneCount*sizeof(Transform));
         }
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
-    }
-
-    // WARNING: Disable vertex attribute color input if mesh can not provide that data (despite location being enabled in shader)
-    if (mesh.vboId[3] == 0) rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+        for (int i = 0; i < animCount; i++)
+        {
+            memcpy(fileData + anims[i].bones, animations[i].bones, animations[i].boneCount*sizeof(BoneInfo));
 
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+            for (int f = 0; f < animations[i].frameCount; f++)
+            {
+                GetModelAnimationPose(animations[i], f, (Transform *)(fileData + anims[i].poses) + f*animations[i].boneCount);
+            }
 
-    for (int eye = 0; eye < eyeCount; eye++)
-    {
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
-        {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            if (animations[i].frameTimes != NULL) memcpy(fileData + anims[i].frameTimes, animations[i].frameTimes, animations[i].frameCount*sizeof(float));
         }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        success = SaveFileData(fileName, fileData, (unsigned int)dataSize);
 
-        // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
-        else rlDrawVertexArray(0, mesh.vertexCount);
+        RL_FREE(fileData);
     }
 
-    // Unbind all bound texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
-
-            // Disable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
-        }
-    }
+    for (int i = 0; i < textureCount; i++) UnloadImage(images[i]);
 
-    // Disable all possible vertex array objects (or VBOs)
-    rlDisableVertexArray();
-    rlDisableVertexBuffer();
-    rlDisableVertexBufferElement();
+    RL_FREE(images);
+    RL_FREE(sources);
+    RL_FREE(textureIds);
+    RL_FREE(mapTextures);
+    RL_FREE(meshes);
+    RL_FREE(textures);
+    RL_FREE(anims);
 
-    // Disable shader program
-    rlDisableShader();
+    if (success) TRACELOG(LOG_INFO, "MODEL: [%s] Model binary file exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to export model binary file", fileName);
 
-    // Restore rlgl internal modelview and projection matrices
-    rlSetMatrixModelview(matView);
-    rlSetMatrixProjection(matProjection);
-#endif
+    return success;
 }
 
-// Draw multiple mesh instances with material and different transforms
-void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
+// Check if a model is ready
+bool IsModelReady(Model model)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
-
-    // Bind shader program
-    rlEnableShader(material.shader.id);
+    return ((model.meshes != NULL) &&           // Validate model contains some mesh
+            (model.materials != NULL) &&        // Validate model contains some material (at least default one)
+            (model.meshMaterial != NULL) &&     // Validate mesh-material linkage
+            (model.meshCount > 0) &&            // Validate mesh count
+            (model.materialCount > 0));         // Validate material count
 
-    // Send required data to shader (matrices, values)
-    //-----------------------------------------------------
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
-    {
-        float values[4] = {
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
-        };
+    // NOTE: This is a very general model validation, many elements could be validated from a model...
+}
 
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
-    }
+// Unload model (meshes/materials) from memory (RAM and/or VRAM)
+// NOTE: This function takes care of all model elements, for a detailed control
+// over them, use UnloadMesh() and UnloadMaterial()
+void UnloadModel(Model model)
+{
+    // Unload meshes
+    for (int i = 0; i < model.meshCount; i++) UnloadMesh(model.meshes[i]);
 
-    // Upload to shader material.colSpecular (if location available)
-    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    // Unload materials maps
+    // NOTE: As the user could be sharing shaders and textures between models,
+    // we don't unload the material but just free its maps, the user is responsible
+    // for freeing models shaders and textures, except the textures loaded by models
+    // loaders, shared through the textures cache, their references are released
+    for (int i = 0; i < model.materialCount; i++)
     {
-        float values[4] = {
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
-        };
+        if (model.materials[i].maps != NULL)
+        {
+            for (int m = 0; m < MAX_MATERIAL_MAPS; m++) UnloadTextureCached(model.materials[i].maps[m].texture);
+        }
 
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+        RL_FREE(model.materials[i].maps);
     }
 
-    // Get a copy of current matrices to work with,
-    // just in case stereo render is required, and we need to modify them
-    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it and there is no model-drawing function
-    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matModel = MatrixIdentity();
-    Matrix matView = rlGetMatrixModelview();
-    Matrix matModelView = MatrixIdentity();
-    Matrix matProjection = rlGetMatrixProjection();
+    // Unload arrays
+    RL_FREE(model.meshes);
+    RL_FREE(model.materials);
+    RL_FREE(model.meshMaterial);
+    RL_FREE(model.meshBounds);
 
-    // Upload view and projection matrices (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
-    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    // Unload animation data
+    RL_FREE(model.bones);
+    RL_FREE(model.bindPose);
+    RL_FREE(model.boneBounds);
+    RL_FREE(model.pose);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
+    TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
+}
 
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+// Compute model bounding box limits (considers all meshes)
+// NOTE: Meshes bounding boxes computed on model loading (updated by animation) are used if available
+BoundingBox GetModelBoundingBox(Model model)
+{
+    BoundingBox bounds = { 0 };
 
-    // Enable mesh VAO to attach new buffer
-    rlEnableVertexArray(mesh.vaoId);
+    if (model.meshCount > 0)
+    {
+        Vector3 temp = { 0 };
+        bounds = (model.meshBounds != NULL)? model.meshBounds[0] : GetMeshBoundingBox(model.meshes[0]);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData().
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+        for (int i = 1; i < model.meshCount; i++)
+        {
+            BoundingBox tempBounds = (model.meshBounds != NULL)? model.meshBounds[i] : GetMeshBoundingBox(model.meshes[i]);
 
-    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
-    {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+            temp.x = (bounds.min.x < tempBounds.min.x)? bounds.min.x : tempBounds.min.x;
+            temp.y = (bounds.min.y < tempBounds.min.y)? bounds.min.y : tempBounds.min.y;
+            temp.z = (bounds.min.z < tempBounds.min.z)? bounds.min.z : tempBounds.min.z;
+            bounds.min = temp;
+
+            temp.x = (bounds.max.x > tempBounds.max.x)? bounds.max.x : tempBounds.max.x;
+            temp.y = (bounds.max.y > tempBounds.max.y)? bounds.max.y : tempBounds.max.y;
+            temp.z = (bounds.max.z > tempBounds.max.z)? bounds.max.z : tempBounds.max.z;
+            bounds.max = temp;
+        }
     }
 
-    rlDisableVertexBuffer();
-    rlDisableVertexArray();
+    return bounds;
+}
 
-    // Accumulate internal matrix transform (push/pop) and view matrix
-    // NOTE: In this case, model instance transformation must be computed in the shader
-    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+// Upload vertex data into a VAO (if supported) and VBO
+void UploadMesh(Mesh *mesh, bool dynamic)
+{
+    if (mesh->vaoId > 0)
+    {
+        // Check if mesh has already been loaded in GPU
+        TRACELOG(LOG_WARNING, "VAO: [ID %i] Trying to re-load an already loaded mesh", mesh->vaoId);
+        return;
+    }
 
-    // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
-    //-----------------------------------------------------
+    UploadMeshPacked(mesh, dynamic, 0);
+}
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+// Upload vertex data into a VAO (if supported) and VBO, with packed vertex attributes
+// NOTE: Packed attributes are decoded by vertex fetch (normalized integers, half-float), no shader changes required,
+// packed positions are dequantized by draw transform (instances buffers transforms must include GetMeshPackedTransform()),
+// meshes skinned or morphed on CPU or GPU keep float positions and normals
+void UploadMeshPacked(Mesh *mesh, bool dynamic, unsigned int flags)
+{
+    // Mesh already uploaded, buffers are uploaded again with new packing
+    if (mesh->vboId != NULL)
     {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
+        if (mesh->morphTextureId > 0) rlUnloadTexture(mesh->morphTextureId);
+        mesh->morphTextureId = 0;
+    }
 
-            // Enable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
-            else rlEnableTexture(material.maps[i].texture.id);
+    if ((mesh->boneIds != NULL) || (mesh->animVertices != NULL) || (mesh->morphVertices != NULL)) flags &= ~(MESH_PACK_POSITIONS | MESH_PACK_NORMALS);
 
-            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
-        }
-    }
+    mesh->packFlags = 0;
+    mesh->packOffset = (Vector4){ 0.0f, 0.0f, 0.0f, 1.0f };
 
-    // Try binding vertex array objects (VAO)
-    // or use VBOs if not possible
-    if (!rlEnableVertexArray(mesh.vaoId))
+    mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+
+    // Dynamic meshes updates are registered as dirty ranges, uploaded on draw (UpdateMeshVertices()...)
+    mesh->vertexCapacity = mesh->vertexCount;
+    mesh->indexCapacity = (mesh->indices != NULL)? mesh->triangleCount*3 : 0;
+    for (int i = 1; (mesh->indices != NULL) && (i < mesh->lodCount); i++) mesh->indexCapacity += mesh->lodTriangles[i]*3;
+
+    if (dynamic && (mesh->dirtyRanges == NULL)) mesh->dirtyRanges = (int *)RL_CALLOC(MESH_DYNAMIC_BUFFERS*2, sizeof(int));
+    else if (!dynamic)
     {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+        RL_FREE(mesh->dirtyRanges);
+        mesh->dirtyRanges = NULL;
+    }
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+    mesh->vaoId = 0;        // Vertex Array Object
+    mesh->vboId[0] = 0;     // Vertex buffer: positions
+    mesh->vboId[1] = 0;     // Vertex buffer: texcoords
+    mesh->vboId[2] = 0;     // Vertex buffer: normals
+    mesh->vboId[3] = 0;     // Vertex buffer: colors
+    mesh->vboId[4] = 0;     // Vertex buffer: tangents
+    mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
+    mesh->vboId[6] = 0;     // Vertex buffer: indices
+    mesh->vboId[7] = 0;     // Vertex buffer: boneIds
+    mesh->vboId[8] = 0;     // Vertex buffer: boneWeights
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
-        {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
-        }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mesh->vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(mesh->vaoId);
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[3]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-        }
+    // NOTE: Vertex attributes must be uploaded considering default locations points and available vertex data
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
-        }
+    // Enable vertex attributes: position (shader-location = 0)
+    void *vertices = mesh->animVertices != NULL ? mesh->animVertices : mesh->vertices;
+    int dataSize = mesh->vertexCount*3*sizeof(float);
+    void *packed = LoadMeshPackedBuffer(mesh, 0, flags, &dataSize);
+    mesh->vboId[0] = rlLoadVertexBuffer((packed != NULL)? packed : vertices, dataSize, dynamic);
+    SetMeshVertexAttribute(*mesh, 0, 0);
+    rlEnableVertexAttribute(0);
+    RL_FREE(packed);
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[5]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
-        }
+    // Enable vertex attributes: texcoords (shader-location = 1)
+    dataSize = mesh->vertexCount*2*sizeof(float);
+    packed = LoadMeshPackedBuffer(mesh, 1, flags, &dataSize);
+    mesh->vboId[1] = rlLoadVertexBuffer((packed != NULL)? packed : mesh->texcoords, dataSize, dynamic);
+    SetMeshVertexAttribute(*mesh, 1, 1);
+    rlEnableVertexAttribute(1);
+    RL_FREE(packed);
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
-    }
+    // WARNING: When setting default vertex attribute values, the values for each generic vertex attribute
+    // is part of current state, and it is maintained even if a different program object is used
 
-    // WARNING: Disable vertex attribute color input if mesh can not provide that data (despite location being enabled in shader)
-    if (mesh.vboId[3] == 0) rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+    if (mesh->normals != NULL)
+    {
+        // Enable vertex attributes: normals (shader-location = 2)
+        void *normals = mesh->animNormals != NULL ? mesh->animNormals : mesh->normals;
+        dataSize = mesh->vertexCount*3*sizeof(float);
+        packed = LoadMeshPackedBuffer(mesh, 2, flags, &dataSize);
+        mesh->vboId[2] = rlLoadVertexBuffer((packed != NULL)? packed : normals, dataSize, dynamic);
+        SetMeshVertexAttribute(*mesh, 2, 2);
+        rlEnableVertexAttribute(2);
+        RL_FREE(packed);
+    }
+    else
+    {
+        // Default vertex attribute: normal
+        // WARNING: Default value provided to shader if location available
+        float value[3] = { 1.0f, 1.0f, 1.0f };
+        rlSetVertexAttributeDefault(2, value, SHADER_ATTRIB_VEC3, 3);
+        rlDisableVertexAttribute(2);
+    }
 
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+    if (mesh->colors != NULL)
+    {
+        // Enable vertex attribute: color (shader-location = 3)
+        mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+        rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+        rlEnableVertexAttribute(3);
+    }
+    else
+    {
+        // Default vertex attribute: color
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+        rlSetVertexAttributeDefault(3, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(3);
+    }
 
-    for (int eye = 0; eye < eyeCount; eye++)
+    if (mesh->tangents != NULL)
     {
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
-        {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
-        }
+        // Enable vertex attribute: tangent (shader-location = 4)
+        dataSize = mesh->vertexCount*4*sizeof(float);
+        packed = LoadMeshPackedBuffer(mesh, 4, flags, &dataSize);
+        mesh->vboId[4] = rlLoadVertexBuffer((packed != NULL)? packed : mesh->tangents, dataSize, dynamic);
+        SetMeshVertexAttribute(*mesh, 4, 4);
+        rlEnableVertexAttribute(4);
+        RL_FREE(packed);
+    }
+    else
+    {
+        // Default vertex attribute: tangent
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(4, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(4);
+    }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+    if (mesh->texcoords2 != NULL)
+    {
+        // Enable vertex attribute: texcoord2 (shader-location = 5)
+        dataSize = mesh->vertexCount*2*sizeof(float);
+        packed = LoadMeshPackedBuffer(mesh, 5, flags, &dataSize);
+        mesh->vboId[5] = rlLoadVertexBuffer((packed != NULL)? packed : mesh->texcoords2, dataSize, dynamic);
+        SetMeshVertexAttribute(*mesh, 5, 5);
+        rlEnableVertexAttribute(5);
+        RL_FREE(packed);
+    }
+    else
+    {
+        // Default vertex attribute: texcoord2
+        // WARNING: Default value provided to shader if location available
+        float value[2] = { 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(5, value, SHADER_ATTRIB_VEC2, 2);
+        rlDisableVertexAttribute(5);
+    }
 
-        // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        // Enable vertex attribute: boneIds (shader-location = 6)
+        // NOTE: Bones data is static, skinning is done on GPU with bones matrices (UpdateModelAnimationBones())
+        mesh->vboId[7] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), false);
+        rlSetVertexAttribute(6, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(6);
+
+        // Enable vertex attribute: boneWeights (shader-location = 7)
+        mesh->vboId[8] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), false);
+        rlSetVertexAttribute(7, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(7);
     }
 
-    // Unbind all bound texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    if (mesh->indices != NULL)
     {
-        if (material.maps[i].texture.id > 0)
+        // Mesh LOD levels indices are uploaded after mesh indices, levels are drawn as ranges of indices buffer
+        int indexCount = mesh->triangleCount*3;
+        int lodIndexCount = 0;
+        for (int i = 1; i < mesh->lodCount; i++) lodIndexCount += mesh->lodTriangles[i]*3;
+
+        if (lodIndexCount > 0)
         {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+            unsigned short *indices = (unsigned short *)RL_MALLOC((indexCount + lodIndexCount)*sizeof(unsigned short));
+            memcpy(indices, mesh->indices, indexCount*sizeof(unsigned short));
+            memcpy(indices + indexCount, mesh->lodIndices, lodIndexCount*sizeof(unsigned short));
 
-            // Disable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
+            mesh->vboId[6] = rlLoadVertexBufferElement(indices, (indexCount + lodIndexCount)*sizeof(unsigned short), dynamic);
+            RL_FREE(indices);
         }
+        else mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, indexCount*sizeof(unsigned short), dynamic);
     }
 
-    // Disable all possible vertex array objects (or VBOs)
+    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
+    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
+
     rlDisableVertexArray();
-    rlDisableVertexBuffer();
-    rlDisableVertexBufferElement();
+#endif
 
-    // Disable shader program
-    rlDisableShader();
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Morph targets deltas texture, vertices are morphed on GPU by morph weights (vertex shader texel fetch)
+    // NOTE: Every target is a texture tile (MESH_MORPH_TEXTURE_TILE texels wide), position and normal delta texels by vertex,
+    // meshes with more than MAX_MESH_MORPH_TARGETS targets are morphed on CPU
+    if ((mesh->morphVertices != NULL) && (mesh->morphCount <= MAX_MESH_MORPH_TARGETS))
+    {
+        int width = MESH_MORPH_TEXTURE_TILE*mesh->morphCount;
+        int height = (mesh->vertexCount*2 + MESH_MORPH_TEXTURE_TILE - 1)/MESH_MORPH_TEXTURE_TILE;
+        float *texels = (float *)RL_CALLOC(width*height*3, sizeof(float));
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+        for (int v = 0; v < mesh->vertexCount; v++)
+        {
+            for (int t = 0; t < mesh->morphCount; t++)
+            {
+                int texel = ((v*2)/MESH_MORPH_TEXTURE_TILE)*width + t*MESH_MORPH_TEXTURE_TILE + (v*2)%MESH_MORPH_TEXTURE_TILE;
+
+                memcpy(&texels[texel*3], &mesh->morphVertices[(v*mesh->morphCount + t)*3], 3*sizeof(float));
+                if (mesh->morphNormals != NULL) memcpy(&texels[(texel + 1)*3], &mesh->morphNormals[(v*mesh->morphCount + t)*3], 3*sizeof(float));
+            }
+        }
+
+        mesh->morphTextureId = rlLoadTexture(texels, width, height, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32, 1);
+        RL_FREE(texels);
+
+        if (mesh->morphTextureId == 0) TRACELOG(LOG_WARNING, "MESH: Failed to load morph targets texture, mesh morphed on CPU");
+    }
 #endif
 }
 
-// Unload mesh from memory (RAM and VRAM)
-void UnloadMesh(Mesh mesh)
+// Get mesh packed positions dequantization transform (identity if positions not packed)
+Matrix GetMeshPackedTransform(Mesh mesh)
 {
-    // Unload rlgl mesh vboId data
-    rlUnloadVertexArray(mesh.vaoId);
+    Matrix transform = MatrixIdentity();
 
-    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
-    RL_FREE(mesh.vboId);
-
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
+    if (mesh.packFlags & MESH_PACK_POSITIONS)
+    {
+        transform = MatrixMultiply(MatrixScale(mesh.packOffset.w, mesh.packOffset.w, mesh.packOffset.w),
+            MatrixTranslate(mesh.packOffset.x, mesh.packOffset.y, mesh.packOffset.z));
+    }
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
+    return transform;
 }
 
-// Export mesh data to file
-bool ExportMesh(Mesh mesh, const char *fileName)
+// Release mesh CPU vertex data not required after upload
+// NOTE: Attributes flagged in keepFlags are kept (MeshDataFlags), indices are always kept (indexed drawing),
+// skinned and morphed meshes keep positions, normals and animation data (CPU animation and bind pose restore),
+// released attributes can not be updated or exported anymore, GPU buffers are not changed
+void ReleaseMeshData(Mesh *mesh, unsigned int keepFlags)
 {
-    bool success = false;
+    if ((mesh == NULL) || (mesh->vboId == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh data can not be released, mesh not uploaded to GPU");
+        return;
+    }
 
-    if (IsFileExtension(fileName, ".obj"))
+    // NOTE: OpenGL 1.1 draws mesh vertex data from CPU arrays, dynamic meshes updates are uploaded from CPU data
+    if ((rlGetVersion() == RL_OPENGL_11) || (mesh->dirtyRanges != NULL))
     {
-        // Estimated data size, it should be enough...
-        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
-                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
-                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
-                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
-
-        // NOTE: Text data buffer size is estimated considering mesh data size
-        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
-
-        int byteCount = 0;
-        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // more info and bugs-report:  github.com/raysan5/raylib                        //\n");
-        byteCount += sprintf(txtData + byteCount, "# // feedback and support:       ray[at]raylib.com                                //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                          //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n\n");
-        byteCount += sprintf(txtData + byteCount, "# Vertex Count:     %i\n", mesh.vertexCount);
-        byteCount += sprintf(txtData + byteCount, "# Triangle Count:   %i\n\n", mesh.triangleCount);
-
-        byteCount += sprintf(txtData + byteCount, "g mesh\n");
-
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
-        {
-            byteCount += sprintf(txtData + byteCount, "v %.2f %.2f %.2f\n", mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2]);
-        }
-
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 2)
-        {
-            byteCount += sprintf(txtData + byteCount, "vt %.3f %.3f\n", mesh.texcoords[v], mesh.texcoords[v + 1]);
-        }
-
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
-        {
-            byteCount += sprintf(txtData + byteCount, "vn %.3f %.3f %.3f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
-        }
-
-        if (mesh.indices != NULL)
-        {
-            for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
-            {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
-                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
-                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
-                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
-            }
-        }
-        else
-        {
-            for (int i = 0, v = 1; i < mesh.triangleCount; i++, v += 3)
-            {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n", v, v, v, v + 1, v + 1, v + 1, v + 2, v + 2, v + 2);
-            }
-        }
+        TRACELOG(LOG_WARNING, "MESH: [VAO ID %i] Mesh data can not be released, required by dynamic meshes and OpenGL 1.1", mesh->vaoId);
+        return;
+    }
 
-        byteCount += sprintf(txtData + byteCount, "\n");
+    if ((mesh->boneIds != NULL) || (mesh->animVertices != NULL) || (mesh->morphVertices != NULL)) keepFlags |= (MESH_DATA_VERTICES | MESH_DATA_NORMALS);
 
-        // NOTE: Text data length exported is determined by '\0' (NULL) character
-        success = SaveFileText(fileName, txtData);
+    int releasedSize = 0;
 
-        RL_FREE(txtData);
-    }
-    else if (IsFileExtension(fileName, ".raw"))
+    if (!(keepFlags & MESH_DATA_VERTICES) && (mesh->vertices != NULL))
     {
-        // TODO: Support additional file formats to export mesh vertex data
+        RL_FREE(mesh->vertices);
+        mesh->vertices = NULL;
+        releasedSize += mesh->vertexCount*3*sizeof(float);
     }
 
-    return success;
-}
-
-#if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-// Process obj materials
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount)
-{
-    // Init model materials
-    for (int m = 0; m < materialCount; m++)
+    if (!(keepFlags & MESH_DATA_TEXCOORDS))
     {
-        // Init material to default
-        // NOTE: Uses default shader, which only supports MATERIAL_MAP_DIFFUSE
-        rayMaterials[m] = LoadMaterialDefault();
-
-        // Get default texture, in case no texture is defined
-        // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
-        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
-
-        if (materials[m].diffuse_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
-
-        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(materials[m].diffuse[0]*255.0f), (unsigned char)(materials[m].diffuse[1]*255.0f), (unsigned char)(materials[m].diffuse[2] * 255.0f), 255 }; //float diffuse[3];
-        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
-
-        if (materials[m].specular_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
-        rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(materials[m].specular[0]*255.0f), (unsigned char)(materials[m].specular[1]*255.0f), (unsigned char)(materials[m].specular[2] * 255.0f), 255 }; //float specular[3];
-        rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
+        if (mesh->texcoords != NULL) releasedSize += mesh->vertexCount*2*sizeof(float);
+        if (mesh->texcoords2 != NULL) releasedSize += mesh->vertexCount*2*sizeof(float);
+        RL_FREE(mesh->texcoords);
+        RL_FREE(mesh->texcoords2);
+        mesh->texcoords = NULL;
+        mesh->texcoords2 = NULL;
+    }
 
-        if (materials[m].bump_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
-        rayMaterials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
-        rayMaterials[m].maps[MATERIAL_MAP_NORMAL].value = materials[m].shininess;
+    if (!(keepFlags & MESH_DATA_NORMALS) && (mesh->normals != NULL))
+    {
+        RL_FREE(mesh->normals);
+        mesh->normals = NULL;
+        releasedSize += mesh->vertexCount*3*sizeof(float);
+    }
 
-        rayMaterials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(materials[m].emission[0]*255.0f), (unsigned char)(materials[m].emission[1]*255.0f), (unsigned char)(materials[m].emission[2] * 255.0f), 255 }; //float emission[3];
+    if (!(keepFlags & MESH_DATA_TANGENTS) && (mesh->tangents != NULL))
+    {
+        RL_FREE(mesh->tangents);
+        mesh->tangents = NULL;
+        releasedSize += mesh->vertexCount*4*sizeof(float);
+    }
 
-        if (materials[m].displacement_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
+    if (!(keepFlags & MESH_DATA_COLORS) && (mesh->colors != NULL))
+    {
+        RL_FREE(mesh->colors);
+        mesh->colors = NULL;
+        releasedSize += mesh->vertexCount*4*sizeof(unsigned char);
     }
+
+    TRACELOG(LOG_DEBUG, "MESH: [VAO ID %i] Mesh CPU data released (%i bytes)", mesh->vaoId, releasedSize);
 }
-#endif
 
-// Load materials from model file
-Material *LoadMaterials(const char *fileName, int *materialCount)
+// Set mesh morph targets weights
+// NOTE: Meshes morphed on GPU (morph targets texture) read weights on DrawMesh(), default shader is replaced by
+// default morphing shader, meshes are morphed on CPU otherwise and animated vertex data is uploaded to GPU
+void SetMeshMorphWeights(Mesh *mesh, const float *weights, int count)
 {
-    Material *materials = NULL;
-    unsigned int count = 0;
+    if ((mesh == NULL) || (mesh->morphWeights == NULL) || (weights == NULL)) return;
 
-    // TODO: Support IQM and GLTF for materials parsing
+    if (count > mesh->morphCount) count = mesh->morphCount;
+    memcpy(mesh->morphWeights, weights, count*sizeof(float));
 
-#if defined(SUPPORT_FILEFORMAT_MTL)
-    if (IsFileExtension(fileName, ".mtl"))
+    if ((mesh->morphTextureId == 0) && (mesh->morphVertices != NULL))
     {
-        tinyobj_material_t *mats = NULL;
+        if (mesh->animVertices == NULL) mesh->animVertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+        if ((mesh->animNormals == NULL) && (mesh->normals != NULL)) mesh->animNormals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
 
-        int result = tinyobj_parse_mtl_file(&mats, &count, fileName);
-        if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
-
-        materials = MemAlloc(count*sizeof(Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        MorphVertices(mesh, 0, mesh->vertexCount);
 
-        tinyobj_materials_free(mats, count);
+        if (mesh->vboId != NULL)
+        {
+            rlUpdateVertexBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float), 0);
+            if (mesh->animNormals != NULL) rlUpdateVertexBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float), 0);
+        }
     }
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load material file", fileName);
-#endif
-
-    *materialCount = count;
-    return materials;
 }
 
-// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
-Material LoadMaterialDefault(void)
+// Update mesh vertex data in GPU for a specific buffer index
+void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
-    Material material = { 0 };
-    material.maps = (MaterialMap *)RL_CALLOC(MAX_MATERIAL_MAPS, sizeof(MaterialMap));
-
-    // Using rlgl default shader
-    material.shader.id = rlGetShaderIdDefault();
-    material.shader.locs = rlGetShaderLocsDefault();
-
-    // Using rlgl default texture (1x1 pixel, UNCOMPRESSED_R8G8B8A8, 1 mipmap)
-    material.maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
-    //material.maps[MATERIAL_MAP_NORMAL].texture;         // NOTE: By default, not set
-    //material.maps[MATERIAL_MAP_SPECULAR].texture;       // NOTE: By default, not set
-
-    material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;    // Diffuse color
-    material.maps[MATERIAL_MAP_SPECULAR].color = WHITE;   // Specular color
-
-    return material;
+    rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
 }
 
-// Check if a material is ready
-bool IsMaterialReady(Material material)
+// Update mesh vertex positions range (first vertex and vertices count)
+// NOTE: Mesh CPU data is updated (data can be NULL if CPU data was already updated), dynamic meshes GPU
+// buffers are updated on next draw (dirty ranges), static meshes GPU buffers are updated right away
+void UpdateMeshVertices(Mesh *mesh, int first, int count, const Vector3 *vertices)
 {
-    return ((material.maps != NULL) &&      // Validate material contain some map
-            (material.shader.id > 0));      // Validate material shader is valid
+    UpdateMeshData(mesh, 0, first, count, vertices);
 }
 
-// Unload material from memory
-void UnloadMaterial(Material material)
+// Update mesh vertex normals range (first vertex and vertices count)
+void UpdateMeshNormals(Mesh *mesh, int first, int count, const Vector3 *normals)
 {
-    // Unload material shader (avoid unloading default shader, managed by raylib)
-    if (material.shader.id != rlGetShaderIdDefault()) UnloadShader(material.shader);
-
-    // Unload loaded texture maps (avoid unloading default texture, managed by raylib)
-    if (material.maps != NULL)
-    {
-        for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-        {
-            if (material.maps[i].texture.id != rlGetTextureIdDefault()) rlUnloadTexture(material.maps[i].texture.id);
-        }
-    }
-
-    RL_FREE(material.maps);
+    UpdateMeshData(mesh, 2, first, count, normals);
 }
 
-// Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
-// NOTE: Previous texture should be manually unloaded
-void SetMaterialTexture(Material *material, int mapType, Texture2D texture)
+// Update mesh vertex texture coordinates range (first vertex and vertices count)
+void UpdateMeshTexcoords(Mesh *mesh, int first, int count, const Vector2 *texcoords)
 {
-    material->maps[mapType].texture = texture;
+    UpdateMeshData(mesh, 1, first, count, texcoords);
 }
 
-// Set the material for a mesh
-void SetModelMeshMaterial(Model *model, int meshId, int materialId)
+// Update mesh vertex colors range (first vertex and vertices count)
+void UpdateMeshColors(Mesh *mesh, int first, int count, const Color *colors)
 {
-    if (meshId >= model->meshCount) TRACELOG(LOG_WARNING, "MESH: Id greater than mesh count");
-    else if (materialId >= model->materialCount) TRACELOG(LOG_WARNING, "MATERIAL: Id greater than material count");
-    else  model->meshMaterial[meshId] = materialId;
+    UpdateMeshData(mesh, 3, first, count, colors);
 }
 
-// Load model animations from file
-ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount)
+// Update mesh indices range (first index and indices count)
+void UpdateMeshIndices(Mesh *mesh, int first, int count, const unsigned short *indices)
 {
-    ModelAnimation *animations = NULL;
-
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) animations = LoadModelAnimationsIQM(fileName, animCount);
-#endif
-#if defined(SUPPORT_FILEFORMAT_M3D)
-    if (IsFileExtension(fileName, ".m3d")) animations = LoadModelAnimationsM3D(fileName, animCount);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
-#endif
-
-    return animations;
+    UpdateMeshData(mesh, 6, first, count, indices);
 }
 
-// Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
-void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
+// Resize mesh vertex data and triangles, GPU buffers capacity grows as required (data kept)
+// NOTE: New vertices and indices are zero-initialized, triangleCount is only used by indexed meshes,
+// mesh LOD levels are unloaded, morphed meshes can not be resized and packed meshes are uploaded again
+void ResizeMesh(Mesh *mesh, int vertexCount, int triangleCount)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
-    {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+    if ((mesh == NULL) || (vertexCount < 0) || (triangleCount < 0)) return;
 
-        for (int m = 0; m < model.meshCount; m++)
-        {
-            Mesh mesh = model.meshes[m];
+    if (mesh->morphVertices != NULL)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Morphed meshes can not be resized");
+        return;
+    }
 
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
-            {
-                TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Mesh %i has no connection to bones", m);
-                continue;
-            }
+    if (mesh->indices == NULL) triangleCount = vertexCount/3;
 
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+    // Resize CPU vertex data, new vertices zero-initialized
+    float **floatArrays[6] = { &mesh->vertices, &mesh->texcoords, &mesh->texcoords2, &mesh->normals, &mesh->animVertices, &mesh->animNormals };
+    int floatSizes[6] = { 3, 2, 2, 3, 3, 3 };
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
+    for (int i = 0; i < 6; i++)
+    {
+        if (*floatArrays[i] == NULL) continue;
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+        *floatArrays[i] = (float *)RL_REALLOC(*floatArrays[i], (vertexCount*floatSizes[i] + 1)*sizeof(float));
+        if (vertexCount > mesh->vertexCount) memset(*floatArrays[i] + mesh->vertexCount*floatSizes[i], 0, (vertexCount - mesh->vertexCount)*floatSizes[i]*sizeof(float));
+    }
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+    if (mesh->tangents != NULL)
+    {
+        mesh->tangents = (float *)RL_REALLOC(mesh->tangents, (vertexCount*4 + 1)*sizeof(float));
+        if (vertexCount > mesh->vertexCount) memset(mesh->tangents + mesh->vertexCount*4, 0, (vertexCount - mesh->vertexCount)*4*sizeof(float));
+    }
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-            {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+    if (mesh->boneWeights != NULL)
+    {
+        mesh->boneWeights = (float *)RL_REALLOC(mesh->boneWeights, (vertexCount*4 + 1)*sizeof(float));
+        if (vertexCount > mesh->vertexCount) memset(mesh->boneWeights + mesh->vertexCount*4, 0, (vertexCount - mesh->vertexCount)*4*sizeof(float));
+    }
 
-                if (mesh.animNormals != NULL)
-                {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
+    unsigned char **byteArrays[2] = { &mesh->colors, &mesh->boneIds };
+    for (int i = 0; i < 2; i++)
+    {
+        if (*byteArrays[i] == NULL) continue;
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
-            }
+        *byteArrays[i] = (unsigned char *)RL_REALLOC(*byteArrays[i], vertexCount*4 + 1);
+        if (vertexCount > mesh->vertexCount) memset(*byteArrays[i] + mesh->vertexCount*4, 0, (vertexCount - mesh->vertexCount)*4);
+    }
 
-            // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
-            {
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-            }
-        }
+    if (mesh->indices != NULL)
+    {
+        mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, (triangleCount*3 + 1)*sizeof(unsigned short));
+        if (triangleCount > mesh->triangleCount) memset(mesh->indices + mesh->triangleCount*3, 0, (triangleCount - mesh->triangleCount)*3*sizeof(unsigned short));
     }
-}
 
-// Unload animation array data
-void UnloadModelAnimations(ModelAnimation *animations, unsigned int count)
-{
-    for (unsigned int i = 0; i < count; i++) UnloadModelAnimation(animations[i]);
-    RL_FREE(animations);
-}
+    // LOD levels indices are not valid for resized mesh
+    RL_FREE(mesh->lodTriangles);
+    RL_FREE(mesh->lodErrors);
+    RL_FREE(mesh->lodIndices);
+    mesh->lodTriangles = NULL;
+    mesh->lodErrors = NULL;
+    mesh->lodIndices = NULL;
+    mesh->lodCount = 0;
+    mesh->lodLevel = 0;
 
-// Unload animation data
-void UnloadModelAnimation(ModelAnimation anim)
-{
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    int prevVertexCount = mesh->vertexCount;
+    int prevIndexCount = mesh->triangleCount*3;
+    mesh->vertexCount = vertexCount;
+    mesh->triangleCount = triangleCount;
 
-    RL_FREE(anim.bones);
-    RL_FREE(anim.framePoses);
-}
+    if (mesh->vboId == NULL) return;
 
-// Check model animation skeleton match
-// NOTE: Only number of bones and parent connections are checked
-bool IsModelAnimationValid(Model model, ModelAnimation anim)
-{
-    int result = true;
+    bool dynamic = (mesh->dirtyRanges != NULL);
 
-    if (model.boneCount != anim.boneCount) result = false;
-    else
+    if (mesh->packFlags != 0)
     {
-        for (int i = 0; i < model.boneCount; i++)
-        {
-            if (model.bones[i].parent != anim.bones[i].parent) { result = false; break; }
-        }
+        // Packed buffers are packed again from CPU data
+        UploadMeshPacked(mesh, dynamic, mesh->packFlags & MESH_PACK_ALL);
+        return;
     }
 
-    return result;
-}
-
-#if defined(SUPPORT_MESH_GENERATION)
-// Generate polygonal mesh
-Mesh GenMeshPoly(int sides, float radius)
-{
-    Mesh mesh = { 0 };
+    if (vertexCount > mesh->vertexCapacity)
+    {
+        // Vertex buffers storage reallocated with capacity doubled, buffers keep their ids (VAO state is kept)
+        int capacity = (mesh->vertexCapacity > 0)? mesh->vertexCapacity : 64;
+        while (capacity < vertexCount) capacity *= 2;
 
-    if (sides < 3) return mesh;
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++)
+        {
+            int stride = 0;
+            const void *data = GetMeshBufferData(*mesh, i, &stride);
 
-    int vertexCount = sides*3;
+            if ((i == 6) || (mesh->vboId[i] == 0) || (data == NULL)) continue;
 
-    // Vertices definition
-    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+            rlResizeVertexBuffer(mesh->vboId[i], capacity*stride, dynamic);
+            rlUpdateVertexBuffer(mesh->vboId[i], data, vertexCount*stride, 0);
+        }
 
-    float d = 0.0f, dStep = 360.0f/sides;
-    for (int v = 0; v < vertexCount; v += 3)
+        mesh->vertexCapacity = capacity;
+    }
+    else if (vertexCount > prevVertexCount)
     {
-        vertices[v] = (Vector3){ 0.0f, 0.0f, 0.0f };
-        vertices[v + 1] = (Vector3){ sinf(DEG2RAD*d)*radius, 0.0f, cosf(DEG2RAD*d)*radius };
-        vertices[v + 2] = (Vector3){sinf(DEG2RAD*(d+dStep))*radius, 0.0f, cosf(DEG2RAD*(d+dStep))*radius };
-        d += dStep;
+        for (int i = 0; i < 6; i++) if (mesh->vboId[i] != 0) UpdateMeshData(mesh, i, prevVertexCount, vertexCount - prevVertexCount, NULL);
     }
 
-    // Normals definition
-    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
-
-    // TexCoords definition
-    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-    for (int n = 0; n < vertexCount; n++) texcoords[n] = (Vector2){ 0.0f, 0.0f };
+    if ((mesh->indices != NULL) && (mesh->vboId[6] != 0))
+    {
+        if (triangleCount*3 > mesh->indexCapacity)
+        {
+            int capacity = (mesh->indexCapacity > 0)? mesh->indexCapacity : 192;
+            while (capacity < triangleCount*3) capacity *= 2;
 
-    mesh.vertexCount = vertexCount;
-    mesh.triangleCount = sides;
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+            rlResizeVertexBufferElements(mesh->vboId[6], capacity*sizeof(unsigned short), dynamic);
+            rlUpdateVertexBufferElements(mesh->vboId[6], mesh->indices, triangleCount*3*sizeof(unsigned short), 0);
 
-    // Mesh vertices position array
-    for (int i = 0; i < mesh.vertexCount; i++)
-    {
-        mesh.vertices[3*i] = vertices[i].x;
-        mesh.vertices[3*i + 1] = vertices[i].y;
-        mesh.vertices[3*i + 2] = vertices[i].z;
+            mesh->indexCapacity = capacity;
+        }
+        else if (triangleCount*3 > prevIndexCount) UpdateMeshData(mesh, 6, prevIndexCount, triangleCount*3 - prevIndexCount, NULL);
     }
+}
+
+// Draw a 3d mesh with material and transform
+void DrawMesh(Mesh mesh, Material material, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    #define GL_VERTEX_ARRAY         0x8074
+    #define GL_NORMAL_ARRAY         0x8075
+    #define GL_COLOR_ARRAY          0x8076
+    #define GL_TEXTURE_COORD_ARRAY  0x8078
+
+    rlEnableTexture(material.maps[MATERIAL_MAP_DIFFUSE].texture.id);
+
+    rlEnableStatePointer(GL_VERTEX_ARRAY, mesh.vertices);
+    rlEnableStatePointer(GL_TEXTURE_COORD_ARRAY, mesh.texcoords);
+    rlEnableStatePointer(GL_NORMAL_ARRAY, mesh.normals);
+    rlEnableStatePointer(GL_COLOR_ARRAY, mesh.colors);
+
+    rlPushMatrix();
+        rlMultMatrixf(MatrixToFloat(transform));
+        rlColor4ub(material.maps[MATERIAL_MAP_DIFFUSE].color.r,
+                   material.maps[MATERIAL_MAP_DIFFUSE].color.g,
+                   material.maps[MATERIAL_MAP_DIFFUSE].color.b,
+                   material.maps[MATERIAL_MAP_DIFFUSE].color.a);
 
-    // Mesh texcoords array
-    for (int i = 0; i < mesh.vertexCount; i++)
+        int indexCount = 0;
+        int indexOffset = GetMeshLODIndices(mesh, &indexCount);
+
+        if (indexOffset > 0) rlDrawVertexArrayElements(indexOffset - mesh.triangleCount*3, indexCount, mesh.lodIndices);
+        else if (mesh.indices != NULL) rlDrawVertexArrayElements(0, indexCount, mesh.indices);
+        else rlDrawVertexArray(0, mesh.vertexCount);
+    rlPopMatrix();
+
+    rlDisableStatePointer(GL_VERTEX_ARRAY);
+    rlDisableStatePointer(GL_TEXTURE_COORD_ARRAY);
+    rlDisableStatePointer(GL_NORMAL_ARRAY);
+    rlDisableStatePointer(GL_COLOR_ARRAY);
+
+    rlDisableTexture();
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Packed positions are dequantized by model transform
+    if (mesh.packFlags & MESH_PACK_POSITIONS) transform = MatrixMultiply(GetMeshPackedTransform(mesh), transform);
+
+    // Shadow casters drawn with depth shaders (BeginShadowMode()), queued meshes use instancing depth shader
+    if (shadowModeActive)
     {
-        mesh.texcoords[2*i] = texcoords[i].x;
-        mesh.texcoords[2*i + 1] = texcoords[i].y;
+        if ((mesh.morphTextureId > 0) && LoadShaderMorph()) material.shader = (mesh.boneMatrices != NULL)? morphSkinningShader : morphShader;
+        else if ((mesh.boneMatrices != NULL) && (skinningShader.id > 0)) material.shader = skinningShader;
+        else material.shader = (meshQueueActive && (shadowShaderInstancing.id > 0))? shadowShaderInstancing : shadowShader;
+        material.maps = shadowMaterialMaps;
     }
 
-    // Mesh normals array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Mesh draw queued between BeginMeshQueue() and EndMeshQueue(), skinned and GPU morphed meshes are drawn immediately
+    // NOTE: Skinned meshes pose or morph weights could change before queue is submitted (UpdateModelAnimation())
+    if (meshQueueActive && (mesh.boneWeights == NULL) && (mesh.morphTextureId == 0))
     {
-        mesh.normals[3*i] = normals[i].x;
-        mesh.normals[3*i + 1] = normals[i].y;
-        mesh.normals[3*i + 2] = normals[i].z;
+        QueueMesh(mesh, material, transform);
+        return;
     }
 
-    RL_FREE(vertices);
-    RL_FREE(normals);
-    RL_FREE(texcoords);
+    // Mesh skinned on GPU (UpdateModelAnimationBones()) drawn with default shader uses default skinning shader
+    // NOTE: Custom shaders must declare boneMatrices uniform and bones vertex attributes to skin the mesh
+    if ((mesh.boneMatrices != NULL) && (skinningShader.id > 0) &&
+        (material.shader.id == rlGetShaderIdDefault())) material.shader = skinningShader;
 
-    // Upload vertex data to GPU (static mesh)
-    // NOTE: mesh.vboId array is allocated inside UploadMesh()
-    UploadMesh(&mesh, false);
+    // Mesh morphed on GPU drawn with default shader uses default morphing shader (GPU skinning supported)
+    // NOTE: Custom shaders must declare morphWeights uniform and morphTargets sampler to morph the mesh
+    if ((mesh.morphTextureId > 0) && ((material.shader.id == rlGetShaderIdDefault()) || (material.shader.id == skinningShader.id)) &&
+        LoadShaderMorph()) material.shader = (mesh.boneMatrices != NULL)? morphSkinningShader : morphShader;
 
-    return mesh;
+    // Get a copy of current matrices to work with,
+    // just in case stereo render is required, and we need to modify them
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    // That's because BeginMode3D() sets it and there is no model-drawing function
+    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+
+    // Bind shader program, material values and texture maps and mesh vertex data
+    EnableMeshShader(material.shader, matView, matProjection);
+    EnableMeshMaterial(material);
+    EnableMeshVertexArray(mesh, material.shader);
+
+    // Send model transformation to shader and draw mesh
+    DrawMeshVertexArray(mesh, material, transform, matView, matProjection);
+
+    // Unbind all bound texture maps
+    DisableMeshMaterial(material);
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Disable shader program
+    rlDisableShader();
+
+    // Restore rlgl internal modelview and projection matrices
+    rlSetMatrixModelview(matView);
+    rlSetMatrixProjection(matProjection);
+#endif
 }
 
-// Generate plane mesh (with subdivisions)
-Mesh GenMeshPlane(float width, float length, int resX, int resZ)
+// Begin mesh draws queue, DrawMesh() calls are queued until EndMeshQueue()
+// NOTE: Meshes drawn by DrawModel() functions are queued too, except skinned meshes (drawn immediately)
+void BeginMeshQueue(void)
 {
-    Mesh mesh = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (meshQueueActive) TRACELOG(LOG_WARNING, "MESH: Mesh queue already active");
+
+    meshQueueActive = true;
+#endif
+}
 
-#define CUSTOM_MESH_GEN_PLANE
-#if defined(CUSTOM_MESH_GEN_PLANE)
-    resX++;
-    resZ++;
+// End mesh draws queue, queued meshes are sorted and drawn with minimal state changes
+// NOTE: Draws are sorted by shader, material and mesh (draws order is not kept, intended for opaque meshes),
+// same mesh and material draws are instanced if shader provides instanceTransform attribute (SHADER_LOC_INSTANCE_TRANSFORM),
+// current view and projection matrices are used for all draws, materials maps are read at this point
+void EndMeshQueue(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!meshQueueActive) return;
 
-    // Vertices definition
-    int vertexCount = resX*resZ; // vertices get reused for the faces
+    meshQueueActive = false;
+    if (meshQueueCount == 0) return;
 
-    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int z = 0; z < resZ; z++)
+    for (int i = 0; i < meshQueueCount; i++) meshQueueOrder[i] = i;
+    qsort(meshQueueOrder, meshQueueCount, sizeof(int), CompareMeshQueueEntries);
+
+    // Instances transforms are uploaded once in submission order for all instancing shaders draws
+    int instances = 0;
+    for (int i = 0; i < meshQueueCount; i++) if (meshQueue[i].material.shader.locs[SHADER_LOC_INSTANCE_TRANSFORM] != -1) instances++;
+
+    bool instancing = ((instances > 0) && LoadInstanceBufferDefault(instances));
+
+    if (instancing)
     {
-        // [-length/2, length/2]
-        float zPos = ((float)z/(resZ - 1) - 0.5f)*length;
-        for (int x = 0; x < resX; x++)
+        for (int i = 0, k = 0; i < meshQueueCount; i++)
         {
-            // [-width/2, width/2]
-            float xPos = ((float)x/(resX - 1) - 0.5f)*width;
-            vertices[x + z*resX] = (Vector3){ xPos, 0.0f, zPos };
+            const MeshQueueEntry *entry = &meshQueue[meshQueueOrder[i]];
+            if (entry->material.shader.locs[SHADER_LOC_INSTANCE_TRANSFORM] != -1) instanceTransforms[k++] = MatrixToFloatV(entry->transform);
         }
+
+        rlUpdateVertexBuffer(instanceBuffer.id, instanceTransforms, instances*sizeof(float16), 0);
     }
 
-    // Normals definition
-    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
+    MeshInstanceBuffer buffer = { instanceBuffer.id, instances };   // No instances colors or attributes
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+
+    // Queued transforms already include rlgl internal transform
+    rlPushMatrix();
+    rlLoadIdentity();
+
+    const MeshQueueEntry *shaderEntry = NULL;       // Entry with current shader bound
+    const MeshQueueEntry *materialEntry = NULL;     // Entry with current material bound
+    const MeshQueueEntry *meshEntry = NULL;         // Entry with current mesh vertex data bound
+    Color materialColor = { 0 };                    // Current material diffuse color to restore
+    int first = 0;
 
-    // TexCoords definition
-    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-    for (int v = 0; v < resZ; v++)
+    for (int i = 0; i < meshQueueCount;)
     {
-        for (int u = 0; u < resX; u++)
+        const MeshQueueEntry *entry = &meshQueue[meshQueueOrder[i]];
+
+        // Shader changed, material and mesh are bound again
+        if ((shaderEntry == NULL) || (entry->material.shader.id != shaderEntry->material.shader.id))
+        {
+            EnableMeshShader(entry->material.shader, matView, matProjection);
+            shaderEntry = entry;
+            meshEntry = NULL;
+
+            if (materialEntry != NULL)
+            {
+                DisableMeshMaterial(materialEntry->material);
+                materialEntry->material.maps[MATERIAL_MAP_DIFFUSE].color = materialColor;
+                materialEntry = NULL;
+            }
+        }
+
+        // Material changed, queued diffuse color is set on material while bound
+        if ((materialEntry == NULL) || (entry->material.maps != materialEntry->material.maps) ||
+            (memcmp(&entry->color, &materialEntry->color, sizeof(Color)) != 0))
+        {
+            if (materialEntry != NULL)
+            {
+                DisableMeshMaterial(materialEntry->material);
+                materialEntry->material.maps[MATERIAL_MAP_DIFFUSE].color = materialColor;
+            }
+
+            materialColor = entry->material.maps[MATERIAL_MAP_DIFFUSE].color;
+            entry->material.maps[MATERIAL_MAP_DIFFUSE].color = entry->color;
+            EnableMeshMaterial(entry->material);
+            materialEntry = entry;
+        }
+
+        if (entry->material.shader.locs[SHADER_LOC_INSTANCE_TRANSFORM] != -1)
+        {
+            // Same mesh and material draws are drawn as instances
+            int count = 1;
+            while (((i + count) < meshQueueCount) && (meshQueue[meshQueueOrder[i + count]].mesh.vboId == entry->mesh.vboId) &&
+                (meshQueue[meshQueueOrder[i + count]].mesh.lodLevel == entry->mesh.lodLevel) &&
+                (meshQueue[meshQueueOrder[i + count]].material.maps == entry->material.maps) &&
+                (meshQueue[meshQueueOrder[i + count]].material.shader.id == entry->material.shader.id) &&
+                (memcmp(&meshQueue[meshQueueOrder[i + count]].color, &entry->color, sizeof(Color)) == 0)) count++;
+
+            if (instancing) DrawMeshInstancedArray(entry->mesh, entry->material, buffer, first, count, 0, matView, matProjection);
+
+            first += count;
+            i += count;
+            meshEntry = NULL;
+        }
+        else
         {
-            texcoords[u + v*resX] = (Vector2){ (float)u/(resX - 1), (float)v/(resZ - 1) };
+            if ((meshEntry == NULL) || (entry->mesh.vboId != meshEntry->mesh.vboId)) EnableMeshVertexArray(entry->mesh, entry->material.shader);
+            meshEntry = entry;
+
+            DrawMeshVertexArray(entry->mesh, entry->material, entry->transform, matView, matProjection);
+            i++;
         }
     }
 
-    // Triangles definition (indices)
-    int numFaces = (resX - 1)*(resZ - 1);
-    int *triangles = (int *)RL_MALLOC(numFaces*6*sizeof(int));
-    int t = 0;
-    for (int face = 0; face < numFaces; face++)
+    if (materialEntry != NULL)
     {
-        // Retrieve lower left corner from face ind
-        int i = face % (resX - 1) + (face/(resZ - 1)*resX);
+        DisableMeshMaterial(materialEntry->material);
+        materialEntry->material.maps[MATERIAL_MAP_DIFFUSE].color = materialColor;
+    }
 
-        triangles[t++] = i + resX;
-        triangles[t++] = i + 1;
-        triangles[t++] = i;
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
 
-        triangles[t++] = i + resX;
-        triangles[t++] = i + resX + 1;
-        triangles[t++] = i + 1;
-    }
+    // Disable shader program
+    rlDisableShader();
 
-    mesh.vertexCount = vertexCount;
-    mesh.triangleCount = numFaces*2;
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+    rlPopMatrix();
+
+    // Restore rlgl internal modelview and projection matrices
+    rlSetMatrixModelview(matView);
+    rlSetMatrixProjection(matProjection);
+
+    meshQueueCount = 0;
+#endif
+}
+
+// Draw multiple mesh instances with material and different transforms
+// NOTE: Instances transforms are uploaded to an internal buffer kept between draws,
+// use LoadMeshInstanceBuffer() and DrawMeshInstancedBuffer() for transforms not changing every frame
+void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((transforms == NULL) || !LoadInstanceBufferDefault(instances)) return;
+
+    // Packed positions are dequantized by instances transforms
+    UploadInstanceTransforms(transforms, instances, GetMeshPackedTransform(mesh));
+
+    MeshInstanceBuffer buffer = { instanceBuffer.id, instances };   // No instances colors or attributes
+    DrawMeshInstancedVbo(mesh, material, buffer, 0, instances, 0);
+#endif
+}
+
+// Load mesh instances transforms buffer into GPU
+// NOTE: Transforms are stored as float16 arrays, if transforms is NULL buffer is allocated but not initialized
+MeshInstanceBuffer LoadMeshInstanceBuffer(const Matrix *transforms, int instances, bool dynamic)
+{
+    MeshInstanceBuffer buffer = { 0 };
 
-    // Mesh vertices position array
-    for (int i = 0; i < mesh.vertexCount; i++)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instances <= 0) return buffer;
+
+    float16 *instanceTransforms = NULL;
+
+    if (transforms != NULL)
     {
-        mesh.vertices[3*i] = vertices[i].x;
-        mesh.vertices[3*i + 1] = vertices[i].y;
-        mesh.vertices[3*i + 2] = vertices[i].z;
+        // Fill buffer with instances transformations as float16 arrays
+        instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
+        for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
     }
 
-    // Mesh texcoords array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    buffer.id = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), dynamic);
+    buffer.instanceCount = (buffer.id > 0)? instances : 0;
+
+    RL_FREE(instanceTransforms);
+#endif
+
+    return buffer;
+}
+
+// Update mesh instances transforms buffer (partial update)
+// NOTE: Only the [offset, offset + count) instances range is uploaded
+void UpdateMeshInstanceBuffer(MeshInstanceBuffer buffer, const Matrix *transforms, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.id == 0) || (transforms == NULL) || (offset < 0) || (count <= 0)) return;
+
+    if ((offset + count) > buffer.instanceCount)
     {
-        mesh.texcoords[2*i] = texcoords[i].x;
-        mesh.texcoords[2*i + 1] = texcoords[i].y;
+        TRACELOG(LOG_WARNING, "MESH: Instance buffer update out of bounds (%i/%i), clamped", offset + count, buffer.instanceCount);
+        count = buffer.instanceCount - offset;
+        if (count <= 0) return;
     }
 
-    // Mesh normals array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    float16 *instanceTransforms = (float16 *)RL_MALLOC(count*sizeof(float16));
+    for (int i = 0; i < count; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+
+    rlUpdateVertexBuffer(buffer.id, instanceTransforms, count*sizeof(float16), offset*sizeof(float16));
+
+    RL_FREE(instanceTransforms);
+#endif
+}
+
+// Update mesh instances colors (partial update)
+// NOTE: Colors buffer is loaded on first update for all buffer instances, colors are
+// sent to shader attribute location SHADER_LOC_INSTANCE_COLOR (normalized, default: WHITE)
+void UpdateMeshInstanceColors(MeshInstanceBuffer *buffer, const Color *colors, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer == NULL) || (buffer->id == 0) || (colors == NULL) || (offset < 0) || (count <= 0)) return;
+
+    if ((offset + count) > buffer->instanceCount)
     {
-        mesh.normals[3*i] = normals[i].x;
-        mesh.normals[3*i + 1] = normals[i].y;
-        mesh.normals[3*i + 2] = normals[i].z;
+        TRACELOG(LOG_WARNING, "MESH: Instance colors update out of bounds (%i/%i), clamped", offset + count, buffer->instanceCount);
+        count = buffer->instanceCount - offset;
+        if (count <= 0) return;
     }
 
-    // Mesh indices array initialization
-    for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = triangles[i];
+    if (buffer->colorsId == 0) buffer->colorsId = rlLoadVertexBuffer(NULL, buffer->instanceCount*sizeof(Color), true);
 
-    RL_FREE(vertices);
-    RL_FREE(normals);
-    RL_FREE(texcoords);
-    RL_FREE(triangles);
+    rlUpdateVertexBuffer(buffer->colorsId, colors, count*sizeof(Color), offset*sizeof(Color));
+#endif
+}
 
-#else       // Use par_shapes library to generate plane mesh
+// Update mesh instances custom attribute (partial update)
+// NOTE: Every attribute is stored in its own buffer (float, 1..4 components per instance), loaded on
+// first update for all buffer instances, values are sent to shader attribute location attribLoc
+void UpdateMeshInstanceAttribute(MeshInstanceBuffer *buffer, int attribLoc, const float *values, int components, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer == NULL) || (buffer->id == 0) || (values == NULL) || (attribLoc < 0) || (offset < 0) || (count <= 0)) return;
 
-    par_shapes_mesh *plane = par_shapes_create_plane(resX, resZ);   // No normals/texcoords generated!!!
-    par_shapes_scale(plane, width, length, 1.0f);
-    par_shapes_rotate(plane, -PI/2.0f, (float[]){ 1, 0, 0 });
-    par_shapes_translate(plane, -width/2, 0.0f, length/2);
+    if ((components < 1) || (components > 4))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Instance attribute components not supported (%i)", components);
+        return;
+    }
 
-    mesh.vertices = (float *)RL_MALLOC(plane->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(plane->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(plane->ntriangles*3*3*sizeof(float));
+    if ((offset + count) > buffer->instanceCount)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Instance attribute update out of bounds (%i/%i), clamped", offset + count, buffer->instanceCount);
+        count = buffer->instanceCount - offset;
+        if (count <= 0) return;
+    }
 
-    mesh.vertexCount = plane->ntriangles*3;
-    mesh.triangleCount = plane->ntriangles;
+    // Look for attribute buffer already loaded for location, or a free one
+    int index = -1;
+    for (int i = 0; i < 4; i++)
+    {
+        if ((buffer->attribIds[i] > 0) && (buffer->attribLocs[i] == attribLoc)) { index = i; break; }
+    }
 
-    for (int k = 0; k < mesh.vertexCount; k++)
+    if (index == -1)
     {
-        mesh.vertices[k*3] = plane->points[plane->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = plane->points[plane->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = plane->points[plane->triangles[k]*3 + 2];
+        for (int i = 0; i < 4; i++)
+        {
+            if (buffer->attribIds[i] == 0)
+            {
+                buffer->attribIds[i] = rlLoadVertexBuffer(NULL, buffer->instanceCount*components*sizeof(float), true);
+                buffer->attribLocs[i] = attribLoc;
+                buffer->attribSizes[i] = components;
+                index = i;
+                break;
+            }
+        }
+    }
+
+    if (index == -1) TRACELOG(LOG_WARNING, "MESH: Instance attributes limit reached (4), location %i not updated", attribLoc);
+    else if (buffer->attribSizes[index] != components) TRACELOG(LOG_WARNING, "MESH: Instance attribute components mismatch (%i/%i), location %i not updated", components, buffer->attribSizes[index], attribLoc);
+    else rlUpdateVertexBuffer(buffer->attribIds[index], values, count*components*sizeof(float), offset*components*sizeof(float));
+#endif
+}
+
+// Unload mesh instances buffers from GPU (transforms, colors and attributes)
+void UnloadMeshInstanceBuffer(MeshInstanceBuffer buffer)
+{
+    rlUnloadVertexBuffer(buffer.id);
+    rlUnloadVertexBuffer(buffer.colorsId);
+    for (int i = 0; i < 4; i++) rlUnloadVertexBuffer(buffer.attribIds[i]);
+}
+
+// Draw multiple mesh instances with material and transforms stored in GPU buffer
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, MeshInstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instances > buffer.instanceCount) instances = buffer.instanceCount;
+    if ((buffer.id == 0) || (instances <= 0)) return;
+
+    DrawMeshInstancedVbo(mesh, material, buffer, 0, instances, 0);
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_43)
+// Mesh instances frustum culling compute shader
+// NOTE: Instance bounding box corners are tested in clip space, instance is culled if all corners
+// are outside of the same frustum plane, visible transforms are compacted with an atomic counter
+// stored as instanceCount of indirect draw arguments
+static const char *cullInstancesShaderCode =
+    "#version 430                                       \n"
+    "layout(local_size_x = 64) in;                      \n"
+    "layout(std430, binding = 0) readonly buffer Instances { mat4 instances[]; };       \n"
+    "layout(std430, binding = 1) writeonly buffer Visible { mat4 visible[]; };          \n"
+    "layout(std430, binding = 2) buffer Args { uint count; uint instanceCount; uint first; int baseVertex; uint baseInstance; } args; \n"
+    "uniform mat4 viewProjection;                       \n"
+    "uniform vec3 boundsMin;                            \n"
+    "uniform vec3 boundsMax;                            \n"
+    "uniform int totalInstances;                        \n"
+    "void main()                                        \n"
+    "{                                                  \n"
+    "    uint id = gl_GlobalInvocationID.x;             \n"
+    "    if (id >= uint(totalInstances)) return;        \n"
+    "    mat4 transform = instances[id];                \n"
+    "    mat4 mvp = viewProjection*transform;           \n"
+    "    ivec3 outsideMin = ivec3(0);                   \n"
+    "    ivec3 outsideMax = ivec3(0);                   \n"
+    "    for (int i = 0; i < 8; i++)                    \n"
+    "    {                                              \n"
+    "        vec3 corner = vec3(((i & 1) != 0)? boundsMax.x : boundsMin.x, ((i & 2) != 0)? boundsMax.y : boundsMin.y, ((i & 4) != 0)? boundsMax.z : boundsMin.z); \n"
+    "        vec4 clip = mvp*vec4(corner, 1.0);         \n"
+    "        outsideMin += ivec3(lessThan(clip.xyz, vec3(-clip.w)));                        \n"
+    "        outsideMax += ivec3(greaterThan(clip.xyz, vec3(clip.w)));                      \n"
+    "    }                                              \n"
+    "    if (any(equal(outsideMin, ivec3(8))) || any(equal(outsideMax, ivec3(8)))) return; \n"
+    "    uint index = atomicAdd(args.instanceCount, 1u);\n"
+    "    visible[index] = transform;                    \n"
+    "}                                                  \n";
+#endif
+
+// Load mesh instances GPU frustum culler
+// NOTE: Visible instances buffer is allocated for maxInstances, mesh bounding box is computed from mesh vertex data
+MeshInstanceCuller LoadMeshInstanceCuller(Mesh mesh, int maxInstances)
+{
+    MeshInstanceCuller culler = { 0 };
 
-        mesh.normals[k*3] = plane->normals[plane->triangles[k]*3];
-        mesh.normals[k*3 + 1] = plane->normals[plane->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = plane->normals[plane->triangles[k]*3 + 2];
+#if defined(GRAPHICS_API_OPENGL_43)
+    unsigned int shader = rlCompileShader(cullInstancesShaderCode, RL_COMPUTE_SHADER);
+    culler.shaderId = rlLoadComputeShaderProgram(shader);
 
-        mesh.texcoords[k*2] = plane->tcoords[plane->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = plane->tcoords[plane->triangles[k]*2 + 1];
+    if ((culler.shaderId > 0) && (maxInstances > 0))
+    {
+        culler.visible.id = rlLoadShaderBuffer(maxInstances*sizeof(float16), NULL, RL_DYNAMIC_COPY);
+        culler.visible.instanceCount = maxInstances;
+        culler.argsId = rlLoadShaderBuffer(sizeof(rlDrawIndirectCommand), NULL, RL_DYNAMIC_COPY);
+        culler.bounds = GetMeshBoundingBox(mesh);
+        culler.elementCount = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount;
     }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to load instances culler");
+#else
+    TRACELOG(LOG_WARNING, "MESH: Instances GPU culling requires OpenGL 4.3");
+#endif
+
+    return culler;
+}
 
-    par_shapes_free_mesh(plane);
+// Unload mesh instances GPU frustum culler
+void UnloadMeshInstanceCuller(MeshInstanceCuller culler)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    rlUnloadShaderBuffer(culler.visible.id);
+    rlUnloadShaderBuffer(culler.argsId);
+    if (culler.shaderId > 0) rlUnloadShaderProgram(culler.shaderId);
 #endif
+}
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+// Cull mesh instances against current camera frustum
+// NOTE: Frustum is derived from current modelview and projection matrices (BeginMode3D()),
+// rlgl internal transform (push/pop) is applied to instances like DrawMeshInstanced()
+void CullMeshInstances(MeshInstanceCuller culler, MeshInstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if ((culler.shaderId == 0) || (buffer.id == 0)) return;
 
-    return mesh;
+    if (instances > buffer.instanceCount) instances = buffer.instanceCount;
+    if (instances > culler.visible.instanceCount) instances = culler.visible.instanceCount;
+
+    // Reset indirect draw arguments, visible instances are counted by culling pass
+    rlDrawIndirectCommand args = { (unsigned int)culler.elementCount, 0, 0, 0, 0 };
+    rlUpdateShaderBuffer(culler.argsId, &args, sizeof(rlDrawIndirectCommand), 0);
+
+    if (instances <= 0) return;
+
+    Matrix matViewProjection = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+    int totalInstances = instances;
+
+    rlEnableShader(culler.shaderId);
+    rlSetUniformMatrix(rlGetLocationUniform(culler.shaderId, "viewProjection"), matViewProjection);
+    rlSetUniform(rlGetLocationUniform(culler.shaderId, "boundsMin"), &culler.bounds.min, SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(rlGetLocationUniform(culler.shaderId, "boundsMax"), &culler.bounds.max, SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(rlGetLocationUniform(culler.shaderId, "totalInstances"), &totalInstances, SHADER_UNIFORM_INT, 1);
+
+    rlBindShaderBuffer(buffer.id, 0);
+    rlBindShaderBuffer(culler.visible.id, 1);
+    rlBindShaderBuffer(culler.argsId, 2);
+
+    rlComputeShaderDispatch((unsigned int)(totalInstances + 63)/64, 1, 1);
+    rlComputeShaderBarrier();
+
+    rlDisableShader();
+#endif
 }
 
-// Generated cuboid mesh
-Mesh GenMeshCube(float width, float height, float length)
+// Draw mesh instances visible after last CullMeshInstances()
+// NOTE: Instances count is read by GPU from indirect draw arguments, no CPU readback
+void DrawMeshInstancedCulled(Mesh mesh, Material material, MeshInstanceCuller culler)
 {
-    Mesh mesh = { 0 };
+#if defined(GRAPHICS_API_OPENGL_43)
+    if ((culler.visible.id == 0) || (culler.argsId == 0)) return;
 
-#define CUSTOM_MESH_GEN_CUBE
-#if defined(CUSTOM_MESH_GEN_CUBE)
-    float vertices[] = {
-        -width/2, -height/2, length/2,
-        width/2, -height/2, length/2,
-        width/2, height/2, length/2,
-        -width/2, height/2, length/2,
-        -width/2, -height/2, -length/2,
-        -width/2, height/2, -length/2,
-        width/2, height/2, -length/2,
-        width/2, -height/2, -length/2,
-        -width/2, height/2, -length/2,
-        -width/2, height/2, length/2,
-        width/2, height/2, length/2,
-        width/2, height/2, -length/2,
-        -width/2, -height/2, -length/2,
-        width/2, -height/2, -length/2,
-        width/2, -height/2, length/2,
-        -width/2, -height/2, length/2,
-        width/2, -height/2, -length/2,
-        width/2, height/2, -length/2,
-        width/2, height/2, length/2,
-        width/2, -height/2, length/2,
-        -width/2, -height/2, -length/2,
-        -width/2, -height/2, length/2,
-        -width/2, height/2, length/2,
-        -width/2, height/2, -length/2
-    };
+    DrawMeshInstancedVbo(mesh, material, culler.visible, 0, culler.visible.instanceCount, culler.argsId);
+#endif
+}
 
-    float texcoords[] = {
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f
-    };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw mesh instances from instances buffer (transforms, colors and custom attributes)
+// NOTE: If args buffer is provided, instances count is read from it (indirect draw, OpenGL 4.3)
+static void DrawMeshInstancedVbo(Mesh mesh, Material material, MeshInstanceBuffer buffer, int first, int instances, unsigned int argsBufferId)
+{
+    // Shadow casters instances drawn with instancing depth shader (BeginShadowMode())
+    if (shadowModeActive)
+    {
+        if (shadowShaderInstancing.id == 0) return;
 
-    float normals[] = {
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f
-    };
+        material.shader = shadowShaderInstancing;
+        material.maps = shadowMaterialMaps;
+    }
 
-    mesh.vertices = (float *)RL_MALLOC(24*3*sizeof(float));
-    memcpy(mesh.vertices, vertices, 24*3*sizeof(float));
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
 
-    mesh.texcoords = (float *)RL_MALLOC(24*2*sizeof(float));
-    memcpy(mesh.texcoords, texcoords, 24*2*sizeof(float));
+    // Bind shader program, material values and texture maps
+    EnableMeshShader(material.shader, matView, matProjection);
+    EnableMeshMaterial(material);
 
-    mesh.normals = (float *)RL_MALLOC(24*3*sizeof(float));
-    memcpy(mesh.normals, normals, 24*3*sizeof(float));
+    // Attach instances buffer to mesh vertex data and draw mesh instances
+    DrawMeshInstancedArray(mesh, material, buffer, first, instances, argsBufferId, matView, matProjection);
 
-    mesh.indices = (unsigned short *)RL_MALLOC(36*sizeof(unsigned short));
+    // Unbind all bound texture maps
+    DisableMeshMaterial(material);
 
-    int k = 0;
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
 
-    // Indices can be initialized right now
-    for (int i = 0; i < 36; i += 6)
-    {
-        mesh.indices[i] = 4*k;
-        mesh.indices[i + 1] = 4*k + 1;
-        mesh.indices[i + 2] = 4*k + 2;
-        mesh.indices[i + 3] = 4*k;
-        mesh.indices[i + 4] = 4*k + 2;
-        mesh.indices[i + 5] = 4*k + 3;
+    // Disable shader program
+    rlDisableShader();
+}
 
-        k++;
-    }
+// Enable mesh shader program and upload view and projection matrices (if locations available)
+static void EnableMeshShader(Shader shader, Matrix matView, Matrix matProjection)
+{
+    // Bind shader program
+    rlEnableShader(shader.id);
 
-    mesh.vertexCount = 24;
-    mesh.triangleCount = 12;
+    // Upload view and projection matrices (if locations available)
+    if (shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-#else               // Use par_shapes library to generate cube mesh
-/*
-// Platonic solids:
-par_shapes_mesh* par_shapes_create_tetrahedron();       // 4 sides polyhedron (pyramid)
-par_shapes_mesh* par_shapes_create_cube();              // 6 sides polyhedron (cube)
-par_shapes_mesh* par_shapes_create_octahedron();        // 8 sides polyhedron (dyamond)
-par_shapes_mesh* par_shapes_create_dodecahedron();      // 12 sides polyhedron
-par_shapes_mesh* par_shapes_create_icosahedron();       // 20 sides polyhedron
-*/
-    // Platonic solid generation: cube (6 sides)
-    // NOTE: No normals/texcoords generated by default
-    par_shapes_mesh *cube = par_shapes_create_cube();
-    cube->tcoords = PAR_MALLOC(float, 2*cube->npoints);
-    for (int i = 0; i < 2*cube->npoints; i++) cube->tcoords[i] = 0.0f;
-    par_shapes_scale(cube, width, height, length);
-    par_shapes_translate(cube, -width/2, 0.0f, -length/2);
-    par_shapes_compute_normals(cube);
+    // Upload view and projection matrices to frame uniform block (if declared by shader)
+    // NOTE: Block data is only uploaded when matrices change
+    if (shader.locs[SHADER_LOC_BLOCK_FRAME] != -1) rlSetUniformBlockFrame(matView, matProjection);
+}
 
-    mesh.vertices = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(cube->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
+// Upload material colors to shader and bind material texture maps (if available)
+static void EnableMeshMaterial(Material material)
+{
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
 
-    mesh.vertexCount = cube->ntriangles*3;
-    mesh.triangleCount = cube->ntriangles;
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
 
-    for (int k = 0; k < mesh.vertexCount; k++)
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
     {
-        mesh.vertices[k*3] = cube->points[cube->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = cube->points[cube->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = cube->points[cube->triangles[k]*3 + 2];
-
-        mesh.normals[k*3] = cube->normals[cube->triangles[k]*3];
-        mesh.normals[k*3 + 1] = cube->normals[cube->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = cube->normals[cube->triangles[k]*3 + 2];
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.a/255.0f
+        };
 
-        mesh.texcoords[k*2] = cube->tcoords[cube->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = cube->tcoords[cube->triangles[k]*2 + 1];
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
     }
 
-    par_shapes_free_mesh(cube);
-#endif
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+            // Enable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
 
-    return mesh;
+            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+        }
+    }
 }
 
-// Generate sphere mesh (standard sphere)
-Mesh GenMeshSphere(float radius, int rings, int slices)
+// Unbind material texture maps
+static void DisableMeshMaterial(Material material)
 {
-    Mesh mesh = { 0 };
-
-    if ((rings >= 3) && (slices >= 3))
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
-        par_shapes_mesh *sphere = par_shapes_create_parametric_sphere(slices, rings);
-        par_shapes_scale(sphere, radius, radius, radius);
-        // NOTE: Soft normals are computed internally
-
-        mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-
-        mesh.vertexCount = sphere->ntriangles*3;
-        mesh.triangleCount = sphere->ntriangles;
-
-        for (int k = 0; k < mesh.vertexCount; k++)
+        if (material.maps[i].texture.id > 0)
         {
-            mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
-
-            mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-            mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-            mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
+            // Disable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
         }
-
-        par_shapes_free_mesh(sphere);
-
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: sphere");
-
-    return mesh;
 }
 
-// Generate hemisphere mesh (half sphere, no bottom cap)
-Mesh GenMeshHemiSphere(float radius, int rings, int slices)
+// Bind mesh vertex data for shader attributes, mesh VAO or VBOs if VAO not available
+static void EnableMeshVertexArray(Mesh mesh, Shader shader)
 {
-    Mesh mesh = { 0 };
-
-    if ((rings >= 3) && (slices >= 3))
+    // Try binding vertex array objects (VAO) or use VBOs if not possible
+    // WARNING: UploadMesh() enables all vertex attributes available in mesh and sets default attribute values
+    // for shader expected vertex attributes that are not provided by the mesh (i.e. colors)
+    // This could be a dangerous approach because different meshes with different shaders can enable/disable some attributes
+    if (!rlEnableVertexArray(mesh.vaoId))
     {
-        if (radius < 0.0f) radius = 0.0f;
+        // Bind mesh VBO data: vertex position (shader-location = 0)
+        rlEnableVertexBuffer(mesh.vboId[0]);
+        SetMeshVertexAttribute(mesh, 0, shader.locs[SHADER_LOC_VERTEX_POSITION]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
 
-        par_shapes_mesh *sphere = par_shapes_create_hemisphere(slices, rings);
-        par_shapes_scale(sphere, radius, radius, radius);
-        // NOTE: Soft normals are computed internally
+        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+        rlEnableVertexBuffer(mesh.vboId[1]);
+        SetMeshVertexAttribute(mesh, 1, shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
 
-        mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
+        if (shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+        {
+            // Bind mesh VBO data: vertex normals (shader-location = 2)
+            rlEnableVertexBuffer(mesh.vboId[2]);
+            SetMeshVertexAttribute(mesh, 2, shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+        }
 
-        mesh.vertexCount = sphere->ntriangles*3;
-        mesh.triangleCount = sphere->ntriangles;
+        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+        if (shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+        {
+            if (mesh.vboId[3] != 0)
+            {
+                rlEnableVertexBuffer(mesh.vboId[3]);
+                rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+                rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+            }
+            else
+            {
+                // Set default value for defined vertex attribute in shader but not provided by mesh
+                // WARNING: It could result in GPU undefined behaviour
+                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                rlSetVertexAttributeDefault(shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+                rlDisableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+            }
+        }
 
-        for (int k = 0; k < mesh.vertexCount; k++)
+        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+        if (shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
         {
-            mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
+            rlEnableVertexBuffer(mesh.vboId[4]);
+            SetMeshVertexAttribute(mesh, 4, shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+        }
 
-            mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-            mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
+        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+        if (shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+        {
+            rlEnableVertexBuffer(mesh.vboId[5]);
+            SetMeshVertexAttribute(mesh, 5, shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+        }
 
-            mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
+        // Bind mesh VBO data: vertex bones ids and weights (shader-location = 6 and 7, if available)
+        if ((shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
         }
 
-        par_shapes_free_mesh(sphere);
+        if ((shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: hemisphere");
 
-    return mesh;
+    // WARNING: Disable vertex attribute color input if mesh can not provide that data (despite location being enabled in shader)
+    if (mesh.vboId[3] == 0) rlDisableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
 }
 
-// Generate cylinder mesh
-Mesh GenMeshCylinder(float radius, float height, int slices)
+// Send mesh model transformation (and bones) to shader and draw mesh, stereo render supported
+static void DrawMeshVertexArray(Mesh mesh, Material material, Matrix transform, Matrix matView, Matrix matProjection)
 {
-    Mesh mesh = { 0 };
+    UploadMeshDirtyRanges(mesh);
 
-    if (slices >= 3)
+    // Upload bones matrices to shader (if mesh skinned on GPU and location available)
+    if ((mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
     {
-        // Instance a cylinder that sits on the Z=0 plane using the given tessellation
-        // levels across the UV domain.  Think of "slices" like a number of pizza
-        // slices, and "stacks" like a number of stacked rings.
-        // Height and radius are both 1.0, but they can easily be changed with par_shapes_scale
-        par_shapes_mesh *cylinder = par_shapes_create_cylinder(slices, 8);
-        par_shapes_scale(cylinder, radius, radius, height);
-        par_shapes_rotate(cylinder, -PI/2.0f, (float[]){ 1, 0, 0 });
-
-        // Generate an orientable disk shape (top cap)
-        par_shapes_mesh *capTop = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, 1 });
-        capTop->tcoords = PAR_MALLOC(float, 2*capTop->npoints);
-        for (int i = 0; i < 2*capTop->npoints; i++) capTop->tcoords[i] = 0.0f;
-        par_shapes_rotate(capTop, -PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(capTop, 90*DEG2RAD, (float[]){ 0, 1, 0 });
-        par_shapes_translate(capTop, 0, height, 0);
-
-        // Generate an orientable disk shape (bottom cap)
-        par_shapes_mesh *capBottom = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, -1 });
-        capBottom->tcoords = PAR_MALLOC(float, 2*capBottom->npoints);
-        for (int i = 0; i < 2*capBottom->npoints; i++) capBottom->tcoords[i] = 0.95f;
-        par_shapes_rotate(capBottom, PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(capBottom, -90*DEG2RAD, (float[]){ 0, 1, 0 });
-
-        par_shapes_merge_and_free(cylinder, capTop);
-        par_shapes_merge_and_free(cylinder, capBottom);
-
-        mesh.vertices = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(cylinder->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
+        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+    }
 
-        mesh.vertexCount = cylinder->ntriangles*3;
-        mesh.triangleCount = cylinder->ntriangles;
+    SetMeshMorphUniforms(mesh, material.shader);
 
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = cylinder->points[cylinder->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = cylinder->points[cylinder->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = cylinder->points[cylinder->triangles[k]*3 + 2];
+    // Model transformation matrix is sent to shader uniform location: SHADER_LOC_MATRIX_MODEL
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
 
-            mesh.normals[k*3] = cylinder->normals[cylinder->triangles[k]*3];
-            mesh.normals[k*3 + 1] = cylinder->normals[cylinder->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = cylinder->normals[cylinder->triangles[k]*3 + 2];
+    // Accumulate several model transformations:
+    //    transform: model transformation provided (includes DrawModel() params combined with model.transform)
+    //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
+    Matrix matModel = MatrixMultiply(transform, rlGetMatrixTransform());
 
-            mesh.texcoords[k*2] = cylinder->tcoords[cylinder->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = cylinder->tcoords[cylinder->triangles[k]*2 + 1];
-        }
+    // Get model-view matrix
+    Matrix matModelView = MatrixMultiply(matModel, matView);
 
-        par_shapes_free_mesh(cylinder);
+    // Get model normal matrix (if required by shader uniform location or draw uniform block)
+    Matrix matNormal = MatrixIdentity();
+    if ((material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) ||
+        (material.shader.locs[SHADER_LOC_BLOCK_DRAW] != -1)) matNormal = MatrixTranspose(MatrixInvert(matModel));
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
-    }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cylinder");
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], matNormal);
 
-    return mesh;
-}
+    // Mesh indices range drawn, mesh LOD level selected
+    int indexCount = 0;
+    int indexOffset = GetMeshLODIndices(mesh, &indexCount);
 
-// Generate cone/pyramid mesh
-Mesh GenMeshCone(float radius, float height, int slices)
-{
-    Mesh mesh = { 0 };
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    if (slices >= 3)
+    // Single pass stereo, mesh drawn once with one instance by eye (shader selects eye matrix by instance)
+    // NOTE: Draw uniform block is still uploaded for model, normal and color diffuse values
+    if (rlIsStereoSinglePassEnabled() && (material.shader.locs[SHADER_LOC_MATRIX_MVP_STEREO] != -1))
     {
-        // Instance a cone that sits on the Z=0 plane using the given tessellation
-        // levels across the UV domain.  Think of "slices" like a number of pizza
-        // slices, and "stacks" like a number of stacked rings.
-        // Height and radius are both 1.0, but they can easily be changed with par_shapes_scale
-        par_shapes_mesh *cone = par_shapes_create_cone(slices, 8);
-        par_shapes_scale(cone, radius, radius, height);
-        par_shapes_rotate(cone, -PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(cone, PI/2.0f, (float[]){ 0, 1, 0 });
+        if (material.shader.locs[SHADER_LOC_BLOCK_DRAW] != -1)
+        {
+            float colDiffuse[4] = {
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+            };
+
+            rlSetUniformBlockDraw(MatrixMultiply(matModelView, matProjection), transform, matNormal, colDiffuse);
+        }
 
-        // Generate an orientable disk shape (bottom cap)
-        par_shapes_mesh *capBottom = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, -1 });
-        capBottom->tcoords = PAR_MALLOC(float, 2*capBottom->npoints);
-        for (int i = 0; i < 2*capBottom->npoints; i++) capBottom->tcoords[i] = 0.95f;
-        par_shapes_rotate(capBottom, PI/2.0f, (float[]){ 1, 0, 0 });
+        rlBeginStereoSinglePass(material.shader.locs[SHADER_LOC_MATRIX_MVP_STEREO], matModelView);
 
-        par_shapes_merge_and_free(cone, capBottom);
+        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(indexOffset, indexCount, 0, 2);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, 2);
 
-        mesh.vertices = (float *)RL_MALLOC(cone->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(cone->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(cone->ntriangles*3*3*sizeof(float));
+        rlEndStereoSinglePass();
 
-        mesh.vertexCount = cone->ntriangles*3;
-        mesh.triangleCount = cone->ntriangles;
+        eyeCount = 0;
+    }
 
-        for (int k = 0; k < mesh.vertexCount; k++)
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
         {
-            mesh.vertices[k*3] = cone->points[cone->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = cone->points[cone->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = cone->points[cone->triangles[k]*3 + 2];
-
-            mesh.normals[k*3] = cone->normals[cone->triangles[k]*3];
-            mesh.normals[k*3 + 1] = cone->normals[cone->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = cone->normals[cone->triangles[k]*3 + 2];
-
-            mesh.texcoords[k*2] = cone->tcoords[cone->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = cone->tcoords[cone->triangles[k]*2 + 1];
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
         }
 
-        par_shapes_free_mesh(cone);
+        // Send combined model-view-projection matrix to shader
+        if (material.shader.locs[SHADER_LOC_BLOCK_DRAW] != -1)
+        {
+            // Draw uniform block (if declared by shader): mvp, model, normal and color diffuse with one buffer range bind
+            float colDiffuse[4] = {
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+                (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+            };
+
+            rlSetUniformBlockDraw(matModelViewProjection, transform, matNormal, colDiffuse);
+        }
+        else rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+        // Draw mesh
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(indexOffset, indexCount, 0);
+        else rlDrawVertexArray(0, mesh.vertexCount);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cone");
-
-    return mesh;
 }
 
-// Generate torus mesh
-Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
+// Upload mesh morph weights and bind morph targets texture (if mesh morphed on GPU and locations available)
+// NOTE: Morph targets count is the texture width in tiles, morph targets texture is kept bound
+static void SetMeshMorphUniforms(Mesh mesh, Shader shader)
 {
-    Mesh mesh = { 0 };
-
-    if ((sides >= 3) && (radSeg >= 3))
-    {
-        if (radius > 1.0f) radius = 1.0f;
-        else if (radius < 0.1f) radius = 0.1f;
+    if ((mesh.morphTextureId == 0) || (shader.locs[SHADER_LOC_MORPH_WEIGHTS] == -1)) return;
 
-        // Create a donut that sits on the Z=0 plane with the specified inner radius
-        // The outer radius can be controlled with par_shapes_scale
-        par_shapes_mesh *torus = par_shapes_create_torus(radSeg, sides, radius);
-        par_shapes_scale(torus, size/2, size/2, size/2);
+    int slot = MESH_MORPH_TEXTURE_SLOT;
 
-        mesh.vertices = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(torus->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
+    rlSetUniform(shader.locs[SHADER_LOC_MORPH_WEIGHTS], mesh.morphWeights, SHADER_UNIFORM_FLOAT, mesh.morphCount);
 
-        mesh.vertexCount = torus->ntriangles*3;
-        mesh.triangleCount = torus->ntriangles;
-
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = torus->points[torus->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = torus->points[torus->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = torus->points[torus->triangles[k]*3 + 2];
-
-            mesh.normals[k*3] = torus->normals[torus->triangles[k]*3];
-            mesh.normals[k*3 + 1] = torus->normals[torus->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = torus->normals[torus->triangles[k]*3 + 2];
-
-            mesh.texcoords[k*2] = torus->tcoords[torus->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = torus->tcoords[torus->triangles[k]*2 + 1];
-        }
-
-        par_shapes_free_mesh(torus);
-
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+    if (shader.locs[SHADER_LOC_MORPH_TARGETS] != -1)
+    {
+        rlSetUniform(shader.locs[SHADER_LOC_MORPH_TARGETS], &slot, SHADER_UNIFORM_INT, 1);
+        rlActiveTextureSlot(slot);
+        rlEnableTexture(mesh.morphTextureId);
+        rlActiveTextureSlot(0);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: torus");
-
-    return mesh;
 }
 
-// Generate trefoil knot mesh
-Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
+// Attach instances buffer to mesh vertex data and draw mesh instances, stereo render supported
+// NOTE: Instances attributes are read from first instance, if args buffer is provided instances count is read from it
+static void DrawMeshInstancedArray(Mesh mesh, Material material, MeshInstanceBuffer buffer, int first, int instances, unsigned int argsBufferId, Matrix matView, Matrix matProjection)
 {
-    Mesh mesh = { 0 };
+    // Instances transforms attribute location: instanceTransform (if available) or set by user on SHADER_LOC_MATRIX_MODEL
+    // NOTE: Mesh vertex attributes would be replaced by instances transforms if no location is available
+    int transformLoc = material.shader.locs[SHADER_LOC_INSTANCE_TRANSFORM];
+    if (transformLoc == -1) transformLoc = material.shader.locs[SHADER_LOC_MATRIX_MODEL];
 
-    if ((sides >= 3) && (radSeg >= 3))
+    if (transformLoc == -1)
     {
-        if (radius > 3.0f) radius = 3.0f;
-        else if (radius < 0.5f) radius = 0.5f;
+        TRACELOG(LOG_WARNING, "MESH: [ID %i] Instances not drawn, shader instances transform location not available", material.shader.id);
+        return;
+    }
 
-        par_shapes_mesh *knot = par_shapes_create_trefoil_knot(radSeg, sides, radius);
-        par_shapes_scale(knot, size, size, size);
+    UploadMeshDirtyRanges(mesh);
 
-        mesh.vertices = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(knot->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
+    // Upload bones matrices to shader, all instances share the same pose (if location available)
+    if ((mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+    }
 
-        mesh.vertexCount = knot->ntriangles*3;
-        mesh.triangleCount = knot->ntriangles;
+    SetMeshMorphUniforms(mesh, material.shader);
 
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = knot->points[knot->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = knot->points[knot->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = knot->points[knot->triangles[k]*3 + 2];
+    // Enable mesh VAO to attach instances buffer
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(buffer.id);
 
-            mesh.normals[k*3] = knot->normals[knot->triangles[k]*3];
-            mesh.normals[k*3 + 1] = knot->normals[knot->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = knot->normals[knot->triangles[k]*3 + 2];
+    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_INSTANCE_TRANSFORM
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        rlEnableVertexAttribute(transformLoc + i);
+        rlSetVertexAttribute(transformLoc + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(first*sizeof(Matrix) + i*sizeof(Vector4)));
+        rlSetVertexAttributeDivisor(transformLoc + i, 1);
+    }
 
-            mesh.texcoords[k*2] = knot->tcoords[knot->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = knot->tcoords[knot->triangles[k]*2 + 1];
+    // Instances colors are send to shader attribute location: SHADER_LOC_INSTANCE_COLOR (if available)
+    if (material.shader.locs[SHADER_LOC_INSTANCE_COLOR] != -1)
+    {
+        if (buffer.colorsId > 0)
+        {
+            rlEnableVertexBuffer(buffer.colorsId);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, (void *)(first*sizeof(Color)));
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 1);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
+        }
+        else
+        {
+            // Set default value for unused attribute, instances are not tinted
+            float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
         }
+    }
 
-        par_shapes_free_mesh(knot);
+    // Instances custom attributes are send to their shader attribute locations
+    for (int i = 0; i < 4; i++)
+    {
+        if (buffer.attribIds[i] == 0) continue;
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+        rlEnableVertexBuffer(buffer.attribIds[i]);
+        rlSetVertexAttribute(buffer.attribLocs[i], buffer.attribSizes[i], RL_FLOAT, 0, 0, (void *)(first*buffer.attribSizes[i]*sizeof(float)));
+        rlSetVertexAttributeDivisor(buffer.attribLocs[i], 1);
+        rlEnableVertexAttribute(buffer.attribLocs[i]);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: knot");
 
-    return mesh;
-}
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
 
-// Generate a mesh from heightmap
-// NOTE: Vertex data is uploaded to GPU
-Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
-{
-    #define GRAY_VALUE(c) ((float)(c.r + c.g + c.b)/3.0f)
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: In this case, model instance transformation must be computed in the shader
+    Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
 
-    Mesh mesh = { 0 };
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixIdentity());
 
-    int mapX = heightmap.width;
-    int mapZ = heightmap.height;
+    EnableMeshVertexArray(mesh, material.shader);
 
-    Color *pixels = LoadImageColors(heightmap);
+    // Mesh indices range drawn, mesh LOD level selected
+    // NOTE: Indirect draws count and indices range are read from args buffer
+    int indexCount = 0;
+    int indexOffset = GetMeshLODIndices(mesh, &indexCount);
 
-    // NOTE: One vertex per pixel
-    mesh.triangleCount = (mapX - 1)*(mapZ - 1)*2;    // One quad every four pixels
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    mesh.vertexCount = mesh.triangleCount*3;
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
 
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.colors = NULL;
+        // Send combined model-view-projection matrix to shader
+        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
-    int vCounter = 0;       // Used to count vertices float by float
-    int tcCounter = 0;      // Used to count texcoords float by float
-    int nCounter = 0;       // Used to count normals float by float
+        // Draw mesh instanced
+        if (argsBufferId > 0)
+        {
+            if (mesh.indices != NULL) rlDrawVertexArrayElementsIndirect(argsBufferId, 0);
+            else rlDrawVertexArrayIndirect(argsBufferId, 0);
+        }
+        else if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(indexOffset, indexCount, 0, instances);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+    }
 
-    Vector3 scaleFactor = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
+    // Detach instances transforms, colors and custom attributes, mesh could be drawn later
+    // without instances or with a buffer not providing them (attributes state is kept in mesh VAO)
+    for (int i = 0; i < 4; i++)
+    {
+        rlSetVertexAttributeDivisor(transformLoc + i, 0);
+        rlDisableVertexAttribute(transformLoc + i);
+    }
 
-    Vector3 vA = { 0 };
-    Vector3 vB = { 0 };
-    Vector3 vC = { 0 };
-    Vector3 vN = { 0 };
+    if ((buffer.colorsId > 0) && (material.shader.locs[SHADER_LOC_INSTANCE_COLOR] != -1))
+    {
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 0);
+        rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
+    }
 
-    for (int z = 0; z < mapZ-1; z++)
+    for (int i = 0; i < 4; i++)
     {
-        for (int x = 0; x < mapX-1; x++)
-        {
-            // Fill vertices array with data
-            //----------------------------------------------------------
+        if (buffer.attribIds[i] == 0) continue;
 
-            // one triangle - 3 vertex
-            mesh.vertices[vCounter] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 1] = GRAY_VALUE(pixels[x + z*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 2] = (float)z*scaleFactor.z;
+        rlSetVertexAttributeDivisor(buffer.attribLocs[i], 0);
+        rlDisableVertexAttribute(buffer.attribLocs[i]);
+    }
+}
 
-            mesh.vertices[vCounter + 3] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 4] = GRAY_VALUE(pixels[x + (z + 1)*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 5] = (float)(z + 1)*scaleFactor.z;
+// Load internal instances buffer
+// NOTE: Buffer grows to required instances (power of two), it is kept between draws
+static bool LoadInstanceBufferDefault(int instances)
+{
+    if (instances <= 0) return false;
 
-            mesh.vertices[vCounter + 6] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 7] = GRAY_VALUE(pixels[(x + 1) + z*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 8] = (float)z*scaleFactor.z;
+    if (instances > instanceBuffer.instanceCount)
+    {
+        int capacity = 64;
+        while (capacity < instances) capacity *= 2;
 
-            // Another triangle - 3 vertex
-            mesh.vertices[vCounter + 9] = mesh.vertices[vCounter + 6];
-            mesh.vertices[vCounter + 10] = mesh.vertices[vCounter + 7];
-            mesh.vertices[vCounter + 11] = mesh.vertices[vCounter + 8];
+        UnloadMeshInstanceBuffer(instanceBuffer);
+        instanceBuffer = LoadMeshInstanceBuffer(NULL, capacity, true);
 
-            mesh.vertices[vCounter + 12] = mesh.vertices[vCounter + 3];
-            mesh.vertices[vCounter + 13] = mesh.vertices[vCounter + 4];
-            mesh.vertices[vCounter + 14] = mesh.vertices[vCounter + 5];
+        RL_FREE(instanceTransforms);
+        instanceTransforms = (instanceBuffer.id > 0)? (float16 *)RL_MALLOC(capacity*sizeof(float16)) : NULL;
+    }
 
-            mesh.vertices[vCounter + 15] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 16] = GRAY_VALUE(pixels[(x + 1) + (z + 1)*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 17] = (float)(z + 1)*scaleFactor.z;
-            vCounter += 18;     // 6 vertex, 18 floats
+    return (instanceBuffer.id > 0);
+}
 
-            // Fill texcoords array with data
-            //--------------------------------------------------------------
-            mesh.texcoords[tcCounter] = (float)x/(mapX - 1);
-            mesh.texcoords[tcCounter + 1] = (float)z/(mapZ - 1);
+// Upload instances transforms to internal instances buffer, combined with local transform (applied first)
+static void UploadInstanceTransforms(const Matrix *transforms, int instances, Matrix local)
+{
+    Matrix identity = MatrixIdentity();
 
-            mesh.texcoords[tcCounter + 2] = (float)x/(mapX - 1);
-            mesh.texcoords[tcCounter + 3] = (float)(z + 1)/(mapZ - 1);
+    if (memcmp(&local, &identity, sizeof(Matrix)) == 0) for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+    else for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(MatrixMultiply(local, transforms[i]));
 
-            mesh.texcoords[tcCounter + 4] = (float)(x + 1)/(mapX - 1);
-            mesh.texcoords[tcCounter + 5] = (float)z/(mapZ - 1);
+    rlUpdateVertexBuffer(instanceBuffer.id, instanceTransforms, instances*sizeof(float16), 0);
+}
 
-            mesh.texcoords[tcCounter + 6] = mesh.texcoords[tcCounter + 4];
-            mesh.texcoords[tcCounter + 7] = mesh.texcoords[tcCounter + 5];
+// Add mesh draw to mesh queue
+// NOTE: Queue memory grows as required and it is kept between frames
+static void QueueMesh(Mesh mesh, Material material, Matrix transform)
+{
+    if (meshQueueCount >= meshQueueCapacity)
+    {
+        int capacity = (meshQueueCapacity > 0)? meshQueueCapacity*2 : 256;
+        MeshQueueEntry *queue = (MeshQueueEntry *)RL_REALLOC(meshQueue, capacity*sizeof(MeshQueueEntry));
+        if (queue != NULL) meshQueue = queue;
+        int *order = (int *)RL_REALLOC(meshQueueOrder, capacity*sizeof(int));
+        if (order != NULL) meshQueueOrder = order;
 
-            mesh.texcoords[tcCounter + 8] = mesh.texcoords[tcCounter + 2];
-            mesh.texcoords[tcCounter + 9] = mesh.texcoords[tcCounter + 3];
+        if ((queue == NULL) || (order == NULL))
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to grow mesh queue, mesh not drawn");
+            return;
+        }
 
-            mesh.texcoords[tcCounter + 10] = (float)(x + 1)/(mapX - 1);
-            mesh.texcoords[tcCounter + 11] = (float)(z + 1)/(mapZ - 1);
-            tcCounter += 12;    // 6 texcoords, 12 floats
+        meshQueueCapacity = capacity;
+    }
 
-            // Fill normals array with data
-            //--------------------------------------------------------------
-            for (int i = 0; i < 18; i += 9)
-            {
-                vA.x = mesh.vertices[nCounter + i];
-                vA.y = mesh.vertices[nCounter + i + 1];
-                vA.z = mesh.vertices[nCounter + i + 2];
+    MeshQueueEntry *entry = &meshQueue[meshQueueCount];
+    entry->mesh = mesh;
+    entry->material = material;
+    entry->color = material.maps[MATERIAL_MAP_DIFFUSE].color;
+    entry->transform = MatrixMultiply(transform, rlGetMatrixTransform());
+    meshQueueCount++;
+}
 
-                vB.x = mesh.vertices[nCounter + i + 3];
-                vB.y = mesh.vertices[nCounter + i + 4];
-                vB.z = mesh.vertices[nCounter + i + 5];
+// Compare mesh queue entries order: shader, material (maps and diffuse color), mesh and mesh LOD level
+// NOTE: Entries are compared by queue index last, keeping queue order for same state draws
+static int CompareMeshQueueEntries(const void *a, const void *b)
+{
+    const MeshQueueEntry *entryA = &meshQueue[*(const int *)a];
+    const MeshQueueEntry *entryB = &meshQueue[*(const int *)b];
 
-                vC.x = mesh.vertices[nCounter + i + 6];
-                vC.y = mesh.vertices[nCounter + i + 7];
-                vC.z = mesh.vertices[nCounter + i + 8];
+    if (entryA->material.shader.id != entryB->material.shader.id) return (entryA->material.shader.id < entryB->material.shader.id)? -1 : 1;
+    if (entryA->material.maps != entryB->material.maps) return ((size_t)entryA->material.maps < (size_t)entryB->material.maps)? -1 : 1;
 
-                vN = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vB, vA), Vector3Subtract(vC, vA)));
+    int color = memcmp(&entryA->color, &entryB->color, sizeof(Color));
+    if (color != 0) return color;
 
-                mesh.normals[nCounter + i] = vN.x;
-                mesh.normals[nCounter + i + 1] = vN.y;
-                mesh.normals[nCounter + i + 2] = vN.z;
+    if (entryA->mesh.vboId != entryB->mesh.vboId) return ((size_t)entryA->mesh.vboId < (size_t)entryB->mesh.vboId)? -1 : 1;
+    if (entryA->mesh.lodLevel != entryB->mesh.lodLevel) return (entryA->mesh.lodLevel < entryB->mesh.lodLevel)? -1 : 1;
 
-                mesh.normals[nCounter + i + 3] = vN.x;
-                mesh.normals[nCounter + i + 4] = vN.y;
-                mesh.normals[nCounter + i + 5] = vN.z;
+    return (*(const int *)a - *(const int *)b);
+}
+#endif
 
-                mesh.normals[nCounter + i + 6] = vN.x;
-                mesh.normals[nCounter + i + 7] = vN.y;
-                mesh.normals[nCounter + i + 8] = vN.z;
-            }
+// Unload internal instances buffer, mesh queue, shadow casters depth shaders, shapes meshes cache,
+// billboards batch data, tangents scratch memory and models textures cache
+extern void UnloadMeshDrawDefault(void)
+{
+    // NOTE: Textures still referenced by models not unloaded are released
+    for (int i = 0; i < textureCacheCount; i++) UnloadTexture(textureCache[i].texture);
+    RL_FREE(textureCache);
+
+    textureCache = NULL;
+    textureCacheCount = 0;
+    textureCacheCapacity = 0;
+
+    if (billboardsShader.id > 0) UnloadShader(billboardsShader);
+    rlUnloadVertexArray(billboardsVaoId);
+    rlUnloadVertexBuffer(billboardsVboId);
+    rlUnloadVertexBuffer(billboardsInstancesId);
+    RL_FREE(billboardsInstances);
+    RL_FREE(billboardsKeys);
+
+    billboardsShader = (Shader){ 0 };
+    billboardsShaderFailed = false;
+    billboardsVaoId = 0;
+    billboardsVboId = 0;
+    billboardsInstancesId = 0;
+    billboardsInstances = NULL;
+    billboardsKeys = NULL;
+    billboardsCapacity = 0;
+
+#if defined(RMODELS_SHAPES_CACHE)
+    if (shapesShader.id > 0)
+    {
+        rlSetRenderBatchCallback(NULL);
+        UnloadShader(shapesShader);
+    }
 
-            nCounter += 18;     // 6 vertex, 18 floats
-        }
+    for (int i = 0; i < shapeMeshCount; i++)
+    {
+        rlUnloadVertexArray(shapeMeshes[i].vaoId);
+        rlUnloadVertexBuffer(shapeMeshes[i].vboId);
     }
 
-    UnloadImageColors(pixels);  // Unload pixels color data
+    RL_FREE(shapeDraws);
+    RL_FREE(shapeInstances);
+    RL_FREE(shapeColors);
+
+    shapesShader = (Shader){ 0 };
+    shapesShaderFailed = false;
+    shapeMeshCount = 0;
+    shapeDraws = NULL;
+    shapeInstances = NULL;
+    shapeColors = NULL;
+    shapeDrawCount = 0;
+    shapeDrawCapacity = 0;
+    shapeInstanceCount = 0;
+    shapeInstanceCapacity = 0;
+#endif
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+    if (shadowShader.id > 0) UnloadShader(shadowShader);
+    if (shadowShaderInstancing.id > 0) UnloadShader(shadowShaderInstancing);
 
-    return mesh;
+    shadowShader = (Shader){ 0 };
+    shadowShaderInstancing = (Shader){ 0 };
+    shadowModeActive = false;
+
+    UnloadMeshInstanceBuffer(instanceBuffer);
+    RL_FREE(instanceTransforms);
+    RL_FREE(meshQueue);
+    RL_FREE(meshQueueOrder);
+    RL_FREE(tangentsScratch);
+
+    instanceBuffer = (MeshInstanceBuffer){ 0 };
+    instanceTransforms = NULL;
+    meshQueue = NULL;
+    meshQueueOrder = NULL;
+    meshQueueCount = 0;
+    meshQueueCapacity = 0;
+    meshQueueActive = false;
+    tangentsScratch = NULL;
+    tangentsScratchSize = 0;
 }
 
-// Generate a cubes mesh from pixel data
-// NOTE: Vertex data is uploaded to GPU
-Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
+// Unload mesh from memory (RAM and VRAM)
+void UnloadMesh(Mesh mesh)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
-    Mesh mesh = { 0 };
+    // Unload rlgl mesh vboId data
+    rlUnloadVertexArray(mesh.vaoId);
 
-    Color *pixels = LoadImageColors(cubicmap);
+    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
+    RL_FREE(mesh.vboId);
 
-    int mapWidth = cubicmap.width;
-    int mapHeight = cubicmap.height;
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
 
-    // NOTE: Max possible number of triangles numCubes*(12 triangles by cube)
-    int maxTriangles = cubicmap.width*cubicmap.height*12;
+    RL_FREE(mesh.lodTriangles);
+    RL_FREE(mesh.lodErrors);
+    RL_FREE(mesh.lodIndices);
 
-    int vCounter = 0;       // Used to count vertices
-    int tcCounter = 0;      // Used to count texcoords
-    int nCounter = 0;       // Used to count normals
+    if (mesh.morphTextureId > 0) rlUnloadTexture(mesh.morphTextureId);
+    RL_FREE(mesh.morphVertices);
+    RL_FREE(mesh.morphNormals);
+    RL_FREE(mesh.morphWeights);
 
-    float w = cubeSize.x;
-    float h = cubeSize.z;
-    float h2 = cubeSize.y;
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+    RL_FREE(mesh.dirtyRanges);
+}
 
-    Vector3 *mapVertices = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
-    Vector2 *mapTexcoords = (Vector2 *)RL_MALLOC(maxTriangles*3*sizeof(Vector2));
-    Vector3 *mapNormals = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
+// Export mesh data to file
+bool ExportMesh(Mesh mesh, const char *fileName)
+{
+    bool success = false;
 
-    // Define the 6 normals of the cube, we will combine them accordingly later...
-    Vector3 n1 = { 1.0f, 0.0f, 0.0f };
-    Vector3 n2 = { -1.0f, 0.0f, 0.0f };
-    Vector3 n3 = { 0.0f, 1.0f, 0.0f };
-    Vector3 n4 = { 0.0f, -1.0f, 0.0f };
-    Vector3 n5 = { 0.0f, 0.0f, -1.0f };
-    Vector3 n6 = { 0.0f, 0.0f, 1.0f };
+    if ((mesh.vertices == NULL) || (mesh.texcoords == NULL) || (mesh.normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Export requires CPU vertex data, it was released or not generated");
+        return success;
+    }
 
-    // NOTE: We use texture rectangles to define different textures for top-bottom-front-back-right-left (6)
-    typedef struct RectangleF {
-        float x;
-        float y;
-        float width;
-        float height;
-    } RectangleF;
+    if (IsFileExtension(fileName, ".obj"))
+    {
+        // Estimated data size, it should be enough...
+        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
+                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
+                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
+                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
 
-    RectangleF rightTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
-    RectangleF leftTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
-    RectangleF frontTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
-    RectangleF backTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
-    RectangleF topTexUV = { 0.0f, 0.5f, 0.5f, 0.5f };
-    RectangleF bottomTexUV = { 0.5f, 0.5f, 0.5f, 0.5f };
+        // NOTE: Text data buffer size is estimated considering mesh data size
+        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
 
-    for (int z = 0; z < mapHeight; ++z)
-    {
-        for (int x = 0; x < mapWidth; ++x)
-        {
-            // Define the 8 vertex of the cube, we will combine them accordingly later...
-            Vector3 v1 = { w*(x - 0.5f), h2, h*(z - 0.5f) };
-            Vector3 v2 = { w*(x - 0.5f), h2, h*(z + 0.5f) };
-            Vector3 v3 = { w*(x + 0.5f), h2, h*(z + 0.5f) };
-            Vector3 v4 = { w*(x + 0.5f), h2, h*(z - 0.5f) };
-            Vector3 v5 = { w*(x + 0.5f), 0, h*(z - 0.5f) };
-            Vector3 v6 = { w*(x - 0.5f), 0, h*(z - 0.5f) };
-            Vector3 v7 = { w*(x - 0.5f), 0, h*(z + 0.5f) };
-            Vector3 v8 = { w*(x + 0.5f), 0, h*(z + 0.5f) };
+        int byteCount = 0;
+        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // more info and bugs-report:  github.com/raysan5/raylib                        //\n");
+        byteCount += sprintf(txtData + byteCount, "# // feedback and support:       ray[at]raylib.com                                //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                          //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n\n");
+        byteCount += sprintf(txtData + byteCount, "# Vertex Count:     %i\n", mesh.vertexCount);
+        byteCount += sprintf(txtData + byteCount, "# Triangle Count:   %i\n\n", mesh.triangleCount);
 
-            // We check pixel color to be WHITE -> draw full cube
-            if (COLOR_EQUAL(pixels[z*cubicmap.width + x], WHITE))
-            {
-                // Define triangles and checking collateral cubes
-                //------------------------------------------------
-
-                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
-                // WARNING: Not required for a WHITE cubes, created to allow seeing the map from outside
-                mapVertices[vCounter] = v1;
-                mapVertices[vCounter + 1] = v2;
-                mapVertices[vCounter + 2] = v3;
-                mapVertices[vCounter + 3] = v1;
-                mapVertices[vCounter + 4] = v3;
-                mapVertices[vCounter + 5] = v4;
-                vCounter += 6;
-
-                mapNormals[nCounter] = n3;
-                mapNormals[nCounter + 1] = n3;
-                mapNormals[nCounter + 2] = n3;
-                mapNormals[nCounter + 3] = n3;
-                mapNormals[nCounter + 4] = n3;
-                mapNormals[nCounter + 5] = n3;
-                nCounter += 6;
-
-                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
-                tcCounter += 6;
-
-                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
-                mapVertices[vCounter] = v6;
-                mapVertices[vCounter + 1] = v8;
-                mapVertices[vCounter + 2] = v7;
-                mapVertices[vCounter + 3] = v6;
-                mapVertices[vCounter + 4] = v5;
-                mapVertices[vCounter + 5] = v8;
-                vCounter += 6;
-
-                mapNormals[nCounter] = n4;
-                mapNormals[nCounter + 1] = n4;
-                mapNormals[nCounter + 2] = n4;
-                mapNormals[nCounter + 3] = n4;
-                mapNormals[nCounter + 4] = n4;
-                mapNormals[nCounter + 5] = n4;
-                nCounter += 6;
-
-                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
-                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                tcCounter += 6;
-
-                // Checking cube on bottom of current cube
-                if (((z < cubicmap.height - 1) && COLOR_EQUAL(pixels[(z + 1)*cubicmap.width + x], BLACK)) || (z == cubicmap.height - 1))
-                {
-                    // Define front triangles (2 tris, 6 vertex) --> v2 v7 v3, v3 v7 v8
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v2;
-                    mapVertices[vCounter + 1] = v7;
-                    mapVertices[vCounter + 2] = v3;
-                    mapVertices[vCounter + 3] = v3;
-                    mapVertices[vCounter + 4] = v7;
-                    mapVertices[vCounter + 5] = v8;
-                    vCounter += 6;
-
-                    mapNormals[nCounter] = n6;
-                    mapNormals[nCounter + 1] = n6;
-                    mapNormals[nCounter + 2] = n6;
-                    mapNormals[nCounter + 3] = n6;
-                    mapNormals[nCounter + 4] = n6;
-                    mapNormals[nCounter + 5] = n6;
-                    nCounter += 6;
-
-                    mapTexcoords[tcCounter] = (Vector2){ frontTexUV.x, frontTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y + frontTexUV.height };
-                    tcCounter += 6;
-                }
+        byteCount += sprintf(txtData + byteCount, "g mesh\n");
 
-                // Checking cube on top of current cube
-                if (((z > 0) && COLOR_EQUAL(pixels[(z - 1)*cubicmap.width + x], BLACK)) || (z == 0))
-                {
-                    // Define back triangles (2 tris, 6 vertex) --> v1 v5 v6, v1 v4 v5
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v1;
-                    mapVertices[vCounter + 1] = v5;
-                    mapVertices[vCounter + 2] = v6;
-                    mapVertices[vCounter + 3] = v1;
-                    mapVertices[vCounter + 4] = v4;
-                    mapVertices[vCounter + 5] = v5;
-                    vCounter += 6;
-
-                    mapNormals[nCounter] = n5;
-                    mapNormals[nCounter + 1] = n5;
-                    mapNormals[nCounter + 2] = n5;
-                    mapNormals[nCounter + 3] = n5;
-                    mapNormals[nCounter + 4] = n5;
-                    mapNormals[nCounter + 5] = n5;
-                    nCounter += 6;
-
-                    mapTexcoords[tcCounter] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y + backTexUV.height };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ backTexUV.x, backTexUV.y };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
-                    tcCounter += 6;
-                }
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
+        {
+            byteCount += sprintf(txtData + byteCount, "v %.2f %.2f %.2f\n", mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2]);
+        }
 
-                // Checking cube on right of current cube
-                if (((x < cubicmap.width - 1) && COLOR_EQUAL(pixels[z*cubicmap.width + (x + 1)], BLACK)) || (x == cubicmap.width - 1))
-                {
-                    // Define right triangles (2 tris, 6 vertex) --> v3 v8 v4, v4 v8 v5
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v3;
-                    mapVertices[vCounter + 1] = v8;
-                    mapVertices[vCounter + 2] = v4;
-                    mapVertices[vCounter + 3] = v4;
-                    mapVertices[vCounter + 4] = v8;
-                    mapVertices[vCounter + 5] = v5;
-                    vCounter += 6;
-
-                    mapNormals[nCounter] = n1;
-                    mapNormals[nCounter + 1] = n1;
-                    mapNormals[nCounter + 2] = n1;
-                    mapNormals[nCounter + 3] = n1;
-                    mapNormals[nCounter + 4] = n1;
-                    mapNormals[nCounter + 5] = n1;
-                    nCounter += 6;
-
-                    mapTexcoords[tcCounter] = (Vector2){ rightTexUV.x, rightTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y + rightTexUV.height };
-                    tcCounter += 6;
-                }
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 2)
+        {
+            byteCount += sprintf(txtData + byteCount, "vt %.3f %.3f\n", mesh.texcoords[v], mesh.texcoords[v + 1]);
+        }
 
-                // Checking cube on left of current cube
-                if (((x > 0) && COLOR_EQUAL(pixels[z*cubicmap.width + (x - 1)], BLACK)) || (x == 0))
-                {
-                    // Define left triangles (2 tris, 6 vertex) --> v1 v7 v2, v1 v6 v7
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v1;
-                    mapVertices[vCounter + 1] = v7;
-                    mapVertices[vCounter + 2] = v2;
-                    mapVertices[vCounter + 3] = v1;
-                    mapVertices[vCounter + 4] = v6;
-                    mapVertices[vCounter + 5] = v7;
-                    vCounter += 6;
-
-                    mapNormals[nCounter] = n2;
-                    mapNormals[nCounter + 1] = n2;
-                    mapNormals[nCounter + 2] = n2;
-                    mapNormals[nCounter + 3] = n2;
-                    mapNormals[nCounter + 4] = n2;
-                    mapNormals[nCounter + 5] = n2;
-                    nCounter += 6;
-
-                    mapTexcoords[tcCounter] = (Vector2){ leftTexUV.x, leftTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ leftTexUV.x, leftTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ leftTexUV.x, leftTexUV.y + leftTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
-                    tcCounter += 6;
-                }
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
+        {
+            byteCount += sprintf(txtData + byteCount, "vn %.3f %.3f %.3f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
+        }
+
+        if (mesh.indices != NULL)
+        {
+            for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
+            {
+                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
+                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
+                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
+                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
             }
-            // We check pixel color to be BLACK, we will only draw floor and roof
-            else if (COLOR_EQUAL(pixels[z*cubicmap.width + x], BLACK))
-            {
-                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
-                mapVertices[vCounter] = v1;
-                mapVertices[vCounter + 1] = v3;
-                mapVertices[vCounter + 2] = v2;
-                mapVertices[vCounter + 3] = v1;
-                mapVertices[vCounter + 4] = v4;
-                mapVertices[vCounter + 5] = v3;
-                vCounter += 6;
-
-                mapNormals[nCounter] = n4;
-                mapNormals[nCounter + 1] = n4;
-                mapNormals[nCounter + 2] = n4;
-                mapNormals[nCounter + 3] = n4;
-                mapNormals[nCounter + 4] = n4;
-                mapNormals[nCounter + 5] = n4;
-                nCounter += 6;
-
-                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
-                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                tcCounter += 6;
-
-                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
-                mapVertices[vCounter] = v6;
-                mapVertices[vCounter + 1] = v7;
-                mapVertices[vCounter + 2] = v8;
-                mapVertices[vCounter + 3] = v6;
-                mapVertices[vCounter + 4] = v8;
-                mapVertices[vCounter + 5] = v5;
-                vCounter += 6;
-
-                mapNormals[nCounter] = n3;
-                mapNormals[nCounter + 1] = n3;
-                mapNormals[nCounter + 2] = n3;
-                mapNormals[nCounter + 3] = n3;
-                mapNormals[nCounter + 4] = n3;
-                mapNormals[nCounter + 5] = n3;
-                nCounter += 6;
-
-                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
-                tcCounter += 6;
-            }
-        }
-    }
-
-    // Move data from mapVertices temp arrays to vertices float array
-    mesh.vertexCount = vCounter;
-    mesh.triangleCount = vCounter/3;
+        }
+        else
+        {
+            for (int i = 0, v = 1; i < mesh.triangleCount; i++, v += 3)
+            {
+                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n", v, v, v, v + 1, v + 1, v + 1, v + 2, v + 2, v + 2);
+            }
+        }
 
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.colors = NULL;
+        byteCount += sprintf(txtData + byteCount, "\n");
 
-    int fCounter = 0;
+        // NOTE: Text data length exported is determined by '\0' (NULL) character
+        success = SaveFileText(fileName, txtData);
 
-    // Move vertices data
-    for (int i = 0; i < vCounter; i++)
-    {
-        mesh.vertices[fCounter] = mapVertices[i].x;
-        mesh.vertices[fCounter + 1] = mapVertices[i].y;
-        mesh.vertices[fCounter + 2] = mapVertices[i].z;
-        fCounter += 3;
+        RL_FREE(txtData);
     }
-
-    fCounter = 0;
-
-    // Move normals data
-    for (int i = 0; i < nCounter; i++)
+    else if (IsFileExtension(fileName, ".raw"))
     {
-        mesh.normals[fCounter] = mapNormals[i].x;
-        mesh.normals[fCounter + 1] = mapNormals[i].y;
-        mesh.normals[fCounter + 2] = mapNormals[i].z;
-        fCounter += 3;
+        // TODO: Support additional file formats to export mesh vertex data
     }
 
-    fCounter = 0;
+    return success;
+}
 
-    // Move texcoords data
-    for (int i = 0; i < tcCounter; i++)
+#if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
+// Process obj materials
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount)
+{
+    // Init model materials
+    for (int m = 0; m < materialCount; m++)
     {
-        mesh.texcoords[fCounter] = mapTexcoords[i].x;
-        mesh.texcoords[fCounter + 1] = mapTexcoords[i].y;
-        fCounter += 2;
-    }
+        // Init material to default
+        // NOTE: Uses default shader, which only supports MATERIAL_MAP_DIFFUSE
+        rayMaterials[m] = LoadMaterialDefault();
 
-    RL_FREE(mapVertices);
-    RL_FREE(mapNormals);
-    RL_FREE(mapTexcoords);
+        // Get default texture, in case no texture is defined
+        // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
+        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-    UnloadImageColors(pixels);   // Unload pixels color data
+        if (materials[m].diffuse_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureCached(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(materials[m].diffuse[0]*255.0f), (unsigned char)(materials[m].diffuse[1]*255.0f), (unsigned char)(materials[m].diffuse[2] * 255.0f), 255 }; //float diffuse[3];
+        rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-    return mesh;
-}
-#endif      // SUPPORT_MESH_GENERATION
+        if (materials[m].specular_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureCached(materials[m].specular_texname);  //char *specular_texname; // map_Ks
+        rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(materials[m].specular[0]*255.0f), (unsigned char)(materials[m].specular[1]*255.0f), (unsigned char)(materials[m].specular[2] * 255.0f), 255 }; //float specular[3];
+        rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox GetMeshBoundingBox(Mesh mesh)
-{
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+        if (materials[m].bump_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureCached(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        rayMaterials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
+        rayMaterials[m].maps[MATERIAL_MAP_NORMAL].value = materials[m].shininess;
 
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        rayMaterials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(materials[m].emission[0]*255.0f), (unsigned char)(materials[m].emission[1]*255.0f), (unsigned char)(materials[m].emission[2] * 255.0f), 255 }; //float emission[3];
 
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
+        if (materials[m].displacement_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTextureCached(materials[m].displacement_texname);  //char *displacement_texname; // disp
     }
-
-    // Create the bounding box
-    BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
-
-    return box;
 }
+#endif
 
-// Compute mesh tangents
-// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
-// Implementation based on: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
-void GenMeshTangents(Mesh *mesh)
+// Load materials from model file
+Material *LoadMaterials(const char *fileName, int *materialCount)
 {
-    if ((mesh->vertices == NULL) || (mesh->texcoords == NULL))
-    {
-        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires texcoord vertex attribute data");
-        return;
-    }
+    Material *materials = NULL;
+    unsigned int count = 0;
 
-    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    else
+    // TODO: Support IQM and GLTF for materials parsing
+
+#if defined(SUPPORT_FILEFORMAT_MTL)
+    if (IsFileExtension(fileName, ".mtl"))
     {
-        RL_FREE(mesh->tangents);
-        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    }
+        tinyobj_material_t *mats = NULL;
 
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+        int result = tinyobj_parse_mtl_file(&mats, &count, fileName);
+        if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
-    for (int i = 0; i < mesh->vertexCount; i += 3)
-    {
-        // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+        materials = MemAlloc(count*sizeof(Material));
+        ProcessMaterialsOBJ(materials, mats, count);
 
-        // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+        tinyobj_materials_free(mats, count);
+    }
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load material file", fileName);
+#endif
 
-        float x1 = v2.x - v1.x;
-        float y1 = v2.y - v1.y;
-        float z1 = v2.z - v1.z;
-        float x2 = v3.x - v1.x;
-        float y2 = v3.y - v1.y;
-        float z2 = v3.z - v1.z;
+    *materialCount = count;
+    return materials;
+}
 
-        float s1 = uv2.x - uv1.x;
-        float t1 = uv2.y - uv1.y;
-        float s2 = uv3.x - uv1.x;
-        float t2 = uv3.y - uv1.y;
+// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
+Material LoadMaterialDefault(void)
+{
+    Material material = { 0 };
+    material.maps = (MaterialMap *)RL_CALLOC(MAX_MATERIAL_MAPS, sizeof(MaterialMap));
 
-        float div = s1*t2 - s2*t1;
-        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+    // Using rlgl default shader
+    material.shader.id = rlGetShaderIdDefault();
+    material.shader.locs = rlGetShaderLocsDefault();
 
-        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
-        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    // Using rlgl default texture (1x1 pixel, UNCOMPRESSED_R8G8B8A8, 1 mipmap)
+    material.maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    //material.maps[MATERIAL_MAP_NORMAL].texture;         // NOTE: By default, not set
+    //material.maps[MATERIAL_MAP_SPECULAR].texture;       // NOTE: By default, not set
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+    material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;    // Diffuse color
+    material.maps[MATERIAL_MAP_SPECULAR].color = WHITE;   // Specular color
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
-    }
+    return material;
+}
 
-    // Compute tangents considering normals
-    for (int i = 0; i < mesh->vertexCount; i++)
-    {
-        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        Vector3 tangent = tan1[i];
-
-        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
-#if defined(COMPUTE_TANGENTS_METHOD_01)
-        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
-        tmp = Vector3Normalize(tmp);
-        mesh->tangents[i*4 + 0] = tmp.x;
-        mesh->tangents[i*4 + 1] = tmp.y;
-        mesh->tangents[i*4 + 2] = tmp.z;
-        mesh->tangents[i*4 + 3] = 1.0f;
-#else
-        Vector3OrthoNormalize(&normal, &tangent);
-        mesh->tangents[i*4 + 0] = tangent.x;
-        mesh->tangents[i*4 + 1] = tangent.y;
-        mesh->tangents[i*4 + 2] = tangent.z;
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-#endif
-    }
+// Check if a material is ready
+bool IsMaterialReady(Material material)
+{
+    return ((material.maps != NULL) &&      // Validate material contain some map
+            (material.shader.id > 0));      // Validate material shader is valid
+}
 
-    RL_FREE(tan1);
-    RL_FREE(tan2);
+// Unload material from memory
+void UnloadMaterial(Material material)
+{
+    // Unload material shader (avoid unloading default shader, managed by raylib)
+    if (material.shader.id != rlGetShaderIdDefault()) UnloadShader(material.shader);
 
-    if (mesh->vboId != NULL)
+    // Unload loaded texture maps (avoid unloading default texture, managed by raylib)
+    if (material.maps != NULL)
     {
-        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
-        {
-            // Update existing vertex buffer
-            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
-        }
-        else
+        for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
         {
-            // Load a new tangent attributes buffer
-            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+            if ((material.maps[i].texture.id != rlGetTextureIdDefault()) && !UnloadTextureCached(material.maps[i].texture)) rlUnloadTexture(material.maps[i].texture.id);
         }
-
-        rlEnableVertexArray(mesh->vaoId);
-        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(4);
-        rlDisableVertexArray();
     }
 
-    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+    RL_FREE(material.maps);
 }
 
-// Draw a model (with texture if set)
-void DrawModel(Model model, Vector3 position, float scale, Color tint)
+// Set texture cache key from formatted text
+// NOTE: Keys not fitting MAX_FILEPATH_LENGTH are left empty, truncated keys could match other textures
+static void SetTextureCacheKey(char *key, const char *text, ...)
 {
-    Vector3 vScale = { scale, scale, scale };
-    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+    va_list args;
+    va_start(args, text);
+    int length = vsnprintf(key, MAX_FILEPATH_LENGTH, text, args);
+    va_end(args);
 
-    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+    if ((length < 0) || (length >= MAX_FILEPATH_LENGTH)) key[0] = '\0';
 }
 
-// Draw a model with extended parameters
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+// Find models materials texture cached by image key
+// NOTE: Returns cache entry index, -1 if not cached (empty keys are never cached)
+static int FindTextureCached(const char *key)
 {
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
-    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    int index = -1;
 
-    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+#if defined(SUPPORT_MODEL_TEXTURE_CACHE)
+    if (key[0] == '\0') return index;
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+    unsigned int hash = 2166136261u;
+    for (const char *c = key; *c != '\0'; c++) hash = (hash^(unsigned char)*c)*16777619u;
 
-    for (int i = 0; i < model.meshCount; i++)
+    for (int i = 0; i < textureCacheCount; i++)
     {
-        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
-
-        Color colorTint = WHITE;
-        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
-        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
-        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
-        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
-
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
-        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+        if ((textureCache[i].hash == hash) && (strcmp(textureCache[i].key, key) == 0))
+        {
+            index = i;
+            break;
+        }
     }
+#endif
+
+    return index;
 }
 
-// Draw a model wires (with texture if set)
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+// Get models materials texture cached by image key, reference added
+static bool GetTextureCached(const char *key, Texture2D *texture)
 {
-    rlEnableWireMode();
+    int index = FindTextureCached(key);
 
-    DrawModel(model, position, scale, tint);
+    if (index >= 0)
+    {
+        textureCache[index].refCount++;
+        *texture = textureCache[index].texture;
 
-    rlDisableWireMode();
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Cached texture shared [%s] (references: %i)", texture->id, key, textureCache[index].refCount);
+    }
+
+    return (index >= 0);
 }
 
-// Draw a model wires (with texture if set) with extended parameters
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+// Load texture from image and add it to cache, one reference
+// NOTE: Texture not cached if loading fails, key is empty (or cache not supported), key must not be already cached
+static Texture2D AddTextureCached(const char *key, Image image)
 {
-    rlEnableWireMode();
+    Texture2D texture = LoadTextureFromImage(image);
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+#if defined(SUPPORT_MODEL_TEXTURE_CACHE)
+    if ((texture.id > 0) && (key[0] != '\0'))
+    {
+        if (textureCacheCount == textureCacheCapacity)
+        {
+            int capacity = (textureCacheCapacity > 0)? textureCacheCapacity*2 : 16;
+            ModelTextureCacheEntry *entries = (ModelTextureCacheEntry *)RL_REALLOC(textureCache, capacity*sizeof(ModelTextureCacheEntry));
 
-    rlDisableWireMode();
-}
+            if (entries == NULL) return texture;
 
-// Draw a billboard
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+            textureCache = entries;
+            textureCacheCapacity = capacity;
+        }
 
-    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
-}
+        ModelTextureCacheEntry *entry = &textureCache[textureCacheCount++];
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
-{
-    // NOTE: Billboard locked on axis-Y
-    Vector3 up = { 0.0f, 1.0f, 0.0f };
+        unsigned int hash = 2166136261u;
+        for (const char *c = key; *c != '\0'; c++) hash = (hash^(unsigned char)*c)*16777619u;
 
-    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
+        strncpy(entry->key, key, MAX_FILEPATH_LENGTH - 1);
+        entry->key[MAX_FILEPATH_LENGTH - 1] = '\0';
+        entry->hash = hash;
+        entry->texture = texture;
+        entry->refCount = 1;
+    }
+#endif
+
+    return texture;
 }
 
-void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+// Load models materials texture from file through cache
+// NOTE: Relative paths are keyed from current working directory (models loaders change it to model directory)
+static Texture2D LoadTextureCached(const char *fileName)
 {
-    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
-    Vector2 sizeRatio = { size.x*(float)source.width/source.height, size.y };
+    Texture2D texture = { 0 };
+    char key[MAX_FILEPATH_LENGTH] = { 0 };
 
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    if ((fileName[0] == '/') || (fileName[0] == '\\') || ((fileName[0] != '\0') && (fileName[1] == ':'))) SetTextureCacheKey(key, "%s", fileName);
+    else SetTextureCacheKey(key, "%s/%s", GetWorkingDirectory(), fileName);
 
-    Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+    if (!GetTextureCached(key, &texture))
+    {
+        Image image = LoadImage(fileName);
 
-    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
-    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+        if (image.data != NULL)
+        {
+            texture = AddTextureCached(key, image);
+            UnloadImage(image);
+        }
+    }
 
-    Vector3 p1 = Vector3Add(rightScaled, upScaled);
-    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+    return texture;
+}
 
-    Vector3 topLeft = Vector3Scale(p2, -1);
-    Vector3 topRight = p1;
-    Vector3 bottomRight = p2;
-    Vector3 bottomLeft = Vector3Scale(p1, -1);
+// Release models materials texture cached reference, texture unloaded when no more references
+// NOTE: Returns false if texture is not cached, it is not unloaded
+static bool UnloadTextureCached(Texture2D texture)
+{
+    bool cached = false;
 
-    if (rotation != 0.0f)
+#if defined(SUPPORT_MODEL_TEXTURE_CACHE)
+    for (int i = 0; (texture.id > 0) && (i < textureCacheCount); i++)
     {
-        float sinRotation = sinf(rotation*DEG2RAD);
-        float cosRotation = cosf(rotation*DEG2RAD);
+        if (textureCache[i].texture.id == texture.id)
+        {
+            textureCache[i].refCount--;
 
-        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
-        float rotateAboutX = sizeRatio.x*origin.x/2;
-        float rotateAboutY = sizeRatio.y*origin.y/2;
+            if (textureCache[i].refCount <= 0)
+            {
+                UnloadTexture(textureCache[i].texture);
+                textureCache[i] = textureCache[textureCacheCount - 1];
+                textureCacheCount--;
+            }
 
-        float xtvalue, ytvalue;
-        float rotatedX, rotatedY;
+            cached = true;
+            break;
+        }
+    }
+#endif
 
-        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
-        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+    return cached;
+}
 
-        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+// Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
+// NOTE: Previous texture should be manually unloaded
+void SetMaterialTexture(Material *material, int mapType, Texture2D texture)
+{
+    material->maps[mapType].texture = texture;
+}
 
-        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+// Set the material for a mesh
+void SetModelMeshMaterial(Model *model, int meshId, int materialId)
+{
+    if (meshId >= model->meshCount) TRACELOG(LOG_WARNING, "MESH: Id greater than mesh count");
+    else if (materialId >= model->materialCount) TRACELOG(LOG_WARNING, "MATERIAL: Id greater than material count");
+    else  model->meshMaterial[meshId] = materialId;
+}
 
-        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
-    }
+// Load model animations from file
+ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount)
+{
+    ModelAnimation *animations = NULL;
 
-    // Translate points to the draw center (position)
-    topLeft = Vector3Add(topLeft, position);
-    topRight = Vector3Add(topRight, position);
-    bottomRight = Vector3Add(bottomRight, position);
-    bottomLeft = Vector3Add(bottomLeft, position);
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) animations = LoadModelAnimationsIQM(fileName, animCount);
+#endif
+#if defined(SUPPORT_FILEFORMAT_M3D)
+    if (IsFileExtension(fileName, ".m3d")) animations = LoadModelAnimationsM3D(fileName, animCount);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
+#endif
+    if (IsFileExtension(fileName, ".rlm")) animations = LoadModelAnimationsBinary(fileName, animCount);
 
-    rlSetTexture(texture.id);
+    return animations;
+}
 
-    rlBegin(RL_QUADS);
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+// Update model animated vertex data (positions and normals) for a given frame
+// NOTE: Updated data is uploaded to GPU
+void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
+{
+    PROFILE_BEGIN("UpdateModelAnimation");
 
-        // Bottom-left corner for texture and quad
-        rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
-        rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+    bool skinning = ((anim.frameCount > 0) && (anim.bones != NULL) && ((anim.framePoses != NULL) || (anim.compressedPoses != NULL)));
 
-        // Top-left corner for texture and quad
-        rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
-        rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+    // Morph targets weights for frame, skinned meshes are morphed on CPU skinning (if morphed on CPU)
+    if ((anim.frameCount > 0) && (anim.frameMorphWeights != NULL))
+    {
+        SetModelMorphWeights(model, &anim.frameMorphWeights[(frame%anim.frameCount)*anim.morphCount], anim.morphCount, skinning);
+    }
 
-        // Top-right corner for texture and quad
-        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
-        rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+    if (skinning)
+    {
+        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        // Bottom-right corner for texture and quad
-        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
-        rlVertex3f(topRight.x, topRight.y, topRight.z);
-    rlEnd();
+        // Compressed animation frame pose is decompressed into temporal buffer
+        Transform *buffer = (anim.framePoses == NULL)? (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform)) : NULL;
 
-    rlSetTexture(0);
+        // Bones matrices are computed once per frame into model pose, vertices skinning is a weighted matrices blend
+        Matrix *matrices = (model.pose == NULL)? (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix)) : NULL;
+        const Matrix *boneMatrices = UpdateModelPose(model, GetAnimationFramePose(anim, frame, buffer), anim.boneCount, matrices);
+
+        SkinModelMeshes(model, boneMatrices);
+        UpdateModelMeshBounds(model, boneMatrices);
+
+        RL_FREE(matrices);
+        RL_FREE(buffer);
+    }
+
+    PROFILE_END();
 }
 
-// Draw a bounding box with wires
-void DrawBoundingBox(BoundingBox box, Color color)
+// Update model animation bones matrices (GPU skinning)
+// NOTE: Bones matrices are computed once per model and shared by all meshes, vertices are skinned
+// by shader on DrawMesh(), CPU skinning is used if bones count exceeds MAX_MESH_BONE_MATRICES
+void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 {
-    Vector3 size = { 0 };
+    if (anim.frameCount <= 0) return;
 
-    size.x = fabsf(box.max.x - box.min.x);
-    size.y = fabsf(box.max.y - box.min.y);
-    size.z = fabsf(box.max.z - box.min.z);
+    // Animations without bones only update morph targets weights
+    if ((anim.bones == NULL) || ((anim.framePoses == NULL) && (anim.compressedPoses == NULL)) ||
+        (model.boneCount > MAX_MESH_BONE_MATRICES) || (anim.boneCount < model.boneCount) || !LoadShaderSkinning())
+    {
+        UpdateModelAnimation(model, anim, frame);
+        return;
+    }
 
-    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+    PROFILE_BEGIN("UpdateModelAnimationBones");
 
-    DrawCubeWires(center, size.x, size.y, size.z, color);
-}
+    if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-// Check collision between two spheres
-bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
-{
-    bool collision = false;
+    if (anim.frameMorphWeights != NULL) SetModelMorphWeights(model, &anim.frameMorphWeights[frame*anim.morphCount], anim.morphCount, false);
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = center1.x - center2.x;      // X distance between centers
-    float dy = center1.y - center2.y;      // Y distance between centers
-    float dz = center1.z - center2.z;      // Z distance between centers
+    Transform *buffer = (anim.framePoses == NULL)? (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform)) : NULL;
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+    Matrix matrices[MAX_MESH_BONE_MATRICES] = { 0 };
+    const Matrix *boneMatrices = UpdateModelPose(model, GetAnimationFramePose(anim, frame, buffer), anim.boneCount, matrices);
 
-    if (distance <= (radius1 + radius2)) collision = true;
-    */
+    SetModelBoneMatrices(model, boneMatrices);
+    UpdateModelMeshBounds(model, boneMatrices);
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+    RL_FREE(buffer);
 
-    return collision;
+    PROFILE_END();
 }
 
-// Check collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+// Update model animations blended pose at time
+// NOTE: Animations are sampled at time (looped by animation duration) interpolating between frames,
+// sampled poses are blended by weights (normalized), skinning is done on GPU if model meshes
+// were previously skinned on GPU (UpdateModelAnimationBones()), on CPU otherwise
+void UpdateModelAnimationEx(Model model, const ModelAnimation *anims, const float *weights, int count, float time)
 {
-    bool collision = true;
+    if ((anims == NULL) || (weights == NULL) || (count <= 0)) return;
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
-    {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
-    }
-    else collision = false;
+    PROFILE_BEGIN("UpdateModelAnimationEx");
 
-    return collision;
-}
+    // Meshes skinned on GPU keep bones matrices, other meshes are skinned on CPU
+    bool skinnedGPU = false;
+    for (int m = 0; m < model.meshCount; m++) if (model.meshes[m].boneMatrices != NULL) { skinnedGPU = true; break; }
 
-// Check collision between box and sphere
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
-{
-    bool collision = false;
+    bool skinning = ((model.boneCount > 0) && (model.bindPose != NULL));
 
-    float dmin = 0;
+    // Morph targets weights, animations weights blended by weights (normalized), frames interpolated
+    int morphCount = 0;
+    for (int a = 0; a < count; a++) if ((anims[a].frameMorphWeights != NULL) && (weights[a] > 0.0f) && (anims[a].morphCount > morphCount)) morphCount = anims[a].morphCount;
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+    if (morphCount > 0)
+    {
+        float *morphWeights = (float *)RL_CALLOC(morphCount, sizeof(float));
+        float morphTotal = 0.0f;
 
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
-    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+        for (int a = 0; a < count; a++)
+        {
+            if ((anims[a].frameMorphWeights == NULL) || (weights[a] <= 0.0f) || (anims[a].frameCount <= 0)) continue;
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+            float t = 0.0f;
+            int frame = GetAnimationFrame(anims[a], time, &t);
+            int nextFrame = (frame < anims[a].frameCount - 1)? frame + 1 : frame;
+            const float *current = &anims[a].frameMorphWeights[frame*anims[a].morphCount];
+            const float *next = &anims[a].frameMorphWeights[nextFrame*anims[a].morphCount];
 
-    if (dmin <= (radius*radius)) collision = true;
+            for (int i = 0; i < anims[a].morphCount; i++) morphWeights[i] += (current[i] + (next[i] - current[i])*t)*weights[a];
+            morphTotal += weights[a];
+        }
 
-    return collision;
-}
+        if (morphTotal > 0.0f)
+        {
+            for (int i = 0; i < morphCount; i++) morphWeights[i] /= morphTotal;
 
-// Get collision info between ray and sphere
-RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
-{
-    RayCollision collision = { 0 };
+            SetModelMorphWeights(model, morphWeights, morphCount, skinning && !skinnedGPU);
+        }
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float distance = Vector3Length(raySpherePos);
-    float d = radius*radius - (distance*distance - vector*vector);
+        RL_FREE(morphWeights);
+    }
 
-    collision.hit = d >= 0.0f;
+    if (!skinning)
+    {
+        PROFILE_END();
+        return;
+    }
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    if (distance < radius)
+    // Compressed animations frames are decompressed into frames buffer (two frames)
+    int framesSize = 0;
+    for (int a = 0; a < count; a++) if ((anims[a].compressedPoses != NULL) && (anims[a].boneCount*2 > framesSize)) framesSize = anims[a].boneCount*2;
+
+    Transform *pose = (Transform *)RL_CALLOC(model.boneCount*2 + framesSize, sizeof(Transform));
+    Transform *sampled = pose + model.boneCount;
+    Transform *frames = sampled + model.boneCount;
+    float totalWeight = 0.0f;
+
+    for (int a = 0; a < count; a++)
     {
-        collision.distance = vector + sqrtf(d);
+        float weight = weights[a];
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        if ((weight <= 0.0f) || (anims[a].frameCount <= 0) || ((anims[a].framePoses == NULL) && (anims[a].compressedPoses == NULL))) continue;
 
-        // Calculate collision normal (pointing outwards)
-        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+        SampleAnimationPose(model, anims[a], time, sampled, frames);
+
+        // Blend sampled pose, rotations accumulated in the same hemisphere (normalized lerp)
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            Quaternion rotation = sampled[i].rotation;
+            float dot = pose[i].rotation.x*rotation.x + pose[i].rotation.y*rotation.y + pose[i].rotation.z*rotation.z + pose[i].rotation.w*rotation.w;
+            float rotationWeight = (dot < 0.0f)? -weight : weight;
+
+            pose[i].translation = Vector3Add(pose[i].translation, Vector3Scale(sampled[i].translation, weight));
+            pose[i].scale = Vector3Add(pose[i].scale, Vector3Scale(sampled[i].scale, weight));
+            pose[i].rotation = QuaternionAdd(pose[i].rotation, QuaternionScale(rotation, rotationWeight));
+        }
+
+        totalWeight += weight;
     }
-    else
+
+    if (totalWeight > 0.0f)
     {
-        collision.distance = vector - sqrtf(d);
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            pose[i].translation = Vector3Scale(pose[i].translation, 1.0f/totalWeight);
+            pose[i].scale = Vector3Scale(pose[i].scale, 1.0f/totalWeight);
+            pose[i].rotation = QuaternionNormalize(pose[i].rotation);
+        }
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        Matrix *matrices = (model.pose == NULL)? (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix)) : NULL;
+        const Matrix *boneMatrices = UpdateModelPose(model, pose, model.boneCount, matrices);
 
-        // Calculate collision normal (pointing inwards)
-        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+        if (skinnedGPU) SetModelBoneMatrices(model, boneMatrices);
+        else SkinModelMeshes(model, boneMatrices);
+
+        UpdateModelMeshBounds(model, boneMatrices);
+
+        RL_FREE(matrices);
     }
 
-    return collision;
+    RL_FREE(pose);
+
+    PROFILE_END();
 }
 
-// Get collision info between ray and box
-RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+// Sample animation pose at time, interpolated between frames
+// NOTE: Time is looped by animation duration (last frame time), bones not available in animation keep bind pose,
+// compressed animations frames are decompressed into frames buffer (anim.boneCount*2 transforms)
+static void SampleAnimationPose(Model model, ModelAnimation anim, float time, Transform *pose, Transform *frames)
 {
-    RayCollision collision = { 0 };
+    float t = 0.0f;
+    int frame = GetAnimationFrame(anim, time, &t);
+    int nextFrame = (frame < anim.frameCount - 1)? frame + 1 : frame;
 
-    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
-    // Reversing ray.direction will give use the correct result.
-    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
-                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
-                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+    const Transform *currentPose = GetAnimationFramePose(anim, frame, frames);
+    const Transform *nextPose = GetAnimationFramePose(anim, nextFrame, frames + anim.boneCount);
 
-    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        if (i >= anim.boneCount)
+        {
+            pose[i] = model.bindPose[i];
+            continue;
+        }
 
-    float t[11] = { 0 };
+        const Transform *current = &currentPose[i];
+        const Transform *next = &nextPose[i];
 
-    t[8] = 1.0f/ray.direction.x;
-    t[9] = 1.0f/ray.direction.y;
-    t[10] = 1.0f/ray.direction.z;
+        pose[i].translation = Vector3Lerp(current->translation, next->translation, t);
+        pose[i].rotation = QuaternionSlerp(current->rotation, next->rotation, t);
+        pose[i].scale = Vector3Lerp(current->scale, next->scale, t);
+    }
+}
 
-    t[0] = (box.min.x - ray.position.x)*t[8];
-    t[1] = (box.max.x - ray.position.x)*t[8];
-    t[2] = (box.min.y - ray.position.y)*t[9];
-    t[3] = (box.max.y - ray.position.y)*t[9];
-    t[4] = (box.min.z - ray.position.z)*t[10];
-    t[5] = (box.max.z - ray.position.z)*t[10];
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+// Get animation frame at time and interpolation factor to next frame
+// NOTE: Time is looped by animation duration (last frame time)
+static int GetAnimationFrame(ModelAnimation anim, float time, float *t)
+{
+    float duration = (anim.frameTimes != NULL)? anim.frameTimes[anim.frameCount - 1] : (anim.frameCount - 1)*MODEL_ANIMATION_FRAME_TIME;
 
-    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
-    collision.distance = t[6];
-    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+    if (duration > 0.0f)
+    {
+        time = fmodf(time, duration);
+        if (time < 0.0f) time += duration;
+    }
+    else time = 0.0f;
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+    int frame = 0;
+    *t = 0.0f;
 
-    collision.normal = Vector3Normalize(collision.normal);
+    if (anim.frameTimes != NULL)
+    {
+        // Binary search of last frame with time lower or equal to sampling time
+        int low = 0;
+        int high = anim.frameCount - 1;
 
-    if (insideBox)
+        while (low < high)
+        {
+            int mid = (low + high + 1)/2;
+            if (anim.frameTimes[mid] <= time) low = mid;
+            else high = mid - 1;
+        }
+
+        frame = low;
+        if ((frame < anim.frameCount - 1) && (anim.frameTimes[frame + 1] > anim.frameTimes[frame])) *t = (time - anim.frameTimes[frame])/(anim.frameTimes[frame + 1] - anim.frameTimes[frame]);
+    }
+    else
     {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
+        float position = time/MODEL_ANIMATION_FRAME_TIME;
+        frame = (int)position;
+        *t = position - (float)frame;
     }
 
-    return collision;
+    if (frame >= anim.frameCount - 1)
+    {
+        frame = anim.frameCount - 1;
+        *t = 0.0f;
+    }
+
+    return frame;
 }
 
-// Get collision info between ray and mesh
-RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+// Compress animation poses
+// NOTE: Poses are stored in a single allocation, constant bone tracks are stored once,
+// varying translations and scales are quantized to 16bit in track range and rotations are
+// stored as smallest three components (15bit), animation framePoses are unloaded
+void CompressModelAnimation(ModelAnimation *anim)
 {
-    RayCollision collision = { 0 };
+    if ((anim == NULL) || (anim->framePoses == NULL) || (anim->frameCount <= 0) || (anim->boneCount <= 0)) return;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+    AnimationBoneTrack *tracks = (AnimationBoneTrack *)RL_CALLOC(anim->boneCount, sizeof(AnimationBoneTrack));
+    int frameStride = 0;
+
+    // Find varying tracks and tracks ranges
+    for (int i = 0; i < anim->boneCount; i++)
     {
-        int triangleCount = mesh.triangleCount;
+        Transform first = anim->framePoses[0][i];
+        Vector3 translationMax = first.translation;
+        Vector3 scaleMax = first.scale;
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        tracks[i].pose = first;
+        tracks[i].translationMin = first.translation;
+        tracks[i].scaleMin = first.scale;
+
+        for (int f = 1; f < anim->frameCount; f++)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            Transform *current = &anim->framePoses[f][i];
 
-            if (mesh.indices)
+            tracks[i].translationMin = Vector3Min(tracks[i].translationMin, current->translation);
+            translationMax = Vector3Max(translationMax, current->translation);
+            tracks[i].scaleMin = Vector3Min(tracks[i].scaleMin, current->scale);
+            scaleMax = Vector3Max(scaleMax, current->scale);
+
+            // Rotations q and -q are the same rotation
+            float dot = fabsf(first.rotation.x*current->rotation.x + first.rotation.y*current->rotation.y + first.rotation.z*current->rotation.z + first.rotation.w*current->rotation.w);
+            if (dot < 0.999999f) tracks[i].flags |= ANIMATION_TRACK_ROTATION;
+        }
+
+        Vector3 translationRange = Vector3Subtract(translationMax, tracks[i].translationMin);
+        Vector3 scaleRange = Vector3Subtract(scaleMax, tracks[i].scaleMin);
+
+        if ((translationRange.x > ANIMATION_TRACK_TOLERANCE) || (translationRange.y > ANIMATION_TRACK_TOLERANCE) || (translationRange.z > ANIMATION_TRACK_TOLERANCE)) tracks[i].flags |= ANIMATION_TRACK_TRANSLATION;
+        if ((scaleRange.x > ANIMATION_TRACK_TOLERANCE) || (scaleRange.y > ANIMATION_TRACK_TOLERANCE) || (scaleRange.z > ANIMATION_TRACK_TOLERANCE)) tracks[i].flags |= ANIMATION_TRACK_SCALE;
+
+        tracks[i].translationStep = Vector3Scale(translationRange, 1.0f/65535.0f);
+        tracks[i].scaleStep = Vector3Scale(scaleRange, 1.0f/65535.0f);
+
+        tracks[i].offset = frameStride;
+        if (tracks[i].flags & ANIMATION_TRACK_TRANSLATION) frameStride += 3;
+        if (tracks[i].flags & ANIMATION_TRACK_ROTATION) frameStride += 3;
+        if (tracks[i].flags & ANIMATION_TRACK_SCALE) frameStride += 3;
+    }
+
+    int dataSize = sizeof(AnimationCompressed) + anim->boneCount*sizeof(AnimationBoneTrack) + anim->frameCount*frameStride*sizeof(unsigned short);
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+
+    AnimationCompressed *header = (AnimationCompressed *)data;
+    header->boneCount = anim->boneCount;
+    header->frameStride = frameStride;
+    memcpy(data + sizeof(AnimationCompressed), tracks, anim->boneCount*sizeof(AnimationBoneTrack));
+
+    unsigned short *frames = (unsigned short *)(data + sizeof(AnimationCompressed) + anim->boneCount*sizeof(AnimationBoneTrack));
+
+    // Quantize varying tracks values by frame
+    for (int f = 0; f < anim->frameCount; f++)
+    {
+        for (int i = 0; i < anim->boneCount; i++)
+        {
+            Transform *current = &anim->framePoses[f][i];
+            unsigned short *values = frames + f*frameStride + tracks[i].offset;
+
+            if (tracks[i].flags & ANIMATION_TRACK_TRANSLATION)
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
+                const float *value = &current->translation.x;
+                const float *min = &tracks[i].translationMin.x;
+                const float *step = &tracks[i].translationStep.x;
+
+                for (int k = 0; k < 3; k++) *values++ = (step[k] > 0.0f)? (unsigned short)Clamp((value[k] - min[k])/step[k] + 0.5f, 0.0f, 65535.0f) : 0;
             }
-            else
+
+            if (tracks[i].flags & ANIMATION_TRACK_ROTATION)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                EncodeQuaternion(current->rotation, values);
+                values += 3;
             }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
-
-            if (triHitInfo.hit)
+            if (tracks[i].flags & ANIMATION_TRACK_SCALE)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                const float *value = &current->scale.x;
+                const float *min = &tracks[i].scaleMin.x;
+                const float *step = &tracks[i].scaleStep.x;
+
+                for (int k = 0; k < 3; k++) *values++ = (step[k] > 0.0f)? (unsigned short)Clamp((value[k] - min[k])/step[k] + 0.5f, 0.0f, 65535.0f) : 0;
             }
         }
     }
 
-    return collision;
+    TRACELOG(LOG_INFO, "MODEL: Animation compressed: %i KB -> %i KB", (int)(anim->frameCount*(anim->boneCount*sizeof(Transform) + sizeof(Transform *))/1024), dataSize/1024);
+
+    UnloadAnimationFramePoses(anim->framePoses, anim->frameCount, anim->boneCount);
+    RL_FREE(tracks);
+
+    anim->framePoses = NULL;
+    anim->compressedPoses = data;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+// Get animation frame pose (boneCount transforms), decompressed if required
+void GetModelAnimationPose(ModelAnimation anim, int frame, Transform *pose)
 {
-    #define EPSILON 0.000001f        // A small number
+    if ((pose == NULL) || (anim.frameCount <= 0) || ((anim.framePoses == NULL) && (anim.compressedPoses == NULL))) return;
 
-    RayCollision collision = { 0 };
-    Vector3 edge1 = { 0 };
-    Vector3 edge2 = { 0 };
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+    else if (frame < 0) frame = 0;
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+    const Transform *framePose = GetAnimationFramePose(anim, frame, pose);
+    if (framePose != pose) memcpy(pose, framePose, anim.boneCount*sizeof(Transform));
+}
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+// Get animation frame pose
+// NOTE: Uncompressed animations return frame poses, compressed animations
+// frame is decompressed into provided pose (anim.boneCount transforms)
+static const Transform *GetAnimationFramePose(ModelAnimation anim, int frame, Transform *pose)
+{
+    if (anim.framePoses != NULL) return anim.framePoses[frame];
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+    const unsigned char *data = (const unsigned char *)anim.compressedPoses;
+    const AnimationCompressed *header = (const AnimationCompressed *)data;
+    const AnimationBoneTrack *tracks = (const AnimationBoneTrack *)(data + sizeof(AnimationCompressed));
+    const unsigned short *frameData = (const unsigned short *)(data + sizeof(AnimationCompressed) + header->boneCount*sizeof(AnimationBoneTrack)) + frame*header->frameStride;
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+    for (int i = 0; i < header->boneCount; i++)
+    {
+        const AnimationBoneTrack *track = &tracks[i];
+        const unsigned short *values = frameData + track->offset;
 
-    invDet = 1.0f/det;
+        pose[i] = track->pose;
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+        if (track->flags & ANIMATION_TRACK_TRANSLATION)
+        {
+            pose[i].translation.x = track->translationMin.x + values[0]*track->translationStep.x;
+            pose[i].translation.y = track->translationMin.y + values[1]*track->translationStep.y;
+            pose[i].translation.z = track->translationMin.z + values[2]*track->translationStep.z;
+            values += 3;
+        }
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+        if (track->flags & ANIMATION_TRACK_ROTATION)
+        {
+            pose[i].rotation = DecodeQuaternion(values);
+            values += 3;
+        }
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+        if (track->flags & ANIMATION_TRACK_SCALE)
+        {
+            pose[i].scale.x = track->scaleMin.x + values[0]*track->scaleStep.x;
+            pose[i].scale.y = track->scaleMin.y + values[1]*track->scaleStep.y;
+            pose[i].scale.z = track->scaleMin.z + values[2]*track->scaleStep.z;
+        }
+    }
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+    return pose;
+}
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+// Encode quaternion smallest three components
+// NOTE: Largest component is dropped (sign flipped to positive, same rotation), other components
+// in range [-1/sqrt(2), 1/sqrt(2)] are quantized to 15bit, largest component index stored in high bits
+static void EncodeQuaternion(Quaternion q, unsigned short *data)
+{
+    q = QuaternionNormalize(q);
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+    float values[4] = { q.x, q.y, q.z, q.w };
+    int largest = 0;
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+    for (int k = 1; k < 4; k++) if (fabsf(values[k]) > fabsf(values[largest])) largest = k;
 
-    if (t > EPSILON)
+    float sign = (values[largest] < 0.0f)? -1.0f : 1.0f;
+
+    for (int k = 0, n = 0; k < 4; k++)
     {
-        // Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        if (k == largest) continue;
+
+        float value = Clamp((sign*values[k]*ANIMATION_QUATERNION_RANGE*0.5f) + 0.5f, 0.0f, 1.0f);
+        data[n++] = (unsigned short)(value*32767.0f + 0.5f);
     }
 
-    return collision;
+    data[0] |= (unsigned short)((largest & 1) << 15);
+    data[1] |= (unsigned short)((largest >> 1) << 15);
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+// Decode quaternion from smallest three components
+static Quaternion DecodeQuaternion(const unsigned short *data)
 {
-    RayCollision collision = { 0 };
+    int largest = (data[0] >> 15) | ((data[1] >> 15) << 1);
+    float values[4] = { 0 };
+    float sum = 0.0f;
 
-    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+    for (int k = 0, n = 0; k < 4; k++)
+    {
+        if (k == largest) continue;
 
-    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+        values[k] = ((data[n++] & 0x7fff)/32767.0f*2.0f - 1.0f)/ANIMATION_QUATERNION_RANGE;
+        sum += values[k]*values[k];
+    }
 
-    return collision;
+    values[largest] = sqrtf(fmaxf(0.0f, 1.0f - sum));
+
+    return (Quaternion){ values[0], values[1], values[2], values[3] };
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Skin model meshes on CPU with bones matrices, vertex data uploaded to GPU
+static void SkinModelMeshes(Model model, const Matrix *boneMatrices)
 {
-    for (int i = 0; i < boneCount; i++)
+    int *meshOffsets = (int *)RL_CALLOC(model.meshCount + 1, sizeof(int));
+
+    for (int m = 0; m < model.meshCount; m++)
     {
-        if (bones[i].parent >= 0)
+        meshOffsets[m + 1] = meshOffsets[m];
+
+        // Switch mesh back to CPU skinning if previously skinned on GPU
+        if (model.meshes[m].boneMatrices != NULL)
         {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+            RL_FREE(model.meshes[m].boneMatrices);
+            model.meshes[m].boneMatrices = NULL;
+            model.meshes[m].boneCount = 0;
         }
-    }
-}
-#endif
-
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-//
-// Keep the following information in mind when reading this
-//  - A mesh is created for every material present in the obj file
-//  - the model.meshCount is therefore the materialCount returned from tinyobj
-//  - the mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
-{
-    Model model = { 0 };
 
-    tinyobj_attrib_t attrib = { 0 };
-    tinyobj_shape_t *meshes = NULL;
-    unsigned int meshCount = 0;
+        if ((model.meshes[m].boneIds == NULL) || (model.meshes[m].boneWeights == NULL) || (model.meshes[m].animVertices == NULL))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Mesh %i has no connection to bones, animation not applied", m);
+            continue;
+        }
 
-    tinyobj_material_t *materials = NULL;
-    unsigned int materialCount = 0;
+        meshOffsets[m + 1] += model.meshes[m].vertexCount;
+    }
 
-    char *fileText = LoadFileText(fileName);
+    // Vertices of all meshes skinning, processed in parallel by jobs system (if initialized)
+    MeshSkinningJob job = { &model, boneMatrices, meshOffsets };
+    JobParallelFor(meshOffsets[model.meshCount], SkinMeshVertices, &job);
 
-    if (fileText != NULL)
+    for (int m = 0; m < model.meshCount; m++)
     {
-        unsigned int dataSize = (unsigned int)strlen(fileText);
-        char currentDir[1024] = { 0 };
-        strcpy(currentDir, GetWorkingDirectory());
-        const char *workingDir = GetDirectoryPath(fileName);
-        if (CHDIR(workingDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-        }
-
-        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+        Mesh mesh = model.meshes[m];
 
-        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
-        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
+        if (meshOffsets[m + 1] == meshOffsets[m]) continue;
 
-        model.meshCount = materialCount;
+        // Flag to check when anim vertex information is updated (any vertex with bone weights)
+        bool updated = false;
+        for (int i = 0; i < mesh.vertexCount*4; i++) if (mesh.boneWeights[i] != 0.0f) { updated = true; break; }
 
-        // Init model materials array
-        if (materialCount > 0)
-        {
-            model.materialCount = materialCount;
-            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
-        }
-        else
+        // Upload new vertex data to GPU for model drawing
+        // NOTE: Only update data when values changed
+        if (updated)
         {
-            model.meshCount = 1;
-            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+            if (mesh.animNormals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
         }
+    }
 
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    RL_FREE(meshOffsets);
+}
 
-        // Count the faces for each material
-        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
+// Set model meshes bones matrices (GPU skinning)
+// NOTE: Meshes bones matrices are allocated on first call, default vertex data is restored on GPU
+static void SetModelBoneMatrices(Model model, const Matrix *boneMatrices)
+{
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
 
-        // if no materials are present use all faces on one mesh
-        if (materialCount > 0)
-        {
-            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
-            {
-                //tinyobj_vertex_index_t face = attrib.faces[fi];
-                int idx = attrib.material_ids[fi];
-                matFaces[idx]++;
-            }
+        if ((mesh->boneIds == NULL) || (mesh->boneWeights == NULL)) continue;
 
-        }
-        else
+        if (mesh->boneMatrices == NULL)
         {
-            matFaces[0] = attrib.num_faces;
+            mesh->boneMatrices = (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix));
+            mesh->boneCount = model.boneCount;
+
+            // Restore default vertex data on GPU, it could have been skinned on CPU (UpdateModelAnimation())
+            if (mesh->animVertices != NULL) rlUpdateVertexBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+            if ((mesh->animNormals != NULL) && (mesh->normals != NULL)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
         }
 
-        //--------------------------------------
-        // Create the material meshes
+        memcpy(mesh->boneMatrices, boneMatrices, model.boneCount*sizeof(Matrix));
+    }
+}
+
+// Unload animation array data
+void UnloadModelAnimations(ModelAnimation *animations, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++) UnloadModelAnimation(animations[i]);
+    RL_FREE(animations);
+}
+
+// Unload animation data
+void UnloadModelAnimation(ModelAnimation anim)
+{
+    UnloadAnimationFramePoses(anim.framePoses, anim.frameCount, anim.boneCount);
+
+    RL_FREE(anim.bones);
+    RL_FREE(anim.frameTimes);
+    RL_FREE(anim.compressedPoses);
+    RL_FREE(anim.frameMorphWeights);
+}
+
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_M3D)
+// Load animation frames poses, all frames poses allocated contiguous after frames pointers
+// NOTE: Poses are not initialized
+static Transform **LoadAnimationFramePoses(int frameCount, int boneCount)
+{
+    Transform **framePoses = (Transform **)RL_MALLOC(frameCount*sizeof(Transform *) + (size_t)frameCount*boneCount*sizeof(Transform));
+    Transform *poses = (Transform *)(framePoses + frameCount);
+
+    for (int i = 0; i < frameCount; i++) framePoses[i] = poses + i*boneCount;
+
+    return framePoses;
+}
+#endif
+
+// Unload animation frames poses
+// NOTE: Frames poses loaded by LoadAnimationFramePoses() are freed at once, frames allocated one by one otherwise
+static void UnloadAnimationFramePoses(Transform **framePoses, int frameCount, int boneCount)
+{
+    if (framePoses == NULL) return;
+
+    Transform *poses = (Transform *)(framePoses + frameCount);
+    bool contiguous = true;
+
+    for (int i = 0; (i < frameCount) && contiguous; i++) contiguous = (framePoses[i] == (poses + i*boneCount));
+
+    if (!contiguous) for (int i = 0; i < frameCount; i++) RL_FREE(framePoses[i]);
+
+    RL_FREE(framePoses);
+}
+
+// Check model animation skeleton match
+// NOTE: Only number of bones and parent connections are checked, animated morph weights must match model morph targets
+bool IsModelAnimationValid(Model model, ModelAnimation anim)
+{
+    int result = true;
+    int morphCount = 0;
+    for (int m = 0; m < model.meshCount; m++) morphCount += model.meshes[m].morphCount;
+
+    if (model.boneCount != anim.boneCount) result = false;
+    else if ((anim.frameMorphWeights != NULL) && (anim.morphCount != morphCount)) result = false;
+    else
+    {
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            if (model.bones[i].parent != anim.bones[i].parent) { result = false; break; }
+        }
+    }
+
+    return result;
+}
+
+// Get model bone transform for current pose (model transform applied)
+// NOTE: Pose is updated by UpdateModelAnimation*() functions, bind pose is used if model was not animated,
+// transform can be used to attach models to bones: MatrixMultiply(attachmentTransform, GetModelBoneTransform(model, boneId))
+Matrix GetModelBoneTransform(Model model, int boneId)
+{
+    if ((boneId < 0) || (boneId >= model.boneCount) || (model.bindPose == NULL)) return model.transform;
+
+    Matrix matBone = { 0 };
+
+    if ((model.pose != NULL) && (boneId < model.pose->boneCount)) matBone = model.pose->globals[boneId];
+    else
+    {
+        const Transform *bind = &model.bindPose[boneId];
+        matBone = MatrixMultiply(MatrixMultiply(MatrixScale(bind->scale.x, bind->scale.y, bind->scale.z), QuaternionToMatrix(bind->rotation)),
+                                 MatrixTranslate(bind->translation.x, bind->translation.y, bind->translation.z));
+    }
+
+    return MatrixMultiply(matBone, model.transform);
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate polygonal mesh
+Mesh GenMeshPoly(int sides, float radius)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_POLY, { radius, 0.0f }, { sides, 0 } });
+}
+
+// Generate plane mesh (with subdivisions)
+Mesh GenMeshPlane(float width, float length, int resX, int resZ)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_PLANE, { width, length }, { resX, resZ } });
+}
+
+// Generated cuboid mesh
+Mesh GenMeshCube(float width, float height, float length)
+{
+    Mesh mesh = { 0 };
+
+#define CUSTOM_MESH_GEN_CUBE
+#if defined(CUSTOM_MESH_GEN_CUBE)
+    float vertices[] = {
+        -width/2, -height/2, length/2,
+        width/2, -height/2, length/2,
+        width/2, height/2, length/2,
+        -width/2, height/2, length/2,
+        -width/2, -height/2, -length/2,
+        -width/2, height/2, -length/2,
+        width/2, height/2, -length/2,
+        width/2, -height/2, -length/2,
+        -width/2, height/2, -length/2,
+        -width/2, height/2, length/2,
+        width/2, height/2, length/2,
+        width/2, height/2, -length/2,
+        -width/2, -height/2, -length/2,
+        width/2, -height/2, -length/2,
+        width/2, -height/2, length/2,
+        -width/2, -height/2, length/2,
+        width/2, -height/2, -length/2,
+        width/2, height/2, -length/2,
+        width/2, height/2, length/2,
+        width/2, -height/2, length/2,
+        -width/2, -height/2, -length/2,
+        -width/2, -height/2, length/2,
+        -width/2, height/2, length/2,
+        -width/2, height/2, -length/2
+    };
+
+    float texcoords[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f
+    };
+
+    float normals[] = {
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f
+    };
+
+    mesh.vertices = (float *)RL_MALLOC(24*3*sizeof(float));
+    memcpy(mesh.vertices, vertices, 24*3*sizeof(float));
+
+    mesh.texcoords = (float *)RL_MALLOC(24*2*sizeof(float));
+    memcpy(mesh.texcoords, texcoords, 24*2*sizeof(float));
+
+    mesh.normals = (float *)RL_MALLOC(24*3*sizeof(float));
+    memcpy(mesh.normals, normals, 24*3*sizeof(float));
+
+    mesh.indices = (unsigned short *)RL_MALLOC(36*sizeof(unsigned short));
+
+    int k = 0;
+
+    // Indices can be initialized right now
+    for (int i = 0; i < 36; i += 6)
+    {
+        mesh.indices[i] = 4*k;
+        mesh.indices[i + 1] = 4*k + 1;
+        mesh.indices[i + 2] = 4*k + 2;
+        mesh.indices[i + 3] = 4*k;
+        mesh.indices[i + 4] = 4*k + 2;
+        mesh.indices[i + 5] = 4*k + 3;
+
+        k++;
+    }
+
+    mesh.vertexCount = 24;
+    mesh.triangleCount = 12;
+
+#else               // Use par_shapes library to generate cube mesh
+/*
+// Platonic solids:
+par_shapes_mesh* par_shapes_create_tetrahedron();       // 4 sides polyhedron (pyramid)
+par_shapes_mesh* par_shapes_create_cube();              // 6 sides polyhedron (cube)
+par_shapes_mesh* par_shapes_create_octahedron();        // 8 sides polyhedron (dyamond)
+par_shapes_mesh* par_shapes_create_dodecahedron();      // 12 sides polyhedron
+par_shapes_mesh* par_shapes_create_icosahedron();       // 20 sides polyhedron
+*/
+    // Platonic solid generation: cube (6 sides)
+    // NOTE: No normals/texcoords generated by default
+    par_shapes_mesh *cube = par_shapes_create_cube();
+    cube->tcoords = PAR_MALLOC(float, 2*cube->npoints);
+    for (int i = 0; i < 2*cube->npoints; i++) cube->tcoords[i] = 0.0f;
+    par_shapes_scale(cube, width, height, length);
+    par_shapes_translate(cube, -width/2, 0.0f, -length/2);
+    par_shapes_compute_normals(cube);
+
+    mesh.vertices = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(cube->ntriangles*3*2*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
+
+    mesh.vertexCount = cube->ntriangles*3;
+    mesh.triangleCount = cube->ntriangles;
+
+    for (int k = 0; k < mesh.vertexCount; k++)
+    {
+        mesh.vertices[k*3] = cube->points[cube->triangles[k]*3];
+        mesh.vertices[k*3 + 1] = cube->points[cube->triangles[k]*3 + 1];
+        mesh.vertices[k*3 + 2] = cube->points[cube->triangles[k]*3 + 2];
+
+        mesh.normals[k*3] = cube->normals[cube->triangles[k]*3];
+        mesh.normals[k*3 + 1] = cube->normals[cube->triangles[k]*3 + 1];
+        mesh.normals[k*3 + 2] = cube->normals[cube->triangles[k]*3 + 2];
+
+        mesh.texcoords[k*2] = cube->tcoords[cube->triangles[k]*2];
+        mesh.texcoords[k*2 + 1] = cube->tcoords[cube->triangles[k]*2 + 1];
+    }
+
+    par_shapes_free_mesh(cube);
+#endif
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Generate sphere mesh (standard sphere)
+Mesh GenMeshSphere(float radius, int rings, int slices)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_SPHERE, { radius, 0.0f }, { rings, slices } });
+}
+
+// Generate hemisphere mesh (half sphere, no bottom cap)
+Mesh GenMeshHemiSphere(float radius, int rings, int slices)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_HEMISPHERE, { radius, 0.0f }, { rings, slices } });
+}
+
+// Generate cylinder mesh
+Mesh GenMeshCylinder(float radius, float height, int slices)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_CYLINDER, { radius, height }, { slices, 0 } });
+}
+
+// Generate cone/pyramid mesh
+Mesh GenMeshCone(float radius, float height, int slices)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_CONE, { radius, height }, { slices, 0 } });
+}
+
+// Generate torus mesh
+Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_TORUS, { radius, size }, { radSeg, sides } });
+}
+
+// Generate trefoil knot mesh
+Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
+{
+    return GenMeshShape((MeshGenParams){ MESH_GEN_KNOT, { radius, size }, { radSeg, sides } });
+}
+
+// Generate meshes shapes in parallel (jobs system), uploaded to GPU
+// NOTE: Meshes vertex data is generated by jobs system workers, GPU upload is done by calling thread,
+// meshes failing generation are returned empty (vertexCount is 0)
+void GenMeshes(Mesh *meshes, const MeshGenParams *params, int count)
+{
+    if ((meshes == NULL) || (params == NULL) || (count <= 0)) return;
+
+    MeshGenJob job = { meshes, params };
+    JobParallelFor(count, GenMeshShapesJob, &job);
+
+    for (int i = 0; i < count; i++)
+    {
+        // Upload vertex data to GPU (static mesh)
+        if (meshes[i].vertexCount > 0) UploadMesh(&meshes[i], false);
+    }
+}
+
+// Generate a mesh from heightmap
+// NOTE: Vertex data is uploaded to GPU
+Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
+{
+    #define GRAY_VALUE(c) ((float)(c.r + c.g + c.b)/3.0f)
+
+    Mesh mesh = { 0 };
+
+    int mapX = heightmap.width;
+    int mapZ = heightmap.height;
+
+    Color *pixels = LoadImageColors(heightmap);
+
+    // NOTE: One vertex per pixel
+    mesh.triangleCount = (mapX - 1)*(mapZ - 1)*2;    // One quad every four pixels
+
+    mesh.vertexCount = mesh.triangleCount*3;
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.colors = NULL;
+
+    int vCounter = 0;       // Used to count vertices float by float
+    int tcCounter = 0;      // Used to count texcoords float by float
+    int nCounter = 0;       // Used to count normals float by float
+
+    Vector3 scaleFactor = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
+
+    Vector3 vA = { 0 };
+    Vector3 vB = { 0 };
+    Vector3 vC = { 0 };
+    Vector3 vN = { 0 };
+
+    for (int z = 0; z < mapZ-1; z++)
+    {
+        for (int x = 0; x < mapX-1; x++)
+        {
+            // Fill vertices array with data
+            //----------------------------------------------------------
+
+            // one triangle - 3 vertex
+            mesh.vertices[vCounter] = (float)x*scaleFactor.x;
+            mesh.vertices[vCounter + 1] = GRAY_VALUE(pixels[x + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 2] = (float)z*scaleFactor.z;
+
+            mesh.vertices[vCounter + 3] = (float)x*scaleFactor.x;
+            mesh.vertices[vCounter + 4] = GRAY_VALUE(pixels[x + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 5] = (float)(z + 1)*scaleFactor.z;
+
+            mesh.vertices[vCounter + 6] = (float)(x + 1)*scaleFactor.x;
+            mesh.vertices[vCounter + 7] = GRAY_VALUE(pixels[(x + 1) + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 8] = (float)z*scaleFactor.z;
+
+            // Another triangle - 3 vertex
+            mesh.vertices[vCounter + 9] = mesh.vertices[vCounter + 6];
+            mesh.vertices[vCounter + 10] = mesh.vertices[vCounter + 7];
+            mesh.vertices[vCounter + 11] = mesh.vertices[vCounter + 8];
+
+            mesh.vertices[vCounter + 12] = mesh.vertices[vCounter + 3];
+            mesh.vertices[vCounter + 13] = mesh.vertices[vCounter + 4];
+            mesh.vertices[vCounter + 14] = mesh.vertices[vCounter + 5];
+
+            mesh.vertices[vCounter + 15] = (float)(x + 1)*scaleFactor.x;
+            mesh.vertices[vCounter + 16] = GRAY_VALUE(pixels[(x + 1) + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 17] = (float)(z + 1)*scaleFactor.z;
+            vCounter += 18;     // 6 vertex, 18 floats
+
+            // Fill texcoords array with data
+            //--------------------------------------------------------------
+            mesh.texcoords[tcCounter] = (float)x/(mapX - 1);
+            mesh.texcoords[tcCounter + 1] = (float)z/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 2] = (float)x/(mapX - 1);
+            mesh.texcoords[tcCounter + 3] = (float)(z + 1)/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 4] = (float)(x + 1)/(mapX - 1);
+            mesh.texcoords[tcCounter + 5] = (float)z/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 6] = mesh.texcoords[tcCounter + 4];
+            mesh.texcoords[tcCounter + 7] = mesh.texcoords[tcCounter + 5];
+
+            mesh.texcoords[tcCounter + 8] = mesh.texcoords[tcCounter + 2];
+            mesh.texcoords[tcCounter + 9] = mesh.texcoords[tcCounter + 3];
+
+            mesh.texcoords[tcCounter + 10] = (float)(x + 1)/(mapX - 1);
+            mesh.texcoords[tcCounter + 11] = (float)(z + 1)/(mapZ - 1);
+            tcCounter += 12;    // 6 texcoords, 12 floats
+
+            // Fill normals array with data
+            //--------------------------------------------------------------
+            for (int i = 0; i < 18; i += 9)
+            {
+                vA.x = mesh.vertices[nCounter + i];
+                vA.y = mesh.vertices[nCounter + i + 1];
+                vA.z = mesh.vertices[nCounter + i + 2];
+
+                vB.x = mesh.vertices[nCounter + i + 3];
+                vB.y = mesh.vertices[nCounter + i + 4];
+                vB.z = mesh.vertices[nCounter + i + 5];
+
+                vC.x = mesh.vertices[nCounter + i + 6];
+                vC.y = mesh.vertices[nCounter + i + 7];
+                vC.z = mesh.vertices[nCounter + i + 8];
+
+                vN = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vB, vA), Vector3Subtract(vC, vA)));
+
+                mesh.normals[nCounter + i] = vN.x;
+                mesh.normals[nCounter + i + 1] = vN.y;
+                mesh.normals[nCounter + i + 2] = vN.z;
+
+                mesh.normals[nCounter + i + 3] = vN.x;
+                mesh.normals[nCounter + i + 4] = vN.y;
+                mesh.normals[nCounter + i + 5] = vN.z;
+
+                mesh.normals[nCounter + i + 6] = vN.x;
+                mesh.normals[nCounter + i + 7] = vN.y;
+                mesh.normals[nCounter + i + 8] = vN.z;
+            }
+
+            nCounter += 18;     // 6 vertex, 18 floats
+        }
+    }
+
+    UnloadImageColors(pixels);  // Unload pixels color data
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Generate a cubes mesh from pixel data
+// NOTE: Vertex data is uploaded to GPU
+Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
+{
+    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+
+    Mesh mesh = { 0 };
+
+    Color *pixels = LoadImageColors(cubicmap);
+
+    int mapWidth = cubicmap.width;
+    int mapHeight = cubicmap.height;
+
+    float w = cubeSize.x;
+    float h = cubeSize.z;
+    float h2 = cubeSize.y;
+
+    // NOTE: We use texture rectangles to define different textures for top-bottom-front-back-right-left (6)
+    typedef struct RectangleF {
+        float x;
+        float y;
+        float width;
+        float height;
+    } RectangleF;
+
+    RectangleF rightTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
+    RectangleF leftTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
+    RectangleF frontTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
+    RectangleF backTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
+    RectangleF topTexUV = { 0.0f, 0.5f, 0.5f, 0.5f };
+    RectangleF bottomTexUV = { 0.5f, 0.5f, 0.5f, 0.5f };
+
+    // Cube faces definition: 4 corners (cube vertex v1..v8), corners texcoords inside face rectangle,
+    // triangles (two per face) and normal, faces: top, bottom, front, back, right, left (WHITE cubes),
+    // roof and floor (BLACK cells)
+    // NOTE: Faces are generated as indexed quads, faces texcoords are not shared between cubes (atlas rectangles)
+    typedef struct CubicmapFace {
+        int corners[4];
+        Vector2 uvs[4];
+        int triangles[6];
+        Vector3 normal;
+        RectangleF *texUV;
+    } CubicmapFace;
+
+    CubicmapFace faces[8] = {
+        { { 1, 2, 3, 4 }, { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 0 } }, { 0, 1, 2, 0, 2, 3 }, { 0.0f, 1.0f, 0.0f }, &topTexUV },
+        { { 6, 8, 7, 5 }, { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 0, 0 } }, { 0, 1, 2, 0, 3, 1 }, { 0.0f, -1.0f, 0.0f }, &bottomTexUV },
+        { { 2, 7, 3, 8 }, { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } }, { 0, 1, 2, 2, 1, 3 }, { 0.0f, 0.0f, 1.0f }, &frontTexUV },
+        { { 1, 5, 6, 4 }, { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 0, 0 } }, { 0, 1, 2, 0, 3, 1 }, { 0.0f, 0.0f, -1.0f }, &backTexUV },
+        { { 3, 8, 4, 5 }, { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } }, { 0, 1, 2, 2, 1, 3 }, { 1.0f, 0.0f, 0.0f }, &rightTexUV },
+        { { 1, 7, 2, 6 }, { { 0, 0 }, { 1, 1 }, { 1, 0 }, { 0, 1 } }, { 0, 1, 2, 0, 3, 1 }, { -1.0f, 0.0f, 0.0f }, &leftTexUV },
+        { { 1, 3, 2, 4 }, { { 0, 0 }, { 1, 1 }, { 0, 1 }, { 1, 0 } }, { 0, 1, 2, 0, 3, 1 }, { 0.0f, -1.0f, 0.0f }, &topTexUV },
+        { { 6, 7, 8, 5 }, { { 1, 0 }, { 1, 1 }, { 0, 1 }, { 0, 0 } }, { 0, 1, 2, 0, 2, 3 }, { 0.0f, 1.0f, 0.0f }, &bottomTexUV }
+    };
+
+    // Get cells faces to generate, faces counted to allocate only required data
+    unsigned char *cellFaces = (unsigned char *)RL_CALLOC(mapWidth*mapHeight, sizeof(unsigned char));
+    int faceCount = 0;
+
+    for (int z = 0; z < mapHeight; z++)
+    {
+        for (int x = 0; x < mapWidth; x++)
+        {
+            unsigned char mask = 0;
+
+            // We check pixel color to be WHITE -> draw full cube
+            if (COLOR_EQUAL(pixels[z*mapWidth + x], WHITE))
+            {
+                // Top and bottom faces, not required for WHITE cubes, created to allow seeing the map from outside
+                mask = 0x03;
+
+                // Checking collateral cubes, occluded faces are not generated
+                if ((z == mapHeight - 1) || COLOR_EQUAL(pixels[(z + 1)*mapWidth + x], BLACK)) mask |= 0x04;   // Front
+                if ((z == 0) || COLOR_EQUAL(pixels[(z - 1)*mapWidth + x], BLACK)) mask |= 0x08;               // Back
+                if ((x == mapWidth - 1) || COLOR_EQUAL(pixels[z*mapWidth + (x + 1)], BLACK)) mask |= 0x10;    // Right
+                if ((x == 0) || COLOR_EQUAL(pixels[z*mapWidth + (x - 1)], BLACK)) mask |= 0x20;               // Left
+            }
+            // We check pixel color to be BLACK, we will only draw floor and roof
+            else if (COLOR_EQUAL(pixels[z*mapWidth + x], BLACK)) mask = 0xc0;
+
+            cellFaces[z*mapWidth + x] = mask;
+            for (int f = 0; f < 8; f++) if (mask & (1 << f)) faceCount++;
+        }
+    }
+
+    // Indexed quads (4 vertices per face), non-indexed if vertices exceed 16bit indices
+    bool indexed = (faceCount*4 <= 65536);
+
+    mesh.vertexCount = indexed? faceCount*4 : faceCount*6;
+    mesh.triangleCount = faceCount*2;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.indices = indexed? (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short)) : NULL;
+    mesh.colors = NULL;
+
+    int vCounter = 0;       // Used to count vertices
+    int iCounter = 0;       // Used to count indices
+
+    for (int z = 0; z < mapHeight; z++)
+    {
+        for (int x = 0; x < mapWidth; x++)
+        {
+            unsigned char mask = cellFaces[z*mapWidth + x];
+            if (mask == 0) continue;
+
+            // Define the 8 vertex of the cube, indexed by faces corners (v1..v8)
+            Vector3 v[9] = {
+                { 0 },
+                { w*(x - 0.5f), h2, h*(z - 0.5f) },
+                { w*(x - 0.5f), h2, h*(z + 0.5f) },
+                { w*(x + 0.5f), h2, h*(z + 0.5f) },
+                { w*(x + 0.5f), h2, h*(z - 0.5f) },
+                { w*(x + 0.5f), 0, h*(z - 0.5f) },
+                { w*(x - 0.5f), 0, h*(z - 0.5f) },
+                { w*(x - 0.5f), 0, h*(z + 0.5f) },
+                { w*(x + 0.5f), 0, h*(z + 0.5f) }
+            };
+
+            for (int f = 0; f < 8; f++)
+            {
+                if ((mask & (1 << f)) == 0) continue;
+
+                CubicmapFace *face = &faces[f];
+                int count = indexed? 4 : 6;
+
+                for (int k = 0; k < count; k++)
+                {
+                    int corner = indexed? k : face->triangles[k];
+                    Vector3 position = v[face->corners[corner]];
+
+                    mesh.vertices[(vCounter + k)*3] = position.x;
+                    mesh.vertices[(vCounter + k)*3 + 1] = position.y;
+                    mesh.vertices[(vCounter + k)*3 + 2] = position.z;
+                    mesh.normals[(vCounter + k)*3] = face->normal.x;
+                    mesh.normals[(vCounter + k)*3 + 1] = face->normal.y;
+                    mesh.normals[(vCounter + k)*3 + 2] = face->normal.z;
+                    mesh.texcoords[(vCounter + k)*2] = face->texUV->x + face->uvs[corner].x*face->texUV->width;
+                    mesh.texcoords[(vCounter + k)*2 + 1] = face->texUV->y + face->uvs[corner].y*face->texUV->height;
+                }
+
+                if (indexed) for (int k = 0; k < 6; k++) mesh.indices[iCounter++] = (unsigned short)(vCounter + face->triangles[k]);
+
+                vCounter += count;
+            }
+        }
+    }
+
+    RL_FREE(cellFaces);
+
+    UnloadImageColors(pixels);   // Unload pixels color data
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+#endif      // SUPPORT_MESH_GENERATION
+
+// Load terrain from heightmap image, split in chunks of size (power of two) with LOD levels
+// NOTE: Heights are stored as 16 bit samples, chunks meshes are generated by UpdateTerrain(),
+// terrain space matches GenMeshHeightmap(): from (0, 0, 0) to size
+Terrain LoadTerrain(Image heightmap, Vector3 size, int chunkSize, int lodCount)
+{
+    Terrain terrain = { 0 };
+
+    if ((heightmap.data == NULL) || (heightmap.width < 2) || (heightmap.height < 2) || (heightmap.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain, heightmap image not valid");
+        return terrain;
+    }
+
+    // Chunk size is a power of two, LOD levels vertex steps divide chunks evenly
+    int chunk = 1;
+    while ((chunk < chunkSize) && (chunk < TERRAIN_MAX_CHUNK_SIZE)) chunk *= 2;
+
+    if (lodCount < 1) lodCount = 1;
+    if (lodCount > TERRAIN_MAX_LOD_LEVELS) lodCount = TERRAIN_MAX_LOD_LEVELS;
+    while ((1 << (lodCount - 1)) > chunk) lodCount--;
+
+    terrain.width = heightmap.width;
+    terrain.height = heightmap.height;
+    terrain.size = size;
+    terrain.chunkSize = chunk;
+    terrain.chunksX = (terrain.width - 1 + chunk - 1)/chunk;
+    terrain.chunksZ = (terrain.height - 1 + chunk - 1)/chunk;
+    terrain.lodCount = lodCount;
+    terrain.lodDistance = 2.0f*fmaxf(size.x*chunk/(terrain.width - 1), size.z*chunk/(terrain.height - 1));
+    terrain.viewDistance = terrain.lodDistance*(float)(1 << lodCount);
+    terrain.heights = (unsigned short *)RL_MALLOC((size_t)terrain.width*terrain.height*sizeof(unsigned short));
+    terrain.chunks = (TerrainChunk *)RL_CALLOC(terrain.chunksX*terrain.chunksZ, sizeof(TerrainChunk));
+
+    // Convert heightmap pixels to normalized heights, color pixels use gray value (same as GenMeshHeightmap())
+    int pixelSize = GetPixelDataSize(1, 1, heightmap.format);
+    int count = terrain.width*terrain.height;
+
+    if (heightmap.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        for (int i = 0; i < count; i++) terrain.heights[i] = ((unsigned char *)heightmap.data)[i]*257;
+    }
+    else if (heightmap.format == PIXELFORMAT_UNCOMPRESSED_R32)
+    {
+        for (int i = 0; i < count; i++) terrain.heights[i] = (unsigned short)(Clamp(((float *)heightmap.data)[i], 0.0f, 1.0f)*65535.0f + 0.5f);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            Color color = GetPixelColor((unsigned char *)heightmap.data + (size_t)i*pixelSize, heightmap.format);
+            terrain.heights[i] = (unsigned short)(((color.r + color.g + color.b)*257 + 1)/3);
+        }
+    }
+
+    // Compute chunks bounds from heights range
+    for (int cz = 0; cz < terrain.chunksZ; cz++)
+    {
+        for (int cx = 0; cx < terrain.chunksX; cx++)
+        {
+            TerrainChunk *tchunk = &terrain.chunks[cz*terrain.chunksX + cx];
+            int x0 = cx*chunk, z0 = cz*chunk;
+            int x1 = (x0 + chunk < terrain.width - 1)? x0 + chunk : terrain.width - 1;
+            int z1 = (z0 + chunk < terrain.height - 1)? z0 + chunk : terrain.height - 1;
+            unsigned short minHeight = 0xffff, maxHeight = 0;
+
+            for (int z = z0; z <= z1; z++)
+            {
+                for (int x = x0; x <= x1; x++)
+                {
+                    unsigned short value = terrain.heights[z*terrain.width + x];
+                    if (value < minHeight) minHeight = value;
+                    if (value > maxHeight) maxHeight = value;
+                }
+            }
+
+            tchunk->lod = -1;
+            tchunk->request = -1;
+            tchunk->bounds.min = (Vector3){ x0*size.x/(terrain.width - 1), minHeight*size.y/65535.0f, z0*size.z/(terrain.height - 1) };
+            tchunk->bounds.max = (Vector3){ x1*size.x/(terrain.width - 1), maxHeight*size.y/65535.0f, z1*size.z/(terrain.height - 1) };
+        }
+    }
+
+    TRACELOG(LOG_INFO, "TERRAIN: Terrain loaded successfully (%ix%i samples, %ix%i chunks, %i LOD levels)",
+        terrain.width, terrain.height, terrain.chunksX, terrain.chunksZ, terrain.lodCount);
+
+    return terrain;
+}
+
+// Unload terrain chunks meshes and heightmap data (waits for pending chunks)
+void UnloadTerrain(Terrain terrain)
+{
+    for (int i = 0; i < terrain.chunksX*terrain.chunksZ; i++)
+    {
+        TerrainChunk *chunk = &terrain.chunks[i];
+
+        if (chunk->request >= 0)
+        {
+            // NOTE: Loader thread could be using terrain heights, pending request must be finished
+            while (!IsAsyncLoadReady(chunk->request)) ProcessAsyncLoads(0.0);
+
+            TerrainChunkAsyncLoad *load = (TerrainChunkAsyncLoad *)GetAsyncLoadData(chunk->request, FinalizeTerrainChunkAsync);
+
+            if (load != NULL)
+            {
+                UnloadMesh(load->mesh);
+                RL_FREE(load);
+            }
+        }
+
+        if (chunk->lod >= 0) UnloadMesh(chunk->mesh);
+    }
+
+    RL_FREE(terrain.chunks);
+    RL_FREE(terrain.heights);
+}
+
+// Update terrain chunks LOD levels by view distance (terrain space), meshes generated on loader thread
+// NOTE: Chunks keep current mesh until new LOD level mesh is generated, nearest chunks are requested first
+void UpdateTerrain(Terrain *terrain, Vector3 viewPosition)
+{
+    int chunkCount = terrain->chunksX*terrain->chunksZ;
+    int pendingCount = 0;
+
+    if ((terrain->chunks == NULL) || (chunkCount <= 0)) return;
+
+    // Retrieve generated chunks meshes
+    for (int i = 0; i < chunkCount; i++)
+    {
+        TerrainChunk *chunk = &terrain->chunks[i];
+
+        if ((chunk->request >= 0) && IsAsyncLoadReady(chunk->request))
+        {
+            TerrainChunkAsyncLoad *load = (TerrainChunkAsyncLoad *)GetAsyncLoadData(chunk->request, FinalizeTerrainChunkAsync);
+
+            if (load != NULL)
+            {
+                if (chunk->lod >= 0) UnloadMesh(chunk->mesh);
+
+                chunk->mesh = load->mesh;
+                chunk->lod = load->lod;
+                RL_FREE(load);
+            }
+
+            chunk->request = -1;
+        }
+
+        if (chunk->request >= 0) pendingCount++;
+    }
+
+    // Select chunks LOD levels by view distance to chunk bounds
+    int *lods = (int *)RL_MALLOC(chunkCount*sizeof(int));
+    float *distances = (float *)RL_MALLOC(chunkCount*sizeof(float));
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        TerrainChunk *chunk = &terrain->chunks[i];
+        Vector3 closest = Vector3Clamp(viewPosition, chunk->bounds.min, chunk->bounds.max);
+        float distance = Vector3Distance(viewPosition, closest);
+        float limit = terrain->lodDistance;
+        int lod = 0;
+
+        while ((distance > limit) && (lod < (terrain->lodCount - 1))) { lod++; limit *= 2.0f; }
+        if ((terrain->viewDistance > 0.0f) && (distance > terrain->viewDistance)) lod = -1;
+
+        // Chunks out of view distance are unloaded
+        if ((lod < 0) && (chunk->lod >= 0) && (chunk->request < 0))
+        {
+            UnloadMesh(chunk->mesh);
+            chunk->mesh = (Mesh){ 0 };
+            chunk->lod = -1;
+        }
+
+        lods[i] = lod;
+        distances[i] = distance;
+    }
+
+    // Request chunks meshes with LOD level changed, nearest first
+    while (pendingCount < MAX_TERRAIN_CHUNK_REQUESTS)
+    {
+        int nearest = -1;
+
+        for (int i = 0; i < chunkCount; i++)
+        {
+            TerrainChunk *chunk = &terrain->chunks[i];
+
+            if ((chunk->request < 0) && (lods[i] >= 0) && (lods[i] != chunk->lod) &&
+                ((nearest < 0) || (distances[i] < distances[nearest]))) nearest = i;
+        }
+
+        if (nearest < 0) break;
+
+        TerrainChunk *chunk = &terrain->chunks[nearest];
+        TerrainChunkAsyncLoad *load = (TerrainChunkAsyncLoad *)RL_CALLOC(1, sizeof(TerrainChunkAsyncLoad));
+        int cx = nearest%terrain->chunksX;
+        int cz = nearest/terrain->chunksX;
+
+        load->heights = terrain->heights;
+        load->width = terrain->width;
+        load->height = terrain->height;
+        load->size = terrain->size;
+        load->x = cx*terrain->chunkSize;
+        load->z = cz*terrain->chunkSize;
+        load->quadsX = ((load->x + terrain->chunkSize) < (terrain->width - 1))? terrain->chunkSize : terrain->width - 1 - load->x;
+        load->quadsZ = ((load->z + terrain->chunkSize) < (terrain->height - 1))? terrain->chunkSize : terrain->height - 1 - load->z;
+        load->lod = lods[nearest];
+        load->lodCount = terrain->lodCount;
+
+        chunk->request = LoadAsync(GenTerrainChunkAsync, FinalizeTerrainChunkAsync, load);
+
+        if (chunk->request < 0)
+        {
+            RL_FREE(load);
+            break;
+        }
+
+        pendingCount++;
+    }
+
+    RL_FREE(lods);
+    RL_FREE(distances);
+}
+
+// Draw terrain loaded chunks visible in view frustum
+void DrawTerrain(Terrain terrain, Material material, Matrix transform)
+{
+    // Get frustum in terrain space from current matrices, chunks bounds are checked directly
+    bool culling = !rlIsStereoRenderEnabled();
+    Frustum frustum = { 0 };
+
+    if (culling) frustum = GetMatrixFrustum(MatrixMultiply(MatrixMultiply(MatrixMultiply(transform,
+        rlGetMatrixTransform()), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+    for (int i = 0; i < terrain.chunksX*terrain.chunksZ; i++)
+    {
+        TerrainChunk *chunk = &terrain.chunks[i];
+
+        if ((chunk->lod < 0) || (culling && !CheckFrustumBox(frustum, chunk->bounds))) continue;
+
+        DrawMesh(chunk->mesh, material, transform);
+    }
+}
+
+// Get terrain height at position (terrain space, bilinear)
+// NOTE: Positions out of terrain are clamped to terrain borders
+float GetTerrainHeight(Terrain terrain, float x, float z)
+{
+    if (terrain.heights == NULL) return 0.0f;
+
+    float fx = Clamp(x/terrain.size.x, 0.0f, 1.0f)*(terrain.width - 1);
+    float fz = Clamp(z/terrain.size.z, 0.0f, 1.0f)*(terrain.height - 1);
+    int x0 = (int)fx, z0 = (int)fz;
+    int x1 = (x0 < (terrain.width - 1))? x0 + 1 : x0;
+    int z1 = (z0 < (terrain.height - 1))? z0 + 1 : z0;
+    float tx = fx - x0, tz = fz - z0;
+
+    float h0 = Lerp(terrain.heights[z0*terrain.width + x0], terrain.heights[z0*terrain.width + x1], tx);
+    float h1 = Lerp(terrain.heights[z1*terrain.width + x0], terrain.heights[z1*terrain.width + x1], tx);
+
+    return Lerp(h0, h1, tz)*terrain.size.y/65535.0f;
+}
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox GetMeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+
+    // Create the bounding box
+    BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Compute mesh tangents
+// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions, normals and texture coordinates,
+// triangles tangents are accumulated on vertices weighted by corner angle (indexed or not), vertices with same
+// position, normal and texcoords are welded, so shared and duplicated vertices get the same tangent (MikkTSpace-like)
+// Triangles and vertices are processed in parallel by jobs system (if initialized), scratch memory is kept between calls
+void GenMeshTangents(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires normal and texcoord vertex attribute data");
+        return;
+    }
+
+    int vertexCount = mesh->vertexCount;
+    int triangleCount = (mesh->indices != NULL)? mesh->triangleCount : vertexCount/3;
+    int cornerCount = triangleCount*3;
+    int hashSize = 16;
+    while (hashSize < vertexCount*2) hashSize *= 2;
+
+    // Scratch memory: corners tangents and bitangents, corners by welded vertex and vertices weld table
+    size_t scratchSize = cornerCount*2*sizeof(Vector3) + (cornerCount + (vertexCount + 1)*2 + hashSize)*sizeof(int);
+    if (scratchSize > tangentsScratchSize)
+    {
+        RL_FREE(tangentsScratch);
+        tangentsScratch = (unsigned char *)RL_MALLOC(scratchSize);
+        tangentsScratchSize = (tangentsScratch != NULL)? scratchSize : 0;
+        if (tangentsScratch == NULL) return;
+    }
+
+    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(vertexCount*4*sizeof(float));
+
+    MeshTangentsJob job = { 0 };
+    job.mesh = mesh;
+    job.cornerTangents = (Vector3 *)tangentsScratch;
+    job.cornerBitangents = job.cornerTangents + cornerCount;
+    job.corners = (int *)(job.cornerBitangents + cornerCount);
+    job.cornerOffsets = job.corners + cornerCount;
+    job.welds = job.cornerOffsets + vertexCount + 1;
+    int *hash = job.welds + vertexCount;
+
+    // Weld vertices with same position, normal and texcoords, welded vertex is first vertex with same data
+    for (int i = 0; i < hashSize; i++) hash[i] = -1;
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const unsigned int *data[3] = { (const unsigned int *)&mesh->vertices[i*3], (const unsigned int *)&mesh->normals[i*3], (const unsigned int *)&mesh->texcoords[i*2] };
+        unsigned int h = 2166136261u;
+        for (int k = 0; k < 8; k++) h = (h ^ ((k < 3)? data[0][k] : (k < 6)? data[1][k - 3] : data[2][k - 6]))*16777619u;
+
+        int slot = (int)(h & (hashSize - 1));
+        job.welds[i] = i;
+
+        while (hash[slot] >= 0)
+        {
+            int j = hash[slot];
+
+            if ((memcmp(&mesh->vertices[i*3], &mesh->vertices[j*3], 3*sizeof(float)) == 0) &&
+                (memcmp(&mesh->normals[i*3], &mesh->normals[j*3], 3*sizeof(float)) == 0) &&
+                (memcmp(&mesh->texcoords[i*2], &mesh->texcoords[j*2], 2*sizeof(float)) == 0))
+            {
+                job.welds[i] = j;
+                break;
+            }
+
+            slot = (slot + 1) & (hashSize - 1);
+        }
+
+        if (job.welds[i] == i) hash[slot] = i;
+    }
+
+    // Triangles corners tangents
+    JobParallelFor(triangleCount, ComputeTriangleTangents, &job);
+
+    // Corners grouped by welded vertex (counting sort)
+    memset(job.cornerOffsets, 0, (vertexCount + 1)*sizeof(int));
+    for (int c = 0; c < cornerCount; c++)
+    {
+        int index = (mesh->indices != NULL)? mesh->indices[c] : c;
+        job.cornerOffsets[job.welds[index] + 1]++;
+    }
+
+    for (int i = 0; i < vertexCount; i++) job.cornerOffsets[i + 1] += job.cornerOffsets[i];
+
+    int *cursor = hash;     // Hash table reused, vertexCount*2 <= hashSize
+    memcpy(cursor, job.cornerOffsets, vertexCount*sizeof(int));
+    for (int c = 0; c < cornerCount; c++)
+    {
+        int index = (mesh->indices != NULL)? mesh->indices[c] : c;
+        job.corners[cursor[job.welds[index]]++] = c;
+    }
+
+    // Vertices tangents from welded vertex corners
+    JobParallelFor(vertexCount, ComputeVertexTangents, &job);
+
+    if (mesh->vboId != NULL)
+    {
+        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
+        {
+            // Update existing vertex buffer
+            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
+        }
+        else
+        {
+            // Load a new tangent attributes buffer
+            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+        }
+
+        rlEnableVertexArray(mesh->vaoId);
+        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(4);
+        rlDisableVertexArray();
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+}
+
+// Optimize mesh indices and vertices order for GPU rendering (MeshOptimizeFlags)
+// NOTE: Mesh data is optimized in place (vertex attributes remapped), non-indexed meshes are always indexed,
+// indices are 16bit so meshes with more than 65535 unique vertices can not be indexed,
+// meshes already uploaded to GPU are uploaded again (static buffers)
+void OptimizeMesh(Mesh *mesh, unsigned int flags)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (mesh->triangleCount <= 0)) return;
+
+    int indexCount = mesh->triangleCount*3;
+    int vertexCount = mesh->vertexCount;
+    float missRatio = (mesh->indices != NULL)? GetMeshCacheMissRatio(mesh->indices, indexCount, vertexCount) : 3.0f;
+
+    // Triangles reordering requires indices
+    if (mesh->indices == NULL)
+    {
+        if (vertexCount < indexCount)
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to optimize mesh, vertex data not matching triangles");
+            return;
+        }
+
+        flags |= MESH_OPTIMIZE_INDICES;
+    }
+
+    bool uploaded = (mesh->vaoId > 0);
+
+    // Mesh LOD levels indices refer to mesh vertices order, levels must be generated again if vertices are remapped
+    if ((mesh->lodCount > 0) && (flags & (MESH_OPTIMIZE_INDICES | MESH_OPTIMIZE_VERTEX_FETCH)))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh LODs discarded by vertices optimization, generate LODs after optimizing mesh");
+
+        RL_FREE(mesh->lodTriangles);
+        RL_FREE(mesh->lodErrors);
+        RL_FREE(mesh->lodIndices);
+        mesh->lodTriangles = NULL;
+        mesh->lodErrors = NULL;
+        mesh->lodIndices = NULL;
+        mesh->lodCount = 0;
+        mesh->lodLevel = 0;
+    }
+
+    if ((flags & MESH_OPTIMIZE_INDICES) && !IndexMeshVertices(mesh))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to optimize mesh, unique vertices exceed 16bit indices");
+        return;
+    }
+
+    if (flags & MESH_OPTIMIZE_VERTEX_CACHE) OptimizeMeshVertexCache(mesh->indices, indexCount, mesh->vertexCount);
+    if (flags & MESH_OPTIMIZE_OVERDRAW) OptimizeMeshOverdraw(mesh->vertices, mesh->indices, indexCount, mesh->vertexCount);
+    if (flags & MESH_OPTIMIZE_VERTEX_FETCH) OptimizeMeshVertexFetch(mesh);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh optimized: %i -> %i vertices, cache miss ratio %.2f -> %.2f", vertexCount, mesh->vertexCount,
+        missRatio, GetMeshCacheMissRatio(mesh->indices, indexCount, mesh->vertexCount));
+
+    // Mesh buffers sizes changed, vertex data is uploaded again (keeping packing)
+    if (uploaded) UploadMeshPacked(mesh, false, mesh->packFlags);
+}
+// Generate mesh LOD levels, simplified indices sharing mesh vertices (quadric error edge collapses)
+// NOTE: Every level halves previous level triangles if simplification error (relative to mesh bounds size) keeps
+// under targetError, levels generation stops when simplification can not reduce triangles, non-indexed meshes are indexed,
+// meshes already uploaded to GPU are uploaded again (static buffers), LOD levels drawn are set on mesh.lodLevel
+void GenMeshLODs(Mesh *mesh, int levels, float targetError)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (mesh->triangleCount <= 0)) return;
+
+    if (levels > MESH_LOD_MAX_LEVELS) levels = MESH_LOD_MAX_LEVELS;
+
+    // Previous LOD levels are discarded
+    RL_FREE(mesh->lodTriangles);
+    RL_FREE(mesh->lodErrors);
+    RL_FREE(mesh->lodIndices);
+    mesh->lodTriangles = NULL;
+    mesh->lodErrors = NULL;
+    mesh->lodIndices = NULL;
+    mesh->lodCount = 0;
+    mesh->lodLevel = 0;
+
+    if (levels < 2) return;
+
+    bool uploaded = (mesh->vboId != NULL);
+    bool indexed = false;
+
+    // Simplification collapses shared vertices, indices required
+    if (mesh->indices == NULL)
+    {
+        if ((mesh->vertexCount < mesh->triangleCount*3) || !IndexMeshVertices(mesh))
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh LODs, mesh vertices can not be indexed");
+            return;
+        }
+
+        indexed = true;
+    }
+
+    int vertexCount = mesh->vertexCount;
+    int indexCount = mesh->triangleCount*3;
+
+    MeshSimplifyData data = { 0 };
+    data.vertexCount = vertexCount;
+    data.points = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+    data.group = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    data.groupNext = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    data.quadrics = (MeshQuadric *)RL_CALLOC(vertexCount, sizeof(MeshQuadric));
+    data.remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    data.locked = (bool *)RL_MALLOC(vertexCount*sizeof(bool));
+    data.adjacencyStart = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    data.adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    data.collapses = (MeshCollapse *)RL_MALLOC(indexCount*2*sizeof(MeshCollapse));
+
+    // Positions relative to mesh bounds, simplification error is relative to mesh size
+    BoundingBox bounds = GetMeshBoundingBox(*mesh);
+    Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    Vector3 extent = Vector3Subtract(bounds.max, bounds.min);
+    float size = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    if (size <= 0.0f) size = 1.0f;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        Vector3 position = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
+        data.points[v] = Vector3Scale(Vector3Subtract(position, center), 1.0f/size);
+    }
+
+    // Vertices position groups, vertices are hashed (FNV-1a) by position
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        const unsigned char *position = (const unsigned char *)(mesh->vertices + v*3);
+        unsigned int hash = 2166136261u;
+        for (int b = 0; b < 3*(int)sizeof(float); b++) hash = (hash ^ position[b])*16777619u;
+
+        int slot = (int)(hash & (unsigned int)(tableSize - 1));
+        while ((table[slot] >= 0) && (memcmp(mesh->vertices + table[slot]*3, position, 3*sizeof(float)) != 0)) slot = (slot + 1) & (tableSize - 1);
+
+        if (table[slot] < 0)
+        {
+            table[slot] = v;
+            data.group[v] = v;
+            data.groupNext[v] = v;
+        }
+        else
+        {
+            int group = table[slot];
+            data.group[v] = group;
+            data.groupNext[v] = data.groupNext[group];
+            data.groupNext[group] = v;
+        }
+    }
+
+    RL_FREE(table);
+
+    // Working indices, degenerate triangles (repeated positions) are discarded
+    unsigned short *indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    int triangleCount = 0;
+
+    for (int t = 0; t < mesh->triangleCount; t++)
+    {
+        const unsigned short *triangle = mesh->indices + t*3;
+        int g0 = data.group[triangle[0]], g1 = data.group[triangle[1]], g2 = data.group[triangle[2]];
+        if ((g0 == g1) || (g1 == g2) || (g0 == g2)) continue;
+
+        memcpy(indices + triangleCount*3, triangle, 3*sizeof(unsigned short));
+        triangleCount++;
+    }
+
+    // Faces quadrics: triangles planes weighted by area, accumulated on triangle position groups
+    MeshEdge *edges = (MeshEdge *)RL_MALLOC(triangleCount*3*sizeof(MeshEdge));
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        Vector3 p0 = data.points[indices[t*3]];
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(data.points[indices[t*3 + 1]], p0), Vector3Subtract(data.points[indices[t*3 + 2]], p0));
+        float area = Vector3Length(normal);
+
+        if (area > 0.0f)
+        {
+            normal = Vector3Scale(normal, 1.0f/area);
+            for (int k = 0; k < 3; k++) AddMeshQuadricPlane(&data.quadrics[data.group[indices[t*3 + k]]], normal, -Vector3DotProduct(normal, p0), area*0.5f);
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            int ga = data.group[indices[t*3 + k]];
+            int gb = data.group[indices[t*3 + (k + 1)%3]];
+            edges[t*3 + k] = (MeshEdge){ (ga < gb)? ga : gb, (ga < gb)? gb : ga, t };
+        }
+    }
+
+    // Borders quadrics: edges used by one triangle, planes perpendicular to triangle through edge
+    // NOTE: Border vertices keep near the border line, open meshes silhouette is preserved
+    qsort(edges, triangleCount*3, sizeof(MeshEdge), CompareMeshEdges);
+
+    for (int i = 0; i < triangleCount*3;)
+    {
+        int count = 1;
+        while (((i + count) < triangleCount*3) && (edges[i + count].a == edges[i].a) && (edges[i + count].b == edges[i].b)) count++;
+
+        if (count == 1)
+        {
+            const unsigned short *triangle = indices + edges[i].triangle*3;
+            Vector3 p0 = data.points[triangle[0]];
+            Vector3 normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(data.points[triangle[1]], p0), Vector3Subtract(data.points[triangle[2]], p0)));
+
+            Vector3 edge = Vector3Subtract(data.points[edges[i].b], data.points[edges[i].a]);
+            Vector3 border = Vector3Normalize(Vector3CrossProduct(edge, normal));
+            float distance = -Vector3DotProduct(border, data.points[edges[i].a]);
+            float weight = Vector3DotProduct(edge, edge)*MESH_LOD_BORDER_WEIGHT;
+
+            AddMeshQuadricPlane(&data.quadrics[edges[i].a], border, distance, weight);
+            AddMeshQuadricPlane(&data.quadrics[edges[i].b], border, distance, weight);
+        }
+
+        i += count;
+    }
+
+    RL_FREE(edges);
+
+    // Generate LOD levels, every level simplified from previous level
+    int *lodTriangles = (int *)RL_CALLOC(levels, sizeof(int));
+    float *lodErrors = (float *)RL_CALLOC(levels, sizeof(float));
+    unsigned short *lodIndices = NULL;
+    int lodIndexCount = 0;
+    int lodCount = 1;
+    float error = 0.0f;
+
+    lodTriangles[0] = mesh->triangleCount;
+
+    while (lodCount < levels)
+    {
+        int count = SimplifyMeshIndices(&data, indices, triangleCount, lodTriangles[lodCount - 1]/2, targetError, &error);
+        if ((count == 0) || (count > (int)(lodTriangles[lodCount - 1]*MESH_LOD_MIN_REDUCTION))) break;
+
+        triangleCount = count;
+
+        unsigned short *levelIndices = (unsigned short *)RL_REALLOC(lodIndices, (lodIndexCount + count*3)*sizeof(unsigned short));
+        if (levelIndices == NULL) break;
+
+        lodIndices = levelIndices;
+        memcpy(lodIndices + lodIndexCount, indices, count*3*sizeof(unsigned short));
+        OptimizeMeshVertexCache(lodIndices + lodIndexCount, count*3, vertexCount);
+
+        lodIndexCount += count*3;
+        lodTriangles[lodCount] = count;
+        lodErrors[lodCount] = sqrtf(error);
+        lodCount++;
+    }
+
+    RL_FREE(indices);
+    RL_FREE(data.points);
+    RL_FREE(data.group);
+    RL_FREE(data.groupNext);
+    RL_FREE(data.quadrics);
+    RL_FREE(data.remap);
+    RL_FREE(data.locked);
+    RL_FREE(data.adjacencyStart);
+    RL_FREE(data.adjacency);
+    RL_FREE(data.collapses);
+
+    if (lodCount > 1)
+    {
+        mesh->lodCount = lodCount;
+        mesh->lodTriangles = lodTriangles;
+        mesh->lodErrors = lodErrors;
+        mesh->lodIndices = lodIndices;
+
+        TRACELOG(LOG_INFO, "MESH: Mesh LODs generated: %i levels, %i -> %i triangles (error: %.4f)", lodCount,
+            lodTriangles[0], lodTriangles[lodCount - 1], lodErrors[lodCount - 1]);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh LODs not generated, mesh can not be simplified under target error");
+
+        RL_FREE(lodTriangles);
+        RL_FREE(lodErrors);
+        RL_FREE(lodIndices);
+    }
+
+    // Mesh indices buffer changed, vertex data is uploaded again (keeping packing)
+    if (uploaded && (indexed || (lodCount > 1))) UploadMeshPacked(mesh, false, mesh->packFlags);
+}
+
+
+// Draw a model (with texture if set)
+void DrawModel(Model model, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    // Get frustum in model space from current matrices, meshes bounds are checked directly
+    // NOTE: Skinned meshes are only culled if bounds are updated by animation (bones bounds)
+    bool culling = (modelFrustumCulling && (model.meshBounds != NULL) && !rlIsStereoRenderEnabled());
+    Frustum frustum = { 0 };
+
+    if (culling) frustum = GetMatrixFrustum(MatrixMultiply(MatrixMultiply(MatrixMultiply(model.transform,
+        rlGetMatrixTransform()), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+    // Streamed textures mipmaps requested by meshes projected size (texture mapped once over mesh bounds)
+    bool streaming = ((GetTextureStreamingMemory() > 0) && (model.meshBounds != NULL));
+    Matrix matModelView = { 0 };
+    float pixelScale = 0.0f;
+    float unitScale = 0.0f;
+    bool perspective = false;
+
+    if (streaming)
+    {
+        Matrix matProjection = rlGetMatrixProjection();
+        matModelView = MatrixMultiply(MatrixMultiply(model.transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+        perspective = (matProjection.m15 == 0.0f);
+        pixelScale = fabsf(matProjection.m5)*(float)rlGetFramebufferHeight()*0.5f;
+        unitScale = sqrtf(fmaxf(matModelView.m0*matModelView.m0 + matModelView.m1*matModelView.m1 + matModelView.m2*matModelView.m2,
+            fmaxf(matModelView.m4*matModelView.m4 + matModelView.m5*matModelView.m5 + matModelView.m6*matModelView.m6,
+            matModelView.m8*matModelView.m8 + matModelView.m9*matModelView.m9 + matModelView.m10*matModelView.m10)));
+    }
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (culling && ((model.meshes[i].boneWeights == NULL) || (model.boneBounds != NULL)) &&
+            !CheckFrustumBox(frustum, model.meshBounds[i])) continue;
+
+        if (streaming)
+        {
+            BoundingBox bounds = model.meshBounds[i];
+            Vector3 extent = Vector3Subtract(bounds.max, bounds.min);
+            Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f), matModelView);
+            float distance = -center.z - Vector3Length(extent)*0.5f*unitScale;
+
+            // Camera inside mesh bounds requests full resolution
+            float screenSize = (perspective && (distance <= 0.0f))? FLT_MAX :
+                fmaxf(extent.x, fmaxf(extent.y, extent.z))*unitScale*(perspective? pixelScale/distance : pixelScale);
+
+            Material *material = &model.materials[model.meshMaterial[i]];
+            for (int m = 0; m < MAX_MATERIAL_MAPS; m++) RequestTextureStreaming(material->maps[m].texture, screenSize);
+        }
+
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+// Draw a model with meshes LOD levels selected by projected size
+// NOTE: Current view and projection matrices (BeginMode3D()) are used, every mesh draws the coarsest LOD level with
+// simplification error projected under MESH_LOD_PIXEL_ERROR pixels, meshes without LOD levels draw full detail
+void DrawModelLOD(Model model, Vector3 position, float scale, Color tint)
+{
+    Matrix matTransform = MatrixMultiply(MatrixScale(scale, scale, scale), MatrixTranslate(position.x, position.y, position.z));
+    Matrix matModelView = MatrixMultiply(MatrixMultiply(MatrixMultiply(model.transform, matTransform), rlGetMatrixTransform()), rlGetMatrixModelview());
+    Matrix matProjection = rlGetMatrixProjection();
+
+    // Projected pixels for one view space unit: at unit distance (perspective) or at any distance (orthographic)
+    bool perspective = (matProjection.m15 == 0.0f);
+    float pixelScale = fabsf(matProjection.m5)*(float)rlGetFramebufferHeight()*0.5f;
+
+    // View space units for one model space unit (largest axis scale)
+    float unitScale = sqrtf(fmaxf(matModelView.m0*matModelView.m0 + matModelView.m1*matModelView.m1 + matModelView.m2*matModelView.m2,
+        fmaxf(matModelView.m4*matModelView.m4 + matModelView.m5*matModelView.m5 + matModelView.m6*matModelView.m6,
+        matModelView.m8*matModelView.m8 + matModelView.m9*matModelView.m9 + matModelView.m10*matModelView.m10)));
+
+    int *levels = (int *)RL_MALLOC(model.meshCount*sizeof(int));
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh *mesh = &model.meshes[i];
+        levels[i] = mesh->lodLevel;
+        mesh->lodLevel = 0;
+
+        if (mesh->lodCount <= 1) continue;
+
+        BoundingBox bounds = (model.meshBounds != NULL)? model.meshBounds[i] : GetMeshBoundingBox(*mesh);
+        Vector3 extent = Vector3Subtract(bounds.max, bounds.min);
+        Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f), matModelView);
+        float size = fmaxf(extent.x, fmaxf(extent.y, extent.z))*unitScale;
+        float radius = Vector3Length(extent)*0.5f*unitScale;
+
+        // Mesh bounds nearest distance to camera (view space looks towards -Z), camera inside bounds draws full detail
+        float distance = -center.z - radius;
+        if (perspective && (distance <= 0.0f)) continue;
+
+        float pixels = perspective? pixelScale/distance : pixelScale;
+
+        while (((mesh->lodLevel + 1) < mesh->lodCount) &&
+            ((mesh->lodErrors[mesh->lodLevel + 1]*size*pixels) <= MESH_LOD_PIXEL_ERROR)) mesh->lodLevel++;
+    }
+
+    DrawModelEx(model, position, (Vector3){ 0.0f, 1.0f, 0.0f }, 0.0f, (Vector3){ scale, scale, scale }, tint);
+
+    // Restore meshes LOD levels, queued meshes (BeginMeshQueue()) keep LOD level selected
+    for (int i = 0; i < model.meshCount; i++) model.meshes[i].lodLevel = levels[i];
+
+    RL_FREE(levels);
+}
+
+// Load occlusion query for a drawn model
+// NOTE: Model is considered visible until first query result is available
+OcclusionQuery LoadOcclusionQuery(void)
+{
+    OcclusionQuery query = { 0 };
+
+    query.id = rlLoadOcclusionQuery();
+    query.pending = false;
+    query.visible = true;
+
+    return query;
+}
+
+// Unload occlusion query from GPU memory
+void UnloadOcclusionQuery(OcclusionQuery query)
+{
+    rlUnloadOcclusionQuery(query.id);
+}
+
+// Draw a model if its bounding box was not occluded
+// NOTE: Model bounding box is drawn (color and depth writes disabled) inside an occlusion query whose result is read back
+// on next frames without waiting for GPU, latest result decides if model is drawn; while model is considered occluded,
+// it is drawn conditioned by the pending query on GPU if supported, so it is not drawn one frame late when it appears.
+// Occluders must be drawn before, bounding box crossing near plane (camera inside it) is considered visible
+void DrawModelOccluded(Model model, OcclusionQuery *query, Vector3 position, float scale, Color tint)
+{
+    if ((query == NULL) || (query->id == 0))
+    {
+        DrawModel(model, position, scale, tint);
+        return;
+    }
+
+    // Read back previous frames query result, if available
+    if (query->pending)
+    {
+        int result = rlGetOcclusionQueryResult(query->id);
+
+        if (result >= 0)
+        {
+            query->visible = (result > 0);
+            query->pending = false;
+        }
+    }
+
+    // Get model bounding box corners, transformed by model transform
+    BoundingBox bounds = GetModelBoundingBox(model);
+    Matrix matTransform = MatrixMultiply(model.transform, MatrixMultiply(MatrixScale(scale, scale, scale), MatrixTranslate(position.x, position.y, position.z)));
+    Matrix matMVP = MatrixMultiply(MatrixMultiply(MatrixMultiply(matTransform, rlGetMatrixTransform()), rlGetMatrixModelview()), rlGetMatrixProjection());
+
+    Vector3 corners[8] = { 0 };
+    bool clipped = false;
+
+    for (int i = 0; i < 8; i++)
+    {
+        Vector3 corner = { (i & 1)? bounds.max.x : bounds.min.x, (i & 2)? bounds.max.y : bounds.min.y, (i & 4)? bounds.max.z : bounds.min.z };
+        corners[i] = Vector3Transform(corner, matTransform);
+
+        // Check corner clip space position behind near plane (z < -w)
+        float z = matMVP.m2*corner.x + matMVP.m6*corner.y + matMVP.m10*corner.z + matMVP.m14;
+        float w = matMVP.m3*corner.x + matMVP.m7*corner.y + matMVP.m11*corner.z + matMVP.m15;
+        if (z < -w) clipped = true;
+    }
+
+    if (clipped)
+    {
+        // Bounding box clipped by near plane, query would miss visible samples
+        query->visible = true;
+    }
+    else if (!query->pending)
+    {
+        // Bounding box faces, counter-clockwise seen from outside
+        static const unsigned char faces[36] = {
+            0, 4, 6, 0, 6, 2,   1, 3, 7, 1, 7, 5,   0, 1, 5, 0, 5, 4,
+            2, 6, 7, 2, 7, 3,   0, 2, 3, 0, 3, 1,   4, 5, 7, 4, 7, 6
+        };
+
+        rlBeginOcclusionQuery(query->id);
+        rlColorMask(false, false, false, false);
+        rlDisableDepthMask();
+
+        rlSetTexture(0);
+        rlBegin(RL_TRIANGLES);
+            rlColor4ub(255, 255, 255, 255);
+            for (int i = 0; i < 36; i++) rlVertex3f(corners[faces[i]].x, corners[faces[i]].y, corners[faces[i]].z);
+        rlEnd();
+
+        rlEndOcclusionQuery();
+        rlEnableDepthMask();
+        rlColorMask(true, true, true, true);
+
+        query->pending = true;
+    }
+
+    if (query->visible) DrawModel(model, position, scale, tint);
+    else if (query->pending && !meshQueueActive && rlIsConditionalRenderSupported())
+    {
+        // NOTE: Without conditional rendering, model is not drawn until query result is read back
+        rlBeginConditionalRender(query->id);
+        DrawModel(model, position, scale, tint);
+        rlEndConditionalRender();
+    }
+}
+
+
+// Draw multiple model instances with different transforms and tints
+// NOTE: Instances data is uploaded to an internal buffer kept between draws, all model meshes are drawn
+// with their materials, materials shaders must provide instances transforms attribute (SHADER_LOC_MATRIX_MODEL),
+// tints are applied by shaders providing instanceColor attribute (SHADER_LOC_INSTANCE_COLOR)
+void DrawModelInstanced(Model model, const Matrix *transforms, const Color *colors, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((transforms == NULL) || !LoadInstanceBufferDefault(instances)) return;
+
+    MeshInstanceBuffer buffer = { instanceBuffer.id, instances };
+    if (colors != NULL)
+    {
+        UpdateMeshInstanceColors(&instanceBuffer, colors, 0, instances);
+        buffer.colorsId = instanceBuffer.colorsId;
+    }
+
+    bool packed = false;    // Uploaded transforms include a mesh packed positions transform
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        // Transforms are uploaded once for all meshes, again for every mesh with packed positions
+        // NOTE: Packed positions are dequantized by instances transforms, model transform is applied first
+        if ((i == 0) || packed || (model.meshes[i].packFlags & MESH_PACK_POSITIONS))
+        {
+            packed = (model.meshes[i].packFlags & MESH_PACK_POSITIONS);
+            UploadInstanceTransforms(transforms, instances, MatrixMultiply(GetMeshPackedTransform(model.meshes[i]), model.transform));
+        }
+
+        DrawMeshInstancedVbo(model.meshes[i], model.materials[model.meshMaterial[i]], buffer, 0, instances, 0);
+    }
+#endif
+}
+
+// Draw multiple model instances with transforms, colors and attributes stored in GPU buffer
+// NOTE: Buffer transforms must include model transform, meshes with packed positions are not supported
+void DrawModelInstancedBuffer(Model model, MeshInstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instances > buffer.instanceCount) instances = buffer.instanceCount;
+    if ((buffer.id == 0) || (instances <= 0)) return;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        DrawMeshInstancedVbo(model.meshes[i], model.materials[model.meshMaterial[i]], buffer, 0, instances, 0);
+    }
+#endif
+}
+
+// Set model meshes frustum culling on drawing (disabled by default)
+// NOTE: Only models loaded with LoadModel()/LoadModelFromMesh() provide meshes bounds
+void SetModelFrustumCulling(bool enabled)
+{
+    modelFrustumCulling = enabled;
+}
+
+// Load directional light shadow map, cascades cover distance from camera
+// NOTE: Cascades are square depth regions (size x size) side by side in shadow depth texture
+ShadowMap LoadShadowMap(int size, int cascades, float distance)
+{
+    ShadowMap shadow = { 0 };
+
+    if (cascades < 1) cascades = 1;
+    if (cascades > SHADOW_MAX_CASCADES)
+    {
+        TRACELOG(LOG_WARNING, "SHADOW: Shadow map cascades limited to %i", SHADOW_MAX_CASCADES);
+        cascades = SHADOW_MAX_CASCADES;
+    }
+
+    shadow.type = SHADOW_LIGHT_DIRECTIONAL;
+    shadow.size = size;
+    shadow.cascadeCount = cascades;
+    shadow.distance = distance;
+    shadow.direction = (Vector3){ 0.0f, -1.0f, 0.0f };
+
+    LoadShadowMapBuffers(&shadow);
+
+    return shadow;
+}
+
+// Load spot light shadow map (cone angle in degrees)
+ShadowMap LoadShadowMapSpot(int size, float angle, float range)
+{
+    ShadowMap shadow = { 0 };
+
+    shadow.type = SHADOW_LIGHT_SPOT;
+    shadow.size = size;
+    shadow.cascadeCount = 1;
+    shadow.distance = range;
+    shadow.angle = angle;
+    shadow.direction = (Vector3){ 0.0f, -1.0f, 0.0f };
+
+    LoadShadowMapBuffers(&shadow);
+
+    return shadow;
+}
+
+// Check if a shadow map is ready
+bool IsShadowMapReady(ShadowMap shadow)
+{
+    return ((shadow.id > 0) && (shadow.depth.id > 0));
+}
+
+// Unload shadow map from GPU memory (VRAM)
+// NOTE: Framebuffers attached depth textures are unloaded with framebuffers
+void UnloadShadowMap(ShadowMap shadow)
+{
+    if (shadow.id > 0) rlUnloadFramebuffer(shadow.id);
+    if (shadow.cacheId > 0) rlUnloadFramebuffer(shadow.cacheId);
+}
+
+// Update shadow map cascades for camera and light
+// NOTE: Directional light cascades are sized by camera view slices bounding spheres (stable with camera rotation)
+// and snapped to cascades texels, cascades origins scroll by texels so static casters cache is kept (clipmap),
+// cascades scroll one axis per update, the other axis lags (up to SHADOW_CASCADE_MARGIN texels)
+void UpdateShadowMap(ShadowMap *shadow, Camera camera, Vector3 position, Vector3 direction)
+{
+    if ((shadow == NULL) || (shadow->id == 0)) return;
+
+    direction = Vector3Normalize(direction);
+
+    // Light changed, static casters cache is not valid
+    if (!Vector3Equals(direction, shadow->direction) ||
+        ((shadow->type == SHADOW_LIGHT_SPOT) && !Vector3Equals(position, shadow->position))) shadow->cacheMask = 0;
+
+    // Static casters drawn by cascade are tracked by update if static casters cache not supported
+    if (shadow->cacheId == 0) shadow->cacheMask = 0;
+
+    shadow->position = position;
+    shadow->direction = direction;
+
+    Vector3 up = (fabsf(direction.y) > 0.99f)? (Vector3){ 0.0f, 0.0f, 1.0f } : (Vector3){ 0.0f, 1.0f, 0.0f };
+
+    if (shadow->type == SHADOW_LIGHT_SPOT)
+    {
+        shadow->view = MatrixLookAt(position, Vector3Add(position, direction), up);
+        shadow->projections[0] = MatrixPerspective(shadow->angle*DEG2RAD, 1.0, shadow->distance*0.01, shadow->distance);
+        shadow->splits[0] = shadow->distance;
+        shadow->sizes[0] = 2.0f*shadow->distance*tanf(shadow->angle*0.5f*DEG2RAD);
+    }
+    else
+    {
+        shadow->view = MatrixLookAt(Vector3Zero(), direction, up);
+
+        Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+        float aspect = (float)rlGetFramebufferWidth()/(float)rlGetFramebufferHeight();
+        float nearDistance = (float)RL_CULL_DISTANCE_NEAR;
+        float farDistance = shadow->distance;
+        float tanHalfFovy = tanf(camera.fovy*0.5f*DEG2RAD);
+        float diagonal = tanHalfFovy*tanHalfFovy*(1.0f + aspect*aspect);     // View slice corners squared distance factor
+        float splitNear = nearDistance;
+        int size = shadow->size;
+
+        for (int i = 0; i < shadow->cascadeCount; i++)
+        {
+            // Cascades splits, logarithmic and uniform splits blend
+            float t = (float)(i + 1)/(float)shadow->cascadeCount;
+            float splitFar = Lerp(nearDistance + (farDistance - nearDistance)*t, nearDistance*powf(farDistance/nearDistance, t), SHADOW_CASCADE_SPLIT_LAMBDA);
+            if (i == (shadow->cascadeCount - 1)) splitFar = farDistance;
+            shadow->splits[i] = splitFar;
+
+            // View slice bounding sphere: center distance along view direction and radius
+            float center = 0.0f;
+            float radius = 0.0f;
+
+            if (camera.projection == CAMERA_PERSPECTIVE)
+            {
+                center = 0.5f*(splitNear + splitFar)*(1.0f + diagonal);
+
+                if (center < splitFar) radius = sqrtf((splitFar - center)*(splitFar - center) + splitFar*splitFar*diagonal);
+                else
+                {
+                    center = splitFar;
+                    radius = splitFar*sqrtf(diagonal);
+                }
+            }
+            else
+            {
+                float halfHeight = camera.fovy*0.5f;
+                center = 0.5f*(splitNear + splitFar);
+                radius = sqrtf(0.25f*(splitFar - splitNear)*(splitFar - splitNear) + halfHeight*halfHeight*(1.0f + aspect*aspect));
+            }
+
+            splitNear = splitFar;
+
+            // Cascade covers view slice sphere and margin texels (cascade origin lag)
+            float side = 2.0f*radius*(float)size/(float)(size - 2*SHADOW_CASCADE_MARGIN);
+            float texel = side/(float)size;
+
+            if (fabsf(side - shadow->sizes[i]) > side*0.001f) shadow->cacheMask &= ~(1u << i);
+            else side = shadow->sizes[i];
+
+            shadow->sizes[i] = side;
+
+            // Cascade origin in light space, XY snapped to texels and depth snapped to cascade size steps
+            Vector3 point = Vector3Transform(Vector3Add(camera.position, Vector3Scale(forward, center)), shadow->view);
+            int *origin = shadow->origins[i];
+            const int *cached = shadow->cacheOrigins[i];
+
+            origin[0] = (int)floorf(point.x/texel + 0.5f);
+            origin[1] = (int)floorf(point.y/texel + 0.5f);
+            origin[2] = (int)floorf(-point.z/side);
+
+            if ((shadow->cacheId > 0) && (shadow->cacheMask & (1u << i)))
+            {
+                int dx = abs(origin[0] - cached[0]);
+                int dy = abs(origin[1] - cached[1]);
+
+                // Cache scrolled along one axis, other axis lags if it stays inside cascade margin
+                if ((origin[2] != cached[2]) || (dx >= size/2) || (dy >= size/2)) shadow->cacheMask &= ~(1u << i);
+                else if ((dx > 0) && (dy > 0))
+                {
+                    if ((dx >= dy) && (dy <= SHADOW_CASCADE_MARGIN)) origin[1] = cached[1];
+                    else if ((dy > dx) && (dx <= SHADOW_CASCADE_MARGIN)) origin[0] = cached[0];
+                    else shadow->cacheMask &= ~(1u << i);
+                }
+            }
+
+            // Cascade depth range covers casters up to shadows distance towards light
+            shadow->projections[i] = MatrixOrtho((origin[0] - size/2)*texel, (origin[0] + size/2)*texel,
+                (origin[1] - size/2)*texel, (origin[1] + size/2)*texel, (origin[2] - 1)*side - shadow->distance, (origin[2] + 2)*side);
+        }
+    }
+
+    // Shadow matrices: world space to cascade region in shadow depth texture (UV) and depth in [0..1]
+    for (int i = 0; i < shadow->cascadeCount; i++)
+    {
+        Matrix matTexture = MatrixMultiply(MatrixScale(0.5f/(float)shadow->cascadeCount, 0.5f, 0.5f),
+            MatrixTranslate((0.5f + (float)i)/(float)shadow->cascadeCount, 0.5f, 0.5f));
+
+        shadow->matrices[i] = MatrixMultiply(MatrixMultiply(shadow->view, shadow->projections[i]), matTexture);
+    }
+}
+
+// Invalidate shadow map static casters cache (static casters changed)
+void InvalidateShadowMap(ShadowMap *shadow)
+{
+    if (shadow != NULL) shadow->cacheMask = 0;
+}
+
+// Begin drawing shadow casters into cascade, models drawn with depth shaders (materials not used)
+// NOTE: Static casters pass returns false (no drawing required) if cascade static casters cache is valid, cache is
+// scrolled and only exposed region is drawn again, dynamic casters pass draws over static casters depth every update,
+// shadow passes must be drawn after UpdateShadowMap() and outside BeginMode3D()/BeginTextureMode()
+bool BeginShadowMode(ShadowMap *shadow, int cascade, bool staticCasters)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((shadow == NULL) || (shadow->id == 0) || (cascade < 0) || (cascade >= shadow->cascadeCount) || shadowModeActive) return false;
+
+    int size = shadow->size;
+    int x = cascade*size;
+    unsigned int bit = 1u << cascade;
+    int *origin = shadow->origins[cascade];
+    int *cached = shadow->cacheOrigins[cascade];
+    bool cacheValid = ((shadow->cacheMask & bit) && (memcmp(origin, cached, 3*sizeof(int)) == 0));
+    bool clear = true;
+    int region[4] = { x, 0, size, size };   // Cascade region drawn
+
+    rlDrawRenderBatchActive();
+
+    // Unbind shadow depth texture, depth can not be sampled while drawing into it
+    rlActiveTextureSlot(SHADOW_MAP_TEXTURE_SLOT);
+    rlDisableTexture();
+    rlActiveTextureSlot(0);
+
+    if (shadow->cacheId == 0)
+    {
+        // Static casters cache not supported, static and dynamic casters are drawn into shadow depth every update
+        if (!staticCasters && (shadow->cacheMask & bit)) clear = false;
+        if (staticCasters) shadow->cacheMask |= bit;
+
+        rlEnableFramebuffer(shadow->id);
+    }
+    else if (staticCasters)
+    {
+        if (cacheValid) return false;
+
+        if (shadow->cacheMask & bit)
+        {
+            // Cached depth scrolled to new origin (copied through shadow depth, overlapping blit not supported)
+            int dx = origin[0] - cached[0];
+            int dy = origin[1] - cached[1];
+            int width = size - abs(dx);
+            int height = size - abs(dy);
+
+            rlBindFramebuffer(RL_READ_FRAMEBUFFER, shadow->cacheId);
+            rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, shadow->id);
+            rlBlitFramebuffer(x + ((dx > 0)? dx : 0), (dy > 0)? dy : 0, width, height, x + ((dx < 0)? -dx : 0), (dy < 0)? -dy : 0, width, height, RL_DEPTH_BUFFER_BIT);
+            rlBindFramebuffer(RL_READ_FRAMEBUFFER, shadow->id);
+            rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, shadow->cacheId);
+            rlBlitFramebuffer(x, 0, size, size, x, 0, size, size, RL_DEPTH_BUFFER_BIT);
+
+            // Cascade region exposed by scroll (one axis scrolled by update)
+            if (dx > 0) { region[0] = x + size - dx; region[2] = dx; }
+            else if (dx < 0) region[2] = -dx;
+            else if (dy > 0) { region[1] = size - dy; region[3] = dy; }
+            else region[3] = -dy;
+        }
+
+        memcpy(cached, origin, 3*sizeof(int));
+        shadow->cacheMask |= bit;
+
+        rlEnableFramebuffer(shadow->cacheId);
+    }
+    else
+    {
+        // Static casters depth copied into shadow depth, dynamic casters drawn over it
+        if (cacheValid)
+        {
+            rlBindFramebuffer(RL_READ_FRAMEBUFFER, shadow->cacheId);
+            rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, shadow->id);
+            rlBlitFramebuffer(x, 0, size, size, x, 0, size, size, RL_DEPTH_BUFFER_BIT);
+            clear = false;
+        }
+
+        rlEnableFramebuffer(shadow->id);
+    }
+
+    // Setup cascade viewport, drawing limited to cascade region
+    rlViewport(x, 0, size, size);
+    rlEnableScissorTest();
+    rlScissor(region[0], region[1], region[2], region[3]);
+
+    rlEnableDepthTest();
+    rlEnableDepthMask();
+    if (clear) rlClearScreenBuffers();
+
+    // Stereo render disabled while drawing shadow casters (one view)
+    shadowModeStereo = rlIsStereoRenderEnabled();
+    if (shadowModeStereo) rlDisableStereoRender();
+
+    // Framebuffer size considered by projected size computations (DrawModelLOD())
+    shadowModeFramebufferWidth = rlGetFramebufferWidth();
+    shadowModeFramebufferHeight = rlGetFramebufferHeight();
+    rlSetFramebufferWidth(size);
+    rlSetFramebufferHeight(size);
+
+    // Setup light view and cascade projection, previous matrices restored by EndShadowMode()
+    shadowModeView = rlGetMatrixModelview();
+    shadowModeProjection = rlGetMatrixProjection();
+    rlSetMatrixModelview(shadow->view);
+    rlSetMatrixProjection(shadow->projections[cascade]);
+
+    shadowModeActive = true;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// End drawing shadow casters
+void EndShadowMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!shadowModeActive) return;
+
+    rlDrawRenderBatchActive();
+
+    rlDisableScissorTest();
+    rlDisableDepthTest();
+    rlDisableFramebuffer();
+
+    rlSetFramebufferWidth(shadowModeFramebufferWidth);
+    rlSetFramebufferHeight(shadowModeFramebufferHeight);
+    rlViewport(0, 0, shadowModeFramebufferWidth, shadowModeFramebufferHeight);
+
+    rlSetMatrixModelview(shadowModeView);
+    rlSetMatrixProjection(shadowModeProjection);
+
+    if (shadowModeStereo) rlEnableStereoRender();
+
+    shadowModeActive = false;
+#endif
+}
+
+// Set shader shadow map uniforms and bind shadow depth texture
+// NOTE: Shadow depth texture is bound to texture slot SHADOW_MAP_TEXTURE_SLOT (after material maps), shader uniforms set:
+//   uniform sampler2D shadowMap;       // Shadow depth texture, cascades side by side
+//   uniform mat4 shadowMatrices[4];    // Cascades world space to shadow texture space (xy: UV, z: depth)
+//   uniform vec4 shadowSplits;         // Cascades far distances from camera
+//   uniform int shadowCascades;        // Number of cascades
+// Fragment is shadowed if depth sampled at UV is lower than fragment depth (bias required), sampled cascade
+// is the first one with split distance greater than fragment distance to camera
+void SetShaderShadowMap(Shader shader, ShadowMap shadow)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((shader.id == 0) || (shadow.depth.id == 0)) return;
+
+    int slot = SHADOW_MAP_TEXTURE_SLOT;
+    int mapLoc = rlGetLocationUniform(shader.id, "shadowMap");
+    int matricesLoc = rlGetLocationUniform(shader.id, "shadowMatrices");
+    int splitsLoc = rlGetLocationUniform(shader.id, "shadowSplits");
+    int cascadesLoc = rlGetLocationUniform(shader.id, "shadowCascades");
+
+    rlEnableShader(shader.id);
+    if (mapLoc != -1) rlSetUniform(mapLoc, &slot, SHADER_UNIFORM_INT, 1);
+    if (matricesLoc != -1) rlSetUniformMatrices(matricesLoc, shadow.matrices, shadow.cascadeCount);
+    if (splitsLoc != -1) rlSetUniform(splitsLoc, shadow.splits, SHADER_UNIFORM_VEC4, 1);
+    if (cascadesLoc != -1) rlSetUniform(cascadesLoc, &shadow.cascadeCount, SHADER_UNIFORM_INT, 1);
+    rlDisableShader();
+
+    rlActiveTextureSlot(slot);
+    rlEnableTexture(shadow.depth.id);
+    rlActiveTextureSlot(0);
+#endif
+}
+
+// Load light clusters for clustered forward lighting
+// NOTE: Lights are binned into clusters on CPU by UpdateLightClusters(), lights data and clusters lights lists
+// are stored in float textures fetched by clustered lighting shader, LoadShaderLightClusters()
+LightClusters LoadLightClusters(int maxLights)
+{
+    LightClusters clusters = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (maxLights <= 0) return clusters;
+
+    int clusterCount = LIGHT_CLUSTERS_TILES_X*LIGHT_CLUSTERS_TILES_Y*LIGHT_CLUSTERS_SLICES;
+
+    // Clusters texture: lights list range by cluster (one texel), followed by lists lights indices (four by texel)
+    int clustersTexels = clusterCount + (clusterCount*MAX_LIGHTS_PER_CLUSTER + 3)/4;
+    int clustersHeight = (clustersTexels + LIGHT_CLUSTERS_TEXTURE_WIDTH - 1)/LIGHT_CLUSTERS_TEXTURE_WIDTH;
+
+    clusters.lightsData = (float *)RL_CALLOC(maxLights*3*4, sizeof(float));
+    clusters.clustersData = (float *)RL_CALLOC(LIGHT_CLUSTERS_TEXTURE_WIDTH*clustersHeight*4, sizeof(float));
+
+    // Binned lights by cluster, preceded by binned lights count by cluster
+    clusters.binned = (int *)RL_MALLOC(clusterCount*(MAX_LIGHTS_PER_CLUSTER + 1)*sizeof(int));
+
+    clusters.lights.id = rlLoadTexture(clusters.lightsData, 3, maxLights, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    clusters.lights.width = 3;
+    clusters.lights.height = maxLights;
+    clusters.lights.mipmaps = 1;
+    clusters.lights.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+    clusters.clusters.id = rlLoadTexture(clusters.clustersData, LIGHT_CLUSTERS_TEXTURE_WIDTH, clustersHeight, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    clusters.clusters.width = LIGHT_CLUSTERS_TEXTURE_WIDTH;
+    clusters.clusters.height = clustersHeight;
+    clusters.clusters.mipmaps = 1;
+    clusters.clusters.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+    if ((clusters.lights.id == 0) || (clusters.clusters.id == 0))
+    {
+        TRACELOG(LOG_WARNING, "LIGHTS: Failed to load light clusters textures");
+        UnloadLightClusters(clusters);
+        return (LightClusters){ 0 };
+    }
+
+    rlTextureParameters(clusters.lights.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+    rlTextureParameters(clusters.lights.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+    rlTextureParameters(clusters.clusters.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+    rlTextureParameters(clusters.clusters.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+
+    clusters.maxLights = maxLights;
+    clusters.tiles[0] = LIGHT_CLUSTERS_TILES_X;
+    clusters.tiles[1] = LIGHT_CLUSTERS_TILES_Y;
+    clusters.tiles[2] = LIGHT_CLUSTERS_SLICES;
+    clusters.near = 0.1f;
+    clusters.far = (float)RL_CULL_DISTANCE_FAR;
+    clusters.ambient = (Color){ 20, 20, 20, 255 };
+
+    TRACELOG(LOG_INFO, "LIGHTS: Light clusters loaded successfully (%i lights, %ix%ix%i clusters)", maxLights, clusters.tiles[0], clusters.tiles[1], clusters.tiles[2]);
+#else
+    TRACELOG(LOG_WARNING, "LIGHTS: Clustered lighting requires OpenGL 3.3");
+#endif
+
+    return clusters;
+}
+
+// Check if light clusters are ready
+bool IsLightClustersReady(LightClusters clusters)
+{
+    return ((clusters.lights.id > 0) && (clusters.clusters.id > 0) && (clusters.binned != NULL));
+}
+
+// Unload light clusters from CPU and GPU memory
+void UnloadLightClusters(LightClusters clusters)
+{
+    if (clusters.lights.id > 0) rlUnloadTexture(clusters.lights.id);
+    if (clusters.clusters.id > 0) rlUnloadTexture(clusters.clusters.id);
+
+    RL_FREE(clusters.lightsData);
+    RL_FREE(clusters.clustersData);
+    RL_FREE(clusters.binned);
+}
+
+// Update lights and bin them into camera view clusters
+// NOTE: Clusters screen tiles cover current render size (rlgl framebuffer size), lights bounding spheres
+// are tested against every depth slice they overlap, exceeding lights by cluster are ignored (MAX_LIGHTS_PER_CLUSTER)
+void UpdateLightClusters(LightClusters *clusters, Camera camera, const ClusterLight *lights, int count)
+{
+    if ((clusters == NULL) || !IsLightClustersReady(*clusters)) return;
+
+    if (lights == NULL) count = 0;
+    if (count > clusters->maxLights) count = clusters->maxLights;
+
+    int tilesX = clusters->tiles[0];
+    int tilesY = clusters->tiles[1];
+    int slices = clusters->tiles[2];
+    int clusterCount = tilesX*tilesY*slices;
+    int *binnedCount = clusters->binned;
+    int *binned = clusters->binned + clusterCount;
+
+    memset(binnedCount, 0, clusterCount*sizeof(int));
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    float aspect = (float)rlGetFramebufferWidth()/(float)rlGetFramebufferHeight();
+    float tanHalfFovy = tanf(camera.fovy*0.5f*DEG2RAD);
+    float depthRatio = clusters->far/clusters->near;
+    float sliceScale = (float)slices/logf(depthRatio);
+
+    for (int i = 0; i < count; i++)
+    {
+        // Light data texels: position and range, color and spot outer cone cosine, direction and spot inner cone cosine
+        // NOTE: Point lights outer cone cosine is out of range (-2.0), spot cone smoothly fades on its outer 20%
+        float *data = clusters->lightsData + i*12;
+        float halfAngle = lights[i].angle*0.5f*DEG2RAD;
+        Vector3 direction = Vector3Normalize(lights[i].direction);
+
+        data[0] = lights[i].position.x;
+        data[1] = lights[i].position.y;
+        data[2] = lights[i].position.z;
+        data[3] = lights[i].range;
+        data[4] = (float)lights[i].color.r/255.0f*lights[i].intensity;
+        data[5] = (float)lights[i].color.g/255.0f*lights[i].intensity;
+        data[6] = (float)lights[i].color.b/255.0f*lights[i].intensity;
+        data[7] = (lights[i].angle > 0.0f)? cosf(halfAngle) : -2.0f;
+        data[8] = direction.x;
+        data[9] = direction.y;
+        data[10] = direction.z;
+        data[11] = cosf(halfAngle*0.8f);
+
+        // Light bounding sphere in view space, depth is distance along view direction
+        Vector3 center = Vector3Transform(lights[i].position, matView);
+        float radius = lights[i].range;
+        float depth = -center.z;
+
+        if ((radius <= 0.0f) || ((depth + radius) <= 0.0f)) continue;
+
+        // Depth slices overlapped by light, fragments beyond clusters far distance use last slice
+        float depthMin = fmaxf(depth - radius, 0.0f);
+        float depthMax = depth + radius;
+        int sliceMin = (depthMin > clusters->near)? (int)(logf(depthMin/clusters->near)*sliceScale) : 0;
+        int sliceMax = (depthMax > clusters->near)? (int)(logf(depthMax/clusters->near)*sliceScale) : 0;
+        if (sliceMin > (slices - 1)) sliceMin = slices - 1;
+        if (sliceMax > (slices - 1)) sliceMax = slices - 1;
+
+        for (int s = sliceMin; s <= sliceMax; s++)
+        {
+            // Light depth range inside slice
+            float sliceNear = (s == 0)? 0.0f : clusters->near*powf(depthRatio, (float)s/slices);
+            float sliceFar = (s == (slices - 1))? depthMax : clusters->near*powf(depthRatio, (float)(s + 1)/slices);
+            float nearDepth = fmaxf(sliceNear, depthMin);
+            float farDepth = fminf(sliceFar, depthMax);
+
+            // Light bounding box projected to normalized screen coordinates, whole screen if box reaches camera plane
+            // NOTE: Projected coordinate x/depth is monotonic on depth, extremes are at slice range limits
+            Vector2 min = { -1.0f, -1.0f };
+            Vector2 max = { 1.0f, 1.0f };
+
+            if (camera.projection == CAMERA_ORTHOGRAPHIC)
+            {
+                float halfHeight = camera.fovy*0.5f;
+                min = (Vector2){ (center.x - radius)/(halfHeight*aspect), (center.y - radius)/halfHeight };
+                max = (Vector2){ (center.x + radius)/(halfHeight*aspect), (center.y + radius)/halfHeight };
+            }
+            else if (nearDepth > 0.001f)
+            {
+                float scaleX = 1.0f/(tanHalfFovy*aspect);
+                float scaleY = 1.0f/tanHalfFovy;
+                min.x = fminf((center.x - radius)/nearDepth, (center.x - radius)/farDepth)*scaleX;
+                max.x = fmaxf((center.x + radius)/nearDepth, (center.x + radius)/farDepth)*scaleX;
+                min.y = fminf((center.y - radius)/nearDepth, (center.y - radius)/farDepth)*scaleY;
+                max.y = fmaxf((center.y + radius)/nearDepth, (center.y + radius)/farDepth)*scaleY;
+            }
+
+            int x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+            if (!GetLightClustersTiles(min.x, max.x, tilesX, &x0, &x1) || !GetLightClustersTiles(min.y, max.y, tilesY, &y0, &y1)) continue;
+
+            for (int y = y0; y <= y1; y++)
+            {
+                for (int x = x0; x <= x1; x++)
+                {
+                    int cluster = x + tilesX*(y + tilesY*s);
+                    if (binnedCount[cluster] < MAX_LIGHTS_PER_CLUSTER) binned[cluster*MAX_LIGHTS_PER_CLUSTER + binnedCount[cluster]++] = i;
+                }
+            }
+        }
+    }
+
+    // Compact clusters lights lists: list range by cluster (offset, count), lights indices after clusters ranges
+    float *indices = clusters->clustersData + clusterCount*4;
+    int offset = 0;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        clusters->clustersData[c*4] = (float)offset;
+        clusters->clustersData[c*4 + 1] = (float)binnedCount[c];
+
+        for (int k = 0; k < binnedCount[c]; k++) indices[offset + k] = (float)binned[c*MAX_LIGHTS_PER_CLUSTER + k];
+        offset += binnedCount[c];
+    }
+
+    // Upload lights and clusters texture rows in use
+    int rows = (clusterCount + (offset + 3)/4 + LIGHT_CLUSTERS_TEXTURE_WIDTH - 1)/LIGHT_CLUSTERS_TEXTURE_WIDTH;
+
+    if (count > 0) rlUpdateTexture(clusters->lights.id, 0, 0, 3, count, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, clusters->lightsData);
+    rlUpdateTexture(clusters->clusters.id, 0, 0, LIGHT_CLUSTERS_TEXTURE_WIDTH, rows, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, clusters->clustersData);
+
+    clusters->lightCount = count;
+    clusters->viewPosition = camera.position;
+    clusters->screenSize = (Vector2){ (float)rlGetFramebufferWidth(), (float)rlGetFramebufferHeight() };
+}
+
+// Load standard material shader with clustered lighting
+// NOTE: Shader supports diffuse map and color, specular color and ambient, lights are evaluated with Blinn-Phong model,
+// fragment cluster is selected by fragment screen position and view depth, only cluster listed lights are evaluated
+Shader LoadShaderLightClusters(void)
+{
+    Shader shader = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    const char *clustersVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec3 vertexNormal;              \n"
+    "in vec4 vertexColor;               \n"
+    "out vec3 fragPosition;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out vec3 fragNormal;               \n"
+    "out float fragDepth;               \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 matModel;             \n"
+    "uniform mat4 matNormal;            \n"
+    "uniform mat4 matView;              \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 position = matModel*vec4(vertexPosition, 1.0); \n"
+    "    fragPosition = position.xyz;   \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragNormal = normalize(vec3(matNormal*vec4(vertexNormal, 0.0))); \n"
+    "    fragDepth = -(matView*position).z; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *clustersFShaderCode =
+    "#version 330                       \n"
+    "in vec3 fragPosition;              \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in vec3 fragNormal;                \n"
+    "in float fragDepth;                \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec4 colSpecular;          \n"
+    "uniform vec4 ambient;              \n"
+    "uniform vec3 viewPos;              \n"
+    "uniform sampler2D lightsData;      \n"
+    "uniform sampler2D clustersData;    \n"
+    "uniform ivec3 clustersTiles;       \n"
+    "uniform vec2 clustersScreen;       \n"
+    "uniform vec2 clustersDepth;        \n"
+    "vec4 FetchClusters(int index)      \n"
+    "{                                  \n"
+    "    int width = textureSize(clustersData, 0).x; \n"
+    "    return texelFetch(clustersData, ivec2(index%width, index/width), 0); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "    vec3 normal = normalize(fragNormal); \n"
+    "    vec3 viewDir = normalize(viewPos - fragPosition); \n"
+    "    ivec3 tile = ivec3(ivec2(gl_FragCoord.xy/clustersScreen*vec2(clustersTiles.xy)), int(max(log(fragDepth)*clustersDepth.x + clustersDepth.y, 0.0))); \n"
+    "    tile = clamp(tile, ivec3(0), clustersTiles - 1); \n"
+    "    int clusterCount = clustersTiles.x*clustersTiles.y*clustersTiles.z; \n"
+    "    vec2 range = FetchClusters(tile.x + clustersTiles.x*(tile.y + clustersTiles.y*tile.z)).xy; \n"
+    "    vec3 diffuse = ambient.rgb;    \n"
+    "    vec3 specular = vec3(0.0);     \n"
+    "    for (int i = int(range.x); i < int(range.x + range.y); i++) \n"
+    "    {                              \n"
+    "        int light = int(FetchClusters(clusterCount + i/4)[i%4]); \n"
+    "        vec4 position = texelFetch(lightsData, ivec2(0, light), 0); \n"
+    "        vec4 color = texelFetch(lightsData, ivec2(1, light), 0); \n"
+    "        vec4 spot = texelFetch(lightsData, ivec2(2, light), 0); \n"
+    "        vec3 lightDir = position.xyz - fragPosition; \n"
+    "        float distance = length(lightDir); \n"
+    "        lightDir /= max(distance, 0.0001); \n"
+    "        float falloff = clamp(1.0 - pow(distance/position.w, 4.0), 0.0, 1.0); \n"
+    "        float attenuation = falloff*falloff/(distance*distance + 1.0); \n"
+    "        if (color.w > -1.5) attenuation *= smoothstep(color.w, spot.w, dot(-lightDir, spot.xyz)); \n"
+    "        float NdotL = max(dot(normal, lightDir), 0.0); \n"
+    "        diffuse += color.rgb*NdotL*attenuation; \n"
+    "        if (NdotL > 0.0) specular += color.rgb*pow(max(dot(normal, normalize(lightDir + viewDir)), 0.0), 32.0)*attenuation; \n"
+    "    }                              \n"
+    "    finalColor = vec4(texelColor.rgb*diffuse + specular*colSpecular.rgb, texelColor.a); \n"
+    "}                                  \n";
+
+    // NOTE: Failed shader compilation returns default shader
+    shader = LoadShaderFromMemory(clustersVShaderCode, clustersFShaderCode);
+
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()))
+    {
+        shader.locs[SHADER_LOC_COLOR_SPECULAR] = rlGetLocationUniform(shader.id, "colSpecular");
+        shader.locs[SHADER_LOC_COLOR_AMBIENT] = rlGetLocationUniform(shader.id, "ambient");
+        shader.locs[SHADER_LOC_VECTOR_VIEW] = rlGetLocationUniform(shader.id, "viewPos");
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Clustered lighting shader loaded successfully", shader.id);
+    }
+#else
+    TRACELOG(LOG_WARNING, "LIGHTS: Clustered lighting requires OpenGL 3.3");
+#endif
+
+    return shader;
+}
+
+// Set shader light clusters uniforms and bind clusters textures
+// NOTE: Clusters textures are bound to texture slots after shadow map and morph targets slots
+void SetShaderLightClusters(Shader shader, LightClusters clusters)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if ((shader.id == 0) || !IsLightClustersReady(clusters)) return;
+
+    int lightsSlot = LIGHT_CLUSTERS_TEXTURE_SLOT;
+    int clustersSlot = LIGHT_CLUSTERS_TEXTURE_SLOT + 1;
+    float depth[2] = { (float)clusters.tiles[2]/logf(clusters.far/clusters.near), 0.0f };
+    float ambient[4] = { (float)clusters.ambient.r/255.0f, (float)clusters.ambient.g/255.0f, (float)clusters.ambient.b/255.0f, (float)clusters.ambient.a/255.0f };
+    depth[1] = -logf(clusters.near)*depth[0];
+
+    int lightsLoc = rlGetLocationUniform(shader.id, "lightsData");
+    int clustersLoc = rlGetLocationUniform(shader.id, "clustersData");
+    int tilesLoc = rlGetLocationUniform(shader.id, "clustersTiles");
+    int screenLoc = rlGetLocationUniform(shader.id, "clustersScreen");
+    int depthLoc = rlGetLocationUniform(shader.id, "clustersDepth");
+    int ambientLoc = rlGetLocationUniform(shader.id, "ambient");
+    int viewLoc = rlGetLocationUniform(shader.id, "viewPos");
+
+    rlEnableShader(shader.id);
+    if (lightsLoc != -1) rlSetUniform(lightsLoc, &lightsSlot, SHADER_UNIFORM_INT, 1);
+    if (clustersLoc != -1) rlSetUniform(clustersLoc, &clustersSlot, SHADER_UNIFORM_INT, 1);
+    if (tilesLoc != -1) rlSetUniform(tilesLoc, clusters.tiles, SHADER_UNIFORM_IVEC3, 1);
+    if (screenLoc != -1) rlSetUniform(screenLoc, &clusters.screenSize, SHADER_UNIFORM_VEC2, 1);
+    if (depthLoc != -1) rlSetUniform(depthLoc, depth, SHADER_UNIFORM_VEC2, 1);
+    if (ambientLoc != -1) rlSetUniform(ambientLoc, ambient, SHADER_UNIFORM_VEC4, 1);
+    if (viewLoc != -1) rlSetUniform(viewLoc, &clusters.viewPosition, SHADER_UNIFORM_VEC3, 1);
+    rlDisableShader();
+
+    rlActiveTextureSlot(lightsSlot);
+    rlEnableTexture(clusters.lights.id);
+    rlActiveTextureSlot(clustersSlot);
+    rlEnableTexture(clusters.clusters.id);
+    rlActiveTextureSlot(0);
+#endif
+}
+
+// Draw a model wires (with texture if set)
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModel(model, position, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a billboard
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+{
+    // NOTE: Billboard locked on axis-Y
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
+}
+
+void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+{
+    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
+    Vector2 sizeRatio = { size.x*(float)source.width/source.height, size.y };
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+
+    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
+    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+
+    Vector3 p1 = Vector3Add(rightScaled, upScaled);
+    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+
+    Vector3 topLeft = Vector3Scale(p2, -1);
+    Vector3 topRight = p1;
+    Vector3 bottomRight = p2;
+    Vector3 bottomLeft = Vector3Scale(p1, -1);
+
+    if (rotation != 0.0f)
+    {
+        float sinRotation = sinf(rotation*DEG2RAD);
+        float cosRotation = cosf(rotation*DEG2RAD);
+
+        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
+        float rotateAboutX = sizeRatio.x*origin.x/2;
+        float rotateAboutY = sizeRatio.y*origin.y/2;
+
+        float xtvalue, ytvalue;
+        float rotatedX, rotatedY;
+
+        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
+        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+
+        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+    }
+
+    // Translate points to the draw center (position)
+    topLeft = Vector3Add(topLeft, position);
+    topRight = Vector3Add(topRight, position);
+    bottomRight = Vector3Add(bottomRight, position);
+    bottomLeft = Vector3Add(bottomLeft, position);
+
+    rlSetTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        // Bottom-left corner for texture and quad
+        rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
+        rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+
+        // Top-left corner for texture and quad
+        rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
+        rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+
+        // Top-right corner for texture and quad
+        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
+        rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+
+        // Bottom-right corner for texture and quad
+        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
+        rlVertex3f(topRight.x, topRight.y, topRight.z);
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Draw billboards batch, billboards facing camera (camera right and up vectors) with size, rotation, source and tint
+// NOTE: Billboards are expanded on GPU as quad instances (default shader and batch active), or drawn by render batch,
+// billboards are drawn in items order or sorted back-to-front (SetBillboardsBatchSorting())
+void DrawBillboardsBatch(Camera camera, Texture2D texture, const BillboardInstance *items, int count)
+{
+    if ((items == NULL) || (count <= 0)) return;
+
+    // Camera right and up vectors computed once for all billboards
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    Vector3 up = { matView.m1, matView.m5, matView.m9 };
+
+    if (count > billboardsCapacity)
+    {
+        int capacity = (billboardsCapacity > 0)? billboardsCapacity : 1024;
+        while (capacity < count) capacity *= 2;
+
+        RL_FREE(billboardsInstances);
+        RL_FREE(billboardsKeys);
+        billboardsInstances = (float *)RL_MALLOC(capacity*BILLBOARD_INSTANCE_FLOATS*sizeof(float));
+        billboardsKeys = (BillboardSortKey *)RL_MALLOC(capacity*2*sizeof(BillboardSortKey));
+        billboardsCapacity = ((billboardsInstances != NULL) && (billboardsKeys != NULL))? capacity : 0;
+        if (billboardsCapacity == 0) return;
+    }
+
+    // Billboards order, sorted by view depth (farthest first) in parallel by jobs system (if initialized)
+    const BillboardSortKey *order = NULL;
+    if (billboardsSorting)
+    {
+        Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+        order = SortBillboards(items, count, camera.position, forward);
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlIsRenderBatchDefault() && LoadShaderBillboards())
+    {
+        // Billboards instances data: position and rotation, source texcoords, size and tint
+        for (int i = 0; i < count; i++)
+        {
+            const BillboardInstance *item = (order != NULL)? &items[order[i].index] : &items[i];
+            Rectangle source = item->source;
+            if (source.width == 0.0f) source = (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+            float *instance = &billboardsInstances[i*BILLBOARD_INSTANCE_FLOATS];
+            instance[0] = item->position.x;
+            instance[1] = item->position.y;
+            instance[2] = item->position.z;
+            instance[3] = item->rotation*DEG2RAD;
+            instance[4] = source.x/texture.width;
+            instance[5] = source.y/texture.height;
+            instance[6] = (source.x + source.width)/texture.width;
+            instance[7] = (source.y + source.height)/texture.height;
+            instance[8] = item->size.x;
+            instance[9] = item->size.y;
+            instance[10] = 0.0f;
+            memcpy(&instance[11], &item->tint, sizeof(Color));
+        }
+
+        DrawBillboardsInstanced(texture, right, up, count);
+        return;
+    }
+#endif
+
+    rlSetTexture(texture.id);
+
+    for (int i = 0; i < count; i++)
+    {
+        const BillboardInstance *item = (order != NULL)? &items[order[i].index] : &items[i];
+        Rectangle source = item->source;
+        if (source.width == 0.0f) source = (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+        float sinRotation = sinf(item->rotation*DEG2RAD);
+        float cosRotation = cosf(item->rotation*DEG2RAD);
+
+        // Quad corners rotated on billboard plane: top-left, bottom-left, bottom-right, top-right
+        Vector3 corners[4] = { 0 };
+        const float cornerX[4] = { -0.5f, -0.5f, 0.5f, 0.5f };
+        const float cornerY[4] = { 0.5f, -0.5f, -0.5f, 0.5f };
+
+        for (int k = 0; k < 4; k++)
+        {
+            float x = cornerX[k]*item->size.x;
+            float y = cornerY[k]*item->size.y;
+            float rotatedX = x*cosRotation - y*sinRotation;
+            float rotatedY = x*sinRotation + y*cosRotation;
+
+            corners[k] = Vector3Add(item->position, Vector3Add(Vector3Scale(right, rotatedX), Vector3Scale(up, rotatedY)));
+        }
+
+        float u0 = source.x/texture.width;
+        float v0 = source.y/texture.height;
+        float u1 = (source.x + source.width)/texture.width;
+        float v1 = (source.y + source.height)/texture.height;
+
+        rlCheckRenderBatchLimit(4);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(item->tint.r, item->tint.g, item->tint.b, item->tint.a);
+
+            rlTexCoord2f(u0, v0);
+            rlVertex3f(corners[0].x, corners[0].y, corners[0].z);
+            rlTexCoord2f(u0, v1);
+            rlVertex3f(corners[1].x, corners[1].y, corners[1].z);
+            rlTexCoord2f(u1, v1);
+            rlVertex3f(corners[2].x, corners[2].y, corners[2].z);
+            rlTexCoord2f(u1, v0);
+            rlVertex3f(corners[3].x, corners[3].y, corners[3].z);
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+}
+
+// Set billboards batch back-to-front sorting (disabled by default)
+// NOTE: Sorting is required for alpha blended billboards drawn with depth test
+void SetBillboardsBatchSorting(bool enabled)
+{
+    billboardsSorting = enabled;
+}
+
+// Load particle system
+// NOTE: Particles are simulated and drawn on GPU if compute shaders are supported (OpenGL 4.3),
+// otherwise particles are simulated on CPU and drawn with DrawBillboardsBatch()
+ParticleSystem LoadParticleSystem(int maxParticles)
+{
+    ParticleSystem system = { 0 };
+
+    if (maxParticles <= 0) return system;
+
+    ParticleSystemData *data = (ParticleSystemData *)RL_CALLOC(1, sizeof(ParticleSystemData));
+    if (data == NULL) return system;
+
+    data->seed = 2463534242u;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    system.gpu = LoadParticleSystemGpu(data, maxParticles);
+#endif
+
+    if (!system.gpu)
+    {
+        data->particles = (ParticleState *)RL_MALLOC(maxParticles*sizeof(ParticleState));
+        data->items = (BillboardInstance *)RL_CALLOC(maxParticles, sizeof(BillboardInstance));
+
+        if ((data->particles == NULL) || (data->items == NULL))
+        {
+            RL_FREE(data->particles);
+            RL_FREE(data->items);
+            RL_FREE(data);
+            TRACELOG(LOG_WARNING, "PARTICLES: Failed to allocate particles memory");
+            return system;
+        }
+    }
+
+    system.maxParticles = maxParticles;
+    system.ctxData = data;
+
+    TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (%i particles, %s simulation)", maxParticles, system.gpu? "GPU" : "CPU");
+
+    return system;
+}
+
+// Check if a particle system is ready
+bool IsParticleSystemReady(ParticleSystem system)
+{
+    return ((system.ctxData != NULL) && (system.maxParticles > 0));
+}
+
+// Unload particle system (GPU buffers and shaders or CPU particles)
+void UnloadParticleSystem(ParticleSystem system)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.ctxData;
+    if (data == NULL) return;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    UnloadParticleSystemGpu(data);
+#endif
+    RL_FREE(data->particles);
+    RL_FREE(data->items);
+    RL_FREE(data);
+}
+
+// Update particle system: spawn emitter particles, move particles and remove expired ones
+// NOTE: Particles spawned by frame are emitter.rate*deltaTime (fractional part kept for next update),
+// GPU simulated particles are updated, compacted and spawned in compute passes without CPU readback
+void UpdateParticleSystem(ParticleSystem system, ParticleEmitter emitter, float deltaTime)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.ctxData;
+    if ((data == NULL) || (deltaTime < 0.0f)) return;
+
+    data->emitter = emitter;
+    data->spawnTime += ((emitter.rate > 0.0f)? emitter.rate*deltaTime : 0.0f);
+
+    int spawnCount = (int)data->spawnTime;
+    data->spawnTime -= (float)spawnCount;
+    if (spawnCount > system.maxParticles) spawnCount = system.maxParticles;
+
+    float lifetimeMin = (emitter.lifetimeMin > 0.0f)? emitter.lifetimeMin : 0.0f;
+    float lifetimeMax = (emitter.lifetimeMax > lifetimeMin)? emitter.lifetimeMax : lifetimeMin;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (system.gpu)
+    {
+        int source = data->current;
+        int target = 1 - source;
+        int maxParticles = system.maxParticles;
+        int seed = (int)(data->seed & 0x7fffffff);
+        Vector2 lifetime = { lifetimeMin, lifetimeMax };
+
+        GetParticleRandom(&data->seed);
+
+        // Reset target particles count, alive and spawned particles are counted by compute passes
+        unsigned int args[4] = { 6, 0, 0, 0 };
+        rlUpdateShaderBuffer(data->argsIds[target], args, sizeof(args), 0);
+
+        rlBindShaderBuffer(data->particlesIds[source], 0);
+        rlBindShaderBuffer(data->particlesIds[target], 1);
+        rlBindShaderBuffer(data->argsIds[source], 2);
+        rlBindShaderBuffer(data->argsIds[target], 3);
+
+        // Update pass: alive particles moved and compacted into target buffer
+        rlEnableShader(data->updateShaderId);
+        rlSetUniform(rlGetLocationUniform(data->updateShaderId, "gravity"), &emitter.gravity, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(rlGetLocationUniform(data->updateShaderId, "deltaTime"), &deltaTime, SHADER_UNIFORM_FLOAT, 1);
+        rlComputeShaderDispatch((unsigned int)(maxParticles + PARTICLES_GROUP_SIZE - 1)/PARTICLES_GROUP_SIZE, 1, 1);
+        rlComputeShaderBarrier();
+
+        // Spawn pass: new particles appended to target buffer (up to maxParticles)
+        if (spawnCount > 0)
+        {
+            rlEnableShader(data->spawnShaderId);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "position"), &emitter.position, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "spread"), &emitter.spread, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "velocity"), &emitter.velocity, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "velocityRandom"), &emitter.velocityRandom, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "lifetime"), &lifetime, SHADER_UNIFORM_VEC2, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "spawnCount"), &spawnCount, SHADER_UNIFORM_INT, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "maxParticles"), &maxParticles, SHADER_UNIFORM_INT, 1);
+            rlSetUniform(rlGetLocationUniform(data->spawnShaderId, "seed"), &seed, SHADER_UNIFORM_INT, 1);
+            rlComputeShaderDispatch((unsigned int)(spawnCount + PARTICLES_GROUP_SIZE - 1)/PARTICLES_GROUP_SIZE, 1, 1);
+            rlComputeShaderBarrier();
+        }
+
+        rlDisableShader();
+
+        data->current = target;
+        return;
+    }
+#endif
+
+    // Update alive particles, expired particles replaced by last particle
+    for (int i = 0; i < data->count; i++)
+    {
+        ParticleState *particle = &data->particles[i];
+        particle->age += deltaTime;
+
+        if (particle->age >= particle->lifetime)
+        {
+            data->particles[i] = data->particles[data->count - 1];
+            data->count--;
+            i--;
+            continue;
+        }
+
+        particle->velocity = Vector3Add(particle->velocity, Vector3Scale(emitter.gravity, deltaTime));
+        particle->position = Vector3Add(particle->position, Vector3Scale(particle->velocity, deltaTime));
+    }
+
+    // Spawn new particles (up to maxParticles)
+    for (int i = 0; (i < spawnCount) && (data->count < system.maxParticles); i++)
+    {
+        ParticleState *particle = &data->particles[data->count];
+
+        particle->position.x = emitter.position.x + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.spread.x;
+        particle->position.y = emitter.position.y + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.spread.y;
+        particle->position.z = emitter.position.z + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.spread.z;
+        particle->velocity.x = emitter.velocity.x + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.velocityRandom.x;
+        particle->velocity.y = emitter.velocity.y + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.velocityRandom.y;
+        particle->velocity.z = emitter.velocity.z + (GetParticleRandom(&data->seed)*2.0f - 1.0f)*emitter.velocityRandom.z;
+        particle->lifetime = lifetimeMin + (lifetimeMax - lifetimeMin)*GetParticleRandom(&data->seed);
+        particle->age = 0.0f;
+
+        data->count++;
+    }
+}
+
+// Draw particle system particles as billboards facing camera
+// NOTE: Particles size and color are interpolated along lifetime (last update emitter),
+// GPU simulated particles are drawn with one indirect instanced draw, particles count not read back
+void DrawParticleSystem(ParticleSystem system, Camera camera, Texture2D texture)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.ctxData;
+    if (data == NULL) return;
+
+    ParticleEmitter emitter = data->emitter;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (system.gpu)
+    {
+        // Camera right and up vectors, particles quads expanded by vertex shader
+        Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+        Vector3 right = { matView.m0, matView.m4, matView.m8 };
+        Vector3 up = { matView.m1, matView.m5, matView.m9 };
+        Vector2 size = { emitter.sizeStart, emitter.sizeEnd };
+        Vector4 colorStart = ColorNormalize(emitter.colorStart);
+        Vector4 colorEnd = ColorNormalize(emitter.colorEnd);
+
+        rlDrawRenderBatchActive();
+
+        Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+        int mvpLoc = rlGetLocationUniform(data->drawShaderId, "mvp");
+
+        rlEnableShader(data->drawShaderId);
+        rlSetUniform(rlGetLocationUniform(data->drawShaderId, "cameraRight"), &right, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(rlGetLocationUniform(data->drawShaderId, "cameraUp"), &up, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(rlGetLocationUniform(data->drawShaderId, "size"), &size, SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(rlGetLocationUniform(data->drawShaderId, "colorStart"), &colorStart, SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(rlGetLocationUniform(data->drawShaderId, "colorEnd"), &colorEnd, SHADER_UNIFORM_VEC4, 1);
+
+        rlActiveTextureSlot(0);
+        rlEnableTexture(texture.id);
+
+        rlBindShaderBuffer(data->particlesIds[data->current], 0);
+        rlEnableVertexArray(data->vaoId);
+
+        int eyeCount = 1;
+        if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+        for (int eye = 0; eye < eyeCount; eye++)
+        {
+            if (eyeCount == 1) rlSetUniformMatrix(mvpLoc, MatrixMultiply(matModelView, rlGetMatrixProjection()));
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                rlSetUniformMatrix(mvpLoc, MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye)));
+            }
+
+            rlDrawVertexArrayIndirect(data->argsIds[data->current], 0);
+        }
+
+        if (eyeCount == 2) rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+
+        rlDisableVertexArray();
+        rlDisableTexture();
+        rlDisableShader();
+        return;
+    }
+#endif
+
+    // CPU particles drawn as billboards batch (quads expanded on GPU if instancing supported)
+    for (int i = 0; i < data->count; i++)
+    {
+        const ParticleState *particle = &data->particles[i];
+        float t = (particle->lifetime > 0.0f)? fminf(particle->age/particle->lifetime, 1.0f) : 1.0f;
+        float size = emitter.sizeStart + (emitter.sizeEnd - emitter.sizeStart)*t;
+
+        data->items[i].position = particle->position;
+        data->items[i].size = (Vector2){ size, size };
+        data->items[i].tint.r = (unsigned char)(emitter.colorStart.r + (emitter.colorEnd.r - emitter.colorStart.r)*t);
+        data->items[i].tint.g = (unsigned char)(emitter.colorStart.g + (emitter.colorEnd.g - emitter.colorStart.g)*t);
+        data->items[i].tint.b = (unsigned char)(emitter.colorStart.b + (emitter.colorEnd.b - emitter.colorStart.b)*t);
+        data->items[i].tint.a = (unsigned char)(emitter.colorStart.a + (emitter.colorEnd.a - emitter.colorStart.a)*t);
+    }
+
+    DrawBillboardsBatch(camera, texture, data->items, data->count);
+}
+
+// Get particle system particles alive
+// NOTE: GPU simulated particles count is read back from GPU, stalling the pipeline until last update is done
+int GetParticleCount(ParticleSystem system)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.ctxData;
+    if (data == NULL) return 0;
+
+    int count = data->count;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (system.gpu)
+    {
+        unsigned int args[4] = { 0 };
+        rlReadShaderBuffer(data->argsIds[data->current], args, sizeof(args), 0);
+        count = (int)args[1];
+    }
+#endif
+
+    return count;
+}
+
+// Draw a bounding box with wires
+void DrawBoundingBox(BoundingBox box, Color color)
+{
+    Vector3 size = { 0 };
+
+    size.x = fabsf(box.max.x - box.min.x);
+    size.y = fabsf(box.max.y - box.min.y);
+    size.z = fabsf(box.max.z - box.min.z);
+
+    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Check collision between two spheres
+bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = center1.x - center2.x;      // X distance between centers
+    float dy = center1.y - center2.y;      // Y distance between centers
+    float dz = center1.z - center2.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radius1 + radius2)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between box and boxes array, returns colliding boxes count
+// NOTE: Results are optional (one per box), boxes are tested with SIMD instructions if available
+int CheckCollisionBoxesBatch(BoundingBox box, const BoundingBox *boxes, int count, bool *results)
+{
+    int collisions = 0;
+    int i = 0;
+
+#if defined(SUPPORT_SIMD_COLLISION) && defined(RMODELS_SIMD_SSE2)
+    // Box corners loaded as 4 floats (last lane of next field), last lane always passes
+    __m128 boxMin = _mm_setr_ps(box.min.x, box.min.y, box.min.z, -FLT_MAX);
+    __m128 boxMax = _mm_setr_ps(box.max.x, box.max.y, box.max.z, FLT_MAX);
+
+    // NOTE: Last box max corner load would read past the array, tested by scalar path
+    for (; i < count - 1; i++)
+    {
+        __m128 min = _mm_loadu_ps(&boxes[i].min.x);
+        __m128 max = _mm_loadu_ps(&boxes[i].max.x);
+        bool collision = (_mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(boxMax, min), _mm_cmple_ps(boxMin, max))) == 0xf);
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+#elif defined(SUPPORT_SIMD_COLLISION) && defined(RMODELS_SIMD_NEON)
+    float32x4_t boxMin = { box.min.x, box.min.y, box.min.z, -FLT_MAX };
+    float32x4_t boxMax = { box.max.x, box.max.y, box.max.z, FLT_MAX };
+
+    for (; i < count - 1; i++)
+    {
+        float32x4_t min = vld1q_f32(&boxes[i].min.x);
+        float32x4_t max = vld1q_f32(&boxes[i].max.x);
+        uint32x4_t mask = vandq_u32(vcgeq_f32(boxMax, min), vcleq_f32(boxMin, max));
+        uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+        bool collision = ((vget_lane_u32(half, 0) & vget_lane_u32(half, 1)) != 0);
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        bool collision = CheckCollisionBoxes(box, boxes[i]);
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+
+    return collisions;
+}
+
+// Check if box is inside or intersects frustum
+// NOTE: Conservative test, boxes near frustum corners could be reported as visible
+bool CheckFrustumBox(Frustum frustum, BoundingBox box)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+
+        // Check box corner farthest along plane normal
+        float x = (plane.x >= 0.0f)? box.max.x : box.min.x;
+        float y = (plane.y >= 0.0f)? box.max.y : box.min.y;
+        float z = (plane.z >= 0.0f)? box.max.z : box.min.z;
+
+        if ((plane.x*x + plane.y*y + plane.z*z + plane.w) < 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Check if sphere is inside or intersects frustum
+bool CheckFrustumSphere(Frustum frustum, Vector3 center, float radius)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+
+        if ((plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w) < -radius) return false;
+    }
+
+    return true;
+}
+
+// Check collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get collision info between ray and sphere
+RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float distance = Vector3Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+{
+    RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result.
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
+    collision.distance = t[6];
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Vector3Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and boxes array (nearest hit box)
+// NOTE: Boxes containing ray position are hit at exit distance (as GetRayCollisionBox()), nearest box
+// collision info is computed by GetRayCollisionBox(), boxes are tested with SIMD instructions if available
+RayCollision GetRayCollisionBoxes(Ray ray, const BoundingBox *boxes, int count, int *hitIndex)
+{
+    RayCollision collision = { 0 };
+    Vector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+    float closest = FLT_MAX;
+    int closestBox = -1;
+    int i = 0;
+
+#if defined(SUPPORT_SIMD_COLLISION) && defined(RMODELS_SIMD_SSE2)
+    // Last lane (next field loaded) distances are 0, replaced by -FLT_MAX entry and FLT_MAX exit
+    __m128 origin = _mm_setr_ps(ray.position.x, ray.position.y, ray.position.z, 0.0f);
+    __m128 inverse = _mm_setr_ps(invDirection.x, invDirection.y, invDirection.z, 0.0f);
+    __m128 maskXYZ = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128 entryW = _mm_setr_ps(0.0f, 0.0f, 0.0f, -FLT_MAX);
+    __m128 exitW = _mm_setr_ps(0.0f, 0.0f, 0.0f, FLT_MAX);
+
+    // NOTE: Last box max corner load would read past the array, tested by scalar path
+    for (; i < count - 1; i++)
+    {
+        __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes[i].min.x), origin), inverse);
+        __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&boxes[i].max.x), origin), inverse);
+        __m128 entry = _mm_or_ps(_mm_and_ps(_mm_min_ps(t1, t2), maskXYZ), entryW);
+        __m128 exit = _mm_or_ps(_mm_and_ps(_mm_max_ps(t1, t2), maskXYZ), exitW);
+
+        // Horizontal maximum of entry distances and minimum of exit distances
+        entry = _mm_max_ps(entry, _mm_shuffle_ps(entry, entry, _MM_SHUFFLE(1, 0, 3, 2)));
+        entry = _mm_max_ps(entry, _mm_shuffle_ps(entry, entry, _MM_SHUFFLE(2, 3, 0, 1)));
+        exit = _mm_min_ps(exit, _mm_shuffle_ps(exit, exit, _MM_SHUFFLE(1, 0, 3, 2)));
+        exit = _mm_min_ps(exit, _mm_shuffle_ps(exit, exit, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        float tmin = _mm_cvtss_f32(entry);
+        float tmax = _mm_cvtss_f32(exit);
+
+        if ((tmax >= 0.0f) && (tmax >= tmin))
+        {
+            float distance = (tmin < 0.0f)? tmax : tmin;
+
+            if (distance < closest)
+            {
+                closest = distance;
+                closestBox = i;
+            }
+        }
+    }
+#elif defined(SUPPORT_SIMD_COLLISION) && defined(RMODELS_SIMD_NEON)
+    float32x4_t origin = { ray.position.x, ray.position.y, ray.position.z, 0.0f };
+    float32x4_t inverse = { invDirection.x, invDirection.y, invDirection.z, 0.0f };
+
+    for (; i < count - 1; i++)
+    {
+        float32x4_t t1 = vmulq_f32(vsubq_f32(vld1q_f32(&boxes[i].min.x), origin), inverse);
+        float32x4_t t2 = vmulq_f32(vsubq_f32(vld1q_f32(&boxes[i].max.x), origin), inverse);
+        float32x4_t entry = vsetq_lane_f32(-FLT_MAX, vminq_f32(t1, t2), 3);
+        float32x4_t exit = vsetq_lane_f32(FLT_MAX, vmaxq_f32(t1, t2), 3);
+
+        float32x2_t entryHalf = vpmax_f32(vget_low_f32(entry), vget_high_f32(entry));
+        float32x2_t exitHalf = vpmin_f32(vget_low_f32(exit), vget_high_f32(exit));
+        float tmin = vget_lane_f32(vpmax_f32(entryHalf, entryHalf), 0);
+        float tmax = vget_lane_f32(vpmin_f32(exitHalf, exitHalf), 0);
+
+        if ((tmax >= 0.0f) && (tmax >= tmin))
+        {
+            float distance = (tmin < 0.0f)? tmax : tmin;
+
+            if (distance < closest)
+            {
+                closest = distance;
+                closestBox = i;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float t1 = (boxes[i].min.x - ray.position.x)*invDirection.x;
+        float t2 = (boxes[i].max.x - ray.position.x)*invDirection.x;
+        float tmin = fminf(t1, t2);
+        float tmax = fmaxf(t1, t2);
+
+        t1 = (boxes[i].min.y - ray.position.y)*invDirection.y;
+        t2 = (boxes[i].max.y - ray.position.y)*invDirection.y;
+        tmin = fmaxf(tmin, fminf(t1, t2));
+        tmax = fminf(tmax, fmaxf(t1, t2));
+
+        t1 = (boxes[i].min.z - ray.position.z)*invDirection.z;
+        t2 = (boxes[i].max.z - ray.position.z)*invDirection.z;
+        tmin = fmaxf(tmin, fminf(t1, t2));
+        tmax = fminf(tmax, fmaxf(t1, t2));
+
+        if ((tmax >= 0.0f) && (tmax >= tmin))
+        {
+            float distance = (tmin < 0.0f)? tmax : tmin;
+
+            if (distance < closest)
+            {
+                closest = distance;
+                closestBox = i;
+            }
+        }
+    }
+
+    if (closestBox >= 0) collision = GetRayCollisionBox(ray, boxes[closestBox]);
+    if (hitIndex != NULL) *hitIndex = closestBox;
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            Vector3* vertdata = (Vector3*)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Load mesh bounding volume hierarchy
+// NOTE: Hierarchy is built with binned surface area heuristic (SAH), nodes are stored in a flat array
+// (inner nodes children are consecutive) and triangles vertices are copied in leaf nodes order
+MeshBVH LoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: BVH requires mesh vertex data on CPU");
+        return bvh;
+    }
+
+    int triangleCount = mesh.triangleCount;
+    const Vector3 *vertices = (const Vector3 *)mesh.vertices;
+
+    int *triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    BoundingBox *bounds = (BoundingBox *)RL_MALLOC(triangleCount*sizeof(BoundingBox));
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a = vertices[(mesh.indices != NULL)? mesh.indices[i*3 + 0] : i*3 + 0];
+        Vector3 b = vertices[(mesh.indices != NULL)? mesh.indices[i*3 + 1] : i*3 + 1];
+        Vector3 c = vertices[(mesh.indices != NULL)? mesh.indices[i*3 + 2] : i*3 + 2];
+
+        triangles[i] = i;
+        bounds[i].min = Vector3Min(Vector3Min(a, b), c);
+        bounds[i].max = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(bounds[i].min, bounds[i].max), 0.5f);
+    }
+
+    bvh.nodes = (BVHNode *)RL_CALLOC(triangleCount*2 - 1, sizeof(BVHNode));
+    bvh.nodes[0].first = 0;
+    bvh.nodes[0].count = triangleCount;
+    bvh.nodeCount = 1;
+
+    // Nodes are split depth first, one pending sibling by depth level
+    int stack[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    int stackDepth[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    int stackSize = 1;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        int nodeIndex = stack[stackSize];
+        int depth = stackDepth[stackSize];
+        BVHNode *node = &bvh.nodes[nodeIndex];
+
+        // Compute node bounds and triangles centroids bounds
+        BoundingBox nodeBounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+        BoundingBox centroidBounds = nodeBounds;
+
+        for (int i = node->first; i < node->first + node->count; i++)
+        {
+            GrowBoundsBVH(&nodeBounds, bounds[i].min, bounds[i].max);
+            GrowBoundsBVH(&centroidBounds, centroids[i], centroids[i]);
+        }
+
+        node->min = nodeBounds.min;
+        node->max = nodeBounds.max;
+        Vector3 centroidMin = centroidBounds.min;
+        Vector3 centroidMax = centroidBounds.max;
+
+        if ((node->count <= 2) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
+
+        // Find best split plane, triangles centroids binned by axis
+        Vector3 extent = Vector3Subtract(node->max, node->min);
+        float area = extent.x*extent.y + extent.y*extent.z + extent.z*extent.x;
+        float bestCost = node->count*area;
+        int bestAxis = -1;
+        int bestSplit = 0;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float binsMin = (&centroidMin.x)[axis];
+            float binsExtent = (&centroidMax.x)[axis] - binsMin;
+
+            if (binsExtent <= 0.0f) continue;
+
+            int binCount[MESH_BVH_BINS] = { 0 };
+            BoundingBox binBounds[MESH_BVH_BINS] = { 0 };
+            for (int b = 0; b < MESH_BVH_BINS; b++) binBounds[b] = (BoundingBox){ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+
+            float binScale = MESH_BVH_BINS/binsExtent;
+
+            for (int i = node->first; i < node->first + node->count; i++)
+            {
+                int b = (int)(((&centroids[i].x)[axis] - binsMin)*binScale);
+                if (b >= MESH_BVH_BINS) b = MESH_BVH_BINS - 1;
+
+                binCount[b]++;
+                GrowBoundsBVH(&binBounds[b], bounds[i].min, bounds[i].max);
+            }
+
+            // Sweep bins from both sides accumulating triangles count and bounds area
+            float leftArea[MESH_BVH_BINS - 1] = { 0 };
+            int leftCount[MESH_BVH_BINS - 1] = { 0 };
+            BoundingBox leftBox = binBounds[0];
+            BoundingBox rightBox = binBounds[MESH_BVH_BINS - 1];
+            int leftSum = 0;
+            int rightSum = 0;
+
+            for (int s = 0; s < MESH_BVH_BINS - 1; s++)
+            {
+                leftSum += binCount[s];
+                GrowBoundsBVH(&leftBox, binBounds[s].min, binBounds[s].max);
+                Vector3 size = Vector3Subtract(leftBox.max, leftBox.min);
+                leftArea[s] = size.x*size.y + size.y*size.z + size.z*size.x;
+                leftCount[s] = leftSum;
+            }
+
+            for (int s = MESH_BVH_BINS - 2; s >= 0; s--)
+            {
+                rightSum += binCount[s + 1];
+                GrowBoundsBVH(&rightBox, binBounds[s + 1].min, binBounds[s + 1].max);
+
+                if ((leftCount[s] == 0) || (rightSum == 0)) continue;
+
+                Vector3 size = Vector3Subtract(rightBox.max, rightBox.min);
+                float cost = MESH_BVH_TRAVERSAL_COST*area + leftCount[s]*leftArea[s] + rightSum*(size.x*size.y + size.y*size.z + size.z*size.x);
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = s;
+                }
+            }
+        }
+
+        // Leaf node is cheaper than any split
+        if (bestAxis < 0) continue;
+
+        // Partition node triangles by split plane, triangles bounds and centroids kept in triangles order (sequential access)
+        float binsMin = (&centroidMin.x)[bestAxis];
+        float binScale = MESH_BVH_BINS/((&centroidMax.x)[bestAxis] - binsMin);
+        int i = node->first;
+        int j = node->first + node->count - 1;
+
+        while (i <= j)
+        {
+            int b = (int)(((&centroids[i].x)[bestAxis] - binsMin)*binScale);
+            if (b >= MESH_BVH_BINS) b = MESH_BVH_BINS - 1;
+
+            if (b <= bestSplit) i++;
+            else
+            {
+                int temp = triangles[i];
+                triangles[i] = triangles[j];
+                triangles[j] = temp;
+
+                BoundingBox tempBounds = bounds[i];
+                bounds[i] = bounds[j];
+                bounds[j] = tempBounds;
+
+                Vector3 tempCentroid = centroids[i];
+                centroids[i] = centroids[j];
+                centroids[j] = tempCentroid;
+                j--;
+            }
+        }
+
+        int leftIndex = bvh.nodeCount;
+        bvh.nodes[leftIndex].first = node->first;
+        bvh.nodes[leftIndex].count = i - node->first;
+        bvh.nodes[leftIndex + 1].first = i;
+        bvh.nodes[leftIndex + 1].count = node->count - (i - node->first);
+        bvh.nodeCount += 2;
+
+        node->first = leftIndex;
+        node->count = 0;
+
+        stack[stackSize] = leftIndex + 1;
+        stackDepth[stackSize] = depth + 1;
+        stack[stackSize + 1] = leftIndex;
+        stackDepth[stackSize + 1] = depth + 1;
+        stackSize += 2;
+    }
+
+    // Copy triangles vertices in leaf nodes order
+    bvh.triangleCount = triangleCount;
+    bvh.vertices = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++) bvh.vertices[i*3 + k] = vertices[(mesh.indices != NULL)? mesh.indices[triangles[i]*3 + k] : triangles[i]*3 + k];
+    }
+
+    bvh.nodes = (BVHNode *)RL_REALLOC(bvh.nodes, bvh.nodeCount*sizeof(BVHNode));
+
+    RL_FREE(triangles);
+    RL_FREE(bounds);
+    RL_FREE(centroids);
+
+    TRACELOG(LOG_INFO, "MESH: BVH loaded successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void UnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.vertices);
+}
+
+// Get collision info between ray and mesh bounding volume hierarchy
+// NOTE: Ray is transformed into mesh space once, ray distance is the same in both spaces
+// (direction not normalized), nodes are traversed front to back skipping nodes beyond closest hit
+RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    if ((bvh.nodes == NULL) || (bvh.vertices == NULL)) return collision;
+
+    Matrix invTransform = MatrixInvert(transform);
+    Vector3 origin = Vector3Transform(ray.position, invTransform);
+    Vector3 direction = {
+        invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z,
+        invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z,
+        invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z
+    };
+    Vector3 invDirection = { 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+
+    float closest = FLT_MAX;
+    int closestTriangle = -1;
+
+    int stack[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    float stackDistance[MESH_BVH_MAX_DEPTH + 1] = { 0 };
+    int stackSize = 0;
+
+    float rootDistance = GetRayDistanceBVHNode(origin, invDirection, &bvh.nodes[0], closest);
+    if (rootDistance < FLT_MAX)
+    {
+        stack[0] = 0;
+        stackDistance[0] = rootDistance;
+        stackSize = 1;
+    }
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        if (stackDistance[stackSize] >= closest) continue;
+
+        const BVHNode *node = &bvh.nodes[stack[stackSize]];
+
+        if (node->count > 0)
+        {
+            // Test leaf triangles (Moller-Trumbore), same as GetRayCollisionTriangle()
+            for (int i = node->first; i < node->first + node->count; i++)
+            {
+                const Vector3 *p = &bvh.vertices[i*3];
+                Vector3 edge1 = Vector3Subtract(p[1], p[0]);
+                Vector3 edge2 = Vector3Subtract(p[2], p[0]);
+                Vector3 pv = Vector3CrossProduct(direction, edge2);
+                float det = Vector3DotProduct(edge1, pv);
+
+                if ((det > -EPSILON) && (det < EPSILON)) continue;
+
+                float invDet = 1.0f/det;
+                Vector3 tv = Vector3Subtract(origin, p[0]);
+                float u = Vector3DotProduct(tv, pv)*invDet;
+
+                if ((u < 0.0f) || (u > 1.0f)) continue;
+
+                Vector3 qv = Vector3CrossProduct(tv, edge1);
+                float v = Vector3DotProduct(direction, qv)*invDet;
+
+                if ((v < 0.0f) || ((u + v) > 1.0f)) continue;
+
+                float t = Vector3DotProduct(edge2, qv)*invDet;
+
+                if ((t > EPSILON) && (t < closest))
+                {
+                    closest = t;
+                    closestTriangle = i;
+                }
+            }
+        }
+        else
+        {
+            // Push farthest child first, nearest child is traversed first
+            int left = node->first;
+            float leftDistance = GetRayDistanceBVHNode(origin, invDirection, &bvh.nodes[left], closest);
+            float rightDistance = GetRayDistanceBVHNode(origin, invDirection, &bvh.nodes[left + 1], closest);
+
+            int near = left;
+            int far = left + 1;
+            if (rightDistance < leftDistance)
+            {
+                near = left + 1;
+                far = left;
+                float temp = leftDistance;
+                leftDistance = rightDistance;
+                rightDistance = temp;
+            }
+
+            if (rightDistance < FLT_MAX)
+            {
+                stack[stackSize] = far;
+                stackDistance[stackSize] = rightDistance;
+                stackSize++;
+            }
+
+            if (leftDistance < FLT_MAX)
+            {
+                stack[stackSize] = near;
+                stackDistance[stackSize] = leftDistance;
+                stackSize++;
+            }
+        }
+    }
+
+    if (closestTriangle >= 0)
+    {
+        const Vector3 *p = &bvh.vertices[closestTriangle*3];
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+
+        // Normal transformed by inverse transpose, flipped for mirroring transforms (winding reversed)
+        normal = (Vector3){
+            invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z,
+            invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z,
+            invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z
+        };
+        if (MatrixDeterminant(transform) < 0.0f) normal = Vector3Negate(normal);
+
+        collision.hit = true;
+        collision.distance = closest;
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, closest));
+        collision.normal = Vector3Normalize(normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangles array (nearest hit)
+// NOTE: Triangles vertices are consecutive (3 per triangle, counter-clockwise winding), triangles are
+// tested 4 at once with SIMD instructions if available, same test as GetRayCollisionTriangle()
+RayCollision GetRayCollisionTriangles(Ray ray, const Vector3 *vertices, int triangleCount, int *hitIndex)
+{
+    RayCollision collision = { 0 };
+    float closest = FLT_MAX;
+    int closestTriangle = -1;
+    int i = 0;
+
+#if defined(SUPPORT_SIMD_COLLISION) && (defined(RMODELS_SIMD_SSE2) || defined(RMODELS_SIMD_NEON))
+    for (; i + 4 <= triangleCount; i += 4)
+    {
+        // Transpose 4 triangles vertices (structure of arrays, one component by SIMD lane)
+        float soaVertices[9][4];
+        float distances[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            const float *components = &vertices[(i + k)*3].x;
+            for (int c = 0; c < 9; c++) soaVertices[c][k] = components[c];
+        }
+
+        int mask = CheckRayTriangles4(ray, soaVertices, closest, distances);
+
+        for (int k = 0; k < 4; k++)
+        {
+            if ((mask & (1 << k)) && (distances[k] < closest))
+            {
+                closest = distances[k];
+                closestTriangle = i + k;
+            }
+        }
+    }
+#endif
+
+    for (; i < triangleCount; i++)
+    {
+        RayCollision triHitInfo = GetRayCollisionTriangle(ray, vertices[i*3], vertices[i*3 + 1], vertices[i*3 + 2]);
+
+        if (triHitInfo.hit && (triHitInfo.distance < closest))
+        {
+            closest = triHitInfo.distance;
+            closestTriangle = i;
+        }
+    }
+
+    if (closestTriangle >= 0)
+    {
+        const Vector3 *p = &vertices[closestTriangle*3];
+
+        collision.hit = true;
+        collision.distance = closest;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0])));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, closest));
+    }
+
+    if (hitIndex != NULL) *hitIndex = closestTriangle;
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
+
+    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF) || defined(SUPPORT_FILEFORMAT_M3D)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM, GLTF and M3D)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+//
+// Keep the following information in mind when reading this
+//  - A mesh is created for every material present in the obj file
+//  - the model.meshCount is therefore the materialCount returned from tinyobj
+//  - the mesh is automatically triangulated by tinyobj
+static Model LoadOBJ(const char *fileName)
+{
+    Model model = { 0 };
+
+    tinyobj_attrib_t attrib = { 0 };
+    tinyobj_shape_t *meshes = NULL;
+    unsigned int meshCount = 0;
+
+    tinyobj_material_t *materials = NULL;
+    unsigned int materialCount = 0;
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText != NULL)
+    {
+        unsigned int dataSize = (unsigned int)strlen(fileText);
+        char currentDir[1024] = { 0 };
+        strcpy(currentDir, GetWorkingDirectory());
+        const char *workingDir = GetDirectoryPath(fileName);
+        if (CHDIR(workingDir) != 0)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+        }
+
+        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
+        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+
+        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
+        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
+
+        model.meshCount = materialCount;
+
+        // Init model materials array
+        if (materialCount > 0)
+        {
+            model.materialCount = materialCount;
+            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
+        }
+        else
+        {
+            model.meshCount = 1;
+            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+        }
+
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Count the faces for each material
+        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
+
+        // if no materials are present use all faces on one mesh
+        if (materialCount > 0)
+        {
+            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
+            {
+                //tinyobj_vertex_index_t face = attrib.faces[fi];
+                int idx = attrib.material_ids[fi];
+                matFaces[idx]++;
+            }
+
+        }
+        else
+        {
+            matFaces[0] = attrib.num_faces;
+        }
+
+        //--------------------------------------
+        // Create the material meshes
 
         // Running counts/indexes for each material mesh as we are
         // building them at the same time
@@ -3983,1979 +8667,6052 @@ static Model LoadOBJ(const char *fileName)
         int *vnCount = RL_CALLOC(model.meshCount, sizeof(int));
         int *faceCount = RL_CALLOC(model.meshCount, sizeof(int));
 
-        // Allocate space for each of the material meshes
-        for (int mi = 0; mi < model.meshCount; mi++)
+        // Allocate space for each of the material meshes
+        for (int mi = 0; mi < model.meshCount; mi++)
+        {
+            model.meshes[mi].vertexCount = matFaces[mi]*3;
+            model.meshes[mi].triangleCount = matFaces[mi];
+            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
+            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshMaterial[mi] = mi;
+        }
+
+        // Scan through the combined sub meshes and pick out each material mesh
+        for (unsigned int af = 0; af < attrib.num_faces; af++)
+        {
+            int mm = attrib.material_ids[af];   // mesh material for this face
+            if (mm == -1) { mm = 0; }           // no material object..
+
+            // Get indices for the face
+            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
+            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
+            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
+
+            // Fill vertices buffer (float) using vertex index of the face
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
+
+            if (attrib.num_texcoords > 0)
+            {
+                // Fill texcoords buffer (float) using vertex index of the face
+                // NOTE: Y-coordinate must be flipped upside-down to account for
+                // raylib's upside down textures...
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
+            }
+
+            if (attrib.num_normals > 0)
+            {
+                // Fill normals buffer (float) using vertex index of the face
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
+            }
+        }
+
+        // Init model materials
+        ProcessMaterialsOBJ(model.materials, materials, materialCount);
+
+        tinyobj_attrib_free(&attrib);
+        tinyobj_shapes_free(meshes, meshCount);
+        tinyobj_materials_free(materials, materialCount);
+
+        UnloadFileText(fileText);
+
+        RL_FREE(matFaces);
+        RL_FREE(vCount);
+        RL_FREE(vtCount);
+        RL_FREE(vnCount);
+        RL_FREE(faceCount);
+
+        if (CHDIR(currentDir) != 0)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        }
+    }
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_IQM)
+// Load IQM mesh data
+static Model LoadIQM(const char *fileName)
+{
+    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
+    #define IQM_VERSION          2          // only IQM version 2 supported
+
+    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
+    #define MESH_NAME_LENGTH    32          // Mesh name string length
+    #define MATERIAL_NAME_LENGTH 32         // Material name string length
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+    unsigned char *fileDataPtr = fileData;
+
+    // IQM file structs
+    //-----------------------------------------------------------------------------------
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMMesh {
+        unsigned int name;
+        unsigned int material;
+        unsigned int first_vertex, num_vertexes;
+        unsigned int first_triangle, num_triangles;
+    } IQMMesh;
+
+    typedef struct IQMTriangle {
+        unsigned int vertex[3];
+    } IQMTriangle;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMVertexArray {
+        unsigned int type;
+        unsigned int flags;
+        unsigned int format;
+        unsigned int size;
+        unsigned int offset;
+    } IQMVertexArray;
+
+    // NOTE: Below IQM structures are not used but listed for reference
+    /*
+    typedef struct IQMAdjacency {
+        unsigned int triangle[3];
+    } IQMAdjacency;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    typedef struct IQMBounds {
+        float bbmin[3], bbmax[3];
+        float xyradius, radius;
+    } IQMBounds;
+    */
+    //-----------------------------------------------------------------------------------
+
+    // IQM vertex data types
+    enum {
+        IQM_POSITION     = 0,
+        IQM_TEXCOORD     = 1,
+        IQM_NORMAL       = 2,
+        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
+        IQM_BLENDINDEXES = 4,
+        IQM_BLENDWEIGHTS = 5,
+        IQM_COLOR        = 6,
+        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
+    };
+
+    Model model = { 0 };
+
+    IQMMesh *imesh = NULL;
+    IQMTriangle *tri = NULL;
+    IQMVertexArray *va = NULL;
+    IQMJoint *ijoint = NULL;
+
+    float *vertex = NULL;
+    float *normal = NULL;
+    float *text = NULL;
+    char *blendi = NULL;
+    unsigned char *blendw = NULL;
+    unsigned char *color = NULL;
+
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return model;
+
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        return model;
+    }
+
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        return model;
+    }
+
+    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+
+    // Meshes data processing
+    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
+    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
+    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
+    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+
+    model.meshCount = iqmHeader->num_meshes;
+    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    model.materialCount = model.meshCount;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    char name[MESH_NAME_LENGTH] = { 0 };
+    char material[MATERIAL_NAME_LENGTH] = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
+        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
+        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
+        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
+        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+
+        model.materials[i] = LoadMaterialDefault();
+
+        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+
+        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+
+        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
+        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
+        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+
+        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
+        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+
+        model.meshes[i].triangleCount = imesh[i].num_triangles;
+        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+
+        // Animated verted data, what we actually process for rendering
+        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
+        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+    }
+
+    // Triangles data processing
+    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
+    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
+    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
+    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        int tcounter = 0;
+
+        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        {
+            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
+            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
+            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
+            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            tcounter += 3;
+        }
+    }
+
+    // Vertex arrays data processing
+    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
+    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
+    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+
+    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    {
+        switch (va[i].type)
+        {
+            case IQM_POSITION:
+            {
+                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].vertices[vCounter] = vertex[i];
+                        model.meshes[m].animVertices[vCounter] = vertex[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_NORMAL:
+            {
+                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].normals[vCounter] = normal[i];
+                        model.meshes[m].animNormals[vCounter] = normal[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_TEXCOORD:
+            {
+                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
+                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
+                    {
+                        model.meshes[m].texcoords[vCounter] = text[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDINDEXES:
+            {
+                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
+                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneIds[boneCounter] = blendi[i];
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDWEIGHTS:
+            {
+                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_COLOR:
+            {
+                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].colors[vCounter] = color[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+        }
+    }
+
+    // Bones (joints) data processing
+    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
+    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
+    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+
+    model.boneCount = iqmHeader->num_joints;
+    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
+    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
+
+    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
+    {
+        // Bones
+        model.bones[i].parent = ijoint[i].parent;
+        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
+        //fread(model.bones[i].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
+        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+
+        // Bind pose (base pose)
+        model.bindPose[i].translation.x = ijoint[i].translate[0];
+        model.bindPose[i].translation.y = ijoint[i].translate[1];
+        model.bindPose[i].translation.z = ijoint[i].translate[2];
+
+        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
+        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
+        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
+        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+
+        model.bindPose[i].scale.x = ijoint[i].scale[0];
+        model.bindPose[i].scale.y = ijoint[i].scale[1];
+        model.bindPose[i].scale.z = ijoint[i].scale[2];
+    }
+
+    BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+
+    UnloadFileDataMapped(fileData);
+
+    RL_FREE(imesh);
+    RL_FREE(tri);
+    RL_FREE(va);
+    RL_FREE(vertex);
+    RL_FREE(normal);
+    RL_FREE(text);
+    RL_FREE(blendi);
+    RL_FREE(blendw);
+    RL_FREE(ijoint);
+    RL_FREE(color);
+
+    return model;
+}
+
+// Load IQM animation data
+static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
+{
+    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
+    #define IQM_VERSION     2                   // only IQM version 2 supported
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+    unsigned char *fileDataPtr = fileData;
+
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return NULL;
+
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        return NULL;
+    }
+
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        return NULL;
+    }
+
+    // Get bones data
+    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
+    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
+    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
+    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
+
+    // Get animations data
+    *animCount = iqmHeader->num_anims;
+    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
+    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
+    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
+    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+
+    ModelAnimation *animations = RL_CALLOC(iqmHeader->num_anims, sizeof(ModelAnimation));
+
+    // frameposes, read from file data
+    const unsigned short *framedata = (const unsigned short *)(fileDataPtr + iqmHeader->ofs_frames);
+
+    // joints
+    IQMJoint *joints = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+
+    // Poses channels dequantization data: offset + framedata*scale
+    // NOTE: Channels not animated keep scale 0, only offset is used
+    float *channelOffsets = RL_MALLOC(iqmHeader->num_poses*10*sizeof(float));
+    float *channelScales = RL_CALLOC(iqmHeader->num_poses*10, sizeof(float));
+    int *channelIndices = RL_CALLOC(iqmHeader->num_poses*10, sizeof(int));
+    unsigned int channel = 0;
+
+    for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+    {
+        for (int c = 0; c < 10; c++)
+        {
+            channelOffsets[i*10 + c] = poses[i].channeloffset[c];
+
+            if ((poses[i].mask & (1 << c)) && (channel < iqmHeader->num_framechannels))
+            {
+                channelScales[i*10 + c] = poses[i].channelscale[c];
+                channelIndices[i*10 + c] = channel++;
+            }
+        }
+    }
+
+    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    {
+        // Check animation frames are available in file frames data
+        if ((anim[a].first_frame + anim[a].num_frames) > iqmHeader->num_frames)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] IQM animation #%i frames out of range", fileName, a);
+            anim[a].num_frames = (anim[a].first_frame < iqmHeader->num_frames)? iqmHeader->num_frames - anim[a].first_frame : 0;
+        }
+
+        animations[a].frameCount = anim[a].num_frames;
+        animations[a].boneCount = iqmHeader->num_poses;
+        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
+        animations[a].framePoses = LoadAnimationFramePoses(anim[a].num_frames, iqmHeader->num_poses);
+        animations[a].frameTimes = RL_MALLOC(anim[a].num_frames*sizeof(float));
+
+        // Frames time from animation framerate (if available)
+        float frameTime = (anim[a].framerate > 0.0f)? 1.0f/anim[a].framerate : MODEL_ANIMATION_FRAME_TIME;
+        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].frameTimes[j] = (float)j*frameTime;
+
+        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        {
+            // If animations and skeleton are in the same file, copy bone names to anim
+            if (iqmHeader->num_joints > 0)
+                memcpy(animations[a].bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
+            else
+                strcpy(animations[a].bones[j].name, "ANIMJOINTNAME"); // default bone name otherwise
+            animations[a].bones[j].parent = poses[j].parent;
+        }
+
+        // Decode frames poses and build them from parent bones, frames decoded in parallel
+        AnimationFramesJob job = { 0 };
+        job.anim = &animations[a];
+        job.frameData = framedata + anim[a].first_frame*iqmHeader->num_framechannels;
+        job.channelCount = iqmHeader->num_framechannels;
+        job.channelOffsets = channelOffsets;
+        job.channelScales = channelScales;
+        job.channelIndices = channelIndices;
+
+        JobParallelFor(anim[a].num_frames, DecodeAnimationFramesIQM, &job);
+    }
+
+    UnloadFileDataMapped(fileData);
+
+    RL_FREE(joints);
+    RL_FREE(channelOffsets);
+    RL_FREE(channelScales);
+    RL_FREE(channelIndices);
+    RL_FREE(poses);
+    RL_FREE(anim);
+
+    return animations;
+}
+
+// Decode IQM animation frames range poses, jobs system callback
+// NOTE: Frames channels are dequantized (offset + data*scale) directly into poses Transform fields
+static void DecodeAnimationFramesIQM(int start, int end, void *userData)
+{
+    AnimationFramesJob *job = (AnimationFramesJob *)userData;
+    ModelAnimation *anim = job->anim;
+
+    for (int frame = start; frame < end; frame++)
+    {
+        const unsigned short *data = job->frameData + frame*job->channelCount;
+        Transform *pose = anim->framePoses[frame];
+
+        for (int i = 0; i < anim->boneCount; i++)
+        {
+            const int *indices = job->channelIndices + i*10;
+            const float *offsets = job->channelOffsets + i*10;
+            const float *scales = job->channelScales + i*10;
+            float *channels = (float *)&pose[i];       // Transform: translation, rotation, scale
+
+            unsigned short values[12] = { 0 };
+            if (job->channelCount > 0) for (int c = 0; c < 10; c++) values[c] = data[indices[c]];
+
+#if defined(RMODELS_SIMD_SSE2) && defined(SUPPORT_SIMD_SKINNING)
+            __m128i quantized = _mm_loadu_si128((const __m128i *)values);
+            __m128i zero = _mm_setzero_si128();
+            __m128 low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(quantized, zero));
+            __m128 high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(quantized, zero));
+
+            _mm_storeu_ps(channels, _mm_add_ps(_mm_loadu_ps(offsets), _mm_mul_ps(low, _mm_loadu_ps(scales))));
+            _mm_storeu_ps(channels + 4, _mm_add_ps(_mm_loadu_ps(offsets + 4), _mm_mul_ps(high, _mm_loadu_ps(scales + 4))));
+            for (int c = 8; c < 10; c++) channels[c] = offsets[c] + values[c]*scales[c];
+#elif defined(RMODELS_SIMD_NEON) && defined(SUPPORT_SIMD_SKINNING)
+            uint16x8_t quantized = vld1q_u16(values);
+            float32x4_t low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(quantized)));
+            float32x4_t high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(quantized)));
+
+            vst1q_f32(channels, vmlaq_f32(vld1q_f32(offsets), low, vld1q_f32(scales)));
+            vst1q_f32(channels + 4, vmlaq_f32(vld1q_f32(offsets + 4), high, vld1q_f32(scales + 4)));
+            for (int c = 8; c < 10; c++) channels[c] = offsets[c] + values[c]*scales[c];
+#else
+            for (int c = 0; c < 10; c++) channels[c] = offsets[c] + values[c]*scales[c];
+#endif
+            pose[i].rotation = QuaternionNormalize(pose[i].rotation);
+        }
+
+        BuildPoseFromParentJoints(anim->bones, anim->boneCount, pose);
+    }
+}
+
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// Load image from different glTF provided methods (uri, path, buffer_view)
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+{
+    Image image = { 0 };
+
+    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    {
+        if ((strlen(cgltfImage->uri) > 5) &&
+            (cgltfImage->uri[0] == 'd') &&
+            (cgltfImage->uri[1] == 'a') &&
+            (cgltfImage->uri[2] == 't') &&
+            (cgltfImage->uri[3] == 'a') &&
+            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        {
+            // Data URI Format: data:<mediatype>;base64,<data>
+
+            // Find the comma
+            int i = 0;
+            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+
+            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
+            else
+            {
+                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
+                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
+                void *data = NULL;
+
+                cgltf_options options = { 0 };
+                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+
+                if (result == cgltf_result_success)
+                {
+                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    MemFree(data);
+                }
+            }
+        }
+        else     // Check if image is provided as image path
+        {
+            // NOTE: TextFormat() not used, images can be loaded from jobs threads
+            char imagePath[MAX_FILEPATH_LENGTH] = { 0 };
+            snprintf(imagePath, MAX_FILEPATH_LENGTH, "%s/%s", texPath, cgltfImage->uri);
+            image = LoadImage(imagePath);
+        }
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL))    // Check if image is provided as data buffer
+    {
+        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
+        int offset = (int)cgltfImage->buffer_view->offset;
+        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+
+        // Copy buffer data to memory for loading
+        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+        {
+            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
+            offset += stride;
+        }
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
+            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
+                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized: %s", cgltfImage->mime_type);
+
+        RL_FREE(data);
+    }
+
+    return image;
+}
+
+// Load bone info from GLTF skin data
+static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
+{
+    *boneCount = (int)skin.joints_count;
+    BoneInfo *bones = RL_MALLOC(skin.joints_count*sizeof(BoneInfo));
+
+    for (unsigned int i = 0; i < skin.joints_count; i++)
+    {
+        cgltf_node node = *skin.joints[i];
+        strncpy(bones[i].name, node.name, sizeof(bones[i].name));
+
+        // Find parent bone index
+        unsigned int parentIndex = -1;
+
+        for (unsigned int j = 0; j < skin.joints_count; j++)
+        {
+            if (skin.joints[j] == node.parent)
+            {
+                parentIndex = j;
+                break;
+            }
+        }
+
+        bones[i].parent = parentIndex;
+    }
+
+    return bones;
+}
+
+// Load glTF file into model struct, .gltf and .glb supported
+// NOTE: Model data is decoded on CPU (images and meshes in parallel), then materials textures are uploaded
+static Model LoadGLTF(const char *fileName)
+{
+    GLTFModelData gltf = LoadGLTFData(fileName, true);
+
+    return LoadGLTFTextures(gltf);
+}
+
+// Load glTF model data on CPU, materials textures images decoded but not uploaded
+// NOTE: No GPU access, it can be called from loader thread if images already cached are not skipped,
+// textures cache is only accessed from main thread
+static GLTFModelData LoadGLTFData(const char *fileName, bool skipCached)
+{
+    /*********************************************************************************************
+
+        Function implemented by Wilhem Barbier(@wbrbr), with modifications by Tyler Bezera(@gamerfiend)
+        Reviewed by Ramon Santamaria (@raysan5)
+
+        FEATURES:
+          - Supports .gltf and .glb files
+          - Supports embedded (base64) or external textures
+          - Supports PBR metallic/roughness flow, loads material textures, values and colors
+                     PBR specular/glossiness flow and extended texture flows not supported
+          - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
+          - Supports basic animations
+          - Supports KHR_mesh_quantization, quantized attributes uploaded packed to GPU
+          - Images are decoded and primitives converted in parallel (jobs system, if initialized)
+
+        RESTRICTIONS:
+          - Only triangle meshes supported
+          - Vertex attibute types and formats supported:
+              > Vertices (position): vec3: float, s8, u8, s16, u16 (normalized or not, quantized)
+              > Normals: vec3: float, s8, s16 (normalized, quantized)
+              > Tangents: vec4: float, s8, s16 (normalized, quantized)
+              > Texcoords: vec2: float, s8, u8, s16, u16 (normalized or not, quantized)
+              > Colors: vec4: u8, u16, f32 (normalized)
+              > Indices: u16, u32 (truncated to u16)
+          - Node hierarchies or transforms not supported, quantized positions are dequantized with mesh node transform
+          - EXT_meshopt_compression not supported, compressed buffers are skipped
+
+    ***********************************************************************************************/
+
+    GLTFModelData gltf = { 0 };
+
+    // glTF file loading
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
+
+    if (fileData == NULL) return gltf;
+
+    // glTF data loading
+    // NOTE: cgltf parse data (and external buffers) is allocated from a memory arena, released at once
+    MemArena arena = LoadMemArena(GLTF_MEM_ARENA_BLOCK_SIZE);
+    cgltf_options options = { 0 };
+    options.memory.alloc_func = AllocArenaGLTF;
+    options.memory.free_func = FreeArenaGLTF;
+    options.memory.user_data = &arena;
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+
+    if (result == cgltf_result_success)
+    {
+        Model model = { 0 };
+
+        if (data->file_type == cgltf_file_type_glb) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glb) loaded successfully", fileName);
+        else if (data->file_type == cgltf_file_type_gltf) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glTF) loaded successfully", fileName);
+        else TRACELOG(LOG_WARNING, "MODEL: [%s] Model format not recognized", fileName);
+
+        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
+        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
+        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
+        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
+        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
+
+        // Force reading data buffers (fills buffer_view->buffer->data)
+        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded -> TODO: Verify this assumption
+        result = cgltf_load_buffers(&options, data, fileName);
+        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
+
+        for (unsigned int i = 0; i < data->buffer_views_count; i++)
+        {
+            if (data->buffer_views[i].has_meshopt_compression)
+            {
+                TRACELOG(LOG_WARNING, "MODEL: [%s] glTF EXT_meshopt_compression not supported, compressed buffers skipped", fileName);
+                break;
+            }
+        }
+
+        // NOTE: We will load every triangles primitive in the glTF as a separate raylib mesh
+        // Other alternatives: points, lines, line_strip, triangle_strip, are skipped
+        int primitivesCount = 0;
+        for (unsigned int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+
+        GLTFLoadJob job = { 0 };
+        job.fileName = fileName;
+        job.primitives = (cgltf_primitive **)RL_CALLOC(primitivesCount + 1, sizeof(cgltf_primitive *));
+        job.nodes = (cgltf_node **)RL_CALLOC(primitivesCount + 1, sizeof(cgltf_node *));
+
+        int meshesCount = 0;
+
+        for (unsigned int i = 0; i < data->meshes_count; i++)
+        {
+            // Mesh node, required to dequantize positions (KHR_mesh_quantization)
+            cgltf_node *node = NULL;
+            for (unsigned int n = 0; n < data->nodes_count; n++)
+            {
+                if (data->nodes[n].mesh == &data->meshes[i]) { node = &data->nodes[n]; break; }
+            }
+
+            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+
+                job.primitives[meshesCount] = &data->meshes[i].primitives[p];
+                job.nodes[meshesCount] = node;
+                meshesCount++;
+            }
+        }
+
+        // Load our model data: meshes and materials
+        model.meshCount = meshesCount;
+        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+        // NOTE: We keep an extra slot for default material, in case some mesh requires it
+        model.materialCount = (int)data->materials_count + 1;
+        model.materials = RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
+
+        // Load mesh-material indices, by default all meshes are mapped to material index: 0
+        model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Materials maps images, loaded once even if shared by several maps
+        gltf.imageCount = (int)data->images_count;
+        gltf.images = (Image *)RL_CALLOC(gltf.imageCount + 1, sizeof(Image));
+        gltf.mapImages = (int *)RL_MALLOC(model.materialCount*MAX_MATERIAL_MAPS*sizeof(int));
+        for (int i = 0; i < model.materialCount*MAX_MATERIAL_MAPS; i++) gltf.mapImages[i] = -1;
+
+        #define GLTF_IMAGE_INDEX(texture) ((((texture) != NULL) && ((texture)->image != NULL))? (int)((texture)->image - data->images) : -1)
+
+        // Load materials data
+        //----------------------------------------------------------------------------------------------------
+        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
+        {
+            model.materials[j] = LoadMaterialDefault();
+            int *mapImages = gltf.mapImages + j*MAX_MATERIAL_MAPS;
+
+            // Check glTF material flow: PBR metallic/roughness flow
+            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
+            if (data->materials[i].has_pbr_metallic_roughness)
+            {
+                // Load base color texture (albedo)
+                mapImages[MATERIAL_MAP_ALBEDO] = GLTF_IMAGE_INDEX(data->materials[i].pbr_metallic_roughness.base_color_texture.texture);
+
+                // Load base color factor (tint)
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
+
+                // Load metallic/roughness texture
+                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
+                {
+                    mapImages[MATERIAL_MAP_ROUGHNESS] = GLTF_IMAGE_INDEX(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture);
+
+                    // Load metallic/roughness material properties
+                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
+                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
+
+                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
+                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
+                }
+
+                // Load normal texture
+                mapImages[MATERIAL_MAP_NORMAL] = GLTF_IMAGE_INDEX(data->materials[i].normal_texture.texture);
+
+                // Load ambient occlusion texture
+                mapImages[MATERIAL_MAP_OCCLUSION] = GLTF_IMAGE_INDEX(data->materials[i].occlusion_texture.texture);
+
+                // Load emissive texture
+                if (data->materials[i].emissive_texture.texture)
+                {
+                    mapImages[MATERIAL_MAP_EMISSION] = GLTF_IMAGE_INDEX(data->materials[i].emissive_texture.texture);
+
+                    // Load emissive color factor
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
+                }
+            }
+
+            // Other possible materials not supported by raylib pipeline:
+            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
+        }
+
+        #undef GLTF_IMAGE_INDEX
+
+        // Load materials images, decoded in parallel
+        //----------------------------------------------------------------------------------------------------
+        // NOTE: Images paths are relative to glTF file directory
+        char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+        strncpy(texPath, fileName, MAX_FILEPATH_LENGTH - 1);
+        char *lastSlash = strrchr(texPath, '/');
+        if (strrchr(texPath, '\\') > lastSlash) lastSlash = strrchr(texPath, '\\');
+        if (lastSlash != NULL) *lastSlash = '\0';
+        else strcpy(texPath, ".");
+
+        job.data = data;
+        job.texPath = texPath;
+        job.images = gltf.images;
+        job.imageIndices = (int *)RL_MALLOC((gltf.imageCount + 1)*sizeof(int));
+
+        // Images textures cache keys: images files paths, embedded images keyed by glTF file name and image index
+        gltf.imageKeys = (char *)RL_CALLOC(gltf.imageCount + 1, MAX_FILEPATH_LENGTH);
+
+        for (int i = 0; i < gltf.imageCount; i++)
+        {
+            const char *uri = data->images[i].uri;
+            char *key = gltf.imageKeys + i*MAX_FILEPATH_LENGTH;
+
+            if ((uri != NULL) && (strncmp(uri, "data:", 5) != 0)) SetTextureCacheKey(key, "%s/%s", texPath, uri);
+            else SetTextureCacheKey(key, "%s#%i", fileName, i);
+        }
+
+        int imagesCount = 0;
+        for (int i = 0; i < gltf.imageCount; i++)
+        {
+            bool used = false;
+            for (int m = 0; (m < model.materialCount*MAX_MATERIAL_MAPS) && !used; m++) used = (gltf.mapImages[m] == i);
+
+            // Images already cached are not decoded, textures are shared on loading
+            if (used && skipCached && (FindTextureCached(gltf.imageKeys + i*MAX_FILEPATH_LENGTH) >= 0)) used = false;
+            if (used) job.imageIndices[imagesCount++] = i;
+        }
+
+        JobParallelFor(imagesCount, LoadImagesGLTF, &job);
+
+        // Load meshes data, converted in parallel
+        //----------------------------------------------------------------------------------------------------
+        job.meshes = model.meshes;
+        job.meshMaterial = model.meshMaterial;
+
+        JobParallelFor(meshesCount, LoadMeshesGLTF, &job);
+
+        // Load glTF meshes animation data
+        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
+        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skinned-mesh-attributes
+        //
+        // LIMITATIONS:
+        //  - Only supports 1 armature per file, and skips loading it if there are multiple armatures
+        //  - Only supports linear interpolation (default method in Blender when checked "Always Sample Animations" when exporting a GLTF file)
+        //  - Only supports translation/rotation/scale animation channel.path, weights not considered (i.e. morph targets)
+        //----------------------------------------------------------------------------------------------------
+        if (data->skins_count == 1)
+        {
+            cgltf_skin skin = data->skins[0];
+            model.bones = LoadBoneInfoGLTF(skin, &model.boneCount);
+            model.bindPose = RL_MALLOC(model.boneCount*sizeof(Transform));
+
+            for (int i = 0; i < model.boneCount; i++)
+            {
+                cgltf_node node = *skin.joints[i];
+                model.bindPose[i].translation.x = node.translation[0];
+                model.bindPose[i].translation.y = node.translation[1];
+                model.bindPose[i].translation.z = node.translation[2];
+
+                model.bindPose[i].rotation.x = node.rotation[0];
+                model.bindPose[i].rotation.y = node.rotation[1];
+                model.bindPose[i].rotation.z = node.rotation[2];
+                model.bindPose[i].rotation.w = node.rotation[3];
+
+                model.bindPose[i].scale.x = node.scale[0];
+                model.bindPose[i].scale.y = node.scale[1];
+                model.bindPose[i].scale.z = node.scale[2];
+            }
+
+            BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+        }
+        else if (data->skins_count > 1)
+        {
+            TRACELOG(LOG_ERROR, "MODEL: [%s] can only load one skin (armature) per model, but gltf skins_count == %i", fileName, data->skins_count);
+        }
+
+        RL_FREE(job.primitives);
+        RL_FREE(job.nodes);
+        RL_FREE(job.imageIndices);
+
+        gltf.model = model;
+
+        // Free all cgltf loaded data
+        cgltf_free(data);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+
+    UnloadMemArena(arena);
+
+    // WARNING: cgltf requires the file pointer available while reading data
+    UnloadFileDataMapped(fileData);
+
+    return gltf;
+}
+
+// Load glTF model materials textures from decoded images, images unloaded (main thread)
+static Model LoadGLTFTextures(GLTFModelData gltf)
+{
+    Model model = gltf.model;
+
+    for (int i = 0; (gltf.mapImages != NULL) && (i < model.materialCount); i++)
+    {
+        for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+        {
+            int index = gltf.mapImages[i*MAX_MATERIAL_MAPS + m];
+
+            if (index >= 0)
+            {
+                // NOTE: Maps using the same image (in this or previous models) share the cached texture
+                const char *key = gltf.imageKeys + index*MAX_FILEPATH_LENGTH;
+                Texture2D texture = { 0 };
+
+                if (GetTextureCached(key, &texture)) model.materials[i].maps[m].texture = texture;
+                else if (gltf.images[index].data != NULL) model.materials[i].maps[m].texture = AddTextureCached(key, gltf.images[index]);
+            }
+        }
+    }
+
+    for (int i = 0; i < gltf.imageCount; i++) UnloadImage(gltf.images[i]);
+
+    RL_FREE(gltf.images);
+    RL_FREE(gltf.mapImages);
+    RL_FREE(gltf.imageKeys);
+
+    return model;
+}
+
+// Load glTF images range, jobs system callback
+static void LoadImagesGLTF(int start, int end, void *userData)
+{
+    GLTFLoadJob *job = (GLTFLoadJob *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        int index = job->imageIndices[i];
+        job->images[index] = LoadImageFromCgltfImage(&job->data->images[index], job->texPath);
+    }
+}
+
+// Load glTF meshes range from triangles primitives, jobs system callback
+static void LoadMeshesGLTF(int start, int end, void *userData)
+{
+    GLTFLoadJob *job = (GLTFLoadJob *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        LoadMeshGLTF(&job->meshes[i], job->primitives[i], job->nodes[i], job->fileName);
+
+        // Assign to the primitive mesh the corresponding material index
+        // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
+        // raylib assigns materials by index as loaded in model.materials array, skipping index 0, the default material
+        if (job->primitives[i]->material != NULL) job->meshMaterial[i] = (int)(job->primitives[i]->material - job->data->materials) + 1;
+    }
+}
+
+// Load glTF triangles primitive into mesh
+// NOTE: Quantized attributes (KHR_mesh_quantization) are dequantized and registered for packed upload
+static void LoadMeshGLTF(Mesh *mesh, const cgltf_primitive *primitive, const cgltf_node *node, const char *fileName)
+{
+    // Macro to simplify attributes loading code
+    #define LOAD_ATTRIBUTE(accesor, numComp, dataType, dstPtr) \
+    { \
+        int n = 0; \
+        dataType *buffer = (dataType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(dataType) + accesor->offset/sizeof(dataType); \
+        for (unsigned int k = 0; k < accesor->count; k++) \
+        {\
+            for (int l = 0; l < numComp; l++) \
+            {\
+                dstPtr[numComp*k + l] = buffer[n + l];\
+            }\
+            n += (int)(accesor->stride/sizeof(dataType));\
+        }\
+    }
+
+    // Check attribute data is available: meshopt compressed buffer views are not decoded
+    #define ATTRIBUTE_AVAILABLE(accesor) (((accesor)->buffer_view != NULL) && !(accesor)->buffer_view->has_meshopt_compression && ((accesor)->buffer_view->buffer->data != NULL))
+
+    // Check quantized attribute component type (KHR_mesh_quantization), read as float
+    #define ATTRIBUTE_QUANTIZED(accesor) (((accesor)->component_type == cgltf_component_type_r_8) || ((accesor)->component_type == cgltf_component_type_r_8u) || \
+                                          ((accesor)->component_type == cgltf_component_type_r_16) || ((accesor)->component_type == cgltf_component_type_r_16u))
+
+    // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
+    // Only some formats for each attribute type are supported, read info at the top of LoadGLTFData()!
+
+    for (unsigned int j = 0; j < primitive->attributes_count; j++)
+    {
+        cgltf_accessor *attribute = primitive->attributes[j].data;
+
+        if (!ATTRIBUTE_AVAILABLE(attribute))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Attribute data not available", fileName);
+            continue;
+        }
+
+        // Check the different attributes for every primitive
+        if (primitive->attributes[j].type == cgltf_attribute_type_position)      // POSITION
+        {
+            // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined.
+
+            if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
+            {
+                // Init raylib mesh vertices to copy glTF attribute data
+                mesh->vertexCount = (int)attribute->count;
+                mesh->vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+
+                // Load 3 components of float data type into mesh.vertices
+                LOAD_ATTRIBUTE(attribute, 3, float, mesh->vertices)
+            }
+            else if (ATTRIBUTE_QUANTIZED(attribute) && (attribute->type == cgltf_type_vec3))
+            {
+                mesh->vertexCount = (int)attribute->count;
+                mesh->vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+                cgltf_accessor_unpack_floats(attribute, mesh->vertices, attribute->count*3);
+
+                // Quantized positions are dequantized by node transform
+                if (node != NULL)
+                {
+                    float m[16] = { 0 };
+                    cgltf_node_transform_world(node, m);
+
+                    for (int v = 0; v < mesh->vertexCount; v++)
+                    {
+                        float x = mesh->vertices[v*3], y = mesh->vertices[v*3 + 1], z = mesh->vertices[v*3 + 2];
+                        mesh->vertices[v*3] = m[0]*x + m[4]*y + m[8]*z + m[12];
+                        mesh->vertices[v*3 + 1] = m[1]*x + m[5]*y + m[9]*z + m[13];
+                        mesh->vertices[v*3 + 2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+                    }
+                }
+
+                mesh->packFlags |= MESH_PACK_POSITIONS;
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_normal)   // NORMAL
+        {
+            if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
+            {
+                // Init raylib mesh normals to copy glTF attribute data
+                mesh->normals = RL_MALLOC(attribute->count*3*sizeof(float));
+
+                // Load 3 components of float data type into mesh.normals
+                LOAD_ATTRIBUTE(attribute, 3, float, mesh->normals)
+            }
+            else if (ATTRIBUTE_QUANTIZED(attribute) && (attribute->type == cgltf_type_vec3))
+            {
+                mesh->normals = RL_MALLOC(attribute->count*3*sizeof(float));
+                cgltf_accessor_unpack_floats(attribute, mesh->normals, attribute->count*3);
+                mesh->packFlags |= MESH_PACK_NORMALS;
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT
+        {
+            if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh tangent to copy glTF attribute data
+                mesh->tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+
+                // Load 4 components of float data type into mesh.tangents
+                LOAD_ATTRIBUTE(attribute, 4, float, mesh->tangents)
+            }
+            else if (ATTRIBUTE_QUANTIZED(attribute) && (attribute->type == cgltf_type_vec4))
+            {
+                mesh->tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+                cgltf_accessor_unpack_floats(attribute, mesh->tangents, attribute->count*4);
+                mesh->packFlags |= MESH_PACK_NORMALS;
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_0
+        {
+            // TODO: Support additional texture coordinates: TEXCOORD_1 -> mesh.texcoords2
+
+            if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec2))
+            {
+                // Init raylib mesh texcoords to copy glTF attribute data
+                mesh->texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+
+                // Load 3 components of float data type into mesh.texcoords
+                LOAD_ATTRIBUTE(attribute, 2, float, mesh->texcoords)
+            }
+            else if (ATTRIBUTE_QUANTIZED(attribute) && (attribute->type == cgltf_type_vec2))
+            {
+                // NOTE: Unnormalized quantized texcoords are scaled by KHR_texture_transform (not supported)
+                mesh->texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+                cgltf_accessor_unpack_floats(attribute, mesh->texcoords, attribute->count*2);
+                mesh->packFlags |= MESH_PACK_TEXCOORDS;
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_color)    // COLOR_0
+        {
+            // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range.
+
+            if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh color to copy glTF attribute data
+                mesh->colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                // Load 4 components of unsigned char data type into mesh.colors
+                LOAD_ATTRIBUTE(attribute, 4, unsigned char, mesh->colors)
+            }
+            else if ((attribute->component_type == cgltf_component_type_r_16u) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh color to copy glTF attribute data
+                mesh->colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                // Load data into a temp buffer to be converted to raylib data type
+                unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
+                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+
+                // Convert data to raylib color data type (4 bytes)
+                for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
+
+                RL_FREE(temp);
+            }
+            else if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh color to copy glTF attribute data
+                mesh->colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                // Load data into a temp buffer to be converted to raylib data type
+                float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
+                LOAD_ATTRIBUTE(attribute, 4, float, temp);
+
+                // Convert data to raylib color data type (4 bytes), we expect the color data normalized
+                for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(temp[c]*255.0f);
+
+                RL_FREE(temp);
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+        }
+
+        // NOTE: Attributes related to animations are processed separately
+    }
+
+    // Load primitive indices data (if provided)
+    if ((primitive->indices != NULL) && ATTRIBUTE_AVAILABLE(primitive->indices))
+    {
+        cgltf_accessor *attribute = primitive->indices;
+
+        mesh->triangleCount = (int)attribute->count/3;
+
+        if (attribute->component_type == cgltf_component_type_r_16u)
+        {
+            // Init raylib mesh indices to copy glTF attribute data
+            mesh->indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+
+            // Load unsigned short data type into mesh.indices
+            LOAD_ATTRIBUTE(attribute, 1, unsigned short, mesh->indices)
+        }
+        else if (attribute->component_type == cgltf_component_type_r_32u)
+        {
+            // Init raylib mesh indices to copy glTF attribute data
+            mesh->indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+
+            // Load data into a temp buffer to be converted to raylib data type
+            unsigned int *temp = RL_MALLOC(attribute->count*sizeof(unsigned int));
+            LOAD_ATTRIBUTE(attribute, 1, unsigned int, temp);
+
+            // Convert data to raylib indices data type (unsigned short)
+            for (unsigned int d = 0; d < attribute->count; d++) mesh->indices[d] = (unsigned short)temp[d];
+
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+
+            RL_FREE(temp);
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
+    }
+    else mesh->triangleCount = mesh->vertexCount/3;    // Unindexed mesh
+
+    // Load primitive animation data
+    for (unsigned int j = 0; j < primitive->attributes_count; j++)
+    {
+        // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+        cgltf_accessor *attribute = primitive->attributes[j].data;
+
+        if (!ATTRIBUTE_AVAILABLE(attribute)) continue;
+
+        if (primitive->attributes[j].type == cgltf_attribute_type_joints)        // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
+        {
+            if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh bone ids to copy glTF attribute data
+                mesh->boneIds = RL_CALLOC(mesh->vertexCount*4, sizeof(unsigned char));
+
+                // Load 4 components of unsigned char data type into mesh.boneIds
+                // for cgltf_attribute_type_joints we have:
+                //   - data.meshes[0] (256 vertices)
+                //   - 256 values, provided as cgltf_type_vec4 of bytes (4 byte per joint, stride 4)
+                LOAD_ATTRIBUTE(attribute, 4, unsigned char, mesh->boneIds)
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported, use vec4 u8", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_weights)  // WEIGHTS_n (vec4 / u8, u16, f32)
+        {
+            if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+            {
+                // Init raylib mesh bone weight to copy glTF attribute data
+                mesh->boneWeights = RL_CALLOC(mesh->vertexCount*4, sizeof(float));
+
+                // Load 4 components of float data type into mesh.boneWeights
+                // for cgltf_attribute_type_weights we have:
+                //   - data.meshes[0] (256 vertices)
+                //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
+                LOAD_ATTRIBUTE(attribute, 4, float, mesh->boneWeights)
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
+        }
+    }
+
+    // Load primitive morph targets (blend shapes), position and normal deltas stored by vertex
+    // NOTE: Sparse accessors are supported, quantized positions deltas are transformed as dequantized positions
+    if ((primitive->targets_count > 0) && (mesh->vertices != NULL))
+    {
+        int count = (int)primitive->targets_count;
+        float *deltas = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+        float m[16] = { 0 };
+
+        if ((node != NULL) && (mesh->packFlags & MESH_PACK_POSITIONS)) cgltf_node_transform_world(node, m);
+        else { m[0] = 1.0f; m[5] = 1.0f; m[10] = 1.0f; }
+
+        mesh->morphCount = count;
+        mesh->morphVertices = (float *)RL_CALLOC(mesh->vertexCount*count*3, sizeof(float));
+        if (mesh->normals != NULL) mesh->morphNormals = (float *)RL_CALLOC(mesh->vertexCount*count*3, sizeof(float));
+        mesh->morphWeights = (float *)RL_CALLOC(count, sizeof(float));
+
+        for (int t = 0; t < count; t++)
+        {
+            for (unsigned int j = 0; j < primitive->targets[t].attributes_count; j++)
+            {
+                cgltf_accessor *attribute = primitive->targets[t].attributes[j].data;
+                cgltf_attribute_type type = primitive->targets[t].attributes[j].type;
+                float *target = (type == cgltf_attribute_type_position)? mesh->morphVertices : (type == cgltf_attribute_type_normal)? mesh->morphNormals : NULL;
+
+                if ((target == NULL) || (attribute->type != cgltf_type_vec3) || (attribute->count != (cgltf_size)mesh->vertexCount)) continue;
+                if ((attribute->buffer_view != NULL) && !ATTRIBUTE_AVAILABLE(attribute)) continue;
+
+                cgltf_accessor_unpack_floats(attribute, deltas, mesh->vertexCount*3);
+
+                for (int v = 0; v < mesh->vertexCount; v++)
+                {
+                    float x = deltas[v*3], y = deltas[v*3 + 1], z = deltas[v*3 + 2];
+                    float *delta = &target[(v*count + t)*3];
+
+                    if (type == cgltf_attribute_type_position)
+                    {
+                        delta[0] = m[0]*x + m[4]*y + m[8]*z;
+                        delta[1] = m[1]*x + m[5]*y + m[9]*z;
+                        delta[2] = m[2]*x + m[6]*y + m[10]*z;
+                    }
+                    else { delta[0] = x; delta[1] = y; delta[2] = z; }
+                }
+            }
+        }
+
+        // Default weights: node weights or mesh weights
+        if ((node != NULL) && (node->weights_count >= (cgltf_size)count)) memcpy(mesh->morphWeights, node->weights, count*sizeof(float));
+        else if ((node != NULL) && (node->mesh != NULL) && (node->mesh->weights_count >= (cgltf_size)count)) memcpy(mesh->morphWeights, node->mesh->weights, count*sizeof(float));
+
+        RL_FREE(deltas);
+    }
+
+    // Animated vertex data, only required by skinned meshes
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        mesh->animVertices = RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+        if (mesh->vertices != NULL) memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+        mesh->animNormals = RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+        if (mesh->normals != NULL) memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+    }
+
+    #undef LOAD_ATTRIBUTE
+    #undef ATTRIBUTE_AVAILABLE
+    #undef ATTRIBUTE_QUANTIZED
+}
+
+// Get interpolated pose for bone sampler at a specific time. Returns true on success.
+static bool GetPoseAtTimeGLTF(cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+{
+    // Input and output should have the same count
+    float tstart = 0.0f;
+    float tend = 0.0f;
+    int keyframe = 0;       // Defaults to first pose
+
+    for (int i = 0; i < input->count - 1; i++)
+    {
+        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
+        if (!r1) return false;
+
+        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
+        if (!r2) return false;
+
+        if ((tstart <= time) && (time < tend))
+        {
+            keyframe = i;
+            break;
+        }
+    }
+
+    float t = (time - tstart)/(tend - tstart);
+    t = (t < 0.0f)? 0.0f : t;
+    t = (t > 1.0f)? 1.0f : t;
+
+    if (output->component_type != cgltf_component_type_r_32f) return false;
+
+    if (output->type == cgltf_type_vec3)
+    {
+        float tmp[3] = { 0.0f };
+        cgltf_accessor_read_float(output, keyframe, tmp, 3);
+        Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
+        cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
+        Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
+        Vector3 *r = data;
+        *r = Vector3Lerp(v1, v2, t);
+    }
+    else if (output->type == cgltf_type_vec4)
+    {
+        float tmp[4] = { 0.0f };
+        cgltf_accessor_read_float(output, keyframe, tmp, 4);
+        Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
+        cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
+        Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
+        Vector4 *r = data;
+
+        // Only v4 is for rotations, so we know it's a quat
+        *r = QuaternionSlerp(v1, v2, t);
+    }
+
+    return true;
+}
+
+// Get morph targets weights for weights sampler at a specific time
+// NOTE: Sampler output provides count weights by keyframe (cubic spline keyframes: in-tangents, weights, out-tangents)
+static void GetMorphWeightsAtTimeGLTF(const cgltf_animation_sampler *sampler, float time, int count, float *weights)
+{
+    const cgltf_accessor *input = sampler->input;
+    int keyframe = 0;
+    float tstart = 0.0f;
+    float tend = 0.0f;
+    float t = 0.0f;
+
+    for (int i = 0; i < (int)input->count - 1; i++)
+    {
+        cgltf_accessor_read_float(input, i, &tstart, 1);
+        cgltf_accessor_read_float(input, i + 1, &tend, 1);
+
+        if (time < tend)
+        {
+            keyframe = i;
+            if (tend > tstart) t = (time - tstart)/(tend - tstart);
+            break;
+        }
+
+        keyframe = i + 1;
+    }
+
+    t = (t < 0.0f)? 0.0f : t;
+    if (sampler->interpolation == cgltf_interpolation_type_step) t = 0.0f;
+
+    int stride = (sampler->interpolation == cgltf_interpolation_type_cubic_spline)? 3 : 1;
+    int offset = (stride == 3)? count : 0;
+    int nextKeyframe = (keyframe < (int)input->count - 1)? keyframe + 1 : keyframe;
+
+    for (int w = 0; w < count; w++)
+    {
+        float current = 0.0f;
+        float next = 0.0f;
+        cgltf_accessor_read_float(sampler->output, keyframe*stride*count + offset + w, &current, 1);
+        cgltf_accessor_read_float(sampler->output, nextKeyframe*stride*count + offset + w, &next, 1);
+
+        weights[w] = current + (next - current)*t;
+    }
+}
+
+#define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+
+static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, unsigned int *animCount)
+{
+    // glTF file loading
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    ModelAnimation *animations = NULL;
+
+    // glTF data loading
+    MemArena arena = LoadMemArena(GLTF_MEM_ARENA_BLOCK_SIZE);
+    cgltf_options options = { 0 };
+    options.memory.alloc_func = AllocArenaGLTF;
+    options.memory.free_func = FreeArenaGLTF;
+    options.memory.user_data = &arena;
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+
+    if (result != cgltf_result_success)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        UnloadMemArena(arena);
+        UnloadFileData(fileData);
+        *animCount = 0;
+        return NULL;
+    }
+
+    result = cgltf_load_buffers(&options, data, fileName);
+    if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
+
+    if (result == cgltf_result_success)
+    {
+        // Morph targets weights are animated by model mesh, meshes loaded from triangles primitives (LoadGLTF())
+        int morphCount = 0;
+        for (unsigned int i = 0; i < data->meshes_count; i++)
+        {
+            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                if (data->meshes[i].primitives[p].type == cgltf_primitive_type_triangles) morphCount += (int)data->meshes[i].primitives[p].targets_count;
+            }
+        }
+
+        // NOTE: Models without skin only load morph targets weights animations
+        if ((data->skins_count == 1) || ((data->skins_count == 0) && (morphCount > 0)))
+        {
+            cgltf_skin *skin = (data->skins_count == 1)? &data->skins[0] : NULL;
+            *animCount = (int)data->animations_count;
+            animations = RL_CALLOC(data->animations_count, sizeof(ModelAnimation));
+
+            for (unsigned int i = 0; i < data->animations_count; i++)
+            {
+                if (skin != NULL) animations[i].bones = LoadBoneInfoGLTF(*skin, &animations[i].boneCount);
+
+                cgltf_animation animData = data->animations[i];
+
+                struct Channels {
+                    cgltf_animation_channel *translate;
+                    cgltf_animation_channel *rotate;
+                    cgltf_animation_channel *scale;
+                };
+
+                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount + 1, sizeof(struct Channels));
+                cgltf_animation_channel **morphChannels = RL_CALLOC(data->meshes_count + 1, sizeof(cgltf_animation_channel *));
+                bool morphAnimated = false;
+                float animDuration = 0.0f;
+
+                for (unsigned int j = 0; j < animData.channels_count; j++)
+                {
+                    cgltf_animation_channel channel = animData.channels[j];
+                    int boneIndex = -1;
+
+                    for (unsigned int k = 0; (skin != NULL) && (k < skin->joints_count); k++)
+                    {
+                        if (animData.channels[j].target_node == skin->joints[k])
+                        {
+                            boneIndex = k;
+                            break;
+                        }
+                    }
+
+                    if (channel.target_path == cgltf_animation_path_type_weights)
+                    {
+                        // Morph targets weights channel, applied to channel node mesh primitives
+                        if ((channel.target_node == NULL) || (channel.target_node->mesh == NULL)) continue;
+
+                        morphChannels[channel.target_node->mesh - data->meshes] = &animData.channels[j];
+                        morphAnimated = true;
+                    }
+                    else if (boneIndex == -1)
+                    {
+                        // Animation channel for a node not in the armature
+                        continue;
+                    }
+                    else if (animData.channels[j].sampler->interpolation == cgltf_interpolation_type_linear)
+                    {
+                        if (channel.target_path == cgltf_animation_path_type_translation)
+                        {
+                            boneChannels[boneIndex].translate = &animData.channels[j];
+                        }
+                        else if (channel.target_path == cgltf_animation_path_type_rotation)
+                        {
+                            boneChannels[boneIndex].rotate = &animData.channels[j];
+                        }
+                        else if (channel.target_path == cgltf_animation_path_type_scale)
+                        {
+                            boneChannels[boneIndex].scale = &animData.channels[j];
+                        }
+                        else
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
+                        }
+                    }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Only linear interpolation curves are supported for GLTF animation.", fileName);
+
+                    float t = 0.0f;
+                    cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
+
+                    if (!r)
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load input time", fileName);
+                        continue;
+                    }
+
+                    animDuration = (t > animDuration)? t : animDuration;
+                }
+
+                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY);
+
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+                // Use channels keyframes as animation frames (sorted and unique times) if there are less
+                // keyframes than fixed rate frames, poses between keyframes are interpolated by UpdateModelAnimationEx()
+                int keyframeCount = 0;
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    if (boneChannels[k].translate) keyframeCount += (int)boneChannels[k].translate->sampler->input->count;
+                    if (boneChannels[k].rotate) keyframeCount += (int)boneChannels[k].rotate->sampler->input->count;
+                    if (boneChannels[k].scale) keyframeCount += (int)boneChannels[k].scale->sampler->input->count;
+                }
+
+                for (unsigned int k = 0; k < data->meshes_count; k++) if (morphChannels[k]) keyframeCount += (int)morphChannels[k]->sampler->input->count;
+
+                float *keyframes = RL_MALLOC(keyframeCount*sizeof(float));
+                keyframeCount = 0;
+
+                for (int k = 0; k < animations[i].boneCount; k++)
+                {
+                    cgltf_animation_channel *channels[3] = { boneChannels[k].translate, boneChannels[k].rotate, boneChannels[k].scale };
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        if (channels[c] == NULL) continue;
+
+                        cgltf_accessor *input = channels[c]->sampler->input;
+                        for (unsigned int n = 0; n < input->count; n++)
+                        {
+                            if (cgltf_accessor_read_float(input, n, &keyframes[keyframeCount], 1)) keyframeCount++;
+                        }
+                    }
+                }
+
+                for (unsigned int k = 0; k < data->meshes_count; k++)
+                {
+                    if (morphChannels[k] == NULL) continue;
+
+                    cgltf_accessor *input = morphChannels[k]->sampler->input;
+                    for (unsigned int n = 0; n < input->count; n++)
+                    {
+                        if (cgltf_accessor_read_float(input, n, &keyframes[keyframeCount], 1)) keyframeCount++;
+                    }
+                }
+
+                qsort(keyframes, keyframeCount, sizeof(float), CompareKeyframesGLTF);
+
+                int uniqueCount = 0;
+                for (int k = 0; k < keyframeCount; k++)
+                {
+                    if ((uniqueCount == 0) || ((keyframes[k] - keyframes[uniqueCount - 1]) > 0.0001f)) keyframes[uniqueCount++] = keyframes[k];
+                }
+
+                if ((uniqueCount > 1) && (uniqueCount < animations[i].frameCount))
+                {
+                    animations[i].frameCount = uniqueCount;
+                    animations[i].frameTimes = keyframes;
+                }
+                else RL_FREE(keyframes);
+#endif
+                if (animations[i].frameTimes == NULL)
+                {
+                    animations[i].frameTimes = RL_MALLOC(animations[i].frameCount*sizeof(float));
+                    for (int j = 0; j < animations[i].frameCount; j++) animations[i].frameTimes[j] = ((float)j*GLTF_ANIMDELAY)/1000.0f;
+                }
+
+                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
+
+                if (morphAnimated)
+                {
+                    animations[i].morphCount = morphCount;
+                    animations[i].frameMorphWeights = RL_CALLOC(animations[i].frameCount*morphCount, sizeof(float));
+                }
+
+                for (int j = 0; j < animations[i].frameCount; j++)
+                {
+                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
+                    float time = animations[i].frameTimes[j];
+
+                    for (int k = 0; k < animations[i].boneCount; k++)
+                    {
+                        Vector3 translation = {0, 0, 0};
+                        Quaternion rotation = {0, 0, 0, 1};
+                        Vector3 scale = {1, 1, 1};
+
+                        if (boneChannels[k].translate)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        if (boneChannels[k].rotate)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        if (boneChannels[k].scale)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        animations[i].framePoses[j][k] = (Transform){
+                            .translation = translation,
+                            .rotation = rotation,
+                            .scale = scale
+                        };
+                    }
+
+                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
+
+                    if (!morphAnimated) continue;
+
+                    // Morph targets weights by model mesh, meshes not animated keep default weights (node or mesh weights)
+                    float *weights = &animations[i].frameMorphWeights[j*morphCount];
+
+                    for (unsigned int m = 0; m < data->meshes_count; m++)
+                    {
+                        cgltf_mesh *mesh = &data->meshes[m];
+                        const cgltf_node *node = NULL;
+                        for (unsigned int n = 0; n < data->nodes_count; n++) if (data->nodes[n].mesh == mesh) { node = &data->nodes[n]; break; }
+
+                        for (unsigned int p = 0; p < mesh->primitives_count; p++)
+                        {
+                            int targetCount = (int)mesh->primitives[p].targets_count;
+                            if ((mesh->primitives[p].type != cgltf_primitive_type_triangles) || (targetCount == 0)) continue;
+
+                            if (morphChannels[m] != NULL) GetMorphWeightsAtTimeGLTF(morphChannels[m]->sampler, time, targetCount, weights);
+                            else if ((node != NULL) && (node->weights_count >= (cgltf_size)targetCount)) memcpy(weights, node->weights, targetCount*sizeof(float));
+                            else if (mesh->weights_count >= (cgltf_size)targetCount) memcpy(weights, mesh->weights, targetCount*sizeof(float));
+
+                            weights += targetCount;
+                        }
+                    }
+                }
+
+                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, animData.name, animations[i].frameCount, animDuration);
+                RL_FREE(boneChannels);
+                RL_FREE(morphChannels);
+            }
+        }
+        else TRACELOG(LOG_ERROR, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
+
+        cgltf_free(data);
+    }
+
+    UnloadMemArena(arena);
+    UnloadFileData(fileData);
+
+    return animations;
+}
+
+#if defined(SUPPORT_GLTF_ANIMATION_KEYFRAMES)
+// Compare keyframes time, qsort() callback
+static int CompareKeyframesGLTF(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+#endif
+
+// Allocate cgltf parse data from memory arena
+static void *AllocArenaGLTF(void *user, cgltf_size size)
+{
+    return MemArenaAlloc((MemArena *)user, (unsigned int)size);
+}
+
+// Free cgltf parse data
+// NOTE: Nothing to do, memory is released at once with memory arena
+static void FreeArenaGLTF(void *user, void *ptr)
+{
+    (void)user;
+    (void)ptr;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_VOX)
+// Load VOX (MagicaVoxel) mesh data
+// NOTE: Coplanar adjacent faces of same color are merged into quads (greedy meshing),
+// meshes are split to fit 16bit indices
+static Model LoadVOX(const char *fileName)
+{
+    Model model = { 0 };
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = NULL;
+
+    // Read vox file into buffer
+    fileData = LoadFileData(fileName, &fileSize);
+    if (fileData == 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
+        return model;
+    }
+
+    // Read and build voxarray description
+    VoxArray3D voxarray = { 0 };
+    int ret = Vox_LoadFromMemory(fileData, fileSize, &voxarray);
+
+    if (ret != VOX_SUCCESS)
+    {
+        // Error
+        Vox_FreeArrays(&voxarray);
+        UnloadFileData(fileData);
+
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
+        return model;
+    }
+
+    // Generate quads, 4 vertices per quad
+    float *vertices = NULL;
+    unsigned char *colors = NULL;
+    float *normals = NULL;
+    int quadCount = GenVoxelQuads(&voxarray, &vertices, &colors, &normals);
+
+    Vox_FreeArrays(&voxarray);
+    UnloadFileData(fileData);
+
+    int quadsMax = 65536/4;     // Quads per mesh (16bit indices)
+    int meshescount = (quadCount + quadsMax - 1)/quadsMax;
+    if (meshescount == 0) meshescount = 1;
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, quadCount*4, meshescount);
+
+    // Build models from meshes
+    model.transform = MatrixIdentity();
+
+    model.meshCount = meshescount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    model.materialCount = 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+
+    for (int i = 0, quad = 0; i < meshescount; i++)
+    {
+        Mesh *pmesh = &model.meshes[i];
+        int count = (int)fmin(quadsMax, quadCount - quad);
+
+        pmesh->vertexCount = count*4;
+        pmesh->triangleCount = count*2;
+
+        pmesh->vertices = (float *)RL_MALLOC(pmesh->vertexCount*3*sizeof(float));
+        pmesh->normals = (float *)RL_MALLOC(pmesh->vertexCount*3*sizeof(float));
+        pmesh->colors = (unsigned char *)RL_MALLOC(pmesh->vertexCount*4*sizeof(unsigned char));
+        pmesh->indices = (unsigned short *)RL_MALLOC(pmesh->triangleCount*3*sizeof(unsigned short));
+
+        memcpy(pmesh->vertices, vertices + quad*4*3, pmesh->vertexCount*3*sizeof(float));
+        memcpy(pmesh->normals, normals + quad*4*3, pmesh->vertexCount*3*sizeof(float));
+        memcpy(pmesh->colors, colors + quad*4*4, pmesh->vertexCount*4*sizeof(unsigned char));
+
+        // Quads triangles: v0-v1-v2, v0-v2-v3
+        for (int q = 0; q < count; q++)
+        {
+            pmesh->indices[q*6] = (unsigned short)(q*4);
+            pmesh->indices[q*6 + 1] = (unsigned short)(q*4 + 1);
+            pmesh->indices[q*6 + 2] = (unsigned short)(q*4 + 2);
+            pmesh->indices[q*6 + 3] = (unsigned short)(q*4);
+            pmesh->indices[q*6 + 4] = (unsigned short)(q*4 + 2);
+            pmesh->indices[q*6 + 5] = (unsigned short)(q*4 + 3);
+        }
+
+        // First material index
+        model.meshMaterial[i] = 0;
+
+        quad += count;
+    }
+
+    RL_FREE(vertices);
+    RL_FREE(colors);
+    RL_FREE(normals);
+
+    return model;
+}
+
+// Generate voxels greedy meshed quads, quads vertices in counter-clockwise order
+// NOTE: For every axis and slice, visible faces are merged in rectangles of same voxel id,
+// vertices scaled to match vox_loader (0.25 units per voxel)
+static int GenVoxelQuads(VoxArray3D *voxarray, float **vertices, unsigned char **colors, float **normals)
+{
+    int size[3] = { voxarray->sizeX, voxarray->sizeY, voxarray->sizeZ };
+    int stride[3] = { voxarray->sizeY*voxarray->sizeZ, voxarray->sizeZ, 1 };
+    float scale = 0.25f;
+
+    // Flatten voxels ids, faster access than chunks array
+    // NOTE: Chunks are CHUNKSIZE^3 voxels indexed [x][z][y], empty chunks not allocated
+    unsigned char *voxels = (unsigned char *)RL_CALLOC(size[0]*size[1]*size[2] + 1, sizeof(unsigned char));
+
+    for (int cx = 0; cx < voxarray->chunksSizeX; cx++)
+    {
+        for (int cz = 0; cz < voxarray->chunksSizeZ; cz++)
+        {
+            for (int cy = 0; cy < voxarray->chunksSizeY; cy++)
+            {
+                const unsigned char *chunk = voxarray->m_arrayChunks[cx*voxarray->ChunkFlattenOffset + cz*voxarray->chunksSizeY + cy].m_array;
+                if (chunk == NULL) continue;
+
+                for (int x = 0; x < CHUNKSIZE; x++)
+                {
+                    for (int z = 0; z < CHUNKSIZE; z++)
+                    {
+                        for (int y = 0; y < CHUNKSIZE; y++)
+                        {
+                            voxels[(cx*CHUNKSIZE + x)*stride[0] + (cy*CHUNKSIZE + y)*stride[1] + cz*CHUNKSIZE + z] = chunk[(x*CHUNKSIZE + z)*CHUNKSIZE + y];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    int maxSize = (int)fmax(size[0], fmax(size[1], size[2]));
+    unsigned char *mask = (unsigned char *)RL_MALLOC(maxSize*maxSize + 1);
+
+    int quadCount = 0;
+    int quadCapacity = 256;
+    float *pvertices = (float *)RL_MALLOC(quadCapacity*4*3*sizeof(float));
+    unsigned char *pcolors = (unsigned char *)RL_MALLOC(quadCapacity*4*4*sizeof(unsigned char));
+    float *pnormals = (float *)RL_MALLOC(quadCapacity*4*3*sizeof(float));
+
+    for (int d = 0; d < 3; d++)
+    {
+        int u = (d + 1)%3;
+        int v = (d + 2)%3;
+
+        for (int side = -1; side <= 1; side += 2)
+        {
+            for (int slice = 0; slice < size[d]; slice++)
+            {
+                // Get faces mask for slice: voxel id if face visible, 0 otherwise
+                bool neighbours = ((slice + side) >= 0) && ((slice + side) < size[d]);
+                int offset = side*stride[d];
+
+                for (int j = 0; j < size[v]; j++)
+                {
+                    const unsigned char *voxel = voxels + slice*stride[d] + j*stride[v];
+                    unsigned char *row = mask + j*size[u];
+
+                    for (int i = 0; i < size[u]; i++, voxel += stride[u])
+                    {
+                        unsigned char id = *voxel;
+                        if ((id != 0) && neighbours && (voxel[offset] != 0)) id = 0;
+                        row[i] = id;
+                    }
+                }
+
+                // Merge faces mask in rectangles
+                for (int j = 0; j < size[v]; j++)
+                {
+                    for (int i = 0; i < size[u];)
+                    {
+                        unsigned char id = mask[j*size[u] + i];
+
+                        if (id == 0) { i++; continue; }
+
+                        int w = 1;
+                        while (((i + w) < size[u]) && (mask[j*size[u] + i + w] == id)) w++;
+
+                        int h = 1;
+                        bool done = false;
+                        while (!done && ((j + h) < size[v]))
+                        {
+                            for (int k = 0; k < w; k++)
+                            {
+                                if (mask[(j + h)*size[u] + i + k] != id) { done = true; break; }
+                            }
+
+                            if (!done) h++;
+                        }
+
+                        for (int l = 0; l < h; l++) memset(mask + (j + l)*size[u] + i, 0, w);
+
+                        if (quadCount == quadCapacity)
+                        {
+                            quadCapacity *= 2;
+                            pvertices = (float *)RL_REALLOC(pvertices, quadCapacity*4*3*sizeof(float));
+                            pcolors = (unsigned char *)RL_REALLOC(pcolors, quadCapacity*4*4*sizeof(unsigned char));
+                            pnormals = (float *)RL_REALLOC(pnormals, quadCapacity*4*3*sizeof(float));
+                        }
+
+                        // Quad corners: origin, +u, +u+v, +v (counter-clockwise for positive side, reversed otherwise)
+                        int corners[4][2] = { { 0, 0 }, { w, 0 }, { w, h }, { 0, h } };
+                        if (side < 0)
+                        {
+                            corners[1][0] = 0; corners[1][1] = h;
+                            corners[3][0] = w; corners[3][1] = 0;
+                        }
+
+                        VoxColor color = voxarray->palette[id];
+
+                        for (int k = 0; k < 4; k++)
+                        {
+                            float position[3] = { 0 };
+                            position[d] = (float)(slice + ((side > 0)? 1 : 0))*scale;
+                            position[u] = (float)(i + corners[k][0])*scale;
+                            position[v] = (float)(j + corners[k][1])*scale;
+
+                            float normal[3] = { 0 };
+                            normal[d] = (float)side;
+
+                            int index = quadCount*4 + k;
+                            memcpy(pvertices + index*3, position, 3*sizeof(float));
+                            memcpy(pnormals + index*3, normal, 3*sizeof(float));
+                            pcolors[index*4] = color.r;
+                            pcolors[index*4 + 1] = color.g;
+                            pcolors[index*4 + 2] = color.b;
+                            pcolors[index*4 + 3] = color.a;
+                        }
+
+                        quadCount++;
+                        i += w;
+                    }
+                }
+            }
+        }
+    }
+
+    RL_FREE(mask);
+    RL_FREE(voxels);
+
+    // Shrink buffers to generated quads
+    if (quadCount > 0)
+    {
+        pvertices = (float *)RL_REALLOC(pvertices, quadCount*4*3*sizeof(float));
+        pcolors = (unsigned char *)RL_REALLOC(pcolors, quadCount*4*4*sizeof(unsigned char));
+        pnormals = (float *)RL_REALLOC(pnormals, quadCount*4*3*sizeof(float));
+    }
+
+    *vertices = pvertices;
+    *colors = pcolors;
+    *normals = pnormals;
+
+    return quadCount;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_M3D)
+// Hook LoadFileData()/UnloadFileData() calls to M3D loaders
+unsigned char *m3d_loaderhook(char *fn, unsigned int *len) { return LoadFileData((const char *)fn, len); }
+void m3d_freehook(void *data) { UnloadFileData((unsigned char *)data); }
+
+// Load M3D mesh data
+static Model LoadM3D(const char *fileName)
+{
+    Model model = { 0 };
+
+    m3d_t *m3d = NULL;
+    m3dp_t *prop = NULL;
+    unsigned int bytesRead = 0;
+    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
+    int i, j, k, l, n, mi = -2;
+
+    if (fileData != NULL)
+    {
+        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+
+        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
+            if (m3d) m3d_free(m3d);
+            UnloadFileData(fileData);
+            return model;
+        }
+        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i faces/%i materials", fileName, m3d->numface, m3d->nummaterial);
+
+        // no face? this is probably just a material library
+        if (!m3d->numface)
+        {
+            m3d_free(m3d);
+            UnloadFileData(fileData);
+            return model;
+        }
+
+        if (m3d->nummaterial > 0)
+        {
+            model.meshCount = model.materialCount = m3d->nummaterial;
+            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", model.materialCount);
+        }
+        else
+        {
+            model.meshCount = model.materialCount = 1;
+            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+        }
+
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+        model.materials = (Material *)RL_CALLOC(model.materialCount + 1, sizeof(Material));
+
+        // Map no material to index 0 with default shader, everything else materialid + 1
+        model.materials[0] = LoadMaterialDefault();
+
+        for (i = l = 0, k = -1; i < (int)m3d->numface; i++, l++)
+        {
+            // Materials are grouped together
+            if (mi != m3d->face[i].materialid)
+            {
+                // there should be only one material switch per material kind, but be bulletproof for non-optimal model files
+                if (k + 1 >= model.meshCount)
+                {
+                    model.meshCount++;
+                    model.meshes = (Mesh *)RL_REALLOC(model.meshes, model.meshCount*sizeof(Mesh));
+                    memset(&model.meshes[model.meshCount - 1], 0, sizeof(Mesh));
+                    model.meshMaterial = (int *)RL_REALLOC(model.meshMaterial, model.meshCount*sizeof(int));
+                }
+
+                k++;
+                mi = m3d->face[i].materialid;
+
+                for (j = i, l = 0; (j < (int)m3d->numface) && (mi == m3d->face[j].materialid); j++, l++);
+
+                model.meshes[k].vertexCount = l*3;
+                model.meshes[k].triangleCount = l;
+                model.meshes[k].vertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                model.meshes[k].texcoords = (float *)RL_CALLOC(model.meshes[k].vertexCount*2, sizeof(float));
+                model.meshes[k].normals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+
+                // If no map is provided, we allocate storage for vertex colors
+                // M3D specs only consider vertex colors if no material is provided
+                if (mi != M3D_UNDEF) model.meshes[k].colors = RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+
+                if (m3d->numbone && m3d->numskin)
+                {
+                    model.meshes[k].boneIds = (unsigned char *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+                    model.meshes[k].boneWeights = (float *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(float));
+                    model.meshes[k].animVertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                    model.meshes[k].animNormals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                }
+
+                model.meshMaterial[k] = mi + 1;
+                l = 0;
+            }
+
+            // Process meshes per material, add triangles
+            model.meshes[k].vertices[l*9 + 0] = m3d->vertex[m3d->face[i].vertex[0]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 1] = m3d->vertex[m3d->face[i].vertex[0]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 2] = m3d->vertex[m3d->face[i].vertex[0]].z*m3d->scale;
+            model.meshes[k].vertices[l*9 + 3] = m3d->vertex[m3d->face[i].vertex[1]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 4] = m3d->vertex[m3d->face[i].vertex[1]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 5] = m3d->vertex[m3d->face[i].vertex[1]].z*m3d->scale;
+            model.meshes[k].vertices[l*9 + 6] = m3d->vertex[m3d->face[i].vertex[2]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 7] = m3d->vertex[m3d->face[i].vertex[2]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 8] = m3d->vertex[m3d->face[i].vertex[2]].z*m3d->scale;
+
+            // without vertex color (full transparency), we use the default color
+            if (model.meshes[k].colors != NULL)
+            {
+                if (m3d->vertex[m3d->face[i].vertex[0]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 0], &m3d->vertex[m3d->face[i].vertex[0]].color, 4);
+                if (m3d->vertex[m3d->face[i].vertex[1]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 4], &m3d->vertex[m3d->face[i].vertex[1]].color, 4);
+                if (m3d->vertex[m3d->face[i].vertex[2]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 8], &m3d->vertex[m3d->face[i].vertex[2]].color, 4);
+            }
+
+            if (m3d->face[i].texcoord[0] != M3D_UNDEF)
+            {
+                model.meshes[k].texcoords[l*6 + 0] = m3d->tmap[m3d->face[i].texcoord[0]].u;
+                model.meshes[k].texcoords[l*6 + 1] = 1.0f - m3d->tmap[m3d->face[i].texcoord[0]].v;
+                model.meshes[k].texcoords[l*6 + 2] = m3d->tmap[m3d->face[i].texcoord[1]].u;
+                model.meshes[k].texcoords[l*6 + 3] = 1.0f - m3d->tmap[m3d->face[i].texcoord[1]].v;
+                model.meshes[k].texcoords[l*6 + 4] = m3d->tmap[m3d->face[i].texcoord[2]].u;
+                model.meshes[k].texcoords[l*6 + 5] = 1.0f - m3d->tmap[m3d->face[i].texcoord[2]].v;
+            }
+
+            if (m3d->face[i].normal[0] != M3D_UNDEF)
+            {
+                model.meshes[k].normals[l*9 + 0] = m3d->vertex[m3d->face[i].normal[0]].x;
+                model.meshes[k].normals[l*9 + 1] = m3d->vertex[m3d->face[i].normal[0]].y;
+                model.meshes[k].normals[l*9 + 2] = m3d->vertex[m3d->face[i].normal[0]].z;
+                model.meshes[k].normals[l*9 + 3] = m3d->vertex[m3d->face[i].normal[1]].x;
+                model.meshes[k].normals[l*9 + 4] = m3d->vertex[m3d->face[i].normal[1]].y;
+                model.meshes[k].normals[l*9 + 5] = m3d->vertex[m3d->face[i].normal[1]].z;
+                model.meshes[k].normals[l*9 + 6] = m3d->vertex[m3d->face[i].normal[2]].x;
+                model.meshes[k].normals[l*9 + 7] = m3d->vertex[m3d->face[i].normal[2]].y;
+                model.meshes[k].normals[l*9 + 8] = m3d->vertex[m3d->face[i].normal[2]].z;
+            }
+
+            // Add skin (vertex / bone weight pairs)
+            if (m3d->numbone && m3d->numskin)
+            {
+                for (n = 0; n < 3; n++)
+                {
+                    int skinid = m3d->vertex[m3d->face[i].vertex[n]].skinid;
+
+                    // Check if there is a skin for this mesh, should be, just failsafe
+                    if (skinid != M3D_UNDEF && skinid < (int)m3d->numskin)
+                    {
+                        for (j = 0; j < 4; j++)
+                        {
+                            model.meshes[k].boneIds[l*12 + n*4 + j] = m3d->skin[skinid].boneid[j];
+                            model.meshes[k].boneWeights[l*12 + n*4 + j] = m3d->skin[skinid].weight[j];
+                        }
+                    }
+                    else
+                    {
+                        // raylib does not handle boneless meshes with skeletal animations, so
+                        // we put all vertices without a bone into a special "no bone" bone
+                        model.meshes[k].boneIds[l*12 + n*4] = m3d->numbone;
+                        model.meshes[k].boneWeights[l*12 + n*4] = 1.0f;
+                    }
+                }
+            }
+        }
+
+        // Load materials
+        for (i = 0; i < (int)m3d->nummaterial; i++)
+        {
+            model.materials[i + 1] = LoadMaterialDefault();
+
+            for (j = 0; j < m3d->material[i].numprop; j++)
+            {
+                prop = &m3d->material[i].prop[j];
+
+                switch (prop->type)
+                {
+                    case m3dp_Kd:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].color, &prop->value.color, 4);
+                        model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
+                    } break;
+                    case m3dp_Ks:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].color, &prop->value.color, 4);
+                    } break;
+                    case m3dp_Ns:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Ke:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].color, &prop->value.color, 4);
+                        model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].value = 0.0f;
+                    } break;
+                    case m3dp_Pm:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_METALNESS].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Pr:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Ps:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].color = WHITE;
+                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].value = prop->value.fnum;
+                    } break;
+                    default:
+                    {
+                        if (prop->type >= 128)
+                        {
+                            Image image = { 0 };
+                            image.data = m3d->texture[prop->value.textureid].d;
+                            image.width = m3d->texture[prop->value.textureid].w;
+                            image.height = m3d->texture[prop->value.textureid].h;
+                            image.mipmaps = 1;
+                            image.format = (m3d->texture[prop->value.textureid].f == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 :
+                                           ((m3d->texture[prop->value.textureid].f == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 :
+                                           ((m3d->texture[prop->value.textureid].f == 2)? PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
+
+                            int map = -1;
+                            switch (prop->type)
+                            {
+                                case m3dp_map_Kd: map = MATERIAL_MAP_DIFFUSE; break;
+                                case m3dp_map_Ks: map = MATERIAL_MAP_SPECULAR; break;
+                                case m3dp_map_Ke: map = MATERIAL_MAP_EMISSION; break;
+                                case m3dp_map_Km: map = MATERIAL_MAP_NORMAL; break;
+                                case m3dp_map_Ka: map = MATERIAL_MAP_OCCLUSION; break;
+                                case m3dp_map_Pm: map = MATERIAL_MAP_ROUGHNESS; break;
+                                default: break;
+                            }
+
+                            // NOTE: M3D textures are decoded on file loading, textures cache only avoids uploading them again,
+                            // keyed by model file name, textures can be embedded
+                            if (map >= 0)
+                            {
+                                char key[MAX_FILEPATH_LENGTH] = { 0 };
+                                if (m3d->texture[prop->value.textureid].name != NULL) SetTextureCacheKey(key, "%s#%s", fileName, m3d->texture[prop->value.textureid].name);
+                                else SetTextureCacheKey(key, "%s#%i", fileName, (int)prop->value.textureid);
+
+                                if (!GetTextureCached(key, &model.materials[i + 1].maps[map].texture)) model.materials[i + 1].maps[map].texture = AddTextureCached(key, image);
+                            }
+                        }
+                    } break;
+                }
+            }
+        }
+
+        // Load bones
+        if (m3d->numbone)
+        {
+            model.boneCount = m3d->numbone + 1;
+            model.bones = RL_CALLOC(model.boneCount, sizeof(BoneInfo));
+            model.bindPose = RL_CALLOC(model.boneCount, sizeof(Transform));
+
+            for (i = 0; i < (int)m3d->numbone; i++)
+            {
+                model.bones[i].parent = m3d->bone[i].parent;
+                strncpy(model.bones[i].name, m3d->bone[i].name, sizeof(model.bones[i].name));
+                model.bindPose[i].translation.x = m3d->vertex[m3d->bone[i].pos].x*m3d->scale;
+                model.bindPose[i].translation.y = m3d->vertex[m3d->bone[i].pos].y*m3d->scale;
+                model.bindPose[i].translation.z = m3d->vertex[m3d->bone[i].pos].z*m3d->scale;
+                model.bindPose[i].rotation.x = m3d->vertex[m3d->bone[i].ori].x;
+                model.bindPose[i].rotation.y = m3d->vertex[m3d->bone[i].ori].y;
+                model.bindPose[i].rotation.z = m3d->vertex[m3d->bone[i].ori].z;
+                model.bindPose[i].rotation.w = m3d->vertex[m3d->bone[i].ori].w;
+
+                // TODO: if the orientation quaternion not normalized, then that's encoding scaling
+                model.bindPose[i].rotation = QuaternionNormalize(model.bindPose[i].rotation);
+                model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+
+                // Child bones are stored in parent bone relative space, convert that into model space
+                if (model.bones[i].parent >= 0)
+                {
+                    model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
+                    model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
+                    model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
+                    model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+                }
+            }
+
+            // Add a special "no bone" bone
+            model.bones[i].parent = -1;
+            strcpy(model.bones[i].name, "NO BONE");
+            model.bindPose[i].translation.x = 0.0f;
+            model.bindPose[i].translation.y = 0.0f;
+            model.bindPose[i].translation.z = 0.0f;
+            model.bindPose[i].rotation.x = 0.0f;
+            model.bindPose[i].rotation.y = 0.0f;
+            model.bindPose[i].rotation.z = 0.0f;
+            model.bindPose[i].rotation.w = 1.0f;
+            model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+        }
+
+        // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
+        // called, but not before, however DrawMesh uses these if they exist (so not good if they are left empty).
+        if (m3d->numbone && m3d->numskin)
+        {
+            for(i = 0; i < model.meshCount; i++)
+            {
+                memcpy(model.meshes[i].animVertices, model.meshes[i].vertices, model.meshes[i].vertexCount*3*sizeof(float));
+                memcpy(model.meshes[i].animNormals, model.meshes[i].normals, model.meshes[i].vertexCount*3*sizeof(float));
+            }
+        }
+
+        m3d_free(m3d);
+        UnloadFileData(fileData);
+    }
+
+    return model;
+}
+
+#define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+
+// Load M3D animation data
+static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount)
+{
+    m3d_t *m3d = NULL;
+    unsigned int bytesRead = 0;
+    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
+    ModelAnimation *animations = NULL;
+    int i = 0, j = 0;
+
+    *animCount = 0;
+
+    if (fileData != NULL)
+    {
+        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+
+        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
+            UnloadFileData(fileData);
+            return NULL;
+        }
+        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i animations, %i bones, %i skins", fileName,
+            m3d->numaction, m3d->numbone, m3d->numskin);
+
+        // No animation or bone+skin?
+        if (!m3d->numaction || !m3d->numbone || !m3d->numskin)
         {
-            model.meshes[mi].vertexCount = matFaces[mi]*3;
-            model.meshes[mi].triangleCount = matFaces[mi];
-            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
-            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshMaterial[mi] = mi;
+            m3d_free(m3d);
+            UnloadFileData(fileData);
+            return NULL;
         }
 
-        // Scan through the combined sub meshes and pick out each material mesh
-        for (unsigned int af = 0; af < attrib.num_faces; af++)
+        animations = RL_CALLOC(m3d->numaction, sizeof(ModelAnimation));
+        *animCount = m3d->numaction;
+
+        for (unsigned int a = 0; a < m3d->numaction; a++)
         {
-            int mm = attrib.material_ids[af];   // mesh material for this face
-            if (mm == -1) { mm = 0; }           // no material object..
+            animations[a].frameCount = m3d->action[a].durationmsec / M3D_ANIMDELAY;
+            animations[a].boneCount = m3d->numbone + 1;
+            animations[a].bones = RL_MALLOC((m3d->numbone + 1)*sizeof(BoneInfo));
+            animations[a].framePoses = LoadAnimationFramePoses(animations[a].frameCount, m3d->numbone + 1);
+            animations[a].frameTimes = RL_MALLOC(animations[a].frameCount*sizeof(float));
+            for (i = 0; i < animations[a].frameCount; i++) animations[a].frameTimes[i] = (float)(i*M3D_ANIMDELAY)/1000.0f;
+            // strncpy(animations[a].name, m3d->action[a].name, sizeof(animations[a].name));
+            TRACELOG(LOG_INFO, "MODEL: [%s] animation #%i: %i msec, %i frames", fileName, a, m3d->action[a].durationmsec, animations[a].frameCount);
 
-            // Get indices for the face
-            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
-            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
-            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
+            for (i = 0; i < (int)m3d->numbone; i++)
+            {
+                animations[a].bones[i].parent = m3d->bone[i].parent;
+                strncpy(animations[a].bones[i].name, m3d->bone[i].name, sizeof(animations[a].bones[i].name));
+            }
 
-            // Fill vertices buffer (float) using vertex index of the face
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
+            // A special, never transformed "no bone" bone, used for boneless vertices
+            animations[a].bones[i].parent = -1;
+            strcpy(animations[a].bones[i].name, "NO BONE");
 
-            if (attrib.num_texcoords > 0)
+            // M3D stores frames at arbitrary intervals with sparse skeletons. We need full skeletons at
+            // regular intervals, so let the M3D SDK do the heavy lifting and calculate interpolated bones
+            // NOTE: m3d_pose() is not reentrant (interpolated bones are stored in model vertices),
+            // bones local poses are read serially, poses are built from parent bones in parallel
+            for (i = 0; i < animations[a].frameCount; i++)
             {
-                // Fill texcoords buffer (float) using vertex index of the face
-                // NOTE: Y-coordinate must be flipped upside-down to account for
-                // raylib's upside down textures...
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
+                Transform *framePose = animations[a].framePoses[i];
+                m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
+
+                for (j = 0; (pose != NULL) && (j < (int)m3d->numbone); j++)
+                {
+                    framePose[j].translation.x = m3d->vertex[pose[j].pos].x*m3d->scale;
+                    framePose[j].translation.y = m3d->vertex[pose[j].pos].y*m3d->scale;
+                    framePose[j].translation.z = m3d->vertex[pose[j].pos].z*m3d->scale;
+                    framePose[j].rotation.x = m3d->vertex[pose[j].ori].x;
+                    framePose[j].rotation.y = m3d->vertex[pose[j].ori].y;
+                    framePose[j].rotation.z = m3d->vertex[pose[j].ori].z;
+                    framePose[j].rotation.w = m3d->vertex[pose[j].ori].w;
+                    framePose[j].rotation = QuaternionNormalize(framePose[j].rotation);
+                    framePose[j].scale = (Vector3){ 1.0f, 1.0f, 1.0f };
+                }
+
+                // Default transform for the "no bone" bone (and frame bones if pose not available)
+                for (; j < animations[a].boneCount; j++) framePose[j] = (Transform){ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+
+                RL_FREE(pose);
+            }
+
+            // Child bones are stored in parent bone relative space, convert that into model space
+            AnimationFramesJob job = { 0 };
+            job.anim = &animations[a];
+
+            JobParallelFor(animations[a].frameCount, BuildAnimationFramesM3D, &job);
+        }
+
+        m3d_free(m3d);
+        UnloadFileData(fileData);
+    }
+
+    return animations;
+}
+
+// Build M3D animation frames range poses from parent bones, jobs system callback
+static void BuildAnimationFramesM3D(int start, int end, void *userData)
+{
+    AnimationFramesJob *job = (AnimationFramesJob *)userData;
+
+    for (int frame = start; frame < end; frame++) BuildPoseFromParentJoints(job->anim->bones, job->anim->boneCount, job->anim->framePoses[frame]);
+}
+#endif
+
+
+// Get ray entry distance to BVH node bounds (slabs test), FLT_MAX if missed or beyond max distance
+static float GetRayDistanceBVHNode(Vector3 origin, Vector3 invDirection, const BVHNode *node, float maxDistance)
+{
+    float t1 = (node->min.x - origin.x)*invDirection.x;
+    float t2 = (node->max.x - origin.x)*invDirection.x;
+    float tmin = (t1 < t2)? t1 : t2;
+    float tmax = (t1 < t2)? t2 : t1;
+
+    t1 = (node->min.y - origin.y)*invDirection.y;
+    t2 = (node->max.y - origin.y)*invDirection.y;
+    if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+    if (t1 > tmin) tmin = t1;
+    if (t2 < tmax) tmax = t2;
+
+    t1 = (node->min.z - origin.z)*invDirection.z;
+    t2 = (node->max.z - origin.z)*invDirection.z;
+    if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+    if (t1 > tmin) tmin = t1;
+    if (t2 < tmax) tmax = t2;
+
+    if ((tmax >= tmin) && (tmax > 0.0f) && (tmin < maxDistance)) return (tmin > 0.0f)? tmin : 0.0f;
+
+    return FLT_MAX;
+}
+
+// Grow bounds to contain box
+// NOTE: Plain comparisons, fminf()/fmaxf() are not inlined without finite math
+static void GrowBoundsBVH(BoundingBox *box, Vector3 min, Vector3 max)
+{
+    if (min.x < box->min.x) box->min.x = min.x;
+    if (min.y < box->min.y) box->min.y = min.y;
+    if (min.z < box->min.z) box->min.z = min.z;
+    if (max.x > box->max.x) box->max.x = max.x;
+    if (max.y > box->max.y) box->max.y = max.y;
+    if (max.z > box->max.z) box->max.z = max.z;
+}
+
+#if defined(SUPPORT_SIMD_COLLISION) && (defined(RMODELS_SIMD_SSE2) || defined(RMODELS_SIMD_NEON))
+// Check ray against 4 triangles (Moller-Trumbore), returns hit triangles mask
+// NOTE: Triangles vertices components are SoA (p1x, p1y, p1z, p2x... by 4 triangles), hit distances are
+// written for all triangles, only hits closer than max distance are set in mask
+static int CheckRayTriangles4(Ray ray, float vertices[9][4], float maxDistance, float *distances)
+{
+    int mask = 0;
+
+#if defined(RMODELS_SIMD_SSE2)
+    __m128 dx = _mm_set1_ps(ray.direction.x);
+    __m128 dy = _mm_set1_ps(ray.direction.y);
+    __m128 dz = _mm_set1_ps(ray.direction.z);
+
+    __m128 p0x = _mm_loadu_ps(vertices[0]);
+    __m128 p0y = _mm_loadu_ps(vertices[1]);
+    __m128 p0z = _mm_loadu_ps(vertices[2]);
+
+    __m128 e1x = _mm_sub_ps(_mm_loadu_ps(vertices[3]), p0x);
+    __m128 e1y = _mm_sub_ps(_mm_loadu_ps(vertices[4]), p0y);
+    __m128 e1z = _mm_sub_ps(_mm_loadu_ps(vertices[5]), p0z);
+    __m128 e2x = _mm_sub_ps(_mm_loadu_ps(vertices[6]), p0x);
+    __m128 e2y = _mm_sub_ps(_mm_loadu_ps(vertices[7]), p0y);
+    __m128 e2z = _mm_sub_ps(_mm_loadu_ps(vertices[8]), p0z);
+
+    // p = direction x edge2, det = edge1·p
+    __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+    // tv = origin - p1, u = tv·p/det
+    __m128 tx = _mm_sub_ps(_mm_set1_ps(ray.position.x), p0x);
+    __m128 ty = _mm_sub_ps(_mm_set1_ps(ray.position.y), p0y);
+    __m128 tz = _mm_sub_ps(_mm_set1_ps(ray.position.z), p0z);
+    __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), invDet);
+
+    // q = tv x edge1, v = direction·q/det, t = edge2·q/det
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+    __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+    __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+    __m128 hit = _mm_cmpge_ps(absDet, _mm_set1_ps(EPSILON));
+    hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+    hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+    hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpgt_ps(t, _mm_set1_ps(EPSILON)), _mm_cmplt_ps(t, _mm_set1_ps(maxDistance))));
+
+    _mm_storeu_ps(distances, t);
+    mask = _mm_movemask_ps(hit);
+#elif defined(RMODELS_SIMD_NEON)
+    float32x4_t dx = vdupq_n_f32(ray.direction.x);
+    float32x4_t dy = vdupq_n_f32(ray.direction.y);
+    float32x4_t dz = vdupq_n_f32(ray.direction.z);
+
+    float32x4_t p0x = vld1q_f32(vertices[0]);
+    float32x4_t p0y = vld1q_f32(vertices[1]);
+    float32x4_t p0z = vld1q_f32(vertices[2]);
+
+    float32x4_t e1x = vsubq_f32(vld1q_f32(vertices[3]), p0x);
+    float32x4_t e1y = vsubq_f32(vld1q_f32(vertices[4]), p0y);
+    float32x4_t e1z = vsubq_f32(vld1q_f32(vertices[5]), p0z);
+    float32x4_t e2x = vsubq_f32(vld1q_f32(vertices[6]), p0x);
+    float32x4_t e2y = vsubq_f32(vld1q_f32(vertices[7]), p0y);
+    float32x4_t e2z = vsubq_f32(vld1q_f32(vertices[8]), p0z);
+
+    float32x4_t px = vsubq_f32(vmulq_f32(dy, e2z), vmulq_f32(dz, e2y));
+    float32x4_t py = vsubq_f32(vmulq_f32(dz, e2x), vmulq_f32(dx, e2z));
+    float32x4_t pz = vsubq_f32(vmulq_f32(dx, e2y), vmulq_f32(dy, e2x));
+    float32x4_t det = vaddq_f32(vaddq_f32(vmulq_f32(e1x, px), vmulq_f32(e1y, py)), vmulq_f32(e1z, pz));
+
+    // Reciprocal estimate refined by two Newton-Raphson steps (no vector division on ARMv7)
+    float32x4_t invDet = vrecpeq_f32(det);
+    invDet = vmulq_f32(vrecpsq_f32(det, invDet), invDet);
+    invDet = vmulq_f32(vrecpsq_f32(det, invDet), invDet);
+
+    float32x4_t tx = vsubq_f32(vdupq_n_f32(ray.position.x), p0x);
+    float32x4_t ty = vsubq_f32(vdupq_n_f32(ray.position.y), p0y);
+    float32x4_t tz = vsubq_f32(vdupq_n_f32(ray.position.z), p0z);
+    float32x4_t u = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(tx, px), vmulq_f32(ty, py)), vmulq_f32(tz, pz)), invDet);
+
+    float32x4_t qx = vsubq_f32(vmulq_f32(ty, e1z), vmulq_f32(tz, e1y));
+    float32x4_t qy = vsubq_f32(vmulq_f32(tz, e1x), vmulq_f32(tx, e1z));
+    float32x4_t qz = vsubq_f32(vmulq_f32(tx, e1y), vmulq_f32(ty, e1x));
+    float32x4_t v = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(dx, qx), vmulq_f32(dy, qy)), vmulq_f32(dz, qz)), invDet);
+    float32x4_t t = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(e2x, qx), vmulq_f32(e2y, qy)), vmulq_f32(e2z, qz)), invDet);
+
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    float32x4_t one = vdupq_n_f32(1.0f);
+    uint32x4_t hit = vcgeq_f32(vabsq_f32(det), vdupq_n_f32(EPSILON));
+    hit = vandq_u32(hit, vandq_u32(vcgeq_f32(u, zero), vcleq_f32(u, one)));
+    hit = vandq_u32(hit, vandq_u32(vcgeq_f32(v, zero), vcleq_f32(vaddq_f32(u, v), one)));
+    hit = vandq_u32(hit, vandq_u32(vcgtq_f32(t, vdupq_n_f32(EPSILON)), vcltq_f32(t, vdupq_n_f32(maxDistance))));
+
+    vst1q_f32(distances, t);
+    mask = (vgetq_lane_u32(hit, 0) & 1) | ((vgetq_lane_u32(hit, 1) & 1) << 1) | ((vgetq_lane_u32(hit, 2) & 1) << 2) | ((vgetq_lane_u32(hit, 3) & 1) << 3);
+#endif
+
+    return mask;
+}
+#endif
+
+// Compute bones matrices for pose
+// NOTE: Bone matrix transforms vertex from bind pose to pose: translate to bone origin, scale,
+// rotate by bind to pose rotation and translate to pose, bones missing in pose are not transformed
+static void ComputeBoneMatrices(Model model, const Transform *pose, int poseCount, Matrix *boneMatrices)
+{
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        if (i >= poseCount)
+        {
+            boneMatrices[i] = MatrixIdentity();
+            continue;
+        }
+
+        const Transform *inPose = &model.bindPose[i];
+        const Transform *outPose = &pose[i];
+
+        Quaternion rotation = QuaternionMultiply(outPose->rotation, QuaternionInvert(inPose->rotation));
+
+        Matrix matBone = MatrixMultiply(MatrixTranslate(-inPose->translation.x, -inPose->translation.y, -inPose->translation.z),
+                                        MatrixScale(outPose->scale.x, outPose->scale.y, outPose->scale.z));
+        matBone = MatrixMultiply(matBone, QuaternionToMatrix(rotation));
+        boneMatrices[i] = MatrixMultiply(matBone, MatrixTranslate(outPose->translation.x, outPose->translation.y, outPose->translation.z));
+    }
+}
+
+// Update model pose for animation pose, returns bones skinning matrices
+// NOTE: Animation poses are bones global transforms (parents hierarchy evaluated on animation loading),
+// pose is evaluated once per update and shared by skinning, bounds update and GetModelBoneTransform(),
+// models without pose (not loaded from file) only compute skinning matrices into buffer (model.boneCount matrices)
+static const Matrix *UpdateModelPose(Model model, const Transform *pose, int poseCount, Matrix *buffer)
+{
+    ModelPose *modelPose = model.pose;
+
+    if ((modelPose == NULL) || (modelPose->boneCount != model.boneCount))
+    {
+        ComputeBoneMatrices(model, pose, poseCount, buffer);
+        return buffer;
+    }
+
+    for (int i = 0; i < modelPose->boneCount; i++)
+    {
+        // Bones not available in pose keep bind pose (identity skinning matrix)
+        const Transform *transform = (i < poseCount)? &pose[i] : &model.bindPose[i];
+
+        modelPose->transforms[i] = *transform;
+        modelPose->globals[i] = MatrixMultiply(MatrixMultiply(MatrixScale(transform->scale.x, transform->scale.y, transform->scale.z), QuaternionToMatrix(transform->rotation)),
+                                               MatrixTranslate(transform->translation.x, transform->translation.y, transform->translation.z));
+    }
+
+    ComputeBoneMatrices(model, pose, poseCount, modelPose->boneMatrices);
+
+    return modelPose->boneMatrices;
+}
+
+// Skin model meshes vertices range [start, end) for animation frame, jobs system callback
+// NOTE: Range can span several meshes, job items are the vertices of all skinned meshes
+static void SkinMeshVertices(int start, int end, void *userData)
+{
+    MeshSkinningJob *job = (MeshSkinningJob *)userData;
+
+    // Find mesh containing first vertex of range
+    int m = 0;
+    while (job->meshOffsets[m + 1] <= start) m++;
+
+    while (start < end)
+    {
+        int meshEnd = (end < job->meshOffsets[m + 1])? end : job->meshOffsets[m + 1];
+
+        SkinVertices(&job->model->meshes[m], job->boneMatrices, start - job->meshOffsets[m], meshEnd - job->meshOffsets[m]);
+
+        start = meshEnd;
+        m++;
+    }
+}
+
+// Compute triangles range [start, end) corners tangents and bitangents, jobs system callback (GenMeshTangents())
+// NOTE: Triangle tangent is projected on every corner normal plane, weighted by corner angle,
+// triangles with degenerated texcoords add no tangent
+static void ComputeTriangleTangents(int start, int end, void *userData)
+{
+    MeshTangentsJob *job = (MeshTangentsJob *)userData;
+    const Mesh *mesh = job->mesh;
+
+    for (int t = start; t < end; t++)
+    {
+        int index[3] = { t*3 + 0, t*3 + 1, t*3 + 2 };
+        if (mesh->indices != NULL) for (int k = 0; k < 3; k++) index[k] = mesh->indices[t*3 + k];
+
+        Vector3 v[3] = { 0 };
+        Vector2 uv[3] = { 0 };
+        for (int k = 0; k < 3; k++)
+        {
+            v[k] = (Vector3){ mesh->vertices[index[k]*3 + 0], mesh->vertices[index[k]*3 + 1], mesh->vertices[index[k]*3 + 2] };
+            uv[k] = (Vector2){ mesh->texcoords[index[k]*2 + 0], mesh->texcoords[index[k]*2 + 1] };
+        }
+
+        Vector3 e1 = Vector3Subtract(v[1], v[0]);
+        Vector3 e2 = Vector3Subtract(v[2], v[0]);
+
+        float s1 = uv[1].x - uv[0].x;
+        float t1 = uv[1].y - uv[0].y;
+        float s2 = uv[2].x - uv[0].x;
+        float t2 = uv[2].y - uv[0].y;
+
+        float div = s1*t2 - s2*t1;
+        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+
+        // NOTE: Bitangent sign is kept for texcoords mirroring, tangent magnitude is not used (normalized)
+        Vector3 sdir = Vector3Scale(Vector3Subtract(Vector3Scale(e1, t2), Vector3Scale(e2, t1)), r);
+        Vector3 tdir = Vector3Scale(Vector3Subtract(Vector3Scale(e2, s1), Vector3Scale(e1, s2)), r);
+
+        for (int k = 0; k < 3; k++)
+        {
+            Vector3 normal = { mesh->normals[index[k]*3 + 0], mesh->normals[index[k]*3 + 1], mesh->normals[index[k]*3 + 2] };
+            Vector3 tangent = Vector3Subtract(sdir, Vector3Scale(normal, Vector3DotProduct(normal, sdir)));
+            Vector3 bitangent = Vector3Subtract(tdir, Vector3Scale(normal, Vector3DotProduct(normal, tdir)));
+
+            float angle = Vector3Angle(Vector3Subtract(v[(k + 1)%3], v[k]), Vector3Subtract(v[(k + 2)%3], v[k]));
+
+            job->cornerTangents[t*3 + k] = Vector3Scale(Vector3Normalize(tangent), angle);
+            job->cornerBitangents[t*3 + k] = Vector3Scale(Vector3Normalize(bitangent), angle);
+        }
+    }
+}
+
+// Compute vertices range [start, end) tangents from welded vertex corners, jobs system callback (GenMeshTangents())
+// NOTE: Vertices with no texcoords gradient get a tangent perpendicular to normal
+static void ComputeVertexTangents(int start, int end, void *userData)
+{
+    MeshTangentsJob *job = (MeshTangentsJob *)userData;
+    Mesh *mesh = (Mesh *)job->mesh;
+
+    for (int i = start; i < end; i++)
+    {
+        int weld = job->welds[i];
+        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        Vector3 tangent = { 0 };
+        Vector3 bitangent = { 0 };
+
+        for (int c = job->cornerOffsets[weld]; c < job->cornerOffsets[weld + 1]; c++)
+        {
+            tangent = Vector3Add(tangent, job->cornerTangents[job->corners[c]]);
+            bitangent = Vector3Add(bitangent, job->cornerBitangents[job->corners[c]]);
+        }
+
+        normal = Vector3Normalize(normal);
+        tangent = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
+        if (Vector3LengthSqr(tangent) < 1e-12f) tangent = Vector3Perpendicular(normal);
+        tangent = Vector3Normalize(tangent);
+
+        mesh->tangents[i*4 + 0] = tangent.x;
+        mesh->tangents[i*4 + 1] = tangent.y;
+        mesh->tangents[i*4 + 2] = tangent.z;
+        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), bitangent) < 0.0f)? -1.0f : 1.0f;
+    }
+}
+
+// Skin mesh vertices range [start, end) with bones matrices
+// NOTE: Animated vertices and normals are computed from default vertices and normals,
+// bones matrices rows (3x4, translation in last column) are blended by vertex bone weights
+static void SkinVertices(Mesh *mesh, const Matrix *boneMatrices, int start, int end)
+{
+    // Meshes morphed on CPU are morphed into animated vertex data, skinned in place
+    bool morphed = ((mesh->morphVertices != NULL) && (mesh->morphTextureId == 0));
+    if (morphed) MorphVertices(mesh, start, end);
+
+    const float *vertices = morphed? mesh->animVertices : mesh->vertices;
+    const float *normals = ((mesh->normals != NULL) && (mesh->animNormals != NULL))? (morphed? mesh->animNormals : mesh->normals) : NULL;
+    const unsigned char *boneIds = mesh->boneIds;
+    const float *boneWeights = mesh->boneWeights;
+
+    for (int v = start; v < end; v++)
+    {
+        const float *position = &vertices[v*3];
+        float out[4] = { 0 };
+
+#if defined(RMODELS_SIMD_SSE2) && defined(SUPPORT_SIMD_SKINNING)
+        __m128 row0 = _mm_setzero_ps();
+        __m128 row1 = _mm_setzero_ps();
+        __m128 row2 = _mm_setzero_ps();
+
+        // Iterates over 4 bones per vertex, early stop when no transformation will be applied
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = boneWeights[v*4 + j];
+            if (boneWeight == 0.0f) continue;
+
+            const float *bone = &boneMatrices[boneIds[v*4 + j]].m0;
+            __m128 weight = _mm_set1_ps(boneWeight);
+
+            row0 = _mm_add_ps(row0, _mm_mul_ps(weight, _mm_loadu_ps(bone)));
+            row1 = _mm_add_ps(row1, _mm_mul_ps(weight, _mm_loadu_ps(bone + 4)));
+            row2 = _mm_add_ps(row2, _mm_mul_ps(weight, _mm_loadu_ps(bone + 8)));
+        }
+
+        __m128 point = _mm_setr_ps(position[0], position[1], position[2], 1.0f);
+        __m128 x = _mm_mul_ps(row0, point);
+        __m128 y = _mm_mul_ps(row1, point);
+        __m128 z = _mm_mul_ps(row2, point);
+        __m128 w = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+
+        mesh->animVertices[v*3] = out[0];
+        mesh->animVertices[v*3 + 1] = out[1];
+        mesh->animVertices[v*3 + 2] = out[2];
+
+        if (normals != NULL)
+        {
+            point = _mm_setr_ps(normals[v*3], normals[v*3 + 1], normals[v*3 + 2], 0.0f);
+            x = _mm_mul_ps(row0, point);
+            y = _mm_mul_ps(row1, point);
+            z = _mm_mul_ps(row2, point);
+            w = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+
+            mesh->animNormals[v*3] = out[0];
+            mesh->animNormals[v*3 + 1] = out[1];
+            mesh->animNormals[v*3 + 2] = out[2];
+        }
+#elif defined(RMODELS_SIMD_NEON) && defined(SUPPORT_SIMD_SKINNING)
+        float32x4_t row0 = vdupq_n_f32(0.0f);
+        float32x4_t row1 = vdupq_n_f32(0.0f);
+        float32x4_t row2 = vdupq_n_f32(0.0f);
+
+        // Iterates over 4 bones per vertex, early stop when no transformation will be applied
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = boneWeights[v*4 + j];
+            if (boneWeight == 0.0f) continue;
+
+            const float *bone = &boneMatrices[boneIds[v*4 + j]].m0;
+
+            row0 = vaddq_f32(row0, vmulq_n_f32(vld1q_f32(bone), boneWeight));
+            row1 = vaddq_f32(row1, vmulq_n_f32(vld1q_f32(bone + 4), boneWeight));
+            row2 = vaddq_f32(row2, vmulq_n_f32(vld1q_f32(bone + 8), boneWeight));
+        }
+
+        float32x4_t point = { position[0], position[1], position[2], 1.0f };
+        float32x4_t x = vmulq_f32(row0, point);
+        float32x4_t y = vmulq_f32(row1, point);
+        float32x4_t z = vmulq_f32(row2, point);
+        float32x2_t xy = vpadd_f32(vpadd_f32(vget_low_f32(x), vget_high_f32(x)), vpadd_f32(vget_low_f32(y), vget_high_f32(y)));
+        float32x2_t zz = vpadd_f32(vget_low_f32(z), vget_high_f32(z));
+
+        mesh->animVertices[v*3] = vget_lane_f32(xy, 0);
+        mesh->animVertices[v*3 + 1] = vget_lane_f32(xy, 1);
+        mesh->animVertices[v*3 + 2] = vget_lane_f32(zz, 0) + vget_lane_f32(zz, 1);
+
+        if (normals != NULL)
+        {
+            float32x4_t normal = { normals[v*3], normals[v*3 + 1], normals[v*3 + 2], 0.0f };
+            x = vmulq_f32(row0, normal);
+            y = vmulq_f32(row1, normal);
+            z = vmulq_f32(row2, normal);
+            xy = vpadd_f32(vpadd_f32(vget_low_f32(x), vget_high_f32(x)), vpadd_f32(vget_low_f32(y), vget_high_f32(y)));
+            zz = vpadd_f32(vget_low_f32(z), vget_high_f32(z));
+
+            mesh->animNormals[v*3] = vget_lane_f32(xy, 0);
+            mesh->animNormals[v*3 + 1] = vget_lane_f32(xy, 1);
+            mesh->animNormals[v*3 + 2] = vget_lane_f32(zz, 0) + vget_lane_f32(zz, 1);
+        }
+#else
+        float rows[12] = { 0 };
+
+        // Iterates over 4 bones per vertex, early stop when no transformation will be applied
+        for (int j = 0; j < 4; j++)
+        {
+            float boneWeight = boneWeights[v*4 + j];
+            if (boneWeight == 0.0f) continue;
+
+            const float *bone = &boneMatrices[boneIds[v*4 + j]].m0;
+            for (int k = 0; k < 12; k++) rows[k] += bone[k]*boneWeight;
+        }
+
+        for (int k = 0; k < 3; k++) out[k] = rows[k*4]*position[0] + rows[k*4 + 1]*position[1] + rows[k*4 + 2]*position[2] + rows[k*4 + 3];
+
+        mesh->animVertices[v*3] = out[0];
+        mesh->animVertices[v*3 + 1] = out[1];
+        mesh->animVertices[v*3 + 2] = out[2];
+
+        if (normals != NULL)
+        {
+            const float *normal = &normals[v*3];
+            for (int k = 0; k < 3; k++) out[k] = rows[k*4]*normal[0] + rows[k*4 + 1]*normal[1] + rows[k*4 + 2]*normal[2];
+
+            mesh->animNormals[v*3] = out[0];
+            mesh->animNormals[v*3 + 1] = out[1];
+            mesh->animNormals[v*3 + 2] = out[2];
+        }
+#endif
+    }
+}
+
+// Morph mesh vertices range into animated vertex data (CPU morphing)
+// NOTE: Vertices and normals are displaced by weighted morph targets deltas (zero weights skipped)
+static void MorphVertices(Mesh *mesh, int start, int end)
+{
+    const int count = mesh->morphCount;
+    const float *weights = mesh->morphWeights;
+
+    for (int v = start; v < end; v++)
+    {
+        float position[3] = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
+        const float *delta = &mesh->morphVertices[v*count*3];
+
+        for (int t = 0; t < count; t++)
+        {
+            if (weights[t] == 0.0f) continue;
+            for (int k = 0; k < 3; k++) position[k] += delta[t*3 + k]*weights[t];
+        }
+
+        memcpy(&mesh->animVertices[v*3], position, 3*sizeof(float));
+
+        if ((mesh->normals == NULL) || (mesh->animNormals == NULL)) continue;
+
+        float normal[3] = { mesh->normals[v*3], mesh->normals[v*3 + 1], mesh->normals[v*3 + 2] };
+
+        if (mesh->morphNormals != NULL)
+        {
+            delta = &mesh->morphNormals[v*count*3];
+
+            for (int t = 0; t < count; t++)
+            {
+                if (weights[t] == 0.0f) continue;
+                for (int k = 0; k < 3; k++) normal[k] += delta[t*3 + k]*weights[t];
             }
+        }
+
+        memcpy(&mesh->animNormals[v*3], normal, 3*sizeof(float));
+    }
+}
+
+// Set model meshes morph weights, weights stored by mesh in meshes order (morphCount weights by mesh)
+// NOTE: Meshes skinned on CPU are morphed by skinning (skinning required), weights are only stored in that case
+static void SetModelMorphWeights(Model model, const float *weights, int count, bool skinning)
+{
+    int offset = 0;
+
+    for (int m = 0; (m < model.meshCount) && (offset < count); m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+        if (mesh->morphCount == 0) continue;
+        if ((offset + mesh->morphCount) > count) break;
+
+        if (skinning && (mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (mesh->animVertices != NULL) &&
+            (mesh->morphTextureId == 0)) memcpy(mesh->morphWeights, weights + offset, mesh->morphCount*sizeof(float));
+        else SetMeshMorphWeights(mesh, weights + offset, mesh->morphCount);
+
+        offset += mesh->morphCount;
+    }
+}
+
+// Load GPU skinning default shader (if not loaded)
+// NOTE: Shader is equivalent to rlgl default shader, vertex position is skinned by up to 4 bones
+static bool LoadShaderSkinning(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((skinningShader.id > 0) || skinningShaderFailed) return (skinningShader.id > 0);
+
+    #define SKINNING_STRINGIFY(x) #x
+    #define SKINNING_TOSTRING(x) SKINNING_STRINGIFY(x)
+
+    // Vertex shader directly defined, no external file required
+    const char *skinningVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 boneMatrices[" SKINNING_TOSTRING(MAX_MESH_BONE_MATRICES) "]; \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 position = vec4(vertexPosition, 1.0); \n"
+    "    vec4 skinnedPosition = vertexBoneWeights.x*(boneMatrices[int(vertexBoneIds.x)]*position) + \n"
+    "        vertexBoneWeights.y*(boneMatrices[int(vertexBoneIds.y)]*position) + \n"
+    "        vertexBoneWeights.z*(boneMatrices[int(vertexBoneIds.z)]*position) + \n"
+    "        vertexBoneWeights.w*(boneMatrices[int(vertexBoneIds.w)]*position); \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(skinnedPosition.xyz, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *skinningFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Failed shader compilation returns default shader, CPU skinning is used in that case
+    Shader shader = LoadShaderFromMemory(skinningVShaderCode, skinningFShaderCode);
+
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()) && (shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        skinningShader = shader;
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] GPU skinning shader loaded successfully (%i bones max)", skinningShader.id, MAX_MESH_BONE_MATRICES);
+    }
+    else
+    {
+        if (shader.id != rlGetShaderIdDefault()) UnloadShader(shader);
+        skinningShaderFailed = true;
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load GPU skinning shader, CPU skinning used");
+    }
+
+    return (skinningShader.id > 0);
+#else
+    return false;
+#endif
+}
+
+// Load shadow map framebuffers and depth textures (cascades side by side)
+// NOTE: Static casters cache requires framebuffers blit (OpenGL 3.3), static casters are drawn every update otherwise
+static void LoadShadowMapBuffers(ShadowMap *shadow)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((shadow->size <= 2*SHADOW_CASCADE_MARGIN) || !LoadShaderShadow())
+    {
+        TRACELOG(LOG_WARNING, "SHADOW: Failed to load shadow map");
+        return;
+    }
+
+    int width = shadow->size*shadow->cascadeCount;
+    bool cached = ((rlGetVersion() == RL_OPENGL_33) || (rlGetVersion() == RL_OPENGL_43));
+
+    for (int i = 0; i < (cached? 2 : 1); i++)
+    {
+        unsigned int id = rlLoadFramebuffer(width, shadow->size);
+        Texture2D depth = { 0 };
+
+        if (id > 0)
+        {
+            rlEnableFramebuffer(id);
+
+            depth.id = rlLoadTextureDepth(width, shadow->size, false);
+            depth.width = width;
+            depth.height = shadow->size;
+            depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+            depth.mipmaps = 1;
+
+            rlFramebufferAttach(id, depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
 
-            if (attrib.num_normals > 0)
+            if (!rlFramebufferComplete(id))
             {
-                // Fill normals buffer (float) using vertex index of the face
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
+                rlUnloadFramebuffer(id);
+                id = 0;
+                depth = (Texture2D){ 0 };
             }
+
+            rlDisableFramebuffer();
         }
 
-        // Init model materials
-        ProcessMaterialsOBJ(model.materials, materials, materialCount);
+        if (i == 0)
+        {
+            shadow->id = id;
+            shadow->depth = depth;
+        }
+        else
+        {
+            shadow->cacheId = id;
+            shadow->cacheDepth = depth;
+        }
+    }
 
-        tinyobj_attrib_free(&attrib);
-        tinyobj_shapes_free(meshes, meshCount);
-        tinyobj_materials_free(materials, materialCount);
+    if (shadow->id > 0) TRACELOG(LOG_INFO, "SHADOW: [ID %i] Shadow map loaded successfully (%i cascades, %ix%i, %s)", shadow->id,
+        shadow->cascadeCount, shadow->size, shadow->size, (shadow->cacheId > 0)? "static casters cached" : "static casters not cached");
+    else TRACELOG(LOG_WARNING, "SHADOW: Failed to load shadow map framebuffer");
+#endif
+}
 
-        UnloadFileText(fileText);
+// Load shadow casters depth shaders (if not loaded)
+// NOTE: Instancing depth shader is used by instanced draws and queued meshes (BeginMeshQueue())
+static bool LoadShaderShadow(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shadowShader.id > 0) return true;
+
+    const char *shadowVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *shadowInstancingVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute mat4 instanceTransform;  \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in mat4 instanceTransform;         \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute mat4 instanceTransform;  \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Color output not used, shadow map framebuffer has only depth attachment
+    const char *shadowFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = vec4(1.0);      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = vec4(1.0);        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = vec4(1.0);      \n"
+    "}                                  \n";
+#endif
 
-        RL_FREE(matFaces);
-        RL_FREE(vCount);
-        RL_FREE(vtCount);
-        RL_FREE(vnCount);
-        RL_FREE(faceCount);
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(shadowVShaderCode, shadowFShaderCode);
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault())) shadowShader = shader;
+    else return false;
 
-        if (CHDIR(currentDir) != 0)
+    shader = LoadShaderFromMemory(shadowInstancingVShaderCode, shadowFShaderCode);
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()) && (shader.locs[SHADER_LOC_INSTANCE_TRANSFORM] != -1)) shadowShaderInstancing = shader;
+
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Shadow casters depth shader loaded successfully", shadowShader.id);
+#endif
+    return (shadowShader.id > 0);
+}
+
+// Get clusters tiles range covered by normalized screen range [-1..1], false if range is out of screen
+static bool GetLightClustersTiles(float min, float max, int tiles, int *first, int *last)
+{
+    if ((max < -1.0f) || (min > 1.0f)) return false;
+
+    *first = (int)floorf((min*0.5f + 0.5f)*tiles);
+    *last = (int)floorf((max*0.5f + 0.5f)*tiles);
+
+    if (*first < 0) *first = 0;
+    if (*last > (tiles - 1)) *last = tiles - 1;
+
+    return (*first <= *last);
+}
+
+// Sort billboards back-to-front by view depth, returns sort keys in drawing order (billboardsKeys)
+// NOTE: Keys are computed and sorted in chunks in parallel by jobs system (if initialized), chunks are merged
+static const BillboardSortKey *SortBillboards(const BillboardInstance *items, int count, Vector3 position, Vector3 forward)
+{
+    BillboardsSortJob job = { items, billboardsKeys, count, count, position, forward };
+
+    int chunkCount = GetJobThreadCount()*4;
+    if (chunkCount > 1) job.chunkSize = (count + chunkCount - 1)/chunkCount;
+    chunkCount = (count + job.chunkSize - 1)/job.chunkSize;
+
+    JobParallelFor(count, ComputeBillboardsSortKeys, &job);
+    JobParallelFor(chunkCount, SortBillboardsChunks, &job);
+
+    // Sorted chunks merged by pairs (bottom-up), keys switch between two arrays
+    BillboardSortKey *src = billboardsKeys;
+    BillboardSortKey *dst = billboardsKeys + billboardsCapacity;
+
+    for (int width = job.chunkSize; width < count; width *= 2)
+    {
+        for (int start = 0; start < count; start += width*2)
         {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+            int middle = (start + width < count)? start + width : count;
+            int end = (start + width*2 < count)? start + width*2 : count;
+            int i = start, j = middle, k = start;
+
+            while ((i < middle) && (j < end)) dst[k++] = (CompareBillboardSortKeys(&src[j], &src[i]) < 0)? src[j++] : src[i++];
+            while (i < middle) dst[k++] = src[i++];
+            while (j < end) dst[k++] = src[j++];
         }
+
+        BillboardSortKey *keys = src;
+        src = dst;
+        dst = keys;
     }
 
-    return model;
+    return src;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_IQM)
-// Load IQM mesh data
-static Model LoadIQM(const char *fileName)
+// Compute billboards range [start, end) sort keys (view depth), jobs system callback
+static void ComputeBillboardsSortKeys(int start, int end, void *userData)
 {
-    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
-    #define IQM_VERSION          2          // only IQM version 2 supported
+    BillboardsSortJob *job = (BillboardsSortJob *)userData;
 
-    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
-    #define MESH_NAME_LENGTH    32          // Mesh name string length
-    #define MATERIAL_NAME_LENGTH 32         // Material name string length
+    for (int i = start; i < end; i++)
+    {
+        job->keys[i].depth = Vector3DotProduct(Vector3Subtract(job->items[i].position, job->position), job->forward);
+        job->keys[i].index = i;
+    }
+}
 
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+// Sort billboards sort keys chunks range [start, end), jobs system callback
+static void SortBillboardsChunks(int start, int end, void *userData)
+{
+    BillboardsSortJob *job = (BillboardsSortJob *)userData;
 
-    // IQM file structs
-    //-----------------------------------------------------------------------------------
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    for (int c = start; c < end; c++)
+    {
+        int first = c*job->chunkSize;
+        int count = (first + job->chunkSize < job->count)? job->chunkSize : job->count - first;
 
-    typedef struct IQMMesh {
-        unsigned int name;
-        unsigned int material;
-        unsigned int first_vertex, num_vertexes;
-        unsigned int first_triangle, num_triangles;
-    } IQMMesh;
+        qsort(&job->keys[first], count, sizeof(BillboardSortKey), CompareBillboardSortKeys);
+    }
+}
 
-    typedef struct IQMTriangle {
-        unsigned int vertex[3];
-    } IQMTriangle;
+// Compare billboards sort keys (farthest first, items order on same depth), qsort() callback
+static int CompareBillboardSortKeys(const void *a, const void *b)
+{
+    const BillboardSortKey *keyA = (const BillboardSortKey *)a;
+    const BillboardSortKey *keyB = (const BillboardSortKey *)b;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    if (keyA->depth > keyB->depth) return -1;
+    if (keyA->depth < keyB->depth) return 1;
 
-    typedef struct IQMVertexArray {
-        unsigned int type;
-        unsigned int flags;
-        unsigned int format;
-        unsigned int size;
-        unsigned int offset;
-    } IQMVertexArray;
+    return (keyA->index - keyB->index);
+}
 
-    // NOTE: Below IQM structures are not used but listed for reference
-    /*
-    typedef struct IQMAdjacency {
-        unsigned int triangle[3];
-    } IQMAdjacency;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load billboards batch instancing shader and quad vertex data (if not loaded)
+// NOTE: Billboards quads are expanded by vertex shader from instances data, facing camera right and up vectors
+static bool LoadShaderBillboards(void)
+{
+    if ((billboardsShader.id > 0) || billboardsShaderFailed) return (billboardsShader.id > 0);
+
+    billboardsShaderFailed = true;
+    if (!rlIsInstancingSupported()) return false;
+
+    const char *billboardsVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instancePosition;   \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec2 instanceSize;       \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instancePosition;          \n"
+    "in vec4 instanceSource;            \n"
+    "in vec2 instanceSize;              \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instancePosition;   \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec2 instanceSize;       \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec3 cameraRight;          \n"
+    "uniform vec3 cameraUp;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 corner = vertexPosition*instanceSize; \n"
+    "    float s = sin(instancePosition.w); \n"
+    "    float c = cos(instancePosition.w); \n"
+    "    vec2 rotated = vec2(corner.x*c - corner.y*s, corner.x*s + corner.y*c); \n"
+    "    vec3 position = instancePosition.xyz + cameraRight*rotated.x + cameraUp*rotated.y; \n"
+    "    fragTexCoord = vec2(mix(instanceSource.x, instanceSource.z, vertexPosition.x + 0.5), mix(instanceSource.w, instanceSource.y, vertexPosition.y + 0.5)); \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(position, 1.0); \n"
+    "}                                  \n";
+
+    const char *billboardsFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "uniform sampler2D texture0;        \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(billboardsVShaderCode, billboardsFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+    billboardsLocs[0] = rlGetLocationAttrib(shader.id, "instancePosition");
+    billboardsLocs[1] = rlGetLocationAttrib(shader.id, "instanceSource");
+    billboardsLocs[2] = rlGetLocationAttrib(shader.id, "instanceSize");
+    billboardsLocs[3] = rlGetLocationUniform(shader.id, "cameraRight");
+    billboardsLocs[4] = rlGetLocationUniform(shader.id, "cameraUp");
 
-    typedef struct IQMBounds {
-        float bbmin[3], bbmax[3];
-        float xyradius, radius;
-    } IQMBounds;
-    */
-    //-----------------------------------------------------------------------------------
+    bool ready = (shader.locs[SHADER_LOC_VERTEX_POSITION] != -1) && (shader.locs[SHADER_LOC_INSTANCE_COLOR] != -1) && (shader.locs[SHADER_LOC_MATRIX_MVP] != -1);
+    for (int i = 0; i < 5; i++) if (billboardsLocs[i] == -1) ready = false;
 
-    // IQM vertex data types
-    enum {
-        IQM_POSITION     = 0,
-        IQM_TEXCOORD     = 1,
-        IQM_NORMAL       = 2,
-        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
-        IQM_BLENDINDEXES = 4,
-        IQM_BLENDWEIGHTS = 5,
-        IQM_COLOR        = 6,
-        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
-    };
+    if (!ready)
+    {
+        UnloadShader(shader);
+        return false;
+    }
 
-    Model model = { 0 };
+    // Quad corners, two triangles: top-left, bottom-left, bottom-right and top-left, bottom-right, top-right
+    const float corners[12] = { -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f };
 
-    IQMMesh *imesh = NULL;
-    IQMTriangle *tri = NULL;
-    IQMVertexArray *va = NULL;
-    IQMJoint *ijoint = NULL;
+    billboardsVaoId = rlLoadVertexArray();
+    rlEnableVertexArray(billboardsVaoId);
+    billboardsVboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
 
-    float *vertex = NULL;
-    float *normal = NULL;
-    float *text = NULL;
-    char *blendi = NULL;
-    unsigned char *blendw = NULL;
-    unsigned char *color = NULL;
+    billboardsShader = shader;
+    billboardsShaderFailed = false;
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return model;
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Billboards instancing shader loaded successfully", billboardsShader.id);
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    return true;
+}
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+// Draw billboards batch instances (billboardsInstances), billboards quads expanded on GPU
+// NOTE: Render batch is drawn first to keep drawing order, instances buffer storage is orphaned on every draw
+static void DrawBillboardsInstanced(Texture2D texture, Vector3 right, Vector3 up, int count)
+{
+    rlDrawRenderBatchActive();
+
+    int size = count*BILLBOARD_INSTANCE_FLOATS*sizeof(float);
+    if (billboardsInstancesId == 0) billboardsInstancesId = rlLoadVertexBuffer(NULL, size, true);
+    else rlResizeVertexBuffer(billboardsInstancesId, size, true);
+    rlUpdateVertexBuffer(billboardsInstancesId, billboardsInstances, size, 0);
+
+    Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix matProjection = rlGetMatrixProjection();
+    int positionLoc = billboardsShader.locs[SHADER_LOC_VERTEX_POSITION];
+    int colorLoc = billboardsShader.locs[SHADER_LOC_INSTANCE_COLOR];
+    int stride = BILLBOARD_INSTANCE_FLOATS*sizeof(float);
+
+    rlEnableShader(billboardsShader.id);
+    rlSetUniform(billboardsLocs[3], &right, SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(billboardsLocs[4], &up, SHADER_UNIFORM_VEC3, 1);
+
+    rlActiveTextureSlot(0);
+    rlEnableTexture(texture.id);
+
+    // Quad corners attached again if VAO not supported
+    if (!rlEnableVertexArray(billboardsVaoId))
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return model;
+        rlEnableVertexBuffer(billboardsVboId);
+        rlSetVertexAttribute(positionLoc, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(positionLoc);
     }
 
-    if (iqmHeader->version != IQM_VERSION)
+    // Instances attributes: position and rotation, source texcoords, size and tint
+    rlEnableVertexBuffer(billboardsInstancesId);
+    rlSetVertexAttribute(billboardsLocs[0], 4, RL_FLOAT, 0, stride, 0);
+    rlSetVertexAttribute(billboardsLocs[1], 4, RL_FLOAT, 0, stride, (void *)(4*sizeof(float)));
+    rlSetVertexAttribute(billboardsLocs[2], 2, RL_FLOAT, 0, stride, (void *)(8*sizeof(float)));
+    rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, 1, stride, (void *)(11*sizeof(float)));
+
+    int instanceLocs[4] = { billboardsLocs[0], billboardsLocs[1], billboardsLocs[2], colorLoc };
+    for (int i = 0; i < 4; i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return model;
+        rlEnableVertexAttribute(instanceLocs[i]);
+        rlSetVertexAttributeDivisor(instanceLocs[i], 1);
     }
 
-    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    // Meshes data processing
-    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
-    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
-    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
-    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        if (eyeCount == 1) rlSetUniformMatrix(billboardsShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, matProjection));
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            rlSetUniformMatrix(billboardsShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye)));
+        }
+
+        rlDrawVertexArrayInstanced(0, 6, count);
+    }
+
+    // Instances attributes detached, VAO keeps them attached to current instances buffer
+    if (billboardsVaoId == 0)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            rlSetVertexAttributeDivisor(instanceLocs[i], 0);
+            rlDisableVertexAttribute(instanceLocs[i]);
+        }
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_43)
+// Load particle system GPU buffers and shaders (compute shaders required)
+// NOTE: Shaders and buffers are loaded by particle system, loaded ones unloaded on failure
+static bool LoadParticleSystemGpu(ParticleSystemData *data, int maxParticles)
+{
+    // Particles update compute shader: particles aged and moved, alive particles compacted into target buffer
+    static const char *updateShaderCode =
+    "#version 430                                       \n"
+    "layout(local_size_x = 64) in;                      \n"
+    "struct Particle { vec4 position; vec4 velocity; }; \n"
+    "layout(std430, binding = 0) readonly buffer Source { Particle source[]; };     \n"
+    "layout(std430, binding = 1) writeonly buffer Target { Particle target[]; };    \n"
+    "layout(std430, binding = 2) readonly buffer SourceArgs { uint count; uint instanceCount; uint first; uint baseInstance; } sourceArgs; \n"
+    "layout(std430, binding = 3) buffer TargetArgs { uint count; uint instanceCount; uint first; uint baseInstance; } targetArgs; \n"
+    "uniform vec3 gravity;                              \n"
+    "uniform float deltaTime;                           \n"
+    "void main()                                        \n"
+    "{                                                  \n"
+    "    uint id = gl_GlobalInvocationID.x;             \n"
+    "    if (id >= sourceArgs.instanceCount) return;    \n"
+    "    Particle particle = source[id];                \n"
+    "    particle.position.w += deltaTime;              \n"
+    "    if (particle.position.w >= particle.velocity.w) return;    \n"
+    "    particle.velocity.xyz += gravity*deltaTime;    \n"
+    "    particle.position.xyz += particle.velocity.xyz*deltaTime;  \n"
+    "    uint index = atomicAdd(targetArgs.instanceCount, 1u);      \n"
+    "    target[index] = particle;                      \n"
+    "}                                                  \n";
+
+    // Particles spawn compute shader: new particles appended to target buffer, slots over maxParticles released
+    static const char *spawnShaderCode =
+    "#version 430                                       \n"
+    "layout(local_size_x = 64) in;                      \n"
+    "struct Particle { vec4 position; vec4 velocity; }; \n"
+    "layout(std430, binding = 1) writeonly buffer Target { Particle target[]; };    \n"
+    "layout(std430, binding = 3) buffer TargetArgs { uint count; uint instanceCount; uint first; uint baseInstance; } targetArgs; \n"
+    "uniform vec3 position;                             \n"
+    "uniform vec3 spread;                               \n"
+    "uniform vec3 velocity;                             \n"
+    "uniform vec3 velocityRandom;                       \n"
+    "uniform vec2 lifetime;                             \n"
+    "uniform int spawnCount;                            \n"
+    "uniform int maxParticles;                          \n"
+    "uniform int seed;                                  \n"
+    "uint Hash(uint x)                                  \n"
+    "{                                                  \n"
+    "    x ^= x >> 16; x *= 0x7feb352du; x ^= x >> 15; x *= 0x846ca68bu; x ^= x >> 16; \n"
+    "    return x;                                      \n"
+    "}                                                  \n"
+    "float Random(inout uint state)                     \n"
+    "{                                                  \n"
+    "    state = Hash(state);                           \n"
+    "    return float(state >> 8)/16777216.0;           \n"
+    "}                                                  \n"
+    "vec3 RandomSigned(inout uint state)                \n"
+    "{                                                  \n"
+    "    float x = Random(state);                       \n"
+    "    float y = Random(state);                       \n"
+    "    float z = Random(state);                       \n"
+    "    return vec3(x, y, z)*2.0 - 1.0;                \n"
+    "}                                                  \n"
+    "void main()                                        \n"
+    "{                                                  \n"
+    "    uint id = gl_GlobalInvocationID.x;             \n"
+    "    if (id >= uint(spawnCount)) return;            \n"
+    "    uint index = atomicAdd(targetArgs.instanceCount, 1u);      \n"
+    "    if (index >= uint(maxParticles)) { atomicAdd(targetArgs.instanceCount, 0xffffffffu); return; } \n"
+    "    uint state = Hash(uint(seed) ^ Hash(id));      \n"
+    "    Particle particle;                             \n"
+    "    particle.position = vec4(position + RandomSigned(state)*spread, 0.0); \n"
+    "    particle.velocity.xyz = velocity + RandomSigned(state)*velocityRandom; \n"
+    "    particle.velocity.w = mix(lifetime.x, lifetime.y, Random(state));     \n"
+    "    target[index] = particle;                      \n"
+    "}                                                  \n";
+
+    // Particles drawing shaders: quad corners from vertex id, particle from instance id
+    static const char *drawVShaderCode =
+    "#version 430                                       \n"
+    "struct Particle { vec4 position; vec4 velocity; }; \n"
+    "layout(std430, binding = 0) readonly buffer Particles { Particle particles[]; }; \n"
+    "uniform mat4 mvp;                                  \n"
+    "uniform vec3 cameraRight;                          \n"
+    "uniform vec3 cameraUp;                             \n"
+    "uniform vec2 size;                                 \n"
+    "uniform vec4 colorStart;                           \n"
+    "uniform vec4 colorEnd;                             \n"
+    "out vec2 fragTexCoord;                             \n"
+    "out vec4 fragColor;                                \n"
+    "const vec2 corners[6] = vec2[6](vec2(-0.5, 0.5), vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(-0.5, 0.5), vec2(0.5, -0.5), vec2(0.5, 0.5)); \n"
+    "void main()                                        \n"
+    "{                                                  \n"
+    "    Particle particle = particles[gl_InstanceID];  \n"
+    "    float t = clamp(particle.position.w/max(particle.velocity.w, 0.0001), 0.0, 1.0); \n"
+    "    vec2 corner = corners[gl_VertexID];            \n"
+    "    vec3 position = particle.position.xyz + (cameraRight*corner.x + cameraUp*corner.y)*mix(size.x, size.y, t); \n"
+    "    fragTexCoord = vec2(corner.x + 0.5, 0.5 - corner.y); \n"
+    "    fragColor = mix(colorStart, colorEnd, t);      \n"
+    "    gl_Position = mvp*vec4(position, 1.0);         \n"
+    "}                                                  \n";
+
+    static const char *drawFShaderCode =
+    "#version 430                                       \n"
+    "in vec2 fragTexCoord;                              \n"
+    "in vec4 fragColor;                                 \n"
+    "uniform sampler2D texture0;                        \n"
+    "out vec4 finalColor;                               \n"
+    "void main()                                        \n"
+    "{                                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                                  \n";
+
+    unsigned int updateShader = rlCompileShader(updateShaderCode, RL_COMPUTE_SHADER);
+    if (updateShader > 0) data->updateShaderId = rlLoadComputeShaderProgram(updateShader);
+    unsigned int spawnShader = rlCompileShader(spawnShaderCode, RL_COMPUTE_SHADER);
+    if (spawnShader > 0) data->spawnShaderId = rlLoadComputeShaderProgram(spawnShader);
+
+    if ((data->updateShaderId > 0) && (data->spawnShaderId > 0))
+    {
+        // NOTE: Failed shader loading returns default shader
+        data->drawShaderId = rlLoadShaderCode(drawVShaderCode, drawFShaderCode);
+        if (data->drawShaderId == rlGetShaderIdDefault()) data->drawShaderId = 0;
+    }
+
+    if (data->drawShaderId == 0)
+    {
+        UnloadParticleSystemGpu(data);
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load GPU particles shaders, CPU simulation used");
+        return false;
+    }
+
+    unsigned int args[4] = { 6, 0, 0, 0 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        data->particlesIds[i] = rlLoadShaderBuffer(maxParticles*sizeof(ParticleState), NULL, RL_DYNAMIC_COPY);
+        data->argsIds[i] = rlLoadShaderBuffer(sizeof(args), args, RL_DYNAMIC_COPY);
+    }
+
+    data->vaoId = rlLoadVertexArray();
+
+    return true;
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_43)
+// Unload particle system GPU buffers and shaders (loaded ones)
+static void UnloadParticleSystemGpu(ParticleSystemData *data)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (data->particlesIds[i] > 0) rlUnloadShaderBuffer(data->particlesIds[i]);
+        if (data->argsIds[i] > 0) rlUnloadShaderBuffer(data->argsIds[i]);
+        data->particlesIds[i] = 0;
+        data->argsIds[i] = 0;
+    }
+
+    if (data->updateShaderId > 0) rlUnloadShaderProgram(data->updateShaderId);
+    if (data->spawnShaderId > 0) rlUnloadShaderProgram(data->spawnShaderId);
+    if (data->drawShaderId > 0) rlUnloadShaderProgram(data->drawShaderId);
+    if (data->vaoId > 0) rlUnloadVertexArray(data->vaoId);
+
+    data->updateShaderId = 0;
+    data->spawnShaderId = 0;
+    data->drawShaderId = 0;
+    data->vaoId = 0;
+}
+#endif
+
+// Get particles random value in [0..1) range (xorshift)
+static float GetParticleRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return (float)(x >> 8)/16777216.0f;
+}
+
+#if defined(RMODELS_SHAPES_CACHE)
+// Load shapes instancing shader (if not loaded), shapes draws callback registered
+// NOTE: Shader is equivalent to rlgl default shader drawing shapes (default texture), color and transform by instance
+static bool LoadShaderShapes(void)
+{
+    if ((shapesShader.id > 0) || shapesShaderFailed) return (shapesShader.id > 0);
+
+    shapesShaderFailed = true;
+    if (!rlIsInstancingSupported()) return false;
+
+    const char *shapesVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "attribute mat4 instanceTransform;  \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec4 instanceColor;             \n"
+    "in mat4 instanceTransform;         \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "attribute mat4 instanceTransform;  \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *shapesFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(shapesVShaderCode, shapesFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
+
+    if ((shader.locs[SHADER_LOC_VERTEX_POSITION] == -1) || (shader.locs[SHADER_LOC_INSTANCE_COLOR] == -1) ||
+        (shader.locs[SHADER_LOC_INSTANCE_TRANSFORM] == -1) || (shader.locs[SHADER_LOC_MATRIX_MVP] == -1))
+    {
+        UnloadShader(shader);
+        return false;
+    }
 
-    model.meshCount = iqmHeader->num_meshes;
-    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+    shapesShader = shader;
+    shapesShaderFailed = false;
 
-    model.materialCount = model.meshCount;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    // Pending shapes draws are drawn before default render batch vertex data
+    rlSetRenderBatchCallback(DrawShapeMeshes);
 
-    char name[MESH_NAME_LENGTH] = { 0 };
-    char material[MATERIAL_NAME_LENGTH] = { 0 };
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Shapes instancing shader loaded successfully", shapesShader.id);
 
-    for (int i = 0; i < model.meshCount; i++)
+    return true;
+}
+
+// Load shape unit mesh into shapes cache, returns mesh index
+// NOTE: Shapes must be tessellated into render batch (-1 returned) if mesh draws can not replace
+// batch vertex data (custom batch or shader, recording, sorted batch) or shapes cache is full
+static int LoadShapeMesh(int type, int rings, int slices, float radiusTop, float radiusBottom)
+{
+    if (!rlIsRenderBatchDefault() || !LoadShaderShapes()) return -1;
+
+    for (int i = 0; i < shapeMeshCount; i++)
     {
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
-        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
-        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+        const ShapeMesh *mesh = &shapeMeshes[i];
 
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
-        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
-        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+        if ((mesh->type == type) && (mesh->rings == rings) && (mesh->slices == slices) &&
+            (mesh->radiusTop == radiusTop) && (mesh->radiusBottom == radiusBottom)) return i;
+    }
 
-        model.materials[i] = LoadMaterialDefault();
+    if (shapeMeshCount >= SHAPES_CACHE_MAX_MESHES) return -1;
 
-        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+    int vertexCount = GenShapeMeshVertices(type, rings, slices, radiusTop, radiusBottom, NULL);
+    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+    if (vertices == NULL) return -1;
 
-        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+    GenShapeMeshVertices(type, rings, slices, radiusTop, radiusBottom, vertices);
 
-        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
-        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
-        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+    ShapeMesh mesh = { type, rings, slices, radiusTop, radiusBottom };
+    mesh.lines = ((type == SHAPE_MESH_CUBE_WIRES) || (type == SHAPE_MESH_SPHERE_WIRES) ||
+                  (type == SHAPE_MESH_CYLINDER_WIRES) || (type == SHAPE_MESH_CYLINDER_EX_WIRES));
+    mesh.vertexCount = vertexCount;
 
-        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
-        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+    // Vertex positions attached to VAO (if supported), instances attributes are attached on drawing
+    mesh.vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(mesh.vaoId);
+    mesh.vboId = rlLoadVertexBuffer(vertices, vertexCount*sizeof(Vector3), false);
+    rlSetVertexAttribute(shapesShader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(shapesShader.locs[SHADER_LOC_VERTEX_POSITION]);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
 
-        model.meshes[i].triangleCount = imesh[i].num_triangles;
-        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+    RL_FREE(vertices);
 
-        // Animated verted data, what we actually process for rendering
-        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
-        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+    if (mesh.vboId == 0)
+    {
+        rlUnloadVertexArray(mesh.vaoId);
+        return -1;
     }
 
-    // Triangles data processing
-    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
-    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
-    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
-    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+    shapeMeshes[shapeMeshCount] = mesh;
+    shapeMeshCount++;
 
-    for (int m = 0; m < model.meshCount; m++)
-    {
-        int tcounter = 0;
+    return (shapeMeshCount - 1);
+}
 
-        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
-        {
-            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
-            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
-            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
-            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
-            tcounter += 3;
-        }
-    }
+// Generate shape unit mesh vertices, returns vertex count (vertices not written if NULL)
+// NOTE: Vertices match shapes tessellation into render batch (same order and winding),
+// transformed by shape transform they provide the tessellated shape vertices
+static int GenShapeMeshVertices(int type, int rings, int slices, float radiusTop, float radiusBottom, Vector3 *vertices)
+{
+    int count = 0;
 
-    // Vertex arrays data processing
-    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
-    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
-    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
-    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    #define SHAPE_VERTEX(px, py, pz) { if (vertices != NULL) vertices[count] = (Vector3){ (px), (py), (pz) }; count++; }
+    #define SPHERE_VERTEX(i, j) SHAPE_VERTEX(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*sinf(DEG2RAD*(360.0f*(j)/slices)), \
+        sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i))), cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*cosf(DEG2RAD*(360.0f*(j)/slices)))
+    #define CAPSULE_VERTEX(i, j) SHAPE_VERTEX(sinf(baseSliceAngle*(j))*cosf(baseRingAngle*(i)), sinf(baseRingAngle*(i)), \
+        cosf(baseSliceAngle*(j))*cosf(baseRingAngle*(i)))
 
-    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    float baseSliceAngle = (2.0f*PI)/slices;
+    float baseRingAngle = (rings > 0)? (PI*0.5f/rings) : 0.0f;
+
+    switch (type)
     {
-        switch (va[i].type)
+        case SHAPE_MESH_CUBE:
         {
-            case IQM_POSITION:
+            // Front, back, top, bottom, right and left faces
+            SHAPE_VERTEX(-0.5f, -0.5f, 0.5f); SHAPE_VERTEX(0.5f, -0.5f, 0.5f); SHAPE_VERTEX(-0.5f, 0.5f, 0.5f);
+            SHAPE_VERTEX(0.5f, 0.5f, 0.5f); SHAPE_VERTEX(-0.5f, 0.5f, 0.5f); SHAPE_VERTEX(0.5f, -0.5f, 0.5f);
+            SHAPE_VERTEX(-0.5f, -0.5f, -0.5f); SHAPE_VERTEX(-0.5f, 0.5f, -0.5f); SHAPE_VERTEX(0.5f, -0.5f, -0.5f);
+            SHAPE_VERTEX(0.5f, 0.5f, -0.5f); SHAPE_VERTEX(0.5f, -0.5f, -0.5f); SHAPE_VERTEX(-0.5f, 0.5f, -0.5f);
+            SHAPE_VERTEX(-0.5f, 0.5f, -0.5f); SHAPE_VERTEX(-0.5f, 0.5f, 0.5f); SHAPE_VERTEX(0.5f, 0.5f, 0.5f);
+            SHAPE_VERTEX(0.5f, 0.5f, -0.5f); SHAPE_VERTEX(-0.5f, 0.5f, -0.5f); SHAPE_VERTEX(0.5f, 0.5f, 0.5f);
+            SHAPE_VERTEX(-0.5f, -0.5f, -0.5f); SHAPE_VERTEX(0.5f, -0.5f, 0.5f); SHAPE_VERTEX(-0.5f, -0.5f, 0.5f);
+            SHAPE_VERTEX(0.5f, -0.5f, -0.5f); SHAPE_VERTEX(0.5f, -0.5f, 0.5f); SHAPE_VERTEX(-0.5f, -0.5f, -0.5f);
+            SHAPE_VERTEX(0.5f, -0.5f, -0.5f); SHAPE_VERTEX(0.5f, 0.5f, -0.5f); SHAPE_VERTEX(0.5f, 0.5f, 0.5f);
+            SHAPE_VERTEX(0.5f, -0.5f, 0.5f); SHAPE_VERTEX(0.5f, -0.5f, -0.5f); SHAPE_VERTEX(0.5f, 0.5f, 0.5f);
+            SHAPE_VERTEX(-0.5f, -0.5f, -0.5f); SHAPE_VERTEX(-0.5f, 0.5f, 0.5f); SHAPE_VERTEX(-0.5f, 0.5f, -0.5f);
+            SHAPE_VERTEX(-0.5f, -0.5f, 0.5f); SHAPE_VERTEX(-0.5f, 0.5f, 0.5f); SHAPE_VERTEX(-0.5f, -0.5f, -0.5f);
+        } break;
+        case SHAPE_MESH_CUBE_WIRES:
+        {
+            // Front and back faces lines, top and bottom faces side lines
+            for (int i = 0; i < 2; i++)
             {
-                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+                float z = (i == 0)? 0.5f : -0.5f;
+                SHAPE_VERTEX(-0.5f, -0.5f, z); SHAPE_VERTEX(0.5f, -0.5f, z);
+                SHAPE_VERTEX(0.5f, -0.5f, z); SHAPE_VERTEX(0.5f, 0.5f, z);
+                SHAPE_VERTEX(0.5f, 0.5f, z); SHAPE_VERTEX(-0.5f, 0.5f, z);
+                SHAPE_VERTEX(-0.5f, 0.5f, z); SHAPE_VERTEX(-0.5f, -0.5f, z);
+            }
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].vertices[vCounter] = vertex[i];
-                        model.meshes[m].animVertices[vCounter] = vertex[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_NORMAL:
+            for (int i = 0; i < 2; i++)
             {
-                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
-
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                float y = (i == 0)? 0.5f : -0.5f;
+                SHAPE_VERTEX(-0.5f, y, 0.5f); SHAPE_VERTEX(-0.5f, y, -0.5f);
+                SHAPE_VERTEX(0.5f, y, 0.5f); SHAPE_VERTEX(0.5f, y, -0.5f);
+            }
+        } break;
+        case SHAPE_MESH_SPHERE:
+        {
+            for (int i = 0; i < (rings + 2); i++)
+            {
+                for (int j = 0; j < slices; j++)
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].normals[vCounter] = normal[i];
-                        model.meshes[m].animNormals[vCounter] = normal[i];
-                        vCounter++;
-                    }
+                    SPHERE_VERTEX(i, j); SPHERE_VERTEX(i + 1, j + 1); SPHERE_VERTEX(i + 1, j);
+                    SPHERE_VERTEX(i, j); SPHERE_VERTEX(i, j + 1); SPHERE_VERTEX(i + 1, j + 1);
                 }
-            } break;
-            case IQM_TEXCOORD:
+            }
+        } break;
+        case SHAPE_MESH_SPHERE_WIRES:
+        {
+            for (int i = 0; i < (rings + 2); i++)
             {
-                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
-                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
-
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                for (int j = 0; j < slices; j++)
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
-                    {
-                        model.meshes[m].texcoords[vCounter] = text[i];
-                        vCounter++;
-                    }
+                    SPHERE_VERTEX(i, j); SPHERE_VERTEX(i + 1, j + 1);
+                    SPHERE_VERTEX(i + 1, j + 1); SPHERE_VERTEX(i + 1, j);
+                    SPHERE_VERTEX(i + 1, j); SPHERE_VERTEX(i, j);
                 }
-            } break;
-            case IQM_BLENDINDEXES:
-            {
-                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
-                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
+            }
+        } break;
+        case SHAPE_MESH_CYLINDER:
+        {
+            // NOTE: Sides angles step in whole degrees, as tessellated shape
+            int step = 360/slices;
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+            if (radiusTop > 0)
+            {
+                // Body and top cap
+                for (int i = 0; i < 360; i += step)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneIds[boneCounter] = blendi[i];
-                        boneCounter++;
-                    }
+                    float s0 = sinf(DEG2RAD*i), c0 = cosf(DEG2RAD*i);
+                    float s1 = sinf(DEG2RAD*(i + 360.0f/slices)), c1 = cosf(DEG2RAD*(i + 360.0f/slices));
+
+                    SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop);
+                    SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop); SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop);
                 }
-            } break;
-            case IQM_BLENDWEIGHTS:
-            {
-                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                for (int i = 0; i < 360; i += step)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
-                        boneCounter++;
-                    }
+                    SHAPE_VERTEX(0, 1, 0);
+                    SHAPE_VERTEX(sinf(DEG2RAD*i)*radiusTop, 1, cosf(DEG2RAD*i)*radiusTop);
+                    SHAPE_VERTEX(sinf(DEG2RAD*(i + 360.0f/slices))*radiusTop, 1, cosf(DEG2RAD*(i + 360.0f/slices))*radiusTop);
                 }
-            } break;
-            case IQM_COLOR:
+            }
+            else
             {
-                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
-
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                // Cone
+                for (int i = 0; i < 360; i += step)
                 {
-                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
-
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].colors[vCounter] = color[i];
-                        vCounter++;
-                    }
+                    SHAPE_VERTEX(0, 1, 0);
+                    SHAPE_VERTEX(sinf(DEG2RAD*i)*radiusBottom, 0, cosf(DEG2RAD*i)*radiusBottom);
+                    SHAPE_VERTEX(sinf(DEG2RAD*(i + 360.0f/slices))*radiusBottom, 0, cosf(DEG2RAD*(i + 360.0f/slices))*radiusBottom);
                 }
-            } break;
-        }
-    }
-
-    // Bones (joints) data processing
-    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
-    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
-    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
-
-    model.boneCount = iqmHeader->num_joints;
-    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
-    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
-
-    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
-    {
-        // Bones
-        model.bones[i].parent = ijoint[i].parent;
-        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
-        //fread(model.bones[i].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
-        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
-
-        // Bind pose (base pose)
-        model.bindPose[i].translation.x = ijoint[i].translate[0];
-        model.bindPose[i].translation.y = ijoint[i].translate[1];
-        model.bindPose[i].translation.z = ijoint[i].translate[2];
-
-        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
-        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
-        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
-        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+            }
 
-        model.bindPose[i].scale.x = ijoint[i].scale[0];
-        model.bindPose[i].scale.y = ijoint[i].scale[1];
-        model.bindPose[i].scale.z = ijoint[i].scale[2];
-    }
+            // Base
+            for (int i = 0; i < 360; i += step)
+            {
+                SHAPE_VERTEX(0, 0, 0);
+                SHAPE_VERTEX(sinf(DEG2RAD*(i + 360.0f/slices))*radiusBottom, 0, cosf(DEG2RAD*(i + 360.0f/slices))*radiusBottom);
+                SHAPE_VERTEX(sinf(DEG2RAD*i)*radiusBottom, 0, cosf(DEG2RAD*i)*radiusBottom);
+            }
+        } break;
+        case SHAPE_MESH_CYLINDER_WIRES:
+        {
+            for (int i = 0; i < 360; i += 360/slices)
+            {
+                float s0 = sinf(DEG2RAD*i), c0 = cosf(DEG2RAD*i);
+                float s1 = sinf(DEG2RAD*(i + 360.0f/slices)), c1 = cosf(DEG2RAD*(i + 360.0f/slices));
 
-    BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+                SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom);
+                SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop);
+                SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop); SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop);
+                SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop); SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom);
+            }
+        } break;
+        case SHAPE_MESH_CYLINDER_EX:
+        case SHAPE_MESH_CYLINDER_EX_WIRES:
+        {
+            // Base (bottom radius) at origin and top (top radius) at (0, 1, 0)
+            for (int i = 0; i < slices; i++)
+            {
+                float s0 = sinf(baseSliceAngle*(i + 0)), c0 = cosf(baseSliceAngle*(i + 0));
+                float s1 = sinf(baseSliceAngle*(i + 1)), c1 = cosf(baseSliceAngle*(i + 1));
 
-    RL_FREE(fileData);
+                if (type == SHAPE_MESH_CYLINDER_EX_WIRES)
+                {
+                    SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom);
+                    SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop);
+                    SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop);
+                    continue;
+                }
 
-    RL_FREE(imesh);
-    RL_FREE(tri);
-    RL_FREE(va);
-    RL_FREE(vertex);
-    RL_FREE(normal);
-    RL_FREE(text);
-    RL_FREE(blendi);
-    RL_FREE(blendw);
-    RL_FREE(ijoint);
-    RL_FREE(color);
+                if (radiusBottom > 0) { SHAPE_VERTEX(0, 0, 0); SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom); SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); }
 
-    return model;
-}
+                SHAPE_VERTEX(s0*radiusBottom, 0, c0*radiusBottom); SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom); SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop);
+                SHAPE_VERTEX(s1*radiusBottom, 0, c1*radiusBottom); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop); SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop);
 
-// Load IQM animation data
-static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
-{
-    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
-    #define IQM_VERSION     2                   // only IQM version 2 supported
+                if (radiusTop > 0) { SHAPE_VERTEX(0, 1, 0); SHAPE_VERTEX(s0*radiusTop, 1, c0*radiusTop); SHAPE_VERTEX(s1*radiusTop, 1, c1*radiusTop); }
+            }
+        } break;
+        case SHAPE_MESH_CAPSULE_CAP:
+        case SHAPE_MESH_CAPSULE_CAP_FLIPPED:
+        {
+            // Sphere cap at origin, cap pole at (0, 1, 0)
+            for (int i = 0; i < rings; i++)
+            {
+                for (int j = 0; j < slices; j++)
+                {
+                    if (type == SHAPE_MESH_CAPSULE_CAP)
+                    {
+                        CAPSULE_VERTEX(i, j); CAPSULE_VERTEX(i, j + 1); CAPSULE_VERTEX(i + 1, j);
+                        CAPSULE_VERTEX(i, j + 1); CAPSULE_VERTEX(i + 1, j + 1); CAPSULE_VERTEX(i + 1, j);
+                    }
+                    else
+                    {
+                        CAPSULE_VERTEX(i, j); CAPSULE_VERTEX(i + 1, j); CAPSULE_VERTEX(i, j + 1);
+                        CAPSULE_VERTEX(i, j + 1); CAPSULE_VERTEX(i + 1, j); CAPSULE_VERTEX(i + 1, j + 1);
+                    }
+                }
+            }
+        } break;
+        case SHAPE_MESH_CAPSULE_BODY:
+        {
+            // Body from origin to (0, 1, 0)
+            for (int j = 0; j < slices; j++)
+            {
+                float s0 = sinf(baseSliceAngle*(j + 0)), c0 = cosf(baseSliceAngle*(j + 0));
+                float s1 = sinf(baseSliceAngle*(j + 1)), c1 = cosf(baseSliceAngle*(j + 1));
 
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+                SHAPE_VERTEX(s0, 0, c0); SHAPE_VERTEX(s1, 0, c1); SHAPE_VERTEX(s0, 1, c0);
+                SHAPE_VERTEX(s1, 0, c1); SHAPE_VERTEX(s1, 1, c1); SHAPE_VERTEX(s0, 1, c0);
+            }
+        } break;
+        default: break;
+    }
 
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    #undef SHAPE_VERTEX
+    #undef SPHERE_VERTEX
+    #undef CAPSULE_VERTEX
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    return count;
+}
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+// Get shape mesh transform from basis axes and origin, unit mesh axes are mapped to basis axes
+static Matrix GetShapeMeshBasis(Vector3 x, Vector3 y, Vector3 z, Vector3 origin)
+{
+    Matrix result = {
+        x.x, y.x, z.x, origin.x,
+        x.y, y.y, z.y, origin.y,
+        x.z, y.z, z.z, origin.z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+    return result;
+}
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return NULL;
+// Add shape meshes instances to pending shapes draws, one instance by mesh (shape parts)
+// NOTE: Shapes are drawn before render batch vertex data submitted after them (render batch callback),
+// consecutive shapes with same meshes are drawn instanced, parts of opaque capsules are drawn grouped
+static void QueueShapeMeshes(const int *meshes, const Matrix *transforms, int count, Color color)
+{
+    // Vertex data submitted before shape is drawn first, after pending shapes
+    if (!rlIsRenderBatchEmpty()) rlDrawRenderBatchActive();
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    if ((shapeInstanceCount + count) > SHAPES_MAX_PENDING_INSTANCES) DrawShapeMeshes();
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    if ((shapeInstanceCount + count) > shapeInstanceCapacity)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return NULL;
+        int capacity = (shapeInstanceCapacity > 0)? shapeInstanceCapacity*2 : 256;
+        ShapeMeshInstance *instances = (ShapeMeshInstance *)RL_REALLOC(shapeInstances, capacity*sizeof(ShapeMeshInstance));
+        if (instances != NULL) shapeInstances = instances;
+        Color *colors = (Color *)RL_REALLOC(shapeColors, capacity*sizeof(Color));
+        if (colors != NULL) shapeColors = colors;
+        if ((instances == NULL) || (colors == NULL)) return;
+
+        shapeInstanceCapacity = capacity;
     }
 
-    if (iqmHeader->version != IQM_VERSION)
+    // Instances are added to previous draws if they draw same meshes
+    bool merged = (shapeDrawCount >= count);
+    for (int i = 0; merged && (i < count); i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return NULL;
+        const ShapeMeshDraw *draw = &shapeDraws[shapeDrawCount - count + i];
+        if ((draw->mesh != meshes[i]) || ((count > 1) && (!draw->opaque || (color.a < 255)))) merged = false;
     }
 
-    // Get bones data
-    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
-    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
-    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
-    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
+    if (!merged)
+    {
+        if ((shapeDrawCount + count) > shapeDrawCapacity)
+        {
+            int capacity = (shapeDrawCapacity > 0)? shapeDrawCapacity*2 : 64;
+            ShapeMeshDraw *draws = (ShapeMeshDraw *)RL_REALLOC(shapeDraws, capacity*sizeof(ShapeMeshDraw));
+            if (draws == NULL) return;
 
-    // Get animations data
-    *animCount = iqmHeader->num_anims;
-    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
-    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
-    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
-    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+            shapeDraws = draws;
+            shapeDrawCapacity = capacity;
+        }
 
-    ModelAnimation *animations = RL_MALLOC(iqmHeader->num_anims*sizeof(ModelAnimation));
+        for (int i = 0; i < count; i++) shapeDraws[shapeDrawCount++] = (ShapeMeshDraw){ meshes[i], 0, 0, true };
+    }
 
-    // frameposes
-    unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
-    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
-    //fread(framedata, sizeof(unsigned short), iqmHeader->num_frames*iqmHeader->num_framechannels, iqmFile);
-    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+    Matrix transform = rlGetMatrixTransform();
 
-    // joints
-    IQMJoint *joints = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+    for (int i = 0; i < count; i++)
+    {
+        int draw = shapeDrawCount - count + i;
+        shapeDraws[draw].count++;
+        if (color.a < 255) shapeDraws[draw].opaque = false;
 
-    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+        shapeInstances[shapeInstanceCount++] = (ShapeMeshInstance){ MatrixToFloatV(MatrixMultiply(transforms[i], transform)), color, draw };
+    }
+}
+
+// Draw pending shapes draws, called before default render batch is drawn (rlSetRenderBatchCallback())
+// NOTE: Instances are uploaded grouped by draw, draws are submitted in order with current matrices
+static void DrawShapeMeshes(void)
+{
+    if ((shapeDrawCount == 0) || shapeDrawing) return;
+
+    shapeDrawing = true;
+
+    if (LoadInstanceBufferDefault(shapeInstanceCount))
     {
-        animations[a].frameCount = anim[a].num_frames;
-        animations[a].boneCount = iqmHeader->num_poses;
-        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
-        animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
-        // animations[a].framerate = anim.framerate;     // TODO: Use framerate?
+        // Draws first instance follows previous draws instances
+        for (int i = 0, first = 0; i < shapeDrawCount; i++)
+        {
+            shapeDraws[i].first = first;
+            first += shapeDraws[i].count;
+            shapeDraws[i].count = 0;
+        }
 
-        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        for (int i = 0; i < shapeInstanceCount; i++)
         {
-            // If animations and skeleton are in the same file, copy bone names to anim
-            if (iqmHeader->num_joints > 0)
-                memcpy(animations[a].bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
-            else
-                strcpy(animations[a].bones[j].name, "ANIMJOINTNAME"); // default bone name otherwise
-            animations[a].bones[j].parent = poses[j].parent;
+            ShapeMeshDraw *draw = &shapeDraws[shapeInstances[i].draw];
+            instanceTransforms[draw->first + draw->count] = shapeInstances[i].transform;
+            shapeColors[draw->first + draw->count] = shapeInstances[i].color;
+            draw->count++;
         }
 
-        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+        rlUpdateVertexBuffer(instanceBuffer.id, instanceTransforms, shapeInstanceCount*sizeof(float16), 0);
+        UpdateMeshInstanceColors(&instanceBuffer, shapeColors, 0, shapeInstanceCount);
+
+        Matrix matView = rlGetMatrixModelview();
+        Matrix matProjection = rlGetMatrixProjection();
+        int positionLoc = shapesShader.locs[SHADER_LOC_VERTEX_POSITION];
+        int transformLoc = shapesShader.locs[SHADER_LOC_INSTANCE_TRANSFORM];
+        int colorLoc = shapesShader.locs[SHADER_LOC_INSTANCE_COLOR];
 
-        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+        rlEnableShader(shapesShader.id);
 
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        int eyeCount = 1;
+        if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+        for (int eye = 0; eye < eyeCount; eye++)
         {
-            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+            if (eyeCount == 1) rlSetUniformMatrix(shapesShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matView, matProjection));
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                rlSetUniformMatrix(shapesShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye)));
+            }
+
+            for (int i = 0; i < shapeDrawCount; i++)
             {
-                animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
+                const ShapeMeshDraw *draw = &shapeDraws[i];
+                const ShapeMesh *mesh = &shapeMeshes[draw->mesh];
 
-                if (poses[i].mask & 0x01)
+                // Vertex positions are attached again if VAO not supported
+                if (!rlEnableVertexArray(mesh->vaoId))
                 {
-                    animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
-                    dcounter++;
+                    rlEnableVertexBuffer(mesh->vboId);
+                    rlSetVertexAttribute(positionLoc, 3, RL_FLOAT, 0, 0, 0);
+                    rlEnableVertexAttribute(positionLoc);
                 }
 
-                animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
-
-                if (poses[i].mask & 0x02)
+                // Instances transforms and colors attached from draw first instance
+                rlEnableVertexBuffer(instanceBuffer.id);
+                for (unsigned int k = 0; k < 4; k++)
                 {
-                    animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
-                    dcounter++;
+                    rlEnableVertexAttribute(transformLoc + k);
+                    rlSetVertexAttribute(transformLoc + k, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(draw->first*sizeof(Matrix) + k*sizeof(Vector4)));
+                    rlSetVertexAttributeDivisor(transformLoc + k, 1);
                 }
 
-                animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
+                rlEnableVertexBuffer(instanceBuffer.colorsId);
+                rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, 1, 0, (void *)(draw->first*sizeof(Color)));
+                rlSetVertexAttributeDivisor(colorLoc, 1);
+                rlEnableVertexAttribute(colorLoc);
 
-                if (poses[i].mask & 0x04)
+                if (mesh->lines) rlDrawVertexArrayLinesInstanced(0, mesh->vertexCount, draw->count);
+                else rlDrawVertexArrayInstanced(0, mesh->vertexCount, draw->count);
+
+                // Instances attributes detached if VAO not supported, render batch uses same attributes state
+                if (mesh->vaoId == 0)
                 {
-                    animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
-                    dcounter++;
+                    for (unsigned int k = 0; k < 4; k++)
+                    {
+                        rlSetVertexAttributeDivisor(transformLoc + k, 0);
+                        rlDisableVertexAttribute(transformLoc + k);
+                    }
+
+                    rlSetVertexAttributeDivisor(colorLoc, 0);
+                    rlDisableVertexAttribute(colorLoc);
                 }
+            }
+        }
 
-                animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableShader();
+    }
 
-                if (poses[i].mask & 0x08)
-                {
-                    animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
-                    dcounter++;
-                }
+    shapeDrawCount = 0;
+    shapeInstanceCount = 0;
+    shapeDrawing = false;
+}
+#endif
 
-                animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+// Load GPU morphing default shaders (if not loaded)
+// NOTE: Shaders are equivalent to rlgl default shader, vertex position is displaced by morph targets deltas
+// fetched from morph targets texture (one tile by target), skinning shader variant skins morphed position
+static bool LoadShaderMorph(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if ((morphShader.id > 0) || morphShaderFailed) return (morphShader.id > 0);
+
+    #define MORPH_STRINGIFY(x) #x
+    #define MORPH_TOSTRING(x) MORPH_STRINGIFY(x)
+
+    // Vertex shader directly defined, no external file required
+    // NOTE: Morph targets count is the texture width in tiles, mesh vertex index is the vertex id
+    #define MORPH_VSHADER_CODE \
+    "in vec3 vertexPosition;            \n" \
+    "in vec2 vertexTexCoord;            \n" \
+    "in vec4 vertexColor;               \n" \
+    "out vec2 fragTexCoord;             \n" \
+    "out vec4 fragColor;                \n" \
+    "uniform mat4 mvp;                  \n" \
+    "uniform sampler2D morphTargets;    \n" \
+    "uniform float morphWeights[" MORPH_TOSTRING(MAX_MESH_MORPH_TARGETS) "]; \n" \
+    "#if defined(MORPH_SKINNING)        \n" \
+    "in vec4 vertexBoneIds;             \n" \
+    "in vec4 vertexBoneWeights;         \n" \
+    "uniform mat4 boneMatrices[" MORPH_TOSTRING(MAX_MESH_BONE_MATRICES) "]; \n" \
+    "#endif                             \n" \
+    "void main()                        \n" \
+    "{                                  \n" \
+    "    vec3 position = vertexPosition; \n" \
+    "    int count = textureSize(morphTargets, 0).x/" MORPH_TOSTRING(MESH_MORPH_TEXTURE_TILE) "; \n" \
+    "    ivec2 texel = ivec2((gl_VertexID*2)%" MORPH_TOSTRING(MESH_MORPH_TEXTURE_TILE) ", (gl_VertexID*2)/" MORPH_TOSTRING(MESH_MORPH_TEXTURE_TILE) "); \n" \
+    "    for (int i = 0; i < count; i++) \n" \
+    "    {                              \n" \
+    "        if (morphWeights[i] != 0.0) position += morphWeights[i]*texelFetch(morphTargets, ivec2(texel.x + i*" MORPH_TOSTRING(MESH_MORPH_TEXTURE_TILE) ", texel.y), 0).xyz; \n" \
+    "    }                              \n" \
+    "#if defined(MORPH_SKINNING)        \n" \
+    "    vec4 morphed = vec4(position, 1.0); \n" \
+    "    position = (vertexBoneWeights.x*(boneMatrices[int(vertexBoneIds.x)]*morphed) + \n" \
+    "        vertexBoneWeights.y*(boneMatrices[int(vertexBoneIds.y)]*morphed) + \n" \
+    "        vertexBoneWeights.z*(boneMatrices[int(vertexBoneIds.z)]*morphed) + \n" \
+    "        vertexBoneWeights.w*(boneMatrices[int(vertexBoneIds.w)]*morphed)).xyz; \n" \
+    "#endif                             \n" \
+    "    fragTexCoord = vertexTexCoord; \n" \
+    "    fragColor = vertexColor;       \n" \
+    "    gl_Position = mvp*vec4(position, 1.0); \n" \
+    "}                                  \n"
+
+    const char *morphVShaderCode = "#version 330\n" MORPH_VSHADER_CODE;
+    const char *morphSkinningVShaderCode = "#version 330\n#define MORPH_SKINNING\n" MORPH_VSHADER_CODE;
+
+    // Fragment shader directly defined, no external file required
+    const char *morphFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor; \n"
+    "}                                  \n";
+
+    #undef MORPH_VSHADER_CODE
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(morphVShaderCode, morphFShaderCode);
+    Shader skinning = LoadShaderFromMemory(morphSkinningVShaderCode, morphFShaderCode);
+
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()) && (shader.locs[SHADER_LOC_MORPH_WEIGHTS] != -1) &&
+        (skinning.id > 0) && (skinning.id != rlGetShaderIdDefault()) && (skinning.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        morphShader = shader;
+        morphSkinningShader = skinning;
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] GPU morphing shader loaded successfully (%i targets max)", morphShader.id, MAX_MESH_MORPH_TARGETS);
+    }
+    else
+    {
+        if (shader.id != rlGetShaderIdDefault()) UnloadShader(shader);
+        if (skinning.id != rlGetShaderIdDefault()) UnloadShader(skinning);
+        morphShaderFailed = true;
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load GPU morphing shader, morphed meshes drawn with default shader");
+    }
 
-                if (poses[i].mask & 0x10)
-                {
-                    animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
-                    dcounter++;
-                }
+    return (morphShader.id > 0);
+#else
+    return false;
+#endif
+}
 
-                animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+// Unload GPU skinning and morphing default shaders
+extern void UnloadShaderSkinning(void)
+{
+    if (skinningShader.id > 0) UnloadShader(skinningShader);
+    if (morphShader.id > 0) UnloadShader(morphShader);
+    if (morphSkinningShader.id > 0) UnloadShader(morphSkinningShader);
+
+    skinningShader = (Shader){ 0 };
+    skinningShaderFailed = false;
+    morphShader = (Shader){ 0 };
+    morphSkinningShader = (Shader){ 0 };
+    morphShaderFailed = false;
+}
 
-                if (poses[i].mask & 0x20)
-                {
-                    animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
-                    dcounter++;
-                }
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate mesh shape, uploaded to GPU
+static Mesh GenMeshShape(MeshGenParams params)
+{
+    Mesh mesh = { 0 };
 
-                animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+    // Upload vertex data to GPU (static mesh)
+    // NOTE: mesh.vboId array is allocated inside UploadMesh()
+    if (GenMeshShapeData(&mesh, params)) UploadMesh(&mesh, false);
 
-                if (poses[i].mask & 0x40)
-                {
-                    animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
-                    dcounter++;
-                }
+    return mesh;
+}
 
-                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+// Generate mesh shape vertex data (not uploaded), thread-safe
+// NOTE: Shape is generated twice, first pass counts vertices and indices to allocate mesh arrays once,
+// second pass writes vertex data directly into mesh arrays, triangles share vertices (indexed) unless
+// vertices exceed 16bit indices, triangles are expanded in that case
+static bool GenMeshShapeData(Mesh *mesh, MeshGenParams params)
+{
+    static const char *shapeNames[] = { "poly", "plane", "sphere", "hemisphere", "cylinder", "cone", "torus", "knot" };
 
-                if (poses[i].mask & 0x80)
-                {
-                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-                    dcounter++;
-                }
+    *mesh = (Mesh){ 0 };
 
-                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+    if ((params.type < MESH_GEN_POLY) || (params.type > MESH_GEN_KNOT)) return false;
 
-                if (poses[i].mask & 0x100)
-                {
-                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-                    dcounter++;
-                }
+    bool valid = false;
+
+    switch (params.type)
+    {
+        case MESH_GEN_POLY: valid = (params.resolution[0] >= 3); break;
+        case MESH_GEN_PLANE: valid = ((params.resolution[0] >= 1) && (params.resolution[1] >= 1)); break;
+        case MESH_GEN_SPHERE: valid = ((params.resolution[0] >= 3) && (params.resolution[1] >= 3)); break;
+        case MESH_GEN_HEMISPHERE:
+        {
+            valid = ((params.resolution[0] >= 3) && (params.resolution[1] >= 3));
+            if (params.params[0] < 0.0f) params.params[0] = 0.0f;
+        } break;
+        case MESH_GEN_CYLINDER:
+        case MESH_GEN_CONE: valid = (params.resolution[0] >= 3); break;
+        case MESH_GEN_TORUS:
+        {
+            valid = ((params.resolution[0] >= 3) && (params.resolution[1] >= 3));
+            params.params[0] = Clamp(params.params[0], 0.1f, 1.0f);
+        } break;
+        case MESH_GEN_KNOT:
+        {
+            valid = ((params.resolution[0] >= 3) && (params.resolution[1] >= 3));
+            params.params[0] = Clamp(params.params[0], 0.5f, 3.0f);
+        } break;
+        default: break;
+    }
 
-                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: %s", shapeNames[params.type]);
+        return false;
+    }
 
-                if (poses[i].mask & 0x200)
-                {
-                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-                    dcounter++;
-                }
+    MeshGenWriter writer = { mesh, 0, 0, NULL };
+    GenMeshShapeVertices(&writer, params);
 
-                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
-            }
-        }
+    mesh->vertices = (float *)RL_MALLOC(writer.vertexCount*3*sizeof(float));
+    mesh->normals = (float *)RL_MALLOC(writer.vertexCount*3*sizeof(float));
+    mesh->texcoords = (float *)RL_MALLOC(writer.vertexCount*2*sizeof(float));
+
+    if (writer.vertexCount <= 65535) mesh->indices = (unsigned short *)RL_MALLOC(writer.indexCount*sizeof(unsigned short));
+    else writer.wideIndices = (unsigned int *)RL_MALLOC(writer.indexCount*sizeof(unsigned int));
 
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+    writer.vertexCount = 0;
+    writer.indexCount = 0;
+    GenMeshShapeVertices(&writer, params);
+
+    mesh->vertexCount = writer.vertexCount;
+    mesh->triangleCount = writer.indexCount/3;
+
+    if (writer.wideIndices != NULL)
+    {
+        // Triangles expanded, every triangle corner gets a vertex (no indices)
+        float *vertices = (float *)RL_MALLOC(writer.indexCount*3*sizeof(float));
+        float *normals = (float *)RL_MALLOC(writer.indexCount*3*sizeof(float));
+        float *texcoords = (float *)RL_MALLOC(writer.indexCount*2*sizeof(float));
+
+        for (int k = 0; k < writer.indexCount; k++)
         {
-            for (int i = 0; i < animations[a].boneCount; i++)
-            {
-                if (animations[a].bones[i].parent >= 0)
-                {
-                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
-                }
-            }
+            unsigned int index = writer.wideIndices[k];
+            memcpy(&vertices[k*3], &mesh->vertices[index*3], 3*sizeof(float));
+            memcpy(&normals[k*3], &mesh->normals[index*3], 3*sizeof(float));
+            memcpy(&texcoords[k*2], &mesh->texcoords[index*2], 2*sizeof(float));
         }
-    }
 
-    RL_FREE(fileData);
+        RL_FREE(mesh->vertices);
+        RL_FREE(mesh->normals);
+        RL_FREE(mesh->texcoords);
+        RL_FREE(writer.wideIndices);
 
-    RL_FREE(joints);
-    RL_FREE(framedata);
-    RL_FREE(poses);
-    RL_FREE(anim);
+        mesh->vertices = vertices;
+        mesh->normals = normals;
+        mesh->texcoords = texcoords;
+        mesh->vertexCount = writer.indexCount;
+    }
 
-    return animations;
+    return true;
 }
 
-#endif
-
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-// Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+// Generate meshes range [start, end) shapes vertex data, jobs system callback
+static void GenMeshShapesJob(int start, int end, void *userData)
 {
-    Image image = { 0 };
+    MeshGenJob *job = (MeshGenJob *)userData;
 
-    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    for (int i = start; i < end; i++) GenMeshShapeData(&job->meshes[i], job->params[i]);
+}
+
+// Write mesh shape vertices and triangles (counted if mesh arrays are NULL)
+// NOTE: Shapes match the previous par_shapes generated shapes orientation and texcoords,
+// parametric surfaces use analytic normals, cylinder and cone sides use a single stack
+static void GenMeshShapeVertices(MeshGenWriter *writer, MeshGenParams params)
+{
+    switch (params.type)
     {
-        if ((strlen(cgltfImage->uri) > 5) &&
-            (cgltfImage->uri[0] == 'd') &&
-            (cgltfImage->uri[1] == 'a') &&
-            (cgltfImage->uri[2] == 't') &&
-            (cgltfImage->uri[3] == 'a') &&
-            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        case MESH_GEN_POLY: AddMeshGenDisk(writer, (Vector3){ 0.0f, 0.0f, 0.0f }, params.params[0], params.resolution[0], true, (Vector2){ 0.0f, 0.0f }); break;
+        case MESH_GEN_PLANE:
         {
-            // Data URI Format: data:<mediatype>;base64,<data>
+            int resX = params.resolution[0] + 1;
+            int resZ = params.resolution[1] + 1;
 
-            // Find the comma
-            int i = 0;
-            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
-
-            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
-            else
+            for (int z = 0; z < resZ; z++)
             {
-                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
-                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
-                void *data = NULL;
-
-                cgltf_options options = { 0 };
-                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+                for (int x = 0; x < resX; x++)
+                {
+                    Vector2 texcoord = { (float)x/(resX - 1), (float)z/(resZ - 1) };
+                    AddMeshGenVertex(writer, (Vector3){ (texcoord.x - 0.5f)*params.params[0], 0.0f, (texcoord.y - 0.5f)*params.params[1] }, (Vector3){ 0.0f, 1.0f, 0.0f }, texcoord);
+                }
+            }
 
-                if (result == cgltf_result_success)
+            for (int z = 0; z < resZ - 1; z++)
+            {
+                for (int x = 0; x < resX - 1; x++)
                 {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
-                    MemFree(data);
+                    int i = x + z*resX;
+                    AddMeshGenTriangle(writer, i + resX, i + 1, i);
+                    AddMeshGenTriangle(writer, i + resX, i + resX + 1, i + 1);
                 }
             }
-        }
-        else     // Check if image is provided as image path
+        } break;
+        case MESH_GEN_SPHERE:
+        case MESH_GEN_HEMISPHERE: AddMeshGenGrid(writer, params, params.resolution[1], params.resolution[0]); break;
+        case MESH_GEN_CYLINDER:
         {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
-        }
-    }
-    else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
-    {
-        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
-
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+            AddMeshGenGrid(writer, params, params.resolution[0], 1);
+            AddMeshGenDisk(writer, (Vector3){ 0.0f, params.params[1], 0.0f }, params.params[0], params.resolution[0], true, (Vector2){ 0.0f, 0.0f });
+            AddMeshGenDisk(writer, (Vector3){ 0.0f, 0.0f, 0.0f }, params.params[0], params.resolution[0], false, (Vector2){ 0.95f, 0.95f });
+        } break;
+        case MESH_GEN_CONE:
         {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+            AddMeshGenGrid(writer, params, params.resolution[0], 1);
+            AddMeshGenDisk(writer, (Vector3){ 0.0f, 0.0f, 0.0f }, params.params[0], params.resolution[0], false, (Vector2){ 0.95f, 0.95f });
+        } break;
+        case MESH_GEN_TORUS:
+        case MESH_GEN_KNOT: AddMeshGenGrid(writer, params, params.resolution[0], params.resolution[1]); break;
+        default: break;
+    }
+}
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
-            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
-                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+// Get mesh shape parametric surface point and normal at (u, v), u along stacks and v along slices in [0..1]
+static Vector3 GetMeshGenSurface(MeshGenParams params, float u, float v, Vector3 *normal)
+{
+    Vector3 position = { 0 };
+    float radius = params.params[0];
 
-        RL_FREE(data);
+    switch (params.type)
+    {
+        case MESH_GEN_SPHERE:
+        case MESH_GEN_HEMISPHERE:
+        {
+            // Sphere poles along Z axis, half-sphere covers positive Y side
+            float phi = u*PI;
+            float theta = (params.type == MESH_GEN_SPHERE)? v*2.0f*PI : v*PI;
+            *normal = (Vector3){ cosf(theta)*sinf(phi), sinf(theta)*sinf(phi), cosf(phi) };
+            position = Vector3Scale(*normal, radius);
+        } break;
+        case MESH_GEN_CYLINDER:
+        {
+            float theta = v*2.0f*PI;
+            *normal = (Vector3){ sinf(theta), 0.0f, -cosf(theta) };
+            position = (Vector3){ radius*sinf(theta), params.params[1]*u, -radius*cosf(theta) };
+        } break;
+        case MESH_GEN_CONE:
+        {
+            float theta = v*2.0f*PI;
+            float height = params.params[1];
+            *normal = Vector3Normalize((Vector3){ -height*cosf(theta), radius, -height*sinf(theta) });
+            position = (Vector3){ -radius*(1.0f - u)*cosf(theta), height*u, -radius*(1.0f - u)*sinf(theta) };
+        } break;
+        case MESH_GEN_TORUS:
+        {
+            // Torus lies on Z=0 plane, major radius is 1.0 (scaled by size/2)
+            float theta = u*2.0f*PI;
+            float phi = v*2.0f*PI;
+            float beta = 1.0f + radius*cosf(phi);
+            *normal = (Vector3){ cosf(theta)*cosf(phi), sinf(theta)*cosf(phi), sinf(phi) };
+            position = Vector3Scale((Vector3){ cosf(theta)*beta, sinf(theta)*beta, sinf(phi)*radius }, params.params[1]/2.0f);
+        } break;
+        case MESH_GEN_KNOT:
+        {
+            // Trefoil knot curve with tube around it (tube radius scaled by radius)
+            const float a = 0.5f;
+            const float b = 0.3f;
+            const float c = 0.5f;
+            float d = radius*0.1f;
+            float t = (1.0f - u)*4.0f*PI;
+            float s = v*2.0f*PI;
+            float r = a + b*cosf(1.5f*t);
+
+            Vector3 q = Vector3Normalize((Vector3){ -1.5f*b*sinf(1.5f*t)*cosf(t) - r*sinf(t), -1.5f*b*sinf(1.5f*t)*sinf(t) + r*cosf(t), 1.5f*c*cosf(1.5f*t) });
+            Vector3 qvn = Vector3Normalize((Vector3){ q.y, -q.x, 0.0f });
+            Vector3 ww = Vector3CrossProduct(q, qvn);
+
+            *normal = Vector3Add(Vector3Scale(qvn, cosf(s)), Vector3Scale(ww, sinf(s)));
+            position = Vector3Scale(Vector3Add((Vector3){ r*cosf(t), r*sinf(t), c*sinf(1.5f*t) }, Vector3Scale(*normal, d)), params.params[1]);
+        } break;
+        default: break;
     }
 
-    return image;
+    return position;
 }
 
-// Load bone info from GLTF skin data
-static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
+// Add mesh shape parametric surface grid, (slices + 1)*(stacks + 1) vertices (texture seam vertices duplicated)
+static void AddMeshGenGrid(MeshGenWriter *writer, MeshGenParams params, int slices, int stacks)
 {
-    *boneCount = (int)skin.joints_count;
-    BoneInfo *bones = RL_MALLOC(skin.joints_count*sizeof(BoneInfo));
+    int base = writer->vertexCount;
 
-    for (unsigned int i = 0; i < skin.joints_count; i++)
+    for (int stack = 0; stack <= stacks; stack++)
     {
-        cgltf_node node = *skin.joints[i];
-        strncpy(bones[i].name, node.name, sizeof(bones[i].name));
-
-        // Find parent bone index
-        unsigned int parentIndex = -1;
-
-        for (unsigned int j = 0; j < skin.joints_count; j++)
+        for (int slice = 0; slice <= slices; slice++)
         {
-            if (skin.joints[j] == node.parent)
-            {
-                parentIndex = j;
-                break;
-            }
+            Vector2 texcoord = { (float)stack/stacks, (float)slice/slices };
+            Vector3 normal = { 0 };
+            Vector3 position = (writer->mesh->vertices != NULL)? GetMeshGenSurface(params, texcoord.x, texcoord.y, &normal) : normal;
+
+            AddMeshGenVertex(writer, position, normal, texcoord);
         }
+    }
 
-        bones[i].parent = parentIndex;
+    // Triangles collapsed at poles (sphere) and apex (cone) are skipped
+    for (int stack = 0; stack < stacks; stack++)
+    {
+        for (int slice = 0; slice < slices; slice++)
+        {
+            int i = base + stack*(slices + 1) + slice;
+            AddMeshGenTriangle(writer, i + slices + 1, i + 1, i);
+            AddMeshGenTriangle(writer, i + slices + 1, i + slices + 2, i + 1);
+        }
     }
-
-    return bones;
 }
 
-// Load glTF file into model struct, .gltf and .glb supported
-static Model LoadGLTF(const char *fileName)
+// Add horizontal disk (triangles fan), facing up (+Y) or down (-Y)
+static void AddMeshGenDisk(MeshGenWriter *writer, Vector3 center, float radius, int slices, bool up, Vector2 texcoord)
 {
-    /*********************************************************************************************
-
-        Function implemented by Wilhem Barbier(@wbrbr), with modifications by Tyler Bezera(@gamerfiend)
-        Reviewed by Ramon Santamaria (@raysan5)
+    int base = writer->vertexCount;
+    Vector3 normal = { 0.0f, up? 1.0f : -1.0f, 0.0f };
 
-        FEATURES:
-          - Supports .gltf and .glb files
-          - Supports embedded (base64) or external textures
-          - Supports PBR metallic/roughness flow, loads material textures, values and colors
-                     PBR specular/glossiness flow and extended texture flows not supported
-          - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
-          - Supports basic animations
+    AddMeshGenVertex(writer, center, normal, texcoord);
 
-        RESTRICTIONS:
-          - Only triangle meshes supported
-          - Vertex attibute types and formats supported:
-              > Vertices (position): vec3: float
-              > Normals: vec3: float
-              > Texcoords: vec2: float
-              > Colors: vec4: u8, u16, f32 (normalized)
-              > Indices: u16, u32 (truncated to u16)
-          - Node hierarchies or transforms not supported
+    for (int i = 0; i < slices; i++)
+    {
+        float theta = 2.0f*PI*i/slices;
+        AddMeshGenVertex(writer, (Vector3){ center.x + sinf(theta)*radius, center.y, center.z + cosf(theta)*radius }, normal, texcoord);
+    }
 
-    ***********************************************************************************************/
+    for (int i = 0; i < slices; i++)
+    {
+        int current = base + 1 + i;
+        int next = base + 1 + (i + 1)%slices;
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, dataType, dstPtr) \
-    { \
-        int n = 0; \
-        dataType *buffer = (dataType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(dataType) + accesor->offset/sizeof(dataType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(dataType));\
-        }\
+        if (up) AddMeshGenTriangle(writer, base, current, next);
+        else AddMeshGenTriangle(writer, base, next, current);
     }
+}
 
-    Model model = { 0 };
+// Add mesh generation vertex, only counted on counting pass
+static void AddMeshGenVertex(MeshGenWriter *writer, Vector3 position, Vector3 normal, Vector2 texcoord)
+{
+    Mesh *mesh = writer->mesh;
+    int i = writer->vertexCount;
 
-    // glTF file loading
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    if (mesh->vertices != NULL)
+    {
+        mesh->vertices[i*3] = position.x;
+        mesh->vertices[i*3 + 1] = position.y;
+        mesh->vertices[i*3 + 2] = position.z;
+        mesh->normals[i*3] = normal.x;
+        mesh->normals[i*3 + 1] = normal.y;
+        mesh->normals[i*3 + 2] = normal.z;
+        mesh->texcoords[i*2] = texcoord.x;
+        mesh->texcoords[i*2 + 1] = texcoord.y;
+    }
 
-    if (fileData == NULL) return model;
+    writer->vertexCount++;
+}
 
-    // glTF data loading
-    cgltf_options options = { 0 };
-    cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+// Add mesh generation triangle, only counted on counting pass
+// NOTE: Degenerate triangles (area relative to longest edge) are skipped on writing pass
+static void AddMeshGenTriangle(MeshGenWriter *writer, int a, int b, int c)
+{
+    Mesh *mesh = writer->mesh;
 
-    if (result == cgltf_result_success)
+    if (mesh->vertices != NULL)
     {
-        if (data->file_type == cgltf_file_type_glb) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glb) loaded successfully", fileName);
-        else if (data->file_type == cgltf_file_type_gltf) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glTF) loaded successfully", fileName);
-        else TRACELOG(LOG_WARNING, "MODEL: [%s] Model format not recognized", fileName);
+        Vector3 v0 = { mesh->vertices[a*3], mesh->vertices[a*3 + 1], mesh->vertices[a*3 + 2] };
+        Vector3 v1 = { mesh->vertices[b*3], mesh->vertices[b*3 + 1], mesh->vertices[b*3 + 2] };
+        Vector3 v2 = { mesh->vertices[c*3], mesh->vertices[c*3 + 1], mesh->vertices[c*3 + 2] };
+        float edge = fmaxf(Vector3DistanceSqr(v0, v1), fmaxf(Vector3DistanceSqr(v1, v2), Vector3DistanceSqr(v2, v0)));
 
-        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
-        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
-        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
-        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
-        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
-
-        // Force reading data buffers (fills buffer_view->buffer->data)
-        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded -> TODO: Verify this assumption
-        result = cgltf_load_buffers(&options, data, fileName);
-        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
+        if (Vector3LengthSqr(Vector3CrossProduct(Vector3Subtract(v1, v0), Vector3Subtract(v2, v0))) <= 1e-10f*edge*edge) return;
 
-        int primitivesCount = 0;
-        // NOTE: We will load every primitive in the glTF as a separate raylib mesh
-        for (unsigned int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+        int i = writer->indexCount;
 
-        // Load our model data: meshes and materials
-        model.meshCount = primitivesCount;
-        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+        if (writer->wideIndices != NULL)
+        {
+            writer->wideIndices[i] = a;
+            writer->wideIndices[i + 1] = b;
+            writer->wideIndices[i + 2] = c;
+        }
+        else
+        {
+            mesh->indices[i] = (unsigned short)a;
+            mesh->indices[i + 1] = (unsigned short)b;
+            mesh->indices[i + 2] = (unsigned short)c;
+        }
+    }
 
-        // NOTE: We keep an extra slot for default material, in case some mesh requires it
-        model.materialCount = (int)data->materials_count + 1;
-        model.materials = RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
+    writer->indexCount += 3;
+}
+#endif      // SUPPORT_MESH_GENERATION
 
-        // Load mesh-material indices, by default all meshes are mapped to material index: 0
-        model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
+// Compute model meshes bounding boxes (culling) and load bones pose
+// NOTE: Bounds are computed once from meshes vertices, GetModelBoundingBox() reuses them,
+// skinned meshes vertices bounds by bone are kept to update meshes bounds on animation
+static void LoadModelMeshBounds(Model *model)
+{
+    RL_FREE(model->meshBounds);
+    RL_FREE(model->boneBounds);
+    RL_FREE(model->pose);
+    model->meshBounds = (BoundingBox *)RL_MALLOC(model->meshCount*sizeof(BoundingBox));
+    model->boneBounds = NULL;
+    model->pose = NULL;
+
+    for (int i = 0; i < model->meshCount; i++)
+    {
+        Mesh *mesh = &model->meshes[i];
+        model->meshBounds[i] = GetMeshBoundingBox(*mesh);
 
-        // Load materials data
-        //----------------------------------------------------------------------------------------------------
-        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
+        // Morph targets meshes bounds include vertices displaced by any targets combination (weights in [0..1])
+        for (int v = 0; (mesh->morphVertices != NULL) && (mesh->vertices != NULL) && (v < mesh->vertexCount); v++)
         {
-            model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
+            Vector3 low = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
+            Vector3 high = low;
 
-            // Check glTF material flow: PBR metallic/roughness flow
-            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
-            if (data->materials[i].has_pbr_metallic_roughness)
+            for (int t = 0; t < mesh->morphCount; t++)
             {
-                // Load base color texture (albedo)
-                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
-                {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
-                    }
-                }
-                // Load base color factor (tint)
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
-
-                // Load metallic/roughness texture
-                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
-                {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
-                        UnloadImage(imMetallicRoughness);
-                    }
+                Vector3 delta = { mesh->morphVertices[(v*mesh->morphCount + t)*3], mesh->morphVertices[(v*mesh->morphCount + t)*3 + 1], mesh->morphVertices[(v*mesh->morphCount + t)*3 + 2] };
+                low = Vector3Add(low, Vector3Min(delta, Vector3Zero()));
+                high = Vector3Add(high, Vector3Max(delta, Vector3Zero()));
+            }
 
-                    // Load metallic/roughness material properties
-                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
-                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
+            model->meshBounds[i].min = Vector3Min(model->meshBounds[i].min, low);
+            model->meshBounds[i].max = Vector3Max(model->meshBounds[i].max, high);
+        }
+    }
 
-                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
-                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
-                }
+    if ((model->boneCount <= 0) || (model->bindPose == NULL)) return;
 
-                // Load normal texture
-                if (data->materials[i].normal_texture.texture)
-                {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
-                    }
-                }
+    // Bones pose is loaded in a single allocation, initialized to bind pose
+    model->pose = (ModelPose *)RL_MALLOC(sizeof(ModelPose) + model->boneCount*(sizeof(Transform) + 2*sizeof(Matrix)));
+    model->pose->boneCount = model->boneCount;
+    model->pose->globals = (Matrix *)(model->pose + 1);
+    model->pose->boneMatrices = model->pose->globals + model->boneCount;
+    model->pose->transforms = (Transform *)(model->pose->boneMatrices + model->boneCount);
+    UpdateModelPose(*model, model->bindPose, model->boneCount, NULL);
 
-                // Load ambient occlusion texture
-                if (data->materials[i].occlusion_texture.texture)
-                {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
-                    }
-                }
+    // Bones bounds are empty (min > max) for bones not influencing mesh vertices
+    model->boneBounds = (BoundingBox *)RL_MALLOC(model->meshCount*model->boneCount*sizeof(BoundingBox));
 
-                // Load emissive texture
-                if (data->materials[i].emissive_texture.texture)
-                {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
-                    }
+    for (int i = 0; i < model->meshCount*model->boneCount; i++)
+    {
+        model->boneBounds[i] = (BoundingBox){ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+    }
 
-                    // Load emissive color factor
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
-                }
-            }
+    for (int m = 0; m < model->meshCount; m++)
+    {
+        Mesh *mesh = &model->meshes[m];
+        BoundingBox *bounds = &model->boneBounds[m*model->boneCount];
 
-            // Other possible materials not supported by raylib pipeline:
-            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
-        }
+        if ((mesh->vertices == NULL) || (mesh->boneIds == NULL) || (mesh->boneWeights == NULL)) continue;
 
-        // Load meshes data
-        //----------------------------------------------------------------------------------------------------
-        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
+        for (int v = 0; v < mesh->vertexCount; v++)
         {
-            // NOTE: meshIndex accumulates primitives
+            Vector3 vertex = { mesh->vertices[v*3], mesh->vertices[v*3 + 1], mesh->vertices[v*3 + 2] };
 
-            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            for (int j = 0; j < 4; j++)
             {
-                // NOTE: We only support primitives defined by triangles
-                // Other alternatives: points, lines, line_strip, triangle_strip
-                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+                int boneId = mesh->boneIds[v*4 + j];
 
-                // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
-                // Only some formats for each attribute type are supported, read info at the top of this function!
+                if ((mesh->boneWeights[v*4 + j] <= 0.0f) || (boneId >= model->boneCount)) continue;
 
-                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
-                {
-                    // Check the different attributes for every primitive
-                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+                bounds[boneId].min = Vector3Min(bounds[boneId].min, vertex);
+                bounds[boneId].max = Vector3Max(bounds[boneId].max, vertex);
+            }
+        }
+    }
+}
 
-                        // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined.
+// Update skinned meshes bounding boxes from bones bounds
+// NOTE: Bones bind pose bounds are transformed by bones matrices (center and absolute extents),
+// skinned vertices are weighted blends of bone transformed vertices so they remain inside bounds
+static void UpdateModelMeshBounds(Model model, const Matrix *boneMatrices)
+{
+    if ((model.meshBounds == NULL) || (model.boneBounds == NULL)) return;
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh vertices to copy glTF attribute data
-                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                            model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        const BoundingBox *bones = &model.boneBounds[m*model.boneCount];
+        BoundingBox bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
 
-                            // Load 3 components of float data type into mesh.vertices
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            if (bones[i].min.x > bones[i].max.x) continue;
+
+            const Matrix *mat = &boneMatrices[i];
+            Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(bones[i].min, bones[i].max), 0.5f), *mat);
+            Vector3 extent = Vector3Scale(Vector3Subtract(bones[i].max, bones[i].min), 0.5f);
+            Vector3 size = {
+                fabsf(mat->m0)*extent.x + fabsf(mat->m4)*extent.y + fabsf(mat->m8)*extent.z,
+                fabsf(mat->m1)*extent.x + fabsf(mat->m5)*extent.y + fabsf(mat->m9)*extent.z,
+                fabsf(mat->m2)*extent.x + fabsf(mat->m6)*extent.y + fabsf(mat->m10)*extent.z
+            };
+
+            bounds.min = Vector3Min(bounds.min, Vector3Subtract(center, size));
+            bounds.max = Vector3Max(bounds.max, Vector3Add(center, size));
+        }
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh normals to copy glTF attribute data
-                            model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
+        // Meshes not skinned keep static bounds
+        if (bounds.min.x <= bounds.max.x) model.meshBounds[m] = bounds;
+    }
+}
 
-                            // Load 3 components of float data type into mesh.normals
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+// Get mesh vertex attributes arrays and vertex sizes (bytes)
+// NOTE: Animated vertices and normals are remapped but not compared for deduplication (first attributes)
+static void GetMeshAttributes(Mesh *mesh, void **attributes[MESH_OPTIMIZE_ATTRIBUTES], int *sizes)
+{
+    attributes[0] = (void **)&mesh->vertices;       sizes[0] = 3*sizeof(float);
+    attributes[1] = (void **)&mesh->texcoords;      sizes[1] = 2*sizeof(float);
+    attributes[2] = (void **)&mesh->texcoords2;     sizes[2] = 2*sizeof(float);
+    attributes[3] = (void **)&mesh->normals;        sizes[3] = 3*sizeof(float);
+    attributes[4] = (void **)&mesh->tangents;       sizes[4] = 4*sizeof(float);
+    attributes[5] = (void **)&mesh->colors;         sizes[5] = 4*sizeof(unsigned char);
+    attributes[6] = (void **)&mesh->boneIds;        sizes[6] = 4*sizeof(unsigned char);
+    attributes[7] = (void **)&mesh->boneWeights;    sizes[7] = 4*sizeof(float);
+    attributes[8] = (void **)&mesh->morphVertices;  sizes[8] = mesh->morphCount*3*sizeof(float);
+    attributes[9] = (void **)&mesh->morphNormals;   sizes[9] = mesh->morphCount*3*sizeof(float);
+    attributes[10] = (void **)&mesh->animVertices;  sizes[10] = 3*sizeof(float);
+    attributes[11] = (void **)&mesh->animNormals;   sizes[11] = 3*sizeof(float);
+}
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh tangent to copy glTF attribute data
-                            model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+// Remap mesh vertex attributes, new vertices copied from source vertices
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *source, int count)
+{
+    void **attributes[MESH_OPTIMIZE_ATTRIBUTES] = { 0 };
+    int sizes[MESH_OPTIMIZE_ATTRIBUTES] = { 0 };
+    GetMeshAttributes(mesh, attributes, sizes);
 
-                            // Load 4 components of float data type into mesh.tangents
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_0
-                    {
-                        // TODO: Support additional texture coordinates: TEXCOORD_1 -> mesh.texcoords2
+    for (int a = 0; a < MESH_OPTIMIZE_ATTRIBUTES; a++)
+    {
+        unsigned char *data = (unsigned char *)*attributes[a];
+        if (data == NULL) continue;
 
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+        unsigned char *remapped = (unsigned char *)RL_MALLOC(count*sizes[a]);
+        for (int i = 0; i < count; i++) memcpy(remapped + i*sizes[a], data + source[i]*sizes[a], sizes[a]);
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec2))
-                        {
-                            // Init raylib mesh texcoords to copy glTF attribute data
-                            model.meshes[meshIndex].texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+        RL_FREE(data);
+        *attributes[a] = remapped;
+    }
 
-                            // Load 3 components of float data type into mesh.texcoords
-                            LOAD_ATTRIBUTE(attribute, 2, float, model.meshes[meshIndex].texcoords)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_0
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+    mesh->vertexCount = count;
+}
 
-                        // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range.
+// Deduplicate mesh vertices into indices buffer, fails if unique vertices exceed 16bit indices
+// NOTE: Vertices are hashed (FNV-1a) over all vertex attributes, equal vertices are compared byte by byte
+static bool IndexMeshVertices(Mesh *mesh)
+{
+    void **attributes[MESH_OPTIMIZE_ATTRIBUTES] = { 0 };
+    int sizes[MESH_OPTIMIZE_ATTRIBUTES] = { 0 };
+    GetMeshAttributes(mesh, attributes, sizes);
 
-                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    int indexCount = mesh->triangleCount*3;
+    int vertexCount = (mesh->indices != NULL)? mesh->vertexCount : indexCount;
 
-                            // Load 4 components of unsigned char data type into mesh.colors
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                        }
-                        else if ((attribute->component_type == cgltf_component_type_r_16u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize *= 2;
 
-                            // Load data into a temp buffer to be converted to raylib data type
-                            unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    unsigned int *remap = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));      // Vertex to unique vertex
+    unsigned int *source = (unsigned int *)RL_MALLOC(vertexCount*sizeof(unsigned int));     // Unique vertex to vertex
+    int uniqueCount = 0;
 
-                            // Convert data to raylib color data type (4 bytes)
-                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
 
-                            RL_FREE(temp);
-                        }
-                        else if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    for (int v = 0; v < vertexCount; v++)
+    {
+        unsigned int hash = 2166136261u;
 
-                            // Load data into a temp buffer to be converted to raylib data type
-                            float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
-                            LOAD_ATTRIBUTE(attribute, 4, float, temp);
+        for (int a = 0; a < MESH_OPTIMIZE_ATTRIBUTES - 2; a++)
+        {
+            const unsigned char *data = (const unsigned char *)*attributes[a];
+            if (data == NULL) continue;
 
-                            // Convert data to raylib color data type (4 bytes), we expect the color data normalized
-                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
+            for (int b = 0; b < sizes[a]; b++) hash = (hash ^ data[v*sizes[a] + b])*16777619u;
+        }
 
-                            RL_FREE(temp);
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                    }
+        int slot = (int)(hash & (unsigned int)(tableSize - 1));
 
-                    // NOTE: Attributes related to animations are processed separately
-                }
+        while (table[slot] >= 0)
+        {
+            int other = table[slot];
+            bool equal = true;
 
-                // Load primitive indices data (if provided)
-                if (data->meshes[i].primitives[p].indices != NULL)
-                {
-                    cgltf_accessor *attribute = data->meshes[i].primitives[p].indices;
+            for (int a = 0; (a < MESH_OPTIMIZE_ATTRIBUTES - 2) && equal; a++)
+            {
+                const unsigned char *data = (const unsigned char *)*attributes[a];
+                if ((data != NULL) && (memcmp(data + v*sizes[a], data + other*sizes[a], sizes[a]) != 0)) equal = false;
+            }
 
-                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
+            if (equal) break;
+            slot = (slot + 1) & (tableSize - 1);
+        }
 
-                    if (attribute->component_type == cgltf_component_type_r_16u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+        if (table[slot] >= 0) remap[v] = remap[table[slot]];
+        else
+        {
+            table[slot] = v;
+            remap[v] = uniqueCount;
+            source[uniqueCount] = v;
+            uniqueCount++;
+        }
+    }
 
-                        // Load unsigned short data type into mesh.indices
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
-                    }
-                    else if (attribute->component_type == cgltf_component_type_r_32u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+    bool success = (uniqueCount <= 65535);
 
-                        // Load data into a temp buffer to be converted to raylib data type
-                        unsigned int *temp = RL_MALLOC(attribute->count*sizeof(unsigned int));
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned int, temp);
+    if (success)
+    {
+        unsigned short *indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+        for (int i = 0; i < indexCount; i++) indices[i] = (unsigned short)remap[(mesh->indices != NULL)? mesh->indices[i] : i];
 
-                        // Convert data to raylib indices data type (unsigned short)
-                        for (unsigned int d = 0; d < attribute->count; d++) model.meshes[meshIndex].indices[d] = (unsigned short)temp[d];
+        RL_FREE(mesh->indices);
+        mesh->indices = indices;
+        mesh->vertexCount = vertexCount;
 
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+        RemapMeshVertices(mesh, source, uniqueCount);
+    }
 
-                        RL_FREE(temp);
-                    }
-                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
-                }
-                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
+    RL_FREE(table);
+    RL_FREE(remap);
+    RL_FREE(source);
 
-                // Assign to the primitive mesh the corresponding material index
-                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
-                for (unsigned int m = 0; m < data->materials_count; m++)
-                {
-                    // The primitive actually keeps the pointer to the corresponding material,
-                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
-                    // To get the index, we check if material pointers match, and we assign the corresponding index,
-                    // skipping index 0, the default material
-                    if (&data->materials[m] == data->meshes[i].primitives[p].material)
-                    {
-                        model.meshMaterial[meshIndex] = m + 1;
-                        break;
-                    }
-                }
+    return success;
+}
 
-                meshIndex++;       // Move to next mesh
-            }
-        }
+// Get mesh average cache miss ratio (FIFO vertex cache)
+// NOTE: Ratio of transformed vertices by triangle, 3.0 for no vertex reuse, ~0.5 optimal for regular grids
+static float GetMeshCacheMissRatio(const unsigned short *indices, int indexCount, int vertexCount)
+{
+    unsigned int *cache = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int timestamp = MESH_OPTIMIZE_CACHE_SIZE + 1;
+    int misses = 0;
 
-        // Load glTF meshes animation data
-        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
-        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skinned-mesh-attributes
-        //
-        // LIMITATIONS:
-        //  - Only supports 1 armature per file, and skips loading it if there are multiple armatures
-        //  - Only supports linear interpolation (default method in Blender when checked "Always Sample Animations" when exporting a GLTF file)
-        //  - Only supports translation/rotation/scale animation channel.path, weights not considered (i.e. morph targets)
-        //----------------------------------------------------------------------------------------------------
-        if (data->skins_count == 1)
+    for (int i = 0; i < indexCount; i++)
+    {
+        if ((timestamp - cache[indices[i]]) > MESH_OPTIMIZE_CACHE_SIZE)
         {
-            cgltf_skin skin = data->skins[0];
-            model.bones = LoadBoneInfoGLTF(skin, &model.boneCount);
-            model.bindPose = RL_MALLOC(model.boneCount*sizeof(Transform));
+            cache[indices[i]] = timestamp++;
+            misses++;
+        }
+    }
 
-            for (int i = 0; i < model.boneCount; i++)
-            {
-                cgltf_node node = *skin.joints[i];
-                model.bindPose[i].translation.x = node.translation[0];
-                model.bindPose[i].translation.y = node.translation[1];
-                model.bindPose[i].translation.z = node.translation[2];
+    RL_FREE(cache);
 
-                model.bindPose[i].rotation.x = node.rotation[0];
-                model.bindPose[i].rotation.y = node.rotation[1];
-                model.bindPose[i].rotation.z = node.rotation[2];
-                model.bindPose[i].rotation.w = node.rotation[3];
+    return (indexCount > 0)? (float)misses/(float)(indexCount/3) : 0.0f;
+}
 
-                model.bindPose[i].scale.x = node.scale[0];
-                model.bindPose[i].scale.y = node.scale[1];
-                model.bindPose[i].scale.z = node.scale[2];
-            }
+// Reorder triangles for vertex cache locality (Tipsify)
+// NOTE: Triangles are emitted fanning around vertices, next fanning vertex is selected from
+// emitted vertices still in cache after its triangles, recent vertices stack is used on dead-ends
+// Ref: Sander et al., Fast Triangle Reordering for Vertex Locality and Reduced Overdraw, 2007
+static void OptimizeMeshVertexCache(unsigned short *indices, int indexCount, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    // Vertices adjacent triangles, live triangles are adjacent triangles not emitted yet
+    int *offsets = (int *)RL_CALLOC(vertexCount + 1, sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *live = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    unsigned int *cache = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    int *deadEnd = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *candidates = (int *)RL_MALLOC(indexCount*sizeof(int));
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned short *output = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+    for (int i = 0; i < indexCount; i++) live[indices[i]]++;
+    for (int v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + live[v];
+    for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]] + cache[indices[i]]++] = i/3;
+    memset(cache, 0, vertexCount*sizeof(unsigned int));
+
+    unsigned int timestamp = MESH_OPTIMIZE_CACHE_SIZE + 1;
+    int deadEndCount = 0;
+    int outputCount = 0;
+    int cursor = 0;
+    int fanning = 0;
+
+    while (fanning >= 0)
+    {
+        int candidateCount = 0;
 
-            BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
-        }
-        else if (data->skins_count > 1)
+        for (int a = offsets[fanning]; a < offsets[fanning + 1]; a++)
         {
-            TRACELOG(LOG_ERROR, "MODEL: [%s] can only load one skin (armature) per model, but gltf skins_count == %i", fileName, data->skins_count);
-        }
+            int triangle = adjacency[a];
+            if (emitted[triangle]) continue;
 
-        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
-        {
-            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            for (int k = 0; k < 3; k++)
             {
-                // NOTE: We only support primitives defined by triangles
-                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+                int v = indices[triangle*3 + k];
 
-                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
-                {
-                    // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+                output[outputCount++] = (unsigned short)v;
+                deadEnd[deadEndCount++] = v;
+                candidates[candidateCount++] = v;
+                live[v]--;
 
-                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_joints)        // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+                if ((timestamp - cache[v]) > MESH_OPTIMIZE_CACHE_SIZE) cache[v] = timestamp++;
+            }
 
-                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh bone ids to copy glTF attribute data
-                            model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
-
-                            // Load 4 components of unsigned char data type into mesh.boneIds
-                            // for cgltf_attribute_type_joints we have:
-                            //   - data.meshes[0] (256 vertices)
-                            //   - 256 values, provided as cgltf_type_vec4 of bytes (4 byte per joint, stride 4)
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIds)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported, use vec4 u8", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_weights)  // WEIGHTS_n (vec4 / u8, u16, f32)
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+            emitted[triangle] = true;
+        }
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh bone weight to copy glTF attribute data
-                            model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
-
-                            // Load 4 components of float data type into mesh.boneWeights
-                            // for cgltf_attribute_type_weights we have:
-                            //   - data.meshes[0] (256 vertices)
-                            //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
-                    }
-                }
+        // Select oldest candidate that stays in cache when fanning its live triangles
+        int next = -1;
+        int priority = -1;
 
-                // Animated vertex data
-                model.meshes[meshIndex].animVertices = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                memcpy(model.meshes[meshIndex].animVertices, model.meshes[meshIndex].vertices, model.meshes[meshIndex].vertexCount*3*sizeof(float));
-                model.meshes[meshIndex].animNormals = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                memcpy(model.meshes[meshIndex].animNormals, model.meshes[meshIndex].normals, model.meshes[meshIndex].vertexCount*3*sizeof(float));
+        for (int c = 0; c < candidateCount; c++)
+        {
+            int v = candidates[c];
+            if (live[v] <= 0) continue;
+
+            int age = (int)(timestamp - cache[v]);
+            int vertexPriority = ((age + 2*live[v]) <= MESH_OPTIMIZE_CACHE_SIZE)? age : 0;
 
-                meshIndex++;       // Move to next mesh
+            if (vertexPriority > priority)
+            {
+                priority = vertexPriority;
+                next = v;
             }
+        }
 
+        // Dead-end: most recent vertex with live triangles, next vertex in input order otherwise
+        while ((next < 0) && (deadEndCount > 0))
+        {
+            int v = deadEnd[--deadEndCount];
+            if (live[v] > 0) next = v;
         }
 
-        // Free all cgltf loaded data
-        cgltf_free(data);
+        while ((next < 0) && (cursor < vertexCount))
+        {
+            if (live[cursor] > 0) next = cursor;
+            else cursor++;
+        }
+
+        fanning = next;
     }
-    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
-    // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    memcpy(indices, output, indexCount*sizeof(unsigned short));
 
-    return model;
+    RL_FREE(offsets);
+    RL_FREE(adjacency);
+    RL_FREE(live);
+    RL_FREE(cache);
+    RL_FREE(deadEnd);
+    RL_FREE(candidates);
+    RL_FREE(emitted);
+    RL_FREE(output);
 }
 
-// Get interpolated pose for bone sampler at a specific time. Returns true on success.
-static bool GetPoseAtTimeGLTF(cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+// Reorder triangles clusters to reduce overdraw
+// NOTE: Triangles order is split in clusters where cluster cache miss ratio gets close to mesh ratio
+// (vertex cache locality mostly kept), clusters facing outwards from mesh center are drawn first
+static void OptimizeMeshOverdraw(const float *vertices, unsigned short *indices, int indexCount, int vertexCount)
 {
-    // Input and output should have the same count
-    float tstart = 0.0f;
-    float tend = 0.0f;
-    int keyframe = 0;       // Defaults to first pose
+    int triangleCount = indexCount/3;
+    float missThreshold = MESH_OPTIMIZE_OVERDRAW_THRESHOLD*GetMeshCacheMissRatio(indices, indexCount, vertexCount);
 
-    for (int i = 0; i < input->count - 1; i++)
-    {
-        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
-        if (!r1) return false;
+    unsigned int *cache = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    MeshTriangleCluster *clusters = (MeshTriangleCluster *)RL_MALLOC(triangleCount*sizeof(MeshTriangleCluster));
+    int clusterCount = 0;
 
-        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
-        if (!r2) return false;
+    // Split clusters, vertex cache is reset for every cluster
+    unsigned int timestamp = MESH_OPTIMIZE_CACHE_SIZE + 1;
+    int clusterStart = 0;
+    int clusterMisses = 0;
 
-        if ((tstart <= time) && (time < tend))
+    for (int t = 0; t < triangleCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
         {
-            keyframe = i;
-            break;
-        }
-    }
-
-    float t = (time - tstart)/(tend - tstart);
-    t = (t < 0.0f)? 0.0f : t;
-    t = (t > 1.0f)? 1.0f : t;
+            int v = indices[t*3 + k];
 
-    if (output->component_type != cgltf_component_type_r_32f) return false;
+            if ((timestamp - cache[v]) > MESH_OPTIMIZE_CACHE_SIZE)
+            {
+                cache[v] = timestamp++;
+                clusterMisses++;
+            }
+        }
 
-    if (output->type == cgltf_type_vec3)
-    {
-        float tmp[3] = { 0.0f };
-        cgltf_accessor_read_float(output, keyframe, tmp, 3);
-        Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
-        cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
-        Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
-        Vector3 *r = data;
-        *r = Vector3Lerp(v1, v2, t);
-    }
-    else if (output->type == cgltf_type_vec4)
-    {
-        float tmp[4] = { 0.0f };
-        cgltf_accessor_read_float(output, keyframe, tmp, 4);
-        Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-        cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
-        Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-        Vector4 *r = data;
+        if ((t == (triangleCount - 1)) || ((float)clusterMisses <= missThreshold*(float)(t - clusterStart + 1)))
+        {
+            clusters[clusterCount].start = clusterStart;
+            clusters[clusterCount].end = t + 1;
+            clusterCount++;
 
-        // Only v4 is for rotations, so we know it's a quat
-        *r = QuaternionSlerp(v1, v2, t);
+            clusterStart = t + 1;
+            clusterMisses = 0;
+            timestamp += MESH_OPTIMIZE_CACHE_SIZE + 1;
+        }
     }
 
-    return true;
-}
-
-#define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+    // Get mesh centroid and clusters centroids and normals (area weighted)
+    Vector3 meshCentroid = { 0 };
+    float meshArea = 0.0f;
 
-static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, unsigned int *animCount)
-{
-    // glTF file loading
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    for (int c = 0; c < clusterCount; c++)
+    {
+        Vector3 centroid = { 0 };
+        Vector3 normal = { 0 };
+        float area = 0.0f;
 
-    ModelAnimation *animations = NULL;
+        for (int t = clusters[c].start; t < clusters[c].end; t++)
+        {
+            const float *p0 = &vertices[indices[t*3]*3];
+            const float *p1 = &vertices[indices[t*3 + 1]*3];
+            const float *p2 = &vertices[indices[t*3 + 2]*3];
+
+            Vector3 edge1 = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            Vector3 edge2 = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            Vector3 cross = Vector3CrossProduct(edge1, edge2);
+            float triangleArea = Vector3Length(cross);
+
+            centroid.x += (p0[0] + p1[0] + p2[0])*triangleArea/3.0f;
+            centroid.y += (p0[1] + p1[1] + p2[1])*triangleArea/3.0f;
+            centroid.z += (p0[2] + p1[2] + p2[2])*triangleArea/3.0f;
+            normal = Vector3Add(normal, cross);
+            area += triangleArea;
+        }
 
-    // glTF data loading
-    cgltf_options options = { 0 };
-    cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+        meshCentroid = Vector3Add(meshCentroid, centroid);
+        meshArea += area;
 
-    if (result != cgltf_result_success)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
-        *animCount = 0;
-        return NULL;
+        clusters[c].centroid = (area > 0.0f)? Vector3Scale(centroid, 1.0f/area) : centroid;
+        clusters[c].normal = Vector3Normalize(normal);
     }
 
-    result = cgltf_load_buffers(&options, data, fileName);
-    if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
+    if (meshArea > 0.0f) meshCentroid = Vector3Scale(meshCentroid, 1.0f/meshArea);
 
-    if (result == cgltf_result_success)
+    for (int c = 0; c < clusterCount; c++)
     {
-        if (data->skins_count == 1)
-        {
-            cgltf_skin skin = data->skins[0];
-            *animCount = (int)data->animations_count;
-            animations = RL_MALLOC(data->animations_count*sizeof(ModelAnimation));
+        clusters[c].sortKey = Vector3DotProduct(Vector3Subtract(clusters[c].centroid, meshCentroid), clusters[c].normal);
+    }
 
-            for (unsigned int i = 0; i < data->animations_count; i++)
-            {
-                animations[i].bones = LoadBoneInfoGLTF(skin, &animations[i].boneCount);
+    qsort(clusters, clusterCount, sizeof(MeshTriangleCluster), CompareMeshTriangleClusters);
 
-                cgltf_animation animData = data->animations[i];
+    unsigned short *output = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    int outputCount = 0;
 
-                struct Channels {
-                    cgltf_animation_channel *translate;
-                    cgltf_animation_channel *rotate;
-                    cgltf_animation_channel *scale;
-                };
+    for (int c = 0; c < clusterCount; c++)
+    {
+        int count = (clusters[c].end - clusters[c].start)*3;
+        memcpy(output + outputCount, indices + clusters[c].start*3, count*sizeof(unsigned short));
+        outputCount += count;
+    }
 
-                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
-                float animDuration = 0.0f;
+    memcpy(indices, output, indexCount*sizeof(unsigned short));
 
-                for (unsigned int j = 0; j < animData.channels_count; j++)
-                {
-                    cgltf_animation_channel channel = animData.channels[j];
-                    int boneIndex = -1;
+    RL_FREE(output);
+    RL_FREE(clusters);
+    RL_FREE(cache);
+}
 
-                    for (unsigned int k = 0; k < skin.joints_count; k++)
-                    {
-                        if (animData.channels[j].target_node == skin.joints[k])
-                        {
-                            boneIndex = k;
-                            break;
-                        }
-                    }
+// Reorder mesh vertices by first use in indices
+// NOTE: Vertices not referenced by indices are removed
+static void OptimizeMeshVertexFetch(Mesh *mesh)
+{
+    int indexCount = mesh->triangleCount*3;
+    unsigned int *remap = (unsigned int *)RL_MALLOC(mesh->vertexCount*sizeof(unsigned int));
+    unsigned int *source = (unsigned int *)RL_MALLOC(mesh->vertexCount*sizeof(unsigned int));
+    int count = 0;
 
-                    if (boneIndex == -1)
-                    {
-                        // Animation channel for a node not in the armature
-                        continue;
-                    }
+    for (int v = 0; v < mesh->vertexCount; v++) remap[v] = 0xffffffff;
 
-                    if (animData.channels[j].sampler->interpolation == cgltf_interpolation_type_linear)
-                    {
-                        if (channel.target_path == cgltf_animation_path_type_translation)
-                        {
-                            boneChannels[boneIndex].translate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_rotation)
-                        {
-                            boneChannels[boneIndex].rotate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_scale)
-                        {
-                            boneChannels[boneIndex].scale = &animData.channels[j];
-                        }
-                        else
-                        {
-                            TRACELOG(LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
-                        }
-                    }
-                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Only linear interpolation curves are supported for GLTF animation.", fileName);
+    for (int i = 0; i < indexCount; i++)
+    {
+        int v = mesh->indices[i];
 
-                    float t = 0.0f;
-                    cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
+        if (remap[v] == 0xffffffff)
+        {
+            remap[v] = count;
+            source[count] = v;
+            count++;
+        }
 
-                    if (!r)
-                    {
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load input time", fileName);
-                        continue;
-                    }
+        mesh->indices[i] = (unsigned short)remap[v];
+    }
 
-                    animDuration = (t > animDuration)? t : animDuration;
-                }
+    RemapMeshVertices(mesh, source, count);
 
-                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY);
-                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
+    RL_FREE(remap);
+    RL_FREE(source);
+}
 
-                for (int j = 0; j < animations[i].frameCount; j++)
-                {
-                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+// Compare triangle clusters sort key (descending), qsort() callback
+static int CompareMeshTriangleClusters(const void *a, const void *b)
+{
+    float keyA = ((const MeshTriangleCluster *)a)->sortKey;
+    float keyB = ((const MeshTriangleCluster *)b)->sortKey;
 
-                    for (int k = 0; k < animations[i].boneCount; k++)
-                    {
-                        Vector3 translation = {0, 0, 0};
-                        Quaternion rotation = {0, 0, 0, 1};
-                        Vector3 scale = {1, 1, 1};
+    return (keyA < keyB) - (keyA > keyB);
+}
+// Add weighted plane (normal, distance) to mesh quadric
+static void AddMeshQuadricPlane(MeshQuadric *quadric, Vector3 normal, float distance, float weight)
+{
+    quadric->a00 += weight*normal.x*normal.x;
+    quadric->a11 += weight*normal.y*normal.y;
+    quadric->a22 += weight*normal.z*normal.z;
+    quadric->a10 += weight*normal.y*normal.x;
+    quadric->a20 += weight*normal.z*normal.x;
+    quadric->a21 += weight*normal.z*normal.y;
+    quadric->b0 += weight*normal.x*distance;
+    quadric->b1 += weight*normal.y*distance;
+    quadric->b2 += weight*normal.z*distance;
+    quadric->c += weight*distance*distance;
+    quadric->w += weight;
+}
 
-                        if (boneChannels[k].translate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+// Get mesh quadric value at point, planes weighted squared distance
+static float GetMeshQuadricValue(const MeshQuadric *quadric, Vector3 point)
+{
+    float value = quadric->a00*point.x*point.x + quadric->a11*point.y*point.y + quadric->a22*point.z*point.z +
+        2.0f*(quadric->a10*point.y*point.x + quadric->a20*point.z*point.x + quadric->a21*point.z*point.y) +
+        2.0f*(quadric->b0*point.x + quadric->b1*point.y + quadric->b2*point.z) + quadric->c;
 
-                        if (boneChannels[k].rotate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+    return fmaxf(value, 0.0f);
+}
 
-                        if (boneChannels[k].scale)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+// Simplify mesh indices by edge collapses (in place), returns simplified triangles count
+// NOTE: Position groups are collapsed into neighbour groups positions (vertices are not moved, half-edge collapses),
+// every pass collapses non-adjacent edges by ascending error until target triangles, error stays under maxError
+// and collapses do not flip triangles, vertices on attributes seams must be collapsed along the seam
+static int SimplifyMeshIndices(MeshSimplifyData *data, unsigned short *indices, int triangleCount, int targetTriangles, float maxError, float *error)
+{
+    int vertexCount = data->vertexCount;
 
-                        animations[i].framePoses[j][k] = (Transform){
-                            .translation = translation,
-                            .rotation = rotation,
-                            .scale = scale
-                        };
-                    }
+    while (triangleCount > targetTriangles)
+    {
+        // Vertices adjacent triangles
+        memset(data->adjacencyStart, 0, (vertexCount + 1)*sizeof(int));
+        for (int i = 0; i < triangleCount*3; i++) data->adjacencyStart[indices[i] + 1]++;
+        for (int v = 0; v < vertexCount; v++) data->adjacencyStart[v + 1] += data->adjacencyStart[v];
+        for (int i = 0; i < triangleCount*3; i++) data->adjacency[data->adjacencyStart[indices[i]]++] = i/3;
+        for (int v = vertexCount; v > 0; v--) data->adjacencyStart[v] = data->adjacencyStart[v - 1];
+        data->adjacencyStart[0] = 0;
+
+        // Edge collapses candidates, both directions of every triangle edge
+        int collapseCount = 0;
+
+        for (int i = 0; i < triangleCount*3; i++)
+        {
+            int ga = data->group[indices[i]];
+            int gb = data->group[indices[(i%3 == 2)? i - 2 : i + 1]];
+            float weight = data->quadrics[ga].w + data->quadrics[gb].w;
+            if (weight <= 0.0f) weight = 1.0f;
 
-                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
-                }
+            float errorA = GetMeshQuadricValue(&data->quadrics[ga], data->points[ga]) + GetMeshQuadricValue(&data->quadrics[gb], data->points[ga]);
+            float errorB = GetMeshQuadricValue(&data->quadrics[ga], data->points[gb]) + GetMeshQuadricValue(&data->quadrics[gb], data->points[gb]);
 
-                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, animData.name, animations[i].frameCount, animDuration);
-                RL_FREE(boneChannels);
-            }
+            data->collapses[collapseCount++] = (MeshCollapse){ errorB/weight, ga, gb };
+            data->collapses[collapseCount++] = (MeshCollapse){ errorA/weight, gb, ga };
         }
-        else TRACELOG(LOG_ERROR, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
 
-        cgltf_free(data);
-    }
+        qsort(data->collapses, collapseCount, sizeof(MeshCollapse), CompareMeshCollapses);
 
-    return animations;
-}
-#endif
+        for (int v = 0; v < vertexCount; v++)
+        {
+            data->remap[v] = v;
+            data->locked[v] = false;
+        }
 
-#if defined(SUPPORT_FILEFORMAT_VOX)
-// Load VOX (MagicaVoxel) mesh data
-static Model LoadVOX(const char *fileName)
-{
-    Model model = { 0 };
+        int removedCount = 0;
 
-    int nbvertices = 0;
-    int meshescount = 0;
-    unsigned int fileSize = 0;
-    unsigned char *fileData = NULL;
+        for (int c = 0; (c < collapseCount) && (removedCount < (triangleCount - targetTriangles)); c++)
+        {
+            const MeshCollapse *collapse = &data->collapses[c];
+            if (collapse->error > maxError*maxError) break;
+            if (data->locked[collapse->source] || data->locked[collapse->target]) continue;
 
-    // Read vox file into buffer
-    fileData = LoadFileData(fileName, &fileSize);
-    if (fileData == 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
-        return model;
-    }
+            // Every source group vertex collapses into a target group vertex sharing an edge (attributes seams kept)
+            bool valid = true;
+            int v = collapse->source;
 
-    // Read and build voxarray description
-    VoxArray3D voxarray = { 0 };
-    int ret = Vox_LoadFromMemory(fileData, fileSize, &voxarray);
+            do
+            {
+                int target = (data->adjacencyStart[v] == data->adjacencyStart[v + 1])? v : -1;     // Unused vertex kept
 
-    if (ret != VOX_SUCCESS)
-    {
-        // Error
-        UnloadFileData(fileData);
+                for (int k = data->adjacencyStart[v]; (k < data->adjacencyStart[v + 1]) && (target < 0); k++)
+                {
+                    const unsigned short *triangle = indices + data->adjacency[k]*3;
+                    for (int j = 0; j < 3; j++) if (data->group[triangle[j]] == collapse->target) target = triangle[j];
+                }
 
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
-        return model;
-    }
-    else
-    {
-        // Success: Compute meshes count
-        nbvertices = voxarray.vertices.used;
-        meshescount = 1 + (nbvertices/65536);
+                if (target < 0) valid = false;
+                else data->remap[v] = target;
 
-        TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, nbvertices, meshescount);
-    }
+                v = data->groupNext[v];
+            } while (valid && (v != collapse->source));
 
-    // Build models from meshes
-    model.transform = MatrixIdentity();
+            // Collapsed triangles are removed, remaining source triangles must not flip
+            int removed = 0;
 
-    model.meshCount = meshescount;
-    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+            for (v = collapse->source; valid; )
+            {
+                for (int k = data->adjacencyStart[v]; (k < data->adjacencyStart[v + 1]) && valid; k++)
+                {
+                    const unsigned short *triangle = indices + data->adjacency[k]*3;
+                    if ((data->group[triangle[0]] == collapse->target) || (data->group[triangle[1]] == collapse->target) ||
+                        (data->group[triangle[2]] == collapse->target))
+                    {
+                        removed++;
+                        continue;
+                    }
 
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+                    // Triangles already collapsed in current pass are skipped
+                    int current[3] = { 0 };
+                    for (int j = 0; j < 3; j++) current[j] = (data->group[triangle[j]] == collapse->source)? triangle[j] : data->remap[triangle[j]];
+                    if ((data->group[current[0]] == data->group[current[1]]) || (data->group[current[1]] == data->group[current[2]]) ||
+                        (data->group[current[0]] == data->group[current[2]])) continue;
 
-    model.materialCount = 1;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.materials[0] = LoadMaterialDefault();
+                    Vector3 p[3] = { 0 };
+                    Vector3 q[3] = { 0 };
 
-    // Init model meshes
-    int verticesRemain = voxarray.vertices.used;
-    int verticesMax = 65532; // 5461 voxels x 12 vertices per voxel -> 65532 (must be inf 65536)
+                    for (int j = 0; j < 3; j++)
+                    {
+                        p[j] = data->points[current[j]];
+                        q[j] = data->points[data->remap[triangle[j]]];
+                    }
 
-    // 6*4 = 12 vertices per voxel
-    Vector3 *pvertices = (Vector3 *)voxarray.vertices.array;
-    Color *pcolors = (Color *)voxarray.colors.array;
+                    Vector3 normal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+                    Vector3 collapsed = Vector3CrossProduct(Vector3Subtract(q[1], q[0]), Vector3Subtract(q[2], q[0]));
+                    if (Vector3DotProduct(normal, collapsed) <= 0.0f) valid = false;
+                }
 
-    unsigned short *pindices = voxarray.indices.array;    // 5461*6*6 = 196596 indices max per mesh
+                v = data->groupNext[v];
+                if (v == collapse->source) break;
+            }
 
-    int size = 0;
+            if (!valid)
+            {
+                v = collapse->source;
+                do
+                {
+                    data->remap[v] = v;
+                    v = data->groupNext[v];
+                } while (v != collapse->source);
 
-    for (int i = 0; i < meshescount; i++)
-    {
-        Mesh *pmesh = &model.meshes[i];
-        memset(pmesh, 0, sizeof(Mesh));
+                continue;
+            }
 
-        // Copy vertices
-        pmesh->vertexCount = (int)fmin(verticesMax, verticesRemain);
+            MeshQuadric *target = &data->quadrics[collapse->target];
+            const MeshQuadric *source = &data->quadrics[collapse->source];
+            target->a00 += source->a00; target->a11 += source->a11; target->a22 += source->a22;
+            target->a10 += source->a10; target->a20 += source->a20; target->a21 += source->a21;
+            target->b0 += source->b0; target->b1 += source->b1; target->b2 += source->b2;
+            target->c += source->c;
+            target->w += source->w;
+
+            data->locked[collapse->source] = true;
+            data->locked[collapse->target] = true;
+            removedCount += removed;
+            if (collapse->error > *error) *error = collapse->error;
+        }
 
-        size = pmesh->vertexCount*sizeof(float)*3;
-        pmesh->vertices = RL_MALLOC(size);
-        memcpy(pmesh->vertices, pvertices, size);
+        if (removedCount == 0) break;
 
-        // Copy indices
-        // TODO: Compute globals indices array
-        size = voxarray.indices.used*sizeof(unsigned short);
-        pmesh->indices = RL_MALLOC(size);
-        memcpy(pmesh->indices, pindices, size);
+        // Remap indices, collapsed triangles are discarded
+        int count = 0;
 
-        pmesh->triangleCount = (pmesh->vertexCount/4)*2;
+        for (int t = 0; t < triangleCount; t++)
+        {
+            int i0 = data->remap[indices[t*3]];
+            int i1 = data->remap[indices[t*3 + 1]];
+            int i2 = data->remap[indices[t*3 + 2]];
 
-        // Copy colors
-        size = pmesh->vertexCount*sizeof(Color);
-        pmesh->colors = RL_MALLOC(size);
-        memcpy(pmesh->colors, pcolors, size);
+            if ((data->group[i0] == data->group[i1]) || (data->group[i1] == data->group[i2]) || (data->group[i0] == data->group[i2])) continue;
 
-        // First material index
-        model.meshMaterial[i] = 0;
+            indices[count*3] = (unsigned short)i0;
+            indices[count*3 + 1] = (unsigned short)i1;
+            indices[count*3 + 2] = (unsigned short)i2;
+            count++;
+        }
 
-        verticesRemain -= verticesMax;
-        pvertices += verticesMax;
-        pcolors += verticesMax;
+        triangleCount = count;
     }
 
-    // Free buffers
-    Vox_FreeArrays(&voxarray);
-    UnloadFileData(fileData);
-
-    return model;
+    return triangleCount;
 }
-#endif
-
-#if defined(SUPPORT_FILEFORMAT_M3D)
-// Hook LoadFileData()/UnloadFileData() calls to M3D loaders
-unsigned char *m3d_loaderhook(char *fn, unsigned int *len) { return LoadFileData((const char *)fn, len); }
-void m3d_freehook(void *data) { UnloadFileData((unsigned char *)data); }
 
-// Load M3D mesh data
-static Model LoadM3D(const char *fileName)
+// Compare mesh simplification edges (position groups), qsort() callback
+static int CompareMeshEdges(const void *a, const void *b)
 {
-    Model model = { 0 };
-
-    m3d_t *m3d = NULL;
-    m3dp_t *prop = NULL;
-    unsigned int bytesRead = 0;
-    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
-    int i, j, k, l, n, mi = -2;
+    const MeshEdge *edgeA = (const MeshEdge *)a;
+    const MeshEdge *edgeB = (const MeshEdge *)b;
 
-    if (fileData != NULL)
-    {
-        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+    if (edgeA->a != edgeB->a) return (edgeA->a < edgeB->a)? -1 : 1;
+    if (edgeA->b != edgeB->b) return (edgeA->b < edgeB->b)? -1 : 1;
 
-        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
-            if (m3d) m3d_free(m3d);
-            UnloadFileData(fileData);
-            return model;
-        }
-        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i faces/%i materials", fileName, m3d->numface, m3d->nummaterial);
+    return 0;
+}
 
-        // no face? this is probably just a material library
-        if (!m3d->numface)
-        {
-            m3d_free(m3d);
-            UnloadFileData(fileData);
-            return model;
-        }
+// Compare mesh edge collapses error (ascending), qsort() callback
+static int CompareMeshCollapses(const void *a, const void *b)
+{
+    float errorA = ((const MeshCollapse *)a)->error;
+    float errorB = ((const MeshCollapse *)b)->error;
 
-        if (m3d->nummaterial > 0)
-        {
-            model.meshCount = model.materialCount = m3d->nummaterial;
-            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", model.materialCount);
-        }
-        else
-        {
-            model.meshCount = model.materialCount = 1;
-            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
-        }
+    return (errorA > errorB) - (errorA < errorB);
+}
 
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-        model.materials = (Material *)RL_CALLOC(model.materialCount + 1, sizeof(Material));
+// Get mesh indices range for current LOD level, returns offset in mesh indices buffer
+// NOTE: LOD levels indices are stored after mesh indices, level 0 (or invalid level) draws mesh indices
+static int GetMeshLODIndices(Mesh mesh, int *count)
+{
+    int offset = 0;
+    *count = mesh.triangleCount*3;
 
-        // Map no material to index 0 with default shader, everything else materialid + 1
-        model.materials[0] = LoadMaterialDefault();
+    if ((mesh.lodLevel > 0) && (mesh.lodLevel < mesh.lodCount) && (mesh.indices != NULL))
+    {
+        offset = mesh.triangleCount*3;
+        for (int i = 1; i < mesh.lodLevel; i++) offset += mesh.lodTriangles[i]*3;
+        *count = mesh.lodTriangles[mesh.lodLevel]*3;
+    }
 
-        for (i = l = 0, k = -1; i < (int)m3d->numface; i++, l++)
-        {
-            // Materials are grouped together
-            if (mi != m3d->face[i].materialid)
-            {
-                // there should be only one material switch per material kind, but be bulletproof for non-optimal model files
-                if (k + 1 >= model.meshCount)
-                {
-                    model.meshCount++;
-                    model.meshes = (Mesh *)RL_REALLOC(model.meshes, model.meshCount*sizeof(Mesh));
-                    memset(&model.meshes[model.meshCount - 1], 0, sizeof(Mesh));
-                    model.meshMaterial = (int *)RL_REALLOC(model.meshMaterial, model.meshCount*sizeof(int));
-                }
+    return offset;
+}
 
-                k++;
-                mi = m3d->face[i].materialid;
 
-                for (j = i, l = 0; (j < (int)m3d->numface) && (mi == m3d->face[j].materialid); j++, l++);
+// Generate terrain chunk mesh data (loader thread)
+// NOTE: Chunk grid vertices are shared (indexed), LOD levels sample heights every (1 << lod) quads, chunk borders
+// get skirts going down by twice the maximum edge error of any LOD level, covering cracks between neighbour chunks
+static void GenTerrainChunkAsync(void *data)
+{
+    TerrainChunkAsyncLoad *load = (TerrainChunkAsyncLoad *)data;
+    Mesh *mesh = &load->mesh;
 
-                model.meshes[k].vertexCount = l*3;
-                model.meshes[k].triangleCount = l;
-                model.meshes[k].vertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                model.meshes[k].texcoords = (float *)RL_CALLOC(model.meshes[k].vertexCount*2, sizeof(float));
-                model.meshes[k].normals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+    int step = 1 << load->lod;
+    int nx = (load->quadsX + step - 1)/step;
+    int nz = (load->quadsZ + step - 1)/step;
+    int gridCount = (nx + 1)*(nz + 1);
+    Vector3 scale = { load->size.x/(load->width - 1), load->size.y/65535.0f, load->size.z/(load->height - 1) };
 
-                // If no map is provided, we allocate storage for vertex colors
-                // M3D specs only consider vertex colors if no material is provided
-                if (mi != M3D_UNDEF) model.meshes[k].colors = RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+    #define TERRAIN_HEIGHT(x, z) ((float)load->heights[(z)*load->width + (x)]*scale.y)
 
-                if (m3d->numbone && m3d->numskin)
-                {
-                    model.meshes[k].boneIds = (unsigned char *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
-                    model.meshes[k].boneWeights = (float *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(float));
-                    model.meshes[k].animVertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                    model.meshes[k].animNormals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                }
+    // Skirts depth from edges error, same on both chunks sharing an edge
+    float skirtDepth = 0.0f;
 
-                model.meshMaterial[k] = mi + 1;
-                l = 0;
-            }
+    for (int lod = 1; lod < load->lodCount; lod++)
+    {
+        skirtDepth = fmaxf(skirtDepth, GetTerrainEdgeError(load, true, load->z, 1 << lod));
+        skirtDepth = fmaxf(skirtDepth, GetTerrainEdgeError(load, true, load->z + load->quadsZ, 1 << lod));
+        skirtDepth = fmaxf(skirtDepth, GetTerrainEdgeError(load, false, load->x, 1 << lod));
+        skirtDepth = fmaxf(skirtDepth, GetTerrainEdgeError(load, false, load->x + load->quadsX, 1 << lod));
+    }
 
-            // Process meshes per material, add triangles
-            model.meshes[k].vertices[l*9 + 0] = m3d->vertex[m3d->face[i].vertex[0]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 1] = m3d->vertex[m3d->face[i].vertex[0]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 2] = m3d->vertex[m3d->face[i].vertex[0]].z*m3d->scale;
-            model.meshes[k].vertices[l*9 + 3] = m3d->vertex[m3d->face[i].vertex[1]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 4] = m3d->vertex[m3d->face[i].vertex[1]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 5] = m3d->vertex[m3d->face[i].vertex[1]].z*m3d->scale;
-            model.meshes[k].vertices[l*9 + 6] = m3d->vertex[m3d->face[i].vertex[2]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 7] = m3d->vertex[m3d->face[i].vertex[2]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 8] = m3d->vertex[m3d->face[i].vertex[2]].z*m3d->scale;
+    skirtDepth = 2.0f*skirtDepth + load->size.y/255.0f;
 
-            // without vertex color (full transparency), we use the default color
-            if (model.meshes[k].colors != NULL)
-            {
-                if (m3d->vertex[m3d->face[i].vertex[0]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 0], &m3d->vertex[m3d->face[i].vertex[0]].color, 4);
-                if (m3d->vertex[m3d->face[i].vertex[1]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 4], &m3d->vertex[m3d->face[i].vertex[1]].color, 4);
-                if (m3d->vertex[m3d->face[i].vertex[2]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 8], &m3d->vertex[m3d->face[i].vertex[2]].color, 4);
-            }
+    mesh->vertexCount = gridCount + 2*(nx + 1) + 2*(nz + 1);
+    mesh->triangleCount = nx*nz*2 + 2*(2*nx + 2*nz);
+    mesh->vertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+    mesh->normals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+    mesh->texcoords = (float *)RL_MALLOC(mesh->vertexCount*2*sizeof(float));
+    mesh->indices = (unsigned short *)RL_MALLOC(mesh->triangleCount*3*sizeof(unsigned short));
 
-            if (m3d->face[i].texcoord[0] != M3D_UNDEF)
-            {
-                model.meshes[k].texcoords[l*6 + 0] = m3d->tmap[m3d->face[i].texcoord[0]].u;
-                model.meshes[k].texcoords[l*6 + 1] = 1.0f - m3d->tmap[m3d->face[i].texcoord[0]].v;
-                model.meshes[k].texcoords[l*6 + 2] = m3d->tmap[m3d->face[i].texcoord[1]].u;
-                model.meshes[k].texcoords[l*6 + 3] = 1.0f - m3d->tmap[m3d->face[i].texcoord[1]].v;
-                model.meshes[k].texcoords[l*6 + 4] = m3d->tmap[m3d->face[i].texcoord[2]].u;
-                model.meshes[k].texcoords[l*6 + 5] = 1.0f - m3d->tmap[m3d->face[i].texcoord[2]].v;
-            }
+    // Grid vertices, normals from full resolution heights (central differences)
+    for (int j = 0; j <= nz; j++)
+    {
+        int z = load->z + ((j*step < load->quadsZ)? j*step : load->quadsZ);
 
-            if (m3d->face[i].normal[0] != M3D_UNDEF)
-            {
-                model.meshes[k].normals[l*9 + 0] = m3d->vertex[m3d->face[i].normal[0]].x;
-                model.meshes[k].normals[l*9 + 1] = m3d->vertex[m3d->face[i].normal[0]].y;
-                model.meshes[k].normals[l*9 + 2] = m3d->vertex[m3d->face[i].normal[0]].z;
-                model.meshes[k].normals[l*9 + 3] = m3d->vertex[m3d->face[i].normal[1]].x;
-                model.meshes[k].normals[l*9 + 4] = m3d->vertex[m3d->face[i].normal[1]].y;
-                model.meshes[k].normals[l*9 + 5] = m3d->vertex[m3d->face[i].normal[1]].z;
-                model.meshes[k].normals[l*9 + 6] = m3d->vertex[m3d->face[i].normal[2]].x;
-                model.meshes[k].normals[l*9 + 7] = m3d->vertex[m3d->face[i].normal[2]].y;
-                model.meshes[k].normals[l*9 + 8] = m3d->vertex[m3d->face[i].normal[2]].z;
-            }
+        for (int i = 0; i <= nx; i++)
+        {
+            int x = load->x + ((i*step < load->quadsX)? i*step : load->quadsX);
+            int v = j*(nx + 1) + i;
+
+            int xl = (x > 0)? x - 1 : x, xr = (x < (load->width - 1))? x + 1 : x;
+            int zd = (z > 0)? z - 1 : z, zu = (z < (load->height - 1))? z + 1 : z;
+            Vector3 normal = { (TERRAIN_HEIGHT(xl, z) - TERRAIN_HEIGHT(xr, z))/((xr - xl)*scale.x), 1.0f,
+                (TERRAIN_HEIGHT(x, zd) - TERRAIN_HEIGHT(x, zu))/((zu - zd)*scale.z) };
+            normal = Vector3Normalize(normal);
+
+            mesh->vertices[v*3] = x*scale.x;
+            mesh->vertices[v*3 + 1] = TERRAIN_HEIGHT(x, z);
+            mesh->vertices[v*3 + 2] = z*scale.z;
+            mesh->normals[v*3] = normal.x;
+            mesh->normals[v*3 + 1] = normal.y;
+            mesh->normals[v*3 + 2] = normal.z;
+            mesh->texcoords[v*2] = (float)x/(load->width - 1);
+            mesh->texcoords[v*2 + 1] = (float)z/(load->height - 1);
+        }
+    }
 
-            // Add skin (vertex / bone weight pairs)
-            if (m3d->numbone && m3d->numskin)
-            {
-                for (n = 0; n < 3; n++)
-                {
-                    int skinid = m3d->vertex[m3d->face[i].vertex[n]].skinid;
+    // Grid triangles, same winding as GenMeshHeightmap()
+    int index = 0;
 
-                    // Check if there is a skin for this mesh, should be, just failsafe
-                    if (skinid != M3D_UNDEF && skinid < (int)m3d->numskin)
-                    {
-                        for (j = 0; j < 4; j++)
-                        {
-                            model.meshes[k].boneIds[l*12 + n*4 + j] = m3d->skin[skinid].boneid[j];
-                            model.meshes[k].boneWeights[l*12 + n*4 + j] = m3d->skin[skinid].weight[j];
-                        }
-                    }
-                    else
-                    {
-                        // raylib does not handle boneless meshes with skeletal animations, so
-                        // we put all vertices without a bone into a special "no bone" bone
-                        model.meshes[k].boneIds[l*12 + n*4] = m3d->numbone;
-                        model.meshes[k].boneWeights[l*12 + n*4] = 1.0f;
-                    }
-                }
-            }
+    for (int j = 0; j < nz; j++)
+    {
+        for (int i = 0; i < nx; i++)
+        {
+            unsigned short a = (unsigned short)(j*(nx + 1) + i);
+            unsigned short b = (unsigned short)(a + nx + 1);
+
+            mesh->indices[index++] = a;
+            mesh->indices[index++] = b;
+            mesh->indices[index++] = a + 1;
+            mesh->indices[index++] = a + 1;
+            mesh->indices[index++] = b;
+            mesh->indices[index++] = b + 1;
         }
+    }
 
-        // Load materials
-        for (i = 0; i < (int)m3d->nummaterial; i++)
-        {
-            model.materials[i + 1] = LoadMaterialDefault();
+    // Skirts: edges vertices copied down, faces pointing outwards
+    // NOTE: Edges order: bottom (z min), top (z max), left (x min), right (x max)
+    int skirt = gridCount;
 
-            for (j = 0; j < m3d->material[i].numprop; j++)
-            {
-                prop = &m3d->material[i].prop[j];
+    for (int edge = 0; edge < 4; edge++)
+    {
+        bool alongX = (edge < 2);
+        int count = alongX? nx + 1 : nz + 1;
+        bool flip = ((edge == 1) || (edge == 2));
 
-                switch (prop->type)
-                {
-                    case m3dp_Kd:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].color, &prop->value.color, 4);
-                        model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
-                    } break;
-                    case m3dp_Ks:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].color, &prop->value.color, 4);
-                    } break;
-                    case m3dp_Ns:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Ke:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].color, &prop->value.color, 4);
-                        model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].value = 0.0f;
-                    } break;
-                    case m3dp_Pm:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_METALNESS].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Pr:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Ps:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].color = WHITE;
-                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].value = prop->value.fnum;
-                    } break;
-                    default:
-                    {
-                        if (prop->type >= 128)
-                        {
-                            Image image = { 0 };
-                            image.data = m3d->texture[prop->value.textureid].d;
-                            image.width = m3d->texture[prop->value.textureid].w;
-                            image.height = m3d->texture[prop->value.textureid].h;
-                            image.mipmaps = 1;
-                            image.format = (m3d->texture[prop->value.textureid].f == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 :
-                                           ((m3d->texture[prop->value.textureid].f == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 :
-                                           ((m3d->texture[prop->value.textureid].f == 2)? PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
+        for (int k = 0; k < count; k++)
+        {
+            int v = 0;
+
+            if (edge == 0) v = k;
+            else if (edge == 1) v = nz*(nx + 1) + k;
+            else if (edge == 2) v = k*(nx + 1);
+            else v = k*(nx + 1) + nx;
+
+            int s = skirt + k;
+            mesh->vertices[s*3] = mesh->vertices[v*3];
+            mesh->vertices[s*3 + 1] = mesh->vertices[v*3 + 1] - skirtDepth;
+            mesh->vertices[s*3 + 2] = mesh->vertices[v*3 + 2];
+            mesh->normals[s*3] = mesh->normals[v*3];
+            mesh->normals[s*3 + 1] = mesh->normals[v*3 + 1];
+            mesh->normals[s*3 + 2] = mesh->normals[v*3 + 2];
+            mesh->texcoords[s*2] = mesh->texcoords[v*2];
+            mesh->texcoords[s*2 + 1] = mesh->texcoords[v*2 + 1];
+
+            if (k > 0)
+            {
+                int stride = alongX? 1 : nx + 1;
+                unsigned short a = (unsigned short)(v - stride), b = (unsigned short)v;
+                unsigned short sa = (unsigned short)(s - 1), sb = (unsigned short)s;
 
-                            switch (prop->type)
-                            {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
-                                default: break;
-                            }
-                        }
-                    } break;
+                if (!flip)
+                {
+                    mesh->indices[index++] = a; mesh->indices[index++] = b; mesh->indices[index++] = sa;
+                    mesh->indices[index++] = b; mesh->indices[index++] = sb; mesh->indices[index++] = sa;
+                }
+                else
+                {
+                    mesh->indices[index++] = b; mesh->indices[index++] = a; mesh->indices[index++] = sb;
+                    mesh->indices[index++] = a; mesh->indices[index++] = sa; mesh->indices[index++] = sb;
                 }
             }
         }
 
-        // Load bones
-        if (m3d->numbone)
+        skirt += count;
+    }
+
+    #undef TERRAIN_HEIGHT
+}
+
+// Upload terrain chunk mesh (main thread)
+static void FinalizeTerrainChunkAsync(void *data)
+{
+    TerrainChunkAsyncLoad *load = (TerrainChunkAsyncLoad *)data;
+
+    UploadMesh(&load->mesh, false);
+}
+
+// Get terrain chunk edge max height error at LOD step
+// NOTE: Edge is a heightmap row (alongX) or column, error measured against linear interpolation between LOD samples
+static float GetTerrainEdgeError(const TerrainChunkAsyncLoad *load, bool alongX, int line, int step)
+{
+    int start = alongX? load->x : load->z;
+    int quads = alongX? load->quadsX : load->quadsZ;
+    float maxError = 0.0f;
+
+    for (int k = 0; k <= quads; k++)
+    {
+        int ka = (k/step)*step;
+        int kb = (ka + step < quads)? ka + step : quads;
+        float t = (kb > ka)? (float)(k - ka)/(kb - ka) : 0.0f;
+
+        float ha = alongX? load->heights[line*load->width + start + ka] : load->heights[(start + ka)*load->width + line];
+        float hb = alongX? load->heights[line*load->width + start + kb] : load->heights[(start + kb)*load->width + line];
+        float h = alongX? load->heights[line*load->width + start + k] : load->heights[(start + k)*load->width + line];
+
+        maxError = fmaxf(maxError, fabsf(Lerp(ha, hb, t) - h));
+    }
+
+    return maxError*load->size.y/65535.0f;
+}
+
+// Load mesh vertex buffer packed data (NULL if not packed), packing registered in mesh
+// NOTE: Buffer index matches mesh vboId index, packed data size is returned in dataSize
+static void *LoadMeshPackedBuffer(Mesh *mesh, int buffer, unsigned int flags, int *dataSize)
+{
+    void *packed = NULL;
+
+    if ((buffer == 0) && (flags & MESH_PACK_POSITIONS))
+    {
+        // Positions quantized to mesh bounds with uniform scale, keeping normals directions under dequantization
+        // NOTE: Stored as 4 components for attributes alignment, unorm conversion is exact on all GL versions
+        BoundingBox bounds = GetMeshBoundingBox(*mesh);
+        float scale = fmaxf(bounds.max.x - bounds.min.x, fmaxf(bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z));
+        if (scale <= 0.0f) scale = 1.0f;
+
+        unsigned short *data = (unsigned short *)RL_CALLOC(mesh->vertexCount*4, sizeof(unsigned short));
+        float min[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+
+        for (int i = 0; i < mesh->vertexCount*3; i++)
         {
-            model.boneCount = m3d->numbone + 1;
-            model.bones = RL_CALLOC(model.boneCount, sizeof(BoneInfo));
-            model.bindPose = RL_CALLOC(model.boneCount, sizeof(Transform));
+            float value = (mesh->vertices[i] - min[i%3])/scale;
+            data[(i/3)*4 + i%3] = (unsigned short)(Clamp(value, 0.0f, 1.0f)*65535.0f + 0.5f);
+        }
 
-            for (i = 0; i < (int)m3d->numbone; i++)
-            {
-                model.bones[i].parent = m3d->bone[i].parent;
-                strncpy(model.bones[i].name, m3d->bone[i].name, sizeof(model.bones[i].name));
-                model.bindPose[i].translation.x = m3d->vertex[m3d->bone[i].pos].x*m3d->scale;
-                model.bindPose[i].translation.y = m3d->vertex[m3d->bone[i].pos].y*m3d->scale;
-                model.bindPose[i].translation.z = m3d->vertex[m3d->bone[i].pos].z*m3d->scale;
-                model.bindPose[i].rotation.x = m3d->vertex[m3d->bone[i].ori].x;
-                model.bindPose[i].rotation.y = m3d->vertex[m3d->bone[i].ori].y;
-                model.bindPose[i].rotation.z = m3d->vertex[m3d->bone[i].ori].z;
-                model.bindPose[i].rotation.w = m3d->vertex[m3d->bone[i].ori].w;
+        mesh->packFlags |= MESH_PACK_POSITIONS;
+        mesh->packOffset = (Vector4){ bounds.min.x, bounds.min.y, bounds.min.z, scale };
+        *dataSize = mesh->vertexCount*4*sizeof(unsigned short);
+        packed = data;
+    }
+    else if (((buffer == 1) || (buffer == 5)) && (flags & MESH_PACK_TEXCOORDS))
+    {
+        const float *texcoords = (buffer == 1)? mesh->texcoords : mesh->texcoords2;
+        bool normalized = true;
 
-                // TODO: if the orientation quaternion not normalized, then that's encoding scaling
-                model.bindPose[i].rotation = QuaternionNormalize(model.bindPose[i].rotation);
-                model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+        if (texcoords == NULL) return NULL;
 
-                // Child bones are stored in parent bone relative space, convert that into model space
-                if (model.bones[i].parent >= 0)
-                {
-                    model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
-                    model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
-                    model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
-                    model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
-                }
-            }
+        for (int i = 0; i < mesh->vertexCount*2; i++) if ((texcoords[i] < 0.0f) || (texcoords[i] > 1.0f)) { normalized = false; break; }
 
-            // Add a special "no bone" bone
-            model.bones[i].parent = -1;
-            strcpy(model.bones[i].name, "NO BONE");
-            model.bindPose[i].translation.x = 0.0f;
-            model.bindPose[i].translation.y = 0.0f;
-            model.bindPose[i].translation.z = 0.0f;
-            model.bindPose[i].rotation.x = 0.0f;
-            model.bindPose[i].rotation.y = 0.0f;
-            model.bindPose[i].rotation.z = 0.0f;
-            model.bindPose[i].rotation.w = 1.0f;
-            model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+        // Texcoords in [0..1] range are stored as unorm16, half-float otherwise (if supported)
+        if (normalized || rlIsVertexHalfFloatSupported())
+        {
+            unsigned short *data = (unsigned short *)RL_MALLOC(mesh->vertexCount*2*sizeof(unsigned short));
+
+            if (normalized) for (int i = 0; i < mesh->vertexCount*2; i++) data[i] = (unsigned short)(texcoords[i]*65535.0f + 0.5f);
+            else for (int i = 0; i < mesh->vertexCount*2; i++) data[i] = FloatToHalf(texcoords[i]);
+
+            if (buffer == 1) mesh->packFlags |= normalized? MESH_PACKED_TEXCOORDS_UNORM : MESH_PACKED_TEXCOORDS_HALF;
+            else mesh->packFlags |= normalized? MESH_PACKED_TEXCOORDS2_UNORM : MESH_PACKED_TEXCOORDS2_HALF;
+
+            mesh->packFlags |= MESH_PACK_TEXCOORDS;
+            *dataSize = mesh->vertexCount*2*sizeof(unsigned short);
+            packed = data;
         }
+    }
+    else if (((buffer == 2) || (buffer == 4)) && (flags & MESH_PACK_NORMALS))
+    {
+        // Normals (XYZ, padded) and tangents (XYZW) stored as snorm8
+        const float *vectors = (buffer == 2)? mesh->normals : mesh->tangents;
+        int components = (buffer == 2)? 3 : 4;
+        signed char *data = (signed char *)RL_CALLOC(mesh->vertexCount*4, sizeof(signed char));
 
-        // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
-        // called, but not before, however DrawMesh uses these if they exist (so not good if they are left empty).
-        if (m3d->numbone && m3d->numskin)
+        for (int i = 0; i < mesh->vertexCount*components; i++)
         {
-            for(i = 0; i < model.meshCount; i++)
-            {
-                memcpy(model.meshes[i].animVertices, model.meshes[i].vertices, model.meshes[i].vertexCount*3*sizeof(float));
-                memcpy(model.meshes[i].animNormals, model.meshes[i].normals, model.meshes[i].vertexCount*3*sizeof(float));
-            }
+            data[(i/components)*4 + i%components] = (signed char)roundf(Clamp(vectors[i], -1.0f, 1.0f)*127.0f);
         }
 
-        m3d_free(m3d);
-        UnloadFileData(fileData);
+        mesh->packFlags |= MESH_PACK_NORMALS;
+        *dataSize = mesh->vertexCount*4*sizeof(signed char);
+        packed = data;
     }
 
-    return model;
+    return packed;
 }
 
-#define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+// Set mesh vertex buffer attribute format (considering packing)
+// NOTE: Vertex buffer must be bound, buffer index matches mesh vboId index
+static void SetMeshVertexAttribute(Mesh mesh, int buffer, int location)
+{
+    switch (buffer)
+    {
+        case 0:
+        {
+            if (mesh.packFlags & MESH_PACK_POSITIONS) rlSetVertexAttribute(location, 3, RL_UNSIGNED_SHORT, 1, 4*sizeof(unsigned short), 0);
+            else rlSetVertexAttribute(location, 3, RL_FLOAT, 0, 0, 0);
+        } break;
+        case 1:
+        case 5:
+        {
+            unsigned int unorm = (buffer == 1)? MESH_PACKED_TEXCOORDS_UNORM : MESH_PACKED_TEXCOORDS2_UNORM;
+            unsigned int half = (buffer == 1)? MESH_PACKED_TEXCOORDS_HALF : MESH_PACKED_TEXCOORDS2_HALF;
+
+            if (mesh.packFlags & unorm) rlSetVertexAttribute(location, 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            else if (mesh.packFlags & half) rlSetVertexAttribute(location, 2, RL_HALF_FLOAT, 0, 0, 0);
+            else rlSetVertexAttribute(location, 2, RL_FLOAT, 0, 0, 0);
+        } break;
+        case 2:
+        case 4:
+        {
+            int components = (buffer == 2)? 3 : 4;
 
-// Load M3D animation data
-static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount)
+            if (mesh.packFlags & MESH_PACK_NORMALS) rlSetVertexAttribute(location, components, RL_BYTE, 1, 4*sizeof(signed char), 0);
+            else rlSetVertexAttribute(location, components, RL_FLOAT, 0, 0, 0);
+        } break;
+        default: break;
+    }
+}
+
+// Get mesh buffer data uploaded to GPU and data stride (bytes per vertex or index), NULL if not available
+// NOTE: Animated vertex data is provided for positions and normals if available, as uploaded by UploadMesh()
+static const void *GetMeshBufferData(Mesh mesh, int buffer, int *stride)
 {
-    m3d_t *m3d = NULL;
-    unsigned int bytesRead = 0;
-    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
-    ModelAnimation *animations = NULL;
-    int i = 0, j = 0;
+    const void *data = NULL;
 
-    *animCount = 0;
+    switch (buffer)
+    {
+        case 0: data = (mesh.animVertices != NULL)? mesh.animVertices : mesh.vertices; *stride = 3*sizeof(float); break;
+        case 1: data = mesh.texcoords; *stride = 2*sizeof(float); break;
+        case 2: data = (mesh.animNormals != NULL)? mesh.animNormals : mesh.normals; *stride = 3*sizeof(float); break;
+        case 3: data = mesh.colors; *stride = 4*sizeof(unsigned char); break;
+        case 4: data = mesh.tangents; *stride = 4*sizeof(float); break;
+        case 5: data = mesh.texcoords2; *stride = 2*sizeof(float); break;
+        case 6: data = mesh.indices; *stride = sizeof(unsigned short); break;
+        case 7: data = mesh.boneIds; *stride = 4*sizeof(unsigned char); break;
+        case 8: data = mesh.boneWeights; *stride = 4*sizeof(float); break;
+        default: *stride = 0; break;
+    }
 
-    if (fileData != NULL)
+    return data;
+}
+
+// Update mesh buffer data range (vertices or indices), CPU data is updated if data provided
+// NOTE: Dynamic meshes register the range as dirty (uploaded on draw), static meshes upload the range right away,
+// missing vertex attributes are allocated (zero-initialized) and attached to mesh vertex array
+static void UpdateMeshData(Mesh *mesh, int buffer, int first, int count, const void *data)
+{
+    if ((mesh == NULL) || (count <= 0)) return;
+
+    int total = (buffer == 6)? mesh->triangleCount*3 : mesh->vertexCount;
+    if ((first < 0) || ((first + count) > total))
     {
-        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+        TRACELOG(LOG_WARNING, "MESH: Update range out of bounds (%i/%i)", first + count, total);
+        return;
+    }
 
-        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+    int stride = 0;
+    void *cpuData = (void *)GetMeshBufferData(*mesh, buffer, &stride);
+
+    // Animated vertex data is updated by animation, provided data updates default vertex data
+    if (buffer == 0) cpuData = mesh->vertices;
+    if (buffer == 2) cpuData = mesh->normals;
+
+    if (cpuData == NULL)
+    {
+        if (buffer == 6)
         {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
-            UnloadFileData(fileData);
-            return NULL;
+            TRACELOG(LOG_WARNING, "MESH: Indices can not be updated for a non-indexed mesh");
+            return;
         }
-        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i animations, %i bones, %i skins", fileName,
-            m3d->numaction, m3d->numbone, m3d->numskin);
 
-        // No animation or bone+skin?
-        if (!m3d->numaction || !m3d->numbone || !m3d->numskin)
+        if ((buffer != 1) && (buffer != 2) && (buffer != 3)) return;
+
+        // Missing vertex attribute data allocated, attached to mesh vertex array if mesh is uploaded
+        cpuData = RL_CALLOC(mesh->vertexCount, stride);
+        if (buffer == 1) mesh->texcoords = (float *)cpuData;
+        else if (buffer == 2) mesh->normals = (float *)cpuData;
+        else if (buffer == 3) mesh->colors = (unsigned char *)cpuData;
+
+        if ((mesh->vboId != NULL) && (mesh->vboId[buffer] == 0))
         {
-            m3d_free(m3d);
-            UnloadFileData(fileData);
-            return NULL;
+            rlEnableVertexArray(mesh->vaoId);
+            mesh->vboId[buffer] = rlLoadVertexBuffer(NULL, mesh->vertexCapacity*stride, (mesh->dirtyRanges != NULL));
+            if (buffer == 3) rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            else SetMeshVertexAttribute(*mesh, buffer, buffer);
+            rlEnableVertexAttribute(buffer);
+            rlDisableVertexArray();
+
+            first = 0;
+            count = mesh->vertexCount;
         }
+    }
 
-        animations = RL_MALLOC(m3d->numaction*sizeof(ModelAnimation));
-        *animCount = m3d->numaction;
+    if (data != NULL) memcpy((unsigned char *)cpuData + first*stride, data, count*stride);
 
-        for (unsigned int a = 0; a < m3d->numaction; a++)
+    if ((mesh->vboId == NULL) || (mesh->vboId[buffer] == 0)) return;
+
+    bool packed = ((buffer == 0) && (mesh->packFlags & MESH_PACK_POSITIONS)) || (((buffer == 2) || (buffer == 4)) && (mesh->packFlags & MESH_PACK_NORMALS)) ||
+        ((buffer == 1) && (mesh->packFlags & (MESH_PACKED_TEXCOORDS_UNORM | MESH_PACKED_TEXCOORDS_HALF)));
+    if (packed)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Packed vertex attributes can not be updated, mesh must be uploaded again");
+        return;
+    }
+
+    // Animated vertex data is uploaded instead if available
+    if ((buffer == 0) && (mesh->animVertices != NULL)) return;
+    if ((buffer == 2) && (mesh->animNormals != NULL)) return;
+
+    if (mesh->dirtyRanges != NULL)
+    {
+        int *range = &mesh->dirtyRanges[buffer*2];
+
+        if (range[0] >= range[1]) { range[0] = first; range[1] = first + count; }
+        else
         {
-            animations[a].frameCount = m3d->action[a].durationmsec / M3D_ANIMDELAY;
-            animations[a].boneCount = m3d->numbone + 1;
-            animations[a].bones = RL_MALLOC((m3d->numbone + 1)*sizeof(BoneInfo));
-            animations[a].framePoses = RL_MALLOC(animations[a].frameCount*sizeof(Transform *));
-            // strncpy(animations[a].name, m3d->action[a].name, sizeof(animations[a].name));
-            TRACELOG(LOG_INFO, "MODEL: [%s] animation #%i: %i msec, %i frames", fileName, a, m3d->action[a].durationmsec, animations[a].frameCount);
+            if (first < range[0]) range[0] = first;
+            if ((first + count) > range[1]) range[1] = first + count;
+        }
+    }
+    else if (buffer == 6) rlUpdateVertexBufferElements(mesh->vboId[6], (unsigned char *)cpuData + first*stride, count*stride, first*stride);
+    else rlUpdateVertexBuffer(mesh->vboId[buffer], (unsigned char *)cpuData + first*stride, count*stride, first*stride);
+}
 
-            for (i = 0; i < (int)m3d->numbone; i++)
+// Upload dynamic mesh dirty ranges to GPU buffers, called before mesh is drawn
+// NOTE: Ranges covering most of buffer orphan buffer storage and upload all the data, so the update does not
+// wait for previous draws still using the buffer (per-frame deformation), small ranges are updated in place
+static void UploadMeshDirtyRanges(Mesh mesh)
+{
+    if ((mesh.dirtyRanges == NULL) || (mesh.vboId == NULL)) return;
+
+    for (int i = 0; i < MESH_DYNAMIC_BUFFERS; i++)
+    {
+        int *range = &mesh.dirtyRanges[i*2];
+        if (range[0] >= range[1]) continue;
+
+        int stride = 0;
+        const unsigned char *data = (const unsigned char *)GetMeshBufferData(mesh, i, &stride);
+        int count = (i == 6)? mesh.triangleCount*3 : mesh.vertexCount;
+        int capacity = (i == 6)? mesh.indexCapacity : mesh.vertexCapacity;
+        if (range[1] > count) range[1] = count;
+
+        // Indices buffer also stores LOD levels indices, never orphaned if available
+        bool orphan = (((range[1] - range[0])*2 >= count) && !((i == 6) && (mesh.lodCount > 1)));
+
+        if ((data != NULL) && (mesh.vboId[i] != 0) && (range[0] < range[1]))
+        {
+            if (i == 6)
             {
-                animations[a].bones[i].parent = m3d->bone[i].parent;
-                strncpy(animations[a].bones[i].name, m3d->bone[i].name, sizeof(animations[a].bones[i].name));
+                if (orphan) rlResizeVertexBufferElements(mesh.vboId[i], capacity*stride, true);
+                if (orphan) rlUpdateVertexBufferElements(mesh.vboId[i], data, count*stride, 0);
+                else rlUpdateVertexBufferElements(mesh.vboId[i], data + range[0]*stride, (range[1] - range[0])*stride, range[0]*stride);
             }
+            else
+            {
+                if (orphan) rlResizeVertexBuffer(mesh.vboId[i], capacity*stride, true);
+                if (orphan) rlUpdateVertexBuffer(mesh.vboId[i], data, count*stride, 0);
+                else rlUpdateVertexBuffer(mesh.vboId[i], data + range[0]*stride, (range[1] - range[0])*stride, range[0]*stride);
+            }
+        }
 
-            // A special, never transformed "no bone" bone, used for boneless vertices
-            animations[a].bones[i].parent = -1;
-            strcpy(animations[a].bones[i].name, "NO BONE");
+        range[0] = 0;
+        range[1] = 0;
+    }
+}
 
-            // M3D stores frames at arbitrary intervals with sparse skeletons. We need full skeletons at
-            // regular intervals, so let the M3D SDK do the heavy lifting and calculate interpolated bones
-            for (i = 0; i < animations[a].frameCount; i++)
-            {
-                animations[a].framePoses[i] = RL_MALLOC((m3d->numbone + 1)*sizeof(Transform));
+// Convert float to half-float bits (round to nearest)
+// NOTE: Values out of half-float range are clamped to infinity, denormals flushed to zero
+static unsigned short FloatToHalf(float x)
+{
+    unsigned int bits = 0;
+    memcpy(&bits, &x, sizeof(float));
 
-                m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
+    unsigned short sign = (unsigned short)((bits >> 16) & 0x8000);
+    int exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+    unsigned int mantissa = bits & 0x007fffff;
 
-                if (pose != NULL)
-                {
-                    for (j = 0; j < (int)m3d->numbone; j++)
-                    {
-                        animations[a].framePoses[i][j].translation.x = m3d->vertex[pose[j].pos].x*m3d->scale;
-                        animations[a].framePoses[i][j].translation.y = m3d->vertex[pose[j].pos].y*m3d->scale;
-                        animations[a].framePoses[i][j].translation.z = m3d->vertex[pose[j].pos].z*m3d->scale;
-                        animations[a].framePoses[i][j].rotation.x = m3d->vertex[pose[j].ori].x;
-                        animations[a].framePoses[i][j].rotation.y = m3d->vertex[pose[j].ori].y;
-                        animations[a].framePoses[i][j].rotation.z = m3d->vertex[pose[j].ori].z;
-                        animations[a].framePoses[i][j].rotation.w = m3d->vertex[pose[j].ori].w;
-                        animations[a].framePoses[i][j].rotation = QuaternionNormalize(animations[a].framePoses[i][j].rotation);
-                        animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
-
-                        // Child bones are stored in parent bone relative space, convert that into model space
-                        if (animations[a].bones[j].parent >= 0)
-                        {
-                            animations[a].framePoses[i][j].rotation = QuaternionMultiply(animations[a].framePoses[i][animations[a].bones[j].parent].rotation, animations[a].framePoses[i][j].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3RotateByQuaternion(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3Add(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].translation);
-                            animations[a].framePoses[i][j].scale = Vector3Multiply(animations[a].framePoses[i][j].scale, animations[a].framePoses[i][animations[a].bones[j].parent].scale);
-                        }
-                    }
+    if (exponent <= 0) return sign;                                   // Zero or denormal, flushed to zero
+    if (exponent >= 31) return sign | 0x7c00 | ((((bits >> 23) & 0xff) == 0xff) && mantissa? 0x200 : 0);   // Infinity or NaN
 
-                    // Default transform for the "no bone" bone
-                    animations[a].framePoses[i][j].translation.x = 0.0f;
-                    animations[a].framePoses[i][j].translation.y = 0.0f;
-                    animations[a].framePoses[i][j].translation.z = 0.0f;
-                    animations[a].framePoses[i][j].rotation.x = 0.0f;
-                    animations[a].framePoses[i][j].rotation.y = 0.0f;
-                    animations[a].framePoses[i][j].rotation.z = 0.0f;
-                    animations[a].framePoses[i][j].rotation.w = 1.0f;
-                    animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
-                    RL_FREE(pose);
-                }
+    unsigned short result = sign | (unsigned short)(exponent << 10) | (unsigned short)(mantissa >> 13);
+
+    // Round to nearest, mantissa overflow carries into exponent
+    if (mantissa & 0x1000) result++;
+
+    return result;
+}
+
+// Load model binary file animations (.rlm)
+static ModelAnimation *LoadModelAnimationsBinary(const char *fileName, unsigned int *animCount)
+{
+    ModelAnimation *animations = NULL;
+    unsigned int size = 0;
+    unsigned char *data = LoadFileDataMapped(fileName, &size);
+    const ModelBinaryHeader *header = GetModelBinaryHeader(data, size);
+
+    *animCount = 0;
+
+    if ((header != NULL) && (header->animationCount > 0))
+    {
+        const ModelBinaryAnimation *anims = (const ModelBinaryAnimation *)(data + sizeof(ModelBinaryHeader) + header->meshCount*sizeof(ModelBinaryMesh) +
+            header->materialCount*4*sizeof(float) + header->materialCount*header->mapCount*sizeof(ModelBinaryMap) + header->textureCount*sizeof(ModelBinaryTexture));
+
+        animations = (ModelAnimation *)RL_CALLOC(header->animationCount, sizeof(ModelAnimation));
+        *animCount = header->animationCount;
+
+        for (int i = 0; i < header->animationCount; i++)
+        {
+            ModelAnimation *anim = &animations[i];
+            const Transform *poses = (const Transform *)(data + anims[i].poses);
+
+            anim->boneCount = anims[i].boneCount;
+            anim->frameCount = anims[i].frameCount;
+            anim->bones = (BoneInfo *)RL_MALLOC(anim->boneCount*sizeof(BoneInfo));
+            memcpy(anim->bones, data + anims[i].bones, anim->boneCount*sizeof(BoneInfo));
+
+            anim->framePoses = (Transform **)RL_MALLOC(anim->frameCount*sizeof(Transform *));
+
+            for (int f = 0; f < anim->frameCount; f++)
+            {
+                anim->framePoses[f] = (Transform *)RL_MALLOC(anim->boneCount*sizeof(Transform));
+                memcpy(anim->framePoses[f], poses + f*anim->boneCount, anim->boneCount*sizeof(Transform));
             }
-        }
 
-        m3d_free(m3d);
-        UnloadFileData(fileData);
+            if (anims[i].frameTimes > 0)
+            {
+                anim->frameTimes = (float *)RL_MALLOC(anim->frameCount*sizeof(float));
+                memcpy(anim->frameTimes, data + anims[i].frameTimes, anim->frameCount*sizeof(float));
+            }
+        }
     }
+    else if (header == NULL) TRACELOG(LOG_WARNING, "MODEL: [%s] Model binary file not valid or version not supported", fileName);
+
+    UnloadFileDataMapped(data);
 
     return animations;
 }
+
+// Get model binary file header, validated (NULL if not valid)
+// NOTE: All tables and data blocks are checked to be contained in file data, accessed without further checks
+static const ModelBinaryHeader *GetModelBinaryHeader(const unsigned char *data, unsigned int size)
+{
+    if ((data == NULL) || (size < sizeof(ModelBinaryHeader))) return NULL;
+
+    const ModelBinaryHeader *header = (const ModelBinaryHeader *)data;
+
+    if ((memcmp(header->id, "rMDL", 4) != 0) || (header->version != MODEL_BINARY_VERSION) || (header->fileSize != size)) return NULL;
+    if ((header->meshCount < 0) || (header->materialCount < 0) || (header->mapCount < 0) || (header->textureCount < 0) ||
+        (header->boneCount < 0) || (header->animationCount < 0)) return NULL;
+
+    unsigned long long tablesSize = sizeof(ModelBinaryHeader) + (unsigned long long)header->meshCount*sizeof(ModelBinaryMesh) +
+        (unsigned long long)header->materialCount*4*sizeof(float) + (unsigned long long)header->materialCount*header->mapCount*sizeof(ModelBinaryMap) +
+        (unsigned long long)header->textureCount*sizeof(ModelBinaryTexture) + (unsigned long long)header->animationCount*sizeof(ModelBinaryAnimation);
+
+    if (tablesSize > size) return NULL;
+
+    #define MODEL_BINARY_BLOCK_VALID(offset, blockSize) (((offset) == 0) || (((offset)%MODEL_BINARY_ALIGNMENT == 0) && \
+        ((unsigned long long)(offset) + (unsigned long long)(blockSize) <= size)))
+
+    bool valid = true;
+    const ModelBinaryMesh *meshes = (const ModelBinaryMesh *)(data + sizeof(ModelBinaryHeader));
+    const ModelBinaryMap *maps = (const ModelBinaryMap *)((const float *)(meshes + header->meshCount) + header->materialCount*4);
+    const ModelBinaryTexture *textures = (const ModelBinaryTexture *)(maps + header->materialCount*header->mapCount);
+    const ModelBinaryAnimation *anims = (const ModelBinaryAnimation *)(textures + header->textureCount);
+    unsigned long long sizes[MODEL_BINARY_MESH_STREAMS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float), 0 };
+
+    for (int i = 0; (i < header->meshCount) && valid; i++)
+    {
+        if ((meshes[i].vertexCount <= 0) || (meshes[i].triangleCount <= 0) || (meshes[i].streams[0] == 0)) valid = false;
+
+        for (int s = 0; (s < MODEL_BINARY_MESH_STREAMS) && valid; s++)
+        {
+            unsigned long long streamSize = (s == (MODEL_BINARY_MESH_STREAMS - 1))? (unsigned long long)meshes[i].triangleCount*3*sizeof(unsigned short) : meshes[i].vertexCount*sizes[s];
+            if (!MODEL_BINARY_BLOCK_VALID(meshes[i].streams[s], streamSize)) valid = false;
+        }
+
+        // Non-indexed meshes vertices are triangles vertices, indices must reference mesh vertices
+        if (valid && (meshes[i].streams[MODEL_BINARY_MESH_STREAMS - 1] == 0) && (meshes[i].vertexCount < meshes[i].triangleCount*3)) valid = false;
+
+        if (valid && (meshes[i].streams[MODEL_BINARY_MESH_STREAMS - 1] > 0))
+        {
+            const unsigned short *indices = (const unsigned short *)(data + meshes[i].streams[MODEL_BINARY_MESH_STREAMS - 1]);
+            for (int k = 0; k < meshes[i].triangleCount*3; k++) if (indices[k] >= meshes[i].vertexCount) { valid = false; break; }
+        }
+    }
+
+    for (int i = 0; (i < header->materialCount*header->mapCount) && valid; i++)
+    {
+        if (maps[i].texture >= header->textureCount) valid = false;
+    }
+
+    for (int i = 0; (i < header->textureCount) && valid; i++)
+    {
+        if ((textures[i].width <= 0) || (textures[i].height <= 0) || (textures[i].data == 0) ||
+            !MODEL_BINARY_BLOCK_VALID(textures[i].data, GetPixelDataSize(textures[i].width, textures[i].height, textures[i].format))) valid = false;
+    }
+
+    if (valid && (header->boneCount > 0))
+    {
+        if ((header->bones == 0) || (header->bindPose == 0) || !MODEL_BINARY_BLOCK_VALID(header->bones, (unsigned long long)header->boneCount*sizeof(BoneInfo)) ||
+            !MODEL_BINARY_BLOCK_VALID(header->bindPose, (unsigned long long)header->boneCount*sizeof(Transform))) valid = false;
+    }
+
+    for (int i = 0; (i < header->animationCount) && valid; i++)
+    {
+        if ((anims[i].boneCount < 0) || (anims[i].frameCount < 0) || (anims[i].bones == 0) || (anims[i].poses == 0) ||
+            !MODEL_BINARY_BLOCK_VALID(anims[i].bones, (unsigned long long)anims[i].boneCount*sizeof(BoneInfo)) ||
+            !MODEL_BINARY_BLOCK_VALID(anims[i].poses, (unsigned long long)anims[i].frameCount*anims[i].boneCount*sizeof(Transform)) ||
+            !MODEL_BINARY_BLOCK_VALID(anims[i].frameTimes, (unsigned long long)anims[i].frameCount*sizeof(float))) valid = false;
+    }
+
+    #undef MODEL_BINARY_BLOCK_VALID
+
+    return valid? header : NULL;
+}
+
+// Decode model async load data (loader thread), glTF only
+static void DecodeModelAsync(void *data)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)data;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    load->gltf = LoadGLTFData(load->fileName, false);
+    load->decoded = true;
+#endif
+}
+
+// Finalize model async load (main thread)
+static void FinalizeModelAsync(void *data)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)data;
+
+    if (load->decoded)
+    {
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+        load->model = LoadGLTFTextures(load->gltf);
 #endif
+        SetupModelLoaded(&load->model, load->fileName);
+    }
+    else load->model = LoadModel(load->fileName);
+}
 
 #endif      // SUPPORT_MODULE_RMODELS
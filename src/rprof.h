@@ -0,0 +1,376 @@
+/**********************************************************************************************
+*
+*   rprof - Lightweight frame profiler, named CPU scopes recorded per thread
+*
+*   CONFIGURATION:
+*
+*   #define PROFILER_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   #define PROFILER_STANDALONE
+*       If defined, the library can be used as standalone with its own timer,
+*       otherwise raylib GetTime() is used for scopes timing
+*
+*   NOTES:
+*       Every thread records its scopes in its own events ring buffer (no locks required),
+*       threads are registered on their first scope, up to PROFILER_MAX_THREADS threads.
+*       Oldest events are overwritten once a thread ring buffer is full (PROFILER_MAX_EVENTS).
+*       Scope names are not copied, they must be string literals or remain valid until exported.
+*       Recorded events are exported as Chrome trace_event JSON (chrome://tracing, ui.perfetto.dev).
+*
+*   CONTRIBUTORS:
+*       Ramon Santamaria:   Supervision, review, update and maintenance
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RPROF_H
+#define RPROF_H
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Function specifiers definition
+#ifndef RLAPI
+    #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+#ifndef PROFILER_MAX_THREADS
+    #define PROFILER_MAX_THREADS        16      // Maximum number of threads recording scopes
+#endif
+#ifndef PROFILER_MAX_EVENTS
+    #define PROFILER_MAX_EVENTS       8192      // Maximum number of events kept per thread (ring buffer)
+#endif
+#ifndef PROFILER_MAX_DEPTH
+    #define PROFILER_MAX_DEPTH          32      // Maximum scopes nesting depth per thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+// NOTE: Below types are required for PROFILER_STANDALONE usage
+//----------------------------------------------------------------------------------
+#if defined(PROFILER_STANDALONE)
+    // Boolean type
+    #if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+        #include <stdbool.h>
+    #elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
+        typedef enum bool { false = 0, true = !false } bool;
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+RLAPI void BeginProfileScope(const char *name);         // Begin named CPU profile scope (current thread)
+RLAPI void EndProfileScope(void);                       // End latest CPU profile scope (current thread)
+RLAPI bool ExportProfileTrace(const char *fileName);    // Export recorded profile scopes as Chrome trace_event JSON file (.json)
+
+void MarkProfileFrame(unsigned int frame);              // Record a frame marker event (current thread), raylib calls it on EndDrawing()
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RPROF_H
+
+
+/***********************************************************************************
+*
+*   PROFILER IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(PROFILER_IMPLEMENTATION)
+
+#if defined(PROFILER_STANDALONE)
+#if defined(_WIN32)
+    #if defined(__cplusplus)
+    extern "C" {        // Prevents name mangling of functions
+    #endif
+    // Functions required to query time on Windows
+    int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);
+    int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
+    #if defined(__cplusplus)
+    }
+    #endif
+#else
+    #if defined(__linux__) && (_POSIX_C_SOURCE < 199309L)
+        #undef _POSIX_C_SOURCE
+        #define _POSIX_C_SOURCE 199309L // Required for CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #endif
+    #include <time.h>                   // Required for: clock_gettime()
+#endif
+#endif
+
+#include <stdlib.h>                 // Required for: calloc()
+#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef PROFILER_CALLOC
+    #define PROFILER_CALLOC(n,sz)   calloc(n,sz)
+#endif
+
+// Profile events are recorded in thread-local ring buffers
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+    #define PROFILER_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define PROFILER_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define PROFILER_THREAD_LOCAL _Thread_local
+#else
+    #define PROFILER_THREAD_LOCAL __thread
+#endif
+
+// Atomic operations required for threads registration and events publication
+#if defined(_MSC_VER)
+    #if defined(__cplusplus)
+    extern "C" {
+    #endif
+    long _InterlockedIncrement(long volatile *addend);
+    #if defined(__cplusplus)
+    }
+    #endif
+    #pragma intrinsic(_InterlockedIncrement)
+    #define PROFILER_ATOMIC_INCREMENT(x)    (_InterlockedIncrement(x) - 1)
+    #define PROFILER_ATOMIC_STORE(x, v)     (*(x) = (v))    // NOTE: MSVC volatile stores have release semantics
+    #define PROFILER_ATOMIC_LOAD(x)         (*(x))          // NOTE: MSVC volatile loads have acquire semantics
+#else
+    #define PROFILER_ATOMIC_INCREMENT(x)    __atomic_fetch_add(x, 1, __ATOMIC_ACQ_REL)
+    #define PROFILER_ATOMIC_STORE(x, v)     __atomic_store_n(x, v, __ATOMIC_RELEASE)
+    #define PROFILER_ATOMIC_LOAD(x)         __atomic_load_n(x, __ATOMIC_ACQUIRE)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Profile event, times in seconds
+typedef struct {
+    const char *name;               // Event name (not copied)
+    double begin;                   // Event begin time
+    double duration;                // Event duration, negative for frame markers
+    unsigned int frame;             // Event frame (frame markers only)
+} ProfileEvent;
+
+// Profile thread data, events are only written by owner thread
+typedef struct {
+    ProfileEvent events[PROFILER_MAX_EVENTS];   // Events ring buffer
+    volatile long eventCount;       // Events recorded (published to exporting thread)
+
+    const char *stackNames[PROFILER_MAX_DEPTH]; // Open scopes names
+    double stackTimes[PROFILER_MAX_DEPTH];      // Open scopes begin times
+    int stackCounter;               // Open scopes counter (could exceed PROFILER_MAX_DEPTH)
+} ProfileThread;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static ProfileThread *profileThreads[PROFILER_MAX_THREADS] = { 0 };    // Registered threads data
+static volatile long profileThreadsCount = 0;                           // Registered threads counter
+static PROFILER_THREAD_LOCAL ProfileThread *profileThread = NULL;       // Current thread data
+static PROFILER_THREAD_LOCAL bool profileThreadDisabled = false;        // Current thread could not be registered
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetProfileTime(void);                     // Get profiler time in seconds (same timer as GetTime())
+static ProfileThread *GetProfileThread(void);           // Get current thread data, thread is registered on first call
+static void PushProfileEvent(ProfileThread *thread, ProfileEvent event);  // Push event into thread ring buffer
+static void WriteProfileString(FILE *file, const char *text);   // Write JSON escaped string
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Begin named CPU profile scope (current thread)
+void BeginProfileScope(const char *name)
+{
+    ProfileThread *thread = GetProfileThread();
+    if (thread == NULL) return;
+
+    if (thread->stackCounter < PROFILER_MAX_DEPTH)
+    {
+        thread->stackNames[thread->stackCounter] = name;
+        thread->stackTimes[thread->stackCounter] = GetProfileTime();
+    }
+
+    thread->stackCounter++;     // NOTE: Scopes over max depth are tracked but not recorded
+}
+
+// End latest CPU profile scope (current thread)
+void EndProfileScope(void)
+{
+    ProfileThread *thread = GetProfileThread();
+    if ((thread == NULL) || (thread->stackCounter <= 0)) return;
+
+    thread->stackCounter--;
+
+    if (thread->stackCounter < PROFILER_MAX_DEPTH)
+    {
+        ProfileEvent event = { 0 };
+        event.name = thread->stackNames[thread->stackCounter];
+        event.begin = thread->stackTimes[thread->stackCounter];
+        event.duration = GetProfileTime() - event.begin;
+
+        PushProfileEvent(thread, event);
+    }
+}
+
+// Record a frame marker event (current thread)
+void MarkProfileFrame(unsigned int frame)
+{
+    ProfileThread *thread = GetProfileThread();
+    if (thread == NULL) return;
+
+    ProfileEvent event = { 0 };
+    event.name = "Frame";
+    event.begin = GetProfileTime();
+    event.duration = -1.0;
+    event.frame = frame;
+
+    PushProfileEvent(thread, event);
+}
+
+// Export recorded profile scopes as Chrome trace_event JSON file (.json)
+// NOTE: Times are exported in microseconds, one trace thread (tid) per registered thread,
+// threads recording while exporting could overwrite their oldest events being exported
+bool ExportProfileTrace(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    int threadCount = (int)PROFILER_ATOMIC_LOAD(&profileThreadsCount);
+    if (threadCount > PROFILER_MAX_THREADS) threadCount = PROFILER_MAX_THREADS;
+
+    bool first = true;
+    fprintf(file, "{\"traceEvents\":[\n");
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        ProfileThread *thread = profileThreads[t];
+        if (thread == NULL) continue;   // Thread registered but not allocated yet
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%i,\"args\":{\"name\":\"Thread %i\"}}", first? "" : ",\n", t, t);
+        first = false;
+
+        long count = PROFILER_ATOMIC_LOAD(&thread->eventCount);
+        long start = (count > PROFILER_MAX_EVENTS)? (count - PROFILER_MAX_EVENTS) : 0;
+
+        for (long i = start; i < count; i++)
+        {
+            ProfileEvent event = thread->events[i%PROFILER_MAX_EVENTS];
+
+            fprintf(file, ",\n{\"name\":");
+            WriteProfileString(file, event.name);
+
+            if (event.duration < 0.0) fprintf(file, ",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":0,\"tid\":%i,\"args\":{\"frame\":%u}}", event.begin*1000000.0, t, event.frame);
+            else fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%i}", event.begin*1000000.0, event.duration*1000000.0, t);
+        }
+    }
+
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(file);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Get profiler time in seconds
+static double GetProfileTime(void)
+{
+    double time = 0.0;
+
+#if !defined(PROFILER_STANDALONE)
+    time = GetTime();       // Same timer as frame timing, required to attribute scopes to frames
+#else
+#if defined(_WIN32)
+    unsigned long long int clockFrequency, currentTime;
+
+    QueryPerformanceFrequency(&clockFrequency);
+    QueryPerformanceCounter(&currentTime);
+
+    time = (double)currentTime/clockFrequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    time = (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+#endif
+
+    return time;
+}
+
+// Get current thread data, thread is registered on first call
+static ProfileThread *GetProfileThread(void)
+{
+    if ((profileThread == NULL) && !profileThreadDisabled)
+    {
+        long index = PROFILER_ATOMIC_INCREMENT(&profileThreadsCount);
+
+        if (index < PROFILER_MAX_THREADS)
+        {
+            // NOTE: Threads data is kept for the program lifetime, other threads could be exporting it
+            profileThread = (ProfileThread *)PROFILER_CALLOC(1, sizeof(ProfileThread));
+            profileThreads[index] = profileThread;
+        }
+
+        if (profileThread == NULL) profileThreadDisabled = true;
+    }
+
+    return profileThread;
+}
+
+// Push event into thread ring buffer
+static void PushProfileEvent(ProfileThread *thread, ProfileEvent event)
+{
+    long count = thread->eventCount;    // NOTE: Only owner thread writes events
+
+    thread->events[count%PROFILER_MAX_EVENTS] = event;
+    PROFILER_ATOMIC_STORE(&thread->eventCount, count + 1);
+}
+
+// Write JSON escaped string
+static void WriteProfileString(FILE *file, const char *text)
+{
+    fputc('"', file);
+
+    for (int i = 0; (text != NULL) && (text[i] != '\0'); i++)
+    {
+        if ((text[i] == '"') || (text[i] == '\\')) fputc('\\', file);
+        if ((unsigned char)text[i] >= 0x20) fputc(text[i], file);
+    }
+
+    fputc('"', file);
+}
+
+#endif // PROFILER_IMPLEMENTATION
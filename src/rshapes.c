@@ -23,6 +23,17 @@
 *   #define SUPPORT_QUADS_DRAW_MODE
 *       Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*   #define SUPPORT_SPATIAL_INDEX
+*       Spatial indices module is included (rspatial.h), 2D rectangles grid and 3D boxes dynamic tree
+*       for broadphase collision and picking queries
+*
+*   #define SUPPORT_SIMD_SHAPES_COLLISION
+*       Use SSE2/NEON/WASM SIMD instructions for batched 2d collision tests (CheckCollisionRecsBatch()...),
+*       scalar fallback if not available
+*
+*   #define SHAPES_SDF_MAX_INSTANCES
+*       Maximum shapes queued in SDF shapes mode (BeginShapesSdfMode()) before they are drawn
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -54,11 +65,39 @@
 
 #if defined(SUPPORT_MODULE_RSHAPES)
 
+#include "utils.h"      // Required for: TRACELOG()
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#if defined(SUPPORT_SIMD_RAYMATH)
+    #define RAYMATH_SIMD            // Use SIMD instructions for raymath hot functions
+#endif
+#include "raymath.h"    // Required for: MatrixMultiply() [Used in DrawShapesSdf()]
 
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_MALLOC(), RL_CALLOC(), RL_FREE(), qsort()
+#include <string.h>     // Required for: memcpy()
+
+// SIMD batched collision tests (CheckCollisionRecsBatch()...), scalar fallback if not available
+#if defined(SUPPORT_SIMD_SHAPES_COLLISION)
+    #if defined(__wasm_simd128__)
+        #define RSHAPES_SIMD_WASM
+        #include <wasm_simd128.h>           // Required for: WebAssembly SIMD intrinsics
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RSHAPES_SIMD_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RSHAPES_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
+
+#if defined(SUPPORT_SPATIAL_INDEX)
+    #define SPATIAL_IMPLEMENTATION
+    #define SPATIAL_MALLOC(sz)          RL_MALLOC(sz)
+    #define SPATIAL_REALLOC(ptr,sz)     RL_REALLOC(ptr,sz)
+    #define SPATIAL_FREE(ptr)           RL_FREE(ptr)
+    #include "rspatial.h"       // Spatial indices functionality
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -71,12 +110,120 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef MAX_CIRCLE_SEGMENTS
+    #define MAX_CIRCLE_SEGMENTS        256      // Maximum segments for adaptive circles tessellation
+#endif
+#ifndef MAX_CIRCLE_TABLES
+    #define MAX_CIRCLE_TABLES           16      // Maximum circle and arcs sin/cos tables cached
+#endif
+#ifndef MAX_SHAPES_TEXTURES
+    #define MAX_SHAPES_TEXTURES         16      // Maximum textures with a shapes region (AddShapesTexture())
+#endif
+#ifndef SHAPES_SDF_MAX_INSTANCES
+    #define SHAPES_SDF_MAX_INSTANCES  8192      // Maximum SDF shapes queued before drawing them
+#endif
+
+#ifndef MAX_PATH_CURVE_SEGMENTS
+    #define MAX_PATH_CURVE_SEGMENTS   1024      // Maximum segments for a path curve flattening
+#endif
+#ifndef PATH_MITER_LIMIT
+    #define PATH_MITER_LIMIT          4.0f      // Path miter joins limit (miter length/half thickness), bevel joins over it
+#endif
+
+#ifndef MAX_POLYGON_INDEX_ROWS
+    #define MAX_POLYGON_INDEX_ROWS    1024      // Maximum rows for a polygon index
+#endif
+
+#define SHAPES_SDF_INSTANCE_FLOATS      12      // SDF shape instance data: center and half size, axis, corner radius and thickness, color
+
+// SIMD 4 floats operations used by batched collision tests, comparisons return lanes masks,
+// SIMD4_MASK() gets lanes masks as 4 bits (first lane on lowest bit)
+#if defined(RSHAPES_SIMD_WASM)
+    #define RSHAPES_SIMD
+    #define SIMD4_LOAD(ptr)     wasm_v128_load(ptr)
+    #define SIMD4_SET1(x)       wasm_f32x4_splat(x)
+    #define SIMD4_ADD(a, b)     wasm_f32x4_add(a, b)
+    #define SIMD4_SUB(a, b)     wasm_f32x4_sub(a, b)
+    #define SIMD4_MUL(a, b)     wasm_f32x4_mul(a, b)
+    #define SIMD4_ABS(a)        wasm_f32x4_abs(a)
+    #define SIMD4_LT(a, b)      wasm_f32x4_lt(a, b)
+    #define SIMD4_LE(a, b)      wasm_f32x4_le(a, b)
+    #define SIMD4_GT(a, b)      wasm_f32x4_gt(a, b)
+    #define SIMD4_GE(a, b)      wasm_f32x4_ge(a, b)
+    #define SIMD4_AND(a, b)     wasm_v128_and(a, b)
+    #define SIMD4_OR(a, b)      wasm_v128_or(a, b)
+    #define SIMD4_MASK(m)       wasm_i32x4_bitmask(m)
+#elif defined(RSHAPES_SIMD_SSE2)
+    #define RSHAPES_SIMD
+    #define SIMD4_LOAD(ptr)     _mm_loadu_ps(ptr)
+    #define SIMD4_SET1(x)       _mm_set1_ps(x)
+    #define SIMD4_ADD(a, b)     _mm_add_ps(a, b)
+    #define SIMD4_SUB(a, b)     _mm_sub_ps(a, b)
+    #define SIMD4_MUL(a, b)     _mm_mul_ps(a, b)
+    #define SIMD4_ABS(a)        _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)))
+    #define SIMD4_LT(a, b)      _mm_cmplt_ps(a, b)
+    #define SIMD4_LE(a, b)      _mm_cmple_ps(a, b)
+    #define SIMD4_GT(a, b)      _mm_cmpgt_ps(a, b)
+    #define SIMD4_GE(a, b)      _mm_cmpge_ps(a, b)
+    #define SIMD4_AND(a, b)     _mm_and_ps(a, b)
+    #define SIMD4_OR(a, b)      _mm_or_ps(a, b)
+    #define SIMD4_MASK(m)       _mm_movemask_ps(m)
+#elif defined(RSHAPES_SIMD_NEON)
+    #define RSHAPES_SIMD
+    #define SIMD4_LOAD(ptr)     vld1q_f32(ptr)
+    #define SIMD4_SET1(x)       vdupq_n_f32(x)
+    #define SIMD4_ADD(a, b)     vaddq_f32(a, b)
+    #define SIMD4_SUB(a, b)     vsubq_f32(a, b)
+    #define SIMD4_MUL(a, b)     vmulq_f32(a, b)
+    #define SIMD4_ABS(a)        vabsq_f32(a)
+    #define SIMD4_LT(a, b)      vcltq_f32(a, b)
+    #define SIMD4_LE(a, b)      vcleq_f32(a, b)
+    #define SIMD4_GT(a, b)      vcgtq_f32(a, b)
+    #define SIMD4_GE(a, b)      vcgeq_f32(a, b)
+    #define SIMD4_AND(a, b)     vandq_u32(a, b)
+    #define SIMD4_OR(a, b)      vorrq_u32(a, b)
+    #define SIMD4_MASK(m)       GetSimdLanesMask(m)
+#endif
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle arc points table for an angles range and segments count
+typedef struct CircleTable {
+    int segments;                               // Segments count (0: table not used)
+    float startAngle;                           // Arc start angle (degrees)
+    float endAngle;                             // Arc end angle (degrees)
+    unsigned int lastUse;                       // Last use counter, least recently used table is replaced
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];    // Unit circle arc points (sin, cos), segments + 1 points
+} CircleTable;
+
+// Texture region used on shapes drawing when texture is current (no draw call break)
+typedef struct ShapesTexture {
+    Texture2D texture;                          // Texture containing a white region (i.e. sprites atlas)
+    Rectangle source;                           // White region source rectangle
+} ShapesTexture;
+
+// Path contour, points range in path points
+typedef struct PathContour {
+    int first;                                  // Contour first point index
+    int count;                                  // Contour points count
+    bool closed;                                // Contour closed (last point joined to first one)
+} PathContour;
+
+#if defined(RSHAPES_SIMD_WASM)
+typedef v128_t simd4f;                          // SIMD 4 floats
+#elif defined(RSHAPES_SIMD_SSE2)
+typedef __m128 simd4f;                          // SIMD 4 floats
+#elif defined(RSHAPES_SIMD_NEON)
+typedef float32x4_t simd4f;                     // SIMD 4 floats
+#endif
+
+// Polygon index row edge sorting key
+typedef struct PolygonIndexEdge {
+    float x;                                    // Edge x at row middle
+    int edge;                                   // Edge index
+} PolygonIndexEdge;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -84,10 +231,68 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static Texture2D texShapesDefault = { 1, 1, 1, 1, 7 };  // Texture used on shapes drawing by default (SetShapesTexture())
+static Rectangle texShapesDefaultRec = { 0.0f, 0.0f, 1.0f, 1.0f };  // Texture source rectangle used on shapes drawing by default
+static ShapesTexture shapesTextures[MAX_SHAPES_TEXTURES] = { 0 };   // Textures with a shapes region, used if current on batch
+static int shapesTextureCount = 0;                      // Textures with a shapes region count
+
+static float shapesCircleError = 0.0f;                  // Adaptive circles tessellation max error in screen pixels (0: fixed segments)
+static CircleTable circleTables[MAX_CIRCLE_TABLES] = { 0 };  // Circle sin/cos tables cache
+static unsigned int circleTablesCounter = 0;            // Circle tables use counter
+
+static Vector2 *pathPoints = NULL;                      // Path points, all contours
+static int pathPointCount = 0;                          // Path points count
+static int pathPointCapacity = 0;                       // Path points allocated
+static PathContour *pathContours = NULL;                // Path contours
+static int pathContourCount = 0;                        // Path contours count
+static int pathContourCapacity = 0;                     // Path contours allocated
+static bool pathContourOpen = false;                    // Path last contour accepts points (not moved or closed)
+static Vector2 pathPen = { 0 };                         // Path pen position, curves start
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool shapesSdfMode = false;                      // SDF shapes mode active (BeginShapesSdfMode())
+static Shader shapesSdfShader = { 0 };                  // SDF shapes instancing shader
+static bool shapesSdfShaderFailed = false;              // SDF shapes shader failed to load (or instancing not supported), shapes tessellated
+static int shapesSdfShaderLocs[3] = { -1, -1, -1 };     // SDF shapes shader instance attributes locations: rectangle, parameters, color
+static int shapesSdfPixelSizeLoc = -1;                  // SDF shapes shader pixel size uniform location (antialiasing width)
+static unsigned int shapesSdfVaoId = 0;                 // SDF shapes quad vertex array id
+static unsigned int shapesSdfVboId = 0;                 // SDF shapes quad corners vertex buffer id
+static unsigned int shapesSdfInstancesId = 0;           // SDF shapes instances vertex buffer id
+static float *shapesSdfInstances = NULL;                // SDF shapes queued instances data
+static int shapesSdfCount = 0;                          // SDF shapes queued instances count
+static rlRenderBatchCallback shapesSdfPrevCallback = NULL;  // Render batch callback replaced on SDF shapes mode (chained)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void SetShapesTextureCurrent(void);                          // Set shapes texture for next vertex, current batch texture kept if it contains a shapes region
+static int GetCircleSegments(float radius, float arcAngle, float maxError); // Get segments required for an arc, error bounded on screen
+static const Vector2 *GetCircleTable(int segments);                 // Get unit circle points table for segments count (cached)
+static const Vector2 *GetArcTable(float startAngle, float endAngle, int segments);  // Get unit circle arc points table for angles range and segments count (cached)
+static float GetShapesScale(void);                                  // Get shapes units to screen pixels scale (2D camera zoom)
+static float GetPathTolerance(void);                                // Get path curves flattening tolerance in shapes units
+static int GetBezierCubicSegments(Vector2 p1, Vector2 c1, Vector2 c2, Vector2 p2, float tolerance);  // Get cubic bezier segments required for flatness tolerance
+static void AddPathPoint(Vector2 point);                            // Add point to current path contour (started if required)
+static void DrawPathTriangle(Vector2 v1, Vector2 v2, Vector2 v3);   // Draw path triangle, vertex order fixed
+static void DrawPathArc(Vector2 center, Vector2 from, float angle, float radius);  // Draw path arc as a triangles fan
+static void DrawPathJoin(Vector2 point, Vector2 prevDir, Vector2 prevNormal, Vector2 dir, Vector2 normal, int join);  // Draw path join between two segments
+static int GetSplineCurveCount(int type, int pointCount);           // Get spline cubic curves count for control points count
+static void GetSplineCurve(const Spline *spline, int curve, Vector2 *bezier);  // Get spline curve as cubic bezier control points
+static void UpdateSplineTessellation(Spline *spline);               // Update spline tessellation if required (points changed or zoom level crossed)
+static int GetPolygonIndexRow(PolygonIndex index, float y);         // Get polygon index row for a y coordinate (clamped)
+static int ComparePolygonIndexEdges(const void *a, const void *b);  // Compare polygon index row edges by x (qsort)
+static int StoreCollisionsMask(int mask, int lanes, bool *results); // Store batched collision test lanes results (optional), returns collisions count
+#if defined(RSHAPES_SIMD_NEON)
+static int GetSimdLanesMask(uint32x4_t mask);                       // Get SIMD lanes masks as 4 bits (first lane on lowest bit)
+#endif
+static bool QueueShapeSdf(Vector2 center, Vector2 size, Vector2 axis, float radius, float thick, Color color);  // Queue SDF shape quad, returns false if shape must be tessellated
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool LoadShapesSdfShader(void);                              // Load SDF shapes shader and quad vertex data
+static void DrawShapesSdf(void);                                    // Draw SDF shapes queued, one instanced draw call
+static void DrawShapesSdfCallback(void);                            // Render batch callback, queued SDF shapes drawn before batch vertex data
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -98,10 +303,84 @@ static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic eas
 // defining a font char white rectangle would allow drawing everything in a single draw call
 void SetShapesTexture(Texture2D texture, Rectangle source)
 {
+    texShapesDefault = texture;
+    texShapesDefaultRec = source;
     texShapes = texture;
     texShapesRec = source;
 }
 
+// Add texture white region to be used on shapes drawing while texture is current on batch
+// NOTE: Shapes drawn between sprites of the same texture (i.e. sprites atlas) do not require a new draw call,
+// atlas builder pages get their white region added automatically (AddAtlasImage())
+void AddShapesTexture(Texture2D texture, Rectangle source)
+{
+    if (texture.id == 0) return;
+
+    for (int i = 0; i < shapesTextureCount; i++)
+    {
+        if (shapesTextures[i].texture.id == texture.id)
+        {
+            shapesTextures[i] = (ShapesTexture){ texture, source };
+            return;
+        }
+    }
+
+    if (shapesTextureCount < MAX_SHAPES_TEXTURES) shapesTextures[shapesTextureCount++] = (ShapesTexture){ texture, source };
+    else TRACELOG(LOG_WARNING, "SHAPES: Maximum shapes textures reached (%i)", MAX_SHAPES_TEXTURES);
+}
+
+// Remove texture white region used on shapes drawing
+void RemoveShapesTexture(Texture2D texture)
+{
+    for (int i = 0; i < shapesTextureCount; i++)
+    {
+        if (shapesTextures[i].texture.id == texture.id)
+        {
+            shapesTextures[i] = shapesTextures[shapesTextureCount - 1];
+            shapesTextureCount--;
+            break;
+        }
+    }
+}
+
+// Set shapes curves tessellation max error in screen pixels (0: fixed segments)
+// NOTE: Circles and ellipses segments are derived from their radius on screen (2D camera zoom considered),
+// shapes with user-provided segments keep them, automatic segments (segments < minimum) use this error if set
+void SetShapesTessellation(float maxError)
+{
+    shapesCircleError = (maxError > 0.0f)? maxError : 0.0f;
+}
+
+// Begin SDF shapes mode, supported shapes are drawn as one quad evaluating a distance field (antialiased)
+// NOTE: Supported shapes: DrawCircle*(), DrawCircleLines(), full DrawRing(), DrawLineEx(), DrawRectangleRounded*(),
+// shapes are queued and drawn instanced in submission order with render batch vertex data
+void BeginShapesSdfMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shapesSdfMode) return;
+    if ((shapesSdfShader.id == 0) && !LoadShapesSdfShader()) return;
+
+    shapesSdfMode = true;
+    shapesSdfPrevCallback = rlGetRenderBatchCallback();
+    rlSetRenderBatchCallback(DrawShapesSdfCallback);
+#endif
+}
+
+// End SDF shapes mode, shapes queued are drawn
+void EndShapesSdfMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!shapesSdfMode) return;
+
+    DrawShapesSdf();
+    shapesSdfMode = false;
+
+    // Previous callback restored, unless replaced while mode was active
+    if (rlGetRenderBatchCallback() == DrawShapesSdfCallback) rlSetRenderBatchCallback(shapesSdfPrevCallback);
+    shapesSdfPrevCallback = NULL;
+#endif
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -112,7 +391,7 @@ void DrawPixel(int posX, int posY, Color color)
 void DrawPixelV(Vector2 position, Color color)
 {
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
 
@@ -179,6 +458,9 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 
     if ((length > 0) && (thick > 0))
     {
+        Vector2 center = { (startPos.x + endPos.x)/2.0f, (startPos.y + endPos.y)/2.0f };
+        if (QueueShapeSdf(center, (Vector2){ length/2.0f, thick/2.0f }, (Vector2){ delta.x/length, delta.y/length }, 0.0f, 0.0f, color)) return;
+
         float scale = thick/(2*length);
         Vector2 radius = { -scale*delta.y, scale*delta.x };
         Vector2 strip[4] = {
@@ -359,20 +641,15 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+    if (segments < minSegments) segments = GetCircleSegments(radius, endAngle - startAngle, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
 
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *arc = GetArcTable(startAngle, endAngle, segments);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         // NOTE: Every QUAD actually represents two segments
@@ -384,15 +661,15 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
+            rlVertex2f(center.x + arc[index + 2].x*radius, center.y + arc[index + 2].y*radius);
 
-            angle += (stepLength*2);
+            index += 2;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -404,10 +681,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -422,10 +699,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -447,17 +724,12 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+    if (segments < minSegments) segments = GetCircleSegments(radius, endAngle - startAngle, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
 
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *arc = GetArcTable(startAngle, endAngle, segments);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -465,24 +737,24 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
         }
     rlEnd();
 }
@@ -491,6 +763,31 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    SetShapesTextureCurrent();
+
+    rlBegin(RL_QUADS);
+        // NOTE: Every QUAD actually represents two segments
+        for (int i = 0; i < 360; i += 20)
+        {
+            rlColor4ub(color1.r, color1.g, color1.b, color1.a);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f((float)centerX, (float)centerY);
+
+            rlColor4ub(color2.r, color2.g, color2.b, color2.a);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radius, (float)centerY + cosf(DEG2RAD*i)*radius);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radius, (float)centerY + cosf(DEG2RAD*(i + 10))*radius);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 20))*radius, (float)centerY + cosf(DEG2RAD*(i + 20))*radius);
+        }
+    rlEnd();
+
+    rlSetTexture(0);
+#else
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
         {
@@ -502,98 +799,97 @@ void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Co
             rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radius, (float)centerY + cosf(DEG2RAD*(i + 10))*radius);
         }
     rlEnd();
+#endif
 }
 
 // Draw a color-filled circle (Vector version)
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues
 void DrawCircleV(Vector2 center, float radius, Color color)
 {
-    DrawCircleSector(center, radius, 0, 360, 36, color);
+    if (QueueShapeSdf(center, (Vector2){ radius, radius }, (Vector2){ 1.0f, 0.0f }, radius, 0.0f, color)) return;
+
+    if (shapesCircleError > 0.0f) DrawEllipsePro(center, (Vector2){ radius, radius }, (Vector2){ 0.0f, 0.0f }, 0.0f, color);
+    else DrawCircleSector(center, radius, 0, 360, 36, color);
 }
 
 // Draw circle outline
 void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 {
-    rlBegin(RL_LINES);
-        rlColor4ub(color.r, color.g, color.b, color.a);
+    // NOTE: Negative thickness is one screen pixel line
+    if (QueueShapeSdf((Vector2){ (float)centerX, (float)centerY }, (Vector2){ radius, radius }, (Vector2){ 1.0f, 0.0f }, radius, -1.0f, color)) return;
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
-        {
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radius, centerY + cosf(DEG2RAD*i)*radius);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radius, centerY + cosf(DEG2RAD*(i + 10))*radius);
-        }
-    rlEnd();
+    DrawEllipseLines(centerX, centerY, radius, radius, color);
 }
 
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
-    rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radiusH, (float)centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radiusH, (float)centerY + cosf(DEG2RAD*(i + 10))*radiusV);
-        }
-    rlEnd();
+    DrawEllipsePro((Vector2){ (float)centerX, (float)centerY }, (Vector2){ radiusH, radiusV }, (Vector2){ 0.0f, 0.0f }, 0.0f, color);
 }
 
 // Draw ellipse with pro parameters
+// NOTE: Vertices are rotated on CPU with sin/cos computed once, no matrix push/pop required
 void DrawEllipsePro(Vector2 center, Vector2 radius, Vector2 origin, float rotation, Color col)
 {
-	if ( rotation == 0 )
-	{
-		center.x -= origin.x;
-		center.y -= origin.y;
-	}
-	else
-	{
-		float sinRotation = sinf(rotation*DEG2RAD);
-		float cosRotation = cosf(rotation*DEG2RAD);
-		Vector2 pivot = {center.x + origin.x, center.y + origin.y};
-		Vector2 newPos = center;
-		Vector2 finalPos;
-		newPos.x -= pivot.x;
-		newPos.y -= pivot.y;
-			
-		finalPos.x = newPos.x * cosRotation - newPos.y * sinRotation;
-		finalPos.y = newPos.x * sinRotation + newPos.y * cosRotation;
-				
-		center.x += finalPos.x;
-		center.y += finalPos.y;
-	}
-	
-	rlCheckRenderBatchLimit(3*36);
-	
-	rlPushMatrix();
-		rlTranslatef(center.x, center.y, 0.0f);
-		rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-		
-		rlBegin(RL_TRIANGLES);
-			for (int i = 0; i < 360; i += 10)
-			{
-				rlColor4ub(col.r, col.g, col.b, col.a);
-				
-				rlVertex2f(0, 0);
-				rlVertex2f(sinf(DEG2RAD*i)*radius.x, cosf(DEG2RAD*i)*radius.y);
-				
-				rlVertex2f(sinf(DEG2RAD*(i + 10))*radius.x, cosf(DEG2RAD*(i + 10))*radius.y);
-			}
-		rlEnd();
-	rlPopMatrix();
+    float sinRotation = 0.0f;
+    float cosRotation = 1.0f;
+
+    // Only calculate rotation if needed
+    if (rotation == 0.0f)
+    {
+        center.x -= origin.x;
+        center.y -= origin.y;
+    }
+    else
+    {
+        sinRotation = sinf(rotation*DEG2RAD);
+        cosRotation = cosf(rotation*DEG2RAD);
+
+        center.x += -origin.x*cosRotation + origin.y*sinRotation;
+        center.y += -origin.x*sinRotation - origin.y*cosRotation;
+    }
+
+    int segments = (shapesCircleError > 0.0f)? GetCircleSegments(fmaxf(radius.x, radius.y), 360.0f, shapesCircleError) : 36;
+    const Vector2 *points = GetCircleTable(segments);
+
+    rlCheckRenderBatchLimit(3*segments);
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(col.r, col.g, col.b, col.a);
+
+        // First point at angle 0: (0, radius.y) rotated
+        Vector2 prev = { center.x - radius.y*sinRotation, center.y + radius.y*cosRotation };
+
+        for (int i = 1; i <= segments; i++)
+        {
+            float px = points[i].x*radius.x;
+            float py = points[i].y*radius.y;
+            Vector2 next = { center.x + px*cosRotation - py*sinRotation, center.y + px*sinRotation + py*cosRotation };
+
+            rlVertex2f(center.x, center.y);
+            rlVertex2f(prev.x, prev.y);
+            rlVertex2f(next.x, next.y);
+
+            prev = next;
+        }
+    rlEnd();
 }
 
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    int segments = (shapesCircleError > 0.0f)? GetCircleSegments(fmaxf(radiusH, radiusV), 360.0f, shapesCircleError) : 36;
+    const Vector2 *points = GetCircleTable(segments);
+
+    rlCheckRenderBatchLimit(2*segments);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radiusH, centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radiusH, centerY + cosf(DEG2RAD*(i + 10))*radiusV);
+            rlVertex2f(centerX + points[i].x*radiusH, centerY + points[i].y*radiusV);
+            rlVertex2f(centerX + points[i + 1].x*radiusH, centerY + points[i + 1].y*radiusV);
         }
     rlEnd();
 }
@@ -601,72 +897,58 @@ void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Co
 // Draw ellipse outline with extended parameters
 void DrawEllipseLinesEx(Vector2 center, Vector2 radius, float lineThick, Color color)
 {
-	rlCheckRenderBatchLimit(2*36*lineThick*2);
-	
-	rlPushMatrix();
-		rlTranslatef(center.x, center.y, 0.0f);
-		rlBegin(RL_LINES);
-		for (float line = 0; line < lineThick * 2; line++)
-		{
-			for (int i = 0; i < 360; i += 10)
-			{
-				rlColor4ub(color.r, color.g, color.b, color.a);
-				rlVertex2f(sinf(DEG2RAD*i)*radius.x, cosf(DEG2RAD*i)*radius.y);
-				rlVertex2f(sinf(DEG2RAD*(i + 10))*radius.x, cosf(DEG2RAD*(i + 10))*radius.y);
-			}
-			radius.x += 0.5;
-			radius.y += 0.5;
-		}
-	rlPopMatrix();
-    rlEnd();
+    DrawEllipseLinesPro(center, (Vector2){ radius.x + lineThick/2, radius.y + lineThick/2 }, (Vector2){ 0.0f, 0.0f }, 0.0f, lineThick, color);
 }
 
 // Draw ellipse outline with pro parameters
+// NOTE: Vertices are rotated on CPU with sin/cos computed once, no matrix push/pop required
 void DrawEllipseLinesPro(Vector2 center, Vector2 radius, Vector2 origin, float rotation, float lineThick, Color color)
 {
-    if ( rotation == 0 )
-	{
-		center.x -= origin.x;
-		center.y -= origin.y;
-	}
-	else
-	{
-		float sinRotation = sinf(rotation*DEG2RAD);
-		float cosRotation = cosf(rotation*DEG2RAD);
-		Vector2 pivot = {center.x + origin.x, center.y + origin.y};
-		Vector2 newPos = center;
-		Vector2 finalPos;
-		newPos.x -= pivot.x;
-		newPos.y -= pivot.y;
-			
-		finalPos.x = newPos.x * cosRotation - newPos.y * sinRotation;
-		finalPos.y = newPos.x * sinRotation + newPos.y * cosRotation;
-				
-		center.x += finalPos.x;
-		center.y += finalPos.y;
-	}
-	radius.x -= lineThick / 2;
-	radius.y -= lineThick / 2;
-	
-	rlCheckRenderBatchLimit(2*36*lineThick*2);
-	
-	rlPushMatrix();
-		rlTranslatef(center.x, center.y, 0.0f);
-		rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+    float sinRotation = 0.0f;
+    float cosRotation = 1.0f;
 
-		rlBegin(RL_LINES);
-		for (float line = 0; line < lineThick * 2; line++)
-		{
-			for (int i = 0; i < 360; i += 10)
-			{
-				rlColor4ub(color.r, color.g, color.b, color.a);
-				rlVertex2f(sinf(DEG2RAD*i)*radius.x, cosf(DEG2RAD*i)*radius.y);
-				rlVertex2f(sinf(DEG2RAD*(i + 10))*radius.x, cosf(DEG2RAD*(i + 10))*radius.y);
-			}
-			radius.x += 0.5;
-			radius.y += 0.5;
-		}
-	rlPopMatrix();
+    // Only calculate rotation if needed
+    if (rotation == 0.0f)
+    {
+        center.x -= origin.x;
+        center.y -= origin.y;
+    }
+    else
+    {
+        sinRotation = sinf(rotation*DEG2RAD);
+        cosRotation = cosf(rotation*DEG2RAD);
+
+        center.x += -origin.x*cosRotation + origin.y*sinRotation;
+        center.y += -origin.x*sinRotation - origin.y*cosRotation;
+    }
+
+    radius.x -= lineThick/2;
+    radius.y -= lineThick/2;
+
+    int segments = (shapesCircleError > 0.0f)? GetCircleSegments(fmaxf(radius.x, radius.y) + lineThick, 360.0f, shapesCircleError) : 36;
+    const Vector2 *dirs = GetCircleTable(segments);
+
+    rlCheckRenderBatchLimit(2*segments*lineThick*2);
+
+    rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (float line = 0; line < lineThick*2; line++)
+        {
+            for (int i = 0; i < segments; i++)
+            {
+                float px0 = dirs[i].x*radius.x;
+                float py0 = dirs[i].y*radius.y;
+                float px1 = dirs[i + 1].x*radius.x;
+                float py1 = dirs[i + 1].y*radius.y;
+
+                rlVertex2f(center.x + px0*cosRotation - py0*sinRotation, center.y + px0*sinRotation + py0*cosRotation);
+                rlVertex2f(center.x + px1*cosRotation - py1*sinRotation, center.y + px1*sinRotation + py1*cosRotation);
+            }
+
+            radius.x += 0.5f;
+            radius.y += 0.5f;
+        }
     rlEnd();
 }
 
@@ -694,17 +976,16 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         endAngle = tmp;
     }
 
-    int minSegments = (int)ceilf((endAngle - startAngle)/90);
-
-    if (segments < minSegments)
+    // Full rings drawn as a circle outline distance field
+    if ((endAngle - startAngle) >= 360.0f)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
+        if (QueueShapeSdf(center, (Vector2){ outerRadius, outerRadius }, (Vector2){ 1.0f, 0.0f }, outerRadius, (innerRadius > 0.0f)? outerRadius - innerRadius : 0.0f, color)) return;
     }
 
+    int minSegments = (int)ceilf((endAngle - startAngle)/90);
+
+    if (segments < minSegments) segments = GetCircleSegments(outerRadius, endAngle - startAngle, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
+
     // Not a ring
     if (innerRadius <= 0.0f)
     {
@@ -712,11 +993,13 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetArcTable(startAngle, endAngle, segments);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         for (int i = 0; i < segments; i++)
@@ -724,18 +1007,18 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 
@@ -746,15 +1029,15 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -786,14 +1069,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments < minSegments) segments = GetCircleSegments(outerRadius, endAngle - startAngle, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
 
     if (innerRadius <= 0.0f)
     {
@@ -801,36 +1077,38 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetArcTable(startAngle, endAngle, segments);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
         }
     rlEnd();
 }
@@ -895,7 +1173,7 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
     }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
 
@@ -952,7 +1230,7 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
 {
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         rlNormal3f(0.0f, 0.0f, 1.0f);
@@ -1106,16 +1384,20 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    Vector2 center = { rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+    if (QueueShapeSdf(center, (Vector2){ rec.width/2.0f, rec.height/2.0f }, (Vector2){ 1.0f, 0.0f }, radius, 0.0f, color)) return;
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
-        if (segments <= 0) segments = 4;
+        segments = GetCircleSegments(radius, 90.0f, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
+        if (segments < 4) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
+    if (segments > MAX_CIRCLE_SEGMENTS/4) segments = MAX_CIRCLE_SEGMENTS/4;
+
+    // Corners arcs points from a circle table, quarter of the circle each
+    const Vector2 *arc = GetCircleTable(4*segments);
 
     /*
     Quick sketch to make sense of all of this,
@@ -1143,16 +1425,16 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     };
 
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
-    const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
+    const int offsets[4] = { 2*segments, segments, 0, 3*segments };    // Corners start angles: 180, 90, 0, 270 degrees
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = offsets[k];
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
@@ -1162,12 +1444,12 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-                angle += (stepLength*2);
+                rlVertex2f(center.x + arc[index + 2].x*radius, center.y + arc[index + 2].y*radius);
+                index += 2;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -1177,9 +1459,9 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
             }
@@ -1248,15 +1530,15 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = offsets[k];
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
+                index++;
             }
         }
 
@@ -1326,16 +1608,22 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    // Outline drawn outside the rectangle, outer shape rounded corners radius grows with lineThick
+    Vector2 center = { rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+    Vector2 size = { rec.width/2.0f + lineThick, rec.height/2.0f + lineThick };
+    if ((lineThick > 0.0f) && QueueShapeSdf(center, size, (Vector2){ 1.0f, 0.0f }, radius + lineThick, lineThick, color)) return;
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
-        if (segments <= 0) segments = 4;
+        segments = GetCircleSegments(radius, 180.0f, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
+        if (segments < 4) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
+    if (segments > MAX_CIRCLE_SEGMENTS/4) segments = MAX_CIRCLE_SEGMENTS/4;
+
+    // Corners arcs points from a circle table, quarter of the circle each
+    const Vector2 *arc = GetCircleTable(4*segments);
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1369,33 +1657,33 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
         {(float)(rec.x + rec.width) - innerRadius, (float)(rec.y + rec.height) - innerRadius}, {(float)rec.x + innerRadius, (float)(rec.y + rec.height) - innerRadius} // P18, P19
     };
 
-    const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
+    const int offsets[4] = { 2*segments, segments, 0, 3*segments };    // Corners start angles: 180, 90, 0, 270 degrees
 
     if (lineThick > 1)
     {
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-        rlSetTexture(texShapes.id);
+        SetShapesTextureCurrent();
 
         rlBegin(RL_QUADS);
 
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = offsets[k];
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1451,22 +1739,22 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = offsets[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1516,15 +1804,15 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = offsets[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
+                    index++;
                 }
             }
 
@@ -1545,7 +1833,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1704,7 +1992,7 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
 {
     if (pointCount >= 3)
     {
-        rlSetTexture(texShapes.id);
+        SetShapesTextureCurrent();
         rlBegin(RL_QUADS);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
@@ -1762,7 +2050,7 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
     float centralAngle = rotation;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         for (int i = 0; i < sides; i++)
@@ -1802,9 +2090,33 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 
 // Draw a bi-directional polygon of n sides (Vector version)
 void DrawPolyEx(Vector2 center, int sides, Vector2 radius, float rotation, Color col)
+{
+    DrawPolyPro(center, sides, radius, (Vector2){ 0.0f, 0.0f }, rotation, col);
+}
+
+// Draw a bi-directional polygon of n sides (Vector version) with pro parameters
+// NOTE: Vertices are rotated on CPU with sin/cos computed once, no matrix push/pop required
+void DrawPolyPro(Vector2 center, int sides, Vector2 radius, Vector2 origin, float rotation, Color col)
 {
     if (sides < 3) sides = 3;
     float centralAngle = 0.0f;
+    float sinRotation = 0.0f;
+    float cosRotation = 1.0f;
+
+    // Only calculate rotation if needed
+    if (rotation == 0.0f)
+    {
+        center.x -= origin.x;
+        center.y -= origin.y;
+    }
+    else
+    {
+        sinRotation = sinf(rotation*DEG2RAD);
+        cosRotation = cosf(rotation*DEG2RAD);
+
+        center.x += -origin.x*cosRotation + origin.y*sinRotation;
+        center.y += -origin.x*sinRotation - origin.y*cosRotation;
+    }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*sides); // Each side is a quad
@@ -1812,99 +2124,57 @@ void DrawPolyEx(Vector2 center, int sides, Vector2 radius, float rotation, Color
     rlCheckRenderBatchLimit(3*sides);
 #endif
 
-    rlPushMatrix();
-        rlTranslatef(center.x, center.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+    // First point at angle 0: (0, radius.y) rotated
+    Vector2 prev = { center.x - radius.y*sinRotation, center.y + radius.y*cosRotation };
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-		rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
-		rlBegin(RL_QUADS);
-			for (int i = 0; i < sides; i++)
-			{
-				rlColor4ub(col.r, col.g, col.b, col.a);
+    rlBegin(RL_QUADS);
+        rlColor4ub(col.r, col.g, col.b, col.a);
 
-				rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-				rlVertex2f(0, 0);
+        for (int i = 0; i < sides; i++)
+        {
+            centralAngle += 360.0f/(float)sides;
+            float px = sinf(DEG2RAD*centralAngle)*radius.x;
+            float py = cosf(DEG2RAD*centralAngle)*radius.y;
+            Vector2 next = { center.x + px*cosRotation - py*sinRotation, center.y + px*sinRotation + py*cosRotation };
 
-				rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(center.x, center.y);
 
-				rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(prev.x, prev.y);
 
-				centralAngle += 360.0f/(float)sides;
-				rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
-			}
-		rlEnd();
-		rlSetTexture(0);
-#else
-		rlBegin(RL_TRIANGLES);
-			for (int i = 0; i < sides; i++)
-			{
-				rlColor4ub(col.r, col.g, col.b, col.a);
-
-				rlVertex2f(0, 0);
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
-
-				centralAngle += 360.0f/(float)sides;
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
-			}
-			rlEnd();
-#endif
-	rlPopMatrix();
-}
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(prev.x, prev.y);
 
-// Draw a bi-directional polygon of n sides (Vector version) with pro parameters
-void DrawPolyPro(Vector2 center, int sides, Vector2 radius, Vector2 origin, float rotation, Color col)
-{
-    if (sides < 3) sides = 3;
-    float centralAngle = 0.0f;
-	if ( rotation == 0 )
-	{
-		center.x -= origin.x;
-		center.y -= origin.y;
-	}
-	else
-	{
-		float sinRotation = sinf(rotation*DEG2RAD);
-		float cosRotation = cosf(rotation*DEG2RAD);
-		Vector2 pivot = {center.x + origin.x, center.y + origin.y};
-		Vector2 newPos = center;
-		Vector2 finalPos;
-		newPos.x -= pivot.x;
-		newPos.y -= pivot.y;
-			
-		finalPos.x = newPos.x * cosRotation - newPos.y * sinRotation;
-		finalPos.y = newPos.x * sinRotation + newPos.y * cosRotation;
-				
-		center.x += finalPos.x;
-		center.y += finalPos.y;
-	}
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlCheckRenderBatchLimit(4*sides); // Each side is a quad
-#else
-    rlCheckRenderBatchLimit(3*sides);
-#endif
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(next.x, next.y);
 
-    rlPushMatrix();
-        rlTranslatef(center.x, center.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            prev = next;
+        }
+    rlEnd();
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(col.r, col.g, col.b, col.a);
 
-		rlBegin(RL_TRIANGLES);
-			for (int i = 0; i < sides; i++)
-			{
-				rlColor4ub(col.r, col.g, col.b, col.a);
+        for (int i = 0; i < sides; i++)
+        {
+            centralAngle += 360.0f/(float)sides;
+            float px = sinf(DEG2RAD*centralAngle)*radius.x;
+            float py = cosf(DEG2RAD*centralAngle)*radius.y;
+            Vector2 next = { center.x + px*cosRotation - py*sinRotation, center.y + px*sinRotation + py*cosRotation };
 
-				rlVertex2f(0, 0);
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
+            rlVertex2f(center.x, center.y);
+            rlVertex2f(prev.x, prev.y);
+            rlVertex2f(next.x, next.y);
 
-				centralAngle += 360.0f/(float)sides;
-				rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
-			}
-		rlEnd();
-	rlPopMatrix();
+            prev = next;
+        }
+    rlEnd();
+#endif
 }
 
 // Draw a polygon outline of n sides
@@ -1934,7 +2204,7 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
     float innerRadius = radius - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f));
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
     rlBegin(RL_QUADS);
         for (int i = 0; i < sides; i++)
@@ -1978,34 +2248,30 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
 }
 
 // Draw a bi-directional polygon outline of n sides with pro parameters
+// NOTE: Vertices are rotated on CPU with sin/cos computed once, no matrix push/pop required
 void DrawPolyLinesPro(Vector2 center, int sides, Vector2 radius, Vector2 origin, float rotation, float lineThick, Color color)
 {
     if (sides < 3) sides = 3;
     float centralAngle = 0.0f;
     float exteriorAngle = 360.0f/(float)sides;
     Vector2 innerRadius = {radius.x - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f)), radius.y - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f))};
-	
-	if ( rotation == 0 )
-	{
-		center.x -= origin.x;
-		center.y -= origin.y;
-	}
-	else
-	{
-		float sinRotation = sinf(rotation*DEG2RAD);
-		float cosRotation = cosf(rotation*DEG2RAD);
-		Vector2 pivot = {center.x + origin.x, center.y + origin.y};
-		Vector2 newPos = center;
-		Vector2 finalPos;
-		newPos.x -= pivot.x;
-		newPos.y -= pivot.y;
-			
-		finalPos.x = newPos.x * cosRotation - newPos.y * sinRotation;
-		finalPos.y = newPos.x * sinRotation + newPos.y * cosRotation;
-				
-		center.x += finalPos.x;
-		center.y += finalPos.y;
-	}
+    float sinRotation = 0.0f;
+    float cosRotation = 1.0f;
+
+    // Only calculate rotation if needed
+    if (rotation == 0.0f)
+    {
+        center.x -= origin.x;
+        center.y -= origin.y;
+    }
+    else
+    {
+        sinRotation = sinf(rotation*DEG2RAD);
+        cosRotation = cosf(rotation*DEG2RAD);
+
+        center.x += -origin.x*cosRotation + origin.y*sinRotation;
+        center.y += -origin.x*sinRotation - origin.y*cosRotation;
+    }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*sides);
@@ -2013,53 +2279,466 @@ void DrawPolyLinesPro(Vector2 center, int sides, Vector2 radius, Vector2 origin,
     rlCheckRenderBatchLimit(6*sides);
 #endif
 
-    rlPushMatrix();
-        rlTranslatef(center.x, center.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+    // First outer and inner points at angle 0: (0, radius.y) rotated
+    Vector2 prevOuter = { center.x - radius.y*sinRotation, center.y + radius.y*cosRotation };
+    Vector2 prevInner = { center.x - innerRadius.y*sinRotation, center.y + innerRadius.y*cosRotation };
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-        rlSetTexture(texShapes.id);
+    SetShapesTextureCurrent();
 
-        rlBegin(RL_QUADS);
-            for (int i = 0; i < sides; i++)
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < sides; i++)
+        {
+            centralAngle += exteriorAngle;
+            float dx = sinf(DEG2RAD*centralAngle);
+            float dy = cosf(DEG2RAD*centralAngle);
+            Vector2 nextOuter = { center.x + dx*radius.x*cosRotation - dy*radius.y*sinRotation, center.y + dx*radius.x*sinRotation + dy*radius.y*cosRotation };
+            Vector2 nextInner = { center.x + dx*innerRadius.x*cosRotation - dy*innerRadius.y*sinRotation, center.y + dx*innerRadius.x*sinRotation + dy*innerRadius.y*cosRotation };
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(prevInner.x, prevInner.y);
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(prevOuter.x, prevOuter.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(nextOuter.x, nextOuter.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(nextInner.x, nextInner.y);
+
+            prevOuter = nextOuter;
+            prevInner = nextInner;
+        }
+    rlEnd();
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < sides; i++)
+        {
+            centralAngle += exteriorAngle;
+            float dx = sinf(DEG2RAD*centralAngle);
+            float dy = cosf(DEG2RAD*centralAngle);
+            Vector2 nextOuter = { center.x + dx*radius.x*cosRotation - dy*radius.y*sinRotation, center.y + dx*radius.x*sinRotation + dy*radius.y*cosRotation };
+            Vector2 nextInner = { center.x + dx*innerRadius.x*cosRotation - dy*innerRadius.y*sinRotation, center.y + dx*innerRadius.x*sinRotation + dy*innerRadius.y*cosRotation };
+
+            rlVertex2f(prevOuter.x, prevOuter.y);
+            rlVertex2f(prevInner.x, prevInner.y);
+            rlVertex2f(nextOuter.x, nextOuter.y);
+
+            rlVertex2f(prevInner.x, prevInner.y);
+            rlVertex2f(nextOuter.x, nextOuter.y);
+            rlVertex2f(nextInner.x, nextInner.y);
+
+            prevOuter = nextOuter;
+            prevInner = nextInner;
+        }
+    rlEnd();
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Paths drawing functions
+//----------------------------------------------------------------------------------
+
+// Begin a new path, previous path points are cleared
+void PathBegin(void)
+{
+    pathPointCount = 0;
+    pathContourCount = 0;
+    pathContourOpen = false;
+    pathPen = (Vector2){ 0.0f, 0.0f };
+}
+
+// Move path pen to point, a new contour is started
+void PathMoveTo(Vector2 point)
+{
+    pathContourOpen = false;
+    pathPen = point;
+}
+
+// Add a line from path pen to point
+void PathLineTo(Vector2 point)
+{
+    AddPathPoint(point);
+}
+
+// Add a quadratic bezier curve from path pen to point, flattened by curvature
+void PathQuadTo(Vector2 control, Vector2 point)
+{
+    Vector2 start = pathPen;
+
+    // Segments required for flatness tolerance (Wang's formula)
+    float ddx = start.x - 2*control.x + point.x;
+    float ddy = start.y - 2*control.y + point.y;
+    int segments = (int)ceilf(sqrtf(0.25f*sqrtf(ddx*ddx + ddy*ddy)/GetPathTolerance()));
+    if (segments < 1) segments = 1;
+    else if (segments > MAX_PATH_CURVE_SEGMENTS) segments = MAX_PATH_CURVE_SEGMENTS;
+
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i/(float)segments;
+        float a = (1.0f - t)*(1.0f - t);
+        float b = 2.0f*(1.0f - t)*t;
+        float c = t*t;
+
+        AddPathPoint((Vector2){ a*start.x + b*control.x + c*point.x, a*start.y + b*control.y + c*point.y });
+    }
+}
+
+// Add a cubic bezier curve from path pen to point, flattened by curvature
+void PathCubicTo(Vector2 control1, Vector2 control2, Vector2 point)
+{
+    Vector2 start = pathPen;
+
+    int segments = GetBezierCubicSegments(start, control1, control2, point, GetPathTolerance());
+
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i/(float)segments;
+        float u = 1.0f - t;
+        float a = u*u*u;
+        float b = 3.0f*u*u*t;
+        float c = 3.0f*u*t*t;
+        float d = t*t*t;
+
+        AddPathPoint((Vector2){ a*start.x + b*control1.x + c*control2.x + d*point.x, a*start.y + b*control1.y + c*control2.y + d*point.y });
+    }
+}
+
+// Close current path contour, last point is joined to first one
+void PathClose(void)
+{
+    if (!pathContourOpen) return;
+
+    PathContour *contour = &pathContours[pathContourCount - 1];
+    Vector2 first = pathPoints[contour->first];
+    Vector2 last = pathPoints[contour->first + contour->count - 1];
+
+    // Last point equal to first one is not required, closing segment joins them
+    if ((contour->count > 1) && (first.x == last.x) && (first.y == last.y))
+    {
+        contour->count--;
+        pathPointCount--;
+    }
+
+    contour->closed = true;
+    pathContourOpen = false;
+    pathPen = first;
+}
+
+// Draw path contours outline, segments joined and open contours ends capped
+// NOTE: All contours are drawn in a single vertex emission pass, one normal per segment shared by joins
+void PathStroke(float thick, int join, int cap, Color color)
+{
+    float halfThick = thick/2.0f;
+    if ((halfThick <= 0.0f) || (pathContourCount == 0)) return;
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int c = 0; c < pathContourCount; c++)
+        {
+            const Vector2 *points = pathPoints + pathContours[c].first;
+            int count = pathContours[c].count;
+            bool closed = pathContours[c].closed && (count >= 3);
+            int segmentCount = closed? count : count - 1;
+
+            Vector2 firstDir = { 0 };
+            Vector2 firstNormal = { 0 };
+            Vector2 prevDir = { 0 };
+            Vector2 prevNormal = { 0 };
+
+            for (int i = 0; i < segmentCount; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
+                Vector2 start = points[i];
+                Vector2 end = points[(i + 1)%count];
+                Vector2 dir = { end.x - start.x, end.y - start.y };
+                float length = sqrtf(dir.x*dir.x + dir.y*dir.y);
+                dir.x /= length;
+                dir.y /= length;
+                Vector2 normal = { -dir.y*halfThick, dir.x*halfThick };
+
+                if (i == 0)
+                {
+                    firstDir = dir;
+                    firstNormal = normal;
+
+                    if (!closed)
+                    {
+                        if (cap == PATH_CAP_SQUARE) start = (Vector2){ start.x - dir.x*halfThick, start.y - dir.y*halfThick };
+                        else if (cap == PATH_CAP_ROUND) DrawPathArc(start, normal, PI, halfThick);
+                    }
+                }
+                else DrawPathJoin(start, prevDir, prevNormal, dir, normal, join);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius.x, cosf(DEG2RAD*centralAngle)*innerRadius.y);
+                if (!closed && (i == (segmentCount - 1)))
+                {
+                    if (cap == PATH_CAP_SQUARE) end = (Vector2){ end.x + dir.x*halfThick, end.y + dir.y*halfThick };
+                    else if (cap == PATH_CAP_ROUND) DrawPathArc(end, (Vector2){ -normal.x, -normal.y }, PI, halfThick);
+                }
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
+                // Segment body quad, counter-clockwise on screen
+                rlVertex2f(start.x - normal.x, start.y - normal.y);
+                rlVertex2f(start.x + normal.x, start.y + normal.y);
+                rlVertex2f(end.x + normal.x, end.y + normal.y);
 
-                centralAngle += exteriorAngle;
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
+                rlVertex2f(start.x - normal.x, start.y - normal.y);
+                rlVertex2f(end.x + normal.x, end.y + normal.y);
+                rlVertex2f(end.x - normal.x, end.y - normal.y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius.x, cosf(DEG2RAD*centralAngle)*innerRadius.y);
+                prevDir = dir;
+                prevNormal = normal;
             }
-        rlEnd();
-        rlSetTexture(0);
-#else
-        rlBegin(RL_TRIANGLES);
-            for (int i = 0; i < sides; i++)
+
+            if (closed) DrawPathJoin(points[0], prevDir, prevNormal, firstDir, firstNormal, join);
+        }
+    rlEnd();
+}
+
+// Draw path contours filled, open contours are closed
+// NOTE: Convex contours drawn as triangle fans, concave ones triangulated by ear clipping (simple contours, no holes)
+void PathFill(Color color)
+{
+    if (pathContourCount == 0) return;
+
+    int *indices = NULL;
+    int indicesCapacity = 0;
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int c = 0; c < pathContourCount; c++)
+        {
+            const Vector2 *points = pathPoints + pathContours[c].first;
+            int count = pathContours[c].count;
+            if (count < 3) continue;
+
+            // Contour orientation (signed area) and convexity
+            float area = 0.0f;
+            for (int i = 0, j = count - 1; i < count; j = i++) area += points[j].x*points[i].y - points[i].x*points[j].y;
+            if (area == 0.0f) continue;
+
+            float sign = (area > 0.0f)? 1.0f : -1.0f;
+            bool convex = true;
+
+            for (int i = 0; (i < count) && convex; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                float nextAngle = centralAngle + exteriorAngle;
+                Vector2 a = points[(i + count - 1)%count];
+                Vector2 b = points[i];
+                Vector2 d = points[(i + 1)%count];
+                if (((b.x - a.x)*(d.y - b.y) - (b.y - a.y)*(d.x - b.x))*sign < 0.0f) convex = false;
+            }
+
+            if (convex)
+            {
+                for (int i = 1; i < count - 1; i++) DrawPathTriangle(points[0], points[i], points[i + 1]);
+                continue;
+            }
 
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius.x, cosf(DEG2RAD*centralAngle)*radius.y);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius.x, cosf(DEG2RAD*centralAngle)*innerRadius.y);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*radius.x, cosf(DEG2RAD*nextAngle)*radius.y);
+            if (count > indicesCapacity)
+            {
+                int *newIndices = (int *)RL_REALLOC(indices, count*sizeof(int));
+                if (newIndices == NULL) break;
+                indices = newIndices;
+                indicesCapacity = count;
+            }
 
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius.x, cosf(DEG2RAD*centralAngle)*innerRadius.y);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*radius.x, cosf(DEG2RAD*nextAngle)*radius.y);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*innerRadius.x, cosf(DEG2RAD*nextAngle)*innerRadius.y);
+            for (int i = 0; i < count; i++) indices[i] = i;
+
+            // Ear clipping, remaining vertex drawn as a fan if no ear is found (self-intersecting contour)
+            int remaining = count;
+            int misses = 0;
+
+            for (int i = 0; remaining > 3;)
+            {
+                int ip = (i + remaining - 1)%remaining;
+                int in = (i + 1)%remaining;
+                Vector2 a = points[indices[ip]];
+                Vector2 b = points[indices[i]];
+                Vector2 d = points[indices[in]];
+                bool ear = (((b.x - a.x)*(d.y - b.y) - (b.y - a.y)*(d.x - b.x))*sign > 0.0f);
+
+                for (int k = 0; ear && (k < remaining); k++)
+                {
+                    if ((k == ip) || (k == i) || (k == in)) continue;
+                    if (CheckCollisionPointTriangle(points[indices[k]], a, b, d)) ear = false;
+                }
 
-                centralAngle = nextAngle;
+                if (ear)
+                {
+                    DrawPathTriangle(a, b, d);
+                    for (int k = i; k < remaining - 1; k++) indices[k] = indices[k + 1];
+                    remaining--;
+                    if (i >= remaining) i = 0;
+                    misses = 0;
+                }
+                else
+                {
+                    i = (i + 1)%remaining;
+                    if (++misses > remaining) break;
+                }
             }
-        rlEnd();
+
+            for (int i = 1; i < remaining - 1; i++) DrawPathTriangle(points[indices[0]], points[indices[i]], points[indices[i + 1]]);
+        }
+    rlEnd();
+
+    RL_FREE(indices);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Splines drawing functions
+//----------------------------------------------------------------------------------
+
+// Load spline from control points (SplineType), tessellated on first use
+// NOTE: Control points are copied, all spline types are tessellated as cubic bezier curves
+Spline LoadSpline(int type, const Vector2 *points, int pointCount)
+{
+    Spline spline = { 0 };
+
+    spline.type = type;
+    UpdateSpline(&spline, points, pointCount);
+
+    return spline;
+}
+
+// Unload spline data
+void UnloadSpline(Spline spline)
+{
+    RL_FREE(spline.points);
+    RL_FREE(spline.vertices);
+    RL_FREE(spline.normals);
+    RL_FREE(spline.lengths);
+}
+
+// Update spline control points, tessellated again on next use
+void UpdateSpline(Spline *spline, const Vector2 *points, int pointCount)
+{
+    if ((points == NULL) || (pointCount < 0)) pointCount = 0;
+
+    if (pointCount != spline->pointCount)
+    {
+        Vector2 *buffer = (Vector2 *)RL_REALLOC(spline->points, ((pointCount > 0)? pointCount : 1)*sizeof(Vector2));
+        if (buffer == NULL) return;
+
+        spline->points = buffer;
+        spline->pointCount = pointCount;
+    }
+
+    if (pointCount > 0) memcpy(spline->points, points, pointCount*sizeof(Vector2));
+
+    spline->tolerance = 0.0f;
+}
+
+// Draw spline, tessellation cached until points or zoom level change
+// NOTE: Segments quads are extruded along cached normals, no curve evaluation on draw
+void DrawSpline(Spline *spline, float thick, Color color)
+{
+    UpdateSplineTessellation(spline);
+
+    if (spline->vertexCount < 2) return;
+
+    float half = 0.5f*thick;
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    SetShapesTextureCurrent();
+
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < spline->vertexCount - 1; i++)
+        {
+            Vector2 v1 = spline->vertices[i];
+            Vector2 v2 = spline->vertices[i + 1];
+            Vector2 n1 = { spline->normals[i].x*half, spline->normals[i].y*half };
+            Vector2 n2 = { spline->normals[i + 1].x*half, spline->normals[i + 1].y*half };
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(v1.x + n1.x, v1.y + n1.y);
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(v2.x + n2.x, v2.y + n2.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(v2.x - n2.x, v2.y - n2.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(v1.x - n1.x, v1.y - n1.y);
+        }
+
+    rlEnd();
+
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < spline->vertexCount - 1; i++)
+        {
+            Vector2 v1 = spline->vertices[i];
+            Vector2 v2 = spline->vertices[i + 1];
+            Vector2 n1 = { spline->normals[i].x*half, spline->normals[i].y*half };
+            Vector2 n2 = { spline->normals[i + 1].x*half, spline->normals[i + 1].y*half };
+
+            rlVertex2f(v1.x + n1.x, v1.y + n1.y);
+            rlVertex2f(v2.x + n2.x, v2.y + n2.y);
+            rlVertex2f(v2.x - n2.x, v2.y - n2.y);
+
+            rlVertex2f(v1.x + n1.x, v1.y + n1.y);
+            rlVertex2f(v2.x - n2.x, v2.y - n2.y);
+            rlVertex2f(v1.x - n1.x, v1.y - n1.y);
+        }
+
+    rlEnd();
 #endif
-    rlPopMatrix();
+}
+
+// Get spline length (tessellated)
+float GetSplineLength(Spline *spline)
+{
+    UpdateSplineTessellation(spline);
+
+    return (spline->vertexCount > 0)? spline->lengths[spline->vertexCount - 1] : 0.0f;
+}
+
+// Get spline point at distance from start (arc length parameterization)
+// NOTE: Distance is clamped to spline length, point interpolated between tessellated points
+Vector2 GetSplinePoint(Spline *spline, float distance)
+{
+    Vector2 point = { 0 };
+
+    UpdateSplineTessellation(spline);
+
+    if (spline->vertexCount == 0) return point;
+    if (distance <= 0.0f) return spline->vertices[0];
+    if (distance >= spline->lengths[spline->vertexCount - 1]) return spline->vertices[spline->vertexCount - 1];
+
+    // Last tessellated point with length lower or equal to distance
+    int low = 0;
+    int high = spline->vertexCount - 1;
+
+    while (high - low > 1)
+    {
+        int mid = (low + high)/2;
+
+        if (spline->lengths[mid] <= distance) low = mid;
+        else high = mid;
+    }
+
+    float t = (distance - spline->lengths[low])/(spline->lengths[high] - spline->lengths[low]);
+
+    point.x = spline->vertices[low].x + (spline->vertices[high].x - spline->vertices[low].x)*t;
+    point.y = spline->vertices[low].y + (spline->vertices[high].y - spline->vertices[low].y)*t;
+
+    return point;
 }
 
 //----------------------------------------------------------------------------------
@@ -2127,12 +2806,13 @@ bool CheckCollisionPointPoly(Vector2 point, Vector2 *points, int pointCount)
 
     if (pointCount > 2)
     {
-        for (int i = 0; i < pointCount - 1; i++)
+        // NOTE: Closing edge (last point to first point) is also checked
+        for (int i = 0, j = pointCount - 1; i < pointCount; j = i, i++)
         {
-            Vector2 vc = points[i];
-            Vector2 vn = points[i + 1];
+            Vector2 vc = points[j];
+            Vector2 vn = points[i];
 
-            if ((((vc.y >= point.y) && (vn.y < point.y)) || ((vc.y < point.y) && (vn.y >= point.y))) &&
+            if (((vc.y > point.y) != (vn.y > point.y)) &&
                  (point.x < ((vn.x - vc.x)*(point.y - vc.y)/(vn.y - vc.y) + vc.x))) collision = !collision;
         }
     }
@@ -2140,6 +2820,193 @@ bool CheckCollisionPointPoly(Vector2 point, Vector2 *points, int pointCount)
     return collision;
 }
 
+// Load polygon index for fast point in polygon checks
+// NOTE: Polygon bounds are split in horizontal rows, every row lists the edges crossing it:
+// edges spanning the full row height are sorted left to right (binary searched on checks),
+// edges starting or ending inside the row are checked one by one, polygon must be simple (no self-intersections)
+PolygonIndex LoadPolygonIndex(const Vector2 *points, int pointCount)
+{
+    PolygonIndex index = { 0 };
+
+    if ((points == NULL) || (pointCount < 3)) return index;
+
+    index.pointCount = pointCount;
+    index.points = (Vector2 *)RL_MALLOC(pointCount*sizeof(Vector2));
+    memcpy(index.points, points, pointCount*sizeof(Vector2));
+
+    Vector2 min = points[0];
+    Vector2 max = points[0];
+
+    for (int i = 1; i < pointCount; i++)
+    {
+        min.x = fminf(min.x, points[i].x);
+        min.y = fminf(min.y, points[i].y);
+        max.x = fmaxf(max.x, points[i].x);
+        max.y = fmaxf(max.y, points[i].y);
+    }
+
+    index.bounds = (Rectangle){ min.x, min.y, max.x - min.x, max.y - min.y };
+
+    // NOTE: Around two points per row, edges spanning several rows are listed on all of them
+    index.rowCount = pointCount/2;
+    if (index.rowCount > MAX_POLYGON_INDEX_ROWS) index.rowCount = MAX_POLYGON_INDEX_ROWS;
+    if ((index.rowCount < 1) || (index.bounds.height <= 0.0f)) index.rowCount = 1;
+
+    index.rowOffsets = (int *)RL_CALLOC(index.rowCount + 1, sizeof(int));
+    index.rowSpanCounts = (int *)RL_CALLOC(index.rowCount, sizeof(int));
+
+    // Count edges per row, horizontal edges are never crossed
+    for (int i = 0; i < pointCount; i++)
+    {
+        Vector2 v1 = points[i];
+        Vector2 v2 = points[(i + 1)%pointCount];
+
+        if (v1.y == v2.y) continue;
+
+        int row1 = GetPolygonIndexRow(index, fminf(v1.y, v2.y));
+        int row2 = GetPolygonIndexRow(index, fmaxf(v1.y, v2.y));
+
+        for (int r = row1; r <= row2; r++)
+        {
+            index.rowOffsets[r + 1]++;
+            if ((r > row1) && (r < row2)) index.rowSpanCounts[r]++;
+        }
+    }
+
+    for (int r = 0; r < index.rowCount; r++) index.rowOffsets[r + 1] += index.rowOffsets[r];
+
+    index.rowEdges = (int *)RL_MALLOC(((index.rowOffsets[index.rowCount] > 0)? index.rowOffsets[index.rowCount] : 1)*sizeof(int));
+
+    // Fill rows edges, spanning edges first
+    int *spanFill = (int *)RL_CALLOC(index.rowCount, sizeof(int));
+    int *partialFill = (int *)RL_CALLOC(index.rowCount, sizeof(int));
+
+    for (int i = 0; i < pointCount; i++)
+    {
+        Vector2 v1 = points[i];
+        Vector2 v2 = points[(i + 1)%pointCount];
+
+        if (v1.y == v2.y) continue;
+
+        int row1 = GetPolygonIndexRow(index, fminf(v1.y, v2.y));
+        int row2 = GetPolygonIndexRow(index, fmaxf(v1.y, v2.y));
+
+        for (int r = row1; r <= row2; r++)
+        {
+            if ((r > row1) && (r < row2)) index.rowEdges[index.rowOffsets[r] + spanFill[r]++] = i;
+            else index.rowEdges[index.rowOffsets[r] + index.rowSpanCounts[r] + partialFill[r]++] = i;
+        }
+    }
+
+    RL_FREE(spanFill);
+    RL_FREE(partialFill);
+
+    // Sort spanning edges by x at row middle, they do not cross inside the row so order is kept on full row height
+    int maxSpanCount = 0;
+    for (int r = 0; r < index.rowCount; r++) if (index.rowSpanCounts[r] > maxSpanCount) maxSpanCount = index.rowSpanCounts[r];
+
+    if (maxSpanCount > 1)
+    {
+        PolygonIndexEdge *keys = (PolygonIndexEdge *)RL_MALLOC(maxSpanCount*sizeof(PolygonIndexEdge));
+        float rowHeight = index.bounds.height/index.rowCount;
+
+        for (int r = 0; r < index.rowCount; r++)
+        {
+            int spanCount = index.rowSpanCounts[r];
+            if (spanCount < 2) continue;
+
+            int *edges = index.rowEdges + index.rowOffsets[r];
+            float y = index.bounds.y + (r + 0.5f)*rowHeight;
+
+            for (int k = 0; k < spanCount; k++)
+            {
+                Vector2 v1 = points[edges[k]];
+                Vector2 v2 = points[(edges[k] + 1)%pointCount];
+
+                keys[k].x = v1.x + (v2.x - v1.x)*(y - v1.y)/(v2.y - v1.y);
+                keys[k].edge = edges[k];
+            }
+
+            qsort(keys, spanCount, sizeof(PolygonIndexEdge), ComparePolygonIndexEdges);
+
+            for (int k = 0; k < spanCount; k++) edges[k] = keys[k].edge;
+        }
+
+        RL_FREE(keys);
+    }
+
+    return index;
+}
+
+// Unload polygon index data
+void UnloadPolygonIndex(PolygonIndex index)
+{
+    RL_FREE(index.points);
+    RL_FREE(index.rowOffsets);
+    RL_FREE(index.rowSpanCounts);
+    RL_FREE(index.rowEdges);
+}
+
+// Check if point is within an indexed polygon
+// NOTE: Same crossing rules as CheckCollisionPointPoly(), spanning edges crossings counted with a binary search
+bool CheckCollisionPointPolyIndex(Vector2 point, PolygonIndex index)
+{
+    bool collision = false;
+
+    if ((index.rowEdges == NULL) ||
+        (point.y < index.bounds.y) || (point.y >= (index.bounds.y + index.bounds.height)) ||
+        (point.x < index.bounds.x) || (point.x >= (index.bounds.x + index.bounds.width))) return false;
+
+    int row = GetPolygonIndexRow(index, point.y);
+    const int *edges = index.rowEdges + index.rowOffsets[row];
+    int spanCount = index.rowSpanCounts[row];
+    int edgeCount = index.rowOffsets[row + 1] - index.rowOffsets[row];
+
+    // Spanning edges always cross point row, find first one on point right side
+    int low = 0;
+    int high = spanCount;
+
+    while (low < high)
+    {
+        int mid = (low + high)/2;
+        Vector2 vc = index.points[edges[mid]];
+        Vector2 vn = index.points[(edges[mid] + 1)%index.pointCount];
+
+        if (point.x < ((vn.x - vc.x)*(point.y - vc.y)/(vn.y - vc.y) + vc.x)) high = mid;
+        else low = mid + 1;
+    }
+
+    collision = ((spanCount - low)%2) == 1;
+
+    // Edges starting or ending in the row
+    for (int k = spanCount; k < edgeCount; k++)
+    {
+        Vector2 vc = index.points[edges[k]];
+        Vector2 vn = index.points[(edges[k] + 1)%index.pointCount];
+
+        if (((vc.y > point.y) != (vn.y > point.y)) &&
+             (point.x < ((vn.x - vc.x)*(point.y - vc.y)/(vn.y - vc.y) + vc.x))) collision = !collision;
+    }
+
+    return collision;
+}
+
+// Check points within an indexed polygon, results per point (optional), returns points inside count
+int CheckCollisionPointsPoly(const Vector2 *points, int pointCount, PolygonIndex index, bool *results)
+{
+    int insideCount = 0;
+
+    for (int i = 0; i < pointCount; i++)
+    {
+        bool inside = CheckCollisionPointPolyIndex(points[i], index);
+
+        if (results != NULL) results[i] = inside;
+        if (inside) insideCount++;
+    }
+
+    return insideCount;
+}
+
 // Check collision between two rectangles
 bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2)
 {
@@ -2184,12 +3051,163 @@ bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
     if (dx <= (rec.width/2.0f)) { return true; }
     if (dy <= (rec.height/2.0f)) { return true; }
 
-    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) +
-                             (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) +
+                             (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+
+    collision = (cornerDistanceSq <= (radius*radius));
+
+    return collision;
+}
+
+// Check collision between rectangle and rectangles array (SoA layout), returns colliding rectangles count
+// NOTE: Results are optional (one per rectangle), rectangles are tested with SIMD instructions if available
+int CheckCollisionRecsBatch(Rectangle rec, const float *xs, const float *ys, const float *widths, const float *heights, int count, bool *results)
+{
+    int collisions = 0;
+    int i = 0;
+
+#if defined(RSHAPES_SIMD)
+    simd4f minX = SIMD4_SET1(rec.x);
+    simd4f minY = SIMD4_SET1(rec.y);
+    simd4f maxX = SIMD4_SET1(rec.x + rec.width);
+    simd4f maxY = SIMD4_SET1(rec.y + rec.height);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd4f x = SIMD4_LOAD(xs + i);
+        simd4f y = SIMD4_LOAD(ys + i);
+
+        int mask = SIMD4_MASK(SIMD4_AND(SIMD4_AND(SIMD4_LT(minX, SIMD4_ADD(x, SIMD4_LOAD(widths + i))), SIMD4_GT(maxX, x)),
+                                        SIMD4_AND(SIMD4_LT(minY, SIMD4_ADD(y, SIMD4_LOAD(heights + i))), SIMD4_GT(maxY, y))));
+
+        collisions += StoreCollisionsMask(mask, 4, (results != NULL)? results + i : NULL);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        bool collision = CheckCollisionRecs(rec, (Rectangle){ xs[i], ys[i], widths[i], heights[i] });
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+
+    return collisions;
+}
+
+// Check collision between circle and circles array (SoA layout), returns colliding circles count
+// NOTE: Results are optional (one per circle), squared distances are compared (same for scalar path)
+int CheckCollisionCirclesBatch(Vector2 center, float radius, const float *xs, const float *ys, const float *radii, int count, bool *results)
+{
+    int collisions = 0;
+    int i = 0;
+
+#if defined(RSHAPES_SIMD)
+    simd4f centerX = SIMD4_SET1(center.x);
+    simd4f centerY = SIMD4_SET1(center.y);
+    simd4f rad = SIMD4_SET1(radius);
+    simd4f zero = SIMD4_SET1(0.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd4f dx = SIMD4_SUB(SIMD4_LOAD(xs + i), centerX);
+        simd4f dy = SIMD4_SUB(SIMD4_LOAD(ys + i), centerY);
+        simd4f sum = SIMD4_ADD(rad, SIMD4_LOAD(radii + i));
+
+        int mask = SIMD4_MASK(SIMD4_AND(SIMD4_GE(sum, zero), SIMD4_LE(SIMD4_ADD(SIMD4_MUL(dx, dx), SIMD4_MUL(dy, dy)), SIMD4_MUL(sum, sum))));
+
+        collisions += StoreCollisionsMask(mask, 4, (results != NULL)? results + i : NULL);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float dx = xs[i] - center.x;
+        float dy = ys[i] - center.y;
+        float sum = radius + radii[i];
+        bool collision = (sum >= 0.0f) && ((dx*dx + dy*dy) <= (sum*sum));
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+
+    return collisions;
+}
+
+// Check collision between rectangle and circles array (SoA layout), returns colliding circles count
+// NOTE: Results are optional (one per circle), same tests as CheckCollisionCircleRec()
+int CheckCollisionCircleRecBatch(Rectangle rec, const float *xs, const float *ys, const float *radii, int count, bool *results)
+{
+    int collisions = 0;
+    int i = 0;
+
+#if defined(RSHAPES_SIMD)
+    simd4f recCenterX = SIMD4_SET1((float)(int)(rec.x + rec.width/2.0f));
+    simd4f recCenterY = SIMD4_SET1((float)(int)(rec.y + rec.height/2.0f));
+    simd4f halfWidth = SIMD4_SET1(rec.width/2.0f);
+    simd4f halfHeight = SIMD4_SET1(rec.height/2.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd4f dx = SIMD4_ABS(SIMD4_SUB(SIMD4_LOAD(xs + i), recCenterX));
+        simd4f dy = SIMD4_ABS(SIMD4_SUB(SIMD4_LOAD(ys + i), recCenterY));
+        simd4f radius = SIMD4_LOAD(radii + i);
+        simd4f cornerX = SIMD4_SUB(dx, halfWidth);
+        simd4f cornerY = SIMD4_SUB(dy, halfHeight);
+
+        // Circle not too far, center inside rectangle extended bands or corner in circle
+        int mask = SIMD4_MASK(SIMD4_AND(SIMD4_AND(SIMD4_LE(dx, SIMD4_ADD(halfWidth, radius)), SIMD4_LE(dy, SIMD4_ADD(halfHeight, radius))),
+                                        SIMD4_OR(SIMD4_OR(SIMD4_LE(dx, halfWidth), SIMD4_LE(dy, halfHeight)),
+                                                 SIMD4_LE(SIMD4_ADD(SIMD4_MUL(cornerX, cornerX), SIMD4_MUL(cornerY, cornerY)), SIMD4_MUL(radius, radius)))));
+
+        collisions += StoreCollisionsMask(mask, 4, (results != NULL)? results + i : NULL);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        bool collision = CheckCollisionCircleRec((Vector2){ xs[i], ys[i] }, radii[i], rec);
+
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
+
+    return collisions;
+}
+
+// Check points array (SoA layout) inside rectangle, returns points inside count
+// NOTE: Results are optional (one per point), points are tested with SIMD instructions if available
+int CheckCollisionPointRecBatch(Rectangle rec, const float *xs, const float *ys, int count, bool *results)
+{
+    int collisions = 0;
+    int i = 0;
+
+#if defined(RSHAPES_SIMD)
+    simd4f minX = SIMD4_SET1(rec.x);
+    simd4f minY = SIMD4_SET1(rec.y);
+    simd4f maxX = SIMD4_SET1(rec.x + rec.width);
+    simd4f maxY = SIMD4_SET1(rec.y + rec.height);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd4f x = SIMD4_LOAD(xs + i);
+        simd4f y = SIMD4_LOAD(ys + i);
+
+        int mask = SIMD4_MASK(SIMD4_AND(SIMD4_AND(SIMD4_GE(x, minX), SIMD4_LE(x, maxX)), SIMD4_AND(SIMD4_GE(y, minY), SIMD4_LE(y, maxY))));
+
+        collisions += StoreCollisionsMask(mask, 4, (results != NULL)? results + i : NULL);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        bool collision = CheckCollisionPointRec((Vector2){ xs[i], ys[i] }, rec);
 
-    collision = (cornerDistanceSq <= (radius*radius));
+        if (results != NULL) results[i] = collision;
+        collisions += collision;
+    }
 
-    return collision;
+    return collisions;
 }
 
 // Check the collision between two lines defined by two points each, returns collision point by reference
@@ -2312,6 +3330,761 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Get shapes units to screen pixels scale, from current modelview (2D camera zoom)
+static float GetShapesScale(void)
+{
+    Matrix modelview = rlGetMatrixModelview();
+    float scale = sqrtf(fabsf(modelview.m0*modelview.m5 - modelview.m4*modelview.m1));
+
+    return (scale > 0.0f)? scale : 1.0f;
+}
+
+// Get path curves flattening tolerance in shapes units
+static float GetPathTolerance(void)
+{
+    return ((shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE)/GetShapesScale();
+}
+
+// Get cubic bezier segments required for flatness tolerance (Wang's formula)
+static int GetBezierCubicSegments(Vector2 p1, Vector2 c1, Vector2 c2, Vector2 p2, float tolerance)
+{
+    float ddx1 = p1.x - 2*c1.x + c2.x;
+    float ddy1 = p1.y - 2*c1.y + c2.y;
+    float ddx2 = c1.x - 2*c2.x + p2.x;
+    float ddy2 = c1.y - 2*c2.y + p2.y;
+    float dd = fmaxf(sqrtf(ddx1*ddx1 + ddy1*ddy1), sqrtf(ddx2*ddx2 + ddy2*ddy2));
+    int segments = (int)ceilf(sqrtf(0.75f*dd/tolerance));
+
+    if (segments < 1) segments = 1;
+    else if (segments > MAX_PATH_CURVE_SEGMENTS) segments = MAX_PATH_CURVE_SEGMENTS;
+
+    return segments;
+}
+
+// Add point to current path contour, a contour is started at path pen if required
+// NOTE: Points equal to previous one are skipped, segments always have length
+static void AddPathPoint(Vector2 point)
+{
+    if (!pathContourOpen)
+    {
+        if (pathContourCount >= pathContourCapacity)
+        {
+            int capacity = (pathContourCapacity > 0)? pathContourCapacity*2 : 16;
+            PathContour *contours = (PathContour *)RL_REALLOC(pathContours, capacity*sizeof(PathContour));
+            if (contours == NULL) return;
+
+            pathContours = contours;
+            pathContourCapacity = capacity;
+        }
+
+        pathContours[pathContourCount++] = (PathContour){ pathPointCount, 0, false };
+        pathContourOpen = true;
+
+        AddPathPoint(pathPen);
+    }
+
+    PathContour *contour = &pathContours[pathContourCount - 1];
+
+    if (contour->count > 0)
+    {
+        Vector2 last = pathPoints[pathPointCount - 1];
+        if ((last.x == point.x) && (last.y == point.y)) return;
+    }
+
+    if (pathPointCount >= pathPointCapacity)
+    {
+        int capacity = (pathPointCapacity > 0)? pathPointCapacity*2 : 256;
+        Vector2 *points = (Vector2 *)RL_REALLOC(pathPoints, capacity*sizeof(Vector2));
+        if (points == NULL) return;
+
+        pathPoints = points;
+        pathPointCapacity = capacity;
+    }
+
+    pathPoints[pathPointCount++] = point;
+    contour->count++;
+    pathPen = point;
+}
+
+// Draw path triangle, vertex order fixed counter-clockwise on screen
+static void DrawPathTriangle(Vector2 v1, Vector2 v2, Vector2 v3)
+{
+    if (((v2.x - v1.x)*(v3.y - v1.y) - (v2.y - v1.y)*(v3.x - v1.x)) > 0.0f)
+    {
+        Vector2 tmp = v2;
+        v2 = v3;
+        v3 = tmp;
+    }
+
+    rlVertex2f(v1.x, v1.y);
+    rlVertex2f(v2.x, v2.y);
+    rlVertex2f(v3.x, v3.y);
+}
+
+// Draw path arc as a triangles fan around center, from offset vector rotated by angle (radians)
+static void DrawPathArc(Vector2 center, Vector2 from, float angle, float radius)
+{
+    int segments = GetCircleSegments(radius, fabsf(angle)*RAD2DEG, (shapesCircleError > 0.0f)? shapesCircleError : SMOOTH_CIRCLE_ERROR_RATE);
+    float sinStep = sinf(angle/segments);
+    float cosStep = cosf(angle/segments);
+    Vector2 prev = from;
+
+    for (int i = 0; i < segments; i++)
+    {
+        Vector2 next = { prev.x*cosStep - prev.y*sinStep, prev.x*sinStep + prev.y*cosStep };
+        DrawPathTriangle(center, (Vector2){ center.x + prev.x, center.y + prev.y }, (Vector2){ center.x + next.x, center.y + next.y });
+        prev = next;
+    }
+}
+
+// Draw path join between two segments at point, gap on outer side filled
+// NOTE: Directions are normalized, normals are scaled by half thickness
+static void DrawPathJoin(Vector2 point, Vector2 prevDir, Vector2 prevNormal, Vector2 dir, Vector2 normal, int join)
+{
+    float cross = prevDir.x*dir.y - prevDir.y*dir.x;
+    float dot = prevDir.x*dir.x + prevDir.y*dir.y;
+    if ((fabsf(cross) < 1e-6f) && (dot > 0.0f)) return;   // Collinear segments, no gap
+
+    // Outer side is opposite to turn direction
+    float side = (cross > 0.0f)? -1.0f : 1.0f;
+    Vector2 prevOuter = { point.x + side*prevNormal.x, point.y + side*prevNormal.y };
+    Vector2 outer = { point.x + side*normal.x, point.y + side*normal.y };
+
+    if (join == PATH_JOIN_ROUND)
+    {
+        DrawPathArc(point, (Vector2){ side*prevNormal.x, side*prevNormal.y }, atan2f(cross, dot), sqrtf(normal.x*normal.x + normal.y*normal.y));
+    }
+    else if ((join == PATH_JOIN_MITER) && ((1.0f + dot) > 2.0f/(PATH_MITER_LIMIT*PATH_MITER_LIMIT)))
+    {
+        // Miter tip at half thickness/cos(angle/2) from point: (n1 + n2)/(1 + cos(angle))
+        float scale = side/(1.0f + dot);
+        Vector2 miter = { point.x + (prevNormal.x + normal.x)*scale, point.y + (prevNormal.y + normal.y)*scale };
+
+        DrawPathTriangle(point, prevOuter, miter);
+        DrawPathTriangle(point, miter, outer);
+    }
+    else DrawPathTriangle(point, prevOuter, outer);    // Bevel join (or miter over limit)
+}
+
+// Get segments required for an arc, error bounded on screen
+// NOTE: Radius is scaled by current modelview (2D camera zoom), segments chord max distance to arc is maxError pixels
+static int GetCircleSegments(float radius, float arcAngle, float maxError)
+{
+    int minSegments = (int)ceilf(arcAngle/90.0f);
+    if (minSegments < 1) minSegments = 1;
+
+    float screenRadius = radius*GetShapesScale();
+    if (screenRadius <= maxError) return minSegments;
+
+    // Maximum angle between segments for the error: th = 2*acos(1 - e/r)
+    float th = 2.0f*acosf(1.0f - maxError/screenRadius);
+    int segments = (int)ceilf(DEG2RAD*arcAngle/th);
+
+    if (segments < minSegments) segments = minSegments;
+    else if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    return segments;
+}
+
+// Get unit circle points table for segments count
+// NOTE: Last point closes the circle, returned pointer is valid until next table is requested
+static const Vector2 *GetCircleTable(int segments)
+{
+    return GetArcTable(0.0f, 360.0f, segments);
+}
+
+// Get unit circle arc points table for angles range and segments count
+// NOTE: Tables are cached, least recently used table is replaced when cache is full,
+// returned pointer is valid until next call, points are (sinf(angle), cosf(angle)) as shapes arcs
+static const Vector2 *GetArcTable(float startAngle, float endAngle, int segments)
+{
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    CircleTable *table = &circleTables[0];
+
+    for (int i = 0; i < MAX_CIRCLE_TABLES; i++)
+    {
+        if ((circleTables[i].segments == segments) && (circleTables[i].startAngle == startAngle) && (circleTables[i].endAngle == endAngle))
+        {
+            table = &circleTables[i];
+            break;
+        }
+
+        if (circleTables[i].lastUse < table->lastUse) table = &circleTables[i];
+    }
+
+    if ((table->segments != segments) || (table->startAngle != startAngle) || (table->endAngle != endAngle))
+    {
+        float stepLength = (endAngle - startAngle)/(float)segments;
+
+        for (int i = 0; i < segments; i++)
+        {
+            float angle = DEG2RAD*(startAngle + stepLength*i);
+            table->points[i] = (Vector2){ sinf(angle), cosf(angle) };
+        }
+
+        table->points[segments] = (Vector2){ sinf(DEG2RAD*endAngle), cosf(DEG2RAD*endAngle) };
+        table->segments = segments;
+        table->startAngle = startAngle;
+        table->endAngle = endAngle;
+    }
+
+    table->lastUse = ++circleTablesCounter;
+
+    return table->points;
+}
+
+// Queue SDF shape quad, drawn instanced with queued shapes
+// NOTE: Shape is a rounded box (size is half size) along axis, with thickness it is an outline inside it,
+// current transform is applied (rotation, translation and uniform scale), returns false if not in SDF shapes mode
+static bool QueueShapeSdf(Vector2 center, Vector2 size, Vector2 axis, float radius, float thick, Color color)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!shapesSdfMode || (shapesSdfShader.id == 0) || !rlIsRenderBatchDefault()) return false;
+
+    // Vertex data submitted before shape is drawn first, after queued shapes
+    if (!rlIsRenderBatchEmpty() || (shapesSdfCount >= SHAPES_SDF_MAX_INSTANCES))
+    {
+        DrawShapesSdf();
+        rlDrawRenderBatchActive();
+    }
+
+    Matrix transform = rlGetMatrixTransform();
+    Vector2 position = { transform.m0*center.x + transform.m4*center.y + transform.m12, transform.m1*center.x + transform.m5*center.y + transform.m13 };
+    Vector2 direction = { transform.m0*axis.x + transform.m4*axis.y, transform.m1*axis.x + transform.m5*axis.y };
+    float scale = sqrtf(direction.x*direction.x + direction.y*direction.y);
+    if (scale <= 0.0f) return false;
+
+    float *instance = shapesSdfInstances + shapesSdfCount*SHAPES_SDF_INSTANCE_FLOATS;
+
+    instance[0] = position.x;
+    instance[1] = position.y;
+    instance[2] = size.x*scale;
+    instance[3] = size.y*scale;
+    instance[4] = direction.x/scale;
+    instance[5] = direction.y/scale;
+    instance[6] = radius*scale;
+    instance[7] = (thick > 0.0f)? thick*scale : thick;
+    instance[8] = (float)color.r/255.0f;
+    instance[9] = (float)color.g/255.0f;
+    instance[10] = (float)color.b/255.0f;
+    instance[11] = (float)color.a/255.0f;
+
+    shapesSdfCount++;
+    result = true;
+#endif
+
+    return result;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load SDF shapes shader, quad vertex data and instances buffer
+// NOTE: Quads are expanded by vertex shader from instances data, returns false if not available
+static bool LoadShapesSdfShader(void)
+{
+    if (shapesSdfShaderFailed) return false;
+
+    shapesSdfShaderFailed = true;
+    if (!rlIsInstancingSupported()) return false;
+
+    const char *shapesSdfVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRec;        \n"
+    "attribute vec4 instanceParams;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragLocal;            \n"
+    "varying vec4 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instanceRec;               \n"
+    "in vec4 instanceParams;            \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragLocal;                \n"
+    "out vec4 fragShape;                \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRec;        \n"
+    "attribute vec4 instanceParams;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragLocal;            \n"
+    "varying vec4 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform float pixelSize;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 local = vertexPosition*(instanceRec.zw + vec2(pixelSize)); \n"
+    "    vec2 axis = instanceParams.xy;  \n"
+    "    vec2 position = instanceRec.xy + vec2(local.x*axis.x - local.y*axis.y, local.x*axis.y + local.y*axis.x); \n"
+    "    float thick = instanceParams.w; \n"
+    "    if (thick < 0.0) thick = -thick*pixelSize; \n"
+    "    fragLocal = local;             \n"
+    "    fragShape = vec4(instanceRec.zw, instanceParams.z, thick); \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(position, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Rounded box distance, outline band inside shape if thickness, coverage from distance in pixels
+    const char *shapesSdfFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragLocal;            \n"
+    "varying vec4 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+    "uniform float pixelSize;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragLocal) - fragShape.xy + fragShape.z; \n"
+    "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*clamp(0.5 - d/pixelSize, 0.0, 1.0)); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragLocal;                 \n"
+    "in vec4 fragShape;                 \n"
+    "in vec4 fragColor;                 \n"
+    "uniform float pixelSize;           \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragLocal) - fragShape.xy + fragShape.z; \n"
+    "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*clamp(0.5 - d/pixelSize, 0.0, 1.0)); \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragLocal;            \n"
+    "varying vec4 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+    "uniform float pixelSize;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragLocal) - fragShape.xy + fragShape.z; \n"
+    "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*clamp(0.5 - d/pixelSize, 0.0, 1.0)); \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(shapesSdfVShaderCode, shapesSdfFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
+
+    shapesSdfShaderLocs[0] = rlGetLocationAttrib(shader.id, "instanceRec");
+    shapesSdfShaderLocs[1] = rlGetLocationAttrib(shader.id, "instanceParams");
+    shapesSdfShaderLocs[2] = rlGetLocationAttrib(shader.id, "instanceColor");
+    shapesSdfPixelSizeLoc = rlGetLocationUniform(shader.id, "pixelSize");
+
+    bool ready = (shader.locs[SHADER_LOC_VERTEX_POSITION] != -1) && (shader.locs[SHADER_LOC_MATRIX_MVP] != -1) && (shapesSdfPixelSizeLoc != -1);
+    for (int i = 0; i < 3; i++) if (shapesSdfShaderLocs[i] == -1) ready = false;
+
+    shapesSdfInstances = (float *)RL_MALLOC(SHAPES_SDF_MAX_INSTANCES*SHAPES_SDF_INSTANCE_FLOATS*sizeof(float));
+    if (shapesSdfInstances == NULL) ready = false;
+
+    if (!ready)
+    {
+        UnloadShader(shader);
+        RL_FREE(shapesSdfInstances);
+        shapesSdfInstances = NULL;
+        return false;
+    }
+
+    // Quad corners, two triangles: top-left, bottom-left, bottom-right and top-left, bottom-right, top-right
+    // NOTE: Same vertex order than render batch quads (faces culling)
+    const float corners[12] = { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f };
+
+    shapesSdfVaoId = rlLoadVertexArray();
+    rlEnableVertexArray(shapesSdfVaoId);
+    shapesSdfVboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    shapesSdfInstancesId = rlLoadVertexBuffer(NULL, SHAPES_SDF_MAX_INSTANCES*SHAPES_SDF_INSTANCE_FLOATS*sizeof(float), true);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    shapesSdfShader = shader;
+    shapesSdfShaderFailed = false;
+
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] SDF shapes instancing shader loaded successfully", shapesSdfShader.id);
+
+    return true;
+}
+
+// Draw SDF shapes queued, one instanced draw call with current matrices
+static void DrawShapesSdf(void)
+{
+    if (shapesSdfCount == 0) return;
+
+    rlUpdateVertexBuffer(shapesSdfInstancesId, shapesSdfInstances, shapesSdfCount*SHAPES_SDF_INSTANCE_FLOATS*sizeof(float), 0);
+
+    Matrix matModelView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+    int positionLoc = shapesSdfShader.locs[SHADER_LOC_VERTEX_POSITION];
+    int stride = SHAPES_SDF_INSTANCE_FLOATS*sizeof(float);
+
+    // Antialiasing width: one screen pixel in shapes units (2D camera zoom considered)
+    float scale = sqrtf(fabsf(matModelView.m0*matModelView.m5 - matModelView.m4*matModelView.m1));
+    float pixelSize = (scale > 0.0f)? 1.0f/scale : 1.0f;
+
+    rlEnableShader(shapesSdfShader.id);
+    rlSetUniform(shapesSdfPixelSizeLoc, &pixelSize, SHADER_UNIFORM_FLOAT, 1);
+
+    // Quad corners attached again if VAO not supported
+    bool vao = rlEnableVertexArray(shapesSdfVaoId);
+    if (!vao)
+    {
+        rlEnableVertexBuffer(shapesSdfVboId);
+        rlSetVertexAttribute(positionLoc, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(positionLoc);
+    }
+
+    // Shapes instances attributes: center and half size, axis and shape parameters, color
+    rlEnableVertexBuffer(shapesSdfInstancesId);
+    for (int i = 0; i < 3; i++)
+    {
+        rlSetVertexAttribute(shapesSdfShaderLocs[i], 4, RL_FLOAT, 0, stride, (void *)(i*4*sizeof(float)));
+        rlEnableVertexAttribute(shapesSdfShaderLocs[i]);
+        rlSetVertexAttributeDivisor(shapesSdfShaderLocs[i], 1);
+    }
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        if (eyeCount == 1) rlSetUniformMatrix(shapesSdfShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, matProjection));
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            rlSetUniformMatrix(shapesSdfShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye)));
+        }
+
+        rlDrawVertexArrayInstanced(0, 6, shapesSdfCount);
+    }
+
+    // Instances attributes detached if VAO not supported, they would be used by next draws
+    if (!vao)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            rlSetVertexAttributeDivisor(shapesSdfShaderLocs[i], 0);
+            rlDisableVertexAttribute(shapesSdfShaderLocs[i]);
+        }
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableShader();
+
+    shapesSdfCount = 0;
+}
+
+// Render batch callback, queued SDF shapes are drawn before batch vertex data (submitted after them)
+static void DrawShapesSdfCallback(void)
+{
+    if (shapesSdfPrevCallback != NULL) shapesSdfPrevCallback();
+
+    DrawShapesSdf();
+}
+#endif
+
+// Unload SDF shapes shader and buffers and path points, called on CloseWindow()
+// NOTE: Module function required by rcore, not exposed to users
+extern void UnloadShapesDefault(void)
+{
+    RL_FREE(pathPoints);
+    RL_FREE(pathContours);
+
+    pathPoints = NULL;
+    pathPointCount = 0;
+    pathPointCapacity = 0;
+    pathContours = NULL;
+    pathContourCount = 0;
+    pathContourCapacity = 0;
+    pathContourOpen = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shapesSdfMode) EndShapesSdfMode();
+
+    if (shapesSdfShader.id > 0)
+    {
+        UnloadShader(shapesSdfShader);
+        rlUnloadVertexArray(shapesSdfVaoId);
+        rlUnloadVertexBuffer(shapesSdfVboId);
+        rlUnloadVertexBuffer(shapesSdfInstancesId);
+    }
+
+    RL_FREE(shapesSdfInstances);
+
+    shapesSdfShader = (Shader){ 0 };
+    shapesSdfShaderFailed = false;
+    shapesSdfVaoId = 0;
+    shapesSdfVboId = 0;
+    shapesSdfInstancesId = 0;
+    shapesSdfInstances = NULL;
+    shapesSdfCount = 0;
+#endif
+}
+
+// Store batched collision test lanes results (optional), returns collisions count
+static int StoreCollisionsMask(int mask, int lanes, bool *results)
+{
+    int collisions = 0;
+
+    for (int k = 0; k < lanes; k++)
+    {
+        bool collision = ((mask >> k) & 1);
+
+        if (results != NULL) results[k] = collision;
+        collisions += collision;
+    }
+
+    return collisions;
+}
+
+#if defined(RSHAPES_SIMD_NEON)
+// Get SIMD lanes masks as 4 bits (first lane on lowest bit)
+static int GetSimdLanesMask(uint32x4_t mask)
+{
+    return (int)((vgetq_lane_u32(mask, 0) & 1) | (vgetq_lane_u32(mask, 1) & 2) | (vgetq_lane_u32(mask, 2) & 4) | (vgetq_lane_u32(mask, 3) & 8));
+}
+#endif
+
+// Get spline cubic curves count for control points count
+static int GetSplineCurveCount(int type, int pointCount)
+{
+    int count = 0;
+
+    switch (type)
+    {
+        case SPLINE_LINEAR:
+        case SPLINE_CATMULL_ROM: count = pointCount - 1; break;
+        case SPLINE_BASIS: count = pointCount - 3; break;
+        case SPLINE_BEZIER_CUBIC: count = (pointCount - 1)/3; break;
+        default: break;
+    }
+
+    return (count > 0)? count : 0;
+}
+
+// Get spline curve as cubic bezier control points
+static void GetSplineCurve(const Spline *spline, int curve, Vector2 *bezier)
+{
+    const Vector2 *points = spline->points;
+
+    switch (spline->type)
+    {
+        case SPLINE_LINEAR:
+        {
+            // NOTE: Control points at thirds, curve evaluated at constant speed (one segment)
+            Vector2 p1 = points[curve];
+            Vector2 p2 = points[curve + 1];
+
+            bezier[0] = p1;
+            bezier[1] = (Vector2){ p1.x + (p2.x - p1.x)/3.0f, p1.y + (p2.y - p1.y)/3.0f };
+            bezier[2] = (Vector2){ p1.x + 2.0f*(p2.x - p1.x)/3.0f, p1.y + 2.0f*(p2.y - p1.y)/3.0f };
+            bezier[3] = p2;
+        } break;
+        case SPLINE_CATMULL_ROM:
+        {
+            // NOTE: End points are repeated, curve goes through all points
+            Vector2 p0 = points[(curve > 0)? curve - 1 : 0];
+            Vector2 p1 = points[curve];
+            Vector2 p2 = points[curve + 1];
+            Vector2 p3 = points[(curve + 2 < spline->pointCount)? curve + 2 : spline->pointCount - 1];
+
+            bezier[0] = p1;
+            bezier[1] = (Vector2){ p1.x + (p2.x - p0.x)/6.0f, p1.y + (p2.y - p0.y)/6.0f };
+            bezier[2] = (Vector2){ p2.x - (p3.x - p1.x)/6.0f, p2.y - (p3.y - p1.y)/6.0f };
+            bezier[3] = p2;
+        } break;
+        case SPLINE_BASIS:
+        {
+            Vector2 p0 = points[curve];
+            Vector2 p1 = points[curve + 1];
+            Vector2 p2 = points[curve + 2];
+            Vector2 p3 = points[curve + 3];
+
+            bezier[0] = (Vector2){ (p0.x + 4.0f*p1.x + p2.x)/6.0f, (p0.y + 4.0f*p1.y + p2.y)/6.0f };
+            bezier[1] = (Vector2){ (2.0f*p1.x + p2.x)/3.0f, (2.0f*p1.y + p2.y)/3.0f };
+            bezier[2] = (Vector2){ (p1.x + 2.0f*p2.x)/3.0f, (p1.y + 2.0f*p2.y)/3.0f };
+            bezier[3] = (Vector2){ (p1.x + 4.0f*p2.x + p3.x)/6.0f, (p1.y + 4.0f*p2.y + p3.y)/6.0f };
+        } break;
+        case SPLINE_BEZIER_CUBIC:
+        {
+            bezier[0] = points[3*curve];
+            bezier[1] = points[3*curve + 1];
+            bezier[2] = points[3*curve + 2];
+            bezier[3] = points[3*curve + 3];
+        } break;
+        default: break;
+    }
+}
+
+// Update spline tessellation if required (points changed or zoom level crossed)
+// NOTE: Tolerance is quantized to powers of two, zooming re-tessellates only when crossing a level,
+// curves are flattened by curvature (Wang's formula) as path curves
+static void UpdateSplineTessellation(Spline *spline)
+{
+    float tolerance = exp2f(floorf(log2f(GetPathTolerance())));
+
+    if ((spline->tolerance == tolerance) && (spline->vertices != NULL)) return;
+
+    spline->tolerance = tolerance;
+    spline->vertexCount = 0;
+
+    int curveCount = GetSplineCurveCount(spline->type, spline->pointCount);
+    if (curveCount == 0) return;
+
+    // Curves segments count, tessellated points allocated once
+    int vertexCount = 1;
+    Vector2 bezier[4] = { 0 };
+
+    for (int c = 0; c < curveCount; c++)
+    {
+        GetSplineCurve(spline, c, bezier);
+
+        vertexCount += GetBezierCubicSegments(bezier[0], bezier[1], bezier[2], bezier[3], tolerance);
+    }
+
+    RL_FREE(spline->vertices);
+    RL_FREE(spline->normals);
+    RL_FREE(spline->lengths);
+
+    spline->vertices = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
+    spline->normals = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
+    spline->lengths = (float *)RL_MALLOC(vertexCount*sizeof(float));
+
+    // Curves points, points equal to previous one are skipped (segments always have length)
+    int count = 0;
+
+    for (int c = 0; c < curveCount; c++)
+    {
+        GetSplineCurve(spline, c, bezier);
+
+        int segments = GetBezierCubicSegments(bezier[0], bezier[1], bezier[2], bezier[3], tolerance);
+
+        for (int i = (c == 0)? 0 : 1; i <= segments; i++)
+        {
+            float t = (float)i/(float)segments;
+            float u = 1.0f - t;
+            float a = u*u*u;
+            float b = 3.0f*u*u*t;
+            float d = 3.0f*u*t*t;
+            float e = t*t*t;
+            Vector2 point = { a*bezier[0].x + b*bezier[1].x + d*bezier[2].x + e*bezier[3].x,
+                              a*bezier[0].y + b*bezier[1].y + d*bezier[2].y + e*bezier[3].y };
+
+            if ((count > 0) && (spline->vertices[count - 1].x == point.x) && (spline->vertices[count - 1].y == point.y)) continue;
+
+            spline->vertices[count++] = point;
+        }
+    }
+
+    // Arc lengths and normals, interior points normals scaled to keep thickness on joins (miter limited)
+    spline->lengths[0] = 0.0f;
+    Vector2 prevNormal = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 normal = prevNormal;
+
+        if (i < count - 1)
+        {
+            float dx = spline->vertices[i + 1].x - spline->vertices[i].x;
+            float dy = spline->vertices[i + 1].y - spline->vertices[i].y;
+            float length = sqrtf(dx*dx + dy*dy);
+
+            spline->lengths[i + 1] = spline->lengths[i] + length;
+            normal = (Vector2){ -dy/length, dx/length };
+        }
+
+        if ((i == 0) || (i == count - 1)) spline->normals[i] = normal;
+        else
+        {
+            Vector2 miter = { prevNormal.x + normal.x, prevNormal.y + normal.y };
+            float length = sqrtf(miter.x*miter.x + miter.y*miter.y);
+
+            if (length < 1e-6f) spline->normals[i] = normal;
+            else
+            {
+                miter.x /= length;
+                miter.y /= length;
+
+                float scale = 1.0f/(miter.x*normal.x + miter.y*normal.y);
+                if (scale > PATH_MITER_LIMIT) scale = PATH_MITER_LIMIT;
+
+                spline->normals[i] = (Vector2){ miter.x*scale, miter.y*scale };
+            }
+        }
+
+        prevNormal = normal;
+    }
+
+    spline->vertexCount = count;
+}
+
+// Get polygon index row for a y coordinate (clamped)
+static int GetPolygonIndexRow(PolygonIndex index, float y)
+{
+    int row = 0;
+
+    if (index.bounds.height > 0.0f) row = (int)((y - index.bounds.y)/index.bounds.height*index.rowCount);
+    if (row < 0) row = 0;
+    else if (row >= index.rowCount) row = index.rowCount - 1;
+
+    return row;
+}
+
+// Compare polygon index row edges by x (qsort)
+static int ComparePolygonIndexEdges(const void *a, const void *b)
+{
+    float xa = ((const PolygonIndexEdge *)a)->x;
+    float xb = ((const PolygonIndexEdge *)b)->x;
+
+    return (xa > xb) - (xa < xb);
+}
+
+// Set shapes texture for next vertex, current batch texture kept if it contains a shapes region
+// NOTE: Shapes texture and source rectangle are updated, used on texture coordinates computation
+static void SetShapesTextureCurrent(void)
+{
+    unsigned int currentId = rlGetTextureIdCurrent();
+
+    texShapes = texShapesDefault;
+    texShapesRec = texShapesDefaultRec;
+
+    if (currentId != texShapesDefault.id)
+    {
+        for (int i = 0; i < shapesTextureCount; i++)
+        {
+            if (shapesTextures[i].texture.id == currentId)
+            {
+                texShapes = shapesTextures[i].texture;
+                texShapesRec = shapesTextures[i].source;
+                break;
+            }
+        }
+    }
+
+    rlSetTexture(texShapes.id);
+}
+
 // Cubic easing in-out
 // NOTE: Used by DrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
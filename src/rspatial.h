@@ -0,0 +1,1199 @@
+/**********************************************************************************************
+*
+*   rspatial - Broadphase spatial indices for collision and picking queries
+*
+*   CONFIGURATION:
+*
+*   #define SPATIAL_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   #define SPATIAL_STANDALONE
+*       If defined, the library can be used as standalone, required types are defined,
+*       otherwise raylib types (raylib.h) are used and must be declared before including it
+*
+*   NOTES:
+*       SpatialGrid is a 2D uniform grid of rectangles, best suited for many items of similar size
+*       (bullets, particles, enemies), items outside grid bounds are stored in border cells.
+*       SpatialTree is a dynamic AABB tree of bounding boxes (balanced by rotations), suited for
+*       items of any size, items boxes are enlarged by a margin to avoid reinsertion on small moves.
+*       Items are identified by the id returned on insertion, ids of removed items are reused.
+*       Queries write results into provided arrays (no allocations), up to provided maximum count,
+*       indices memory only grows on insertions. Queries are not thread safe (items query stamp).
+*
+*   CONTRIBUTORS:
+*       Ramon Santamaria:   Supervision, review, update and maintenance
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RSPATIAL_H
+#define RSPATIAL_H
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Function specifiers definition
+#ifndef RLAPI
+    #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+#ifndef SPATIAL_TREE_STACK_SIZE
+    #define SPATIAL_TREE_STACK_SIZE    256      // Maximum nodes pending on tree queries traversal (tree height is balanced)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+// NOTE: Below types are required for SPATIAL_STANDALONE usage
+//----------------------------------------------------------------------------------
+#if defined(SPATIAL_STANDALONE)
+    // Boolean type
+    #if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+        #include <stdbool.h>
+    #elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
+        typedef enum bool { false = 0, true = !false } bool;
+    #endif
+
+    // Vector2, 2 components
+    typedef struct Vector2 {
+        float x;                // Vector x component
+        float y;                // Vector y component
+    } Vector2;
+
+    // Vector3, 3 components
+    typedef struct Vector3 {
+        float x;                // Vector x component
+        float y;                // Vector y component
+        float z;                // Vector z component
+    } Vector3;
+
+    // Rectangle, 4 components
+    typedef struct Rectangle {
+        float x;                // Rectangle top-left corner position x
+        float y;                // Rectangle top-left corner position y
+        float width;            // Rectangle width
+        float height;           // Rectangle height
+    } Rectangle;
+
+    // Ray, ray for raycasting
+    typedef struct Ray {
+        Vector3 position;       // Ray position (origin)
+        Vector3 direction;      // Ray direction
+    } Ray;
+
+    // BoundingBox
+    typedef struct BoundingBox {
+        Vector3 min;            // Minimum vertex box-corner
+        Vector3 max;            // Maximum vertex box-corner
+    } BoundingBox;
+#endif
+
+// SpatialPair, overlapping items pair (a < b)
+typedef struct SpatialPair {
+    int a;                      // First item id
+    int b;                      // Second item id
+} SpatialPair;
+
+// SpatialGridItem, grid item (internal)
+typedef struct SpatialGridItem {
+    Rectangle rec;              // Item rectangle
+    int minX, minY;             // Item first covered cell (minX is -1 for free items)
+    int maxX, maxY;             // Item last covered cell
+    int next;                   // Next free item (free items list)
+    unsigned int stamp;         // Latest query visiting item (results deduplication)
+} SpatialGridItem;
+
+// SpatialGridEntry, grid cell item entry (internal)
+typedef struct SpatialGridEntry {
+    int item;                   // Item id
+    int next;                   // Next entry in cell (or next free entry)
+} SpatialGridEntry;
+
+// SpatialGrid, 2D uniform grid of rectangles
+typedef struct SpatialGrid {
+    Rectangle bounds;           // Grid bounds
+    float cellSize;             // Grid cell size
+    int columns;                // Grid columns
+    int rows;                   // Grid rows
+    int *cells;                 // Cells first entry (-1 for empty cells)
+
+    SpatialGridEntry *entries;  // Cells entries pool
+    int entryCapacity;          // Cells entries pool capacity
+    int freeEntry;              // First free entry (-1 if none)
+
+    SpatialGridItem *items;     // Items array (indexed by id)
+    int itemCapacity;           // Items array capacity
+    int itemCount;              // Items array used size (including free items)
+    int freeItem;               // First free item (-1 if none)
+
+    unsigned int stamp;         // Current query stamp
+} SpatialGrid;
+
+// SpatialTreeNode, tree node (internal)
+// NOTE: Fields accessed on traversal are placed first (same cache line)
+typedef struct SpatialTreeNode {
+    BoundingBox box;            // Node box (leaf item box enlarged by margin)
+    int child1;                 // First child node (-1 for leaves)
+    int child2;                 // Second child node
+    int parent;                 // Parent node (or next free node)
+    int height;                 // Node height (0 for leaves, -1 for free nodes)
+    BoundingBox itemBox;        // Leaf item box
+} SpatialTreeNode;
+
+// SpatialTree, dynamic AABB tree of bounding boxes
+typedef struct SpatialTree {
+    SpatialTreeNode *nodes;     // Nodes array, leaf nodes indices are items ids
+    int nodeCapacity;           // Nodes array capacity
+    int nodeCount;              // Nodes array used size (including free nodes)
+    int freeNode;               // First free node (-1 if none)
+    int root;                   // Root node (-1 if empty)
+    float margin;               // Leaves boxes enlarge margin
+} SpatialTree;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Spatial grid functions (2D rectangles)
+RLAPI SpatialGrid LoadSpatialGrid(Rectangle bounds, float cellSize);                                 // Load spatial grid covering bounds
+RLAPI void UnloadSpatialGrid(SpatialGrid grid);                                                     // Unload spatial grid
+RLAPI void ClearSpatialGrid(SpatialGrid *grid);                                                     // Remove all spatial grid items (ids are reset)
+RLAPI int AddSpatialGridItem(SpatialGrid *grid, Rectangle rec);                                     // Add item rectangle to spatial grid, returns item id
+RLAPI void UpdateSpatialGridItem(SpatialGrid *grid, int id, Rectangle rec);                         // Update spatial grid item rectangle
+RLAPI void RemoveSpatialGridItem(SpatialGrid *grid, int id);                                        // Remove spatial grid item
+RLAPI int QuerySpatialGridRec(SpatialGrid *grid, Rectangle rec, int *results, int maxResults);      // Query spatial grid items overlapping rectangle, returns results count
+RLAPI int QuerySpatialGridLine(SpatialGrid *grid, Vector2 start, Vector2 end, int *results, int maxResults); // Query spatial grid items crossed by line segment, returns results count
+RLAPI int GetSpatialGridPairs(SpatialGrid *grid, SpatialPair *pairs, int maxPairs);                 // Get spatial grid overlapping items pairs, returns pairs count
+
+// Spatial tree functions (3D bounding boxes)
+RLAPI SpatialTree LoadSpatialTree(float margin);                                                    // Load spatial tree, items boxes enlarged by margin
+RLAPI void UnloadSpatialTree(SpatialTree tree);                                                     // Unload spatial tree
+RLAPI int AddSpatialTreeItem(SpatialTree *tree, BoundingBox box);                                   // Add item box to spatial tree, returns item id
+RLAPI void UpdateSpatialTreeItem(SpatialTree *tree, int id, BoundingBox box);                       // Update spatial tree item box (reinserted if out of enlarged box)
+RLAPI void RemoveSpatialTreeItem(SpatialTree *tree, int id);                                        // Remove spatial tree item
+RLAPI int QuerySpatialTreeBox(SpatialTree *tree, BoundingBox box, int *results, int maxResults);    // Query spatial tree items overlapping box, returns results count
+RLAPI int QuerySpatialTreeRay(SpatialTree *tree, Ray ray, float maxDistance, int *results, int maxResults); // Query spatial tree items hit by ray (up to distance), returns results count
+RLAPI int GetSpatialTreePairs(SpatialTree *tree, SpatialPair *pairs, int maxPairs);                 // Get spatial tree overlapping items pairs, returns pairs count
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RSPATIAL_H
+
+
+/***********************************************************************************
+*
+*   SPATIAL IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(SPATIAL_IMPLEMENTATION)
+
+#include <stdlib.h>                 // Required for: malloc(), realloc(), free()
+#include <math.h>                   // Required for: fabsf()
+#include <float.h>                  // Required for: FLT_MAX
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef SPATIAL_MALLOC
+    #define SPATIAL_MALLOC(sz)          malloc(sz)
+#endif
+#ifndef SPATIAL_REALLOC
+    #define SPATIAL_REALLOC(ptr,sz)     realloc(ptr,sz)
+#endif
+#ifndef SPATIAL_FREE
+    #define SPATIAL_FREE(ptr)           free(ptr)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetSpatialGridCell(float value, float origin, float invCellSize, int count);  // Get grid cell coordinate for value (clamped)
+static void InsertSpatialGridItem(SpatialGrid *grid, int id);       // Insert grid item entries in covered cells
+static void EraseSpatialGridItem(SpatialGrid *grid, int id);        // Erase grid item entries from covered cells
+static unsigned int NextSpatialGridStamp(SpatialGrid *grid);        // Get next query stamp (items stamps reset on wrap)
+
+static int AllocateSpatialTreeNode(SpatialTree *tree);              // Allocate tree node (from free nodes list)
+static void FreeSpatialTreeNode(SpatialTree *tree, int node);       // Free tree node (to free nodes list)
+static void InsertSpatialTreeLeaf(SpatialTree *tree, int leaf);     // Insert leaf in tree (best sibling by boxes area cost)
+static void RemoveSpatialTreeLeaf(SpatialTree *tree, int leaf);     // Remove leaf from tree
+static int BalanceSpatialTree(SpatialTree *tree, int node);         // Balance tree node by rotation, returns new subtree root
+static BoundingBox MergeSpatialBoxes(BoundingBox a, BoundingBox b); // Get box containing both boxes
+static float GetSpatialBoxArea(BoundingBox box);                    // Get box surface area (half)
+static bool CheckSpatialBoxes(BoundingBox a, BoundingBox b);        // Check boxes overlap
+static bool CheckSpatialRayBox(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance);    // Check ray hits box before max distance
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Spatial grid
+//----------------------------------------------------------------------------------
+
+// Load spatial grid covering bounds
+SpatialGrid LoadSpatialGrid(Rectangle bounds, float cellSize)
+{
+    SpatialGrid grid = { 0 };
+
+    if ((cellSize <= 0.0f) || (bounds.width <= 0.0f) || (bounds.height <= 0.0f)) return grid;
+
+    grid.bounds = bounds;
+    grid.cellSize = cellSize;
+    grid.columns = (int)(bounds.width/cellSize) + 1;
+    grid.rows = (int)(bounds.height/cellSize) + 1;
+    grid.cells = (int *)SPATIAL_MALLOC(grid.columns*grid.rows*sizeof(int));
+    grid.freeEntry = -1;
+    grid.freeItem = -1;
+
+    for (int i = 0; i < grid.columns*grid.rows; i++) grid.cells[i] = -1;
+
+    return grid;
+}
+
+// Unload spatial grid
+void UnloadSpatialGrid(SpatialGrid grid)
+{
+    SPATIAL_FREE(grid.cells);
+    SPATIAL_FREE(grid.entries);
+    SPATIAL_FREE(grid.items);
+}
+
+// Remove all spatial grid items (ids are reset)
+// NOTE: Memory is kept, useful to rebuild grid every frame
+void ClearSpatialGrid(SpatialGrid *grid)
+{
+    for (int i = 0; i < grid->columns*grid->rows; i++) grid->cells[i] = -1;
+
+    // All entries are free, linked in order
+    for (int i = 0; i < grid->entryCapacity; i++) grid->entries[i].next = (i < grid->entryCapacity - 1)? i + 1 : -1;
+
+    grid->freeEntry = (grid->entryCapacity > 0)? 0 : -1;
+    grid->itemCount = 0;
+    grid->freeItem = -1;
+}
+
+// Add item rectangle to spatial grid, returns item id
+int AddSpatialGridItem(SpatialGrid *grid, Rectangle rec)
+{
+    if (grid->cells == NULL) return -1;
+
+    int id = grid->freeItem;
+
+    if (id >= 0) grid->freeItem = grid->items[id].next;
+    else
+    {
+        if (grid->itemCount == grid->itemCapacity)
+        {
+            grid->itemCapacity = (grid->itemCapacity > 0)? grid->itemCapacity*2 : 64;
+            grid->items = (SpatialGridItem *)SPATIAL_REALLOC(grid->items, grid->itemCapacity*sizeof(SpatialGridItem));
+        }
+
+        id = grid->itemCount;
+        grid->itemCount++;
+    }
+
+    SpatialGridItem *item = &grid->items[id];
+    item->rec = rec;
+    item->minX = GetSpatialGridCell(rec.x, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    item->minY = GetSpatialGridCell(rec.y, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+    item->maxX = GetSpatialGridCell(rec.x + rec.width, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    item->maxY = GetSpatialGridCell(rec.y + rec.height, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+    item->next = -1;
+    item->stamp = 0;
+
+    InsertSpatialGridItem(grid, id);
+
+    return id;
+}
+
+// Update spatial grid item rectangle
+// NOTE: Cells entries are only updated if covered cells change
+void UpdateSpatialGridItem(SpatialGrid *grid, int id, Rectangle rec)
+{
+    if ((id < 0) || (id >= grid->itemCount) || (grid->items[id].minX < 0)) return;
+
+    SpatialGridItem *item = &grid->items[id];
+    int minX = GetSpatialGridCell(rec.x, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int minY = GetSpatialGridCell(rec.y, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+    int maxX = GetSpatialGridCell(rec.x + rec.width, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int maxY = GetSpatialGridCell(rec.y + rec.height, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+
+    item->rec = rec;
+
+    if ((minX != item->minX) || (minY != item->minY) || (maxX != item->maxX) || (maxY != item->maxY))
+    {
+        EraseSpatialGridItem(grid, id);
+
+        item->minX = minX;
+        item->minY = minY;
+        item->maxX = maxX;
+        item->maxY = maxY;
+
+        InsertSpatialGridItem(grid, id);
+    }
+}
+
+// Remove spatial grid item
+void RemoveSpatialGridItem(SpatialGrid *grid, int id)
+{
+    if ((id < 0) || (id >= grid->itemCount) || (grid->items[id].minX < 0)) return;
+
+    EraseSpatialGridItem(grid, id);
+
+    grid->items[id].minX = -1;
+    grid->items[id].next = grid->freeItem;
+    grid->freeItem = id;
+}
+
+// Query spatial grid items overlapping rectangle, returns results count
+int QuerySpatialGridRec(SpatialGrid *grid, Rectangle rec, int *results, int maxResults)
+{
+    int count = 0;
+
+    if ((grid->cells == NULL) || (results == NULL) || (maxResults <= 0)) return 0;
+
+    unsigned int stamp = NextSpatialGridStamp(grid);
+    int minX = GetSpatialGridCell(rec.x, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int minY = GetSpatialGridCell(rec.y, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+    int maxX = GetSpatialGridCell(rec.x + rec.width, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int maxY = GetSpatialGridCell(rec.y + rec.height, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        for (int x = minX; x <= maxX; x++)
+        {
+            for (int e = grid->cells[y*grid->columns + x]; e >= 0; e = grid->entries[e].next)
+            {
+                SpatialGridItem *item = &grid->items[grid->entries[e].item];
+
+                if (item->stamp == stamp) continue;
+                item->stamp = stamp;
+
+                // Same overlap test as CheckCollisionRecs()
+                if ((rec.x < (item->rec.x + item->rec.width)) && ((rec.x + rec.width) > item->rec.x) &&
+                    (rec.y < (item->rec.y + item->rec.height)) && ((rec.y + rec.height) > item->rec.y))
+                {
+                    results[count] = grid->entries[e].item;
+                    count++;
+
+                    if (count == maxResults) return count;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Query spatial grid items crossed by line segment, returns results count
+// NOTE: Segment is clipped to grid bounds and cells are traversed along segment (DDA),
+// items outside grid bounds are not tested
+int QuerySpatialGridLine(SpatialGrid *grid, Vector2 start, Vector2 end, int *results, int maxResults)
+{
+    int count = 0;
+
+    if ((grid->cells == NULL) || (results == NULL) || (maxResults <= 0)) return 0;
+
+    // Clip segment to grid bounds (Liang-Barsky)
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    float p[4] = { -dx, dx, -dy, dy };
+    float q[4] = { start.x - grid->bounds.x, grid->bounds.x + grid->bounds.width - start.x, start.y - grid->bounds.y, grid->bounds.y + grid->bounds.height - start.y };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (p[i] == 0.0f)
+        {
+            if (q[i] < 0.0f) return 0;
+        }
+        else
+        {
+            float t = q[i]/p[i];
+
+            if (p[i] < 0.0f) { if (t > t0) t0 = t; }
+            else if (t < t1) t1 = t;
+        }
+    }
+
+    if (t0 > t1) return 0;
+
+    unsigned int stamp = NextSpatialGridStamp(grid);
+
+    // Segment in cells units
+    float cx = (start.x + t0*dx - grid->bounds.x)/grid->cellSize;
+    float cy = (start.y + t0*dy - grid->bounds.y)/grid->cellSize;
+    float ex = (start.x + t1*dx - grid->bounds.x)/grid->cellSize;
+    float ey = (start.y + t1*dy - grid->bounds.y)/grid->cellSize;
+
+    int x = GetSpatialGridCell(start.x + t0*dx, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int y = GetSpatialGridCell(start.y + t0*dy, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+    int endX = GetSpatialGridCell(start.x + t1*dx, grid->bounds.x, 1.0f/grid->cellSize, grid->columns);
+    int endY = GetSpatialGridCell(start.y + t1*dy, grid->bounds.y, 1.0f/grid->cellSize, grid->rows);
+
+    int stepX = (ex > cx)? 1 : -1;
+    int stepY = (ey > cy)? 1 : -1;
+    float deltaX = (ex != cx)? 1.0f/fabsf(ex - cx) : FLT_MAX;
+    float deltaY = (ey != cy)? 1.0f/fabsf(ey - cy) : FLT_MAX;
+    float maxX = (ex != cx)? ((stepX > 0)? (x + 1 - cx) : (cx - x))*deltaX : FLT_MAX;
+    float maxY = (ey != cy)? ((stepY > 0)? (y + 1 - cy) : (cy - y))*deltaY : FLT_MAX;
+
+    // Segment direction inverse for items rectangles slabs test
+    float invX = (dx != 0.0f)? 1.0f/dx : FLT_MAX;
+    float invY = (dy != 0.0f)? 1.0f/dy : FLT_MAX;
+
+    while (true)
+    {
+        for (int e = grid->cells[y*grid->columns + x]; e >= 0; e = grid->entries[e].next)
+        {
+            SpatialGridItem *item = &grid->items[grid->entries[e].item];
+
+            if (item->stamp == stamp) continue;
+            item->stamp = stamp;
+
+            float tx1 = (item->rec.x - start.x)*invX;
+            float tx2 = (item->rec.x + item->rec.width - start.x)*invX;
+            float ty1 = (item->rec.y - start.y)*invY;
+            float ty2 = (item->rec.y + item->rec.height - start.y)*invY;
+            float tmin = (dx != 0.0f)? ((tx1 < tx2)? tx1 : tx2) : (((start.x >= item->rec.x) && (start.x <= item->rec.x + item->rec.width))? -FLT_MAX : FLT_MAX);
+            float tmax = (dx != 0.0f)? ((tx1 < tx2)? tx2 : tx1) : FLT_MAX;
+            float tymin = (dy != 0.0f)? ((ty1 < ty2)? ty1 : ty2) : (((start.y >= item->rec.y) && (start.y <= item->rec.y + item->rec.height))? -FLT_MAX : FLT_MAX);
+            float tymax = (dy != 0.0f)? ((ty1 < ty2)? ty2 : ty1) : FLT_MAX;
+
+            if (tymin > tmin) tmin = tymin;
+            if (tymax < tmax) tmax = tymax;
+
+            if ((tmin <= tmax) && (tmax >= 0.0f) && (tmin <= 1.0f))
+            {
+                results[count] = grid->entries[e].item;
+                count++;
+
+                if (count == maxResults) return count;
+            }
+        }
+
+        if ((x == endX) && (y == endY)) break;
+
+        if (maxX < maxY)
+        {
+            if (maxX > 1.0f) break;
+            x += stepX;
+            maxX += deltaX;
+        }
+        else
+        {
+            if (maxY > 1.0f) break;
+            y += stepY;
+            maxY += deltaY;
+        }
+
+        if ((x < 0) || (x >= grid->columns) || (y < 0) || (y >= grid->rows)) break;
+    }
+
+    return count;
+}
+
+// Get spatial grid overlapping items pairs, returns pairs count
+// NOTE: Pairs are checked by cell, a pair is reported only by the cell containing
+// the overlap rectangle top-left corner (items sharing several cells reported once)
+int GetSpatialGridPairs(SpatialGrid *grid, SpatialPair *pairs, int maxPairs)
+{
+    int count = 0;
+
+    if ((grid->cells == NULL) || (pairs == NULL) || (maxPairs <= 0)) return 0;
+
+    for (int y = 0; y < grid->rows; y++)
+    {
+        for (int x = 0; x < grid->columns; x++)
+        {
+            for (int e1 = grid->cells[y*grid->columns + x]; e1 >= 0; e1 = grid->entries[e1].next)
+            {
+                int id1 = grid->entries[e1].item;
+                Rectangle rec1 = grid->items[id1].rec;
+
+                for (int e2 = grid->entries[e1].next; e2 >= 0; e2 = grid->entries[e2].next)
+                {
+                    int id2 = grid->entries[e2].item;
+                    Rectangle rec2 = grid->items[id2].rec;
+
+                    if ((rec1.x < (rec2.x + rec2.width)) && ((rec1.x + rec1.width) > rec2.x) &&
+                        (rec1.y < (rec2.y + rec2.height)) && ((rec1.y + rec1.height) > rec2.y))
+                    {
+                        float cornerX = (rec1.x > rec2.x)? rec1.x : rec2.x;
+                        float cornerY = (rec1.y > rec2.y)? rec1.y : rec2.y;
+
+                        if ((GetSpatialGridCell(cornerX, grid->bounds.x, 1.0f/grid->cellSize, grid->columns) != x) ||
+                            (GetSpatialGridCell(cornerY, grid->bounds.y, 1.0f/grid->cellSize, grid->rows) != y)) continue;
+
+                        pairs[count].a = (id1 < id2)? id1 : id2;
+                        pairs[count].b = (id1 < id2)? id2 : id1;
+                        count++;
+
+                        if (count == maxPairs) return count;
+                    }
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Spatial tree
+//----------------------------------------------------------------------------------
+
+// Load spatial tree, items boxes enlarged by margin
+SpatialTree LoadSpatialTree(float margin)
+{
+    SpatialTree tree = { 0 };
+
+    tree.freeNode = -1;
+    tree.root = -1;
+    tree.margin = (margin > 0.0f)? margin : 0.0f;
+
+    return tree;
+}
+
+// Unload spatial tree
+void UnloadSpatialTree(SpatialTree tree)
+{
+    SPATIAL_FREE(tree.nodes);
+}
+
+// Add item box to spatial tree, returns item id
+int AddSpatialTreeItem(SpatialTree *tree, BoundingBox box)
+{
+    int leaf = AllocateSpatialTreeNode(tree);
+    SpatialTreeNode *node = &tree->nodes[leaf];
+
+    node->itemBox = box;
+    node->box = (BoundingBox){ { box.min.x - tree->margin, box.min.y - tree->margin, box.min.z - tree->margin },
+                               { box.max.x + tree->margin, box.max.y + tree->margin, box.max.z + tree->margin } };
+    node->height = 0;
+
+    InsertSpatialTreeLeaf(tree, leaf);
+
+    return leaf;
+}
+
+// Update spatial tree item box
+// NOTE: Item is only reinserted if box is not contained in enlarged box
+void UpdateSpatialTreeItem(SpatialTree *tree, int id, BoundingBox box)
+{
+    if ((id < 0) || (id >= tree->nodeCount) || (tree->nodes[id].height != 0)) return;
+
+    SpatialTreeNode *node = &tree->nodes[id];
+    node->itemBox = box;
+
+    if ((box.min.x >= node->box.min.x) && (box.min.y >= node->box.min.y) && (box.min.z >= node->box.min.z) &&
+        (box.max.x <= node->box.max.x) && (box.max.y <= node->box.max.y) && (box.max.z <= node->box.max.z)) return;
+
+    RemoveSpatialTreeLeaf(tree, id);
+
+    node = &tree->nodes[id];
+    node->box = (BoundingBox){ { box.min.x - tree->margin, box.min.y - tree->margin, box.min.z - tree->margin },
+                               { box.max.x + tree->margin, box.max.y + tree->margin, box.max.z + tree->margin } };
+
+    InsertSpatialTreeLeaf(tree, id);
+}
+
+// Remove spatial tree item
+void RemoveSpatialTreeItem(SpatialTree *tree, int id)
+{
+    if ((id < 0) || (id >= tree->nodeCount) || (tree->nodes[id].height != 0)) return;
+
+    RemoveSpatialTreeLeaf(tree, id);
+    FreeSpatialTreeNode(tree, id);
+}
+
+// Query spatial tree items overlapping box, returns results count
+int QuerySpatialTreeBox(SpatialTree *tree, BoundingBox box, int *results, int maxResults)
+{
+    int count = 0;
+
+    if ((tree->root < 0) || (results == NULL) || (maxResults <= 0)) return 0;
+
+    int stack[SPATIAL_TREE_STACK_SIZE];     // Pending nodes (not initialized, query hot path)
+    int stackSize = 1;
+    stack[0] = tree->root;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        const SpatialTreeNode *node = &tree->nodes[stack[stackSize]];
+
+        if (!CheckSpatialBoxes(node->box, box)) continue;
+
+        if (node->child1 < 0)
+        {
+            if (CheckSpatialBoxes(node->itemBox, box))
+            {
+                results[count] = stack[stackSize];
+                count++;
+
+                if (count == maxResults) return count;
+            }
+        }
+        else if (stackSize <= SPATIAL_TREE_STACK_SIZE - 2)
+        {
+            stack[stackSize] = node->child1;
+            stack[stackSize + 1] = node->child2;
+            stackSize += 2;
+        }
+    }
+
+    return count;
+}
+
+// Query spatial tree items hit by ray up to distance, returns results count
+// NOTE: Distance is measured in ray direction units, results are not sorted by distance
+int QuerySpatialTreeRay(SpatialTree *tree, Ray ray, float maxDistance, int *results, int maxResults)
+{
+    int count = 0;
+
+    if ((tree->root < 0) || (results == NULL) || (maxResults <= 0)) return 0;
+
+    Vector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+
+    int stack[SPATIAL_TREE_STACK_SIZE];     // Pending nodes (not initialized, query hot path)
+    int stackSize = 1;
+    stack[0] = tree->root;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        const SpatialTreeNode *node = &tree->nodes[stack[stackSize]];
+
+        if (!CheckSpatialRayBox(ray.position, invDirection, node->box, maxDistance)) continue;
+
+        if (node->child1 < 0)
+        {
+            if (CheckSpatialRayBox(ray.position, invDirection, node->itemBox, maxDistance))
+            {
+                results[count] = stack[stackSize];
+                count++;
+
+                if (count == maxResults) return count;
+            }
+        }
+        else if (stackSize <= SPATIAL_TREE_STACK_SIZE - 2)
+        {
+            stack[stackSize] = node->child1;
+            stack[stackSize + 1] = node->child2;
+            stackSize += 2;
+        }
+    }
+
+    return count;
+}
+
+// Get spatial tree overlapping items pairs, returns pairs count
+// NOTE: Every leaf queries the tree, pairs are reported by the lowest id item
+int GetSpatialTreePairs(SpatialTree *tree, SpatialPair *pairs, int maxPairs)
+{
+    int count = 0;
+
+    if ((tree->root < 0) || (pairs == NULL) || (maxPairs <= 0)) return 0;
+
+    int stack[SPATIAL_TREE_STACK_SIZE];     // Pending nodes (not initialized, query hot path)
+
+    for (int leaf = 0; leaf < tree->nodeCount; leaf++)
+    {
+        if (tree->nodes[leaf].height != 0) continue;
+
+        BoundingBox box = tree->nodes[leaf].itemBox;
+        int stackSize = 1;
+        stack[0] = tree->root;
+
+        while (stackSize > 0)
+        {
+            stackSize--;
+            int index = stack[stackSize];
+            const SpatialTreeNode *node = &tree->nodes[index];
+
+            if (!CheckSpatialBoxes(node->box, box)) continue;
+
+            if (node->child1 < 0)
+            {
+                if ((index > leaf) && CheckSpatialBoxes(node->itemBox, box))
+                {
+                    pairs[count].a = leaf;
+                    pairs[count].b = index;
+                    count++;
+
+                    if (count == maxPairs) return count;
+                }
+            }
+            else if (stackSize <= SPATIAL_TREE_STACK_SIZE - 2)
+            {
+                stack[stackSize] = node->child1;
+                stack[stackSize + 1] = node->child2;
+                stackSize += 2;
+            }
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get grid cell coordinate for value (clamped to grid)
+// NOTE: Values before origin are clamped to first cell, truncation is enough (no floorf())
+static int GetSpatialGridCell(float value, float origin, float invCellSize, int count)
+{
+    float position = (value - origin)*invCellSize;
+    int cell = (position > 0.0f)? (int)position : 0;
+
+    if (cell < 0) cell = 0;
+    else if (cell >= count) cell = count - 1;
+
+    return cell;
+}
+
+// Insert grid item entries in covered cells
+static void InsertSpatialGridItem(SpatialGrid *grid, int id)
+{
+    SpatialGridItem *item = &grid->items[id];
+
+    for (int y = item->minY; y <= item->maxY; y++)
+    {
+        for (int x = item->minX; x <= item->maxX; x++)
+        {
+            if (grid->freeEntry < 0)
+            {
+                // Grow entries pool, new entries linked as free entries
+                int capacity = (grid->entryCapacity > 0)? grid->entryCapacity*2 : 256;
+                grid->entries = (SpatialGridEntry *)SPATIAL_REALLOC(grid->entries, capacity*sizeof(SpatialGridEntry));
+
+                for (int i = grid->entryCapacity; i < capacity; i++) grid->entries[i].next = (i < capacity - 1)? i + 1 : -1;
+
+                grid->freeEntry = grid->entryCapacity;
+                grid->entryCapacity = capacity;
+            }
+
+            int entry = grid->freeEntry;
+            int *cell = &grid->cells[y*grid->columns + x];
+
+            grid->freeEntry = grid->entries[entry].next;
+            grid->entries[entry].item = id;
+            grid->entries[entry].next = *cell;
+            *cell = entry;
+        }
+    }
+}
+
+// Erase grid item entries from covered cells
+static void EraseSpatialGridItem(SpatialGrid *grid, int id)
+{
+    SpatialGridItem *item = &grid->items[id];
+
+    for (int y = item->minY; y <= item->maxY; y++)
+    {
+        for (int x = item->minX; x <= item->maxX; x++)
+        {
+            int *link = &grid->cells[y*grid->columns + x];
+
+            while (*link >= 0)
+            {
+                int entry = *link;
+
+                if (grid->entries[entry].item == id)
+                {
+                    *link = grid->entries[entry].next;
+                    grid->entries[entry].next = grid->freeEntry;
+                    grid->freeEntry = entry;
+                    break;
+                }
+
+                link = &grid->entries[entry].next;
+            }
+        }
+    }
+}
+
+// Get next query stamp, items stamps are reset on stamp wrap
+static unsigned int NextSpatialGridStamp(SpatialGrid *grid)
+{
+    grid->stamp++;
+
+    if (grid->stamp == 0)
+    {
+        for (int i = 0; i < grid->itemCount; i++) grid->items[i].stamp = 0;
+        grid->stamp = 1;
+    }
+
+    return grid->stamp;
+}
+
+// Allocate tree node from free nodes list, nodes array grows if required
+static int AllocateSpatialTreeNode(SpatialTree *tree)
+{
+    if (tree->freeNode < 0)
+    {
+        int capacity = (tree->nodeCapacity > 0)? tree->nodeCapacity*2 : 64;
+        tree->nodes = (SpatialTreeNode *)SPATIAL_REALLOC(tree->nodes, capacity*sizeof(SpatialTreeNode));
+
+        for (int i = tree->nodeCapacity; i < capacity; i++)
+        {
+            tree->nodes[i].parent = (i < capacity - 1)? i + 1 : -1;
+            tree->nodes[i].height = -1;
+        }
+
+        tree->freeNode = tree->nodeCapacity;
+        tree->nodeCapacity = capacity;
+    }
+
+    int index = tree->freeNode;
+    SpatialTreeNode *node = &tree->nodes[index];
+
+    tree->freeNode = node->parent;
+    if (index >= tree->nodeCount) tree->nodeCount = index + 1;
+
+    node->parent = -1;
+    node->child1 = -1;
+    node->child2 = -1;
+    node->height = 0;
+
+    return index;
+}
+
+// Free tree node to free nodes list
+static void FreeSpatialTreeNode(SpatialTree *tree, int node)
+{
+    tree->nodes[node].parent = tree->freeNode;
+    tree->nodes[node].height = -1;
+    tree->freeNode = node;
+}
+
+// Insert leaf in tree
+// NOTE: Sibling is chosen descending from root by boxes area cost (surface area heuristic),
+// ancestors boxes are refit and balanced by rotations on the way back to root
+static void InsertSpatialTreeLeaf(SpatialTree *tree, int leaf)
+{
+    if (tree->root < 0)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
+
+    BoundingBox leafBox = tree->nodes[leaf].box;
+    int index = tree->root;
+
+    while (tree->nodes[index].child1 >= 0)
+    {
+        int child1 = tree->nodes[index].child1;
+        int child2 = tree->nodes[index].child2;
+
+        float area = GetSpatialBoxArea(tree->nodes[index].box);
+        float combinedArea = GetSpatialBoxArea(MergeSpatialBoxes(tree->nodes[index].box, leafBox));
+
+        // Cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f*combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f*(combinedArea - area);
+
+        float cost1 = GetSpatialBoxArea(MergeSpatialBoxes(leafBox, tree->nodes[child1].box)) + inheritanceCost;
+        if (tree->nodes[child1].child1 >= 0) cost1 -= GetSpatialBoxArea(tree->nodes[child1].box);
+
+        float cost2 = GetSpatialBoxArea(MergeSpatialBoxes(leafBox, tree->nodes[child2].box)) + inheritanceCost;
+        if (tree->nodes[child2].child1 >= 0) cost2 -= GetSpatialBoxArea(tree->nodes[child2].box);
+
+        if ((cost < cost1) && (cost < cost2)) break;
+
+        index = (cost1 < cost2)? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // Create new parent for sibling and leaf
+    // NOTE: Nodes array can be reallocated, nodes accessed by index
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateSpatialTreeNode(tree);
+
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].box = MergeSpatialBoxes(leafBox, tree->nodes[sibling].box);
+    tree->nodes[newParent].height = tree->nodes[sibling].height + 1;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    if (oldParent >= 0)
+    {
+        if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+        else tree->nodes[oldParent].child2 = newParent;
+    }
+    else tree->root = newParent;
+
+    // Refit ancestors boxes and heights
+    index = tree->nodes[leaf].parent;
+
+    while (index >= 0)
+    {
+        index = BalanceSpatialTree(tree, index);
+
+        int child1 = tree->nodes[index].child1;
+        int child2 = tree->nodes[index].child2;
+        int height1 = tree->nodes[child1].height;
+        int height2 = tree->nodes[child2].height;
+
+        tree->nodes[index].height = 1 + ((height1 > height2)? height1 : height2);
+        tree->nodes[index].box = MergeSpatialBoxes(tree->nodes[child1].box, tree->nodes[child2].box);
+
+        index = tree->nodes[index].parent;
+    }
+}
+
+// Remove leaf from tree, leaf parent is replaced by leaf sibling
+static void RemoveSpatialTreeLeaf(SpatialTree *tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = -1;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    if (grandParent >= 0)
+    {
+        if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+        else tree->nodes[grandParent].child2 = sibling;
+
+        tree->nodes[sibling].parent = grandParent;
+        FreeSpatialTreeNode(tree, parent);
+
+        // Refit ancestors boxes and heights
+        int index = grandParent;
+
+        while (index >= 0)
+        {
+            index = BalanceSpatialTree(tree, index);
+
+            int child1 = tree->nodes[index].child1;
+            int child2 = tree->nodes[index].child2;
+            int height1 = tree->nodes[child1].height;
+            int height2 = tree->nodes[child2].height;
+
+            tree->nodes[index].box = MergeSpatialBoxes(tree->nodes[child1].box, tree->nodes[child2].box);
+            tree->nodes[index].height = 1 + ((height1 > height2)? height1 : height2);
+
+            index = tree->nodes[index].parent;
+        }
+    }
+    else
+    {
+        tree->root = sibling;
+        tree->nodes[sibling].parent = -1;
+        FreeSpatialTreeNode(tree, parent);
+    }
+
+    tree->nodes[leaf].parent = -1;
+}
+
+// Balance tree node by rotation, returns new subtree root
+// NOTE: Child higher than its sibling by more than one level is rotated up (AVL rotation)
+static int BalanceSpatialTree(SpatialTree *tree, int iA)
+{
+    SpatialTreeNode *nodes = tree->nodes;
+    SpatialTreeNode *A = &nodes[iA];
+
+    if ((A->child1 < 0) || (A->height < 2)) return iA;
+
+    int iB = A->child1;
+    int iC = A->child2;
+    SpatialTreeNode *B = &nodes[iB];
+    SpatialTreeNode *C = &nodes[iC];
+
+    int balance = C->height - B->height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        int iF = C->child1;
+        int iG = C->child2;
+        SpatialTreeNode *F = &nodes[iF];
+        SpatialTreeNode *G = &nodes[iG];
+
+        // Swap A and C
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+
+        // A old parent should point to C
+        if (C->parent >= 0)
+        {
+            if (nodes[C->parent].child1 == iA) nodes[C->parent].child1 = iC;
+            else nodes[C->parent].child2 = iC;
+        }
+        else tree->root = iC;
+
+        // Rotate
+        if (F->height > G->height)
+        {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->box = MergeSpatialBoxes(B->box, G->box);
+            C->box = MergeSpatialBoxes(A->box, F->box);
+
+            A->height = 1 + ((B->height > G->height)? B->height : G->height);
+            C->height = 1 + ((A->height > F->height)? A->height : F->height);
+        }
+        else
+        {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->box = MergeSpatialBoxes(B->box, F->box);
+            C->box = MergeSpatialBoxes(A->box, G->box);
+
+            A->height = 1 + ((B->height > F->height)? B->height : F->height);
+            C->height = 1 + ((A->height > G->height)? A->height : G->height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        int iD = B->child1;
+        int iE = B->child2;
+        SpatialTreeNode *D = &nodes[iD];
+        SpatialTreeNode *E = &nodes[iE];
+
+        // Swap A and B
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+
+        // A old parent should point to B
+        if (B->parent >= 0)
+        {
+            if (nodes[B->parent].child1 == iA) nodes[B->parent].child1 = iB;
+            else nodes[B->parent].child2 = iB;
+        }
+        else tree->root = iB;
+
+        // Rotate
+        if (D->height > E->height)
+        {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->box = MergeSpatialBoxes(C->box, E->box);
+            B->box = MergeSpatialBoxes(A->box, D->box);
+
+            A->height = 1 + ((C->height > E->height)? C->height : E->height);
+            B->height = 1 + ((A->height > D->height)? A->height : D->height);
+        }
+        else
+        {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->box = MergeSpatialBoxes(C->box, D->box);
+            B->box = MergeSpatialBoxes(A->box, E->box);
+
+            A->height = 1 + ((C->height > D->height)? C->height : D->height);
+            B->height = 1 + ((A->height > E->height)? A->height : E->height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Get box containing both boxes
+static BoundingBox MergeSpatialBoxes(BoundingBox a, BoundingBox b)
+{
+    BoundingBox box = a;
+
+    if (b.min.x < box.min.x) box.min.x = b.min.x;
+    if (b.min.y < box.min.y) box.min.y = b.min.y;
+    if (b.min.z < box.min.z) box.min.z = b.min.z;
+    if (b.max.x > box.max.x) box.max.x = b.max.x;
+    if (b.max.y > box.max.y) box.max.y = b.max.y;
+    if (b.max.z > box.max.z) box.max.z = b.max.z;
+
+    return box;
+}
+
+// Get box surface area (half), insertion cost metric
+static float GetSpatialBoxArea(BoundingBox box)
+{
+    float dx = box.max.x - box.min.x;
+    float dy = box.max.y - box.min.y;
+    float dz = box.max.z - box.min.z;
+
+    return dx*dy + dy*dz + dz*dx;
+}
+
+// Check boxes overlap, same test as CheckCollisionBoxes()
+static bool CheckSpatialBoxes(BoundingBox a, BoundingBox b)
+{
+    if ((a.max.x >= b.min.x) && (a.min.x <= b.max.x) &&
+        (a.max.y >= b.min.y) && (a.min.y <= b.max.y) &&
+        (a.max.z >= b.min.z) && (a.min.z <= b.max.z)) return true;
+
+    return false;
+}
+
+// Check ray hits box before max distance (slabs test)
+static bool CheckSpatialRayBox(Vector3 origin, Vector3 invDirection, BoundingBox box, float maxDistance)
+{
+    float t1 = (box.min.x - origin.x)*invDirection.x;
+    float t2 = (box.max.x - origin.x)*invDirection.x;
+    float tmin = (t1 < t2)? t1 : t2;
+    float tmax = (t1 < t2)? t2 : t1;
+
+    t1 = (box.min.y - origin.y)*invDirection.y;
+    t2 = (box.max.y - origin.y)*invDirection.y;
+    if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+    if (t1 > tmin) tmin = t1;
+    if (t2 < tmax) tmax = t2;
+
+    t1 = (box.min.z - origin.z)*invDirection.z;
+    t2 = (box.max.z - origin.z)*invDirection.z;
+    if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+    if (t1 > tmin) tmin = t1;
+    if (t2 < tmax) tmax = t2;
+
+    return ((tmax >= tmin) && (tmax >= 0.0f) && (tmin <= maxDistance));
+}
+
+#endif // SPATIAL_IMPLEMENTATION
@@ -16,11 +16,8 @@
 *       Load default raylib font on initialization to be used by DrawText() and MeasureText().
 *       If no default font loaded, DrawTextEx() and MeasureTextEx() are required.
 *
-*   #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
-*       TextSplit() function static buffer max size
-*
-*   #define MAX_TEXTSPLIT_COUNT
-*       TextSplit() function static substrings pointers array (pointing to static buffer)
+*   NOTE: Text functions results (TextFormat(), TextSubtext(), TextJoin(), TextSplit()...) are allocated
+*   from frame memory (utils module), they are valid until EndDrawing(), no need to free them
 *
 *
 *   DEPENDENCIES:
@@ -58,19 +55,41 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
+#define MEMORY_MODULE MEMORY_MODULE_TEXT    // Memory tracking module (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: LoadFile*()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
+#if defined(SUPPORT_SIMD_RAYMATH)
+    #define RAYMATH_SIMD            // Use SIMD instructions for raymath hot functions
+#endif
+#include "raymath.h"        // Required for: MatrixMultiply(), MatrixTranslate() [Used in DrawTextLayout()]
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
-#include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
+#include <string.h>         // Required for: strlen(), memchr(), strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <math.h>           // Required for: sqrtf(), fabsf(), fminf(), fmaxf(), acosf(), cosf(), powf() [Used in GenGlyphMsdf()]
+
+// SIMD UTF-8 decoding ASCII fast path (DecodeUTF8Into()), scalar fallback if not available
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RTEXT_SIMD_SSE2
+    #include <emmintrin.h>          // Required for: SSE2 intrinsics
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RTEXT_SIMD_NEON
+    #include <arm_neon.h>           // Required for: NEON intrinsics
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
     #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
 
+    // NOTE: Glyphs rasterization temporary memory is taken from thread scratch memory (if available)
+    static void *GlyphScratchAlloc(size_t size);
+    static void GlyphScratchFree(void *ptr);
+
+    #define STBTT_malloc(x,u)   ((void)(u), GlyphScratchAlloc(x))
+    #define STBTT_free(x,u)     ((void)(u), GlyphScratchFree(x))
+
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
     #include "external/stb_truetype.h"      // Required for: ttf font data reading
@@ -79,21 +98,190 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#ifndef MAX_TEXT_BUFFER_LENGTH
-    #define MAX_TEXT_BUFFER_LENGTH              1024        // Size of internal static buffers used on some functions:
-                                                            // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
-#endif
 #ifndef MAX_TEXT_UNICODE_CHARS
     #define MAX_TEXT_UNICODE_CHARS               512        // Maximum number of unicode codepoints: GetCodepoints()
 #endif
 #ifndef MAX_TEXTSPLIT_COUNT
-    #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
+    #define MAX_TEXTSPLIT_COUNT               262144        // Maximum number of substrings to split: TextSplit()
+#endif
+#ifndef GLYPH_NOTFOUND_CHAR_FALLBACK
+    #define GLYPH_NOTFOUND_CHAR_FALLBACK          63        // Character used if requested codepoint is not found: '?'
+#endif
+
+#ifndef FONT_GLYPHS_SCRATCH_SIZE
+    #define FONT_GLYPHS_SCRATCH_SIZE      (256*1024)        // Glyphs rasterization scratch memory size by jobs range (bigger allocations use heap)
+#endif
+#ifndef FONT_MSDF_CHAR_PADDING
+    #define FONT_MSDF_CHAR_PADDING           4      // MSDF font generation char padding (distance field border)
+#endif
+#ifndef FONT_MSDF_PIXEL_RANGE
+    #define FONT_MSDF_PIXEL_RANGE         4.0f      // MSDF font generation distance range in pixels (full channel range)
+#endif
+#ifndef FONT_KERNING_MAX_GLYPHS
+    #define FONT_KERNING_MAX_GLYPHS        512      // Font kerning pairs search maximum glyphs (GPOS), fonts with more glyphs use kern table only
+#endif
+#ifndef TEXT_RUNS_CACHE_SIZE
+    #define TEXT_RUNS_CACHE_SIZE            64      // Text shaped runs cache size, least recently used run is replaced
+#endif
+#ifndef TEXT_RUN_MAX_LENGTH
+    #define TEXT_RUN_MAX_LENGTH           1024      // Text shaped run maximum text length in bytes (longer texts are not cached)
+#endif
+#ifndef FONT_DYNAMIC_ATLAS_SIZE
+    #define FONT_DYNAMIC_ATLAS_SIZE             1024        // Dynamic font default atlas size (width and height)
 #endif
+#define FONT_BINARY_VERSION                      100        // Font binary file format version, ExportFontBinary()
+
+#ifndef TEXT_INTERN_ARENA_BLOCK_SIZE
+    #define TEXT_INTERN_ARENA_BLOCK_SIZE   (64*1024)        // Text intern table strings memory arena block size
+#endif
+#ifndef TEXT_LAYOUT_INSTANCED_MIN_GLYPHS
+    #define TEXT_LAYOUT_INSTANCED_MIN_GLYPHS     512        // Text layout minimum glyphs to be drawn instanced (smaller layouts drawn on render batch)
+#endif
+
+#define TEXT_LAYOUT_INSTANCE_FLOATS                8        // Text layout glyph instance data: quad rectangle and source texcoords
+#define TEXT_DECODE_CHUNK_SIZE                   256        // Codepoints decoded per chunk by text drawing and measuring (stack buffer)
+
+// Glyphs rasterization scratch memory is thread-local, every jobs system worker uses its own
+#if defined(_MSC_VER)
+    #define TEXT_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define TEXT_THREAD_LOCAL _Thread_local
+#else
+    #define TEXT_THREAD_LOCAL __thread
+#endif
+
+#define GLYPH_LOOKUP_DIRECT_SIZE                 256        // Glyphs lookup direct table size: Basic Latin + Latin-1 Supplement codepoints
+#define FONT_DYNAMIC_MIN_GLYPHS                  128        // Dynamic font minimum atlas glyphs (ASCII codepoints and fallback glyph index)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job data
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info for data reading
+    GlyphInfo *chars;               // Output glyphs info
+    const int *fontChars;           // Codepoints to rasterize
+    int fontSize;                   // Font base size
+    int type;                       // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF
+    float scaleFactor;              // Font scale factor for pixel height
+    int ascent;                     // Font ascent (baseline)
+} FontGlyphsJob;
+
+// Glyphs rasterization scratch memory, linear allocator reset after every glyph
+typedef struct GlyphScratch {
+    unsigned char *buffer;          // Scratch memory buffer
+    size_t size;                    // Scratch memory size
+    size_t used;                    // Scratch memory used by current glyph
+} GlyphScratch;
+
+// MSDF glyph shape edge, bitmap pixels space
+typedef struct MsdfEdge {
+    Vector2 p[3];                   // Edge points: line (p[0], p[1]), quadratic curve (p[0], control p[1], p[2])
+    int type;                       // Edge type: 1-Line, 2-Quadratic curve
+    int color;                      // Edge channels mask: 1-Red, 2-Green, 4-Blue
+} MsdfEdge;
+
+// MSDF signed distance
+typedef struct MsdfDistance {
+    float distance;                 // Signed distance to edge
+    float dot;                      // Edge direction and nearest point vector alignment (equal distances solving)
+} MsdfDistance;
+
+// Dynamic font data, glyphs rasterized on first use into atlas cells
+// NOTE: Font glyphs, recs and texture are fixed on loading (Font is used by value), every glyph slot
+// maps to one atlas cell, least recently used glyph slot is reused when all slots are in use
+typedef struct FontDynamic {
+    unsigned char *fileData;        // Font file data (kept resident for rasterization)
+    stbtt_fontinfo fontInfo;        // Font info for data reading
+    float scaleFactor;              // Font scale factor for pixel height
+    int ascent;                     // Font ascent (baseline)
+    int fontSize;                   // Font base size
+    int padding;                    // Glyphs padding inside cells
+    int cellWidth;                  // Atlas cell width (including padding)
+    int cellHeight;                 // Atlas cell height (including padding)
+    int columns;                    // Atlas cells per row
+
+    GlyphInfo *glyphs;              // Font glyphs (slots)
+    Rectangle *recs;                // Font glyphs rectangles in atlas
+    int glyphCount;                 // Font glyphs slots count
+    int slotsUsed;                  // Glyphs slots used, consecutively until atlas is full
+    unsigned int *lastUse;          // Glyphs slots last use (LRU)
+    unsigned int useCounter;        // Glyphs use counter
+
+    unsigned int textureId;         // Atlas texture id
+    Image atlas;                    // Atlas image (RAM copy, GRAY_ALPHA)
+    int dirtyMinY;                  // Atlas first row pending upload
+    int dirtyMaxY;                  // Atlas last row pending upload (lower than dirtyMinY: no rows pending)
+} FontDynamic;
+#else
+typedef struct FontDynamic FontDynamic;
+#endif
+
+// Glyphs lookup, codepoint to glyph index
+// NOTE: Codepoints [0..255] are indexed directly, other codepoints are hashed (open addressing, linear probing),
+// glyphs array and count are kept to validate lookup when font data is replaced by user
+struct rGlyphLookup {
+    const GlyphInfo *glyphs;        // Glyphs array indexed
+    int glyphCount;                 // Glyphs count indexed
+    int direct[GLYPH_LOOKUP_DIRECT_SIZE];   // Glyph index for direct codepoints (-1: not available)
+    int capacity;                   // Hash table capacity (power of two, 0: no hashed codepoints)
+    int *keys;                      // Hash table codepoints (-1: empty slot)
+    int *values;                    // Hash table glyph index
+    FontDynamic *dynamic;           // Dynamic font data (NULL: static font)
+    int fontType;                   // Font glyphs type: FONT_DEFAULT, FONT_MSDF (drawn with MSDF shader)
+    int kerningCapacity;            // Kerning hash table capacity (power of two, 0: no kerning pairs)
+    unsigned int *kerningKeys;      // Kerning hash table glyphs pairs (index << 16 | next index, 0xffffffff: empty slot)
+    float *kerningValues;           // Kerning hash table advance adjustment (pixels at font base size)
+};
+
+// Font binary file header (.rfnb), ExportFontBinary()/LoadFontBinary()
+// NOTE: Header is followed by glyphs info (value, offsetX, offsetY, advanceX as int), glyphs rectangles (float),
+// kerning hash table (keys and values, as loaded in glyphs lookup) and atlas pixels data (optionally DEFLATE compressed),
+// all data is 4-byte aligned and little-endian
+typedef struct FontBinaryHeader {
+    char id[4];                     // File identifier: "rFNB"
+    int version;                    // File format version: FONT_BINARY_VERSION
+    int baseSize;                   // Font base size
+    int glyphCount;                 // Font glyphs count
+    int glyphPadding;               // Font glyphs padding
+    int fontType;                   // Font glyphs type: FONT_DEFAULT, FONT_MSDF
+    int atlasWidth;                 // Atlas image width
+    int atlasHeight;                // Atlas image height
+    int atlasFormat;                // Atlas image pixel format (PixelFormat)
+    int atlasDataSize;              // Atlas data size in file (compressed data size if compressed)
+    int atlasCompressed;            // Atlas data DEFLATE compressed
+    int kerningCapacity;            // Kerning hash table capacity (0: no kerning pairs)
+} FontBinaryHeader;
+
+// Text interned string, strings stored in intern table memory arena
+typedef struct TextInterned {
+    const char *text;               // Text string copy (stable pointer)
+    unsigned int length;            // Text length in bytes
+    unsigned int hash;              // Text hash, TextHash()
+} TextInterned;
+
+// Text shaped run, glyphs positions for text drawing (cached)
+// NOTE: Run is shaped for one font, size and spacing, text copy is kept to check hash collisions
+typedef struct TextRun {
+    const rGlyphLookup *lookup;     // Font glyphs lookup shaped with (NULL: run not in use)
+    float fontSize;                 // Font size shaped with
+    float spacing;                  // Characters spacing shaped with
+    unsigned int hash;              // Text hash
+    int length;                     // Text length in bytes
+    char *text;                     // Text copy
+    int glyphCount;                 // Glyphs to draw (spaces and line breaks not included)
+    int *indices;                   // Glyphs index in font
+    Vector2 *positions;             // Glyphs positions, relative to text position
+    unsigned int lastUse;           // Run last use (LRU)
+} TextRun;
+
+// Font async load request data
+typedef struct FontAsyncLoad {
+    char *fileName;                 // Font file name
+    Font font;                      // Loaded font (TTF glyphs decoded on loader thread)
+    Image image;                    // Decoded image: TTF glyphs atlas or XNA style font image (loader thread)
+} FontAsyncLoad;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -104,10 +292,38 @@
 static Font defaultFont = { 0 };
 #endif
 
+static TextRun textRuns[TEXT_RUNS_CACHE_SIZE] = { 0 };  // Text shaped runs cache
+
+// NOTE: Interned strings id is index + 1 in strings array (0: no string), ids hash table uses open addressing
+static TextInterned *textInterned = NULL;   // Text intern table strings
+static int textInternedCount = 0;           // Text intern table strings count
+static int textInternedCapacity = 0;        // Text intern table strings array capacity
+static unsigned int *textInternedIds = NULL;    // Text intern table ids hash table (0: empty slot)
+static int textInternedIdsCapacity = 0;     // Text intern table ids hash table capacity (power of two)
+static MemArena textInternedArena = { 0 };  // Text intern table strings memory
+static unsigned int textRunsUseCounter = 0;             // Text shaped runs use counter
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static TEXT_THREAD_LOCAL GlyphScratch *glyphScratch = NULL;     // Current thread glyphs scratch memory (NULL: heap allocations)
+
+static Shader fontMsdfShader = { 0 };       // Font MSDF default shader, shared by MSDF fonts
+static int fontMsdfShaderRangeLoc = -1;     // Font MSDF shader screen pixels range uniform location
+static int fontMsdfShaderUsers = 0;         // Font MSDF shader users (MSDF fonts loaded)
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader textLayoutShader = { 0 };     // Text layout instancing shader, shared by instanced layouts
+static bool textLayoutShaderFailed = false; // Text layout shader failed to load (or instancing not supported), render batch used
+static int textLayoutShaderLocs[2] = { -1, -1 };    // Text layout shader instance attributes locations: rectangle, source
+static unsigned int textLayoutVaoId = 0;    // Text layout glyph quad vertex array
+static unsigned int textLayoutVboId = 0;    // Text layout glyph quad corners buffer
+static int textLayoutShaderUsers = 0;       // Text layout shader users (instanced layouts loaded)
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+extern bool GetScissorArea(Rectangle *area);    // [Module: core] Get scissor mode area, required by DrawTextBoxed()
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -115,6 +331,44 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphs(int start, int end, void *userData);   // Rasterize font glyphs range, jobs system callback
+#endif
+static void DecodeFontAsync(void *data);          // Decode font async load glyphs and atlas image (loader thread)
+static void FinalizeFontAsync(void *data);        // Finalize font async load, atlas uploaded to GPU (main thread)
+
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyphs lookup for codepoints
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                            // Unload glyphs lookup
+static int GetGlyphLookupIndex(const rGlyphLookup *lookup, int codepoint);      // Get glyph index from lookup (-1: not found)
+static void AddGlyphLookupIndex(rGlyphLookup *lookup, int codepoint, int index);    // Add codepoint glyph index to lookup (first index kept)
+static void RemoveGlyphLookupIndex(rGlyphLookup *lookup, int codepoint);        // Remove codepoint from lookup
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontKerning(rGlyphLookup *lookup, const unsigned char *fileData, int fontSize);  // Load font kerning pairs into glyphs lookup
+#endif
+static float GetGlyphKerningIndex(Font font, int index, int nextIndex);         // Get glyphs pair kerning by index (pixels at font base size)
+static float GetGlyphLookupKerning(const rGlyphLookup *lookup, int index, int nextIndex); // Get glyphs pair kerning from lookup kerning pairs
+static const TextRun *GetTextRun(Font font, const char *text, int size, float fontSize, float spacing);  // Get text shaped run from cache (shaped on miss)
+static void UnloadTextRuns(const rGlyphLookup *lookup);                        // Unload text shaped runs of font lookup (NULL: all runs)
+static int GetTextLineEnd(Font font, const char *text, int start, int size, float maxWidth, float fontSize, float spacing, int wrapMode, int *next);  // Get text line end byte for boxed drawing (next line start returned)
+static void ClipTextScissorArea(float *top, float *bottom);                    // Clip text vertical drawing range to scissor mode area
+static int DecodeUTF8(const char *text, int byteCount, int *codepoints, int capacity, int *bytesRead);  // Decode UTF-8 bytes into codepoints (validating), only counted if codepoints is NULL
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static int LoadFontDynamicGlyph(rGlyphLookup *lookup, int codepoint);           // Rasterize dynamic font glyph into atlas, returns glyph index
+static void UpdateFontDynamicAtlas(FontDynamic *dynamic);                       // Upload dynamic font atlas rows pending
+#endif
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint);  // Draw one glyph by index
+static void DrawTextGlyphPro(Font font, int index, Vector2 position, Vector2 origin, float rotation, float fontSize, Color tint);  // Draw one glyph by index, rotated around position
+static float GetFontPixelRange(Font font, float fontSize);                     // Get font distance field screen pixels range (0: not MSDF font)
+static bool BeginFontShaderMode(float pixelRange);                             // Begin MSDF shader mode if default shader active (returns true if set)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static unsigned char *GenGlyphMsdf(const stbtt_fontinfo *fontInfo, int codepoint, float scale, int padding, float range, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph MSDF (RGB)
+static void LoadFontMsdfShader(void);                                          // Load font MSDF shader (shared, users counted)
+static void UnloadFontMsdfShader(void);                                        // Unload font MSDF shader (when no users left)
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool LoadTextLayoutShader(void);                                        // Load text layout instancing shader (shared, users counted)
+static void UnloadTextLayoutShader(void);                                      // Unload text layout instancing shader (when no users left)
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -271,6 +525,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -282,6 +537,10 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.glyphLookup);
+    defaultFont.glyphLookup = NULL;
+
+    UnloadTextRuns(NULL);       // Text shaped runs released on window close
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -323,6 +582,8 @@ Font LoadFont(const char *fileName)
     if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
     else
 #endif
+    if (IsFileExtension(fileName, ".rfnb")) return LoadFontBinary(fileName);
+    else
     {
         Image image = LoadImage(fileName);
         if (image.data != NULL) font = LoadFontFromImage(image, MAGENTA, FONT_TTF_DEFAULT_FIRST_CHAR);
@@ -343,6 +604,43 @@ Font LoadFont(const char *fileName)
     return font;
 }
 
+// Load font from file asynchronously, returns request id (-1: failed)
+// NOTE: TTF glyphs and font images are decoded on loader thread, atlas is uploaded on BeginDrawing(),
+// BMFont files are loaded on main thread, check IsAsyncLoadReady()
+int LoadFontAsync(const char *fileName)
+{
+    FontAsyncLoad *load = (FontAsyncLoad *)RL_CALLOC(1, sizeof(FontAsyncLoad));
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
+
+    int request = LoadAsync(DecodeFontAsync, FinalizeFontAsync, load);
+
+    if (request < 0)
+    {
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return request;
+}
+
+// Get async loaded font, request is released (empty if not ready)
+Font GetFontAsync(int request)
+{
+    Font font = { 0 };
+    FontAsyncLoad *load = (FontAsyncLoad *)GetAsyncLoadData(request, FinalizeFontAsync);
+
+    if (load != NULL)
+    {
+        font = load->font;
+
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return font;
+}
+
 // Load Font from TTF font file with generation parameters
 // NOTE: You can pass an array with desired characters, those characters should be available in the font
 // if array is NULL, default char set is selected 32..126
@@ -352,14 +650,14 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCou
 
     // Loading file to memory
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
 
     if (fileData != NULL)
     {
         // Loading font from memory data
         font = LoadFontFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, glyphCount);
 
-        UnloadFileData(fileData);
+        UnloadFileDataMapped(fileData);
     }
     else font = GetFontDefault();
 
@@ -487,6 +785,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -524,6 +823,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+            LoadFontKerning(font.glyphLookup, fileData, font.baseSize);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -535,6 +837,207 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font as multi-channel signed distance field (MSDF)
+// NOTE: Only TTF/OTF fonts supported, if codepoints array is NULL, default char set is selected 32..126
+Font LoadFontMsdf(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data
+        font = LoadFontMsdfFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, codepoints, codepointCount);
+
+        UnloadFileDataMapped(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load MSDF font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Glyphs distance fields are generated at fontSize (RGB atlas, bilinear filtered), DrawText*() functions
+// use default MSDF shader (if no custom shader active) rendering sharp glyphs at sizes bigger or smaller than fontSize,
+// glyphs[i].image is RGB distance field data, not valid for ImageDrawText*() functions
+Font LoadFontMsdfFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((fileData == NULL) || (dataSize <= 0) || (fontSize <= 0) || (!TextIsEqual(fileExtLower, ".ttf") && !TextIsEqual(fileExtLower, ".otf")))
+    {
+        TRACELOG(LOG_WARNING, "FONT: MSDF font requires TTF/OTF font data");
+        return GetFontDefault();
+    }
+
+    font.baseSize = fontSize;
+    font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+    font.glyphPadding = 0;
+    font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_MSDF);
+
+    if (font.glyphs != NULL)
+    {
+        font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+        // NOTE: Glyphs include distance field padding, atlas rows fit highest glyph
+        int rowHeight = font.baseSize;
+        for (int i = 0; i < font.glyphCount; i++) if (font.glyphs[i].image.height > rowHeight) rowHeight = font.glyphs[i].image.height;
+
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, rowHeight, font.glyphPadding, 1);
+        font.texture = LoadTextureFromImage(atlas);
+        SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);    // Distance field requires interpolation
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            UnloadImage(font.glyphs[i].image);
+            font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+        }
+
+        UnloadImage(atlas);
+
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+        font.glyphLookup->fontType = FONT_MSDF;
+        LoadFontKerning(font.glyphLookup, fileData, font.baseSize);
+
+        LoadFontMsdfShader();
+
+        TRACELOG(LOG_INFO, "FONT: MSDF font loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+    }
+    else font = GetFontDefault();
+#else
+    TRACELOG(LOG_WARNING, "FONT: MSDF font requires TTF support");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load font with glyphs rasterized on first use
+// NOTE: Only TTF/OTF fonts supported, font file data is kept loaded for glyphs rasterization
+Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data, data is copied
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, atlasSize);
+
+        UnloadFileDataMapped(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Atlas is divided in cells of font bounding box size, glyphs are rasterized on first use (ASCII glyphs on loading),
+// missing glyphs of one text draw are rasterized before drawing and uploaded at once (rlUpdateTexture() rows),
+// when all cells are in use least recently used glyph is evicted (pending batch is drawn first),
+// text layouts reference atlas cells, atlas size should fit glyphs in use to keep layouts valid
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((fileData == NULL) || (dataSize <= 0) || (fontSize <= 0) || (!TextIsEqual(fileExtLower, ".ttf") && !TextIsEqual(fileExtLower, ".otf")))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF font data");
+        return GetFontDefault();
+    }
+
+    FontDynamic *dynamic = (FontDynamic *)RL_CALLOC(1, sizeof(FontDynamic));
+    dynamic->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    memcpy(dynamic->fileData, fileData, dataSize);
+
+    if (!stbtt_InitFont(&dynamic->fontInfo, dynamic->fileData, 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+        RL_FREE(dynamic->fileData);
+        RL_FREE(dynamic);
+        return GetFontDefault();
+    }
+
+    int descent = 0, lineGap = 0;
+    dynamic->fontSize = fontSize;
+    dynamic->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+    dynamic->scaleFactor = stbtt_ScaleForPixelHeight(&dynamic->fontInfo, (float)fontSize);
+    stbtt_GetFontVMetrics(&dynamic->fontInfo, &dynamic->ascent, &descent, &lineGap);
+
+    // Atlas cell size from font bounding box, limited to twice the font size (glyphs clipped)
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetFontBoundingBox(&dynamic->fontInfo, &x0, &y0, &x1, &y1);
+
+    int glyphWidth = (int)((float)(x1 - x0)*dynamic->scaleFactor) + 1;
+    int glyphHeight = (int)((float)(y1 - y0)*dynamic->scaleFactor) + 1;
+    if (glyphWidth > 2*fontSize) glyphWidth = 2*fontSize;
+    if (glyphHeight > 2*fontSize) glyphHeight = 2*fontSize;
+    if (glyphHeight < fontSize) glyphHeight = fontSize;     // Space glyph height is font size
+
+    dynamic->cellWidth = glyphWidth + 2*dynamic->padding;
+    dynamic->cellHeight = glyphHeight + 2*dynamic->padding;
+
+    if (atlasSize <= 0) atlasSize = FONT_DYNAMIC_ATLAS_SIZE;
+    while (((atlasSize/dynamic->cellWidth)*(atlasSize/dynamic->cellHeight)) < FONT_DYNAMIC_MIN_GLYPHS) atlasSize *= 2;
+
+    dynamic->columns = atlasSize/dynamic->cellWidth;
+    dynamic->glyphCount = dynamic->columns*(atlasSize/dynamic->cellHeight);
+
+    // Atlas image, transparent white (same as GenImageFontAtlas())
+    dynamic->atlas.data = RL_CALLOC(atlasSize*atlasSize, 2);
+    dynamic->atlas.width = atlasSize;
+    dynamic->atlas.height = atlasSize;
+    dynamic->atlas.mipmaps = 1;
+    dynamic->atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    for (int i = 0; i < atlasSize*atlasSize; i++) ((unsigned char *)dynamic->atlas.data)[2*i] = 255;
+
+    dynamic->dirtyMinY = atlasSize;
+    dynamic->dirtyMaxY = -1;
+
+    font.baseSize = fontSize;
+    font.glyphCount = dynamic->glyphCount;
+    font.glyphPadding = dynamic->padding;
+    font.texture = LoadTextureFromImage(dynamic->atlas);
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
+
+    for (int i = 0; i < font.glyphCount; i++) font.glyphs[i].value = -1;     // Glyph slot not in use
+
+    dynamic->glyphs = font.glyphs;
+    dynamic->recs = font.recs;
+    dynamic->lastUse = (unsigned int *)RL_CALLOC(font.glyphCount, sizeof(unsigned int));
+    dynamic->textureId = font.texture.id;
+
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+    font.glyphLookup->dynamic = dynamic;
+
+    // Rasterize ASCII glyphs on loading
+    for (int i = 32; i < 127; i++) LoadFontDynamicGlyph(font.glyphLookup, i);
+    UpdateFontDynamicAtlas(dynamic);
+
+    TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %ix%i atlas | %i glyphs slots)", fontSize, atlasSize, atlasSize, font.glyphCount);
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF support");
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -602,67 +1105,10 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
 
+            // Glyphs rasterization, processed in parallel by jobs system (if initialized)
             // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < glyphCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .mipmaps = 1,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            FontGlyphsJob job = { &fontInfo, chars, fontChars, fontSize, type, scaleFactor, ascent };
+            JobParallelFor(glyphCount, LoadFontGlyphs, &job);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -714,10 +1160,13 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
         rowCount = imageSize/(fontSize + 2*padding);    // Calculate new row count for the new image size
     }
 
+    // NOTE: MSDF glyphs (FONT_MSDF) are RGB, atlas keeps RGB channels
+    int bytesPerPixel = (chars[0].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 1;
+
     atlas.width = imageSize;   // Atlas bitmap width
     atlas.height = imageSize;  // Atlas bitmap height
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height*bytesPerPixel);   // Create a bitmap to store characters (8 bpp or 24 bpp)
+    atlas.format = (bytesPerPixel == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
     // DEBUG: We can see padding in the generated image setting a gray background...
@@ -759,9 +1208,9 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
             // Copy pixel data from fc.data to atlas
             for (int y = 0; y < chars[i].image.height; y++)
             {
-                for (int x = 0; x < chars[i].image.width; x++)
+                for (int x = 0; x < chars[i].image.width*bytesPerPixel; x++)
                 {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
+                    ((unsigned char *)atlas.data)[((offsetY + y)*atlas.width + offsetX)*bytesPerPixel + x] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width*bytesPerPixel + x];
                 }
             }
 
@@ -807,9 +1256,9 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
                 // Copy pixel data from fc.data to atlas
                 for (int y = 0; y < chars[i].image.height; y++)
                 {
-                    for (int x = 0; x < chars[i].image.width; x++)
+                    for (int x = 0; x < chars[i].image.width*bytesPerPixel; x++)
                     {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
+                        ((unsigned char *)atlas.data)[((rects[i].y + padding + y)*atlas.width + (rects[i].x + padding))*bytesPerPixel + x] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width*bytesPerPixel + x];
                     }
                 }
             }
@@ -822,17 +1271,20 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
     }
 
     // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    if (bytesPerPixel == 1)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
+
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *charRecs = recs;
 
@@ -860,6 +1312,11 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((font.glyphLookup != NULL) && (font.glyphLookup->fontType == FONT_MSDF)) UnloadFontMsdfShader();
+#endif
+        UnloadTextRuns(font.glyphLookup);
+        UnloadGlyphLookup(font.glyphLookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1019,112 +1476,374 @@ bool ExportFontAsCode(Font font, const char *fileName)
     return success;
 }
 
-
-// Draw current FPS
-// NOTE: Uses default font
-void DrawFPS(int posX, int posY)
+// Export font as binary file (.rfnb): atlas, glyphs rectangles and metrics, kerning pairs, returns true on success
+// NOTE: Dynamic fonts are exported with their current atlas glyphs (loaded back as static font),
+// compressed atlas requires SUPPORT_COMPRESSION_API
+bool ExportFontBinary(Font font, const char *fileName, bool compressAtlas)
 {
-    Color color = LIME;                         // Good FPS
-    int fps = GetFPS();
+    bool success = false;
 
-    if ((fps < 30) && (fps >= 15)) color = ORANGE;  // Warning FPS
-    else if (fps < 15) color = RED;             // Low FPS
+    if ((font.texture.id == 0) || (font.glyphs == NULL) || (font.recs == NULL) || (font.glyphCount <= 0)) return false;
 
-    DrawText(TextFormat("%2i FPS", GetFPS()), posX, posY, 20, color);
-}
+    const rGlyphLookup *lookup = font.glyphLookup;
+    bool lookupValid = ((lookup != NULL) && (lookup->glyphs == font.glyphs) && (lookup->glyphCount == font.glyphCount));
 
-// Draw text (using default font)
-// NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
-// NOTE: chars spacing is proportional to fontSize
-void DrawText(const char *text, int posX, int posY, int fontSize, Color color)
-{
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
+    // Atlas from dynamic font RAM copy if available, otherwise read back from GPU texture
+    Image atlas = { 0 };
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (lookupValid && (lookup->dynamic != NULL)) atlas = ImageCopy(lookup->dynamic->atlas);
+    else
+#endif
+    atlas = LoadImageFromTexture(font.texture);
+
+    if (atlas.data == NULL) return false;
+
+    FontBinaryHeader header = { 0 };
+    memcpy(header.id, "rFNB", 4);
+    header.version = FONT_BINARY_VERSION;
+    header.baseSize = font.baseSize;
+    header.glyphCount = font.glyphCount;
+    header.glyphPadding = font.glyphPadding;
+    header.fontType = lookupValid? lookup->fontType : FONT_DEFAULT;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.kerningCapacity = (lookupValid && (lookup->kerningKeys != NULL))? lookup->kerningCapacity : 0;
+
+    unsigned char *atlasData = (unsigned char *)atlas.data;
+    int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (compressAtlas)
     {
-        Vector2 position = { (float)posX, (float)posY };
-
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
+        int compDataSize = 0;
+        unsigned char *compData = CompressData(atlasData, atlasDataSize, &compDataSize);
 
-        DrawTextEx(GetFontDefault(), text, position, (float)fontSize, (float)spacing, color);
+        if (compData != NULL)
+        {
+            atlasData = compData;
+            atlasDataSize = compDataSize;
+            header.atlasCompressed = 1;
+        }
     }
-}
-
-// Draw text using Font
-// NOTE: chars spacing is NOT proportional to fontSize
-void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
-{
-    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+#else
+    if (compressAtlas) TRACELOG(LOG_WARNING, "FONT: Font binary atlas compression requires SUPPORT_COMPRESSION_API, atlas exported uncompressed");
+#endif
 
-    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+    header.atlasDataSize = atlasDataSize;
 
-    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
-    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int glyphsSize = font.glyphCount*4*sizeof(int);
+    int recsSize = font.glyphCount*sizeof(Rectangle);
+    int kerningSize = header.kerningCapacity*(sizeof(unsigned int) + sizeof(float));
+    int dataSize = sizeof(FontBinaryHeader) + glyphsSize + recsSize + kerningSize + ((atlasDataSize + 3) & ~3);
 
-    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
 
-    for (int i = 0; i < size;)
+    if (fileData != NULL)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
+        unsigned char *ptr = fileData;
 
-        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all the bad bytes using the '?' symbol moving one byte
-        if (codepoint == 0x3f) codepointByteCount = 1;
+        memcpy(ptr, &header, sizeof(FontBinaryHeader));
+        ptr += sizeof(FontBinaryHeader);
 
-        if (codepoint == '\n')
+        int *glyphsData = (int *)ptr;
+        for (int i = 0; i < font.glyphCount; i++)
         {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
-            textOffsetX = 0.0f;
+            glyphsData[i*4] = font.glyphs[i].value;
+            glyphsData[i*4 + 1] = font.glyphs[i].offsetX;
+            glyphsData[i*4 + 2] = font.glyphs[i].offsetY;
+            glyphsData[i*4 + 3] = font.glyphs[i].advanceX;
         }
-        else
-        {
-            if ((codepoint != ' ') && (codepoint != '\t'))
-            {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
-            }
+        ptr += glyphsSize;
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
-            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        memcpy(ptr, font.recs, recsSize);
+        ptr += recsSize;
+
+        if (header.kerningCapacity > 0)
+        {
+            memcpy(ptr, lookup->kerningKeys, header.kerningCapacity*sizeof(unsigned int));
+            memcpy(ptr + header.kerningCapacity*sizeof(unsigned int), lookup->kerningValues, header.kerningCapacity*sizeof(float));
+            ptr += kerningSize;
         }
 
-        i += codepointByteCount;   // Move text bytes counter to next codepoint
+        memcpy(ptr, atlasData, atlasDataSize);
+
+        success = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
     }
+
+    if (header.atlasCompressed) MemFree(atlasData);
+    UnloadImage(atlas);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font binary exported successfully (%i glyphs)", fileName, font.glyphCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font binary", fileName);
+
+    return success;
+}
+
+// Load font from binary file (.rfnb), no font rasterization or atlas packing
+// NOTE: File is memory mapped, uncompressed atlas is uploaded directly from file data
+Font LoadFontBinary(const char *fileName)
+{
+    Font font = { 0 };
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+    if (fileData == NULL) return GetFontDefault();
+
+    FontBinaryHeader header = { 0 };
+    if (fileSize >= sizeof(FontBinaryHeader)) memcpy(&header, fileData, sizeof(FontBinaryHeader));
+
+    int glyphsSize = header.glyphCount*4*sizeof(int);
+    int recsSize = header.glyphCount*sizeof(Rectangle);
+    int kerningSize = header.kerningCapacity*(sizeof(unsigned int) + sizeof(float));
+
+    if ((memcmp(header.id, "rFNB", 4) != 0) || (header.version != FONT_BINARY_VERSION) || (header.glyphCount <= 0) ||
+        (header.glyphCount > 0xffff) || (header.kerningCapacity < 0) || (header.kerningCapacity > 0x1000000) || (header.atlasDataSize <= 0) ||
+        ((sizeof(FontBinaryHeader) + (size_t)glyphsSize + (size_t)recsSize + (size_t)kerningSize + (size_t)header.atlasDataSize) > fileSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font binary file not valid", fileName);
+        UnloadFileDataMapped(fileData);
+        return GetFontDefault();
+    }
+
+    const unsigned char *ptr = fileData + sizeof(FontBinaryHeader);
+    const int *glyphsData = (const int *)ptr;
+    const Rectangle *recsData = (const Rectangle *)(ptr + glyphsSize);
+    const unsigned char *kerningData = ptr + glyphsSize + recsSize;
+    unsigned char *atlasData = (unsigned char *)(kerningData + kerningSize);
+
+    Image atlas = { 0 };
+    atlas.width = header.atlasWidth;
+    atlas.height = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = header.atlasFormat;
+
+    int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    if (header.atlasCompressed)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        int decompDataSize = 0;
+        atlas.data = DecompressData(atlasData, header.atlasDataSize, &decompDataSize);
+        if (decompDataSize != atlasDataSize) { MemFree(atlas.data); atlas.data = NULL; }
+#else
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font binary atlas decompression requires SUPPORT_COMPRESSION_API", fileName);
+#endif
+    }
+    else if (header.atlasDataSize >= atlasDataSize) atlas.data = atlasData;     // NOTE: Mapped file data, not owned
+
+    if ((atlas.data != NULL) && (atlasDataSize > 0)) font.texture = LoadTextureFromImage(atlas);
+
+    if (font.texture.id > 0)
+    {
+        font.baseSize = header.baseSize;
+        font.glyphCount = header.glyphCount;
+        font.glyphPadding = header.glyphPadding;
+        font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+        font.recs = (Rectangle *)RL_MALLOC(recsSize);
+        memcpy(font.recs, recsData, recsSize);
+
+        // Glyphs images from atlas, same as LoadFontFromMemory(), required to be used on ImageDrawText()
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            font.glyphs[i].value = glyphsData[i*4];
+            font.glyphs[i].offsetX = glyphsData[i*4 + 1];
+            font.glyphs[i].offsetY = glyphsData[i*4 + 2];
+            font.glyphs[i].advanceX = glyphsData[i*4 + 3];
+            font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+        }
+
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+        // Kerning hash table is loaded as exported (same glyphs indices)
+        if ((font.glyphLookup != NULL) && (header.kerningCapacity > 0) && ((header.kerningCapacity & (header.kerningCapacity - 1)) == 0))
+        {
+            font.glyphLookup->kerningKeys = (unsigned int *)RL_MALLOC(kerningSize);
+            font.glyphLookup->kerningValues = (float *)(font.glyphLookup->kerningKeys + header.kerningCapacity);
+            font.glyphLookup->kerningCapacity = header.kerningCapacity;
+            memcpy(font.glyphLookup->kerningKeys, kerningData, kerningSize);
+        }
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((font.glyphLookup != NULL) && (header.fontType == FONT_MSDF))
+        {
+            font.glyphLookup->fontType = FONT_MSDF;
+            SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+            LoadFontMsdfShader();
+        }
+#endif
+
+        TRACELOG(LOG_INFO, "FONT: [%s] Font binary loaded successfully (%i pixel size | %i glyphs)", fileName, font.baseSize, font.glyphCount);
+    }
+
+    if (atlas.data != atlasData) MemFree(atlas.data);
+    UnloadFileDataMapped(fileData);
+
+    if (font.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font binary atlas -> Using default font", fileName);
+        font = GetFontDefault();
+    }
+
+    return font;
+}
+
+// Draw current FPS
+// NOTE: Uses default font
+void DrawFPS(int posX, int posY)
+{
+    Color color = LIME;                         // Good FPS
+    int fps = GetFPS();
+
+    if ((fps < 30) && (fps >= 15)) color = ORANGE;  // Warning FPS
+    else if (fps < 15) color = RED;             // Low FPS
+
+    DrawText(TextFormat("%2i FPS", GetFPS()), posX, posY, 20, color);
+}
+
+// Draw text (using default font)
+// NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
+// NOTE: chars spacing is proportional to fontSize
+void DrawText(const char *text, int posX, int posY, int fontSize, Color color)
+{
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        Vector2 position = { (float)posX, (float)posY };
+
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        DrawTextEx(GetFontDefault(), text, position, (float)fontSize, (float)spacing, color);
+    }
+}
+
+// Draw text using Font
+// NOTE: chars spacing is NOT proportional to fontSize
+void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    DrawTextPro(font, text, position, (Vector2){ 0.0f, 0.0f }, 0.0f, fontSize, spacing, tint);
 }
 
 // Draw text using Font and pro parameters (rotation)
+// NOTE: Glyph quads are rotated on CPU around position, no matrix push/pop required
 void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint)
 {
-    rlPushMatrix();
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-        rlTranslatef(position.x, position.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-        rlTranslatef(-origin.x, -origin.y, 0.0f);
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
 
-        DrawTextEx(font, text, (Vector2){ 0.0f, 0.0f }, fontSize, spacing, tint);
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
-    rlPopMatrix();
+    bool fontShader = BeginFontShaderMode(GetFontPixelRange(font, fontSize));
+
+    // Text shaped run reused if cached (fonts with kerning), no text decoding or glyphs lookup
+    const TextRun *run = GetTextRun(font, text, size, fontSize, spacing);
+
+    if (run != NULL)
+    {
+        for (int i = 0; i < run->glyphCount; i++) DrawTextGlyphPro(font, run->indices[i], position, (Vector2){ origin.x - run->positions[i].x, origin.y - run->positions[i].y }, rotation, fontSize, tint);
+
+        size = 0;
+    }
+
+    // NOTE: Text is decoded by chunks into a stack buffer, invalid bytes are decoded as '?' one by one
+    int codepoints[TEXT_DECODE_CHUNK_SIZE] = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font missing glyphs are rasterized before drawing, atlas is uploaded once
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->dynamic != NULL))
+    {
+        for (int i = 0, bytesRead = 0; i < size; i += bytesRead)
+        {
+            int count = DecodeUTF8(text + i, size - i, codepoints, TEXT_DECODE_CHUNK_SIZE, &bytesRead);
+            for (int k = 0; k < count; k++) GetGlyphIndex(font, codepoints[k]);
+        }
+    }
+#endif
+
+    int prevIndex = -1;             // Previous glyph index on line (kerning)
+
+    for (int i = 0, bytesRead = 0; i < size; i += bytesRead)
+    {
+        int count = DecodeUTF8(text + i, size - i, codepoints, TEXT_DECODE_CHUNK_SIZE, &bytesRead);
+
+        for (int k = 0; k < count; k++)
+        {
+            int codepoint = codepoints[k];
+
+            if (codepoint == '\n')
+            {
+                // NOTE: Fixed line spacing of 1.5 line-height
+                // TODO: Support custom line spacing defined by user
+                textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
+                textOffsetX = 0.0f;
+                prevIndex = -1;
+            }
+            else
+            {
+                int index = GetGlyphIndex(font, codepoint);
+
+                if (prevIndex >= 0) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+                prevIndex = index;
+
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    DrawTextGlyphPro(font, index, position, (Vector2){ origin.x - textOffsetX, origin.y - textOffsetY }, rotation, fontSize, tint);
+                }
+
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+            }
+        }
+    }
+
+    if (fontShader) EndShaderMode();
 }
 
 // Draw one character (codepoint)
 void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
 {
+    bool fontShader = BeginFontShaderMode(GetFontPixelRange(font, fontSize));
+
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
-    int index = GetGlyphIndex(font, codepoint);
+    DrawTextGlyph(font, GetGlyphIndex(font, codepoint), position, fontSize, tint);
+
+    if (fontShader) EndShaderMode();
+}
+
+// Draw one glyph by index
+// NOTE: Glyph index already solved by caller, avoids a second codepoint lookup per character
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    DrawTextGlyphPro(font, index, position, (Vector2){ 0.0f, 0.0f }, 0.0f, fontSize, tint);
+}
+
+// Draw one glyph by index, rotated around position
+// NOTE: origin is the pivot relative to the glyph pen position, DrawTexturePro() rotates the quad vertices
+static void DrawTextGlyphPro(Font font, int index, Vector2 position, Vector2 origin, float rotation, float fontSize, Color tint)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font glyphs rasterized since last upload are uploaded before drawing
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->dynamic != NULL)) UpdateFontDynamicAtlas(font.glyphLookup->dynamic);
+#endif
+
     float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
 
     // Character destination rectangle on screen
     // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+    Rectangle dstRec = { position.x, position.y,
                       (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
                       (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+    Vector2 dstOrigin = { origin.x - font.glyphs[index].offsetX*scaleFactor + (float)font.glyphPadding*scaleFactor,
+                          origin.y - font.glyphs[index].offsetY*scaleFactor + (float)font.glyphPadding*scaleFactor };
 
     // Character source rectangle from font texture atlas
     // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
@@ -1132,7 +1851,37 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTexturePro(font.texture, srcRec, dstRec, dstOrigin, rotation, tint);
+}
+
+// Get font distance field screen pixels range (0: not MSDF font)
+static float GetFontPixelRange(Font font, float fontSize)
+{
+    float pixelRange = 0.0f;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->fontType == FONT_MSDF)) pixelRange = FONT_MSDF_PIXEL_RANGE*fontSize/font.baseSize;
+#endif
+
+    return pixelRange;
+}
+
+// Begin MSDF shader mode for distance field glyphs drawing, returns true if shader is set
+// NOTE: Only set if default shader is active, custom shaders set by user are kept
+static bool BeginFontShaderMode(float pixelRange)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((pixelRange > 0.0f) && (fontMsdfShaderUsers > 0) && (fontMsdfShader.id != rlGetShaderIdDefault()) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault()))
+    {
+        BeginShaderMode(fontMsdfShader);
+        SetShaderValue(fontMsdfShader, fontMsdfShaderRangeLoc, &pixelRange, SHADER_UNIFORM_FLOAT);
+        result = true;
+    }
+#endif
+
+    return result;
 }
 
 // Draw multiple character (codepoints)
@@ -1143,6 +1892,18 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool fontShader = BeginFontShaderMode(GetFontPixelRange(font, fontSize));
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font missing glyphs are rasterized before drawing, atlas is uploaded once
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->dynamic != NULL))
+    {
+        for (int i = 0; i < count; i++) GetGlyphIndex(font, codepoints[i]);
+    }
+#endif
+
+    int prevIndex = -1;             // Previous glyph index on line (kerning)
+
     for (int i = 0; i < count; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1153,955 +1914,3281 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
             // TODO: Support custom line spacing defined by user
             textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
             textOffsetX = 0.0f;
+            prevIndex = -1;
         }
         else
         {
+            if (prevIndex >= 0) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+            prevIndex = index;
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
-}
-
-// Measure string width for default font
-int MeasureText(const char *text, int fontSize)
-{
-    Vector2 textSize = { 0.0f, 0.0f };
-
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
-    {
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
-
-        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
-    }
 
-    return (int)textSize.x;
+    if (fontShader) EndShaderMode();
 }
 
-// Measure string size for Font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+// Draw text inside rectangle, lines broken by wrap mode (TextWrapMode)
+// NOTE: Lines are broken in one pass, lines not fitting rectangle height are not drawn,
+// lines out of rectangle or scissor mode area are only advanced (no glyphs decoding on TEXT_WRAP_NONE)
+void DrawTextBoxed(Font font, const char *text, Rectangle rec, float fontSize, float spacing, int wrapMode, Color tint)
 {
-    Vector2 textSize = { 0 };
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    if ((font.texture.id == 0) || (text == NULL)) return textSize;
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by lines
 
-    int size = TextLength(text);    // Get size in bytes of text
-    int tempByteCounter = 0;        // Used to count longer text line num chars
-    int byteCounter = 0;
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int lineOffset = (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);   // Same line spacing than DrawTextEx()
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    // Vertical range with glyphs drawn, rectangle clipped to scissor mode area
+    float visibleTop = rec.y;
+    float visibleBottom = rec.y + rec.height;
+    ClipTextScissorArea(&visibleTop, &visibleBottom);
 
-    float textHeight = (float)font.baseSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+    bool fontShader = BeginFontShaderMode(GetFontPixelRange(font, fontSize));
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n' or wrap)
 
-    for (int i = 0; i < size; i++)
+    for (int i = 0; i < size;)
     {
-        byteCounter++;
+        float lineTop = rec.y + textOffsetY;
 
-        int next = 0;
-        letter = GetCodepointNext(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
+        // Lines not fitting rectangle or below visible range end drawing
+        if (((textOffsetY + fontSize) > rec.height) || (lineTop >= visibleBottom)) break;
 
-        // NOTE: normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all the bad bytes using the '?' symbol so to not skip any we set next = 1
-        if (letter == 0x3f) next = 1;
-        i += next - 1;
+        int next = size;
+        int end = GetTextLineEnd(font, text, i, size, rec.width, fontSize, spacing, wrapMode, &next);
 
-        if (letter != '\n')
+        // Lines above visible range are only advanced
+        if ((lineTop + fontSize) > visibleTop)
         {
-            if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
-        }
-        else
-        {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
-            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
-        }
+            float textOffsetX = 0.0f;
+            int prevIndex = -1;         // Previous glyph index on line (kerning)
 
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
-    }
+            for (int j = i; j < end;)
+            {
+                int codepointByteCount = 0;
+                int codepoint = GetCodepointNext(&text[j], &codepointByteCount);
+                int index = GetGlyphIndex(font, codepoint);
 
-    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                // NOTE: Bad bytes are drawn using the '?' symbol moving one byte (same as DrawTextEx())
+                if (codepoint == 0x3f) codepointByteCount = 1;
 
-    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing); // Adds chars spacing to measure
-    textSize.y = textHeight*scaleFactor;
+                if (prevIndex >= 0) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+                prevIndex = index;
 
-    return textSize;
-}
+                float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-// Get index position for a unicode character on font
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-int GetGlyphIndex(Font font, int codepoint)
-{
-#ifndef GLYPH_NOTFOUND_CHAR_FALLBACK
-    #define GLYPH_NOTFOUND_CHAR_FALLBACK     63      // Character used if requested codepoint is not found: '?'
-#endif
+                // Not wrapped lines are clipped, glyphs out of rectangle are not drawn
+                if ((textOffsetX + advance) > rec.width) break;
 
-// Support charsets with any characters order
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
-    int index = GLYPH_NOTFOUND_CHAR_FALLBACK;
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    DrawTextGlyph(font, index, (Vector2){ rec.x + textOffsetX, lineTop }, fontSize, tint);
+                }
 
-    for (int i = 0; i < font.glyphCount; i++)
-    {
-        if (font.glyphs[i].value == codepoint)
-        {
-            index = i;
-            break;
+                textOffsetX += (advance + spacing);
+                j += codepointByteCount;
+            }
         }
+
+        textOffsetY += lineOffset;
+        i = next;
     }
 
-    return index;
-#else
-    return (codepoint - 32);
-#endif
+    if (fontShader) EndShaderMode();
 }
 
-// Get glyph font info data for a codepoint (unicode character)
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-GlyphInfo GetGlyphInfo(Font font, int codepoint)
+// Load text layout, glyphs quads positioned once to be drawn multiple times
+// NOTE: Same glyphs placement than DrawTextEx(), if wrapWidth > 0 words are moved to next line when exceeding it
+// (words longer than wrapWidth are split), font texture is referenced by layout, font must be kept loaded
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
 {
-    GlyphInfo info = { 0 };
+    TextLayout layout = { 0 };
 
-    info = font.glyphs[GetGlyphIndex(font, codepoint)];
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((text == NULL) || (font.texture.id == 0)) return layout;
 
-    return info;
-}
+    int size = TextLength(text);    // Total size in bytes of the text, maximum number of glyphs
 
-// Get glyph rectangle in font atlas for a codepoint (unicode character)
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
-Rectangle GetGlyphAtlasRec(Font font, int codepoint)
-{
-    Rectangle rec = { 0 };
+    if (size == 0) return layout;
 
-    rec = font.recs[GetGlyphIndex(font, codepoint)];
+    layout.texture = font.texture;
+    layout.vertices = (float *)RL_MALLOC(size*8*sizeof(float));
+    layout.texcoords = (float *)RL_MALLOC(size*8*sizeof(float));
 
-    return rec;
-}
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float lineOffset = (float)((int)((font.baseSize + font.baseSize/2.0f)*scaleFactor));  // Same line spacing than DrawTextEx()
+    float padding = (float)font.glyphPadding;
+    float invWidth = 1.0f/(float)font.texture.width;
+    float invHeight = 1.0f/(float)font.texture.height;
 
-//----------------------------------------------------------------------------------
-// Text strings management functions
-//----------------------------------------------------------------------------------
-// Get text length in bytes, check for \0 character
-unsigned int TextLength(const char *text)
-{
-    unsigned int length = 0; //strlen(text)
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    float textOffsetY = 0.0f;       // Offset between lines (on linebreak '\n' or words wrap)
+    float textWidth = 0.0f;         // Longest line width
+    int lineCount = 1;
+    bool wrapped = false;           // Line started by words wrap, leading spaces are skipped
+    bool wordStart = true;          // Next character starts a word
+    int prevIndex = -1;             // Previous glyph index on line (kerning)
 
-    if (text != NULL)
+    for (int i = 0; i < size;)
     {
-        while (*text++) length++;
-    }
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
 
-    return length;
-}
+        // NOTE: Bad bytes are drawn using the '?' symbol moving one byte (same as DrawTextEx())
+        if (codepoint == 0x3f) codepointByteCount = 1;
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
-{
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
-#endif
+        if (codepoint == '\n')
+        {
+            textOffsetY += lineOffset;
+            textOffsetX = 0.0f;
+            lineCount++;
+            wrapped = false;
+            wordStart = true;
+            prevIndex = -1;
+        }
+        else
+        {
+            bool space = ((codepoint == ' ') || (codepoint == '\t'));
+            float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+            if (space && wrapped)
+            {
+                i += codepointByteCount;    // Skip leading spaces on wrapped line
+                continue;
+            }
 
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
+            if ((wrapWidth > 0.0f) && !space)
+            {
+                float wordWidth = advance;
 
-    va_list args;
-    va_start(args, text);
-    vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-    va_end(args);
+                // Measure word width on its first character
+                if (wordStart)
+                {
+                    for (int j = i + codepointByteCount, wordIndex = index; j < size;)
+                    {
+                        int nextByteCount = 0;
+                        int next = GetCodepointNext(&text[j], &nextByteCount);
+                        if ((next == ' ') || (next == '\t') || (next == '\n')) break;
+                        if (next == 0x3f) nextByteCount = 1;
+
+                        int nextIndex = GetGlyphIndex(font, next);
+                        wordWidth += (spacing + GetGlyphKerningIndex(font, wordIndex, nextIndex)*scaleFactor + ((font.glyphs[nextIndex].advanceX == 0)? (float)font.recs[nextIndex].width : (float)font.glyphs[nextIndex].advanceX)*scaleFactor);
+                        wordIndex = nextIndex;
+                        j += nextByteCount;
+                    }
+                }
+
+                if ((textOffsetX > 0.0f) && ((textOffsetX + wordWidth) > wrapWidth))
+                {
+                    textOffsetY += lineOffset;
+                    textOffsetX = 0.0f;
+                    lineCount++;
+                    prevIndex = -1;
+                }
+            }
 
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+            // NOTE: Kerning not applied on line start (wrapped line)
+            if ((prevIndex >= 0) && (textOffsetX > 0.0f)) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+            prevIndex = index;
 
-    return currentBuffer;
-}
+            wrapped = false;
+            wordStart = space;
 
-// Get integer value from text
-// NOTE: This function replaces atoi() [stdlib.h]
-int TextToInteger(const char *text)
-{
-    int value = 0;
-    int sign = 1;
+            if (!space)
+            {
+                float *v = layout.vertices + 8*layout.glyphCount;
+                float *t = layout.texcoords + 8*layout.glyphCount;
+
+                // Glyph quad, same as DrawTextCodepoint(), padding considered for outline/glow shader effects
+                float x = textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+                float y = textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+                float width = (font.recs[index].width + 2.0f*padding)*scaleFactor;
+                float height = (font.recs[index].height + 2.0f*padding)*scaleFactor;
+
+                float left = (font.recs[index].x - padding)*invWidth;
+                float top = (font.recs[index].y - padding)*invHeight;
+                float right = (font.recs[index].x + font.recs[index].width + padding)*invWidth;
+                float bottom = (font.recs[index].y + font.recs[index].height + padding)*invHeight;
+
+                // Corners order: top-left, bottom-left, bottom-right, top-right
+                v[0] = x; v[1] = y;
+                v[2] = x; v[3] = y + height;
+                v[4] = x + width; v[5] = y + height;
+                v[6] = x + width; v[7] = y;
+
+                t[0] = left; t[1] = top;
+                t[2] = left; t[3] = bottom;
+                t[4] = right; t[5] = bottom;
+                t[6] = right; t[7] = top;
+
+                layout.glyphCount++;
+            }
 
-    if ((text[0] == '+') || (text[0] == '-'))
-    {
-        if (text[0] == '-') sign = -1;
-        text++;
-    }
+            textOffsetX += (advance + spacing);
 
-    for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); ++i) value = value*10 + (int)(text[i] - '0');
+            if ((wrapWidth > 0.0f) && space && ((textOffsetX - spacing) > wrapWidth))
+            {
+                // Spaces exceeding wrap width start a new line (not considered on text width)
+                textOffsetY += lineOffset;
+                textOffsetX = 0.0f;
+                lineCount++;
+                wrapped = true;
+                prevIndex = -1;
+            }
+            else if ((textOffsetX - spacing) > textWidth) textWidth = textOffsetX - spacing;
+        }
 
-    return value*sign;
-}
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
 
-#if defined(SUPPORT_TEXT_MANIPULATION)
-// Copy one string to another, returns bytes copied
-int TextCopy(char *dst, const char *src)
-{
-    int bytes = 0;
+    layout.bounds = (Rectangle){ 0.0f, 0.0f, textWidth, (font.baseSize + 1.5f*font.baseSize*(lineCount - 1))*scaleFactor };
+    layout.pixelRange = GetFontPixelRange(font, fontSize);
 
-    if ((src != NULL) && (dst != NULL))
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font glyphs rasterized for layout are uploaded
+    if ((font.glyphLookup != NULL) && (font.glyphLookup->dynamic != NULL)) UpdateFontDynamicAtlas(font.glyphLookup->dynamic);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Large layouts glyphs instances are uploaded once to GPU, quads expanded by vertex shader
+    // NOTE: MSDF layouts are drawn on render batch with MSDF shader
+    if ((layout.glyphCount >= TEXT_LAYOUT_INSTANCED_MIN_GLYPHS) && (layout.pixelRange == 0.0f) && LoadTextLayoutShader())
     {
-        while (*src != '\0')
-        {
-            *dst = *src;
-            dst++;
-            src++;
+        float *instances = (float *)RL_MALLOC(layout.glyphCount*TEXT_LAYOUT_INSTANCE_FLOATS*sizeof(float));
 
-            bytes++;
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            const float *v = layout.vertices + 8*i;
+            const float *t = layout.texcoords + 8*i;
+            float *instance = instances + i*TEXT_LAYOUT_INSTANCE_FLOATS;
+
+            // Quad top-left corner and size, source top-left and bottom-right texcoords
+            instance[0] = v[0]; instance[1] = v[1];
+            instance[2] = v[4] - v[0]; instance[3] = v[5] - v[1];
+            instance[4] = t[0]; instance[5] = t[1];
+            instance[6] = t[4]; instance[7] = t[5];
         }
 
-        *dst = '\0';
+        layout.instancesId = rlLoadVertexBuffer(instances, layout.glyphCount*TEXT_LAYOUT_INSTANCE_FLOATS*sizeof(float), false);
+        RL_FREE(instances);
+
+        if (layout.instancesId == 0) UnloadTextLayoutShader();
     }
+#endif
 
-    return bytes;
+    return layout;
 }
 
-// Check if two text string are equal
-// REQUIRES: strcmp()
-bool TextIsEqual(const char *text1, const char *text2)
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
 {
-    bool result = false;
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
 
-    if ((text1 != NULL) && (text2 != NULL))
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (layout.instancesId > 0)
     {
-        if (strcmp(text1, text2) == 0) result = true;
+        rlUnloadVertexBuffer(layout.instancesId);
+        UnloadTextLayoutShader();
     }
-
-    return result;
+#endif
 }
 
-// Get a piece of a text string
-const char *TextSubtext(const char *text, int position, int length)
+// Draw text layout
+// NOTE: Glyphs quads are translated to position on batch vertex transform, no text decoding or glyphs lookup,
+// layouts with glyphs instances on GPU are drawn in one instanced draw call (if default shader is active)
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-
-    int textLength = TextLength(text);
+    if ((layout.texture.id == 0) || (layout.glyphCount == 0)) return;
 
-    if (position >= textLength)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((layout.instancesId > 0) && (textLayoutShader.id > 0) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault()))
     {
-        position = textLength - 1;
-        length = 0;
-    }
-
-    if (length >= textLength) length = textLength;
+        rlDrawRenderBatchActive();      // Update and draw internal render batch, drawing order kept
 
-    for (int c = 0 ; c < length ; c++)
-    {
-        *(buffer + c) = *(text + position);
-        text++;
-    }
+        Matrix matModelView = MatrixMultiply(MatrixTranslate(position.x, position.y, 0.0f), MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()));
+        Matrix matProjection = rlGetMatrixProjection();
+        int positionLoc = textLayoutShader.locs[SHADER_LOC_VERTEX_POSITION];
+        int stride = TEXT_LAYOUT_INSTANCE_FLOATS*sizeof(float);
+        float color[4] = { (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f };
 
-    *(buffer + length) = '\0';
+        rlEnableShader(textLayoutShader.id);
+        rlSetUniform(textLayoutShader.locs[SHADER_LOC_COLOR_DIFFUSE], color, SHADER_UNIFORM_VEC4, 1);
 
-    return buffer;
-}
+        rlActiveTextureSlot(0);
+        rlEnableTexture(layout.texture.id);
 
-// Replace text string
-// REQUIRES: strlen(), strstr(), strncpy(), strcpy()
-// WARNING: Allocated memory must be manually freed
-char *TextReplace(char *text, const char *replace, const char *by)
-{
-    // Sanity checks and initialization
-    if (!text || !replace || !by) return NULL;
+        // Quad corners attached again if VAO not supported
+        if (!rlEnableVertexArray(textLayoutVaoId))
+        {
+            rlEnableVertexBuffer(textLayoutVboId);
+            rlSetVertexAttribute(positionLoc, 2, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(positionLoc);
+        }
 
-    char *result = NULL;
+        // Glyphs instances attributes: quad rectangle and source texcoords
+        rlEnableVertexBuffer(layout.instancesId);
+        rlSetVertexAttribute(textLayoutShaderLocs[0], 4, RL_FLOAT, 0, stride, 0);
+        rlSetVertexAttribute(textLayoutShaderLocs[1], 4, RL_FLOAT, 0, stride, (void *)(4*sizeof(float)));
 
-    char *insertPoint = NULL;   // Next insert point
-    char *temp = NULL;          // Temp pointer
-    int replaceLen = 0;         // Replace string length of (the string to remove)
-    int byLen = 0;              // Replacement length (the string to replace by)
-    int lastReplacePos = 0;     // Distance between replace and end of last replace
-    int count = 0;              // Number of replacements
+        for (int i = 0; i < 2; i++)
+        {
+            rlEnableVertexAttribute(textLayoutShaderLocs[i]);
+            rlSetVertexAttributeDivisor(textLayoutShaderLocs[i], 1);
+        }
 
-    replaceLen = TextLength(replace);
-    if (replaceLen == 0) return NULL;  // Empty replace causes infinite loop during count
+        int eyeCount = 1;
+        if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    byLen = TextLength(by);
+        for (int eye = 0; eye < eyeCount; eye++)
+        {
+            if (eyeCount == 1) rlSetUniformMatrix(textLayoutShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, matProjection));
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                rlSetUniformMatrix(textLayoutShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye)));
+            }
 
-    // Count the number of replacements needed
-    insertPoint = text;
-    for (count = 0; (temp = strstr(insertPoint, replace)); count++) insertPoint = temp + replaceLen;
+            rlDrawVertexArrayInstanced(0, 6, layout.glyphCount);
+        }
 
-    // Allocate returning string and point temp to it
-    temp = result = (char *)RL_MALLOC(TextLength(text) + (byLen - replaceLen)*count + 1);
+        // Instances attributes detached, every layout uses its own instances buffer
+        for (int i = 0; i < 2; i++)
+        {
+            rlSetVertexAttributeDivisor(textLayoutShaderLocs[i], 0);
+            rlDisableVertexAttribute(textLayoutShaderLocs[i]);
+        }
 
-    if (!result) return NULL;   // Memory could not be allocated
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableTexture();
+        rlDisableShader();
 
-    // First time through the loop, all the variable are set correctly from here on,
-    //  - 'temp' points to the end of the result string
-    //  - 'insertPoint' points to the next occurrence of replace in text
-    //  - 'text' points to the remainder of text after "end of replace"
-    while (count--)
-    {
-        insertPoint = strstr(text, replace);
-        lastReplacePos = (int)(insertPoint - text);
-        temp = strncpy(temp, text, lastReplacePos) + lastReplacePos;
-        temp = strcpy(temp, by) + byLen;
-        text += lastReplacePos + replaceLen; // Move to next "end of replace"
+        return;
     }
+#endif
 
-    // Copy remaind text part after replacement to result (pointed by moving temp)
-    strcpy(temp, text);
+    bool fontShader = BeginFontShaderMode(layout.pixelRange);
 
-    return result;
-}
+    rlPushMatrix();
+        rlTranslatef(position.x, position.y, 0.0f);
 
-// Insert text in a specific position, moves all text forward
-// WARNING: Allocated memory must be manually freed
-char *TextInsert(const char *text, const char *insert, int position)
-{
-    int textLen = TextLength(text);
-    int insertLen = TextLength(insert);
+        rlSetTexture(layout.texture.id);
+        rlBegin(RL_QUADS);
 
-    char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);              // Normal vector pointing towards viewer
 
-    for (int i = 0; i < position; i++) result[i] = text[i];
-    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
-    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+            rlVertexQuads2D(layout.vertices, layout.texcoords, NULL, layout.glyphCount);
 
-    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+        rlEnd();
+        rlSetTexture(0);
+    rlPopMatrix();
 
-    return result;
+    if (fontShader) EndShaderMode();
 }
 
-// Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
-const char *TextJoin(const char **textList, int count, const char *delimiter)
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
-
-    int totalLength = 0;
-    int delimiterLen = TextLength(delimiter);
+    Vector2 textSize = { 0.0f, 0.0f };
 
-    for (int i = 0; i < count; i++)
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
     {
-        int textLength = TextLength(textList[i]);
-
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
-        {
-            memcpy(textPtr, textList[i], textLength);
-            totalLength += textLength;
-            textPtr += textLength;
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
-            {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
-            }
-        }
+        textSize = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
     }
 
-    return buffer;
+    return (int)textSize.x;
 }
 
-// Split string into multiple strings
-// REQUIRES: memset()
-const char **TextSplit(const char *text, char delimiter, int *count)
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
 {
-    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
-    //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
-
-    static const char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-
-    result[0] = buffer;
-    int counter = 0;
-
-    if (text != NULL)
-    {
-        counter = 1;
-
-        // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
-        {
-            buffer[i] = text[i];
-            if (buffer[i] == '\0') break;
-            else if (buffer[i] == delimiter)
-            {
-                buffer[i] = '\0';   // Set an end of string at this point
-                result[counter] = buffer + i + 1;
-                counter++;
+    Vector2 textSize = { 0 };
 
-                if (counter == MAX_TEXTSPLIT_COUNT) break;
-            }
-        }
-    }
+    if ((font.texture.id == 0) || (text == NULL)) return textSize;
 
-    *count = counter;
-    return result;
+    return MeasureTextBytes(font, text, TextLength(text), fontSize, spacing);
 }
 
-// Append text at specific position and move cursor!
-// REQUIRES: strcpy()
-void TextAppend(char *text, const char *append, int *position)
+// Measure string size for Font, text bytes count provided (no null terminator required)
+// NOTE: Text is decoded by chunks (ASCII runs SIMD widened), ASCII glyph index is read directly from font glyphs lookup
+Vector2 MeasureTextBytes(Font font, const char *text, int byteCount, float fontSize, float spacing)
 {
-    strcpy(text + *position, append);
-    *position += TextLength(append);
-}
+    Vector2 textSize = { 0 };
 
-// Find first text occurrence within a string
-// REQUIRES: strstr()
-int TextFindIndex(const char *text, const char *find)
-{
-    int position = -1;
+    if ((font.texture.id == 0) || (text == NULL) || (byteCount <= 0)) return textSize;
 
-    char *ptr = strstr(text, find);
+    int size = byteCount;           // Size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
 
-    if (ptr != NULL) position = (int)(ptr - text);
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
 
-    return position;
-}
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
 
-// Get upper case version of provided string
-// REQUIRES: toupper()
-const char *TextToUpper(const char *text)
-{
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    int letter = 0;                 // Current character
+    int index = 0;                  // Index position in sprite font
+    int prevIndex = -1;             // Previous glyph index on line (kerning)
 
-    if (text != NULL)
+    // Glyphs lookup direct table used for ASCII bytes (static fonts only, dynamic fonts rasterize missing glyphs)
+    const rGlyphLookup *lookup = font.glyphLookup;
+    bool lookupValid = ((lookup != NULL) && (lookup->glyphs == font.glyphs) && (lookup->glyphCount == font.glyphCount));
+    const int *direct = (lookupValid && (lookup->dynamic == NULL))? lookup->direct : NULL;
+    bool kerning = (lookupValid && ((lookup->kerningCapacity > 0) || (lookup->dynamic != NULL)));
+    bool kerningPairs = (kerning && (lookup->dynamic == NULL));    // Static font kerning pairs read from lookup
+
+    int codepoints[TEXT_DECODE_CHUNK_SIZE] = { 0 };
+
+    for (int i = 0, bytesRead = 0; i < size; i += bytesRead)
     {
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        int count = DecodeUTF8(text + i, size - i, codepoints, TEXT_DECODE_CHUNK_SIZE, &bytesRead);
+
+        for (int k = 0; k < count; k++)
         {
-            if (text[i] != '\0')
+            byteCounter++;
+
+            letter = codepoints[k];
+
+            if (letter != '\n')
             {
-                buffer[i] = (char)toupper(text[i]);
-                //if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+                if ((letter < 0x80) && (direct != NULL) && (direct[letter] >= 0)) index = direct[letter];
+                else index = GetGlyphIndex(font, letter);
 
-                // TODO: Support UTF-8 diacritics to upper-case
-                //if ((text[i] >= 'à') && (text[i] <= 'ý')) buffer[i] = text[i] - 32;
+                if (kerning && (prevIndex >= 0)) textWidth += kerningPairs? GetGlyphLookupKerning(lookup, prevIndex, index) : GetGlyphKerningIndex(font, prevIndex, index);
+                prevIndex = index;
+
+                if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+                else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
             }
-            else { buffer[i] = '\0'; break; }
+            else
+            {
+                if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                byteCounter = 0;
+                textWidth = 0;
+                prevIndex = -1;
+                textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
+            }
+
+            if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
         }
     }
 
-    return buffer;
-}
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing); // Adds chars spacing to measure
+    textSize.y = textHeight*scaleFactor;
+
+    return textSize;
+}
+
+// Get index position for a unicode character on font
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+int GetGlyphIndex(Font font, int codepoint)
+{
+// Support charsets with any characters order
+#define SUPPORT_UNORDERED_CHARSET
+#if defined(SUPPORT_UNORDERED_CHARSET)
+    int index = GLYPH_NOTFOUND_CHAR_FALLBACK;
+    const rGlyphLookup *lookup = font.glyphLookup;
+
+    // Use glyphs lookup if it indexes current font glyphs
+    if ((lookup != NULL) && (lookup->glyphs == font.glyphs) && (lookup->glyphCount == font.glyphCount))
+    {
+        int found = GetGlyphLookupIndex(lookup, codepoint);
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        // Dynamic font glyphs are rasterized on first use
+        if (lookup->dynamic != NULL)
+        {
+            if (found >= 0) lookup->dynamic->lastUse[found] = ++lookup->dynamic->useCounter;
+            else found = LoadFontDynamicGlyph(font.glyphLookup, codepoint);
+        }
+#endif
+        return (found >= 0)? found : index;
+    }
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == codepoint)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    return index;
+#else
+    return (codepoint - 32);
+#endif
+}
+
+// Get glyph font info data for a codepoint (unicode character)
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+GlyphInfo GetGlyphInfo(Font font, int codepoint)
+{
+    GlyphInfo info = { 0 };
+
+    info = font.glyphs[GetGlyphIndex(font, codepoint)];
+
+    return info;
+}
+
+// Get glyph rectangle in font atlas for a codepoint (unicode character)
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+Rectangle GetGlyphAtlasRec(Font font, int codepoint)
+{
+    Rectangle rec = { 0 };
+
+    rec = font.recs[GetGlyphIndex(font, codepoint)];
+
+    return rec;
+}
+
+// Get glyphs pair kerning, advance adjustment in pixels at font base size
+// NOTE: Kerning pairs are loaded with TTF/OTF fonts (kern table and GPOS pair adjustments)
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    return GetGlyphKerningIndex(font, GetGlyphIndex(font, codepoint), GetGlyphIndex(font, nextCodepoint));
+}
+
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Get text length in bytes, check for \0 character
+unsigned int TextLength(const char *text)
+{
+    unsigned int length = 0;
+
+    if (text != NULL) length = (unsigned int)strlen(text);
+
+    return length;
+}
+
+// Formatting of text with variables to 'embed'
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextFormat(const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    const char *result = FormatFrameMemory(text, args);
+    va_end(args);
+
+    return (result != NULL)? result : "";
+}
+
+// Get integer value from text
+// NOTE: This function replaces atoi() [stdlib.h]
+int TextToInteger(const char *text)
+{
+    int value = 0;
+    int sign = 1;
+
+    if ((text[0] == '+') || (text[0] == '-'))
+    {
+        if (text[0] == '-') sign = -1;
+        text++;
+    }
+
+    for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); ++i) value = value*10 + (int)(text[i] - '0');
+
+    return value*sign;
+}
+
+#if defined(SUPPORT_TEXT_MANIPULATION)
+// Copy one string to another, returns bytes copied
+int TextCopy(char *dst, const char *src)
+{
+    int bytes = 0;
+
+    if ((src != NULL) && (dst != NULL))
+    {
+        while (*src != '\0')
+        {
+            *dst = *src;
+            dst++;
+            src++;
+
+            bytes++;
+        }
+
+        *dst = '\0';
+    }
+
+    return bytes;
+}
+
+// Check if two text string are equal
+// REQUIRES: strcmp()
+// NOTE: Same pointers are equal without comparison (interned strings)
+bool TextIsEqual(const char *text1, const char *text2)
+{
+    bool result = false;
+
+    if ((text1 != NULL) && (text2 != NULL))
+    {
+        if ((text1 == text2) || (strcmp(text1, text2) == 0)) result = true;
+    }
+
+    return result;
+}
+
+// Get text hash (FNV-1a, 32 bit)
+unsigned int TextHash(const char *text)
+{
+    unsigned int hash = 2166136261u;
+
+    if (text != NULL)
+    {
+        for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) hash = (hash ^ *c)*16777619u;
+    }
+
+    return hash;
+}
+
+// Intern text string, same text always gets same id
+// NOTE: Interned strings are copied and kept until CloseWindow(), ids can be compared instead of strings,
+// intern table is not thread-safe
+unsigned int TextIntern(const char *text)
+{
+    if (text == NULL) return 0;
+
+    unsigned int length = TextLength(text);
+    unsigned int hash = TextHash(text);
+
+    // Check if text already interned
+    if (textInternedIdsCapacity > 0)
+    {
+        unsigned int mask = (unsigned int)textInternedIdsCapacity - 1;
+
+        for (unsigned int slot = hash & mask; textInternedIds[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const TextInterned *interned = &textInterned[textInternedIds[slot] - 1];
+            if ((interned->hash == hash) && (interned->length == length) && (memcmp(interned->text, text, length) == 0)) return textInternedIds[slot];
+        }
+    }
+
+    // Ids hash table grown and rehashed (load factor <= 0.5)
+    if ((textInternedCount + 1)*2 > textInternedIdsCapacity)
+    {
+        int capacity = (textInternedIdsCapacity > 0)? textInternedIdsCapacity*2 : 256;
+        unsigned int *ids = (unsigned int *)RL_CALLOC(capacity, sizeof(unsigned int));
+        if (ids == NULL) return 0;
+
+        for (int i = 0; i < textInternedCount; i++)
+        {
+            unsigned int slot = textInterned[i].hash & (capacity - 1);
+            while (ids[slot] != 0) slot = (slot + 1) & (capacity - 1);
+            ids[slot] = i + 1;
+        }
+
+        RL_FREE(textInternedIds);
+        textInternedIds = ids;
+        textInternedIdsCapacity = capacity;
+    }
+
+    if (textInternedCount == textInternedCapacity)
+    {
+        int capacity = (textInternedCapacity > 0)? textInternedCapacity*2 : 128;
+        TextInterned *strings = (TextInterned *)RL_REALLOC(textInterned, capacity*sizeof(TextInterned));
+        if (strings == NULL) return 0;
+
+        textInterned = strings;
+        textInternedCapacity = capacity;
+    }
+
+    if (textInternedArena.blockSize == 0) textInternedArena = LoadMemArena(TEXT_INTERN_ARENA_BLOCK_SIZE);
+
+    char *copy = (char *)MemArenaAlloc(&textInternedArena, length + 1);
+    if (copy == NULL) return 0;
+    memcpy(copy, text, length + 1);
+
+    textInterned[textInternedCount] = (TextInterned){ copy, length, hash };
+    textInternedCount++;
+
+    unsigned int mask = (unsigned int)textInternedIdsCapacity - 1;
+    unsigned int slot = hash & mask;
+    while (textInternedIds[slot] != 0) slot = (slot + 1) & mask;
+    textInternedIds[slot] = (unsigned int)textInternedCount;
+
+    return (unsigned int)textInternedCount;
+}
+
+// Get interned text string by id, pointer is stable (NULL: not valid id)
+const char *TextGetInterned(unsigned int id)
+{
+    return ((id > 0) && (id <= (unsigned int)textInternedCount))? textInterned[id - 1].text : NULL;
+}
+
+// Get interned text string hash by id, same as TextHash() (0: not valid id)
+unsigned int TextGetInternedHash(unsigned int id)
+{
+    return ((id > 0) && (id <= (unsigned int)textInternedCount))? textInterned[id - 1].hash : 0;
+}
+
+// Unload text strings intern table, interned ids are not valid any more
+extern void UnloadTextInternTable(void)
+{
+    UnloadMemArena(textInternedArena);
+    RL_FREE(textInterned);
+    RL_FREE(textInternedIds);
+
+    textInternedArena = (MemArena){ 0 };
+    textInterned = NULL;
+    textInternedCount = 0;
+    textInternedCapacity = 0;
+    textInternedIds = NULL;
+    textInternedIdsCapacity = 0;
+}
+
+// Get a piece of a text string
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextSubtext(const char *text, int position, int length)
+{
+    int textLength = TextLength(text);
+
+    if (position >= textLength)
+    {
+        position = textLength - 1;
+        length = 0;
+    }
+
+    if (length > (textLength - position)) length = textLength - position;
+    if (length < 0) length = 0;
+
+    char *buffer = AllocFrameMemory(length + 1);
+    if (buffer == NULL) return "";
+
+    for (int c = 0 ; c < length ; c++)
+    {
+        *(buffer + c) = *(text + position);
+        text++;
+    }
+
+    *(buffer + length) = '\0';
+
+    return buffer;
+}
+
+// Replace text string
+// REQUIRES: strlen(), strstr(), strncpy(), strcpy()
+// WARNING: Allocated memory must be manually freed
+char *TextReplace(char *text, const char *replace, const char *by)
+{
+    // Sanity checks and initialization
+    if (!text || !replace || !by) return NULL;
+
+    char *result = NULL;
+
+    char *insertPoint = NULL;   // Next insert point
+    char *temp = NULL;          // Temp pointer
+    int replaceLen = 0;         // Replace string length of (the string to remove)
+    int byLen = 0;              // Replacement length (the string to replace by)
+    int lastReplacePos = 0;     // Distance between replace and end of last replace
+    int count = 0;              // Number of replacements
+
+    replaceLen = TextLength(replace);
+    if (replaceLen == 0) return NULL;  // Empty replace causes infinite loop during count
+
+    byLen = TextLength(by);
+
+    // Count the number of replacements needed
+    insertPoint = text;
+    for (count = 0; (temp = strstr(insertPoint, replace)); count++) insertPoint = temp + replaceLen;
+
+    // Allocate returning string and point temp to it
+    temp = result = (char *)RL_MALLOC(TextLength(text) + (byLen - replaceLen)*count + 1);
+
+    if (!result) return NULL;   // Memory could not be allocated
+
+    // First time through the loop, all the variable are set correctly from here on,
+    //  - 'temp' points to the end of the result string
+    //  - 'insertPoint' points to the next occurrence of replace in text
+    //  - 'text' points to the remainder of text after "end of replace"
+    while (count--)
+    {
+        insertPoint = strstr(text, replace);
+        lastReplacePos = (int)(insertPoint - text);
+        temp = strncpy(temp, text, lastReplacePos) + lastReplacePos;
+        temp = strcpy(temp, by) + byLen;
+        text += lastReplacePos + replaceLen; // Move to next "end of replace"
+    }
+
+    // Copy remaind text part after replacement to result (pointed by moving temp)
+    strcpy(temp, text);
+
+    return result;
+}
+
+// Insert text in a specific position, moves all text forward
+// WARNING: Allocated memory must be manually freed
+char *TextInsert(const char *text, const char *insert, int position)
+{
+    int textLen = TextLength(text);
+    int insertLen = TextLength(insert);
+
+    char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
+
+    for (int i = 0; i < position; i++) result[i] = text[i];
+    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
+    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+
+    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+
+    return result;
+}
+
+// Join text strings with delimiter
+// REQUIRES: memcpy()
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextJoin(const char **textList, int count, const char *delimiter)
+{
+    int totalLength = 0;
+    int delimiterLen = TextLength(delimiter);
+
+    // Get joined text length to allocate it at once
+    for (int i = 0; i < count; i++) totalLength += TextLength(textList[i]);
+    if (count > 1) totalLength += delimiterLen*(count - 1);
+
+    char *buffer = AllocFrameMemory(totalLength + 1);
+    if (buffer == NULL) return "";
+
+    char *textPtr = buffer;
+
+    for (int i = 0; i < count; i++)
+    {
+        int textLength = TextLength(textList[i]);
+
+        memcpy(textPtr, textList[i], textLength);
+        textPtr += textLength;
+
+        if ((delimiterLen > 0) && (i < (count - 1)))
+        {
+            memcpy(textPtr, delimiter, delimiterLen);
+            textPtr += delimiterLen;
+        }
+    }
+
+    *textPtr = '\0';
+
+    return buffer;
+}
+
+// Split string into multiple strings
+// REQUIRES: memcpy()
+// WARNING: Strings array returned is allocated from frame memory, it expires on EndDrawing()
+const char **TextSplit(const char *text, char delimiter, int *count)
+{
+    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
+    // inserted between strings defined by "delimiter" parameter, strings pointers array and text copy
+    // are allocated together from frame memory, substrings count limited by MAX_TEXTSPLIT_COUNT,
+    // last substring contains the remaining text
+
+    static const char *empty[1] = { "" };
+    int counter = 0;
+
+    if (text == NULL)
+    {
+        *count = counter;
+        return empty;
+    }
+
+    // Count how many substrings we have on text
+    int textLength = 0;
+    counter = 1;
+
+    for (; text[textLength] != '\0'; textLength++)
+    {
+        if ((text[textLength] == delimiter) && (counter < MAX_TEXTSPLIT_COUNT)) counter++;
+    }
+
+    const char **result = (const char **)AllocFrameMemory(counter*sizeof(const char *) + textLength + 1);
+
+    if (result == NULL)
+    {
+        *count = 0;
+        return empty;
+    }
+
+    char *buffer = (char *)(result + counter);
+    memcpy(buffer, text, textLength + 1);
+
+    // Point to every substring, setting an end of string on every delimiter
+    result[0] = buffer;
+
+    for (int i = 0, k = 1; (i < textLength) && (k < counter); i++)
+    {
+        if (buffer[i] == delimiter)
+        {
+            buffer[i] = '\0';
+            result[k] = buffer + i + 1;
+            k++;
+        }
+    }
+
+    *count = counter;
+    return result;
+}
+
+// Split string into multiple strings, allocated from memory arena
+// NOTE: Strings array and text copy are allocated together from arena, no limits on substrings count,
+// they are valid until arena is reset or unloaded
+const char **TextSplitEx(MemArena *arena, const char *text, char delimiter, int *count)
+{
+    *count = 0;
+    if ((arena == NULL) || (text == NULL)) return NULL;
+
+    int textLength = 0;
+    int counter = 1;
+
+    for (; text[textLength] != '\0'; textLength++)
+    {
+        if (text[textLength] == delimiter) counter++;
+    }
+
+    const char **result = (const char **)MemArenaAlloc(arena, counter*sizeof(const char *) + textLength + 1);
+    if (result == NULL) return NULL;
+
+    char *buffer = (char *)(result + counter);
+    memcpy(buffer, text, textLength + 1);
+
+    // Point to every substring, setting an end of string on every delimiter
+    result[0] = buffer;
+
+    for (int i = 0, k = 1; i < textLength; i++)
+    {
+        if (buffer[i] == delimiter)
+        {
+            buffer[i] = '\0';
+            result[k] = buffer + i + 1;
+            k++;
+        }
+    }
+
+    *count = counter;
+    return result;
+}
+
+// Append text at specific position and move cursor!
+// REQUIRES: strcpy()
+void TextAppend(char *text, const char *append, int *position)
+{
+    strcpy(text + *position, append);
+    *position += TextLength(append);
+}
+
+// Find first text occurrence within a string
+// REQUIRES: strstr()
+int TextFindIndex(const char *text, const char *find)
+{
+    int position = -1;
+
+    char *ptr = strstr(text, find);
+
+    if (ptr != NULL) position = (int)(ptr - text);
+
+    return position;
+}
+
+// Get upper case version of provided string
+// REQUIRES: toupper()
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextToUpper(const char *text)
+{
+    int textLength = TextLength(text);
+    char *buffer = AllocFrameMemory(textLength + 1);
+    if (buffer == NULL) return "";
+    buffer[0] = '\0';
+
+    if (text != NULL)
+    {
+        for (int i = 0; i <= textLength; i++)
+        {
+            if (text[i] != '\0')
+            {
+                buffer[i] = (char)toupper(text[i]);
+                //if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+
+                // TODO: Support UTF-8 diacritics to upper-case
+                //if ((text[i] >= 'à') && (text[i] <= 'ý')) buffer[i] = text[i] - 32;
+            }
+            else { buffer[i] = '\0'; break; }
+        }
+    }
+
+    return buffer;
+}
+
+// Get lower case version of provided string
+// REQUIRES: tolower()
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextToLower(const char *text)
+{
+    int textLength = TextLength(text);
+    char *buffer = AllocFrameMemory(textLength + 1);
+    if (buffer == NULL) return "";
+    buffer[0] = '\0';
+
+    if (text != NULL)
+    {
+        for (int i = 0; i <= textLength; i++)
+        {
+            if (text[i] != '\0')
+            {
+                buffer[i] = (char)tolower(text[i]);
+                //if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
+            }
+            else { buffer[i] = '\0'; break; }
+        }
+    }
+
+    return buffer;
+}
+
+// Get Pascal case notation version of provided string
+// REQUIRES: toupper()
+// WARNING: String returned is allocated from frame memory, it expires on EndDrawing()
+const char *TextToPascal(const char *text)
+{
+    int textLength = TextLength(text);
+    char *buffer = AllocFrameMemory(textLength + 1);
+    if (buffer == NULL) return "";
+    buffer[0] = '\0';
+
+    if (textLength > 0)
+    {
+        buffer[0] = (char)toupper(text[0]);
+
+        for (int i = 1, j = 1; i <= textLength; i++, j++)
+        {
+            if (text[j] != '\0')
+            {
+                if (text[j] != '_') buffer[i] = text[j];
+                else
+                {
+                    j++;
+                    buffer[i] = (char)toupper(text[j]);
+                    if (buffer[i] == '\0') break;
+                }
+            }
+            else { buffer[i] = '\0'; break; }
+        }
+    }
+
+    return buffer;
+}
+
+// Encode text codepoint into UTF-8 text
+// REQUIRES: memcpy()
+// WARNING: Allocated memory must be manually freed
+char *LoadUTF8(const int *codepoints, int length)
+{
+    // We allocate enough memory fo fit all possible codepoints
+    // NOTE: 5 bytes for every codepoint should be enough
+    char *text = (char *)RL_CALLOC(length*5, 1);
+    const char *utf8 = NULL;
+    int size = 0;
+
+    for (int i = 0, bytes = 0; i < length; i++)
+    {
+        utf8 = CodepointToUTF8(codepoints[i], &bytes);
+        memcpy(text + size, utf8, bytes);
+        size += bytes;
+    }
+
+    // Resize memory to text length + string NULL terminator
+    void *ptr = RL_REALLOC(text, size + 1);
+
+    if (ptr != NULL) text = (char *)ptr;
+
+    return text;
+}
+
+// Unload UTF-8 text encoded from codepoints array
+void UnloadUTF8(char *text)
+{
+    RL_FREE(text);
+}
+
+// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
+// NOTE: Use DecodeUTF8Into() to decode into a provided buffer, no memory allocated
+int *LoadCodepoints(const char *text, int *count)
+{
+    int textLength = TextLength(text);
+
+    // Allocate a big enough buffer to store as many codepoints as text bytes
+    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+
+    int codepointCount = DecodeUTF8Into(text, textLength, codepoints, textLength);
+
+    // Re-allocate buffer to the actual number of codepoints loaded
+    int *temp = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+    if (temp != NULL) codepoints = temp;
+
+    *count = codepointCount;
+
+    return codepoints;
+}
+
+// Unload codepoints data from memory
+void UnloadCodepoints(int *codepoints)
+{
+    RL_FREE(codepoints);
+}
+
+// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
+// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted for every invalid byte
+int GetCodepointCount(const char *text)
+{
+    return DecodeUTF8(text, TextLength(text), NULL, 0, NULL);
+}
+
+// Encode codepoint into utf8 text (char array length returned as parameter)
+// NOTE: It uses a static array to store UTF-8 bytes
+const char *CodepointToUTF8(int codepoint, int *utf8Size)
+{
+    static char utf8[6] = { 0 };
+    int size = 0;   // Byte size of codepoint
+
+    if (codepoint <= 0x7f)
+    {
+        utf8[0] = (char)codepoint;
+        size = 1;
+    }
+    else if (codepoint <= 0x7ff)
+    {
+        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
+        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
+        size = 2;
+    }
+    else if (codepoint <= 0xffff)
+    {
+        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
+        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
+        size = 3;
+    }
+    else if (codepoint <= 0x10ffff)
+    {
+        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
+        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
+        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
+        size = 4;
+    }
+
+    *utf8Size = size;
+
+    return utf8;
+}
+#endif      // SUPPORT_TEXT_MANIPULATION
+
+// Decode UTF-8 text bytes into provided codepoints buffer, returns codepoints decoded
+// NOTE: Sequences are validated (RFC 3629), invalid bytes are decoded as '?'(0x3f) one by one,
+// decoding stops when buffer is full (capacity equal to byteCount is always enough), no memory allocated
+int DecodeUTF8Into(const char *text, int byteCount, int *codepoints, int capacity)
+{
+    if ((text == NULL) || (codepoints == NULL) || (byteCount <= 0) || (capacity <= 0)) return 0;
+
+    return DecodeUTF8(text, byteCount, codepoints, capacity, NULL);
+}
+
+// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
+// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
+// Total number of bytes processed are returned as a parameter
+// NOTE: The standard says U+FFFD should be returned in case of errors
+// but that character is not supported by the default font in raylib
+int GetCodepoint(const char *text, int *codepointSize)
+{
+/*
+    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+
+    Char. number range  |        UTF-8 octet sequence
+      (hexadecimal)    |              (binary)
+    --------------------+---------------------------------------------
+    0000 0000-0000 007F | 0xxxxxxx
+    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
+    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
+    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+*/
+    // NOTE: on decode errors we return as soon as possible
+
+    int codepoint = 0x3f;   // Codepoint (defaults to '?')
+    int octet = (unsigned char)(text[0]); // The first UTF8 octet
+    *codepointSize = 1;
+
+    if (octet <= 0x7f)
+    {
+        // Only one octet (ASCII range x00-7F)
+        codepoint = text[0];
+    }
+    else if ((octet & 0xe0) == 0xc0)
+    {
+        // Two octets
+
+        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
+        unsigned char octet1 = text[1];
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if ((octet >= 0xc2) && (octet <= 0xdf))
+        {
+            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
+            *codepointSize = 2;
+        }
+    }
+    else if ((octet & 0xf0) == 0xe0)
+    {
+        // Three octets
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+
+        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
+        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
+        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+
+        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
+            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+
+        if ((octet >= 0xe0) && (octet <= 0xef))
+        {
+            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
+            *codepointSize = 3;
+        }
+    }
+    else if ((octet & 0xf8) == 0xf0)
+    {
+        // Four octets
+        if (octet > 0xf4) return codepoint;
+
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+        unsigned char octet3 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+
+        octet3 = text[3];
+
+        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+
+        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+
+        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
+            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if (octet >= 0xf0)
+        {
+            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
+            *codepointSize = 4;
+        }
+    }
+
+    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+
+    return codepoint;
+}
+
+// Get next codepoint in a byte sequence and bytes processed
+int GetCodepointNext(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 0;
+
+    // Get current codepoint and bytes processed
+    if (0xf0 == (0xf8 & ptr[0]))
+    {
+        // 4 byte UTF-8 codepoint
+        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
+        *codepointSize = 4;
+    }
+    else if (0xe0 == (0xf0 & ptr[0]))
+    {
+        // 3 byte UTF-8 codepoint */
+        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
+        *codepointSize = 3;
+    }
+    else if (0xc0 == (0xe0 & ptr[0]))
+    {
+        // 2 byte UTF-8 codepoint
+        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
+        *codepointSize = 2;
+    }
+    else
+    {
+        // 1 byte UTF-8 codepoint
+        codepoint = ptr[0];
+        *codepointSize = 1;
+    }
+
+    return codepoint;
+}
+
+// Get previous codepoint in a byte sequence and bytes processed
+int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Decode UTF-8 bytes into codepoints, returns codepoints decoded (bytes decoded returned by parameter)
+// NOTE: Runs of 16 ASCII bytes are checked and widened with SIMD, other bytes are decoded one sequence at a time,
+// if codepoints is NULL codepoints are only counted (capacity not applied)
+static int DecodeUTF8(const char *text, int byteCount, int *codepoints, int capacity, int *bytesRead)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int count = 0;
+    int i = 0;
+
+    if (codepoints == NULL) capacity = byteCount;
+
+    while ((i < byteCount) && (count < capacity))
+    {
+#if defined(RTEXT_SIMD_SSE2) || defined(RTEXT_SIMD_NEON)
+        if (((byteCount - i) >= 16) && ((capacity - count) >= 16))
+        {
+    #if defined(RTEXT_SIMD_SSE2)
+            __m128i chunk = _mm_loadu_si128((const __m128i *)(bytes + i));
+
+            if (_mm_movemask_epi8(chunk) == 0)
+            {
+                if (codepoints != NULL)
+                {
+                    __m128i zero = _mm_setzero_si128();
+                    __m128i low = _mm_unpacklo_epi8(chunk, zero);
+                    __m128i high = _mm_unpackhi_epi8(chunk, zero);
+
+                    _mm_storeu_si128((__m128i *)(codepoints + count), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16(high, zero));
+                }
+
+                i += 16;
+                count += 16;
+                continue;
+            }
+    #else
+            uint8x16_t chunk = vld1q_u8(bytes + i);
+            uint64x2_t high = vreinterpretq_u64_u8(vandq_u8(chunk, vdupq_n_u8(0x80)));
+
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) == 0)
+            {
+                if (codepoints != NULL)
+                {
+                    uint16x8_t low16 = vmovl_u8(vget_low_u8(chunk));
+                    uint16x8_t high16 = vmovl_u8(vget_high_u8(chunk));
+
+                    vst1q_s32(codepoints + count, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(low16))));
+                    vst1q_s32(codepoints + count + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(low16))));
+                    vst1q_s32(codepoints + count + 8, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(high16))));
+                    vst1q_s32(codepoints + count + 12, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(high16))));
+                }
+
+                i += 16;
+                count += 16;
+                continue;
+            }
+    #endif
+        }
+#endif
+        int octet = bytes[i];
+        int remaining = byteCount - i;
+        int codepoint = 0x3f;       // Invalid sequence, one byte decoded as '?'
+        int size = 1;
+
+        if (octet < 0x80) codepoint = octet;
+        else if ((octet >= 0xc2) && (octet <= 0xdf))
+        {
+            if ((remaining >= 2) && ((bytes[i + 1] & 0xc0) == 0x80))
+            {
+                codepoint = ((octet & 0x1f) << 6) | (bytes[i + 1] & 0x3f);
+                size = 2;
+            }
+        }
+        else if ((octet & 0xf0) == 0xe0)
+        {
+            if ((remaining >= 3) && ((bytes[i + 1] & 0xc0) == 0x80) && ((bytes[i + 2] & 0xc0) == 0x80))
+            {
+                int value = ((octet & 0x0f) << 12) | ((bytes[i + 1] & 0x3f) << 6) | (bytes[i + 2] & 0x3f);
+
+                // Overlong sequences and surrogates are not valid
+                if ((value >= 0x800) && ((value < 0xd800) || (value > 0xdfff)))
+                {
+                    codepoint = value;
+                    size = 3;
+                }
+            }
+        }
+        else if ((octet >= 0xf0) && (octet <= 0xf4))
+        {
+            if ((remaining >= 4) && ((bytes[i + 1] & 0xc0) == 0x80) && ((bytes[i + 2] & 0xc0) == 0x80) && ((bytes[i + 3] & 0xc0) == 0x80))
+            {
+                int value = ((octet & 0x07) << 18) | ((bytes[i + 1] & 0x3f) << 12) | ((bytes[i + 2] & 0x3f) << 6) | (bytes[i + 3] & 0x3f);
+
+                // Overlong sequences and codepoints after U+10FFFF are not valid
+                if ((value >= 0x10000) && (value <= 0x10ffff))
+                {
+                    codepoint = value;
+                    size = 4;
+                }
+            }
+        }
+
+        if (codepoints != NULL) codepoints[count] = codepoint;
+        count++;
+        i += size;
+    }
+
+    if (bytesRead != NULL) *bytesRead = i;
+
+    return count;
+}
+
+#if defined(SUPPORT_FILEFORMAT_FNT)
+
+// Read a line from memory
+// REQUIRES: memcpy()
+// NOTE: Returns the number of bytes read
+static int GetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    return count;
+}
+
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static Font LoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE     256
+
+    Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int glyphCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    char imFileName[129] = { 0 };
+
+    int base = 0;   // Useless data
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText == NULL) return font;
+
+    char *fileTextPtr = fileText;
+
+    // NOTE: We skip first line, it contains no useful information
+    int lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    fileTextPtr += (lineBytes + 1);
+
+    // Read line data
+    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "lineHeight");
+    sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i", &fontSize, &base, &imWidth, &imHeight);
+    fileTextPtr += (lineBytes + 1);
+
+    TRACELOGD("FONT: [%s] Loaded font info:", fileName);
+    TRACELOGD("    > Base size: %i", fontSize);
+    TRACELOGD("    > Texture scale: %ix%i", imWidth, imHeight);
+
+    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "file");
+    sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName);
+    fileTextPtr += (lineBytes + 1);
+
+    TRACELOGD("    > Texture filename: %s", imFileName);
+
+    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "count");
+    sscanf(searchPoint, "count=%i", &glyphCount);
+    fileTextPtr += (lineBytes + 1);
+
+    TRACELOGD("    > Chars count: %i", glyphCount);
+
+    // Compose correct path using route of .fnt file (fileName) and imFileName
+    char *imPath = NULL;
+    char *lastSlash = NULL;
+
+    lastSlash = strrchr(fileName, '/');
+    if (lastSlash == NULL) lastSlash = strrchr(fileName, '\\');
+
+    if (lastSlash != NULL)
+    {
+        // NOTE: We need some extra space to avoid memory corruption on next allocations!
+        imPath = (char *)RL_CALLOC(TextLength(fileName) - TextLength(lastSlash) + TextLength(imFileName) + 4, 1);
+        memcpy(imPath, fileName, TextLength(fileName) - TextLength(lastSlash) + 1);
+        memcpy(imPath + TextLength(fileName) - TextLength(lastSlash) + 1, imFileName, TextLength(imFileName));
+    }
+    else imPath = imFileName;
+
+    TRACELOGD("    > Image loading path: %s", imPath);
+
+    Image imFont = LoadImage(imPath);
+
+    if (imFont.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
+        Image imFontAlpha = {
+            .data = RL_CALLOC(imFont.width*imFont.height, 2),
+            .width = imFont.width,
+            .height = imFont.height,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+        };
+
+        for (int p = 0, i = 0; p < (imFont.width*imFont.height*2); p += 2, i++)
+        {
+            ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
+            ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFont.data)[i];
+        }
+
+        UnloadImage(imFont);
+        imFont = imFontAlpha;
+    }
+
+    font.texture = LoadTextureFromImage(imFont);
+
+    if (lastSlash != NULL) RL_FREE(imPath);
+
+    // Fill font characters info data
+    font.baseSize = fontSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = 0;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+
+    int charId, charX, charY, charWidth, charHeight, charOffsetX, charOffsetY, charAdvanceX;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i",
+                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX);
+        fileTextPtr += (lineBytes + 1);
+
+        // Get character rectangle in the font atlas texture
+        font.recs[i] = (Rectangle){ (float)charX, (float)charY, (float)charWidth, (float)charHeight };
+
+        // Save data properly in sprite font
+        font.glyphs[i].value = charId;
+        font.glyphs[i].offsetX = charOffsetX;
+        font.glyphs[i].offsetY = charOffsetY;
+        font.glyphs[i].advanceX = charAdvanceX;
+
+        // Fill character image data from imFont data
+        font.glyphs[i].image = ImageFromImage(imFont, font.recs[i]);
+    }
+
+    UnloadImage(imFont);
+    UnloadFileText(fileText);
+
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+    if (font.texture.id == 0)
+    {
+        UnloadFont(font);
+        font = GetFontDefault();
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+    }
+    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+
+    return font;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize font glyphs range [start, end), jobs system callback
+// NOTE: Font data is only read, every glyph writes its own GlyphInfo
+static void LoadFontGlyphs(int start, int end, void *userData)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)userData;
+
+    // Scratch memory for stb_truetype temporary allocations, shared by all glyphs of the range
+    // NOTE: Font info is shared read-only between threads, glyphs images are allocated on heap
+    GlyphScratch scratch = { 0 };
+    scratch.buffer = (unsigned char *)RL_MALLOC(FONT_GLYPHS_SCRATCH_SIZE);
+    scratch.size = (scratch.buffer != NULL)? FONT_GLYPHS_SCRATCH_SIZE : 0;
+    glyphScratch = &scratch;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->fontChars[i];  // Character value to get info for
+        job->chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (job->type == FONT_MSDF)
+        {
+            // NOTE: Multi-channel distance field generated on scratch memory, glyph image allocated on heap
+            job->chars[i].image.data = GenGlyphMsdf(job->fontInfo, ch, job->scaleFactor, FONT_MSDF_CHAR_PADDING, FONT_MSDF_PIXEL_RANGE, &chw, &chh, &job->chars[i].offsetX, &job->chars[i].offsetY);
+        }
+        else if (job->type != FONT_SDF)
+        {
+            int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+            stbtt_GetCodepointBitmapBox(job->fontInfo, ch, job->scaleFactor, job->scaleFactor, &x0, &y0, &x1, &y1);
+
+            chw = x1 - x0;
+            chh = y1 - y0;
+            job->chars[i].offsetX = x0;
+            job->chars[i].offsetY = y0;
+            job->chars[i].image.data = NULL;
+
+            // NOTE: Same rasterization as stbtt_GetCodepointBitmap(), bitmap allocated on heap for glyph image
+            if ((chw > 0) && (chh > 0))
+            {
+                job->chars[i].image.data = RL_MALLOC(chw*chh);
+                stbtt_MakeCodepointBitmap(job->fontInfo, (unsigned char *)job->chars[i].image.data, chw, chh, chw, job->scaleFactor, job->scaleFactor, ch);
+            }
+            else chw = chh = 0;
+        }
+        else if (ch != 32)
+        {
+            unsigned char *sdf = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &job->chars[i].offsetX, &job->chars[i].offsetY);
+
+            // SDF is generated on scratch memory, copied to glyph image
+            job->chars[i].image.data = NULL;
+
+            if (sdf != NULL)
+            {
+                job->chars[i].image.data = RL_MALLOC(chw*chh);
+                memcpy(job->chars[i].image.data, sdf, chw*chh);
+                stbtt_FreeSDF(sdf, NULL);
+            }
+        }
+        else job->chars[i].image.data = NULL;
+
+        scratch.used = 0;       // Glyph temporary allocations released
+
+        stbtt_GetCodepointHMetrics(job->fontInfo, ch, &job->chars[i].advanceX, NULL);
+        job->chars[i].advanceX = (int)((float)job->chars[i].advanceX*job->scaleFactor);
+
+        // Load characters images
+        job->chars[i].image.width = chw;
+        job->chars[i].image.height = chh;
+        job->chars[i].image.mipmaps = 1;
+        job->chars[i].image.format = (job->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        job->chars[i].offsetY += (int)((float)job->ascent*job->scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = RL_CALLOC(job->chars[i].advanceX*job->fontSize, (job->type == FONT_MSDF)? 3 : 2),
+                .width = job->chars[i].advanceX,
+                .height = job->fontSize,
+                .mipmaps = 1,
+                .format = job->chars[i].image.format
+            };
+
+            job->chars[i].image = imSpace;
+        }
+
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)job->chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)job->chars[i].image.data)[p] = 0;
+                else ((unsigned char *)job->chars[i].image.data)[p] = 255;
+            }
+        }
+
+        // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(job->fontInfo, ch, job->scaleFactor, job->scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)job->ascent*job->scaleFactor) + chY1);
+        */
+    }
+
+    glyphScratch = NULL;
+    RL_FREE(scratch.buffer);
+}
+
+// Allocate glyphs rasterization memory, from thread scratch memory if available
+// NOTE: Allocations are 16 bytes aligned, allocations not fitting scratch memory use heap
+static void *GlyphScratchAlloc(size_t size)
+{
+    GlyphScratch *scratch = glyphScratch;
+
+    if (scratch != NULL)
+    {
+        size_t alignedSize = (size + 15) & ~(size_t)15;
+
+        if ((scratch->used + alignedSize) <= scratch->size)
+        {
+            void *ptr = scratch->buffer + scratch->used;
+            scratch->used += alignedSize;
+            return ptr;
+        }
+    }
+
+    return RL_MALLOC(size);
+}
+
+// Free glyphs rasterization memory
+// NOTE: Scratch memory is released at once after every glyph, only heap allocations are freed
+static void GlyphScratchFree(void *ptr)
+{
+    GlyphScratch *scratch = glyphScratch;
+
+    if ((scratch != NULL) && ((unsigned char *)ptr >= scratch->buffer) && ((unsigned char *)ptr < (scratch->buffer + scratch->size))) return;
+
+    RL_FREE(ptr);
+}
+
+// Get MSDF edge point at parameter t
+static Vector2 GetMsdfEdgePoint(const MsdfEdge *edge, float t)
+{
+    Vector2 point = { 0 };
+
+    if (edge->type == 1)
+    {
+        point.x = edge->p[0].x + (edge->p[1].x - edge->p[0].x)*t;
+        point.y = edge->p[0].y + (edge->p[1].y - edge->p[0].y)*t;
+    }
+    else
+    {
+        float it = 1.0f - t;
+        point.x = it*it*edge->p[0].x + 2.0f*it*t*edge->p[1].x + t*t*edge->p[2].x;
+        point.y = it*it*edge->p[0].y + 2.0f*it*t*edge->p[1].y + t*t*edge->p[2].y;
+    }
+
+    return point;
+}
+
+// Get MSDF edge direction at parameter t (not normalized)
+static Vector2 GetMsdfEdgeDirection(const MsdfEdge *edge, float t)
+{
+    Vector2 direction = { edge->p[1].x - edge->p[0].x, edge->p[1].y - edge->p[0].y };
+
+    if (edge->type == 2)
+    {
+        direction.x = direction.x + ((edge->p[2].x - edge->p[1].x) - direction.x)*t;
+        direction.y = direction.y + ((edge->p[2].y - edge->p[1].y) - direction.y)*t;
+
+        // Degenerated curve (control point on end point)
+        if ((direction.x == 0.0f) && (direction.y == 0.0f)) direction = (Vector2){ edge->p[2].x - edge->p[0].x, edge->p[2].y - edge->p[0].y };
+    }
+
+    return direction;
+}
+
+// Normalize vector for MSDF generation (zero length vector returned unchanged)
+static Vector2 MsdfNormalize(Vector2 v)
+{
+    float length = sqrtf(v.x*v.x + v.y*v.y);
+    if (length > 0.0f) { v.x /= length; v.y /= length; }
+    return v;
+}
+
+// Compare MSDF signed distances (true: a is nearer than b)
+// NOTE: Equal distances (edges joints) are solved by the less orthogonal edge
+static bool MsdfDistanceLess(MsdfDistance a, MsdfDistance b)
+{
+    return (fabsf(a.distance) < fabsf(b.distance)) || ((fabsf(a.distance) == fabsf(b.distance)) && (a.dot < b.dot));
+}
+
+// Solve cubic equation a*x^3 + b*x^2 + c*x + d = 0, returns number of real roots
+static int SolveMsdfCubic(float *x, float a, float b, float c, float d)
+{
+    if ((a != 0.0f) && (fabsf(b/a) < 1e6f))
+    {
+        // Normalized cubic x^3 + a*x^2 + b*x + c = 0 (trigonometric or Cardano solution)
+        float an = b/a, bn = c/a, cn = d/a;
+        float a2 = an*an;
+        float q = (a2 - 3.0f*bn)/9.0f;
+        float r = (an*(2.0f*a2 - 9.0f*bn) + 27.0f*cn)/54.0f;
+        float r2 = r*r;
+        float q3 = q*q*q;
+        an /= 3.0f;
+
+        if (r2 < q3)
+        {
+            float t = r/sqrtf(q3);
+            if (t < -1.0f) t = -1.0f;
+            if (t > 1.0f) t = 1.0f;
+            t = acosf(t);
+            q = -2.0f*sqrtf(q);
+            x[0] = q*cosf(t/3.0f) - an;
+            x[1] = q*cosf((t + 2.0f*PI)/3.0f) - an;
+            x[2] = q*cosf((t - 2.0f*PI)/3.0f) - an;
+            return 3;
+        }
+        else
+        {
+            float u = ((r < 0.0f)? 1.0f : -1.0f)*powf(fabsf(r) + sqrtf(r2 - q3), 1.0f/3.0f);
+            float v = (u == 0.0f)? 0.0f : q/u;
+            x[0] = (u + v) - an;
+
+            if ((u == v) || (fabsf(u - v) < 1e-7f*fabsf(u + v)))
+            {
+                x[1] = -0.5f*(u + v) - an;
+                return 2;
+            }
+
+            return 1;
+        }
+    }
+
+    // Quadratic equation b*x^2 + c*x + d = 0
+    if ((b == 0.0f) || (fabsf(c) > 1e12f*fabsf(b)))
+    {
+        if (c == 0.0f) return 0;
+        x[0] = -d/c;
+        return 1;
+    }
+
+    float dscr = c*c - 4.0f*b*d;
+
+    if (dscr > 0.0f)
+    {
+        dscr = sqrtf(dscr);
+        x[0] = (-c + dscr)/(2.0f*b);
+        x[1] = (-c - dscr)/(2.0f*b);
+        return 2;
+    }
+    else if (dscr == 0.0f)
+    {
+        x[0] = -c/(2.0f*b);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Get MSDF signed distance from point to edge, nearest point parameter returned (out of [0..1] range beyond end points)
+// NOTE: Distance sign given by point side of edge direction
+static MsdfDistance GetMsdfEdgeDistance(const MsdfEdge *edge, Vector2 p, float *param)
+{
+    MsdfDistance result = { 0 };
+
+    if (edge->type == 1)
+    {
+        Vector2 aq = { p.x - edge->p[0].x, p.y - edge->p[0].y };
+        Vector2 ab = { edge->p[1].x - edge->p[0].x, edge->p[1].y - edge->p[0].y };
+        float t = (aq.x*ab.x + aq.y*ab.y)/(ab.x*ab.x + ab.y*ab.y);
+        Vector2 eq = (t > 0.5f)? (Vector2){ edge->p[1].x - p.x, edge->p[1].y - p.y } : (Vector2){ edge->p[0].x - p.x, edge->p[0].y - p.y };
+        float endDistance = sqrtf(eq.x*eq.x + eq.y*eq.y);
+
+        *param = t;
+
+        if ((t > 0.0f) && (t < 1.0f))
+        {
+            float orthoDistance = (aq.x*ab.y - aq.y*ab.x)/sqrtf(ab.x*ab.x + ab.y*ab.y);
+
+            if (fabsf(orthoDistance) < endDistance) return (MsdfDistance){ orthoDistance, 0.0f };
+        }
+
+        Vector2 abn = MsdfNormalize(ab);
+        Vector2 eqn = MsdfNormalize(eq);
+        result.distance = (((aq.x*ab.y - aq.y*ab.x) >= 0.0f)? 1.0f : -1.0f)*endDistance;
+        result.dot = fabsf(abn.x*eqn.x + abn.y*eqn.y);
+    }
+    else
+    {
+        Vector2 qa = { edge->p[0].x - p.x, edge->p[0].y - p.y };
+        Vector2 ab = { edge->p[1].x - edge->p[0].x, edge->p[1].y - edge->p[0].y };
+        Vector2 br = { edge->p[2].x - edge->p[1].x - ab.x, edge->p[2].y - edge->p[1].y - ab.y };
+
+        // Nearest point on curve: derivative of squared distance roots
+        float a = br.x*br.x + br.y*br.y;
+        float b = 3.0f*(ab.x*br.x + ab.y*br.y);
+        float c = 2.0f*(ab.x*ab.x + ab.y*ab.y) + (qa.x*br.x + qa.y*br.y);
+        float d = qa.x*ab.x + qa.y*ab.y;
+        float t[3] = { 0 };
+        int solutions = SolveMsdfCubic(t, a, b, c, d);
+
+        // Start point distance
+        Vector2 dir = GetMsdfEdgeDirection(edge, 0.0f);
+        float minDistance = (((dir.x*qa.y - dir.y*qa.x) >= 0.0f)? 1.0f : -1.0f)*sqrtf(qa.x*qa.x + qa.y*qa.y);
+        *param = -(qa.x*dir.x + qa.y*dir.y)/(dir.x*dir.x + dir.y*dir.y);
+
+        // End point distance
+        dir = GetMsdfEdgeDirection(edge, 1.0f);
+        Vector2 qe = { edge->p[2].x - p.x, edge->p[2].y - p.y };
+        float distance = sqrtf(qe.x*qe.x + qe.y*qe.y);
+
+        if (distance < fabsf(minDistance))
+        {
+            minDistance = (((dir.x*qe.y - dir.y*qe.x) >= 0.0f)? 1.0f : -1.0f)*distance;
+            *param = ((p.x - edge->p[1].x)*dir.x + (p.y - edge->p[1].y)*dir.y)/(dir.x*dir.x + dir.y*dir.y);
+        }
+
+        // Curve inner points distance
+        for (int i = 0; i < solutions; i++)
+        {
+            if ((t[i] > 0.0f) && (t[i] < 1.0f))
+            {
+                qe = (Vector2){ qa.x + 2.0f*t[i]*ab.x + t[i]*t[i]*br.x, qa.y + 2.0f*t[i]*ab.y + t[i]*t[i]*br.y };
+                distance = sqrtf(qe.x*qe.x + qe.y*qe.y);
+
+                if (distance <= fabsf(minDistance))
+                {
+                    dir = (Vector2){ ab.x + t[i]*br.x, ab.y + t[i]*br.y };
+                    minDistance = (((dir.x*qe.y - dir.y*qe.x) >= 0.0f)? 1.0f : -1.0f)*distance;
+                    *param = t[i];
+                }
+            }
+        }
+
+        result.distance = minDistance;
+
+        if ((*param >= 0.0f) && (*param <= 1.0f)) result.dot = 0.0f;
+        else if (*param < 0.5f)
+        {
+            Vector2 dirn = MsdfNormalize(GetMsdfEdgeDirection(edge, 0.0f));
+            Vector2 qan = MsdfNormalize(qa);
+            result.dot = fabsf(dirn.x*qan.x + dirn.y*qan.y);
+        }
+        else
+        {
+            Vector2 dirn = MsdfNormalize(GetMsdfEdgeDirection(edge, 1.0f));
+            Vector2 qen = MsdfNormalize((Vector2){ edge->p[2].x - p.x, edge->p[2].y - p.y });
+            result.dot = fabsf(dirn.x*qen.x + dirn.y*qen.y);
+        }
+    }
+
+    return result;
+}
+
+// Get MSDF pseudo-distance, distance to edge extended beyond end points along end directions
+// NOTE: Required for channels distances to meet on corners (edges of different colors)
+static float GetMsdfEdgePseudoDistance(const MsdfEdge *edge, MsdfDistance distance, Vector2 p, float param)
+{
+    if ((param < 0.0f) || (param > 1.0f))
+    {
+        float t = (param < 0.0f)? 0.0f : 1.0f;
+        Vector2 dir = MsdfNormalize(GetMsdfEdgeDirection(edge, t));
+        Vector2 point = GetMsdfEdgePoint(edge, t);
+        Vector2 aq = { p.x - point.x, p.y - point.y };
+        float ts = aq.x*dir.x + aq.y*dir.y;
+
+        if (((param < 0.0f) && (ts < 0.0f)) || ((param > 1.0f) && (ts > 0.0f)))
+        {
+            float pseudoDistance = aq.x*dir.y - aq.y*dir.x;
+            if (fabsf(pseudoDistance) <= fabsf(distance.distance)) return pseudoDistance;
+        }
+    }
+
+    return distance.distance;
+}
+
+// Split MSDF edge in three parts
+static void SplitMsdfEdge(const MsdfEdge *edge, MsdfEdge *parts)
+{
+    Vector2 p1 = GetMsdfEdgePoint(edge, 1.0f/3.0f);
+    Vector2 p2 = GetMsdfEdgePoint(edge, 2.0f/3.0f);
+
+    for (int i = 0; i < 3; i++) parts[i] = *edge;
+
+    if (edge->type == 1)
+    {
+        parts[0].p[1] = p1;
+        parts[1].p[0] = p1; parts[1].p[1] = p2;
+        parts[2].p[0] = p2;
+    }
+    else
+    {
+        const Vector2 *p = edge->p;
+
+        parts[0].p[1] = (Vector2){ p[0].x + (p[1].x - p[0].x)/3.0f, p[0].y + (p[1].y - p[0].y)/3.0f };
+        parts[0].p[2] = p1;
+        parts[1].p[0] = p1;
+        parts[1].p[1] = (Vector2){ 0.5f*((p[0].x + (p[1].x - p[0].x)*5.0f/9.0f) + (p[1].x + (p[2].x - p[1].x)*4.0f/9.0f)),
+                                   0.5f*((p[0].y + (p[1].y - p[0].y)*5.0f/9.0f) + (p[1].y + (p[2].y - p[1].y)*4.0f/9.0f)) };
+        parts[1].p[2] = p2;
+        parts[2].p[0] = p2;
+        parts[2].p[1] = (Vector2){ p[1].x + (p[2].x - p[1].x)*2.0f/3.0f, p[1].y + (p[2].y - p[1].y)*2.0f/3.0f };
+    }
+}
+
+// Get next MSDF edge color (channels mask), avoiding banned color channel
+static int GetMsdfNextColor(int color, int banned)
+{
+    int combined = color & banned;
+
+    if ((combined == 1) || (combined == 2) || (combined == 4)) return combined ^ 7;
+    if ((color == 0) || (color == 7)) return 6;     // Cyan
+
+    int shifted = color << 1;
+    return (shifted | (shifted >> 3)) & 7;
+}
+
+// Check MSDF corner between edges directions (normalized)
+static bool IsMsdfCorner(Vector2 a, Vector2 b)
+{
+    return ((a.x*b.x + a.y*b.y) <= 0.0f) || (fabsf(a.x*b.y - a.y*b.x) > 0.1411f);     // sin(3.0 radians) angle threshold
+}
+
+// Color MSDF contour edges (channels), contour edges are [start..end), returns new contour end (edges could be split)
+// NOTE: Edges meeting on a corner get different colors, smooth contours use all channels (white)
+static int ColorMsdfContour(MsdfEdge *edges, int start, int end)
+{
+    MsdfEdge *contour = edges + start;
+    int count = end - start;
+    int cornerCount = 0;
+    int firstCorner = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 prev = MsdfNormalize(GetMsdfEdgeDirection(&contour[(i + count - 1)%count], 1.0f));
+        Vector2 next = MsdfNormalize(GetMsdfEdgeDirection(&contour[i], 0.0f));
+
+        if (IsMsdfCorner(prev, next))
+        {
+            if (cornerCount == 0) firstCorner = i;
+            cornerCount++;
+        }
+    }
+
+    if (cornerCount == 0)
+    {
+        for (int i = 0; i < count; i++) contour[i].color = 7;
+    }
+    else if (cornerCount == 1)
+    {
+        // Teardrop contour, three colors spread along contour
+        int colors[3] = { 6, 7, 5 };    // Cyan, White, Magenta
+
+        if (count >= 3)
+        {
+            for (int i = 0; i < count; i++) contour[(firstCorner + i)%count].color = colors[(int)(3.0f + 2.875f*i/(count - 1) - 1.4375f + 0.5f) - 2];
+        }
+        else
+        {
+            // Less than three edges for three colors, edges split in three parts
+            MsdfEdge parts[6] = { 0 };
+
+            SplitMsdfEdge(&contour[firstCorner], parts);
+
+            if (count == 2)
+            {
+                SplitMsdfEdge(&contour[1 - firstCorner], parts + 3);
+                for (int i = 0; i < 6; i++) parts[i].color = colors[i/2];
+                count = 6;
+            }
+            else
+            {
+                for (int i = 0; i < 3; i++) parts[i].color = colors[i];
+                count = 3;
+            }
+
+            for (int i = 0; i < count; i++) contour[i] = parts[i];
+        }
+    }
+    else
+    {
+        // Multiple corners, color switched on every corner
+        int spline = 0;
+        int color = GetMsdfNextColor(7, 0);
+        int initialColor = color;
+
+        for (int i = 0; i < count; i++)
+        {
+            int index = (firstCorner + i)%count;
+
+            if (i > 0)
+            {
+                Vector2 prev = MsdfNormalize(GetMsdfEdgeDirection(&contour[(index + count - 1)%count], 1.0f));
+                Vector2 next = MsdfNormalize(GetMsdfEdgeDirection(&contour[index], 0.0f));
+
+                if (IsMsdfCorner(prev, next))
+                {
+                    spline++;
+                    color = GetMsdfNextColor(color, (spline == (cornerCount - 1))? initialColor : 0);
+                }
+            }
+
+            contour[index].color = color;
+        }
+    }
+
+    return start + count;
+}
+
+// Add MSDF edge to shape, degenerated edges (no length) are skipped
+static void AddMsdfEdge(MsdfEdge *edges, int *edgeCount, int type, Vector2 p0, Vector2 p1, Vector2 p2)
+{
+    Vector2 end = (type == 1)? p1 : p2;
+
+    if ((p0.x == end.x) && (p0.y == end.y) && ((type == 1) || ((p1.x == p0.x) && (p1.y == p0.y)))) return;
+
+    edges[*edgeCount].type = type;
+    edges[*edgeCount].p[0] = p0;
+    edges[*edgeCount].p[1] = p1;
+    edges[*edgeCount].p[2] = p2;
+    edges[*edgeCount].color = 7;
+    (*edgeCount)++;
+}
+
+// Check MSDF texels clash, channels interpolation between texels producing artifacts
+static bool IsMsdfClash(const float *a, const float *b, float threshold)
+{
+    // Sort channels so pairs (a0, b0), (a1, b1), (a2, b2) go from biggest to smallest absolute difference
+    float a0 = a[0], a1 = a[1], a2 = a[2];
+    float b0 = b[0], b1 = b[1], b2 = b[2];
+    float tmp = 0.0f;
+
+    if (fabsf(b0 - a0) < fabsf(b1 - a1))
+    {
+        tmp = a0; a0 = a1; a1 = tmp;
+        tmp = b0; b0 = b1; b1 = tmp;
+    }
+
+    if (fabsf(b1 - a1) < fabsf(b2 - a2))
+    {
+        tmp = a1; a1 = a2; a2 = tmp;
+        tmp = b1; b1 = b2; b2 = tmp;
+
+        if (fabsf(b0 - a0) < fabsf(b1 - a1))
+        {
+            tmp = a0; a0 = a1; a1 = tmp;
+            tmp = b0; b0 = b1; b1 = tmp;
+        }
+    }
+
+    return (fabsf(b1 - a1) >= threshold) && !((b0 == b1) && (b0 == b2)) && (fabsf(a2 - 0.5f) >= fabsf(b2 - 0.5f));
+}
+
+// Generate glyph multi-channel signed distance field (RGB) for codepoint, returns NULL for glyphs without shape
+// NOTE: Contours edges are colored on corners, every channel stores distance to its nearest edges (pseudo-distance)
+// so median of channels keeps corners sharp on interpolation, texels with median out of true distance side and
+// clashing texels are corrected, distance range mapped to [0..255] with 127.5 on glyph edge
+static unsigned char *GenGlyphMsdf(const stbtt_fontinfo *fontInfo, int codepoint, float scale, int padding, float range, int *width, int *height, int *offsetX, int *offsetY)
+{
+    unsigned char *data = NULL;
+
+    *width = 0;
+    *height = 0;
+    *offsetX = 0;
+    *offsetY = 0;
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetCodepointShape(fontInfo, codepoint, &vertices);
+    stbtt_GetCodepointBitmapBox(fontInfo, codepoint, scale, scale, &x0, &y0, &x1, &y1);
+
+    if ((vertexCount <= 0) || (x1 <= x0) || (y1 <= y0))
+    {
+        stbtt_FreeShape(fontInfo, vertices);
+        return NULL;
+    }
+
+    // Glyph shape edges in bitmap pixels space (Y down), cubic curves approximated by quadratic curves
+    // NOTE: Every vertex generates up to 4 edges (cubic curves) and contours split add up to 4 edges
+    MsdfEdge *edges = (MsdfEdge *)GlyphScratchAlloc((size_t)(8*vertexCount + 8)*sizeof(MsdfEdge));
+    int edgeCount = 0;
+    int contourStart = 0;
+    Vector2 start = { 0 };
+    Vector2 current = { 0 };
+
+    for (int i = 0; i <= vertexCount; i++)
+    {
+        if ((i == vertexCount) || (vertices[i].type == STBTT_vmove))
+        {
+            // Close previous contour and color its edges
+            if (edgeCount > contourStart)
+            {
+                AddMsdfEdge(edges, &edgeCount, 1, current, start, start);
+                if (edgeCount > contourStart) edgeCount = ColorMsdfContour(edges, contourStart, edgeCount);
+            }
+
+            if (i == vertexCount) break;
+
+            start = (Vector2){ vertices[i].x*scale, -vertices[i].y*scale };
+            current = start;
+            contourStart = edgeCount;
+            continue;
+        }
+
+        Vector2 point = { vertices[i].x*scale, -vertices[i].y*scale };
+        Vector2 control = { vertices[i].cx*scale, -vertices[i].cy*scale };
+
+        if (vertices[i].type == STBTT_vline) AddMsdfEdge(edges, &edgeCount, 1, current, point, point);
+        else if (vertices[i].type == STBTT_vcurve) AddMsdfEdge(edges, &edgeCount, 2, current, control, point);
+        else if (vertices[i].type == STBTT_vcubic)
+        {
+            // Cubic curve split in 4 parts, every part approximated by quadratic curve
+            Vector2 control1 = { vertices[i].cx1*scale, -vertices[i].cy1*scale };
+
+            for (int k = 0; k < 4; k++)
+            {
+                Vector2 c[4] = { 0 };
+                float ta = k/4.0f, tb = (k + 1)/4.0f;
+
+                for (int j = 0; j < 2; j++)
+                {
+                    float t = (j == 0)? ta : tb;
+                    float it = 1.0f - t;
+                    c[3*j].x = it*it*it*current.x + 3.0f*it*it*t*control.x + 3.0f*it*t*t*control1.x + t*t*t*point.x;
+                    c[3*j].y = it*it*it*current.y + 3.0f*it*it*t*control.y + 3.0f*it*t*t*control1.y + t*t*t*point.y;
+                }
+
+                // Part inner control points from curve derivatives at part end points
+                for (int j = 0; j < 2; j++)
+                {
+                    float t = (j == 0)? ta : tb;
+                    float it = 1.0f - t;
+                    float dx = 3.0f*(it*it*(control.x - current.x) + 2.0f*it*t*(control1.x - control.x) + t*t*(point.x - control1.x))*(tb - ta)/3.0f;
+                    float dy = 3.0f*(it*it*(control.y - current.y) + 2.0f*it*t*(control1.y - control.y) + t*t*(point.y - control1.y))*(tb - ta)/3.0f;
+                    c[1 + j] = (j == 0)? (Vector2){ c[0].x + dx, c[0].y + dy } : (Vector2){ c[3].x - dx, c[3].y - dy };
+                }
+
+                Vector2 quadControl = { (3.0f*(c[1].x + c[2].x) - c[0].x - c[3].x)/4.0f, (3.0f*(c[1].y + c[2].y) - c[0].y - c[3].y)/4.0f };
+                AddMsdfEdge(edges, &edgeCount, 2, c[0], quadControl, c[3]);
+            }
+        }
+
+        current = point;
+    }
+
+    stbtt_FreeShape(fontInfo, vertices);
+
+    // Shape orientation from contours signed area, distances sign fixed to be positive inside glyph
+    float area = 0.0f;
+    for (int i = 0; i < edgeCount; i++)
+    {
+        const Vector2 *p = edges[i].p;
+        if (edges[i].type == 1) area += p[0].x*p[1].y - p[1].x*p[0].y;
+        else area += (p[0].x*p[1].y - p[1].x*p[0].y) + (p[1].x*p[2].y - p[2].x*p[1].y);
+    }
+
+    float sign = (area > 0.0f)? -1.0f : 1.0f;
+
+    int w = x1 - x0 + 2*padding;
+    int h = y1 - y0 + 2*padding;
+    float *field = (float *)GlyphScratchAlloc((size_t)w*h*3*sizeof(float));
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            Vector2 p = { x0 - padding + x + 0.5f, y0 - padding + y + 0.5f };
+            MsdfDistance trueDistance = { 1e30f, 1.0f };
+            MsdfDistance channelDistance[3] = { { 1e30f, 1.0f }, { 1e30f, 1.0f }, { 1e30f, 1.0f } };
+            float channelParam[3] = { 0 };
+            int channelEdge[3] = { -1, -1, -1 };
+
+            for (int e = 0; e < edgeCount; e++)
+            {
+                float param = 0.0f;
+                MsdfDistance distance = GetMsdfEdgeDistance(&edges[e], p, &param);
+
+                if (MsdfDistanceLess(distance, trueDistance)) trueDistance = distance;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    if ((edges[e].color & (1 << c)) && MsdfDistanceLess(distance, channelDistance[c]))
+                    {
+                        channelDistance[c] = distance;
+                        channelParam[c] = param;
+                        channelEdge[c] = e;
+                    }
+                }
+            }
+
+            float *texel = &field[(y*w + x)*3];
+            float value = sign*trueDistance.distance/range + 0.5f;
+
+            for (int c = 0; c < 3; c++)
+            {
+                if (channelEdge[c] >= 0) texel[c] = sign*GetMsdfEdgePseudoDistance(&edges[channelEdge[c]], channelDistance[c], p, channelParam[c])/range + 0.5f;
+                else texel[c] = value;
+            }
+
+            // Median on wrong side of glyph edge, true distance used
+            float median = fmaxf(fminf(texel[0], texel[1]), fminf(fmaxf(texel[0], texel[1]), texel[2]));
+            if ((median - 0.5f)*(value - 0.5f) < 0.0f) texel[0] = texel[1] = texel[2] = value;
+        }
+    }
+
+    // Clashing texels (with neighbours) get median value on all channels
+    float threshold = 1.001f/range;
+    unsigned char *clash = (unsigned char *)GlyphScratchAlloc((size_t)w*h);
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const float *texel = &field[(y*w + x)*3];
+
+            clash[y*w + x] = ((x > 0) && IsMsdfClash(texel, texel - 3, threshold)) ||
+                             ((x < (w - 1)) && IsMsdfClash(texel, texel + 3, threshold)) ||
+                             ((y > 0) && IsMsdfClash(texel, texel - 3*w, threshold)) ||
+                             ((y < (h - 1)) && IsMsdfClash(texel, texel + 3*w, threshold));
+        }
+    }
+
+    data = (unsigned char *)RL_MALLOC(w*h*3);
+
+    for (int i = 0; i < w*h; i++)
+    {
+        float *texel = &field[i*3];
+
+        if (clash[i]) texel[0] = texel[1] = texel[2] = fmaxf(fminf(texel[0], texel[1]), fminf(fmaxf(texel[0], texel[1]), texel[2]));
+
+        for (int c = 0; c < 3; c++)
+        {
+            float value = texel[c]*255.0f + 0.5f;
+            data[i*3 + c] = (value < 0.0f)? 0 : ((value > 255.0f)? 255 : (unsigned char)value);
+        }
+    }
+
+    GlyphScratchFree(clash);
+    GlyphScratchFree(field);
+    GlyphScratchFree(edges);
+
+    *width = w;
+    *height = h;
+    *offsetX = x0 - padding;
+    *offsetY = y0 - padding;
+
+    return data;
+}
+
+// Load font MSDF shader, shared by all MSDF fonts (users counted)
+// NOTE: Default vertex shader is used, glyph coverage from channels median and screen pixels range
+static void LoadFontMsdfShader(void)
+{
+    // Fragment shader directly defined, no external file required
+    const char *fontMsdfShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "#define TEXTURE texture            \n"
+    "#define FINAL_COLOR finalColor     \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform float pixelRange;          \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 msd = TEXTURE(texture0, fragTexCoord).rgb; \n"
+    "    float sd = max(min(msd.r, msd.g), min(max(msd.r, msd.g), msd.b)); \n"
+    "    float alpha = clamp(max(pixelRange, 1.0)*(sd - 0.5) + 0.5, 0.0, 1.0); \n"
+    "    FINAL_COLOR = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "}                                  \n";
+
+    if (fontMsdfShaderUsers == 0)
+    {
+        fontMsdfShader = LoadShaderFromMemory(NULL, fontMsdfShaderCode);
+        fontMsdfShaderRangeLoc = GetShaderLocation(fontMsdfShader, "pixelRange");
+    }
+
+    fontMsdfShaderUsers++;
+}
+
+// Unload font MSDF shader, when no MSDF fonts left
+static void UnloadFontMsdfShader(void)
+{
+    if (fontMsdfShaderUsers > 0)
+    {
+        fontMsdfShaderUsers--;
+
+        if (fontMsdfShaderUsers == 0)
+        {
+            UnloadShader(fontMsdfShader);
+            fontMsdfShader = (Shader){ 0 };
+            fontMsdfShaderRangeLoc = -1;
+        }
+    }
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load text layout instancing shader and glyph quad vertex data, shared by instanced layouts (users counted)
+// NOTE: Glyphs quads are expanded by vertex shader from instances data, returns false if not available
+static bool LoadTextLayoutShader(void)
+{
+    if (textLayoutShaderFailed) return false;
+    if (textLayoutShaderUsers > 0)
+    {
+        textLayoutShaderUsers++;
+        return true;
+    }
+
+    textLayoutShaderFailed = true;
+    if (!rlIsInstancingSupported()) return false;
+
+    const char *textLayoutVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRec;        \n"
+    "attribute vec4 instanceSource;     \n"
+    "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instanceRec;               \n"
+    "in vec4 instanceSource;            \n"
+    "out vec2 fragTexCoord;             \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRec;        \n"
+    "attribute vec4 instanceSource;     \n"
+    "varying vec2 fragTexCoord;         \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = mix(instanceSource.xy, instanceSource.zw, vertexPosition); \n"
+    "    gl_Position = mvp*vec4(instanceRec.xy + vertexPosition*instanceRec.zw, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *textLayoutFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#endif
 
-// Get lower case version of provided string
-// REQUIRES: tolower()
-const char *TextToLower(const char *text)
-{
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(textLayoutVShaderCode, textLayoutFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
 
-    if (text != NULL)
+    textLayoutShaderLocs[0] = rlGetLocationAttrib(shader.id, "instanceRec");
+    textLayoutShaderLocs[1] = rlGetLocationAttrib(shader.id, "instanceSource");
+
+    bool ready = (shader.locs[SHADER_LOC_VERTEX_POSITION] != -1) && (shader.locs[SHADER_LOC_MATRIX_MVP] != -1) && (shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1);
+    for (int i = 0; i < 2; i++) if (textLayoutShaderLocs[i] == -1) ready = false;
+
+    if (!ready)
+    {
+        UnloadShader(shader);
+        return false;
+    }
+
+    // Quad corners, two triangles: top-left, bottom-left, bottom-right and top-left, bottom-right, top-right
+    // NOTE: Same vertex order than render batch quads (faces culling)
+    const float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+    textLayoutVaoId = rlLoadVertexArray();
+    rlEnableVertexArray(textLayoutVaoId);
+    textLayoutVboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    textLayoutShader = shader;
+    textLayoutShaderFailed = false;
+    textLayoutShaderUsers = 1;
+
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Text layout instancing shader loaded successfully", textLayoutShader.id);
+
+    return true;
+}
+
+// Unload text layout instancing shader and glyph quad vertex data, when no instanced layouts left
+static void UnloadTextLayoutShader(void)
+{
+    if (textLayoutShaderUsers > 0)
     {
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        textLayoutShaderUsers--;
+
+        if (textLayoutShaderUsers == 0)
         {
-            if (text[i] != '\0')
-            {
-                buffer[i] = (char)tolower(text[i]);
-                //if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
-            }
-            else { buffer[i] = '\0'; break; }
+            UnloadShader(textLayoutShader);
+            rlUnloadVertexArray(textLayoutVaoId);
+            rlUnloadVertexBuffer(textLayoutVboId);
+
+            textLayoutShader = (Shader){ 0 };
+            textLayoutVaoId = 0;
+            textLayoutVboId = 0;
         }
     }
-
-    return buffer;
 }
+#endif
 
-// Get Pascal case notation version of provided string
-// REQUIRES: toupper()
-const char *TextToPascal(const char *text)
+// Decode font async load glyphs and atlas image (loader thread)
+// NOTE: Same generation parameters than LoadFont()
+static void DecodeFontAsync(void *data)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    FontAsyncLoad *load = (FontAsyncLoad *)data;
 
-    if (text != NULL)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (IsFileExtension(load->fileName, ".ttf") || IsFileExtension(load->fileName, ".otf"))
     {
-        buffer[0] = (char)toupper(text[0]);
+        unsigned int dataSize = 0;
+        unsigned char *fileData = LoadFileDataMapped(load->fileName, &dataSize);
 
-        for (int i = 1, j = 1; i < MAX_TEXT_BUFFER_LENGTH; i++, j++)
+        if (fileData != NULL)
         {
-            if (text[j] != '\0')
+            load->font.baseSize = FONT_TTF_DEFAULT_SIZE;
+            load->font.glyphCount = FONT_TTF_DEFAULT_NUMCHARS;
+            load->font.glyphs = LoadFontData(fileData, dataSize, load->font.baseSize, NULL, load->font.glyphCount, FONT_DEFAULT);
+
+            if (load->font.glyphs != NULL)
             {
-                if (text[j] != '_') buffer[i] = text[j];
-                else
+                load->font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+                load->image = GenImageFontAtlas(load->font.glyphs, &load->font.recs, load->font.glyphCount, load->font.baseSize, load->font.glyphPadding, 0);
+
+                // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
+                for (int i = 0; i < load->font.glyphCount; i++)
                 {
-                    j++;
-                    buffer[i] = (char)toupper(text[j]);
+                    UnloadImage(load->font.glyphs[i].image);
+                    load->font.glyphs[i].image = ImageFromImage(load->image, load->font.recs[i]);
                 }
+
+                // Glyphs lookup and kerning loaded on loader thread, font data is available
+                load->font.glyphLookup = LoadGlyphLookup(load->font.glyphs, load->font.glyphCount);
+                LoadFontKerning(load->font.glyphLookup, fileData, load->font.baseSize);
             }
-            else { buffer[i] = '\0'; break; }
+
+            UnloadFileDataMapped(fileData);
         }
     }
-
-    return buffer;
+    else
+#endif
+#if defined(SUPPORT_FILEFORMAT_FNT)
+    if (IsFileExtension(load->fileName, ".fnt")) return;    // BMFont loads its texture while parsing, loaded on main thread
+    else
+#endif
+    {
+        load->image = LoadImage(load->fileName);
+    }
 }
 
-// Encode text codepoint into UTF-8 text
-// REQUIRES: memcpy()
-// WARNING: Allocated memory must be manually freed
-char *LoadUTF8(const int *codepoints, int length)
+// Finalize font async load, atlas uploaded to GPU (main thread)
+static void FinalizeFontAsync(void *data)
 {
-    // We allocate enough memory fo fit all possible codepoints
-    // NOTE: 5 bytes for every codepoint should be enough
-    char *text = (char *)RL_CALLOC(length*5, 1);
-    const char *utf8 = NULL;
-    int size = 0;
+    FontAsyncLoad *load = (FontAsyncLoad *)data;
 
-    for (int i = 0, bytes = 0; i < length; i++)
+    if (load->font.glyphs != NULL)
     {
-        utf8 = CodepointToUTF8(codepoints[i], &bytes);
-        memcpy(text + size, utf8, bytes);
-        size += bytes;
-    }
-
-    // Resize memory to text length + string NULL terminator
-    void *ptr = RL_REALLOC(text, size + 1);
-
-    if (ptr != NULL) text = (char *)ptr;
+        load->font.texture = LoadTextureFromImage(load->image);     // TTF glyphs atlas
+        UnloadImage(load->image);
 
-    return text;
-}
+        if (load->font.texture.id == 0)
+        {
+            UnloadFont(load->font);
+            load->font = (Font){ 0 };
+        }
+        else if (load->font.glyphLookup == NULL) load->font.glyphLookup = LoadGlyphLookup(load->font.glyphs, load->font.glyphCount);
+    }
+    else if (load->image.data != NULL)
+    {
+        load->font = LoadFontFromImage(load->image, MAGENTA, FONT_TTF_DEFAULT_FIRST_CHAR);
+        UnloadImage(load->image);
+    }
+    else
+    {
+        load->font = LoadFont(load->fileName);      // BMFont or not decoded, LoadFont() provides fallback
+        return;
+    }
 
-// Unload UTF-8 text encoded from codepoints array
-void UnloadUTF8(char *text)
-{
-    RL_FREE(text);
+    if (load->font.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture -> Using default font", load->fileName);
+        load->font = GetFontDefault();
+    }
+    else
+    {
+        SetTextureFilter(load->font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+        TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", load->fileName, load->font.glyphCount);
+    }
 }
 
-// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-int *LoadCodepoints(const char *text, int *count)
+// Load glyphs lookup for codepoints
+// NOTE: First glyph is kept for repeated codepoints (same result as linear search)
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
 {
-    int textLength = TextLength(text);
-
-    int codepointSize = 0;
-    int codepointCount = 0;
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
 
-    // Allocate a big enough buffer to store as many codepoints as text bytes
-    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+    // Count hashed codepoints to size hash table (load factor <= 0.5)
+    int hashedCount = 0;
+    for (int i = 0; i < glyphCount; i++) if ((glyphs[i].value < 0) || (glyphs[i].value >= GLYPH_LOOKUP_DIRECT_SIZE)) hashedCount++;
 
-    for (int i = 0; i < textLength; codepointCount++)
+    int capacity = 0;
+    if (hashedCount > 0)
     {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
+        capacity = 16;
+        while (capacity < hashedCount*2) capacity *= 2;
     }
 
-    // Re-allocate buffer to the actual number of codepoints loaded
-    int *temp = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
-    if (temp != NULL) codepoints = temp;
+    // NOTE: Lookup and hash table are allocated in a single memory block
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_MALLOC(sizeof(rGlyphLookup) + (size_t)capacity*2*sizeof(int));
 
-    *count = codepointCount;
+    lookup->glyphs = glyphs;
+    lookup->glyphCount = glyphCount;
+    lookup->capacity = capacity;
+    lookup->keys = (capacity > 0)? (int *)(lookup + 1) : NULL;
+    lookup->values = (capacity > 0)? lookup->keys + capacity : NULL;
 
-    return codepoints;
-}
+    lookup->dynamic = NULL;
+    lookup->fontType = FONT_DEFAULT;
+    lookup->kerningCapacity = 0;
+    lookup->kerningKeys = NULL;
+    lookup->kerningValues = NULL;
 
-// Unload codepoints data from memory
-void UnloadCodepoints(int *codepoints)
-{
-    RL_FREE(codepoints);
+    for (int i = 0; i < GLYPH_LOOKUP_DIRECT_SIZE; i++) lookup->direct[i] = -1;
+    for (int i = 0; i < capacity; i++) lookup->keys[i] = -1;
+
+    for (int i = 0; i < glyphCount; i++) AddGlyphLookupIndex(lookup, glyphs[i].value, i);
+
+    return lookup;
 }
 
-// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
-// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
-int GetCodepointCount(const char *text)
+// Unload glyphs lookup
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
 {
-    unsigned int length = 0;
-    char *ptr = (char *)&text[0];
+    if (lookup == NULL) return;
 
-    while (*ptr != '\0')
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (lookup->dynamic != NULL)
     {
-        int next = 0;
-        int letter = GetCodepointNext(ptr, &next);
-
-        if (letter == 0x3f) ptr += 1;
-        else ptr += next;
-
-        length++;
+        RL_FREE(lookup->dynamic->fileData);
+        RL_FREE(lookup->dynamic->lastUse);
+        UnloadImage(lookup->dynamic->atlas);
+        RL_FREE(lookup->dynamic);
     }
+#endif
 
-    return length;
+    RL_FREE(lookup->kerningKeys);       // NOTE: Kerning keys and values allocated in a single memory block
+    RL_FREE(lookup);
 }
 
-// Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
-const char *CodepointToUTF8(int codepoint, int *utf8Size)
+// Get glyph index from lookup (-1: not found)
+static int GetGlyphLookupIndex(const rGlyphLookup *lookup, int codepoint)
 {
-    static char utf8[6] = { 0 };
-    int size = 0;   // Byte size of codepoint
+    int index = -1;
 
-    if (codepoint <= 0x7f)
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE)) index = lookup->direct[codepoint];
+    else if ((lookup->capacity > 0) && (codepoint != -1))
     {
-        utf8[0] = (char)codepoint;
-        size = 1;
+        unsigned int mask = (unsigned int)lookup->capacity - 1;
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+        while (lookup->keys[slot] != -1)
+        {
+            if (lookup->keys[slot] == codepoint) { index = lookup->values[slot]; break; }
+            slot = (slot + 1) & mask;
+        }
     }
-    else if (codepoint <= 0x7ff)
+
+    return index;
+}
+
+// Add codepoint glyph index to lookup
+// NOTE: Index is not replaced if codepoint is already available (first glyph kept), -1 codepoint is ignored
+static void AddGlyphLookupIndex(rGlyphLookup *lookup, int codepoint, int index)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE))
     {
-        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
-        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
-        size = 2;
+        if (lookup->direct[codepoint] == -1) lookup->direct[codepoint] = index;
     }
-    else if (codepoint <= 0xffff)
+    else if ((lookup->capacity > 0) && (codepoint != -1))
     {
-        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
-        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
-        size = 3;
+        unsigned int mask = (unsigned int)lookup->capacity - 1;
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+        while ((lookup->keys[slot] != -1) && (lookup->keys[slot] != codepoint)) slot = (slot + 1) & mask;
+
+        if (lookup->keys[slot] == -1)
+        {
+            lookup->keys[slot] = codepoint;
+            lookup->values[slot] = index;
+        }
     }
-    else if (codepoint <= 0x10ffff)
+}
+
+// Remove codepoint from lookup
+// NOTE: Hash table entries following removed one are shifted back (linear probing, no tombstones)
+static void RemoveGlyphLookupIndex(rGlyphLookup *lookup, int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE)) lookup->direct[codepoint] = -1;
+    else if ((lookup->capacity > 0) && (codepoint != -1))
     {
-        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
-        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
-        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
-        size = 4;
-    }
+        unsigned int mask = (unsigned int)lookup->capacity - 1;
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
 
-    *utf8Size = size;
+        while ((lookup->keys[slot] != -1) && (lookup->keys[slot] != codepoint)) slot = (slot + 1) & mask;
 
-    return utf8;
+        if (lookup->keys[slot] == -1) return;
+
+        // Shift back following entries which home slot is not between empty slot and their position
+        unsigned int empty = slot;
+
+        for (unsigned int next = (slot + 1) & mask; lookup->keys[next] != -1; next = (next + 1) & mask)
+        {
+            unsigned int home = ((unsigned int)lookup->keys[next]*2654435761u) & mask;
+
+            if (((next - home) & mask) >= ((next - empty) & mask))
+            {
+                lookup->keys[empty] = lookup->keys[next];
+                lookup->values[empty] = lookup->values[next];
+                empty = next;
+            }
+        }
+
+        lookup->keys[empty] = -1;
+    }
 }
-#endif      // SUPPORT_TEXT_MANIPULATION
 
-// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
-// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
-// Total number of bytes processed are returned as a parameter
-// NOTE: The standard says U+FFFD should be returned in case of errors
-// but that character is not supported by the default font in raylib
-int GetCodepoint(const char *text, int *codepointSize)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font kerning pairs into glyphs lookup, kerning scaled to font size pixels
+// NOTE: GPOS pair adjustments are searched for every glyphs pair (fonts up to FONT_KERNING_MAX_GLYPHS glyphs),
+// otherwise kern table pairs are used, only pairs with kerning are stored
+static void LoadFontKerning(rGlyphLookup *lookup, const unsigned char *fileData, int fontSize)
 {
-/*
-    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+#if defined(SUPPORT_FONT_KERNING)
+    stbtt_fontinfo fontInfo = { 0 };
 
-    Char. number range  |        UTF-8 octet sequence
-      (hexadecimal)    |              (binary)
-    --------------------+---------------------------------------------
-    0000 0000-0000 007F | 0xxxxxxx
-    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
-    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
-    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-*/
-    // NOTE: on decode errors we return as soon as possible
+    if ((lookup == NULL) || (fileData == NULL) || (lookup->glyphCount > 0xffff)) return;
+    if (!stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0) || ((fontInfo.gpos == 0) && (fontInfo.kern == 0))) return;
 
-    int codepoint = 0x3f;   // Codepoint (defaults to '?')
-    int octet = (unsigned char)(text[0]); // The first UTF8 octet
-    *codepointSize = 1;
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+    int glyphCount = lookup->glyphCount;
+    int *glyphIds = (int *)RL_MALLOC(glyphCount*sizeof(int));
 
-    if (octet <= 0x7f)
+    for (int i = 0; i < glyphCount; i++) glyphIds[i] = stbtt_FindGlyphIndex(&fontInfo, lookup->glyphs[i].value);
+
+    int pairCount = 0;
+    int pairCapacity = 256;
+    unsigned int *pairKeys = (unsigned int *)RL_MALLOC(pairCapacity*sizeof(unsigned int));
+    float *pairValues = (float *)RL_MALLOC(pairCapacity*sizeof(float));
+
+    if ((fontInfo.gpos != 0) && (glyphCount <= FONT_KERNING_MAX_GLYPHS))
     {
-        // Only one octet (ASCII range x00-7F)
-        codepoint = text[0];
+        for (int i = 0; i < glyphCount; i++)
+        {
+            for (int j = 0; j < glyphCount; j++)
+            {
+                int kerning = stbtt_GetGlyphKernAdvance(&fontInfo, glyphIds[i], glyphIds[j]);
+                if (kerning == 0) continue;
+
+                if (pairCount == pairCapacity)
+                {
+                    pairCapacity *= 2;
+                    pairKeys = (unsigned int *)RL_REALLOC(pairKeys, pairCapacity*sizeof(unsigned int));
+                    pairValues = (float *)RL_REALLOC(pairValues, pairCapacity*sizeof(float));
+                }
+
+                pairKeys[pairCount] = ((unsigned int)i << 16) | (unsigned int)j;
+                pairValues[pairCount] = (float)kerning*scaleFactor;
+                pairCount++;
+            }
+        }
     }
-    else if ((octet & 0xe0) == 0xc0)
+    else if (fontInfo.kern != 0)
     {
-        // Two octets
+        // Font glyphs ids mapped to glyphs index (first index kept)
+        int *glyphIndex = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) glyphIndex[i] = -1;
+        for (int i = glyphCount - 1; i >= 0; i--) if ((glyphIds[i] >= 0) && (glyphIds[i] < fontInfo.numGlyphs)) glyphIndex[glyphIds[i]] = i;
 
-        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
-        unsigned char octet1 = text[1];
+        int entryCount = stbtt_GetKerningTableLength(&fontInfo);
+        stbtt_kerningentry *entries = (stbtt_kerningentry *)RL_MALLOC((entryCount + 1)*sizeof(stbtt_kerningentry));
+        entryCount = stbtt_GetKerningTable(&fontInfo, entries, entryCount);
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+        for (int k = 0; k < entryCount; k++)
+        {
+            // NOTE: kern table entries are glyph ids, codepoints not loaded are skipped
+            int i = ((entries[k].glyph1 >= 0) && (entries[k].glyph1 < fontInfo.numGlyphs))? glyphIndex[entries[k].glyph1] : -1;
+            int j = ((entries[k].glyph2 >= 0) && (entries[k].glyph2 < fontInfo.numGlyphs))? glyphIndex[entries[k].glyph2] : -1;
+            if ((i < 0) || (j < 0) || (entries[k].advance == 0)) continue;
 
-        if ((octet >= 0xc2) && (octet <= 0xdf))
+            if (pairCount == pairCapacity)
+            {
+                pairCapacity *= 2;
+                pairKeys = (unsigned int *)RL_REALLOC(pairKeys, pairCapacity*sizeof(unsigned int));
+                pairValues = (float *)RL_REALLOC(pairValues, pairCapacity*sizeof(float));
+            }
+
+            pairKeys[pairCount] = ((unsigned int)i << 16) | (unsigned int)j;
+            pairValues[pairCount] = (float)entries[k].advance*scaleFactor;
+            pairCount++;
+        }
+
+        RL_FREE(entries);
+        RL_FREE(glyphIndex);
+    }
+
+    if (pairCount > 0)
+    {
+        int capacity = 16;
+        while (capacity < pairCount*2) capacity *= 2;
+
+        // NOTE: Kerning keys and values are allocated in a single memory block
+        lookup->kerningKeys = (unsigned int *)RL_MALLOC((size_t)capacity*(sizeof(unsigned int) + sizeof(float)));
+        lookup->kerningValues = (float *)(lookup->kerningKeys + capacity);
+        lookup->kerningCapacity = capacity;
+
+        for (int i = 0; i < capacity; i++) lookup->kerningKeys[i] = 0xffffffff;
+
+        for (int i = 0; i < pairCount; i++)
         {
-            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
-            *codepointSize = 2;
+            unsigned int mask = (unsigned int)capacity - 1;
+            unsigned int slot = (pairKeys[i]*2654435761u) & mask;
+
+            while ((lookup->kerningKeys[slot] != 0xffffffff) && (lookup->kerningKeys[slot] != pairKeys[i])) slot = (slot + 1) & mask;
+
+            lookup->kerningKeys[slot] = pairKeys[i];
+            lookup->kerningValues[slot] = pairValues[i];
         }
+
+        TRACELOGD("FONT: Kerning pairs loaded successfully (%i pairs)", pairCount);
     }
-    else if ((octet & 0xf0) == 0xe0)
+
+    RL_FREE(pairKeys);
+    RL_FREE(pairValues);
+    RL_FREE(glyphIds);
+#endif
+}
+#endif
+
+// Get glyphs pair kerning by index, advance adjustment in pixels at font base size
+// NOTE: Dynamic fonts kerning is read from font data, glyphs slots change on eviction
+static float GetGlyphKerningIndex(Font font, int index, int nextIndex)
+{
+    float kerning = 0.0f;
+
+#if defined(SUPPORT_FONT_KERNING)
+    const rGlyphLookup *lookup = font.glyphLookup;
+
+    // Kerning pairs reference glyphs index, not valid if font glyphs were replaced by user
+    if ((lookup == NULL) || (lookup->glyphs != font.glyphs) || (lookup->glyphCount != font.glyphCount)) return kerning;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (lookup->dynamic != NULL)
     {
-        // Three octets
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
+        kerning = (float)stbtt_GetCodepointKernAdvance(&lookup->dynamic->fontInfo, font.glyphs[index].value, font.glyphs[nextIndex].value)*lookup->dynamic->scaleFactor;
+    }
+    else
+#endif
+    kerning = GetGlyphLookupKerning(lookup, index, nextIndex);
+#endif
+
+    return kerning;
+}
+
+// Get glyphs pair kerning from lookup kerning pairs (pixels at font base size)
+static float GetGlyphLookupKerning(const rGlyphLookup *lookup, int index, int nextIndex)
+{
+    float kerning = 0.0f;
+
+    if (lookup->kerningCapacity > 0)
+    {
+        unsigned int key = ((unsigned int)index << 16) | (unsigned int)nextIndex;
+        unsigned int mask = (unsigned int)lookup->kerningCapacity - 1;
+        unsigned int slot = (key*2654435761u) & mask;
+
+        while (lookup->kerningKeys[slot] != 0xffffffff)
+        {
+            if (lookup->kerningKeys[slot] == key)
+            {
+                kerning = lookup->kerningValues[slot];
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+    }
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+    return kerning;
+}
 
-        octet2 = text[2];
+// Get text shaped run from cache, text shaped on cache miss (least recently used run replaced)
+// NOTE: Only fonts with kerning pairs are cached (dynamic fonts glyphs change), returns NULL if text is not cached,
+// glyphs positions are computed same way than DrawTextEx() (same results than not cached drawing)
+static const TextRun *GetTextRun(Font font, const char *text, int size, float fontSize, float spacing)
+{
+    const rGlyphLookup *lookup = font.glyphLookup;
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+    if ((lookup == NULL) || (lookup->kerningCapacity == 0) || (lookup->dynamic != NULL) ||
+        (lookup->glyphs != font.glyphs) || (lookup->glyphCount != font.glyphCount) || (size == 0) || (size > TEXT_RUN_MAX_LENGTH)) return NULL;
 
-        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
-        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
-        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
-        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+    // Text hash (FNV-1a)
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < size; i++) hash = (hash ^ (unsigned char)text[i])*16777619u;
 
-        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
-            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+    TextRun *run = &textRuns[0];
 
-        if ((octet >= 0xe0) && (octet <= 0xef))
-        {
-            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
-            *codepointSize = 3;
-        }
-    }
-    else if ((octet & 0xf8) == 0xf0)
+    for (int i = 0; i < TEXT_RUNS_CACHE_SIZE; i++)
     {
-        // Four octets
-        if (octet > 0xf4) return codepoint;
+        TextRun *cached = &textRuns[i];
 
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-        unsigned char octet3 = '\0';
+        if ((cached->lookup == lookup) && (cached->hash == hash) && (cached->length == size) &&
+            (cached->fontSize == fontSize) && (cached->spacing == spacing) && (memcmp(cached->text, text, size) == 0))
+        {
+            cached->lastUse = ++textRunsUseCounter;
+            return cached;
+        }
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+        // Replaced run: first run not in use or least recently used
+        if ((run->lookup != NULL) && ((cached->lookup == NULL) || (cached->lastUse < run->lastUse))) run = cached;
+    }
 
-        octet2 = text[2];
+    // Run memory: positions, glyphs index and text copy, allocated in a single memory block
+    // NOTE: Glyphs count is up to text size (one byte codepoints)
+    RL_FREE(run->positions);
+    run->positions = (Vector2 *)RL_MALLOC(size*sizeof(Vector2) + size*sizeof(int) + size + 1);
+    run->indices = (int *)(run->positions + size);
+    run->text = (char *)(run->indices + size);
+    memcpy(run->text, text, size);
+    run->text[size] = '\0';
+
+    run->lookup = lookup;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->hash = hash;
+    run->length = size;
+    run->glyphCount = 0;
+    run->lastUse = ++textRunsUseCounter;
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    float scaleFactor = fontSize/font.baseSize;
+    int prevIndex = -1;
 
-        octet3 = text[3];
+    for (int i = 0; i < size;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
 
-        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+        if (codepoint == 0x3f) codepointByteCount = 1;
 
-        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+        if (codepoint == '\n')
+        {
+            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
+            textOffsetX = 0.0f;
+            prevIndex = -1;
+        }
+        else
+        {
+            if (prevIndex >= 0) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+            prevIndex = index;
 
-        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
-            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                run->indices[run->glyphCount] = index;
+                run->positions[run->glyphCount] = (Vector2){ textOffsetX, (float)textOffsetY };
+                run->glyphCount++;
+            }
 
-        if (octet >= 0xf0)
-        {
-            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
-            *codepointSize = 4;
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
-    }
 
-    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+        i += codepointByteCount;
+    }
 
-    return codepoint;
+    return run;
 }
 
-// Get next codepoint in a byte sequence and bytes processed
-int GetCodepointNext(const char *text, int *codepointSize)
+// Unload text shaped runs of font lookup (NULL: all runs)
+static void UnloadTextRuns(const rGlyphLookup *lookup)
 {
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    *codepointSize = 0;
-
-    // Get current codepoint and bytes processed
-    if (0xf0 == (0xf8 & ptr[0]))
-    {
-        // 4 byte UTF-8 codepoint
-        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
-        *codepointSize = 4;
-    }
-    else if (0xe0 == (0xf0 & ptr[0]))
+    for (int i = 0; i < TEXT_RUNS_CACHE_SIZE; i++)
     {
-        // 3 byte UTF-8 codepoint */
-        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
-        *codepointSize = 3;
+        if ((textRuns[i].positions != NULL) && ((lookup == NULL) || (textRuns[i].lookup == lookup)))
+        {
+            RL_FREE(textRuns[i].positions);     // NOTE: Run memory allocated in a single memory block
+            textRuns[i] = (TextRun){ 0 };
+        }
     }
-    else if (0xc0 == (0xe0 & ptr[0]))
+}
+
+// Get text line end byte for boxed drawing, next line start byte is returned
+// NOTE: Line measured with same advance and kerning than DrawTextEx(), spaces never overflow line,
+// words longer than line width are broken by characters, on TEXT_WRAP_NONE line ends on linebreak
+static int GetTextLineEnd(Font font, const char *text, int start, int size, float maxWidth, float fontSize, float spacing, int wrapMode, int *next)
+{
+    if ((wrapMode != TEXT_WRAP_CHAR) && (wrapMode != TEXT_WRAP_WORD))
     {
-        // 2 byte UTF-8 codepoint
-        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
-        *codepointSize = 2;
+        const char *lineBreak = (const char *)memchr(text + start, '\n', size - start);
+        int end = (lineBreak != NULL)? (int)(lineBreak - text) : size;
+
+        *next = (lineBreak != NULL)? end + 1 : size;
+        return end;
     }
-    else
+
+    float scaleFactor = fontSize/font.baseSize;
+    float textOffsetX = 0.0f;
+    int prevIndex = -1;
+    int wordEnd = -1;               // Last word end on line, preferred break point
+    bool prevSpace = false;
+
+    for (int i = start; i < size;)
     {
-        // 1 byte UTF-8 codepoint
-        codepoint = ptr[0];
-        *codepointSize = 1;
-    }
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        if (codepoint == 0x3f) codepointByteCount = 1;
 
-    return codepoint;
-}
+        if (codepoint == '\n')
+        {
+            *next = i + 1;
+            return i;
+        }
 
-// Get previous codepoint in a byte sequence and bytes processed
-int GetCodepointPrevious(const char *text, int *codepointSize)
-{
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    int cpSize = 0;
-    *codepointSize = 0;
+        int index = GetGlyphIndex(font, codepoint);
+        bool space = ((codepoint == ' ') || (codepoint == '\t'));
 
-    // Move to previous codepoint
-    do ptr--;
-    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+        if (prevIndex >= 0) textOffsetX += GetGlyphKerningIndex(font, prevIndex, index)*scaleFactor;
+        prevIndex = index;
 
-    codepoint = GetCodepointNext(ptr, &cpSize);
+        float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-    if (codepoint != 0) *codepointSize = cpSize;
+        if (space && !prevSpace) wordEnd = i;
+        else if (!space && ((textOffsetX + advance) > maxWidth) && (i > start))
+        {
+            if ((wrapMode == TEXT_WRAP_WORD) && (wordEnd > start))
+            {
+                // Next line starts on next word, spaces skipped
+                int wordStart = wordEnd;
+                while ((text[wordStart] == ' ') || (text[wordStart] == '\t')) wordStart++;
 
-    return codepoint;
-}
+                *next = wordStart;
+                return wordEnd;
+            }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_FNT)
+            *next = i;
+            return i;
+        }
 
-// Read a line from memory
-// REQUIRES: memcpy()
-// NOTE: Returns the number of bytes read
-static int GetLine(const char *origin, char *buffer, int maxLength)
-{
-    int count = 0;
-    for (; count < maxLength; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    return count;
+        prevSpace = space;
+        textOffsetX += (advance + spacing);
+        i += codepointByteCount;
+    }
+
+    *next = size;
+    return size;
 }
 
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static Font LoadBMFont(const char *fileName)
+// Clip text vertical drawing range to scissor mode area
+// NOTE: Only on 2d drawing (screen orthographic projection, no rotation), text Y mapped to screen Y
+static void ClipTextScissorArea(float *top, float *bottom)
 {
-    #define MAX_BUFFER_SIZE     256
+    Rectangle scissor = { 0 };
 
-    Font font = { 0 };
+    if (!GetScissorArea(&scissor)) return;
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    Matrix projection = rlGetMatrixProjection();
+    Matrix modelview = rlGetMatrixModelview();
+    Matrix transform = rlGetMatrixTransform();
 
-    int fontSize = 0;
-    int glyphCount = 0;
+    // Screen projection: rlOrtho(0, width, height, 0, ...), any render size
+    if ((projection.m15 != 1.0f) || (projection.m7 != 0.0f) || (projection.m1 != 0.0f) || (projection.m13 != 1.0f) || (projection.m5 >= 0.0f)) return;
+    if ((modelview.m1 != 0.0f) || (transform.m1 != 0.0f)) return;
 
-    int imWidth = 0;
-    int imHeight = 0;
-    char imFileName[129] = { 0 };
+    float scaleY = modelview.m5*transform.m5;
+    float offsetY = modelview.m5*transform.m13 + modelview.m13;
 
-    int base = 0;   // Useless data
+    if (scaleY == 0.0f) return;
 
-    char *fileText = LoadFileText(fileName);
+    float scissorTop = (scissor.y - offsetY)/scaleY;
+    float scissorBottom = (scissor.y + scissor.height - offsetY)/scaleY;
 
-    if (fileText == NULL) return font;
+    *top = fmaxf(*top, fminf(scissorTop, scissorBottom));
+    *bottom = fminf(*bottom, fmaxf(scissorTop, scissorBottom));
+}
 
-    char *fileTextPtr = fileText;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize dynamic font glyph into atlas, returns glyph index
+// NOTE: Codepoints not available in font use '?' glyph, returns -1 if it is also not available
+static int LoadFontDynamicGlyph(rGlyphLookup *lookup, int codepoint)
+{
+    FontDynamic *dynamic = lookup->dynamic;
 
-    // NOTE: We skip first line, it contains no useful information
-    int lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    fileTextPtr += (lineBytes + 1);
+    if (stbtt_FindGlyphIndex(&dynamic->fontInfo, codepoint) == 0)
+    {
+        if (codepoint == GLYPH_NOTFOUND_CHAR_FALLBACK) return -1;
 
-    // Read line data
-    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "lineHeight");
-    sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i", &fontSize, &base, &imWidth, &imHeight);
-    fileTextPtr += (lineBytes + 1);
+        int fallback = GetGlyphLookupIndex(lookup, GLYPH_NOTFOUND_CHAR_FALLBACK);
+        return (fallback >= 0)? fallback : LoadFontDynamicGlyph(lookup, GLYPH_NOTFOUND_CHAR_FALLBACK);
+    }
 
-    TRACELOGD("FONT: [%s] Loaded font info:", fileName);
-    TRACELOGD("    > Base size: %i", fontSize);
-    TRACELOGD("    > Texture scale: %ix%i", imWidth, imHeight);
+    // Get glyph slot, consecutive slots until atlas is full, least recently used slot afterwards
+    int slot = 0;
 
-    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "file");
-    sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName);
-    fileTextPtr += (lineBytes + 1);
+    if (dynamic->slotsUsed < dynamic->glyphCount) slot = dynamic->slotsUsed++;
+    else
+    {
+        for (int i = 1; i < dynamic->glyphCount; i++) if (dynamic->lastUse[i] < dynamic->lastUse[slot]) slot = i;
 
-    TRACELOGD("    > Texture filename: %s", imFileName);
+        // NOTE: Pending batch could contain quads using evicted glyph, it is drawn before cell is updated
+        rlDrawRenderBatchActive();
 
-    lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "count");
-    sscanf(searchPoint, "count=%i", &glyphCount);
-    fileTextPtr += (lineBytes + 1);
+        RemoveGlyphLookupIndex(lookup, dynamic->glyphs[slot].value);
+        UnloadImage(dynamic->glyphs[slot].image);
+    }
 
-    TRACELOGD("    > Chars count: %i", glyphCount);
+    GlyphInfo *glyph = &dynamic->glyphs[slot];
+    int width = 0, height = 0;
 
-    // Compose correct path using route of .fnt file (fileName) and imFileName
-    char *imPath = NULL;
-    char *lastSlash = NULL;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&dynamic->fontInfo, dynamic->scaleFactor, dynamic->scaleFactor, codepoint, &width, &height, &glyph->offsetX, &glyph->offsetY);
+    stbtt_GetCodepointHMetrics(&dynamic->fontInfo, codepoint, &glyph->advanceX, NULL);
 
-    lastSlash = strrchr(fileName, '/');
-    if (lastSlash == NULL) lastSlash = strrchr(fileName, '\\');
+    glyph->value = codepoint;
+    glyph->advanceX = (int)((float)glyph->advanceX*dynamic->scaleFactor);
+    glyph->offsetY += (int)((float)dynamic->ascent*dynamic->scaleFactor);
 
-    if (lastSlash != NULL)
+    int stride = width;     // Bitmap row size, glyph could be clipped
+
+    // NOTE: Space character uses an empty glyph (same as LoadFontData())
+    if (codepoint == 32)
     {
-        // NOTE: We need some extra space to avoid memory corruption on next allocations!
-        imPath = (char *)RL_CALLOC(TextLength(fileName) - TextLength(lastSlash) + TextLength(imFileName) + 4, 1);
-        memcpy(imPath, fileName, TextLength(fileName) - TextLength(lastSlash) + 1);
-        memcpy(imPath + TextLength(fileName) - TextLength(lastSlash) + 1, imFileName, TextLength(imFileName));
+        width = glyph->advanceX;
+        height = dynamic->fontSize;
     }
-    else imPath = imFileName;
 
-    TRACELOGD("    > Image loading path: %s", imPath);
+    // Glyphs bigger than cells are clipped
+    if (width > (dynamic->cellWidth - 2*dynamic->padding)) width = dynamic->cellWidth - 2*dynamic->padding;
+    if (height > (dynamic->cellHeight - 2*dynamic->padding)) height = dynamic->cellHeight - 2*dynamic->padding;
 
-    Image imFont = LoadImage(imPath);
+    // Clear atlas cell and copy glyph bitmap as alpha
+    int cellX = (slot%dynamic->columns)*dynamic->cellWidth;
+    int cellY = (slot/dynamic->columns)*dynamic->cellHeight;
+    unsigned char *pixels = (unsigned char *)dynamic->atlas.data;
 
-    if (imFont.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    for (int y = 0; y < dynamic->cellHeight; y++)
     {
-        // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
-        Image imFontAlpha = {
-            .data = RL_CALLOC(imFont.width*imFont.height, 2),
-            .width = imFont.width,
-            .height = imFont.height,
-            .mipmaps = 1,
-            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
-        };
+        unsigned char *row = pixels + 2*((cellY + y)*dynamic->atlas.width + cellX);
+        int bitmapY = y - dynamic->padding;
 
-        for (int p = 0, i = 0; p < (imFont.width*imFont.height*2); p += 2, i++)
+        for (int x = 0; x < dynamic->cellWidth; x++)
         {
-            ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
-            ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFont.data)[i];
-        }
+            int bitmapX = x - dynamic->padding;
+            bool inside = (bitmap != NULL) && (bitmapX >= 0) && (bitmapX < width) && (bitmapY >= 0) && (bitmapY < height);
 
-        UnloadImage(imFont);
-        imFont = imFontAlpha;
+            row[2*x + 1] = inside? bitmap[bitmapY*stride + bitmapX] : 0;
+        }
     }
 
-    font.texture = LoadTextureFromImage(imFont);
-
-    if (lastSlash != NULL) RL_FREE(imPath);
-
-    // Fill font characters info data
-    font.baseSize = fontSize;
-    font.glyphCount = glyphCount;
-    font.glyphPadding = 0;
-    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
-    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+    if (bitmap != NULL) stbtt_FreeBitmap(bitmap, NULL);
 
-    int charId, charX, charY, charWidth, charHeight, charOffsetX, charOffsetY, charAdvanceX;
+    dynamic->recs[slot] = (Rectangle){ (float)(cellX + dynamic->padding), (float)(cellY + dynamic->padding), (float)width, (float)height };
+    glyph->image = ((width > 0) && (height > 0))? ImageFromImage(dynamic->atlas, dynamic->recs[slot]) : (Image){ 0 };
 
-    for (int i = 0; i < glyphCount; i++)
-    {
-        lineBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i",
-                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX);
-        fileTextPtr += (lineBytes + 1);
+    if (cellY < dynamic->dirtyMinY) dynamic->dirtyMinY = cellY;
+    if ((cellY + dynamic->cellHeight - 1) > dynamic->dirtyMaxY) dynamic->dirtyMaxY = cellY + dynamic->cellHeight - 1;
 
-        // Get character rectangle in the font atlas texture
-        font.recs[i] = (Rectangle){ (float)charX, (float)charY, (float)charWidth, (float)charHeight };
+    dynamic->lastUse[slot] = ++dynamic->useCounter;
+    AddGlyphLookupIndex(lookup, codepoint, slot);
 
-        // Save data properly in sprite font
-        font.glyphs[i].value = charId;
-        font.glyphs[i].offsetX = charOffsetX;
-        font.glyphs[i].offsetY = charOffsetY;
-        font.glyphs[i].advanceX = charAdvanceX;
+    return slot;
+}
 
-        // Fill character image data from imFont data
-        font.glyphs[i].image = ImageFromImage(imFont, font.recs[i]);
-    }
+// Upload dynamic font atlas rows pending
+static void UpdateFontDynamicAtlas(FontDynamic *dynamic)
+{
+    if (dynamic->dirtyMaxY < dynamic->dirtyMinY) return;
 
-    UnloadImage(imFont);
-    UnloadFileText(fileText);
+    int rows = dynamic->dirtyMaxY - dynamic->dirtyMinY + 1;
+    unsigned char *data = (unsigned char *)dynamic->atlas.data + 2*dynamic->dirtyMinY*dynamic->atlas.width;
 
-    if (font.texture.id == 0)
-    {
-        UnloadFont(font);
-        font = GetFontDefault();
-        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
-    }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    rlUpdateTexture(dynamic->textureId, 0, dynamic->dirtyMinY, dynamic->atlas.width, rows, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, data);
 
-    return font;
+    dynamic->dirtyMinY = dynamic->atlas.height;
+    dynamic->dirtyMaxY = -1;
 }
 #endif
 
@@ -24,6 +24,7 @@
 *   #define SUPPORT_FILEFORMAT_ASTC
 *       Select desired fileformats to be supported for image data loading. Some of those formats are
 *       supported by default, to remove support, just comment unrequired #define in this module
+*       NOTE: Animated images (LoadAnimImage()) support GIF and APNG (requires SUPPORT_FILEFORMAT_PNG)
 *
 *   #define SUPPORT_IMAGE_EXPORT
 *       Support image export in multiple file formats
@@ -35,6 +36,17 @@
 *   #define SUPPORT_IMAGE_GENERATION
 *       Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*   #define SUPPORT_TEXTURE_STREAMING
+*       Support textures mipmaps streaming, LoadTextureStreamed() keeps resident only the low resolution
+*       mipmaps tail, higher resolution mipmaps are loaded asynchronously when requested by drawn size,
+*       and evicted least recently requested first to keep streamed textures under a GPU memory budget
+*       NOTE: Requires texture base mipmap level support (OpenGL 3.3), textures are fully loaded otherwise
+*
+*   #define SUPPORT_VIDEO_TEXTURE
+*       Support video textures playback (LoadVideoTexture()), YUV4MPEG2 (.y4m) frames are read ahead on
+*       async loader thread, YUV planes are uploaded as single channel textures and converted to RGB on GPU
+*       NOTE: Requires OpenGL 2.1 or higher (shaders)
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -71,13 +83,29 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
+#define MEMORY_MODULE MEMORY_MODULE_TEXTURES    // Memory tracking module (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"              // Required for: TRACELOG()
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
+#if defined(SUPPORT_SIMD_RAYMATH)
+    #define RAYMATH_SIMD                // Use SIMD instructions for raymath hot functions
+#endif
+#include "raymath.h"            // Required for: MatrixLookAt(), MatrixPerspective() [Used in GenTextureCubemap()]
 
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in ImageCompress()]
+#include <float.h>              // Required for: FLT_MAX [Used in ImageCompress()]
+
+// SIMD image formats conversion kernels (ImageFormat()), scalar fallback if not available
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RTEXTURES_SIMD_SSE2
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RTEXTURES_SIMD_NEON
+    #include <arm_neon.h>               // Required for: NEON intrinsics
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -183,6 +211,10 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_COMPRESSION_API)
+        #include "external/sdefl.h"         // Required for: zsdeflate() [ExportImage()], implementation in rcore
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
@@ -190,11 +222,19 @@
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
-#define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
-#define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
+// NOTE: Resize scratch memory is taken from ImageResizeContext buffers if provided as allocation context
+static void *LoadImageResizeScratch(void **buffer, size_t size);    // Load image resize scratch buffer, buffer grows if required
+
+#define STBIR_MALLOC(size,c) (((c) != NULL)? LoadImageResizeScratch((void **)(c), size) : RL_MALLOC(size))
+#define STBIR_FREE(ptr,c) (((c) != NULL)? (void)0 : RL_FREE(ptr))
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 
+#if defined(SUPPORT_VIDEO_TEXTURE)
+    #define RLY4M_IMPLEMENTATION
+    #include "external/rly4m.h"             // Required for: rly4m_open(), rly4m_read() [LoadVideoTexture()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -206,15 +246,474 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef RENDER_TEXTURE_POOL_SIZE
+    #define RENDER_TEXTURE_POOL_SIZE    32      // Maximum render textures kept in pool (acquired and released)
+#endif
+#ifndef RENDER_TEXTURE_POOL_FRAMES
+    #define RENDER_TEXTURE_POOL_FRAMES  30      // Frames a released pooled render texture is kept before being unloaded
+#endif
+
+#ifndef SPRITE_BATCH_CHUNK_SIZE
+    #define SPRITE_BATCH_CHUNK_SIZE     256     // Sprites quads computed before submission to render batch by DrawTextureBatch()
+#endif
+
+#ifndef TILED_IMAGE_DEFAULT_BUDGET
+    #define TILED_IMAGE_DEFAULT_BUDGET  (256*1024*1024)   // Tiled image default tiles cache memory budget, in bytes
+#endif
+
+#if defined(_WIN32)
+    #define FSEEK64(file, offset) _fseeki64(file, offset, SEEK_SET)     // Seek big files (64 bit offset)
+#else
+    #define FSEEK64(file, offset) fseeko(file, (off_t)(offset), SEEK_SET)
+#endif
+
+#ifndef IMAGE_DRAW_PARALLEL_PIXELS
+    #define IMAGE_DRAW_PARALLEL_PIXELS        65536   // Minimum pixels drawn by ImageDraw() to blit rows in parallel (jobs system)
+#endif
+#ifndef IMAGE_RESIZE_SLICE_ROWS
+    #define IMAGE_RESIZE_SLICE_ROWS              32   // Minimum output rows per resize slice, slices resized in parallel (jobs system)
+#endif
+#ifndef IMAGE_FILL_CHUNK_SIZE
+    #define IMAGE_FILL_CHUNK_SIZE              4096   // Pixels fill pattern size (bytes), pattern doubled up to this size and repeated
+#endif
+#ifndef IMAGE_DRAW_ROW_CHUNK
+    #define IMAGE_DRAW_ROW_CHUNK                256   // Pixels converted to RGBA8 per chunk when blitting rows from other formats
+#endif
+#define READ_BE32(ptr) (((unsigned int)(ptr)[0] << 24) | ((unsigned int)(ptr)[1] << 16) | ((unsigned int)(ptr)[2] << 8) | (unsigned int)(ptr)[3])
+
+#ifndef IMAGE_EXPORT_PNG_LEVEL
+    #define IMAGE_EXPORT_PNG_LEVEL                2   // PNG export DEFLATE compression level [0..8], lower is faster (requires SUPPORT_COMPRESSION_API)
+#endif
+
+#ifndef MAX_IMAGE_DECODERS
+    #define MAX_IMAGE_DECODERS                      8   // Maximum number of registered image decoders (RegisterImageDecoder())
+#endif
+#ifndef MAX_TEXTURE_STREAMS
+    #define MAX_TEXTURE_STREAMS                  1024   // Maximum number of streamed textures
+#endif
+#ifndef TEXTURE_STREAMING_TAIL_SIZE
+    #define TEXTURE_STREAMING_TAIL_SIZE            64   // Streamed textures mipmaps tail size (always resident), in pixels
+#endif
+#ifndef TEXTURE_STREAMING_MAX_LOADS
+    #define TEXTURE_STREAMING_MAX_LOADS             4   // Maximum streamed textures mipmaps loads in flight
+#endif
+#ifndef TEXTURE_STREAMING_KEEP_FRAMES
+    #define TEXTURE_STREAMING_KEEP_FRAMES         120   // Frames requested mipmaps are kept wanted after last request
+#endif
+#ifndef TEXTURE_STREAMING_DEFAULT_BUDGET
+    #define TEXTURE_STREAMING_DEFAULT_BUDGET  (256*1024*1024)   // Streamed textures default GPU memory budget, in bytes
+#endif
+#ifndef IBL_PREFILTERED_MIPMAPS
+    #define IBL_PREFILTERED_MIPMAPS                 5   // Prefiltered environment cubemap mipmaps, roughness levels (GenTexturePrefiltered())
+#endif
+#ifndef IBL_SAMPLE_COUNT
+    #define IBL_SAMPLE_COUNT                     1024   // Importance samples by texel, prefiltered environment cubemap and BRDF lookup texture
+#endif
+#ifndef VIDEO_TEXTURE_QUEUE_FRAMES
+    #define VIDEO_TEXTURE_QUEUE_FRAMES              4   // Video texture frames decoded ahead on async loader thread
+#endif
+#ifndef ATLAS_SHAPES_REGION_SIZE
+    #define ATLAS_SHAPES_REGION_SIZE                4   // Atlas pages white region size (top-left corner), used on shapes drawing
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Atlas rectangle (pixels)
+typedef struct AtlasRect {
+    int x;                          // Rectangle top-left corner position x
+    int y;                          // Rectangle top-left corner position y
+    int width;                      // Rectangle width
+    int height;                     // Rectangle height
+} AtlasRect;
+
+// Atlas page, texture free space tracked as free rectangles (guillotine packing)
+typedef struct AtlasPage {
+    Texture2D texture;              // Page texture (R8G8B8A8)
+    AtlasRect *freeRects;           // Free rectangles
+    int freeCount;                  // Free rectangles count
+    int freeCapacity;               // Free rectangles allocated
+    int regionCount;                // Regions packed in page
+} AtlasPage;
+
+// Atlas packed region
+typedef struct AtlasEntry {
+    int page;                       // Page index
+    AtlasRect rect;                 // Region rectangle (including padding)
+    bool active;                    // Region in use, inactive ids are reused
+} AtlasEntry;
+
+// Atlas builder, images packed into pages on demand
+struct AtlasBuilder {
+    int pageWidth;                  // Pages width
+    int pageHeight;                 // Pages height
+    int padding;                    // Padding around images, filled extruding image edges
+    AtlasPage *pages;               // Pages
+    int pageCount;                  // Pages count
+    AtlasEntry *entries;            // Regions, indexed by id
+    int entryCount;                 // Regions count (including inactive)
+};
+
+// Image rows blit (ImageDraw()), rows processed in parallel by jobs system
+typedef struct ImageBlitJob {
+    const unsigned char *src;       // Source first pixel
+    int srcStride;                  // Source row stride (bytes)
+    int srcFormat;                  // Source pixel format
+    unsigned char *dst;             // Destination first pixel
+    int dstStride;                  // Destination row stride (bytes)
+    int dstFormat;                  // Destination pixel format
+    int width;                      // Pixels per row
+    Color tint;                     // Source tint (blend only)
+    bool blend;                     // Source alpha blending required
+} ImageBlitJob;
+
+// Image compression, 4x4 blocks rows compressed in parallel by jobs system
+typedef struct ImageCompressJob {
+    const Color *pixels;            // Level pixels (RGBA8)
+    int width;                      // Level width
+    int height;                     // Level height
+    unsigned char *dst;             // Level compressed blocks
+    int format;                     // Compressed pixel format
+    int quality;                    // Compression quality [0..100]
+} ImageCompressJob;
+
+// Image generation, rectangle rows generated in parallel by jobs system
+typedef struct ImageGenJob {
+    Color *pixels;                  // Generated rectangle pixels
+    int x;                          // Rectangle position x in generated image
+    int y;                          // Rectangle position y in generated image
+    int width;                      // Rectangle width
+    int imageWidth;                 // Generated image width (radial gradient, perlin noise)
+    int imageHeight;                // Generated image height (radial gradient, perlin noise)
+    float params[4];                // Generator parameters: radial density, perlin offset and scale, white noise factor
+    Color colors[2];                // Generator colors: radial inner and outer
+    const int *seeds;               // Cellular seeds positions (x, y), hashed from tiles position if NULL
+    int seedsPerRow;                // Cellular seeds per row
+    int seedsPerCol;                // Cellular seeds per column
+    int tileSize;                   // Cellular tile size
+    unsigned int seed;              // Hashed generators seed (cellular, white noise)
+} ImageGenJob;
+
+// Image mipmap level generation (2x2 box filter), destination rows filtered in parallel by jobs system
+typedef struct ImageMipmapJob {
+    const unsigned char *src;       // Source level pixels
+    int srcWidth;                   // Source level width
+    int srcHeight;                  // Source level height
+    unsigned char *dst;             // Destination level pixels
+    int dstWidth;                   // Destination level width
+    int format;                     // Pixel format
+    bool srgb;                      // Color channels filtered in linear space (8 bit formats)
+    bool premultiplied;             // Color channels weighted by alpha
+} ImageMipmapJob;
+
+// Image resize, output rows split in slices resized in parallel by jobs system
+typedef struct ImageResizeJob {
+    const void *input;              // Input pixels
+    int inputWidth;                 // Input width
+    int inputHeight;                // Input height
+    int inputStride;                // Input row stride (bytes)
+    void *output;                   // Output pixels
+    int outputWidth;                // Output width
+    int outputHeight;               // Output height
+    int outputStride;               // Output row stride (bytes)
+    stbir_datatype type;            // Channels data type
+    int channels;                   // Channels per pixel
+    int alphaChannel;               // Alpha channel index (-1: channels filtered independently)
+    stbir_colorspace colorspace;    // Channels color space
+    int sliceCount;                 // Output rows slices
+    void **buffers;                 // Slices scratch buffers (NULL: allocated per resize)
+} ImageResizeJob;
+
+// Image colors histogram entry, open addressing hash table slot keyed by packed color
+typedef struct ImageColorCount {
+    unsigned int color;             // Packed color (RGBA bytes)
+    int count;                      // Pixels with color (0: empty slot)
+    int first;                      // First pixel index with color
+    int index;                      // Palette index (ImageQuantize())
+} ImageColorCount;
+
+// Image colors histogram, hash table (capacity power of 2)
+typedef struct ImageColorTable {
+    ImageColorCount *slots;         // Hash table slots
+    int capacity;                   // Slots capacity
+    int count;                      // Unique colors
+} ImageColorTable;
+
+// Image colors histogram, pixels split in slices counted in parallel by jobs system
+typedef struct ImageHistogramJob {
+    const Color *pixels;            // Image pixels
+    int pixelCount;                 // Image pixels count
+    int sliceCount;                 // Pixels slices
+    ImageColorTable *tables;        // Slices histograms
+} ImageHistogramJob;
+
+// Image quantization median cut box, histogram colors range
+typedef struct ImageQuantizeBox {
+    int start;                      // First color index
+    int end;                        // Last color index + 1
+    int channel;                    // Channel with highest variance
+    double error;                   // Squared error to box average (0: box can not be split)
+    Color average;                  // Colors average (pixels weighted)
+} ImageQuantizeBox;
+
+// Image color operations fused stage, consecutive channels operations are composed into lookup tables
+typedef struct ImageProcessStage {
+    int type;                       // Stage type: -1 (channels lookup tables) or ImageProcessType
+    unsigned int color;             // Replaced color (RGBA8 packed)
+    unsigned int replace;           // Replacement color (RGBA8 packed)
+    unsigned char table[4][256];    // Channels lookup tables
+} ImageProcessStage;
+
+// Image color operations rows processing (ImageProcess())
+typedef struct ImageProcessJob {
+    unsigned char *pixels;          // Image pixels (RGBA8), processed in place
+    int width;                      // Image width (pixels per row)
+    const ImageProcessStage *stages;    // Fused stages
+    int stageCount;                 // Fused stages count
+} ImageProcessJob;
+
+// Image quantization pixels mapping to palette (no dithering)
+typedef struct ImageQuantizeJob {
+    Color *pixels;                  // Image pixels (replaced by palette colors)
+    int width;                      // Image width (pixels per row)
+    const ImageColorTable *table;   // Image colors histogram with palette indices
+    const Color *palette;           // Palette colors
+} ImageQuantizeJob;
+
+// Image rows fill, first row copied to the following rows
+typedef struct ImageFillJob {
+    unsigned char *data;            // First row first pixel
+    int stride;                     // Rows stride (bytes)
+    int rowSize;                    // Row fill size (bytes)
+} ImageFillJob;
+
+// PNG export rows filtering, every row filtered with the filter likely to compress best
+typedef struct ImageFilterPNGJob {
+    const unsigned char *pixels;    // Image pixels
+    unsigned char *filtered;        // Filtered rows, filter type byte followed by row data
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Channels per pixel
+} ImageFilterPNGJob;
+
+// Animated image container type
+typedef enum {
+    ANIM_IMAGE_GIF = 1,             // GIF, frames composed by stb_image decoder
+    ANIM_IMAGE_APNG                 // APNG, frames decoded as standalone PNG images and composed on canvas
+} AnimImageType;
+
+// Animated image frame info, parsed on load without decoding frames
+typedef struct AnimImageFrame {
+    int delay;                      // Frame delay (milliseconds)
+    int x;                          // Frame region position X (APNG)
+    int y;                          // Frame region position Y (APNG)
+    int width;                      // Frame region width (APNG)
+    int height;                     // Frame region height (APNG)
+    int dispose;                    // Frame region disposal after frame (APNG: 0 none, 1 clear, 2 previous)
+    int blend;                      // Frame region blending (APNG: 0 source, 1 over)
+    unsigned int offset;            // Frame data chunks offset, after fcTL chunk (APNG)
+} AnimImageFrame;
+
+// Animated image decoder, frames decoded on demand and composed on a reused canvas
+typedef struct AnimImageDecoder {
+    AnimImageType type;             // Container type
+    unsigned char *fileData;        // File data (mapped)
+    unsigned int dataSize;          // File data size
+    int width;                      // Canvas width
+    int height;                     // Canvas height
+    int frameCount;                 // Frames count
+    AnimImageFrame *frames;         // Frames info
+    int decodedFrame;               // Last frame composed on canvas (-1: none)
+    unsigned char *canvas;          // Canvas pixels (APNG), GIF canvas is owned by stb_image decoder
+    unsigned char *previous;        // Canvas restored by disposal (GIF: two frames back, APNG: before current frame)
+    unsigned char *saved;           // Canvas of previous frame (GIF)
+    bool restorePrevious;           // Some frame disposal restores previous canvas
+    unsigned int paletteOffset;     // PLTE chunk offset (APNG, 0: not available)
+    unsigned int transparencyOffset;    // tRNS chunk offset (APNG, 0: not available)
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    stbi__context context;          // GIF decoder input context
+    stbi__gif gif;                  // GIF decoder state
+#endif
+    unsigned char *next;            // Next frame pixels (prefetched)
+    int nextFrame;                  // Next frame index (-1: not available)
+    int prefetchFrame;              // Frame being decoded by prefetch request
+    bool prefetch;                  // Next frame decoded on async loader thread
+    int request;                    // Prefetch async load request (-1: none)
+} AnimImageDecoder;
+
+// Tiled image cached tile, loaded tiles are linked in least recently used order
+typedef struct TiledImageTile {
+    unsigned char *data;            // Tile pixels (NULL: not loaded)
+    int prev;                       // More recently used loaded tile (-1: none)
+    int next;                       // Less recently used loaded tile (-1: none)
+} TiledImageTile;
+
+// Tiled image context, tiles cache shared by image and region views (reference counted)
+typedef struct TiledImageContext {
+    int width;                      // Source image width
+    int height;                     // Source image height
+    int format;                     // Source image pixel format
+    int tileSize;                   // Tiles size
+    int tilesX;                     // Tiles per row
+    int tilesY;                     // Tiles per column
+    int bytesPerPixel;              // Pixel size (bytes)
+    FILE *file;                     // RAW file source (NULL: callback source)
+    long long headerSize;           // RAW file header size
+    TiledImageCallback callback;    // Tiles loader callback
+    void *userData;                 // Tiles loader callback user data
+    TiledImageTile *tiles;          // Tiles cache
+    int first;                      // Most recently used loaded tile (-1: none)
+    int last;                       // Least recently used loaded tile (-1: none)
+    unsigned int budget;            // Tiles cache memory budget (bytes)
+    unsigned int memory;            // Loaded tiles memory (bytes)
+    int refCount;                   // Image and views referencing context
+} TiledImageContext;
+
+// Tiled image view, region of source context
+typedef struct TiledImageView {
+    TiledImageContext *context;     // Source tiles cache
+    int x;                          // Region position x in source image
+    int y;                          // Region position y in source image
+} TiledImageView;
+
+// Registered image decoder, checked before built-in decoders
+typedef struct ImageDecoder {
+    char fileType[16];              // File type (extension), i.e. ".jpg"
+    ImageProbeCallback probe;       // Get image size and format from file data
+    ImageDecodeCallback decode;     // Decode image into provided pixels memory
+} ImageDecoder;
+
+// Texture async load request data
+typedef struct TextureAsyncLoad {
+    char *fileName;                 // Texture file name
+    Image image;                    // Decoded image (loader thread)
+    unsigned char *fileData;        // File data probed by registered decoder, decoded into staging buffer (mapped)
+    unsigned int fileSize;          // File data size
+    void *staging;                  // Staging pixel buffer mapped memory, image copied by loader thread
+    unsigned int stagingId;         // Staging pixel buffer id
+    Texture2D texture;              // Loaded texture (main thread)
+} TextureAsyncLoad;
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Streamed texture, mipmaps resident from residentLevel, mipmaps tail (from tailLevel) always resident
+typedef struct TextureStream {
+    unsigned int id;                // Texture id (OpenGL)
+    char *fileName;                 // Texture file name (mipmaps are decoded again from file)
+    int width;                      // Texture base width
+    int height;                     // Texture base height
+    int format;                     // Texture pixel format
+    int mipmaps;                    // Texture mipmap levels
+    int tailLevel;                  // Mipmaps tail first level (always resident)
+    int minLevel;                   // Minimum level available (set on streaming failure)
+    int residentLevel;              // Resident mipmaps first level (texture base level)
+    int wantedLevel;                // Wanted mipmaps first level (requested on lastFrame)
+    unsigned int lastFrame;         // Last frame the texture was requested
+    int request;                    // Async load request in flight (-1: none)
+    unsigned int requestSize;       // Async load request levels size (reserved budget)
+} TextureStream;
+
+// Streamed texture mipmaps async load request data
+typedef struct TextureStreamLoad {
+    char *fileName;                 // Texture file name (stream owned)
+    unsigned int id;                // Texture id to update
+    int width;                      // Texture base width
+    int height;                     // Texture base height
+    int format;                     // Texture pixel format
+    int firstLevel;                 // First mipmap level to load
+    int lastLevel;                  // Last mipmap level to load (resident level - 1)
+    Image image;                    // Decoded image with mipmaps (loader thread)
+    bool loaded;                    // Mipmaps levels loaded (main thread)
+} TextureStreamLoad;
+#endif
+
+#if defined(SUPPORT_VIDEO_TEXTURE)
+// Video texture decoder, frames read ahead into a frames queue (ring) on async loader thread
+// NOTE: Positions are playback frames not wrapped by looping (frame: position%frameCount)
+typedef struct VideoDecoder {
+    struct rly4m y4m;               // Video stream reader (loader thread while decoding)
+    unsigned char *frames[VIDEO_TEXTURE_QUEUE_FRAMES];  // Frames queue planes (Y, U and V planes one after the other)
+    int positions[VIDEO_TEXTURE_QUEUE_FRAMES];          // Frames queue playback positions
+    int first;                      // First queued frame slot
+    int count;                      // Queued frames count
+    int nextPosition;               // Next position to decode
+    int requestSlot;                // First slot decoded by current request
+    int requestPosition;            // First position decoded by current request
+    int requestCount;               // Frames requested to current request, slots after queued frames
+    int decodedCount;               // Frames decoded by current request (loader thread)
+    int request;                    // Decoding async load request (-1: none)
+    bool looping;                   // Stream wraps to first frame at end (copied for loader thread)
+    bool ended;                     // Stream end reached, no more frames to decode
+    int position;                   // Position shown in video texture
+    unsigned int planeIds[3];       // Y, U and V planes textures (single channel)
+    RenderTexture2D target;         // Video texture framebuffer, planes converted to RGBA
+} VideoDecoder;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+// sRGB conversion tables, required by gamma-correct mipmaps filtering (initialized on first use)
+static float srgbToLinear[256] = { 0 };             // sRGB 8 bit value to linear [0..1]
+static unsigned char linearToSrgb[4096] = { 0 };    // Linear value (12 bit) to sRGB 8 bit
+static bool srgbTablesReady = false;
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Streamed textures, dense array with id hash table lookup (stream index + 1, 0: empty slot)
+static struct {
+    TextureStream streams[MAX_TEXTURE_STREAMS];
+    int slots[MAX_TEXTURE_STREAMS*2];
+    int count;
+    unsigned int budget;            // Streamed textures GPU memory budget (bytes)
+    unsigned int memory;            // Streamed textures resident GPU memory (bytes)
+    unsigned int pending;           // Streamed textures GPU memory reserved by loads in flight (bytes)
+    unsigned int frame;             // Streaming frame counter, updated on BeginDrawing()
+} textureStreaming = { .budget = TEXTURE_STREAMING_DEFAULT_BUDGET };
+#endif
+
+// Render textures pool, released targets are reused by matching acquisitions
+typedef struct RenderTexturePoolEntry {
+    RenderTexture2D target;         // Pooled render texture
+    bool depth;                     // Render texture has (transient) depth renderbuffer
+    bool acquired;                  // Render texture currently acquired (in use)
+    unsigned int frame;             // Frame render texture was released
+} RenderTexturePoolEntry;
+
+// Multisample render texture, drawn on multisample framebuffer, resolved into render texture color texture
+typedef struct RenderTextureMultisample {
+    unsigned int id;                // Multisample framebuffer id (render texture id)
+    unsigned int resolveId;         // Resolve framebuffer id (render texture color texture attached)
+    int width;                      // Render texture width
+    int height;                     // Render texture height
+} RenderTextureMultisample;
+
+static struct {
+    RenderTextureMultisample *entries;
+    int count;                      // Loaded multisample render textures
+} renderTextureMultisample = { 0 };
+
+static struct {
+    RenderTexturePoolEntry entries[RENDER_TEXTURE_POOL_SIZE];
+    int count;                      // Pooled render textures
+    unsigned int frame;             // Pool frame counter, updated on BeginDrawing()
+} renderTexturePool = { 0 };
+
+static ImageDecoder imageDecoders[MAX_IMAGE_DECODERS] = { 0 };    // Registered image decoders
+static int imageDecoderCount = 0;           // Registered image decoders count
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Textures filters shader and ping-pong framebuffer (color attachment only), loaded on first use
+static Shader textureFilterShader = { 0 };
+static int textureFilterLocs[3] = { -1, -1, -1 };   // Filter uniforms locations: filterMode, filterParams0, filterParams1
+static bool textureFilterShaderFailed = false;
+static RenderTexture2D textureFilterTarget = { 0 };
+#endif
+
+#if defined(SUPPORT_VIDEO_TEXTURE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Video textures YUV to RGB conversion shader, loaded on first use
+static Shader videoTextureShader = { 0 };
+static int videoTextureLocs[3] = { -1, -1, -1 };    // Uniforms locations: texture1 (U plane), texture2 (V plane), yuvRange
+static bool videoTextureShaderFailed = false;
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -225,6 +724,103 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static bool ImageFormatDirect(Image *image, int newFormat); // Convert image data format with integer kernels (common formats pairs), mipmaps are kept
+static void ImageBlitRows(int start, int end, void *userData);  // Blit image rows, source blended into destination (ImageDraw())
+static void ImageFillRec(Image *dst, int x, int y, int width, int height);  // Fill image rectangle repeating its first pixel (rectangle inside image)
+static void ImageResizeSlices(int start, int end, void *userData);  // Resize image output rows slices
+static void ImageMipmapRows(int start, int end, void *userData);    // Filter mipmap level rows from previous level (2x2 box filter)
+static void ImageCompressRows(int start, int end, void *userData);  // Compress image 4x4 blocks rows
+static void AddAtlasFreeRect(AtlasPage *page, AtlasRect rect);      // Add atlas page free rectangle, merged with adjacent free rectangles
+static void ResetAtlasPageFreeRects(AtlasPage *page, int width, int height);  // Reset atlas page free rectangles, shapes white region kept
+static void GetBlockBounds(const Color *block, Color *minColor, Color *maxColor);   // Get 4x4 block texels min/max channels
+static int MatchBlockDXT1(const Color *block, unsigned short c0, unsigned short c1, bool alpha, unsigned int *indices);  // Get DXT1 block indices for endpoints, returns squared error
+static void CompressBlockDXT1(const Color *block, unsigned char *dst, bool alpha, int quality);    // Compress 4x4 block color (DXT1, 1 bit alpha optional)
+static void CompressBlockDXTAlpha(const Color *block, unsigned char *dst, bool interpolated);     // Compress 4x4 block alpha (DXT3 explicit, DXT5 interpolated)
+static int FitSubblockETC1(const Color *block, const int *texels, const int *base, int *table, int *selectors);   // Fit ETC1 subblock texels to base color, returns squared error
+static void CompressBlockETC1(const Color *block, unsigned char *dst, int quality);               // Compress 4x4 block color (ETC1, valid ETC2 RGB)
+static void CompressBlockEACAlpha(const Color *block, unsigned char *dst, int quality);           // Compress 4x4 block alpha (ETC2 EAC)
+static void FilterMipmapTexel(const unsigned char *texels[4], unsigned char *dst, int channels, int alphaChannel, bool srgb, bool premultiplied);  // Filter 4 texels (8 bit per channel)
+static void ImageFillRows(int start, int end, void *userData);  // Fill image rows copying first row
+#if defined(SUPPORT_IMAGE_GENERATION)
+static Image GenImageRec(Rectangle rec, ImageGenJob *job, void (*generate)(int start, int end, void *userData));   // Generate image rectangle rows with generator callback (parallel for big images)
+static void GenImageRadialRows(int start, int end, void *userData);     // Generate radial gradient rows
+static void GenImagePerlinRows(int start, int end, void *userData);     // Generate perlin noise rows (fbm, 6 octaves)
+static void GenImageCellularRows(int start, int end, void *userData);   // Generate cellular pattern rows, nearest seed of neighbor tiles
+static void GenImageWhiteNoiseRows(int start, int end, void *userData); // Generate hashed white noise rows
+static unsigned int HashImageGen(int x, int y, unsigned int seed);      // Hash generated image position with seed
+#endif
+static ImageColorTable LoadImageHistogram(const Color *pixels, int pixelCount); // Load image colors histogram (parallel for big images)
+static void UnloadImageHistogram(ImageColorTable *table);  // Unload image colors histogram
+static ImageColorCount *AddImageColorCount(ImageColorTable *table, unsigned int color, int count, int first);   // Add pixels to color histogram entry
+static ImageColorCount *GetImageColorCount(const ImageColorTable *table, unsigned int color);   // Get color histogram entry (NULL: not found)
+static void ImageHistogramSlices(int start, int end, void *userData);   // Count image pixels slices colors
+static int CompareColorCountFirst(const void *a, const void *b);        // Compare histogram entries by first pixel index
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void UpdateImageQuantizeBox(ImageQuantizeBox *box, ImageColorCount **colors);    // Update quantization box colors average and error
+static void ImageQuantizeRows(int start, int end, void *userData);      // Map image pixels to palette colors, histogram palette indices
+static int LoadImageProcessStages(const ImageProcessOp *ops, int count, ImageProcessStage *stages);  // Fuse color operations into stages, returns stages count
+static void ImageProcessRows(int start, int end, void *userData);      // Apply fused color operations stages to image rows
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_COMPRESSION_API)
+static unsigned char *ExportImagePNGToMemory(const unsigned char *pixels, int width, int height, int channels, int *dataSize);   // Export image pixels as PNG file data (8 bit per channel)
+static void ImageFilterPNGRows(int start, int end, void *userData); // Filter image rows for PNG export
+#endif
+static void FillPixels(unsigned char *dst, const unsigned char *pixel, int bytesPerPixel, int count);   // Fill pixels with pixel data, filled region doubled on every copy
+static void LoadRowColors(Color *colors, const unsigned char *src, int count, int format);   // Load pixels row as RGBA8 colors
+static void BlendRowColors(Color *dst, const Color *src, int count, Color tint);    // Alpha blend RGBA8 pixels row with tint, same as ColorAlphaBlend()
+static bool ScanAnimImageGIF(AnimImageDecoder *decoder);    // Scan GIF frames info, frames are not decoded
+static bool ScanAnimImageAPNG(AnimImageDecoder *decoder);   // Scan APNG frames info, frames are not decoded
+static void ResetAnimImageDecoder(AnimImageDecoder *decoder);   // Reset animated image decoder to first frame
+static bool DecodeAnimImageFrame(AnimImageDecoder *decoder);    // Decode and compose next frame on canvas
+static bool LoadAnimImageFrame(AnimImageDecoder *decoder, int frame, unsigned char *pixels);    // Load animated image frame pixels, decoding from first frame if required
+static void WaitAnimImagePrefetch(AnimImageDecoder *decoder);   // Wait for animated image prefetch request to be decoded
+static void RequestAnimImagePrefetch(AnimImageDecoder *decoder, int frame);    // Request animated image frame decoding on async loader thread
+static void DecodeAnimImagePrefetch(void *data);            // Decode animated image prefetched frame (loader thread)
+static TiledImage LoadTiledImageContext(int width, int height, int format, int tileSize);   // Load tiled image with empty tiles cache
+static const unsigned char *GetTiledImagePixels(TiledImage image, int x, int y, int *count);    // Get tiled image pixel data at (x, y) in its tile, count of pixels up to tile row end
+static void LoadTiledImageTile(TiledImageContext *context, int index);   // Load tile into cache, least recently used tiles unloaded over budget
+static void UnloadTiledImageTile(TiledImageContext *context, int index); // Unload tile from cache
+static const ImageDecoder *GetImageDecoder(const char *fileType);   // Get registered image decoder for file type (NULL: not registered)
+static void DecodeTextureAsync(void *data);                 // Decode texture async load image (loader thread)
+static void FinalizeTextureAsync(void *data);               // Finalize texture async load, image uploaded to GPU (main thread)
+#if defined(SUPPORT_TEXTURE_STREAMING)
+static int GetTextureStreamIndex(unsigned int id);          // Get streamed texture index from texture id (-1: not streamed)
+static void RemoveTextureStream(int index);                 // Remove streamed texture, texture is not unloaded
+static unsigned int GetTextureStreamSize(const TextureStream *stream, int firstLevel, int lastLevel);   // Get streamed texture mipmaps levels size (bytes)
+static int GetTextureStreamTarget(const TextureStream *stream); // Get streamed texture target resident level
+static bool EvictTextureStream(int skip, bool surplusOnly); // Evict one mipmap level, least recently requested first
+static void DecodeTextureStream(void *data);                // Decode streamed texture mipmaps (loader thread)
+static void FinalizeTextureStream(void *data);              // Finalize streamed texture mipmaps, levels uploaded to GPU (main thread)
+#endif
+#if defined(SUPPORT_VIDEO_TEXTURE)
+static bool ReadVideoFrame(VideoDecoder *decoder, int position, unsigned char *planes);    // Read video frame at playback position (wrapped if looping)
+static void DecodeVideoFrames(void *data);                  // Decode requested video frames into queue slots (loader thread)
+static void RequestVideoFrames(VideoDecoder *decoder);      // Request video frames decoding into free queue slots on async loader thread
+static void RetrieveVideoFrames(VideoDecoder *decoder, bool wait);  // Retrieve video frames decoding request, decoded frames are queued
+static void UploadVideoFrame(VideoDecoder *decoder, const unsigned char *planes);  // Upload video frame planes and convert them into video texture
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool LoadShaderTextureFilter(void);                  // Load textures filters shader (if not loaded)
+static RenderTexture2D LoadTextureFilterTarget(int width, int height);  // Load framebuffer with color texture only (no depth)
+static void DrawTextureFilter(Texture2D source, RenderTexture2D target, int mode, Vector4 params0, Vector4 params1);   // Draw texture into render texture with filter pass (no blending)
+#endif
+#if defined(SUPPORT_VIDEO_TEXTURE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static bool LoadShaderVideoTexture(void);                   // Load video textures YUV to RGB conversion shader (if not loaded)
+#endif
+static void ApplyTextureFilter(RenderTexture2D *target, int mode, Vector4 params0, Vector4 params1);  // Apply filter pass to render texture color, ping-pong with filter framebuffer
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader LoadShaderCubemapPass(const char *fsCode);    // Load cubemap faces pass shader (cube vertex shader), NULL if compilation failed
+static void DrawTextureCubemapFaces(Shader shader, unsigned int cubemapId, int size, int mipLevel);  // Draw cube with shader into cubemap faces mipmap level (source texture bound by caller)
+#endif
+
+static unsigned char *LoadTextureLayersData(const Image *layers, int layerCount);   // Load layers pixel data one after the other (first image size and format)
+
+void UpdateTextureStreaming(void);                          // Update streamed textures residency, called on BeginDrawing() [Used by rcore]
+void UnloadTextureFilterDefault(void);                      // Unload textures filters shaders and framebuffer, called on CloseWindow() [Used by rcore]
+void UpdateRenderTexturePool(void);                         // Unload pooled render textures released some frames ago, called on BeginDrawing() [Used by rcore]
+void UnloadRenderTexturePool(void);                         // Unload all pooled render textures, called on CloseWindow() [Used by rcore]
+void ResolveRenderTexture(unsigned int id);                 // Resolve multisample render texture and invalidate transient attachments, called on EndTextureMode() [Used by rcore]
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -248,14 +844,14 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Loading file to memory (mapped, image is decoded from file pages)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
 
     // Loading image from memory data
     if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnloadFileDataMapped(fileData);
 
     return image;
 }
@@ -291,1794 +887,1987 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 // Load animated image data
 //  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
 //  - Number of frames is returned through 'frames' parameter
-//  - All frames are returned in RGBA format
-//  - Frames delay data is discarded
+//  - All frames are returned in RGBA format (GIF, APNG)
+//  - Frames delay data is discarded, use LoadAnimImage() to decode frames on demand
 Image LoadImageAnim(const char *fileName, int *frames)
 {
     Image image = { 0 };
     int frameCount = 0;
 
-#if defined(SUPPORT_FILEFORMAT_GIF)
-    if (IsFileExtension(fileName, ".gif"))
-    {
-        unsigned int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    AnimImage anim = LoadAnimImage(fileName);
 
-        if (fileData != NULL)
-        {
-            int comp = 0;
-            int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+    if (anim.ctxData != NULL)
+    {
+        int size = GetPixelDataSize(anim.image.width, anim.image.height, anim.image.format);
 
-            image.mipmaps = 1;
-            image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image = anim.image;
+        image.data = RL_MALLOC(size*anim.frameCount);
+        memcpy(image.data, anim.image.data, size);
+        frameCount = 1;
 
-            RL_FREE(fileData);
-            RL_FREE(delays);        // NOTE: Frames delays are discarded
+        while ((frameCount < anim.frameCount) && AnimImageNextFrame(&anim))
+        {
+            memcpy((unsigned char *)image.data + size*frameCount, anim.image.data, size);
+            frameCount++;
         }
+
+        UnloadAnimImage(anim);
     }
-#else
-    if (false) { }
-#endif
-    else
+    else if (anim.image.data != NULL)
     {
-        image = LoadImage(fileName);
+        image = anim.image;         // Not animated image, loaded with LoadImage()
         frameCount = 1;
     }
 
-    // TODO: Support APNG animated images
-
     *frames = frameCount;
     return image;
 }
 
-// Load image from memory buffer, fileType refers to extension: i.e. ".png"
-// WARNING: File extension must be provided in lower-case
-Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+// Load animated image from file (GIF, APNG), frames decoded on demand
+// NOTE: File data is mapped and only one frame is decoded at a time, frames are composed on a canvas
+// reused by all frames, not animated images are loaded with LoadImage() as a single frame
+AnimImage LoadAnimImage(const char *fileName)
 {
-    Image image = { 0 };
+    AnimImage anim = { 0 };
 
-    if ((false)
-#if defined(SUPPORT_FILEFORMAT_PNG)
-        || (strcmp(fileType, ".png") == 0)
-#endif
-#if defined(SUPPORT_FILEFORMAT_BMP)
-        || (strcmp(fileType, ".bmp") == 0)
-#endif
-#if defined(SUPPORT_FILEFORMAT_TGA)
-        || (strcmp(fileType, ".tga") == 0)
-#endif
-#if defined(SUPPORT_FILEFORMAT_JPG)
-        || ((strcmp(fileType, ".jpg") == 0) || (strcmp(fileType, ".jpeg") == 0))
-#endif
+    AnimImageDecoder *decoder = (AnimImageDecoder *)RL_CALLOC(1, sizeof(AnimImageDecoder));
+    decoder->fileData = LoadFileDataMapped(fileName, &decoder->dataSize);
+    decoder->request = -1;
+    decoder->nextFrame = -1;
+    decoder->decodedFrame = -1;
+
+    bool animated = false;
+
+    if (decoder->fileData != NULL)
+    {
 #if defined(SUPPORT_FILEFORMAT_GIF)
-        || (strcmp(fileType, ".gif") == 0)
+        if (!animated && ScanAnimImageGIF(decoder)) { decoder->type = ANIM_IMAGE_GIF; animated = true; }
 #endif
-#if defined(SUPPORT_FILEFORMAT_PIC)
-        || (strcmp(fileType, ".pic") == 0)
-#endif
-#if defined(SUPPORT_FILEFORMAT_PNM)
-        || ((strcmp(fileType, ".ppm") == 0) || (strcmp(fileType, ".pgm") == 0))
-#endif
-#if defined(SUPPORT_FILEFORMAT_PSD)
-        || (strcmp(fileType, ".psd") == 0)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        if (!animated && ScanAnimImageAPNG(decoder)) { decoder->type = ANIM_IMAGE_APNG; animated = true; }
 #endif
-        )
-    {
-#if defined(STBI_REQUIRED)
-        // NOTE: Using stb_image to load images (Supports multiple image formats)
+    }
 
-        if (fileData != NULL)
-        {
-            int comp = 0;
-            image.data = stbi_load_from_memory(fileData, dataSize, &image.width, &image.height, &comp, 0);
+    if (animated)
+    {
+        int size = decoder->width*decoder->height*4;
 
-            if (image.data != NULL)
-            {
-                image.mipmaps = 1;
+        if (decoder->type == ANIM_IMAGE_APNG) decoder->canvas = (unsigned char *)RL_MALLOC(size);
+        if (decoder->restorePrevious || (decoder->type == ANIM_IMAGE_APNG)) decoder->previous = (unsigned char *)RL_MALLOC(size);
+        if (decoder->restorePrevious && (decoder->type == ANIM_IMAGE_GIF)) decoder->saved = (unsigned char *)RL_MALLOC(size);
+        decoder->next = (unsigned char *)RL_MALLOC(size);
 
-                if (comp == 1) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-                else if (comp == 2) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
-                else if (comp == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
-                else if (comp == 4) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-            }
-        }
-#endif
-    }
-#if defined(SUPPORT_FILEFORMAT_HDR)
-    else if (strcmp(fileType, ".hdr") == 0)
-    {
-#if defined(STBI_REQUIRED)
-        if (fileData != NULL)
-        {
-            int comp = 0;
-            image.data = stbi_loadf_from_memory(fileData, dataSize, &image.width, &image.height, &comp, 0);
+        ResetAnimImageDecoder(decoder);
 
-            image.mipmaps = 1;
+        anim.image = (Image){ RL_MALLOC(size), decoder->width, decoder->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        anim.frameCount = decoder->frameCount;
+        anim.ctxData = decoder;
 
-            if (comp == 1) image.format = PIXELFORMAT_UNCOMPRESSED_R32;
-            else if (comp == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32;
-            else if (comp == 4) image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
-            else
-            {
-                TRACELOG(LOG_WARNING, "IMAGE: HDR file format not supported");
-                UnloadImage(image);
-            }
+        if (!LoadAnimImageFrame(decoder, 0, (unsigned char *)anim.image.data))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to decode animated image first frame", fileName);
+            UnloadAnimImage(anim);
+            anim = (AnimImage){ 0 };
         }
-#endif
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOI)
-    else if (strcmp(fileType, ".qoi") == 0)
-    {
-        qoi_desc desc = { 0 };
-        image.data = qoi_decode(fileData, dataSize, &desc, 4);
-        image.width = desc.width;
-        image.height = desc.height;
-        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        image.mipmaps = 1;
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_DDS)
-    else if (strcmp(fileType, ".dds") == 0)
-    {
-        image.data = rl_load_dds_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_PKM)
-    else if (strcmp(fileType, ".pkm") == 0)
-    {
-        image.data = rl_load_pkm_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_KTX)
-    else if (strcmp(fileType, ".ktx") == 0)
-    {
-        image.data = rl_load_ktx_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_PVR)
-    else if (strcmp(fileType, ".pvr") == 0)
-    {
-        image.data = rl_load_pvr_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+        else TRACELOG(LOG_INFO, "IMAGE: [%s] Animated image loaded successfully (%ix%i | %i frames)", fileName, anim.image.width, anim.image.height, anim.frameCount);
     }
-#endif
-#if defined(SUPPORT_FILEFORMAT_ASTC)
-    else if (strcmp(fileType, ".astc") == 0)
+    else
     {
-        image.data = rl_load_astc_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+        UnloadFileDataMapped(decoder->fileData);
+        RL_FREE(decoder->frames);
+        RL_FREE(decoder);
+
+        anim.image = LoadImage(fileName);
+        if (anim.image.data != NULL) anim.frameCount = 1;
     }
-#endif
-    else TRACELOG(LOG_WARNING, "IMAGE: Data format not supported");
 
-    if (image.data != NULL) TRACELOG(LOG_INFO, "IMAGE: Data loaded successfully (%ix%i | %s | %i mipmaps)", image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
-    else TRACELOG(LOG_WARNING, "IMAGE: Failed to load image data");
+    return anim;
+}
 
-    return image;
+// Check if an animated image is ready
+bool IsAnimImageReady(AnimImage anim)
+{
+    return (IsImageReady(anim.image) && (anim.frameCount > 0));
 }
 
-// Load image from GPU texture data
-// NOTE: Compressed texture formats not supported
-Image LoadImageFromTexture(Texture2D texture)
+// Unload animated image frames decoder and current frame image
+void UnloadAnimImage(AnimImage anim)
 {
-    Image image = { 0 };
+    AnimImageDecoder *decoder = (AnimImageDecoder *)anim.ctxData;
 
-    if (texture.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    if (decoder != NULL)
     {
-        image.data = rlReadTexturePixels(texture.id, texture.width, texture.height, texture.format);
+        WaitAnimImagePrefetch(decoder);
 
-        if (image.data != NULL)
+#if defined(SUPPORT_FILEFORMAT_GIF)
+        if (decoder->type == ANIM_IMAGE_GIF)
         {
-            image.width = texture.width;
-            image.height = texture.height;
-            image.format = texture.format;
-            image.mipmaps = 1;
-
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
-            // coming from FBO color buffer attachment, but it seems
-            // original texture format is retrieved on RPI...
-            image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-#endif
-            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Pixel data retrieved successfully", texture.id);
+            RL_FREE(decoder->gif.out);
+            RL_FREE(decoder->gif.background);
+            RL_FREE(decoder->gif.history);
         }
-        else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve pixel data", texture.id);
+#endif
+        UnloadFileDataMapped(decoder->fileData);
+        RL_FREE(decoder->frames);
+        RL_FREE(decoder->canvas);
+        RL_FREE(decoder->previous);
+        RL_FREE(decoder->saved);
+        RL_FREE(decoder->next);
+        RL_FREE(decoder);
     }
-    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve compressed pixel data", texture.id);
 
-    return image;
+    UnloadImage(anim.image);
 }
 
-// Load image from screen buffer and (screenshot)
-Image LoadImageFromScreen(void)
+// Decode next animated image frame into anim.image (loops to first frame)
+// NOTE: If prefetch is enabled, frame was decoded on async loader thread and buffers are swapped
+bool AnimImageNextFrame(AnimImage *anim)
 {
-    Image image = { 0 };
-
-    image.width = GetScreenWidth();
-    image.height = GetScreenHeight();
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    image.data = rlReadScreenPixels(image.width, image.height);
+    if (anim->ctxData == NULL) return false;
 
-    return image;
+    return AnimImageSeek(anim, (anim->currentFrame + 1)%anim->frameCount);
 }
 
-// Check if an image is ready
-bool IsImageReady(Image image)
+// Decode animated image frame into anim.image
+// NOTE: Frames depend on previous frames, seeking backwards decodes again from first frame
+bool AnimImageSeek(AnimImage *anim, int frame)
 {
-    return ((image.data != NULL) &&     // Validate pixel data available
-            (image.width > 0) &&
-            (image.height > 0) &&       // Validate image size
-            (image.format > 0) &&       // Validate image format
-            (image.mipmaps > 0));       // Validate image mipmaps (at least 1 for basic mipmap level)
+    AnimImageDecoder *decoder = (AnimImageDecoder *)anim->ctxData;
+
+    if ((decoder == NULL) || (frame < 0) || (frame >= anim->frameCount)) return false;
+
+    WaitAnimImagePrefetch(decoder);
+
+    bool success = true;
+
+    if (decoder->nextFrame == frame)
+    {
+        unsigned char *pixels = (unsigned char *)anim->image.data;
+        anim->image.data = decoder->next;
+        decoder->next = pixels;
+    }
+    else success = LoadAnimImageFrame(decoder, frame, (unsigned char *)anim->image.data);
+
+    decoder->nextFrame = -1;
+
+    if (success)
+    {
+        anim->currentFrame = frame;
+
+        if (decoder->prefetch) RequestAnimImagePrefetch(decoder, (frame + 1)%anim->frameCount);
+    }
+
+    return success;
 }
 
-// Unload image from CPU memory (RAM)
-void UnloadImage(Image image)
+// Get animated image frame delay (milliseconds)
+int GetAnimImageFrameDelay(AnimImage anim, int frame)
 {
-    RL_FREE(image.data);
+    const AnimImageDecoder *decoder = (const AnimImageDecoder *)anim.ctxData;
+
+    if ((decoder == NULL) || (frame < 0) || (frame >= decoder->frameCount)) return 0;
+
+    return decoder->frames[frame].delay;
 }
 
-// Export image data to file
-// NOTE: File format depends on fileName extension
-bool ExportImage(Image image, const char *fileName)
+// Set animated image next frame decoding on async loader thread
+// NOTE: Next frame is decoded in background after every AnimImageNextFrame()/AnimImageSeek()
+void SetAnimImagePrefetch(AnimImage anim, bool enabled)
 {
-    int success = 0;
+    AnimImageDecoder *decoder = (AnimImageDecoder *)anim.ctxData;
 
-#if defined(SUPPORT_IMAGE_EXPORT)
-    int channels = 4;
-    bool allocatedData = false;
-    unsigned char *imgData = (unsigned char *)image.data;
+    if (decoder == NULL) return;
 
-    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
-    {
-        // NOTE: Getting Color array as RGBA unsigned char values
-        imgData = (unsigned char *)LoadImageColors(image);
-        allocatedData = true;
-    }
+    decoder->prefetch = enabled;
 
-#if defined(SUPPORT_FILEFORMAT_PNG)
-    if (IsFileExtension(fileName, ".png"))
-    {
-        int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
-        success = SaveFileData(fileName, fileData, dataSize);
-        RL_FREE(fileData);
-    }
-#else
-    if (false) { }
-#endif
-#if defined(SUPPORT_FILEFORMAT_BMP)
-    else if (IsFileExtension(fileName, ".bmp")) success = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_TGA)
-    else if (IsFileExtension(fileName, ".tga")) success = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_JPG)
-    else if (IsFileExtension(fileName, ".jpg") ||
-             IsFileExtension(fileName, ".jpeg")) success = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOI)
-    else if (IsFileExtension(fileName, ".qoi"))
-    {
-        channels = 0;
-        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
+    if (enabled && (decoder->request < 0) && (decoder->nextFrame < 0)) RequestAnimImagePrefetch(decoder, (anim.currentFrame + 1)%anim.frameCount);
+}
 
-        if ((channels == 3) || (channels == 4))
-        {
-            qoi_desc desc = { 0 };
-            desc.width = image.width;
-            desc.height = image.height;
-            desc.channels = channels;
-            desc.colorspace = QOI_SRGB;
+// Load tiled image from RAW file data
+// NOTE: File is kept open, tiles rows are read from file when required (files bigger than 4GB supported)
+TiledImage LoadTiledImageRaw(const char *fileName, int width, int height, int format, int headerSize, int tileSize)
+{
+    TiledImage image = { 0 };
 
-            success = qoi_write(fileName, imgData, &desc);
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_KTX)
-    else if (IsFileExtension(fileName, ".ktx"))
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
     {
-        success = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+        return image;
     }
-#endif
-    else if (IsFileExtension(fileName, ".raw"))
+
+    image = LoadTiledImageContext(width, height, format, tileSize);
+
+    if (image.ctxData != NULL)
     {
-        // Export raw pixel data (without header)
-        // NOTE: It's up to the user to track image parameters
-        success = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
+        TiledImageContext *context = ((TiledImageView *)image.ctxData)->context;
+        context->file = file;
+        context->headerSize = headerSize;
+
+        TRACELOG(LOG_INFO, "IMAGE: [%s] Tiled image loaded successfully (%ix%i, %i tiles)", fileName, width, height, context->tilesX*context->tilesY);
     }
+    else fclose(file);
 
-    if (allocatedData) RL_FREE(imgData);
-#endif      // SUPPORT_IMAGE_EXPORT
+    return image;
+}
 
-    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
-    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+// Load tiled image with tiles loaded by callback
+// NOTE: Callback is called with tile rectangle (edge tiles clipped to image size), returned image is converted
+// to tiled image format if required and unloaded after being copied into tiles cache
+TiledImage LoadTiledImageCallback(int width, int height, int format, int tileSize, TiledImageCallback callback, void *userData)
+{
+    TiledImage image = { 0 };
 
-    return success;
+    if (callback == NULL) return image;
+
+    image = LoadTiledImageContext(width, height, format, tileSize);
+
+    if (image.ctxData != NULL)
+    {
+        TiledImageContext *context = ((TiledImageView *)image.ctxData)->context;
+        context->callback = callback;
+        context->userData = userData;
+    }
+
+    return image;
 }
 
-// Export image as code file (.h) defining an array of bytes
-bool ExportImageAsCode(Image image, const char *fileName)
+// Load tiled image region view
+// NOTE: View shares tiles cache with source image, rectangle is clipped to image size
+TiledImage LoadTiledImageView(TiledImage image, Rectangle rec)
 {
-    bool success = false;
+    TiledImage view = { 0 };
+    const TiledImageView *source = (const TiledImageView *)image.ctxData;
 
-#if defined(SUPPORT_IMAGE_EXPORT)
+    if (source == NULL) return view;
 
-#ifndef TEXT_BYTES_PER_LINE
-    #define TEXT_BYTES_PER_LINE     20
-#endif
+    int x = (rec.x < 0)? 0 : (int)rec.x;
+    int y = (rec.y < 0)? 0 : (int)rec.y;
+    int width = (int)(rec.x + rec.width) - x;
+    int height = (int)(rec.y + rec.height) - y;
 
-    int dataSize = GetPixelDataSize(image.width, image.height, image.format);
+    if ((x + width) > image.width) width = image.width - x;
+    if ((y + height) > image.height) height = image.height - y;
 
-    // NOTE: Text data buffer size is estimated considering image data size in bytes
-    // and requiring 6 char bytes for every byte: "0x00, "
-    char *txtData = (char *)RL_CALLOC(dataSize*6 + 2000, sizeof(char));
+    if ((width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Tiled image view rectangle out of image bounds");
+        return view;
+    }
 
-    int byteCount = 0;
-    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
-    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                                //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
+    TiledImageView *ctx = (TiledImageView *)RL_MALLOC(sizeof(TiledImageView));
+    ctx->context = source->context;
+    ctx->x = source->x + x;
+    ctx->y = source->y + y;
+    ctx->context->refCount++;
 
-    // Get file name from path and convert variable name to uppercase
-    char varFileName[256] = { 0 };
-    strcpy(varFileName, GetFileNameWithoutExt(fileName));
-    for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
+    view.width = width;
+    view.height = height;
+    view.format = image.format;
+    view.tileSize = image.tileSize;
+    view.ctxData = ctx;
 
-    // Add image information
-    byteCount += sprintf(txtData + byteCount, "// Image data information\n");
-    byteCount += sprintf(txtData + byteCount, "#define %s_WIDTH    %i\n", varFileName, image.width);
-    byteCount += sprintf(txtData + byteCount, "#define %s_HEIGHT   %i\n", varFileName, image.height);
-    byteCount += sprintf(txtData + byteCount, "#define %s_FORMAT   %i          // raylib internal pixel format\n\n", varFileName, image.format);
+    return view;
+}
 
-    byteCount += sprintf(txtData + byteCount, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
-    for (int i = 0; i < dataSize - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)image.data)[i]);
-    byteCount += sprintf(txtData + byteCount, "0x%x };\n", ((unsigned char *)image.data)[dataSize - 1]);
+// Check if a tiled image is ready
+bool IsTiledImageReady(TiledImage image)
+{
+    return ((image.ctxData != NULL) && (image.width > 0) && (image.height > 0) && (image.tileSize > 0));
+}
 
-    // NOTE: Text data size exported is determined by '\0' (NULL) character
-    success = SaveFileText(fileName, txtData);
+// Unload tiled image
+// NOTE: Tiles cache (and RAW file) is unloaded when last image or view referencing it is unloaded
+void UnloadTiledImage(TiledImage image)
+{
+    TiledImageView *view = (TiledImageView *)image.ctxData;
 
-    RL_FREE(txtData);
+    if (view == NULL) return;
 
-#endif      // SUPPORT_IMAGE_EXPORT
+    TiledImageContext *context = view->context;
+    context->refCount--;
 
-    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image as code exported successfully", fileName);
-    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image as code", fileName);
+    if (context->refCount == 0)
+    {
+        while (context->first >= 0) UnloadTiledImageTile(context, context->first);
+        if (context->file != NULL) fclose(context->file);
 
-    return success;
+        RL_FREE(context->tiles);
+        RL_FREE(context);
+    }
+
+    RL_FREE(view);
 }
 
-//------------------------------------------------------------------------------------
-// Image generation functions
-//------------------------------------------------------------------------------------
-// Generate image: plain color
-Image GenImageColor(int width, int height, Color color)
+// Set tiled image tiles cache memory budget
+// NOTE: Budget is shared by image and views, one tile is always kept loaded
+void SetTiledImageBudget(TiledImage image, unsigned int bytes)
 {
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+    TiledImageView *view = (TiledImageView *)image.ctxData;
 
-    for (int i = 0; i < width*height; i++) pixels[i] = color;
+    if (view == NULL) return;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    TiledImageContext *context = view->context;
+    context->budget = bytes;
 
-    return image;
+    while ((context->memory > context->budget) && (context->last != context->first)) UnloadTiledImageTile(context, context->last);
 }
 
-#if defined(SUPPORT_IMAGE_GENERATION)
-// Generate image: vertical gradient
-Image GenImageGradientV(int width, int height, Color top, Color bottom)
+// Get tiled image pixel color
+Color GetTiledImageColor(TiledImage image, int x, int y)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Color color = { 0 };
 
-    for (int j = 0; j < height; j++)
-    {
-        float factor = (float)j/(float)height;
-        for (int i = 0; i < width; i++)
-        {
-            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
-        }
-    }
+    if ((image.ctxData == NULL) || (x < 0) || (y < 0) || (x >= image.width) || (y >= image.height)) return color;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    int count = 0;
+    const unsigned char *pixel = GetTiledImagePixels(image, x, y, &count);
 
-    return image;
+    LoadRowColors(&color, pixel, 1, image.format);
+
+    return color;
 }
 
-// Generate image: horizontal gradient
-Image GenImageGradientH(int width, int height, Color left, Color right)
+// Create an image from tiled image piece
+// NOTE: Rectangle is clipped to image size, pixels are copied tile row by tile row (tiles loaded once)
+Image ImageFromTiledImage(TiledImage image, Rectangle rec)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Image result = { 0 };
 
-    for (int i = 0; i < width; i++)
+    if (image.ctxData == NULL) return result;
+
+    int x = (rec.x < 0)? 0 : (int)rec.x;
+    int y = (rec.y < 0)? 0 : (int)rec.y;
+    int width = (int)(rec.x + rec.width) - x;
+    int height = (int)(rec.y + rec.height) - y;
+
+    if ((x + width) > image.width) width = image.width - x;
+    if ((y + height) > image.height) height = image.height - y;
+    if ((width <= 0) || (height <= 0)) return result;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+
+    result.data = RL_MALLOC((size_t)width*height*bytesPerPixel);
+    result.width = width;
+    result.height = height;
+    result.format = image.format;
+    result.mipmaps = 1;
+
+    unsigned char *data = (unsigned char *)result.data;
+
+    for (int i = 0; i < width; )
     {
-        float factor = (float)i/(float)width;
+        int count = 0;
+        int rows = 0;
+
+        // Column of tiles intersecting rectangle, copied row by row
         for (int j = 0; j < height; j++)
         {
-            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
+            const unsigned char *pixels = GetTiledImagePixels(image, x + i, y + j, &count);
+            if ((i + count) > width) count = width - i;
+
+            memcpy(data + ((size_t)j*width + i)*bytesPerPixel, pixels, (size_t)count*bytesPerPixel);
+            rows = count;
         }
-    }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+        i += rows;
+    }
 
-    return image;
+    return result;
 }
 
-// Generate image: radial gradient
-Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+// Create an image from tiled image piece scaled to new size
+// NOTE: Every output pixel is the average of the source pixels it covers (box filter), nearest pixel when enlarged,
+// output rows computed from source rows streamed through tiles cache (only one tiles row required in memory)
+Image ImageFromTiledImageScaled(TiledImage image, Rectangle rec, int newWidth, int newHeight)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+    Image result = { 0 };
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
+    if ((image.ctxData == NULL) || (newWidth <= 0) || (newHeight <= 0)) return result;
 
-    for (int y = 0; y < height; y++)
+    int x = (rec.x < 0)? 0 : (int)rec.x;
+    int y = (rec.y < 0)? 0 : (int)rec.y;
+    int width = (int)(rec.x + rec.width) - x;
+    int height = (int)(rec.y + rec.height) - y;
+
+    if ((x + width) > image.width) width = image.width - x;
+    if ((y + height) > image.height) height = image.height - y;
+    if ((width <= 0) || (height <= 0)) return result;
+
+    Color *pixels = (Color *)RL_MALLOC((size_t)newWidth*newHeight*sizeof(Color));
+    Color *row = (Color *)RL_MALLOC(width*sizeof(Color));
+    unsigned int *sums = (unsigned int *)RL_MALLOC(newWidth*4*sizeof(unsigned int));
+    int *columns = (int *)RL_MALLOC((newWidth + 1)*sizeof(int));
+
+    // Source columns range for every output column: [columns[i], columns[i + 1])
+    for (int i = 0; i <= newWidth; i++) columns[i] = (int)((long long)i*width/newWidth);
+
+    for (int j = 0; j < newHeight; j++)
     {
-        for (int x = 0; x < width; x++)
+        int startY = (int)((long long)j*height/newHeight);
+        int endY = (int)((long long)(j + 1)*height/newHeight);
+        if (endY <= startY) endY = startY + 1;
+
+        memset(sums, 0, newWidth*4*sizeof(unsigned int));
+
+        for (int sy = startY; sy < endY; sy++)
         {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
+            // Load source row colors, tile by tile
+            for (int i = 0; i < width; )
+            {
+                int count = 0;
+                const unsigned char *src = GetTiledImagePixels(image, x + i, y + sy, &count);
+                if ((i + count) > width) count = width - i;
+
+                LoadRowColors(row + i, src, count, image.format);
+                i += count;
+            }
+
+            for (int i = 0; i < newWidth; i++)
+            {
+                int startX = columns[i];
+                int endX = (columns[i + 1] > startX)? columns[i + 1] : startX + 1;
+
+                for (int sx = startX; sx < endX; sx++)
+                {
+                    sums[i*4] += row[sx].r;
+                    sums[i*4 + 1] += row[sx].g;
+                    sums[i*4 + 2] += row[sx].b;
+                    sums[i*4 + 3] += row[sx].a;
+                }
+            }
+        }
 
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+        for (int i = 0; i < newWidth; i++)
+        {
+            int endX = (columns[i + 1] > columns[i])? columns[i + 1] : columns[i] + 1;
+            unsigned int area = (unsigned int)((endX - columns[i])*(endY - startY));
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+            pixels[(size_t)j*newWidth + i] = (Color){ (unsigned char)((sums[i*4] + area/2)/area), (unsigned char)((sums[i*4 + 1] + area/2)/area),
+                (unsigned char)((sums[i*4 + 2] + area/2)/area), (unsigned char)((sums[i*4 + 3] + area/2)/area) };
         }
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    RL_FREE(columns);
+    RL_FREE(sums);
+    RL_FREE(row);
 
-    return image;
+    result.data = pixels;
+    result.width = newWidth;
+    result.height = newHeight;
+    result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    result.mipmaps = 1;
+
+    return result;
 }
 
-// Generate image: checked
-Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+// Draw a source tiled image piece within a destination image
+// NOTE: Unscaled pieces are drawn tile by tile with ImageDraw() (no pixels copied),
+// scaled pieces are scaled with ImageFromTiledImageScaled() to destination size first
+void ImageDrawTiledImage(Image *dst, TiledImage src, Rectangle srcRec, Rectangle dstRec, Color tint)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    if ((dst->data == NULL) || (src.ctxData == NULL)) return;
 
-    for (int y = 0; y < height; y++)
+    if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
     {
-        for (int x = 0; x < width; x++)
+        Image scaled = ImageFromTiledImageScaled(src, srcRec, (int)dstRec.width, (int)dstRec.height);
+
+        if (scaled.data != NULL) ImageDraw(dst, scaled, (Rectangle){ 0, 0, (float)scaled.width, (float)scaled.height }, dstRec, tint);
+
+        UnloadImage(scaled);
+        return;
+    }
+
+    const TiledImageView *view = (const TiledImageView *)src.ctxData;
+    const TiledImageContext *context = view->context;
+
+    int x = (srcRec.x < 0)? 0 : (int)srcRec.x;
+    int y = (srcRec.y < 0)? 0 : (int)srcRec.y;
+    int endX = (int)(srcRec.x + srcRec.width);
+    int endY = (int)(srcRec.y + srcRec.height);
+
+    if (endX > src.width) endX = src.width;
+    if (endY > src.height) endY = src.height;
+
+    // Source rectangle tiles in source context coordinates
+    for (int ty = (view->y + y)/context->tileSize; ty*context->tileSize < (view->y + endY); ty++)
+    {
+        for (int tx = (view->x + x)/context->tileSize; tx*context->tileSize < (view->x + endX); tx++)
         {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
+            int tileX = tx*context->tileSize - view->x;     // Tile position in view coordinates
+            int tileY = ty*context->tileSize - view->y;
+
+            int pieceX = (tileX > x)? tileX : x;
+            int pieceY = (tileY > y)? tileY : y;
+            int pieceEndX = ((tileX + context->tileSize) < endX)? (tileX + context->tileSize) : endX;
+            int pieceEndY = ((tileY + context->tileSize) < endY)? (tileY + context->tileSize) : endY;
+
+            int count = 0;
+            GetTiledImagePixels(src, pieceX, pieceY, &count);
+
+            // Tile image referencing cached tile pixels
+            const TiledImageTile *tile = &context->tiles[ty*context->tilesX + tx];
+            Image tileImage = {
+                .data = tile->data,
+                .width = ((context->width - tx*context->tileSize) < context->tileSize)? (context->width - tx*context->tileSize) : context->tileSize,
+                .height = ((context->height - ty*context->tileSize) < context->tileSize)? (context->height - ty*context->tileSize) : context->tileSize,
+                .format = context->format,
+                .mipmaps = 1
+            };
+
+            Rectangle piece = { (float)(pieceX - tileX), (float)(pieceY - tileY), (float)(pieceEndX - pieceX), (float)(pieceEndY - pieceY) };
+            Rectangle target = { dstRec.x + (float)(pieceX - (int)srcRec.x), dstRec.y + (float)(pieceY - (int)srcRec.y), piece.width, piece.height };
+
+            ImageDraw(dst, tileImage, piece, target, tint);
         }
     }
+}
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
-
-    return image;
-}
-
-// Generate image: white noise
-Image GenImageWhiteNoise(int width, int height, float factor)
+// Load image from memory buffer, fileType refers to extension: i.e. ".png"
+// NOTE: Registered image decoders are checked first, built-in decoders used if not registered or not supported data
+// WARNING: File extension must be provided in lower-case
+Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Image image = { 0 };
+    const ImageDecoder *decoder = GetImageDecoder(fileType);
 
-    for (int i = 0; i < width*height; i++)
+    if ((decoder != NULL) && (fileData != NULL) && decoder->probe(fileData, dataSize, &image.width, &image.height, &image.format))
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
+        int size = GetPixelDataSize(image.width, image.height, image.format);
+        image.data = RL_MALLOC(size);
+        image.mipmaps = 1;
+
+        if (!decoder->decode(fileData, dataSize, image.data, size))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Registered decoder failed to decode data, using built-in decoder");
+            RL_FREE(image.data);
+            image = (Image){ 0 };
+        }
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    if (image.data != NULL)
+    {
+        // Image decoded by registered decoder
+    }
+    else if ((false)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        || (strcmp(fileType, ".png") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+        || (strcmp(fileType, ".bmp") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+        || (strcmp(fileType, ".tga") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+        || ((strcmp(fileType, ".jpg") == 0) || (strcmp(fileType, ".jpeg") == 0))
+#endif
+#if defined(SUPPORT_FILEFORMAT_GIF)
+        || (strcmp(fileType, ".gif") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PIC)
+        || (strcmp(fileType, ".pic") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNM)
+        || ((strcmp(fileType, ".ppm") == 0) || (strcmp(fileType, ".pgm") == 0))
+#endif
+#if defined(SUPPORT_FILEFORMAT_PSD)
+        || (strcmp(fileType, ".psd") == 0)
+#endif
+        )
+    {
+#if defined(STBI_REQUIRED)
+        // NOTE: Using stb_image to load images (Supports multiple image formats)
 
-    return image;
-}
+        if (fileData != NULL)
+        {
+            int comp = 0;
+            image.data = stbi_load_from_memory(fileData, dataSize, &image.width, &image.height, &comp, 0);
 
-// Generate image: perlin noise
-Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
-{
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+            if (image.data != NULL)
+            {
+                image.mipmaps = 1;
 
-    for (int y = 0; y < height; y++)
+                if (comp == 1) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                else if (comp == 2) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+                else if (comp == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                else if (comp == 4) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+        }
+#endif
+    }
+#if defined(SUPPORT_FILEFORMAT_HDR)
+    else if (strcmp(fileType, ".hdr") == 0)
     {
-        for (int x = 0; x < width; x++)
+#if defined(STBI_REQUIRED)
+        if (fileData != NULL)
         {
-            float nx = (float)(x + offsetX)*scale/(float)width;
-            float ny = (float)(y + offsetY)*scale/(float)height;
-
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            int comp = 0;
+            image.data = stbi_loadf_from_memory(fileData, dataSize, &image.width, &image.height, &comp, 0);
 
-            // NOTE: We need to translate the data from [-1..1] to [0..1]
-            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
+            image.mipmaps = 1;
 
-            int intensity = (int)(p*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+            if (comp == 1) image.format = PIXELFORMAT_UNCOMPRESSED_R32;
+            else if (comp == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32;
+            else if (comp == 4) image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+            else
+            {
+                TRACELOG(LOG_WARNING, "IMAGE: HDR file format not supported");
+                UnloadImage(image);
+            }
         }
+#endif
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    else if (strcmp(fileType, ".qoi") == 0)
+    {
+        qoi_desc desc = { 0 };
+        image.data = qoi_decode(fileData, dataSize, &desc, 4);
+        image.width = desc.width;
+        image.height = desc.height;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image.mipmaps = 1;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (strcmp(fileType, ".dds") == 0)
+    {
+        image.data = rl_load_dds_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PKM)
+    else if (strcmp(fileType, ".pkm") == 0)
+    {
+        image.data = rl_load_pkm_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (strcmp(fileType, ".ktx") == 0)
+    {
+        image.data = rl_load_ktx_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+    else if (strcmp(fileType, ".ktx2") == 0)
+    {
+        image.data = rl_load_ktx2_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PVR)
+    else if (strcmp(fileType, ".pvr") == 0)
+    {
+        image.data = rl_load_pvr_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+    else if (strcmp(fileType, ".astc") == 0)
+    {
+        image.data = rl_load_astc_from_memory(fileData, dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
     }
+#endif
+    else TRACELOG(LOG_WARNING, "IMAGE: Data format not supported");
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    if (image.data != NULL) TRACELOG(LOG_INFO, "IMAGE: Data loaded successfully (%ix%i | %s | %i mipmaps)", image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to load image data");
 
     return image;
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
-Image GenImageCellular(int width, int height, int tileSize)
+// Register image decoder for file type (i.e. ".jpg"), checked before built-in decoders
+// NOTE: Probe callback could reject data (built-in decoder is used), NULL decode unregisters file type decoder,
+// decoders are called from loader thread (LoadTextureAsync()), register them before loading
+bool RegisterImageDecoder(const char *fileType, ImageProbeCallback probe, ImageDecodeCallback decode)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    if ((fileType == NULL) || (strlen(fileType) >= sizeof(imageDecoders[0].fileType))) return false;
 
-    int seedsPerRow = width/tileSize;
-    int seedsPerCol = height/tileSize;
-    int seedCount = seedsPerRow*seedsPerCol;
+    for (int i = 0; i < imageDecoderCount; i++)
+    {
+        if (strcmp(imageDecoders[i].fileType, fileType) == 0)
+        {
+            if ((probe != NULL) && (decode != NULL))
+            {
+                imageDecoders[i].probe = probe;
+                imageDecoders[i].decode = decode;
+            }
+            else
+            {
+                imageDecoders[i] = imageDecoders[imageDecoderCount - 1];
+                imageDecoderCount--;
+            }
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+            return true;
+        }
+    }
 
-    for (int i = 0; i < seedCount; i++)
+    if ((probe == NULL) || (decode == NULL)) return false;
+
+    if (imageDecoderCount == MAX_IMAGE_DECODERS)
     {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
+        TRACELOG(LOG_WARNING, "IMAGE: Image decoders limit reached (MAX_IMAGE_DECODERS: %i)", MAX_IMAGE_DECODERS);
+        return false;
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
+    strcpy(imageDecoders[imageDecoderCount].fileType, fileType);
+    imageDecoders[imageDecoderCount].probe = probe;
+    imageDecoders[imageDecoderCount].decode = decode;
+    imageDecoderCount++;
 
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
+    TRACELOG(LOG_INFO, "IMAGE: Image decoder registered for file type: %s", fileType);
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+    return true;
+}
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+// Get image size and pixel format from file data without decoding
+// NOTE: Supported by registered decoders and built-in uncompressed formats (stb_image formats, QOI),
+// format is the one provided by LoadImageFromMemory()
+bool GetImageInfoFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *width, int *height, int *format)
+{
+    bool result = false;
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+    if ((fileData == NULL) || (dataSize <= 0)) return false;
 
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+    const ImageDecoder *decoder = GetImageDecoder(fileType);
+    if (decoder != NULL) result = decoder->probe(fileData, dataSize, width, height, format);
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
+    if (!result)
+    {
+        int comp = 0;
+
+#if defined(STBI_REQUIRED)
+        if (stbi_info_from_memory(fileData, dataSize, width, height, &comp))
+        {
+            result = true;
+#if defined(SUPPORT_FILEFORMAT_HDR)
+            if (strcmp(fileType, ".hdr") == 0)
+            {
+                if (comp == 1) *format = PIXELFORMAT_UNCOMPRESSED_R32;
+                else if (comp == 3) *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32;
+                else if (comp == 4) *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+                else result = false;
+            }
+            else
+#endif
+            {
+                if (comp == 1) *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                else if (comp == 2) *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+                else if (comp == 3) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                else if (comp == 4) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                else result = false;
             }
+        }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+        if (!result && (strcmp(fileType, ".qoi") == 0) && (dataSize >= 14) && (memcmp(fileData, "qoif", 4) == 0))
+        {
+            // NOTE: QOI images are always decoded as RGBA
+            *width = (int)READ_BE32(fileData + 4);
+            *height = (int)READ_BE32(fileData + 8);
+            *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            result = true;
+        }
+#endif
+        (void)comp;
+    }
 
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    return result;
+}
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
+// Decode image from memory into provided pixels memory, size and format from GetImageInfoFromMemory()
+// NOTE: Registered decoders decode directly into pixels memory, built-in decoders decoded data is copied
+bool LoadImageFromMemoryInto(const char *fileType, const unsigned char *fileData, int dataSize, void *pixels, int pixelsSize)
+{
+    int width = 0;
+    int height = 0;
+    int format = 0;
+
+    if ((pixels == NULL) || !GetImageInfoFromMemory(fileType, fileData, dataSize, &width, &height, &format)) return false;
+
+    int size = GetPixelDataSize(width, height, format);
+
+    if (pixelsSize < size)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pixels memory too small to decode image (required: %i bytes)", size);
+        return false;
     }
 
-    RL_FREE(seeds);
+    const ImageDecoder *decoder = GetImageDecoder(fileType);
+    if ((decoder != NULL) && decoder->decode(fileData, dataSize, pixels, pixelsSize)) return true;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    Image image = LoadImageFromMemory(fileType, fileData, dataSize);
+    bool result = ((image.data != NULL) && (image.width == width) && (image.height == height) && (image.format == format));
 
-    return image;
+    if (result) memcpy(pixels, image.data, size);
+    UnloadImage(image);
+
+    return result;
 }
 
-// Generate image: grayscale image from text data
-Image GenImageText(int width, int height, const char *text)
+// Load image from GPU texture data
+// NOTE: Compressed texture formats not supported
+Image LoadImageFromTexture(Texture2D texture)
 {
     Image image = { 0 };
 
-    int textLength = TextLength(text);
-    int imageViewSize = width*height;
+    if (texture.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        image.data = rlReadTexturePixels(texture.id, texture.width, texture.height, texture.format);
 
-    image.width = width;
-    image.height = height;
-    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    image.data = RL_CALLOC(imageViewSize, 1);
-    image.mipmaps = 1;
+        if (image.data != NULL)
+        {
+            image.width = texture.width;
+            image.height = texture.height;
+            image.format = texture.format;
+            image.mipmaps = 1;
 
-    memcpy(image.data, text, (textLength > imageViewSize)? imageViewSize : textLength);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
+            // coming from FBO color buffer attachment, but it seems
+            // original texture format is retrieved on RPI...
+            image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+#endif
+            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Pixel data retrieved successfully", texture.id);
+        }
+        else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve pixel data", texture.id);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve compressed pixel data", texture.id);
 
     return image;
 }
-#endif      // SUPPORT_IMAGE_GENERATION
 
-//------------------------------------------------------------------------------------
-// Image manipulation functions
-//------------------------------------------------------------------------------------
-// Copy an image to a new image
-Image ImageCopy(Image image)
+// Load image from screen buffer and (screenshot)
+Image LoadImageFromScreen(void)
 {
-    Image newImage = { 0 };
-
-    int width = image.width;
-    int height = image.height;
-    int size = 0;
-
-    for (int i = 0; i < image.mipmaps; i++)
-    {
-        size += GetPixelDataSize(width, height, image.format);
-
-        width /= 2;
-        height /= 2;
-
-        // Security check for NPOT textures
-        if (width < 1) width = 1;
-        if (height < 1) height = 1;
-    }
-
-    newImage.data = RL_MALLOC(size);
+    Image image = { 0 };
 
-    if (newImage.data != NULL)
-    {
-        // NOTE: Size must be provided in bytes
-        memcpy(newImage.data, image.data, size);
+    image.width = GetScreenWidth();
+    image.height = GetScreenHeight();
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.data = rlReadScreenPixels(image.width, image.height);
 
-        newImage.width = image.width;
-        newImage.height = image.height;
-        newImage.mipmaps = image.mipmaps;
-        newImage.format = image.format;
-    }
+    return image;
+}
 
-    return newImage;
+// Check if an image is ready
+bool IsImageReady(Image image)
+{
+    return ((image.data != NULL) &&     // Validate pixel data available
+            (image.width > 0) &&
+            (image.height > 0) &&       // Validate image size
+            (image.format > 0) &&       // Validate image format
+            (image.mipmaps > 0));       // Validate image mipmaps (at least 1 for basic mipmap level)
 }
 
-// Create an image from another image piece
-Image ImageFromImage(Image image, Rectangle rec)
+// Unload image from CPU memory (RAM)
+void UnloadImage(Image image)
 {
-    Image result = { 0 };
+    RL_FREE(image.data);
+}
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+// Export image data to file
+// NOTE: File format depends on fileName extension
+bool ExportImage(Image image, const char *fileName)
+{
+    int success = 0;
 
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
+#if defined(SUPPORT_IMAGE_EXPORT)
+    int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
 
-    for (int y = 0; y < (int)rec.height; y++)
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
     {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageColors(image);
+        allocatedData = true;
     }
 
-    return result;
-}
-
-// Crop an image to area defined by a rectangle
-// NOTE: Security checks are performed in case rectangle goes out of bounds
-void ImageCrop(Image *image, Rectangle crop)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    // Security checks to validate crop rectangle
-    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
-    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
-    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
-    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
-    if ((crop.x > image->width) || (crop.y > image->height))
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png"))
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
-        return;
+        int dataSize = 0;
+    #if defined(SUPPORT_COMPRESSION_API)
+        unsigned char *fileData = ExportImagePNGToMemory((const unsigned char *)imgData, image.width, image.height, channels, &dataSize);
+    #else
+        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+    #endif
+        success = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
     }
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+#else
+    if (false) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+    else if (IsFileExtension(fileName, ".bmp")) success = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+    else if (IsFileExtension(fileName, ".tga")) success = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+    else if (IsFileExtension(fileName, ".jpg") ||
+             IsFileExtension(fileName, ".jpeg")) success = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    else if (IsFileExtension(fileName, ".qoi"))
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
+        channels = 0;
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
 
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
+        if ((channels == 3) || (channels == 4))
         {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
-        }
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
 
-        /*
-        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
-        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
-        {
-            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
-            {
-                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
+            success = qoi_write(fileName, imgData, &desc);
         }
-        */
-
-        RL_FREE(image->data);
-        image->data = croppedData;
-        image->width = (int)crop.width;
-        image->height = (int)crop.height;
     }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (IsFileExtension(fileName, ".ktx"))
+    {
+        success = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+#endif
+    else if (IsFileExtension(fileName, ".raw"))
+    {
+        // Export raw pixel data (without header)
+        // NOTE: It's up to the user to track image parameters
+        success = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
+    }
+
+    if (allocatedData) RL_FREE(imgData);
+#endif      // SUPPORT_IMAGE_EXPORT
+
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+
+    return success;
 }
 
-// Convert image data to desired format
-void ImageFormat(Image *image, int newFormat)
+// Export image as code file (.h) defining an array of bytes
+bool ExportImageAsCode(Image image, const char *fileName)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    bool success = false;
 
-    if ((newFormat != 0) && (image->format != newFormat))
-    {
-        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
-        {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+#if defined(SUPPORT_IMAGE_EXPORT)
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+#ifndef TEXT_BYTES_PER_LINE
+    #define TEXT_BYTES_PER_LINE     20
+#endif
 
-            int k = 0;
+    int dataSize = GetPixelDataSize(image.width, image.height, image.format);
 
-            switch (image->format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+    // NOTE: Text data buffer size is estimated considering image data size in bytes
+    // and requiring 6 char bytes for every byte: "0x00, "
+    char *txtData = (char *)RL_CALLOC(dataSize*6 + 2000, sizeof(char));
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
+    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2018-2023 Ramon Santamaria (@raysan5)                                //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+    // Get file name from path and convert variable name to uppercase
+    char varFileName[256] = { 0 };
+    strcpy(varFileName, GetFileNameWithoutExt(fileName));
+    for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
 
-                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+    // Add image information
+    byteCount += sprintf(txtData + byteCount, "// Image data information\n");
+    byteCount += sprintf(txtData + byteCount, "#define %s_WIDTH    %i\n", varFileName, image.width);
+    byteCount += sprintf(txtData + byteCount, "#define %s_HEIGHT   %i\n", varFileName, image.height);
+    byteCount += sprintf(txtData + byteCount, "#define %s_FORMAT   %i          // raylib internal pixel format\n\n", varFileName, image.format);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    byteCount += sprintf(txtData + byteCount, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
+    for (int i = 0; i < dataSize - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)image.data)[i]);
+    byteCount += sprintf(txtData + byteCount, "0x%x };\n", ((unsigned char *)image.data)[dataSize - 1]);
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = SaveFileText(fileName, txtData);
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+    RL_FREE(txtData);
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+#endif      // SUPPORT_IMAGE_EXPORT
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image as code exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image as code", fileName);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    return success;
+}
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+//------------------------------------------------------------------------------------
+// Image generation functions
+//------------------------------------------------------------------------------------
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+    if ((pixels != NULL) && (width > 0) && (height > 0))
+    {
+        pixels[0] = color;
+        ImageFillRec(&image, 0, 0, width, height);
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    return image;
+}
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate image: vertical gradient
+Image GenImageGradientV(int width, int height, Color top, Color bottom)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+    for (int j = 0; j < height; j++)
+    {
+        float factor = (float)j/(float)height;
+        for (int i = 0; i < width; i++)
+        {
+            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
+        }
+    }
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+    return image;
+}
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+// Generate image: horizontal gradient
+Image GenImageGradientH(int width, int height, Color left, Color right)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+    for (int i = 0; i < width; i++)
+    {
+        float factor = (float)i/(float)width;
+        for (int j = 0; j < height; j++)
+        {
+            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
+        }
+    }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+    return image;
+}
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                default: break;
-            }
+// Generate image: radial gradient
+Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+{
+    return GenImageGradientRadialRec(width, height, density, inner, outer, (Rectangle){ 0, 0, (float)width, (float)height });
+}
 
-            RL_FREE(pixels);
-            pixels = NULL;
+// Generate image: checked
+Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
-            {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
-            }
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
+            else pixels[y*width + x] = col2;
         }
-        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
+
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
+
+    return image;
 }
 
-// Create an image from text (default font)
-Image ImageText(const char *text, int fontSize, Color color)
+// Generate image: white noise
+Image GenImageWhiteNoise(int width, int height, float factor)
 {
-    Image imText = { 0 };
-#if defined(SUPPORT_MODULE_RTEXT)
-    int defaultFontSize = 10;   // Default Font chars height in pixel
-    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-    int spacing = fontSize/defaultFontSize;
-    imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);   // WARNING: Module required: rtext
-#else
-    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
-    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
-#endif
-    return imText;
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int i = 0; i < width*height; i++)
+    {
+        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
+        else pixels[i] = BLACK;
+    }
+
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
+
+    return image;
 }
 
-// Create an image from text (custom sprite font)
-Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+// Generate image: perlin noise
+Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
-    Image imText = { 0 };
-#if defined(SUPPORT_MODULE_RTEXT)
-    int size = (int)strlen(text);   // Get size in bytes of text
-
-    int textOffsetX = 0;            // Image drawing position X
-    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    return GenImagePerlinNoiseRec(width, height, offsetX, offsetY, scale, (Rectangle){ 0, 0, (float)width, (float)height });
+}
 
-    // NOTE: Text image is generated at font base size, later scaled to desired font size
-    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
-    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+Image GenImageCellular(int width, int height, int tileSize)
+{
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+    int seedCount = seedsPerRow*seedsPerCol;
 
-    // Create image to store text
-    imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
+    int *seeds = (int *)RL_MALLOC(seedCount*2*sizeof(int));
 
-    for (int i = 0; i < size; i++)
+    for (int i = 0; i < seedCount; i++)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
-        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
-
-        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all the bad bytes using the '?' symbol moving one byte
-        if (codepoint == 0x3f) codepointByteCount = 1;
+        seeds[i*2 + 1] = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i*2] = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+    }
 
-        if (codepoint == '\n')
-        {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (font.baseSize + font.baseSize/2);
-            textOffsetX = 0;
-        }
-        else
-        {
-            if ((codepoint != ' ') && (codepoint != '\t'))
-            {
-                Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
-                ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
-            }
+    ImageGenJob job = { 0 };
+    job.seeds = seeds;
+    job.seedsPerRow = seedsPerRow;
+    job.seedsPerCol = seedsPerCol;
+    job.tileSize = tileSize;
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
-            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
-        }
+    Image image = GenImageRec((Rectangle){ 0, 0, (float)width, (float)height }, &job, GenImageCellularRows);
 
-        i += (codepointByteCount - 1);   // Move text bytes counter to next codepoint
-    }
+    RL_FREE(seeds);
 
-    // Scale image depending on text size
-    if (textSize.y != imSize.y)
-    {
-        float scaleFactor = textSize.y / imSize.y;
-        TRACELOG(LOG_INFO, "IMAGE: Text scaled by factor: %f", scaleFactor);
+    return image;
+}
 
-        // Using nearest-neighbor scaling algorithm for default font
-        // TODO: Allow defining the preferred scaling mechanism externally
-        // WARNING: Module required: rtext
-        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-    }
-#else
-    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
-    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
-#endif
-    return imText;
+// Generate image: radial gradient, rectangle of width*height gradient
+// NOTE: Rectangle can exceed gradient image, outer color is used outside radius
+Image GenImageGradientRadialRec(int width, int height, float density, Color inner, Color outer, Rectangle rec)
+{
+    ImageGenJob job = { 0 };
+    job.imageWidth = width;
+    job.imageHeight = height;
+    job.params[0] = density;
+    job.colors[0] = inner;
+    job.colors[1] = outer;
+
+    return GenImageRec(rec, &job, GenImageRadialRows);
 }
 
-// Resize and image to new size using Nearest-Neighbor scaling algorithm
-void ImageResizeNN(Image *image,int newWidth,int newHeight)
+// Generate image: perlin noise, rectangle of width*height noise
+// NOTE: Noise is continuous across rectangles, tiles of an infinite noise can be generated with any rectangle position
+Image GenImagePerlinNoiseRec(int width, int height, int offsetX, int offsetY, float scale, Rectangle rec)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    ImageGenJob job = { 0 };
+    job.imageWidth = width;
+    job.imageHeight = height;
+    job.params[0] = (float)offsetX;
+    job.params[1] = (float)offsetY;
+    job.params[2] = scale;
+
+    return GenImageRec(rec, &job, GenImagePerlinRows);
+}
 
-    Color *pixels = LoadImageColors(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+// Generate image: infinite cellular pattern rectangle
+// NOTE: One seed per tile, seed position hashed from tile position and seed, rectangles of same seed are continuous
+Image GenImageCellularRec(int tileSize, unsigned int seed, Rectangle rec)
+{
+    ImageGenJob job = { 0 };
+    job.tileSize = (tileSize > 0)? tileSize : 1;
+    job.seed = seed;
 
-    // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+    return GenImageRec(rec, &job, GenImageCellularRows);
+}
 
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
-    {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
+// Generate image: infinite white noise rectangle
+// NOTE: Pixels hashed from position and seed, GenImageWhiteNoise() uses GetRandomValue() sequence instead
+Image GenImageWhiteNoiseRec(float factor, unsigned int seed, Rectangle rec)
+{
+    ImageGenJob job = { 0 };
+    job.params[0] = factor;
+    job.seed = seed;
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
-    }
+    return GenImageRec(rec, &job, GenImageWhiteNoiseRows);
+}
 
-    int format = image->format;
+// Generate image: grayscale image from text data
+Image GenImageText(int width, int height, const char *text)
+{
+    Image image = { 0 };
 
-    RL_FREE(image->data);
+    int textLength = TextLength(text);
+    int imageViewSize = width*height;
 
-    image->data = output;
-    image->width = newWidth;
-    image->height = newHeight;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.width = width;
+    image.height = height;
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    image.data = RL_CALLOC(imageViewSize, 1);
+    image.mipmaps = 1;
 
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    memcpy(image.data, text, (textLength > imageViewSize)? imageViewSize : textLength);
 
-    UnloadImageColors(pixels);
+    return image;
 }
+#endif      // SUPPORT_IMAGE_GENERATION
 
-
-// Resize and image to new size
-// NOTE: Uses stb default scaling filters (both bicubic):
-// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
-// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
-void ImageResize(Image *image, int newWidth, int newHeight)
+//------------------------------------------------------------------------------------
+// Image manipulation functions
+//------------------------------------------------------------------------------------
+// Copy an image to a new image
+Image ImageCopy(Image image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image newImage = { 0 };
+
+    int width = image.width;
+    int height = image.height;
+    int size = 0;
 
-    // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    for (int i = 0; i < image.mipmaps; i++)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        size += GetPixelDataSize(width, height, image.format);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 4); break;
-            default: break;
-        }
+        width /= 2;
+        height /= 2;
 
-        RL_FREE(image->data);
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
     }
-    else
+
+    newImage.data = RL_MALLOC(size);
+
+    if (newImage.data != NULL)
     {
-        // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
-        Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+        // NOTE: Size must be provided in bytes
+        memcpy(newImage.data, image.data, size);
 
-        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
+        newImage.width = image.width;
+        newImage.height = image.height;
+        newImage.mipmaps = image.mipmaps;
+        newImage.format = image.format;
+    }
 
-        int format = image->format;
+    return newImage;
+}
 
-        UnloadImageColors(pixels);
-        RL_FREE(image->data);
+// Create an image from another image piece
+Image ImageFromImage(Image image, Rectangle rec)
+{
+    Image result = { 0 };
 
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
-        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
 
-        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    result.width = (int)rec.width;
+    result.height = (int)rec.height;
+    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
+    result.format = image.format;
+    result.mipmaps = 1;
+
+    for (int y = 0; y < (int)rec.height; y++)
+    {
+        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
     }
+
+    return result;
 }
 
-// Resize canvas and fill with color
-// NOTE: Resize offset is relative to the top-left corner of the original image
-void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill)
+// Crop an image to area defined by a rectangle
+// NOTE: Security checks are performed in case rectangle goes out of bounds
+void ImageCrop(Image *image, Rectangle crop)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Security checks to validate crop rectangle
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
+    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
+    if ((crop.x > image->width) || (crop.y > image->height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
+        return;
+    }
+
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else if ((newWidth != image->width) || (newHeight != image->height))
+    else
     {
-        Rectangle srcRec = { 0, 0, (float)image->width, (float)image->height };
-        Vector2 dstPos = { (float)offsetX, (float)offsetY };
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-        if (offsetX < 0)
-        {
-            srcRec.x = (float)-offsetX;
-            srcRec.width += (float)offsetX;
-            dstPos.x = 0;
-        }
-        else if ((offsetX + image->width) > newWidth) srcRec.width = (float)(newWidth - offsetX);
+        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
 
-        if (offsetY < 0)
+        // OPTION 1: Move cropped data line-by-line
+        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
         {
-            srcRec.y = (float)-offsetY;
-            srcRec.height += (float)offsetY;
-            dstPos.y = 0;
+            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
+            offsetSize += ((int)crop.width*bytesPerPixel);
         }
-        else if ((offsetY + image->height) > newHeight) srcRec.height = (float)(newHeight - offsetY);
-
-        if (newWidth < srcRec.width) srcRec.width = (float)newWidth;
-        if (newHeight < srcRec.height) srcRec.height = (float)newHeight;
-
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *resizedData = (unsigned char *)RL_CALLOC(newWidth*newHeight*bytesPerPixel, 1);
 
-        // TODO: Fill resized canvas with fill color (must be formatted to image->format)
-
-        int dstOffsetSize = ((int)dstPos.y*newWidth + (int)dstPos.x)*bytesPerPixel;
-
-        for (int y = 0; y < (int)srcRec.height; y++)
+        /*
+        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
+        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
         {
-            memcpy(resizedData + dstOffsetSize, ((unsigned char *)image->data) + ((y + (int)srcRec.y)*image->width + (int)srcRec.x)*bytesPerPixel, (int)srcRec.width*bytesPerPixel);
-            dstOffsetSize += (newWidth*bytesPerPixel);
+            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
+            {
+                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
+            }
         }
+        */
 
         RL_FREE(image->data);
-        image->data = resizedData;
-        image->width = newWidth;
-        image->height = newHeight;
+        image->data = croppedData;
+        image->width = (int)crop.width;
+        image->height = (int)crop.height;
     }
 }
 
-#if defined(SUPPORT_IMAGE_MANIPULATION)
-// Convert image to POT (power-of-two)
-// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
-void ImageToPOT(Image *image, Color fill)
+// Convert image data to desired format
+void ImageFormat(Image *image, int newFormat)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // Calculate next power-of-two values
-    // NOTE: Just add the required amount of pixels at the right and bottom sides of image...
-    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
-    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
-
-    // Check if POT texture generation is required (if texture is not already POT)
-    if ((potWidth != image->width) || (potHeight != image->height)) ImageResizeCanvas(image, potWidth, potHeight, 0, 0, fill);
-}
+    if ((newFormat != 0) && (image->format != newFormat))
+    {
+        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            // Common formats pairs are converted directly, no normalized float pixels required
+            if (ImageFormatDirect(image, newFormat)) return;
 
-// Crop image depending on alpha value
-// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
-void ImageAlphaCrop(Image *image, float threshold)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-    Rectangle crop = GetImageAlphaBorder(*image, threshold);
-
-    // Crop if rectangle is valid
-    if (((int)crop.width != 0) && ((int)crop.height != 0)) ImageCrop(image, crop);
-}
+            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            image->data = NULL;
+            image->format = newFormat;
 
-// Clear alpha channel to desired color
-// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
-void ImageAlphaClear(Image *image, Color color, float threshold)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+            int k = 0;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            switch (image->format)
             {
-                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
-                for (int i = 1; i < image->width*image->height*2; i += 2)
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                 {
-                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((unsigned char *)image->data)[i - 1] = color.r;
-                        ((unsigned char *)image->data)[i] = color.a;
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned char thresholdValue = ((threshold < 0.5f)? 0 : 1);
 
-                unsigned char r = (unsigned char)(round((float)color.r*31.0f));
-                unsigned char g = (unsigned char)(round((float)color.g*31.0f));
-                unsigned char b = (unsigned char)(round((float)color.b*31.0f));
-                unsigned char a = (color.a < 128)? 0 : 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                for (int i = 0; i < image->width*image->height; i++)
+                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                    }
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                 {
-                    if ((((unsigned short *)image->data)[i] & 0b0000000000000001) <= thresholdValue)
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*63.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-            {
-                unsigned char thresholdValue = (unsigned char)(threshold*15.0f);
 
-                unsigned char r = (unsigned char)(round((float)color.r*15.0f));
-                unsigned char g = (unsigned char)(round((float)color.g*15.0f));
-                unsigned char b = (unsigned char)(round((float)color.b*15.0f));
-                unsigned char a = (unsigned char)(round((float)color.a*15.0f));
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                for (int i = 0; i < image->width*image->height; i++)
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
                 {
-                    if ((((unsigned short *)image->data)[i] & 0x000f) <= thresholdValue)
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*31.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
-                for (int i = 3; i < image->width*image->height*4; i += 4)
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                 {
-                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
+
+                    for (int i = 0; i < image->width*image->height; i++)
                     {
-                        ((unsigned char *)image->data)[i - 3] = color.r;
-                        ((unsigned char *)image->data)[i - 2] = color.g;
-                        ((unsigned char *)image->data)[i - 1] = color.b;
-                        ((unsigned char *)image->data)[i] = color.a;
+                        r = (unsigned char)(round(pixels[i].x*15.0f));
+                        g = (unsigned char)(round(pixels[i].y*15.0f));
+                        b = (unsigned char)(round(pixels[i].z*15.0f));
+                        a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
                     }
-                }
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                for (int i = 3; i < image->width*image->height*4; i += 4)
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                 {
-                    if (((float *)image->data)[i] <= threshold)
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
                     {
-                        ((float *)image->data)[i - 3] = (float)color.r/255.0f;
-                        ((float *)image->data)[i - 2] = (float)color.g/255.0f;
-                        ((float *)image->data)[i - 1] = (float)color.b/255.0f;
-                        ((float *)image->data)[i] = (float)color.a/255.0f;
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
                     }
-                }
-            } break;
-            default: break;
-        }
-    }
-}
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
 
-// Apply alpha mask to image
-// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
-// NOTE 2: alphaMask should be same size as image
-void ImageAlphaMask(Image *image, Image alphaMask)
-{
-    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask must be same size as image");
-    }
-    else if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask can not be applied to compressed data formats");
-    }
-    else
-    {
-        // Force mask to be Grayscale
-        Image mask = ImageCopy(alphaMask);
-        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-        // In case image is only grayscale, we just add alpha channel
-        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-        {
-            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
-            {
-                data[k] = ((unsigned char *)image->data)[i];
-                data[k + 1] = ((unsigned char *)mask.data)[i];
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
+                    }
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    {
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
+                        ((float *)image->data)[i + 3] = pixels[k].w;
+                    }
+                } break;
+                default: break;
             }
 
-            RL_FREE(image->data);
-            image->data = data;
-            image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
-        }
-        else
-        {
-            // Convert image to RGBA
-            if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            RL_FREE(pixels);
+            pixels = NULL;
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
             {
-                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (image->data != NULL) ImageMipmaps(image);
+            #endif
             }
         }
-
-        UnloadImage(mask);
+        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
-// Premultiply alpha channel
-void ImageAlphaPremultiply(Image *image)
+// Compress image data to GPU compressed format (DXT, ETC1, ETC2), quality [0..100]
+// NOTE 1: Supported formats: DXT1 RGB/RGBA, DXT3, DXT5, ETC1, ETC2 RGB, ETC2 EAC RGBA
+// NOTE 2: Image size must be multiple of 4, mipmaps levels not multiple of 4 (bigger than one block) are discarded
+// NOTE 3: Low quality uses blocks bounds as color endpoints, high quality refines color endpoints and ETC base colors
+void ImageCompress(Image *image, int compressedFormat, int quality)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed again");
+        return;
     }
 
-    RL_FREE(image->data);
-
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
-}
+    switch (compressedFormat)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: break;
+        default:
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for runtime compression");
+            return;
+        }
+    }
 
-// Apply box blur
-void ImageBlurGaussian(Image *image, int blurSize) {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if (((image->width%4) != 0) || ((image->height%4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image size must be multiple of 4 to be compressed");
+        return;
+    }
 
-    ImageAlphaPremultiply(image);
+    // Count mipmaps levels that can be compressed: 4x4 blocks aligned or single block levels
+    int mipCount = 0;
+    int mipWidth = image->width;
+    int mipHeight = image->height;
+    int dataSize = 0;
 
-    Color *pixels = LoadImageColors(*image);
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        if ((((mipWidth%4) != 0) || ((mipHeight%4) != 0)) && ((mipWidth >= 4) || (mipHeight >= 4))) break;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+        dataSize += GetPixelDataSize(mipWidth, mipHeight, compressedFormat);
+        mipCount++;
 
-    for (int i = 0; i < (image->height)*(image->width); i++) {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
     }
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++) {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
-
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            pixelsCopy2[row*image->width].x = avgR/convolutionSize;
-            pixelsCopy2[row*image->width].y = avgG/convolutionSize;
-            pixelsCopy2[row*image->width].z = avgB/convolutionSize;
-            pixelsCopy2[row*image->width].w = avgAlpha/convolutionSize;
+    if (mipCount < image->mipmaps) TRACELOG(LOG_WARNING, "IMAGE: Mipmaps levels not multiple of 4 can not be compressed, mipmaps reduced to %i", mipCount);
 
-            for (int x = 1; x < image->width; x++)
-            {
-                if (x-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize].w;
-                    convolutionSize--;
-                }
+    unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+    const unsigned char *src = (const unsigned char *)image->data;
+    unsigned char *dst = data;
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+    ImageCompressJob job = { 0 };
+    job.format = compressedFormat;
+    job.quality = quality;
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-                }
+    mipWidth = image->width;
+    mipHeight = image->height;
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
+    for (int i = 0; i < mipCount; i++)
+    {
+        Image level = { (void *)src, mipWidth, mipHeight, 1, image->format };
+        Color *pixels = (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)src : LoadImageColors(level);
 
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+        job.pixels = pixels;
+        job.width = mipWidth;
+        job.height = mipHeight;
+        job.dst = dst;
 
-            pixelsCopy1[col].x = (unsigned char) (avgR/convolutionSize);
-            pixelsCopy1[col].y = (unsigned char) (avgG/convolutionSize);
-            pixelsCopy1[col].z = (unsigned char) (avgB/convolutionSize);
-            pixelsCopy1[col].w = (unsigned char) (avgAlpha/convolutionSize);
+        int blockRows = (mipHeight + 3)/4;
 
-            for (int y = 1; y < image->height; y++)
-            {
-                if (y-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+        if ((mipWidth*mipHeight) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(blockRows, ImageCompressRows, &job);
+        else ImageCompressRows(0, blockRows, &job);
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
+        if ((void *)pixels != (void *)src) UnloadImageColors(pixels);
 
+        src += GetPixelDataSize(mipWidth, mipHeight, image->format);
+        dst += GetPixelDataSize(mipWidth, mipHeight, compressedFormat);
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
     }
 
-    int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-    ImageFormat(image, format);
+    image->data = data;
+    image->format = compressedFormat;
+    image->mipmaps = mipCount;
 }
 
-// Generate all mipmap levels for a provided image
-// NOTE 1: Supports POT and NPOT images
-// NOTE 2: image.data is scaled to include mipmap levels
-// NOTE 3: Mipmaps format is the same as base image
-void ImageMipmaps(Image *image)
+// Create an image from text (default font)
+Image ImageText(const char *text, int fontSize, Color color)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    int mipCount = 1;                   // Required mipmap levels count (including base level)
-    int mipWidth = image->width;        // Base image width
-    int mipHeight = image->height;      // Base image height
-    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+    Image imText = { 0 };
+#if defined(SUPPORT_MODULE_RTEXT)
+    int defaultFontSize = 10;   // Default Font chars height in pixel
+    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+    int spacing = fontSize/defaultFontSize;
+    imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);   // WARNING: Module required: rtext
+#else
+    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
+    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
+#endif
+    return imText;
+}
 
-    // Count mipmap levels required
-    while ((mipWidth != 1) || (mipHeight != 1))
-    {
-        if (mipWidth != 1) mipWidth /= 2;
-        if (mipHeight != 1) mipHeight /= 2;
+// Create an image from text (custom sprite font)
+Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+{
+    Image imText = { 0 };
+#if defined(SUPPORT_MODULE_RTEXT)
+    int size = (int)strlen(text);   // Get size in bytes of text
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+    int textOffsetX = 0;            // Image drawing position X
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    int prevCodepoint = -1;         // Previous codepoint on line (kerning)
 
-        TRACELOGD("IMAGE: Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+    // NOTE: Text image is generated at font base size, later scaled to desired font size
+    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
 
-        mipCount++;
-        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
-    }
+    // Create image to store text
+    imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
 
-    if (image->mipmaps < mipCount)
+    for (int i = 0; i < size; i++)
     {
-        void *temp = RL_REALLOC(image->data, mipSize);
-
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
-
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
+        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
 
-        mipWidth = image->width/2;
-        mipHeight = image->height/2;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
+        // but we need to draw all the bad bytes using the '?' symbol moving one byte
+        if (codepoint == 0x3f) codepointByteCount = 1;
 
-        for (int i = 1; i < mipCount; i++)
+        if (codepoint == '\n')
         {
-            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
-
-            ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
-
-            memcpy(nextmip, imCopy.data, mipSize);
-            nextmip += mipSize;
-            image->mipmaps++;
-
-            mipWidth /= 2;
-            mipHeight /= 2;
+            // NOTE: Fixed line spacing of 1.5 line-height
+            // TODO: Support custom line spacing defined by user
+            textOffsetY += (font.baseSize + font.baseSize/2);
+            textOffsetX = 0;
+            prevCodepoint = -1;
+        }
+        else
+        {
+            if (prevCodepoint >= 0) textOffsetX += (int)roundf(GetGlyphKerning(font, prevCodepoint, codepoint));  // WARNING: Module required: rtext
+            prevCodepoint = codepoint;
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
+                ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
+            }
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
+            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
         }
 
-        UnloadImage(imCopy);
+        i += (codepointByteCount - 1);   // Move text bytes counter to next codepoint
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
-}
-
-// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-// NOTE: In case selected bpp do not represent a known 16bit format,
-// dithered data is stored in the LSB part of the unsigned short
-void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    // Scale image depending on text size
+    if (textSize.y != imSize.y)
     {
-        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
-        return;
-    }
+        float scaleFactor = textSize.y / imSize.y;
+        TRACELOG(LOG_INFO, "IMAGE: Text scaled by factor: %f", scaleFactor);
 
-    if ((rBpp + gBpp + bBpp + aBpp) > 16)
-    {
-        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
+        // Using nearest-neighbor scaling algorithm for default font
+        // TODO: Allow defining the preferred scaling mechanism externally
+        // WARNING: Module required: rtext
+        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
     }
-    else
-    {
-        Color *pixels = LoadImageColors(*image);
+#else
+    imText = GenImageColor(200, 60, BLACK);     // Generating placeholder black image rectangle
+    TRACELOG(LOG_WARNING, "IMAGE: ImageTextEx() requires module: rtext");
+#endif
+    return imText;
+}
 
-        RL_FREE(image->data);      // free old image data
+// Resize and image to new size using Nearest-Neighbor scaling algorithm
+void ImageResizeNN(Image *image,int newWidth,int newHeight)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-        if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
-        {
-            TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
-        }
+    Color *pixels = LoadImageColors(*image);
+    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-        // Define new image format, check if desired bpp match internal known format
-        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
-        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
-        else
+    // EDIT: added +1 to account for an early rounding problem
+    int xRatio = (int)((image->width << 16)/newWidth) + 1;
+    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+
+    int x2, y2;
+    for (int y = 0; y < newHeight; y++)
+    {
+        for (int x = 0; x < newWidth; x++)
         {
-            image->format = 0;
-            TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+            x2 = ((x*xRatio) >> 16);
+            y2 = ((y*yRatio) >> 16);
+
+            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
         }
+    }
 
-        // NOTE: We will store the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    int format = image->format;
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
+    RL_FREE(image->data);
 
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+    image->data = output;
+    image->width = newWidth;
+    image->height = newHeight;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
+    UnloadImageColors(pixels);
+}
 
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
 
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+// Resize and image to new size
+// NOTE: Uses stb default scaling filters (both bicubic):
+// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
+// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
+void ImageResize(Image *image, int newWidth, int newHeight)
+{
+    ImageResizeEx(image, newWidth, newHeight, NULL);
+}
 
-                pixels[y*image->width + x] = newPixel;
+// Resize image (Bicubic scaling algorithm) with resize context (scratch buffers reuse, sRGB filtering)
+// NOTE: 8 bit and float formats are resized natively, other formats are resized as R8G8B8A8,
+// output rows are split in slices resized in parallel by jobs system (if initialized), context could be NULL
+void ImageResizeEx(Image *image, int newWidth, int newHeight, ImageResizeContext *context)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (newWidth <= 0) || (newHeight <= 0)) return;
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+    bool srgb = (context != NULL) && context->srgb;
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+    ImageResizeJob job = { 0 };
+    job.type = STBIR_TYPE_UINT8;
+    job.alphaChannel = -1;
+    job.colorspace = STBIR_COLORSPACE_LINEAR;
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: job.channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: job.channels = 2; job.alphaChannel = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: job.channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: job.channels = 4; job.alphaChannel = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: job.channels = 1; job.type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: job.channels = 3; job.type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: job.channels = 4; job.alphaChannel = 3; job.type = STBIR_TYPE_FLOAT; break;
+        default: break;
+    }
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+    // Get data as Color pixels array to work with it, other formats are reformatted after resize
+    int format = image->format;
+    int resizeFormat = format;
+    void *input = image->data;
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+    if (job.channels == 0)
+    {
+        input = LoadImageColors(*image);
+        resizeFormat = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        job.channels = 4;
+        job.alphaChannel = 3;
+    }
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
+    // sRGB filtering: 8 bit color channels decoded to linear space and alpha weighted, float channels are linear
+    if (srgb && (job.type == STBIR_TYPE_UINT8)) job.colorspace = STBIR_COLORSPACE_SRGB;
+    if (!srgb) job.alphaChannel = -1;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, resizeFormat);
+    void *output = RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+
+    job.input = input;
+    job.inputWidth = image->width;
+    job.inputHeight = image->height;
+    job.inputStride = image->width*bytesPerPixel;
+    job.output = output;
+    job.outputWidth = newWidth;
+    job.outputHeight = newHeight;
+    job.outputStride = newWidth*bytesPerPixel;
+
+    // Output rows slices, one per jobs thread for big images
+    job.sliceCount = 1;
+    if ((newWidth*newHeight) >= IMAGE_DRAW_PARALLEL_PIXELS) job.sliceCount = newHeight/IMAGE_RESIZE_SLICE_ROWS;
+    if (job.sliceCount > GetJobThreadCount()) job.sliceCount = GetJobThreadCount();
+    if (job.sliceCount < 1) job.sliceCount = 1;
+
+    if (context != NULL)
+    {
+        if (context->bufferCount < job.sliceCount)
+        {
+            context->buffers = (void **)RL_REALLOC(context->buffers, job.sliceCount*sizeof(void *));
+            for (int i = context->bufferCount; i < job.sliceCount; i++) context->buffers[i] = NULL;
+            context->bufferCount = job.sliceCount;
         }
 
-        UnloadImageColors(pixels);
+        job.buffers = context->buffers;
     }
+
+    if (job.sliceCount > 1) JobParallelFor(job.sliceCount, ImageResizeSlices, &job);
+    else ImageResizeSlices(0, 1, &job);
+
+    if (input != image->data) UnloadImageColors((Color *)input);
+    RL_FREE(image->data);
+
+    image->data = output;
+    image->width = newWidth;
+    image->height = newHeight;
+    image->format = resizeFormat;
+
+    if (resizeFormat != format) ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 }
 
-// Flip image vertically
-void ImageFlipVertical(Image *image)
+// Load image resize context, scratch buffers are kept between resizes
+ImageResizeContext LoadImageResizeContext(bool srgb)
+{
+    ImageResizeContext context = { 0 };
+    context.srgb = srgb;
+
+    return context;
+}
+
+// Unload image resize context scratch buffers
+void UnloadImageResizeContext(ImageResizeContext context)
+{
+    for (int i = 0; i < context.bufferCount; i++) RL_FREE(context.buffers[i]);
+    RL_FREE(context.buffers);
+}
+
+// Resize canvas and fill with color
+// NOTE: Resize offset is relative to the top-left corner of the original image
+void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    else if ((newWidth != image->width) || (newHeight != image->height))
     {
+        Rectangle srcRec = { 0, 0, (float)image->width, (float)image->height };
+        Vector2 dstPos = { (float)offsetX, (float)offsetY };
+
+        if (offsetX < 0)
+        {
+            srcRec.x = (float)-offsetX;
+            srcRec.width += (float)offsetX;
+            dstPos.x = 0;
+        }
+        else if ((offsetX + image->width) > newWidth) srcRec.width = (float)(newWidth - offsetX);
+
+        if (offsetY < 0)
+        {
+            srcRec.y = (float)-offsetY;
+            srcRec.height += (float)offsetY;
+            dstPos.y = 0;
+        }
+        else if ((offsetY + image->height) > newHeight) srcRec.height = (float)(newHeight - offsetY);
+
+        if (newWidth < srcRec.width) srcRec.width = (float)newWidth;
+        if (newHeight < srcRec.height) srcRec.height = (float)newHeight;
+
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        unsigned char *resizedData = (unsigned char *)RL_CALLOC(newWidth*newHeight*bytesPerPixel, 1);
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        // TODO: Fill resized canvas with fill color (must be formatted to image->format)
+
+        int dstOffsetSize = ((int)dstPos.y*newWidth + (int)dstPos.x)*bytesPerPixel;
+
+        for (int y = 0; y < (int)srcRec.height; y++)
         {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
+            memcpy(resizedData + dstOffsetSize, ((unsigned char *)image->data) + ((y + (int)srcRec.y)*image->width + (int)srcRec.x)*bytesPerPixel, (int)srcRec.width*bytesPerPixel);
+            dstOffsetSize += (newWidth*bytesPerPixel);
         }
 
         RL_FREE(image->data);
-        image->data = flippedData;
+        image->data = resizedData;
+        image->width = newWidth;
+        image->height = newHeight;
     }
 }
 
-// Flip image horizontally
-void ImageFlipHorizontal(Image *image)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Convert image to POT (power-of-two)
+// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
+void ImageToPOT(Image *image, Color fill)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+    // Calculate next power-of-two values
+    // NOTE: Just add the required amount of pixels at the right and bottom sides of image...
+    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
+    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcopy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+    // Check if POT texture generation is required (if texture is not already POT)
+    if ((potWidth != image->width) || (potHeight != image->height)) ImageResizeCanvas(image, potWidth, potHeight, 0, 0, fill);
+}
 
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
+// Crop image depending on alpha value
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+void ImageAlphaCrop(Image *image, float threshold)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+    Rectangle crop = GetImageAlphaBorder(*image, threshold);
 
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
-    }
+    // Crop if rectangle is valid
+    if (((int)crop.width != 0) && ((int)crop.height != 0)) ImageCrop(image, crop);
 }
 
-// Rotate image clockwise 90deg
-void ImageRotateCW(Image *image)
+// Clear alpha channel to desired color
+// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
+void ImageAlphaClear(Image *image, Color color, float threshold)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2087,183 +2876,289 @@ void ImageRotateCW(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
+        switch (image->format)
         {
-            for (int x = 0; x < image->width; x++)
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
             {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+                for (int i = 1; i < image->width*image->height*2; i += 2)
+                {
+                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    {
+                        ((unsigned char *)image->data)[i - 1] = color.r;
+                        ((unsigned char *)image->data)[i] = color.a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned char thresholdValue = ((threshold < 0.5f)? 0 : 1);
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+                unsigned char r = (unsigned char)(round((float)color.r*31.0f));
+                unsigned char g = (unsigned char)(round((float)color.g*31.0f));
+                unsigned char b = (unsigned char)(round((float)color.b*31.0f));
+                unsigned char a = (color.a < 128)? 0 : 1;
 
-        image->width = height;
-        image->height = width;
+                for (int i = 0; i < image->width*image->height; i++)
+                {
+                    if ((((unsigned short *)image->data)[i] & 0b0000000000000001) <= thresholdValue)
+                    {
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned char thresholdValue = (unsigned char)(threshold*15.0f);
+
+                unsigned char r = (unsigned char)(round((float)color.r*15.0f));
+                unsigned char g = (unsigned char)(round((float)color.g*15.0f));
+                unsigned char b = (unsigned char)(round((float)color.b*15.0f));
+                unsigned char a = (unsigned char)(round((float)color.a*15.0f));
+
+                for (int i = 0; i < image->width*image->height; i++)
+                {
+                    if ((((unsigned short *)image->data)[i] & 0x000f) <= thresholdValue)
+                    {
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+                for (int i = 3; i < image->width*image->height*4; i += 4)
+                {
+                    if (((unsigned char *)image->data)[i] <= thresholdValue)
+                    {
+                        ((unsigned char *)image->data)[i - 3] = color.r;
+                        ((unsigned char *)image->data)[i - 2] = color.g;
+                        ((unsigned char *)image->data)[i - 1] = color.b;
+                        ((unsigned char *)image->data)[i] = color.a;
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                for (int i = 3; i < image->width*image->height*4; i += 4)
+                {
+                    if (((float *)image->data)[i] <= threshold)
+                    {
+                        ((float *)image->data)[i - 3] = (float)color.r/255.0f;
+                        ((float *)image->data)[i - 2] = (float)color.g/255.0f;
+                        ((float *)image->data)[i - 1] = (float)color.b/255.0f;
+                        ((float *)image->data)[i] = (float)color.a/255.0f;
+                    }
+                }
+            } break;
+            default: break;
+        }
     }
 }
 
-// Rotate image counter-clockwise 90deg
-void ImageRotateCCW(Image *image)
+// Apply alpha mask to image
+// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
+// NOTE 2: alphaMask should be same size as image
+void ImageAlphaMask(Image *image, Image alphaMask)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask must be same size as image");
+    }
+    else if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Alpha mask can not be applied to compressed data formats");
+    }
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        // Force mask to be Grayscale
+        Image mask = ImageCopy(alphaMask);
+        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
 
-        for (int y = 0; y < image->height; y++)
+        // In case image is only grayscale, we just add alpha channel
+        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
         {
-            for (int x = 0; x < image->width; x++)
+            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+
+            // Apply alpha mask to alpha channel
+            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
             {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
+                data[k] = ((unsigned char *)image->data)[i];
+                data[k + 1] = ((unsigned char *)mask.data)[i];
             }
+
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
         }
+        else
+        {
+            // Convert image to RGBA
+            if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+            // Apply alpha mask to alpha channel
+            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
+            {
+                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
+            }
+        }
 
-        image->width = height;
-        image->height = width;
+        UnloadImage(mask);
     }
 }
 
-// Modify image color: tint
-void ImageColorTint(Image *image, Color color)
+// Premultiply alpha channel
+void ImageAlphaPremultiply(Image *image)
 {
+    ImageProcessOp op = { IMAGE_PROCESS_ALPHA_PREMULTIPLY };
+    ImageProcess(image, &op, 1);
+}
+
+// Apply box blur
+void ImageBlurGaussian(Image *image, int blurSize) {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    ImageAlphaPremultiply(image);
 
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
+    Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y*image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
+    // Loop switches between pixelsCopy1 and pixelsCopy2
+    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
 
-            pixels[index].r = r;
-            pixels[index].g = g;
-            pixels[index].b = b;
-            pixels[index].a = a;
-        }
+    for (int i = 0; i < (image->height)*(image->width); i++) {
+        pixelsCopy1[i].x = pixels[i].r;
+        pixelsCopy1[i].y = pixels[i].g;
+        pixelsCopy1[i].z = pixels[i].b;
+        pixelsCopy1[i].w = pixels[i].a;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++) {
+        // Horizontal motion blur
+        for (int row = 0; row < image->height; row++)
+        {
+            float avgR = 0.0f;
+            float avgG = 0.0f;
+            float avgB = 0.0f;
+            float avgAlpha = 0.0f;
+            int convolutionSize = blurSize+1;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            for (int i = 0; i < blurSize+1; i++)
+            {
+                avgR += pixelsCopy1[row*image->width + i].x;
+                avgG += pixelsCopy1[row*image->width + i].y;
+                avgB += pixelsCopy1[row*image->width + i].z;
+                avgAlpha += pixelsCopy1[row*image->width + i].w;
+            }
 
-    ImageFormat(image, format);
-}
+            pixelsCopy2[row*image->width].x = avgR/convolutionSize;
+            pixelsCopy2[row*image->width].y = avgG/convolutionSize;
+            pixelsCopy2[row*image->width].z = avgB/convolutionSize;
+            pixelsCopy2[row*image->width].w = avgAlpha/convolutionSize;
 
-// Modify image color: invert
-void ImageColorInvert(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+            for (int x = 1; x < image->width; x++)
+            {
+                if (x-blurSize >= 0)
+                {
+                    avgR -= pixelsCopy1[row*image->width + x-blurSize].x;
+                    avgG -= pixelsCopy1[row*image->width + x-blurSize].y;
+                    avgB -= pixelsCopy1[row*image->width + x-blurSize].z;
+                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize].w;
+                    convolutionSize--;
+                }
 
-    Color *pixels = LoadImageColors(*image);
+                if (x+blurSize < image->width)
+                {
+                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
+                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
+                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
+                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
+                    convolutionSize++;
+                }
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
-    }
+                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
+                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
+                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
+                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
+            }
+                }
 
-    int format = image->format;
-    RL_FREE(image->data);
+        // Vertical motion blur
+        for (int col = 0; col < image->width; col++)
+        {
+            float avgR = 0.0f;
+            float avgG = 0.0f;
+            float avgB = 0.0f;
+            float avgAlpha = 0.0f;
+            int convolutionSize = blurSize+1;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            for (int i = 0; i < blurSize+1; i++)
+            {
+                avgR += pixelsCopy2[i*image->width + col].x;
+                avgG += pixelsCopy2[i*image->width + col].y;
+                avgB += pixelsCopy2[i*image->width + col].z;
+                avgAlpha += pixelsCopy2[i*image->width + col].w;
+            }
 
-    ImageFormat(image, format);
-}
+            pixelsCopy1[col].x = (unsigned char) (avgR/convolutionSize);
+            pixelsCopy1[col].y = (unsigned char) (avgG/convolutionSize);
+            pixelsCopy1[col].z = (unsigned char) (avgB/convolutionSize);
+            pixelsCopy1[col].w = (unsigned char) (avgAlpha/convolutionSize);
 
-// Modify image color: grayscale
-void ImageColorGrayscale(Image *image)
-{
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
-}
-
-// Modify image color: contrast
-// NOTE: Contrast values between -100 and 100
-void ImageColorContrast(Image *image, float contrast)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
+            for (int y = 1; y < image->height; y++)
+            {
+                if (y-blurSize >= 0)
+                {
+                    avgR -= pixelsCopy2[(y-blurSize)*image->width + col].x;
+                    avgG -= pixelsCopy2[(y-blurSize)*image->width + col].y;
+                    avgB -= pixelsCopy2[(y-blurSize)*image->width + col].z;
+                    avgAlpha -= pixelsCopy2[(y-blurSize)*image->width + col].w;
+                    convolutionSize--;
+                }
+                if (y+blurSize < image->height)
+                {
+                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
+                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
+                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
+                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
+                    convolutionSize++;
+                }
 
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
+                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
+                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
+                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
+                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
+            }
+        }
+    }
 
-    Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
+    // Reverse premultiply
+    for (int i = 0; i < (image->width)*(image->height); i++)
     {
-        for (int x = 0; x < image->width; x++)
+        if (pixelsCopy1[i].w == 0.0f)
         {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5f;
-            pR *= contrast;
-            pR += 0.5f;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5f;
-            pG *= contrast;
-            pG += 0.5f;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5f;
-            pB *= contrast;
-            pB += 0.5f;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+            pixels[i].a = 0;
+        }
+        else if (pixelsCopy1[i].w <= 255.0f)
+        {
+            float alpha = (float)pixelsCopy1[i].w/255.0f;
+            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
+            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
+            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
+            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
         }
     }
 
     int format = image->format;
     RL_FREE(image->data);
+    RL_FREE(pixelsCopy1);
+    RL_FREE(pixelsCopy2);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2271,2237 +3166,8039 @@ void ImageColorContrast(Image *image, float contrast)
     ImageFormat(image, format);
 }
 
-// Modify image color: brightness
-// NOTE: Brightness values between -255 and 255
-void ImageColorBrightness(Image *image, int brightness)
+// Generate all mipmap levels for a provided image
+// NOTE 1: Supports POT and NPOT images
+// NOTE 2: image.data is scaled to include mipmap levels
+// NOTE 3: Mipmaps format is the same as base image
+void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, false, false);
+}
+
+// Compute all mipmap levels for a provided image, gamma-correct and alpha weighted filtering options
+// NOTE 1: Every level is box filtered (2x2) from previous level, mipmaps chain allocated once
+// NOTE 2: srgb filters 8 bit color channels in linear space, float formats are considered linear
+// NOTE 3: premultipliedAlpha weights color channels by alpha, transparent texels do not bleed color
+void ImageMipmapsEx(Image *image, bool srgb, bool premultipliedAlpha)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not generate mipmaps");
+        return;
+    }
 
-    Color *pixels = LoadImageColors(*image);
+    int mipCount = 1;                   // Required mipmap levels count (including base level)
+    int mipWidth = image->width;        // Base image width
+    int mipHeight = image->height;      // Base image height
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+
+    // Count mipmap levels required
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+
+        TRACELOGD("IMAGE: Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
+    }
 
-    for (int y = 0; y < image->height; y++)
+    if (image->mipmaps < mipCount)
     {
-        for (int x = 0; x < image->width; x++)
+        void *temp = RL_REALLOC(image->data, mipSize);
+
+        if (temp == NULL)
         {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
 
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
+        image->data = temp;      // Assign new pointer (new size) to store mipmaps data
 
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
+        if (srgb && !srgbTablesReady)
+        {
+            for (int i = 0; i < 256; i++)
+            {
+                float c = (float)i/255.0f;
+                srgbToLinear[i] = (c <= 0.04045f)? c/12.92f : powf((c + 0.055f)/1.055f, 2.4f);
+            }
 
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
+            for (int i = 0; i < 4096; i++)
+            {
+                float c = (float)i/4095.0f;
+                c = (c <= 0.0031308f)? c*12.92f : 1.055f*powf(c, 1.0f/2.4f) - 0.055f;
+                linearToSrgb[i] = (unsigned char)(c*255.0f + 0.5f);
+            }
 
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
+            srgbTablesReady = true;
         }
-    }
 
-    int format = image->format;
-    RL_FREE(image->data);
+        ImageMipmapJob job = { 0 };
+        job.format = image->format;
+        job.srgb = srgb;
+        job.premultiplied = premultipliedAlpha;
+        job.src = (const unsigned char *)image->data;
+        job.srcWidth = image->width;
+        job.srcHeight = image->height;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
 
-    ImageFormat(image, format);
+        for (int i = 1; i < mipCount; i++)
+        {
+            mipWidth = (job.srcWidth > 1)? job.srcWidth/2 : 1;
+            mipHeight = (job.srcHeight > 1)? job.srcHeight/2 : 1;
+            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+
+            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+
+            job.dst = nextmip;
+            job.dstWidth = mipWidth;
+
+            if ((mipWidth*mipHeight) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(mipHeight, ImageMipmapRows, &job);
+            else ImageMipmapRows(0, mipHeight, &job);
+
+            // Next level is filtered from current level
+            job.src = nextmip;
+            job.srcWidth = mipWidth;
+            job.srcHeight = mipHeight;
+            nextmip += mipSize;
+        }
+
+        image->mipmaps = mipCount;
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
 
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+// NOTE: In case selected bpp do not represent a known 16bit format,
+// dithered data is stored in the LSB part of the unsigned short
+void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        return;
+    }
 
-    for (int y = 0; y < image->height; y++)
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
     {
-        for (int x = 0; x < image->width; x++)
-        {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
-            {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
-            }
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
     }
+    else
+    {
+        Color *pixels = LoadImageColors(*image);
 
-    int format = image->format;
-    RL_FREE(image->data);
+        RL_FREE(image->data);      // free old image data
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Format is already 16bpp or lower, dithering could have no effect");
+        }
 
-    ImageFormat(image, format);
-}
-#endif      // SUPPORT_IMAGE_MANIPULATION
+        // Define new image format, check if desired bpp match internal known format
+        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+        else
+        {
+            image->format = 0;
+            TRACELOG(LOG_WARNING, "IMAGE: Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+        }
 
-// Load color data from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImageColors();
-Color *LoadImageColors(Image image)
-{
-    if ((image.width == 0) || (image.height == 0)) return NULL;
+        // NOTE: We will store the dithered data as unsigned short (16bpp)
+        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+        Color oldPixel = WHITE;
+        Color newPixel = WHITE;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+        int rError, gError, bError;
+        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+
+        for (int y = 0; y < image->height; y++)
         {
-            switch (image.format)
+            for (int x = 0; x < image->width; x++)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+                oldPixel = pixels[y*image->width + x];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                // NOTE: Error must be computed between new and old pixel but using same number of bits!
+                // We want to know how much color precision we have lost...
+                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+                pixels[y*image->width + x] = newPixel;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                // NOTE: Some cases are out of the array and should be ignored
+                if (x < (image->width - 1))
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+                }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                if ((x > 0) && (y < (image->height - 1)))
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                if (y < (image->height - 1))
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                if ((x < (image->width - 1)) && (y < (image->height - 1)))
                 {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+                rPixel = (unsigned short)newPixel.r;
+                gPixel = (unsigned short)newPixel.g;
+                bPixel = (unsigned short)newPixel.b;
+                aPixel = (unsigned short)newPixel.a;
 
-                    k += 4;
-                } break;
-                default: break;
+                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
             }
         }
-    }
 
-    return pixels;
+        UnloadImageColors(pixels);
+    }
 }
 
-// Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+// Quantize image colors to palette size (median cut, up to 256 colors), Floyd-Steinberg dithering optional
+// NOTE: Image colors histogram is split in boxes along the channel with highest variance, at pixels median,
+// box with highest squared error split first, palette colors are the boxes pixels average (alpha included),
+// image format is kept, colors could be merged by format conversion if it has less than 8 bit per channel
+void ImageQuantize(Image *image, int paletteSize, bool dither)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    int palCount = 0;
-    Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return;
+    }
 
-    if (pixels != NULL)
+    if (paletteSize < 1) paletteSize = 1;
+    else if (paletteSize > 256) paletteSize = 256;
+
+    int format = image->format;
+    int pixelCount = image->width*image->height;
+    Color *pixels = LoadImageColors(*image);
+    ImageColorTable table = LoadImageHistogram(pixels, pixelCount);
+
+    ImageColorCount **colors = (ImageColorCount **)RL_MALLOC(table.count*sizeof(ImageColorCount *));
+    ImageColorCount **sorted = (ImageColorCount **)RL_MALLOC(table.count*sizeof(ImageColorCount *));
+    int count = 0;
+
+    for (int i = 0; i < table.capacity; i++) if (table.slots[i].count > 0) colors[count++] = &table.slots[i];
+
+    // Median cut boxes, every box contains a colors range
+    ImageQuantizeBox boxes[256] = { 0 };
+    int boxCount = 1;
+    boxes[0].end = count;
+    UpdateImageQuantizeBox(&boxes[0], colors);
+
+    while (boxCount < paletteSize)
     {
-        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+        // Split box with highest squared error
+        int split = -1;
+        for (int i = 0; i < boxCount; i++) if ((boxes[i].error > 0.0) && ((split < 0) || (boxes[i].error > boxes[split].error))) split = i;
+        if (split < 0) break;       // Every color has its own box
+
+        // Box colors sorted by channel with highest variance (counting sort)
+        int start = boxes[split].start;
+        int end = boxes[split].end;
+        int channel = boxes[split].channel;
+        int offsets[257] = { 0 };
+
+        for (int i = start; i < end; i++) offsets[((const unsigned char *)&colors[i]->color)[channel] + 1]++;
+        for (int v = 0; v < 256; v++) offsets[v + 1] += offsets[v];
+        for (int i = start; i < end; i++) sorted[start + offsets[((const unsigned char *)&colors[i]->color)[channel]]++] = colors[i];
+        memcpy(colors + start, sorted + start, (end - start)*sizeof(ImageColorCount *));
+
+        // Box split at pixels median, both boxes keep one color at least
+        long long half = 0;
+        for (int i = start; i < end; i++) half += colors[i]->count;
+        half /= 2;
+
+        int median = start;
+        long long accum = 0;
+        while ((median < (end - 1)) && ((accum + colors[median]->count) <= half)) accum += colors[median++]->count;
+        if (median == start) median = start + 1;
+
+        boxes[boxCount].start = median;
+        boxes[boxCount].end = end;
+        boxes[split].end = median;
+
+        UpdateImageQuantizeBox(&boxes[split], colors);
+        UpdateImageQuantizeBox(&boxes[boxCount], colors);
+        boxCount++;
+    }
 
-        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+    Color palette[256] = { 0 };
+    for (int i = 0; i < boxCount; i++)
+    {
+        palette[i] = boxes[i].average;
+        for (int j = boxes[i].start; j < boxes[i].end; j++) colors[j]->index = i;
+    }
+
+    RL_FREE(sorted);
+    RL_FREE(colors);
+
+    if (!dither)
+    {
+        ImageQuantizeJob job = { pixels, image->width, &table, palette };
+
+        if (pixelCount >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(image->height, ImageQuantizeRows, &job);
+        else ImageQuantizeRows(0, image->height, &job);
+    }
+    else
+    {
+        // Floyd-Steinberg error diffusion (RGB), nearest palette color cached by color 5 bit per channel
+        unsigned short *nearest = (unsigned short *)RL_MALLOC((1 << 20)*sizeof(unsigned short));
+        memset(nearest, 0xff, (1 << 20)*sizeof(unsigned short));
+
+        int *errors = (int *)RL_CALLOC((image->width + 2)*2*3, sizeof(int));    // Current and next row errors (1/16 units)
 
-        for (int i = 0; i < image.width*image.height; i++)
+        for (int y = 0; y < image->height; y++)
         {
-            if (pixels[i].a > 0)
+            int *current = errors + ((y%2 == 0)? 0 : (image->width + 2)*3);
+            int *next = errors + ((y%2 == 0)? (image->width + 2)*3 : 0);
+            memset(next, 0, (image->width + 2)*3*sizeof(int));
+
+            for (int x = 0; x < image->width; x++)
             {
-                bool colorInPalette = false;
+                Color *pixel = &pixels[y*image->width + x];
+                int value[3] = { 0 };
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
+                for (int ch = 0; ch < 3; ch++)
                 {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
+                    value[ch] = ((const unsigned char *)pixel)[ch] + current[(x + 1)*3 + ch]/16;
+                    value[ch] = (value[ch] < 0)? 0 : ((value[ch] > 255)? 255 : value[ch]);
                 }
 
-                // Store color if not on the palette
-                if (!colorInPalette)
+                int key = ((value[0] >> 3) << 15) | ((value[1] >> 3) << 10) | ((value[2] >> 3) << 5) | (pixel->a >> 3);
+
+                if (nearest[key] == 0xffff)
                 {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+                    // Nearest palette color to cell center
+                    int r = ((value[0] >> 3) << 3) + 4, g = ((value[1] >> 3) << 3) + 4, b = ((value[2] >> 3) << 3) + 4, a = ((pixel->a >> 3) << 3) + 4;
+                    int best = 0, bestDistance = INT_MAX;
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
+                    for (int p = 0; p < boxCount; p++)
                     {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                        int dr = r - palette[p].r, dg = g - palette[p].g, db = b - palette[p].b, da = a - palette[p].a;
+                        int distance = dr*dr + dg*dg + db*db + da*da;
+                        if (distance < bestDistance) { bestDistance = distance; best = p; }
                     }
+
+                    nearest[key] = (unsigned short)best;
+                }
+
+                Color color = palette[nearest[key]];
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    int error = value[ch] - ((const unsigned char *)&color)[ch];
+
+                    current[(x + 2)*3 + ch] += error*7;
+                    next[x*3 + ch] += error*3;
+                    next[(x + 1)*3 + ch] += error*5;
+                    next[(x + 2)*3 + ch] += error;
                 }
+
+                *pixel = color;
             }
         }
 
-        UnloadImageColors(pixels);
+        RL_FREE(errors);
+        RL_FREE(nearest);
     }
 
-    *colorCount = palCount;
+    UnloadImageHistogram(&table);
 
-    return palette;
-}
+    RL_FREE(image->data);
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
-// Unload color data loaded with LoadImageColors()
-void UnloadImageColors(Color *colors)
-{
-    RL_FREE(colors);
+    if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, format);
 }
 
-// Unload colors palette loaded with LoadImagePalette()
-void UnloadImagePalette(Color *colors)
+// Flip image vertically
+void ImageFlipVertical(Image *image)
 {
-    RL_FREE(colors);
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        {
+            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
+            offsetSize += image->width*bytesPerPixel;
+        }
+
+        RL_FREE(image->data);
+        image->data = flippedData;
+    }
 }
 
-// Get image alpha border rectangle
-// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
-Rectangle GetImageAlphaBorder(Image image, float threshold)
+// Flip image horizontally
+void ImageFlipHorizontal(Image *image)
 {
-    Rectangle crop = { 0 };
-
-    Color *pixels = LoadImageColors(image);
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (pixels != NULL)
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image.height; y++)
+        for (int y = 0; y < image->height; y++)
         {
-            for (int x = 0; x < image.width; x++)
+            for (int x = 0; x < image->width; x++)
             {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
+                // OPTION 1: Move pixels with memcopy()
+                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+
+                // OPTION 2: Just copy data pixel by pixel
+                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
             }
         }
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
+        RL_FREE(image->data);
+        image->data = flippedData;
+
+        /*
+        // OPTION 3: Faster implementation (specific for 32bit pixels)
+        // NOTE: It does not require additional allocations
+        uint32_t *ptr = (uint32_t *)image->data;
+        for (int y = 0; y < image->height; y++)
         {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+            for (int x = 0; x < image->width/2; x++)
+            {
+                uint32_t backup = ptr[y*image->width + x];
+                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
+                ptr[y*image->width + (image->width - 1 - x)] = backup;
+            }
         }
-
-        UnloadImageColors(pixels);
+        */
     }
-
-    return crop;
 }
 
-// Get image pixel color at (x, y) position
-Color GetImageColor(Image image, int x, int y)
+// Rotate image clockwise 90deg
+void ImageRotateCW(Image *image)
 {
-    Color color = { 0 };
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
     {
-        switch (image.format)
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int y = 0; y < image->height; y++)
         {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            for (int x = 0; x < image->width; x++)
             {
-                color.r = ((unsigned char *)image.data)[y*image.width + x];
-                color.g = ((unsigned char *)image.data)[y*image.width + x];
-                color.b = ((unsigned char *)image.data)[y*image.width + x];
-                color.a = 255;
+                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
+            }
+        }
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
+        RL_FREE(image->data);
+        image->data = rotatedData;
+        int width = image->width;
+        int height = image-> height;
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+        image->width = height;
+        image->height = width;
+    }
+}
 
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
+// Rotate image counter-clockwise 90deg
+void ImageRotateCCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                color.a = 255;
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
             {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
+                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
+            }
+        }
 
-                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+        RL_FREE(image->data);
+        image->data = rotatedData;
+        int width = image->width;
+        int height = image-> height;
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
+        image->width = height;
+        image->height = width;
+    }
+}
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-            {
-                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
-                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
-                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
-                color.a = 255;
+// Modify image color: tint
+void ImageColorTint(Image *image, Color color)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_TINT, 0.0f, color };
+    ImageProcess(image, &op, 1);
+}
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
+// Modify image color: invert
+void ImageColorInvert(Image *image)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_INVERT };
+    ImageProcess(image, &op, 1);
+}
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
-                color.a = 255;
+// Modify image color: grayscale
+void ImageColorGrayscale(Image *image)
+{
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+}
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+// Modify image color: contrast
+// NOTE: Contrast values between -100 and 100
+void ImageColorContrast(Image *image, float contrast)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_CONTRAST, contrast };
+    ImageProcess(image, &op, 1);
+}
 
-            } break;
-            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
-        }
-    }
-    else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
+// Modify image color: brightness
+// NOTE: Brightness values between -255 and 255
+void ImageColorBrightness(Image *image, int brightness)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_BRIGHTNESS, (float)brightness };
+    ImageProcess(image, &op, 1);
+}
 
-    return color;
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    ImageProcessOp op = { IMAGE_PROCESS_REPLACE, 0.0f, color, replace };
+    ImageProcess(image, &op, 1);
 }
 
-//------------------------------------------------------------------------------------
-// Image drawing functions
-//------------------------------------------------------------------------------------
-// Clear image background with given color
-void ImageClearBackground(Image *dst, Color color)
+// Apply color operations sequence to image in one pass
+// NOTE: Consecutive channels operations (tint, invert, contrast, brightness) are composed into lookup tables,
+// operations are applied in place to RGBA8 images (other formats are converted once), rows processed in parallel
+// WARNING: For formats with less channels, intermediate results keep RGBA8 values (i.e. tinted alpha) until last operation
+void ImageProcess(Image *image, const ImageProcessOp *ops, int count)
 {
     // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
-
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (ops == NULL) || (count <= 0)) return;
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width * dst->height; i++)
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        memcpy(pSrcPixel + i * bytesPerPixel, pSrcPixel, bytesPerPixel);
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be processed");
+        return;
     }
-}
 
-// Draw pixel within an image
-// NOTE: Compressed image formats not supported
-void ImageDrawPixel(Image *dst, int x, int y, Color color)
-{
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+    ImageProcessStage *stages = (ImageProcessStage *)RL_MALLOC(count*sizeof(ImageProcessStage));
+    int stageCount = LoadImageProcessStages(ops, count, stages);
 
-    switch (dst->format)
+    if (stageCount > 0)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+        int format = image->format;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+            Color *pixels = LoadImageColors(*image);
+            RL_FREE(image->data);
 
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            image->mipmaps = 1;
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+        ImageProcessJob job = { (unsigned char *)image->data, image->width, stages, stageCount };
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+        if ((image->width*image->height) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(image->height, ImageProcessRows, &job);
+        else ImageProcessRows(0, image->height, &job);
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+        if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, format);
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    RL_FREE(stages);
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+// Load color data from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors();
+Color *LoadImageColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
 
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
 
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
 
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
 
-        } break;
-        default: break;
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
     }
-}
 
-// Draw pixel within an image (Vector version)
-void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
-{
-    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+    return pixels;
 }
 
-// Draw line within an image
-void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+// Load colors palette from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+// NOTE: Colors are hashed (image colors histogram), palette keeps colors first appearance order
+Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 {
-    // Using Bresenham's algorithm as described in
-    // Drawing Lines with Pixels - Joshua Scott - March 2012
-    // https://classic.csunplugged.org/wp-content/uploads/2014/12/Lines.pdf
-
-    int changeInX = (endPosX - startPosX);
-    int absChangeInX = (changeInX < 0)? -changeInX : changeInX;
-    int changeInY = (endPosY - startPosY);
-    int absChangeInY = (changeInY < 0)? -changeInY : changeInY;
-
-    int startU, startV, endU, stepV; // Substitutions, either U = X, V = Y or vice versa. See loop at end of function
-    //int endV;     // Not needed but left for better understanding, check code below
-    int A, B, P;    // See linked paper above, explained down in the main loop
-    int reversedXY = (absChangeInY < absChangeInX);
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageColors(image);
 
-    if (reversedXY)
+    if (pixels != NULL)
     {
-        A = 2*absChangeInY;
-        B = A - 2*absChangeInX;
-        P = A - absChangeInX;
-
-        if (changeInX > 0)
-        {
-            startU = startPosX;
-            startV = startPosY;
-            endU = endPosX;
-            //endV = endPosY;
-        }
-        else
-        {
-            startU = endPosX;
-            startV = endPosY;
-            endU = startPosX;
-            //endV = startPosY;
-
-            // Since start and end are reversed
-            changeInX = -changeInX;
-            changeInY = -changeInY;
-        }
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
-        stepV = (changeInY < 0)? -1 : 1;
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-        ImageDrawPixel(dst, startU, startV, color);     // At this point they are correctly ordered...
-    }
-    else
-    {
-        A = 2*absChangeInX;
-        B = A - 2*absChangeInY;
-        P = A - absChangeInY;
+        ImageColorTable table = LoadImageHistogram(pixels, image.width*image.height);
+        ImageColorCount *colors = (ImageColorCount *)RL_MALLOC(table.count*sizeof(ImageColorCount));
+        int count = 0;
 
-        if (changeInY > 0)
+        // NOTE: Transparent colors (alpha 0) are not added to palette
+        for (int i = 0; i < table.capacity; i++)
         {
-            startU = startPosY;
-            startV = startPosX;
-            endU = endPosY;
-            //endV = endPosX;
+            if ((table.slots[i].count > 0) && (((const unsigned char *)&table.slots[i].color)[3] > 0)) colors[count++] = table.slots[i];
         }
-        else
-        {
-            startU = endPosY;
-            startV = endPosX;
-            endU = startPosY;
-            //endV = startPosX;
 
-            // Since start and end are reversed
-            changeInX = -changeInX;
-            changeInY = -changeInY;
-        }
+        qsort(colors, count, sizeof(ImageColorCount), CompareColorCountFirst);
 
-        stepV = (changeInX < 0)? -1 : 1;
+        palCount = (count < maxPaletteSize)? count : maxPaletteSize;
+        for (int i = 0; i < palCount; i++) memcpy(&palette[i], &colors[i].color, sizeof(Color));
 
-        ImageDrawPixel(dst, startV, startU, color);     // ... but need to be reversed here. Repeated in the main loop below
+        // We reached the limit of colors supported by palette
+        if (count >= maxPaletteSize) TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+
+        RL_FREE(colors);
+        UnloadImageHistogram(&table);
+        UnloadImageColors(pixels);
     }
 
-    // We already drew the start point. If we started at startU + 0, the line would be crooked and too short
-    for (int u = startU + 1, v = startV; u <= endU; u++)
-    {
-        if (P >= 0)
-        {
-            v += stepV;     // Adjusts whenever we stray too far from the direct line. Details in the linked paper above
-            P += B;         // Remembers that we corrected our path
-        }
-        else P += A;        // Remembers how far we are from the direct line
+    *colorCount = palCount;
 
-        if (reversedXY) ImageDrawPixel(dst, u, v, color);
-        else ImageDrawPixel(dst, v, u, color);
-    }
+    return palette;
 }
 
-// Draw line within an image (Vector version)
-void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
+// Unload color data loaded with LoadImageColors()
+void UnloadImageColors(Color *colors)
 {
-    ImageDrawLine(dst, (int)start.x, (int)start.y, (int)end.x, (int)end.y, color);
+    RL_FREE(colors);
 }
 
-// Draw circle within an image
-void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
+// Unload colors palette loaded with LoadImagePalette()
+void UnloadImagePalette(Color *colors)
 {
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
-
-    while (y >= x)
-    {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
-        x++;
-
-        if (decesionParameter > 0)
-        {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
-        }
-        else decesionParameter = decesionParameter + 4*x + 6;
-    }
+    RL_FREE(colors);
 }
 
-// Draw circle within an image (Vector version)
-void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
+// Get image alpha border rectangle
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
-    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
-}
+    Rectangle crop = { 0 };
 
-// Draw circle outline within an image
-void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
-{
-    int x = 0;
-    int y = radius;
-    int decesionParameter = 3 - 2*radius;
+    Color *pixels = LoadImageColors(image);
 
-    while (y >= x)
+    if (pixels != NULL)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
-        x++;
+        int xMin = 65536;   // Define a big enough number
+        int xMax = 0;
+        int yMin = 65536;
+        int yMax = 0;
 
-        if (decesionParameter > 0)
+        for (int y = 0; y < image.height; y++)
         {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
+                {
+                    if (x < xMin) xMin = x;
+                    if (x > xMax) xMax = x;
+                    if (y < yMin) yMin = y;
+                    if (y > yMax) yMax = y;
+                }
+            }
         }
-        else decesionParameter = decesionParameter + 4*x + 6;
-    }
-}
 
-// Draw circle outline within an image (Vector version)
-void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
-{
-    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
-}
+        // Check for empty blank image
+        if ((xMin != 65536) && (xMax != 65536))
+        {
+            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+        }
 
-// Draw rectangle within an image
-void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
-{
-    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
-}
+        UnloadImageColors(pixels);
+    }
 
-// Draw rectangle within an image (Vector version)
-void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
-{
-    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
+    return crop;
 }
 
-// Draw rectangle within an image
-void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+// Get image pixel color at (x, y) position
+Color GetImageColor(Image image, int x, int y)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    int sy = (int)rec.y;
-    int ey = sy + (int)rec.height;
-
-    int sx = (int)rec.x;
+    Color color = { 0 };
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
-
-    for (int y = sy; y < ey; y++)
+    if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
     {
-        // Fill in the first pixel of the row based on image format
-        ImageDrawPixel(dst, sx, y, color);
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                color.r = ((unsigned char *)image.data)[y*image.width + x];
+                color.g = ((unsigned char *)image.data)[y*image.width + x];
+                color.b = ((unsigned char *)image.data)[y*image.width + x];
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
+                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
 
-        int bytesOffset = ((y * dst->width) + sx) * bytesPerPixel;
-        unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
 
-        // Repeat the first pixel data throughout the row
-        for (int x = 1; x < (int)rec.width; x++)
-        {
-            memcpy(pSrcPixel + x * bytesPerPixel, pSrcPixel, bytesPerPixel);
+                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+
+                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
+
+                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
+                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
+                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
+                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
+                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
+                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
+                color.g = 0;
+                color.b = 0;
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
+                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
+                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
+                color.a = 255;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+
+            } break;
+            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
         }
     }
+    else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
+
+    return color;
 }
 
-// Draw rectangle lines within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
+// Clear image background with given color
+void ImageClearBackground(Image *dst, Color color)
 {
-    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // Fill in first pixel based on image format
+    ImageDrawPixel(dst, 0, 0, color);
+
+    // Repeat the first pixel data throughout the image
+    ImageFillRec(dst, 0, 0, dst->width, dst->height);
 }
 
-// Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+// Draw pixel within an image
+// NOTE: Compressed image formats not supported
+void ImageDrawPixel(Image *dst, int x, int y, Color color)
 {
     // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
-        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
-    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
-    else
+    switch (dst->format)
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
-        // Source rectangle out-of-bounds security checks
-        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
-        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
-        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
-        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
-
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
         {
-            srcRec.x = -dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
 
-        if (dstRec.y < 0)
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
         {
-            srcRec.y = -dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
 
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
 
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-                    SetPixelColor(pDst, blend, dst->format);
+            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
-        }
+            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-    }
-}
-
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
-{
-#if defined(SUPPORT_MODULE_RTEXT)
-    // Make sure default font is loaded to be used on image text drawing
-    if (GetFontDefault().texture.id == 0) LoadFontDefault();
+            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
 
-    Vector2 position = { (float)posX, (float)posY };
-    // NOTE: For default font, spacing is set to desired font size / default font size (10)
-    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);   // WARNING: Module required: rtext
-#else
-    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
-#endif
+        } break;
+        default: break;
+    }
 }
 
-// Draw text (custom sprite font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+// Draw pixel within an image (Vector version)
+void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 {
-    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
-
-    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
-    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
-
-    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
-
-    UnloadImage(imText);
+    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
 }
 
-//------------------------------------------------------------------------------------
-// Texture loading functions
-//------------------------------------------------------------------------------------
-// Load texture from file into GPU memory (VRAM)
-Texture2D LoadTexture(const char *fileName)
+// Draw line within an image
+void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
-    Texture2D texture = { 0 };
-
-    Image image = LoadImage(fileName);
-
-    if (image.data != NULL)
-    {
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
-    }
+    // Using Bresenham's algorithm as described in
+    // Drawing Lines with Pixels - Joshua Scott - March 2012
+    // https://classic.csunplugged.org/wp-content/uploads/2014/12/Lines.pdf
 
-    return texture;
-}
+    int changeInX = (endPosX - startPosX);
+    int absChangeInX = (changeInX < 0)? -changeInX : changeInX;
+    int changeInY = (endPosY - startPosY);
+    int absChangeInY = (changeInY < 0)? -changeInY : changeInY;
 
-// Load a texture from image data
-// NOTE: image is not unloaded, it must be done manually
-Texture2D LoadTextureFromImage(Image image)
-{
-    Texture2D texture = { 0 };
+    int startU, startV, endU, stepV; // Substitutions, either U = X, V = Y or vice versa. See loop at end of function
+    //int endV;     // Not needed but left for better understanding, check code below
+    int A, B, P;    // See linked paper above, explained down in the main loop
+    int reversedXY = (absChangeInY < absChangeInX);
 
-    if ((image.width != 0) && (image.height != 0))
+    if (reversedXY)
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
-    }
-    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
-
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.mipmaps = image.mipmaps;
-    texture.format = image.format;
-
-    return texture;
-}
-
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layout)
-{
-    TextureCubemap cubemap = { 0 };
+        A = 2*absChangeInY;
+        B = A - 2*absChangeInX;
+        P = A - absChangeInX;
 
-    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
-    {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
+        if (changeInX > 0)
         {
-            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-            else if (image.width >= (int)((float)image.height*1.85f)) { layout = CUBEMAP_LAYOUT_PANORAMA; cubemap.width = image.width/4; }
+            startU = startPosX;
+            startV = startPosY;
+            endU = endPosX;
+            //endV = endPosY;
         }
-        else if (image.height > image.width)
+        else
         {
-            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+            startU = endPosX;
+            startV = endPosY;
+            endU = startPosX;
+            //endV = startPosY;
+
+            // Since start and end are reversed
+            changeInX = -changeInX;
+            changeInY = -changeInY;
         }
 
-        cubemap.height = cubemap.width;
-    }
+        stepV = (changeInY < 0)? -1 : 1;
 
-    // Layout provided or already auto-detected
-    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
+        ImageDrawPixel(dst, startU, startV, color);     // At this point they are correctly ordered...
+    }
+    else
     {
-        int size = cubemap.width;
-
-        Image faces = { 0 };                // Vertical column image
-        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
-        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+        A = 2*absChangeInX;
+        B = A - 2*absChangeInY;
+        P = A - absChangeInY;
 
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
-        {
-            faces = ImageCopy(image);       // Image data already follows expected convention
-        }
-        else if (layout == CUBEMAP_LAYOUT_PANORAMA)
+        if (changeInY > 0)
         {
-            // TODO: Convert panorama image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+            startU = startPosY;
+            startV = startPosX;
+            endU = endPosY;
+            //endV = endPosX;
         }
         else
         {
-            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
-            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
-            {
-                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
-                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
-            }
-            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
-            {
-                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
-                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
-            }
-
-            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
-
-            // NOTE: Image formatting does not work with compressed textures
+            startU = endPosY;
+            startV = endPosX;
+            endU = startPosY;
+            //endV = startPosX;
 
-            for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
+            // Since start and end are reversed
+            changeInX = -changeInX;
+            changeInY = -changeInY;
         }
 
-        // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
-        // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
-        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
-        if (cubemap.id == 0) TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+        stepV = (changeInX < 0)? -1 : 1;
 
-        UnloadImage(faces);
+        ImageDrawPixel(dst, startV, startU, color);     // ... but need to be reversed here. Repeated in the main loop below
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
-
-    return cubemap;
-}
-
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
-{
-    RenderTexture2D target = { 0 };
-
-    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
 
-    if (target.id > 0)
+    // We already drew the start point. If we started at startU + 0, the line would be crooked and too short
+    for (int u = startU + 1, v = startV; u <= endU; u++)
     {
-        rlEnableFramebuffer(target.id);
-
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
-
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
-
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
-
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+        if (P >= 0)
+        {
+            v += stepV;     // Adjusts whenever we stray too far from the direct line. Details in the linked paper above
+            P += B;         // Remembers that we corrected our path
+        }
+        else P += A;        // Remembers how far we are from the direct line
 
-        rlDisableFramebuffer();
+        if (reversedXY) ImageDrawPixel(dst, u, v, color);
+        else ImageDrawPixel(dst, v, u, color);
     }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
-
-    return target;
 }
 
-// Check if a texture is ready
-bool IsTextureReady(Texture2D texture)
+// Draw line within an image (Vector version)
+void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
 {
-    // TODO: Validate maximum texture size supported by GPU?
-
-    return ((texture.id > 0) &&         // Validate OpenGL id
-            (texture.width > 0) &&
-            (texture.height > 0) &&     // Validate texture size
-            (texture.format > 0) &&     // Validate texture pixel format
-            (texture.mipmaps > 0));     // Validate texture mipmaps (at least 1 for basic mipmap level)
+    ImageDrawLine(dst, (int)start.x, (int)start.y, (int)end.x, (int)end.y, color);
 }
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
+// Draw circle within an image
+void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
-    if (texture.id > 0)
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
+
+    while (y >= x)
     {
-        rlUnloadTexture(texture.id);
+        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
+        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        x++;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
     }
 }
 
-// Check if a render texture is ready
-bool IsRenderTextureReady(RenderTexture2D target)
+// Draw circle within an image (Vector version)
+void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
 {
-    return ((target.id > 0) &&                  // Validate OpenGL id
-            IsTextureReady(target.depth) &&     // Validate FBO depth texture/renderbuffer
-            IsTextureReady(target.texture));    // Validate FBO texture
+    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
 }
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
+// Draw circle outline within an image
+void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
 {
-    if (target.id > 0)
-    {
-        // Color texture attached to FBO is deleted
-        rlUnloadTexture(target.texture.id);
+    int x = 0;
+    int y = radius;
+    int decesionParameter = 3 - 2*radius;
 
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
+    while (y >= x)
+    {
+        ImageDrawPixel(dst, centerX + x, centerY + y, color);
+        ImageDrawPixel(dst, centerX - x, centerY + y, color);
+        ImageDrawPixel(dst, centerX + x, centerY - y, color);
+        ImageDrawPixel(dst, centerX - x, centerY - y, color);
+        ImageDrawPixel(dst, centerX + y, centerY + x, color);
+        ImageDrawPixel(dst, centerX - y, centerY + x, color);
+        ImageDrawPixel(dst, centerX + y, centerY - x, color);
+        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        x++;
+
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
     }
 }
 
-// Update GPU texture with new data
-// NOTE: pixels data must match texture.format
-void UpdateTexture(Texture2D texture, const void *pixels)
+// Draw circle outline within an image (Vector version)
+void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color)
 {
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    ImageDrawCircleLines(dst, (int)center.x, (int)center.y, radius, color);
 }
 
-// Update GPU texture rectangle with new data
-// NOTE: pixels data must match texture.format
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
 }
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
+// Draw rectangle within an image (Vector version)
+void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
 }
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
+// Draw rectangle within an image
+void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
 {
-    switch (filter)
-    {
-        case TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+    // Rectangle clipped to image bounds
+    int sx = ((int)rec.x > 0)? (int)rec.x : 0;
+    int sy = ((int)rec.y > 0)? (int)rec.y : 0;
+    int ex = (((int)rec.x + (int)rec.width) < dst->width)? ((int)rec.x + (int)rec.width) : dst->width;
+    int ey = (((int)rec.y + (int)rec.height) < dst->height)? ((int)rec.y + (int)rec.height) : dst->height;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+    if ((sx >= ex) || (sy >= ey)) return;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+    // Fill in the first pixel of the rectangle based on image format
+    ImageDrawPixel(dst, sx, sy, color);
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
-    }
+    // Repeat the first pixel data throughout the rectangle
+    ImageFillRec(dst, sx, sy, ex - sx, ey - sy);
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrap)
+// Draw rectangle lines within an image
+void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
 {
-    switch (wrap)
-    {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
-    }
+    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
 }
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a texture
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
 {
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
-}
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
-// Draw a texture with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
-{
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
-}
+    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    else
+    {
+        Image srcMod = { 0 };       // Source copy (in case it was required)
+        Image *srcPtr = &src;       // Pointer to source image
+        bool useSrcMod = false;     // Track source copy required
 
-// Draw a texture with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+        // Source rectangle out-of-bounds security checks
+        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
-}
+        // Check if source rectangle needs to be resized to destination rectangle
+        // In that case, we make a copy of source, and we apply all required transform
+        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        {
+            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
+            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
+            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
-{
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+            srcPtr = &srcMod;
+            useSrcMod = true;
+        }
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
-}
+        // Destination rectangle out-of-bounds security checks
+        if (dstRec.x < 0)
+        {
+            srcRec.x = -dstRec.x;
+            srcRec.width += dstRec.x;
+            dstRec.x = 0;
+        }
+        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
 
-// Draw textured polygon, defined by vertex and texture coordinates
-// NOTE: Polygon center must have straight line path to all points
-// without crossing perimeter, points must be in anticlockwise order
-void DrawTexturePoly(Texture2D texture, Vector2 center, Vector2 texcenter, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint)
-{
-    rlSetTexture(texture.id);
+        if (dstRec.y < 0)
+        {
+            srcRec.y = -dstRec.y;
+            srcRec.height += dstRec.y;
+            dstRec.y = 0;
+        }
+        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
 
-    // Texturing is only supported on RL_QUADS
-    rlBegin(RL_QUADS);
+        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
 
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        // This blitting method is quite fast! The process followed is:
+        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+        // RGBA8 destination rows are blended in chunks with SIMD (SSE2/NEON), rows are blitted in parallel
+        // Some optimization ideas:
+        //    [x] Avoid creating source copy if not required (no resize required)
+        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
+        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
+        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
+        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
+        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [ ] Support f32bit channels drawing
 
-        for (int i = 0; i < pointCount - 1; i++)
-        {
-            rlTexCoord2f(texcenter.x, texcenter.y);
-            rlVertex2f(center.x, center.y);
+        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
 
-            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
-            rlVertex2f(points[i].x + center.x, points[i].y + center.y);
+        bool blendRequired = true;
 
-            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
-            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+        // Fast path: Avoid blend if source has no alpha to blend
+        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
 
-            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
-            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
-        }
-    rlEnd();
+        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+        int bytesPerPixelDst = strideDst/(dst->width);
 
-    rlSetTexture(0);
-}
+        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+        ImageBlitJob job = { 0 };
+        job.src = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+        job.srcStride = strideSrc;
+        job.srcFormat = srcPtr->format;
+        job.dst = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+        job.dstStride = strideDst;
+        job.dstFormat = dst->format;
+        job.width = (int)srcRec.width;
+        job.tint = tint;
+        job.blend = blendRequired;
+
+        // Rows blitted in parallel by jobs system (if initialized), small images (glyphs) blitted directly
+        int rows = (int)srcRec.height;
+        if ((job.width > 0) && (rows > 0))
+        {
+            if ((job.width*rows) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(rows, ImageBlitRows, &job);
+            else ImageBlitRows(0, rows, &job);
+        }
+
+        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+    }
+}
+
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
+#if defined(SUPPORT_MODULE_RTEXT)
+    // Make sure default font is loaded to be used on image text drawing
+    if (GetFontDefault().texture.id == 0) LoadFontDefault();
+
+    Vector2 position = { (float)posX, (float)posY };
+    // NOTE: For default font, spacing is set to desired font size / default font size (10)
+    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);   // WARNING: Module required: rtext
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
+#endif
+}
+
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
+
+    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
+    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+
+    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+
+    UnloadImage(imText);
+}
+
+//------------------------------------------------------------------------------------
+// Texture loading functions
+//------------------------------------------------------------------------------------
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
+{
+    PROFILE_BEGIN("LoadTexture");
+
+    Texture2D texture = { 0 };
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
 
-        bool flipX = false;
+    PROFILE_END();
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+    return texture;
+}
 
-        Vector2 topLeft = { 0 };
-        Vector2 topRight = { 0 };
-        Vector2 bottomLeft = { 0 };
-        Vector2 bottomRight = { 0 };
+// Load texture from file compressed to best GPU supported format (DXT, ETC2), quality [0..100]
+// NOTE: Compressed files (DDS, KTX, KTX2...) are uploaded as provided, uncompressed images are compressed
+// to DXT if supported, ETC2 otherwise, image is uploaded uncompressed if no compressed format is supported
+Texture2D LoadTextureCompressed(const char *fileName, int quality)
+{
+    Texture2D texture = { 0 };
 
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
         {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (Vector2){ x, y };
-            topRight = (Vector2){ x + dest.width, y };
-            bottomLeft = (Vector2){ x, y + dest.height };
-            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+            bool alpha = (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                         (image.format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                         (image.format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) ||
+                         (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+                         (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32);
+            int format = 0;
+
+            if (rlIsTextureFormatSupported(PIXELFORMAT_COMPRESSED_DXT1_RGB)) format = alpha? PIXELFORMAT_COMPRESSED_DXT5_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB;
+            else if (rlIsTextureFormatSupported(PIXELFORMAT_COMPRESSED_ETC2_RGB)) format = alpha? PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA : PIXELFORMAT_COMPRESSED_ETC2_RGB;
+
+            if (format != 0) ImageCompress(&image, format, quality);
+            else TRACELOG(LOG_WARNING, "TEXTURE: No compressed format supported, texture loaded uncompressed");
         }
-        else
-        {
-            float sinRotation = sinf(rotation*DEG2RAD);
-            float cosRotation = cosf(rotation*DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
+        else if (!rlIsTextureFormatSupported(image.format)) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Compressed format not supported by GPU", fileName);
 
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+    return texture;
+}
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+// Load texture from file asynchronously, returns request id (-1: failed)
+// NOTE: Image is decoded on loader thread and uploaded on BeginDrawing(), check IsAsyncLoadReady(),
+// if staging pixel buffers are supported, pixels are copied to GPU mapped memory on loader thread
+int LoadTextureAsync(const char *fileName)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)RL_CALLOC(1, sizeof(TextureAsyncLoad));
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
-        }
+    int request = LoadAsync(DecodeTextureAsync, FinalizeTextureAsync, load);
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+    if (request < 0)
+    {
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    return request;
+}
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+// Get async loaded texture, request is released (empty if not ready)
+Texture2D GetTextureAsync(int request)
+{
+    Texture2D texture = { 0 };
+    TextureAsyncLoad *load = (TextureAsyncLoad *)GetAsyncLoadData(request, FinalizeTextureAsync);
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+    if (load != NULL)
+    {
+        texture = load->texture;
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    return texture;
+}
 
-        rlEnd();
-        rlSetTexture(0);
+// Load texture from file with mipmaps streaming, only low resolution mipmaps tail is loaded into GPU memory
+// NOTE: Higher resolution mipmaps are streamed by drawn size (RequestTextureStreaming()), image file is decoded again
+// on streaming, texture is fully loaded if mipmaps streaming is not supported or image is compressed
+Texture2D LoadTextureStreamed(const char *fileName)
+{
+    Texture2D texture = { 0 };
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than just calculating
-        // the vertex positions manually, like done above.
-        // I leave here the old implementation for educational purposes,
-        // just in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    Image image = LoadImage(fileName);
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    if (image.data == NULL) return texture;
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if ((image.mipmaps == 1) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)) ImageMipmaps(&image);
+#endif
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+    // Mipmaps tail first level, mipmaps from this level are always resident
+    int tailLevel = 0;
+    while (((tailLevel + 1) < image.mipmaps) && (((image.width > image.height)? image.width : image.height) >> tailLevel) > TEXTURE_STREAMING_TAIL_SIZE) tailLevel++;
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+    if ((tailLevel == 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || !rlIsTextureBaseLevelSupported() ||
+        (textureStreaming.count >= MAX_TEXTURE_STREAMS))
+    {
+        if (textureStreaming.count >= MAX_TEXTURE_STREAMS) TRACELOG(LOG_WARNING, "TEXTURE: Maximum streamed textures reached (%i), texture fully loaded", MAX_TEXTURE_STREAMS);
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+
+        return texture;
     }
+
+    TextureStream stream = { 0 };
+    stream.width = image.width;
+    stream.height = image.height;
+    stream.format = image.format;
+    stream.mipmaps = image.mipmaps;
+    stream.tailLevel = tailLevel;
+    stream.residentLevel = tailLevel;
+    stream.wantedLevel = tailLevel;
+    stream.lastFrame = textureStreaming.frame;
+    stream.request = -1;
+
+    unsigned int tailOffset = GetTextureStreamSize(&stream, 0, tailLevel - 1);
+    stream.id = rlLoadTextureLevels((unsigned char *)image.data + tailOffset, image.width, image.height, image.format, image.mipmaps, tailLevel);
+
+    UnloadImage(image);
+
+    if (stream.id == 0) return texture;
+
+    stream.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(stream.fileName, fileName);
+
+    // Register stream into id hash table (linear probing)
+    unsigned int mask = MAX_TEXTURE_STREAMS*2 - 1;
+    unsigned int slot = (stream.id*2654435761u) & mask;
+    while (textureStreaming.slots[slot] != 0) slot = (slot + 1) & mask;
+
+    textureStreaming.streams[textureStreaming.count] = stream;
+    textureStreaming.slots[slot] = textureStreaming.count + 1;
+    textureStreaming.count++;
+    textureStreaming.memory += GetTextureStreamSize(&stream, tailLevel, stream.mipmaps - 1);
+
+    texture.id = stream.id;
+    texture.width = stream.width;
+    texture.height = stream.height;
+    texture.format = stream.format;
+    texture.mipmaps = stream.mipmaps;
+#else
+    texture = LoadTexture(fileName);
+#endif
+
+    return texture;
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Request streamed texture mipmaps for a drawn size (in pixels), highest resolution mipmaps requested in frame are loaded
+// NOTE: Requests are kept wanted for TEXTURE_STREAMING_KEEP_FRAMES frames, not streamed textures are ignored
+void RequestTextureStreaming(Texture2D texture, float screenSize)
 {
-    if (texture.id > 0)
-    {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    if ((textureStreaming.count == 0) || (texture.id == 0)) return;
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+    int index = GetTextureStreamIndex(texture.id);
+    if (index < 0) return;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+    TextureStream *stream = &textureStreaming.streams[index];
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+    // Level texels density matching drawn size: base size/2^level >= screen size
+    int level = 0;
+    float size = (float)((stream->width > stream->height)? stream->width : stream->height);
+    while ((level < stream->tailLevel) && ((size*0.5f) >= screenSize)) { size *= 0.5f; level++; }
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
-        {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
-        }
+    if ((stream->lastFrame != textureStreaming.frame) || (level < stream->wantedLevel)) stream->wantedLevel = level;
+    stream->lastFrame = textureStreaming.frame;
+#endif
+}
 
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
-        {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
-        }
+// Set streamed textures GPU memory budget (bytes), least recently requested mipmaps are evicted over budget
+// NOTE: Mipmaps tails are always resident, budget could be exceeded by tails memory
+void SetTextureStreamingBudget(unsigned int bytes)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    textureStreaming.budget = bytes;
+#endif
+}
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+// Get streamed textures resident GPU memory (bytes)
+unsigned int GetTextureStreamingMemory(void)
+{
+    unsigned int memory = 0;
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    memory = textureStreaming.memory;
+#endif
 
-        rlSetTexture(texture.id);
+    return memory;
+}
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+// Load video texture from file (.y4m), frames decoded ahead on async loader thread
+// NOTE: Y, U and V planes (4:2:0) are uploaded as single channel textures through pixel buffers (1.5 bytes per pixel)
+// and converted to RGBA on GPU, video texture is updated by UpdateVideoTexture() for a playback time
+VideoTexture LoadVideoTexture(const char *fileName)
+{
+    VideoTexture video = { 0 };
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+#if defined(SUPPORT_VIDEO_TEXTURE)
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!LoadShaderVideoTexture()) return video;
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+    VideoDecoder *decoder = (VideoDecoder *)RL_CALLOC(1, sizeof(VideoDecoder));
+
+    if (!rly4m_open(&decoder->y4m, fileName))
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to open video file (YUV4MPEG2 4:2:0 required)", fileName);
+        RL_FREE(decoder);
+        return video;
+    }
+
+    int width = decoder->y4m.width;
+    int height = decoder->y4m.height;
+
+    for (int i = 0; i < VIDEO_TEXTURE_QUEUE_FRAMES; i++) decoder->frames[i] = (unsigned char *)RL_MALLOC(decoder->y4m.frameSize);
+
+    decoder->planeIds[0] = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+    decoder->planeIds[1] = rlLoadTexture(NULL, decoder->y4m.chromaWidth, decoder->y4m.chromaHeight, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+    decoder->planeIds[2] = rlLoadTexture(NULL, decoder->y4m.chromaWidth, decoder->y4m.chromaHeight, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+
+    // NOTE: Chroma planes are upsampled by bilinear filtering on conversion
+    for (int i = 0; i < 3; i++)
+    {
+        rlTextureParameters(decoder->planeIds[i], RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+        rlTextureParameters(decoder->planeIds[i], RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+        rlTextureParameters(decoder->planeIds[i], RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+        rlTextureParameters(decoder->planeIds[i], RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+    }
+
+    decoder->target = LoadTextureFilterTarget(width, height);
+    decoder->request = -1;
+
+    video.texture = decoder->target.texture;
+    video.frameCount = decoder->y4m.frameCount;
+    video.frameRate = (float)decoder->y4m.rateNum/(float)decoder->y4m.rateDen;
+    video.ctxData = decoder;
+
+    if ((decoder->planeIds[0] == 0) || (decoder->planeIds[1] == 0) || (decoder->planeIds[2] == 0) || (decoder->target.id == 0) ||
+        !ReadVideoFrame(decoder, 0, decoder->frames[0]))
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to load video texture first frame", fileName);
+        UnloadVideoTexture(video);
+        return (VideoTexture){ 0 };
+    }
+
+    UploadVideoFrame(decoder, decoder->frames[0]);
+    decoder->nextPosition = 1;
+
+    RequestVideoFrames(decoder);
+
+    TRACELOG(LOG_INFO, "VIDEO: [%s] Video texture loaded successfully (%ix%i | %.2f fps | %i frames)", fileName, width, height, video.frameRate, video.frameCount);
+    #else
+    TRACELOG(LOG_WARNING, "VIDEO: Video textures require OpenGL 2.1 or higher");
+    #endif
+#else
+    TRACELOG(LOG_WARNING, "VIDEO: Video textures support not enabled (SUPPORT_VIDEO_TEXTURE)");
+#endif
+
+    return video;
+}
+
+// Check if a video texture is ready
+bool IsVideoTextureReady(VideoTexture video)
+{
+    return ((video.ctxData != NULL) && (video.texture.id > 0) && (video.frameRate > 0.0f));
+}
+
+// Unload video texture decoder and textures
+// NOTE: Pending frames decoding request is waited
+void UnloadVideoTexture(VideoTexture video)
+{
+#if defined(SUPPORT_VIDEO_TEXTURE)
+    VideoDecoder *decoder = (VideoDecoder *)video.ctxData;
+
+    if (decoder == NULL) return;
+
+    RetrieveVideoFrames(decoder, true);
+    rly4m_close(&decoder->y4m);
+
+    for (int i = 0; i < VIDEO_TEXTURE_QUEUE_FRAMES; i++) RL_FREE(decoder->frames[i]);
+    for (int i = 0; i < 3; i++) if (decoder->planeIds[i] > 0) rlUnloadTexture(decoder->planeIds[i]);
+    if (decoder->target.id > 0) UnloadRenderTexture(decoder->target);
+
+    RL_FREE(decoder);
+#endif
+}
+
+// Update video texture frame for playback time (seconds), returns true if frame changed
+// NOTE: For audio/video sync, time should be the audio clock, i.e. GetMusicTimePlayed() of the soundtrack music stream,
+// late frames are dropped, time going backwards or far ahead seeks the stream (frame read on main thread)
+// WARNING: Frame conversion uses a texture mode pass, do not call it inside BeginTextureMode()/BeginMode3D()
+bool UpdateVideoTexture(VideoTexture *video, float time)
+{
+    bool updated = false;
+
+#if defined(SUPPORT_VIDEO_TEXTURE)
+    VideoDecoder *decoder = (VideoDecoder *)video->ctxData;
+
+    if (decoder == NULL) return false;
+
+    int position = (time > 0.0f)? (int)(time*video->frameRate) : 0;
+    if (!video->looping && (video->frameCount > 0) && (position >= video->frameCount)) position = video->frameCount - 1;
+
+    RetrieveVideoFrames(decoder, false);
+
+    if (position != decoder->position)
+    {
+        // Drop queued frames up to playback position, latest one is shown
+        int slot = -1;
+
+        while ((decoder->count > 0) && (decoder->positions[decoder->first] <= position))
+        {
+            slot = decoder->first;
+            decoder->first = (decoder->first + 1)%VIDEO_TEXTURE_QUEUE_FRAMES;
+            decoder->count--;
+        }
+
+        int expected = (decoder->count > 0)? decoder->positions[decoder->first] : ((decoder->request >= 0)? decoder->requestPosition : decoder->nextPosition);
+
+        // Seek required if position is behind decoded frames or far ahead of them
+        if (((slot < 0) && (position < expected)) || (!decoder->ended && (position >= expected + VIDEO_TEXTURE_QUEUE_FRAMES)))
+        {
+            RetrieveVideoFrames(decoder, true);
+
+            decoder->first = 0;
+            decoder->count = 0;
+            decoder->ended = false;
+            decoder->looping = video->looping;
+            decoder->nextPosition = position;
+
+            if (ReadVideoFrame(decoder, position, decoder->frames[0]))
+            {
+                slot = 0;
+                decoder->positions[0] = position;
+                decoder->nextPosition++;
+            }
+            else
+            {
+                slot = -1;
+                decoder->ended = true;
+            }
+        }
+
+        if (slot >= 0)
+        {
+            UploadVideoFrame(decoder, decoder->frames[slot]);
+            decoder->position = decoder->positions[slot];
+            updated = true;
+        }
+    }
+
+    // NOTE: Looping is only changed for loader thread when no request is in flight
+    if (decoder->request < 0)
+    {
+        if (video->looping && !decoder->looping) decoder->ended = false;
+        decoder->looping = video->looping;
+    }
+
+    RequestVideoFrames(decoder);
+#endif
+
+    return updated;
+}
+
+// Update streamed textures residency, called on BeginDrawing()
+// NOTE: Finished loads are collected, mipmaps over budget are evicted and new loads are requested (largest deficit first)
+void UpdateTextureStreaming(void)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    textureStreaming.frame++;
+
+    if (textureStreaming.count == 0) return;
+
+    int loads = 0;
+
+    // Collect finished mipmaps loads
+    for (int i = 0; i < textureStreaming.count; i++)
+    {
+        TextureStream *stream = &textureStreaming.streams[i];
+
+        if (stream->request < 0) continue;
+        if (!IsAsyncLoadReady(stream->request)) { loads++; continue; }
+
+        TextureStreamLoad *load = (TextureStreamLoad *)GetAsyncLoadData(stream->request, FinalizeTextureStream);
+
+        if ((load != NULL) && load->loaded)
+        {
+            textureStreaming.memory += stream->requestSize;
+            stream->residentLevel = load->firstLevel;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to stream texture mipmaps", stream->id);
+            stream->minLevel = stream->residentLevel;
+        }
+
+        textureStreaming.pending -= stream->requestSize;
+        stream->request = -1;
+        stream->requestSize = 0;
+        RL_FREE(load);
+    }
+
+    // Evict mipmaps over budget, not wanted mipmaps first
+    while (((textureStreaming.memory + textureStreaming.pending) > textureStreaming.budget) &&
+        (EvictTextureStream(-1, true) || EvictTextureStream(-1, false)));
+
+    // Request mipmaps loads, largest deficit first, not wanted mipmaps evicted to make room
+    while (loads < TEXTURE_STREAMING_MAX_LOADS)
+    {
+        int best = -1;
+        int bestDeficit = 0;
+
+        for (int i = 0; i < textureStreaming.count; i++)
+        {
+            TextureStream *stream = &textureStreaming.streams[i];
+            if (stream->request >= 0) continue;
+
+            int deficit = stream->residentLevel - GetTextureStreamTarget(stream);
+
+            if ((deficit > bestDeficit) || ((deficit == bestDeficit) && (deficit > 0) &&
+                (stream->lastFrame > textureStreaming.streams[best].lastFrame)))
+            {
+                best = i;
+                bestDeficit = deficit;
+            }
+        }
+
+        if (best < 0) break;
+
+        TextureStream *stream = &textureStreaming.streams[best];
+        int firstLevel = GetTextureStreamTarget(stream);
+        unsigned int size = GetTextureStreamSize(stream, firstLevel, stream->residentLevel - 1);
+
+        while ((textureStreaming.memory + textureStreaming.pending + size) > textureStreaming.budget)
+        {
+            if (EvictTextureStream(best, true)) continue;
+
+            // Not enough budget, higher resolution levels are skipped
+            if ((firstLevel + 1) >= stream->residentLevel) break;
+            firstLevel++;
+            size = GetTextureStreamSize(stream, firstLevel, stream->residentLevel - 1);
+        }
+
+        if ((textureStreaming.memory + textureStreaming.pending + size) > textureStreaming.budget) break;
+
+        TextureStreamLoad *load = (TextureStreamLoad *)RL_CALLOC(1, sizeof(TextureStreamLoad));
+        load->fileName = stream->fileName;
+        load->id = stream->id;
+        load->width = stream->width;
+        load->height = stream->height;
+        load->format = stream->format;
+        load->firstLevel = firstLevel;
+        load->lastLevel = stream->residentLevel - 1;
+
+        stream->request = LoadAsync(DecodeTextureStream, FinalizeTextureStream, load);
+
+        if (stream->request < 0)
+        {
+            RL_FREE(load);
+            break;
+        }
+
+        stream->requestSize = size;
+        textureStreaming.pending += size;
+        loads++;
+    }
+#endif
+}
+
+// Load a texture from image data
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if ((image.width != 0) && (image.height != 0))
+    {
+        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layout)
+{
+    TextureCubemap cubemap = { 0 };
+
+    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    {
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
+        {
+            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+            else if (image.width >= (int)((float)image.height*1.85f)) { layout = CUBEMAP_LAYOUT_PANORAMA; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
+
+        cubemap.height = cubemap.width;
+    }
+
+    // Layout provided or already auto-detected
+    if (layout != CUBEMAP_LAYOUT_AUTO_DETECT)
+    {
+        if (cubemap.width == 0)
+        {
+            if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.width;
+            else if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.height;
+            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
+            else cubemap.width = image.width/4;
+
+            cubemap.height = cubemap.width;
+        }
+
+        int size = cubemap.width;
+
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
+        {
+            // NOTE: Image data already follows expected convention: 6 faces one after the other,
+            // following convention: +X, -X, +Y, -Y, +Z, -Z
+            cubemap.id = rlLoadTextureCubemap(image.data, size, image.format, 1);
+        }
+        else if (layout == CUBEMAP_LAYOUT_PANORAMA)
+        {
+            // TODO: Convert panorama image to square faces...
+            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+            TRACELOG(LOG_WARNING, "IMAGE: Cubemap panorama layout not supported, use GenTextureCubemap()");
+        }
+        else if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Cubemap layout requires uncompressed image data");
+        }
+        else
+        {
+            // Faces positions in image, in faces units
+            int faceX[6] = { 0 };
+            int faceY[6] = { 0 };
+
+            if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceX[i] = i;
+            else if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR)
+            {
+                faceX[0] = 1; faceY[0] = 1;
+                faceX[1] = 1; faceY[1] = 3;
+                faceX[2] = 1; faceY[2] = 0;
+                faceX[3] = 1; faceY[3] = 2;
+                faceX[4] = 0; faceY[4] = 1;
+                faceX[5] = 2; faceY[5] = 1;
+            }
+            else if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE)
+            {
+                faceX[0] = 2; faceY[0] = 1;
+                faceX[1] = 0; faceY[1] = 1;
+                faceX[2] = 1; faceY[2] = 0;
+                faceX[3] = 1; faceY[3] = 2;
+                faceX[4] = 1; faceY[4] = 1;
+                faceX[5] = 3; faceY[5] = 1;
+            }
+
+            // Faces are uploaded directly from image data, image rows length used as faces rows stride
+            // NOTE: No faces image is composed, avoids copying the whole cubemap data (big HDR cubemaps)
+            int pixelSize = GetPixelDataSize(1, 1, image.format);
+            const void *faces[6] = { 0 };
+            for (int i = 0; i < 6; i++) faces[i] = (unsigned char *)image.data + ((size_t)faceY[i]*size*image.width + (size_t)faceX[i]*size)*pixelSize;
+
+            cubemap.id = rlLoadTextureCubemapFaces(faces, size, image.format, image.width);
+        }
+
+        if (cubemap.id == 0) TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+        else
+        {
+            cubemap.mipmaps = 1;
+            cubemap.format = image.format;
+        }
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
+
+    return cubemap;
+}
+
+// Generate cubemap from equirectangular panorama texture
+// NOTE: Panorama is mapped as in models_skybox example, cubemap is sampled with vertically flipped direction
+TextureCubemap GenTextureCubemap(Texture2D panorama, int size, int format)
+{
+    TextureCubemap cubemap = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((panorama.id == 0) || (size <= 0)) return cubemap;
+
+    const char *cubemapFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec3 fragPosition;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "#define TEXTURE texture            \n"
+    "#define FRAG_COLOR finalColor      \n"
+    "in vec3 fragPosition;              \n"
+    "out vec4 finalColor;               \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec3 fragPosition;         \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 v = normalize(fragPosition); \n"
+    "    vec2 uv = vec2(atan(v.z, v.x), asin(v.y))*vec2(0.1591, 0.3183) + 0.5; \n"
+    "    FRAG_COLOR = vec4(TEXTURE(texture0, uv).rgb, 1.0); \n"
+    "}                                  \n";
+
+    Shader shader = LoadShaderCubemapPass(cubemapFShaderCode);
+    if (shader.id == 0) return cubemap;
+
+    cubemap.id = rlLoadTextureCubemap(NULL, size, format, 1);
+
+    if (cubemap.id > 0)
+    {
+        rlDrawRenderBatchActive();
+        rlActiveTextureSlot(0);
+        rlEnableTexture(panorama.id);
+        DrawTextureCubemapFaces(shader, cubemap.id, size, 0);
+        rlDisableTexture();
+
+        cubemap.width = size;
+        cubemap.height = size;
+        cubemap.mipmaps = 1;
+        cubemap.format = format;
+    }
+
+    UnloadShader(shader);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Cubemap generation requires OpenGL 2.1 or higher");
+#endif
+
+    return cubemap;
+}
+
+// Generate irradiance cubemap from environment cubemap
+// NOTE: Environment is convolved over the hemisphere of every direction (diffuse lighting), cubemap format is float RGBA
+TextureCubemap GenTextureIrradiance(TextureCubemap cubemap, int size)
+{
+    TextureCubemap irradiance = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if ((cubemap.id == 0) || (size <= 0)) return irradiance;
+
+    const char *irradianceFShaderCode =
+    "#version 330                       \n"
+    "in vec3 fragPosition;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform samplerCube environmentMap; \n"
+    "const float PI = 3.14159265359;    \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 normal = normalize(fragPosition); \n"
+    "    vec3 up = (abs(normal.y) < 0.999)? vec3(0.0, 1.0, 0.0) : vec3(0.0, 0.0, 1.0); \n"
+    "    vec3 right = normalize(cross(up, normal)); \n"
+    "    up = cross(normal, right);     \n"
+    "    vec3 irradiance = vec3(0.0);   \n"
+    "    float sampleCount = 0.0;       \n"
+    "    for (float phi = 0.0; phi < 2.0*PI; phi += 0.025) \n"
+    "    {                              \n"
+    "        for (float theta = 0.0; theta < 0.5*PI; theta += 0.025) \n"
+    "        {                          \n"
+    "            vec3 tangentSample = vec3(sin(theta)*cos(phi), sin(theta)*sin(phi), cos(theta)); \n"
+    "            vec3 sampleVec = tangentSample.x*right + tangentSample.y*up + tangentSample.z*normal; \n"
+    "            irradiance += texture(environmentMap, sampleVec).rgb*cos(theta)*sin(theta); \n"
+    "            sampleCount += 1.0;    \n"
+    "        }                          \n"
+    "    }                              \n"
+    "    finalColor = vec4(PI*irradiance/sampleCount, 1.0); \n"
+    "}                                  \n";
+
+    Shader shader = LoadShaderCubemapPass(irradianceFShaderCode);
+    if (shader.id == 0) return irradiance;
+
+    irradiance.id = rlLoadTextureCubemap(NULL, size, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+
+    if (irradiance.id > 0)
+    {
+        rlDrawRenderBatchActive();
+        rlActiveTextureSlot(0);
+        rlEnableTextureCubemap(cubemap.id);
+        DrawTextureCubemapFaces(shader, irradiance.id, size, 0);
+        rlDisableTextureCubemap();
+
+        irradiance.width = size;
+        irradiance.height = size;
+        irradiance.mipmaps = 1;
+        irradiance.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+    }
+
+    UnloadShader(shader);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Irradiance cubemap generation requires OpenGL 3.3");
+#endif
+
+    return irradiance;
+}
+
+// Generate prefiltered cubemap from environment cubemap
+// NOTE: Environment is convolved with GGX distribution (specular lighting), roughness increases linearly by mipmap level
+// from 0.0 (level 0) to 1.0 (last level), sample with textureLod(prefilterMap, R, roughness*(mipmaps - 1)), format is float RGBA
+TextureCubemap GenTexturePrefiltered(TextureCubemap cubemap, int size)
+{
+    TextureCubemap prefiltered = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if ((cubemap.id == 0) || (size <= 0)) return prefiltered;
+
+    const char *prefilterFShaderCode =
+    "#version 330                       \n"
+    "in vec3 fragPosition;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform samplerCube environmentMap; \n"
+    "uniform float roughness;           \n"
+    "uniform float resolution;          \n"
+    "uniform int sampleCount;           \n"
+    "const float PI = 3.14159265359;    \n"
+    "vec2 Hammersley(uint i, uint n)    \n"
+    "{                                  \n"
+    "    uint bits = (i << 16u) | (i >> 16u); \n"
+    "    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u); \n"
+    "    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u); \n"
+    "    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u); \n"
+    "    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u); \n"
+    "    return vec2(float(i)/float(n), float(bits)*2.3283064365386963e-10); \n"
+    "}                                  \n"
+    "vec3 ImportanceSampleGGX(vec2 xi, vec3 n, float a) \n"
+    "{                                  \n"
+    "    float phi = 2.0*PI*xi.x;       \n"
+    "    float cosTheta = sqrt((1.0 - xi.y)/(1.0 + (a*a - 1.0)*xi.y)); \n"
+    "    float sinTheta = sqrt(1.0 - cosTheta*cosTheta); \n"
+    "    vec3 up = (abs(n.z) < 0.999)? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0); \n"
+    "    vec3 tangent = normalize(cross(up, n)); \n"
+    "    vec3 bitangent = cross(n, tangent); \n"
+    "    return normalize(tangent*cos(phi)*sinTheta + bitangent*sin(phi)*sinTheta + n*cosTheta); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 n = normalize(fragPosition); \n"
+    "    float a = roughness*roughness; \n"
+    "    float texelSolidAngle = 4.0*PI/(6.0*resolution*resolution); \n"
+    "    vec3 color = vec3(0.0);        \n"
+    "    float weight = 0.0;            \n"
+    "    for (int i = 0; i < sampleCount; i++) \n"
+    "    {                              \n"
+    "        vec3 h = ImportanceSampleGGX(Hammersley(uint(i), uint(sampleCount)), n, a); \n"
+    "        vec3 l = normalize(2.0*dot(n, h)*h - n); \n"
+    "        float NdotL = dot(n, l);   \n"
+    "        if (NdotL > 0.0)           \n"
+    "        {                          \n"
+    "            float NdotH = max(dot(n, h), 0.0); \n"
+    "            float d = (NdotH*NdotH*(a*a - 1.0) + 1.0); \n"
+    "            float pdf = (a*a/(PI*d*d))/4.0 + 0.0001; \n"
+    "            float sampleSolidAngle = 1.0/(float(sampleCount)*pdf + 0.0001); \n"
+    "            float level = (roughness == 0.0)? 0.0 : 0.5*log2(sampleSolidAngle/texelSolidAngle); \n"
+    "            color += textureLod(environmentMap, l, level).rgb*NdotL; \n"
+    "            weight += NdotL;       \n"
+    "        }                          \n"
+    "    }                              \n"
+    "    finalColor = vec4(color/max(weight, 0.0001), 1.0); \n"
+    "}                                  \n";
+
+    Shader shader = LoadShaderCubemapPass(prefilterFShaderCode);
+    if (shader.id == 0) return prefiltered;
+
+    int mipmaps = 1;
+    while ((mipmaps < IBL_PREFILTERED_MIPMAPS) && ((size >> mipmaps) > 0)) mipmaps++;
+
+    prefiltered.id = rlLoadTextureCubemap(NULL, size, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, mipmaps);
+
+    if (prefiltered.id > 0)
+    {
+        int roughnessLoc = rlGetLocationUniform(shader.id, "roughness");
+        int resolutionLoc = rlGetLocationUniform(shader.id, "resolution");
+        int sampleCountLoc = rlGetLocationUniform(shader.id, "sampleCount");
+        float resolution = (float)cubemap.width;
+        int sampleCount = IBL_SAMPLE_COUNT;
+
+        rlDrawRenderBatchActive();
+        rlEnableShader(shader.id);
+        rlSetUniform(resolutionLoc, &resolution, SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(sampleCountLoc, &sampleCount, SHADER_UNIFORM_INT, 1);
+
+        rlActiveTextureSlot(0);
+        rlEnableTextureCubemap(cubemap.id);
+
+        for (int level = 0; level < mipmaps; level++)
+        {
+            float roughness = (mipmaps > 1)? (float)level/(float)(mipmaps - 1) : 0.0f;
+
+            rlEnableShader(shader.id);
+            rlSetUniform(roughnessLoc, &roughness, SHADER_UNIFORM_FLOAT, 1);
+            DrawTextureCubemapFaces(shader, prefiltered.id, size >> level, level);
+        }
+
+        rlDisableTextureCubemap();
+
+        prefiltered.width = size;
+        prefiltered.height = size;
+        prefiltered.mipmaps = mipmaps;
+        prefiltered.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+    }
+
+    UnloadShader(shader);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Prefiltered cubemap generation requires OpenGL 3.3");
+#endif
+
+    return prefiltered;
+}
+
+// Generate BRDF integration lookup texture
+// NOTE: Split-sum approximation scale (red) and bias (green) to specular color, by NdotV (u) and roughness (v), format is float RGBA
+Texture2D GenTextureBRDF(int size)
+{
+    Texture2D texture = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (size <= 0) return texture;
+
+    const char *brdfVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    gl_Position = vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *brdfFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform int sampleCount;           \n"
+    "const float PI = 3.14159265359;    \n"
+    "vec2 Hammersley(uint i, uint n)    \n"
+    "{                                  \n"
+    "    uint bits = (i << 16u) | (i >> 16u); \n"
+    "    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u); \n"
+    "    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u); \n"
+    "    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u); \n"
+    "    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u); \n"
+    "    return vec2(float(i)/float(n), float(bits)*2.3283064365386963e-10); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float NdotV = max(fragTexCoord.x, 0.0001); \n"
+    "    float a = fragTexCoord.y*fragTexCoord.y; \n"
+    "    float k = a/2.0;               \n"
+    "    vec3 v = vec3(sqrt(1.0 - NdotV*NdotV), 0.0, NdotV); \n"
+    "    vec2 result = vec2(0.0);       \n"
+    "    for (int i = 0; i < sampleCount; i++) \n"
+    "    {                              \n"
+    "        vec2 xi = Hammersley(uint(i), uint(sampleCount)); \n"
+    "        float phi = 2.0*PI*xi.x;   \n"
+    "        float cosTheta = sqrt((1.0 - xi.y)/(1.0 + (a*a - 1.0)*xi.y)); \n"
+    "        float sinTheta = sqrt(1.0 - cosTheta*cosTheta); \n"
+    "        vec3 h = vec3(cos(phi)*sinTheta, sin(phi)*sinTheta, cosTheta); \n"
+    "        vec3 l = normalize(2.0*dot(v, h)*h - v); \n"
+    "        float NdotL = max(l.z, 0.0); \n"
+    "        float NdotH = max(h.z, 0.0); \n"
+    "        float VdotH = max(dot(v, h), 0.0); \n"
+    "        if (NdotL > 0.0)           \n"
+    "        {                          \n"
+    "            float g = (NdotV/(NdotV*(1.0 - k) + k))*(NdotL/(NdotL*(1.0 - k) + k)); \n"
+    "            float gVis = (g*VdotH)/(NdotH*NdotV); \n"
+    "            float fc = pow(1.0 - VdotH, 5.0); \n"
+    "            result += vec2((1.0 - fc)*gVis, fc*gVis); \n"
+    "        }                          \n"
+    "    }                              \n"
+    "    finalColor = vec4(result/float(sampleCount), 0.0, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(brdfVShaderCode, brdfFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return texture;
+
+    texture.id = rlLoadTexture(NULL, size, size, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    unsigned int fbo = rlLoadFramebuffer(size, size);
+
+    if ((texture.id > 0) && (fbo > 0))
+    {
+        rlFramebufferAttach(fbo, texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        if (rlFramebufferComplete(fbo))
+        {
+            int sampleCount = IBL_SAMPLE_COUNT;
+
+            rlDrawRenderBatchActive();
+            rlEnableFramebuffer(fbo);
+            rlViewport(0, 0, size, size);
+
+            rlEnableShader(shader.id);
+            rlSetUniform(rlGetLocationUniform(shader.id, "sampleCount"), &sampleCount, SHADER_UNIFORM_INT, 1);
+            rlLoadDrawQuad();
+            rlDisableShader();
+
+            rlDisableFramebuffer();
+            rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+        }
+
+        texture.width = size;
+        texture.height = size;
+        texture.mipmaps = 1;
+        texture.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+        SetTextureWrap(texture, TEXTURE_WRAP_CLAMP);
+    }
+
+    if (fbo > 0) rlUnloadFramebuffer(fbo);
+    UnloadShader(shader);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: BRDF texture generation requires OpenGL 3.3");
+#endif
+
+    return texture;
+}
+
+// Export cubemap faces and mipmaps to file
+// NOTE: Cubemap is stored as KTX 1.1 file (uncompressed or compressed formats), cubemap data is read back from GPU,
+// intended to cache generated cubemaps, i.e. GenTextureIrradiance(), GenTexturePrefiltered()
+bool ExportTextureCubemap(TextureCubemap cubemap, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    if ((cubemap.id > 0) && IsFileExtension(fileName, ".ktx"))
+    {
+        int mipmaps = (cubemap.mipmaps > 0)? cubemap.mipmaps : 1;
+        void *data = rlReadTextureCubemapPixels(cubemap.id, cubemap.width, cubemap.format, mipmaps);
+
+        if (data != NULL)
+        {
+            success = rl_save_ktx_cubemap(fileName, data, cubemap.width, cubemap.format, mipmaps);
+            RL_FREE(data);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Cubemap export requires a valid cubemap and .ktx file");
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Cubemap export requires KTX file format support (SUPPORT_FILEFORMAT_KTX)");
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Cubemap exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export cubemap", fileName);
+
+    return success;
+}
+
+// Load cubemap with mipmaps from file
+// NOTE: Only KTX 1.1 cubemap files are supported (.ktx), i.e. exported with ExportTextureCubemap()
+TextureCubemap LoadTextureCubemapFromFile(const char *fileName)
+{
+    TextureCubemap cubemap = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        int size = 0, format = 0, mipmaps = 0;
+        void *data = rl_load_ktx_cubemap_from_memory(fileData, dataSize, &size, &format, &mipmaps);
+
+        if (data != NULL)
+        {
+            cubemap.id = rlLoadTextureCubemap(data, size, format, mipmaps);
+
+            if (cubemap.id > 0)
+            {
+                cubemap.width = size;
+                cubemap.height = size;
+                cubemap.mipmaps = mipmaps;
+                cubemap.format = format;
+            }
+
+            RL_FREE(data);
+        }
+
+        UnloadFileData(fileData);
+    }
+
+    if (cubemap.id == 0) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load cubemap file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Cubemap loading requires KTX file format support (SUPPORT_FILEFORMAT_KTX)");
+#endif
+
+    return cubemap;
+}
+
+// Load texture array from images
+// NOTE: All layers must have same size, layers are converted to first image format (uncompressed formats only),
+// texture mipmaps are generated on GPU if first image has mipmaps, layers count is not stored in texture
+Texture2DArray LoadTextureArray(const Image *layers, int layerCount)
+{
+    Texture2DArray texture = { 0 };
+
+    unsigned char *data = LoadTextureLayersData(layers, layerCount);
+
+    if (data != NULL)
+    {
+        texture.id = rlLoadTextureArray(data, layers[0].width, layers[0].height, layerCount, layers[0].format, (layers[0].mipmaps > 1));
+        RL_FREE(data);
+    }
+
+    if (texture.id > 0)
+    {
+        texture.width = layers[0].width;
+        texture.height = layers[0].height;
+        texture.format = layers[0].format;
+        texture.mipmaps = 1;
+
+        if (layers[0].mipmaps > 1)
+        {
+            int size = (texture.width > texture.height)? texture.width : texture.height;
+            while (size > 1) { size /= 2; texture.mipmaps++; }
+        }
+    }
+
+    return texture;
+}
+
+// Load 3d texture from images slices
+// NOTE: All slices must have same size, slices are converted to first image format (uncompressed formats only)
+Texture3D LoadTexture3D(const Image *slices, int sliceCount)
+{
+    Texture3D texture = { 0 };
+
+    unsigned char *data = LoadTextureLayersData(slices, sliceCount);
+
+    if (data != NULL)
+    {
+        texture.id = rlLoadTexture3D(data, slices[0].width, slices[0].height, sliceCount, slices[0].format);
+        RL_FREE(data);
+    }
+
+    if (texture.id > 0)
+    {
+        texture.width = slices[0].width;
+        texture.height = slices[0].height;
+        texture.format = slices[0].format;
+        texture.mipmaps = 1;
+    }
+
+    return texture;
+}
+
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    return LoadRenderTextureEx(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, true);
+}
+
+// Load texture for rendering (framebuffer) with color format and optional depth RenderBuffer
+// NOTE: Color format must be uncompressed, float formats (HDR targets) require GPU support for rendering to them
+RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool depth)
+{
+    RenderTexture2D target = { 0 };
+
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "FBO: Render texture color format must be uncompressed");
+        return target;
+    }
+
+    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+
+        // Attach color texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        if (depth)
+        {
+            // Create depth renderbuffer/texture
+            target.depth.id = rlLoadTextureDepth(width, height, true);
+            target.depth.width = width;
+            target.depth.height = height;
+            target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+            target.depth.mipmaps = 1;
+
+            // Attach depth renderbuffer/texture to FBO
+            rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+        }
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Load multisample texture for rendering (framebuffer)
+// NOTE: Drawing is done on multisample color and depth renderbuffers, color is resolved into render texture
+// color texture (RGBA) on EndTextureMode(), single sample render texture loaded if multisampling not supported
+RenderTexture2D LoadRenderTextureMultisample(int width, int height, int samples)
+{
+    if (samples <= 1) return LoadRenderTexture(width, height);
+
+    RenderTexture2D target = { 0 };
+
+    unsigned int colorId = rlLoadRenderbufferMultisample(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, samples);
+
+    if (colorId == 0)
+    {
+        TRACELOG(LOG_WARNING, "FBO: Multisample render textures not supported, single sample render texture loaded");
+        return LoadRenderTexture(width, height);
+    }
+
+    // Resolve framebuffer, color texture only
+    RenderTexture2D resolve = LoadRenderTextureEx(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false);
+
+    target.id = rlLoadFramebuffer(width, height);
+    if (target.id > 0) rlFramebufferAttach(target.id, colorId, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+    if ((target.id > 0) && (resolve.id > 0))
+    {
+        target.texture = resolve.texture;
+
+        target.depth.id = rlLoadRenderbufferDepthMultisample(width, height, samples);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Multisample framebuffer object created successfully (%i samples)", target.id, samples);
+
+        renderTextureMultisample.entries = (RenderTextureMultisample *)RL_REALLOC(renderTextureMultisample.entries, (renderTextureMultisample.count + 1)*sizeof(RenderTextureMultisample));
+        renderTextureMultisample.entries[renderTextureMultisample.count++] = (RenderTextureMultisample){ target.id, resolve.id, width, height };
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FBO: Multisample framebuffer object can not be created");
+
+        if (resolve.id > 0) UnloadRenderTexture(resolve);
+        if (target.id > 0) rlUnloadFramebuffer(target.id);
+        target = (RenderTexture2D){ 0 };
+    }
+
+    return target;
+}
+
+// Check if a texture is ready
+bool IsTextureReady(Texture2D texture)
+{
+    // TODO: Validate maximum texture size supported by GPU?
+
+    return ((texture.id > 0) &&         // Validate OpenGL id
+            (texture.width > 0) &&
+            (texture.height > 0) &&     // Validate texture size
+            (texture.format > 0) &&     // Validate texture pixel format
+            (texture.mipmaps > 0));     // Validate texture mipmaps (at least 1 for basic mipmap level)
+}
+
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+#if defined(SUPPORT_TEXTURE_STREAMING)
+        int index = GetTextureStreamIndex(texture.id);
+        if (index >= 0) RemoveTextureStream(index);
+#endif
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Check if a render texture is ready
+// NOTE: Depth texture/renderbuffer is optional (LoadRenderTextureEx())
+bool IsRenderTextureReady(RenderTexture2D target)
+{
+    return ((target.id > 0) &&                  // Validate OpenGL id
+            ((target.depth.id == 0) || IsTextureReady(target.depth)) &&     // Validate FBO depth texture/renderbuffer
+            IsTextureReady(target.texture));    // Validate FBO texture
+}
+
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        // Unload multisample render texture resolve framebuffer (color texture unloaded below)
+        for (int i = 0; i < renderTextureMultisample.count; i++)
+        {
+            if (renderTextureMultisample.entries[i].id == target.id)
+            {
+                rlUnloadFramebuffer(renderTextureMultisample.entries[i].resolveId);
+                renderTextureMultisample.entries[i] = renderTextureMultisample.entries[--renderTextureMultisample.count];
+
+                if (renderTextureMultisample.count == 0)
+                {
+                    RL_FREE(renderTextureMultisample.entries);
+                    renderTextureMultisample.entries = NULL;
+                }
+                break;
+            }
+        }
+
+        // Remove render texture from pool if it was acquired from it
+        for (int i = 0; i < renderTexturePool.count; i++)
+        {
+            if (renderTexturePool.entries[i].target.id == target.id)
+            {
+                renderTexturePool.entries[i] = renderTexturePool.entries[--renderTexturePool.count];
+                break;
+            }
+        }
+
+        // Color texture attached to FBO is deleted
+        rlUnloadTexture(target.texture.id);
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture array layer with new data
+// NOTE: pixels data must match texture.format and size
+void UpdateTextureArrayLayer(Texture2DArray texture, int layer, const void *pixels)
+{
+    rlUpdateTextureLayer(texture.id, RL_TEXTURE_2D_ARRAY, layer, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU 3d texture slice with new data
+// NOTE: pixels data must match texture.format and size
+void UpdateTexture3DSlice(Texture3D texture, int slice, const void *pixels)
+{
+    rlUpdateTextureLayer(texture.id, RL_TEXTURE_3D, slice, texture.width, texture.height, texture.format, pixels);
+}
+
+// Acquire render texture from pool
+// NOTE: A released render texture with same size, format and depth is reused if available, otherwise a new one is loaded;
+// depth contents are transient, they are not kept after EndTextureMode() (not stored to memory on tile-based GPUs)
+RenderTexture2D AcquireRenderTexture(int width, int height, int format, bool depth)
+{
+    RenderTexture2D target = { 0 };
+
+    for (int i = 0; i < renderTexturePool.count; i++)
+    {
+        RenderTexturePoolEntry *entry = &renderTexturePool.entries[i];
+
+        if (!entry->acquired && (entry->depth == depth) && (entry->target.texture.width == width) &&
+            (entry->target.texture.height == height) && (entry->target.texture.format == format))
+        {
+            entry->acquired = true;
+            return entry->target;
+        }
+    }
+
+    // Pool full, unload least recently released render texture
+    if (renderTexturePool.count == RENDER_TEXTURE_POOL_SIZE)
+    {
+        int oldest = -1;
+
+        for (int i = 0; i < renderTexturePool.count; i++)
+        {
+            const RenderTexturePoolEntry *entry = &renderTexturePool.entries[i];
+            if (!entry->acquired && ((oldest < 0) || (entry->frame < renderTexturePool.entries[oldest].frame))) oldest = i;
+        }
+
+        if (oldest >= 0) UnloadRenderTexture(renderTexturePool.entries[oldest].target);   // Removed from pool
+    }
+
+    target = LoadRenderTextureEx(width, height, format, depth);
+
+    // NOTE: If all pooled render textures are acquired, new render texture is not pooled (unloaded on release)
+    if ((target.id > 0) && (renderTexturePool.count < RENDER_TEXTURE_POOL_SIZE))
+    {
+        renderTexturePool.entries[renderTexturePool.count++] = (RenderTexturePoolEntry){ target, depth, true, renderTexturePool.frame };
+    }
+
+    return target;
+}
+
+// Release render texture to pool
+// NOTE: Released render texture is unloaded if not acquired again in RENDER_TEXTURE_POOL_FRAMES frames
+void ReleaseRenderTexture(RenderTexture2D target)
+{
+    if (target.id == 0) return;
+
+    for (int i = 0; i < renderTexturePool.count; i++)
+    {
+        RenderTexturePoolEntry *entry = &renderTexturePool.entries[i];
+
+        if (entry->target.id == target.id)
+        {
+            entry->acquired = false;
+            entry->frame = renderTexturePool.frame;
+            return;
+        }
+    }
+
+    UnloadRenderTexture(target);
+}
+
+// Update GPU texture with new data
+// NOTE: pixels data must match texture.format
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE: pixels data must match texture.format
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data through pixel buffer
+// NOTE: pixels data is copied before returning, GPU transfer is completed asynchronously (requires OpenGL 3.2)
+void UpdateTextureRecAsync(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTextureAsync(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Copy texture rectangle into another texture on GPU
+// NOTE: Texels are copied as stored (same coordinates as UpdateTextureRec()), no scaling, region is clipped
+// to both textures bounds, pending batch draws are processed before copy (source could be a render target)
+bool CopyTextureRegion(Texture2D src, Rectangle srcRec, Texture2D dst, Vector2 dstPos)
+{
+    int srcX = (int)srcRec.x;
+    int srcY = (int)srcRec.y;
+    int dstX = (int)dstPos.x;
+    int dstY = (int)dstPos.y;
+    int width = (int)srcRec.width;
+    int height = (int)srcRec.height;
+
+    // Clip region to source and destination bounds
+    if (srcX < 0) { width += srcX; dstX -= srcX; srcX = 0; }
+    if (srcY < 0) { height += srcY; dstY -= srcY; srcY = 0; }
+    if (dstX < 0) { width += dstX; srcX -= dstX; dstX = 0; }
+    if (dstY < 0) { height += dstY; srcY -= dstY; dstY = 0; }
+    if ((srcX + width) > src.width) width = src.width - srcX;
+    if ((srcY + height) > src.height) height = src.height - srcY;
+    if ((dstX + width) > dst.width) width = dst.width - dstX;
+    if ((dstY + height) > dst.height) height = dst.height - dstY;
+
+    if ((width <= 0) || (height <= 0)) return false;
+
+    rlDrawRenderBatchActive();
+
+    return rlCopyTextureRegion(src.id, src.format, srcX, srcY, dst.id, dst.format, dstX, dstY, width, height);
+}
+
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load atlas builder, images packed into texture pages on demand
+// NOTE: Pages are R8G8B8A8 textures, sprites drawn from same page are batched in one draw call,
+// pages top-left corner is a white region registered for shapes drawing (AddShapesTexture()),
+// shapes drawn between sprites of the same page do not break the batch
+AtlasBuilder *LoadAtlasBuilder(int pageWidth, int pageHeight, int padding)
+{
+    AtlasBuilder *atlas = (AtlasBuilder *)RL_CALLOC(1, sizeof(AtlasBuilder));
+
+    atlas->pageWidth = pageWidth;
+    atlas->pageHeight = pageHeight;
+    atlas->padding = (padding > 0)? padding : 0;
+
+    return atlas;
+}
+
+// Unload atlas builder and pages textures
+void UnloadAtlasBuilder(AtlasBuilder *atlas)
+{
+    if (atlas == NULL) return;
+
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+#if defined(SUPPORT_MODULE_RSHAPES)
+        RemoveShapesTexture(atlas->pages[i].texture);
+#endif
+        UnloadTexture(atlas->pages[i].texture);
+        RL_FREE(atlas->pages[i].freeRects);
+    }
+
+    RL_FREE(atlas->pages);
+    RL_FREE(atlas->entries);
+    RL_FREE(atlas);
+}
+
+// Pack image into atlas page, image uploaded with padding edges extruded
+// NOTE: Free rectangle is chosen by best area fit on existing pages, a new page is loaded if image does not fit
+AtlasRegion AddAtlasImage(AtlasBuilder *atlas, Image image)
+{
+    AtlasRegion region = { 0 };
+    region.id = -1;
+
+    // Security check to avoid program crash
+    if ((atlas == NULL) || (image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return region;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas compressed images not supported");
+        return region;
+    }
+
+    int padding = atlas->padding;
+    int width = image.width + 2*padding;
+    int height = image.height + 2*padding;
+
+    if ((width > atlas->pageWidth) || (height > (atlas->pageHeight - ATLAS_SHAPES_REGION_SIZE)))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas image (%i x %i) does not fit atlas page (%i x %i)", image.width, image.height, atlas->pageWidth, atlas->pageHeight);
+        return region;
+    }
+
+    // Best area fit, ties broken by shorter leftover side
+    int bestPage = -1;
+    int bestRect = -1;
+    int bestArea = INT_MAX;
+    int bestSide = INT_MAX;
+
+    for (int p = 0; p < atlas->pageCount; p++)
+    {
+        for (int r = 0; r < atlas->pages[p].freeCount; r++)
+        {
+            AtlasRect space = atlas->pages[p].freeRects[r];
+
+            if ((space.width < width) || (space.height < height)) continue;
+
+            int area = space.width*space.height - width*height;
+            int side = ((space.width - width) < (space.height - height))? (space.width - width) : (space.height - height);
+
+            if ((area < bestArea) || ((area == bestArea) && (side < bestSide)))
+            {
+                bestPage = p;
+                bestRect = r;
+                bestArea = area;
+                bestSide = side;
+            }
+        }
+    }
+
+    if (bestPage < 0)
+    {
+        AtlasPage *pages = (AtlasPage *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(AtlasPage));
+        if (pages == NULL) return region;
+        atlas->pages = pages;
+
+        AtlasPage page = { 0 };
+        unsigned char *blank = (unsigned char *)RL_CALLOC(atlas->pageWidth*atlas->pageHeight, 4);
+
+        // Shapes white region, inner texels sampled (no filtering bleeding)
+        for (int y = 0; y < ATLAS_SHAPES_REGION_SIZE; y++) memset(blank + y*atlas->pageWidth*4, 0xff, ATLAS_SHAPES_REGION_SIZE*4);
+
+        page.texture.id = rlLoadTexture(blank, atlas->pageWidth, atlas->pageHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        page.texture.width = atlas->pageWidth;
+        page.texture.height = atlas->pageHeight;
+        page.texture.mipmaps = 1;
+        page.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        RL_FREE(blank);
+
+        if (page.texture.id == 0)
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Atlas page could not be loaded");
+            return region;
+        }
+
+        ResetAtlasPageFreeRects(&page, atlas->pageWidth, atlas->pageHeight);
+
+#if defined(SUPPORT_MODULE_RSHAPES)
+        AddShapesTexture(page.texture, (Rectangle){ 1.0f, 1.0f, ATLAS_SHAPES_REGION_SIZE - 2.0f, ATLAS_SHAPES_REGION_SIZE - 2.0f });
+#endif
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Atlas page %i loaded successfully (%i x %i)", page.texture.id, atlas->pageCount, atlas->pageWidth, atlas->pageHeight);
+
+        atlas->pages[atlas->pageCount] = page;
+        bestPage = atlas->pageCount;
+        atlas->pageCount++;
+
+        // NOTE: Image fits page area below shapes white region
+        for (int r = 0; (r < page.freeCount) && (bestRect < 0); r++)
+        {
+            if ((page.freeRects[r].width >= width) && (page.freeRects[r].height >= height)) bestRect = r;
+        }
+    }
+
+    AtlasPage *page = &atlas->pages[bestPage];
+    AtlasRect space = page->freeRects[bestRect];
+    page->freeRects[bestRect] = page->freeRects[page->freeCount - 1];
+    page->freeCount--;
+
+    // Guillotine split along shorter leftover axis
+    AtlasRect right = { space.x + width, space.y, space.width - width, space.height };
+    AtlasRect bottom = { space.x, space.y + height, width, space.height - height };
+
+    if ((space.width - width) < (space.height - height))
+    {
+        right.height = height;
+        bottom.width = space.width;
+    }
+
+    if ((right.width > 0) && (right.height > 0)) AddAtlasFreeRect(page, right);
+    if ((bottom.width > 0) && (bottom.height > 0)) AddAtlasFreeRect(page, bottom);
+
+    // Padded image pixels, padding filled extruding image edges (no filtering bleeding)
+    Color *pixels = LoadImageColors(image);
+    Color *padded = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        int sy = (y < padding)? 0 : (y - padding >= image.height)? image.height - 1 : y - padding;
+        Color *row = padded + y*width;
+
+        memcpy(row + padding, pixels + sy*image.width, image.width*sizeof(Color));
+
+        for (int x = 0; x < padding; x++)
+        {
+            row[x] = row[padding];
+            row[width - 1 - x] = row[padding + image.width - 1];
+        }
+    }
+
+    rlUpdateTexture(page->texture.id, space.x, space.y, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, padded);
+
+    RL_FREE(padded);
+    UnloadImageColors(pixels);
+
+    // Inactive regions ids are reused
+    int id = 0;
+    while ((id < atlas->entryCount) && atlas->entries[id].active) id++;
+
+    if (id == atlas->entryCount)
+    {
+        AtlasEntry *entries = (AtlasEntry *)RL_REALLOC(atlas->entries, (atlas->entryCount + 1)*sizeof(AtlasEntry));
+        if (entries == NULL) return region;
+
+        atlas->entries = entries;
+        atlas->entryCount++;
+    }
+
+    atlas->entries[id].page = bestPage;
+    atlas->entries[id].rect = (AtlasRect){ space.x, space.y, width, height };
+    atlas->entries[id].active = true;
+    page->regionCount++;
+
+    region.texture = page->texture;
+    region.source = (Rectangle){ (float)(space.x + padding), (float)(space.y + padding), (float)image.width, (float)image.height };
+    region.id = id;
+
+    return region;
+}
+
+// Remove image from atlas, region space reused by next images
+// NOTE: Page texture is kept loaded, pixels are not cleared
+void RemoveAtlasImage(AtlasBuilder *atlas, int id)
+{
+    if ((atlas == NULL) || (id < 0) || (id >= atlas->entryCount) || !atlas->entries[id].active) return;
+
+    AtlasEntry *entry = &atlas->entries[id];
+    AtlasPage *page = &atlas->pages[entry->page];
+
+    entry->active = false;
+    page->regionCount--;
+
+    // Empty pages are fully available again, avoiding free space fragmentation
+    if (page->regionCount == 0) ResetAtlasPageFreeRects(page, atlas->pageWidth, atlas->pageHeight);
+    else AddAtlasFreeRect(page, entry->rect);
+}
+
+// Get atlas image region (texture and source rectangle)
+AtlasRegion GetAtlasRegion(const AtlasBuilder *atlas, int id)
+{
+    AtlasRegion region = { 0 };
+    region.id = -1;
+
+    if ((atlas != NULL) && (id >= 0) && (id < atlas->entryCount) && atlas->entries[id].active)
+    {
+        const AtlasEntry *entry = &atlas->entries[id];
+
+        region.texture = atlas->pages[entry->page].texture;
+        region.source = (Rectangle){ (float)(entry->rect.x + atlas->padding), (float)(entry->rect.y + atlas->padding),
+            (float)(entry->rect.width - 2*atlas->padding), (float)(entry->rect.height - 2*atlas->padding) };
+        region.id = id;
+    }
+
+    return region;
+}
+
+// Get atlas pages count
+int GetAtlasPageCount(const AtlasBuilder *atlas)
+{
+    return (atlas != NULL)? atlas->pageCount : 0;
+}
+
+// Get atlas page texture
+Texture2D GetAtlasPage(const AtlasBuilder *atlas, int page)
+{
+    Texture2D texture = { 0 };
+
+    if ((atlas != NULL) && (page >= 0) && (page < atlas->pageCount)) texture = atlas->pages[page].texture;
+
+    return texture;
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrap)
+{
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture filters functions (GPU image processing)
+//------------------------------------------------------------------------------------
+// Load render texture from image data
+// NOTE: Image rows are uploaded in order, filters keep rows order so LoadImageFromTexture() returns an unflipped image
+RenderTexture2D LoadRenderTextureFromImage(Image image)
+{
+    RenderTexture2D target = { 0 };
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return target;
+
+    target = LoadRenderTexture(image.width, image.height);
+
+    if (target.id > 0)
+    {
+        Color *pixels = LoadImageColors(image);
+        rlUpdateTexture(target.texture.id, 0, 0, image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pixels);
+        UnloadImageColors(pixels);
+    }
+
+    return target;
+}
+
+// Modify render texture color: tint
+void TextureColorTint(RenderTexture2D *target, Color color)
+{
+    ApplyTextureFilter(target, 0, ColorNormalize(color), (Vector4){ 0 });
+}
+
+// Modify render texture color: invert
+void TextureColorInvert(RenderTexture2D *target)
+{
+    ApplyTextureFilter(target, 1, (Vector4){ 0 }, (Vector4){ 0 });
+}
+
+// Modify render texture color: grayscale
+// NOTE: Same luminance weights as ImageColorGrayscale(), alpha is set to 255 (grayscale format has no alpha)
+void TextureColorGrayscale(RenderTexture2D *target)
+{
+    ApplyTextureFilter(target, 2, (Vector4){ 0 }, (Vector4){ 0 });
+}
+
+// Modify render texture color: contrast
+// NOTE: Contrast values between -100 and 100
+void TextureColorContrast(RenderTexture2D *target, float contrast)
+{
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    ApplyTextureFilter(target, 3, (Vector4){ contrast, 0.0f, 0.0f, 0.0f }, (Vector4){ 0 });
+}
+
+// Modify render texture color: brightness
+// NOTE: Brightness values between -255 and 255
+void TextureColorBrightness(RenderTexture2D *target, int brightness)
+{
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    ApplyTextureFilter(target, 4, (Vector4){ (float)brightness/255.0f, 0.0f, 0.0f, 0.0f }, (Vector4){ 0 });
+}
+
+// Modify render texture color: replace color
+void TextureColorReplace(RenderTexture2D *target, Color color, Color replace)
+{
+    ApplyTextureFilter(target, 5, ColorNormalize(color), ColorNormalize(replace));
+}
+
+// Premultiply render texture alpha channel
+void TextureAlphaPremultiply(RenderTexture2D *target)
+{
+    ApplyTextureFilter(target, 6, (Vector4){ 0 }, (Vector4){ 0 });
+}
+
+// Dither render texture colors to bits per channel
+// NOTE: Ordered dithering (4x4 Bayer matrix), Floyd-Steinberg used by ImageDither() is sequential,
+// render texture keeps RGBA8 format with colors quantized to bits per channel levels
+void TextureDither(RenderTexture2D *target, int rBpp, int gBpp, int bBpp, int aBpp)
+{
+    if ((rBpp < 0) || (rBpp > 8) || (gBpp < 0) || (gBpp > 8) || (bBpp < 0) || (bBpp > 8) || (aBpp < 0) || (aBpp > 8))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Unsupported dithering bpps (%ibpp R, %ibpp G, %ibpp B, %ibpp A)", rBpp, gBpp, bBpp, aBpp);
+        return;
+    }
+
+    Vector4 levels = { (float)((1 << rBpp) - 1), (float)((1 << gBpp) - 1), (float)((1 << bBpp) - 1), (float)((1 << aBpp) - 1) };
+
+    ApplyTextureFilter(target, 7, levels, (Vector4){ 0 });
+}
+
+// Resize render texture
+// NOTE: Bilinear filtering, downscale by more than half is done with successive halving passes (2x2 average),
+// render texture is reloaded with new size, previous framebuffer is unloaded
+void TextureResize(RenderTexture2D *target, int newWidth, int newHeight)
+{
+    if ((target == NULL) || (target->id == 0) || (newWidth <= 0) || (newHeight <= 0)) return;
+    if ((target->texture.width == newWidth) && (target->texture.height == newHeight)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!LoadShaderTextureFilter()) return;
+
+    Texture2D source = target->texture;
+    RenderTexture2D level = { 0 };
+
+    while ((source.width > newWidth*2) || (source.height > newHeight*2))
+    {
+        RenderTexture2D half = LoadTextureFilterTarget((source.width > newWidth*2)? source.width/2 : source.width, (source.height > newHeight*2)? source.height/2 : source.height);
+
+        SetTextureFilter(source, TEXTURE_FILTER_BILINEAR);
+        DrawTextureFilter(source, half, 0, (Vector4){ 1.0f, 1.0f, 1.0f, 1.0f }, (Vector4){ 0 });
+
+        if (level.id > 0) UnloadRenderTexture(level);
+        level = half;
+        source = half.texture;
+    }
+
+    RenderTexture2D resized = LoadRenderTexture(newWidth, newHeight);
+
+    SetTextureFilter(source, TEXTURE_FILTER_BILINEAR);
+    DrawTextureFilter(source, resized, 0, (Vector4){ 1.0f, 1.0f, 1.0f, 1.0f }, (Vector4){ 0 });
+
+    if (level.id > 0) UnloadRenderTexture(level);
+    UnloadRenderTexture(*target);
+    *target = resized;
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Texture filters require OpenGL 2.1 or higher");
+#endif
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw textured polygon, defined by vertex and texture coordinates
+// NOTE: Polygon center must have straight line path to all points
+// without crossing perimeter, points must be in anticlockwise order
+void DrawTexturePoly(Texture2D texture, Vector2 center, Vector2 texcenter, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint)
+{
+    rlSetTexture(texture.id);
+
+    // Texturing is only supported on RL_QUADS
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        for (int i = 0; i < pointCount - 1; i++)
+        {
+            rlTexCoord2f(texcenter.x, texcenter.y);
+            rlVertex2f(center.x, center.y);
+
+            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
+            rlVertex2f(points[i].x + center.x, points[i].y + center.y);
+
+            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
+            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+
+            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
+            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+        }
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + dest.width, y };
+            bottomLeft = (Vector2){ x, y + dest.height };
+            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            // Top-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            else rlTexCoord2f(source.x/width, source.y/height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            // Bottom-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Bottom-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            rlVertex2f(topRight.x, topRight.y);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than just calculating
+        // the vertex positions manually, like done above.
+        // I leave here the old implementation for educational purposes,
+        // just in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draw multiple parts of a texture with 'pro' parameters
+// NOTE: Same result as DrawTexturePro() for every sprite, texture is set once and quads are
+// computed in chunks submitted to render batch at once with rlVertexQuads2D()
+void DrawTextureBatch(Texture2D texture, const SpriteInstance *sprites, int count)
+{
+    if ((texture.id == 0) || (sprites == NULL) || (count <= 0)) return;
+
+    float vertices[SPRITE_BATCH_CHUNK_SIZE*8] = { 0 };      // Quads positions (XY), 4 vertex by quad
+    float texcoords[SPRITE_BATCH_CHUNK_SIZE*8] = { 0 };     // Quads texcoords (UV), 4 vertex by quad
+    unsigned char colors[SPRITE_BATCH_CHUNK_SIZE*4] = { 0 };// Quads colors (RGBA), 1 by quad
+
+    float invWidth = 1.0f/(float)texture.width;
+    float invHeight = 1.0f/(float)texture.height;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int start = 0; start < count; start += SPRITE_BATCH_CHUNK_SIZE)
+        {
+            int chunk = ((count - start) < SPRITE_BATCH_CHUNK_SIZE)? (count - start) : SPRITE_BATCH_CHUNK_SIZE;
+
+            for (int i = 0; i < chunk; i++)
+            {
+                const SpriteInstance *sprite = &sprites[start + i];
+                float *v = vertices + 8*i;
+                float *t = texcoords + 8*i;
+
+                // Texture coordinates, corners order: top-left, bottom-left, bottom-right, top-right
+                float sourceWidth = sprite->source.width;
+                float sourceY = sprite->source.y;
+                if (sprite->source.height < 0) sourceY -= sprite->source.height;
+
+                float left = sprite->source.x*invWidth;
+                float right = (sprite->source.x + fabsf(sourceWidth))*invWidth;
+                float top = sourceY*invHeight;
+                float bottom = (sourceY + sprite->source.height)*invHeight;
+
+                if (sourceWidth < 0) { float temp = left; left = right; right = temp; }
+
+                t[0] = left; t[1] = top;
+                t[2] = left; t[3] = bottom;
+                t[4] = right; t[5] = bottom;
+                t[6] = right; t[7] = top;
+
+                // Quad positions, only calculate rotation if needed
+                float width = sprite->dest.width;
+                float height = sprite->dest.height;
+
+                if (sprite->rotation == 0.0f)
+                {
+                    float x = sprite->dest.x - sprite->origin.x;
+                    float y = sprite->dest.y - sprite->origin.y;
+
+                    v[0] = x; v[1] = y;
+                    v[2] = x; v[3] = y + height;
+                    v[4] = x + width; v[5] = y + height;
+                    v[6] = x + width; v[7] = y;
+                }
+                else
+                {
+                    float sinRotation = sinf(sprite->rotation*DEG2RAD);
+                    float cosRotation = cosf(sprite->rotation*DEG2RAD);
+                    float x = sprite->dest.x;
+                    float y = sprite->dest.y;
+                    float dx = -sprite->origin.x;
+                    float dy = -sprite->origin.y;
+
+                    v[0] = x + dx*cosRotation - dy*sinRotation;
+                    v[1] = y + dx*sinRotation + dy*cosRotation;
+                    v[2] = x + dx*cosRotation - (dy + height)*sinRotation;
+                    v[3] = y + dx*sinRotation + (dy + height)*cosRotation;
+                    v[4] = x + (dx + width)*cosRotation - (dy + height)*sinRotation;
+                    v[5] = y + (dx + width)*sinRotation + (dy + height)*cosRotation;
+                    v[6] = x + (dx + width)*cosRotation - dy*sinRotation;
+                    v[7] = y + (dx + width)*sinRotation + dy*cosRotation;
+                }
+
+                colors[4*i] = sprite->tint.r;
+                colors[4*i + 1] = sprite->tint.g;
+                colors[4*i + 2] = sprite->tint.b;
+                colors[4*i + 3] = sprite->tint.a;
+            }
+
+            rlVertexQuads2D(vertices, texcoords, colors, chunk);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlSetTexture(0);
+    }
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){ color.r, color.g, color.b, (unsigned char)(255.0f*alpha) };
+}
+
+// Get hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+}
+
+// Get color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
+{
+    Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Get a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Get color multiplied with another color
+Color ColorTint(Color color, Color tint)
+{
+    Color result = color;
+
+    float cR = (float)tint.r/255;
+    float cG = (float)tint.g/255;
+    float cB = (float)tint.b/255;
+    float cA = (float)tint.a/255;
+
+    unsigned char r = (unsigned char)(((float)color.r/255*cR)*255.0f);
+    unsigned char g = (unsigned char)(((float)color.g/255*cG)*255.0f);
+    unsigned char b = (unsigned char)(((float)color.b/255*cB)*255.0f);
+    unsigned char a = (unsigned char)(((float)color.a/255*cA)*255.0f);
+
+    result.r = r;
+    result.g = g;
+    result.b = b;
+    result.a = a;
+
+    return result;
+}
+
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+Color ColorBrightness(Color color, float factor)
+{
+    Color result = color;
+
+    if (factor > 1.0f) factor = 1.0f;
+    else if (factor < -1.0f) factor = -1.0f;
+
+    float red = (float)color.r;
+    float green = (float)color.g;
+    float blue = (float)color.b;
+
+    if (factor < 0.0f)
+    {
+        factor = 1.0f + factor;
+        red *= factor;
+        green *= factor;
+        blue *= factor;
+    }
+    else
+    {
+        red = (255 - red)*factor + red;
+        green = (255 - green)*factor + green;
+        blue = (255 - blue)*factor + blue;
+    }
+
+    result.r = (unsigned char)red;
+    result.g = (unsigned char)green;
+    result.b = (unsigned char)blue;
+
+    return result;
+}
+
+// Get color with contrast correction
+// NOTE: Contrast values between -1.0f and 1.0f
+Color ColorContrast(Color color, float contrast)
+{
+    Color result = color;
+
+    if (contrast < -1.0f) contrast = -1.0f;
+    else if (contrast > 1.0f) contrast = 1.0f;
+
+    contrast = (1.0f + contrast);
+    contrast *= contrast;
+
+    float pR = (float)color.r/255.0f;
+    pR -= 0.5f;
+    pR *= contrast;
+    pR += 0.5f;
+    pR *= 255;
+    if (pR < 0) pR = 0;
+    else if (pR > 255) pR = 255;
+
+    float pG = (float)color.g/255.0f;
+    pG -= 0.5f;
+    pG *= contrast;
+    pG += 0.5f;
+    pG *= 255;
+    if (pG < 0) pG = 0;
+    else if (pG > 255) pG = 255;
+
+    float pB = (float)color.b/255.0f;
+    pB -= 0.5f;
+    pB *= contrast;
+    pB += 0.5f;
+    pB *= 255;
+    if (pB < 0) pB = 0;
+    else if (pB > 255) pB = 255;
+
+    result.r = (unsigned char)pR;
+    result.g = (unsigned char)pG;
+    result.b = (unsigned char)pB;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Get src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get a Color struct from hexadecimal value
+Color GetColor(unsigned int hexValue)
+{
+    Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
+    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
+    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
+    color.a = (unsigned char)hexValue & 0xFF;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
+{
+    Color color = { 0 };
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+
+        } break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
+
+        } break;
+        default: break;
+    }
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    dataSize = width*height*bpp/8;  // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks,
+    // if texture is smaller, minimum dataSize is 8 or 16
+    if ((width < 4) && (height < 4))
+    {
+        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
+        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+    }
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Filter mipmap level rows from previous level (2x2 box filter)
+// NOTE: Odd source sizes drop last row/column, 1 pixel source sizes are filtered in one axis,
+// packed 16 bit formats are filtered per texel through GetPixelColor()/SetPixelColor()
+static void ImageMipmapRows(int start, int end, void *userData)
+{
+    const ImageMipmapJob *job = (const ImageMipmapJob *)userData;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, job->format);
+    int srcStride = job->srcWidth*bytesPerPixel;
+    int channels = 0;
+    int alphaChannel = -1;
+
+    switch (job->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; alphaChannel = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; alphaChannel = 3; break;
+        default: break;
+    }
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row0 = job->src + ((job->srcHeight > 1)? 2*y : 0)*srcStride;
+        const unsigned char *row1 = job->src + ((job->srcHeight > 1)? 2*y + 1 : 0)*srcStride;
+        unsigned char *dst = job->dst + y*job->dstWidth*bytesPerPixel;
+        int x = 0;
+
+        if ((job->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && !job->srgb && !job->premultiplied && (job->srcWidth > 1))
+        {
+            // Plain box filter (all channels), rounded as (a + b + c + d + 2)/4
+    #if defined(RTEXTURES_SIMD_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i two = _mm_set1_epi16(2);
+
+            for (; x + 2 <= job->dstWidth; x += 2)
+            {
+                __m128i top = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+                __m128i bottom = _mm_loadu_si128((const __m128i *)(row1 + x*8));
+
+                // Vertical sums for the 4 source texels, 16 bit per channel
+                __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+
+                // Horizontal sums for texel pairs
+                lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+                hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+
+                __m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+                _mm_storel_epi64((__m128i *)(dst + x*4), _mm_packus_epi16(sum, sum));
+            }
+    #elif defined(RTEXTURES_SIMD_NEON)
+            for (; x + 8 <= job->dstWidth; x += 8)
+            {
+                uint8x16x4_t top = vld4q_u8(row0 + x*8);
+                uint8x16x4_t bottom = vld4q_u8(row1 + x*8);
+                uint8x8x4_t result;
+
+                // Texel pairs sums per channel, rounded shift by 2
+                for (int c = 0; c < 4; c++) result.val[c] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(top.val[c]), vpaddlq_u8(bottom.val[c])), 2);
+
+                vst4_u8(dst + x*4, result);
+            }
+    #endif
+            for (; x < job->dstWidth; x++)
+            {
+                for (int c = 0; c < 4; c++) dst[x*4 + c] = (unsigned char)((row0[x*8 + c] + row0[x*8 + 4 + c] + row1[x*8 + c] + row1[x*8 + 4 + c] + 2)/4);
+            }
+
+            continue;
+        }
+
+        for (; x < job->dstWidth; x++)
+        {
+            int x0 = (job->srcWidth > 1)? 2*x : 0;
+            int x1 = (job->srcWidth > 1)? 2*x + 1 : 0;
+            const unsigned char *texels[4] = { row0 + x0*bytesPerPixel, row0 + x1*bytesPerPixel, row1 + x0*bytesPerPixel, row1 + x1*bytesPerPixel };
+
+            if (channels > 0) FilterMipmapTexel(texels, dst + x*bytesPerPixel, channels, alphaChannel, job->srgb, job->premultiplied);
+            else if ((job->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+                     (job->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+                     (job->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+            {
+                // Float formats are linear, alpha weighting only available for R32G32B32A32
+                int count = bytesPerPixel/4;
+                const float *t[4] = { (const float *)texels[0], (const float *)texels[1], (const float *)texels[2], (const float *)texels[3] };
+                float *result = (float *)(dst + x*bytesPerPixel);
+                float weight = 0.0f;
+
+                if (job->premultiplied && (count == 4)) weight = t[0][3] + t[1][3] + t[2][3] + t[3][3];
+
+                for (int c = 0; c < count; c++)
+                {
+                    if ((weight > 0.0f) && (c < 3)) result[c] = (t[0][c]*t[0][3] + t[1][c]*t[1][3] + t[2][c]*t[2][3] + t[3][c]*t[3][3])/weight;
+                    else result[c] = (t[0][c] + t[1][c] + t[2][c] + t[3][c])*0.25f;
+                }
+            }
+            else
+            {
+                unsigned char colors[4][4] = { 0 };
+                const unsigned char *colorTexels[4] = { colors[0], colors[1], colors[2], colors[3] };
+                Color result = { 0 };
+
+                for (int i = 0; i < 4; i++)
+                {
+                    Color color = GetPixelColor((void *)texels[i], job->format);
+                    colors[i][0] = color.r;
+                    colors[i][1] = color.g;
+                    colors[i][2] = color.b;
+                    colors[i][3] = color.a;
+                }
+
+                FilterMipmapTexel(colorTexels, (unsigned char *)&result, 4, 3, job->srgb, job->premultiplied);
+                SetPixelColor(dst + x*bytesPerPixel, result, job->format);
+            }
+        }
+    }
+}
+
+// Reset atlas page free rectangles, shapes white region kept
+static void ResetAtlasPageFreeRects(AtlasPage *page, int width, int height)
+{
+    page->freeCount = 0;
+
+    AddAtlasFreeRect(page, (AtlasRect){ ATLAS_SHAPES_REGION_SIZE, 0, width - ATLAS_SHAPES_REGION_SIZE, ATLAS_SHAPES_REGION_SIZE });
+    AddAtlasFreeRect(page, (AtlasRect){ 0, ATLAS_SHAPES_REGION_SIZE, width, height - ATLAS_SHAPES_REGION_SIZE });
+}
+
+// Add atlas page free rectangle, merged with adjacent free rectangles
+// NOTE: Only rectangles sharing a full edge are merged
+static void AddAtlasFreeRect(AtlasPage *page, AtlasRect rect)
+{
+    if (page->freeCount == page->freeCapacity)
+    {
+        int capacity = (page->freeCapacity > 0)? page->freeCapacity*2 : 16;
+        AtlasRect *rects = (AtlasRect *)RL_REALLOC(page->freeRects, capacity*sizeof(AtlasRect));
+        if (rects == NULL) return;
+
+        page->freeRects = rects;
+        page->freeCapacity = capacity;
+    }
+
+    page->freeRects[page->freeCount++] = rect;
+
+    bool merged = true;
+
+    while (merged)
+    {
+        merged = false;
+
+        for (int i = 0; (i < page->freeCount) && !merged; i++)
+        {
+            for (int j = 0; j < page->freeCount; j++)
+            {
+                AtlasRect *a = &page->freeRects[i];
+                AtlasRect *b = &page->freeRects[j];
+
+                if (i == j) continue;
+
+                if ((a->x == b->x) && (a->width == b->width) && (a->y + a->height == b->y)) a->height += b->height;
+                else if ((a->y == b->y) && (a->height == b->height) && (a->x + a->width == b->x)) a->width += b->width;
+                else continue;
+
+                *b = page->freeRects[page->freeCount - 1];
+                page->freeCount--;
+                merged = true;
+                break;
+            }
+        }
+    }
+}
+
+// Compress image 4x4 blocks rows
+// NOTE: Blocks texels out of level (levels smaller than a block) are clamped to level edges
+static void ImageCompressRows(int start, int end, void *userData)
+{
+    const ImageCompressJob *job = (const ImageCompressJob *)userData;
+
+    int blocksX = (job->width + 3)/4;
+    int blockSize = ((job->format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (job->format == PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                     (job->format == PIXELFORMAT_COMPRESSED_ETC1_RGB) || (job->format == PIXELFORMAT_COMPRESSED_ETC2_RGB))? 8 : 16;
+    Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            for (int y = 0; y < 4; y++)
+            {
+                int py = (by*4 + y < job->height)? by*4 + y : job->height - 1;
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = (bx*4 + x < job->width)? bx*4 + x : job->width - 1;
+                    block[y*4 + x] = job->pixels[py*job->width + px];
+                }
+            }
+
+            unsigned char *dst = job->dst + (by*blocksX + bx)*blockSize;
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockDXT1(block, dst, false, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockDXT1(block, dst, true, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    CompressBlockDXTAlpha(block, dst, false);
+                    CompressBlockDXT1(block, dst + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    CompressBlockDXTAlpha(block, dst, true);
+                    CompressBlockDXT1(block, dst + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: CompressBlockETC1(block, dst, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    CompressBlockEACAlpha(block, dst, job->quality);
+                    CompressBlockETC1(block, dst + 8, job->quality);
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Get 4x4 block texels min/max channels
+static void GetBlockBounds(const Color *block, Color *minColor, Color *maxColor)
+{
+#if defined(RTEXTURES_SIMD_SSE2)
+    __m128i row0 = _mm_loadu_si128((const __m128i *)block);
+    __m128i row1 = _mm_loadu_si128((const __m128i *)(block + 4));
+    __m128i row2 = _mm_loadu_si128((const __m128i *)(block + 8));
+    __m128i row3 = _mm_loadu_si128((const __m128i *)(block + 12));
+
+    __m128i low = _mm_min_epu8(_mm_min_epu8(row0, row1), _mm_min_epu8(row2, row3));
+    __m128i high = _mm_max_epu8(_mm_max_epu8(row0, row1), _mm_max_epu8(row2, row3));
+
+    // Reduce 4 texels to 1
+    low = _mm_min_epu8(low, _mm_srli_si128(low, 8));
+    low = _mm_min_epu8(low, _mm_srli_si128(low, 4));
+    high = _mm_max_epu8(high, _mm_srli_si128(high, 8));
+    high = _mm_max_epu8(high, _mm_srli_si128(high, 4));
+
+    int lowTexel = _mm_cvtsi128_si32(low);
+    int highTexel = _mm_cvtsi128_si32(high);
+    memcpy(minColor, &lowTexel, sizeof(Color));
+    memcpy(maxColor, &highTexel, sizeof(Color));
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint8x16_t row0 = vld1q_u8((const uint8_t *)block);
+    uint8x16_t row1 = vld1q_u8((const uint8_t *)(block + 4));
+    uint8x16_t row2 = vld1q_u8((const uint8_t *)(block + 8));
+    uint8x16_t row3 = vld1q_u8((const uint8_t *)(block + 12));
+
+    uint8x16_t low = vminq_u8(vminq_u8(row0, row1), vminq_u8(row2, row3));
+    uint8x16_t high = vmaxq_u8(vmaxq_u8(row0, row1), vmaxq_u8(row2, row3));
+
+    // Reduce 4 texels to 1
+    uint8x8_t low2 = vmin_u8(vget_low_u8(low), vget_high_u8(low));
+    uint8x8_t high2 = vmax_u8(vget_low_u8(high), vget_high_u8(high));
+    low2 = vmin_u8(low2, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(low2))));
+    high2 = vmax_u8(high2, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(high2))));
+
+    uint32_t lowTexel = vget_lane_u32(vreinterpret_u32_u8(low2), 0);
+    uint32_t highTexel = vget_lane_u32(vreinterpret_u32_u8(high2), 0);
+    memcpy(minColor, &lowTexel, sizeof(Color));
+    memcpy(maxColor, &highTexel, sizeof(Color));
+#else
+    *minColor = block[0];
+    *maxColor = block[0];
+
+    for (int i = 1; i < 16; i++)
+    {
+        if (block[i].r < minColor->r) minColor->r = block[i].r;
+        if (block[i].g < minColor->g) minColor->g = block[i].g;
+        if (block[i].b < minColor->b) minColor->b = block[i].b;
+        if (block[i].a < minColor->a) minColor->a = block[i].a;
+        if (block[i].r > maxColor->r) maxColor->r = block[i].r;
+        if (block[i].g > maxColor->g) maxColor->g = block[i].g;
+        if (block[i].b > maxColor->b) maxColor->b = block[i].b;
+        if (block[i].a > maxColor->a) maxColor->a = block[i].a;
+    }
+#endif
+}
+
+// Get DXT1 block indices for endpoints, returns squared error
+// NOTE: Endpoints order defines block mode: c0 > c1 (4 colors), c0 <= c1 (3 colors + transparent)
+static int MatchBlockDXT1(const Color *block, unsigned short c0, unsigned short c1, bool alpha, unsigned int *indices)
+{
+    int palette[4][3] = { 0 };
+
+    palette[0][0] = ((c0 >> 11) << 3) | (c0 >> 13);
+    palette[0][1] = (((c0 >> 5) & 0x3f) << 2) | (((c0 >> 5) & 0x3f) >> 4);
+    palette[0][2] = ((c0 & 0x1f) << 3) | ((c0 & 0x1f) >> 2);
+    palette[1][0] = ((c1 >> 11) << 3) | (c1 >> 13);
+    palette[1][1] = (((c1 >> 5) & 0x3f) << 2) | (((c1 >> 5) & 0x3f) >> 4);
+    palette[1][2] = ((c1 & 0x1f) << 3) | ((c1 & 0x1f) >> 2);
+
+    int colors = (c0 > c1)? 4 : 3;
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (colors == 4)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+        else palette[2][c] = (palette[0][c] + palette[1][c])/2;
+    }
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (alpha && (block[i].a < 128))
+        {
+            *indices |= 3u << (2*i);
+            continue;
+        }
+
+        int bestIndex = 0;
+        int bestError = INT_MAX;
+
+        for (int k = 0; k < ((colors == 4)? 4 : 3); k++)
+        {
+            int dr = block[i].r - palette[k][0];
+            int dg = block[i].g - palette[k][1];
+            int db = block[i].b - palette[k][2];
+            int e = dr*dr + dg*dg + db*db;
+
+            if (e < bestError) { bestError = e; bestIndex = k; }
+        }
+
+        *indices |= (unsigned int)bestIndex << (2*i);
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress 4x4 block color (DXT1, 1 bit alpha optional)
+// NOTE: Alpha blocks with transparent texels use 3 colors mode, endpoints from opaque texels only
+static void CompressBlockDXT1(const Color *block, unsigned char *dst, bool alpha, int quality)
+{
+    Color texels[16] = { 0 };
+    int count = 0;
+
+    for (int i = 0; i < 16; i++) if (!alpha || (block[i].a >= 128)) texels[count++] = block[i];
+
+    bool transparent = (count < 16);
+    unsigned short c0 = 0;
+    unsigned short c1 = 0;
+    unsigned int indices = 0xffffffff;
+
+    if (count > 0)
+    {
+        // Unused texels repeat first opaque texel, required by bounds
+        for (int i = count; i < 16; i++) texels[i] = texels[0];
+
+        Color minColor = { 0 };
+        Color maxColor = { 0 };
+        GetBlockBounds(texels, &minColor, &maxColor);
+
+        float endpoints[2][3] = { { maxColor.r, maxColor.g, maxColor.b }, { minColor.r, minColor.g, minColor.b } };
+
+        if (quality < 50)
+        {
+            // Bounds inset by 1/16 of range, reduces error caused by endpoints outliers
+            for (int c = 0; c < 3; c++)
+            {
+                float inset = (endpoints[0][c] - endpoints[1][c])/16.0f;
+                endpoints[0][c] -= inset;
+                endpoints[1][c] += inset;
+            }
+        }
+        else
+        {
+            // Endpoints from texels extremes along principal axis
+            float mean[3] = { 0 };
+            float cov[6] = { 0 };
+
+            for (int i = 0; i < count; i++)
+            {
+                mean[0] += texels[i].r;
+                mean[1] += texels[i].g;
+                mean[2] += texels[i].b;
+            }
+
+            for (int c = 0; c < 3; c++) mean[c] /= (float)count;
+
+            for (int i = 0; i < count; i++)
+            {
+                float r = texels[i].r - mean[0];
+                float g = texels[i].g - mean[1];
+                float b = texels[i].b - mean[2];
+
+                cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+                cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+            }
+
+            float axis[3] = { endpoints[0][0] - endpoints[1][0], endpoints[0][1] - endpoints[1][1], endpoints[0][2] - endpoints[1][2] };
+
+            for (int k = 0; k < 4; k++)
+            {
+                float r = axis[0]*cov[0] + axis[1]*cov[1] + axis[2]*cov[2];
+                float g = axis[0]*cov[1] + axis[1]*cov[3] + axis[2]*cov[4];
+                float b = axis[0]*cov[2] + axis[1]*cov[4] + axis[2]*cov[5];
+                float length = fmaxf(fabsf(r), fmaxf(fabsf(g), fabsf(b)));
+
+                if (length < 1e-6f) break;
+
+                axis[0] = r/length;
+                axis[1] = g/length;
+                axis[2] = b/length;
+            }
+
+            float minDot = FLT_MAX;
+            float maxDot = -FLT_MAX;
+
+            for (int i = 0; i < count; i++)
+            {
+                float dot = texels[i].r*axis[0] + texels[i].g*axis[1] + texels[i].b*axis[2];
+
+                if (dot < minDot) { minDot = dot; endpoints[1][0] = texels[i].r; endpoints[1][1] = texels[i].g; endpoints[1][2] = texels[i].b; }
+                if (dot > maxDot) { maxDot = dot; endpoints[0][0] = texels[i].r; endpoints[0][1] = texels[i].g; endpoints[0][2] = texels[i].b; }
+            }
+        }
+
+        c0 = (unsigned short)((((int)(endpoints[0][0] + 0.5f)*31 + 127)/255 << 11) | (((int)(endpoints[0][1] + 0.5f)*63 + 127)/255 << 5) | (((int)(endpoints[0][2] + 0.5f)*31 + 127)/255));
+        c1 = (unsigned short)((((int)(endpoints[1][0] + 0.5f)*31 + 127)/255 << 11) | (((int)(endpoints[1][1] + 0.5f)*63 + 127)/255 << 5) | (((int)(endpoints[1][2] + 0.5f)*31 + 127)/255));
+
+        // Endpoints order selects block mode
+        if ((transparent && (c0 > c1)) || (!transparent && (c0 < c1)))
+        {
+            unsigned short temp = c0;
+            c0 = c1;
+            c1 = temp;
+        }
+
+        int error = MatchBlockDXT1(block, c0, c1, alpha, &indices);
+
+        // Least squares endpoints refinement from current indices (4 colors mode)
+        for (int k = 0; (k < 2) && (quality >= 50) && !transparent && (c0 != c1) && (error > 0); k++)
+        {
+            static const float weights[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ax[3] = { 0 };
+            float bx[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                float w = weights[(indices >> (2*i)) & 3];
+                float texel[3] = { block[i].r, block[i].g, block[i].b };
+
+                aa += w*w;
+                ab += w*(1.0f - w);
+                bb += (1.0f - w)*(1.0f - w);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    ax[c] += w*texel[c];
+                    bx[c] += (1.0f - w)*texel[c];
+                }
+            }
+
+            float det = aa*bb - ab*ab;
+            if (fabsf(det) < 1e-6f) break;
+
+            int a[3] = { 0 };
+            int b[3] = { 0 };
+
+            for (int c = 0; c < 3; c++)
+            {
+                float va = (bb*ax[c] - ab*bx[c])/det;
+                float vb = (aa*bx[c] - ab*ax[c])/det;
+
+                a[c] = (va < 0.0f)? 0 : (va > 255.0f)? 255 : (int)(va + 0.5f);
+                b[c] = (vb < 0.0f)? 0 : (vb > 255.0f)? 255 : (int)(vb + 0.5f);
+            }
+
+            unsigned short r0 = (unsigned short)(((a[0]*31 + 127)/255 << 11) | ((a[1]*63 + 127)/255 << 5) | ((a[2]*31 + 127)/255));
+            unsigned short r1 = (unsigned short)(((b[0]*31 + 127)/255 << 11) | ((b[1]*63 + 127)/255 << 5) | ((b[2]*31 + 127)/255));
+
+            if (r0 < r1)
+            {
+                unsigned short temp = r0;
+                r0 = r1;
+                r1 = temp;
+            }
+
+            unsigned int refined = 0;
+            int refinedError = MatchBlockDXT1(block, r0, r1, alpha, &refined);
+
+            if (refinedError >= error) break;
+
+            c0 = r0;
+            c1 = r1;
+            indices = refined;
+            error = refinedError;
+        }
+    }
+
+    dst[0] = (unsigned char)(c0 & 0xff);
+    dst[1] = (unsigned char)(c0 >> 8);
+    dst[2] = (unsigned char)(c1 & 0xff);
+    dst[3] = (unsigned char)(c1 >> 8);
+    for (int i = 0; i < 4; i++) dst[4 + i] = (unsigned char)((indices >> (8*i)) & 0xff);
+}
+
+// Compress 4x4 block alpha (DXT3 explicit, DXT5 interpolated)
+static void CompressBlockDXTAlpha(const Color *block, unsigned char *dst, bool interpolated)
+{
+    if (!interpolated)
+    {
+        // DXT3: 4 bit explicit alpha per texel
+        for (int i = 0; i < 8; i++) dst[i] = (unsigned char)(((block[2*i].a*15 + 127)/255) | (((block[2*i + 1].a*15 + 127)/255) << 4));
+
+        return;
+    }
+
+    // DXT5: alpha endpoints from block bounds, 8 alpha values mode
+    Color minColor = { 0 };
+    Color maxColor = { 0 };
+    GetBlockBounds(block, &minColor, &maxColor);
+
+    int palette[8] = { maxColor.a, minColor.a };
+    for (int i = 2; i < 8; i++) palette[i] = ((8 - i)*maxColor.a + (i - 1)*minColor.a)/7;
+
+    unsigned long long bits = 0;
+
+    if (maxColor.a > minColor.a)
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            int bestIndex = 0;
+            int bestError = INT_MAX;
+
+            for (int k = 0; k < 8; k++)
+            {
+                int e = abs(block[i].a - palette[k]);
+                if (e < bestError) { bestError = e; bestIndex = k; }
+            }
+
+            bits |= (unsigned long long)bestIndex << (3*i);
+        }
+    }
+
+    dst[0] = maxColor.a;
+    dst[1] = minColor.a;
+    for (int i = 0; i < 6; i++) dst[2 + i] = (unsigned char)((bits >> (8*i)) & 0xff);
+}
+
+// Fit ETC1 subblock texels to base color, returns squared error
+// NOTE: Modifier table and texels selectors (msb << 1 | lsb) are returned
+static int FitSubblockETC1(const Color *block, const int *texels, const int *base, int *table, int *selectors)
+{
+    static const int modifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    int bestError = INT_MAX;
+
+    for (int t = 0; t < 8; t++)
+    {
+        int error = 0;
+        int current[8] = { 0 };
+
+        for (int i = 0; (i < 8) && (error < bestError); i++)
+        {
+            const Color *texel = &block[texels[i]];
+            int texelError = INT_MAX;
+
+            for (int s = 0; s < 4; s++)
+            {
+                int modifier = (s & 2)? -modifiers[t][s & 1] : modifiers[t][s & 1];
+                int r = base[0] + modifier;
+                int g = base[1] + modifier;
+                int b = base[2] + modifier;
+
+                r = (r < 0)? 0 : (r > 255)? 255 : r;
+                g = (g < 0)? 0 : (g > 255)? 255 : g;
+                b = (b < 0)? 0 : (b > 255)? 255 : b;
+
+                int e = (r - texel->r)*(r - texel->r) + (g - texel->g)*(g - texel->g) + (b - texel->b)*(b - texel->b);
+                if (e < texelError) { texelError = e; current[i] = s; }
+            }
+
+            error += texelError;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            for (int i = 0; i < 8; i++) selectors[i] = current[i];
+        }
+    }
+
+    return bestError;
+}
+
+// Compress 4x4 block color (ETC1, valid ETC2 RGB)
+// NOTE: Both subblocks orientations are evaluated, differential mode (5 bit base colors) is used when deltas fit,
+// high quality also evaluates individual mode (4 bit base colors) and base colors luminance offsets
+static void CompressBlockETC1(const Color *block, unsigned char *dst, int quality)
+{
+    unsigned long long bestBlock = 0;
+    int bestError = INT_MAX;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        int texels[2][8] = { 0 };
+        float average[2][3] = { 0 };
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                // Subblocks are 2x4 (flip = 0) or 4x2 (flip = 1)
+                int x = (flip == 0)? 2*s + i/4 : i%4;
+                int y = (flip == 0)? i%4 : 2*s + i/4;
+
+                texels[s][i] = y*4 + x;
+                average[s][0] += block[y*4 + x].r/8.0f;
+                average[s][1] += block[y*4 + x].g/8.0f;
+                average[s][2] += block[y*4 + x].b/8.0f;
+            }
+        }
+
+        for (int differential = 1; differential >= 0; differential--)
+        {
+            int bits = differential? 5 : 4;
+            int levels = (1 << bits) - 1;
+            int quantized[2][3] = { 0 };
+            bool valid = true;
+
+            for (int s = 0; s < 2; s++)
+            {
+                for (int c = 0; c < 3; c++) quantized[s][c] = (int)(average[s][c]*levels/255.0f + 0.5f);
+            }
+
+            if (differential)
+            {
+                for (int c = 0; c < 3; c++) if (((quantized[1][c] - quantized[0][c]) < -4) || ((quantized[1][c] - quantized[0][c]) > 3)) valid = false;
+
+                if (!valid) continue;
+            }
+            else if ((quality < 50) && (bestError < INT_MAX)) continue;
+
+            // Subblocks fit, luminance offsets moved along base colors (high quality)
+            int error = 0;
+            int tables[2] = { 0 };
+            int selectors[2][8] = { 0 };
+            int chosen[2][3] = { 0 };
+
+            for (int s = 0; s < 2; s++)
+            {
+                int subError = INT_MAX;
+
+                for (int offset = ((quality >= 50)? -1 : 0); offset <= ((quality >= 50)? 1 : 0); offset++)
+                {
+                    int candidate[3] = { 0 };
+                    int base[3] = { 0 };
+                    bool inRange = true;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        candidate[c] = quantized[s][c] + offset;
+                        if ((candidate[c] < 0) || (candidate[c] > levels)) inRange = false;
+
+                        // Differential mode deltas must fit [-4..3] from first subblock chosen base color
+                        if (differential && (s == 1) && (((candidate[c] - chosen[0][c]) < -4) || ((candidate[c] - chosen[0][c]) > 3))) inRange = false;
+
+                        base[c] = differential? ((candidate[c] << 3) | (candidate[c] >> 2)) : (candidate[c]*17);
+                    }
+
+                    if (!inRange) continue;
+
+                    int table = 0;
+                    int current[8] = { 0 };
+                    int e = FitSubblockETC1(block, texels[s], base, &table, current);
+
+                    if (e < subError)
+                    {
+                        subError = e;
+                        tables[s] = table;
+                        for (int i = 0; i < 8; i++) selectors[s][i] = current[i];
+                        for (int c = 0; c < 3; c++) chosen[s][c] = candidate[c];
+                    }
+                }
+
+                if (subError == INT_MAX) { error = INT_MAX; break; }
+                error += subError;
+            }
+
+            if (error >= bestError) continue;
+
+            unsigned long long word = 0;
+
+            if (differential)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    word |= (unsigned long long)chosen[0][c] << (59 - 8*c);
+                    word |= (unsigned long long)((chosen[1][c] - chosen[0][c]) & 7) << (56 - 8*c);
+                }
+
+                word |= 1ull << 33;
+            }
+            else
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    word |= (unsigned long long)chosen[0][c] << (60 - 8*c);
+                    word |= (unsigned long long)chosen[1][c] << (56 - 8*c);
+                }
+            }
+
+            word |= (unsigned long long)tables[0] << 37;
+            word |= (unsigned long long)tables[1] << 34;
+            word |= (unsigned long long)flip << 32;
+
+            // Selectors bits are stored by columns: texel (x, y) uses bit x*4 + y
+            for (int s = 0; s < 2; s++)
+            {
+                for (int i = 0; i < 8; i++)
+                {
+                    int bit = (texels[s][i]%4)*4 + texels[s][i]/4;
+
+                    word |= (unsigned long long)(selectors[s][i] >> 1) << (16 + bit);
+                    word |= (unsigned long long)(selectors[s][i] & 1) << bit;
+                }
+            }
+
+            bestError = error;
+            bestBlock = word;
+        }
+    }
+
+    for (int i = 0; i < 8; i++) dst[i] = (unsigned char)((bestBlock >> (56 - 8*i)) & 0xff);
+}
+
+// Compress 4x4 block alpha (ETC2 EAC)
+// NOTE: Base and multiplier are fitted to block alpha range per modifier table, high quality also evaluates near multipliers
+static void CompressBlockEACAlpha(const Color *block, unsigned char *dst, int quality)
+{
+    static const int modifiers[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    Color minColor = { 0 };
+    Color maxColor = { 0 };
+    GetBlockBounds(block, &minColor, &maxColor);
+
+    // Solid alpha: table 13 includes 0 modifier
+    int bestBase = minColor.a;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    int bestSelectors[16] = { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+    int bestError = (maxColor.a == minColor.a)? 0 : INT_MAX;
+
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        int range = modifiers[t][7] - modifiers[t][3];
+        int multiplier = (int)((float)(maxColor.a - minColor.a)/range + 0.5f);
+
+        for (int m = multiplier - ((quality >= 50)? 1 : 0); m <= multiplier + ((quality >= 50)? 1 : 0); m++)
+        {
+            if ((m < 1) || (m > 15)) continue;
+
+            int base = (int)((maxColor.a + minColor.a)/2.0f - m*(modifiers[t][7] + modifiers[t][3])/2.0f + 0.5f);
+            base = (base < 0)? 0 : (base > 255)? 255 : base;
+
+            int values[8] = { 0 };
+            for (int k = 0; k < 8; k++)
+            {
+                values[k] = base + modifiers[t][k]*m;
+                values[k] = (values[k] < 0)? 0 : (values[k] > 255)? 255 : values[k];
+            }
+
+            int error = 0;
+            int selectors[16] = { 0 };
+
+            for (int i = 0; (i < 16) && (error < bestError); i++)
+            {
+                int texelError = INT_MAX;
+
+                for (int k = 0; k < 8; k++)
+                {
+                    int e = (block[i].a - values[k])*(block[i].a - values[k]);
+                    if (e < texelError) { texelError = e; selectors[i] = k; }
+                }
+
+                error += texelError;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                bestBase = base;
+                bestMultiplier = m;
+                bestTable = t;
+                for (int i = 0; i < 16; i++) bestSelectors[i] = selectors[i];
+            }
+        }
+    }
+
+    unsigned long long word = ((unsigned long long)bestBase << 56) | ((unsigned long long)bestMultiplier << 52) | ((unsigned long long)bestTable << 48);
+
+    // Selectors are stored by columns: texel (x, y) uses bits 45 - 3*(x*4 + y)
+    for (int i = 0; i < 16; i++) word |= (unsigned long long)bestSelectors[i] << (45 - 3*((i%4)*4 + i/4));
+
+    for (int i = 0; i < 8; i++) dst[i] = (unsigned char)((word >> (56 - 8*i)) & 0xff);
+}
+
+// Filter 4 texels (8 bit per channel), gamma-correct and alpha weighted options
+static void FilterMipmapTexel(const unsigned char *texels[4], unsigned char *dst, int channels, int alphaChannel, bool srgb, bool premultiplied)
+{
+    float weights[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float weight = 4.0f;
+    bool weighted = false;
+
+    if (premultiplied && (alphaChannel >= 0))
+    {
+        float alpha = (float)(texels[0][alphaChannel] + texels[1][alphaChannel] + texels[2][alphaChannel] + texels[3][alphaChannel]);
+
+        // Fully transparent texels keep plain average
+        if (alpha > 0.0f)
+        {
+            for (int i = 0; i < 4; i++) weights[i] = (float)texels[i][alphaChannel];
+            weight = alpha;
+            weighted = true;
+        }
+    }
+
+    for (int c = 0; c < channels; c++)
+    {
+        if (c == alphaChannel) dst[c] = (unsigned char)((texels[0][c] + texels[1][c] + texels[2][c] + texels[3][c] + 2)/4);
+        else if (srgb)
+        {
+            float value = 0.0f;
+            for (int i = 0; i < 4; i++) value += srgbToLinear[texels[i][c]]*weights[i];
+
+            dst[c] = linearToSrgb[(int)(value/weight*4095.0f + 0.5f)];
+        }
+        else if (weighted)
+        {
+            float value = 0.0f;
+            for (int i = 0; i < 4; i++) value += (float)texels[i][c]*weights[i];
+
+            dst[c] = (unsigned char)(value/weight + 0.5f);
+        }
+        else dst[c] = (unsigned char)((texels[0][c] + texels[1][c] + texels[2][c] + texels[3][c] + 2)/4);
+    }
+}
+
+// Resize image output rows slices
+// NOTE: Every slice maps its output rows to the full resize transform, slices results match a full image resize
+static void ImageResizeSlices(int start, int end, void *userData)
+{
+    const ImageResizeJob *job = (const ImageResizeJob *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        int firstRow = (int)((long long)job->outputHeight*i/job->sliceCount);
+        int lastRow = (int)((long long)job->outputHeight*(i + 1)/job->sliceCount);
+
+        stbir_resize_subpixel(job->input, job->inputWidth, job->inputHeight, job->inputStride,
+            (unsigned char *)job->output + firstRow*job->outputStride, job->outputWidth, lastRow - firstRow, job->outputStride,
+            job->type, job->channels, job->alphaChannel, 0, STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP, STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT,
+            job->colorspace, (job->buffers != NULL)? &job->buffers[i] : NULL,
+            (float)job->outputWidth/(float)job->inputWidth, (float)job->outputHeight/(float)job->inputHeight, 0.0f, (float)firstRow);
+    }
+}
+
+// Load image resize scratch buffer, buffer grows if required
+// NOTE: Buffer size is stored in a header before scratch memory (keeping 16 bytes alignment)
+static void *LoadImageResizeScratch(void **buffer, size_t size)
+{
+    if ((*buffer == NULL) || (*(size_t *)*buffer < size))
+    {
+        RL_FREE(*buffer);
+        *buffer = RL_MALLOC(size + 16);
+        if (*buffer == NULL) return NULL;
+
+        *(size_t *)*buffer = size;
+    }
+
+    return (unsigned char *)*buffer + 16;
+}
+
+// Fill image rectangle repeating its first pixel (rectangle inside image)
+// NOTE: First row is filled doubling the copied pixels, the following rows copy the first row,
+// rows are copied in parallel by jobs system for big rectangles
+static void ImageFillRec(Image *dst, int x, int y, int width, int height)
+{
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    unsigned char *row = (unsigned char *)dst->data + (y*dst->width + x)*bytesPerPixel;
+
+    FillPixels(row, row, bytesPerPixel, width);
+
+    ImageFillJob job = { row, dst->width*bytesPerPixel, width*bytesPerPixel };
+
+    if ((width*height) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(height, ImageFillRows, &job);
+    else ImageFillRows(0, height, &job);
+}
+
+// Fill image rows copying first row
+static void ImageFillRows(int start, int end, void *userData)
+{
+    const ImageFillJob *job = (const ImageFillJob *)userData;
+
+    for (int y = (start > 0)? start : 1; y < end; y++) memcpy(job->data + y*job->stride, job->data, job->rowSize);
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate image rectangle rows with generator callback
+static Image GenImageRec(Rectangle rec, ImageGenJob *job, void (*generate)(int start, int end, void *userData))
+{
+    Image image = { 0 };
+
+    int width = (int)rec.width;
+    int height = (int)rec.height;
+    if ((width <= 0) || (height <= 0)) return image;
+
+    job->pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    job->x = (int)rec.x;
+    job->y = (int)rec.y;
+    job->width = width;
+
+    if ((width*height) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(height, generate, job);
+    else generate(0, height, job);
+
+    image.data = job->pixels;
+    image.width = width;
+    image.height = height;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.mipmaps = 1;
+
+    return image;
+}
+
+// Generate radial gradient rows
+static void GenImageRadialRows(int start, int end, void *userData)
+{
+    const ImageGenJob *job = (const ImageGenJob *)userData;
+
+    float radius = (job->imageWidth < job->imageHeight)? (float)job->imageWidth/2.0f : (float)job->imageHeight/2.0f;
+    float centerX = (float)job->imageWidth/2.0f;
+    float centerY = (float)job->imageHeight/2.0f;
+    float density = job->params[0];
+    Color inner = job->colors[0];
+    Color outer = job->colors[1];
+
+    for (int y = start; y < end; y++)
+    {
+        Color *row = job->pixels + (size_t)y*job->width;
+        float dy = (float)(job->y + y) - centerY;
+        int x = 0;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        __m128 dy2 = _mm_set1_ps(dy*dy);
+        __m128 offset = _mm_set1_ps(radius*density);
+        __m128 range = _mm_set1_ps(radius*(1.0f - density));
+        __m128 innerColor = _mm_setr_ps(inner.r, inner.g, inner.b, inner.a);
+        __m128 outerColor = _mm_setr_ps(outer.r, outer.g, outer.b, outer.a);
+
+        for (; (x + 4) <= job->width; x += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_setr_ps((float)(job->x + x), (float)(job->x + x + 1), (float)(job->x + x + 2), (float)(job->x + x + 3)), _mm_set1_ps(centerX));
+            __m128 factor = _mm_div_ps(_mm_sub_ps(_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), dy2)), offset), range);
+            factor = _mm_min_ps(_mm_max_ps(factor, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+            // Colors interpolated for every pixel factor (broadcast)
+            float factors[4];
+            _mm_storeu_ps(factors, factor);
+
+            __m128i colors[4];
+            for (int k = 0; k < 4; k++)
+            {
+                __m128 f = _mm_set1_ps(factors[k]);
+                colors[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(outerColor, f), _mm_mul_ps(innerColor, _mm_sub_ps(_mm_set1_ps(1.0f), f))));
+            }
+
+            __m128i packed = _mm_packus_epi16(_mm_packs_epi32(colors[0], colors[1]), _mm_packs_epi32(colors[2], colors[3]));
+            _mm_storeu_si128((__m128i *)(row + x), packed);
+        }
+    #endif
+        for (; x < job->width; x++)
+        {
+            float dist = sqrtf(((float)(job->x + x) - centerX)*((float)(job->x + x) - centerX) + dy*dy);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (factor < 0.0f)? 0.0f : ((factor > 1.0f)? 1.0f : factor);    // dist can be bigger than radius, so we have to check
+
+            row[x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            row[x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            row[x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            row[x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate perlin noise rows
+// NOTE: Same result as stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) per pixel, evaluated by rows:
+// z is an integer on every octave (z interpolation weight is 0), only the 4 corners of z0 plane contribute,
+// row y is constant and corners gradients only change when pixels cross a lattice cell
+static void GenImagePerlinRows(int start, int end, void *userData)
+{
+    // Gradients basis (x, y) for stb_perlin gradients indices, z component is not required
+    static const float gradients[12][2] = {
+        { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 0 }, { -1, 0 },
+        { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 0, 1 }, { 0, -1 }
+    };
+
+    const ImageGenJob *job = (const ImageGenJob *)userData;
+
+    float *noise = (float *)RL_MALLOC(job->width*2*sizeof(float));
+    float *nx = noise + job->width;
+
+    for (int x = 0; x < job->width; x++) nx[x] = (float)(job->x + x + (int)job->params[0])*job->params[2]/(float)job->imageWidth;
+
+    for (int y = start; y < end; y++)
+    {
+        Color *row = job->pixels + (size_t)y*job->width;
+        float ny = (float)(job->y + y + (int)job->params[1])*job->params[2]/(float)job->imageHeight;
+
+        for (int x = 0; x < job->width; x++) noise[x] = 0.0f;
+
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+
+        // Typical values to start playing with:
+        //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+        //   gain       =  0.5   -- relative weighting applied to each successive octave
+        //   octaves    =  6     -- number of "octaves" of noise3() to sum
+        for (int octave = 0; octave < 6; octave++)
+        {
+            float fy = ny*frequency;
+            int py = (int)fy;
+            if (fy < py) py--;
+            fy -= py;
+
+            float v = (((fy*6 - 15)*fy + 10)*fy*fy*fy);
+            int y0 = py & 255;
+            int y1 = (py + 1) & 255;
+            int z0 = (int)frequency & 255;
+
+            int cellX = 0;
+            float g[4][2] = { 0 };     // Cell corners gradients: (x0, y0), (x0, y1), (x1, y0), (x1, y1)
+            bool cellReady = false;
+
+            for (int x = 0; x < job->width; )
+            {
+                float fx = nx[x]*frequency;
+                int px = (int)fx;
+                if (fx < px) px--;
+
+                if (!cellReady || (px != cellX))
+                {
+                    int r0 = stb__perlin_randtab[(px & 255) + octave];
+                    int r1 = stb__perlin_randtab[((px + 1) & 255) + octave];
+                    const int corners[4] = { r0 + y0, r0 + y1, r1 + y0, r1 + y1 };
+
+                    for (int k = 0; k < 4; k++)
+                    {
+                        const float *gradient = gradients[stb__perlin_randtab_grad_idx[stb__perlin_randtab[corners[k]] + z0]];
+                        g[k][0] = gradient[0];
+                        g[k][1] = gradient[1];
+                    }
+
+                    cellX = px;
+                    cellReady = true;
+                }
+
+            #if defined(RTEXTURES_SIMD_SSE2)
+                // Four pixels at once if they are in the same lattice cell
+                if ((x + 4) <= job->width)
+                {
+                    __m128 fx4 = _mm_mul_ps(_mm_loadu_ps(nx + x), _mm_set1_ps(frequency));
+                    __m128 px4 = _mm_set1_ps((float)px);
+                    __m128 next = _mm_set1_ps((float)(px + 1));
+
+                    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(fx4, px4), _mm_cmpge_ps(fx4, next))) == 0)
+                    {
+                        __m128 one = _mm_set1_ps(1.0f);
+                        __m128 x0 = _mm_sub_ps(fx4, px4);
+                        __m128 x1 = _mm_sub_ps(x0, one);
+                        __m128 ys0 = _mm_set1_ps(fy);
+                        __m128 ys1 = _mm_set1_ps(fy - 1);
+
+                        __m128 u = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(x0, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), x0), _mm_set1_ps(10.0f));
+                        u = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(u, x0), x0), x0);
+
+                        __m128 n00 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(g[0][0]), x0), _mm_mul_ps(_mm_set1_ps(g[0][1]), ys0));
+                        __m128 n01 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(g[1][0]), x0), _mm_mul_ps(_mm_set1_ps(g[1][1]), ys1));
+                        __m128 n10 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(g[2][0]), x1), _mm_mul_ps(_mm_set1_ps(g[2][1]), ys0));
+                        __m128 n11 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(g[3][0]), x1), _mm_mul_ps(_mm_set1_ps(g[3][1]), ys1));
+
+                        __m128 vs = _mm_set1_ps(v);
+                        __m128 n0 = _mm_add_ps(n00, _mm_mul_ps(_mm_sub_ps(n01, n00), vs));
+                        __m128 n1 = _mm_add_ps(n10, _mm_mul_ps(_mm_sub_ps(n11, n10), vs));
+                        __m128 n = _mm_add_ps(n0, _mm_mul_ps(_mm_sub_ps(n1, n0), u));
+
+                        _mm_storeu_ps(noise + x, _mm_add_ps(_mm_loadu_ps(noise + x), _mm_mul_ps(n, _mm_set1_ps(amplitude))));
+                        x += 4;
+                        continue;
+                    }
+                }
+            #endif
+                fx -= px;
+
+                float u = (((fx*6 - 15)*fx + 10)*fx*fx*fx);
+                float n00 = g[0][0]*fx + g[0][1]*fy;
+                float n01 = g[1][0]*fx + g[1][1]*(fy - 1);
+                float n10 = g[2][0]*(fx - 1) + g[2][1]*fy;
+                float n11 = g[3][0]*(fx - 1) + g[3][1]*(fy - 1);
+
+                float n0 = n00 + (n01 - n00)*v;
+                float n1 = n10 + (n11 - n10)*v;
+
+                noise[x] += (n0 + (n1 - n0)*u)*amplitude;
+                x++;
+            }
+
+            frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
+
+        for (int x = 0; x < job->width; x++)
+        {
+            // NOTE: We need to translate the data from [-1..1] to [0..1]
+            float p = (noise[x] + 1.0f)/2.0f;
+
+            unsigned char intensity = (unsigned char)(int)(p*255.0f);
+            row[x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+
+    RL_FREE(noise);
+}
+
+// Generate cellular pattern rows
+// NOTE: For every tile in row, the 3x3 neighbor tiles seeds are gathered once and compared with squared distances
+static void GenImageCellularRows(int start, int end, void *userData)
+{
+    const ImageGenJob *job = (const ImageGenJob *)userData;
+    int tileSize = job->tileSize;
+
+    for (int y = start; y < end; y++)
+    {
+        Color *row = job->pixels + (size_t)y*job->width;
+        int py = job->y + y;
+        int tileY = (py >= 0)? py/tileSize : -((-py - 1)/tileSize) - 1;
+
+        for (int x = 0; x < job->width; )
+        {
+            int px = job->x + x;
+            int tileX = (px >= 0)? px/tileSize : -((-px - 1)/tileSize) - 1;
+            int tileEnd = (tileX + 1)*tileSize - job->x;        // First pixel of next tile (rectangle coordinates)
+            if (tileEnd > job->width) tileEnd = job->width;
+
+            // Neighbor tiles seeds
+            int seedsX[9] = { 0 };
+            int seedsY[9] = { 0 };
+            int count = 0;
+
+            for (int i = -1; i < 2; i++)
+            {
+                for (int j = -1; j < 2; j++)
+                {
+                    if (job->seeds != NULL)
+                    {
+                        if ((tileX + i < 0) || (tileX + i >= job->seedsPerRow) || (tileY + j < 0) || (tileY + j >= job->seedsPerCol)) continue;
+
+                        seedsX[count] = job->seeds[((tileY + j)*job->seedsPerRow + tileX + i)*2];
+                        seedsY[count] = job->seeds[((tileY + j)*job->seedsPerRow + tileX + i)*2 + 1];
+                    }
+                    else
+                    {
+                        unsigned int hash = HashImageGen(tileX + i, tileY + j, job->seed);
+
+                        seedsX[count] = (tileX + i)*tileSize + (int)((hash & 0xffff)%tileSize);
+                        seedsY[count] = (tileY + j)*tileSize + (int)((hash >> 16)%tileSize);
+                    }
+
+                    count++;
+                }
+            }
+
+            for (; x < tileEnd; x++)
+            {
+                px = job->x + x;
+                long long minDistance = 65536LL*65536LL;
+
+                for (int k = 0; k < count; k++)
+                {
+                    long long dx = px - seedsX[k];
+                    long long dy = py - seedsY[k];
+                    long long dist = dx*dx + dy*dy;
+
+                    if (dist < minDistance) minDistance = dist;
+                }
+
+                // I made this up, but it seems to give good results at all tile sizes
+                int intensity = (int)((float)sqrt((double)minDistance)*256.0f/tileSize);
+                if (intensity > 255) intensity = 255;
+
+                row[x] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+
+// Generate hashed white noise rows
+static void GenImageWhiteNoiseRows(int start, int end, void *userData)
+{
+    const ImageGenJob *job = (const ImageGenJob *)userData;
+    unsigned int threshold = (unsigned int)(job->params[0]*100.0f);
+
+    for (int y = start; y < end; y++)
+    {
+        Color *row = job->pixels + (size_t)y*job->width;
+
+        for (int x = 0; x < job->width; x++) row[x] = ((HashImageGen(job->x + x, job->y + y, job->seed)%100) < threshold)? WHITE : BLACK;
+    }
+}
+
+// Hash generated image position with seed
+// NOTE: Integer hash mixing (xorshift-multiply), well distributed on all bits
+static unsigned int HashImageGen(int x, int y, unsigned int seed)
+{
+    unsigned int hash = (unsigned int)x*0x8da6b343u ^ (unsigned int)y*0xd8163841u ^ seed*0xcb1ab31fu;
+
+    hash ^= hash >> 16;
+    hash *= 0x7feb352du;
+    hash ^= hash >> 15;
+    hash *= 0x846ca68bu;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+#endif
+
+// Load image colors histogram (parallel for big images)
+// NOTE: Pixels are split in slices counted in parallel, slices histograms are merged into the first one
+static ImageColorTable LoadImageHistogram(const Color *pixels, int pixelCount)
+{
+    ImageHistogramJob job = { pixels, pixelCount, 1, NULL };
+
+    if (pixelCount >= IMAGE_DRAW_PARALLEL_PIXELS) job.sliceCount = GetJobThreadCount();
+
+    job.tables = (ImageColorTable *)RL_CALLOC(job.sliceCount, sizeof(ImageColorTable));
+
+    if (job.sliceCount > 1) JobParallelFor(job.sliceCount, ImageHistogramSlices, &job);
+    else ImageHistogramSlices(0, 1, &job);
+
+    ImageColorTable table = job.tables[0];
+
+    for (int i = 1; i < job.sliceCount; i++)
+    {
+        for (int j = 0; j < job.tables[i].capacity; j++)
+        {
+            const ImageColorCount *slot = &job.tables[i].slots[j];
+            if (slot->count > 0) AddImageColorCount(&table, slot->color, slot->count, slot->first);
+        }
+
+        UnloadImageHistogram(&job.tables[i]);
+    }
+
+    RL_FREE(job.tables);
+
+    return table;
+}
+
+// Unload image colors histogram
+static void UnloadImageHistogram(ImageColorTable *table)
+{
+    RL_FREE(table->slots);
+    *table = (ImageColorTable){ 0 };
+}
+
+// Add pixels to color histogram entry
+// NOTE: Hash table grows when half full, linear probing
+static ImageColorCount *AddImageColorCount(ImageColorTable *table, unsigned int color, int count, int first)
+{
+    if ((table->count + 1)*2 > table->capacity)
+    {
+        ImageColorTable grown = { 0 };
+        grown.capacity = (table->capacity > 0)? table->capacity*2 : 1024;
+        grown.slots = (ImageColorCount *)RL_CALLOC(grown.capacity, sizeof(ImageColorCount));
+
+        for (int i = 0; i < table->capacity; i++)
+        {
+            if (table->slots[i].count > 0)
+            {
+                unsigned int slot = (table->slots[i].color*2654435761u) & (grown.capacity - 1);
+                while (grown.slots[slot].count > 0) slot = (slot + 1) & (grown.capacity - 1);
+
+                grown.slots[slot] = table->slots[i];
+            }
+        }
+
+        grown.count = table->count;
+        RL_FREE(table->slots);
+        *table = grown;
+    }
+
+    unsigned int slot = (color*2654435761u) & (table->capacity - 1);
+    while ((table->slots[slot].count > 0) && (table->slots[slot].color != color)) slot = (slot + 1) & (table->capacity - 1);
+
+    ImageColorCount *entry = &table->slots[slot];
+
+    if (entry->count == 0)
+    {
+        entry->color = color;
+        entry->first = first;
+        table->count++;
+    }
+    else if (first < entry->first) entry->first = first;
+
+    entry->count += count;
+
+    return entry;
+}
+
+// Get color histogram entry (NULL: not found)
+static ImageColorCount *GetImageColorCount(const ImageColorTable *table, unsigned int color)
+{
+    if (table->capacity == 0) return NULL;
+
+    unsigned int slot = (color*2654435761u) & (table->capacity - 1);
+
+    while (table->slots[slot].count > 0)
+    {
+        if (table->slots[slot].color == color) return &table->slots[slot];
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+
+    return NULL;
+}
+
+// Count image pixels slices colors
+// NOTE: Pixels runs with the same color are counted once
+static void ImageHistogramSlices(int start, int end, void *userData)
+{
+    const ImageHistogramJob *job = (const ImageHistogramJob *)userData;
+
+    for (int s = start; s < end; s++)
+    {
+        int first = (int)((long long)job->pixelCount*s/job->sliceCount);
+        int last = (int)((long long)job->pixelCount*(s + 1)/job->sliceCount);
+
+        ImageColorTable *table = &job->tables[s];
+
+        for (int i = first; i < last; )
+        {
+            unsigned int color = 0;
+            memcpy(&color, &job->pixels[i], sizeof(Color));
+
+            int run = 1;
+            while (((i + run) < last) && (memcmp(&job->pixels[i + run], &color, sizeof(Color)) == 0)) run++;
+
+            AddImageColorCount(table, color, run, i);
+            i += run;
+        }
+    }
+}
+
+// Compare histogram entries by first pixel index
+static int CompareColorCountFirst(const void *a, const void *b)
+{
+    const ImageColorCount *colorA = (const ImageColorCount *)a;
+    const ImageColorCount *colorB = (const ImageColorCount *)b;
+
+    return (colorA->first > colorB->first) - (colorA->first < colorB->first);
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Update quantization box colors average and error
+static void UpdateImageQuantizeBox(ImageQuantizeBox *box, ImageColorCount **colors)
+{
+    double sum[4] = { 0 };
+    double sumSq[4] = { 0 };
+    double total = 0.0;
+
+    for (int i = box->start; i < box->end; i++)
+    {
+        const unsigned char *color = (const unsigned char *)&colors[i]->color;
+
+        for (int c = 0; c < 4; c++)
+        {
+            sum[c] += (double)color[c]*colors[i]->count;
+            sumSq[c] += (double)color[c]*color[c]*colors[i]->count;
+        }
+
+        total += colors[i]->count;
+    }
+
+    double maxVariance = -1.0;
+    box->error = 0.0;
+
+    for (int c = 0; c < 4; c++)
+    {
+        double variance = sumSq[c] - sum[c]*sum[c]/total;
+
+        box->error += variance;
+        if (variance > maxVariance) { maxVariance = variance; box->channel = c; }
+    }
+
+    if ((box->end - box->start) < 2) box->error = 0.0;
+
+    unsigned char *average = (unsigned char *)&box->average;
+    for (int c = 0; c < 4; c++) average[c] = (unsigned char)(sum[c]/total + 0.5);
+}
+
+// Map image pixels to palette colors, histogram palette indices
+static void ImageQuantizeRows(int start, int end, void *userData)
+{
+    const ImageQuantizeJob *job = (const ImageQuantizeJob *)userData;
+    for (int i = start*job->width; i < end*job->width; i++)
+    {
+        unsigned int color = 0;
+        memcpy(&color, &job->pixels[i], sizeof(Color));
+
+        job->pixels[i] = job->palette[GetImageColorCount(job->table, color)->index];
+    }
+}
+
+// Fuse color operations into stages
+// NOTE: Lookup tables values are computed with the same expressions as single operations functions
+static int LoadImageProcessStages(const ImageProcessOp *ops, int count, ImageProcessStage *stages)
+{
+    int stageCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int type = ops[i].type;
+
+        if ((type == IMAGE_PROCESS_TINT) || (type == IMAGE_PROCESS_INVERT) || (type == IMAGE_PROCESS_CONTRAST) || (type == IMAGE_PROCESS_BRIGHTNESS))
+        {
+            // Channels operation composed into previous lookup tables stage (if any)
+            ImageProcessStage *stage = (stageCount > 0)? &stages[stageCount - 1] : NULL;
+
+            if ((stage == NULL) || (stage->type != -1))
+            {
+                stage = &stages[stageCount++];
+                stage->type = -1;
+                for (int c = 0; c < 4; c++) for (int v = 0; v < 256; v++) stage->table[c][v] = (unsigned char)v;
+            }
+
+            float value = ops[i].value;
+            if (type == IMAGE_PROCESS_CONTRAST)
+            {
+                if (value < -100) value = -100;
+                if (value > 100) value = 100;
+
+                value = (100.0f + value)/100.0f;
+                value *= value;
+            }
+            else if (type == IMAGE_PROCESS_BRIGHTNESS)
+            {
+                if (value < -255) value = -255;
+                if (value > 255) value = 255;
+            }
+
+            const unsigned char *tint = (const unsigned char *)&ops[i].color;
+
+            for (int c = 0; c < 4; c++)
+            {
+                // NOTE: Only tint modifies alpha channel
+                if ((c == 3) && (type != IMAGE_PROCESS_TINT)) break;
+
+                for (int v = 0; v < 256; v++)
+                {
+                    int x = stage->table[c][v];
+
+                    switch (type)
                     {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                        case IMAGE_PROCESS_TINT: x = (int)(((float)x/255*((float)tint[c]/255))*255.0f); break;
+                        case IMAGE_PROCESS_INVERT: x = 255 - x; break;
+                        case IMAGE_PROCESS_CONTRAST:
+                        {
+                            float p = (((float)x/255.0f - 0.5f)*value + 0.5f)*255;
+                            x = (p < 0)? 0 : ((p > 255)? 255 : (int)p);
+                        } break;
+                        case IMAGE_PROCESS_BRIGHTNESS:
+                        {
+                            x += (int)value;
+                            x = (x < 0)? 1 : ((x > 255)? 255 : x);
+                        } break;
+                        default: break;
                     }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
+
+                    stage->table[c][v] = (unsigned char)x;
+                }
+            }
+        }
+        else if ((type == IMAGE_PROCESS_GRAYSCALE) || (type == IMAGE_PROCESS_REPLACE) || (type == IMAGE_PROCESS_ALPHA_PREMULTIPLY))
+        {
+            ImageProcessStage *stage = &stages[stageCount++];
+
+            stage->type = type;
+            memcpy(&stage->color, &ops[i].color, sizeof(Color));
+            memcpy(&stage->replace, &ops[i].replace, sizeof(Color));
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Color operation type not supported: %i", type);
+    }
+
+    return stageCount;
+}
+
+// Apply fused color operations stages to image rows
+// NOTE: Stages are applied one after another on every row, row stays in cache between stages
+static void ImageProcessRows(int start, int end, void *userData)
+{
+    const ImageProcessJob *job = (const ImageProcessJob *)userData;
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = job->pixels + (size_t)y*job->width*4;
+
+        for (int s = 0; s < job->stageCount; s++)
+        {
+            const ImageProcessStage *stage = &job->stages[s];
+            int x = 0;
+
+            switch (stage->type)
+            {
+                case -1:
+                {
+                    for (; x < job->width; x++)
                     {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+                        unsigned char *pixel = row + x*4;
+                        pixel[0] = stage->table[0][pixel[0]];
+                        pixel[1] = stage->table[1][pixel[1]];
+                        pixel[2] = stage->table[2][pixel[2]];
+                        pixel[3] = stage->table[3][pixel[3]];
+                    }
+                } break;
+                case IMAGE_PROCESS_GRAYSCALE:
+                {
+                    // Luminance weights (0.299, 0.587, 0.114) in 8 bit fixed point, same as ImageFormat()
+                    for (; x < job->width; x++)
+                    {
+                        unsigned char *pixel = row + x*4;
+                        unsigned char gray = (unsigned char)((pixel[0]*77 + pixel[1]*150 + pixel[2]*29 + 128) >> 8);
+                        pixel[0] = gray;
+                        pixel[1] = gray;
+                        pixel[2] = gray;
+                    }
+                } break;
+                case IMAGE_PROCESS_REPLACE:
+                {
+                #if defined(RTEXTURES_SIMD_SSE2)
+                    __m128i color = _mm_set1_epi32((int)stage->color);
+                    __m128i replace = _mm_set1_epi32((int)stage->replace);
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    for (; (x + 4) <= job->width; x += 4)
+                    {
+                        __m128i pixels = _mm_loadu_si128((const __m128i *)(row + x*4));
+                        __m128i mask = _mm_cmpeq_epi32(pixels, color);
+
+                        pixels = _mm_or_si128(_mm_and_si128(mask, replace), _mm_andnot_si128(mask, pixels));
+                        _mm_storeu_si128((__m128i *)(row + x*4), pixels);
+                    }
+                #endif
+                    for (; x < job->width; x++)
+                    {
+                        unsigned int pixel = 0;
+                        memcpy(&pixel, row + x*4, 4);
+                        if (pixel == stage->color) memcpy(row + x*4, &stage->replace, 4);
                     }
+                } break;
+                case IMAGE_PROCESS_ALPHA_PREMULTIPLY:
+                {
+                    // NOTE: Channels multiplied by alpha/255 (truncated): t/255 = ((t + 1)*257) >> 16, for t = [0..255*255]
+                #if defined(RTEXTURES_SIMD_SSE2)
+                    __m128i zero = _mm_setzero_si128();
+                    __m128i one = _mm_set1_epi16(1);
+                    __m128i scale = _mm_set1_epi16(257);
+                    __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+                    for (; (x + 4) <= job->width; x += 4)
+                    {
+                        __m128i pixels = _mm_loadu_si128((const __m128i *)(row + x*4));
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                        __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+                        __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+                        __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                        __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+                        // Alpha channel multiplied by 255 to be kept
+                        alphaLo = _mm_or_si128(_mm_andnot_si128(alphaMask, alphaLo), _mm_and_si128(alphaMask, _mm_set1_epi16(255)));
+                        alphaHi = _mm_or_si128(_mm_andnot_si128(alphaMask, alphaHi), _mm_and_si128(alphaMask, _mm_set1_epi16(255)));
+
+                        lo = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(lo, alphaLo), one), scale);
+                        hi = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(hi, alphaHi), one), scale);
+
+                        _mm_storeu_si128((__m128i *)(row + x*4), _mm_packus_epi16(lo, hi));
+                    }
+                #endif
+                    for (; x < job->width; x++)
                     {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                        unsigned char *pixel = row + x*4;
+                        int alpha = pixel[3];
+                        pixel[0] = (unsigned char)(((pixel[0]*alpha + 1)*257) >> 16);
+                        pixel[1] = (unsigned char)(((pixel[1]*alpha + 1)*257) >> 16);
+                        pixel[2] = (unsigned char)(((pixel[2]*alpha + 1)*257) >> 16);
                     }
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+#endif
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_COMPRESSION_API)
+// Export image pixels as PNG file data (8 bit per channel)
+// NOTE: Rows are filtered in parallel by jobs system and compressed with sdefl (IMAGE_EXPORT_PNG_LEVEL),
+// a lot faster than stb_image_write zlib compressor, returned data must be freed
+static unsigned char *ExportImagePNGToMemory(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };  // Grayscale, gray+alpha, RGB, RGBA
+
+    *dataSize = 0;
+
+    int rowSize = width*channels + 1;
+    unsigned char *filtered = (unsigned char *)RL_MALLOC(rowSize*height);
+    if (filtered == NULL) return NULL;
+
+    ImageFilterPNGJob job = { pixels, filtered, width, height, channels };
+
+    if ((width*height) >= IMAGE_DRAW_PARALLEL_PIXELS) JobParallelFor(height, ImageFilterPNGRows, &job);
+    else ImageFilterPNGRows(0, height, &job);
+
+    // NOTE: Compressor state is big (~770KB), not on stack
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(8 + 25 + 12 + sdefl_bound(rowSize*height) + 12);
+
+    if ((sdefl != NULL) && (fileData != NULL))
+    {
+        unsigned char *ptr = fileData;
+        memcpy(ptr, signature, 8);
+        ptr += 8;
+
+        // Chunks: [length: 4 bytes][type: 4 bytes][data: length bytes][crc32: 4 bytes], big-endian
+        stbiw__wp32(ptr, 13);
+        stbiw__wptag(ptr, "IHDR");
+        stbiw__wp32(ptr, width);
+        stbiw__wp32(ptr, height);
+        *ptr++ = 8;                     // Bit depth
+        *ptr++ = colorTypes[channels];  // Color type
+        *ptr++ = 0;                     // Compression method
+        *ptr++ = 0;                     // Filter method
+        *ptr++ = 0;                     // Interlace method
+        stbiw__wpcrc(&ptr, 13);
+
+        int compSize = zsdeflate(sdefl, ptr + 8, filtered, rowSize*height, IMAGE_EXPORT_PNG_LEVEL);
+        stbiw__wp32(ptr, compSize);
+        stbiw__wptag(ptr, "IDAT");
+        ptr += compSize;
+        stbiw__wpcrc(&ptr, compSize);
+
+        stbiw__wp32(ptr, 0);
+        stbiw__wptag(ptr, "IEND");
+        stbiw__wpcrc(&ptr, 0);
+
+        *dataSize = (int)(ptr - fileData);
+    }
+    else
+    {
+        RL_FREE(fileData);
+        fileData = NULL;
+    }
+
+    RL_FREE(sdefl);
+    RL_FREE(filtered);
+
+    return fileData;
+}
+
+// Filter image rows for PNG export
+// NOTE: All filters are evaluated in a single pass and the one with the lowest sum of absolute
+// filtered values is kept (same heuristic as stb_image_write), first row uses a zeroed previous row
+static void ImageFilterPNGRows(int start, int end, void *userData)
+{
+    const ImageFilterPNGJob *job = (const ImageFilterPNGJob *)userData;
+    int bpp = job->channels;
+    int size = job->width*bpp;
+    unsigned char *zero = (unsigned char *)RL_CALLOC(size, 1);
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row = job->pixels + y*size;
+        const unsigned char *prev = (y > 0)? row - size : zero;
+        unsigned char *filtered = job->filtered + y*(size + 1);
+        int sums[5] = { 0 };
+
+        // NOTE: First pixel has no left neighbour, paeth predictor is previous row value
+        for (int i = 0; i < bpp; i++)
+        {
+            sums[0] += abs((signed char)row[i]);
+            sums[1] += abs((signed char)row[i]);
+            sums[2] += abs((signed char)(row[i] - prev[i]));
+            sums[3] += abs((signed char)(row[i] - (prev[i] >> 1)));
+            sums[4] += abs((signed char)(row[i] - prev[i]));
+        }
+
+        int none = 0, sub = 0, up = 0, average = 0, paeth = 0;     // Local sums, loop vectorized by compiler
+
+        for (int i = bpp; i < size; i++)
+        {
+            int a = row[i - bpp];
+            int b = prev[i];
+            int c = prev[i - bpp];
+            int pa = abs(b - c);        // |p - a|, p = a + b - c
+            int pb = abs(a - c);        // |p - b|
+            int pc = abs(a + b - 2*c);  // |p - c|
+            int predictor = ((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c);
+
+            none += abs((signed char)row[i]);
+            sub += abs((signed char)(row[i] - a));
+            up += abs((signed char)(row[i] - b));
+            average += abs((signed char)(row[i] - ((a + b) >> 1)));
+            paeth += abs((signed char)(row[i] - predictor));
+        }
+
+        sums[0] += none;
+        sums[1] += sub;
+        sums[2] += up;
+        sums[3] += average;
+        sums[4] += paeth;
+
+        int filter = 0;
+        for (int f = 1; f < 5; f++) if (sums[f] < sums[filter]) filter = f;
+
+        filtered[0] = (unsigned char)filter;
+        unsigned char *dst = filtered + 1;
+
+        switch (filter)
+        {
+            case 0: memcpy(dst, row, size); break;
+            case 1:
+            {
+                for (int i = 0; i < bpp; i++) dst[i] = row[i];
+                for (int i = bpp; i < size; i++) dst[i] = row[i] - row[i - bpp];
+            } break;
+            case 2: for (int i = 0; i < size; i++) dst[i] = row[i] - prev[i]; break;
+            case 3:
+            {
+                for (int i = 0; i < bpp; i++) dst[i] = row[i] - (prev[i] >> 1);
+                for (int i = bpp; i < size; i++) dst[i] = row[i] - ((row[i - bpp] + prev[i]) >> 1);
+            } break;
+            case 4:
+            {
+                for (int i = 0; i < bpp; i++) dst[i] = row[i] - prev[i];
+                for (int i = bpp; i < size; i++)
+                {
+                    int a = row[i - bpp];
+                    int b = prev[i];
+                    int c = prev[i - bpp];
+                    int pa = abs(b - c);
+                    int pb = abs(a - c);
+                    int pc = abs(a + b - 2*c);
+
+                    dst[i] = row[i] - (((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c));
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+            } break;
+            default: break;
+        }
+    }
+
+    RL_FREE(zero);
+}
+#endif
+
+// Fill pixels with pixel data, filled region doubled on every copy
+// NOTE: Pattern is doubled up to IMAGE_FILL_CHUNK_SIZE (cache resident) and then repeated,
+// pixel data could be the first destination pixel, pixels with equal bytes are filled with memset()
+static void FillPixels(unsigned char *dst, const unsigned char *pixel, int bytesPerPixel, int count)
+{
+    int size = count*bytesPerPixel;
+    if (size <= 0) return;
+
+    bool uniform = true;
+    for (int i = 1; i < bytesPerPixel; i++) if (pixel[i] != pixel[0]) uniform = false;
+
+    if (uniform)
+    {
+        memset(dst, pixel[0], size);
+        return;
+    }
+
+    if (dst != pixel) memcpy(dst, pixel, bytesPerPixel);
+
+    int filled = bytesPerPixel;
+    while ((filled < size) && (filled < IMAGE_FILL_CHUNK_SIZE))
+    {
+        int copy = ((size - filled) < filled)? (size - filled) : filled;
+        memcpy(dst + filled, dst, copy);
+        filled += copy;
+    }
+
+    int chunk = filled;
+    while (filled < size)
+    {
+        int copy = ((size - filled) < chunk)? (size - filled) : chunk;
+        memcpy(dst + filled, dst, copy);
+        filled += copy;
+    }
+}
+
+// Blit image rows, source blended into destination (ImageDraw())
+// NOTE: RGBA8 destination is blended by rows chunks (source converted to RGBA8 if required),
+// other destination formats are blended per pixel through GetPixelColor()/SetPixelColor()
+static void ImageBlitRows(int start, int end, void *userData)
+{
+    const ImageBlitJob *job = (const ImageBlitJob *)userData;
+
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, job->srcFormat);
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, job->dstFormat);
+
+    Color colors[IMAGE_DRAW_ROW_CHUNK] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *pSrc = job->src + y*job->srcStride;
+        unsigned char *pDst = job->dst + y*job->dstStride;
+
+        // Fast path: Avoid moving pixel by pixel if no blend required and same format
+        if (!job->blend && (job->srcFormat == job->dstFormat)) memcpy(pDst, pSrc, job->width*bytesPerPixelSrc);
+        else if (job->dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            for (int x = 0; x < job->width; x += IMAGE_DRAW_ROW_CHUNK)
+            {
+                int count = ((job->width - x) < IMAGE_DRAW_ROW_CHUNK)? (job->width - x) : IMAGE_DRAW_ROW_CHUNK;
+                const Color *src = colors;
+
+                if (job->srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) src = (const Color *)(pSrc + x*4);
+                else LoadRowColors(colors, pSrc + x*bytesPerPixelSrc, count, job->srcFormat);
+
+                // Fast path: Avoid blend if source has no alpha to blend
+                if (job->blend) BlendRowColors((Color *)(pDst + x*4), src, count, job->tint);
+                else memcpy(pDst + x*4, src, count*4);
+            }
+        }
+        else
+        {
+            for (int x = 0; x < job->width; x++)
+            {
+                Color colSrc = GetPixelColor((void *)pSrc, job->srcFormat);
+                Color colDst = GetPixelColor(pDst, job->dstFormat);
+
+                // Fast path: Avoid blend if source has no alpha to blend
+                Color blend = job->blend? ColorAlphaBlend(colDst, colSrc, job->tint) : colSrc;
+
+                SetPixelColor(pDst, blend, job->dstFormat);
+
+                pDst += bytesPerPixelDst;
+                pSrc += bytesPerPixelSrc;
+            }
+        }
+    }
+}
+
+// Load pixels row as RGBA8 colors
+static void LoadRowColors(Color *colors, const unsigned char *src, int count, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: for (int i = 0; i < count; i++) colors[i] = (Color){ src[i], src[i], src[i], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: for (int i = 0; i < count; i++) colors[i] = (Color){ src[i*2], src[i*2], src[i*2], src[i*2 + 1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: for (int i = 0; i < count; i++) colors[i] = (Color){ src[i*3], src[i*3 + 1], src[i*3 + 2], 255 }; break;
+        default:
+        {
+            int bytesPerPixel = GetPixelDataSize(1, 1, format);
+            for (int i = 0; i < count; i++) colors[i] = GetPixelColor((void *)(src + i*bytesPerPixel), format);
+        } break;
+    }
+}
+
+// Alpha blend RGBA8 pixels row with tint, same as ColorAlphaBlend()
+// NOTE: SIMD lanes compute blend with float channels, all terms are integers under 2^24 (exact),
+// divisions are truncated and corrected by remainder to match integer results
+static void BlendRowColors(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 tintR = _mm_set1_ps((float)(tint.r + 1)/256.0f);
+    const __m128 tintG = _mm_set1_ps((float)(tint.g + 1)/256.0f);
+    const __m128 tintB = _mm_set1_ps((float)(tint.b + 1)/256.0f);
+    const __m128 tintA = _mm_set1_ps((float)(tint.a + 1)/256.0f);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 v256 = _mm_set1_ps(256.0f);
+    const __m128 vInv256 = _mm_set1_ps(1.0f/256.0f);
+    const __m128 vOne = _mm_set1_ps(1.0f);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        // Tinted source channels: (c*(tint + 1)) >> 8
+        __m128 sr = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(s, mask)), tintR)));
+        __m128 sg = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(s, 8), mask)), tintG)));
+        __m128 sb = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(s, 16), mask)), tintB)));
+        __m128i sai = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(s, 24)), tintA));
+
+        __m128 dr = _mm_cvtepi32_ps(_mm_and_si128(d, mask));
+        __m128 dg = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(d, 8), mask));
+        __m128 db = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(d, 16), mask));
+        __m128 da = _mm_cvtepi32_ps(_mm_srli_epi32(d, 24));
+
+        __m128 alpha = _mm_add_ps(_mm_cvtepi32_ps(sai), vOne);
+        __m128 inv = _mm_mul_ps(da, _mm_sub_ps(v256, alpha));     // dst.a*(256 - alpha)
+        __m128 outA = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(alpha, v256), inv), vInv256)));
+        __m128 srcScale = _mm_mul_ps(alpha, v256);
+
+        __m128i out = _mm_slli_epi32(_mm_cvttps_epi32(outA), 24);
+        __m128i tinted = _mm_slli_epi32(sai, 24);
+        __m128 channels[3] = { sr, sg, sb };
+        __m128 dstChannels[3] = { dr, dg, db };
+
+        for (int c = 0; c < 3; c++)
+        {
+            // ((src*alpha*256 + dst*dst.a*(256 - alpha))/out.a) >> 8, truncated to 8 bit as integer blend
+            __m128 num = _mm_add_ps(_mm_mul_ps(channels[c], srcScale), _mm_mul_ps(dstChannels[c], inv));
+            __m128 q = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(num, outA)));
+            __m128 rem = _mm_sub_ps(num, _mm_mul_ps(q, outA));
+            q = _mm_sub_ps(q, _mm_and_ps(_mm_cmplt_ps(rem, _mm_setzero_ps()), vOne));
+            q = _mm_add_ps(q, _mm_and_ps(_mm_cmpge_ps(rem, outA), vOne));
+
+            out = _mm_or_si128(out, _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(_mm_cvttps_epi32(q), 8), mask), 8*c));
+            tinted = _mm_or_si128(tinted, _mm_slli_epi32(_mm_cvttps_epi32(channels[c]), 8*c));
+        }
+
+        // Transparent source keeps destination, opaque source is copied
+        __m128i transparent = _mm_cmpeq_epi32(sai, _mm_setzero_si128());
+        __m128i opaque = _mm_cmpeq_epi32(sai, mask);
+
+        out = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(transparent, opaque), out), _mm_or_si128(_mm_and_si128(transparent, d), _mm_and_si128(opaque, tinted)));
+        _mm_storeu_si128((__m128i *)(dst + i), out);
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    const float32x4_t tintR = vdupq_n_f32((float)(tint.r + 1)/256.0f);
+    const float32x4_t tintG = vdupq_n_f32((float)(tint.g + 1)/256.0f);
+    const float32x4_t tintB = vdupq_n_f32((float)(tint.b + 1)/256.0f);
+    const float32x4_t tintA = vdupq_n_f32((float)(tint.a + 1)/256.0f);
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const uint32x4_t oneBits = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+    const float32x4_t v256 = vdupq_n_f32(256.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint32x4_t s = vreinterpretq_u32_u8(vld1q_u8((const uint8_t *)(src + i)));
+        uint32x4_t d = vreinterpretq_u32_u8(vld1q_u8((const uint8_t *)(dst + i)));
+
+        // Tinted source channels: (c*(tint + 1)) >> 8
+        float32x4_t channels[3] = {
+            vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(vcvtq_f32_u32(vandq_u32(s, mask)), tintR))),
+            vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(s, 8), mask)), tintG))),
+            vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(s, 16), mask)), tintB)))
+        };
+        uint32x4_t sai = vcvtq_u32_f32(vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(s, 24)), tintA));
+
+        float32x4_t dstChannels[3] = {
+            vcvtq_f32_u32(vandq_u32(d, mask)),
+            vcvtq_f32_u32(vandq_u32(vshrq_n_u32(d, 8), mask)),
+            vcvtq_f32_u32(vandq_u32(vshrq_n_u32(d, 16), mask))
+        };
+        float32x4_t da = vcvtq_f32_u32(vshrq_n_u32(d, 24));
+
+        float32x4_t alpha = vaddq_f32(vcvtq_f32_u32(sai), vdupq_n_f32(1.0f));
+        float32x4_t inv = vmulq_f32(da, vsubq_f32(v256, alpha));     // dst.a*(256 - alpha)
+        float32x4_t outA = vcvtq_f32_u32(vcvtq_u32_f32(vmulq_n_f32(vmlaq_f32(inv, alpha, v256), 1.0f/256.0f)));
+        float32x4_t srcScale = vmulq_f32(alpha, v256);
+
+        // Reciprocal estimate refined by two Newton-Raphson steps, quotient corrected by remainder
+        float32x4_t recip = vrecpeq_f32(outA);
+        recip = vmulq_f32(vrecpsq_f32(outA, recip), recip);
+        recip = vmulq_f32(vrecpsq_f32(outA, recip), recip);
+
+        uint32x4_t out = vshlq_n_u32(vcvtq_u32_f32(outA), 24);
+        uint32x4_t tinted = vshlq_n_u32(sai, 24);
+
+        for (int c = 0; c < 3; c++)
+        {
+            // ((src*alpha*256 + dst*dst.a*(256 - alpha))/out.a) >> 8, truncated to 8 bit as integer blend
+            float32x4_t num = vmlaq_f32(vmulq_f32(dstChannels[c], inv), channels[c], srcScale);
+            float32x4_t q = vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(num, recip)));
+            float32x4_t rem = vmlsq_f32(num, q, outA);
+            q = vsubq_f32(q, vreinterpretq_f32_u32(vandq_u32(vcltq_f32(rem, zero), oneBits)));
+            q = vaddq_f32(q, vreinterpretq_f32_u32(vandq_u32(vcgeq_f32(rem, outA), oneBits)));
+
+            out = vorrq_u32(out, vshlq_u32(vandq_u32(vshrq_n_u32(vcvtq_u32_f32(q), 8), mask), vdupq_n_s32(8*c)));
+            tinted = vorrq_u32(tinted, vshlq_u32(vcvtq_u32_f32(channels[c]), vdupq_n_s32(8*c)));
+        }
+
+        // Transparent source keeps destination, opaque source is copied
+        out = vbslq_u32(vceqq_u32(sai, vdupq_n_u32(0)), d, vbslq_u32(vceqq_u32(sai, mask), tinted, out));
+        vst1q_u8((uint8_t *)(dst + i), vreinterpretq_u8_u32(out));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ColorAlphaBlend(dst[i], src[i], tint);
+}
+
+// Convert image data format with integer kernels (common formats pairs), mipmaps are kept
+// NOTE: Supported pairs: R8G8B8 <-> R8G8B8A8, R8G8B8A8 -> R5G6B5/R5G5B5A1/R4G4B4A4/GRAYSCALE/GRAY_ALPHA and
+// R32G32B32/R32G32B32A32 -> R8G8B8A8, all mipmap levels are converted as one pixels stream, in place
+static bool ImageFormatDirect(Image *image, int newFormat)
+{
+    int format = image->format;
+
+    bool supported = (((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) ||
+        ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && ((newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+            (newFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (newFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+            (newFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) || (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+            (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA))) ||
+        (((format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) &&
+            (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)));
+
+    if (!supported) return false;
+
+    // Pixels count including mipmap levels
+    int count = 0;
+    for (int i = 0, mipWidth = image->width, mipHeight = image->height; i < image->mipmaps; i++)
+    {
+        count += mipWidth*mipHeight;
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)image->data;
+    int i = 0;
+
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)
+    {
+        data = (unsigned char *)RL_REALLOC(image->data, count*4);
+        if (data == NULL) return false;
+        image->data = data;
+
+        // Pixels expanded backwards, destination pixel never overwrites source pixels not read yet
+        i = count - 1;
+    #if defined(RTEXTURES_SIMD_NEON)
+        for (; (i >= 0) && (((i + 1)%16) != 0); i--)
+        {
+            unsigned char r = data[i*3], g = data[i*3 + 1], b = data[i*3 + 2];
+            data[i*4] = r; data[i*4 + 1] = g; data[i*4 + 2] = b; data[i*4 + 3] = 255;
+        }
+        for (i -= 15; i >= 0; i -= 16)
+        {
+            uint8x16x3_t rgb = vld3q_u8(data + i*3);
+            uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(255) } };
+            vst4q_u8(data + i*4, rgba);
+        }
+    #endif
+        for (; i >= 0; i--)
+        {
+            unsigned char r = data[i*3], g = data[i*3 + 1], b = data[i*3 + 2];
+            data[i*4] = r; data[i*4 + 1] = g; data[i*4 + 2] = b; data[i*4 + 3] = 255;
+        }
+    }
+    else if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // Pixels shrunk forwards, destination pixel never overwrites source pixels not read yet
+        // NOTE: Channels quantized with rounding using exact integer division: x/255 = (x + 1 + (x >> 8)) >> 8
+        unsigned short *data16 = (unsigned short *)data;
+
+        switch (newFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+            #if defined(RTEXTURES_SIMD_NEON)
+                for (; (i + 16) <= count; i += 16)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(data + i*4);
+                    uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+                    vst3q_u8(data + i*3, rgb);
+                }
+            #endif
+                for (; i < count; i++)
+                {
+                    data[i*3] = data[i*4];
+                    data[i*3 + 1] = data[i*4 + 1];
+                    data[i*3 + 2] = data[i*4 + 2];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                // Luminance weights (0.299, 0.587, 0.114) in 8 bit fixed point, rounded to nearest
+                bool alpha = (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+            #if defined(RTEXTURES_SIMD_SSE2)
+                for (; !alpha && ((i + 8) <= count); i += 8)
+                {
+                    __m128i p0 = _mm_loadu_si128((const __m128i *)(data + i*4));
+                    __m128i p1 = _mm_loadu_si128((const __m128i *)(data + i*4 + 16));
+                    __m128i mask = _mm_set1_epi32(0xff);
+
+                    __m128i r = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+                    __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask), _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+                    __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask), _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+
+                    __m128i y = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)), _mm_mullo_epi16(g, _mm_set1_epi16(150))), _mm_mullo_epi16(b, _mm_set1_epi16(29)));
+                    y = _mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8);
+
+                    _mm_storel_epi64((__m128i *)(data + i), _mm_packus_epi16(y, y));
+                }
+            #elif defined(RTEXTURES_SIMD_NEON)
+                for (; !alpha && ((i + 8) <= count); i += 8)
+                {
+                    uint8x8x4_t rgba = vld4_u8(data + i*4);
+                    uint16x8_t y = vmull_u8(rgba.val[0], vdup_n_u8(77));
+                    y = vmlal_u8(y, rgba.val[1], vdup_n_u8(150));
+                    y = vmlal_u8(y, rgba.val[2], vdup_n_u8(29));
+
+                    vst1_u8(data + i, vrshrn_n_u16(y, 8));
+                }
+            #endif
+                for (; i < count; i++)
+                {
+                    unsigned char y = (unsigned char)((data[i*4]*77 + data[i*4 + 1]*150 + data[i*4 + 2]*29 + 128) >> 8);
+                    unsigned char a = data[i*4 + 3];
+
+                    if (alpha) { data[i*2] = y; data[i*2 + 1] = a; }
+                    else data[i] = y;
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                // Channels bits and output shifts for target format
+                int rMax = 31, gMax = 63, bMax = 31, aMax = 0;
+                int rShift = 11, gShift = 5, bShift = 0;
+
+                if (newFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) { gMax = 31; rShift = 11; gShift = 6; bShift = 1; aMax = 1; }
+                else if (newFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) { rMax = 15; gMax = 15; bMax = 15; aMax = 15; rShift = 12; gShift = 8; bShift = 4; }
+
+            #if defined(RTEXTURES_SIMD_SSE2)
+                for (; (i + 8) <= count; i += 8)
                 {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    __m128i p0 = _mm_loadu_si128((const __m128i *)(data + i*4));
+                    __m128i p1 = _mm_loadu_si128((const __m128i *)(data + i*4 + 16));
+                    __m128i mask = _mm_set1_epi32(0xff);
+                    __m128i bias = _mm_set1_epi16(127);
+                    __m128i one = _mm_set1_epi16(1);
+
+                    __m128i c[4] = { 0 };
+                    for (int k = 0; k < 4; k++) c[k] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, k*8), mask), _mm_and_si128(_mm_srli_epi32(p1, k*8), mask));
+
+                    // Quantized channel: (x*max + 127)/255
+                    __m128i t = _mm_add_epi16(_mm_mullo_epi16(c[0], _mm_set1_epi16((short)rMax)), bias);
+                    __m128i result = _mm_slli_epi16(_mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, one), _mm_srli_epi16(t, 8)), 8), rShift);
+                    t = _mm_add_epi16(_mm_mullo_epi16(c[1], _mm_set1_epi16((short)gMax)), bias);
+                    result = _mm_or_si128(result, _mm_slli_epi16(_mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, one), _mm_srli_epi16(t, 8)), 8), gShift));
+                    t = _mm_add_epi16(_mm_mullo_epi16(c[2], _mm_set1_epi16((short)bMax)), bias);
+                    result = _mm_or_si128(result, _mm_slli_epi16(_mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, one), _mm_srli_epi16(t, 8)), 8), bShift));
+
+                    if (aMax == 1) result = _mm_or_si128(result, _mm_and_si128(_mm_cmpgt_epi16(c[3], _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), one));
+                    else if (aMax > 1)
                     {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        t = _mm_add_epi16(_mm_mullo_epi16(c[3], _mm_set1_epi16((short)aMax)), bias);
+                        result = _mm_or_si128(result, _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, one), _mm_srli_epi16(t, 8)), 8));
                     }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+
+                    _mm_storeu_si128((__m128i *)(data16 + i), result);
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+            #elif defined(RTEXTURES_SIMD_NEON)
+                for (; (i + 8) <= count; i += 8)
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    uint8x8x4_t rgba = vld4_u8(data + i*4);
+                    uint16x8_t bias = vdupq_n_u16(127);
+                    uint16x8_t one = vdupq_n_u16(1);
+
+                    // Quantized channel: (x*max + 127)/255
+                    uint16x8_t t = vmlal_u8(bias, rgba.val[0], vdup_n_u8((unsigned char)rMax));
+                    uint16x8_t result = vshlq_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(t, one), vshrq_n_u16(t, 8)), 8), vdupq_n_s16((short)rShift));
+                    t = vmlal_u8(bias, rgba.val[1], vdup_n_u8((unsigned char)gMax));
+                    result = vorrq_u16(result, vshlq_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(t, one), vshrq_n_u16(t, 8)), 8), vdupq_n_s16((short)gShift)));
+                    t = vmlal_u8(bias, rgba.val[2], vdup_n_u8((unsigned char)bMax));
+                    result = vorrq_u16(result, vshlq_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(t, one), vshrq_n_u16(t, 8)), 8), vdupq_n_s16((short)bShift)));
+
+                    if (aMax == 1) result = vorrq_u16(result, vandq_u16(vcgtq_u16(vmovl_u8(rgba.val[3]), vdupq_n_u16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), one));
+                    else if (aMax > 1)
                     {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                        t = vmlal_u8(bias, rgba.val[3], vdup_n_u8((unsigned char)aMax));
+                        result = vorrq_u16(result, vshrq_n_u16(vaddq_u16(vaddq_u16(t, one), vshrq_n_u16(t, 8)), 8));
                     }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+
+                    vst1q_u16(data16 + i, result);
                 }
-            rlEnd();
-        rlPopMatrix();
+            #endif
+                for (; i < count; i++)
+                {
+                    int r = data[i*4]*rMax + 127;
+                    int g = data[i*4 + 1]*gMax + 127;
+                    int b = data[i*4 + 2]*bMax + 127;
+                    int a = data[i*4 + 3];
 
-        rlSetTexture(0);
+                    unsigned short pixel = (unsigned short)((((r + 1 + (r >> 8)) >> 8) << rShift) | (((g + 1 + (g >> 8)) >> 8) << gShift) | (((b + 1 + (b >> 8)) >> 8) << bShift));
+
+                    if (aMax == 1) pixel |= (a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+                    else if (aMax > 1) { a = a*aMax + 127; pixel |= (unsigned short)((a + 1 + (a >> 8)) >> 8); }
+
+                    data16[i] = pixel;
+                }
+            } break;
+            default: break;
+        }
+    }
+    else
+    {
+        // Float channels clamped to [0..1] and rounded, pixels shrunk forwards
+        const float *dataf = (const float *)data;
+        int channels = (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)? 4 : 3;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        for (; (channels == 4) && ((i + 4) <= count); i += 4)
+        {
+            __m128i c[4] = { 0 };
+            for (int k = 0; k < 4; k++)
+            {
+                __m128 p = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(dataf + (i + k)*4), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+                c[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(p, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+            }
+
+            _mm_storeu_si128((__m128i *)(data + i*4), _mm_packus_epi16(_mm_packs_epi32(c[0], c[1]), _mm_packs_epi32(c[2], c[3])));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; (channels == 4) && ((i + 4) <= count); i += 4)
+        {
+            uint32x4_t c[4];
+            for (int k = 0; k < 4; k++)
+            {
+                float32x4_t p = vminq_f32(vmaxq_f32(vld1q_f32(dataf + (i + k)*4), vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+                c[k] = vcvtq_u32_f32(vaddq_f32(vmulq_n_f32(p, 255.0f), vdupq_n_f32(0.5f)));
+            }
+
+            uint16x8_t lo = vcombine_u16(vmovn_u32(c[0]), vmovn_u32(c[1]));
+            uint16x8_t hi = vcombine_u16(vmovn_u32(c[2]), vmovn_u32(c[3]));
+            vst1q_u8(data + i*4, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+        }
+    #endif
+        for (; i < count; i++)
+        {
+            unsigned char pixel[4] = { 0, 0, 0, 255 };
+
+            for (int k = 0; k < channels; k++)
+            {
+                float value = dataf[i*channels + k];
+                pixel[k] = (value <= 0.0f)? 0 : (value >= 1.0f)? 255 : (unsigned char)(value*255.0f + 0.5f);
+            }
+
+            memcpy(data + i*4, pixel, 4);
+        }
+    }
+
+    image->format = newFormat;
+
+    // Shrunk data reallocated to converted size
+    if (GetPixelDataSize(1, 1, format) > GetPixelDataSize(1, 1, newFormat))
+    {
+        data = (unsigned char *)RL_REALLOC(image->data, GetPixelDataSize(count, 1, newFormat));
+        if (data != NULL) image->data = data;
+    }
+
+    return true;
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                }
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Get registered image decoder for file type (NULL: not registered)
+static const ImageDecoder *GetImageDecoder(const char *fileType)
+{
+    if (fileType == NULL) return NULL;
+
+    for (int i = 0; i < imageDecoderCount; i++)
+    {
+        if (strcmp(imageDecoders[i].fileType, fileType) == 0) return &imageDecoders[i];
+    }
+
+    return NULL;
+}
+
+// Decode texture async load image (loader thread)
+// NOTE: Second pass copies decoded image into staging pixel buffer mapped on finalize,
+// images with a registered decoder are decoded directly into staging buffer on second pass
+static void DecodeTextureAsync(void *data)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)data;
+
+    if (load->fileData != NULL)
+    {
+        // Registered decoder second pass, image decoded directly into staging buffer (or image memory if not available)
+        void *pixels = (load->staging != NULL)? load->staging : load->image.data;
+        int size = GetPixelDataSize(load->image.width, load->image.height, load->image.format);
+        const ImageDecoder *decoder = GetImageDecoder(GetFileExtension(load->fileName));
+
+        if ((decoder == NULL) || !decoder->decode(load->fileData, (int)load->fileSize, pixels, size))
+        {
+            // Registered decoder failed, built-in decoder result converted to probed format
+            Image image = LoadImageFromMemory(GetFileExtension(load->fileName), load->fileData, (int)load->fileSize);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+            if ((image.data != NULL) && (image.format != load->image.format)) ImageFormat(&image, load->image.format);
+#endif
+            if ((image.data != NULL) && (image.width == load->image.width) && (image.height == load->image.height) && (image.format == load->image.format)) memcpy(pixels, image.data, size);
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to decode texture image", load->fileName);
+                memset(pixels, 0, size);
+            }
+
+            UnloadImage(image);
+        }
+
+        UnloadFileDataMapped(load->fileData);
+        load->fileData = NULL;
+        load->staging = NULL;
+    }
+    else if (load->staging == NULL)
+    {
+        // Registered decoder: only image info probed, image decoded on second pass into staging buffer mapped on finalize
+        const ImageDecoder *decoder = GetImageDecoder(GetFileExtension(load->fileName));
+
+        if (decoder != NULL)
+        {
+            load->fileData = LoadFileDataMapped(load->fileName, &load->fileSize);
+
+            if ((load->fileData != NULL) && decoder->probe(load->fileData, (int)load->fileSize, &load->image.width, &load->image.height, &load->image.format))
+            {
+                load->image.mipmaps = 1;
+                return;
+            }
+
+            UnloadFileDataMapped(load->fileData);
+            load->fileData = NULL;
+        }
+
+        load->image = LoadImage(load->fileName);
+    }
+    else
+    {
+        int size = 0;
+        int mipWidth = load->image.width;
+        int mipHeight = load->image.height;
+
+        for (int i = 0; i < load->image.mipmaps; i++)
+        {
+            size += GetPixelDataSize(mipWidth, mipHeight, load->image.format);
+
+            mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+            mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+        }
+
+        memcpy(load->staging, load->image.data, size);
+
+        RL_FREE(load->image.data);
+        load->image.data = NULL;
+        load->staging = NULL;
+    }
+}
+
+// Finalize texture async load, image uploaded to GPU (main thread)
+// NOTE: Decoded image is copied into a staging pixel buffer by loader thread (if supported),
+// render thread only issues the transfer from staging buffer, no image data copy
+static void FinalizeTextureAsync(void *data)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)data;
+
+    if (load->stagingId != 0)
+    {
+        load->texture.id = rlLoadTextureFromStaging(load->stagingId, load->image.width, load->image.height, load->image.format, load->image.mipmaps);
+        load->texture.width = load->image.width;
+        load->texture.height = load->image.height;
+        load->texture.mipmaps = load->image.mipmaps;
+        load->texture.format = load->image.format;
+        load->stagingId = 0;
+    }
+    else if ((load->image.data != NULL) || (load->fileData != NULL))
+    {
+        int size = 0;
+        int mipWidth = load->image.width;
+        int mipHeight = load->image.height;
+
+        for (int i = 0; i < load->image.mipmaps; i++)
+        {
+            size += GetPixelDataSize(mipWidth, mipHeight, load->image.format);
+
+            mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+            mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+        }
+
+        load->staging = rlLoadTextureStaging(size, &load->stagingId);
+
+        if (load->staging != NULL) ContinueAsyncLoad(DecodeTextureAsync);
+        else if (load->fileData != NULL)
+        {
+            // Staging buffers not supported, image decoded into image memory and uploaded on next finalize
+            load->image.data = RL_MALLOC(size);
+            ContinueAsyncLoad(DecodeTextureAsync);
+        }
+        else
+        {
+            load->texture = LoadTextureFromImage(load->image);
+            UnloadImage(load->image);
+        }
     }
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Get streamed texture index from texture id (-1: not streamed)
+static int GetTextureStreamIndex(unsigned int id)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    unsigned int mask = MAX_TEXTURE_STREAMS*2 - 1;
+    unsigned int slot = (id*2654435761u) & mask;
 
-    return (Color){ color.r, color.g, color.b, (unsigned char)(255.0f*alpha) };
+    while (textureStreaming.slots[slot] != 0)
+    {
+        int index = textureStreaming.slots[slot] - 1;
+        if (textureStreaming.streams[index].id == id) return index;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
 }
 
-// Get hexadecimal value for a Color
-int ColorToInt(Color color)
+// Remove streamed texture, texture is not unloaded
+// NOTE: Load in flight is waited, hash table slot is removed with backward shift (no tombstones)
+static void RemoveTextureStream(int index)
 {
-    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+    TextureStream *stream = &textureStreaming.streams[index];
+
+    if (stream->request >= 0)
+    {
+        while (!IsAsyncLoadReady(stream->request)) ProcessAsyncLoads(0.0);
+
+        TextureStreamLoad *load = (TextureStreamLoad *)GetAsyncLoadData(stream->request, FinalizeTextureStream);
+
+        if ((load != NULL) && load->loaded)
+        {
+            textureStreaming.memory += stream->requestSize;
+            stream->residentLevel = load->firstLevel;
+        }
+
+        textureStreaming.pending -= stream->requestSize;
+        RL_FREE(load);
+    }
+
+    textureStreaming.memory -= GetTextureStreamSize(stream, stream->residentLevel, stream->mipmaps - 1);
+
+    unsigned int mask = MAX_TEXTURE_STREAMS*2 - 1;
+    unsigned int slot = (stream->id*2654435761u) & mask;
+    while ((textureStreaming.slots[slot] - 1) != index) slot = (slot + 1) & mask;
+
+    unsigned int next = slot;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (textureStreaming.slots[next] == 0) break;
+
+        unsigned int home = (textureStreaming.streams[textureStreaming.slots[next] - 1].id*2654435761u) & mask;
+
+        // Entry moved to the empty slot if its home slot is not between empty slot and its current slot
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            textureStreaming.slots[slot] = textureStreaming.slots[next];
+            slot = next;
+        }
+    }
+    textureStreaming.slots[slot] = 0;
+
+    RL_FREE(stream->fileName);
+
+    // Last stream moved to the removed index
+    int last = textureStreaming.count - 1;
+    if (index != last)
+    {
+        slot = (textureStreaming.streams[last].id*2654435761u) & mask;
+        while ((textureStreaming.slots[slot] - 1) != last) slot = (slot + 1) & mask;
+
+        textureStreaming.streams[index] = textureStreaming.streams[last];
+        textureStreaming.slots[slot] = index + 1;
+    }
+
+    textureStreaming.count--;
 }
 
-// Get color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
+// Get streamed texture mipmaps levels size (bytes)
+static unsigned int GetTextureStreamSize(const TextureStream *stream, int firstLevel, int lastLevel)
 {
-    Vector4 result;
+    unsigned int size = 0;
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+    for (int i = firstLevel; i <= lastLevel; i++)
+    {
+        int mipWidth = ((stream->width >> i) > 0)? (stream->width >> i) : 1;
+        int mipHeight = ((stream->height >> i) > 0)? (stream->height >> i) : 1;
 
-    return result;
+        size += GetPixelDataSize(mipWidth, mipHeight, stream->format);
+    }
+
+    return size;
 }
 
-// Get color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
+// Get streamed texture target resident level
+// NOTE: Textures not requested for TEXTURE_STREAMING_KEEP_FRAMES frames only want the mipmaps tail
+static int GetTextureStreamTarget(const TextureStream *stream)
 {
-    Color result;
+    int level = ((textureStreaming.frame - stream->lastFrame) <= TEXTURE_STREAMING_KEEP_FRAMES)? stream->wantedLevel : stream->tailLevel;
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    return (level < stream->minLevel)? stream->minLevel : level;
+}
 
-    return result;
+// Evict one mipmap level, least recently requested first (largest resident first on ties)
+// NOTE: Mipmaps tails and textures with loads in flight are not evicted, wanted mipmaps are evicted if not surplusOnly
+static bool EvictTextureStream(int skip, bool surplusOnly)
+{
+    int victim = -1;
+
+    for (int i = 0; i < textureStreaming.count; i++)
+    {
+        TextureStream *stream = &textureStreaming.streams[i];
+
+        if ((i == skip) || (stream->request >= 0) || (stream->residentLevel >= stream->tailLevel)) continue;
+        if (surplusOnly && (stream->residentLevel >= GetTextureStreamTarget(stream))) continue;
+
+        if ((victim < 0) || (stream->lastFrame < textureStreaming.streams[victim].lastFrame) ||
+            ((stream->lastFrame == textureStreaming.streams[victim].lastFrame) && (stream->residentLevel < textureStreaming.streams[victim].residentLevel))) victim = i;
+    }
+
+    if (victim < 0) return false;
+
+    TextureStream *stream = &textureStreaming.streams[victim];
+    int level = stream->residentLevel;
+
+    // Base level moved before releasing level memory, released level is not sampled
+    rlSetTextureBaseLevel(stream->id, level + 1);
+    rlUpdateTextureLevel(stream->id, level, ((stream->width >> level) > 0)? (stream->width >> level) : 1,
+        ((stream->height >> level) > 0)? (stream->height >> level) : 1, stream->format, NULL);
+
+    textureStreaming.memory -= GetTextureStreamSize(stream, level, level);
+    stream->residentLevel++;
+
+    return true;
 }
 
-// Get HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Decode streamed texture mipmaps (loader thread)
+static void DecodeTextureStream(void *data)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
+    TextureStreamLoad *load = (TextureStreamLoad *)data;
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
+    load->image = LoadImage(load->fileName);
 
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if ((load->image.data != NULL) && (load->image.mipmaps == 1)) ImageMipmaps(&load->image);
+#endif
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    // File changed since texture was loaded, mipmaps can not be streamed
+    if ((load->image.data != NULL) && ((load->image.width != load->width) || (load->image.height != load->height) ||
+        (load->image.format != load->format) || (load->image.mipmaps <= load->lastLevel)))
+    {
+        UnloadImage(load->image);
+        load->image.data = NULL;
+    }
+}
 
-    if (delta < 0.00001f)
+// Finalize streamed texture mipmaps, levels uploaded to GPU (main thread)
+static void FinalizeTextureStream(void *data)
+{
+    TextureStreamLoad *load = (TextureStreamLoad *)data;
+
+    if (load->image.data == NULL) return;
+
+    TextureStream stream = { .width = load->width, .height = load->height, .format = load->format };
+    unsigned int offset = GetTextureStreamSize(&stream, 0, load->firstLevel - 1);
+
+    for (int i = load->firstLevel; i <= load->lastLevel; i++)
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
+        int mipWidth = ((load->width >> i) > 0)? (load->width >> i) : 1;
+        int mipHeight = ((load->height >> i) > 0)? (load->height >> i) : 1;
+
+        rlUpdateTextureLevel(load->id, i, mipWidth, mipHeight, load->format, (unsigned char *)load->image.data + offset);
+        offset += GetPixelDataSize(mipWidth, mipHeight, load->format);
     }
 
-    if (max > 0.0f)
+    rlSetTextureBaseLevel(load->id, load->firstLevel);
+    load->loaded = true;
+
+    UnloadImage(load->image);
+}
+#endif
+
+#if defined(SUPPORT_VIDEO_TEXTURE)
+// Read video frame at playback position (wrapped if looping)
+// NOTE: Stream is only seeked if position is not the next frame to read
+static bool ReadVideoFrame(VideoDecoder *decoder, int position, unsigned char *planes)
+{
+    int frame = position;
+    if (decoder->looping && (decoder->y4m.frameCount > 0)) frame = position%decoder->y4m.frameCount;
+
+    if ((frame != decoder->y4m.frame) && !rly4m_seek(&decoder->y4m, frame)) return false;
+
+    return rly4m_read(&decoder->y4m, planes);
+}
+
+// Decode requested video frames into queue slots (loader thread)
+// NOTE: Requested slots follow queued frames, main thread only drops queued frames while decoding
+static void DecodeVideoFrames(void *data)
+{
+    VideoDecoder *decoder = (VideoDecoder *)data;
+
+    int slot = decoder->requestSlot;
+    int position = decoder->requestPosition;
+
+    for (int i = 0; i < decoder->requestCount; i++)
     {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
+        if (!ReadVideoFrame(decoder, position, decoder->frames[slot])) break;
+
+        decoder->positions[slot] = position;
+        decoder->decodedCount++;
+
+        slot = (slot + 1)%VIDEO_TEXTURE_QUEUE_FRAMES;
+        position++;
     }
-    else
+}
+
+// Request video frames decoding into free queue slots on async loader thread
+static void RequestVideoFrames(VideoDecoder *decoder)
+{
+    if ((decoder->request >= 0) || decoder->ended || (decoder->count == VIDEO_TEXTURE_QUEUE_FRAMES)) return;
+
+    decoder->requestSlot = (decoder->first + decoder->count)%VIDEO_TEXTURE_QUEUE_FRAMES;
+    decoder->requestPosition = decoder->nextPosition;
+    decoder->requestCount = VIDEO_TEXTURE_QUEUE_FRAMES - decoder->count;
+    decoder->decodedCount = 0;
+    decoder->request = LoadAsync(DecodeVideoFrames, NULL, decoder);
+}
+
+// Retrieve video frames decoding request, decoded frames are queued
+// NOTE: If not waiting, request is only retrieved if already finalized (on BeginDrawing())
+static void RetrieveVideoFrames(VideoDecoder *decoder, bool wait)
+{
+    if (decoder->request < 0) return;
+
+    if (wait) while (!IsAsyncLoadReady(decoder->request)) ProcessAsyncLoads(0.0);
+    else if (!IsAsyncLoadReady(decoder->request)) return;
+
+    GetAsyncLoadData(decoder->request, NULL);
+    decoder->request = -1;
+
+    // NOTE: Queued frames dropped while decoding moved the queue first slot, not the decoded slots
+    decoder->count += decoder->decodedCount;
+    decoder->nextPosition = decoder->requestPosition + decoder->decodedCount;
+    if (decoder->decodedCount < decoder->requestCount) decoder->ended = true;
+}
+
+// Upload video frame planes and convert them into video texture
+// NOTE: Planes are copied into pixel buffers (if supported), frame memory can be reused right away
+static void UploadVideoFrame(VideoDecoder *decoder, const unsigned char *planes)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int width = decoder->y4m.width;
+    int height = decoder->y4m.height;
+    int chromaWidth = decoder->y4m.chromaWidth;
+    int chromaHeight = decoder->y4m.chromaHeight;
+
+    rlUpdateTextureAsync(decoder->planeIds[0], 0, 0, width, height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, planes);
+    rlUpdateTextureAsync(decoder->planeIds[1], 0, 0, chromaWidth, chromaHeight, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, planes + width*height);
+    rlUpdateTextureAsync(decoder->planeIds[2], 0, 0, chromaWidth, chromaHeight, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, planes + width*height + chromaWidth*chromaHeight);
+
+    Texture2D luma = { decoder->planeIds[0], width, height, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+    Texture2D chromaU = { decoder->planeIds[1], chromaWidth, chromaHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+    Texture2D chromaV = { decoder->planeIds[2], chromaWidth, chromaHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+
+    // Luma offset and scale, chroma scale (BT.601 limited range if not full range)
+    Vector3 yuvRange = decoder->y4m.fullRange? (Vector3){ 0.0f, 1.0f, 1.0f } : (Vector3){ 16.0f/255.0f, 255.0f/219.0f, 255.0f/224.0f };
+
+    BeginTextureMode(decoder->target);
+    BeginShaderMode(videoTextureShader);
+
+        SetShaderValueTexture(videoTextureShader, videoTextureLocs[0], chromaU);
+        SetShaderValueTexture(videoTextureShader, videoTextureLocs[1], chromaV);
+        SetShaderValue(videoTextureShader, videoTextureLocs[2], &yuvRange, SHADER_UNIFORM_VEC3);
+
+        // NOTE: Luma plane is drawn flipped to keep video rows order (top row first, as loaded textures)
+        rlDisableColorBlend();
+        DrawTexturePro(luma, (Rectangle){ 0, 0, (float)width, -(float)height },
+            (Rectangle){ 0, 0, (float)width, (float)height }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+        rlDrawRenderBatchActive();
+        rlEnableColorBlend();
+
+    EndShaderMode();
+    EndTextureMode();
+#endif
+}
+#endif
+
+// Scan GIF frames info, frames are not decoded
+// NOTE: Graphic control extension delay and disposal apply to the following image descriptor
+static bool ScanAnimImageGIF(AnimImageDecoder *decoder)
+{
+    const unsigned char *data = decoder->fileData;
+    unsigned int size = decoder->dataSize;
+
+    if ((size < 13) || (memcmp(data, "GIF8", 4) != 0)) return false;
+
+    decoder->width = data[6] | (data[7] << 8);
+    decoder->height = data[8] | (data[9] << 8);
+
+    unsigned int pos = 13;
+    if (data[10] & 0x80) pos += 3*(2 << (data[10] & 7));    // Global color table
+
+    int capacity = 0;
+    int delay = 0;
+
+    while (pos < size)
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
+        unsigned char tag = data[pos++];
+
+        if (tag == 0x3b) break;                 // Trailer
+        else if (tag == 0x21)                   // Extension
+        {
+            if (pos >= size) break;
+            unsigned char label = data[pos++];
+
+            if ((label == 0xf9) && ((pos + 5) <= size) && (data[pos] == 4))
+            {
+                delay = 10*(data[pos + 2] | (data[pos + 3] << 8));          // Delay in 1/100th of a second
+                if (((data[pos + 1] >> 2) & 0x07) == 3) decoder->restorePrevious = true;
+            }
+
+            while ((pos < size) && (data[pos] != 0)) pos += data[pos] + 1;  // Skip sub-blocks
+            pos++;
+        }
+        else if (tag == 0x2c)                   // Image descriptor
+        {
+            if ((pos + 10) > size) break;
+
+            unsigned char flags = data[pos + 8];
+            pos += 9;
+            if (flags & 0x80) pos += 3*(2 << (flags & 7));      // Local color table
+            pos++;                                              // LZW minimum code size
+
+            while ((pos < size) && (data[pos] != 0)) pos += data[pos] + 1;  // Skip image data sub-blocks
+            pos++;
+
+            if (pos > size) break;              // Frame data truncated
+
+            if (decoder->frameCount == capacity)
+            {
+                capacity = (capacity > 0)? capacity*2 : 16;
+                decoder->frames = (AnimImageFrame *)RL_REALLOC(decoder->frames, capacity*sizeof(AnimImageFrame));
+            }
+
+            decoder->frames[decoder->frameCount] = (AnimImageFrame){ .delay = delay, .width = decoder->width, .height = decoder->height };
+            decoder->frameCount++;
+            delay = 0;
+        }
+        else break;                             // Unknown block, data corrupted
     }
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
+    return ((decoder->frameCount > 0) && (decoder->width > 0) && (decoder->height > 0));
+}
+
+// Scan APNG frames info, frames are not decoded
+// NOTE: Default image (IDAT) is only a frame if it is preceded by a frame control chunk (fcTL)
+static bool ScanAnimImageAPNG(AnimImageDecoder *decoder)
+{
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+    const unsigned char *data = decoder->fileData;
+    unsigned int size = decoder->dataSize;
+
+    if ((size < 33) || (memcmp(data, signature, 8) != 0)) return false;
+
+    bool animated = false;
+    int capacity = 0;
+    unsigned int pos = 8;
+
+    // Chunks: [length: 4 bytes][type: 4 bytes][data: length bytes][crc32: 4 bytes], big-endian
+    while ((pos + 12) <= size)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+        unsigned int length = READ_BE32(data + pos);
+        const unsigned char *type = data + pos + 4;
+        const unsigned char *chunk = data + pos + 8;
+
+        if (length > (size - pos - 12)) break;
+
+        if ((memcmp(type, "IHDR", 4) == 0) && (length >= 13))
+        {
+            decoder->width = (int)READ_BE32(chunk);
+            decoder->height = (int)READ_BE32(chunk + 4);
+        }
+        else if (memcmp(type, "acTL", 4) == 0) animated = true;
+        else if (memcmp(type, "PLTE", 4) == 0) decoder->paletteOffset = pos;
+        else if (memcmp(type, "tRNS", 4) == 0) decoder->transparencyOffset = pos;
+        else if ((memcmp(type, "fcTL", 4) == 0) && (length >= 26))
+        {
+            AnimImageFrame frame = { 0 };
+            frame.width = (int)READ_BE32(chunk + 4);
+            frame.height = (int)READ_BE32(chunk + 8);
+            frame.x = (int)READ_BE32(chunk + 12);
+            frame.y = (int)READ_BE32(chunk + 16);
+
+            int delayNum = (chunk[20] << 8) | chunk[21];
+            int delayDen = (chunk[22] << 8) | chunk[23];
+            frame.delay = delayNum*1000/((delayDen > 0)? delayDen : 100);   // Delay in seconds as fraction
+            frame.dispose = chunk[24];
+            frame.blend = chunk[25];
+            frame.offset = pos + 12 + length;
+
+            if ((frame.width <= 0) || (frame.height <= 0) || (frame.x < 0) || (frame.y < 0) ||
+                ((frame.x + frame.width) > decoder->width) || ((frame.y + frame.height) > decoder->height)) break;
+
+            if (decoder->frameCount == capacity)
+            {
+                capacity = (capacity > 0)? capacity*2 : 16;
+                decoder->frames = (AnimImageFrame *)RL_REALLOC(decoder->frames, capacity*sizeof(AnimImageFrame));
+            }
+
+            decoder->frames[decoder->frameCount] = frame;
+            decoder->frameCount++;
+        }
+        else if (memcmp(type, "IEND", 4) == 0) break;
+
+        pos += length + 12;
     }
 
-    hsv.x *= 60.0f;     // Convert to degrees
+    return (animated && (decoder->frameCount > 0) && (decoder->width > 0) && (decoder->height > 0));
+}
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+// Reset animated image decoder to first frame
+static void ResetAnimImageDecoder(AnimImageDecoder *decoder)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (decoder->type == ANIM_IMAGE_GIF)
+    {
+        RL_FREE(decoder->gif.out);
+        RL_FREE(decoder->gif.background);
+        RL_FREE(decoder->gif.history);
+        memset(&decoder->gif, 0, sizeof(stbi__gif));
 
-    return hsv;
+        stbi__start_mem(&decoder->context, decoder->fileData, (int)decoder->dataSize);
+    }
+#endif
+
+    decoder->decodedFrame = -1;
 }
 
-// Get a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
+// Decode and compose next frame on canvas
+// NOTE: GIF frames are composed by stb_image decoder, APNG frames are decoded as standalone PNG images
+// (frame header and data chunks) and blended on canvas after previous frame disposal
+static bool DecodeAnimImageFrame(AnimImageDecoder *decoder)
 {
-    Color color = { 0, 0, 0, 255 };
+    int index = decoder->decodedFrame + 1;
+    if (index >= decoder->frameCount) return false;
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+    int size = decoder->width*decoder->height*4;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (decoder->type == ANIM_IMAGE_GIF)
+    {
+        unsigned char *twoBack = NULL;
+
+        if (decoder->restorePrevious && (index > 0))
+        {
+            // Canvas two frames back required by disposal to previous, previous canvas saved now
+            unsigned char *canvas = decoder->previous;
+            decoder->previous = decoder->saved;
+            decoder->saved = canvas;
+            memcpy(decoder->saved, decoder->gif.out, size);
+
+            if (index > 1) twoBack = decoder->previous;
+        }
+
+        int comp = 0;
+        unsigned char *result = stbi__gif_load_next(&decoder->context, &decoder->gif, &comp, 4, twoBack);
+        if ((result == NULL) || (result == (unsigned char *)&decoder->context)) return false;  // Error or end of GIF
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (decoder->type == ANIM_IMAGE_APNG)
+    {
+        const AnimImageFrame *frame = &decoder->frames[index];
+        const unsigned char *data = decoder->fileData;
+        int stride = decoder->width*4;
+
+        if (index == 0) memset(decoder->canvas, 0, size);
+        else
+        {
+            // Previous frame region disposal, disposal to previous on first frame clears region
+            const AnimImageFrame *last = &decoder->frames[index - 1];
+            int dispose = ((last->dispose == 2) && (index == 1))? 1 : last->dispose;
+
+            for (int y = last->y; (dispose != 0) && (y < (last->y + last->height)); y++)
+            {
+                unsigned char *row = decoder->canvas + y*stride + last->x*4;
+
+                if (dispose == 1) memset(row, 0, last->width*4);
+                else memcpy(row, decoder->previous + y*stride + last->x*4, last->width*4);
+            }
+        }
+
+        if (frame->dispose == 2)
+        {
+            for (int y = frame->y; y < (frame->y + frame->height); y++) memcpy(decoder->previous + y*stride + frame->x*4, decoder->canvas + y*stride + frame->x*4, frame->width*4);
+        }
+
+        // Frame data chunks, until next frame control or end chunk
+        unsigned int dataSize = 0;
+        unsigned int pos = frame->offset;
+
+        while ((pos + 12) <= decoder->dataSize)
+        {
+            unsigned int length = READ_BE32(data + pos);
+            if ((length > (decoder->dataSize - pos - 12)) || (memcmp(data + pos + 4, "fcTL", 4) == 0) || (memcmp(data + pos + 4, "IEND", 4) == 0)) break;
+
+            if (memcmp(data + pos + 4, "IDAT", 4) == 0) dataSize += length;
+            else if ((memcmp(data + pos + 4, "fdAT", 4) == 0) && (length >= 4)) dataSize += length - 4;
+
+            pos += length + 12;
+        }
+
+        // Standalone PNG: signature, IHDR (frame size), PLTE, tRNS, IDAT (frame data), IEND
+        // NOTE: Chunks CRC are not checked by stb_image, they are not computed
+        unsigned int paletteSize = (decoder->paletteOffset > 0)? READ_BE32(data + decoder->paletteOffset) + 12 : 0;
+        unsigned int transparencySize = (decoder->transparencyOffset > 0)? READ_BE32(data + decoder->transparencyOffset) + 12 : 0;
+        unsigned int pngSize = 8 + 25 + paletteSize + transparencySize + 12 + dataSize + 12;
+        unsigned char *png = (unsigned char *)RL_MALLOC(pngSize);
+        unsigned char *ptr = png;
+
+        memcpy(ptr, data, 33);      // Signature and IHDR chunk
+        ptr[16] = (unsigned char)(frame->width >> 24); ptr[17] = (unsigned char)(frame->width >> 16); ptr[18] = (unsigned char)(frame->width >> 8); ptr[19] = (unsigned char)frame->width;
+        ptr[20] = (unsigned char)(frame->height >> 24); ptr[21] = (unsigned char)(frame->height >> 16); ptr[22] = (unsigned char)(frame->height >> 8); ptr[23] = (unsigned char)frame->height;
+        ptr += 33;
+
+        if (paletteSize > 0) { memcpy(ptr, data + decoder->paletteOffset, paletteSize); ptr += paletteSize; }
+        if (transparencySize > 0) { memcpy(ptr, data + decoder->transparencyOffset, transparencySize); ptr += transparencySize; }
+
+        ptr[0] = (unsigned char)(dataSize >> 24); ptr[1] = (unsigned char)(dataSize >> 16); ptr[2] = (unsigned char)(dataSize >> 8); ptr[3] = (unsigned char)dataSize;
+        memcpy(ptr + 4, "IDAT", 4);
+        ptr += 8;
+
+        pos = frame->offset;
+
+        while ((pos + 12) <= decoder->dataSize)
+        {
+            unsigned int length = READ_BE32(data + pos);
+            if ((length > (decoder->dataSize - pos - 12)) || (memcmp(data + pos + 4, "fcTL", 4) == 0) || (memcmp(data + pos + 4, "IEND", 4) == 0)) break;
+
+            if (memcmp(data + pos + 4, "IDAT", 4) == 0) { memcpy(ptr, data + pos + 8, length); ptr += length; }
+            else if ((memcmp(data + pos + 4, "fdAT", 4) == 0) && (length >= 4)) { memcpy(ptr, data + pos + 12, length - 4); ptr += length - 4; }   // Sequence number skipped
+
+            pos += length + 12;
+        }
+
+        memset(ptr, 0, 4);          // IDAT CRC
+        memcpy(ptr + 4, "\0\0\0\0IEND\0\0\0\0", 12);
+        ptr += 16;
+
+        int width = 0;
+        int height = 0;
+        int comp = 0;
+        unsigned char *pixels = stbi_load_from_memory(png, (int)(ptr - png), &width, &height, &comp, 4);
+        RL_FREE(png);
+
+        if ((pixels == NULL) || (width != frame->width) || (height != frame->height))
+        {
+            RL_FREE(pixels);
+            return false;
+        }
+
+        // Frame region blending on canvas (non premultiplied alpha)
+        for (int y = 0; y < frame->height; y++)
+        {
+            const unsigned char *src = pixels + y*frame->width*4;
+            unsigned char *dst = decoder->canvas + (frame->y + y)*stride + frame->x*4;
+
+            if (frame->blend == 0) memcpy(dst, src, frame->width*4);
+            else
+            {
+                for (int x = 0; x < frame->width; x++, src += 4, dst += 4)
+                {
+                    if (src[3] == 255) memcpy(dst, src, 4);
+                    else if (src[3] > 0)
+                    {
+                        int dstAlpha = dst[3]*(255 - src[3])/255;
+                        int alpha = src[3] + dstAlpha;
+
+                        for (int c = 0; c < 3; c++) dst[c] = (unsigned char)((src[c]*src[3] + dst[c]*dstAlpha)/alpha);
+                        dst[3] = (unsigned char)alpha;
+                    }
+                }
+            }
+        }
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+        RL_FREE(pixels);
+    }
+#endif
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+    decoder->decodedFrame = index;
 
-    return color;
+    return true;
 }
 
-// Get color multiplied with another color
-Color ColorTint(Color color, Color tint)
+// Load animated image frame pixels, decoding from first frame if required
+static bool LoadAnimImageFrame(AnimImageDecoder *decoder, int frame, unsigned char *pixels)
 {
-    Color result = color;
-
-    float cR = (float)tint.r/255;
-    float cG = (float)tint.g/255;
-    float cB = (float)tint.b/255;
-    float cA = (float)tint.a/255;
+    if (frame <= decoder->decodedFrame) ResetAnimImageDecoder(decoder);
 
-    unsigned char r = (unsigned char)(((float)color.r/255*cR)*255.0f);
-    unsigned char g = (unsigned char)(((float)color.g/255*cG)*255.0f);
-    unsigned char b = (unsigned char)(((float)color.b/255*cB)*255.0f);
-    unsigned char a = (unsigned char)(((float)color.a/255*cA)*255.0f);
+    while (decoder->decodedFrame < frame)
+    {
+        if (!DecodeAnimImageFrame(decoder))
+        {
+            ResetAnimImageDecoder(decoder);
+            return false;
+        }
+    }
 
-    result.r = r;
-    result.g = g;
-    result.b = b;
-    result.a = a;
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (decoder->type == ANIM_IMAGE_GIF) memcpy(pixels, decoder->gif.out, decoder->width*decoder->height*4);
+#endif
+    if (decoder->type == ANIM_IMAGE_APNG) memcpy(pixels, decoder->canvas, decoder->width*decoder->height*4);
 
-    return result;
+    return true;
 }
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-Color ColorBrightness(Color color, float factor)
+// Wait for animated image prefetch request to be decoded
+static void WaitAnimImagePrefetch(AnimImageDecoder *decoder)
 {
-    Color result = color;
+    if (decoder->request < 0) return;
 
-    if (factor > 1.0f) factor = 1.0f;
-    else if (factor < -1.0f) factor = -1.0f;
+    while (!IsAsyncLoadReady(decoder->request)) ProcessAsyncLoads(0.0);
 
-    float red = (float)color.r;
-    float green = (float)color.g;
-    float blue = (float)color.b;
+    GetAsyncLoadData(decoder->request, NULL);
+    decoder->request = -1;
+}
 
-    if (factor < 0.0f)
-    {
-        factor = 1.0f + factor;
-        red *= factor;
-        green *= factor;
-        blue *= factor;
-    }
-    else
-    {
-        red = (255 - red)*factor + red;
-        green = (255 - green)*factor + green;
-        blue = (255 - blue)*factor + blue;
-    }
+// Request animated image frame decoding on async loader thread
+// NOTE: Decoder is only accessed by loader thread until request is retrieved (WaitAnimImagePrefetch())
+static void RequestAnimImagePrefetch(AnimImageDecoder *decoder, int frame)
+{
+    decoder->prefetchFrame = frame;
+    decoder->nextFrame = -1;
+    decoder->request = LoadAsync(DecodeAnimImagePrefetch, NULL, decoder);
+}
 
-    result.r = (unsigned char)red;
-    result.g = (unsigned char)green;
-    result.b = (unsigned char)blue;
+// Decode animated image prefetched frame (loader thread)
+static void DecodeAnimImagePrefetch(void *data)
+{
+    AnimImageDecoder *decoder = (AnimImageDecoder *)data;
 
-    return result;
+    if (LoadAnimImageFrame(decoder, decoder->prefetchFrame, decoder->next)) decoder->nextFrame = decoder->prefetchFrame;
 }
 
-// Get color with contrast correction
-// NOTE: Contrast values between -1.0f and 1.0f
-Color ColorContrast(Color color, float contrast)
+// Apply filter pass to render texture color
+// NOTE: Color texture is drawn into filter framebuffer, then color textures are swapped between framebuffers,
+// render texture framebuffer id (and depth attachment) is kept
+static void ApplyTextureFilter(RenderTexture2D *target, int mode, Vector4 params0, Vector4 params1)
 {
-    Color result = color;
+    if ((target == NULL) || (target->id == 0)) return;
 
-    if (contrast < -1.0f) contrast = -1.0f;
-    else if (contrast > 1.0f) contrast = 1.0f;
-
-    contrast = (1.0f + contrast);
-    contrast *= contrast;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!LoadShaderTextureFilter()) return;
 
-    float pR = (float)color.r/255.0f;
-    pR -= 0.5f;
-    pR *= contrast;
-    pR += 0.5f;
-    pR *= 255;
-    if (pR < 0) pR = 0;
-    else if (pR > 255) pR = 255;
+    int width = target->texture.width;
+    int height = target->texture.height;
 
-    float pG = (float)color.g/255.0f;
-    pG -= 0.5f;
-    pG *= contrast;
-    pG += 0.5f;
-    pG *= 255;
-    if (pG < 0) pG = 0;
-    else if (pG > 255) pG = 255;
+    if ((textureFilterTarget.texture.width != width) || (textureFilterTarget.texture.height != height))
+    {
+        if (textureFilterTarget.id > 0) UnloadRenderTexture(textureFilterTarget);
+        textureFilterTarget = LoadTextureFilterTarget(width, height);
+        if (textureFilterTarget.id == 0) return;
+    }
 
-    float pB = (float)color.b/255.0f;
-    pB -= 0.5f;
-    pB *= contrast;
-    pB += 0.5f;
-    pB *= 255;
-    if (pB < 0) pB = 0;
-    else if (pB > 255) pB = 255;
+    DrawTextureFilter(target->texture, textureFilterTarget, mode, params0, params1);
 
-    result.r = (unsigned char)pR;
-    result.g = (unsigned char)pG;
-    result.b = (unsigned char)pB;
+    unsigned int textureId = target->texture.id;
+    target->texture.id = textureFilterTarget.texture.id;
+    textureFilterTarget.texture.id = textureId;
 
-    return result;
+    rlFramebufferAttach(target->id, target->texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(textureFilterTarget.id, textureFilterTarget.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Texture filters require OpenGL 2.1 or higher");
+#endif
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load cubemap faces pass shader
+// NOTE: Vertex shader outputs cube local position (fragPosition), drawn by DrawTextureCubemapFaces()
+static Shader LoadShaderCubemapPass(const char *fsCode)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    const char *cubemapVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "varying vec3 fragPosition;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "out vec3 fragPosition;             \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "varying vec3 fragPosition;         \n"
+#endif
+    "uniform mat4 matProjection;        \n"
+    "uniform mat4 matView;              \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragPosition = vertexPosition; \n"
+    "    gl_Position = matProjection*matView*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(cubemapVShaderCode, fsCode);
+
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load cubemap pass shader");
+        shader = (Shader){ 0 };
+    }
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+    return shader;
 }
 
-// Get src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
+// Draw cube with shader into cubemap faces mipmap level
+// NOTE: Cube is drawn from inside with a 90 degrees view for every face, source texture is bound by caller
+// after drawing pending render batch (batch drawing unbinds textures)
+static void DrawTextureCubemapFaces(Shader shader, unsigned int cubemapId, int size, int mipLevel)
 {
-    Color out = WHITE;
+    // Views targets and up vectors for every cubemap face: +X, -X, +Y, -Y, +Z, -Z
+    static const Vector3 faceTargets[6] = { { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f } };
+    static const Vector3 faceUps[6] = { { 0.0f, -1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } };
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+    unsigned int fbo = rlLoadFramebuffer(size, size);
+    if (fbo == 0) return;
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
-    {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+    rlEnableShader(shader.id);
+    rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_PROJECTION], MatrixPerspective(90.0*DEG2RAD, 1.0, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR));
+    rlDisableBackfaceCulling();
+    rlViewport(0, 0, size, size);
 
-        if (out.a > 0)
-        {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-        }
-    }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+    for (int i = 0; i < 6; i++)
     {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
-
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+        rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_VIEW], MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, faceTargets[i], faceUps[i]));
 
-        if (fout.w > 0.0f)
-        {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
-        }
+        // NOTE: Framebuffer attachment unbinds the framebuffer
+        rlFramebufferAttach(fbo, cubemapId, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_CUBEMAP_POSITIVE_X + i, mipLevel);
+        rlEnableFramebuffer(fbo);
 
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+        rlClearScreenBuffers();
+        rlLoadDrawCube();
     }
-#endif
 
-    return out;
+    rlDisableFramebuffer();
+    rlUnloadFramebuffer(fbo);
+    rlDisableShader();
+
+    rlEnableBackfaceCulling();
+    rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
 }
+#endif
 
-// Get a Color struct from hexadecimal value
-Color GetColor(unsigned int hexValue)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load textures filters shader
+// NOTE: One shader for all filters, selected by filterMode uniform: 0-tint, 1-invert, 2-grayscale,
+// 3-contrast, 4-brightness, 5-replace, 6-alpha premultiply, 7-dither
+static bool LoadShaderTextureFilter(void)
 {
-    Color color;
+    if ((textureFilterShader.id > 0) || textureFilterShaderFailed) return (textureFilterShader.id > 0);
+
+    textureFilterShaderFailed = true;
+
+    const char *filterFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "#define TEXTURE texture            \n"
+    "#define FRAG_COLOR finalColor      \n"
+    "in vec2 fragTexCoord;              \n"
+    "out vec4 finalColor;               \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH  \n"
+    "precision highp float;             \n"
+    "#else                              \n"
+    "precision mediump float;           \n"
+    "#endif                             \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec2 fragTexCoord;         \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform float filterMode;          \n"
+    "uniform vec4 filterParams0;        \n"
+    "uniform vec4 filterParams1;        \n"
+    "float Bayer2(vec2 a)               \n"
+    "{                                  \n"
+    "    a = floor(a);                  \n"
+    "    return fract(dot(a, vec2(0.5, a.y*0.75))); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 color = TEXTURE(texture0, fragTexCoord); \n"
+    "    if (filterMode < 0.5) color *= filterParams0; \n"
+    "    else if (filterMode < 1.5) color.rgb = vec3(1.0) - color.rgb; \n"
+    "    else if (filterMode < 2.5) color = vec4(vec3(dot(color.rgb, vec3(0.299, 0.587, 0.114))), 1.0); \n"
+    "    else if (filterMode < 3.5) color.rgb = clamp((color.rgb - 0.5)*filterParams0.x + 0.5, 0.0, 1.0); \n"
+    "    else if (filterMode < 4.5) color.rgb = clamp(color.rgb + filterParams0.x, 0.0, 1.0); \n"
+    "    else if (filterMode < 5.5) { if (all(lessThan(abs(color - filterParams0), vec4(0.5/255.0)))) color = filterParams1; } \n"
+    "    else if (filterMode < 6.5) color.rgb *= color.a; \n"
+    "    else                           \n"
+    "    {                              \n"
+    "        float threshold = Bayer2(gl_FragCoord.xy*0.5)*0.25 + Bayer2(gl_FragCoord.xy); \n"
+    "        color = floor(color*filterParams0 + threshold)/max(filterParams0, vec4(1.0)); \n"
+    "        if (filterParams0.a < 0.5) color.a = 1.0; \n"
+    "    }                              \n"
+    "    FRAG_COLOR = color;            \n"
+    "}                                  \n";
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(NULL, filterFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
+
+    textureFilterLocs[0] = rlGetLocationUniform(shader.id, "filterMode");
+    textureFilterLocs[1] = rlGetLocationUniform(shader.id, "filterParams0");
+    textureFilterLocs[2] = rlGetLocationUniform(shader.id, "filterParams1");
+
+    if ((textureFilterLocs[0] == -1) || (textureFilterLocs[1] == -1) || (textureFilterLocs[2] == -1))
+    {
+        UnloadShader(shader);
+        return false;
+    }
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
-    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
-    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
-    color.a = (unsigned char)hexValue & 0xFF;
+    textureFilterShader = shader;
+    textureFilterShaderFailed = false;
 
-    return color;
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Texture filters shader loaded successfully", textureFilterShader.id);
+
+    return true;
 }
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
+// Load framebuffer with color texture only
+// NOTE: Filter passes do not require depth, saves a depth renderbuffer the size of the image
+static RenderTexture2D LoadTextureFilterTarget(int width, int height)
 {
-    Color color = { 0 };
+    RenderTexture2D target = { 0 };
 
-    switch (format)
+    target.id = rlLoadFramebuffer(width, height);
+
+    if (target.id > 0)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
+        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        if (!rlFramebufferComplete(target.id))
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+            UnloadRenderTexture(target);
+            target = (RenderTexture2D){ 0 };
+        }
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+    if (target.id == 0) TRACELOG(LOG_WARNING, "FBO: Texture filter framebuffer can not be created");
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+    return target;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+// Draw texture into render texture with filter pass
+// NOTE: Blending is disabled for the pass, source is drawn flipped to keep texture rows order
+static void DrawTextureFilter(Texture2D source, RenderTexture2D target, int mode, Vector4 params0, Vector4 params1)
+{
+    float filterMode = (float)mode;
 
-        } break;
-        default: break;
+    BeginTextureMode(target);
+    BeginShaderMode(textureFilterShader);
+
+        SetShaderValue(textureFilterShader, textureFilterLocs[0], &filterMode, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(textureFilterShader, textureFilterLocs[1], &params0, SHADER_UNIFORM_VEC4);
+        SetShaderValue(textureFilterShader, textureFilterLocs[2], &params1, SHADER_UNIFORM_VEC4);
+
+        rlDisableColorBlend();
+        DrawTexturePro(source, (Rectangle){ 0, 0, (float)source.width, -(float)source.height },
+            (Rectangle){ 0, 0, (float)target.texture.width, (float)target.texture.height }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+        rlDrawRenderBatchActive();
+        rlEnableColorBlend();
+
+    EndShaderMode();
+    EndTextureMode();
+}
+#endif
+
+#if defined(SUPPORT_VIDEO_TEXTURE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Load video textures YUV to RGB conversion shader
+// NOTE: Planes are single channel textures: texture0 (Y), texture1 (U) and texture2 (V), BT.601 conversion
+static bool LoadShaderVideoTexture(void)
+{
+    if ((videoTextureShader.id > 0) || videoTextureShaderFailed) return (videoTextureShader.id > 0);
+
+    videoTextureShaderFailed = true;
+
+    const char *videoFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "#define TEXTURE texture            \n"
+    "#define FRAG_COLOR finalColor      \n"
+    "in vec2 fragTexCoord;              \n"
+    "out vec4 finalColor;               \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FRAG_COLOR gl_FragColor    \n"
+    "varying vec2 fragTexCoord;         \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform vec3 yuvRange;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float y = (TEXTURE(texture0, fragTexCoord).r - yuvRange.x)*yuvRange.y; \n"
+    "    float u = (TEXTURE(texture1, fragTexCoord).r - 128.0/255.0)*yuvRange.z; \n"
+    "    float v = (TEXTURE(texture2, fragTexCoord).r - 128.0/255.0)*yuvRange.z; \n"
+    "    vec3 rgb = vec3(y + 1.402*v, y - 0.344136*u - 0.714136*v, y + 1.772*u); \n"
+    "    FRAG_COLOR = vec4(clamp(rgb, 0.0, 1.0), 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Failed shader compilation returns default shader
+    Shader shader = LoadShaderFromMemory(NULL, videoFShaderCode);
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) return false;
+
+    videoTextureLocs[0] = rlGetLocationUniform(shader.id, "texture1");
+    videoTextureLocs[1] = rlGetLocationUniform(shader.id, "texture2");
+    videoTextureLocs[2] = rlGetLocationUniform(shader.id, "yuvRange");
+
+    if ((videoTextureLocs[0] == -1) || (videoTextureLocs[1] == -1) || (videoTextureLocs[2] == -1))
+    {
+        UnloadShader(shader);
+        return false;
     }
 
-    return color;
+    videoTextureShader = shader;
+    videoTextureShaderFailed = false;
+
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Video textures shader loaded successfully", videoTextureShader.id);
+
+    return true;
 }
+#endif
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
+// Unload textures filters shaders and framebuffer
+// NOTE: Video textures conversion shader is also unloaded, video textures must be unloaded before
+void UnloadTextureFilterDefault(void)
 {
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (textureFilterShader.id > 0) UnloadShader(textureFilterShader);
+    if (textureFilterTarget.id > 0) UnloadRenderTexture(textureFilterTarget);
 
-            ((unsigned char *)dstPtr)[0] = gray;
+    textureFilterShader = (Shader){ 0 };
+    textureFilterTarget = (RenderTexture2D){ 0 };
+    textureFilterShaderFailed = false;
+#endif
+#if defined(SUPPORT_VIDEO_TEXTURE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (videoTextureShader.id > 0) UnloadShader(videoTextureShader);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    videoTextureShader = (Shader){ 0 };
+    videoTextureShaderFailed = false;
+#endif
+}
 
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+// Load layers pixel data one after the other, converted to first image format
+// NOTE: Returns NULL if layers sizes do not match or format is compressed
+static unsigned char *LoadTextureLayersData(const Image *layers, int layerCount)
+{
+    if ((layers == NULL) || (layerCount <= 0) || (layers[0].data == NULL)) return NULL;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    int width = layers[0].width;
+    int height = layers[0].height;
+    int format = layers[0].format;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Texture layers compressed formats not supported");
+        return NULL;
+    }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    for (int i = 1; i < layerCount; i++)
+    {
+        if ((layers[i].data == NULL) || (layers[i].width != width) || (layers[i].height != height) || (layers[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Texture layer [%i] not valid (all layers must be uncompressed, same size)", i);
+            return NULL;
+        }
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+    int layerSize = GetPixelDataSize(width, height, format);
+    unsigned char *data = (unsigned char *)RL_MALLOC((size_t)layerSize*layerCount);
+
+    for (int i = 0; i < layerCount; i++)
+    {
+        if (layers[i].format == format) memcpy(data + (size_t)i*layerSize, layers[i].data, layerSize);
+        else
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            // NOTE: Only base level is converted (mipmaps generated on GPU)
+            Image layer = { layers[i].data, width, height, 1, layers[i].format };
+            Image converted = ImageCopy(layer);
+            ImageFormat(&converted, format);
+            memcpy(data + (size_t)i*layerSize, converted.data, layerSize);
+            UnloadImage(converted);
+        }
+    }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    return data;
+}
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+// Unload pooled render textures released some frames ago, called on BeginDrawing()
+void UpdateRenderTexturePool(void)
+{
+    renderTexturePool.frame++;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    for (int i = renderTexturePool.count - 1; i >= 0; i--)
+    {
+        const RenderTexturePoolEntry *entry = &renderTexturePool.entries[i];
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+        // NOTE: Unloaded render texture is removed from pool, last entry moved to its place (already checked)
+        if (!entry->acquired && ((renderTexturePool.frame - entry->frame) > RENDER_TEXTURE_POOL_FRAMES)) UnloadRenderTexture(entry->target);
+    }
+}
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+// Unload all pooled render textures, called on CloseWindow()
+void UnloadRenderTexturePool(void)
+{
+    // NOTE: Unloaded render textures are removed from pool
+    while (renderTexturePool.count > 0) UnloadRenderTexture(renderTexturePool.entries[renderTexturePool.count - 1].target);
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+// Resolve multisample render texture and invalidate transient attachments, called on EndTextureMode()
+// NOTE: Render texture framebuffer must be bound, multisample color is blitted to resolve texture and multisample
+// attachments are invalidated after resolve, pooled render textures depth is invalidated
+void ResolveRenderTexture(unsigned int id)
+{
+    if (id == 0) return;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+    for (int i = 0; i < renderTextureMultisample.count; i++)
+    {
+        const RenderTextureMultisample *msaa = &renderTextureMultisample.entries[i];
+
+        if (msaa->id == id)
         {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+            rlBindFramebuffer(RL_READ_FRAMEBUFFER, msaa->id);
+            rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, msaa->resolveId);
+            rlBlitFramebuffer(0, 0, msaa->width, msaa->height, 0, 0, msaa->width, msaa->height, RL_COLOR_BUFFER_BIT);
 
-        } break;
-        default: break;
+            rlEnableFramebuffer(msaa->id);
+            rlInvalidateFramebuffer(RL_COLOR_BUFFER_BIT | RL_DEPTH_BUFFER_BIT);
+            return;
+        }
+    }
+
+    for (int i = 0; i < renderTexturePool.count; i++)
+    {
+        if (renderTexturePool.entries[i].target.id == id)
+        {
+            if (renderTexturePool.entries[i].depth) rlInvalidateFramebuffer(RL_DEPTH_BUFFER_BIT);
+            break;
+        }
     }
 }
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
+// Load tiled image with empty tiles cache
+static TiledImage LoadTiledImageContext(int width, int height, int format, int tileSize)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    TiledImage image = { 0 };
 
-    switch (format)
+    if ((width <= 0) || (height <= 0) || (tileSize <= 0))
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        TRACELOG(LOG_WARNING, "IMAGE: Tiled image size not valid (%ix%i, tile size %i)", width, height, tileSize);
+        return image;
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
-
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        TRACELOG(LOG_WARNING, "IMAGE: Tiled images do not support compressed formats");
+        return image;
     }
 
-    return dataSize;
-}
+    TiledImageContext *context = (TiledImageContext *)RL_CALLOC(1, sizeof(TiledImageContext));
+    context->width = width;
+    context->height = height;
+    context->format = format;
+    context->tileSize = tileSize;
+    context->tilesX = (width + tileSize - 1)/tileSize;
+    context->tilesY = (height + tileSize - 1)/tileSize;
+    context->bytesPerPixel = GetPixelDataSize(1, 1, format);
+    context->tiles = (TiledImageTile *)RL_CALLOC((size_t)context->tilesX*context->tilesY, sizeof(TiledImageTile));
+    context->first = -1;
+    context->last = -1;
+    context->budget = TILED_IMAGE_DEFAULT_BUDGET;
+    context->refCount = 1;
+
+    TiledImageView *view = (TiledImageView *)RL_CALLOC(1, sizeof(TiledImageView));
+    view->context = context;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
-{
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    image.width = width;
+    image.height = height;
+    image.format = format;
+    image.tileSize = tileSize;
+    image.ctxData = view;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+    return image;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+// Get tiled image pixel data at (x, y) in its tile
+// NOTE: Tile is loaded if required and becomes most recently used, returned pointer is valid until next tile is loaded
+static const unsigned char *GetTiledImagePixels(TiledImage image, int x, int y, int *count)
+{
+    const TiledImageView *view = (const TiledImageView *)image.ctxData;
+    TiledImageContext *context = view->context;
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    x += view->x;
+    y += view->y;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+    int tx = x/context->tileSize;
+    int ty = y/context->tileSize;
+    int index = ty*context->tilesX + tx;
+    TiledImageTile *tile = &context->tiles[index];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    if (tile->data == NULL) LoadTiledImageTile(context, index);
+    else if (context->first != index)
+    {
+        // Move tile to most recently used
+        context->tiles[tile->prev].next = tile->next;
+        if (tile->next >= 0) context->tiles[tile->next].prev = tile->prev;
+        else context->last = tile->prev;
+
+        tile->prev = -1;
+        tile->next = context->first;
+        context->tiles[context->first].prev = index;
+        context->first = index;
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+    int tileWidth = ((context->width - tx*context->tileSize) < context->tileSize)? (context->width - tx*context->tileSize) : context->tileSize;
+    int localX = x - tx*context->tileSize;
+    int localY = y - ty*context->tileSize;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    // Pixels up to tile row end, clipped to view width
+    *count = tileWidth - localX;
+    if ((x - view->x + *count) > image.width) *count = image.width - (x - view->x);
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    return tile->data + ((size_t)localY*tileWidth + localX)*context->bytesPerPixel;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+// Load tile into cache
+// NOTE: Tiles not available (file read failed, callback image not valid) are loaded as zeros
+static void LoadTiledImageTile(TiledImageContext *context, int index)
+{
+    int tx = index%context->tilesX;
+    int ty = index/context->tilesX;
+    int tileWidth = ((context->width - tx*context->tileSize) < context->tileSize)? (context->width - tx*context->tileSize) : context->tileSize;
+    int tileHeight = ((context->height - ty*context->tileSize) < context->tileSize)? (context->height - ty*context->tileSize) : context->tileSize;
+    unsigned int size = (unsigned int)tileWidth*tileHeight*context->bytesPerPixel;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+    while (((context->memory + size) > context->budget) && (context->last >= 0)) UnloadTiledImageTile(context, context->last);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+    TiledImageTile *tile = &context->tiles[index];
+    tile->data = (unsigned char *)RL_CALLOC(size, 1);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    if (context->file != NULL)
+    {
+        size_t rowSize = (size_t)tileWidth*context->bytesPerPixel;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+        for (int j = 0; j < tileHeight; j++)
+        {
+            long long offset = context->headerSize + ((long long)(ty*context->tileSize + j)*context->width + tx*context->tileSize)*context->bytesPerPixel;
 
-                    k += 4;
-                }
-                default: break;
+            if ((FSEEK64(context->file, offset) != 0) || (fread(tile->data + j*rowSize, 1, rowSize, context->file) != rowSize))
+            {
+                TRACELOG(LOG_WARNING, "IMAGE: Tiled image tile [%i, %i] could not be read from file", tx, ty);
+                break;
             }
         }
     }
+    else
+    {
+        Image pixels = context->callback((Rectangle){ (float)(tx*context->tileSize), (float)(ty*context->tileSize), (float)tileWidth, (float)tileHeight }, context->userData);
+
+        if ((pixels.data != NULL) && (pixels.width == tileWidth) && (pixels.height == tileHeight) && (pixels.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            if (pixels.format != context->format) ImageFormat(&pixels, context->format);
+            memcpy(tile->data, pixels.data, size);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Tiled image tile [%i, %i] callback image not valid", tx, ty);
+
+        UnloadImage(pixels);
+    }
 
-    return pixels;
+    tile->prev = -1;
+    tile->next = context->first;
+    if (context->first >= 0) context->tiles[context->first].prev = index;
+    else context->last = index;
+
+    context->first = index;
+    context->memory += size;
+}
+
+// Unload tile from cache
+static void UnloadTiledImageTile(TiledImageContext *context, int index)
+{
+    TiledImageTile *tile = &context->tiles[index];
+
+    int tx = index%context->tilesX;
+    int ty = index/context->tilesX;
+    int tileWidth = ((context->width - tx*context->tileSize) < context->tileSize)? (context->width - tx*context->tileSize) : context->tileSize;
+    int tileHeight = ((context->height - ty*context->tileSize) < context->tileSize)? (context->height - ty*context->tileSize) : context->tileSize;
+
+    if (tile->prev >= 0) context->tiles[tile->prev].next = tile->next;
+    else context->first = tile->next;
+
+    if (tile->next >= 0) context->tiles[tile->next].prev = tile->prev;
+    else context->last = tile->prev;
+
+    RL_FREE(tile->data);
+    *tile = (TiledImageTile){ NULL, -1, -1 };
+
+    context->memory -= (unsigned int)tileWidth*tileHeight*context->bytesPerPixel;
 }
 
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -8,6 +8,31 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_PACK_FILES
+*       Pack files (.rpak) mounting, an indexed archive of (optionally DEFLATE compressed) files,
+*       file paths are resolved through mounted packs first, files are found by hash with binary search
+*
+*   #define SUPPORT_MEMORY_TRACKING
+*       Memory allocations tracking, allocations are tagged by module (MemoryModule) and stats are
+*       available with GetMemoryStats(), unfreed memory blocks are logged on CloseWindow()
+*       NOTE: Every allocation stores a tracking header, intended for development builds
+*
+*   #define SUPPORT_JOB_SYSTEM
+*       Jobs system, small work-stealing thread pool used by modules to process data in parallel
+*       NOTE: Not available on PLATFORM_WEB without pthreads support (jobs processed serially)
+*       NOTE: Async loads are decoded by a loader thread, without jobs system they are decoded on main thread
+*
+*   NOTE: All modules (and bundled external libraries) allocate memory with RL_MALLOC/RL_REALLOC/RL_FREE,
+*   mapped by default to MemAlloc()/MemRealloc()/MemFree(), redirected at runtime with SetMemoryAllocator()
+*
+*   #define MAX_FRAME_MEMORY_SIZE
+*       Frame memory (linear scratch arena) size, used to return text functions results: TextFormat(), TextJoin()...
+*       NOTE: Frame memory is reset by EndDrawing(), results are valid during the whole frame
+*       WARNING: Frame memory is not thread-safe, it must be used from main thread only
+*
+*   #define MAX_TEXT_BUFFER_LENGTH
+*       Maximum length of formatted text results (TextFormat()), longer results are truncated
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -30,6 +55,20 @@
 *
 **********************************************************************************************/
 
+// Default memory allocator, compile-time custom allocators are used if all are defined
+// NOTE: raylib.h maps RL_MALLOC/RL_REALLOC/RL_FREE to MemAlloc()/MemRealloc()/MemFree() if not defined
+#if defined(RL_MALLOC) && defined(RL_CALLOC) && defined(RL_REALLOC) && defined(RL_FREE)
+    #define MEM_DEFAULT_MALLOC(sz)      RL_MALLOC(sz)
+    #define MEM_DEFAULT_CALLOC(n,sz)    RL_CALLOC(n,sz)
+    #define MEM_DEFAULT_REALLOC(ptr,sz) RL_REALLOC(ptr,sz)
+    #define MEM_DEFAULT_FREE(ptr)       RL_FREE(ptr)
+#else
+    #define MEM_DEFAULT_MALLOC(sz)      malloc(sz)
+    #define MEM_DEFAULT_CALLOC(n,sz)    calloc(n,sz)
+    #define MEM_DEFAULT_REALLOC(ptr,sz) realloc(ptr,sz)
+    #define MEM_DEFAULT_FREE(ptr)       free(ptr)
+#endif
+
 #include "raylib.h"                     // WARNING: Required for: LogType enum
 
 // Check if config flags have been externally provided on compilation line
@@ -45,10 +84,94 @@
     #include <android/asset_manager.h>  // Required for: Android assets manager: AAsset, AAssetManager_open(), ...
 #endif
 
-#include <stdlib.h>                     // Required for: exit()
+#include <stdlib.h>                     // Required for: exit(), malloc(), calloc(), realloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
+#include <limits.h>                     // Required for: UINT_MAX
+
+#if defined(SUPPORT_JOB_SYSTEM) && (!defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define JOB_SYSTEM_AVAILABLE
+#endif
+
+// Memory tracking requires default memory allocators (RL_MALLOC... mapped to MemAlloc()...)
+#if defined(SUPPORT_MEMORY_TRACKING) && defined(RL_MEMORY_DEFAULT)
+    #define MEMORY_TRACKING_AVAILABLE
+#endif
+
+// Memory mapped files, LoadFileDataMapped() falls back to LoadFileData() if not available
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB) && \
+    (defined(_WIN32) || defined(__unix__) || defined(__APPLE__))
+    #define FILE_MAPPING_AVAILABLE
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    #if defined(_WIN32)
+        // NOTE: We declare required Win32 functions to avoid including windows.h
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *attributes, unsigned long disposition, unsigned long flags, void *templateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    #else
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+    #endif
+#endif
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+    #if defined(_WIN32)
+        // NOTE: We declare required Win32 functions to avoid including windows.h
+        // SRWLOCK and CONDITION_VARIABLE are pointer size opaque types
+        __declspec(dllimport) void __stdcall InitializeSRWLock(void **lock);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+        __declspec(dllimport) unsigned char __stdcall TryAcquireSRWLockExclusive(void **lock);
+        __declspec(dllimport) void __stdcall InitializeConditionVariable(void **cond);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **cond, void **lock, unsigned long msTimeout, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **cond);
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long msTimeout);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+
+        typedef void *JobMutex;
+        typedef void *JobCond;
+        typedef void *JobThread;
+
+        #define JOB_MUTEX_INITIALIZER   NULL        // SRWLOCK_INIT
+        #define JOB_MUTEX_INIT(m)       InitializeSRWLock(m)
+        #define JOB_MUTEX_DESTROY(m)    (void)0
+        #define JOB_MUTEX_LOCK(m)       AcquireSRWLockExclusive(m)
+        #define JOB_MUTEX_TRYLOCK(m)    (TryAcquireSRWLockExclusive(m) != 0)
+        #define JOB_MUTEX_UNLOCK(m)     ReleaseSRWLockExclusive(m)
+        #define JOB_COND_INIT(c)        InitializeConditionVariable(c)
+        #define JOB_COND_DESTROY(c)     (void)0
+        #define JOB_COND_WAIT(c, m)     SleepConditionVariableSRW(c, m, 0xFFFFFFFF, 0)
+        #define JOB_COND_BROADCAST(c)   WakeAllConditionVariable(c)
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_mutex_t, pthread_cond_t
+        #include <unistd.h>             // Required for: sysconf()
+
+        typedef pthread_mutex_t JobMutex;
+        typedef pthread_cond_t JobCond;
+        typedef pthread_t JobThread;
+
+        #define JOB_MUTEX_INITIALIZER   PTHREAD_MUTEX_INITIALIZER
+        #define JOB_MUTEX_INIT(m)       pthread_mutex_init(m, NULL)
+        #define JOB_MUTEX_DESTROY(m)    pthread_mutex_destroy(m)
+        #define JOB_MUTEX_LOCK(m)       pthread_mutex_lock(m)
+        #define JOB_MUTEX_TRYLOCK(m)    (pthread_mutex_trylock(m) == 0)
+        #define JOB_MUTEX_UNLOCK(m)     pthread_mutex_unlock(m)
+        #define JOB_COND_INIT(c)        pthread_cond_init(c, NULL)
+        #define JOB_COND_DESTROY(c)     pthread_cond_destroy(c)
+        #define JOB_COND_WAIT(c, m)     pthread_cond_wait(c, m)
+        #define JOB_COND_BROADCAST(c)   pthread_cond_broadcast(c)
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -56,17 +179,286 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_TRACELOG_ASYNC_MESSAGES
+    #define MAX_TRACELOG_ASYNC_MESSAGES 256         // Maximum trace-log messages queued in async mode (power of 2)
+#endif
+#ifndef MAX_JOB_THREADS
+    #define MAX_JOB_THREADS              32         // Maximum number of jobs system worker threads
+#endif
+#ifndef MAX_PACK_FILES
+    #define MAX_PACK_FILES                8         // Maximum number of mounted pack files
+#endif
+#ifndef MAX_ASYNC_LOAD_REQUESTS
+    #define MAX_ASYNC_LOAD_REQUESTS      64         // Maximum number of pending async load requests
+#endif
+#ifndef MAX_FRAME_MEMORY_SIZE
+    #define MAX_FRAME_MEMORY_SIZE    262144         // Frame memory size (bytes), used by text functions results
+#endif
+#ifndef MAX_TEXT_BUFFER_LENGTH
+    #define MAX_TEXT_BUFFER_LENGTH   262144         // Maximum length of formatted text results (bytes), longer results are truncated
+#endif
+#define FRAME_MEMORY_ALIGNMENT            8         // Frame memory allocations alignment (bytes)
+#define MEM_ARENA_ALIGNMENT              16         // Memory arena allocations alignment (bytes)
+#define MAX_MEMORY_MODULES                7         // Memory modules tracked (MemoryModule)
+#define MAX_MEMORY_TRACE_BLOCKS          32         // Maximum unfreed memory blocks logged by TraceMemoryBlocks()
+
+// Memory tracking lock, tracked allocations could happen on jobs, loader and audio threads
+#if defined(MEMORY_TRACKING_AVAILABLE) && defined(JOB_SYSTEM_AVAILABLE)
+    #define MEMORY_LOCK()   JOB_MUTEX_LOCK(&MEMORY.mutex)
+    #define MEMORY_UNLOCK() JOB_MUTEX_UNLOCK(&MEMORY.mutex)
+#else
+    #define MEMORY_LOCK()   (void)0
+    #define MEMORY_UNLOCK() (void)0
+#endif
+#define JOB_CHUNKS_PER_THREAD             8         // Items range chunks per thread, smaller chunks balance better
+
+#define PACK_FILE_VERSION                 1         // Pack file format version
+#define PACK_ENTRY_COMPRESSED        0x0001         // Pack entry flag: file data DEFLATE compressed
+
+// Async trace log: messages queue is lock-free, shared by any logging thread and the log writer thread
+#if defined(SUPPORT_TRACELOG) && defined(JOB_SYSTEM_AVAILABLE)
+    #define TRACELOG_ASYNC_AVAILABLE
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: _InterlockedOr(), _InterlockedExchange(), _InterlockedCompareExchange()
+        #define LOG_ATOMIC_LOAD(ptr)            ((unsigned int)_InterlockedOr((long volatile *)(ptr), 0))
+        #define LOG_ATOMIC_STORE(ptr, value)    _InterlockedExchange((long volatile *)(ptr), (long)(value))
+        #define LOG_ATOMIC_CAS(ptr, expected, desired) ((unsigned int)_InterlockedCompareExchange((long volatile *)(ptr), (long)(desired), (long)(expected)) == (expected))
+    #else
+        #define LOG_ATOMIC_LOAD(ptr)            __atomic_load_n(ptr, __ATOMIC_SEQ_CST)
+        #define LOG_ATOMIC_STORE(ptr, value)    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST)
+        #define LOG_ATOMIC_CAS(ptr, expected, desired) __sync_bool_compare_and_swap(ptr, expected, desired)
+    #endif
+
+    #if ((MAX_TRACELOG_ASYNC_MESSAGES & (MAX_TRACELOG_ASYNC_MESSAGES - 1)) != 0)
+        #error "MAX_TRACELOG_ASYNC_MESSAGES must be a power of 2"
+    #endif
+#endif
+
+// Async loader requests lock, only required with loader thread running
+#if defined(JOB_SYSTEM_AVAILABLE)
+    #define ASYNC_LOCK()    if (ASYNC.threadActive) JOB_MUTEX_LOCK(&ASYNC.mutex)
+    #define ASYNC_UNLOCK()  if (ASYNC.threadActive) JOB_MUTEX_UNLOCK(&ASYNC.mutex)
+#else
+    #define ASYNC_LOCK()    (void)0
+    #define ASYNC_UNLOCK()  (void)0
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Memory arena block, block data follows the header
+typedef struct MemArenaBlock {
+    struct MemArenaBlock *next;         // Next (older) arena block
+    unsigned int size;                  // Block data size (bytes)
+    unsigned int offset;                // Block data next allocation offset
+} MemArenaBlock;
+
+#define MEM_ARENA_BLOCK_HEADER  ((sizeof(MemArenaBlock) + MEM_ARENA_ALIGNMENT - 1) & ~(MEM_ARENA_ALIGNMENT - 1))
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+// Memory tracked block header, block data follows the header
+typedef struct MemoryBlock {
+    struct MemoryBlock *prev;           // Previous allocated block
+    struct MemoryBlock *next;           // Next allocated block
+    const char *file;                   // Allocation source file (NULL: user allocation)
+    unsigned int size;                  // Block data size (bytes)
+    int line;                           // Allocation source line
+    int module;                         // Allocation module (MemoryModule)
+    size_t cookie;                      // Tracked block cookie, MEMORY_BLOCK_COOKIE(block)
+} MemoryBlock;
+
+#define MEMORY_BLOCK_HEADER     ((sizeof(MemoryBlock) + MEM_ARENA_ALIGNMENT - 1) & ~(MEM_ARENA_ALIGNMENT - 1))
+
+// Tracked block cookie, block address mixed with a magic value, identifies memory not allocated by MemAlloc()
+// NOTE: Memory allocated by user (malloc() or custom allocator) can be passed to MemFree(), i.e. Image.data on UnloadImage()
+#define MEMORY_BLOCK_COOKIE(block)  ((size_t)(block) ^ (size_t)0x5241594C)
+
+// Memory tracking state
+typedef struct MemoryTracker {
+    MemoryBlock *blocks;                // Allocated blocks list (latest first)
+    MemoryStats stats[MAX_MEMORY_MODULES];  // Allocations stats by module
+    MemoryStats total;                  // Allocations stats, all modules
+#if defined(JOB_SYSTEM_AVAILABLE)
+    JobMutex mutex;                     // Allocated blocks list and stats mutex
+#endif
+} MemoryTracker;
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+// Pack file header (16 bytes)
+// NOTE: Pack files layout: [header][entries (sorted by hash and name)][names][files data], little-endian
+typedef struct PackHeader {
+    char id[4];                         // Pack file identifier: "rPAK"
+    unsigned int version;               // Pack file version: 1
+    unsigned int entryCount;            // Number of files entries
+    unsigned int namesSize;             // Names block size in bytes
+} PackHeader;
+
+// Pack file entry (28 bytes)
+typedef struct PackEntry {
+    unsigned int hash;                  // File name hash (FNV-1a, '/' path separators)
+    unsigned int nameOffset;            // File name offset in names block
+    unsigned int nameLength;            // File name length (no '\0' terminator)
+    unsigned int flags;                 // File flags: PACK_ENTRY_COMPRESSED
+    unsigned int offset;                // File data offset from pack start
+    unsigned int size;                  // File data size in pack (compressed size)
+    unsigned int dataSize;              // File data size (uncompressed size)
+} PackEntry;
+
+// Mounted pack file
+typedef struct PackFile {
+    unsigned char *data;                // Pack file data (mapped to memory)
+    unsigned int size;                  // Pack file size
+    unsigned int entryCount;            // Number of files entries
+    const unsigned char *entries;       // Files entries (PackEntry, possibly unaligned)
+    const char *names;                  // Names block
+} PackFile;
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+// Memory mapped file data, required to unmap data on UnloadFileDataMapped()
+typedef struct FileMapping {
+    unsigned char *data;                // Mapped file data (read-only)
+    unsigned int size;                  // Mapped file size
+    struct FileMapping *next;           // Next mapping
+} FileMapping;
+#endif
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+// Job items range owned by one thread, other threads steal half of it once their range is done
+typedef struct {
+    JobMutex mutex;                     // Range access mutex (owner takes chunks from start, thieves split end)
+    int start;                          // Range next item
+    int end;                            // Range end item (not included)
+} JobRange;
+
+// Jobs system state
+typedef struct {
+    int threadCount;                    // Worker threads count (calling thread not included)
+    JobThread threads[MAX_JOB_THREADS]; // Worker threads
+    JobRange ranges[MAX_JOB_THREADS + 1];   // Items ranges, one per worker plus calling thread (last)
+
+    JobMutex mutex;                     // Jobs state mutex
+    JobCond cond;                       // Jobs state condition (job started, job finished, close requested)
+    JobMutex jobMutex;                  // Current job mutex, only one parallel for processed at a time
+    unsigned int generation;            // Current job generation, incremented on every job start
+    int activeCount;                    // Threads still processing current job
+    bool quit;                          // Close requested
+
+    JobCallback callback;               // Current job callback
+    void *userData;                     // Current job user data
+    int grain;                          // Current job items per chunk
+} JobSystem;
+#endif
+
+// Async load request state
+typedef enum {
+    ASYNC_LOAD_FREE = 0,                // Request slot not used
+    ASYNC_LOAD_QUEUED,                  // Waiting to be decoded
+    ASYNC_LOAD_DECODING,                // Being decoded (loader thread)
+    ASYNC_LOAD_DECODED,                 // Waiting to be finalized (main thread)
+    ASYNC_LOAD_READY                    // Finalized, data can be retrieved
+} AsyncLoadState;
+
+// Async load request
+typedef struct {
+    int id;                             // Request id, requests are processed in id order
+    AsyncLoadState state;               // Request state
+    AsyncLoadCallback decode;           // Decode callback (file loading and decompression, no OpenGL calls)
+    AsyncLoadCallback finalize;         // Finalize callback (GPU data upload)
+    void *data;                         // Request data, owned by requesting module
+} AsyncLoadRequest;
+
+// Async loader state
+typedef struct {
+    AsyncLoadRequest requests[MAX_ASYNC_LOAD_REQUESTS];     // Requests slots
+    int nextId;                         // Next request id
+    int pendingCount;                   // Requests not finalized yet
+    AsyncLoadCallback continueDecode;   // Decode pass requested by request being finalized (main thread)
+#if defined(JOB_SYSTEM_AVAILABLE)
+    bool threadActive;                  // Loader thread running
+    bool quit;                          // Loader thread close requested
+    JobThread thread;                   // Loader thread
+    JobMutex mutex;                     // Requests access mutex
+    JobCond cond;                       // Request queued condition
+#endif
+} AsyncLoader;
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+// Trace log message queued in async mode, formatted by logging thread
+typedef struct TraceLogMessage {
+    unsigned int sequence;              // Slot sequence: position + 1 when message written, position + queue size when slot free
+    int logType;                        // Message log type
+    char text[MAX_TRACELOG_MSG_LENGTH]; // Message text, formatted
+} TraceLogMessage;
+
+// Async trace log state, bounded multi-producer single-consumer queue
+typedef struct TraceLogAsync {
+    TraceLogMessage messages[MAX_TRACELOG_ASYNC_MESSAGES];  // Messages queue (ring buffer)
+    unsigned int head;                  // Next position to write (logging threads)
+    unsigned int tail;                  // Next position to read (writer thread)
+    unsigned int dropped;               // Messages dropped because queue was full
+    unsigned int active;                // Async mode enabled, messages queued
+    unsigned int sleeping;              // Writer thread waiting for messages, logging threads must wake it up
+    bool quit;                          // Writer thread close requested
+    JobThread thread;                   // Writer thread
+    JobMutex mutex;                     // Writer thread wake up mutex
+    JobCond cond;                       // Message queued condition
+} TraceLogAsync;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static int logTypeLevel = LOG_INFO;                 // Minimum log type level
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+static TraceLogAsync LOGGER = { 0 };                // Async trace log state
+#endif
 
 static TraceLogCallback traceLog = NULL;            // TraceLog callback function pointer
 static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback function pointer
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
+static LoadFileDataMappedCallback loadFileDataMapped = NULL;        // LoadFileDataMapped callback function pointer
+static UnloadFileDataMappedCallback unloadFileDataMapped = NULL;    // UnloadFileDataMapped callback function pointer
+
+static MemAllocCallback memAlloc = NULL;            // Memory allocator allocate function pointer
+static MemReallocCallback memRealloc = NULL;        // Memory allocator reallocate function pointer
+static MemFreeCallback memFree = NULL;              // Memory allocator free function pointer
+static void *memUserData = NULL;                    // Memory allocator user data
+static unsigned int memBudget[MAX_MEMORY_MODULES] = { 0 };   // Memory budgets by module (bytes, 0: no budget)
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+#if defined(JOB_SYSTEM_AVAILABLE)
+static MemoryTracker MEMORY = { .mutex = JOB_MUTEX_INITIALIZER };   // Memory tracking state
+#else
+static MemoryTracker MEMORY = { 0 };                // Memory tracking state
+#endif
+static const char *memoryModuleNames[MAX_MEMORY_MODULES] = { "USER", "CORE", "RLGL", "TEXTURES", "TEXT", "MODELS", "AUDIO" };
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+static PackFile packs[MAX_PACK_FILES] = { 0 };      // Mounted pack files
+static int packCount = 0;                           // Mounted pack files count
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+static FileMapping *fileMappings = NULL;            // Memory mapped files list
+#if defined(JOB_SYSTEM_AVAILABLE)
+static JobMutex fileMappingsMutex = JOB_MUTEX_INITIALIZER;  // Memory mapped files list mutex (async loads run on loader thread)
+#endif
+#endif
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+static JobSystem JOBS = { 0 };                      // Jobs system state
+#endif
+static AsyncLoader ASYNC = { 0 };                   // Async loader state
+
+static char frameMemory[MAX_FRAME_MEMORY_SIZE] = { 0 };     // Frame memory, linear scratch arena
+static unsigned int frameMemoryOffset = 0;          // Frame memory next allocation offset
+static bool frameMemoryWrapped = false;             // Frame memory exhausted this frame (allocations restarted from beginning)
 
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
@@ -76,6 +468,29 @@ void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = cal
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
+void SetLoadFileDataMappedCallback(LoadFileDataMappedCallback callback) { loadFileDataMapped = callback; }        // Set custom file mapped data loader
+void SetUnloadFileDataMappedCallback(UnloadFileDataMappedCallback callback) { unloadFileDataMapped = callback; }  // Set custom file mapped data unloader
+
+// Set custom memory allocator used by all modules
+// WARNING: Memory allocated before changing the allocator must not be freed after it, call it before InitWindow()
+void SetMemoryAllocator(MemAllocCallback allocFunc, MemReallocCallback reallocFunc, MemFreeCallback freeFunc, void *userData)
+{
+    if ((allocFunc != NULL) && (reallocFunc != NULL) && (freeFunc != NULL))
+    {
+        memAlloc = allocFunc;
+        memRealloc = reallocFunc;
+        memFree = freeFunc;
+        memUserData = userData;
+    }
+    else if ((allocFunc == NULL) && (reallocFunc == NULL) && (freeFunc == NULL))
+    {
+        memAlloc = NULL;
+        memRealloc = NULL;
+        memFree = NULL;
+        memUserData = NULL;
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Memory allocator requires alloc, realloc and free functions");
+}
 
 
 #if defined(PLATFORM_ANDROID)
@@ -86,6 +501,16 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static void *MemAllocRaw(unsigned int size);        // Allocate memory with current allocator, not initialized or tracked
+static void *MemReallocRaw(void *ptr, unsigned int size);   // Reallocate memory with current allocator, not tracked
+static void MemFreeRaw(void *ptr);                  // Free memory with current allocator, not tracked
+static void *MemAllocNoInit(unsigned int size);     // Internal memory allocator, memory not initialized
+static bool GetMemArraySize(size_t count, size_t size, unsigned int *bytes);   // Get array size in bytes, returns false on overflow
+#if defined(MEMORY_TRACKING_AVAILABLE)
+static bool LinkMemoryBlock(MemoryBlock *block, bool allocated);   // Add memory block to tracked list, returns true if module budget got exceeded
+static void UnlinkMemoryBlock(MemoryBlock *block);  // Remove memory block from tracked list
+#endif
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -96,6 +521,41 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(JOB_SYSTEM_AVAILABLE)
+#if defined(_WIN32)
+static unsigned long __stdcall JobWorkerThread(void *arg);  // Jobs system worker thread
+#else
+static void *JobWorkerThread(void *arg);                    // Jobs system worker thread
+#endif
+static void ProcessJobRanges(int index);                    // Process current job items: own range chunks first, then steal from other ranges
+
+#if defined(_WIN32)
+static unsigned long __stdcall AsyncLoaderThread(void *arg);    // Async loader thread, decodes queued requests
+#else
+static void *AsyncLoaderThread(void *arg);                      // Async loader thread, decodes queued requests
+#endif
+#endif
+static AsyncLoadRequest *GetNextAsyncLoad(AsyncLoadState state);    // Get oldest request in state (NULL if none)
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+#if defined(_WIN32)
+static unsigned long __stdcall TraceLogThread(void *arg);   // Trace log writer thread, writes queued messages
+#else
+static void *TraceLogThread(void *arg);                     // Trace log writer thread, writes queued messages
+#endif
+static bool PushTraceLogMessage(int logType, const char *text, va_list args);   // Queue formatted trace log message (false if queue full)
+static void WriteTraceLogMessage(int logType, const char *text);                // Write formatted trace log message to output (or custom callback)
+static void TraceLogCallbackText(int logType, const char *text, ...);           // Call custom trace log callback with formatted text
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+static const char *GetPackName(const char *fileName);               // Get pack file name, leading "./" skipped
+static unsigned int GetPackNameHash(const char *fileName);          // Get pack file name hash, path normalized ('\\' to '/', no leading "./")
+static int ComparePackName(const char *fileName, const char *name, unsigned int nameLength);    // Compare normalized file name with pack entry name
+static bool FindPackEntry(const char *fileName, PackFile **pack, PackEntry *entry);             // Find file entry in mounted packs (last mounted first)
+static bool LoadPackFileData(const char *fileName, unsigned char **data, unsigned int *dataSize, bool mapped);  // Load file data from mounted packs
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -103,6 +563,60 @@ static int android_close(void *cookie);
 // Set the current threshold (minimum) log level
 void SetTraceLogLevel(int logType) { logTypeLevel = logType; }
 
+// Set trace log messages written by a background thread
+// NOTE: Messages are formatted by logging thread and queued, output (or custom callback) is done by writer thread,
+// messages exceeding MAX_TRACELOG_ASYNC_MESSAGES queued are dropped (and reported) instead of blocking the caller
+void SetTraceLogAsync(bool enabled)
+{
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+    if (enabled && !LOG_ATOMIC_LOAD(&LOGGER.active))
+    {
+        for (int i = 0; i < MAX_TRACELOG_ASYNC_MESSAGES; i++) LOGGER.messages[i].sequence = LOGGER.tail + i;
+        LOGGER.head = LOGGER.tail;
+        LOGGER.quit = false;
+
+        JOB_MUTEX_INIT(&LOGGER.mutex);
+        JOB_COND_INIT(&LOGGER.cond);
+
+    #if defined(_WIN32)
+        LOGGER.thread = CreateThread(NULL, 0, TraceLogThread, NULL, 0, NULL);
+        bool success = (LOGGER.thread != NULL);
+    #else
+        bool success = (pthread_create(&LOGGER.thread, NULL, &TraceLogThread, NULL) == 0);
+    #endif
+        if (success) LOG_ATOMIC_STORE(&LOGGER.active, 1);
+        else
+        {
+            JOB_COND_DESTROY(&LOGGER.cond);
+            JOB_MUTEX_DESTROY(&LOGGER.mutex);
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to create trace log writer thread");
+        }
+    }
+    else if (!enabled && LOG_ATOMIC_LOAD(&LOGGER.active))
+    {
+        // Writer thread writes all queued messages before closing
+        LOG_ATOMIC_STORE(&LOGGER.active, 0);
+
+        JOB_MUTEX_LOCK(&LOGGER.mutex);
+        LOGGER.quit = true;
+        JOB_COND_BROADCAST(&LOGGER.cond);
+        JOB_MUTEX_UNLOCK(&LOGGER.mutex);
+
+    #if defined(_WIN32)
+        WaitForSingleObject(LOGGER.thread, 0xFFFFFFFF);     // INFINITE
+        CloseHandle(LOGGER.thread);
+    #else
+        pthread_join(LOGGER.thread, NULL);
+    #endif
+
+        JOB_COND_DESTROY(&LOGGER.cond);
+        JOB_MUTEX_DESTROY(&LOGGER.mutex);
+    }
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "SYSTEM: Async trace log not supported (jobs system not available)");
+#endif
+}
+
 // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
 void TraceLog(int logType, const char *text, ...)
 {
@@ -113,6 +627,20 @@ void TraceLog(int logType, const char *text, ...)
     va_list args;
     va_start(args, text);
 
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+    if (LOG_ATOMIC_LOAD(&LOGGER.active))
+    {
+        // Fatal messages are written synchronously, after queued ones, program exits right after
+        if (logType == LOG_FATAL) SetTraceLogAsync(false);
+        else
+        {
+            PushTraceLogMessage(logType, text, args);
+            va_end(args);
+            return;
+        }
+    }
+#endif
+
     if (traceLog)
     {
         traceLog(logType, text, args);
@@ -163,21 +691,365 @@ void TraceLog(int logType, const char *text, ...)
 // NOTE: Initializes to zero by default
 void *MemAlloc(unsigned int size)
 {
-    void *ptr = RL_CALLOC(size, 1);
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    return MemAllocTracked(1, size, true, MEMORY_MODULE_USER, NULL, 0);
+#else
+    if (memAlloc == NULL) return MEM_DEFAULT_CALLOC(size, 1);
+
+    void *ptr = memAlloc(size, memUserData);
+    if (ptr != NULL) memset(ptr, 0, size);
+
     return ptr;
+#endif
 }
 
 // Internal memory reallocator
 void *MemRealloc(void *ptr, unsigned int size)
 {
-    void *ret = RL_REALLOC(ptr, size);
-    return ret;
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    return MemReallocTracked(ptr, size, MEMORY_MODULE_USER, NULL, 0);
+#else
+    return MemReallocRaw(ptr, size);
+#endif
 }
 
 // Internal memory free
 void MemFree(void *ptr)
 {
-    RL_FREE(ptr);
+    if (ptr == NULL) return;
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    MemoryBlock *block = (MemoryBlock *)((unsigned char *)ptr - MEMORY_BLOCK_HEADER);
+
+    // Memory not allocated by MemAlloc(), freed with current allocator
+    if (block->cookie != MEMORY_BLOCK_COOKIE(block))
+    {
+        MemFreeRaw(ptr);
+        return;
+    }
+
+    MEMORY_LOCK();
+    UnlinkMemoryBlock(block);
+    MEMORY_UNLOCK();
+
+    block->cookie = 0;
+    MemFreeRaw(block);
+#else
+    MemFreeRaw(ptr);
+#endif
+}
+
+// Internal memory allocator, memory not initialized
+// NOTE: Used by RL_MALLOC(), returns NULL if size does not fit allocators size (unsigned int)
+void *MemAllocUninit(size_t size)
+{
+    return MemAllocTracked(1, size, false, MEMORY_MODULE_USER, NULL, 0);
+}
+
+// Internal memory allocator for count elements, initialized to zero
+// NOTE: Used by RL_CALLOC(), returns NULL if count*size overflows
+void *MemAllocArray(size_t count, size_t size)
+{
+    return MemAllocTracked(count, size, true, MEMORY_MODULE_USER, NULL, 0);
+}
+
+// Internal memory reallocator for count elements
+// NOTE: Used by RL_REALLOC(), returns NULL if count*size overflows, ptr is not freed in that case
+void *MemReallocArray(void *ptr, size_t count, size_t size)
+{
+    unsigned int bytes = 0;
+    if (!GetMemArraySize(count, size, &bytes)) return NULL;
+
+    return MemRealloc(ptr, bytes);
+}
+
+// Allocate tracked memory, tagged with module and source location
+// NOTE: Memory is initialized to zero if requested, not tracked if memory tracking is not available
+void *MemAllocTracked(size_t count, size_t size, bool init, int module, const char *file, int line)
+{
+    unsigned int bytes = 0;
+    if (!GetMemArraySize(count, size, &bytes)) return NULL;
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    if (bytes > (UINT_MAX - MEMORY_BLOCK_HEADER)) return NULL;
+
+    MemoryBlock *block = (MemoryBlock *)MemAllocRaw(MEMORY_BLOCK_HEADER + bytes);
+    if (block == NULL) return NULL;
+
+    memset(block, 0, init? (MEMORY_BLOCK_HEADER + bytes) : MEMORY_BLOCK_HEADER);
+    block->file = file;
+    block->size = bytes;
+    block->line = line;
+    block->module = ((module >= 0) && (module < MAX_MEMORY_MODULES))? module : MEMORY_MODULE_USER;
+    block->cookie = MEMORY_BLOCK_COOKIE(block);
+
+    MEMORY_LOCK();
+    bool overBudget = LinkMemoryBlock(block, true);
+    MEMORY_UNLOCK();
+
+    if (overBudget) TRACELOG(LOG_WARNING, "MEMORY: [%s] Module memory budget exceeded (%u bytes)", memoryModuleNames[block->module], memBudget[block->module]);
+
+    return (unsigned char *)block + MEMORY_BLOCK_HEADER;
+#else
+    (void)module; (void)file; (void)line;
+    return init? MemAlloc(bytes) : MemAllocRaw(bytes);
+#endif
+}
+
+// Reallocate tracked memory
+// NOTE: Reallocated block keeps its module, source location is updated
+void *MemReallocTracked(void *ptr, size_t size, int module, const char *file, int line)
+{
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    if (ptr == NULL) return MemAllocTracked(1, size, false, module, file, line);
+    if (size > (UINT_MAX - MEMORY_BLOCK_HEADER)) return NULL;
+
+    MemoryBlock *block = (MemoryBlock *)((unsigned char *)ptr - MEMORY_BLOCK_HEADER);
+
+    // Memory not allocated by MemAlloc(), reallocated with current allocator and kept untracked
+    if (block->cookie != MEMORY_BLOCK_COOKIE(block)) return MemReallocRaw(ptr, (unsigned int)size);
+
+    MEMORY_LOCK();
+    UnlinkMemoryBlock(block);
+    MEMORY_UNLOCK();
+
+    MemoryBlock *newBlock = (MemoryBlock *)MemReallocRaw(block, (unsigned int)(MEMORY_BLOCK_HEADER + size));
+
+    if (newBlock != NULL)
+    {
+        newBlock->file = file;
+        newBlock->size = (unsigned int)size;
+        newBlock->line = line;
+        newBlock->cookie = MEMORY_BLOCK_COOKIE(newBlock);
+        block = newBlock;
+    }
+
+    MEMORY_LOCK();
+    bool overBudget = LinkMemoryBlock(block, false);
+    MEMORY_UNLOCK();
+
+    if (overBudget) TRACELOG(LOG_WARNING, "MEMORY: [%s] Module memory budget exceeded (%u bytes)", memoryModuleNames[block->module], memBudget[block->module]);
+
+    return (newBlock != NULL)? (unsigned char *)newBlock + MEMORY_BLOCK_HEADER : NULL;
+#else
+    (void)module; (void)file; (void)line;
+    return MemReallocArray(ptr, 1, size);
+#endif
+}
+
+// Get memory allocations stats by module (-1: all modules)
+// NOTE: Stats are only available with memory tracking (SUPPORT_MEMORY_TRACKING)
+MemoryStats GetMemoryStats(int module)
+{
+    MemoryStats stats = { 0 };
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    MEMORY_LOCK();
+    if (module < 0) stats = MEMORY.total;
+    else if (module < MAX_MEMORY_MODULES) stats = MEMORY.stats[module];
+    MEMORY_UNLOCK();
+#else
+    (void)module;
+#endif
+
+    return stats;
+}
+
+// Set memory budget for module, warning logged when exceeded
+void SetMemoryBudget(int module, unsigned int budget)
+{
+    if ((module >= 0) && (module < MAX_MEMORY_MODULES)) memBudget[module] = budget;
+
+#if !defined(MEMORY_TRACKING_AVAILABLE)
+    TRACELOG(LOG_WARNING, "MEMORY: Memory budgets require memory tracking (SUPPORT_MEMORY_TRACKING)");
+#endif
+}
+
+// Log allocated memory blocks, called on CloseWindow() to report unfreed blocks
+// NOTE: Blocks are copied with lock held and logged after, trace log callback could allocate memory
+void TraceMemoryBlocks(void)
+{
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    MemoryBlock blocks[MAX_MEMORY_TRACE_BLOCKS] = { 0 };
+    MemoryStats stats[MAX_MEMORY_MODULES] = { 0 };
+    int blockCount = 0;
+
+    MEMORY_LOCK();
+    for (MemoryBlock *block = MEMORY.blocks; (block != NULL) && (blockCount < MAX_MEMORY_TRACE_BLOCKS); block = block->next) blocks[blockCount++] = *block;
+    for (int i = 0; i < MAX_MEMORY_MODULES; i++) stats[i] = MEMORY.stats[i];
+    MemoryStats total = MEMORY.total;
+    MEMORY_UNLOCK();
+
+    if (total.count == 0) return;
+
+    TRACELOG(LOG_WARNING, "MEMORY: Unfreed memory blocks: %u (%u bytes)", total.count, total.current);
+
+    for (int i = 0; i < MAX_MEMORY_MODULES; i++)
+    {
+        if (stats[i].count > 0) TRACELOG(LOG_WARNING, "    > %s: %u blocks (%u bytes), peak: %u bytes", memoryModuleNames[i], stats[i].count, stats[i].current, stats[i].peak);
+    }
+
+    for (int i = 0; i < blockCount; i++)
+    {
+        if (blocks[i].file != NULL) TRACELOG(LOG_WARNING, "    > [%s] %u bytes allocated at %s:%i", memoryModuleNames[blocks[i].module], blocks[i].size, blocks[i].file, blocks[i].line);
+        else TRACELOG(LOG_WARNING, "    > [%s] %u bytes allocated by MemAlloc()", memoryModuleNames[blocks[i].module], blocks[i].size);
+    }
+
+    if (total.count > MAX_MEMORY_TRACE_BLOCKS) TRACELOG(LOG_WARNING, "    > ...%u more blocks", total.count - MAX_MEMORY_TRACE_BLOCKS);
+#endif
+}
+
+// Internal memory allocator, memory not initialized
+// NOTE: Used for arena blocks, memory must be released with MemFree()
+static void *MemAllocNoInit(unsigned int size)
+{
+#if defined(MEMORY_TRACKING_AVAILABLE)
+    return MemAllocTracked(1, size, false, MEMORY_MODULE_CORE, __FILE__, __LINE__);
+#else
+    return MemAllocRaw(size);
+#endif
+}
+
+// Load memory arena, memory blocks are allocated on demand
+MemArena LoadMemArena(unsigned int blockSize)
+{
+    MemArena arena = { 0 };
+    arena.blockSize = (blockSize > 0)? blockSize : 4096;
+
+    return arena;
+}
+
+// Unload memory arena, all arena allocations are released
+void UnloadMemArena(MemArena arena)
+{
+    MemArenaBlock *block = (MemArenaBlock *)arena.blocks;
+
+    while (block != NULL)
+    {
+        MemArenaBlock *next = block->next;
+        MemFree(block);
+        block = next;
+    }
+}
+
+// Reset memory arena, all arena allocations are released
+// NOTE: Current memory block is kept to be reused by next allocations
+void ResetMemArena(MemArena *arena)
+{
+    MemArenaBlock *block = (MemArenaBlock *)arena->blocks;
+    if (block == NULL) return;
+
+    MemArenaBlock *next = block->next;
+
+    while (next != NULL)
+    {
+        MemArenaBlock *older = next->next;
+        MemFree(next);
+        next = older;
+    }
+
+    block->next = NULL;
+    block->offset = 0;
+}
+
+// Allocate memory from arena
+// NOTE: Memory is not initialized, allocations bigger than arena block size get their own block
+void *MemArenaAlloc(MemArena *arena, unsigned int size)
+{
+    size = (size + MEM_ARENA_ALIGNMENT - 1) & ~(MEM_ARENA_ALIGNMENT - 1);
+
+    MemArenaBlock *block = (MemArenaBlock *)arena->blocks;
+
+    if ((block == NULL) || ((block->offset + size) > block->size))
+    {
+        unsigned int blockSize = (size > arena->blockSize)? size : arena->blockSize;
+        MemArenaBlock *newBlock = (MemArenaBlock *)MemAllocNoInit(MEM_ARENA_BLOCK_HEADER + blockSize);
+
+        if (newBlock == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate memory arena block (%u bytes)", blockSize);
+            return NULL;
+        }
+
+        newBlock->size = blockSize;
+        newBlock->offset = 0;
+
+        // Dedicated blocks for big allocations are placed behind current block, so it keeps being used
+        if ((block != NULL) && (size > arena->blockSize))
+        {
+            newBlock->next = block->next;
+            block->next = newBlock;
+        }
+        else
+        {
+            newBlock->next = block;
+            arena->blocks = newBlock;
+        }
+
+        block = newBlock;
+    }
+
+    void *ptr = (unsigned char *)block + MEM_ARENA_BLOCK_HEADER + block->offset;
+    block->offset += size;
+
+    return ptr;
+}
+
+// Load memory pool of fixed-size blocks
+// NOTE: Block size is aligned to pointer size, free blocks store next free block pointer
+MemPool LoadMemPool(unsigned int blockSize, unsigned int blockCount)
+{
+    MemPool pool = { 0 };
+
+    if (blockSize < sizeof(void *)) blockSize = sizeof(void *);
+    blockSize = (blockSize + sizeof(void *) - 1) & ~((unsigned int)sizeof(void *) - 1);
+
+    pool.data = (unsigned char *)MemAlloc(blockSize*blockCount);
+
+    if (pool.data != NULL)
+    {
+        pool.blockSize = blockSize;
+        pool.blockCount = blockCount;
+
+        // Link all blocks to free list, in memory order
+        for (unsigned int i = 0; i < blockCount; i++) *(void **)(pool.data + i*blockSize) = (i < (blockCount - 1))? pool.data + (i + 1)*blockSize : NULL;
+        pool.freeList = (blockCount > 0)? pool.data : NULL;
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate memory pool (%u x %u bytes)", blockCount, blockSize);
+
+    return pool;
+}
+
+// Unload memory pool
+void UnloadMemPool(MemPool pool)
+{
+    MemFree(pool.data);
+}
+
+// Allocate one block from pool
+// NOTE: Block memory is not initialized
+void *MemPoolAlloc(MemPool *pool)
+{
+    void *ptr = pool->freeList;
+    if (ptr != NULL) pool->freeList = *(void **)ptr;
+
+    return ptr;
+}
+
+// Free one block back to pool
+void MemPoolFree(MemPool *pool, void *ptr)
+{
+    if (ptr == NULL) return;
+
+    if (((unsigned char *)ptr < pool->data) || ((unsigned char *)ptr >= (pool->data + pool->blockSize*pool->blockCount)) ||
+        ((((unsigned char *)ptr - pool->data)%pool->blockSize) != 0))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Memory block does not belong to memory pool");
+        return;
+    }
+
+    *(void **)ptr = pool->freeList;
+    pool->freeList = ptr;
 }
 
 // Load data from file into a buffer
@@ -188,6 +1060,9 @@ unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_PACK_FILES)
+        if (LoadPackFileData(fileName, &data, bytesRead, false)) return data;
+#endif
         if (loadFileData)
         {
             data = loadFileData(fileName, bytesRead);
@@ -235,17 +1110,164 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
-// Save data to file from buffer
-bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
+// Load file data mapped to memory (read-only), file data is paged in on access, no copy required
+// NOTE: Falls back to LoadFileData() if mapping is not available or a custom file data loader is set,
+// returned data must not be modified and must be unloaded with UnloadFileDataMapped()
+unsigned char *LoadFileDataMapped(const char *fileName, unsigned int *bytesRead)
 {
-    bool success = false;
+    unsigned char *data = NULL;
+    *bytesRead = 0;
 
-    if (fileName != NULL)
+    if (fileName == NULL)
     {
-        if (saveFileData)
-        {
-            return saveFileData(fileName, data, bytesToWrite);
-        }
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return data;
+    }
+
+#if defined(SUPPORT_PACK_FILES)
+    if (LoadPackFileData(fileName, &data, bytesRead, true)) return data;    // NOTE: Uncompressed files are not copied
+#endif
+
+    if (loadFileDataMapped) return loadFileDataMapped(fileName, bytesRead);
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (loadFileData == NULL)
+    {
+        unsigned int size = 0;
+
+    #if defined(_WIN32)
+        void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x00000080, NULL);  // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (file != (void *)(size_t)-1)  // INVALID_HANDLE_VALUE
+        {
+            long long fileSize = 0;
+
+            if (GetFileSizeEx(file, &fileSize) && (fileSize > 0) && (fileSize <= 0xffffffff))
+            {
+                void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);  // PAGE_READONLY
+
+                if (mapping != NULL)
+                {
+                    data = (unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);    // FILE_MAP_READ
+                    CloseHandle(mapping);   // NOTE: Mapped view keeps the mapping alive
+                }
+
+                size = (unsigned int)fileSize;
+            }
+
+            CloseHandle(file);
+        }
+    #else
+        int file = open(fileName, O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat fileStat = { 0 };
+
+            if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0) && (fileStat.st_size <= 0xffffffff))
+            {
+                data = (unsigned char *)mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+                if (data == MAP_FAILED) data = NULL;
+
+                size = (unsigned int)fileStat.st_size;
+            }
+
+            close(file);    // NOTE: Mapping keeps a reference to the file
+        }
+    #endif
+
+        if (data != NULL)
+        {
+            FileMapping *mapping = (FileMapping *)RL_MALLOC(sizeof(FileMapping));
+            mapping->data = data;
+            mapping->size = size;
+
+        #if defined(JOB_SYSTEM_AVAILABLE)
+            JOB_MUTEX_LOCK(&fileMappingsMutex);
+        #endif
+            mapping->next = fileMappings;
+            fileMappings = mapping;
+        #if defined(JOB_SYSTEM_AVAILABLE)
+            JOB_MUTEX_UNLOCK(&fileMappingsMutex);
+        #endif
+
+            *bytesRead = size;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+
+            return data;
+        }
+
+        TRACELOG(LOG_DEBUG, "FILEIO: [%s] Failed to map file, loading file data", fileName);
+    }
+#endif
+
+    return LoadFileData(fileName, bytesRead);
+}
+
+// Unload file data loaded by LoadFileDataMapped()
+void UnloadFileDataMapped(unsigned char *data)
+{
+    if (data == NULL) return;
+
+#if defined(SUPPORT_PACK_FILES)
+    // Uncompressed pack files data is not copied, it's unloaded with the pack
+    for (int i = 0; i < packCount; i++)
+    {
+        if ((data >= packs[i].data) && (data <= packs[i].data + packs[i].size)) return;
+    }
+#endif
+
+    if (unloadFileDataMapped)
+    {
+        unloadFileDataMapped(data);
+        return;
+    }
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    FileMapping *mapping = NULL;
+
+    #if defined(JOB_SYSTEM_AVAILABLE)
+    JOB_MUTEX_LOCK(&fileMappingsMutex);
+    #endif
+    for (FileMapping **link = &fileMappings; *link != NULL; link = &(*link)->next)
+    {
+        if ((*link)->data == data)
+        {
+            mapping = *link;
+            *link = mapping->next;
+            break;
+        }
+    }
+    #if defined(JOB_SYSTEM_AVAILABLE)
+    JOB_MUTEX_UNLOCK(&fileMappingsMutex);
+    #endif
+
+    if (mapping != NULL)
+    {
+    #if defined(_WIN32)
+        UnmapViewOfFile(mapping->data);
+    #else
+        munmap(mapping->data, mapping->size);
+    #endif
+        RL_FREE(mapping);
+        return;
+    }
+#endif
+
+    UnloadFileData(data);   // Data loaded by LoadFileData() fallback
+}
+
+// Save data to file from buffer
+bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
+{
+    bool success = false;
+
+    if (fileName != NULL)
+    {
+        if (saveFileData)
+        {
+            return saveFileData(fileName, data, bytesToWrite);
+        }
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "wb");
 
@@ -323,6 +1345,19 @@ char *LoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_PACK_FILES)
+        unsigned char *data = NULL;
+        unsigned int dataSize = 0;
+
+        if (LoadPackFileData(fileName, &data, &dataSize, false))
+        {
+            text = (char *)RL_REALLOC(data, dataSize + 1);
+            if (text == NULL) RL_FREE(data);
+            else text[dataSize] = '\0';     // Zero-terminate the string
+
+            return text;
+        }
+#endif
         if (loadFileText)
         {
             text = loadFileText(fileName);
@@ -408,73 +1443,1225 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager, const char *dataPath)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Pack files
+//----------------------------------------------------------------------------------
+
+// Mount pack file, file paths are resolved through mounted packs first (last mounted first)
+// NOTE: Pack file is mapped to memory (if available) and kept until unmounted, entries index is validated
+bool MountPackFile(const char *fileName)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
+    bool success = false;
+
+#if defined(SUPPORT_PACK_FILES)
+    if (packCount >= MAX_PACK_FILES)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount pack file, too many packs mounted (MAX_PACK_FILES: %i)", fileName, MAX_PACK_FILES);
+        return false;
+    }
+
+    unsigned int size = 0;
+    unsigned char *data = LoadFileDataMapped(fileName, &size);
+
+    if (data != NULL)
+    {
+        PackHeader header = { 0 };
+        if (size >= sizeof(PackHeader)) memcpy(&header, data, sizeof(PackHeader));
+
+        unsigned long long indexSize = sizeof(PackHeader) + (unsigned long long)header.entryCount*sizeof(PackEntry) + header.namesSize;
+
+        if ((memcmp(header.id, "rPAK", 4) != 0) || (header.version != PACK_FILE_VERSION) || (indexSize > size))
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file not valid or version not supported", fileName);
+        }
+        else
+        {
+            PackFile pack = { 0 };
+            pack.data = data;
+            pack.size = size;
+            pack.entryCount = header.entryCount;
+            pack.entries = data + sizeof(PackHeader);
+            pack.names = (const char *)(pack.entries + header.entryCount*sizeof(PackEntry));
+
+            // Validate entries, pack data is accessed without further checks
+            success = true;
+
+            for (unsigned int i = 0; i < pack.entryCount; i++)
+            {
+                PackEntry entry = { 0 };
+                memcpy(&entry, pack.entries + i*sizeof(PackEntry), sizeof(PackEntry));
+
+                if (((unsigned long long)entry.nameOffset + entry.nameLength > header.namesSize) ||
+                    ((unsigned long long)entry.offset + entry.size > size) ||
+                    (((entry.flags & PACK_ENTRY_COMPRESSED) == 0) && (entry.size != entry.dataSize)))
+                {
+                    TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file entry %i not valid", fileName, i);
+                    success = false;
+                    break;
+                }
+            }
+
+            if (success)
+            {
+                packs[packCount] = pack;
+                packCount++;
+                TRACELOG(LOG_INFO, "FILEIO: [%s] Pack file mounted successfully (%i files)", fileName, pack.entryCount);
+            }
+        }
+
+        if (!success) UnloadFileDataMapped(data);
+    }
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack files not supported (SUPPORT_PACK_FILES)", fileName);
+#endif
+
+    return success;
 }
 
-// Replacement for fopen()
-// Ref: https://developer.android.com/ndk/reference/group/asset
-FILE *android_fopen(const char *fileName, const char *mode)
+// Unmount all pack files
+// NOTE: Data loaded from packs with LoadFileDataMapped() is not valid after unmounting
+void UnmountPackFiles(void)
 {
-    if (mode[0] == 'w')
+#if defined(SUPPORT_PACK_FILES)
+    int count = packCount;
+    packCount = 0;      // NOTE: Set first, pack data unloading is not considered pack file data
+
+    for (int i = 0; i < count; i++)
     {
-        // fopen() is mapped to android_fopen() that only grants read access to
-        // assets directory through AAssetManager but we want to also be able to
-        // write data when required using the standard stdio FILE access functions
-        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
-        #undef fopen
-        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-        #define fopen(name, mode) android_fopen(name, mode)
+        UnloadFileDataMapped(packs[i].data);
+        packs[i] = (PackFile){ 0 };
     }
-    else
+
+    if (count > 0) TRACELOG(LOG_INFO, "FILEIO: Pack files unmounted successfully (%i packs)", count);
+#endif
+}
+
+// Export pack file from files list, files are stored with provided names (use relative paths)
+// NOTE: Files are DEFLATE compressed if requested and compressed data is smaller
+bool ExportPackFile(const char *fileName, const char **files, int fileCount, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PACK_FILES)
+    if ((files == NULL) || (fileCount <= 0)) return false;
+
+    PackEntry *entries = (PackEntry *)RL_CALLOC(fileCount, sizeof(PackEntry));
+    unsigned char **filesData = (unsigned char **)RL_CALLOC(fileCount, sizeof(unsigned char *));
+    unsigned int namesSize = 0;
+    unsigned long long dataSize = 0;
+
+    success = true;
+
+    for (int i = 0; i < fileCount; i++)
     {
-        // NOTE: AAsset provides access to read-only asset
-        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+        unsigned int size = 0;
+        unsigned char *data = LoadFileData(files[i], &size);
 
-        if (asset != NULL)
+        if ((data == NULL) && (size == 0) && !FileExists(files[i]))
         {
-            // Get pointer to file in the assets
-            return funopen(asset, android_read, android_write, android_seek, android_close);
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to add file to pack", files[i]);
+            success = false;
+            break;
         }
-        else
+
+        entries[i].hash = GetPackNameHash(files[i]);
+        entries[i].dataSize = size;
+        entries[i].size = size;
+
+    #if defined(SUPPORT_COMPRESSION_API)
+        if (compress && (size > 0))
         {
-            #undef fopen
-            // Just do a regular open if file is not found in the assets
-            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-            #define fopen(name, mode) android_fopen(name, mode)
+            int compSize = 0;
+            unsigned char *compData = CompressData(data, (int)size, &compSize);
+
+            if ((compData != NULL) && (compSize > 0) && ((unsigned int)compSize < size))
+            {
+                RL_FREE(data);
+                data = compData;
+                entries[i].size = (unsigned int)compSize;
+                entries[i].flags |= PACK_ENTRY_COMPRESSED;
+            }
+            else RL_FREE(compData);
+        }
+    #endif
+
+        filesData[i] = data;
+        dataSize += entries[i].size;
+        namesSize += (unsigned int)strlen(GetPackName(files[i]));
+    }
+
+    // NOTE: Pack data is padded, DEFLATE decompressor reads input in 8 bytes words (up to 15 bytes past data end)
+    unsigned long long packSize = sizeof(PackHeader) + (unsigned long long)fileCount*sizeof(PackEntry) + namesSize + dataSize + 16;
+
+    if (success && (packSize > 0xffffffff))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file size exceeds 4GB", fileName);
+        success = false;
+    }
+
+    if (success)
+    {
+        // Sort entries by hash, required for binary search on lookup
+        // NOTE: Simple insertion sort of indices, files data offsets computed after sorting
+        int *order = (int *)RL_MALLOC(fileCount*sizeof(int));
+        for (int i = 0; i < fileCount; i++) order[i] = i;
+
+        for (int i = 1; i < fileCount; i++)
+        {
+            int current = order[i];
+            int j = i - 1;
+
+            while ((j >= 0) && (entries[order[j]].hash > entries[current].hash))
+            {
+                order[j + 1] = order[j];
+                j--;
+            }
+
+            order[j + 1] = current;
+        }
+
+        unsigned char *pack = (unsigned char *)RL_CALLOC((size_t)packSize, 1);
+        PackHeader header = { { 'r', 'P', 'A', 'K' }, PACK_FILE_VERSION, (unsigned int)fileCount, namesSize };
+        memcpy(pack, &header, sizeof(PackHeader));
+
+        unsigned char *entriesPtr = pack + sizeof(PackHeader);
+        char *namesPtr = (char *)(entriesPtr + fileCount*sizeof(PackEntry));
+        unsigned int nameOffset = 0;
+        unsigned int dataOffset = (unsigned int)(sizeof(PackHeader) + fileCount*sizeof(PackEntry) + namesSize);
+
+        for (int i = 0; i < fileCount; i++)
+        {
+            PackEntry entry = entries[order[i]];
+            const char *name = GetPackName(files[order[i]]);
+
+            // Store normalized name: '/' separators, no leading "./"
+            entry.nameLength = (unsigned int)strlen(name);
+            entry.nameOffset = nameOffset;
+            for (unsigned int c = 0; c < entry.nameLength; c++) namesPtr[nameOffset + c] = (name[c] == '\\')? '/' : name[c];
+            nameOffset += entry.nameLength;
+
+            entry.offset = dataOffset;
+            if (entry.size > 0) memcpy(pack + dataOffset, filesData[order[i]], entry.size);
+            dataOffset += entry.size;
+
+            memcpy(entriesPtr + i*sizeof(PackEntry), &entry, sizeof(PackEntry));
         }
+
+        success = SaveFileData(fileName, pack, (unsigned int)packSize);
+
+        RL_FREE(pack);
+        RL_FREE(order);
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Pack file exported successfully (%i files)", fileName, fileCount);
     }
+
+    for (int i = 0; i < fileCount; i++) RL_FREE(filesData[i]);
+    RL_FREE(filesData);
+    RL_FREE(entries);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack files not supported (SUPPORT_PACK_FILES)", fileName);
+#endif
+
+    return success;
+}
+
+// Get file info from mounted packs, returns true if file found (dataSize: uncompressed size)
+bool GetPackFileInfo(const char *fileName, unsigned int *dataSize)
+{
+    bool found = false;
+
+#if defined(SUPPORT_PACK_FILES)
+    PackFile *pack = NULL;
+    PackEntry entry = { 0 };
+
+    found = FindPackEntry(fileName, &pack, &entry);
+    if (found && (dataSize != NULL)) *dataSize = entry.dataSize;
+#endif
+
+    return found;
 }
-#endif  // PLATFORM_ANDROID
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Jobs system
 //----------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
-static int android_read(void *cookie, char *buf, int size)
+
+// Initialize jobs system worker threads (0: one per CPU core minus one)
+// NOTE: Calling thread also processes items on JobParallelFor(), so threadCount workers are created
+void InitJobSystem(int threadCount)
 {
-    return AAsset_read((AAsset *)cookie, buf, size);
+#if defined(JOB_SYSTEM_AVAILABLE)
+    if (JOBS.threadCount > 0) CloseJobSystem();
+
+    if (threadCount <= 0)
+    {
+    #if defined(_WIN32)
+        threadCount = (int)GetActiveProcessorCount(0xFFFF) - 1;     // ALL_PROCESSOR_GROUPS
+    #else
+        threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    #endif
+    }
+
+    if (threadCount > MAX_JOB_THREADS) threadCount = MAX_JOB_THREADS;
+    if (threadCount <= 0) return;   // Single core, jobs processed serially
+
+    JOB_MUTEX_INIT(&JOBS.mutex);
+    JOB_MUTEX_INIT(&JOBS.jobMutex);
+    JOB_COND_INIT(&JOBS.cond);
+    for (int i = 0; i < MAX_JOB_THREADS + 1; i++) JOB_MUTEX_INIT(&JOBS.ranges[i].mutex);
+
+    JOBS.quit = false;
+    JOBS.generation = 0;
+    JOBS.activeCount = 0;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+    #if defined(_WIN32)
+        JOBS.threads[i] = CreateThread(NULL, 0, JobWorkerThread, (void *)(size_t)i, 0, NULL);
+        bool success = (JOBS.threads[i] != NULL);
+    #else
+        bool success = (pthread_create(&JOBS.threads[i], NULL, &JobWorkerThread, (void *)(size_t)i) == 0);
+    #endif
+        if (!success)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to create jobs worker thread %i", i);
+            break;
+        }
+
+        JOBS.threadCount++;
+    }
+
+    TRACELOG(LOG_INFO, "SYSTEM: Jobs system initialized successfully (%i worker threads)", JOBS.threadCount);
+#endif
 }
 
-static int android_write(void *cookie, const char *buf, int size)
+// Close jobs system, worker threads are finished
+void CloseJobSystem(void)
 {
-    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
+#if defined(JOB_SYSTEM_AVAILABLE)
+    if (JOBS.threadCount == 0) return;
 
-    return EACCES;
+    JOB_MUTEX_LOCK(&JOBS.mutex);
+    JOBS.quit = true;
+    JOB_COND_BROADCAST(&JOBS.cond);
+    JOB_MUTEX_UNLOCK(&JOBS.mutex);
+
+    for (int i = 0; i < JOBS.threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(JOBS.threads[i], 0xFFFFFFFF);   // INFINITE
+        CloseHandle(JOBS.threads[i]);
+    #else
+        pthread_join(JOBS.threads[i], NULL);
+    #endif
+    }
+
+    for (int i = 0; i < MAX_JOB_THREADS + 1; i++) JOB_MUTEX_DESTROY(&JOBS.ranges[i].mutex);
+    JOB_COND_DESTROY(&JOBS.cond);
+    JOB_MUTEX_DESTROY(&JOBS.jobMutex);
+    JOB_MUTEX_DESTROY(&JOBS.mutex);
+
+    JOBS.threadCount = 0;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Jobs system closed successfully");
+#endif
 }
 
-static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+// Get jobs system threads count, including calling thread (1: serial)
+int GetJobThreadCount(void)
 {
-    return AAsset_seek((AAsset *)cookie, offset, whence);
+#if defined(JOB_SYSTEM_AVAILABLE)
+    return JOBS.threadCount + 1;
+#else
+    return 1;
+#endif
 }
 
-static int android_close(void *cookie)
+// Process items [0, count) in parallel, returns when all processed
+// NOTE: Items are split in one range per thread, every thread processes its range chunks and then
+// steals half of the biggest pending range, nested or concurrent calls are processed serially
+void JobParallelFor(int count, JobCallback callback, void *userData)
 {
-    AAsset_close((AAsset *)cookie);
-    return 0;
+    if ((count <= 0) || (callback == NULL)) return;
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+    int threadCount = JOBS.threadCount + 1;
+
+    if ((JOBS.threadCount > 0) && (count > 1) && JOB_MUTEX_TRYLOCK(&JOBS.jobMutex))
+    {
+        int grain = count/(threadCount*JOB_CHUNKS_PER_THREAD);
+        if (grain < 1) grain = 1;
+
+        // Split items into ranges, calling thread gets last range
+        for (int i = 0; i < threadCount; i++)
+        {
+            JOBS.ranges[i].start = (int)((long long)count*i/threadCount);
+            JOBS.ranges[i].end = (int)((long long)count*(i + 1)/threadCount);
+        }
+
+        JOB_MUTEX_LOCK(&JOBS.mutex);
+        JOBS.callback = callback;
+        JOBS.userData = userData;
+        JOBS.grain = grain;
+        JOBS.activeCount = threadCount;
+        JOBS.generation++;
+        JOB_COND_BROADCAST(&JOBS.cond);
+        JOB_MUTEX_UNLOCK(&JOBS.mutex);
+
+        ProcessJobRanges(JOBS.threadCount);
+
+        // Wait for workers to finish their chunks
+        JOB_MUTEX_LOCK(&JOBS.mutex);
+        JOBS.activeCount--;
+        if (JOBS.activeCount == 0) JOB_COND_BROADCAST(&JOBS.cond);
+        while (JOBS.activeCount > 0) JOB_COND_WAIT(&JOBS.cond, &JOBS.mutex);
+        JOB_MUTEX_UNLOCK(&JOBS.mutex);
+
+        JOB_MUTEX_UNLOCK(&JOBS.jobMutex);
+        return;
+    }
+#endif
+
+    callback(0, count, userData);
 }
-#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Async loading
+//----------------------------------------------------------------------------------
+
+// Queue async load request, returns request id (-1: queue full)
+// NOTE: decode callback could be NULL if all the work requires main thread, data is owned by caller
+int LoadAsync(AsyncLoadCallback decode, AsyncLoadCallback finalize, void *data)
+{
+    int id = -1;
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+    if (!ASYNC.threadActive)
+    {
+        JOB_MUTEX_INIT(&ASYNC.mutex);
+        JOB_COND_INIT(&ASYNC.cond);
+        ASYNC.quit = false;
+
+    #if defined(_WIN32)
+        ASYNC.thread = CreateThread(NULL, 0, AsyncLoaderThread, NULL, 0, NULL);
+        ASYNC.threadActive = (ASYNC.thread != NULL);
+    #else
+        ASYNC.threadActive = (pthread_create(&ASYNC.thread, NULL, &AsyncLoaderThread, NULL) == 0);
+    #endif
+
+        if (!ASYNC.threadActive)
+        {
+            JOB_COND_DESTROY(&ASYNC.cond);
+            JOB_MUTEX_DESTROY(&ASYNC.mutex);
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to create async loader thread, loads decoded on main thread");
+        }
+        else TRACELOG(LOG_INFO, "SYSTEM: Async loader thread initialized successfully");
+    }
+
+#endif
+
+    ASYNC_LOCK();
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        AsyncLoadRequest *request = &ASYNC.requests[i];
+
+        if (request->state == ASYNC_LOAD_FREE)
+        {
+            ASYNC.nextId = (ASYNC.nextId < 0x7fffffff)? ASYNC.nextId + 1 : 1;
+            id = ASYNC.nextId;
+
+            request->id = id;
+            request->decode = decode;
+            request->finalize = finalize;
+            request->data = data;
+            request->state = (decode != NULL)? ASYNC_LOAD_QUEUED : ASYNC_LOAD_DECODED;
+            ASYNC.pendingCount++;
+            break;
+        }
+    }
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+    if (ASYNC.threadActive) JOB_COND_BROADCAST(&ASYNC.cond);
+#endif
+    ASYNC_UNLOCK();
+
+    if (id < 0) TRACELOG(LOG_WARNING, "SYSTEM: Async load requests queue full (MAX_ASYNC_LOAD_REQUESTS: %i)", MAX_ASYNC_LOAD_REQUESTS);
+
+    return id;
+}
+
+// Check if an async load request is finalized, its asset can be retrieved
+bool IsAsyncLoadReady(int request)
+{
+    bool ready = false;
+
+    ASYNC_LOCK();
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        if ((ASYNC.requests[i].id == request) && (ASYNC.requests[i].state == ASYNC_LOAD_READY)) { ready = true; break; }
+    }
+    ASYNC_UNLOCK();
+
+    return ready;
+}
+
+// Get finalized request data and release request (NULL: not ready or finalize not matching)
+// NOTE: finalize callback is used to validate requested asset type
+void *GetAsyncLoadData(int request, AsyncLoadCallback finalize)
+{
+    void *data = NULL;
+
+    ASYNC_LOCK();
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        AsyncLoadRequest *slot = &ASYNC.requests[i];
+
+        if ((slot->id == request) && (slot->state == ASYNC_LOAD_READY) && (slot->finalize == finalize))
+        {
+            data = slot->data;
+
+            slot->id = 0;
+            slot->data = NULL;
+            slot->state = ASYNC_LOAD_FREE;
+            break;
+        }
+    }
+    ASYNC_UNLOCK();
+
+    return data;
+}
+
+// Finalize decoded requests on main thread, up to time budget (seconds)
+// NOTE: At least one request is finalized per call, requests are finalized in queue order
+void ProcessAsyncLoads(double budget)
+{
+    if (ASYNC.pendingCount == 0) return;
+
+    double startTime = GetTime();
+
+    while (ASYNC.pendingCount > 0)
+    {
+        bool decode = false;
+
+        ASYNC_LOCK();
+        AsyncLoadRequest *request = GetNextAsyncLoad(ASYNC_LOAD_DECODED);
+#if defined(JOB_SYSTEM_AVAILABLE)
+        if (!ASYNC.threadActive)
+#endif
+        {
+            // No loader thread available, requests decoded on main thread
+            if (request == NULL) request = GetNextAsyncLoad(ASYNC_LOAD_QUEUED);
+            decode = ((request != NULL) && (request->state == ASYNC_LOAD_QUEUED));
+        }
+        ASYNC_UNLOCK();
+
+        if (request == NULL) break;     // Requests still being decoded
+
+        // NOTE: Decoded requests are only accessed by main thread
+        ASYNC.continueDecode = NULL;
+        if (decode) request->decode(request->data);
+        if (request->finalize != NULL) request->finalize(request->data);
+
+        ASYNC_LOCK();
+        if (ASYNC.continueDecode != NULL)
+        {
+            // Request queued again for another decode pass (ContinueAsyncLoad())
+            request->decode = ASYNC.continueDecode;
+            request->state = ASYNC_LOAD_QUEUED;
+            ASYNC.continueDecode = NULL;
+        #if defined(JOB_SYSTEM_AVAILABLE)
+            if (ASYNC.threadActive) JOB_COND_BROADCAST(&ASYNC.cond);
+        #endif
+        }
+        else
+        {
+            request->state = ASYNC_LOAD_READY;
+            ASYNC.pendingCount--;
+        }
+        ASYNC_UNLOCK();
+
+        if ((GetTime() - startTime) >= budget) break;
+    }
+}
+
+// Continue request being finalized with another decode pass, finalized again after it
+// NOTE: Only valid inside a finalize callback, i.e. decode into GPU memory mapped on finalize
+void ContinueAsyncLoad(AsyncLoadCallback decode)
+{
+    ASYNC.continueDecode = decode;
+}
+
+// Close async loader thread, pending requests are discarded
+// NOTE: Request data owned by modules is not freed, retrieve all requests before closing
+void CloseAsyncLoads(void)
+{
+#if defined(JOB_SYSTEM_AVAILABLE)
+    if (ASYNC.threadActive)
+    {
+        JOB_MUTEX_LOCK(&ASYNC.mutex);
+        ASYNC.quit = true;
+        JOB_COND_BROADCAST(&ASYNC.cond);
+        JOB_MUTEX_UNLOCK(&ASYNC.mutex);
+
+    #if defined(_WIN32)
+        WaitForSingleObject(ASYNC.thread, 0xFFFFFFFF);     // INFINITE
+        CloseHandle(ASYNC.thread);
+    #else
+        pthread_join(ASYNC.thread, NULL);
+    #endif
+
+        JOB_COND_DESTROY(&ASYNC.cond);
+        JOB_MUTEX_DESTROY(&ASYNC.mutex);
+        ASYNC.threadActive = false;
+    }
+#endif
+
+    if (ASYNC.pendingCount > 0) TRACELOG(LOG_WARNING, "SYSTEM: Async loader closed with %i pending requests", ASYNC.pendingCount);
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++) ASYNC.requests[i] = (AsyncLoadRequest){ 0 };
+    ASYNC.pendingCount = 0;
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
+}
+
+// Replacement for fopen()
+// Ref: https://developer.android.com/ndk/reference/group/asset
+FILE *android_fopen(const char *fileName, const char *mode)
+{
+    if (mode[0] == 'w')
+    {
+        // fopen() is mapped to android_fopen() that only grants read access to
+        // assets directory through AAssetManager but we want to also be able to
+        // write data when required using the standard stdio FILE access functions
+        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
+        #undef fopen
+        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+        #define fopen(name, mode) android_fopen(name, mode)
+    }
+    else
+    {
+        // NOTE: AAsset provides access to read-only asset
+        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+
+        if (asset != NULL)
+        {
+            // Get pointer to file in the assets
+            return funopen(asset, android_read, android_write, android_seek, android_close);
+        }
+        else
+        {
+            #undef fopen
+            // Just do a regular open if file is not found in the assets
+            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+            #define fopen(name, mode) android_fopen(name, mode)
+        }
+    }
+}
+#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Frame memory
+//----------------------------------------------------------------------------------
+// Allocate frame memory, valid until ResetFrameMemory() is called (EndDrawing())
+// NOTE: Frame memory is a linear arena, allocation just moves the offset, no need to free it.
+// If it gets exhausted, allocations restart from the beginning, overwriting older frame results
+char *AllocFrameMemory(unsigned int size)
+{
+    size = (size + FRAME_MEMORY_ALIGNMENT - 1) & ~(FRAME_MEMORY_ALIGNMENT - 1);
+
+    if (size > MAX_FRAME_MEMORY_SIZE)
+    {
+        TRACELOG(LOG_WARNING, "UTILS: Requested frame memory (%u bytes) exceeds MAX_FRAME_MEMORY_SIZE", size);
+        return NULL;
+    }
+
+    if ((frameMemoryOffset + size) > MAX_FRAME_MEMORY_SIZE)
+    {
+        // NOTE: Debug builds warn on every wrap, release builds only once per frame
+#if defined(_DEBUG)
+        TRACELOG(LOG_WARNING, "UTILS: Frame memory exhausted, older frame text results overwritten");
+#else
+        if (!frameMemoryWrapped) TRACELOG(LOG_WARNING, "UTILS: Frame memory exhausted, older frame text results overwritten");
+#endif
+
+        frameMemoryWrapped = true;
+        frameMemoryOffset = 0;
+    }
+
+    char *ptr = frameMemory + frameMemoryOffset;
+    frameMemoryOffset += size;
+
+    return ptr;
+}
+
+// Format text into frame memory
+// NOTE: Text is formatted directly into available frame memory, only formatted again if it does not fit,
+// text longer than MAX_TEXT_BUFFER_LENGTH (or frame memory size) is truncated
+char *FormatFrameMemory(const char *text, va_list args)
+{
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+
+    char *buffer = frameMemory + frameMemoryOffset;
+    unsigned int available = MAX_FRAME_MEMORY_SIZE - frameMemoryOffset;
+    unsigned int maxLength = ((MAX_TEXT_BUFFER_LENGTH < MAX_FRAME_MEMORY_SIZE)? MAX_TEXT_BUFFER_LENGTH : MAX_FRAME_MEMORY_SIZE) - 1;
+    int length = vsnprintf(buffer, available, text, args);
+
+    if (length < 0) buffer = NULL;
+    else
+    {
+        if ((unsigned int)length > maxLength)
+        {
+            TRACELOG(LOG_WARNING, "UTILS: Formatted text truncated (%i bytes) to MAX_TEXT_BUFFER_LENGTH", length);
+            length = (int)maxLength;
+        }
+
+        if ((unsigned int)length < available)
+        {
+            // Text already formatted in place, truncated text requires a new end of string
+            buffer = AllocFrameMemory(length + 1);
+            if (buffer != NULL) buffer[length] = '\0';
+        }
+        else
+        {
+            buffer = AllocFrameMemory(length + 1);
+            if (buffer != NULL) vsnprintf(buffer, length + 1, text, argsCopy);
+        }
+    }
+
+    va_end(argsCopy);
+
+    return buffer;
+}
+
+// Reset frame memory, all previous frame memory allocations expire
+void ResetFrameMemory(void)
+{
+    frameMemoryOffset = 0;
+    frameMemoryWrapped = false;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Allocate memory with current allocator (SetMemoryAllocator()), not initialized or tracked
+static void *MemAllocRaw(unsigned int size)
+{
+    if (memAlloc == NULL) return MEM_DEFAULT_MALLOC(size);
+
+    return memAlloc(size, memUserData);
+}
+
+// Get array size in bytes, returns false if count*size overflows allocators size (unsigned int)
+static bool GetMemArraySize(size_t count, size_t size, unsigned int *bytes)
+{
+    if ((size != 0) && (count > UINT_MAX/size)) return false;
+
+    *bytes = (unsigned int)(count*size);
+
+    return true;
+}
+
+// Reallocate memory with current allocator, not tracked
+static void *MemReallocRaw(void *ptr, unsigned int size)
+{
+    if (memRealloc == NULL) return MEM_DEFAULT_REALLOC(ptr, size);
+
+    return memRealloc(ptr, size, memUserData);
+}
+
+// Free memory with current allocator, not tracked
+static void MemFreeRaw(void *ptr)
+{
+    if (memFree == NULL) MEM_DEFAULT_FREE(ptr);
+    else memFree(ptr, memUserData);
+}
+
+#if defined(MEMORY_TRACKING_AVAILABLE)
+// Add memory block to tracked list and update module stats
+// NOTE: Requires memory tracking lock, returns true if module budget got exceeded by this block
+static bool LinkMemoryBlock(MemoryBlock *block, bool allocated)
+{
+    block->prev = NULL;
+    block->next = MEMORY.blocks;
+    if (MEMORY.blocks != NULL) MEMORY.blocks->prev = block;
+    MEMORY.blocks = block;
+
+    MemoryStats *stats[2] = { &MEMORY.stats[block->module], &MEMORY.total };
+
+    for (int i = 0; i < 2; i++)
+    {
+        stats[i]->current += block->size;
+        stats[i]->count++;
+        if (allocated) stats[i]->total++;
+        if (stats[i]->current > stats[i]->peak) stats[i]->peak = stats[i]->current;
+    }
+
+    unsigned int budget = memBudget[block->module];
+
+    return ((budget > 0) && (MEMORY.stats[block->module].current > budget) && ((MEMORY.stats[block->module].current - block->size) <= budget));
+}
+
+// Remove memory block from tracked list and update module stats
+// NOTE: Requires memory tracking lock
+static void UnlinkMemoryBlock(MemoryBlock *block)
+{
+    if (block->prev != NULL) block->prev->next = block->next;
+    else MEMORY.blocks = block->next;
+    if (block->next != NULL) block->next->prev = block->prev;
+
+    MEMORY.stats[block->module].current -= block->size;
+    MEMORY.stats[block->module].count--;
+    MEMORY.total.current -= block->size;
+    MEMORY.total.count--;
+}
+#endif
+
+#if defined(PLATFORM_ANDROID)
+static int android_read(void *cookie, char *buf, int size)
+{
+    return AAsset_read((AAsset *)cookie, buf, size);
+}
+
+static int android_write(void *cookie, const char *buf, int size)
+{
+    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
+
+    return EACCES;
+}
+
+static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+{
+    return AAsset_seek((AAsset *)cookie, offset, whence);
+}
+
+static int android_close(void *cookie)
+{
+    AAsset_close((AAsset *)cookie);
+    return 0;
+}
+#endif  // PLATFORM_ANDROID
+
+#if defined(JOB_SYSTEM_AVAILABLE)
+// Jobs system worker thread
+#if defined(_WIN32)
+static unsigned long __stdcall JobWorkerThread(void *arg)
+#else
+static void *JobWorkerThread(void *arg)
+#endif
+{
+    int index = (int)(size_t)arg;
+    unsigned int generation = 0;
+
+    while (true)
+    {
+        // Wait for next job start (or close request)
+        JOB_MUTEX_LOCK(&JOBS.mutex);
+        while ((JOBS.generation == generation) && !JOBS.quit) JOB_COND_WAIT(&JOBS.cond, &JOBS.mutex);
+        bool quit = JOBS.quit;
+        generation = JOBS.generation;
+        JOB_MUTEX_UNLOCK(&JOBS.mutex);
+
+        if (quit) break;
+
+        ProcessJobRanges(index);
+
+        JOB_MUTEX_LOCK(&JOBS.mutex);
+        JOBS.activeCount--;
+        if (JOBS.activeCount == 0) JOB_COND_BROADCAST(&JOBS.cond);
+        JOB_MUTEX_UNLOCK(&JOBS.mutex);
+    }
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+// Process current job items: own range chunks first, then steal from other ranges
+static void ProcessJobRanges(int index)
+{
+    int threadCount = JOBS.threadCount + 1;
+    JobRange *range = &JOBS.ranges[index];
+
+    while (true)
+    {
+        // Take next chunk from own range start
+        JOB_MUTEX_LOCK(&range->mutex);
+        int start = range->start;
+        int end = start + JOBS.grain;
+        if (end > range->end) end = range->end;
+        range->start = end;
+        JOB_MUTEX_UNLOCK(&range->mutex);
+
+        if (start < end)
+        {
+            JOBS.callback(start, end, JOBS.userData);
+            continue;
+        }
+
+        // Own range done, steal second half of the biggest pending range
+        int victim = -1;
+        int pending = 0;
+
+        for (int i = 1; i < threadCount; i++)
+        {
+            JobRange *other = &JOBS.ranges[(index + i)%threadCount];
+            int otherPending = other->end - other->start;     // NOTE: Unlocked read, just a hint
+
+            if (otherPending > pending) { pending = otherPending; victim = (index + i)%threadCount; }
+        }
+
+        if (victim < 0) break;      // Nothing pending, job done for this thread
+
+        JobRange *other = &JOBS.ranges[victim];
+        JOB_MUTEX_LOCK(&other->mutex);
+        int stolenEnd = other->end;
+        int stolenStart = other->start + (other->end - other->start)/2;
+        if (stolenStart < other->start + 1) stolenStart = (other->end > other->start)? other->end - 1 : other->end;
+        other->end = stolenStart;
+        JOB_MUTEX_UNLOCK(&other->mutex);
+
+        JOB_MUTEX_LOCK(&range->mutex);
+        range->start = stolenStart;
+        range->end = stolenEnd;
+        JOB_MUTEX_UNLOCK(&range->mutex);
+    }
+}
+
+// Async loader thread, decodes queued requests
+#if defined(_WIN32)
+static unsigned long __stdcall AsyncLoaderThread(void *arg)
+#else
+static void *AsyncLoaderThread(void *arg)
+#endif
+{
+    JOB_MUTEX_LOCK(&ASYNC.mutex);
+
+    while (!ASYNC.quit)
+    {
+        AsyncLoadRequest *request = GetNextAsyncLoad(ASYNC_LOAD_QUEUED);
+
+        if (request == NULL)
+        {
+            JOB_COND_WAIT(&ASYNC.cond, &ASYNC.mutex);
+            continue;
+        }
+
+        // NOTE: Decoding request slot is not released or reused by main thread
+        request->state = ASYNC_LOAD_DECODING;
+        JOB_MUTEX_UNLOCK(&ASYNC.mutex);
+
+        request->decode(request->data);
+
+        JOB_MUTEX_LOCK(&ASYNC.mutex);
+        request->state = ASYNC_LOAD_DECODED;
+    }
+
+    JOB_MUTEX_UNLOCK(&ASYNC.mutex);
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+#endif
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+// Trace log writer thread, writes queued messages
+#if defined(_WIN32)
+static unsigned long __stdcall TraceLogThread(void *arg)
+#else
+static void *TraceLogThread(void *arg)
+#endif
+{
+    unsigned int droppedReported = LOG_ATOMIC_LOAD(&LOGGER.dropped);
+
+    while (true)
+    {
+        TraceLogMessage *message = &LOGGER.messages[LOGGER.tail & (MAX_TRACELOG_ASYNC_MESSAGES - 1)];
+
+        if (LOG_ATOMIC_LOAD(&message->sequence) == (LOGGER.tail + 1))
+        {
+            WriteTraceLogMessage(message->logType, message->text);
+
+            LOG_ATOMIC_STORE(&message->sequence, LOGGER.tail + MAX_TRACELOG_ASYNC_MESSAGES);     // Release slot to logging threads
+            LOGGER.tail++;
+            continue;
+        }
+
+        // Queue empty, report dropped messages before waiting
+        unsigned int dropped = LOG_ATOMIC_LOAD(&LOGGER.dropped);
+        if (dropped != droppedReported)
+        {
+            char text[MAX_TRACELOG_MSG_LENGTH] = { 0 };
+            snprintf(text, MAX_TRACELOG_MSG_LENGTH, "SYSTEM: Trace log queue full, %u messages dropped", dropped - droppedReported);
+            WriteTraceLogMessage(LOG_WARNING, text);
+            droppedReported = dropped;
+        }
+
+        // NOTE: Sleeping flag is set before checking queue again, logging threads check it after queueing,
+        // so a message queued meanwhile is detected here or its logging thread wakes up writer thread
+        JOB_MUTEX_LOCK(&LOGGER.mutex);
+        LOG_ATOMIC_STORE(&LOGGER.sleeping, 1);
+
+        if (LOG_ATOMIC_LOAD(&message->sequence) != (LOGGER.tail + 1))
+        {
+            if (LOGGER.quit)
+            {
+                LOG_ATOMIC_STORE(&LOGGER.sleeping, 0);
+                JOB_MUTEX_UNLOCK(&LOGGER.mutex);
+                break;
+            }
+
+            JOB_COND_WAIT(&LOGGER.cond, &LOGGER.mutex);
+        }
+
+        LOG_ATOMIC_STORE(&LOGGER.sleeping, 0);
+        JOB_MUTEX_UNLOCK(&LOGGER.mutex);
+    }
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+// Queue formatted trace log message (false if queue full)
+// NOTE: Bounded queue slots sequences avoid locks between logging threads, a slot is claimed moving head forward
+static bool PushTraceLogMessage(int logType, const char *text, va_list args)
+{
+    TraceLogMessage *message = NULL;
+    unsigned int position = LOG_ATOMIC_LOAD(&LOGGER.head);
+
+    while (message == NULL)
+    {
+        TraceLogMessage *slot = &LOGGER.messages[position & (MAX_TRACELOG_ASYNC_MESSAGES - 1)];
+        int diff = (int)(LOG_ATOMIC_LOAD(&slot->sequence) - position);
+
+        if (diff == 0)
+        {
+            if (LOG_ATOMIC_CAS(&LOGGER.head, position, position + 1)) message = slot;
+            else position = LOG_ATOMIC_LOAD(&LOGGER.head);
+        }
+        else if (diff < 0)
+        {
+            // Queue full, message dropped instead of waiting for writer thread
+            unsigned int dropped = LOG_ATOMIC_LOAD(&LOGGER.dropped);
+            while (!LOG_ATOMIC_CAS(&LOGGER.dropped, dropped, dropped + 1)) dropped = LOG_ATOMIC_LOAD(&LOGGER.dropped);
+            return false;
+        }
+        else position = LOG_ATOMIC_LOAD(&LOGGER.head);
+    }
+
+    message->logType = logType;
+    vsnprintf(message->text, MAX_TRACELOG_MSG_LENGTH, text, args);
+    LOG_ATOMIC_STORE(&message->sequence, position + 1);     // Publish message to writer thread
+
+    // Wake up writer thread if waiting, lock only taken in that case
+    if (LOG_ATOMIC_LOAD(&LOGGER.sleeping))
+    {
+        JOB_MUTEX_LOCK(&LOGGER.mutex);
+        JOB_COND_BROADCAST(&LOGGER.cond);
+        JOB_MUTEX_UNLOCK(&LOGGER.mutex);
+    }
+
+    return true;
+}
+
+// Write formatted trace log message to output (or custom callback)
+static void WriteTraceLogMessage(int logType, const char *text)
+{
+    if (traceLog)
+    {
+        TraceLogCallbackText(logType, "%s", text);
+        return;
+    }
+
+#if defined(PLATFORM_ANDROID)
+    switch (logType)
+    {
+        case LOG_TRACE: __android_log_write(ANDROID_LOG_VERBOSE, "raylib", text); break;
+        case LOG_DEBUG: __android_log_write(ANDROID_LOG_DEBUG, "raylib", text); break;
+        case LOG_INFO: __android_log_write(ANDROID_LOG_INFO, "raylib", text); break;
+        case LOG_WARNING: __android_log_write(ANDROID_LOG_WARN, "raylib", text); break;
+        case LOG_ERROR: __android_log_write(ANDROID_LOG_ERROR, "raylib", text); break;
+        default: break;
+    }
+#else
+    switch (logType)
+    {
+        case LOG_TRACE: printf("TRACE: %s\n", text); break;
+        case LOG_DEBUG: printf("DEBUG: %s\n", text); break;
+        case LOG_INFO: printf("INFO: %s\n", text); break;
+        case LOG_WARNING: printf("WARNING: %s\n", text); break;
+        case LOG_ERROR: printf("ERROR: %s\n", text); break;
+        default: printf("%s\n", text); break;
+    }
+    fflush(stdout);
+#endif
+}
+
+// Call custom trace log callback with formatted text
+static void TraceLogCallbackText(int logType, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    traceLog(logType, text, args);
+    va_end(args);
+}
+#endif
+
+// Get oldest request in state (NULL if none)
+static AsyncLoadRequest *GetNextAsyncLoad(AsyncLoadState state)
+{
+    AsyncLoadRequest *next = NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        AsyncLoadRequest *request = &ASYNC.requests[i];
+
+        if ((request->state == state) && ((next == NULL) || (request->id < next->id))) next = request;
+    }
+
+    return next;
+}
+
+#if defined(SUPPORT_PACK_FILES)
+// Get pack file name, leading "./" skipped
+static const char *GetPackName(const char *fileName)
+{
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    return fileName;
+}
+
+// Get pack file name hash, path normalized ('\\' to '/', no leading "./")
+// NOTE: Using FNV-1a 32bit hash
+static unsigned int GetPackNameHash(const char *fileName)
+{
+    unsigned int hash = 2166136261u;
+
+    for (const char *c = GetPackName(fileName); *c != '\0'; c++)
+    {
+        hash ^= (unsigned char)((*c == '\\')? '/' : *c);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Compare normalized file name with pack entry name
+static int ComparePackName(const char *fileName, const char *name, unsigned int nameLength)
+{
+    const char *c = GetPackName(fileName);
+    unsigned int i = 0;
+
+    for (; (i < nameLength) && (c[i] != '\0'); i++)
+    {
+        char ch = (c[i] == '\\')? '/' : c[i];
+        if (ch != name[i]) return (int)(unsigned char)ch - (int)(unsigned char)name[i];
+    }
+
+    if (i < nameLength) return -1;          // File name shorter
+    return (c[i] != '\0')? 1 : 0;          // File name longer or equal
+}
+
+// Find file entry in mounted packs (last mounted first)
+static bool FindPackEntry(const char *fileName, PackFile **pack, PackEntry *entry)
+{
+    if ((packCount == 0) || (fileName == NULL)) return false;
+
+    unsigned int hash = GetPackNameHash(fileName);
+
+    for (int p = packCount - 1; p >= 0; p--)
+    {
+        PackFile *current = &packs[p];
+
+        // Binary search first entry with hash
+        unsigned int low = 0;
+        unsigned int high = current->entryCount;
+
+        while (low < high)
+        {
+            unsigned int mid = low + (high - low)/2;
+            unsigned int midHash = 0;
+            memcpy(&midHash, current->entries + mid*sizeof(PackEntry), sizeof(unsigned int));
+
+            if (midHash < hash) low = mid + 1;
+            else high = mid;
+        }
+
+        // Check all entries with same hash (collisions)
+        for (unsigned int i = low; i < current->entryCount; i++)
+        {
+            memcpy(entry, current->entries + i*sizeof(PackEntry), sizeof(PackEntry));
+
+            if (entry->hash != hash) break;
+
+            if (ComparePackName(fileName, current->names + entry->nameOffset, entry->nameLength) == 0)
+            {
+                *pack = current;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Load file data from mounted packs
+// NOTE: If mapped requested, uncompressed files data is returned directly from pack memory
+static bool LoadPackFileData(const char *fileName, unsigned char **data, unsigned int *dataSize, bool mapped)
+{
+    PackFile *pack = NULL;
+    PackEntry entry = { 0 };
+
+    if (!FindPackEntry(fileName, &pack, &entry)) return false;
+
+    *data = NULL;
+    *dataSize = 0;
+
+    if ((entry.flags & PACK_ENTRY_COMPRESSED) == 0)
+    {
+        if (mapped) *data = pack->data + entry.offset;
+        else
+        {
+            *data = (unsigned char *)RL_MALLOC((entry.dataSize > 0)? entry.dataSize : 1);
+            memcpy(*data, pack->data + entry.offset, entry.dataSize);
+        }
+
+        *dataSize = entry.dataSize;
+    }
+    else
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        int size = (int)entry.dataSize;
+        *data = DecompressDataEx(pack->data + entry.offset, (int)entry.size, &size);     // NOTE: Only required memory allocated
+
+        if ((unsigned int)size != entry.dataSize)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress pack file data", fileName);
+            RL_FREE(*data);
+            *data = NULL;
+        }
+        else *dataSize = entry.dataSize;
+#else
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file data compressed, compression API not supported", fileName);
+#endif
+    }
+
+    if (*data != NULL) TRACELOG(LOG_DEBUG, "FILEIO: [%s] File loaded from pack successfully", fileName);
+
+    return true;    // NOTE: File found in pack, even if not loaded
+}
+#endif
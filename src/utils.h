@@ -27,6 +27,8 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stdarg.h>                         // Required for: va_list
+
 #if defined(PLATFORM_ANDROID)
     #include <stdio.h>                      // Required for: FILE
     #include <android/asset_manager.h>      // Required for: AAssetManager
@@ -45,6 +47,29 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    #define PROFILE_BEGIN(name) BeginProfileScope(name)
+    #define PROFILE_END() EndProfileScope()
+#else
+    #define PROFILE_BEGIN(name) (void)0
+    #define PROFILE_END() (void)0
+#endif
+
+// Memory tracking, modules allocations are tagged with MEMORY_MODULE (defined by modules before including utils.h)
+// NOTE: Only available with default memory allocators, custom RL_MALLOC/RL_FREE... are not tracked
+#if defined(SUPPORT_MEMORY_TRACKING) && defined(RL_MEMORY_DEFAULT)
+    #ifndef MEMORY_MODULE
+        #define MEMORY_MODULE MEMORY_MODULE_CORE
+    #endif
+
+    #undef RL_MALLOC
+    #undef RL_CALLOC
+    #undef RL_REALLOC
+    #define RL_MALLOC(sz)       MemAllocTracked(1, sz, false, MEMORY_MODULE, __FILE__, __LINE__)
+    #define RL_CALLOC(n,sz)     MemAllocTracked(n, sz, true, MEMORY_MODULE, __FILE__, __LINE__)
+    #define RL_REALLOC(ptr,sz)  MemReallocTracked(ptr, sz, MEMORY_MODULE, __FILE__, __LINE__)
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -55,7 +80,7 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+typedef void (*AsyncLoadCallback)(void *data);      // Async load request processing step (decode or finalize)
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +99,33 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+// NOTE: Jobs system functions are declared in raylib.h: InitJobSystem(), JobParallelFor()...
+// modules use JobParallelFor() directly, items are processed serially if jobs system is not initialized
+
+// Pack files, used by FileExists() and GetFileLength() to resolve paths through mounted packs
+bool GetPackFileInfo(const char *fileName, unsigned int *dataSize);    // Get file info from mounted packs, returns true if file found
+
+// Async loading, used by modules to implement LoadTextureAsync(), LoadFontAsync()...
+// NOTE: decode callback runs on loader thread (no OpenGL calls allowed), finalize callback runs on main thread
+int LoadAsync(AsyncLoadCallback decode, AsyncLoadCallback finalize, void *data);   // Queue async load request, returns request id (-1: queue full)
+void *GetAsyncLoadData(int request, AsyncLoadCallback finalize);    // Get finalized request data and release request (NULL: not ready or finalize not matching)
+void ContinueAsyncLoad(AsyncLoadCallback decode);                   // Continue request being finalized with another decode pass, finalized again after it
+void ProcessAsyncLoads(double budget);                              // Finalize decoded requests on main thread, up to time budget (seconds)
+void CloseAsyncLoads(void);                                         // Close async loader thread, pending requests are discarded
+
+// Memory tracking, allocations tagged by module, used by RL_MALLOC/RL_REALLOC with SUPPORT_MEMORY_TRACKING
+// NOTE: Memory allocated by tracked functions is released with MemFree()
+void *MemAllocTracked(size_t count, size_t size, bool init, int module, const char *file, int line);  // Allocate tracked memory for count elements (NULL: size overflow)
+void *MemReallocTracked(void *ptr, size_t size, int module, const char *file, int line);     // Reallocate tracked memory, keeps block module
+void TraceMemoryBlocks(void);                                       // Log allocated memory blocks (unfreed blocks on CloseWindow())
+
+// Frame memory, linear scratch arena used by modules to return text results: TextFormat(), TextJoin()...
+// NOTE: Frame memory is reset by EndDrawing(), returned memory must not be freed
+// WARNING: Frame memory is not thread-safe, it must be used from main thread only
+char *AllocFrameMemory(unsigned int size);                          // Allocate frame memory (NULL: size exceeds MAX_FRAME_MEMORY_SIZE)
+char *FormatFrameMemory(const char *text, va_list args);            // Format text into frame memory
+void ResetFrameMemory(void);                                        // Reset frame memory, previous allocations expire
+
 #if defined(__cplusplus)
 }
 #endif
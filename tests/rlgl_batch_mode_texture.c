@@ -0,0 +1,50 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] test - Render batch texture kept across draw mode changes
+*
+*   Textured quads drawn right after a lines draw must keep their texture, with and without
+*   RLGL_ENABLE_MULTI_TEXTURE_BATCH (texture slots of previous draw are not used by new draw)
+*
+*   Test returns 0 on success, 1 on failure
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>      // Required for: printf()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(64, 64, "raylib [rlgl] test - render batch mode texture");
+
+    Image image = GenImageColor(16, 16, RED);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    RenderTexture2D target = LoadRenderTexture(64, 64);
+
+    BeginTextureMode(target);
+        ClearBackground(BLACK);
+        DrawLineBezier((Vector2){ 2, 60 }, (Vector2){ 60, 40 }, 1.0f, GREEN);   // Lines draw
+        DrawTexture(texture, 24, 8, WHITE);                                     // Quads draw, texture set before rlBegin()
+    EndTextureMode();
+
+    Image result = LoadImageFromTexture(target.texture);
+    Color color = GetImageColor(result, 32, 64 - 16);   // Render texture is vertically flipped
+    UnloadImage(result);
+
+    UnloadRenderTexture(target);
+    UnloadTexture(texture);
+    CloseWindow();
+
+    bool passed = ((color.r == RED.r) && (color.g == RED.g) && (color.b == RED.b));
+    printf("Textured quads after lines draw: %s (pixel color: %i, %i, %i)\n", passed? "PASSED" : "FAILED", color.r, color.g, color.b);
+
+    return passed? 0 : 1;
+}